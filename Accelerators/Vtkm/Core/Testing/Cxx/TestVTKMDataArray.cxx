@@ -105,6 +105,25 @@ void TestWithArrayHandle(const ArrayHandleType& vtkmArray)
   }
 }
 
+//------------------------------------------------------------------------------
+void TestHostPointer()
+{
+  vtkm::cont::ArrayHandle<vtkm::Vec3f_32> vtkmArray;
+  vtkmArray.Allocate(4);
+  vtkmArray.Fill(vtkm::Vec3f_32{ 1.0f, 2.0f, 3.0f });
+
+  vtkSmartPointer<vtkDataArray> vtkArray;
+  vtkArray.TakeReference(make_vtkmDataArray(vtkmArray));
+  auto values = static_cast<float*>(vtkArray->GetVoidPointer(0));
+  TEST_VERIFY(values != nullptr, "no host pointer for a basic ArrayHandle");
+  TEST_VERIFY(values[10] == 2.0f, "wrong values through the host pointer");
+  TEST_VERIFY(vtkArray->GetVoidPointer(4) == values + 4, "wrong offset of the host pointer");
+
+  // writes through the pointer are seen by VTK-m
+  values[10] = 5.0f;
+  TEST_VERIFY(vtkmArray.ReadPortal().Get(3)[1] == 5.0f, "write through the host pointer lost");
+}
+
 //------------------------------------------------------------------------------
 template <typename T, bool IsInteger = std::is_integral<T>::value>
 struct UniformDistribution;
@@ -302,6 +321,10 @@ try
   TestWithArrayHandle(vtkm::cont::make_ArrayHandle(testData, vtkm::CopyFlag::Off));
   std::cout << "Passed\n";
 
+  std::cout << "Testing host pointer of Basic ArrayHandle\n";
+  TestHostPointer();
+  std::cout << "Passed\n";
+
   std::cout << "Testing with ArrayHandleConstant\n";
   TestWithArrayHandle(vtkm::cont::make_ArrayHandleConstant(
     vtkm::Vec<vtkm::Vec<float, 3>, 3>{ { 1.0f, 2.0f, 3.0f } }, 10));
@@ -36,6 +36,11 @@
  * 3. Any modifications made through this class' API is not guarenteed to be reflected via the
  *    ArrayHandle interface.
  *
+ * For the ArrayHandles with a basic storage, GetVoidPointer returns a pointer to the values in
+ * host memory. The values are only copied from the device when this is called, and the device
+ * side copy is updated again the next time the ArrayHandle is used by VTK-m. See
+ * fromvtkm::SetKeepArraysOnDevice to have the VTK-m filters output such arrays.
+ *
  * @sa vtkGenericDataArray
  */
 
@@ -86,6 +91,13 @@ public:
   ///
   vtkm::cont::UnknownArrayHandle GetVtkmUnknownArrayHandle() const;
 
+  /// @brief Get a pointer to the values in host memory, copying them from the device if needed.
+  ///
+  /// Only supported for basic storage ArrayHandles, an error is reported for the other ones.
+  /// Writes through this pointer are seen by the next VTK-m use of the ArrayHandle.
+  ///
+  void* GetVoidPointer(vtkIdType valueIdx) override;
+
 protected:
   vtkmDataArray();
   ~vtkmDataArray() override;
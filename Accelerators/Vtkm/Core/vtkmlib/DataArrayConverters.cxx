@@ -25,6 +25,8 @@
 #include "vtkDataArray.h"
 #include "vtkPoints.h"
 
+#include <atomic>
+
 namespace fromvtkm
 {
 VTK_ABI_NAMESPACE_BEGIN
@@ -32,6 +34,8 @@ VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
 
+std::atomic<bool> KeepArraysOnDevice(false);
+
 struct ArrayConverter
 {
 public:
@@ -64,6 +68,12 @@ public:
       return;
     }
 
+    if (KeepArraysOnDevice)
+    {
+      this->Data = make_vtkmDataArray(handle);
+      return;
+    }
+
     VTKArrayType* array = VTKArrayType::New();
     array->SetNumberOfComponents(Traits::NUM_COMPONENTS);
 
@@ -140,6 +150,16 @@ public:
 };
 } // anonymous namespace
 
+void SetKeepArraysOnDevice(bool value)
+{
+  KeepArraysOnDevice = value;
+}
+
+bool GetKeepArraysOnDevice()
+{
+  return KeepArraysOnDevice;
+}
+
 // Though the following conversion routines take const-ref parameters as input,
 // the underlying storage will be stolen, whenever possible, instead of
 // performing a full copy.
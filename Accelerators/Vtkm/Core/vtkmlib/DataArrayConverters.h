@@ -133,6 +133,20 @@ vtkDataArray* Convert(const vtkm::cont::UnknownArrayHandle& input, const char* n
 VTKACCELERATORSVTKMCORE_EXPORT
 vtkPoints* Convert(const vtkm::cont::CoordinateSystem& input);
 
+///@{
+/**
+ * When on, the basic storage arrays of the VTK-m results are wrapped in a vtkmDataArray instead
+ * of being moved to a vtkAOSDataArrayTemplate, which would copy them to the host. They then stay
+ * on the device through a pipeline of VTK-m filters, and are only copied to the host when a VTK
+ * consumer accesses their values. Off by default.
+ */
+VTKACCELERATORSVTKMCORE_EXPORT
+void SetKeepArraysOnDevice(bool value);
+
+VTKACCELERATORSVTKMCORE_EXPORT
+bool GetKeepArraysOnDevice();
+///@}
+
 VTK_ABI_NAMESPACE_END
 }
 
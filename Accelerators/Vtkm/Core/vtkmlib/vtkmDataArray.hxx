@@ -23,6 +23,7 @@
 #include "vtkObjectFactory.h"
 
 #include <vtkm/cont/Algorithm.h>
+#include <vtkm/cont/ArrayHandleBasic.h>
 #include <vtkm/cont/ArrayHandleCounting.h>
 #include <vtkm/cont/ArrayHandleDecorator.h>
 #include <vtkm/cont/ArrayHandleGroupVecVariable.h>
@@ -427,6 +428,7 @@ public:
     vtkm::UInt8 ghostValueToSkip, bool finitesOnly) = 0;
   virtual bool ComputeVectorRange(double range[2], const unsigned char* ghosts,
     vtkm::UInt8 ghostValueToSkip, bool finitesOnly) = 0;
+  virtual void* GetHostPointer() = 0;
   virtual vtkm::cont::UnknownArrayHandle GetArrayHandle() const = 0;
 };
 
@@ -640,6 +642,40 @@ public:
     return true;
   }
 
+private:
+  template <typename AH>
+  static void* GetHostPointerImpl(AH&)
+  {
+    return nullptr;
+  }
+
+  template <typename V>
+  static void* GetHostPointerImpl(vtkm::cont::ArrayHandle<V, vtkm::cont::StorageTagBasic>& array)
+  {
+    return vtkm::cont::ArrayHandleBasic<V>(array).GetWritePointer();
+  }
+
+  static void* GetHostPointerImpl(
+    ArrayHandleRuntimeVecBase<typename vtkm::VecTraits<VecType>::ComponentType>& array)
+  {
+    using ComponentType = typename vtkm::VecTraits<VecType>::ComponentType;
+
+    const auto& sub = static_cast<const ArrayHandleRuntimeVec<ComponentType>&>(array);
+    auto components = sub.GetComponentsArray();
+    return GetHostPointerImpl(components);
+  }
+
+public:
+  void* GetHostPointer() override
+  {
+    // Getting the write pointer copies the values to the host if they are only on a device, and
+    // marks the device side buffers as outdated so that they are updated on the next device use
+    void* pointer = this->GetHostPointerImpl(this->Array);
+    this->ReadPortalValid = false;
+    this->WritePortalValid = false;
+    return pointer;
+  }
+
   vtkm::cont::UnknownArrayHandle GetArrayHandle() const override
   {
     this->ReadPortalValid = false;
@@ -740,6 +776,19 @@ vtkm::cont::UnknownArrayHandle vtkmDataArray<T>::GetVtkmUnknownArrayHandle() con
   return {};
 }
 
+//-----------------------------------------------------------------------------
+template <typename T>
+void* vtkmDataArray<T>::GetVoidPointer(vtkIdType valueIdx)
+{
+  void* pointer = this->Helper ? this->Helper->GetHostPointer() : nullptr;
+  if (!pointer)
+  {
+    // reports that the array has no contiguous memory
+    return this->Superclass::GetVoidPointer(valueIdx);
+  }
+  return static_cast<ValueType*>(pointer) + valueIdx;
+}
+
 //-----------------------------------------------------------------------------
 template <typename T>
 auto vtkmDataArray<T>::GetValue(vtkIdType valueIdx) const -> ValueType
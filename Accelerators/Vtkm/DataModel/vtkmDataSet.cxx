@@ -27,6 +27,7 @@
 #include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkNew.h"
 #include "vtkPoints.h"
 
@@ -81,6 +82,7 @@ vtkmDataSet::vtkmDataSet()
 vtkmDataSet::~vtkmDataSet() = default;
 
 vtkStandardNewMacro(vtkmDataSet);
+vtkInformationKeyMacro(vtkmDataSet, VTKM_DATASET, ObjectBase);
 
 void vtkmDataSet::PrintSelf(ostream& os, vtkIndent indent)
 {
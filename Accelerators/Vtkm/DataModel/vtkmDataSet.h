@@ -41,6 +41,7 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkPoints;
 class vtkCell;
 class vtkGenericCell;
+class vtkInformationObjectBaseKey;
 
 class VTKACCELERATORSVTKMDATAMODEL_EXPORT vtkmDataSet : public vtkDataSet
 {
@@ -53,6 +54,13 @@ public:
   void SetVtkmDataSet(const vtkm::cont::DataSet& ds);
   vtkm::cont::DataSet GetVtkmDataSet() const;
 
+  /**
+   * Key of the information of the outputs of the VTK-m filters where their VTK-m result is kept,
+   * as a vtkmDataSet, when fromvtkm::GetKeepArraysOnDevice() is on. The next VTK-m filter then
+   * uses it instead of converting the output back to VTK-m, unless the output was modified.
+   */
+  static vtkInformationObjectBaseKey* VTKM_DATASET();
+
   /**
    * Copy the geometric and topological structure of an object. Note that
    * the invoking object and the object pointed to by the parameter ds must
@@ -23,6 +23,8 @@
 #include "UnstructuredGridConverter.h"
 
 #include "vtkmDataArray.h"
+#include "vtkmDataSet.h"
+#include "vtkmlib/DataSetUtils.h"
 
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
@@ -31,6 +33,7 @@
 #include "vtkDataObjectTypes.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkImageData.h"
+#include "vtkInformation.h"
 #include "vtkNew.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
@@ -52,6 +55,31 @@ VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
 
+vtkm::cont::DataSet SelectFields(const vtkm::cont::DataSet& input, FieldsFlag fields)
+{
+  if ((fields & FieldsFlag::PointsAndCells) == FieldsFlag::PointsAndCells)
+  {
+    return input;
+  }
+
+  vtkm::cont::DataSet dataset;
+  dataset.SetCellSet(input.GetCellSet());
+  for (vtkm::IdComponent i = 0; i < input.GetNumberOfCoordinateSystems(); ++i)
+  {
+    dataset.AddCoordinateSystem(input.GetCoordinateSystem(i));
+  }
+  for (auto i : GetFieldsIndicesWithoutCoords(input))
+  {
+    const vtkm::cont::Field& field = input.GetField(i);
+    if ((field.IsFieldPoint() && (fields & FieldsFlag::Points) != FieldsFlag::None) ||
+      (field.IsFieldCell() && (fields & FieldsFlag::Cells) != FieldsFlag::None))
+    {
+      dataset.AddField(field);
+    }
+  }
+  return dataset;
+}
+
 template <typename T>
 vtkm::cont::CoordinateSystem deduce_container(vtkPoints* points)
 {
@@ -109,6 +137,12 @@ vtkm::cont::CoordinateSystem Convert(vtkPoints* points)
 // convert an structured grid type
 vtkm::cont::DataSet Convert(vtkStructuredGrid* input, FieldsFlag fields)
 {
+  vtkm::cont::DataSet kept;
+  if (GetKeptDataSet(input, fields, kept))
+  {
+    return kept;
+  }
+
   const int dimensionality = input->GetDataDimension();
   int dims[3];
   input->GetDimensions(dims);
@@ -181,6 +215,12 @@ vtkm::cont::CoordinateSystem ConvertRectilinearPoints(
 // convert a rectilinear grid type
 vtkm::cont::DataSet Convert(vtkRectilinearGrid* input, FieldsFlag fields)
 {
+  vtkm::cont::DataSet kept;
+  if (GetKeptDataSet(input, fields, kept))
+  {
+    return kept;
+  }
+
   const int dimensionality = input->GetDataDimension();
   int dims[3];
   input->GetDimensions(dims);
@@ -278,8 +318,24 @@ vtkm::cont::DataSet Convert(vtkDataSet* input, FieldsFlag fields)
     case VTK_UNSTRUCTURED_GRID_BASE:
     case VTK_STRUCTURED_POINTS:
     default:
-      return vtkm::cont::DataSet();
+      break;
+  }
+
+  vtkmDataSet* vtkmInput = vtkmDataSet::SafeDownCast(input);
+  return vtkmInput ? SelectFields(vtkmInput->GetVtkmDataSet(), fields) : vtkm::cont::DataSet();
+}
+
+//------------------------------------------------------------------------------
+bool GetKeptDataSet(vtkDataSet* input, FieldsFlag fields, vtkm::cont::DataSet& dataset)
+{
+  vtkmDataSet* kept =
+    vtkmDataSet::SafeDownCast(input->GetInformation()->Get(vtkmDataSet::VTKM_DATASET()));
+  if (!kept || kept->GetMTime() < input->GetMTime())
+  {
+    return false;
   }
+  dataset = SelectFields(kept->GetVtkmDataSet(), fields);
+  return true;
 }
 
 VTK_ABI_NAMESPACE_END
@@ -332,6 +388,21 @@ struct ComputeExtents
 };
 } // anonymous namespace
 
+//------------------------------------------------------------------------------
+void KeepDataSet(const vtkm::cont::DataSet& vtkmOut, vtkDataSet* output)
+{
+  if (!fromvtkm::GetKeepArraysOnDevice())
+  {
+    // the arrays of vtkmOut were moved to the output
+    return;
+  }
+
+  // created last, so that any later change of the output makes it outdated
+  vtkNew<vtkmDataSet> kept;
+  kept->SetVtkmDataSet(vtkmOut);
+  output->GetInformation()->Set(vtkmDataSet::VTKM_DATASET(), kept);
+}
+
 void PassAttributesInformation(vtkDataSetAttributes* input, vtkDataSetAttributes* output)
 {
   for (int attribType = 0; attribType < vtkDataSetAttributes::NUM_ATTRIBUTES; attribType++)
@@ -409,6 +480,7 @@ bool Convert(const vtkm::cont::DataSet& vtkmOut, vtkRectilinearGrid* output, vtk
   PassAttributesInformation(input->GetPointData(), output->GetPointData());
   PassAttributesInformation(input->GetCellData(), output->GetCellData());
 
+  KeepDataSet(vtkmOut, output);
   return true;
 }
 
@@ -440,6 +512,7 @@ bool Convert(const vtkm::cont::DataSet& vtkmOut, vtkStructuredGrid* output, vtkD
   PassAttributesInformation(input->GetPointData(), output->GetPointData());
   PassAttributesInformation(input->GetCellData(), output->GetCellData());
 
+  KeepDataSet(vtkmOut, output);
   return true;
 }
 
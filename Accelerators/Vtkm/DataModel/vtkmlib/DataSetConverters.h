@@ -53,6 +53,11 @@ vtkm::cont::DataSet Convert(vtkRectilinearGrid* input, FieldsFlag fields);
 // determine the type and call the proper Convert routine
 VTKACCELERATORSVTKMDATAMODEL_EXPORT
 vtkm::cont::DataSet Convert(vtkDataSet* input, FieldsFlag fields = FieldsFlag::None);
+
+// get the VTK-m dataset kept with the input by the VTK-m filter that produced it, when the input
+// was not modified since. Returns false when there is none.
+VTKACCELERATORSVTKMDATAMODEL_EXPORT
+bool GetKeptDataSet(vtkDataSet* input, FieldsFlag fields, vtkm::cont::DataSet& dataset);
 VTK_ABI_NAMESPACE_END
 }
 
@@ -63,6 +68,11 @@ VTK_ABI_NAMESPACE_BEGIN
 VTKACCELERATORSVTKMDATAMODEL_EXPORT
 void PassAttributesInformation(vtkDataSetAttributes* input, vtkDataSetAttributes* output);
 
+// keep the VTK-m dataset with its converted output for the next VTK-m filter, when the arrays
+// are kept on the device. Must be called once the output is complete.
+VTKACCELERATORSVTKMDATAMODEL_EXPORT
+void KeepDataSet(const vtkm::cont::DataSet& vtkmOut, vtkDataSet* output);
+
 VTKACCELERATORSVTKMDATAMODEL_EXPORT
 bool Convert(const vtkm::cont::DataSet& vtkmOut, vtkRectilinearGrid* output, vtkDataSet* input);
 
@@ -82,6 +82,12 @@ VTK_ABI_NAMESPACE_BEGIN
 // convert an image data type
 vtkm::cont::DataSet Convert(vtkImageData* input, FieldsFlag fields)
 {
+  vtkm::cont::DataSet kept;
+  if (GetKeptDataSet(input, fields, kept))
+  {
+    return kept;
+  }
+
   int extent[6];
   input->GetExtent(extent);
   double vorigin[3];
@@ -151,6 +157,7 @@ bool Convert(
   PassAttributesInformation(input->GetPointData(), output->GetPointData());
   PassAttributesInformation(input->GetCellData(), output->GetCellData());
 
+  KeepDataSet(voutput, output);
   return arraysConverted;
 }
 
@@ -83,6 +83,10 @@ vtkm::cont::DataSet Convert(vtkPolyData* input, FieldsFlag fields)
   // we should look at querying the cell types, so we can use single cell
   // set where possible
   vtkm::cont::DataSet dataset;
+  if (GetKeptDataSet(input, fields, dataset))
+  {
+    return dataset;
+  }
 
   // Only set coordinates if they exists in the vtkPolyData
   if (input->GetPoints())
@@ -215,6 +219,7 @@ bool Convert(const vtkm::cont::DataSet& voutput, vtkPolyData* output, vtkDataSet
   PassAttributesInformation(input->GetPointData(), output->GetPointData());
   PassAttributesInformation(input->GetCellData(), output->GetCellData());
 
+  KeepDataSet(voutput, output);
   return arraysConverted;
 }
 
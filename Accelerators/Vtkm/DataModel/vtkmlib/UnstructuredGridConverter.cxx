@@ -50,6 +50,10 @@ vtkm::cont::DataSet Convert(vtkUnstructuredGrid* input, FieldsFlag fields)
   // This will need to use the custom storage and portals so that
   // we can efficiently map between VTK and VTKm
   vtkm::cont::DataSet dataset;
+  if (GetKeptDataSet(input, fields, dataset))
+  {
+    return dataset;
+  }
 
   // first step convert the points over to an array handle
   vtkm::cont::CoordinateSystem coords = Convert(input->GetPoints());
@@ -118,6 +122,7 @@ bool Convert(const vtkm::cont::DataSet& voutput, vtkUnstructuredGrid* output, vt
   PassAttributesInformation(input->GetPointData(), output->GetPointData());
   PassAttributesInformation(input->GetCellData(), output->GetCellData());
 
+  KeepDataSet(voutput, output);
   return arraysConverted;
 }
 
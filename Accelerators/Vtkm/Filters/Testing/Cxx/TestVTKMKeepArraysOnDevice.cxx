@@ -0,0 +1,94 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestVTKMKeepArraysOnDevice.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the outputs of the VTK-m filters keep their arrays on the device
+// and their VTK-m dataset for the next VTK-m filter when asked to.
+
+#include "vtkmContour.h"
+#include "vtkmDataArray.h"
+#include "vtkmDataSet.h"
+#include "vtkmPolyDataNormals.h"
+#include "vtkmlib/DataSetConverters.h"
+
+#include "vtkInformation.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkRTAnalyticSource.h"
+
+#include <cstdlib>
+#include <iostream>
+
+int TestVTKMKeepArraysOnDevice(int, char*[])
+{
+  fromvtkm::SetKeepArraysOnDevice(true);
+
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(-10, 10, -10, 10, -10, 10);
+
+  vtkNew<vtkmContour> contour;
+  contour->SetInputConnection(wavelet->GetOutputPort());
+  contour->SetValue(0, 150.0);
+
+  vtkNew<vtkmPolyDataNormals> normals;
+  normals->SetInputConnection(contour->GetOutputPort());
+  normals->Update();
+
+  vtkPolyData* surface = contour->GetOutput();
+  vtkDataArray* scalars = surface->GetPointData()->GetScalars();
+  if (!scalars || !vtkmDataArray<float>::SafeDownCast(scalars))
+  {
+    std::cerr << "The scalars of the contour were not kept on the device" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!surface->GetInformation()->Has(vtkmDataSet::VTKM_DATASET()))
+  {
+    std::cerr << "The VTK-m dataset of the contour was not kept" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkm::cont::DataSet kept;
+  if (!tovtkm::GetKeptDataSet(surface, tovtkm::FieldsFlag::Points, kept) ||
+    kept.GetNumberOfPoints() != surface->GetNumberOfPoints())
+  {
+    std::cerr << "The kept dataset does not match the contour" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkPolyData* result = normals->GetOutput();
+  vtkDataArray* resultNormals = result->GetPointData()->GetNormals();
+  if (!resultNormals || resultNormals->GetNumberOfTuples() != surface->GetNumberOfPoints())
+  {
+    std::cerr << "Wrong normals computed from the kept dataset" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the host copy of the values is still available
+  if (!scalars->GetVoidPointer(0) ||
+    static_cast<float*>(scalars->GetVoidPointer(0))[0] != scalars->GetComponent(0, 0))
+  {
+    std::cerr << "Wrong host values of the scalars" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  surface->Modified();
+  if (tovtkm::GetKeptDataSet(surface, tovtkm::FieldsFlag::Points, kept))
+  {
+    std::cerr << "The kept dataset was used for a modified output" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  fromvtkm::SetKeepArraysOnDevice(false);
+  return EXIT_SUCCESS;
+}
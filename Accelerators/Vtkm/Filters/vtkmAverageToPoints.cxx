@@ -16,6 +16,7 @@
 #include "vtkmAverageToPoints.h"
 
 #include "vtkCellData.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkDataSet.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -38,7 +39,11 @@ VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkmAverageToPoints);
 
 //------------------------------------------------------------------------------
-vtkmAverageToPoints::vtkmAverageToPoints() = default;
+vtkmAverageToPoints::vtkmAverageToPoints()
+{
+  // Unlike the superclass, not audited for concurrent block execution.
+  this->GetInformation()->Remove(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION());
+}
 
 //------------------------------------------------------------------------------
 vtkmAverageToPoints::~vtkmAverageToPoints() = default;
@@ -185,9 +185,11 @@ int vtkmClip::RequestData(
     if (!this->GetClipFunction() && this->GetComputeScalars())
     {
       output->GetPointData()->SetActiveScalars(scalars->GetName());
+      fromvtkm::KeepDataSet(result, output);
       if (clippedOutput)
       {
         clippedOutput->GetPointData()->SetActiveScalars(scalars->GetName());
+        fromvtkm::KeepDataSet(result1, clippedOutput);
       }
     }
 
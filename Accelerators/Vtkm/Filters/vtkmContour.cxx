@@ -238,6 +238,8 @@ int vtkmContour::RequestData(
       output->GetPointData()->SetActiveAttribute(
         filter.GetNormalArrayName().c_str(), vtkDataSetAttributes::NORMALS);
     }
+    // keep the result again, the active attributes modified the output
+    fromvtkm::KeepDataSet(result, output);
   }
   catch (const vtkm::cont::ErrorUserAbort&)
   {
@@ -17,6 +17,7 @@
 #include "vtkmConfigFilters.h"
 
 #include "vtkCellData.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkDataSet.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -77,7 +78,11 @@ inline bool HasGhostFlagsSet(vtkUnsignedCharArray* ghostArray, int flags)
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
-vtkmThreshold::vtkmThreshold() = default;
+vtkmThreshold::vtkmThreshold()
+{
+  // Unlike the superclass, not audited for concurrent block execution.
+  this->GetInformation()->Remove(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION());
+}
 
 //------------------------------------------------------------------------------
 vtkmThreshold::~vtkmThreshold() = default;
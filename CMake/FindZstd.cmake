@@ -0,0 +1,49 @@
+# A CMake find module for the Zstandard compression library.
+#
+# https://facebook.github.io/zstd/
+#
+# Once done, this module will define
+#   Zstd_FOUND         - system has Zstandard
+#   Zstd_INCLUDE_DIRS  - the Zstandard include directory
+#   Zstd_LIBRARIES     - link to these to use Zstandard
+#   Zstd_VERSION       - the version of Zstandard
+#   Zstd::Zstd         - imported target
+
+find_path(Zstd_INCLUDE_DIR
+  NAMES zstd.h
+  DOC "zstd include directory")
+mark_as_advanced(Zstd_INCLUDE_DIR)
+find_library(Zstd_LIBRARY
+  NAMES zstd libzstd zstd_static
+  DOC "zstd library")
+mark_as_advanced(Zstd_LIBRARY)
+
+if (Zstd_INCLUDE_DIR)
+  file(STRINGS "${Zstd_INCLUDE_DIR}/zstd.h" _zstd_version_lines
+    REGEX "#define[ \t]+ZSTD_VERSION_(MAJOR|MINOR|RELEASE)")
+  string(REGEX REPLACE ".*ZSTD_VERSION_MAJOR *\([0-9]*\).*" "\\1" _zstd_version_major "${_zstd_version_lines}")
+  string(REGEX REPLACE ".*ZSTD_VERSION_MINOR *\([0-9]*\).*" "\\1" _zstd_version_minor "${_zstd_version_lines}")
+  string(REGEX REPLACE ".*ZSTD_VERSION_RELEASE *\([0-9]*\).*" "\\1" _zstd_version_release "${_zstd_version_lines}")
+  set(Zstd_VERSION "${_zstd_version_major}.${_zstd_version_minor}.${_zstd_version_release}")
+  unset(_zstd_version_major)
+  unset(_zstd_version_minor)
+  unset(_zstd_version_release)
+  unset(_zstd_version_lines)
+endif ()
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Zstd
+  REQUIRED_VARS Zstd_LIBRARY Zstd_INCLUDE_DIR
+  VERSION_VAR Zstd_VERSION)
+
+if (Zstd_FOUND)
+  set(Zstd_INCLUDE_DIRS "${Zstd_INCLUDE_DIR}")
+  set(Zstd_LIBRARIES "${Zstd_LIBRARY}")
+
+  if (NOT TARGET Zstd::Zstd)
+    add_library(Zstd::Zstd UNKNOWN IMPORTED)
+    set_target_properties(Zstd::Zstd PROPERTIES
+      IMPORTED_LOCATION "${Zstd_LIBRARY}"
+      INTERFACE_INCLUDE_DIRECTORIES "${Zstd_INCLUDE_DIR}")
+  endif ()
+endif ()
@@ -126,6 +126,7 @@ set(vtk_cmake_module_files
   FindCGNS.cmake
   FindzSpace.cmake
   FindzSpaceCompat.cmake
+  FindZstd.cmake
 
   vtkCMakeBackports.cmake
   vtkDetectLibraryType.cmake
@@ -0,0 +1,153 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPlotDecimation.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the screen space decimation of large line and scatter plots
+// draws the same image as all their points, before and after zooming.
+
+#include "vtkAxis.h"
+#include "vtkChartXY.h"
+#include "vtkContextScene.h"
+#include "vtkContextView.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPlotLine.h"
+#include "vtkPlotPoints.h"
+#include "vtkPointData.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+void Capture(vtkRenderWindow* window, vtkImageData* image)
+{
+  window->Render();
+  vtkNew<vtkWindowToImageFilter> grab;
+  grab->SetInput(window);
+  grab->ReadFrontBufferOff();
+  grab->Update();
+  image->DeepCopy(grab->GetOutput());
+}
+
+// fraction of the pixels that differ between the two images
+double Difference(vtkImageData* image1, vtkImageData* image2)
+{
+  vtkUnsignedCharArray* pixels1 =
+    vtkArrayDownCast<vtkUnsignedCharArray>(image1->GetPointData()->GetScalars());
+  vtkUnsignedCharArray* pixels2 =
+    vtkArrayDownCast<vtkUnsignedCharArray>(image2->GetPointData()->GetScalars());
+  if (!pixels1 || !pixels2 || pixels1->GetNumberOfValues() != pixels2->GetNumberOfValues())
+  {
+    return 1.0;
+  }
+  vtkIdType different = 0;
+  const int nComponents = pixels1->GetNumberOfComponents();
+  for (vtkIdType i = 0; i < pixels1->GetNumberOfTuples(); ++i)
+  {
+    for (int j = 0; j < nComponents; ++j)
+    {
+      const int value1 = pixels1->GetValue(i * nComponents + j);
+      const int value2 = pixels2->GetValue(i * nComponents + j);
+      if (std::abs(value1 - value2) > 16)
+      {
+        ++different;
+        break;
+      }
+    }
+  }
+  return static_cast<double>(different) / pixels1->GetNumberOfTuples();
+}
+}
+
+//------------------------------------------------------------------------------
+int TestPlotDecimation(int, char*[])
+{
+  vtkNew<vtkContextView> view;
+  view->GetRenderer()->SetBackground(1.0, 1.0, 1.0);
+  view->GetRenderWindow()->SetSize(400, 300);
+  view->GetRenderWindow()->SetMultiSamples(0);
+  vtkNew<vtkChartXY> chart;
+  view->GetScene()->AddItem(chart);
+
+  // a noisy signal, much denser than the pixels, with a few bad values
+  const vtkIdType numPoints = 200000;
+  vtkNew<vtkTable> table;
+  vtkNew<vtkFloatArray> arrX;
+  arrX->SetName("X");
+  arrX->SetNumberOfTuples(numPoints);
+  vtkNew<vtkFloatArray> arrLine;
+  arrLine->SetName("Line");
+  arrLine->SetNumberOfTuples(numPoints);
+  vtkNew<vtkFloatArray> arrPoints;
+  arrPoints->SetName("Points");
+  arrPoints->SetNumberOfTuples(numPoints);
+  vtkMath::RandomSeed(42);
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    const double x = 10.0 * i / numPoints;
+    arrX->SetValue(i, x);
+    arrLine->SetValue(i, std::sin(x) + vtkMath::Gaussian(0.0, 0.1));
+    arrPoints->SetValue(i, std::cos(x) + vtkMath::Gaussian(0.0, 0.3) + 3.0);
+  }
+  arrLine->SetValue(numPoints / 3, vtkMath::Nan());
+  table->AddColumn(arrX);
+  table->AddColumn(arrLine);
+  table->AddColumn(arrPoints);
+
+  vtkPlotLine* line = vtkPlotLine::SafeDownCast(chart->AddPlot(vtkChart::LINE));
+  line->SetInputData(table, 0, 1);
+  line->SetColor(0, 0, 255, 255);
+  vtkPlotPoints* points = vtkPlotPoints::SafeDownCast(chart->AddPlot(vtkChart::POINTS));
+  points->SetInputData(table, 0, 2);
+  points->SetColor(255, 0, 0, 255);
+  points->SetMarkerStyle(vtkPlotPoints::SQUARE);
+  points->SetMarkerSize(2.0);
+
+  for (int zoom = 0; zoom < 2; ++zoom)
+  {
+    if (zoom == 1)
+    {
+      chart->GetAxis(vtkAxis::BOTTOM)->SetBehavior(vtkAxis::FIXED);
+      chart->GetAxis(vtkAxis::BOTTOM)->SetRange(2.0, 3.0);
+    }
+
+    line->SetDecimationThreshold(100000);
+    points->SetDecimationThreshold(100000);
+    vtkNew<vtkImageData> decimated;
+    Capture(view->GetRenderWindow(), decimated);
+
+    line->SetDecimationThreshold(VTK_ID_MAX);
+    points->SetDecimationThreshold(VTK_ID_MAX);
+    vtkNew<vtkImageData> full;
+    Capture(view->GetRenderWindow(), full);
+
+    const double difference = Difference(decimated, full);
+    if (difference > 0.01)
+    {
+      std::cerr << "The decimated plots differ from the full plots on " << 100.0 * difference
+                << "% of the pixels at zoom level " << zoom << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
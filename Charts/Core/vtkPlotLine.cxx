@@ -23,6 +23,9 @@
 
 #include "vtkObjectFactory.h"
 
+#include <algorithm>
+#include <cmath>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPlotLine);
@@ -32,6 +35,7 @@ vtkPlotLine::vtkPlotLine()
 {
   this->MarkerStyle = vtkPlotPoints::NONE;
   this->PolyLine = true;
+  this->DecimatedLineScale = 0.0;
 }
 
 //------------------------------------------------------------------------------
@@ -51,7 +55,28 @@ bool vtkPlotLine::Paint(vtkContext2D* painter)
   // Draw the line between the points
   painter->ApplyPen(this->Pen);
 
-  if (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0)
+  double scale[2];
+  if (this->PolyLine && this->Points->GetNumberOfPoints() > this->DecimationThreshold &&
+    vtkPlotPoints::GetPixelScale(painter, scale))
+  {
+    // draw the decimated lines, kept in the graphics memory when there is
+    // only one
+    this->UpdateDecimatedLine(scale[0]);
+    if (this->DecimatedLineOffsets.size() == 2)
+    {
+      painter->DrawCachedPoly(this->DecimatedLine);
+    }
+    else
+    {
+      float* points = static_cast<float*>(this->DecimatedLine->GetVoidPointer(0));
+      for (size_t i = 0; i + 1 < this->DecimatedLineOffsets.size(); ++i)
+      {
+        painter->DrawPoly(points + 2 * this->DecimatedLineOffsets[i],
+          static_cast<int>(this->DecimatedLineOffsets[i + 1] - this->DecimatedLineOffsets[i]));
+      }
+    }
+  }
+  else if (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0)
   {
     // draw lines skipping bad points
     float* points = static_cast<float*>(this->Points->GetVoidPointer(0));
@@ -96,7 +121,7 @@ bool vtkPlotLine::Paint(vtkContext2D* painter)
     // draw lines between all points
     if (this->PolyLine)
     {
-      painter->DrawPoly(this->Points);
+      painter->DrawCachedPoly(this->Points);
     }
     else
     {
@@ -116,6 +141,72 @@ bool vtkPlotLine::PaintLegend(vtkContext2D* painter, const vtkRectf& rect, int)
   return true;
 }
 
+//------------------------------------------------------------------------------
+void vtkPlotLine::UpdateDecimatedLine(double scale)
+{
+  if (this->DecimatedLineTime > this->BuildTime && scale == this->DecimatedLineScale)
+  {
+    return;
+  }
+  this->DecimatedLineScale = scale;
+
+  const float* points = static_cast<float*>(this->Points->GetVoidPointer(0));
+  const vtkIdType nPoints = this->Points->GetNumberOfPoints();
+  const vtkIdType nBadPoints = this->BadPoints ? this->BadPoints->GetNumberOfTuples() : 0;
+  this->DecimatedLine->SetNumberOfPoints(0);
+  this->DecimatedLineOffsets.assign(1, 0);
+
+  auto insertColumn = [&](vtkIdType first, vtkIdType lowest, vtkIdType highest, vtkIdType last) {
+    vtkIdType ids[4] = { first, lowest, highest, last };
+    std::sort(ids, ids + 4);
+    vtkIdType* end = std::unique(ids, ids + 4);
+    for (vtkIdType* id = ids; id != end; ++id)
+    {
+      this->DecimatedLine->InsertNextPoint(points[2 * *id], points[2 * *id + 1]);
+    }
+  };
+
+  vtkIdType lastGood = 0;
+  vtkIdType bpIdx = 0;
+  while (lastGood < nPoints)
+  {
+    vtkIdType id = bpIdx < nBadPoints ? this->BadPoints->GetValue(bpIdx) : nPoints;
+    if (id - lastGood > 1)
+    {
+      // a line through these points covers the same pixels of each column as
+      // the line through all the points of the column
+      vtkIdType first = lastGood;
+      vtkIdType lowest = lastGood;
+      vtkIdType highest = lastGood;
+      double column = std::floor(points[2 * lastGood] * scale);
+      for (vtkIdType i = lastGood + 1; i < id; ++i)
+      {
+        double pixel = std::floor(points[2 * i] * scale);
+        if (pixel != column)
+        {
+          insertColumn(first, lowest, highest, i - 1);
+          first = lowest = highest = i;
+          column = pixel;
+        }
+        else if (points[2 * i + 1] < points[2 * lowest + 1])
+        {
+          lowest = i;
+        }
+        else if (points[2 * i + 1] > points[2 * highest + 1])
+        {
+          highest = i;
+        }
+      }
+      insertColumn(first, lowest, highest, id - 1);
+      this->DecimatedLineOffsets.push_back(this->DecimatedLine->GetNumberOfPoints());
+    }
+    lastGood = id + 1;
+    bpIdx++;
+  }
+  this->DecimatedLine->Modified();
+  this->DecimatedLineTime.Modified();
+}
+
 //------------------------------------------------------------------------------
 void vtkPlotLine::PrintSelf(ostream& os, vtkIndent indent)
 {
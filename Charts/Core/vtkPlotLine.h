@@ -28,6 +28,8 @@
 #include "vtkChartsCoreModule.h" // For export macro
 #include "vtkPlotPoints.h"
 
+#include <vector> // For ivars
+
 VTK_ABI_NAMESPACE_BEGIN
 class VTKCHARTSCORE_EXPORT vtkPlotLine : public vtkPlotPoints
 {
@@ -75,6 +77,26 @@ protected:
    */
   bool PolyLine;
 
+  /**
+   * Update DecimatedLine with the first, lowest, highest and last points of
+   * each run of consecutive points falling in the same column of pixels, for
+   * the given number of pixels per unit along x. The good points between two
+   * bad points are decimated as separate lines.
+   */
+  void UpdateDecimatedLine(double scale);
+
+  ///@{
+  /**
+   * Screen space decimation of the poly line, cached for a zoom level. Each
+   * line of DecimatedLine starts at one of DecimatedLineOffsets and ends
+   * before the next one.
+   */
+  vtkNew<vtkPoints2D> DecimatedLine;
+  std::vector<vtkIdType> DecimatedLineOffsets;
+  double DecimatedLineScale;
+  vtkTimeStamp DecimatedLineTime;
+  ///@}
+
 private:
   vtkPlotLine(const vtkPlotLine&) = delete;
   void operator=(const vtkPlotLine&) = delete;
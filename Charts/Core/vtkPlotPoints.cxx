@@ -25,16 +25,21 @@
 #include "vtkImageData.h"
 #include "vtkLookupTable.h"
 #include "vtkMath.h"
+#include "vtkMatrix3x3.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPen.h"
 #include "vtkPoints2D.h"
 #include "vtkTable.h"
+#include "vtkTransform2D.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 // PIMPL for STL vector...
@@ -82,6 +87,9 @@ vtkPlotPoints::vtkPlotPoints()
 
   this->UnscaledInputBounds[0] = this->UnscaledInputBounds[2] = vtkMath::Inf();
   this->UnscaledInputBounds[1] = this->UnscaledInputBounds[3] = -vtkMath::Inf();
+
+  this->DecimationThreshold = 100000;
+  this->DecimationScale[0] = this->DecimationScale[1] = 0.0;
 }
 
 //------------------------------------------------------------------------------
@@ -145,8 +153,24 @@ bool vtkPlotPoints::Paint(vtkContext2D* painter)
       colors = this->Colors->GetPointer(0);
       nColorComponents = static_cast<int>(this->Colors->GetNumberOfComponents());
     }
+    bool hasBadPoints = this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0;
 
-    if (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0)
+    double scale[2];
+    if (this->Points->GetNumberOfPoints() > this->DecimationThreshold &&
+      vtkPlotPoints::GetPixelScale(painter, scale))
+    {
+      // draw one marker per pixel, the decimated points being kept in the
+      // graphics memory until they change
+      this->UpdateDecimatedPoints(scale);
+      painter->DrawCachedMarkers(this->MarkerStyle, false, this->DecimatedPoints,
+        colors ? this->DecimatedColors.GetPointer() : nullptr);
+    }
+    else if (!hasBadPoints)
+    {
+      painter->DrawCachedMarkers(
+        this->MarkerStyle, false, this->Points, colors ? this->Colors : nullptr);
+    }
+    else if (hasBadPoints)
     {
       vtkIdType lastGood = 0;
       vtkIdType bpIdx = 0;
@@ -962,9 +986,138 @@ vtkStdString vtkPlotPoints::GetColorArrayName()
   return this->ColorArrayName;
 }
 
+//------------------------------------------------------------------------------
+bool vtkPlotPoints::GetPixelScale(vtkContext2D* painter, double scale[2])
+{
+  vtkTransform2D* transform = painter->GetTransform();
+  if (!transform)
+  {
+    return false;
+  }
+  vtkMatrix3x3* matrix = transform->GetMatrix();
+  scale[0] = std::abs(matrix->GetElement(0, 0));
+  scale[1] = std::abs(matrix->GetElement(1, 1));
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkPlotPoints::UpdateDecimatedPoints(const double scale[2])
+{
+  if (this->DecimationTime > this->BuildTime && scale[0] == this->DecimationScale[0] &&
+    scale[1] == this->DecimationScale[1])
+  {
+    return;
+  }
+  this->DecimationScale[0] = scale[0];
+  this->DecimationScale[1] = scale[1];
+
+  const float* points = static_cast<float*>(this->Points->GetVoidPointer(0));
+  const vtkIdType nPoints = this->Points->GetNumberOfPoints();
+  std::vector<bool> good(nPoints, true);
+  if (this->BadPoints)
+  {
+    for (vtkIdType i = 0; i < this->BadPoints->GetNumberOfTuples(); ++i)
+    {
+      good[this->BadPoints->GetValue(i)] = false;
+    }
+  }
+
+  // Pixel of each good point. The points further than a billion pixels away
+  // are far off screen, and share the pixels at that distance.
+  const double maxPixel = 1e9;
+  std::vector<std::int64_t> pixels(2 * nPoints, 0);
+  std::int64_t bounds[4] = { std::numeric_limits<std::int64_t>::max(),
+    std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max(),
+    std::numeric_limits<std::int64_t>::min() };
+  vtkIdType nGood = 0;
+  for (vtkIdType i = 0; i < nPoints; ++i)
+  {
+    if (!good[i])
+    {
+      continue;
+    }
+    for (int j = 0; j < 2; ++j)
+    {
+      double pixel = std::floor(points[2 * i + j] * scale[j]);
+      pixel = std::max(-maxPixel, std::min(pixel, maxPixel));
+      pixels[2 * i + j] = static_cast<std::int64_t>(pixel);
+      bounds[2 * j] = std::min(bounds[2 * j], pixels[2 * i + j]);
+      bounds[2 * j + 1] = std::max(bounds[2 * j + 1], pixels[2 * i + j]);
+    }
+    ++nGood;
+  }
+
+  // Find the last point drawn in each pixel, on a grid if the points cover
+  // few pixels, or in a hash map when zoomed in.
+  std::vector<bool> keep(nPoints, false);
+  if (nGood > 0)
+  {
+    const std::int64_t width = bounds[1] - bounds[0] + 1;
+    const std::int64_t height = bounds[3] - bounds[2] + 1;
+    auto pixelId = [&](vtkIdType i) {
+      return (pixels[2 * i] - bounds[0]) + width * (pixels[2 * i + 1] - bounds[2]);
+    };
+    if (width * height <= 16 * static_cast<std::int64_t>(nGood))
+    {
+      std::vector<vtkIdType> last(width * height, -1);
+      for (vtkIdType i = 0; i < nPoints; ++i)
+      {
+        if (good[i])
+        {
+          last[pixelId(i)] = i;
+        }
+      }
+      for (vtkIdType id : last)
+      {
+        if (id >= 0)
+        {
+          keep[id] = true;
+        }
+      }
+    }
+    else
+    {
+      std::unordered_map<std::int64_t, vtkIdType> last;
+      for (vtkIdType i = 0; i < nPoints; ++i)
+      {
+        if (good[i])
+        {
+          last[pixelId(i)] = i;
+        }
+      }
+      for (const auto& item : last)
+      {
+        keep[item.second] = true;
+      }
+    }
+  }
+
+  // Copy the kept points in their drawing order
+  vtkUnsignedCharArray* colors =
+    this->Colors && this->Colors->GetNumberOfTuples() == nPoints ? this->Colors : nullptr;
+  this->DecimatedPoints->SetNumberOfPoints(0);
+  this->DecimatedColors->SetNumberOfComponents(colors ? colors->GetNumberOfComponents() : 4);
+  this->DecimatedColors->SetNumberOfTuples(0);
+  for (vtkIdType i = 0; i < nPoints; ++i)
+  {
+    if (keep[i])
+    {
+      this->DecimatedPoints->InsertNextPoint(points[2 * i], points[2 * i + 1]);
+      if (colors)
+      {
+        this->DecimatedColors->InsertNextTuple(i, colors);
+      }
+    }
+  }
+  this->DecimatedPoints->Modified();
+  this->DecimatedColors->Modified();
+  this->DecimationTime.Modified();
+}
+
 //------------------------------------------------------------------------------
 void vtkPlotPoints::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "DecimationThreshold: " << this->DecimationThreshold << endl;
 }
 VTK_ABI_NAMESPACE_END
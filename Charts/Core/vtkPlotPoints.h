@@ -177,6 +177,19 @@ public:
   vtkSetMacro(ValidPointMaskName, vtkStdString);
   ///@}
 
+  ///@{
+  /**
+   * Get/set the number of points above which the plot is decimated in screen
+   * space before being drawn. The markers are reduced to the last one drawn in
+   * each pixel, and vtkPlotLine reduces its line to the first, lowest, highest
+   * and last points of each column of pixels, which draws the same image. The
+   * decimated points are kept until the data or the zoom level change. The
+   * default is 100000, and VTK_ID_MAX disables the decimation.
+   */
+  vtkSetClampMacro(DecimationThreshold, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(DecimationThreshold, vtkIdType);
+  ///@}
+
   /**
    * Update the internal cache. Returns true if cache was successfully updated. Default does
    * nothing.
@@ -227,6 +240,19 @@ protected:
    */
   void CreateSortedPoints();
 
+  /**
+   * Get the number of pixels per unit of the plot coordinates along x and y
+   * for the current transform of the painter. Returns false if the painter
+   * has no transform.
+   */
+  static bool GetPixelScale(vtkContext2D* painter, double scale[2]);
+
+  /**
+   * Update DecimatedPoints and DecimatedColors with the last good point, and
+   * its color, falling in each pixel for the given pixel scale.
+   */
+  void UpdateDecimatedPoints(const double scale[2]);
+
   ///@{
   /**
    * Store a well packed set of XY coordinates for this data series.
@@ -285,6 +311,17 @@ protected:
    */
   double UnscaledInputBounds[4];
 
+  ///@{
+  /**
+   * Screen space decimation of the markers, cached for a zoom level.
+   */
+  vtkIdType DecimationThreshold;
+  vtkNew<vtkPoints2D> DecimatedPoints;
+  vtkNew<vtkUnsignedCharArray> DecimatedColors;
+  double DecimationScale[2];
+  vtkTimeStamp DecimationTime;
+  ///@}
+
 private:
   vtkPlotPoints(const vtkPlotPoints&) = delete;
   void operator=(const vtkPlotPoints&) = delete;
@@ -14,13 +14,18 @@
 =========================================================================*/
 
 #include "SMP/Common/vtkSMPToolsAPI.h"
-#include "vtkSMP.h"    // For SMP preprocessor information
-#include "vtkSetGet.h" // For vtkWarningMacro
+#include "vtkCxxABIConfigure.h" // For VTK_HAS_CXXABI_DEMANGLE
+#include "vtkSMP.h"             // For SMP preprocessor information
+#include "vtkSetGet.h"          // For vtkWarningMacro
 
-#include <algorithm> // For std::toupper
-#include <cstdlib>   // For std::getenv
-#include <iostream>  // For std::cerr
-#include <string>    // For std::string
+#include <algorithm>  // For std::toupper
+#include <chrono>     // For std::chrono::steady_clock
+#include <cstdlib>    // For std::getenv
+#include <iostream>   // For std::cerr
+#include <map>        // For std::map
+#include <mutex>      // For std::mutex
+#include <string>     // For std::string
+#include <typeindex>  // For std::type_index
 
 namespace vtk
 {
@@ -62,6 +67,224 @@ vtkSMPToolsAPI::vtkSMPToolsAPI()
   this->RefreshNumberOfThread();
 }
 
+//------------------------------------------------------------------------------
+const vtkSMPToolsCancellation*& vtkSMPToolsCancellation::GetCurrent()
+{
+  static thread_local const vtkSMPToolsCancellation* current = nullptr;
+  return current;
+}
+
+//------------------------------------------------------------------------------
+namespace
+{
+// Process-wide state of the instrumentation.
+struct InstrumentationRegistry
+{
+  struct Site
+  {
+    const std::type_info* CallSite = nullptr;
+    vtkSMPToolsInstrumentation::Statistics Statistics;
+  };
+
+  std::atomic<bool> Enabled;
+  std::mutex Mutex;
+  std::map<std::type_index, Site> Sites;
+  vtkSMPToolsInstrumentation::ListenerType Listener = nullptr;
+  void* ClientData = nullptr;
+
+  InstrumentationRegistry()
+  {
+    const char* enabled = std::getenv("VTK_SMP_INSTRUMENTATION");
+    this->Enabled = enabled && std::atoi(enabled) != 0;
+  }
+
+  static InstrumentationRegistry& GetInstance()
+  {
+    static InstrumentationRegistry instance;
+    return instance;
+  }
+};
+
+// Number of the calling thread, in the order threads first ask for it.
+int GetInstrumentedThread()
+{
+  static std::atomic<int> numberOfThreads(0);
+  static thread_local int thread = numberOfThreads++;
+  return thread;
+}
+}
+
+//------------------------------------------------------------------------------
+struct vtkSMPToolsInstrumentation::vtkInternals
+{
+  std::mutex Mutex;
+  Call Loop;
+  int CallingThread = 0;
+  int NumberOfThreads = 1;
+};
+
+//------------------------------------------------------------------------------
+vtkSMPToolsInstrumentation::vtkSMPToolsInstrumentation(
+  const std::type_info& callSite, vtkIdType first, vtkIdType last, vtkIdType grain)
+  : Internals(new vtkInternals)
+{
+  auto& api = vtkSMPToolsAPI::GetInstance();
+  Call& call = this->Internals->Loop;
+  call.CallSite = &callSite;
+  call.Backend = api.GetBackend();
+  const vtkSMPToolsInstrumentation* parent = vtkSMPToolsInstrumentation::GetCurrent();
+  call.NestingDepth = parent ? parent->Internals->Loop.NestingDepth + 1 : 0;
+  call.NumberOfIterations = (std::max)(last - first, vtkIdType(0));
+  call.Grain = grain;
+  this->Internals->CallingThread = GetInstrumentedThread();
+  this->Internals->NumberOfThreads = api.GetEstimatedNumberOfThreads();
+  call.StartTime = vtkSMPToolsInstrumentation::GetTime();
+}
+
+//------------------------------------------------------------------------------
+vtkSMPToolsInstrumentation::~vtkSMPToolsInstrumentation()
+{
+  Call& call = this->Internals->Loop;
+  call.WallTime = vtkSMPToolsInstrumentation::GetTime() - call.StartTime;
+
+  // A loop run as a single chunk by the calling thread, as the nested loops
+  // without nested parallelism, has no other thread available.
+  const bool runInline = call.NumberOfChunks <= 1 &&
+    (call.Threads.empty() || call.Threads[0].Thread == this->Internals->CallingThread);
+  call.NumberOfThreads = runInline
+    ? 1
+    : (std::max)(this->Internals->NumberOfThreads, static_cast<int>(call.Threads.size()));
+  for (const ThreadTime& thread : call.Threads)
+  {
+    call.BusyTime += thread.BusyTime;
+  }
+  call.IdleTime = (std::max)(call.NumberOfThreads * call.WallTime - call.BusyTime, 0.0);
+
+  auto& registry = InstrumentationRegistry::GetInstance();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  auto& site = registry.Sites[std::type_index(*call.CallSite)];
+  site.CallSite = call.CallSite;
+  Statistics& statistics = site.Statistics;
+  statistics.Backend = call.Backend;
+  ++statistics.NumberOfCalls;
+  statistics.NumberOfIterations += call.NumberOfIterations;
+  statistics.NumberOfChunks += call.NumberOfChunks;
+  statistics.MaximumNumberOfThreads =
+    (std::max)(statistics.MaximumNumberOfThreads, call.NumberOfThreads);
+  statistics.MaximumNestingDepth = (std::max)(statistics.MaximumNestingDepth, call.NestingDepth);
+  statistics.WallTime += call.WallTime;
+  statistics.BusyTime += call.BusyTime;
+  statistics.IdleTime += call.IdleTime;
+  for (const ThreadTime& thread : call.Threads)
+  {
+    if (thread.Thread >= static_cast<int>(statistics.ThreadBusyTimes.size()))
+    {
+      statistics.ThreadBusyTimes.resize(thread.Thread + 1, 0.0);
+    }
+    statistics.ThreadBusyTimes[thread.Thread] += thread.BusyTime;
+  }
+  if (registry.Listener)
+  {
+    registry.Listener(call, registry.ClientData);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsInstrumentation::AddChunk(double busyTime)
+{
+  const int thread = GetInstrumentedThread();
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  Call& call = this->Internals->Loop;
+  ++call.NumberOfChunks;
+  auto found = std::find_if(call.Threads.begin(), call.Threads.end(),
+    [thread](const ThreadTime& time) { return time.Thread == thread; });
+  if (found == call.Threads.end())
+  {
+    call.Threads.emplace_back();
+    found = call.Threads.end() - 1;
+    found->Thread = thread;
+  }
+  ++found->NumberOfChunks;
+  found->BusyTime += busyTime;
+}
+
+//------------------------------------------------------------------------------
+vtkSMPToolsInstrumentation*& vtkSMPToolsInstrumentation::GetCurrent()
+{
+  static thread_local vtkSMPToolsInstrumentation* current = nullptr;
+  return current;
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPToolsInstrumentation::IsEnabled()
+{
+  return InstrumentationRegistry::GetInstance().Enabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsInstrumentation::SetEnabled(bool enabled)
+{
+  InstrumentationRegistry::GetInstance().Enabled = enabled;
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkSMPToolsInstrumentation::Statistics> vtkSMPToolsInstrumentation::GetStatistics()
+{
+  std::vector<Statistics> result;
+  auto& registry = InstrumentationRegistry::GetInstance();
+  {
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    for (const auto& site : registry.Sites)
+    {
+      result.push_back(site.second.Statistics);
+      result.back().CallSite = vtkSMPToolsInstrumentation::GetCallSiteName(*site.second.CallSite);
+    }
+  }
+  std::sort(result.begin(), result.end(),
+    [](const Statistics& a, const Statistics& b) { return a.WallTime > b.WallTime; });
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsInstrumentation::ClearStatistics()
+{
+  auto& registry = InstrumentationRegistry::GetInstance();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  registry.Sites.clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsInstrumentation::SetListener(ListenerType listener, void* clientData)
+{
+  auto& registry = InstrumentationRegistry::GetInstance();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  registry.Listener = listener;
+  registry.ClientData = clientData;
+}
+
+//------------------------------------------------------------------------------
+std::string vtkSMPToolsInstrumentation::GetCallSiteName(const std::type_info& callSite)
+{
+  std::string name = callSite.name();
+#ifdef VTK_HAS_CXXABI_DEMANGLE
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+  if (!status && demangled)
+  {
+    name = demangled;
+  }
+  free(demangled);
+#endif
+  return name;
+}
+
+//------------------------------------------------------------------------------
+double vtkSMPToolsInstrumentation::GetTime()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
 //------------------------------------------------------------------------------
 vtkSMPToolsAPI& vtkSMPToolsAPI::GetInstance()
 {
@@ -226,6 +449,26 @@ bool vtkSMPToolsAPI::IsParallelScope()
   return false;
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::RunTasks(std::vector<std::function<void()>>& tasks)
+{
+  switch (this->ActivatedBackend)
+  {
+    case BackendType::Sequential:
+      this->SequentialBackend->RunTasks(tasks);
+      break;
+    case BackendType::STDThread:
+      this->STDThreadBackend->RunTasks(tasks);
+      break;
+    case BackendType::TBB:
+      this->TBBBackend->RunTasks(tasks);
+      break;
+    case BackendType::OpenMP:
+      this->OpenMPBackend->RunTasks(tasks);
+      break;
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkSMPToolsAPI::GetSingleThread()
 {
@@ -21,7 +21,12 @@
 #include "vtkObject.h"
 #include "vtkSMP.h"
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #if VTK_SMP_ENABLE_SEQUENTIAL
@@ -47,6 +52,191 @@ VTK_ABI_NAMESPACE_BEGIN
 
 using vtkSMPToolsDefaultImpl = vtkSMPToolsImpl<DefaultBackend>;
 
+/**
+ * A cancellation scope, see vtkSMPTools::CancellableScope(). Scopes are
+ * chained to the enclosing one, which is cancelled as well when its flag is
+ * set. The scope of the calling thread is captured when a For() starts and
+ * made current on the threads running its chunks.
+ */
+class VTKCOMMONCORE_EXPORT vtkSMPToolsCancellation
+{
+public:
+  using FlagType = std::atomic<vtkTypeBool>;
+
+  vtkSMPToolsCancellation(const FlagType& flag)
+    : Flag(&flag)
+    , Parent(vtkSMPToolsCancellation::GetCurrent())
+  {
+    vtkSMPToolsCancellation::GetCurrent() = this;
+  }
+  ~vtkSMPToolsCancellation() { vtkSMPToolsCancellation::GetCurrent() = this->Parent; }
+
+  bool IsCancelled() const
+  {
+    for (const vtkSMPToolsCancellation* scope = this; scope; scope = scope->Parent)
+    {
+      if (*scope->Flag)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // The innermost scope of the calling thread, nullptr if none.
+  static const vtkSMPToolsCancellation*& GetCurrent();
+
+  // Make a scope current on the calling thread for the lifetime of this object.
+  class Resume
+  {
+  public:
+    Resume(const vtkSMPToolsCancellation* scope)
+      : Previous(vtkSMPToolsCancellation::GetCurrent())
+    {
+      vtkSMPToolsCancellation::GetCurrent() = scope;
+    }
+    ~Resume() { vtkSMPToolsCancellation::GetCurrent() = this->Previous; }
+
+  private:
+    const vtkSMPToolsCancellation* Previous;
+
+    Resume(const Resume&) = delete;
+    void operator=(const Resume&) = delete;
+  };
+
+private:
+  const FlagType* Flag;
+  const vtkSMPToolsCancellation* Parent;
+
+  vtkSMPToolsCancellation(const vtkSMPToolsCancellation&) = delete;
+  void operator=(const vtkSMPToolsCancellation&) = delete;
+};
+
+/**
+ * Instrumentation of a For() loop, see vtkSMPTools::SetInstrumentation(). An
+ * instance lives for the duration of an instrumented loop: its chunks report
+ * their time to it with a Chunk, made current on the thread running them so
+ * that the loops nested in a chunk know their depth. When destroyed, the
+ * statistics of the loop are accumulated for its call site, the type of its
+ * functor, and passed to the listener, if any.
+ */
+class VTKCOMMONCORE_EXPORT vtkSMPToolsInstrumentation
+{
+public:
+  // Time spent by a thread in the chunks of a loop. Threads are numbered in
+  // the order they first run an instrumented chunk.
+  struct ThreadTime
+  {
+    int Thread = 0;
+    vtkIdType NumberOfChunks = 0;
+    double BusyTime = 0.0;
+  };
+
+  // Statistics of one loop. Times are in seconds, the start time being the
+  // one of GetTime(). The idle time is the time the threads available to
+  // the loop did not spend in its chunks.
+  struct Call
+  {
+    const std::type_info* CallSite = nullptr;
+    const char* Backend = nullptr;
+    int NestingDepth = 0;
+    int NumberOfThreads = 1;
+    vtkIdType NumberOfIterations = 0;
+    vtkIdType Grain = 0;
+    vtkIdType NumberOfChunks = 0;
+    double StartTime = 0.0;
+    double WallTime = 0.0;
+    double BusyTime = 0.0;
+    double IdleTime = 0.0;
+    std::vector<ThreadTime> Threads;
+  };
+
+  // Statistics of the loops of a call site, see vtkSMPTools::ForStatistics.
+  struct Statistics
+  {
+    std::string CallSite;
+    std::string Backend;
+    vtkIdType NumberOfCalls = 0;
+    vtkIdType NumberOfIterations = 0;
+    vtkIdType NumberOfChunks = 0;
+    int MaximumNumberOfThreads = 0;
+    int MaximumNestingDepth = 0;
+    double WallTime = 0.0;
+    double BusyTime = 0.0;
+    double IdleTime = 0.0;
+    std::vector<double> ThreadBusyTimes;
+  };
+
+  using ListenerType = void (*)(const Call& call, void* clientData);
+
+  vtkSMPToolsInstrumentation(
+    const std::type_info& callSite, vtkIdType first, vtkIdType last, vtkIdType grain);
+  ~vtkSMPToolsInstrumentation();
+
+  // Whether the loops are instrumented, initially true when the
+  // VTK_SMP_INSTRUMENTATION environment variable is set to a nonzero value.
+  static bool IsEnabled();
+  static void SetEnabled(bool enabled);
+
+  // Accumulated statistics, from the most to the least expensive call site.
+  static std::vector<Statistics> GetStatistics();
+  static void ClearStatistics();
+
+  // Function called with the statistics of each loop, on the thread that
+  // ran it, once its statistics are accumulated. Calls are serialized.
+  static void SetListener(ListenerType listener, void* clientData);
+
+  // Readable name of a call site.
+  static std::string GetCallSiteName(const std::type_info& callSite);
+
+  // Monotonic time, in seconds.
+  static double GetTime();
+
+  // Time a chunk of a loop, if instrumented.
+  class Chunk
+  {
+  public:
+    Chunk(vtkSMPToolsInstrumentation* instrumentation)
+      : Instrumentation(instrumentation)
+    {
+      if (instrumentation)
+      {
+        this->Previous = vtkSMPToolsInstrumentation::GetCurrent();
+        vtkSMPToolsInstrumentation::GetCurrent() = instrumentation;
+        this->StartTime = vtkSMPToolsInstrumentation::GetTime();
+      }
+    }
+    ~Chunk()
+    {
+      if (this->Instrumentation)
+      {
+        this->Instrumentation->AddChunk(vtkSMPToolsInstrumentation::GetTime() - this->StartTime);
+        vtkSMPToolsInstrumentation::GetCurrent() = this->Previous;
+      }
+    }
+
+  private:
+    vtkSMPToolsInstrumentation* Instrumentation;
+    vtkSMPToolsInstrumentation* Previous = nullptr;
+    double StartTime = 0.0;
+
+    Chunk(const Chunk&) = delete;
+    void operator=(const Chunk&) = delete;
+  };
+
+private:
+  // The loop whose chunk the calling thread runs, nullptr if none.
+  static vtkSMPToolsInstrumentation*& GetCurrent();
+
+  void AddChunk(double busyTime);
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+
+  vtkSMPToolsInstrumentation(const vtkSMPToolsInstrumentation&) = delete;
+  void operator=(const vtkSMPToolsInstrumentation&) = delete;
+};
+
 class VTKCOMMONCORE_EXPORT vtkSMPToolsAPI
 {
 public:
@@ -101,6 +291,9 @@ public:
     *this << oldConfig;
   }
 
+  //--------------------------------------------------------------------------------
+  void RunTasks(std::vector<std::function<void()>>& tasks);
+
   //--------------------------------------------------------------------------------
   template <typename FunctorInternal>
   void For(vtkIdType first, vtkIdType last, vtkIdType grain, FunctorInternal& fi)
@@ -228,6 +421,66 @@ public:
     }
   }
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp& op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp& op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename BinaryOp>
+  T Reduce(InputIt begin, InputIt end, T init, BinaryOp& op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        return this->SequentialBackend->Reduce(begin, end, init, op);
+      case BackendType::STDThread:
+        return this->STDThreadBackend->Reduce(begin, end, init, op);
+      case BackendType::TBB:
+        return this->TBBBackend->Reduce(begin, end, init, op);
+      case BackendType::OpenMP:
+        return this->OpenMPBackend->Reduce(begin, end, init, op);
+    }
+    return init;
+  }
+
   // disable copying
   vtkSMPToolsAPI(vtkSMPToolsAPI const&) = delete;
   void operator=(vtkSMPToolsAPI const&) = delete;
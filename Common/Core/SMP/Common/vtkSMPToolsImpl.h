@@ -21,6 +21,8 @@
 #include "vtkSMP.h"
 
 #include <atomic>
+#include <functional> // For std::function
+#include <vector>     // For std::vector
 
 #define VTK_SMP_MAX_BACKENDS_NB 4
 
@@ -80,6 +82,9 @@ public:
   template <typename FunctorInternal>
   void For(vtkIdType first, vtkIdType last, vtkIdType grain, FunctorInternal& fi);
 
+  //--------------------------------------------------------------------------------
+  void RunTasks(std::vector<std::function<void()>>& tasks);
+
   //--------------------------------------------------------------------------------
   template <typename InputIt, typename OutputIt, typename Functor>
   void Transform(InputIt inBegin, InputIt inEnd, OutputIt outBegin, Functor transform);
@@ -101,6 +106,18 @@ public:
   template <typename RandomAccessIterator, typename Compare>
   void Sort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp);
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename BinaryOp>
+  T Reduce(InputIt begin, InputIt end, T init, BinaryOp op);
+
   //--------------------------------------------------------------------------------
   vtkSMPToolsImpl()
     : NestedActivated(true)
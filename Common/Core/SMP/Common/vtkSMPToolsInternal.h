@@ -16,7 +16,9 @@
 #ifndef vtkSMPToolsInternal_h
 #define vtkSMPToolsInternal_h
 
-#include <iterator> // For std::advance
+#include <algorithm> // For std::min
+#include <iterator>  // For std::advance
+#include <vector>    // For std::vector
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 namespace vtk
@@ -102,6 +104,181 @@ public:
   T operator()(T vtkNotUsed(inValue)) { return Value; }
 };
 
+// Computes the sum of each block of BlockSize values of the input.
+template <typename InputIt, typename T, typename BinaryOp>
+class BlockReduceCall
+{
+  InputIt In;
+  vtkIdType Size;
+  vtkIdType BlockSize;
+  std::vector<T>& Sums;
+  BinaryOp& Op;
+
+public:
+  BlockReduceCall(
+    InputIt _in, vtkIdType _size, vtkIdType _blockSize, std::vector<T>& _sums, BinaryOp& _op)
+    : In(_in)
+    , Size(_size)
+    , BlockSize(_blockSize)
+    , Sums(_sums)
+    , Op(_op)
+  {
+  }
+
+  void Execute(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType block = begin; block < end; ++block)
+    {
+      const vtkIdType first = block * this->BlockSize;
+      const vtkIdType last = (std::min)(first + this->BlockSize, this->Size);
+      InputIt itIn(In);
+      std::advance(itIn, first);
+      T sum = *itIn;
+      for (vtkIdType it = first + 1; it < last; it++)
+      {
+        ++itIn;
+        sum = Op(sum, *itIn);
+      }
+      this->Sums[block] = sum;
+    }
+  }
+};
+
+// Scans each block of BlockSize values of the input, starting from the carry
+// of the block. The first block has no carry for an inclusive scan without
+// initial value.
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+class BlockScanCall
+{
+  InputIt In;
+  OutputIt Out;
+  vtkIdType Size;
+  vtkIdType BlockSize;
+  const std::vector<T>& Carries;
+  BinaryOp& Op;
+  bool Inclusive;
+  bool FirstBlockHasCarry;
+
+public:
+  BlockScanCall(InputIt _in, OutputIt _out, vtkIdType _size, vtkIdType _blockSize,
+    const std::vector<T>& _carries, BinaryOp& _op, bool _inclusive, bool _firstBlockHasCarry)
+    : In(_in)
+    , Out(_out)
+    , Size(_size)
+    , BlockSize(_blockSize)
+    , Carries(_carries)
+    , Op(_op)
+    , Inclusive(_inclusive)
+    , FirstBlockHasCarry(_firstBlockHasCarry)
+  {
+  }
+
+  void Execute(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType block = begin; block < end; ++block)
+    {
+      vtkIdType first = block * this->BlockSize;
+      const vtkIdType last = (std::min)(first + this->BlockSize, this->Size);
+      InputIt itIn(In);
+      OutputIt itOut(Out);
+      std::advance(itIn, first);
+      std::advance(itOut, first);
+      T sum = this->Carries[block];
+      if (block == 0 && !this->FirstBlockHasCarry)
+      {
+        sum = *itIn;
+        *itOut = sum;
+        ++itIn;
+        ++itOut;
+        ++first;
+      }
+      for (vtkIdType it = first; it < last; it++)
+      {
+        if (this->Inclusive)
+        {
+          sum = Op(sum, *itIn);
+          *itOut = sum;
+        }
+        else
+        {
+          // read the input before writing the output for in-place scans
+          T value = *itIn;
+          *itOut = sum;
+          sum = Op(sum, value);
+        }
+        ++itIn;
+        ++itOut;
+      }
+    }
+  }
+};
+
+// Number of values below which the blocked algorithms run on a single block.
+constexpr vtkIdType MinimumScanBlockSize = 1024;
+
+inline vtkIdType GetNumberOfScanBlocks(int numberOfThreads, vtkIdType size)
+{
+  const vtkIdType maximumNumberOfBlocks = (size + MinimumScanBlockSize - 1) / MinimumScanBlockSize;
+  return numberOfThreads > 1
+    ? (std::max)(vtkIdType(1), (std::min)(vtkIdType(4) * numberOfThreads, maximumNumberOfBlocks))
+    : 1;
+}
+
+// Two pass scan for backends without a native one: the sums of the blocks
+// are computed in parallel, scanned sequentially, then each block is scanned
+// in parallel from its carry. `init` is only used as a first carry when
+// `hasInit` is true.
+template <typename Impl, typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void BlockedScan(Impl& impl, InputIt inBegin, vtkIdType size, OutputIt outBegin, const T& init,
+  bool hasInit, BinaryOp& op, bool inclusive)
+{
+  if (size <= 0)
+  {
+    return;
+  }
+  vtkIdType numberOfBlocks = GetNumberOfScanBlocks(impl.GetEstimatedNumberOfThreads(), size);
+  const vtkIdType blockSize = (size + numberOfBlocks - 1) / numberOfBlocks;
+  numberOfBlocks = (size + blockSize - 1) / blockSize;
+
+  // the sum of the last block is not needed
+  std::vector<T> sums(numberOfBlocks, init);
+  BlockReduceCall<InputIt, T, BinaryOp> reduce(inBegin, size, blockSize, sums, op);
+  impl.For(0, numberOfBlocks - 1, 1, reduce);
+
+  std::vector<T> carries(numberOfBlocks, init);
+  for (vtkIdType block = 1; block < numberOfBlocks; ++block)
+  {
+    carries[block] =
+      (block > 1 || hasInit) ? op(carries[block - 1], sums[block - 1]) : sums[block - 1];
+  }
+  BlockScanCall<InputIt, OutputIt, T, BinaryOp> scan(
+    inBegin, outBegin, size, blockSize, carries, op, inclusive, hasInit);
+  impl.For(0, numberOfBlocks, 1, scan);
+}
+
+// Reduction for backends without a native one: the sums of the blocks are
+// computed in parallel and combined in order.
+template <typename Impl, typename InputIt, typename T, typename BinaryOp>
+T BlockedReduce(Impl& impl, InputIt inBegin, vtkIdType size, T init, BinaryOp& op)
+{
+  if (size <= 0)
+  {
+    return init;
+  }
+  vtkIdType numberOfBlocks = GetNumberOfScanBlocks(impl.GetEstimatedNumberOfThreads(), size);
+  const vtkIdType blockSize = (size + numberOfBlocks - 1) / numberOfBlocks;
+  numberOfBlocks = (size + blockSize - 1) / blockSize;
+
+  std::vector<T> sums(numberOfBlocks, init);
+  BlockReduceCall<InputIt, T, BinaryOp> reduce(inBegin, size, blockSize, sums, op);
+  impl.For(0, numberOfBlocks, 1, reduce);
+  for (const T& sum : sums)
+  {
+    init = op(init, sum);
+  }
+  return init;
+}
+
 VTK_ABI_NAMESPACE_END
 
 } // namespace smp
@@ -83,6 +83,45 @@ bool vtkSMPToolsImpl<BackendType::OpenMP>::GetSingleThread()
   return GetSingleThreadOpenMP();
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::OpenMP>::RunTasks(std::vector<std::function<void()>>& tasks)
+{
+  const int numberOfTasks = static_cast<int>(tasks.size());
+#if _OPENMP >= 200805
+  // Explicit tasks bind to the current team, so the groups created in the
+  // tasks add their tasks to it instead of opening nested parallel regions.
+  if (omp_in_parallel())
+  {
+    for (int i = 0; i < numberOfTasks; ++i)
+    {
+#pragma omp task shared(tasks)
+      tasks[i]();
+    }
+#pragma omp taskwait
+    return;
+  }
+
+#pragma omp parallel num_threads(GetNumberOfThreadsOpenMP())
+#pragma omp single
+  {
+    for (int i = 0; i < numberOfTasks; ++i)
+    {
+#pragma omp task shared(tasks)
+      tasks[i]();
+    }
+#pragma omp taskwait
+  }
+#else
+  // Without explicit tasks, only the outermost group runs in parallel.
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int i = 0; i < numberOfTasks; ++i)
+  {
+    tasks[i]();
+  }
+#endif
+}
+
 //------------------------------------------------------------------------------
 void vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
   ExecuteFunctorPtrType functorExecuter, void* functor, bool nestedActivated)
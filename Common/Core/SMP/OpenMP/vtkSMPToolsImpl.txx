@@ -139,6 +139,38 @@ void vtkSMPToolsImpl<BackendType::OpenMP>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::OpenMP>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  BlockedScan(*this, inBegin, std::distance(inBegin, inEnd), outBegin, init, true, op, false);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::OpenMP>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  if (inBegin == inEnd)
+  {
+    return;
+  }
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  const ValueType first = *inBegin;
+  BlockedScan(*this, inBegin, std::distance(inBegin, inEnd), outBegin, first, false, op, true);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::OpenMP>::Reduce(InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  return BlockedReduce(*this, begin, std::distance(begin, end), init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::OpenMP>::Initialize(int);
@@ -151,6 +183,10 @@ int vtkSMPToolsImpl<BackendType::OpenMP>::GetEstimatedNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::OpenMP>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::OpenMP>::RunTasks(std::vector<std::function<void()>>& tasks);
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -20,9 +20,15 @@
 #include <algorithm>
 #include <cassert>
 #include <condition_variable>
+#include <cstdlib> // For std::getenv()
 #include <future>
 #include <iostream>
 
+#if defined(__linux__)
+#include <pthread.h> // For pthread_setaffinity_np()
+#include <sched.h>   // For sched_getaffinity()
+#endif
+
 namespace vtk
 {
 namespace detail
@@ -33,6 +39,54 @@ VTK_ABI_NAMESPACE_BEGIN
 
 static constexpr std::size_t NoRunningJob = (std::numeric_limits<std::size_t>::max)();
 
+namespace
+{
+// Pin the threads of the pool when the VTK_SMP_PIN_THREADS environment
+// variable is set to a non zero value: the i-th thread is bound to the i-th
+// CPU the process may run on. Because a top level proxy hands its jobs to the
+// pool threads in a fixed round-robin order, and a loop starts each job on the
+// same contiguous part of its range, the same CPU then mostly touches the same
+// part of an array across loops of the same range and grain, which keeps the
+// accesses on the NUMA node where the pages were first touched.
+void PinThreads(std::vector<std::thread*>& threads)
+{
+  const char* pinThreads = std::getenv("VTK_SMP_PIN_THREADS");
+  if (!pinThreads || std::atoi(pinThreads) == 0)
+  {
+    return;
+  }
+#if defined(__linux__)
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+  {
+    return;
+  }
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+  {
+    if (CPU_ISSET(cpu, &allowed))
+    {
+      cpus.push_back(cpu);
+    }
+  }
+  if (cpus.empty())
+  {
+    return;
+  }
+  for (std::size_t i = 0; i < threads.size(); ++i)
+  {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpus[i % cpus.size()], &cpuSet);
+    pthread_setaffinity_np(threads[i]->native_handle(), sizeof(cpuSet), &cpuSet);
+  }
+#else
+  (void)threads; // thread pinning is only implemented on Linux
+#endif
+}
+}
+
 struct vtkSMPThreadPool::ThreadJob
 {
   // This construtor is needed because aggregate initialization can not have default value
@@ -228,12 +282,16 @@ vtkSMPThreadPool::vtkSMPThreadPool()
   const auto threadCount = static_cast<std::size_t>(std::thread::hardware_concurrency());
 
   this->Threads.reserve(threadCount);
+  std::vector<std::thread*> systemThreads;
+  systemThreads.reserve(threadCount);
   for (std::size_t i{}; i < threadCount; ++i)
   {
     std::unique_ptr<ThreadData> data{ new ThreadData{} };
     data->SystemThread = this->MakeThread();
+    systemThreads.push_back(&data->SystemThread);
     this->Threads.emplace_back(std::move(data));
   }
+  PinThreads(systemThreads);
 
   this->Initialized.store(true, std::memory_order_release);
 }
@@ -365,11 +423,9 @@ std::thread vtkSMPThreadPool::MakeThread()
     {
       std::unique_lock<std::mutex> lock{ threadData.Mutex };
 
-      // Job stealing could be implemented but it will requires some changes in the process
-      // A thread that as no longer work to do could look at other threads jobs to "steal" a job
-      // from them and thus increase parallelism. This must take care of not generating deadlocks
-      // and should not increase Proxy parallelism above requested thread count.
-      // This goes out of the scope of current implementation.
+      // Jobs are not stolen between threads: the loops balance their work within their own
+      // jobs instead, see vtkSMPWorkStealingRange, which cannot deadlock nor increase Proxy
+      // parallelism above requested thread count.
       threadData.ConditionVariable.wait(lock, [this, &threadData] {
         return !threadData.Jobs.empty() || this->Joining.load(std::memory_order_acquire);
       });
@@ -435,6 +491,105 @@ vtkSMPThreadPool& vtkSMPThreadPool::GetInstance()
   return instance;
 }
 
+struct vtkSMPWorkStealingRange::Part
+{
+  std::mutex Mutex{};
+  vtkIdType Begin{}; // first block left
+  vtkIdType End{};   // past the last block left
+  char Padding[64];  // keep the parts of different workers on different cache lines
+};
+
+vtkSMPWorkStealingRange::vtkSMPWorkStealingRange(
+  vtkIdType first, vtkIdType last, vtkIdType grain, std::size_t numberOfWorkers)
+  : First{ first }
+  , Last{ last }
+  , Grain{ grain > 0 ? grain : 1 }
+  , NumberOfWorkers{ numberOfWorkers > 0 ? numberOfWorkers : 1 }
+  , Parts{ new Part[numberOfWorkers > 0 ? numberOfWorkers : 1] }
+{
+  const vtkIdType numberOfBlocks = last > first ? (last - first - 1) / this->Grain + 1 : 0;
+  const auto numberOfParts = static_cast<vtkIdType>(this->NumberOfWorkers);
+  for (vtkIdType i = 0; i < numberOfParts; ++i)
+  {
+    this->Parts[i].Begin = numberOfBlocks * i / numberOfParts;
+    this->Parts[i].End = numberOfBlocks * (i + 1) / numberOfParts;
+  }
+}
+
+vtkSMPWorkStealingRange::~vtkSMPWorkStealingRange() = default;
+
+bool vtkSMPWorkStealingRange::Next(std::size_t worker, vtkIdType& from, vtkIdType& to)
+{
+  assert(worker < this->NumberOfWorkers && "worker out of range");
+
+  vtkIdType block = 0;
+  bool found = false;
+  {
+    Part& part = this->Parts[worker];
+    std::lock_guard<std::mutex> lock{ part.Mutex };
+    if (part.Begin < part.End)
+    {
+      block = part.Begin++;
+      found = true;
+    }
+  }
+  if (!found && !this->Steal(worker, block))
+  {
+    return false;
+  }
+
+  from = this->First + block * this->Grain;
+  to = (std::min)(from + this->Grain, this->Last);
+  return true;
+}
+
+bool vtkSMPWorkStealingRange::Steal(std::size_t worker, vtkIdType& block)
+{
+  // The part of the worker is empty and only the worker refills it, so no
+  // lock is held while looking for the largest part. Retry if that part is
+  // emptied before being locked.
+  while (true)
+  {
+    std::size_t victim = worker;
+    vtkIdType largest = 0;
+    for (std::size_t i = 1; i < this->NumberOfWorkers; ++i)
+    {
+      const std::size_t candidate = (worker + i) % this->NumberOfWorkers;
+      Part& part = this->Parts[candidate];
+      std::lock_guard<std::mutex> lock{ part.Mutex };
+      if (part.End - part.Begin > largest)
+      {
+        largest = part.End - part.Begin;
+        victim = candidate;
+      }
+    }
+    if (victim == worker)
+    {
+      return false;
+    }
+
+    Part& part = this->Parts[victim];
+    std::unique_lock<std::mutex> lock{ part.Mutex };
+    const vtkIdType left = part.End - part.Begin;
+    if (left <= 0)
+    {
+      continue;
+    }
+    // Take the back half, rounded up so that the last block is taken too.
+    const vtkIdType middle = part.End - (left + 1) / 2;
+    const vtkIdType end = part.End;
+    part.End = middle;
+    lock.unlock();
+
+    Part& own = this->Parts[worker];
+    std::lock_guard<std::mutex> ownLock{ own.Mutex };
+    block = middle;
+    own.Begin = middle + 1;
+    own.End = end;
+    return true;
+  }
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
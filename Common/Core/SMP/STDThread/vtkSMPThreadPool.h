@@ -20,6 +20,8 @@
 // The DoJob() method is used attributes the job to a free thread, if all
 // threads are working, the job is kept in a queue. Note that vtkSMPThreadPool
 // destructor joins threads and finish the jobs in the queue.
+// vtkSMPWorkStealingRange balances the chunks of a loop between the jobs
+// running it.
 
 #ifndef vtkSMPThreadPool_h
 #define vtkSMPThreadPool_h
@@ -29,6 +31,7 @@
 
 #include <atomic>     // For std::atomic
 #include <functional> // For std::function
+#include <memory>     // For std::unique_ptr
 #include <mutex>      // For std::unique_lock
 #include <thread>     // For std::thread
 #include <vector>     // For std::vector
@@ -184,6 +187,47 @@ public:
   static vtkSMPThreadPool& GetInstance();
 };
 
+/**
+ * @brief Range of a parallel for loop shared by the workers running it, with work stealing
+ *
+ * The range is cut in blocks of grain items, and the blocks are distributed in contiguous parts,
+ * one per worker. A worker takes the blocks of its part from the front, one at a time. Once its
+ * part is empty, it steals the back half of the largest part left, which becomes its own part and
+ * can be stolen from in turn. The range is thus only split further when a worker runs out of work
+ * (lazy binary splitting), which balances irregular loops while the workers mostly access their
+ * own part. The chunks are the same as with a static distribution: the blocks, from first by
+ * steps of grain.
+ *
+ * Next() can be called concurrently, but each worker must be used by one thread at a time.
+ */
+class VTKCOMMONCORE_EXPORT vtkSMPWorkStealingRange
+{
+public:
+  vtkSMPWorkStealingRange(
+    vtkIdType first, vtkIdType last, vtkIdType grain, std::size_t numberOfWorkers);
+  ~vtkSMPWorkStealingRange();
+  vtkSMPWorkStealingRange(const vtkSMPWorkStealingRange&) = delete;
+  vtkSMPWorkStealingRange& operator=(const vtkSMPWorkStealingRange&) = delete;
+
+  /**
+   * @brief Get the next chunk [from, to) of a worker
+   *
+   * @return false once every block has been taken.
+   */
+  bool Next(std::size_t worker, vtkIdType& from, vtkIdType& to);
+
+private:
+  struct Part;
+
+  bool Steal(std::size_t worker, vtkIdType& block);
+
+  vtkIdType First;
+  vtkIdType Last;
+  vtkIdType Grain;
+  std::size_t NumberOfWorkers;
+  std::unique_ptr<Part[]> Parts;
+};
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
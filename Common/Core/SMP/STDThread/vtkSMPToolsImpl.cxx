@@ -15,9 +15,12 @@
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/STDThread/vtkSMPToolsImpl.txx"
+#include "vtkMultiThreader.h"
 
-#include <cstdlib> // For std::getenv()
-#include <thread>  // For std::thread::hardware_concurrency()
+#include <algorithm> // For std::min()
+#include <atomic>    // For std::atomic
+#include <cstdlib>   // For std::getenv()
+#include <thread>    // For std::thread::hardware_concurrency()
 
 namespace vtk
 {
@@ -31,7 +34,8 @@ static int specifiedNumThreads = 0;
 //------------------------------------------------------------------------------
 int GetNumberOfThreadsSTDThread()
 {
-  return specifiedNumThreads ? specifiedNumThreads : std::thread::hardware_concurrency();
+  return vtkMultiThreader::LimitToGlobalMaximumNumberOfThreads(
+    specifiedNumThreads ? specifiedNumThreads : std::thread::hardware_concurrency());
 }
 
 //------------------------------------------------------------------------------
@@ -62,7 +66,7 @@ void vtkSMPToolsImpl<BackendType::STDThread>::Initialize(int numThreads)
 template <>
 int vtkSMPToolsImpl<BackendType::STDThread>::GetEstimatedNumberOfThreads()
 {
-  return specifiedNumThreads > 0 ? specifiedNumThreads : std::thread::hardware_concurrency();
+  return GetNumberOfThreadsSTDThread();
 }
 
 //------------------------------------------------------------------------------
@@ -79,6 +83,44 @@ bool vtkSMPToolsImpl<BackendType::STDThread>::IsParallelScope()
   return vtkSMPThreadPool::GetInstance().IsParallelScope();
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::STDThread>::RunTasks(std::vector<std::function<void()>>& tasks)
+{
+  if (tasks.size() < 2)
+  {
+    for (auto& task : tasks)
+    {
+      task();
+    }
+    return;
+  }
+
+  // Allocate no more threads than tasks: a group created in a task gets a
+  // nested proxy made of the calling thread and of the threads that the
+  // enclosing groups do not use, whatever the nested parallelism setting, so
+  // recursive groups spread over the whole pool.
+  const std::size_t threadNumber =
+    std::min(tasks.size(), static_cast<std::size_t>(GetNumberOfThreadsSTDThread()));
+  auto proxy = vtkSMPThreadPool::GetInstance().AllocateThreads(threadNumber);
+
+  std::atomic<std::size_t> nextTask(0);
+  const std::size_t numberOfWorkers = proxy.GetThreads().size();
+  for (std::size_t worker = 0; worker < numberOfWorkers; ++worker)
+  {
+    proxy.DoJob(
+      [&tasks, &nextTask]
+      {
+        for (std::size_t i = nextTask++; i < tasks.size(); i = nextTask++)
+        {
+          tasks[i]();
+        }
+      });
+  }
+
+  proxy.Join();
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
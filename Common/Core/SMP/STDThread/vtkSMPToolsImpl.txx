@@ -56,16 +56,29 @@ void vtkSMPToolsImpl<BackendType::STDThread>::For(
 
     if (grain <= 0)
     {
-      vtkIdType estimateGrain = (last - first) / (threadNumber * 4);
+      // Work stealing balances the chunks, so finer chunks only cost a few
+      // more calls to the functor.
+      vtkIdType estimateGrain = (last - first) / (threadNumber * 16);
       grain = (estimateGrain > 0) ? estimateGrain : 1;
     }
 
     auto proxy = vtkSMPThreadPool::GetInstance().AllocateThreads(threadNumber);
 
-    for (vtkIdType from = first; from < last; from += grain)
+    // One job per thread of the proxy, taking chunks from the shared range.
+    const std::size_t numberOfWorkers = proxy.GetThreads().size();
+    vtkSMPWorkStealingRange range(first, last, grain, numberOfWorkers);
+    for (std::size_t worker = 0; worker < numberOfWorkers; ++worker)
     {
-      const auto to = (std::min)(from + grain, last);
-      proxy.DoJob([&fi, from, to] { fi.Execute(from, to); });
+      proxy.DoJob(
+        [&fi, &range, worker]
+        {
+          vtkIdType from = 0;
+          vtkIdType to = 0;
+          while (range.Next(worker, from, to))
+          {
+            fi.Execute(from, to);
+          }
+        });
     }
 
     proxy.Join();
@@ -127,6 +140,38 @@ void vtkSMPToolsImpl<BackendType::STDThread>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::STDThread>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  BlockedScan(*this, inBegin, std::distance(inBegin, inEnd), outBegin, init, true, op, false);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::STDThread>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  if (inBegin == inEnd)
+  {
+    return;
+  }
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  const ValueType first = *inBegin;
+  BlockedScan(*this, inBegin, std::distance(inBegin, inEnd), outBegin, first, false, op, true);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::STDThread>::Reduce(InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  return BlockedReduce(*this, begin, std::distance(begin, end), init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::STDThread>::Initialize(int);
@@ -139,6 +184,10 @@ int vtkSMPToolsImpl<BackendType::STDThread>::GetEstimatedNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::STDThread>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::STDThread>::RunTasks(std::vector<std::function<void()>>& tasks);
+
 //--------------------------------------------------------------------------------
 template <>
 bool vtkSMPToolsImpl<BackendType::STDThread>::IsParallelScope();
@@ -44,6 +44,16 @@ bool vtkSMPToolsImpl<BackendType::Sequential>::GetSingleThread()
   return true;
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::Sequential>::RunTasks(std::vector<std::function<void()>>& tasks)
+{
+  for (auto& task : tasks)
+  {
+    task();
+  }
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -17,6 +17,7 @@
 #define SequentialvtkSMPToolsImpl_txx
 
 #include <algorithm> // For std::sort, std::transform, std::fill
+#include <iterator>  // For std::iterator_traits
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/Common/vtkSMPToolsInternal.h" // For common vtk smp class
@@ -105,6 +106,53 @@ void vtkSMPToolsImpl<BackendType::Sequential>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::Sequential>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  for (; inBegin != inEnd; ++inBegin, ++outBegin)
+  {
+    // read the input before writing the output for in-place scans
+    T value = *inBegin;
+    *outBegin = init;
+    init = op(init, value);
+  }
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::Sequential>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  if (inBegin == inEnd)
+  {
+    return;
+  }
+  typename std::iterator_traits<InputIt>::value_type sum = *inBegin;
+  *outBegin = sum;
+  for (++inBegin, ++outBegin; inBegin != inEnd; ++inBegin, ++outBegin)
+  {
+    sum = op(sum, *inBegin);
+    *outBegin = sum;
+  }
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::Sequential>::Reduce(
+  InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  for (; begin != end; ++begin)
+  {
+    init = op(init, *begin);
+  }
+  return init;
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::Sequential>::Initialize(int);
@@ -117,6 +165,10 @@ int vtkSMPToolsImpl<BackendType::Sequential>::GetEstimatedNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::Sequential>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::Sequential>::RunTasks(std::vector<std::function<void()>>& tasks);
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
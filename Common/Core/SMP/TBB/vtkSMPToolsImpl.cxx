@@ -26,6 +26,7 @@
 #endif
 
 #include <tbb/task_arena.h> // For tbb:task_arena
+#include <tbb/task_group.h> // For tbb:task_group
 
 #ifdef _MSC_VER
 #pragma pop_macro("__TBB_NO_IMPLICIT_LINKAGE")
@@ -95,6 +96,31 @@ bool vtkSMPToolsImpl<BackendType::TBB>::GetSingleThread()
   return threadIdStack.top() == tbb::this_task_arena::current_thread_index();
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::TBB>::RunTasks(std::vector<std::function<void()>>& tasks)
+{
+  // The groups created in the tasks spawn their own tasks in the same arena,
+  // where idle threads steal them.
+  auto runTasks = [&tasks]()
+  {
+    tbb::task_group group;
+    for (auto& task : tasks)
+    {
+      group.run([&task]() { task(); });
+    }
+    group.wait();
+  };
+  if (taskArena.is_active())
+  {
+    taskArena.execute(runTasks);
+  }
+  else
+  {
+    runTasks();
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkSMPToolsImplForTBB(vtkIdType first, vtkIdType last, vtkIdType grain,
   ExecuteFunctorPtrType functorExecuter, void* functor)
@@ -27,6 +27,8 @@
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_scan.h>
 #include <tbb/parallel_sort.h>
 
 #ifdef _MSC_VER
@@ -104,6 +106,158 @@ void ExecuteFunctorTBB(void* functor, vtkIdType first, vtkIdType last, vtkIdType
   }
 }
 
+//--------------------------------------------------------------------------------
+// Body of tbb::parallel_scan. The sums only accumulate input values so that
+// they do not depend on how TBB splits and joins the bodies, the initial
+// value of an exclusive scan is combined when writing the output.
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+class ScanBodyTBB
+{
+  InputIt In;
+  OutputIt Out;
+  BinaryOp& Op;
+  T Init;
+  T Sum;
+  bool HasSum;
+  bool Inclusive;
+
+public:
+  ScanBodyTBB(InputIt _in, OutputIt _out, BinaryOp& _op, const T& _init, bool _inclusive)
+    : In(_in)
+    , Out(_out)
+    , Op(_op)
+    , Init(_init)
+    , Sum(_init)
+    , HasSum(false)
+    , Inclusive(_inclusive)
+  {
+  }
+
+  ScanBodyTBB(ScanBodyTBB& other, tbb::split)
+    : In(other.In)
+    , Out(other.Out)
+    , Op(other.Op)
+    , Init(other.Init)
+    , Sum(other.Init)
+    , HasSum(false)
+    , Inclusive(other.Inclusive)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<vtkIdType>& r, Tag)
+  {
+    InputIt itIn(In);
+    OutputIt itOut(Out);
+    std::advance(itIn, r.begin());
+    if (Tag::is_final_scan())
+    {
+      std::advance(itOut, r.begin());
+    }
+    for (vtkIdType it = r.begin(); it < r.end(); it++)
+    {
+      // read the input before writing the output for in-place scans
+      T value = *itIn;
+      if (Tag::is_final_scan() && !this->Inclusive)
+      {
+        *itOut = this->HasSum ? Op(this->Init, this->Sum) : this->Init;
+      }
+      this->Sum = this->HasSum ? Op(this->Sum, value) : value;
+      this->HasSum = true;
+      if (Tag::is_final_scan())
+      {
+        if (this->Inclusive)
+        {
+          *itOut = this->Sum;
+        }
+        ++itOut;
+      }
+      ++itIn;
+    }
+  }
+
+  void reverse_join(ScanBodyTBB& left)
+  {
+    if (left.HasSum)
+    {
+      this->Sum = this->HasSum ? Op(left.Sum, this->Sum) : left.Sum;
+      this->HasSum = true;
+    }
+  }
+
+  void assign(ScanBodyTBB& other)
+  {
+    this->Sum = other.Sum;
+    this->HasSum = other.HasSum;
+  }
+};
+
+//--------------------------------------------------------------------------------
+// Body of tbb::parallel_reduce, which joins bodies in order.
+template <typename InputIt, typename T, typename BinaryOp>
+class ReduceBodyTBB
+{
+  InputIt In;
+  BinaryOp& Op;
+
+public:
+  T Sum;
+  bool HasSum;
+
+  ReduceBodyTBB(InputIt _in, BinaryOp& _op, const T& _init)
+    : In(_in)
+    , Op(_op)
+    , Sum(_init)
+    , HasSum(false)
+  {
+  }
+
+  ReduceBodyTBB(ReduceBodyTBB& other, tbb::split)
+    : In(other.In)
+    , Op(other.Op)
+    , Sum(other.Sum)
+    , HasSum(false)
+  {
+  }
+
+  void operator()(const tbb::blocked_range<vtkIdType>& r)
+  {
+    InputIt itIn(In);
+    std::advance(itIn, r.begin());
+    for (vtkIdType it = r.begin(); it < r.end(); it++)
+    {
+      this->Sum = this->HasSum ? Op(this->Sum, *itIn) : T(*itIn);
+      this->HasSum = true;
+      ++itIn;
+    }
+  }
+
+  void join(ReduceBodyTBB& right)
+  {
+    if (right.HasSum)
+    {
+      this->Sum = this->HasSum ? Op(this->Sum, right.Sum) : right.Sum;
+      this->HasSum = true;
+    }
+  }
+};
+
+//--------------------------------------------------------------------------------
+template <typename Body>
+void ExecuteScanBodyTBB(void* body, vtkIdType first, vtkIdType last, vtkIdType grain)
+{
+  tbb::parallel_scan(
+    tbb::blocked_range<vtkIdType>(first, last, grain), *reinterpret_cast<Body*>(body));
+}
+
+//--------------------------------------------------------------------------------
+template <typename Body>
+void ExecuteReduceBodyTBB(void* body, vtkIdType first, vtkIdType last, vtkIdType grain)
+{
+  tbb::parallel_reduce(
+    tbb::blocked_range<vtkIdType>(first, last, grain), *reinterpret_cast<Body*>(body));
+}
+
 //--------------------------------------------------------------------------------
 template <>
 template <typename FunctorInternal>
@@ -190,6 +344,88 @@ void vtkSMPToolsImpl<BackendType::TBB>::Sort(
   tbb::parallel_sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::TBB>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  const vtkIdType size = std::distance(inBegin, inEnd);
+  if (size <= 0)
+  {
+    return;
+  }
+  using Body = ScanBodyTBB<InputIt, OutputIt, T, BinaryOp>;
+  Body body(inBegin, outBegin, op, init, false);
+  if (!this->NestedActivated && this->IsParallel)
+  {
+    body(tbb::blocked_range<vtkIdType>(0, size), tbb::final_scan_tag());
+  }
+  else
+  {
+    // see For() for the handling of IsParallel
+    bool fromParallelCode = this->IsParallel.exchange(true);
+    vtkSMPToolsImplForTBB(0, size, MinimumScanBlockSize, ExecuteScanBodyTBB<Body>, &body);
+    bool trueFlag = true;
+    this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+  }
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::TBB>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  const vtkIdType size = std::distance(inBegin, inEnd);
+  if (size <= 0)
+  {
+    return;
+  }
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  using Body = ScanBodyTBB<InputIt, OutputIt, ValueType, BinaryOp>;
+  Body body(inBegin, outBegin, op, *inBegin, true);
+  if (!this->NestedActivated && this->IsParallel)
+  {
+    body(tbb::blocked_range<vtkIdType>(0, size), tbb::final_scan_tag());
+  }
+  else
+  {
+    // see For() for the handling of IsParallel
+    bool fromParallelCode = this->IsParallel.exchange(true);
+    vtkSMPToolsImplForTBB(0, size, MinimumScanBlockSize, ExecuteScanBodyTBB<Body>, &body);
+    bool trueFlag = true;
+    this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+  }
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::TBB>::Reduce(InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  const vtkIdType size = std::distance(begin, end);
+  if (size <= 0)
+  {
+    return init;
+  }
+  using Body = ReduceBodyTBB<InputIt, T, BinaryOp>;
+  Body body(begin, op, init);
+  if (!this->NestedActivated && this->IsParallel)
+  {
+    body(tbb::blocked_range<vtkIdType>(0, size));
+  }
+  else
+  {
+    // see For() for the handling of IsParallel
+    bool fromParallelCode = this->IsParallel.exchange(true);
+    vtkSMPToolsImplForTBB(0, size, MinimumScanBlockSize, ExecuteReduceBodyTBB<Body>, &body);
+    bool trueFlag = true;
+    this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+  }
+  return body.HasSum ? op(init, body.Sum) : init;
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::TBB>::Initialize(int);
@@ -202,6 +438,10 @@ int vtkSMPToolsImpl<BackendType::TBB>::GetEstimatedNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::TBB>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::TBB>::RunTasks(std::vector<std::function<void()>>& tasks);
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -0,0 +1,158 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDataArrayCopyOnWrite.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the arrays sharing a buffer with ShallowCopyOnWrite() copy it
+// before they modify it, and only then.
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkNew.h"
+#include "vtkSOADataArrayTemplate.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkIdType NumberOfTuples = 100;
+
+bool CheckValues(vtkDataArray* array, double offset, const char* what)
+{
+  for (vtkIdType i = 0; i < array->GetNumberOfValues(); ++i)
+  {
+    if (array->GetComponent(i / 3, i % 3) != i + offset)
+    {
+      std::cerr << what << ": wrong value " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+void Fill(vtkDataArray* array, double offset)
+{
+  array->SetNumberOfComponents(3);
+  array->SetNumberOfTuples(NumberOfTuples);
+  for (vtkIdType i = 0; i < array->GetNumberOfValues(); ++i)
+  {
+    array->SetComponent(i / 3, i % 3, i + offset);
+  }
+}
+}
+
+int TestDataArrayCopyOnWrite(int, char*[])
+{
+  vtkNew<vtkDoubleArray> source;
+  Fill(source, 0.0);
+
+  // the buffer is shared until the first write
+  vtkNew<vtkDoubleArray> copy;
+  copy->ShallowCopyOnWrite(source);
+  if (copy->GetPointer(0) != source->GetPointer(0) || !CheckValues(copy, 0.0, "copy"))
+  {
+    std::cerr << "The buffer is not shared" << std::endl;
+    return EXIT_FAILURE;
+  }
+  copy->SetValue(0, -1.0);
+  if (copy->GetPointer(0) == source->GetPointer(0) || source->GetValue(0) != 0.0 ||
+    copy->GetValue(0) != -1.0)
+  {
+    std::cerr << "SetValue() wrote to the shared buffer" << std::endl;
+    return EXIT_FAILURE;
+  }
+  copy->SetValue(0, 0.0);
+  if (!CheckValues(copy, 0.0, "copy after a write"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // the source copies the buffer too when it is the first to write
+  vtkNew<vtkDoubleArray> other;
+  other->ShallowCopyOnWrite(source);
+  double* shared = source->GetPointer(0);
+  source->WritePointer(0, 3)[1] = -1.0;
+  if (other->GetPointer(0) != shared || other->GetValue(1) != 1.0)
+  {
+    std::cerr << "WritePointer() wrote to the shared buffer" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // growing, filling and inserting copy the buffer
+  vtkNew<vtkDoubleArray> grown;
+  grown->ShallowCopyOnWrite(other);
+  grown->InsertNextTuple3(1.0, 2.0, 3.0);
+  vtkNew<vtkDoubleArray> filled;
+  filled->ShallowCopyOnWrite(other);
+  filled->Fill(5.0);
+  vtkNew<vtkDoubleArray> inserted;
+  inserted->ShallowCopyOnWrite(other);
+  inserted->InsertTuples(0, 1, 1, source);
+  if (!CheckValues(other, 0.0, "after growing, filling and inserting") ||
+    grown->GetNumberOfTuples() != NumberOfTuples + 1 || filled->GetValue(7) != 5.0 ||
+    inserted->GetValue(0) != 3.0)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // so do the tuple setters and inserters of vtkDataArray, including the
+  // insertions within the allocated memory
+  const double tuple[3] = { -1.0, -2.0, -3.0 };
+  vtkNew<vtkDoubleArray> tupleSet;
+  tupleSet->ShallowCopyOnWrite(other);
+  static_cast<vtkDataArray*>(tupleSet)->SetTuple(2, tuple);
+  vtkNew<vtkDoubleArray> tupleInserted;
+  tupleInserted->ShallowCopyOnWrite(other);
+  static_cast<vtkDataArray*>(tupleInserted)->InsertTuple(3, tuple);
+  vtkNew<vtkDoubleArray> reserved;
+  reserved->DeepCopy(other);
+  reserved->Resize(NumberOfTuples + 10);
+  vtkNew<vtkDoubleArray> appended;
+  appended->ShallowCopyOnWrite(reserved);
+  static_cast<vtkDataArray*>(appended)->InsertNextTuple(tuple);
+  reserved->InsertComponent(NumberOfTuples, 0, 5.0);
+  if (!CheckValues(other, 0.0, "after setting and inserting tuples") ||
+    tupleSet->GetValue(6) != -1.0 || tupleInserted->GetValue(9) != -1.0 ||
+    appended->GetValue(3 * NumberOfTuples) != -1.0 ||
+    reserved->GetValue(3 * NumberOfTuples) != 5.0)
+  {
+    std::cerr << "A tuple setter or inserter wrote to the shared buffer" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // no copy once the other arrays released the buffer
+  vtkNew<vtkFloatArray> alone;
+  Fill(alone, 1.0);
+  {
+    vtkNew<vtkFloatArray> released;
+    released->ShallowCopyOnWrite(alone);
+  }
+  float* pointer = alone->GetPointer(0);
+  alone->SetValue(0, 1.0f);
+  if (alone->GetPointer(0) != pointer)
+  {
+    std::cerr << "The buffer was copied while not shared" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // other arrays fall back to deep copies
+  vtkNew<vtkSOADataArrayTemplate<double>> soa;
+  soa->ShallowCopyOnWrite(source);
+  soa->SetTypedComponent(0, 1, 2.0);
+  if (source->GetValue(1) != -1.0 || soa->GetTypedComponent(0, 1) != 2.0)
+  {
+    std::cerr << "The SOA array is not a deep copy" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
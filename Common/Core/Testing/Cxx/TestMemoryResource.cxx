@@ -0,0 +1,170 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestMemoryResource.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the data arrays allocate their memory with the current memory
+// resource, and that the shipped resources keep the content of the arrays.
+
+#include "vtkBackgroundReleaseMemoryResource.h"
+#include "vtkDoubleArray.h"
+#include "vtkHugePageMemoryResource.h"
+#include "vtkIntArray.h"
+#include "vtkMemoryResource.h"
+#include "vtkNew.h"
+#include "vtkPoolMemoryResource.h"
+#include "vtkSOADataArrayTemplate.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// Grow an array one value at a time, then check its values.
+bool TestGrowth(vtkMemoryResource* resource, vtkIdType numberOfValues)
+{
+  vtkMemoryResourceScope scope(resource);
+  vtkNew<vtkIntArray> array;
+  array->Allocate(1);
+  for (vtkIdType i = 0; i < numberOfValues; ++i)
+  {
+    array->InsertNextValue(static_cast<int>(i));
+  }
+  array->Squeeze();
+  for (vtkIdType i = 0; i < numberOfValues; ++i)
+  {
+    if (array->GetValue(i) != static_cast<int>(i))
+    {
+      std::cerr << resource->GetClassName() << ": wrong value " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestMemoryResource(int, char*[])
+{
+  if (vtkMemoryResource::GetCurrent())
+  {
+    std::cerr << "Expected no memory resource by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkMemoryResource> counting;
+  {
+    vtkMemoryResourceScope scope(counting);
+    vtkNew<vtkDoubleArray> array;
+    array->SetNumberOfComponents(3);
+    array->SetNumberOfTuples(100);
+    if (counting->GetNumberOfAllocations() != 1)
+    {
+      std::cerr << "The AOS array made " << counting->GetNumberOfAllocations()
+                << " allocations instead of 1" << std::endl;
+      return EXIT_FAILURE;
+    }
+    // the SOA array keeps its values in a single block until its component
+    // arrays are set
+    vtkNew<vtkSOADataArrayTemplate<float>> soa;
+    soa->SetNumberOfComponents(2);
+    soa->SetNumberOfTuples(10);
+    if (counting->GetBytesInUse() != 300 * sizeof(double) + 20 * sizeof(float) ||
+      counting->GetNumberOfAllocations() != 2)
+    {
+      std::cerr << "Wrong counters: " << counting->GetBytesInUse() << " bytes in use, "
+                << counting->GetNumberOfAllocations() << " allocations" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (counting->GetBytesInUse() != 0 ||
+    counting->GetPeakBytesInUse() != 300 * sizeof(double) + 20 * sizeof(float))
+  {
+    std::cerr << "The arrays were not released to the resource" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (vtkMemoryResource::GetCurrent())
+  {
+    std::cerr << "The scope did not restore the previous resource" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // a released block is reused by the next allocation of its size class
+  vtkNew<vtkPoolMemoryResource> pool;
+  void* first;
+  {
+    vtkMemoryResourceScope scope(pool);
+    vtkNew<vtkDoubleArray> array;
+    array->SetNumberOfValues(1000);
+    first = array->GetVoidPointer(0);
+  }
+  if (pool->GetCachedBytes() < 1000 * sizeof(double))
+  {
+    std::cerr << "The pool did not keep the released block" << std::endl;
+    return EXIT_FAILURE;
+  }
+  {
+    vtkMemoryResourceScope scope(pool);
+    vtkNew<vtkDoubleArray> array;
+    array->SetNumberOfValues(990);
+    if (array->GetVoidPointer(0) != first || pool->GetCachedBytes() != 0)
+    {
+      std::cerr << "The pool did not reuse the released block" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  pool->ReleaseCachedMemory();
+
+  // a buffer allocated by a resource is released by this resource when it is
+  // reallocated without it
+  vtkNew<vtkIntArray> moved;
+  {
+    vtkMemoryResourceScope scope(pool);
+    moved->SetNumberOfValues(10);
+  }
+  moved->SetValue(9, 9);
+  moved->Resize(1000000);
+  if (moved->GetValue(9) != 9 || pool->GetBytesInUse() != 0)
+  {
+    std::cerr << "The resized buffer was not moved out of the pool" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // large blocks are freed in the background, the others right away
+  vtkNew<vtkBackgroundReleaseMemoryResource> background;
+  background->SetMinimumBlockSize(1000 * sizeof(double));
+  for (int i = 0; i < 10; ++i)
+  {
+    vtkMemoryResourceScope scope(background);
+    vtkNew<vtkDoubleArray> small;
+    small->SetNumberOfValues(999);
+    vtkNew<vtkDoubleArray> large;
+    large->SetNumberOfValues(1000000);
+  }
+  background->WaitForRelease();
+  if (background->GetBytesInUse() != 0 || background->GetPendingBytes() != 0)
+  {
+    std::cerr << "The background resource did not free the released blocks" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkHugePageMemoryResource> hugePages;
+  int success = TestGrowth(counting, 1000000);
+  success &= TestGrowth(background, 1000000);
+  success &= TestGrowth(pool, 1000000);
+  success &= TestGrowth(hugePages, 3 * vtkHugePageMemoryResource::GetHugePageSize());
+  if (hugePages->GetBytesInUse() != 0 || pool->GetBytesInUse() != 0)
+  {
+    std::cerr << "Memory still in use after releasing the arrays" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
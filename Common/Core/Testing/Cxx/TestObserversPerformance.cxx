@@ -14,8 +14,8 @@
 =========================================================================*/
 // .NAME Test speed of Observers.
 // .SECTION Description
-// Probe the speed of vtkObject::AddObserver, vtkObject::InvokeEvent and
-// vtkObject::RemoveObserver
+// Probe the speed of vtkObject::AddObserver, vtkObject::InvokeEvent,
+// vtkObject::RemoveObserver and vtkObject::Modified
 
 #include "vtkCollection.h"
 #include "vtkCommand.h"
@@ -62,6 +62,7 @@ vtkTimeStamp vtkSimpleCommand::MTime;
 
 //------------------------------------------------------------------------------
 double TestStressInvoke(int observerCount, int eventCount, int invokeCount);
+double TestStressModified(unsigned long observedEvent, int modifiedCount);
 
 //------------------------------------------------------------------------------
 int TestObserversPerformance(int, char*[])
@@ -103,6 +104,18 @@ int TestObserversPerformance(int, char*[])
       }
     }
   }
+
+  // objects without observers, observed for other events, and for their modifications
+  const unsigned long observedEvents[] = { vtkCommand::NoEvent, vtkCommand::StartEvent,
+    vtkCommand::ModifiedEvent };
+  for (unsigned long observedEvent : observedEvents)
+  {
+    double time = TestStressModified(observedEvent, 1000000);
+    if (VERBOSE_MODE & Csv)
+    {
+      std::cout << vtkCommand::GetStringFromEventId(observedEvent) << "," << time << std::endl;
+    }
+  }
   return res ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
@@ -178,3 +191,47 @@ double TestStressInvoke(int observerCount, int eventCount, int invokeCount)
   }
   return meanDuration;
 }
+
+//------------------------------------------------------------------------------
+double StressModified(const unsigned long observedEvent, const int modifiedCount)
+{
+  vtkNew<vtkObject> object;
+  vtkNew<vtkSimpleCommand> observer;
+  if (observedEvent != vtkCommand::NoEvent)
+  {
+    object->AddObserver(observedEvent, observer);
+  }
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  for (int modified = 0; modified < modifiedCount; ++modified)
+  {
+    object->Modified();
+  }
+  timer->StopTimer();
+  if (VERBOSE_MODE & Details)
+  {
+    std::cout << "StressModified " << modifiedCount << " modifications observed for "
+              << vtkCommand::GetStringFromEventId(observedEvent) << ": "
+              << timer->GetElapsedTime() << " seconds" << std::endl;
+  }
+  return timer->GetElapsedTime();
+}
+
+//------------------------------------------------------------------------------
+double TestStressModified(unsigned long observedEvent, int modifiedCount)
+{
+  double meanDuration = 0.0;
+  for (int i = 0; i < STRESS_COUNT; ++i)
+  {
+    meanDuration += StressModified(observedEvent, modifiedCount);
+  }
+  meanDuration /= STRESS_COUNT;
+  if (VERBOSE_MODE == CDash)
+  {
+    std::cout << "<DartMeasurement name=\"StressModified-"
+              << vtkCommand::GetStringFromEventId(observedEvent) << "-" << modifiedCount
+              << "\" type=\"numeric/double\">" << meanDuration << "</DartMeasurement>"
+              << std::endl;
+  }
+  return meanDuration;
+}
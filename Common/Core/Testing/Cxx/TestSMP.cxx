@@ -13,17 +13,27 @@
 
 =========================================================================*/
 #include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkMultiThreader.h"
 #include "vtkNew.h"
 #include "vtkObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMP.h"
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <deque>
 #include <functional>
+#include <mutex>
 #include <numeric>
 #include <set>
+#include <string>
+#include <thread>
 #include <vector>
 
 static const int Target = 10000;
@@ -162,6 +172,23 @@ public:
 
 vtkStandardNewMacro(MyVTKClass);
 
+// Recursive sum using nested task groups
+long long TaskGroupSum(const std::vector<int>& values, std::size_t begin, std::size_t end)
+{
+  if (end - begin <= 100)
+  {
+    return std::accumulate(values.begin() + begin, values.begin() + end, 0LL);
+  }
+  const std::size_t middle = begin + (end - begin) / 2;
+  long long left = 0;
+  long long right = 0;
+  vtkSMPTools::TaskGroup group;
+  group.Run([&]() { left = TaskGroupSum(values, begin, middle); });
+  group.Run([&]() { right = TaskGroupSum(values, middle, end); });
+  group.Wait();
+  return left + right;
+}
+
 class InitializableFunctor
 {
 public:
@@ -491,6 +518,305 @@ int doTestSMP()
       return EXIT_FAILURE;
     }
   }
+
+  // Test task groups
+  std::vector<int> taskData(Target);
+  std::iota(taskData.begin(), taskData.end(), 0);
+  const long long expectedSum = static_cast<long long>(Target) * (Target - 1) / 2;
+  for (bool nested : { true, false })
+  {
+    long long sum = 0;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ 0, vtkSMPTools::GetBackend(), nested },
+      [&]() { sum = TaskGroupSum(taskData, 0, taskData.size()); });
+    if (sum != expectedSum)
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::TaskGroup with nested parallelism "
+           << nested << ": " << sum << " instead of " << expectedSum << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // the groups created in tasks run in parallel even without nested
+  // parallelism, so the leaves of a tree of groups use more threads than the
+  // two tasks of the root group
+  std::mutex leafThreadsMutex;
+  std::set<std::thread::id> leafThreads;
+  std::function<void(int)> spawn = [&](int depth)
+  {
+    if (depth == 0)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      std::lock_guard<std::mutex> lock(leafThreadsMutex);
+      leafThreads.insert(std::this_thread::get_id());
+      return;
+    }
+    vtkSMPTools::TaskGroup subGroup;
+    subGroup.Run([&spawn, depth]() { spawn(depth - 1); });
+    subGroup.Run([&spawn, depth]() { spawn(depth - 1); });
+    subGroup.Wait();
+  };
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 0, vtkSMPTools::GetBackend(), false },
+    [&]() { spawn(3); });
+  if (std::string(vtkSMPTools::GetBackend()) != "Sequential" &&
+    vtkSMPTools::GetEstimatedNumberOfThreads() > 2 && leafThreads.size() <= 2)
+  {
+    cerr << "Error: the nested vtkSMPTools::TaskGroup ran on " << leafThreads.size()
+         << " threads only" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // a group can be reused after Wait
+  std::atomic<int> taskCount(0);
+  vtkSMPTools::TaskGroup group;
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    for (int i = 0; i < 10; ++i)
+    {
+      group.Run([&taskCount]() { ++taskCount; });
+    }
+    group.Wait();
+    if (taskCount != 10 * (pass + 1))
+    {
+      cerr << "Error: vtkSMPTools::TaskGroup ran " << taskCount << " tasks after pass " << pass
+           << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Test scans and reductions, with enough threads to split the ranges
+  bool scanSuccess = true;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 4, vtkSMPTools::GetBackend(), false },
+    [&]()
+    {
+      std::vector<vtkIdType> counts(Target);
+      for (int i = 0; i < Target; ++i)
+      {
+        counts[i] = (i * 7) % 5;
+      }
+      std::vector<vtkIdType> inclusive(Target);
+      vtkSMPTools::InclusiveScan(counts.begin(), counts.end(), inclusive.begin());
+      std::vector<vtkIdType> exclusive(counts);
+      vtkSMPTools::ExclusiveScan(exclusive.begin(), exclusive.end(), exclusive.begin(), 10);
+      vtkIdType sum = 0;
+      for (int i = 0; i < Target; ++i)
+      {
+        if (exclusive[i] != sum + 10 || inclusive[i] != sum + counts[i])
+        {
+          cerr << "Error: Invalid output for vtkSMPTools scans at " << i << endl;
+          scanSuccess = false;
+          return;
+        }
+        sum += counts[i];
+      }
+      if (vtkSMPTools::Reduce(counts.begin(), counts.end(), vtkIdType(3)) != sum + 3)
+      {
+        cerr << "Error: Invalid output for vtkSMPTools::Reduce" << endl;
+        scanSuccess = false;
+      }
+
+      // the values must be combined in order
+      std::vector<std::string> letters(Target);
+      std::string expectedWord;
+      for (int i = 0; i < Target; ++i)
+      {
+        letters[i] = std::string(1, static_cast<char>('a' + i % 26));
+        expectedWord += letters[i];
+      }
+      if (vtkSMPTools::Reduce(letters.begin(), letters.end(), std::string(">")) !=
+        ">" + expectedWord)
+      {
+        cerr << "Error: vtkSMPTools::Reduce does not keep the order of the values" << endl;
+        scanSuccess = false;
+      }
+
+      const auto minMax = vtkSMPTools::MinMax(counts.begin(), counts.end());
+      const auto expectedMinMax = std::minmax_element(counts.begin(), counts.end());
+      if (minMax != expectedMinMax)
+      {
+        cerr << "Error: Invalid output for vtkSMPTools::MinMax" << endl;
+        scanSuccess = false;
+      }
+      std::vector<vtkIdType> empty;
+      if (vtkSMPTools::MinMax(empty.begin(), empty.end()).first != empty.end() ||
+        vtkSMPTools::Reduce(empty.begin(), empty.end(), vtkIdType(1)) != 1)
+      {
+        cerr << "Error: Invalid output for vtkSMPTools::MinMax or Reduce on empty ranges" << endl;
+        scanSuccess = false;
+      }
+    });
+  if (!scanSuccess)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Test cancellation: every chunk runs, and the functors, including the ones
+  // of the loops nested in the running chunks, see the flag through
+  // IsCancelled() once it is set.
+  std::atomic<vtkTypeBool> cancel(false);
+  std::atomic<int> numProcessed(0);
+  std::atomic<int> numSkipped(0);
+  std::atomic<int> numNestedCancelled(0);
+  bool cancelledInScope = false;
+  vtkSMPTools::CancellableScope(cancel,
+    [&]()
+    {
+      vtkSMPTools::For(0, Target, 1,
+        [&](vtkIdType, vtkIdType)
+        {
+          if (vtkSMPTools::IsCancelled())
+          {
+            ++numSkipped;
+            return;
+          }
+          ++numProcessed;
+          cancel = true;
+          vtkSMPTools::For(0, 10, 1,
+            [&](vtkIdType, vtkIdType)
+            {
+              if (vtkSMPTools::IsCancelled())
+              {
+                ++numNestedCancelled;
+              }
+            });
+        });
+      cancelledInScope = vtkSMPTools::IsCancelled();
+    });
+  if (numProcessed == 0 || numSkipped == 0 || numProcessed + numSkipped != Target ||
+    numNestedCancelled != 10 * numProcessed || !cancelledInScope || vtkSMPTools::IsCancelled())
+  {
+    cerr << "Error: vtkSMPTools::CancellableScope processed " << numProcessed << " chunks, skipped "
+         << numSkipped << " chunks and saw " << numNestedCancelled << " cancelled nested chunks"
+         << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Test the instrumentation: the loops are accounted for per call site,
+  // with their chunks and nesting depth, only while it is enabled.
+  vtkSMPTools::ClearForStatistics();
+  vtkSMPTools::SetInstrumentation(true);
+  ARangeFunctor instrumented;
+  vtkSMPTools::For(0, Target, 100, instrumented);
+  vtkSMPTools::For(0, Target, 100, instrumented);
+  vtkSMPTools::For(0, 4, 1,
+    [](vtkIdType, vtkIdType) { vtkSMPTools::For(0, 10, [](vtkIdType, vtkIdType) {}); });
+  vtkSMPTools::SetInstrumentation(false);
+  vtkSMPTools::For(0, Target, 100, instrumented);
+  const auto statistics = vtkSMPTools::GetForStatistics();
+  bool rangeFound = false;
+  bool nestedFound = false;
+  for (const auto& site : statistics)
+  {
+    const double threadBusyTime =
+      std::accumulate(site.ThreadBusyTimes.begin(), site.ThreadBusyTimes.end(), 0.0);
+    if (site.BusyTime > site.WallTime * site.MaximumNumberOfThreads + 1e-3 ||
+      site.IdleTime < 0.0 || std::abs(threadBusyTime - site.BusyTime) > 1e-6 ||
+      site.Backend != vtkSMPTools::GetBackend())
+    {
+      cerr << "Error: inconsistent statistics for " << site.CallSite << endl;
+      return EXIT_FAILURE;
+    }
+    if (site.CallSite.find("ARangeFunctor") != std::string::npos)
+    {
+      rangeFound = site.NumberOfCalls == 2 && site.NumberOfIterations == 2 * Target &&
+        site.NumberOfChunks >= 2 && site.NumberOfChunks <= 2 * Target / 100 &&
+        site.MaximumNestingDepth == 0;
+    }
+    else if (site.MaximumNestingDepth == 1)
+    {
+      nestedFound = site.NumberOfCalls == 4 && site.NumberOfIterations == 40;
+    }
+  }
+  vtkSMPTools::ClearForStatistics();
+  if (statistics.size() != 3 || !rangeFound || !nestedFound ||
+    !vtkSMPTools::GetForStatistics().empty())
+  {
+    cerr << "Error: wrong statistics for " << statistics.size() << " call sites" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // The STDThread backend honors the global maximum number of threads.
+  if (std::string(vtkSMPTools::GetBackend()) == "STDThread")
+  {
+#if VTK_SMP_ENABLE_STDTHREAD
+    // Its loops take their chunks from a work stealing range, which hands
+    // out every block of the grain once, the idle workers stealing the
+    // blocks of the busy ones.
+    const vtkIdType first = 7;
+    const vtkIdType grain = 3;
+    const int numberOfWorkers = 4;
+    vtk::detail::smp::vtkSMPWorkStealingRange range(first, first + 1000, grain, numberOfWorkers);
+    std::vector<std::atomic<int>> visits(1000);
+    std::vector<int> numberOfChunks(numberOfWorkers, 0);
+    std::atomic<bool> aligned(true);
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < numberOfWorkers; ++worker)
+    {
+      workers.emplace_back(
+        [&, worker]()
+        {
+          vtkIdType from = 0;
+          vtkIdType to = 0;
+          while (range.Next(worker, from, to))
+          {
+            if ((from - first) % grain != 0 || to <= from || to - from > grain)
+            {
+              aligned = false;
+            }
+            for (vtkIdType i = from; i < to; ++i)
+            {
+              ++visits[i - first];
+            }
+            ++numberOfChunks[worker];
+            if (worker == 0)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+          }
+        });
+    }
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+    // the first worker starts with 83 of the 334 blocks
+    if (!aligned || numberOfChunks[0] >= 83 ||
+      std::any_of(visits.begin(), visits.end(), [](const std::atomic<int>& v) { return v != 1; }))
+    {
+      cerr << "Error: vtkSMPWorkStealingRange did not balance or cover the range" << endl;
+      return EXIT_FAILURE;
+    }
+#endif
+
+    vtkMultiThreader::SetGlobalMaximumNumberOfThreads(1);
+    const int limited = vtkSMPTools::GetEstimatedNumberOfThreads();
+    std::set<std::thread::id> threadIds;
+    std::mutex threadIdsMutex;
+    vtkSMPTools::For(0, Target, 1,
+      [&](vtkIdType, vtkIdType)
+      {
+        std::lock_guard<std::mutex> lock(threadIdsMutex);
+        threadIds.insert(std::this_thread::get_id());
+      });
+    vtkMultiThreader::SetGlobalMaximumNumberOfThreads(0);
+    if (limited != 1 || threadIds.size() != 1)
+    {
+      cerr << "Error: the STDThread backend used " << threadIds.size()
+           << " threads with a global maximum of 1" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Large AOS arrays are filled with vtkSMPTools.
+  vtkNew<vtkDoubleArray> filled;
+  filled->SetNumberOfComponents(2);
+  filled->SetNumberOfTuples(100003);
+  filled->Fill(3.0);
+  const auto filledRange = vtk::DataArrayValueRange(filled);
+  if (std::any_of(filledRange.cbegin(), filledRange.cend(), [](double v) { return v != 3.0; }))
+  {
+    cerr << "Error: vtkAOSDataArrayTemplate::Fill did not set all the values" << endl;
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
 
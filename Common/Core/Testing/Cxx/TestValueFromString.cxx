@@ -0,0 +1,116 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestValueFromString.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the numbers parsed by vtkValueFromString and the number of characters
+// it reports.
+
+#include "vtkValueFromString.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace
+{
+template <typename T>
+bool TestValid(const char* str, std::size_t expectedLength, T expectedValue)
+{
+  T value = 0;
+  const std::size_t length = vtkValueFromString(str, str + strlen(str), value);
+  if (length != expectedLength || value != expectedValue)
+  {
+    std::cerr << "Parsing \"" << str << "\" gave " << value << " using " << length
+              << " characters instead of " << expectedValue << " using " << expectedLength
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <typename T>
+bool TestInvalid(const char* str)
+{
+  T value = 42;
+  const std::size_t length = vtkValueFromString(str, str + strlen(str), value);
+  if (length != 0 || value != 42)
+  {
+    std::cerr << "Parsing \"" << str << "\" should fail" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestValueFromString(int, char*[])
+{
+  bool ok = true;
+
+  ok &= TestValid<int>("0", 1, 0);
+  ok &= TestValid<int>("-17 18", 3, -17);
+  ok &= TestValid<int>("+25/3", 3, 25);
+  ok &= TestValid<int>("2147483647", 10, std::numeric_limits<int>::max());
+  ok &= TestValid<int>("-2147483648", 11, std::numeric_limits<int>::min());
+  ok &= TestValid<int>("12.5", 2, 12);
+  ok &= TestValid<signed char>("-128", 4, -128);
+  ok &= TestValid<unsigned char>("255", 3, 255);
+  ok &= TestValid<unsigned short>("65535", 5, 65535);
+  ok &= TestValid<long long>("-9223372036854775808", 20, std::numeric_limits<long long>::min());
+  ok &= TestValid<unsigned long long>(
+    "18446744073709551615", 20, std::numeric_limits<unsigned long long>::max());
+  ok &= TestInvalid<int>("");
+  ok &= TestInvalid<int>(" 1");
+  ok &= TestInvalid<int>("-");
+  ok &= TestInvalid<int>("x1");
+  ok &= TestInvalid<int>("2147483648");
+  ok &= TestInvalid<int>("-2147483649");
+  ok &= TestInvalid<signed char>("128");
+  ok &= TestInvalid<unsigned char>("256");
+  ok &= TestInvalid<unsigned int>("-1");
+
+  ok &= TestValid<double>("0.5", 3, 0.5);
+  ok &= TestValid<double>("-1.25e2 3", 7, -125.0);
+  ok &= TestValid<double>("+3.", 3, 3.0);
+  ok &= TestValid<double>(".25", 3, 0.25);
+  ok &= TestValid<double>("1E-3,", 4, 1e-3);
+  ok &= TestValid<double>("0.1", 3, 0.1);
+  ok &= TestValid<float>("0.1", 3, 0.1f);
+  ok &= TestValid<float>("16777217", 8, 16777216.0f);
+  ok &= TestValid<double>("inf", 3, std::numeric_limits<double>::infinity());
+  ok &= TestValid<double>("-infinity", 9, -std::numeric_limits<double>::infinity());
+  ok &= TestInvalid<double>("");
+  ok &= TestInvalid<double>("e5");
+  ok &= TestInvalid<double>("+-1");
+  ok &= TestInvalid<double>(" 1.0");
+
+  double nan = 0.0;
+  const char* nanStr = "nan";
+  if (vtkValueFromString(nanStr, nanStr + 3, nan) != 3 || !std::isnan(nan))
+  {
+    std::cerr << "Parsing \"nan\" failed" << std::endl;
+    ok = false;
+  }
+
+  // the range does not have to be null terminated
+  const char* values = "1234";
+  int partial = 0;
+  if (vtkValueFromString(values, values + 2, partial) != 2 || partial != 12)
+  {
+    std::cerr << "Parsing stopped past the end of the range" << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
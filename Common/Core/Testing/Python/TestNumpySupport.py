@@ -13,7 +13,9 @@ from vtkmodules.vtkCommonCore import (
     VTK_INT,
     vtkBitArray,
     vtkLongArray,
+    vtkSOADataArrayTemplate,
 )
+from vtkmodules.vtkCommonDataModel import vtkCellArray
 from vtkmodules.test import Testing
 try:
     import numpy
@@ -22,6 +24,13 @@ except ImportError:
     Testing.skip()
 
 from vtkmodules.util.numpy_support import numpy_to_vtk,vtk_to_numpy
+from vtkmodules.util.numpy_support import (
+    dlpack_to_vtk,
+    numpy_to_vtk_cell_array,
+    numpy_to_vtk_components,
+    vtk_to_numpy_cell_array,
+    vtk_to_numpy_components,
+)
 import vtkmodules.numpy_interface.dataset_adapter as dsa
 
 
@@ -154,5 +163,67 @@ class TestNumpySupport(Testing.vtkTest):
         self.assertEqual(m, 4.5)
         self.assertTrue(isinstance(m, numpy.floating))
 
+    def testSOAComponents(self):
+        "Test that the components of SOA arrays are shared both ways."
+        x = numpy.array([1., 2., 3.])
+        y = numpy.array([4., 5., 6.])
+        vtk_arr = numpy_to_vtk_components([x, y])
+        self.assertTrue(isinstance(vtk_arr, vtkSOADataArrayTemplate['float64']))
+        self.assertEqual(vtk_arr.GetTuple2(1), (2., 5.))
+        y[1] = 50.
+        self.assertEqual(vtk_arr.GetTuple2(1), (2., 50.))
+
+        components = vtk_to_numpy_components(vtk_arr)
+        self.assertEqual(len(components), 2)
+        components[0][2] = 30.
+        self.assertEqual(vtk_arr.GetTuple2(2), (30., 6.))
+        # the views keep the VTK array alive
+        del vtk_arr, x, y
+        import gc
+        gc.collect()
+        self.assertEqual(list(components[1]), [4., 50., 6.])
+
+        # the columns of a Fortran ordered array are contiguous
+        a = numpy.asfortranarray(numpy.array([[1, 2], [3, 4]], 'f'))
+        vtk_arr = numpy_to_vtk_components(a)
+        a[1, 1] = 40.
+        self.assertEqual(vtk_arr.GetTuple2(1), (3., 40.))
+
+        # AOS arrays give strided views
+        aos = numpy_to_vtk(numpy.array([[1, 2], [3, 4]], 'd'))
+        components = vtk_to_numpy_components(aos)
+        components[1][0] = 20.
+        self.assertEqual(aos.GetTuple2(0), (1., 20.))
+
+    def testCellArray(self):
+        "Test that the storage of cell arrays is shared both ways."
+        offsets = numpy.array([0, 3, 7], numpy.int64)
+        connectivity = numpy.array([0, 1, 2, 2, 1, 3, 4], numpy.int64)
+        cells = numpy_to_vtk_cell_array(offsets, connectivity)
+        self.assertEqual(cells.GetNumberOfCells(), 2)
+        self.assertEqual(cells.GetCellSize(1), 4)
+        connectivity[6] = 5
+        vtk_offsets, vtk_connectivity = vtk_to_numpy_cell_array(cells)
+        self.assertEqual(list(vtk_offsets), [0, 3, 7])
+        self.assertEqual(vtk_connectivity[6], 5)
+        vtk_connectivity[0] = 8
+        self.assertEqual(connectivity[0], 8)
+
+    def testDLPack(self):
+        "Test that DLPack producers are shared and kept alive."
+        if not hasattr(numpy, 'from_dlpack'):
+            return
+        a = numpy.array([[1, 2, 3], [4, 5, 6]], 'd')
+        vtk_arr = dlpack_to_vtk(a[:, :])
+        a[0, 0] = 10.
+        self.assertEqual(vtk_arr.GetTuple3(0), (10., 2., 3.))
+        b = numpy.from_dlpack(vtk_to_numpy(vtk_arr))
+        b[1, 2] = 60.
+        self.assertEqual(vtk_arr.GetTuple3(1), (4., 5., 60.))
+
+        class DeviceArray:
+            __cuda_array_interface__ = {}
+        self.assertRaises(TypeError, numpy_to_vtk, DeviceArray())
+
 if __name__ == "__main__":
     Testing.main([(TestNumpySupport, 'test')])
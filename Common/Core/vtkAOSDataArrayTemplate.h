@@ -76,6 +76,10 @@ public:
   void SetValue(vtkIdType valueIdx, ValueType value)
     VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues())
   {
+    if (this->Buffer->GetCopyOnWrite())
+    {
+      this->CopyBufferOnWrite();
+    }
     this->Buffer->GetBuffer()[valueIdx] = value;
   }
 
@@ -99,6 +103,10 @@ public:
   void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
     VTK_EXPECTS(0 <= tupleIdx && tupleIdx < GetNumberOfTuples())
   {
+    if (this->Buffer->GetCopyOnWrite())
+    {
+      this->CopyBufferOnWrite();
+    }
     const vtkIdType valueIdx = tupleIdx * this->NumberOfComponents;
     std::copy(tuple, tuple + this->NumberOfComponents, this->Buffer->GetBuffer() + valueIdx);
   }
@@ -135,6 +143,11 @@ public:
   ///@{
   /**
    * Set all the values in array to @a value.
+   *
+   * Large arrays are filled with vtkSMPTools, which also makes this the place
+   * where freshly allocated memory is first touched: calling `Fill(0)` right
+   * after `SetNumberOfTuples()` places the pages on the NUMA nodes of the
+   * threads that later process them with vtkSMPTools::For.
    */
   void FillValue(ValueType value) override;
   void Fill(double value) override;
@@ -157,6 +170,8 @@ public:
    * Use of this method is discouraged, as newer arrays require a deep-copy of
    * the array data in order to return a suitable pointer. See vtkArrayDispatch
    * for a safer alternative for fast data access.
+   * Writing through this pointer does not copy a buffer shared copy-on-write,
+   * use WritePointer() instead.
    */
   ValueType* GetPointer(vtkIdType valueIdx);
   void* GetVoidPointer(vtkIdType valueIdx) override;
@@ -191,6 +206,15 @@ public:
    **/
   void SetArrayFreeFunction(void (*callback)(void*)) override;
 
+  /**
+   * Use @a array, of @a size values, without copy. @a resource keeps @a array
+   * alive, and is released with it, see vtkBuffer::SetBuffer(). This is how
+   * buffers of other libraries are shared, the memory being released by the
+   * resource once no array uses it anymore.
+   */
+  void SetArrayFromResource(
+    VTK_ZEROCOPY ValueType* array, vtkIdType size, vtkMemoryResource* resource);
+
   // Overridden for optimized implementations:
   void SetTuple(vtkIdType tupleIdx, const float* tuple) override;
   void SetTuple(vtkIdType tupleIdx, const double* tuple) override;
@@ -256,6 +280,19 @@ public:
   bool HasStandardMemoryLayout() const override { return true; }
   void ShallowCopy(vtkDataArray* other) override;
 
+  /**
+   * Share the buffer of other copy-on-write. Until one of the arrays modifies
+   * the values, with the setters, WritePointer(), the fill and insertion
+   * methods, or by resizing, the arrays share the memory. The first of them to
+   * modify it makes a private copy of its values. Writing through GetPointer()
+   * or the value and tuple ranges, which use it, does not make a copy.
+   * The first modification must not be concurrent, an array about to be
+   * modified by several threads should call WritePointer() first. An array
+   * that shares the buffer with ShallowCopy() later joins the copy-on-write
+   * arrays.
+   */
+  void ShallowCopyOnWrite(vtkDataArray* other) override;
+
   // Reimplemented for efficiency:
   void InsertTuples(
     vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source) override;
@@ -287,6 +324,12 @@ protected:
    */
   bool ReallocateTuples(vtkIdType numTuples);
 
+  /**
+   * Give this array a private copy, or an empty buffer when keepValues is
+   * false, of its buffer if it is shared copy-on-write.
+   */
+  void CopyBufferOnWrite(bool keepValues = true);
+
   vtkBuffer<ValueType>* Buffer;
 
 private:
@@ -24,6 +24,7 @@
 #include "vtkAOSDataArrayTemplate.h"
 
 #include "vtkArrayIteratorTemplate.h"
+#include "vtkSMPTools.h"
 
 //-----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -72,7 +73,10 @@ template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetArray(
   ValueType* array, vtkIdType size, int save, int deleteMethod)
 {
-
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite(false);
+  }
   this->Buffer->SetBuffer(array, size);
 
   if (deleteMethod == VTK_DATA_ARRAY_DELETE)
@@ -97,6 +101,21 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::SetArray(
   this->DataChanged();
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+void vtkAOSDataArrayTemplate<ValueTypeT>::SetArrayFromResource(
+  ValueType* array, vtkIdType size, vtkMemoryResource* resource)
+{
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite(false);
+  }
+  this->Buffer->SetBuffer(array, size, resource);
+  this->Size = size;
+  this->MaxId = this->Size - 1;
+  this->DataChanged();
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetArray(ValueType* array, vtkIdType size, int save)
@@ -130,6 +149,10 @@ void vtkAOSDataArrayTemplate<ValueType>::SetArrayFreeFunction(void (*callback)(v
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const float* tuple)
 {
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
   // While std::copy is the obvious choice here, it kills performance on MSVC
   // debugging builds as their STL calls are poorly optimized. Just use a for
   // loop instead.
@@ -144,6 +167,10 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const flo
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const double* tuple)
 {
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
   // See note in SetTuple about std::copy vs for loops on MSVC.
   ValueTypeT* data = this->Buffer->GetBuffer() + tupleIdx * this->NumberOfComponents;
   for (int i = 0; i < this->NumberOfComponents; ++i)
@@ -158,6 +185,10 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuple(vtkIdType tupleIdx, const
 {
   if (this->EnsureAccessToTuple(tupleIdx))
   {
+    if (this->Buffer->GetCopyOnWrite())
+    {
+      this->CopyBufferOnWrite();
+    }
     // See note in SetTuple about std::copy vs for loops on MSVC.
     const vtkIdType valueIdx = tupleIdx * this->NumberOfComponents;
     ValueTypeT* data = this->Buffer->GetBuffer() + valueIdx;
@@ -175,6 +206,10 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuple(vtkIdType tupleIdx, const
 {
   if (this->EnsureAccessToTuple(tupleIdx))
   {
+    if (this->Buffer->GetCopyOnWrite())
+    {
+      this->CopyBufferOnWrite();
+    }
     // See note in SetTuple about std::copy vs for loops on MSVC.
     const vtkIdType valueIdx = tupleIdx * this->NumberOfComponents;
     ValueTypeT* data = this->Buffer->GetBuffer() + valueIdx;
@@ -200,6 +235,10 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertComponent(
     }
   }
 
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
   this->Buffer->GetBuffer()[newMaxId] = static_cast<ValueTypeT>(value);
   this->MaxId = std::max(newMaxId, this->MaxId);
 }
@@ -218,6 +257,10 @@ vtkIdType vtkAOSDataArrayTemplate<ValueTypeT>::InsertNextTuple(const float* tupl
     }
   }
 
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
   // See note in SetTuple about std::copy vs for loops on MSVC.
   ValueTypeT* data = this->Buffer->GetBuffer() + this->MaxId + 1;
   for (int i = 0; i < this->NumberOfComponents; ++i)
@@ -242,6 +285,10 @@ vtkIdType vtkAOSDataArrayTemplate<ValueTypeT>::InsertNextTuple(const double* tup
     }
   }
 
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
   // See note in SetTuple about std::copy vs for loops on MSVC.
   ValueTypeT* data = this->Buffer->GetBuffer() + this->MaxId + 1;
   for (int i = 0; i < this->NumberOfComponents; ++i)
@@ -313,6 +360,48 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::ShallowCopy(vtkDataArray* other)
   }
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+void vtkAOSDataArrayTemplate<ValueTypeT>::ShallowCopyOnWrite(vtkDataArray* other)
+{
+  SelfType* o = SelfType::FastDownCast(other);
+  if (o)
+  {
+    o->Buffer->SetCopyOnWrite(true);
+    this->ShallowCopy(o);
+  }
+  else
+  {
+    this->Superclass::ShallowCopyOnWrite(other);
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+void vtkAOSDataArrayTemplate<ValueTypeT>::CopyBufferOnWrite(bool keepValues)
+{
+  if (this->Buffer->GetReferenceCount() == 1)
+  {
+    // the other arrays released the buffer
+    this->Buffer->SetCopyOnWrite(false);
+    return;
+  }
+  vtkBuffer<ValueType>* buffer = vtkBuffer<ValueType>::New();
+  if (keepValues)
+  {
+    if (!buffer->Allocate(this->Size))
+    {
+      vtkErrorMacro("Unable to copy the shared buffer of " << this->Size << " values.");
+      buffer->Delete();
+      return;
+    }
+    std::copy(this->Buffer->GetBuffer(), this->Buffer->GetBuffer() + this->MaxId + 1,
+      buffer->GetBuffer());
+  }
+  this->Buffer->Delete();
+  this->Buffer = buffer;
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuples(
@@ -362,6 +451,10 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::InsertTuples(
       return;
     }
   }
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
 
   this->MaxId = std::max(this->MaxId, newSize - 1);
 
@@ -390,8 +483,23 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::FillTypedComponent(int compIdx, ValueT
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::FillValue(ValueType value)
 {
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
   std::ptrdiff_t offset = this->MaxId + 1;
-  std::fill(this->Buffer->GetBuffer(), this->Buffer->GetBuffer() + offset, value);
+  // Below this size, starting the threads costs more than the fill.
+  constexpr std::ptrdiff_t parallelFillThreshold = 1 << 16;
+  if (offset >= parallelFillThreshold)
+  {
+    // Touch the pages from the threads that will process them, so that they
+    // are placed on their NUMA nodes.
+    vtkSMPTools::Fill(this->Buffer->GetBuffer(), this->Buffer->GetBuffer() + offset, value);
+  }
+  else
+  {
+    std::fill(this->Buffer->GetBuffer(), this->Buffer->GetBuffer() + offset, value);
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -419,6 +527,11 @@ vtkAOSDataArrayTemplate<ValueTypeT>::WritePointer(vtkIdType valueIdx, vtkIdType
   // For extending the in-use ids but not the size:
   this->MaxId = std::max(this->MaxId, newSize - 1);
 
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite();
+  }
+
   this->DataChanged();
   return this->GetPointer(valueIdx);
 }
@@ -450,6 +563,10 @@ template <class ValueTypeT>
 bool vtkAOSDataArrayTemplate<ValueTypeT>::AllocateTuples(vtkIdType numTuples)
 {
   vtkIdType numValues = numTuples * this->GetNumberOfComponents();
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite(false);
+  }
   if (this->Buffer->Allocate(numValues))
   {
     this->Size = this->Buffer->GetSize();
@@ -462,6 +579,10 @@ bool vtkAOSDataArrayTemplate<ValueTypeT>::AllocateTuples(vtkIdType numTuples)
 template <class ValueTypeT>
 bool vtkAOSDataArrayTemplate<ValueTypeT>::ReallocateTuples(vtkIdType numTuples)
 {
+  if (this->Buffer->GetCopyOnWrite())
+  {
+    this->CopyBufferOnWrite(numTuples > 0);
+  }
   if (this->Buffer->Reallocate(numTuples * this->GetNumberOfComponents()))
   {
     this->Size = this->Buffer->GetSize();
@@ -54,6 +54,7 @@
 #include "vtkVariantArray.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iterator>
 #include <set>
@@ -70,6 +71,8 @@ VTK_ABI_NAMESPACE_END
 namespace
 {
 typedef std::vector<std::string*> vtkInternalComponentNameBase;
+
+std::atomic<vtkMTimeType> LatestNameTime(0);
 }
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -85,6 +88,7 @@ vtkAbstractArray::vtkAbstractArray()
   this->MaxId = -1;
   this->NumberOfComponents = 1;
   this->Name = nullptr;
+  this->NameTime = 0;
   this->RebuildArray = false;
   this->Information = nullptr;
   this->ComponentNames = nullptr;
@@ -106,10 +110,25 @@ vtkAbstractArray::~vtkAbstractArray()
     this->ComponentNames = nullptr;
   }
 
-  this->SetName(nullptr);
+  delete[] this->Name;
+  this->Name = nullptr;
   this->SetInformation(nullptr);
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractArray::SetName(const char* name)
+{
+  // returns early when the name does not change
+  vtkSetStringBodyMacro(Name, name);
+  this->NameTime = ++LatestNameTime;
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkAbstractArray::GetLatestNameTime()
+{
+  return LatestNameTime.load();
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractArray::SetComponentName(vtkIdType component, const char* name)
 {
@@ -398,10 +398,23 @@ public:
   /**
    * Set/get array's name
    */
-  vtkSetStringMacro(Name);
+  virtual void SetName(const char* name);
   vtkGetStringMacro(Name);
   ///@}
 
+  /**
+   * Return the value of a global counter, incremented whenever the name of
+   * an array changes, when the name of this array last changed. Used by
+   * vtkFieldData to detect that arrays it indexes by name were renamed.
+   */
+  vtkMTimeType GetNameTime() const { return this->NameTime; }
+
+  /**
+   * Return the current value of the counter incremented whenever the name of
+   * an array changes.
+   */
+  static vtkMTimeType GetLatestNameTime();
+
   /**
    * Get the name of a data type as a string.
    */
@@ -709,6 +722,7 @@ protected:
   unsigned int MaxDiscreteValues;
 
   char* Name;
+  vtkMTimeType NameTime;
 
   bool RebuildArray; // whether to rebuild the fast lookup data structure.
 
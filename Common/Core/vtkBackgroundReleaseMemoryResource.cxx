@@ -0,0 +1,129 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBackgroundReleaseMemoryResource.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkBackgroundReleaseMemoryResource.h"
+
+#include "vtkObjectFactory.h"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBackgroundReleaseMemoryResource);
+
+struct vtkBackgroundReleaseMemoryResource::vtkInternals
+{
+  std::mutex Mutex;
+  // notifies the thread of new blocks or of the destruction of the resource
+  std::condition_variable Wake;
+  // notifies the threads waiting for the blocks to be freed
+  std::condition_variable Released;
+  std::vector<std::pair<void*, size_t>> Pending;
+  size_t PendingBytes = 0;
+  bool Stop = false;
+  std::thread Thread;
+
+  void Run()
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    while (true)
+    {
+      this->Wake.wait(lock, [this] { return this->Stop || !this->Pending.empty(); });
+      if (this->Pending.empty())
+      {
+        return;
+      }
+      std::vector<std::pair<void*, size_t>> blocks;
+      blocks.swap(this->Pending);
+      lock.unlock();
+      size_t freedBytes = 0;
+      for (const auto& block : blocks)
+      {
+        free(block.first);
+        freedBytes += block.second;
+      }
+      lock.lock();
+      this->PendingBytes -= freedBytes;
+      this->Released.notify_all();
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkBackgroundReleaseMemoryResource::vtkBackgroundReleaseMemoryResource()
+  : MinimumBlockSize(size_t(1) << 20)
+  , Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkBackgroundReleaseMemoryResource::~vtkBackgroundReleaseMemoryResource()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    this->Internals->Stop = true;
+  }
+  this->Internals->Wake.notify_one();
+  if (this->Internals->Thread.joinable())
+  {
+    this->Internals->Thread.join();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBackgroundReleaseMemoryResource::DeallocateMemory(void* ptr, size_t size)
+{
+  if (size < this->MinimumBlockSize)
+  {
+    free(ptr);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    if (!this->Internals->Thread.joinable())
+    {
+      this->Internals->Thread = std::thread(&vtkInternals::Run, this->Internals.get());
+    }
+    this->Internals->Pending.emplace_back(ptr, size);
+    this->Internals->PendingBytes += size;
+  }
+  this->Internals->Wake.notify_one();
+}
+
+//------------------------------------------------------------------------------
+size_t vtkBackgroundReleaseMemoryResource::GetPendingBytes()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return this->Internals->PendingBytes;
+}
+
+//------------------------------------------------------------------------------
+void vtkBackgroundReleaseMemoryResource::WaitForRelease()
+{
+  std::unique_lock<std::mutex> lock(this->Internals->Mutex);
+  this->Internals->Released.wait(lock, [this] { return this->Internals->PendingBytes == 0; });
+}
+
+//------------------------------------------------------------------------------
+void vtkBackgroundReleaseMemoryResource::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MinimumBlockSize: " << this->MinimumBlockSize << endl;
+  os << indent << "PendingBytes: " << this->GetPendingBytes() << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,83 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBackgroundReleaseMemoryResource.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkBackgroundReleaseMemoryResource
+ * @brief   memory resource releasing large blocks on a background thread
+ *
+ * vtkBackgroundReleaseMemoryResource frees the blocks of at least
+ * MinimumBlockSize bytes on a thread of its own instead of the thread
+ * releasing them, smaller blocks being freed right away. Returning the pages
+ * of large arrays to the system takes time, so deleting large datasets, for
+ * instance the output of a reader when switching time steps, is then not
+ * delayed by it. The thread is started when the first block is deferred, and
+ * frees the pending blocks before the resource is destroyed.
+ *
+ * @sa
+ * vtkMemoryResource vtkPoolMemoryResource
+ */
+
+#ifndef vtkBackgroundReleaseMemoryResource_h
+#define vtkBackgroundReleaseMemoryResource_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkMemoryResource.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkBackgroundReleaseMemoryResource : public vtkMemoryResource
+{
+public:
+  static vtkBackgroundReleaseMemoryResource* New();
+  vtkTypeMacro(vtkBackgroundReleaseMemoryResource, vtkMemoryResource);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Blocks of at least this number of bytes are freed on the background
+   * thread. Initial value is 1 MiB.
+   */
+  vtkSetMacro(MinimumBlockSize, size_t);
+  vtkGetMacro(MinimumBlockSize, size_t);
+  ///@}
+
+  /**
+   * Number of bytes of the blocks released but not freed yet.
+   */
+  size_t GetPendingBytes();
+
+  /**
+   * Wait until the background thread has freed all the released blocks.
+   */
+  void WaitForRelease();
+
+protected:
+  vtkBackgroundReleaseMemoryResource();
+  ~vtkBackgroundReleaseMemoryResource() override;
+
+  void DeallocateMemory(void* ptr, size_t size) override;
+
+  size_t MinimumBlockSize;
+
+private:
+  vtkBackgroundReleaseMemoryResource(const vtkBackgroundReleaseMemoryResource&) = delete;
+  void operator=(const vtkBackgroundReleaseMemoryResource&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
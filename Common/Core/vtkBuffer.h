@@ -20,11 +20,17 @@
  * vtkBuffer makes it easier to keep data pointers in vtkDataArray subclasses.
  * This is an internal class and not intended for direct use expect when writing
  * new types of vtkDataArray subclasses.
+ *
+ * The memory is allocated by the current vtkMemoryResource of the thread, if
+ * any, instead of the malloc and realloc functions, unless another malloc
+ * function was set. The memory allocated by a resource is released by the
+ * same resource, and a buffer set with SetBuffer() by the free function.
  */
 
 #ifndef vtkBuffer_h
 #define vtkBuffer_h
 
+#include "vtkMemoryResource.h" // For the memory resource
 #include "vtkObject.h"
 #include "vtkObjectFactory.h" // New() implementation
 
@@ -54,6 +60,16 @@ public:
    */
   void SetBuffer(ScalarType* array, vtkIdType size);
 
+  /**
+   * Set the memory buffer that this vtkBuffer object will manage, for a
+   * buffer that @a resource keeps alive. The buffer keeps a reference to
+   * @a resource and releases @a array with vtkMemoryResource::Deallocate(),
+   * with a size of 0 bytes, instead of its free function. This lets memory
+   * owned by another library be shared without copy, the resource releasing
+   * it when the last buffer using it is released.
+   */
+  void SetBuffer(ScalarType* array, vtkIdType size, vtkMemoryResource* resource);
+
   /**
    * Set the malloc function to be used when allocating space inside this object.
    **/
@@ -72,6 +88,23 @@ public:
    **/
   void SetFreeFunction(bool noFreeFunction, vtkFreeingFunction deleteFunction = free);
 
+  /**
+   * Set the memory resource used to allocate space inside this object instead
+   * of the current memory resource. Initial value is a null pointer.
+   */
+  void SetMemoryResource(vtkMemoryResource* resource);
+  vtkMemoryResource* GetMemoryResource() const { return this->MemoryResource; }
+
+  ///@{
+  /**
+   * Set by vtkAOSDataArrayTemplate::ShallowCopyOnWrite() when the buffer is
+   * shared copy-on-write, so that the arrays sharing it copy it before they
+   * modify it. Initial value is false.
+   */
+  void SetCopyOnWrite(bool copyOnWrite) { this->CopyOnWrite = copyOnWrite; }
+  bool GetCopyOnWrite() const { return this->CopyOnWrite; }
+  ///@}
+
   /**
    * Return the number of elements the current buffer can hold.
    */
@@ -92,19 +125,37 @@ protected:
   vtkBuffer()
     : Pointer(nullptr)
     , Size(0)
+    , MemoryResource(nullptr)
+    , ResourceOfPointer(nullptr)
+    , ResourceSize(0)
+    , CopyOnWrite(false)
   {
     this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
     this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
     this->SetFreeFunction(false, vtkObjectBase::GetCurrentFreeFunction());
   }
 
-  ~vtkBuffer() override { this->SetBuffer(nullptr, 0); }
+  ~vtkBuffer() override
+  {
+    this->SetBuffer(nullptr, 0);
+    this->SetMemoryResource(nullptr);
+  }
+
+  // The resource to allocate with, if any.
+  vtkMemoryResource* GetAllocatingResource();
+  bool AllocateFromResource(vtkMemoryResource* resource, vtkIdType size);
 
   ScalarType* Pointer;
   vtkIdType Size;
   vtkMallocingFunction MallocFunction;
   vtkReallocingFunction ReallocFunction;
   vtkFreeingFunction DeleteFunction;
+  vtkMemoryResource* MemoryResource;
+  // The resource that allocated Pointer and the number of bytes allocated,
+  // when Pointer was allocated by a resource.
+  vtkMemoryResource* ResourceOfPointer;
+  size_t ResourceSize;
+  bool CopyOnWrite;
 
 private:
   vtkBuffer(const vtkBuffer&) = delete;
@@ -130,7 +181,14 @@ void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* arra
 {
   if (this->Pointer != array)
   {
-    if (this->DeleteFunction)
+    if (this->ResourceOfPointer)
+    {
+      this->ResourceOfPointer->Deallocate(this->Pointer, this->ResourceSize);
+      this->ResourceOfPointer->UnRegister(this);
+      this->ResourceOfPointer = nullptr;
+      this->ResourceSize = 0;
+    }
+    else if (this->DeleteFunction)
     {
       this->DeleteFunction(this->Pointer);
     }
@@ -140,6 +198,22 @@ void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* arra
 }
 //------------------------------------------------------------------------------
 template <typename ScalarT>
+void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* array, vtkIdType size,
+  vtkMemoryResource* resource)
+{
+  if (resource)
+  {
+    // before releasing the current buffer, in case it is held by resource too
+    resource->Register(this);
+  }
+  this->SetBuffer(nullptr, 0);
+  this->Pointer = array;
+  this->Size = size;
+  this->ResourceOfPointer = resource;
+  this->ResourceSize = 0;
+}
+//------------------------------------------------------------------------------
+template <typename ScalarT>
 void vtkBuffer<ScalarT>::SetMallocFunction(vtkMallocingFunction mallocFunction)
 {
   this->MallocFunction = mallocFunction;
@@ -165,12 +239,69 @@ void vtkBuffer<ScalarT>::SetFreeFunction(bool noFreeFunction, vtkFreeingFunction
   }
 }
 
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+void vtkBuffer<ScalarT>::SetMemoryResource(vtkMemoryResource* resource)
+{
+  if (this->MemoryResource != resource)
+  {
+    if (resource)
+    {
+      resource->Register(this);
+    }
+    if (this->MemoryResource)
+    {
+      this->MemoryResource->UnRegister(this);
+    }
+    this->MemoryResource = resource;
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+vtkMemoryResource* vtkBuffer<ScalarT>::GetAllocatingResource()
+{
+  if (this->MemoryResource)
+  {
+    return this->MemoryResource;
+  }
+  // a malloc function set explicitly, or the one of memkind, comes first
+  return this->MallocFunction == malloc ? vtkMemoryResource::GetCurrent() : nullptr;
+}
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+bool vtkBuffer<ScalarT>::AllocateFromResource(vtkMemoryResource* resource, vtkIdType size)
+{
+  const size_t bytes = size * sizeof(ScalarType);
+  ScalarType* newArray = static_cast<ScalarType*>(resource->Allocate(bytes));
+  if (!newArray)
+  {
+    return false;
+  }
+  // copy and release the current buffer, if any
+  if (this->Pointer)
+  {
+    std::copy(this->Pointer, this->Pointer + (std::min)(this->Size, size), newArray);
+  }
+  this->SetBuffer(newArray, size);
+  this->ResourceOfPointer = resource;
+  this->ResourceOfPointer->Register(this);
+  this->ResourceSize = bytes;
+  return true;
+}
+
 //------------------------------------------------------------------------------
 template <typename ScalarT>
 bool vtkBuffer<ScalarT>::Allocate(vtkIdType size)
 {
   // release old memory.
   this->SetBuffer(nullptr, 0);
+  vtkMemoryResource* resource = size > 0 ? this->GetAllocatingResource() : nullptr;
+  if (resource)
+  {
+    return this->AllocateFromResource(resource, size);
+  }
   if (size > 0)
   {
     ScalarType* newArray;
@@ -205,7 +336,27 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     return this->Allocate(0);
   }
 
-  if (this->Pointer && this->DeleteFunction != free)
+  vtkMemoryResource* resource = this->GetAllocatingResource();
+  if (resource && resource == this->ResourceOfPointer)
+  {
+    const size_t bytes = newsize * sizeof(ScalarType);
+    ScalarType* newArray =
+      static_cast<ScalarType*>(resource->Reallocate(this->Pointer, this->ResourceSize, bytes));
+    if (!newArray)
+    {
+      return false;
+    }
+    this->Pointer = newArray;
+    this->Size = newsize;
+    this->ResourceSize = bytes;
+    return true;
+  }
+  if (resource)
+  {
+    return this->AllocateFromResource(resource, newsize);
+  }
+
+  if (this->Pointer && (this->DeleteFunction != free || this->ResourceOfPointer))
   {
     ScalarType* newArray;
     bool forceFreeFunction = false;
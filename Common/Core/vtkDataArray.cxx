@@ -161,6 +161,35 @@ struct DeepCopyWorker
   void operator()(vtkDataArray* src, vtkDataArray* dst) const { this->DoGenericCopy(src, dst); }
 };
 
+// Copy a source array that is not dispatched, such as an implicit array, into
+// a dispatched destination by blocks of tuples, to avoid a virtual call for
+// each value of the source.
+struct DeepCopyBlockWorker
+{
+  template <typename DstArrayT>
+  void operator()(DstArrayT* dst, vtkDataArray* src) const
+  {
+    using DstT = vtk::GetAPIType<DstArrayT>;
+    const auto srcTuples = vtk::DataArrayTupleRange(src);
+    auto dstRange = vtk::DataArrayValueRange(dst);
+    const vtkIdType numTuples = srcTuples.size();
+    const int numComps = srcTuples.GetTupleSize();
+    const vtkIdType blockSize = std::max(1024 / numComps, 1);
+    std::vector<double> buffer(blockSize * numComps);
+    auto destIter = dstRange.begin();
+    for (vtkIdType begin = 0; begin < numTuples; begin += blockSize)
+    {
+      const vtkIdType end = std::min(begin + blockSize, numTuples);
+      srcTuples.GetTuples(begin, end, buffer.data());
+      // use for loop instead of copy to avoid -Wconversion warnings
+      for (vtkIdType v = 0, numValues = (end - begin) * numComps; v < numValues; ++v, ++destIter)
+      {
+        *destIter = static_cast<DstT>(buffer[v]);
+      }
+    }
+  }
+};
+
 //------------InterpolateTuple workers------------------------------------------
 struct InterpolateMultiTupleWorker
 {
@@ -507,7 +536,9 @@ void vtkDataArray::DeepCopy(vtkDataArray* da)
     if (numTuples != 0)
     {
       DeepCopyWorker worker;
-      if (!vtkArrayDispatch::Dispatch2::Execute(da, this, worker))
+      DeepCopyBlockWorker blockWorker;
+      if (!vtkArrayDispatch::Dispatch2::Execute(da, this, worker) &&
+        !vtkArrayDispatch::Dispatch::Execute(this, blockWorker, da))
       {
         // If dispatch fails, use fallback:
         worker(da, this);
@@ -532,6 +563,13 @@ void vtkDataArray::ShallowCopy(vtkDataArray* other)
   this->DeepCopy(other);
 }
 
+//------------------------------------------------------------------------------
+void vtkDataArray::ShallowCopyOnWrite(vtkDataArray* other)
+{
+  // Deep copy by default. Subclasses may override this behavior.
+  this->DeepCopy(other);
+}
+
 //------------------------------------------------------------------------------
 void vtkDataArray::SetTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source)
 {
@@ -1457,6 +1495,16 @@ void vtkDataArray::GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* aa)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkDataArray::GetTupleBlock(vtkIdType tupleBegin, vtkIdType tupleEnd, double* tuples)
+{
+  const int numComps = this->NumberOfComponents;
+  for (vtkIdType t = tupleBegin; t < tupleEnd; ++t, tuples += numComps)
+  {
+    this->GetTuple(t, tuples);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkDataArray::FillComponent(int compIdx, double value)
 {
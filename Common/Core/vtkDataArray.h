@@ -115,6 +115,18 @@ public:
   virtual void GetTuple(vtkIdType tupleIdx, double* tuple)
     VTK_EXPECTS(0 <= tupleIdx && tupleIdx < GetNumberOfTuples()) = 0;
 
+  /**
+   * Get the tuples in [tupleBegin, tupleEnd) by filling in a user-provided
+   * array with their components, interleaved. Make sure that your array is
+   * large enough to hold (tupleEnd - tupleBegin) * NumberOfComponents values.
+   * This method makes a single virtual call for the whole block, so reading
+   * an array block by block is much faster than calling GetComponent() for
+   * each value when the array type is not handled by vtkArrayDispatch, as
+   * implicit arrays when VTK_DISPATCH_IMPLICIT_ARRAYS is off.
+   */
+  virtual void GetTupleBlock(vtkIdType tupleBegin, vtkIdType tupleEnd, double* tuples)
+    VTK_EXPECTS(0 <= tupleBegin && tupleBegin <= tupleEnd && tupleEnd <= GetNumberOfTuples());
+
   ///@{
   /**
    * These methods are included as convenience for the wrappers.
@@ -288,6 +300,15 @@ public:
    */
   virtual void ShallowCopy(vtkDataArray* other);
 
+  /**
+   * Create a copy-on-write shallow copy of other into this, if possible. The
+   * arrays share their memory like after ShallowCopy() until one of them
+   * modifies it, which first gives that array a private copy. Only
+   * vtkAOSDataArrayTemplate supports it, other arrays perform a deep copy
+   * instead.
+   */
+  virtual void ShallowCopyOnWrite(vtkDataArray* other);
+
   /**
    * Fill a component of a data array with a specified value. This method
    * sets the specified component to specified value for all tuples in the
@@ -960,6 +960,17 @@ public:
     return const_reference{ this->BeginTuple + i * this->NumComps.value, this->NumComps };
   }
 
+  // Copy the tuples [first, last) of the range into tuples, interleaved. The
+  // caller must ensure that there are (last - first) * GetTupleSize() elements
+  // in tuples.
+  VTK_ITER_INLINE
+  void GetTuples(size_type first, size_type last, APIType* tuples) const noexcept
+  {
+    assert(first >= 0 && first <= last && last <= this->size());
+    std::copy(this->BeginTuple + first * this->NumComps.value,
+      this->BeginTuple + last * this->NumComps.value, tuples);
+  }
+
 private:
   VTK_ITER_INLINE
   ValueType* GetTuplePointer(ArrayType* array, vtkIdType tuple) const noexcept
@@ -57,6 +57,30 @@ struct TupleIterator;
 template <typename ArrayType, ComponentIdType>
 struct TupleRange;
 
+//------------------------------------------------------------------------------
+// Copy the tuples [beginTuple, endTuple) of an array into an interleaved buffer.
+// Arrays only known as vtkDataArray use a single virtual call for the block.
+template <typename ArrayType, typename APIType>
+VTK_ITER_INLINE void CopyTupleBlock(ArrayType* array, ComponentIdType numComps,
+  TupleIdType beginTuple, TupleIdType endTuple, APIType* tuples) noexcept
+{
+  vtkDataArrayAccessor<ArrayType> acc{ array };
+  for (TupleIdType t = beginTuple; t < endTuple; ++t)
+  {
+    for (ComponentIdType c = 0; c < numComps; ++c)
+    {
+      *tuples++ = acc.Get(t, c);
+    }
+  }
+}
+
+VTK_ITER_INLINE
+void CopyTupleBlock(vtkDataArray* array, ComponentIdType, TupleIdType beginTuple,
+  TupleIdType endTuple, double* tuples) noexcept
+{
+  array->GetTupleBlock(beginTuple, endTuple, tuples);
+}
+
 //------------------------------------------------------------------------------
 // Const component reference
 template <typename ArrayType, ComponentIdType TupleSize>
@@ -1723,6 +1747,19 @@ public:
     return const_reference{ this->Array, this->NumComps, this->BeginTuple + i };
   }
 
+  // Copy the tuples [first, last) of the range into tuples, interleaved. The
+  // caller must ensure that there are (last - first) * GetTupleSize() elements
+  // in tuples. This is much faster than iterating over the components of the
+  // tuples when the range was made on a vtkDataArray, as it only costs one
+  // virtual call (see vtkDataArray::GetTupleBlock).
+  VTK_ITER_INLINE
+  void GetTuples(size_type first, size_type last, APIType* tuples) const noexcept
+  {
+    assert(first >= 0 && first <= last && last <= this->size());
+    CopyTupleBlock(this->Array, this->NumComps.value, this->BeginTuple + first,
+      this->BeginTuple + last, tuples);
+  }
+
 private:
   VTK_ITER_INLINE
   iterator NewIter(TupleIdType t) const { return iterator{ this->Array, this->NumComps, t }; }
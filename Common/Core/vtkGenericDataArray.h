@@ -319,6 +319,7 @@ public:
   void GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* output) override;
   double* GetTuple(vtkIdType tupleIdx) override;
   void GetTuple(vtkIdType tupleIdx, double* tuple) override;
+  void GetTupleBlock(vtkIdType tupleBegin, vtkIdType tupleEnd, double* tuples) override;
   void InterpolateTuple(vtkIdType dstTupleIdx, vtkIdList* ptIndices, vtkAbstractArray* source,
     double* weights) override;
   void InterpolateTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx1, vtkAbstractArray* source1,
@@ -41,6 +41,23 @@ void vtkGenericDataArray<DerivedT, ValueTypeT>::GetTuple(vtkIdType tupleIdx, dou
   }
 }
 
+//-----------------------------------------------------------------------------
+template <class DerivedT, class ValueTypeT>
+void vtkGenericDataArray<DerivedT, ValueTypeT>::GetTupleBlock(
+  vtkIdType tupleBegin, vtkIdType tupleEnd, double* tuples)
+{
+  // GetTypedComponent is resolved at compile time for the derived class, so
+  // that the whole block only costs the virtual call to this method.
+  const int numComps = this->NumberOfComponents;
+  for (vtkIdType t = tupleBegin; t < tupleEnd; ++t)
+  {
+    for (int c = 0; c < numComps; ++c)
+    {
+      *tuples++ = static_cast<double>(this->GetTypedComponent(t, c));
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 template <class DerivedT, class ValueTypeT>
 void vtkGenericDataArray<DerivedT, ValueTypeT>::InterpolateTuple(
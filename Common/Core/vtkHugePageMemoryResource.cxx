@@ -0,0 +1,130 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHugePageMemoryResource.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkHugePageMemoryResource.h"
+
+#include "vtkObjectFactory.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#define VTK_HUGE_PAGE_MMAP
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkHugePageMemoryResource);
+
+namespace
+{
+const size_t HugePageSize = size_t(2) << 20;
+
+#ifdef VTK_HUGE_PAGE_MMAP
+bool IsMapped(size_t size)
+{
+  return size >= HugePageSize;
+}
+
+size_t GetMappedSize(size_t size)
+{
+  return (size + HugePageSize - 1) / HugePageSize * HugePageSize;
+}
+
+void* Map(size_t size)
+{
+  void* ptr = mmap(nullptr, GetMappedSize(size), PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED)
+  {
+    return nullptr;
+  }
+#ifdef MADV_HUGEPAGE
+  madvise(ptr, GetMappedSize(size), MADV_HUGEPAGE);
+#endif
+  return ptr;
+}
+#endif
+}
+
+//------------------------------------------------------------------------------
+vtkHugePageMemoryResource::vtkHugePageMemoryResource() = default;
+
+//------------------------------------------------------------------------------
+vtkHugePageMemoryResource::~vtkHugePageMemoryResource() = default;
+
+//------------------------------------------------------------------------------
+size_t vtkHugePageMemoryResource::GetHugePageSize()
+{
+  return HugePageSize;
+}
+
+//------------------------------------------------------------------------------
+void* vtkHugePageMemoryResource::AllocateMemory(size_t size)
+{
+#ifdef VTK_HUGE_PAGE_MMAP
+  if (IsMapped(size))
+  {
+    return Map(size);
+  }
+#endif
+  return this->Superclass::AllocateMemory(size);
+}
+
+//------------------------------------------------------------------------------
+void* vtkHugePageMemoryResource::ReallocateMemory(void* ptr, size_t oldSize, size_t newSize)
+{
+#ifdef VTK_HUGE_PAGE_MMAP
+  if (IsMapped(oldSize) && IsMapped(newSize))
+  {
+#ifdef MREMAP_MAYMOVE
+    void* newPtr =
+      mremap(ptr, GetMappedSize(oldSize), GetMappedSize(newSize), MREMAP_MAYMOVE);
+    return newPtr == MAP_FAILED ? nullptr : newPtr;
+#endif
+  }
+  if (IsMapped(oldSize) || IsMapped(newSize))
+  {
+    void* newPtr = this->AllocateMemory(newSize);
+    if (newPtr)
+    {
+      memcpy(newPtr, ptr, std::min(oldSize, newSize));
+      this->DeallocateMemory(ptr, oldSize);
+    }
+    return newPtr;
+  }
+#endif
+  return this->Superclass::ReallocateMemory(ptr, oldSize, newSize);
+}
+
+//------------------------------------------------------------------------------
+void vtkHugePageMemoryResource::DeallocateMemory(void* ptr, size_t size)
+{
+#ifdef VTK_HUGE_PAGE_MMAP
+  if (IsMapped(size))
+  {
+    munmap(ptr, GetMappedSize(size));
+    return;
+  }
+#endif
+  this->Superclass::DeallocateMemory(ptr, size);
+}
+
+//------------------------------------------------------------------------------
+void vtkHugePageMemoryResource::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "HugePageSize: " << HugePageSize << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,63 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHugePageMemoryResource.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHugePageMemoryResource
+ * @brief   memory resource backing large blocks with huge pages
+ *
+ * On Linux, vtkHugePageMemoryResource maps the blocks of at least one huge
+ * page, 2 MiB, directly with mmap, rounded up to a whole number of huge pages,
+ * and advises the kernel to back them with transparent huge pages. This
+ * divides the number of page faults and TLB misses of large arrays. Resizing
+ * such a block remaps it without copying. Smaller blocks, and all the blocks
+ * on other platforms, use malloc.
+ *
+ * @sa
+ * vtkMemoryResource vtkPoolMemoryResource
+ */
+
+#ifndef vtkHugePageMemoryResource_h
+#define vtkHugePageMemoryResource_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkMemoryResource.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkHugePageMemoryResource : public vtkMemoryResource
+{
+public:
+  static vtkHugePageMemoryResource* New();
+  vtkTypeMacro(vtkHugePageMemoryResource, vtkMemoryResource);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Size of the huge pages, the smallest block mapped with huge pages.
+   */
+  static size_t GetHugePageSize();
+
+protected:
+  vtkHugePageMemoryResource();
+  ~vtkHugePageMemoryResource() override;
+
+  void* AllocateMemory(size_t size) override;
+  void* ReallocateMemory(void* ptr, size_t oldSize, size_t newSize) override;
+  void DeallocateMemory(void* ptr, size_t size) override;
+
+private:
+  vtkHugePageMemoryResource(const vtkHugePageMemoryResource&) = delete;
+  void operator=(const vtkHugePageMemoryResource&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
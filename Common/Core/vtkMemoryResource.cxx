@@ -0,0 +1,179 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkMemoryResource.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkMemoryResource.h"
+
+#include "vtkObjectFactory.h"
+
+#include <cstdlib>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkMemoryResource);
+
+namespace
+{
+vtkMemoryResource* DefaultResource = nullptr;
+VTK_THREAD_LOCAL vtkMemoryResource* CurrentResource = nullptr;
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResource::vtkMemoryResource()
+  : BytesAllocated(0)
+  , NumberOfAllocations(0)
+  , BytesInUse(0)
+  , PeakBytesInUse(0)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResource::~vtkMemoryResource() = default;
+
+//------------------------------------------------------------------------------
+void* vtkMemoryResource::Allocate(size_t size)
+{
+  void* ptr = this->AllocateMemory(size);
+  if (ptr)
+  {
+    this->BytesAllocated += size;
+    ++this->NumberOfAllocations;
+    this->AddInUse(size, 0);
+  }
+  return ptr;
+}
+
+//------------------------------------------------------------------------------
+void* vtkMemoryResource::Reallocate(void* ptr, size_t oldSize, size_t newSize)
+{
+  if (!ptr)
+  {
+    return this->Allocate(newSize);
+  }
+  void* newPtr = this->ReallocateMemory(ptr, oldSize, newSize);
+  if (newPtr)
+  {
+    this->BytesAllocated += newSize;
+    ++this->NumberOfAllocations;
+    this->AddInUse(newSize, oldSize);
+  }
+  return newPtr;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::Deallocate(void* ptr, size_t size)
+{
+  if (ptr)
+  {
+    this->DeallocateMemory(ptr, size);
+    this->AddInUse(0, size);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::AddInUse(size_t added, size_t removed)
+{
+  // the unsigned difference wraps around when fewer bytes are added
+  const vtkTypeUInt64 inUse = this->BytesInUse +=
+    static_cast<vtkTypeUInt64>(added) - static_cast<vtkTypeUInt64>(removed);
+  vtkTypeUInt64 peak = this->PeakBytesInUse;
+  while (inUse > peak && !this->PeakBytesInUse.compare_exchange_weak(peak, inUse))
+  {
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::ResetCounters()
+{
+  this->BytesAllocated = 0;
+  this->NumberOfAllocations = 0;
+  this->PeakBytesInUse = this->BytesInUse.load();
+}
+
+//------------------------------------------------------------------------------
+void* vtkMemoryResource::AllocateMemory(size_t size)
+{
+  return malloc(size);
+}
+
+//------------------------------------------------------------------------------
+void* vtkMemoryResource::ReallocateMemory(void* ptr, size_t, size_t newSize)
+{
+  return realloc(ptr, newSize);
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::DeallocateMemory(void* ptr, size_t)
+{
+  free(ptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::SetDefault(vtkMemoryResource* resource)
+{
+  if (resource == DefaultResource)
+  {
+    return;
+  }
+  if (resource)
+  {
+    resource->Register(nullptr);
+  }
+  if (DefaultResource)
+  {
+    DefaultResource->UnRegister(nullptr);
+  }
+  DefaultResource = resource;
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResource* vtkMemoryResource::GetDefault()
+{
+  return DefaultResource;
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResource* vtkMemoryResource::GetCurrent()
+{
+  return CurrentResource ? CurrentResource : DefaultResource;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "BytesAllocated: " << this->BytesAllocated << endl;
+  os << indent << "NumberOfAllocations: " << this->NumberOfAllocations << endl;
+  os << indent << "BytesInUse: " << this->BytesInUse << endl;
+  os << indent << "PeakBytesInUse: " << this->PeakBytesInUse << endl;
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResourceScope::vtkMemoryResourceScope(vtkMemoryResource* resource)
+  : Resource(resource)
+  , Previous(CurrentResource)
+{
+  if (this->Resource)
+  {
+    CurrentResource = this->Resource;
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResourceScope::~vtkMemoryResourceScope()
+{
+  if (this->Resource)
+  {
+    CurrentResource = this->Previous;
+  }
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,142 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkMemoryResource.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkMemoryResource
+ * @brief   allocator of the memory of the data arrays
+ *
+ * vtkMemoryResource allocates the memory of vtkBuffer, and so of
+ * vtkAOSDataArrayTemplate, vtkSOADataArrayTemplate and vtkCellArray. A
+ * buffer allocates with the resource that is current in its thread, and with
+ * malloc and realloc as before when there is none.
+ *
+ * The current resource of a thread is the one of its innermost
+ * vtkMemoryResourceScope, or else the default resource set by SetDefault().
+ * vtkExecutive makes its memory resource current while its algorithm
+ * executes, so that a resource can be given to a whole pipeline or to a
+ * single filter.
+ *
+ * The resource counts the bytes and the allocations it serves, so that a
+ * resource set on an executive measures the memory allocated by its filter.
+ * Subclasses override AllocateMemory(), ReallocateMemory() and
+ * DeallocateMemory(); this class implements them with malloc, realloc and
+ * free. The memory returned must be aligned like the memory of malloc, and
+ * may be released from any thread. A buffer keeps a reference to the resource
+ * of its memory and releases the memory with it.
+ *
+ * @sa
+ * vtkPoolMemoryResource vtkHugePageMemoryResource vtkBuffer
+ */
+
+#ifndef vtkMemoryResource_h
+#define vtkMemoryResource_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <atomic> // For the counters
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkMemoryResource : public vtkObject
+{
+public:
+  static vtkMemoryResource* New();
+  vtkTypeMacro(vtkMemoryResource, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Allocate, resize or release a block of size bytes. Reallocate() keeps the
+   * content of the block up to the smallest size and may move it, like
+   * realloc. The size given to Reallocate() and Deallocate() is the size the
+   * block was allocated with. Allocate() and Reallocate() return a null
+   * pointer on failure, in which case the block given to Reallocate() is left
+   * unchanged.
+   */
+  void* Allocate(size_t size);
+  void* Reallocate(void* ptr, size_t oldSize, size_t newSize);
+  void Deallocate(void* ptr, size_t size);
+  ///@}
+
+  ///@{
+  /**
+   * The number of bytes and the number of blocks allocated or reallocated
+   * since the last call to ResetCounters(), the number of bytes in use and
+   * the largest number of bytes in use since the last call to
+   * ResetCounters().
+   */
+  vtkTypeUInt64 GetBytesAllocated() const { return this->BytesAllocated; }
+  vtkTypeUInt64 GetNumberOfAllocations() const { return this->NumberOfAllocations; }
+  vtkTypeUInt64 GetBytesInUse() const { return this->BytesInUse; }
+  vtkTypeUInt64 GetPeakBytesInUse() const { return this->PeakBytesInUse; }
+  void ResetCounters();
+  ///@}
+
+  ///@{
+  /**
+   * The resource used when no vtkMemoryResourceScope is active in a thread.
+   * Initial value is a null pointer. It must not be changed while other
+   * threads create data arrays.
+   */
+  static void SetDefault(vtkMemoryResource* resource);
+  static vtkMemoryResource* GetDefault();
+  ///@}
+
+  /**
+   * The resource of the innermost vtkMemoryResourceScope of the calling
+   * thread, or the default resource.
+   */
+  static vtkMemoryResource* GetCurrent();
+
+protected:
+  vtkMemoryResource();
+  ~vtkMemoryResource() override;
+
+  virtual void* AllocateMemory(size_t size);
+  virtual void* ReallocateMemory(void* ptr, size_t oldSize, size_t newSize);
+  virtual void DeallocateMemory(void* ptr, size_t size);
+
+private:
+  vtkMemoryResource(const vtkMemoryResource&) = delete;
+  void operator=(const vtkMemoryResource&) = delete;
+
+  void AddInUse(size_t added, size_t removed);
+
+  std::atomic<vtkTypeUInt64> BytesAllocated;
+  std::atomic<vtkTypeUInt64> NumberOfAllocations;
+  std::atomic<vtkTypeUInt64> BytesInUse;
+  std::atomic<vtkTypeUInt64> PeakBytesInUse;
+};
+
+/**
+ * Makes a resource current in the calling thread for the lifetime of the
+ * scope, and restores the previous one when it is destroyed. A null resource
+ * leaves the current resource unchanged.
+ */
+class VTKCOMMONCORE_EXPORT vtkMemoryResourceScope
+{
+public:
+  vtkMemoryResourceScope(vtkMemoryResource* resource);
+  ~vtkMemoryResourceScope();
+
+private:
+  vtkMemoryResourceScope(const vtkMemoryResourceScope&) = delete;
+  void operator=(const vtkMemoryResourceScope&) = delete;
+
+  vtkMemoryResource* Resource;
+  vtkMemoryResource* Previous;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -58,6 +58,16 @@ int vtkMultiThreader::GetGlobalMaximumNumberOfThreads()
   return vtkMultiThreaderGlobalMaximumNumberOfThreads;
 }
 
+int vtkMultiThreader::LimitToGlobalMaximumNumberOfThreads(int numberOfThreads)
+{
+  if (vtkMultiThreaderGlobalMaximumNumberOfThreads > 0 &&
+    numberOfThreads > vtkMultiThreaderGlobalMaximumNumberOfThreads)
+  {
+    return vtkMultiThreaderGlobalMaximumNumberOfThreads;
+  }
+  return numberOfThreads;
+}
+
 int vtkMultiThreader::GetGlobalStaticMaximumNumberOfThreads()
 {
   return VTK_MAX_THREADS;
@@ -163,13 +173,7 @@ vtkMultiThreader::~vtkMultiThreader()
 //------------------------------------------------------------------------------
 int vtkMultiThreader::GetNumberOfThreads()
 {
-  int num = this->NumberOfThreads;
-  if (vtkMultiThreaderGlobalMaximumNumberOfThreads > 0 &&
-    num > vtkMultiThreaderGlobalMaximumNumberOfThreads)
-  {
-    num = vtkMultiThreaderGlobalMaximumNumberOfThreads;
-  }
-  return num;
+  return vtkMultiThreader::LimitToGlobalMaximumNumberOfThreads(this->NumberOfThreads);
 }
 
 // Set the user defined method that will be run on NumberOfThreads threads
@@ -131,6 +131,14 @@ public:
   static int GetGlobalMaximumNumberOfThreads();
   ///@}
 
+  /**
+   * Return the given number of threads, reduced to the global maximum number
+   * of threads if it is set. The STDThread backend of vtkSMPTools,
+   * vtkThreadedCallbackQueue and vtkThreadedTaskQueue use it to size their
+   * threads, so that the global maximum bounds every thread pool of VTK.
+   */
+  static int LimitToGlobalMaximumNumberOfThreads(int numberOfThreads);
+
   ///@{
   /**
    * Set/Get the value which is used to initialize the NumberOfThreads
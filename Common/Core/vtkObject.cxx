@@ -498,6 +498,14 @@ vtkTypeBool vtkSubjectHelper::HasObserver(unsigned long event, vtkCommand* cmd)
 //------------------------------------------------------------------------------
 int vtkSubjectHelper::InvokeEvent(unsigned long event, void* callData, vtkObject* self)
 {
+  // Objects often have observers for other events only, such as the ModifiedEvent
+  // of objects observed for their interaction events. As observers added while
+  // invoking the event are not invoked, nothing is done when none observes it.
+  if (!this->HasObserver(event))
+  {
+    return 0;
+  }
+
   int focusHandled = 0;
 
   // When we invoke an event, the observer may add or remove observers.  To make
@@ -881,7 +889,11 @@ void vtkObject::InternalReleaseFocus()
 void vtkObject::Modified()
 {
   this->MTime.Modified();
-  this->InvokeEvent(vtkCommand::ModifiedEvent, nullptr);
+  // most objects have no observers at all, avoid the call then.
+  if (this->SubjectHelper)
+  {
+    this->SubjectHelper->InvokeEvent(vtkCommand::ModifiedEvent, nullptr, this);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -438,6 +438,7 @@ void vtkObjectFactory::GrowOverrideArray()
     this->OverrideClassNames = newNameArray;
     delete[] this->OverrideArray;
     this->OverrideArray = newArray;
+    this->SizeOverrideArray = newLength;
   }
 }
 
@@ -0,0 +1,154 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPoolMemoryResource.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPoolMemoryResource.h"
+
+#include "vtkObjectFactory.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPoolMemoryResource);
+
+namespace
+{
+// Round up to a multiple of a quarter of the largest power of two less than
+// the size, so that at most a fifth of a block is wasted.
+size_t GetClassSize(size_t size)
+{
+  const size_t minimumSize = 64;
+  if (size <= minimumSize)
+  {
+    return minimumSize;
+  }
+  size_t power = minimumSize;
+  while (power <= (size - 1) / 2)
+  {
+    power *= 2;
+  }
+  const size_t step = power / 4;
+  return (size + step - 1) / step * step;
+}
+}
+
+struct vtkPoolMemoryResource::vtkInternals
+{
+  std::mutex Mutex;
+  std::map<size_t, std::vector<void*>> FreeBlocks;
+  size_t CachedBytes = 0;
+};
+
+//------------------------------------------------------------------------------
+vtkPoolMemoryResource::vtkPoolMemoryResource()
+  : MaximumBlockSize(size_t(256) << 20)
+  , MaximumCachedBytes(size_t(1) << 30)
+  , Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkPoolMemoryResource::~vtkPoolMemoryResource()
+{
+  this->ReleaseCachedMemory();
+}
+
+//------------------------------------------------------------------------------
+void* vtkPoolMemoryResource::AllocateMemory(size_t size)
+{
+  const size_t classSize = GetClassSize(size);
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    auto blocks = this->Internals->FreeBlocks.find(classSize);
+    if (blocks != this->Internals->FreeBlocks.end() && !blocks->second.empty())
+    {
+      void* ptr = blocks->second.back();
+      blocks->second.pop_back();
+      this->Internals->CachedBytes -= classSize;
+      return ptr;
+    }
+  }
+  // the blocks are always allocated with the size of their class, so that they
+  // can be kept whatever the maximums when they are released
+  return malloc(classSize);
+}
+
+//------------------------------------------------------------------------------
+void* vtkPoolMemoryResource::ReallocateMemory(void* ptr, size_t oldSize, size_t newSize)
+{
+  if (GetClassSize(oldSize) == GetClassSize(newSize))
+  {
+    return ptr;
+  }
+  void* newPtr = this->AllocateMemory(newSize);
+  if (newPtr)
+  {
+    memcpy(newPtr, ptr, std::min(oldSize, newSize));
+    this->DeallocateMemory(ptr, oldSize);
+  }
+  return newPtr;
+}
+
+//------------------------------------------------------------------------------
+void vtkPoolMemoryResource::DeallocateMemory(void* ptr, size_t size)
+{
+  const size_t classSize = GetClassSize(size);
+  if (classSize <= this->MaximumBlockSize)
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    if (this->Internals->CachedBytes + classSize <= this->MaximumCachedBytes)
+    {
+      this->Internals->FreeBlocks[classSize].push_back(ptr);
+      this->Internals->CachedBytes += classSize;
+      return;
+    }
+  }
+  free(ptr);
+}
+
+//------------------------------------------------------------------------------
+size_t vtkPoolMemoryResource::GetCachedBytes()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return this->Internals->CachedBytes;
+}
+
+//------------------------------------------------------------------------------
+void vtkPoolMemoryResource::ReleaseCachedMemory()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  for (auto& blocks : this->Internals->FreeBlocks)
+  {
+    for (void* ptr : blocks.second)
+    {
+      free(ptr);
+    }
+  }
+  this->Internals->FreeBlocks.clear();
+  this->Internals->CachedBytes = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkPoolMemoryResource::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaximumBlockSize: " << this->MaximumBlockSize << endl;
+  os << indent << "MaximumCachedBytes: " << this->MaximumCachedBytes << endl;
+  os << indent << "CachedBytes: " << this->GetCachedBytes() << endl;
+}
+VTK_ABI_NAMESPACE_END
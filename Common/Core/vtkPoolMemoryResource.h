@@ -0,0 +1,100 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPoolMemoryResource.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPoolMemoryResource
+ * @brief   memory resource that keeps released blocks for reuse
+ *
+ * vtkPoolMemoryResource rounds the size of the blocks up to size classes,
+ * four per power of two, and keeps the released blocks in a free list per
+ * class instead of freeing them. A later allocation of the same class reuses
+ * a block without going through malloc or touching new pages.
+ *
+ * Given to the executive of a filter, it acts as an arena for the filter:
+ * when the filter executes again, the arrays of its previous output are
+ * released into the pool and the new output reuses their blocks.
+ *
+ * At most MaximumCachedBytes are kept, and blocks larger than
+ * MaximumBlockSize are freed when released. ReleaseCachedMemory() frees all
+ * the blocks kept. The resource is thread safe.
+ *
+ * @sa
+ * vtkMemoryResource vtkExecutive
+ */
+
+#ifndef vtkPoolMemoryResource_h
+#define vtkPoolMemoryResource_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkMemoryResource.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkPoolMemoryResource : public vtkMemoryResource
+{
+public:
+  static vtkPoolMemoryResource* New();
+  vtkTypeMacro(vtkPoolMemoryResource, vtkMemoryResource);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Released blocks larger than this number of bytes are freed. Initial value
+   * is 256 MiB.
+   */
+  vtkSetMacro(MaximumBlockSize, size_t);
+  vtkGetMacro(MaximumBlockSize, size_t);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum number of bytes of released blocks kept for reuse. Initial value
+   * is 1 GiB.
+   */
+  vtkSetMacro(MaximumCachedBytes, size_t);
+  vtkGetMacro(MaximumCachedBytes, size_t);
+  ///@}
+
+  /**
+   * Number of bytes of released blocks kept for reuse.
+   */
+  size_t GetCachedBytes();
+
+  /**
+   * Free the blocks kept for reuse.
+   */
+  void ReleaseCachedMemory();
+
+protected:
+  vtkPoolMemoryResource();
+  ~vtkPoolMemoryResource() override;
+
+  void* AllocateMemory(size_t size) override;
+  void* ReallocateMemory(void* ptr, size_t oldSize, size_t newSize) override;
+  void DeallocateMemory(void* ptr, size_t size) override;
+
+  size_t MaximumBlockSize;
+  size_t MaximumCachedBytes;
+
+private:
+  vtkPoolMemoryResource(const vtkPoolMemoryResource&) = delete;
+  void operator=(const vtkPoolMemoryResource&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -73,4 +73,35 @@ bool vtkSMPTools::GetSingleThread()
   auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
   return SMPToolsAPI.GetSingleThread();
 }
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::IsCancelled()
+{
+  const auto* scope = vtk::detail::smp::vtkSMPToolsCancellation::GetCurrent();
+  return scope && scope->IsCancelled();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetInstrumentation(bool enable)
+{
+  vtk::detail::smp::vtkSMPToolsInstrumentation::SetEnabled(enable);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetInstrumentation()
+{
+  return vtk::detail::smp::vtkSMPToolsInstrumentation::IsEnabled();
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkSMPTools::ForStatistics> vtkSMPTools::GetForStatistics()
+{
+  return vtk::detail::smp::vtkSMPToolsInstrumentation::GetStatistics();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::ClearForStatistics()
+{
+  vtk::detail::smp::vtkSMPToolsInstrumentation::ClearStatistics();
+}
 VTK_ABI_NAMESPACE_END
@@ -36,8 +36,14 @@
 #include "SMP/Common/vtkSMPToolsAPI.h"
 #include "vtkSMPThreadLocal.h" // For Initialized
 
+#include <algorithm>   // For std::minmax_element
+#include <atomic>      // For CancellableScope
 #include <functional>  // For std::function
+#include <iterator>    // For std::iterator_traits
 #include <type_traits> // For std:::enable_if
+#include <typeinfo>    // For typeid
+#include <utility>     // For std::forward
+#include <vector>      // For TaskGroup
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 namespace vtk
@@ -90,14 +96,31 @@ template <typename Functor>
 struct vtkSMPTools_FunctorInternal<Functor, false>
 {
   Functor& F;
+  const vtkSMPToolsCancellation* Cancellation;
+  vtkSMPToolsInstrumentation* Instrumentation;
   vtkSMPTools_FunctorInternal(Functor& f)
     : F(f)
+    , Cancellation(vtkSMPToolsCancellation::GetCurrent())
+    , Instrumentation(nullptr)
   {
   }
-  void Execute(vtkIdType first, vtkIdType last) { this->F(first, last); }
+  void Execute(vtkIdType first, vtkIdType last)
+  {
+    vtkSMPToolsCancellation::Resume resume(this->Cancellation);
+    vtkSMPToolsInstrumentation::Chunk chunk(this->Instrumentation);
+    this->F(first, last);
+  }
   void For(vtkIdType first, vtkIdType last, vtkIdType grain)
   {
     auto& SMPToolsAPI = vtkSMPToolsAPI::GetInstance();
+    if (vtkSMPToolsInstrumentation::IsEnabled())
+    {
+      vtkSMPToolsInstrumentation instrumentation(typeid(Functor), first, last, grain);
+      this->Instrumentation = &instrumentation;
+      SMPToolsAPI.For(first, last, grain, *this);
+      this->Instrumentation = nullptr;
+      return;
+    }
     SMPToolsAPI.For(first, last, grain, *this);
   }
   vtkSMPTools_FunctorInternal<Functor, false>& operator=(
@@ -110,13 +133,19 @@ struct vtkSMPTools_FunctorInternal<Functor, true>
 {
   Functor& F;
   vtkSMPThreadLocal<unsigned char> Initialized;
+  const vtkSMPToolsCancellation* Cancellation;
+  vtkSMPToolsInstrumentation* Instrumentation;
   vtkSMPTools_FunctorInternal(Functor& f)
     : F(f)
     , Initialized(0)
+    , Cancellation(vtkSMPToolsCancellation::GetCurrent())
+    , Instrumentation(nullptr)
   {
   }
   void Execute(vtkIdType first, vtkIdType last)
   {
+    vtkSMPToolsCancellation::Resume resume(this->Cancellation);
+    vtkSMPToolsInstrumentation::Chunk chunk(this->Instrumentation);
     unsigned char& inited = this->Initialized.Local();
     if (!inited)
     {
@@ -128,6 +157,16 @@ struct vtkSMPTools_FunctorInternal<Functor, true>
   void For(vtkIdType first, vtkIdType last, vtkIdType grain)
   {
     auto& SMPToolsAPI = vtkSMPToolsAPI::GetInstance();
+    if (vtkSMPToolsInstrumentation::IsEnabled())
+    {
+      // The reduction is part of the loop, during which the other threads idle.
+      vtkSMPToolsInstrumentation instrumentation(typeid(Functor), first, last, grain);
+      this->Instrumentation = &instrumentation;
+      SMPToolsAPI.For(first, last, grain, *this);
+      this->Instrumentation = nullptr;
+      this->F.Reduce();
+      return;
+    }
     SMPToolsAPI.For(first, last, grain, *this);
     this->F.Reduce();
   }
@@ -452,6 +491,95 @@ public:
    */
   static bool GetSingleThread();
 
+  /**
+   * Call `lambda` so that the functors of the For() loops it runs, and of the
+   * loops nested in them, can call IsCancelled() to find out whether `cancel`
+   * is true, for instance when it is set from another thread. Cancellation is
+   * opt-in: loops never skip chunks by themselves, because a loop filling a
+   * cache shared with other consumers, such as the range of an input array,
+   * must run to completion. Only functors that own what they write, usually
+   * the output of an algorithm, should return early when IsCancelled() is
+   * true, and the caller should then discard their partial work. Scopes can
+   * be nested: a scope is cancelled when its flag or the flag of an enclosing
+   * scope is set.
+   *
+   * Usage example:
+   * \code
+   * std::atomic<vtkTypeBool> cancel(false);
+   * vtkSMPTools::CancellableScope(cancel, [&]() {
+   *   vtkSMPTools::For(0, size, [&](vtkIdType begin, vtkIdType end) {
+   *     if (!vtkSMPTools::IsCancelled())
+   *     {
+   *       worker(begin, end);
+   *     }
+   *   });
+   * });
+   * \endcode
+   *
+   * The pipeline runs the RequestData() of algorithms in such a scope with
+   * their AbortExecute flag.
+   */
+  template <typename T>
+  static void CancellableScope(const std::atomic<vtkTypeBool>& cancel, T&& lambda)
+  {
+    vtk::detail::smp::vtkSMPToolsCancellation scope(cancel);
+    lambda();
+  }
+
+  /**
+   * Return true if the CancellableScope() of the calling thread, or one
+   * enclosing it, is cancelled. Returns false outside of such a scope.
+   */
+  static bool IsCancelled();
+
+  ///@{
+  /**
+   * Enable or disable the instrumentation of the For() loops, off by default
+   * unless the VTK_SMP_INSTRUMENTATION environment variable is set to a
+   * nonzero value. Instrumented loops time each of their chunks, whatever
+   * the backend, and accumulate their statistics per call site, which
+   * GetForStatistics() returns. Timing the chunks slows down the loops with
+   * many tiny chunks. vtkPipelineProfiler can add the instrumented loops to
+   * its trace, see vtkPipelineProfiler::SetProfileSMP().
+   */
+  static void SetInstrumentation(bool enable);
+  static bool GetInstrumentation();
+  ///@}
+
+  /**
+   * Statistics of the instrumented For() loops of a call site:
+   *    - CallSite is the type of the functor, unique to each lambda.
+   *    - Backend is the backend that ran the last loop.
+   *    - NumberOfCalls, NumberOfIterations and NumberOfChunks are the total
+   *      number of loops, of items in their ranges and of chunks they were
+   *      split in, so NumberOfIterations / NumberOfChunks is the average
+   *      grain.
+   *    - MaximumNumberOfThreads is the largest number of threads available
+   *      to a loop, 1 for the loops run as a single chunk by the calling
+   *      thread.
+   *    - MaximumNestingDepth is the largest number of loops a loop ran in,
+   *      0 for the loops not nested in another loop.
+   *    - WallTime is the total duration of the loops, BusyTime the total
+   *      time spent in their chunks and IdleTime the time the threads
+   *      available to them did not, which grows with the load imbalance.
+   *    - ThreadBusyTimes is the time spent in the chunks by each thread,
+   *      threads being numbered in the order they first ran an instrumented
+   *      chunk.
+   * Times are in seconds.
+   */
+  using ForStatistics = vtk::detail::smp::vtkSMPToolsInstrumentation::Statistics;
+
+  /**
+   * Return the statistics of the instrumented For() loops for each call
+   * site, from the largest to the smallest wall time.
+   */
+  static std::vector<ForStatistics> GetForStatistics();
+
+  /**
+   * Remove the statistics of the instrumented For() loops.
+   */
+  static void ClearForStatistics();
+
   /**
    * Structure used to specify configuration for LocalScope() method.
    * Several parameters can be configured:
@@ -603,6 +731,215 @@ public:
     auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
     SMPToolsAPI.Sort(begin, end, comp);
   }
+
+  /**
+   * A convenience method for computing the exclusive prefix sum of a range. It
+   * is a drop in replacement for std::exclusive_scan(): the output value i is
+   * the sum of init and of the input values before i. The binary operation
+   * must be associative, it needs not be commutative. The output range may be
+   * the input range. Under the hood tbb::parallel_scan is used with TBB, and
+   * the other threaded backends compute the prefix sum in two parallel passes.
+   *
+   * Usage example, turning the number of points of each cell into offsets:
+   * \code
+   * auto range = vtk::DataArrayValueRange<1>(offsets);
+   * vtkSMPTools::ExclusiveScan(range.cbegin(), range.cend(), range.begin(), vtkIdType(0));
+   * \endcode
+   */
+  ///@{
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  static void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+  }
+  template <typename InputIt, typename OutputIt, typename T>
+  static void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init)
+  {
+    vtkSMPTools::ExclusiveScan(inBegin, inEnd, outBegin, init, std::plus<T>());
+  }
+  ///@}
+
+  /**
+   * A convenience method for computing the inclusive prefix sum of a range. It
+   * is a drop in replacement for std::inclusive_scan(): the output value i is
+   * the sum of the input values up to i. The same requirements as
+   * ExclusiveScan() apply.
+   */
+  ///@{
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  static void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.InclusiveScan(inBegin, inEnd, outBegin, op);
+  }
+  template <typename InputIt, typename OutputIt>
+  static void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin)
+  {
+    using ValueType = typename std::iterator_traits<InputIt>::value_type;
+    vtkSMPTools::InclusiveScan(inBegin, inEnd, outBegin, std::plus<ValueType>());
+  }
+  ///@}
+
+  /**
+   * A convenience method for reducing a range. It is a drop in replacement for
+   * std::reduce() which returns the sum of init and of the values of the
+   * range. The binary operation must be associative, values are combined in
+   * the order of the range. tbb::parallel_reduce is used with TBB.
+   */
+  ///@{
+  template <typename InputIt, typename T, typename BinaryOp>
+  static T Reduce(InputIt begin, InputIt end, T init, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.Reduce(begin, end, init, op);
+  }
+  template <typename InputIt, typename T>
+  static T Reduce(InputIt begin, InputIt end, T init)
+  {
+    return vtkSMPTools::Reduce(begin, end, init, std::plus<T>());
+  }
+  ///@}
+
+  /**
+   * A convenience method for finding the smallest and largest values of a
+   * range. It is a drop in replacement for std::minmax_element(): it returns
+   * iterators to the first smallest and to the last largest value, or two
+   * end iterators for an empty range. This version of MinMax() takes a
+   * comparison class.
+   */
+  template <typename Iterator, typename Compare>
+  static std::pair<Iterator, Iterator> MinMax(Iterator begin, Iterator end, Compare comp)
+  {
+    const vtkIdType size = std::distance(begin, end);
+    if (size <= 0)
+    {
+      return std::make_pair(end, end);
+    }
+    vtkIdType numberOfBlocks = vtk::detail::smp::GetNumberOfScanBlocks(
+      vtkSMPTools::GetEstimatedNumberOfThreads(), size);
+    const vtkIdType blockSize = (size + numberOfBlocks - 1) / numberOfBlocks;
+    numberOfBlocks = (size + blockSize - 1) / blockSize;
+    std::vector<std::pair<Iterator, Iterator>> results(numberOfBlocks, std::make_pair(end, end));
+    vtkSMPTools::For(0, numberOfBlocks, 1,
+      [&](vtkIdType beginBlock, vtkIdType endBlock)
+      {
+        for (vtkIdType block = beginBlock; block < endBlock; ++block)
+        {
+          Iterator first = begin;
+          std::advance(first, block * blockSize);
+          Iterator last = first;
+          std::advance(last, (std::min)(blockSize, size - block * blockSize));
+          results[block] = std::minmax_element(first, last, comp);
+        }
+      });
+    std::pair<Iterator, Iterator> result = results[0];
+    for (vtkIdType block = 1; block < numberOfBlocks; ++block)
+    {
+      if (comp(*results[block].first, *result.first))
+      {
+        result.first = results[block].first;
+      }
+      if (!comp(*results[block].second, *result.second))
+      {
+        result.second = results[block].second;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * A convenience method for finding the smallest and largest values of a
+   * range. It is a drop in replacement for std::minmax_element().
+   */
+  template <typename Iterator>
+  static std::pair<Iterator, Iterator> MinMax(Iterator begin, Iterator end)
+  {
+    using ValueType = typename std::iterator_traits<Iterator>::value_type;
+    return vtkSMPTools::MinMax(begin, end, std::less<ValueType>());
+  }
+
+  /**
+   * A group of tasks executed concurrently, for fork-join parallelism.
+   * Tasks are added with Run() and Wait() returns once all of them are done.
+   * Work that depends on the tasks simply goes after Wait(). A task can create
+   * its own TaskGroup to spawn sub-tasks, so recursive algorithms (tree builds,
+   * divide and conquer) can be expressed directly. The tasks are executed by
+   * the backend and the number of threads of the current scope: TBB runs them
+   * in a tbb::task_group, OpenMP as explicit tasks of the current team, and
+   * STDThread on the threads of the pool that the enclosing groups do not
+   * use. The groups created inside tasks thus run in parallel whatever the
+   * nested parallelism setting, which only applies to the For() loops of the
+   * tasks.
+   *
+   * Run() and Wait() must be called from the thread that created the group,
+   * and tasks must not throw. Tasks may start at any time before Wait()
+   * returns, possibly not before Wait() is called. The destructor waits for
+   * the remaining tasks.
+   *
+   * Usage example:
+   * \code
+   * void Build(Node* node)
+   * {
+   *   if (node->IsLeaf())
+   *   {
+   *     return;
+   *   }
+   *   vtkSMPTools::TaskGroup group;
+   *   group.Run([&]() { Build(node->Left); });
+   *   group.Run([&]() { Build(node->Right); });
+   *   group.Wait();
+   *   node->UpdateBounds(); // the children are built
+   * }
+   * \endcode
+   */
+  class TaskGroup
+  {
+  public:
+    TaskGroup() = default;
+    ~TaskGroup() { this->Wait(); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * Add a task, callable with no argument, to the group.
+     */
+    template <typename Task>
+    void Run(Task&& task)
+    {
+      this->Tasks.emplace_back(std::forward<Task>(task));
+    }
+
+    /**
+     * Execute the tasks added since the last call and return when all of them
+     * are done. The group can be reused afterwards.
+     */
+    void Wait()
+    {
+      std::vector<std::function<void()>> tasks;
+      tasks.swap(this->Tasks);
+      using vtk::detail::smp::vtkSMPToolsCancellation;
+      const vtkSMPToolsCancellation* scope = vtkSMPToolsCancellation::GetCurrent();
+      if (scope)
+      {
+        // the tasks see the cancellation scope of the group
+        for (auto& task : tasks)
+        {
+          std::function<void()> run = std::move(task);
+          task = [scope, run]()
+          {
+            vtkSMPToolsCancellation::Resume resume(scope);
+            run();
+          };
+        }
+      }
+      vtk::detail::smp::vtkSMPToolsAPI::GetInstance().RunTasks(tasks);
+    }
+
+  private:
+    std::vector<std::function<void()>> Tasks;
+  };
 };
 
 VTK_ABI_NAMESPACE_END
@@ -197,6 +197,14 @@ public:
    */
   ValueType* GetComponentArrayPointer(int comp);
 
+  /**
+   * Same as GetComponentArrayPointer(), for the wrappers, which use it to
+   * share the values of a component without copies, e.g. with NumPy.
+   * Returns nullptr without error when the component does not exist or the
+   * values are currently stored in AoS mode, after a call to GetVoidPointer().
+   */
+  void* GetComponentArrayVoidPointer(int comp);
+
   /**
    * Use of this method is discouraged, it creates a deep copy of the data into
    * a contiguous AoS-ordered buffer and prints a warning.
@@ -354,6 +354,18 @@ vtkSOADataArrayTemplate<ValueType>::GetComponentArrayPointer(int comp)
   return this->Data[comp]->GetBuffer();
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueType>
+void* vtkSOADataArrayTemplate<ValueType>::GetComponentArrayVoidPointer(int comp)
+{
+  if (this->StorageType == StorageTypeEnum::AOS || comp < 0 ||
+    comp >= this->GetNumberOfComponents())
+  {
+    return nullptr;
+  }
+  return this->Data[comp]->GetBuffer();
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueType>
 bool vtkSOADataArrayTemplate<ValueType>::AllocateTuples(vtkIdType numTuples)
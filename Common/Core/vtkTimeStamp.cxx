@@ -19,6 +19,23 @@
 
 #include <atomic>
 
+namespace
+{
+// The counter has a cache line of its own, so that modifying objects on several
+// threads does not also contend with unrelated data. Handing out ranges of
+// times to each thread would avoid the contention altogether, but times would
+// then no longer be ordered across threads, when the pipeline relies on an
+// object modified after another one having a greater time.
+struct alignas(64) vtkGlobalTimeStamp
+{
+#if defined(VTK_USE_64BIT_TIMESTAMPS) || (VTK_SIZEOF_VOID_P == 8)
+  std::atomic<uint64_t> Value{ 0U };
+#else
+  std::atomic<uint32_t> Value{ 0U };
+#endif
+};
+}
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkTimeStamp* vtkTimeStamp::New()
@@ -49,11 +66,7 @@ void vtkTimeStamp::Modified()
   // The last solution has been decided to have the smallest downside of these.
   //
   // Good luck!
-#if defined(VTK_USE_64BIT_TIMESTAMPS) || (VTK_SIZEOF_VOID_P == 8)
-  static std::atomic<uint64_t> GlobalTimeStamp(0U);
-#else
-  static std::atomic<uint32_t> GlobalTimeStamp(0U);
-#endif
-  this->ModifiedTime = (vtkMTimeType)++GlobalTimeStamp;
+  static vtkGlobalTimeStamp GlobalTimeStamp;
+  this->ModifiedTime = (vtkMTimeType)++GlobalTimeStamp.Value;
 }
 VTK_ABI_NAMESPACE_END
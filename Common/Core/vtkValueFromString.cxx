@@ -0,0 +1,167 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkValueFromString.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkValueFromString.h"
+
+#include "vtkfast_float.h"
+
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Accumulate the digits in the magnitude of the largest integer of the same
+// signedness, checking for overflow against the limits of T.
+template <typename T>
+std::size_t IntegerFromString(const char* begin, const char* end, T& output)
+{
+  using UnsignedT = typename std::make_unsigned<T>::type;
+  const char* it = begin;
+  bool negative = false;
+  if (it != end && (*it == '-' || *it == '+'))
+  {
+    negative = (*it == '-');
+    ++it;
+  }
+  if (negative && !std::is_signed<T>::value)
+  {
+    return 0;
+  }
+
+  // the magnitude of the lowest value of a signed type is max + 1
+  const UnsignedT limit =
+    static_cast<UnsignedT>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+  UnsignedT value = 0;
+  const char* digits = it;
+  for (; it != end && *it >= '0' && *it <= '9'; ++it)
+  {
+    const UnsignedT digit = static_cast<UnsignedT>(*it - '0');
+    if (value > (limit - digit) / 10)
+    {
+      return 0;
+    }
+    value = static_cast<UnsignedT>(value * 10 + digit);
+  }
+  if (it == digits)
+  {
+    return 0;
+  }
+
+  output = negative ? static_cast<T>(0 - value) : static_cast<T>(value);
+  return static_cast<std::size_t>(it - begin);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+std::size_t RealFromString(const char* begin, const char* end, T& output)
+{
+  // from_chars follows the C++17 grammar, which does not allow a plus sign
+  const char* it = begin;
+  if (it != end && *it == '+')
+  {
+    ++it;
+    if (it != end && *it == '-')
+    {
+      return 0;
+    }
+  }
+
+  T value;
+  const auto result = vtkfast_float::from_chars(it, end, value);
+  if (result.ec != std::errc())
+  {
+    return 0;
+  }
+  output = value;
+  return static_cast<std::size_t>(result.ptr - begin);
+}
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, signed char& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, unsigned char& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, short& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, unsigned short& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, int& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, unsigned int& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, long& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, unsigned long& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, long long& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, unsigned long long& output)
+{
+  return IntegerFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, float& output)
+{
+  return RealFromString(begin, end, output);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkValueFromString(const char* begin, const char* end, double& output)
+{
+  return RealFromString(begin, end, output);
+}
+
+VTK_ABI_NAMESPACE_END
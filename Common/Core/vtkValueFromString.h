@@ -0,0 +1,77 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkValueFromString.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+/**
+ * @file   vtkValueFromString.h
+ * @brief  fast, locale independent parsing of numbers
+ *
+ * vtkValueFromString() parses the number at the beginning of the range
+ * [begin, end) and returns the number of characters it used, or 0 if the
+ * range does not start with a valid number or if the number does not fit in
+ * the output type. In that case the output is left unchanged.
+ *
+ * Unlike the C library functions, the range does not need to be null
+ * terminated, leading whitespace is not skipped and the parsing does not
+ * depend on the current locale, which makes these functions suitable for
+ * parsing large text files from several threads. Integers are written in
+ * decimal with an optional sign. Floating point numbers use the fixed or
+ * scientific notation, "inf", "infinity" and "nan" are recognized too, and
+ * are correctly rounded.
+ */
+
+#ifndef vtkValueFromString_h
+#define vtkValueFromString_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+
+#include <cstddef>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+///@{
+/**
+ * Parse a number from [begin, end), return the number of characters used or
+ * 0 on failure.
+ */
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, signed char& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, unsigned char& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, short& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, unsigned short& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, int& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, unsigned int& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, long& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, unsigned long& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, long long& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, unsigned long long& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, float& output);
+VTKCOMMONCORE_EXPORT std::size_t vtkValueFromString(
+  const char* begin, const char* end, double& output);
+///@}
+
+VTK_ABI_NAMESPACE_END
+
+#endif
+// VTK-HeaderTest-Exclude: vtkValueFromString.h
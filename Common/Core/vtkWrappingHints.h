@@ -29,6 +29,8 @@
 #define VTK_WRAPEXCLUDE [[vtk::wrapexclude]]
 // The return value points to a newly-created VTK object.
 #define VTK_NEWINSTANCE [[vtk::newinstance]]
+// The wrappers let other threads run during calls of the method.
+#define VTK_UNBLOCKTHREADS [[vtk::unblockthreads]]
 // The parameter is a pointer to a zerocopy buffer.
 #define VTK_ZEROCOPY [[vtk::zerocopy]]
 // The parameter is a path on the filesystem.
@@ -42,6 +44,7 @@
 #ifndef VTK_WRAP_HINTS_DEFINED
 #define VTK_WRAPEXCLUDE
 #define VTK_NEWINSTANCE
+#define VTK_UNBLOCKTHREADS
 #define VTK_ZEROCOPY
 #define VTK_FILEPATH
 #define VTK_EXPECTS(x)
@@ -0,0 +1,118 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    CellTreeLocatorParallelBuild.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Build vtkCellTreeLocator on an image with enough cells for the upper
+// nodes to be split in parallel, and check FindCell and
+// FindCellsWithinBounds against the structure of the image.
+
+#include "vtkCellTreeLocator.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+bool CheckLocator(vtkImageData* image, bool cacheCellBounds)
+{
+  vtkNew<vtkCellTreeLocator> locator;
+  locator->SetDataSet(image);
+  locator->SetCacheCellBounds(cacheCellBounds);
+  locator->BuildLocator();
+
+  unsigned int state = 2468;
+  auto random = [&state]() {
+    state = state * 1103515245u + 12345u;
+    return ((state >> 8) & 0xffff) / 65535.0;
+  };
+
+  const int* dims = image->GetDimensions();
+  const double* spacing = image->GetSpacing();
+  vtkNew<vtkGenericCell> cell;
+  double pcoords[3], weights[8];
+  int subId;
+  for (int i = 0; i < 2000; i++)
+  {
+    double x[3] = { random() * (dims[0] - 1) * spacing[0], random() * (dims[1] - 1) * spacing[1],
+      random() * (dims[2] - 1) * spacing[2] };
+    int ijk[3];
+    image->ComputeStructuredCoordinates(x, ijk, pcoords);
+    vtkIdType expected = ijk[0] + (dims[0] - 1) * (ijk[1] + (dims[1] - 1) * ijk[2]);
+    vtkIdType cellId = locator->FindCell(x, 0.0, cell, subId, pcoords, weights);
+    if (cellId != expected)
+    {
+      std::cerr << "FindCell returned " << cellId << " instead of " << expected << std::endl;
+      return false;
+    }
+  }
+
+  vtkNew<vtkIdList> cells;
+  for (int i = 0; i < 20; i++)
+  {
+    double bounds[6];
+    for (int axis = 0; axis < 3; axis++)
+    {
+      double a = random() * (dims[axis] - 1) * spacing[axis];
+      double b = random() * (dims[axis] - 1) * spacing[axis];
+      bounds[2 * axis] = std::min(a, b);
+      bounds[2 * axis + 1] = std::max(a, b);
+    }
+    cells->Reset();
+    locator->FindCellsWithinBounds(bounds, cells);
+    std::vector<vtkIdType> found(cells->begin(), cells->end());
+    std::sort(found.begin(), found.end());
+
+    std::vector<vtkIdType> expected;
+    double cellBounds[6];
+    for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); cellId++)
+    {
+      image->GetCellBounds(cellId, cellBounds);
+      bool overlap = true;
+      for (int axis = 0; axis < 3; axis++)
+      {
+        overlap &= (cellBounds[2 * axis] <= bounds[2 * axis + 1] &&
+          cellBounds[2 * axis + 1] >= bounds[2 * axis]);
+      }
+      if (overlap)
+      {
+        expected.push_back(cellId);
+      }
+    }
+    if (found != expected)
+    {
+      std::cerr << "FindCellsWithinBounds found " << found.size() << " cells instead of "
+                << expected.size() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int CellTreeLocatorParallelBuild(int, char*[])
+{
+  // about 120000 cells, with different spacings along each axis
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(80, 50, 31);
+  image->SetSpacing(0.5, 1.0, 2.0);
+
+  bool success = CheckLocator(image, true);
+  success &= CheckLocator(image, false);
+  return (success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
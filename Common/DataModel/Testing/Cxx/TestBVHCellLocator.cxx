@@ -0,0 +1,200 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestBVHCellLocator.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare the queries of vtkBVHCellLocator, with 4-wide and 8-wide nodes,
+// with those of vtkStaticCellLocator on a triangulated height field, and
+// check that the batched ray queries give the same results as the single
+// ray queries.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticCellLocator.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const int Resolution = 60;
+
+void MakeHeightField(vtkPolyData* surface)
+{
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j <= Resolution; j++)
+  {
+    for (int i = 0; i <= Resolution; i++)
+    {
+      double x = 10.0 * i / Resolution;
+      double y = 10.0 * j / Resolution;
+      points->InsertNextPoint(x, y, std::sin(x) * std::cos(0.7 * y));
+    }
+  }
+  vtkNew<vtkCellArray> triangles;
+  for (int j = 0; j < Resolution; j++)
+  {
+    for (int i = 0; i < Resolution; i++)
+    {
+      vtkIdType p = i + j * (Resolution + 1);
+      vtkIdType t0[3] = { p, p + 1, p + Resolution + 2 };
+      vtkIdType t1[3] = { p, p + Resolution + 2, p + Resolution + 1 };
+      triangles->InsertNextCell(3, t0);
+      triangles->InsertNextCell(3, t1);
+    }
+  }
+  surface->SetPoints(points);
+  surface->SetPolys(triangles);
+}
+
+bool CheckLocator(vtkPolyData* surface, int nodeWidth)
+{
+  vtkNew<vtkStaticCellLocator> reference;
+  reference->SetDataSet(surface);
+  reference->BuildLocator();
+
+  vtkNew<vtkBVHCellLocator> locator;
+  locator->SetDataSet(surface);
+  locator->SetNodeWidth(nodeWidth);
+  locator->BuildLocator();
+
+  unsigned int state = 1357;
+  auto random = [&state]() {
+    state = state * 1103515245u + 12345u;
+    return ((state >> 8) & 0xffff) / 65535.0;
+  };
+
+  // random segments, a third of them vertical, some of them missing the surface
+  const int numRays = 2000;
+  vtkNew<vtkPoints> p1s;
+  vtkNew<vtkPoints> p2s;
+  for (int i = 0; i < numRays; i++)
+  {
+    double p1[3] = { 12.0 * random() - 1.0, 12.0 * random() - 1.0, 3.0 * random() - 1.5 };
+    double p2[3] = { 12.0 * random() - 1.0, 12.0 * random() - 1.0, 3.0 * random() - 1.5 };
+    if (i % 3 == 0)
+    {
+      p1[2] = 2.0;
+      p2[0] = p1[0];
+      p2[1] = p1[1];
+      p2[2] = -2.0;
+    }
+    p1s->InsertNextPoint(p1);
+    p2s->InsertNextPoint(p2);
+  }
+
+  vtkNew<vtkIdTypeArray> cellIds;
+  vtkNew<vtkDoubleArray> ts;
+  vtkNew<vtkPoints> xs;
+  locator->IntersectWithLines(p1s, p2s, 0.0, cellIds, ts, xs);
+
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkIdList> cells;
+  vtkNew<vtkIdList> expectedCells;
+  for (int i = 0; i < numRays; i++)
+  {
+    double p1[3], p2[3], t, x[3], pcoords[3], expectedT, expectedX[3];
+    int subId;
+    vtkIdType cellId, expectedId;
+    p1s->GetPoint(i, p1);
+    p2s->GetPoint(i, p2);
+    int hit = locator->IntersectWithLine(p1, p2, 0.0, t, x, pcoords, subId, cellId, cell);
+    int expectedHit = reference->IntersectWithLine(
+      p1, p2, 0.0, expectedT, expectedX, pcoords, subId, expectedId, cell);
+    if (hit != expectedHit || (hit && std::abs(t - expectedT) > 1e-9))
+    {
+      std::cerr << "Width " << nodeWidth << ": wrong intersection of segment " << i << std::endl;
+      return false;
+    }
+    if ((cellIds->GetValue(i) >= 0) != (hit != 0) ||
+      (hit && std::abs(ts->GetValue(i) - t) > 1e-12))
+    {
+      std::cerr << "Width " << nodeWidth << ": wrong batched intersection of segment " << i
+                << std::endl;
+      return false;
+    }
+
+    locator->IntersectWithLine(p1, p2, 0.0, nullptr, cells, cell);
+    reference->IntersectWithLine(p1, p2, 0.0, nullptr, expectedCells, cell);
+    if (cells->GetNumberOfIds() != expectedCells->GetNumberOfIds())
+    {
+      std::cerr << "Width " << nodeWidth << ": " << cells->GetNumberOfIds() << " instead of "
+                << expectedCells->GetNumberOfIds() << " intersections of segment " << i
+                << std::endl;
+      return false;
+    }
+
+    double closest[3], dist2, expectedDist2;
+    locator->FindClosestPoint(p1, closest, cell, cellId, subId, dist2);
+    reference->FindClosestPoint(p1, closest, cell, expectedId, subId, expectedDist2);
+    if (std::abs(dist2 - expectedDist2) > 1e-12)
+    {
+      std::cerr << "Width " << nodeWidth << ": closest distance " << dist2 << " instead of "
+                << expectedDist2 << std::endl;
+      return false;
+    }
+
+    double bbox[6] = { p1[0], p1[0] + 0.5, p1[1], p1[1] + 0.3, -2.0, 2.0 };
+    locator->FindCellsWithinBounds(bbox, cells);
+    vtkIdType expectedNumber = 0;
+    for (vtkIdType c = 0; c < surface->GetNumberOfCells(); c++)
+    {
+      double bounds[6];
+      surface->GetCellBounds(c, bounds);
+      if (bounds[0] <= bbox[1] && bbox[0] <= bounds[1] && bounds[2] <= bbox[3] &&
+        bbox[2] <= bounds[3])
+      {
+        expectedNumber++;
+      }
+    }
+    if (cells->GetNumberOfIds() != expectedNumber)
+    {
+      std::cerr << "Width " << nodeWidth << ": " << cells->GetNumberOfIds() << " instead of "
+                << expectedNumber << " cells within bounds" << std::endl;
+      return false;
+    }
+  }
+
+  // a shallow copy shares the hierarchy
+  vtkNew<vtkBVHCellLocator> copy;
+  copy->ShallowCopy(locator);
+  vtkNew<vtkIdTypeArray> copyIds;
+  copy->IntersectWithLines(p1s, p2s, 0.0, copyIds, nullptr, nullptr);
+  for (int i = 0; i < numRays; i++)
+  {
+    if (copyIds->GetValue(i) != cellIds->GetValue(i))
+    {
+      std::cerr << "Width " << nodeWidth << ": wrong intersection with the copy" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestBVHCellLocator(int, char*[])
+{
+  vtkNew<vtkPolyData> surface;
+  MakeHeightField(surface);
+
+  bool success = CheckLocator(surface, 4);
+  success &= CheckLocator(surface, 8);
+  return (success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,149 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCellEvaluatePositions.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the batched EvaluatePositions() of the linear 3D cells gives the
+// same results as EvaluatePosition() point by point.
+
+#include "vtkHexahedron.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkTetra.h"
+#include "vtkWedge.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 500;
+
+template <class CellT>
+bool TestCell(CellT* cell, const double (*cellPoints)[3], vtkMinimalStandardRandomSequence* random,
+  const char* name)
+{
+  const int numCellPts = static_cast<int>(cell->GetNumberOfPoints());
+  for (int i = 0; i < numCellPts; ++i)
+  {
+    cell->GetPoints()->SetPoint(i, cellPoints[i]);
+    cell->GetPointIds()->SetId(i, i);
+  }
+  double bounds[6];
+  cell->GetBounds(bounds);
+
+  // points around the cell, a part of them outside
+  std::vector<double> coords[3], pcoordsBuf[3];
+  for (int c = 0; c < 3; ++c)
+  {
+    coords[c].resize(NumberOfPoints);
+    pcoordsBuf[c].resize(NumberOfPoints);
+    const double margin = 0.1 * (bounds[2 * c + 1] - bounds[2 * c]);
+    for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+    {
+      coords[c][i] = random->GetNextRangeValue(bounds[2 * c] - margin, bounds[2 * c + 1] + margin);
+    }
+  }
+  const double* const x[3] = { coords[0].data(), coords[1].data(), coords[2].data() };
+  double* const pcoords[3] = { pcoordsBuf[0].data(), pcoordsBuf[1].data(), pcoordsBuf[2].data() };
+  std::vector<double> weights(numCellPts * NumberOfPoints);
+  std::vector<int> inside(NumberOfPoints);
+  cell->EvaluatePositions(NumberOfPoints, x, pcoords, weights.data(), inside.data());
+
+  int numInside = 0;
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    const double p[3] = { x[0][i], x[1][i], x[2][i] };
+    double closest[3], pc[3], w[8], dist2;
+    int subId;
+    const int expected = cell->EvaluatePosition(p, closest, subId, pc, dist2, w);
+    if (inside[i] != expected)
+    {
+      std::cerr << "Wrong status of point " << i << " in " << name << ": " << inside[i]
+                << " instead of " << expected << std::endl;
+      return false;
+    }
+    numInside += expected == 1;
+    if (expected == -1)
+    {
+      continue;
+    }
+    for (int c = 0; c < 3; ++c)
+    {
+      if (std::abs(pcoords[c][i] - pc[c]) > 1e-10)
+      {
+        std::cerr << "Wrong parametric coordinates of point " << i << " in " << name << std::endl;
+        return false;
+      }
+    }
+    for (int j = 0; j < numCellPts; ++j)
+    {
+      if (std::abs(weights[numCellPts * i + j] - w[j]) > 1e-10)
+      {
+        std::cerr << "Wrong weights of point " << i << " in " << name << std::endl;
+        return false;
+      }
+    }
+  }
+  if (numInside == 0 || numInside == NumberOfPoints)
+  {
+    std::cerr << "Expected points inside and outside of " << name << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestCellEvaluatePositions(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+
+  const double tetraPoints[4][3] = { { 0.1, 0.0, 0.0 }, { 1.2, 0.1, 0.0 }, { 0.2, 0.9, 0.1 },
+    { 0.3, 0.2, 1.1 } };
+  vtkNew<vtkTetra> tetra;
+  bool success = TestCell(tetra.Get(), tetraPoints, random, "a tetrahedron");
+
+  const double hexPoints[8][3] = { { 0.0, 0.0, 0.0 }, { 1.0, 0.1, 0.0 }, { 1.1, 1.0, 0.1 },
+    { 0.0, 0.9, 0.0 }, { 0.1, 0.0, 1.0 }, { 1.0, 0.0, 1.2 }, { 1.0, 1.1, 1.0 },
+    { 0.0, 1.0, 0.9 } };
+  vtkNew<vtkHexahedron> hex;
+  success &= TestCell(hex.Get(), hexPoints, random, "a hexahedron");
+
+  const double wedgePoints[6][3] = { { 0.0, 0.0, 0.0 }, { 1.0, 0.1, 0.0 }, { 0.1, 1.0, 0.0 },
+    { 0.0, 0.1, 1.0 }, { 1.1, 0.0, 1.1 }, { 0.0, 1.0, 0.9 } };
+  vtkNew<vtkWedge> wedge;
+  success &= TestCell(wedge.Get(), wedgePoints, random, "a wedge");
+
+  // a flat tetrahedron
+  const double flatPoints[4][3] = { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 },
+    { 1.0, 1.0, 0.0 } };
+  double pc[3], w[4];
+  int inside;
+  const double p[3] = { 0.2, 0.2, 0.0 };
+  const double* const x[3] = { &p[0], &p[1], &p[2] };
+  double* const pcoords[3] = { &pc[0], &pc[1], &pc[2] };
+  for (int i = 0; i < 4; ++i)
+  {
+    tetra->GetPoints()->SetPoint(i, flatPoints[i]);
+  }
+  tetra->EvaluatePositions(1, x, pcoords, w, &inside);
+  if (inside != -1)
+  {
+    std::cerr << "Expected a flat tetrahedron to fail" << std::endl;
+    success = false;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
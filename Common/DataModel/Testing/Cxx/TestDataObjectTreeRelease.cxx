@@ -0,0 +1,92 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDataObjectTreeRelease.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the blocks shared by composite datasets are released with them,
+// including the blocks referenced back by their locators or links, which only
+// then participate in garbage collection.
+
+#include "vtkCellArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkWeakPointer.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+int TestDataObjectTreeRelease(int, char*[])
+{
+  const unsigned int numBlocks = 1000;
+  std::vector<vtkWeakPointer<vtkPolyData>> blocks;
+  vtkSmartPointer<vtkMultiBlockDataSet> tree = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  tree->SetNumberOfBlocks(numBlocks);
+  for (unsigned int i = 0; i < numBlocks; ++i)
+  {
+    vtkNew<vtkPoints> points;
+    points->InsertNextPoint(0, 0, 0);
+    points->InsertNextPoint(1, 0, 0);
+    points->InsertNextPoint(0, 1, 0);
+    vtkNew<vtkCellArray> polys;
+    polys->InsertNextCell({ 0, 1, 2 });
+    vtkNew<vtkPolyData> block;
+    block->SetPoints(points);
+    block->SetPolys(polys);
+    if (block->UsesGarbageCollector())
+    {
+      std::cerr << "A block without locator nor links uses the garbage collector" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (i % 3 == 1)
+    {
+      block->BuildPointLocator();
+    }
+    else if (i % 3 == 2)
+    {
+      block->BuildLinks();
+    }
+    if ((i % 3 != 0) != block->UsesGarbageCollector())
+    {
+      std::cerr << "Block " << i << " does not use the garbage collector" << std::endl;
+      return EXIT_FAILURE;
+    }
+    tree->SetBlock(i, block);
+    blocks.emplace_back(block.GetPointer());
+  }
+
+  // the blocks are shared by the copy, and released with the last tree
+  vtkSmartPointer<vtkMultiBlockDataSet> copy = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  copy->CompositeShallowCopy(tree);
+  tree = nullptr;
+  for (const auto& block : blocks)
+  {
+    if (!block)
+    {
+      std::cerr << "A block shared by the copy was released" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  copy = nullptr;
+  for (const auto& block : blocks)
+  {
+    if (block)
+    {
+      std::cerr << "A block was not released with the trees" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDataSetMultithreadedAccess.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that after PrepareForMultithreadedAccess() the cell queries of
+// vtkPolyData and vtkUnstructuredGrid give from several threads the same
+// results as from a single thread.
+
+#include "vtkCellArray.h"
+#include "vtkCellType.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+const int Resolution = 20;
+
+vtkIdType PointId(int i, int j, int k)
+{
+  return i + (Resolution + 1) * (j + (Resolution + 1) * k);
+}
+
+void MakePoints(vtkPoints* points, int numZ)
+{
+  for (int k = 0; k < numZ; ++k)
+  {
+    for (int j = 0; j <= Resolution; ++j)
+    {
+      for (int i = 0; i <= Resolution; ++i)
+      {
+        points->InsertNextPoint(i, j, k);
+      }
+    }
+  }
+}
+
+struct ReferenceResults
+{
+  std::vector<vtkIdType> CellSizes;
+  std::vector<vtkIdType> NeighborCounts;
+  std::vector<vtkIdType> FoundCells;
+};
+
+void ComputeQueries(vtkDataSet* ds, vtkGenericCell* cell, vtkIdList* ptIds, vtkIdList* neighbors,
+  vtkIdType cellId, vtkIdType& cellSize, vtkIdType& neighborCount, vtkIdType& foundCell)
+{
+  ds->GetCell(cellId, cell);
+  cellSize = cell->GetNumberOfPoints();
+
+  ptIds->SetNumberOfIds(1);
+  ptIds->SetId(0, cell->GetPointId(0));
+  ds->GetCellNeighbors(cellId, ptIds, neighbors);
+  neighborCount = neighbors->GetNumberOfIds();
+
+  double center[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType i = 0; i < cellSize; ++i)
+  {
+    double p[3];
+    cell->GetPoints()->GetPoint(i, p);
+    center[0] += p[0] / cellSize;
+    center[1] += p[1] / cellSize;
+    center[2] += p[2] / cellSize;
+  }
+  int subId;
+  double pcoords[3], weights[8];
+  foundCell = ds->FindCell(center, nullptr, cell, -1, 1e-6, subId, pcoords, weights);
+}
+
+bool TestDataSet(vtkDataSet* ds, const char* name)
+{
+  const vtkIdType numCells = ds->GetNumberOfCells();
+  ReferenceResults reference;
+  reference.CellSizes.resize(numCells);
+  reference.NeighborCounts.resize(numCells);
+  reference.FoundCells.resize(numCells);
+  {
+    vtkNew<vtkGenericCell> cell;
+    vtkNew<vtkIdList> ptIds;
+    vtkNew<vtkIdList> neighbors;
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      ComputeQueries(ds, cell, ptIds, neighbors, cellId, reference.CellSizes[cellId],
+        reference.NeighborCounts[cellId], reference.FoundCells[cellId]);
+    }
+  }
+
+  ds->PrepareForMultithreadedAccess();
+  const vtkMTimeType mtime = ds->GetMTime();
+
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPThreadLocalObject<vtkIdList> tlNeighbors;
+  std::atomic<vtkIdType> numErrors(0);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = tlCell.Local();
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdList* neighbors = tlNeighbors.Local();
+    double bounds[6];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      vtkIdType cellSize, neighborCount, foundCell;
+      ComputeQueries(ds, cell, ptIds, neighbors, cellId, cellSize, neighborCount, foundCell);
+      ds->GetBounds(bounds);
+      if (cellSize != reference.CellSizes[cellId] ||
+        neighborCount != reference.NeighborCounts[cellId] ||
+        foundCell != reference.FoundCells[cellId] || bounds[1] != Resolution)
+      {
+        ++numErrors;
+      }
+    }
+  });
+
+  bool success = true;
+  if (numErrors > 0)
+  {
+    std::cerr << "Concurrent queries on " << name << " differ from the serial ones for "
+              << numErrors << " cells" << std::endl;
+    success = false;
+  }
+  if (ds->GetMTime() != mtime)
+  {
+    std::cerr << "Concurrent queries modified " << name << std::endl;
+    success = false;
+  }
+  return success;
+}
+}
+
+int TestDataSetMultithreadedAccess(int, char*[])
+{
+  // a grid of quads
+  vtkNew<vtkPoints> polyPoints;
+  MakePoints(polyPoints, 1);
+  vtkNew<vtkCellArray> polys;
+  for (int j = 0; j < Resolution; ++j)
+  {
+    for (int i = 0; i < Resolution; ++i)
+    {
+      const vtkIdType quad[4] = { PointId(i, j, 0), PointId(i + 1, j, 0), PointId(i + 1, j + 1, 0),
+        PointId(i, j + 1, 0) };
+      polys->InsertNextCell(4, quad);
+    }
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(polyPoints);
+  polyData->SetPolys(polys);
+  bool success = TestDataSet(polyData, "a vtkPolyData");
+
+  // a grid of hexahedra
+  vtkNew<vtkPoints> gridPoints;
+  MakePoints(gridPoints, 3);
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(gridPoints);
+  grid->Allocate(2 * Resolution * Resolution);
+  for (int k = 0; k < 2; ++k)
+  {
+    for (int j = 0; j < Resolution; ++j)
+    {
+      for (int i = 0; i < Resolution; ++i)
+      {
+        const vtkIdType hex[8] = { PointId(i, j, k), PointId(i + 1, j, k),
+          PointId(i + 1, j + 1, k), PointId(i, j + 1, k), PointId(i, j, k + 1),
+          PointId(i + 1, j, k + 1), PointId(i + 1, j + 1, k + 1), PointId(i, j + 1, k + 1) };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+      }
+    }
+  }
+  success &= TestDataSet(grid, "a vtkUnstructuredGrid");
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
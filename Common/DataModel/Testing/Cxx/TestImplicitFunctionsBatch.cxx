@@ -0,0 +1,135 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestImplicitFunctionsBatch.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the evaluation of implicit functions on arrays of points gives
+// the same values as their evaluation point by point.
+
+#include "vtkBox.h"
+#include "vtkCylinder.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImplicitBoolean.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkSphere.h"
+#include "vtkTransform.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 1000;
+
+bool Compare(vtkImplicitFunction* function, vtkDataArray* points, vtkDataArray* values,
+  double tolerance, const char* name)
+{
+  function->FunctionValue(points, values);
+  if (values->GetNumberOfTuples() != NumberOfPoints || values->GetNumberOfComponents() != 1)
+  {
+    std::cerr << "Wrong size of the values of " << name << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    double x[3];
+    points->GetTuple(i, x);
+    const double expected = function->FunctionValue(x);
+    if (std::abs(values->GetTuple1(i) - expected) > tolerance * (1.0 + std::abs(expected)))
+    {
+      std::cerr << "Wrong value of " << name << " for point " << i << ": "
+                << values->GetTuple1(i) << " instead of " << expected << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestFunctions(vtkDataArray* points, vtkDataArray* values, double tolerance)
+{
+  vtkNew<vtkSphere> sphere;
+  sphere->SetCenter(0.1, 0.2, -0.3);
+  sphere->SetRadius(0.5);
+  vtkNew<vtkBox> box;
+  box->SetBounds(-0.4, 0.3, -0.2, 0.6, -0.5, 0.1);
+  vtkNew<vtkCylinder> cylinder;
+  cylinder->SetCenter(0.2, -0.1, 0.0);
+  cylinder->SetAxis(1.0, 1.0, 0.0);
+  cylinder->SetRadius(0.3);
+  vtkNew<vtkPlane> plane;
+  plane->SetNormal(0.0, 0.0, 1.0);
+
+  bool success = Compare(sphere, points, values, tolerance, "a sphere");
+  success &= Compare(box, points, values, tolerance, "a box");
+  success &= Compare(cylinder, points, values, tolerance, "a cylinder");
+
+  vtkNew<vtkImplicitBoolean> boolean;
+  vtkNew<vtkImplicitBoolean> nested;
+  nested->AddFunction(box);
+  nested->AddFunction(plane);
+  nested->SetOperationTypeToIntersection();
+  boolean->AddFunction(sphere);
+  boolean->AddFunction(cylinder);
+  boolean->AddFunction(nested);
+  const char* names[] = { "a union", "an intersection", "a difference", "a union of magnitudes" };
+  for (int operation = vtkImplicitBoolean::VTK_UNION;
+       operation <= vtkImplicitBoolean::VTK_UNION_OF_MAGNITUDES; ++operation)
+  {
+    boolean->SetOperationType(operation);
+    success &= Compare(boolean, points, values, tolerance, names[operation]);
+  }
+
+  vtkNew<vtkTransform> transform;
+  transform->RotateZ(30.0);
+  transform->Scale(1.0, 2.0, 0.5);
+  transform->Translate(0.1, 0.0, 0.2);
+  sphere->SetTransform(transform);
+  success &= Compare(sphere, points, values, tolerance, "a transformed sphere");
+  success &= Compare(boolean, points, values, tolerance, "a boolean with a transformed sphere");
+
+  vtkNew<vtkImplicitBoolean> empty;
+  success &= Compare(empty, points, values, tolerance, "an empty boolean");
+  return success;
+}
+}
+
+int TestImplicitFunctionsBatch(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkDoubleArray> doublePoints;
+  doublePoints->SetNumberOfComponents(3);
+  doublePoints->SetNumberOfTuples(NumberOfPoints);
+  vtkNew<vtkFloatArray> floatPoints;
+  floatPoints->SetNumberOfComponents(3);
+  floatPoints->SetNumberOfTuples(NumberOfPoints);
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    for (int c = 0; c < 3; ++c)
+    {
+      const double value = random->GetNextRangeValue(-1.0, 1.0);
+      doublePoints->SetComponent(i, c, value);
+      floatPoints->SetComponent(i, c, value);
+    }
+  }
+
+  vtkNew<vtkDoubleArray> doubleValues;
+  vtkNew<vtkFloatArray> floatValues;
+  bool success = TestFunctions(doublePoints, doubleValues, 1e-12);
+  success &= TestFunctions(floatPoints, floatValues, 1e-5);
+  success &= TestFunctions(doublePoints, floatValues, 1e-5);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
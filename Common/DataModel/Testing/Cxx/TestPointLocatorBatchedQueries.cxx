@@ -0,0 +1,158 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPointLocatorBatchedQueries.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the batched queries of the point locators return the same ids
+// as the single queries, in the same order, for every query point.
+
+#include "vtkAbstractPointLocator.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkKdTreePointLocator.h"
+#include "vtkNew.h"
+#include "vtkOctreePointLocator.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticPointLocator.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+bool CompareRow(const char* name, vtkIdType q, vtkIdList* expected, vtkIdTypeArray* offsets,
+  vtkIdTypeArray* ids)
+{
+  vtkIdType begin = offsets->GetValue(q);
+  vtkIdType numIds = offsets->GetValue(q + 1) - begin;
+  if (numIds != expected->GetNumberOfIds())
+  {
+    std::cerr << name << ": " << numIds << " ids instead of " << expected->GetNumberOfIds()
+              << " for query " << q << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < numIds; i++)
+  {
+    if (ids->GetValue(begin + i) != expected->GetId(i))
+    {
+      std::cerr << name << ": wrong id for query " << q << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CheckLocator(vtkAbstractPointLocator* locator, vtkPolyData* data, vtkPoints* queries)
+{
+  const char* name = locator->GetClassName();
+  locator->SetDataSet(data);
+  locator->BuildLocator();
+
+  vtkNew<vtkIdTypeArray> closest;
+  vtkNew<vtkIdTypeArray> nOffsets;
+  vtkNew<vtkIdTypeArray> nIds;
+  vtkNew<vtkIdTypeArray> rOffsets;
+  vtkNew<vtkIdTypeArray> rIds;
+  locator->FindClosestPoints(queries, closest);
+  locator->FindClosestNPoints(5, queries, nOffsets, nIds);
+  locator->FindPointsWithinRadius(0.1, queries, rOffsets, rIds);
+
+  vtkIdType numQueries = queries->GetNumberOfPoints();
+  if (closest->GetNumberOfValues() != numQueries ||
+    nOffsets->GetNumberOfValues() != numQueries + 1 ||
+    rOffsets->GetNumberOfValues() != numQueries + 1)
+  {
+    std::cerr << name << ": wrong number of results" << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkIdList> expected;
+  double x[3];
+  for (vtkIdType q = 0; q < numQueries; q++)
+  {
+    queries->GetPoint(q, x);
+    if (closest->GetValue(q) != locator->FindClosestPoint(x))
+    {
+      std::cerr << name << ": wrong closest point for query " << q << std::endl;
+      return false;
+    }
+    locator->FindClosestNPoints(5, x, expected);
+    if (!CompareRow(name, q, expected, nOffsets, nIds))
+    {
+      return false;
+    }
+    locator->FindPointsWithinRadius(0.1, x, expected);
+    if (!CompareRow(name, q, expected, rOffsets, rIds))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPointLocatorBatchedQueries(int, char*[])
+{
+  unsigned int state = 1234;
+  auto random = [&state]() {
+    state = state * 1103515245u + 12345u;
+    return ((state >> 8) & 0xffff) / 65535.0;
+  };
+
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i < 5000; i++)
+  {
+    points->InsertNextPoint(random(), random(), 0.5 * random());
+  }
+  vtkNew<vtkPolyData> data;
+  data->SetPoints(points);
+
+  // the queries extend past the points, and include some of the points
+  vtkNew<vtkPoints> queries;
+  for (int i = 0; i < 2000; i++)
+  {
+    if (i % 10 == 0)
+    {
+      queries->InsertNextPoint(points->GetPoint(i));
+    }
+    else
+    {
+      queries->InsertNextPoint(1.4 * random() - 0.2, 1.4 * random() - 0.2, random() - 0.25);
+    }
+  }
+
+  vtkNew<vtkStaticPointLocator> staticLocator;
+  vtkNew<vtkKdTreePointLocator> kdTreeLocator;
+  vtkNew<vtkOctreePointLocator> octreeLocator;
+  vtkAbstractPointLocator* locators[3] = { staticLocator, kdTreeLocator, octreeLocator };
+
+  bool success = true;
+  for (vtkAbstractPointLocator* locator : locators)
+  {
+    success &= CheckLocator(locator, data, queries);
+  }
+
+  // an empty set of queries gives a single offset
+  vtkNew<vtkPoints> noQueries;
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> ids;
+  staticLocator->FindPointsWithinRadius(0.1, noQueries, offsets, ids);
+  if (offsets->GetNumberOfValues() != 1 || offsets->GetValue(0) != 0 ||
+    ids->GetNumberOfValues() != 0)
+  {
+    std::cerr << "Wrong results for an empty set of queries" << std::endl;
+    success = false;
+  }
+
+  return (success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -12,6 +12,8 @@
      PURPOSE.  See the above copyright notice for more information.
 
 =========================================================================*/
+#include "vtkCellArray.h"
+#include "vtkCellLinks.h"
 #include "vtkExtractGeometry.h"
 #include "vtkImageData.h"
 #include "vtkPolyData.h"
@@ -195,5 +197,65 @@ int TestStaticCellLinks(int, char*[])
     return EXIT_FAILURE;
   }
 
+  //----------------------------------------------------------------------------
+  // Polydata mixing verts, lines and polys: the serial and threaded builds
+  // must list the same cells, in increasing order, as vtkCellLinks.
+  vtkNew<vtkPolyData> mixed;
+  mixed->DeepCopy(pdata);
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkCellArray> lines;
+  for (vtkIdType ptId = 0; ptId < mixed->GetNumberOfPoints(); ptId += 3)
+  {
+    verts->InsertNextCell(1, &ptId);
+    const vtkIdType line[2] = { ptId, (ptId + 7) % mixed->GetNumberOfPoints() };
+    lines->InsertNextCell(2, line);
+  }
+  mixed->SetVerts(verts);
+  mixed->SetLines(lines);
+
+  vtkNew<vtkCellLinks> dynamicLinks;
+  dynamicLinks->SetDataSet(mixed);
+  dynamicLinks->BuildLinks();
+  vtkStaticCellLinksTemplate<vtkIdType> serialLinks;
+  serialLinks.SetSequentialProcessing(true);
+  serialLinks.BuildLinks(mixed.Get());
+  vtkStaticCellLinksTemplate<vtkIdType> threadedLinks;
+  threadedLinks.BuildLinks(mixed.Get());
+
+  for (vtkIdType ptId = 0; ptId < mixed->GetNumberOfPoints(); ++ptId)
+  {
+    const vtkIdType ncells = dynamicLinks->GetNcells(ptId);
+    const vtkIdType* dynamicCells = dynamicLinks->GetCells(ptId);
+    if (serialLinks.GetNcells(ptId) != ncells || threadedLinks.GetNcells(ptId) != ncells)
+    {
+      cout << "Wrong number of cells for point " << ptId << "\n";
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType i = 0; i < ncells; ++i)
+    {
+      if (serialLinks.GetCells(ptId)[i] != dynamicCells[i] ||
+        threadedLinks.GetCells(ptId)[i] != dynamicCells[i])
+      {
+        cout << "Wrong cells for point " << ptId << "\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // vtkPolyData uses static links unless it is editable
+  mixed->BuildLinks();
+  if (!vtkStaticCellLinks::SafeDownCast(mixed->GetLinks()))
+  {
+    cout << "Expected vtkPolyData to build static links\n";
+    return EXIT_FAILURE;
+  }
+  mixed->EditableOn();
+  mixed->BuildLinks();
+  if (!vtkCellLinks::SafeDownCast(mixed->GetLinks()))
+  {
+    cout << "Expected an editable vtkPolyData to build vtkCellLinks\n";
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
@@ -24,6 +24,8 @@
 #include "vtkPointData.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <string>
+
 namespace
 {
 constexpr vtkIdType NUMBER_OF_VALS = 20;
@@ -169,6 +171,82 @@ bool TestGhostAwareRange()
 
   return retVal;
 }
+
+//------------------------------------------------------------------------------
+bool CheckArray(vtkFieldData* fd, const std::string& name, int expectedIndex)
+{
+  int index;
+  vtkAbstractArray* array = fd->GetAbstractArray(name.c_str(), index);
+  if (index != expectedIndex ||
+    (array && (array != fd->GetAbstractArray(index) || name != array->GetName())))
+  {
+    vtkLog(ERROR, "Array " << name << " found at " << index << " instead of " << expectedIndex);
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestArrayLookupByName()
+{
+  bool retVal = true;
+
+  vtkNew<vtkFieldData> fd;
+  const int numberOfArrays = 100;
+  for (int i = 0; i < numberOfArrays; ++i)
+  {
+    vtkNew<vtkDoubleArray> array;
+    array->SetName(("Array" + std::to_string(i)).c_str());
+    fd->AddArray(array);
+  }
+  for (int i = 0; i < numberOfArrays; ++i)
+  {
+    retVal &= CheckArray(fd, "Array" + std::to_string(i), i);
+  }
+  retVal &= CheckArray(fd, "Missing", -1);
+
+  // rename arrays after they were added
+  fd->GetAbstractArray(10)->SetName("Renamed");
+  retVal &= CheckArray(fd, "Renamed", 10);
+  retVal &= CheckArray(fd, "Array10", -1);
+  fd->GetAbstractArray(20)->SetName("Array10");
+  retVal &= CheckArray(fd, "Array10", 20);
+  retVal &= CheckArray(fd, "Array20", -1);
+
+  // an array with the same name replaces the previous one
+  vtkNew<vtkFloatArray> replacement;
+  replacement->SetName("Array30");
+  if (fd->AddArray(replacement) != 30 || fd->GetAbstractArray("Array30") != replacement ||
+    fd->GetNumberOfArrays() != numberOfArrays)
+  {
+    vtkLog(ERROR, "Array with the same name was not replaced.");
+    retVal = false;
+  }
+
+  // the following arrays are shifted when removing one
+  fd->RemoveArray("Array5");
+  retVal &= CheckArray(fd, "Array5", -1);
+  retVal &= CheckArray(fd, "Array4", 4);
+  retVal &= CheckArray(fd, "Array6", 5);
+  retVal &= CheckArray(fd, "Array99", numberOfArrays - 2);
+
+  // unnamed arrays are not found, but do not prevent finding the others
+  vtkNew<vtkDoubleArray> unnamed;
+  fd->AddArray(unnamed);
+  vtkNew<vtkDoubleArray> last;
+  last->SetName("Last");
+  fd->AddArray(last);
+  retVal &= CheckArray(fd, "Last", numberOfArrays);
+
+  vtkNew<vtkFieldData> copy;
+  copy->ShallowCopy(fd);
+  retVal &= CheckArray(copy, "Array99", numberOfArrays - 2);
+  retVal &= CheckArray(copy, "Renamed", 9);
+  copy->Initialize();
+  retVal &= CheckArray(copy, "Array99", -1);
+
+  return retVal;
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -230,6 +308,12 @@ int otherFieldData(int, char*[])
     retVal = EXIT_FAILURE;
   }
 
+  vtkLog(INFO, "Testing Array Lookup By Name...");
+  if (!TestArrayLookupByName())
+  {
+    retVal = EXIT_FAILURE;
+  }
+
   /* Obsolete API.
   double tuple[10];
   // initialize tuple before using it to set something
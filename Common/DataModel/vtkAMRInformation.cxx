@@ -21,7 +21,9 @@
 #include "vtkObjectFactory.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnsignedIntArray.h"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <set>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -118,8 +120,37 @@ public:
 
 //------------------------------------------------------------------------------
 
+// Grids of each level, binned in a uniform grid over the level.
+struct vtkAMRInformation::BlockLocator
+{
+  struct Level
+  {
+    double Min[3] = { 0.0, 0.0, 0.0 };
+    double Max[3] = { 0.0, 0.0, 0.0 };
+    double BinWidth[3] = { 0.0, 0.0, 0.0 };
+    int NumberOfBins[3] = { 0, 0, 0 };
+    // grid ids of bin b are Ids[Offsets[b]] to Ids[Offsets[b + 1] - 1], in increasing order
+    std::vector<vtkIdType> Offsets;
+    std::vector<unsigned int> Ids;
+
+    int GetBin(int axis, double x) const
+    {
+      if (this->BinWidth[axis] <= 0.0)
+      {
+        return 0;
+      }
+      int bin = static_cast<int>(std::floor((x - this->Min[axis]) / this->BinWidth[axis]));
+      return std::min(std::max(bin, 0), this->NumberOfBins[axis] - 1);
+    }
+  };
+  std::vector<Level> Levels;
+};
+
+//------------------------------------------------------------------------------
+
 vtkAMRInformation::vtkAMRInformation()
   : NumBlocks(1, 0)
+  , HasBlockLocator(false)
 {
   this->Refinement = vtkSmartPointer<vtkIntArray>::New();
   this->SourceIndex = nullptr;
@@ -313,6 +344,7 @@ unsigned int vtkAMRInformation::GetNumberOfDataSets(unsigned int level) const
 
 void vtkAMRInformation::AllocateBoxes(unsigned int n)
 {
+  this->ResetBlockLocator();
   this->Boxes.clear();
   for (unsigned int i = 0; i < n; i++)
   {
@@ -330,6 +362,7 @@ void vtkAMRInformation::SetAMRBox(unsigned int level, unsigned int id, const vtk
 {
   unsigned int index = this->GetIndex(level, id);
   this->Boxes[index] = box;
+  this->ResetBlockLocator();
   if (this->HasSpacing(level)) // has valid spacing
   {
     this->UpdateBounds(level, id);
@@ -385,6 +418,7 @@ void vtkAMRInformation::SetOrigin(const double* origin)
   {
     this->Origin[d] = origin[d];
   }
+  this->ResetBlockLocator();
 }
 
 int vtkAMRInformation::GetRefinementRatio(unsigned int level) const
@@ -585,6 +619,7 @@ void vtkAMRInformation::SetSpacing(unsigned int level, const double* h)
     }
   }
   this->Spacing->SetTuple(level, h);
+  this->ResetBlockLocator();
 }
 
 void vtkAMRInformation::GenerateBlockLevel()
@@ -614,7 +649,9 @@ void vtkAMRInformation::GenerateBlockLevel()
 void vtkAMRInformation::GetBounds(unsigned int level, unsigned int id, double* bb)
 {
   const vtkAMRBox& box = this->Boxes[this->GetIndex(level, id)];
-  vtkAMRBox::GetBounds(box, this->Origin, this->Spacing->GetTuple(level), bb);
+  double h[3];
+  this->Spacing->GetTypedTuple(level, h);
+  vtkAMRBox::GetBounds(box, this->Origin, h, bb);
 }
 
 const vtkAMRBox& vtkAMRInformation::GetAMRBox(unsigned int level, unsigned int id) const
@@ -873,7 +910,9 @@ bool vtkAMRInformation::operator==(const vtkAMRInformation& other)
 bool vtkAMRInformation::GetOrigin(unsigned int level, unsigned int id, double* origin)
 {
   const vtkAMRBox& box = this->Boxes[this->GetIndex(level, id)];
-  vtkAMRBox::GetBoxOrigin(box, this->Origin, this->Spacing->GetTuple(level), origin);
+  double h[3];
+  this->Spacing->GetTypedTuple(level, h);
+  vtkAMRBox::GetBoxOrigin(box, this->Origin, h, origin);
   return true;
 }
 
@@ -897,6 +936,7 @@ void vtkAMRInformation::UpdateBounds(int level, int id)
 
 void vtkAMRInformation::DeepCopy(vtkAMRInformation* other)
 {
+  this->ResetBlockLocator();
   this->GridDescription = other->GridDescription;
   memcpy(this->Origin, other->Origin, sizeof(double) * 3);
   this->Boxes = other->Boxes;
@@ -977,17 +1017,173 @@ bool vtkAMRInformation::FindGrid(double q[3], unsigned int& level, unsigned int&
 
 bool vtkAMRInformation::FindGrid(double q[3], int level, unsigned int& gridId)
 {
-  for (unsigned int i = 0; i < this->GetNumberOfDataSets(level); i++)
+  if (level < 0 || level >= static_cast<int>(this->GetNumberOfLevels()))
+  {
+    return false;
+  }
+  const BlockLocator::Level& bins = this->GetBlockLocator().Levels[level];
+  if (bins.Ids.empty())
+  {
+    return false;
+  }
+  int bin[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    if (q[i] < bins.Min[i] || q[i] > bins.Max[i])
+    {
+      return false;
+    }
+    bin[i] = bins.GetBin(i, q[i]);
+  }
+  vtkIdType binId = bin[0] + bins.NumberOfBins[0] * (bin[1] + bins.NumberOfBins[1] * bin[2]);
+  for (vtkIdType i = bins.Offsets[binId]; i < bins.Offsets[binId + 1]; ++i)
   {
     double gbounds[6];
-    this->GetBounds(level, i, gbounds);
-    bool inside = Inside(q, gbounds);
-    if (inside)
+    this->GetBounds(level, bins.Ids[i], gbounds);
+    if (Inside(q, gbounds))
     {
-      gridId = i;
+      gridId = bins.Ids[i];
       return true;
     }
   }
   return false;
 }
+
+//------------------------------------------------------------------------------
+const vtkAMRInformation::BlockLocator& vtkAMRInformation::GetBlockLocator()
+{
+  if (this->HasBlockLocator.load(std::memory_order_acquire))
+  {
+    return *this->Locator;
+  }
+  std::lock_guard<std::mutex> lock(this->BlockLocatorMutex);
+  if (this->HasBlockLocator.load(std::memory_order_relaxed))
+  {
+    return *this->Locator;
+  }
+
+  // As in CalculateParentChildRelationShip(), the bins are about the average
+  // size of the grids, so that each grid overlaps a few bins.
+  auto locator = std::unique_ptr<BlockLocator>(new BlockLocator);
+  unsigned int numLevels = this->GetNumberOfLevels();
+  locator->Levels.resize(numLevels);
+  for (unsigned int level = 0; level < numLevels; ++level)
+  {
+    BlockLocator::Level& bins = locator->Levels[level];
+    unsigned int numDataSets = this->GetNumberOfDataSets(level);
+    std::vector<unsigned int> ids;
+    std::vector<double> bounds;
+    double totalWidth[3] = { 0.0, 0.0, 0.0 };
+    vtkBoundingBox levelBounds;
+    for (unsigned int id = 0; id < numDataSets; ++id)
+    {
+      if (this->GetAMRBox(level, id).IsInvalid())
+      {
+        continue;
+      }
+      double bb[6];
+      this->GetBounds(level, id, bb);
+      ids.push_back(id);
+      bounds.insert(bounds.end(), bb, bb + 6);
+      levelBounds.AddBounds(bb);
+      for (int i = 0; i < 3; ++i)
+      {
+        totalWidth[i] += bb[2 * i + 1] - bb[2 * i];
+      }
+    }
+    if (ids.empty())
+    {
+      continue;
+    }
+
+    levelBounds.GetMinPoint(bins.Min);
+    levelBounds.GetMaxPoint(bins.Max);
+    vtkIdType numBins = 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      double width = totalWidth[i] / ids.size();
+      double length = bins.Max[i] - bins.Min[i];
+      bins.NumberOfBins[i] = width > 0.0 && length > 0.0
+        ? static_cast<int>(std::min(length / width, static_cast<double>(ids.size()))) + 1
+        : 1;
+      numBins *= bins.NumberOfBins[i];
+    }
+    // Irregular levels could lead to many more bins than grids, limit them.
+    while (numBins > 8 * static_cast<vtkIdType>(ids.size()))
+    {
+      int* largest = std::max_element(bins.NumberOfBins, bins.NumberOfBins + 3);
+      numBins = numBins / *largest * ((*largest + 1) / 2);
+      *largest = (*largest + 1) / 2;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      bins.BinWidth[i] = (bins.Max[i] - bins.Min[i]) / bins.NumberOfBins[i];
+    }
+
+    // Add each grid to the bins overlapping its bounds, counting them first.
+    bins.Offsets.assign(numBins + 1, 0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      for (size_t k = 0; k < ids.size(); ++k)
+      {
+        const double* bb = &bounds[6 * k];
+        int lo[3], hi[3];
+        for (int i = 0; i < 3; ++i)
+        {
+          lo[i] = bins.GetBin(i, bb[2 * i]);
+          hi[i] = bins.GetBin(i, bb[2 * i + 1]);
+        }
+        for (int z = lo[2]; z <= hi[2]; ++z)
+        {
+          for (int y = lo[1]; y <= hi[1]; ++y)
+          {
+            for (int x = lo[0]; x <= hi[0]; ++x)
+            {
+              vtkIdType binId = x + bins.NumberOfBins[0] * (y + bins.NumberOfBins[1] * z);
+              if (pass == 0)
+              {
+                ++bins.Offsets[binId + 1];
+              }
+              else
+              {
+                bins.Ids[bins.Offsets[binId]++] = ids[k];
+              }
+            }
+          }
+        }
+      }
+      if (pass == 0)
+      {
+        // prefix sum of the counts, Offsets[b] is then the first slot of bin b
+        for (vtkIdType b = 0; b < numBins; ++b)
+        {
+          bins.Offsets[b + 1] += bins.Offsets[b];
+        }
+        bins.Ids.resize(bins.Offsets[numBins]);
+      }
+      else
+      {
+        // filling the bins advanced Offsets[b] to the first slot of bin b + 1
+        for (vtkIdType b = numBins; b > 0; --b)
+        {
+          bins.Offsets[b] = bins.Offsets[b - 1];
+        }
+        bins.Offsets[0] = 0;
+      }
+    }
+  }
+  this->Locator = std::move(locator);
+  this->HasBlockLocator.store(true, std::memory_order_release);
+  return *this->Locator;
+}
+
+//------------------------------------------------------------------------------
+void vtkAMRInformation::ResetBlockLocator()
+{
+  if (this->HasBlockLocator)
+  {
+    this->HasBlockLocator = false;
+    this->Locator.reset();
+  }
+}
 VTK_ABI_NAMESPACE_END
@@ -24,6 +24,9 @@
  * - The file block index for each block
  * - parent child information, if requested
  *
+ * FindGrid() and FindCell() may be called concurrently from several threads
+ * once the meta information is set.
+ *
  * @sa
  * vtkOverlappingAMR, vtkAMRBox
  */
@@ -35,6 +38,9 @@
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkObject.h"
 #include "vtkSmartPointer.h" //for ivars
+#include <atomic>            //for the block locator
+#include <memory>            //for the block locator
+#include <mutex>             //for the block locator
 #include <vector>            //for storing AMR Boxes
 
 typedef std::vector<vtkAMRBox> vtkAMRBoxList;
@@ -229,7 +235,10 @@ public:
   bool FindCell(double q[3], unsigned int level, unsigned int index, int& cellIdx);
 
   /**
-   * find the grid that contains the point q at the specified level
+   * find the grid that contains the point q at the specified level.
+   * The grids are binned on the first call, so that each search only tests
+   * the few grids close to q. If several grids contain q, the one with the
+   * lowest index is returned.
    */
   bool FindGrid(double q[3], int level, unsigned int& gridId);
 
@@ -264,6 +273,9 @@ private:
   void CalculateParentChildRelationShip(unsigned int level,
     std::vector<std::vector<unsigned int>>& children,
     std::vector<std::vector<unsigned int>>& parents);
+  struct BlockLocator;
+  const BlockLocator& GetBlockLocator();
+  void ResetBlockLocator();
 
   //-------------------------------------------------------------------------
   // Essential information that determines an AMR structure. Must be copied
@@ -289,6 +301,11 @@ private:
   // parent child information
   std::vector<std::vector<std::vector<unsigned int>>> AllChildren;
   std::vector<std::vector<std::vector<unsigned int>>> AllParents;
+
+  // uniform bins of the grids of each level, built on demand by FindGrid()
+  std::unique_ptr<BlockLocator> Locator;
+  std::atomic<bool> HasBlockLocator;
+  std::mutex BlockLocatorMutex;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -16,9 +16,196 @@
 
 #include "vtkDataSet.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
 
-//------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Order the queries along the bins of a coarse grid over their bounds, with
+// about eight queries per bin, so that consecutive queries visit the same
+// parts of the locator. Ties are broken by query id, so the order does not
+// depend on the sort.
+std::vector<vtkIdType> OrderQueries(vtkPoints* queries)
+{
+  const vtkIdType numQueries = queries->GetNumberOfPoints();
+  double bounds[6];
+  queries->GetBounds(bounds);
+  const int divs = std::max(1, static_cast<int>(std::cbrt(numQueries / 8.0)));
+  double scale[3];
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double length = bounds[2 * axis + 1] - bounds[2 * axis];
+    scale[axis] = (length > 0.0 ? divs / length : 0.0);
+  }
+
+  std::vector<std::pair<vtkIdType, vtkIdType>> keys(numQueries);
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    for (vtkIdType q = begin; q < end; ++q)
+    {
+      queries->GetPoint(q, x);
+      vtkIdType key = 0;
+      for (int axis = 2; axis >= 0; --axis)
+      {
+        int bin = static_cast<int>((x[axis] - bounds[2 * axis]) * scale[axis]);
+        key = key * divs + std::min(std::max(bin, 0), divs - 1);
+      }
+      keys[q] = std::make_pair(key, q);
+    }
+  });
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  std::vector<vtkIdType> order(numQueries);
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    order[i] = keys[i].second;
+  }
+  return order;
+}
+
+// Run the queries that return a list of ids in parallel. Each thread appends
+// the ids of its queries to its own buffer, and records the ranges of
+// ordered queries that it processed. The counts are gathered into offsets,
+// then the buffers are copied into place.
+template <typename TQuery>
+struct BatchedQuery
+{
+  struct Range
+  {
+    vtkIdType Begin;
+    vtkIdType End;
+    size_t Start;
+  };
+
+  struct LocalData
+  {
+    vtkSmartPointer<vtkIdList> Ids;
+    std::vector<vtkIdType> Buffer;
+    std::vector<Range> Ranges;
+  };
+
+  TQuery Query;
+  vtkPoints* Queries;
+  const vtkIdType* Order;
+  vtkIdType* Counts;
+  vtkSMPThreadLocal<LocalData> Local;
+
+  BatchedQuery(TQuery query, vtkPoints* queries, const vtkIdType* order, vtkIdType* counts)
+    : Query(query)
+    , Queries(queries)
+    , Order(order)
+    , Counts(counts)
+  {
+  }
+
+  void Initialize()
+  {
+    LocalData& local = this->Local.Local();
+    local.Ids = vtkSmartPointer<vtkIdList>::New();
+    local.Ids->Allocate(128);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    LocalData& local = this->Local.Local();
+    local.Ranges.push_back(Range{ begin, end, local.Buffer.size() });
+    double x[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType q = this->Order[i];
+      this->Queries->GetPoint(q, x);
+      this->Query(x, local.Ids);
+      const vtkIdType numIds = local.Ids->GetNumberOfIds();
+      const vtkIdType* ids = local.Ids->GetPointer(0);
+      local.Buffer.insert(local.Buffer.end(), ids, ids + numIds);
+      this->Counts[q] = numIds;
+    }
+  }
+
+  void Reduce() {}
+
+  // Copy the ids found by each thread to their place in the output.
+  void Gather(const vtkIdType* offsets, vtkIdType* output)
+  {
+    std::vector<std::pair<const LocalData*, const Range*>> ranges;
+    for (const LocalData& local : this->Local)
+    {
+      for (const Range& range : local.Ranges)
+      {
+        ranges.emplace_back(&local, &range);
+      }
+    }
+    vtkSMPTools::For(0, static_cast<vtkIdType>(ranges.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType r = begin; r < end; ++r)
+      {
+        const vtkIdType* buffer = ranges[r].first->Buffer.data() + ranges[r].second->Start;
+        for (vtkIdType i = ranges[r].second->Begin; i < ranges[r].second->End; ++i)
+        {
+          const vtkIdType q = this->Order[i];
+          const vtkIdType numIds = offsets[q + 1] - offsets[q];
+          std::copy(buffer, buffer + numIds, output + offsets[q]);
+          buffer += numIds;
+        }
+      }
+    });
+  }
+};
+
+template <typename TQuery>
+void ExecuteBatchedQuery(
+  TQuery query, vtkPoints* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  const vtkIdType numQueries = queries->GetNumberOfPoints();
+  offsets->SetNumberOfComponents(1);
+  offsets->SetNumberOfTuples(numQueries + 1);
+  vtkIdType* offsetPtr = offsets->GetPointer(0);
+  ids->SetNumberOfComponents(1);
+
+  // the counts are stored one past each query, then summed into offsets
+  std::vector<vtkIdType> order = OrderQueries(queries);
+  BatchedQuery<TQuery> batch(query, queries, order.data(), offsetPtr + 1);
+  vtkSMPTools::For(0, numQueries, batch);
+
+  offsetPtr[0] = 0;
+  for (vtkIdType q = 0; q < numQueries; ++q)
+  {
+    offsetPtr[q + 1] += offsetPtr[q];
+  }
+  ids->SetNumberOfTuples(offsetPtr[numQueries]);
+  batch.Gather(offsetPtr, ids->GetPointer(0));
+}
+
+struct ClosestNQuery
+{
+  vtkAbstractPointLocator* Locator;
+  int N;
+  void operator()(const double x[3], vtkIdList* result)
+  {
+    this->Locator->FindClosestNPoints(this->N, x, result);
+  }
+};
+
+struct RadiusQuery
+{
+  vtkAbstractPointLocator* Locator;
+  double R;
+  void operator()(const double x[3], vtkIdList* result)
+  {
+    this->Locator->FindPointsWithinRadius(this->R, x, result);
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
 vtkAbstractPointLocator::vtkAbstractPointLocator()
 {
   for (int i = 0; i < 6; i++)
@@ -65,6 +252,58 @@ void vtkAbstractPointLocator::FindPointsWithinRadius(
   this->FindPointsWithinRadius(R, p, result);
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindClosestPoints(vtkPoints* queries, vtkIdTypeArray* result)
+{
+  if (!queries || !result)
+  {
+    vtkErrorMacro("Query points and result array are required");
+    return;
+  }
+  this->BuildLocator();
+
+  const vtkIdType numQueries = queries->GetNumberOfPoints();
+  result->SetNumberOfComponents(1);
+  result->SetNumberOfTuples(numQueries);
+  vtkIdType* resultPtr = result->GetPointer(0);
+  std::vector<vtkIdType> order = OrderQueries(queries);
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType q = order[i];
+      queries->GetPoint(q, x);
+      resultPtr[q] = this->FindClosestPoint(x);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindClosestNPoints(
+  int N, vtkPoints* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  if (!queries || !offsets || !ids)
+  {
+    vtkErrorMacro("Query points, offsets and ids arrays are required");
+    return;
+  }
+  this->BuildLocator();
+  ExecuteBatchedQuery(ClosestNQuery{ this, N }, queries, offsets, ids);
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindPointsWithinRadius(
+  double R, vtkPoints* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  if (!queries || !offsets || !ids)
+  {
+    vtkErrorMacro("Query points, offsets and ids arrays are required");
+    return;
+  }
+  this->BuildLocator();
+  ExecuteBatchedQuery(RadiusQuery{ this, R }, queries, offsets, ids);
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractPointLocator::GetBounds(double* bnds)
 {
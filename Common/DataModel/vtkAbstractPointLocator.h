@@ -35,6 +35,8 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkIdList;
+class vtkIdTypeArray;
+class vtkPoints;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkAbstractPointLocator : public vtkLocator
 {
@@ -90,6 +92,26 @@ public:
   void FindPointsWithinRadius(double R, double x, double y, double z, vtkIdList* result);
   ///@}
 
+  ///@{
+  /**
+   * Batched versions of the queries above, for many query points at once.
+   * The locator is built first if needed, then the queries are processed in
+   * parallel with vtkSMPTools. The queries are ordered by the bins of a
+   * coarse grid over their bounds, so that nearby queries are processed
+   * together. FindClosestPoints() returns the id of the closest point of
+   * each query. The other methods return their results in compressed rows:
+   * the ids found for query i are ids[offsets[i]] to ids[offsets[i+1]-1],
+   * in the order of the single query methods, and offsets has one more
+   * value than there are queries. The subclasses only need thread safe
+   * single query methods to support these methods.
+   */
+  virtual void FindClosestPoints(vtkPoints* queries, vtkIdTypeArray* result);
+  virtual void FindClosestNPoints(
+    int N, vtkPoints* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids);
+  virtual void FindPointsWithinRadius(
+    double R, vtkPoints* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids);
+  ///@}
+
   ///@{
   /**
    * Provide an accessor to the bounds. Valid after the locator is built.
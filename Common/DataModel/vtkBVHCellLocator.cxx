@@ -0,0 +1,1421 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBVHCellLocator.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkBVHCellLocator.h"
+
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBVHCellLocator);
+
+//------------------------------------------------------------------------------
+// The interface of the hierarchy, which is implemented for each node width.
+// The hierarchy keeps the cell bounds alive, so that it can be shared by
+// shallow copies of the locator.
+struct vtkBVHCellTree
+{
+  // The closest intersection of a ray
+  struct RayHit
+  {
+    vtkIdType CellId;
+    double T;
+    double X[3];
+    double PCoords[3];
+    int SubId;
+  };
+
+  vtkDataSet* DataSet = nullptr;
+  std::shared_ptr<std::vector<double>> CellBoundsSharedPtr;
+  const double* CellBounds = nullptr;
+  std::vector<vtkIdType> CellIds; // cells ordered by leaf
+  double Bounds[6];
+  double Epsilon = 0.0; // padding of the boxes for the ray queries
+  int MaxCellSize = 0;
+
+  virtual ~vtkBVHCellTree() = default;
+
+  virtual vtkIdType GetNumberOfNodes() const = 0;
+
+  virtual vtkIdType FindCell(
+    const double x[3], vtkGenericCell* cell, int& subId, double pcoords[3], double* weights) = 0;
+
+  virtual void FindCellsWithinBounds(const double bbox[6], vtkIdList* cells) = 0;
+
+  virtual vtkIdType FindClosestPointWithinRadius(const double x[3], double radius,
+    double closestPoint[3], vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2,
+    int& inside) = 0;
+
+  // Find the closest intersection of a packet of at most 8 rays, given by
+  // the 3*numRays coordinates of their end points.
+  virtual void IntersectRays(int numRays, const double* p1, const double* p2, double tol,
+    RayHit* hits, vtkGenericCell* cell) = 0;
+
+  virtual int IntersectWithLine(const double p1[3], const double p2[3], double tol,
+    vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell) = 0;
+
+  virtual void GenerateRepresentation(int level, vtkPolyData* pd) = 0;
+};
+
+namespace
+{
+// The number of consecutive rays that traverse the hierarchy together.
+constexpr int PacketSize = 8;
+
+// Below this number of cells, a node is left to the parallel subtree builds.
+constexpr vtkIdType ParallelBuildSize = 4096;
+
+//------------------------------------------------------------------------------
+// Half the surface area of a box
+double HalfArea(const double b[6])
+{
+  const double dx = b[1] - b[0];
+  const double dy = b[3] - b[2];
+  const double dz = b[5] - b[4];
+  return dx * dy + dy * dz + dz * dx;
+}
+
+void InitializeBounds(double b[6])
+{
+  b[0] = b[2] = b[4] = VTK_DOUBLE_MAX;
+  b[1] = b[3] = b[5] = -VTK_DOUBLE_MAX;
+}
+
+void AddBounds(double b[6], const double c[6])
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    b[2 * i] = std::min(b[2 * i], c[2 * i]);
+    b[2 * i + 1] = std::max(b[2 * i + 1], c[2 * i + 1]);
+  }
+}
+
+double Distance2ToBounds(const double x[3], const double b[6])
+{
+  double dist2 = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    const double d =
+      (x[i] < b[2 * i] ? b[2 * i] - x[i] : (x[i] > b[2 * i + 1] ? x[i] - b[2 * i + 1] : 0.0));
+    dist2 += d * d;
+  }
+  return dist2;
+}
+
+bool BoundsContain(const double b[6], const double x[3])
+{
+  return b[0] <= x[0] && x[0] <= b[1] && b[2] <= x[1] && x[1] <= b[3] && b[4] <= x[2] &&
+    x[2] <= b[5];
+}
+
+bool BoundsOverlap(const double a[6], const double b[6])
+{
+  return a[0] <= b[1] && b[0] <= a[1] && a[2] <= b[3] && b[2] <= a[3] && a[4] <= b[5] &&
+    b[4] <= a[5];
+}
+
+//------------------------------------------------------------------------------
+// A ray from p1 to p2, with the parametric coordinate t of the nearest
+// intersection found so far.
+struct Ray
+{
+  const double* P1;
+  const double* P2;
+  double Dir[3];
+  double Inv[3]; // the inverse of the direction, zero along the axes that it is parallel to
+  double TMax;
+
+  void Initialize(const double* p1, const double* p2)
+  {
+    this->P1 = p1;
+    this->P2 = p2;
+    for (int i = 0; i < 3; ++i)
+    {
+      this->Dir[i] = p2[i] - p1[i];
+      this->Inv[i] = (this->Dir[i] != 0.0 ? 1.0 / this->Dir[i] : 0.0);
+    }
+    this->TMax = 1.0;
+  }
+
+  // Intersect the ray with a box padded by pad. The parametric coordinate
+  // where the ray enters the box is returned in tEnter.
+  bool HitBounds(const double b[6], double pad, double& tEnter) const
+  {
+    double t0 = 0.0;
+    double t1 = this->TMax;
+    for (int i = 0; i < 3; ++i)
+    {
+      const double lo = b[2 * i] - pad;
+      const double hi = b[2 * i + 1] + pad;
+      if (this->Dir[i] == 0.0)
+      {
+        if (this->P1[i] < lo || this->P1[i] > hi)
+        {
+          return false;
+        }
+      }
+      else
+      {
+        const double ta = (lo - this->P1[i]) * this->Inv[i];
+        const double tb = (hi - this->P1[i]) * this->Inv[i];
+        t0 = std::max(t0, std::min(ta, tb));
+        t1 = std::min(t1, std::max(ta, tb));
+      }
+    }
+    tEnter = t0;
+    return t0 <= t1;
+  }
+};
+
+//------------------------------------------------------------------------------
+// A node of the binary hierarchy that is built first, and then collapsed
+// into wide nodes.
+struct BinaryNode
+{
+  double Bounds[6];
+  vtkIdType Start; // first cell of the node in the cell ordering
+  vtkIdType Count; // number of cells of the node
+  vtkIdType Left;  // index of the left child, the right one follows it; -1 for a leaf
+};
+
+// A bin of the centers of the cells along an axis
+struct Bin
+{
+  double Bounds[6];
+  vtkIdType Count;
+  vtkIdType RightCount; // number of cells in this bin and the bins above it
+  double RightCost;     // SAH cost of the cells in this bin and the bins above it
+};
+
+//------------------------------------------------------------------------------
+// Build the binary hierarchy top-down with the binned surface area
+// heuristic. The top levels are split serially, and the subtrees below
+// them are built in parallel and then appended to the node list.
+class BinaryBuilder
+{
+public:
+  BinaryBuilder(const double* cellBounds, vtkIdType numCells, int numBins, int leafSize)
+    : CellBounds(cellBounds)
+    , NumberOfCells(numCells)
+    , NumberOfBins(numBins)
+    , LeafSize(std::max(leafSize, 1))
+  {
+  }
+
+  void Build();
+
+  std::vector<BinaryNode> Nodes;
+  std::vector<vtkIdType> CellIds;
+
+private:
+  bool Split(std::vector<BinaryNode>& nodes, vtkIdType index, std::vector<Bin>& bins);
+  void BuildSubtree(std::vector<BinaryNode>& nodes, std::vector<Bin>& bins);
+
+  const double* CellBounds;
+  vtkIdType NumberOfCells;
+  int NumberOfBins;
+  int LeafSize;
+  std::vector<double> Centers;
+};
+
+//------------------------------------------------------------------------------
+void BinaryBuilder::Build()
+{
+  this->CellIds.resize(this->NumberOfCells);
+  this->Centers.resize(3 * this->NumberOfCells);
+  vtkSMPTools::For(0, this->NumberOfCells, [this](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      const double* b = this->CellBounds + 6 * cellId;
+      double* c = this->Centers.data() + 3 * cellId;
+      c[0] = 0.5 * (b[0] + b[1]);
+      c[1] = 0.5 * (b[2] + b[3]);
+      c[2] = 0.5 * (b[4] + b[5]);
+      this->CellIds[cellId] = cellId;
+    }
+  });
+
+  BinaryNode root;
+  InitializeBounds(root.Bounds);
+  for (vtkIdType cellId = 0; cellId < this->NumberOfCells; ++cellId)
+  {
+    AddBounds(root.Bounds, this->CellBounds + 6 * cellId);
+  }
+  root.Start = 0;
+  root.Count = this->NumberOfCells;
+  root.Left = -1;
+  this->Nodes.clear();
+  this->Nodes.push_back(root);
+
+  // Split the top levels breadth first, until there are enough subtrees to
+  // keep the threads busy.
+  const size_t maxSubtrees = 8 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  std::vector<Bin> bins;
+  std::vector<vtkIdType> queue(1, 0);
+  std::vector<vtkIdType> subtrees;
+  for (size_t head = 0; head < queue.size(); ++head)
+  {
+    const vtkIdType index = queue[head];
+    if (this->Nodes[index].Count < ParallelBuildSize ||
+      queue.size() - head + subtrees.size() >= maxSubtrees)
+    {
+      subtrees.push_back(index);
+    }
+    else if (this->Split(this->Nodes, index, bins))
+    {
+      queue.push_back(this->Nodes[index].Left);
+      queue.push_back(this->Nodes[index].Left + 1);
+    }
+  }
+
+  // Each subtree is built in its own node list, whose first node is a copy
+  // of the root of the subtree. The cells of the subtrees do not overlap.
+  std::vector<std::vector<BinaryNode>> subtreeNodes(subtrees.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(subtrees.size()), 1,
+    [&](vtkIdType begin, vtkIdType end) {
+      std::vector<Bin> localBins;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        subtreeNodes[i].push_back(this->Nodes[subtrees[i]]);
+        this->BuildSubtree(subtreeNodes[i], localBins);
+      }
+    });
+
+  for (size_t i = 0; i < subtrees.size(); ++i)
+  {
+    const std::vector<BinaryNode>& local = subtreeNodes[i];
+    if (local.size() == 1)
+    {
+      continue;
+    }
+    // local node j > 0 is appended at offset + j
+    const vtkIdType offset = static_cast<vtkIdType>(this->Nodes.size()) - 1;
+    this->Nodes[subtrees[i]].Left = local[0].Left + offset;
+    for (size_t j = 1; j < local.size(); ++j)
+    {
+      BinaryNode node = local[j];
+      if (node.Left >= 0)
+      {
+        node.Left += offset;
+      }
+      this->Nodes.push_back(node);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void BinaryBuilder::BuildSubtree(std::vector<BinaryNode>& nodes, std::vector<Bin>& bins)
+{
+  std::vector<vtkIdType> stack(1, 0);
+  while (!stack.empty())
+  {
+    const vtkIdType index = stack.back();
+    stack.pop_back();
+    if (this->Split(nodes, index, bins))
+    {
+      stack.push_back(nodes[index].Left);
+      stack.push_back(nodes[index].Left + 1);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Split a node in two, by evaluating the SAH cost of the planes between the
+// bins of the cell centers along each axis. The children are appended to
+// the nodes. Returns false if the node is a leaf.
+bool BinaryBuilder::Split(std::vector<BinaryNode>& nodes, vtkIdType index, std::vector<Bin>& bins)
+{
+  const vtkIdType start = nodes[index].Start;
+  const vtkIdType count = nodes[index].Count;
+  if (count <= this->LeafSize)
+  {
+    return false;
+  }
+  vtkIdType* ids = this->CellIds.data() + start;
+  const double* centers = this->Centers.data();
+  const int numBins = this->NumberOfBins;
+
+  double cmin[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+  double cmax[3] = { -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+  for (vtkIdType i = 0; i < count; ++i)
+  {
+    const double* c = centers + 3 * ids[i];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      cmin[axis] = std::min(cmin[axis], c[axis]);
+      cmax[axis] = std::max(cmax[axis], c[axis]);
+    }
+  }
+
+  bins.resize(3 * numBins);
+  int bestAxis = -1;
+  int bestBin = -1;
+  double bestCost = VTK_DOUBLE_MAX;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double extent = cmax[axis] - cmin[axis];
+    if (!(extent > 0.0))
+    {
+      continue;
+    }
+    const double scale = numBins / extent;
+    Bin* axisBins = bins.data() + axis * numBins;
+    for (int b = 0; b < numBins; ++b)
+    {
+      InitializeBounds(axisBins[b].Bounds);
+      axisBins[b].Count = 0;
+    }
+    for (vtkIdType i = 0; i < count; ++i)
+    {
+      const int b = std::min(
+        numBins - 1, static_cast<int>((centers[3 * ids[i] + axis] - cmin[axis]) * scale));
+      axisBins[b].Count++;
+      AddBounds(axisBins[b].Bounds, this->CellBounds + 6 * ids[i]);
+    }
+
+    // sweep from the right to accumulate the cost of the upper sides
+    double bounds[6];
+    InitializeBounds(bounds);
+    vtkIdType sum = 0;
+    for (int b = numBins - 1; b > 0; --b)
+    {
+      if (axisBins[b].Count > 0)
+      {
+        AddBounds(bounds, axisBins[b].Bounds);
+        sum += axisBins[b].Count;
+      }
+      axisBins[b].RightCount = sum;
+      axisBins[b].RightCost = (sum > 0 ? HalfArea(bounds) * sum : 0.0);
+    }
+
+    // sweep from the left to evaluate the splits
+    InitializeBounds(bounds);
+    sum = 0;
+    for (int b = 0; b < numBins - 1; ++b)
+    {
+      if (axisBins[b].Count > 0)
+      {
+        AddBounds(bounds, axisBins[b].Bounds);
+        sum += axisBins[b].Count;
+      }
+      if (sum == 0 || axisBins[b + 1].RightCount == 0)
+      {
+        continue;
+      }
+      const double cost = HalfArea(bounds) * sum + axisBins[b + 1].RightCost;
+      if (cost < bestCost)
+      {
+        bestCost = cost;
+        bestAxis = axis;
+        bestBin = b;
+      }
+    }
+  }
+
+  BinaryNode left;
+  BinaryNode right;
+  InitializeBounds(left.Bounds);
+  InitializeBounds(right.Bounds);
+  vtkIdType mid;
+  if (bestAxis >= 0)
+  {
+    const double scale = numBins / (cmax[bestAxis] - cmin[bestAxis]);
+    const double origin = cmin[bestAxis];
+    mid = std::partition(ids, ids + count,
+            [&](vtkIdType id) {
+              return std::min(numBins - 1,
+                       static_cast<int>((centers[3 * id + bestAxis] - origin) * scale)) <= bestBin;
+            }) -
+      ids;
+    const Bin* axisBins = bins.data() + bestAxis * numBins;
+    for (int b = 0; b < numBins; ++b)
+    {
+      if (axisBins[b].Count > 0)
+      {
+        AddBounds(b <= bestBin ? left.Bounds : right.Bounds, axisBins[b].Bounds);
+      }
+    }
+  }
+  else
+  {
+    // all the centers coincide, split the cells in halves
+    mid = count / 2;
+    for (vtkIdType i = 0; i < count; ++i)
+    {
+      AddBounds(i < mid ? left.Bounds : right.Bounds, this->CellBounds + 6 * ids[i]);
+    }
+  }
+
+  left.Start = start;
+  left.Count = mid;
+  left.Left = -1;
+  right.Start = start + mid;
+  right.Count = count - mid;
+  right.Left = -1;
+  nodes[index].Left = static_cast<vtkIdType>(nodes.size());
+  nodes.push_back(left);
+  nodes.push_back(right);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// A node with up to W children. The boxes of the children are stored one
+// array per coordinate, so that a ray is tested against all of them with
+// loops that the compiler can vectorize.
+template <int W>
+struct WideNode
+{
+  double Min[3][W];
+  double Max[3][W];
+  vtkIdType Child[W]; // index of the child node, or first cell of a leaf
+  vtkIdType Count[W]; // number of cells of a leaf, 0 for a node, -1 for an empty slot
+
+  void Initialize()
+  {
+    for (int s = 0; s < W; ++s)
+    {
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        this->Min[axis][s] = VTK_DOUBLE_MAX;
+        this->Max[axis][s] = -VTK_DOUBLE_MAX;
+      }
+      this->Child[s] = -1;
+      this->Count[s] = -1;
+    }
+  }
+
+  void GetBounds(int s, double b[6]) const
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      b[2 * axis] = this->Min[axis][s];
+      b[2 * axis + 1] = this->Max[axis][s];
+    }
+  }
+
+  // Test a ray against the boxes of all the children, padded by pad.
+  // Returns the mask of the children that are hit, and their entry
+  // parametric coordinates in tEnter.
+  int HitChildren(const Ray& ray, double pad, double tEnter[W]) const
+  {
+    double t0[W];
+    double t1[W];
+    for (int s = 0; s < W; ++s)
+    {
+      t0[s] = 0.0;
+      t1[s] = ray.TMax;
+    }
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const double o = ray.P1[axis];
+      if (ray.Dir[axis] == 0.0)
+      {
+        for (int s = 0; s < W; ++s)
+        {
+          if (o < this->Min[axis][s] - pad || o > this->Max[axis][s] + pad)
+          {
+            t1[s] = -1.0;
+          }
+        }
+      }
+      else
+      {
+        const double inv = ray.Inv[axis];
+        for (int s = 0; s < W; ++s)
+        {
+          const double ta = (this->Min[axis][s] - pad - o) * inv;
+          const double tb = (this->Max[axis][s] + pad - o) * inv;
+          t0[s] = std::max(t0[s], std::min(ta, tb));
+          t1[s] = std::min(t1[s], std::max(ta, tb));
+        }
+      }
+    }
+    int mask = 0;
+    for (int s = 0; s < W; ++s)
+    {
+      if (this->Count[s] >= 0 && t0[s] <= t1[s])
+      {
+        mask |= (1 << s);
+        tEnter[s] = t0[s];
+      }
+    }
+    return mask;
+  }
+};
+
+//------------------------------------------------------------------------------
+// The hierarchy of W-wide nodes. The root is node 0.
+template <int W>
+struct BVHTree : public vtkBVHCellTree
+{
+  std::vector<WideNode<W>> Nodes;
+
+  void Collapse(const std::vector<BinaryNode>& binaryNodes);
+
+  vtkIdType GetNumberOfNodes() const override
+  {
+    return static_cast<vtkIdType>(this->Nodes.size());
+  }
+
+  vtkIdType FindCell(const double x[3], vtkGenericCell* cell, int& subId, double pcoords[3],
+    double* weights) override;
+
+  void FindCellsWithinBounds(const double bbox[6], vtkIdList* cells) override;
+
+  vtkIdType FindClosestPointWithinRadius(const double x[3], double radius, double closestPoint[3],
+    vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2, int& inside) override;
+
+  void IntersectRays(int numRays, const double* p1, const double* p2, double tol, RayHit* hits,
+    vtkGenericCell* cell) override;
+
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
+    vtkIdList* cellIds, vtkGenericCell* cell) override;
+
+  void GenerateRepresentation(int level, vtkPolyData* pd) override;
+};
+
+//------------------------------------------------------------------------------
+// Collapse the binary hierarchy: the children of each wide node are found
+// by repeatedly opening the binary child with the largest surface area,
+// until there are W of them or they are all leaves.
+template <int W>
+void BVHTree<W>::Collapse(const std::vector<BinaryNode>& binaryNodes)
+{
+  this->Nodes.clear();
+  this->Nodes.reserve(binaryNodes.size() / (W - 1) + 1);
+  this->Nodes.emplace_back();
+  this->Nodes[0].Initialize();
+
+  std::vector<std::pair<vtkIdType, vtkIdType>> stack; // (binary node, wide node)
+  stack.emplace_back(0, 0);
+  while (!stack.empty())
+  {
+    const vtkIdType binaryIndex = stack.back().first;
+    const vtkIdType wideIndex = stack.back().second;
+    stack.pop_back();
+
+    vtkIdType children[W];
+    int numChildren = 1;
+    children[0] = binaryIndex;
+    while (numChildren < W)
+    {
+      int best = -1;
+      double bestArea = -1.0;
+      for (int i = 0; i < numChildren; ++i)
+      {
+        const BinaryNode& node = binaryNodes[children[i]];
+        if (node.Left >= 0 && HalfArea(node.Bounds) > bestArea)
+        {
+          best = i;
+          bestArea = HalfArea(node.Bounds);
+        }
+      }
+      if (best < 0)
+      {
+        break;
+      }
+      const vtkIdType left = binaryNodes[children[best]].Left;
+      children[best] = left;
+      children[numChildren++] = left + 1;
+    }
+
+    for (int s = 0; s < numChildren; ++s)
+    {
+      const BinaryNode& node = binaryNodes[children[s]];
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        this->Nodes[wideIndex].Min[axis][s] = node.Bounds[2 * axis];
+        this->Nodes[wideIndex].Max[axis][s] = node.Bounds[2 * axis + 1];
+      }
+      if (node.Left < 0)
+      {
+        this->Nodes[wideIndex].Child[s] = node.Start;
+        this->Nodes[wideIndex].Count[s] = node.Count;
+      }
+      else
+      {
+        const vtkIdType childIndex = static_cast<vtkIdType>(this->Nodes.size());
+        this->Nodes.emplace_back();
+        this->Nodes.back().Initialize();
+        this->Nodes[wideIndex].Child[s] = childIndex;
+        this->Nodes[wideIndex].Count[s] = 0;
+        stack.emplace_back(children[s], childIndex);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int W>
+vtkIdType BVHTree<W>::FindCell(
+  const double x[3], vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  if (!BoundsContain(this->Bounds, x))
+  {
+    return -1;
+  }
+  double closestPoint[3], dist2, bounds[6];
+  std::vector<vtkIdType> stack(1, 0);
+  while (!stack.empty())
+  {
+    const WideNode<W>& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    for (int s = 0; s < W; ++s)
+    {
+      node.GetBounds(s, bounds);
+      if (node.Count[s] < 0 || !BoundsContain(bounds, x))
+      {
+        continue;
+      }
+      if (node.Count[s] == 0)
+      {
+        stack.push_back(node.Child[s]);
+        continue;
+      }
+      for (vtkIdType i = node.Child[s]; i < node.Child[s] + node.Count[s]; ++i)
+      {
+        const vtkIdType cellId = this->CellIds[i];
+        if (BoundsContain(this->CellBounds + 6 * cellId, x))
+        {
+          this->DataSet->GetCell(cellId, cell);
+          if (cell->EvaluatePosition(x, closestPoint, subId, pcoords, dist2, weights) == 1)
+          {
+            return cellId;
+          }
+        }
+      }
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+template <int W>
+void BVHTree<W>::FindCellsWithinBounds(const double bbox[6], vtkIdList* cells)
+{
+  if (!BoundsOverlap(this->Bounds, bbox))
+  {
+    return;
+  }
+  double bounds[6];
+  std::vector<vtkIdType> stack(1, 0);
+  while (!stack.empty())
+  {
+    const WideNode<W>& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    for (int s = 0; s < W; ++s)
+    {
+      node.GetBounds(s, bounds);
+      if (node.Count[s] < 0 || !BoundsOverlap(bounds, bbox))
+      {
+        continue;
+      }
+      if (node.Count[s] == 0)
+      {
+        stack.push_back(node.Child[s]);
+        continue;
+      }
+      for (vtkIdType i = node.Child[s]; i < node.Child[s] + node.Count[s]; ++i)
+      {
+        if (BoundsOverlap(this->CellBounds + 6 * this->CellIds[i], bbox))
+        {
+          cells->InsertNextId(this->CellIds[i]);
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// The nodes are visited in the order of their distance to the point, and the
+// search stops when the nearest remaining node is further than the closest
+// point found so far.
+template <int W>
+vtkIdType BVHTree<W>::FindClosestPointWithinRadius(const double x[3], double radius,
+  double closestPoint[3], vtkGenericCell* cell, vtkIdType& closestCellId, int& closestSubId,
+  double& minDist2, int& inside)
+{
+  std::vector<double> weights(this->MaxCellSize);
+  double pcoords[3], point[3], bounds[6], dist2;
+  int subId, stat;
+  vtkIdType retVal = 0;
+
+  using NodeDistance = std::pair<double, vtkIdType>;
+  std::priority_queue<NodeDistance, std::vector<NodeDistance>, std::greater<NodeDistance>> queue;
+  queue.push(std::make_pair(Distance2ToBounds(x, this->Bounds), 0));
+
+  // minimum squared distance to the closest point
+  minDist2 = radius * radius;
+
+  while (!queue.empty() && queue.top().first < minDist2)
+  {
+    const WideNode<W>& node = this->Nodes[queue.top().second];
+    queue.pop();
+    for (int s = 0; s < W; ++s)
+    {
+      if (node.Count[s] < 0)
+      {
+        continue;
+      }
+      node.GetBounds(s, bounds);
+      const double nodeDist2 = Distance2ToBounds(x, bounds);
+      if (nodeDist2 >= minDist2)
+      {
+        continue;
+      }
+      if (node.Count[s] == 0)
+      {
+        queue.push(std::make_pair(nodeDist2, node.Child[s]));
+        continue;
+      }
+      for (vtkIdType i = node.Child[s]; i < node.Child[s] + node.Count[s]; ++i)
+      {
+        const vtkIdType cellId = this->CellIds[i];
+        if (Distance2ToBounds(x, this->CellBounds + 6 * cellId) >= minDist2)
+        {
+          continue;
+        }
+        this->DataSet->GetCell(cellId, cell);
+        // stat==(-1) is numerical error; stat==0 means outside;
+        // stat=1 means inside.
+        stat = cell->EvaluatePosition(x, point, subId, pcoords, dist2, weights.data());
+        if (stat != -1 && dist2 < minDist2)
+        {
+          retVal = 1;
+          inside = stat;
+          minDist2 = dist2;
+          closestCellId = cellId;
+          closestSubId = subId;
+          closestPoint[0] = point[0];
+          closestPoint[1] = point[1];
+          closestPoint[2] = point[2];
+        }
+      }
+    }
+  }
+
+  if (retVal)
+  {
+    this->DataSet->GetCell(closestCellId, cell);
+  }
+  return retVal;
+}
+
+//------------------------------------------------------------------------------
+// The rays of the packet traverse the hierarchy together, each stack entry
+// holding the mask of the rays that hit the node. The children are pushed
+// farthest first, so that the nearest intersections are found early and
+// shrink the rays. A cell is fetched once for all the rays that hit its box.
+template <int W>
+void BVHTree<W>::IntersectRays(int numRays, const double* p1, const double* p2, double tol,
+  RayHit* hits, vtkGenericCell* cell)
+{
+  Ray rays[PacketSize];
+  for (int r = 0; r < numRays; ++r)
+  {
+    rays[r].Initialize(p1 + 3 * r, p2 + 3 * r);
+    hits[r].CellId = -1;
+    hits[r].T = VTK_DOUBLE_MAX;
+  }
+  const double pad = std::max(tol, 0.0) + this->Epsilon;
+
+  int rayMask = 0;
+  for (int r = 0; r < numRays; ++r)
+  {
+    double tEnter;
+    if (rays[r].HitBounds(this->Bounds, pad, tEnter))
+    {
+      rayMask |= (1 << r);
+    }
+  }
+  if (!rayMask)
+  {
+    return;
+  }
+
+  struct Entry
+  {
+    vtkIdType Node;
+    int RayMask;
+    double TEnter;
+  };
+  std::vector<Entry> stack;
+  stack.push_back(Entry{ 0, rayMask, 0.0 });
+  double tEnter[PacketSize][W];
+  int slotMask[PacketSize];
+  Entry children[W];
+
+  while (!stack.empty())
+  {
+    const Entry entry = stack.back();
+    stack.pop_back();
+    const WideNode<W>& node = this->Nodes[entry.Node];
+
+    for (int r = 0; r < numRays; ++r)
+    {
+      slotMask[r] = ((entry.RayMask >> r) & 1 ? node.HitChildren(rays[r], pad, tEnter[r]) : 0);
+    }
+
+    int numChildren = 0;
+    for (int s = 0; s < W; ++s)
+    {
+      int slotRays = 0;
+      double tMin = VTK_DOUBLE_MAX;
+      for (int r = 0; r < numRays; ++r)
+      {
+        if ((slotMask[r] >> s) & 1)
+        {
+          slotRays |= (1 << r);
+          tMin = std::min(tMin, tEnter[r][s]);
+        }
+      }
+      if (!slotRays)
+      {
+        continue;
+      }
+      if (node.Count[s] == 0)
+      {
+        children[numChildren++] = Entry{ node.Child[s], slotRays, tMin };
+        continue;
+      }
+
+      // a leaf
+      for (vtkIdType i = node.Child[s]; i < node.Child[s] + node.Count[s]; ++i)
+      {
+        const vtkIdType cellId = this->CellIds[i];
+        const double* cellBounds = this->CellBounds + 6 * cellId;
+        bool fetched = false;
+        for (int r = 0; r < numRays; ++r)
+        {
+          double tCell, t, x[3], pcoords[3];
+          int subId;
+          if (!((slotRays >> r) & 1) || !rays[r].HitBounds(cellBounds, pad, tCell))
+          {
+            continue;
+          }
+          if (!fetched)
+          {
+            this->DataSet->GetCell(cellId, cell);
+            fetched = true;
+          }
+          if (cell->IntersectWithLine(rays[r].P1, rays[r].P2, tol, t, x, pcoords, subId) &&
+            t < hits[r].T)
+          {
+            RayHit& hit = hits[r];
+            hit.CellId = cellId;
+            hit.T = t;
+            std::copy_n(x, 3, hit.X);
+            std::copy_n(pcoords, 3, hit.PCoords);
+            hit.SubId = subId;
+            rays[r].TMax = std::max(std::min(t, 1.0), 0.0);
+          }
+        }
+      }
+    }
+
+    // insertion sort of the few children, farthest first
+    for (int i = 1; i < numChildren; ++i)
+    {
+      const Entry child = children[i];
+      int j = i;
+      for (; j > 0 && children[j - 1].TEnter < child.TEnter; --j)
+      {
+        children[j] = children[j - 1];
+      }
+      children[j] = child;
+    }
+    stack.insert(stack.end(), children, children + numChildren);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int W>
+int BVHTree<W>::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell)
+{
+  struct Intersection
+  {
+    vtkIdType CellId;
+    double T;
+    double X[3];
+  };
+  std::vector<Intersection> intersections;
+
+  Ray ray;
+  ray.Initialize(p1, p2);
+  const double pad = std::max(tol, 0.0) + this->Epsilon;
+  double tEnter[W], tCell;
+  if (ray.HitBounds(this->Bounds, pad, tCell))
+  {
+    std::vector<vtkIdType> stack(1, 0);
+    while (!stack.empty())
+    {
+      const WideNode<W>& node = this->Nodes[stack.back()];
+      stack.pop_back();
+      const int mask = node.HitChildren(ray, pad, tEnter);
+      for (int s = 0; s < W; ++s)
+      {
+        if (!((mask >> s) & 1))
+        {
+          continue;
+        }
+        if (node.Count[s] == 0)
+        {
+          stack.push_back(node.Child[s]);
+          continue;
+        }
+        for (vtkIdType i = node.Child[s]; i < node.Child[s] + node.Count[s]; ++i)
+        {
+          const vtkIdType cellId = this->CellIds[i];
+          if (!ray.HitBounds(this->CellBounds + 6 * cellId, pad, tCell))
+          {
+            continue;
+          }
+          Intersection intersection;
+          intersection.CellId = cellId;
+          if (cell)
+          {
+            double pcoords[3];
+            int subId;
+            this->DataSet->GetCell(cellId, cell);
+            if (!cell->IntersectWithLine(
+                  p1, p2, tol, intersection.T, intersection.X, pcoords, subId))
+            {
+              continue;
+            }
+          }
+          else
+          {
+            // the intersection with the bounds of the cell
+            intersection.T = tCell;
+            for (int j = 0; j < 3; ++j)
+            {
+              intersection.X[j] = p1[j] + tCell * ray.Dir[j];
+            }
+          }
+          intersections.push_back(intersection);
+        }
+      }
+    }
+  }
+
+  if (points)
+  {
+    points->Reset();
+  }
+  if (cellIds)
+  {
+    cellIds->Reset();
+  }
+  std::sort(intersections.begin(), intersections.end(),
+    [](const Intersection& a, const Intersection& b) { return a.T < b.T; });
+  for (const Intersection& intersection : intersections)
+  {
+    if (points)
+    {
+      points->InsertNextPoint(intersection.X);
+    }
+    if (cellIds)
+    {
+      cellIds->InsertNextId(intersection.CellId);
+    }
+  }
+  return intersections.empty() ? 0 : 1;
+}
+
+//------------------------------------------------------------------------------
+// Add the 12 edges of a box
+void AddBox(vtkPoints* points, vtkCellArray* lines, const double bounds[6])
+{
+  vtkIdType ids[8];
+  for (int i = 0; i < 8; ++i)
+  {
+    ids[i] = points->InsertNextPoint(
+      bounds[(i & 1)], bounds[2 + ((i >> 1) & 1)], bounds[4 + ((i >> 2) & 1)]);
+  }
+  static const int edges[12][2] = { { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 }, { 0, 2 }, { 1, 3 },
+    { 4, 6 }, { 5, 7 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
+  for (int e = 0; e < 12; ++e)
+  {
+    const vtkIdType line[2] = { ids[edges[e][0]], ids[edges[e][1]] };
+    lines->InsertNextCell(2, line);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Level 0 is the box of the whole data set, level 1 the boxes of the
+// children of the root, and so on.
+template <int W>
+void BVHTree<W>::GenerateRepresentation(int level, vtkPolyData* pd)
+{
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  vtkNew<vtkCellArray> lines;
+  pd->SetPoints(points);
+  pd->SetLines(lines);
+
+  if (level <= 0)
+  {
+    AddBox(points, lines, this->Bounds);
+    return;
+  }
+  double bounds[6];
+  std::vector<std::pair<vtkIdType, int>> stack; // (node, level of its children)
+  stack.emplace_back(0, 1);
+  while (!stack.empty())
+  {
+    const WideNode<W>& node = this->Nodes[stack.back().first];
+    const int childLevel = stack.back().second;
+    stack.pop_back();
+    for (int s = 0; s < W; ++s)
+    {
+      if (node.Count[s] < 0)
+      {
+        continue;
+      }
+      if (childLevel == level || node.Count[s] > 0)
+      {
+        node.GetBounds(s, bounds);
+        AddBox(points, lines, bounds);
+      }
+      else
+      {
+        stack.emplace_back(node.Child[s], childLevel + 1);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int W>
+std::shared_ptr<vtkBVHCellTree> BuildTree(const std::vector<BinaryNode>& binaryNodes)
+{
+  auto tree = std::make_shared<BVHTree<W>>();
+  tree->Collapse(binaryNodes);
+  return tree;
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::vtkBVHCellLocator()
+{
+  this->CacheCellBounds = 1; // always cached
+  this->NumberOfCellsPerNode = 8;
+  this->NodeWidth = 4;
+  this->NumberOfBins = 16;
+}
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::~vtkBVHCellLocator()
+{
+  this->FreeSearchStructure();
+  this->FreeCellBounds();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FreeSearchStructure()
+{
+  this->Tree.reset();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocator()
+{
+  // don't rebuild if build time is newer than modified and dataset modified time
+  if (this->Tree && this->BuildTime > this->MTime && this->BuildTime > this->DataSet->GetMTime())
+  {
+    return;
+  }
+  // don't rebuild if UseExistingSearchStructure is ON and a search structure already exists
+  if (this->Tree && this->UseExistingSearchStructure)
+  {
+    this->BuildTime.Modified();
+    vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
+    return;
+  }
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ForceBuildLocator()
+{
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocatorInternal()
+{
+  vtkDebugMacro(<< "Building BVH cell locator");
+  vtkIdType numCells;
+  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
+  {
+    vtkErrorMacro(<< "No cells to build");
+    return;
+  }
+
+  // Prepare
+  this->FreeSearchStructure();
+  this->FreeCellBounds();
+  this->StoreCellBounds();
+
+  BinaryBuilder builder(this->CellBounds, numCells, this->NumberOfBins, this->NumberOfCellsPerNode);
+  builder.Build();
+
+  std::shared_ptr<vtkBVHCellTree> tree = (this->NodeWidth > 4 ? BuildTree<8>(builder.Nodes)
+                                                              : BuildTree<4>(builder.Nodes));
+  tree->DataSet = this->DataSet;
+  tree->CellBoundsSharedPtr = this->CellBoundsSharedPtr;
+  tree->CellBounds = this->CellBounds;
+  tree->CellIds = std::move(builder.CellIds);
+  std::copy_n(builder.Nodes[0].Bounds, 6, tree->Bounds);
+  double diagonal2 = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    const double d = tree->Bounds[2 * i + 1] - tree->Bounds[2 * i];
+    diagonal2 += d * d;
+  }
+  tree->Epsilon = FLT_EPSILON * std::sqrt(diagonal2);
+  tree->MaxCellSize = this->DataSet->GetMaxCellSize();
+  this->Tree = tree;
+
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindCell(double x[3], double vtkNotUsed(tol2), vtkGenericCell* cell,
+  int& subId, double pcoords[3], double* weights)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return -1;
+  }
+  return this->Tree->FindCell(x, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindClosestPointWithinRadius(double x[3], double radius,
+  double closestPoint[3], vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2,
+  int& inside)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  return this->Tree->FindClosestPointWithinRadius(
+    x, radius, closestPoint, cell, cellId, subId, dist2, inside);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FindCellsWithinBounds(double* bbox, vtkIdList* cells)
+{
+  if (!cells)
+  {
+    return;
+  }
+  cells->Reset();
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return;
+  }
+  this->Tree->FindCellsWithinBounds(bbox, cells);
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  vtkBVHCellTree::RayHit hit;
+  this->Tree->IntersectRays(1, p1, p2, tol, &hit, cell);
+  cellId = hit.CellId;
+  if (hit.CellId < 0)
+  {
+    return 0;
+  }
+  t = hit.T;
+  std::copy_n(hit.X, 3, x);
+  std::copy_n(hit.PCoords, 3, pcoords);
+  subId = hit.SubId;
+  this->DataSet->GetCell(cellId, cell);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  return this->Tree->IntersectWithLine(p1, p2, tol, points, cellIds, cell);
+}
+
+//------------------------------------------------------------------------------
+// The rays are processed in packets of consecutive rays, and the packets
+// are distributed over the threads.
+void vtkBVHCellLocator::IntersectWithLines(vtkPoints* p1, vtkPoints* p2, double tol,
+  vtkIdTypeArray* cellIds, vtkDoubleArray* t, vtkPoints* x)
+{
+  if (!p1 || !p2 || !cellIds)
+  {
+    vtkErrorMacro("The end points and the cell ids must be provided.");
+    return;
+  }
+  const vtkIdType numRays = p1->GetNumberOfPoints();
+  if (p2->GetNumberOfPoints() != numRays)
+  {
+    vtkErrorMacro("The two sets of end points must have the same size.");
+    return;
+  }
+
+  cellIds->SetNumberOfComponents(1);
+  cellIds->SetNumberOfTuples(numRays);
+  if (t)
+  {
+    t->SetNumberOfComponents(1);
+    t->SetNumberOfTuples(numRays);
+  }
+  if (x)
+  {
+    x->SetNumberOfPoints(numRays);
+  }
+
+  this->BuildLocator();
+  vtkBVHCellTree* tree = this->Tree.get();
+  if (numRays == 0)
+  {
+    return;
+  }
+
+  // This is done to cause non-thread safe initialization to occur due to
+  // side effects from GetCell().
+  if (tree)
+  {
+    this->DataSet->GetCell(0, this->GenericCell);
+  }
+
+  vtkSMPThreadLocalObject<vtkGenericCell> threadCell;
+  const vtkIdType numPackets = (numRays + PacketSize - 1) / PacketSize;
+  vtkSMPTools::For(0, numPackets, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = threadCell.Local();
+    double ends1[3 * PacketSize], ends2[3 * PacketSize];
+    vtkBVHCellTree::RayHit hits[PacketSize];
+    for (vtkIdType packet = begin; packet < end; ++packet)
+    {
+      const vtkIdType first = packet * PacketSize;
+      const int count = static_cast<int>(std::min<vtkIdType>(PacketSize, numRays - first));
+      for (int r = 0; r < count; ++r)
+      {
+        p1->GetPoint(first + r, ends1 + 3 * r);
+        p2->GetPoint(first + r, ends2 + 3 * r);
+        hits[r].CellId = -1;
+        hits[r].T = VTK_DOUBLE_MAX;
+      }
+      if (tree)
+      {
+        tree->IntersectRays(count, ends1, ends2, tol, hits, cell);
+      }
+      for (int r = 0; r < count; ++r)
+      {
+        cellIds->SetValue(first + r, hits[r].CellId);
+        if (t)
+        {
+          t->SetValue(first + r, hits[r].T);
+        }
+        if (x)
+        {
+          x->SetPoint(first + r, hits[r].CellId >= 0 ? hits[r].X : ends2 + 3 * r);
+        }
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::GenerateRepresentation(int level, vtkPolyData* pd)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return;
+  }
+  this->Tree->GenerateRepresentation(level, pd);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
+{
+  vtkBVHCellLocator* cellLocator = vtkBVHCellLocator::SafeDownCast(locator);
+  if (!cellLocator)
+  {
+    vtkErrorMacro("Cannot cast " << locator->GetClassName() << " to vtkBVHCellLocator.");
+    return;
+  }
+  // we only copy what's actually used by vtkBVHCellLocator
+
+  // vtkLocator parameters
+  this->SetDataSet(cellLocator->GetDataSet());
+  this->SetUseExistingSearchStructure(cellLocator->GetUseExistingSearchStructure());
+
+  // vtkAbstractCellLocator parameters
+  this->SetNumberOfCellsPerNode(cellLocator->GetNumberOfCellsPerNode());
+  this->CellBoundsSharedPtr = cellLocator->CellBoundsSharedPtr; // this is important
+  this->CellBounds = this->CellBoundsSharedPtr.get() ? this->CellBoundsSharedPtr->data() : nullptr;
+
+  // vtkBVHCellLocator parameters
+  this->SetNodeWidth(cellLocator->GetNodeWidth());
+  this->SetNumberOfBins(cellLocator->GetNumberOfBins());
+  this->Tree = cellLocator->Tree; // this is important
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  // Cell bounds are always cached
+  this->CacheCellBounds = 1;
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Node Width: " << this->NodeWidth << "\n";
+  os << indent << "Number Of Bins: " << this->NumberOfBins << "\n";
+  os << indent << "Number Of Nodes: " << (this->Tree ? this->Tree->GetNumberOfNodes() : 0)
+     << "\n";
+}
+VTK_ABI_NAMESPACE_END
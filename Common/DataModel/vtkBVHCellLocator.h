@@ -0,0 +1,205 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBVHCellLocator.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkBVHCellLocator
+ * @brief   a cell locator based on a wide bounding volume hierarchy
+ *
+ * vtkBVHCellLocator is a type of vtkAbstractCellLocator that organizes the
+ * bounding boxes of the cells in a bounding volume hierarchy (BVH). The
+ * hierarchy is built top-down with the surface area heuristic (SAH), which
+ * places the splits so that a random ray is expected to visit as few boxes
+ * as possible, and is then collapsed into wide nodes that hold the boxes of
+ * 4 or 8 children side by side. This makes the locator well suited to ray
+ * queries with IntersectWithLine(), in particular when many rays are
+ * traced at once with IntersectWithLines(): the rays are split into batches
+ * that are processed in parallel with vtkSMPTools, and the rays of a small
+ * packet of consecutive rays traverse the hierarchy together, so that the
+ * nodes and the cells they share are fetched only once. Consecutive rays
+ * should thus be coherent (e.g. neighboring pixels of an image) to get the
+ * most out of the packets.
+ *
+ * The hierarchy is built in parallel and, once built, all the queries are
+ * thread safe as long as each thread provides its own vtkGenericCell.
+ *
+ * @warning
+ * vtkBVHCellLocator utilizes the following parent class parameters:
+ * - NumberOfCellsPerNode        (default 8)
+ * - UseExistingSearchStructure  (default false)
+ *
+ * vtkBVHCellLocator does NOT utilize the following parameters:
+ * - CacheCellBounds             (always cached)
+ * - Automatic
+ * - Tolerance
+ * - Level
+ * - MaxLevel
+ * - RetainCellLists
+ *
+ * @sa
+ * vtkAbstractCellLocator vtkStaticCellLocator vtkCellTreeLocator vtkModifiedBSPTree vtkOBBTree
+ */
+
+#ifndef vtkBVHCellLocator_h
+#define vtkBVHCellLocator_h
+
+#include "vtkAbstractCellLocator.h"
+#include "vtkCommonDataModelModule.h" // For export macro
+
+#include <memory> // For shared_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDoubleArray;
+class vtkIdTypeArray;
+
+// Forward declaration for PIMPL
+struct vtkBVHCellTree;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkBVHCellLocator : public vtkAbstractCellLocator
+{
+public:
+  ///@{
+  /**
+   * Standard methods to instantiate, print and obtain type-related information.
+   */
+  static vtkBVHCellLocator* New();
+  vtkTypeMacro(vtkBVHCellLocator, vtkAbstractCellLocator);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of children of the nodes of the hierarchy. Wider
+   * nodes make the hierarchy shallower, at the cost of testing more boxes
+   * per node. Only 4 and 8 are supported: any value greater than 4 results
+   * in 8-wide nodes. The default is 4.
+   */
+  vtkSetClampMacro(NodeWidth, int, 4, 8);
+  vtkGetMacro(NodeWidth, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of bins along each axis that are used to evaluate
+   * the surface area heuristic of the candidate splits. More bins give
+   * better splits, but a slower build. The default is 16.
+   */
+  vtkSetClampMacro(NumberOfBins, int, 2, 256);
+  vtkGetMacro(NumberOfBins, int);
+  ///@}
+
+  // Re-use any superclass signatures that we don't override.
+  using vtkAbstractCellLocator::FindCell;
+  using vtkAbstractCellLocator::FindClosestPoint;
+  using vtkAbstractCellLocator::FindClosestPointWithinRadius;
+  using vtkAbstractCellLocator::IntersectWithLine;
+
+  /**
+   * Return intersection point (if any) AND the cell which was intersected by
+   * the finite line. The cell is returned as a cell id and as a generic cell.
+   *
+   * For other IntersectWithLine signatures, see vtkAbstractCellLocator.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t, double x[3],
+    double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+
+  /**
+   * Take the passed line segment and intersect it with the data set.
+   * The return value of the function is 0 if no intersections were found.
+   * For each intersection with the bounds of a cell or with a cell (if a cell is provided),
+   * the points and cellIds have the relevant information added sorted by t.
+   * If points or cellIds are nullptr pointers, then no information is generated for that list.
+   *
+   * For other IntersectWithLine signatures, see vtkAbstractCellLocator.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
+    vtkIdList* cellIds, vtkGenericCell* cell) override;
+
+  /**
+   * Intersect a batch of line segments with the data set, in parallel. The
+   * i-th segment goes from the i-th point of p1 to the i-th point of p2. For
+   * each segment, cellIds receives the id of the first cell that is
+   * intersected along the segment, or -1 if there is none, t receives the
+   * parametric coordinate of the intersection along the segment (or
+   * VTK_DOUBLE_MAX), and x receives the intersection point (or p2). Both t
+   * and x may be nullptr if they are not needed. The results are those of
+   * IntersectWithLine() on each segment, except that another cell may be
+   * returned when several cells are hit at the same t.
+   */
+  void IntersectWithLines(vtkPoints* p1, vtkPoints* p2, double tol, vtkIdTypeArray* cellIds,
+    vtkDoubleArray* t, vtkPoints* x);
+
+  /**
+   * Return the closest point within a specified radius and the cell which is
+   * closest to the point x. The closest point is somewhere on a cell, it
+   * need not be one of the vertices of the cell. This method returns 1 if a
+   * point is found within the specified radius. If there are no cells within
+   * the specified radius, the method returns 0 and the values of
+   * closestPoint, cellId, subId, and dist2 are undefined. If a closest point
+   * is found, inside returns the return value of the EvaluatePosition call to
+   * the closest cell; inside(=1) or outside(=0).
+   */
+  vtkIdType FindClosestPointWithinRadius(double x[3], double radius, double closestPoint[3],
+    vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2, int& inside) override;
+
+  /**
+   * Return a list of unique cell ids inside of a given bounding box. The
+   * user must provide the vtkIdList to populate.
+   */
+  void FindCellsWithinBounds(double* bbox, vtkIdList* cells) override;
+
+  /**
+   * Find the cell containing a given point. returns -1 if no cell found
+   * the cell parameters are copied into the supplied variables, a cell must
+   * be provided to store the information.
+   *
+   * For other FindCell signatures, see vtkAbstractCellLocator.
+   */
+  vtkIdType FindCell(double x[3], double vtkNotUsed(tol2), vtkGenericCell* cell, int& subId,
+    double pcoords[3], double* weights) override;
+
+  ///@{
+  /**
+   * Satisfy vtkLocator abstract interface. The representation of a level
+   * is made of the boxes of the nodes at that depth in the hierarchy, and
+   * of the boxes of the leaves above it.
+   */
+  void GenerateRepresentation(int level, vtkPolyData* pd) override;
+  void FreeSearchStructure() override;
+  void BuildLocator() override;
+  void ForceBuildLocator() override;
+  ///@}
+
+  /**
+   * Shallow copy of a vtkBVHCellLocator. The hierarchy is shared.
+   */
+  void ShallowCopy(vtkAbstractCellLocator* locator) override;
+
+protected:
+  vtkBVHCellLocator();
+  ~vtkBVHCellLocator() override;
+
+  void BuildLocatorInternal() override;
+
+  int NodeWidth;
+  int NumberOfBins;
+
+  std::shared_ptr<vtkBVHCellTree> Tree;
+
+private:
+  vtkBVHCellLocator(const vtkBVHCellLocator&) = delete;
+  void operator=(const vtkBVHCellLocator&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -13,10 +13,13 @@
 
 =========================================================================*/
 #include "vtkBox.h"
+#include "vtkArrayDispatch.h"
 #include "vtkBoundingBox.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm> // for sorting
 #include <cassert>
@@ -26,6 +29,99 @@
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkBox);
 
+namespace
+{
+// Signed distance to the box, shared by the single point and array evaluations.
+inline double EvaluateBox(const double minP[3], const double maxP[3], const double x[3])
+{
+  double diff, dist, minDistance = (-VTK_DOUBLE_MAX), t, distance = 0.0;
+  int inside = 1;
+
+  for (int i = 0; i < 3; i++)
+  {
+    diff = maxP[i] - minP[i];
+    if (diff != 0.0)
+    {
+      t = (x[i] - minP[i]) / diff;
+      if (t < 0.0)
+      {
+        inside = 0;
+        dist = minP[i] - x[i];
+      }
+      else if (t > 1.0)
+      {
+        inside = 0;
+        dist = x[i] - maxP[i];
+      }
+      else
+      { // want negative distance, we are inside
+        if (t <= 0.5)
+        {
+          dist = minP[i] - x[i];
+        }
+        else
+        {
+          dist = x[i] - maxP[i];
+        }
+        if (dist > minDistance) // remember, it's negative
+        {
+          minDistance = dist;
+        }
+      } // if inside
+    }
+    else
+    {
+      dist = fabs(x[i] - minP[i]);
+      if (dist > 0.0)
+      {
+        inside = 0;
+      }
+    }
+    if (dist > 0.0)
+    {
+      distance += dist * dist;
+    }
+  } // for all coordinate directions
+
+  distance = sqrt(distance);
+  if (inside)
+  {
+    return minDistance;
+  }
+  else
+  {
+    return distance;
+  }
+}
+
+// Evaluate the box equation at the tuples of an array, in parallel.
+struct BoxWorker
+{
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(
+    InputArrayType* input, OutputArrayType* output, const double minP[3], const double maxP[3])
+  {
+    using OutputValueType = vtk::GetAPIType<OutputArrayType>;
+    const double boxMin[3] = { minP[0], minP[1], minP[2] };
+    const double boxMax[3] = { maxP[0], maxP[1], maxP[2] };
+
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      const auto points = vtk::DataArrayTupleRange<3>(input, begin, end);
+      auto values = vtk::DataArrayValueRange<1>(output, begin, end);
+      auto value = values.begin();
+      double x[3];
+      for (const auto point : points)
+      {
+        x[0] = static_cast<double>(point[0]);
+        x[1] = static_cast<double>(point[1]);
+        x[2] = static_cast<double>(point[2]);
+        *value++ = static_cast<OutputValueType>(EvaluateBox(boxMin, boxMax, x));
+      }
+    });
+  }
+};
+} // anonymous namespace
+
 // Construct the box centered at the origin and each side length 1.0.
 //------------------------------------------------------------------------------
 vtkBox::vtkBox()
@@ -126,65 +222,23 @@ void vtkBox::AddBounds(const double bounds[6])
 // (with six planes) because of the "rounded" nature of the corners.
 double vtkBox::EvaluateFunction(double x[3])
 {
-  double diff, dist, minDistance = (-VTK_DOUBLE_MAX), t, distance = 0.0;
-  int inside = 1;
-  const double* minP = this->BBox->GetMinPoint();
-  const double* maxP = this->BBox->GetMaxPoint();
+  return EvaluateBox(this->BBox->GetMinPoint(), this->BBox->GetMaxPoint(), x);
+}
 
-  for (int i = 0; i < 3; i++)
-  {
-    diff = this->BBox->GetLength(i);
-    if (diff != 0.0)
-    {
-      t = (x[i] - minP[i]) / diff;
-      if (t < 0.0)
-      {
-        inside = 0;
-        dist = minP[i] - x[i];
-      }
-      else if (t > 1.0)
-      {
-        inside = 0;
-        dist = x[i] - maxP[i];
-      }
-      else
-      { // want negative distance, we are inside
-        if (t <= 0.5)
-        {
-          dist = minP[i] - x[i];
-        }
-        else
-        {
-          dist = x[i] - maxP[i];
-        }
-        if (dist > minDistance) // remember, it's negative
-        {
-          minDistance = dist;
-        }
-      } // if inside
-    }
-    else
-    {
-      dist = fabs(x[i] - minP[i]);
-      if (dist > 0.0)
-      {
-        inside = 0;
-      }
-    }
-    if (dist > 0.0)
-    {
-      distance += dist * dist;
-    }
-  } // for all coordinate directions
+//------------------------------------------------------------------------------
+void vtkBox::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
 
-  distance = sqrt(distance);
-  if (inside)
-  {
-    return minDistance;
-  }
-  else
+  BoxWorker worker;
+  using Dispatcher =
+    vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals, vtkArrayDispatch::Reals>;
+  const double* minP = this->BBox->GetMinPoint();
+  const double* maxP = this->BBox->GetMaxPoint();
+  if (!Dispatcher::Execute(input, output, worker, minP, maxP))
   {
-    return distance;
+    worker(input, output, minP, maxP); // Use vtkDataArray API if dispatch fails.
   }
 }
 
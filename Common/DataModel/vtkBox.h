@@ -47,11 +47,15 @@ public:
    */
   static vtkBox* New();
 
+  ///@{
   /**
    * Evaluate box defined by the two points (pMin,pMax).
+   * The points of a float or double array are evaluated in parallel.
    */
   using vtkImplicitFunction::EvaluateFunction;
+  void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
   double EvaluateFunction(double x[3]) override;
+  ///@}
 
   /**
    * Evaluate the gradient of the box.
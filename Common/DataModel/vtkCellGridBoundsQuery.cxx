@@ -36,6 +36,17 @@ void vtkCellGridBoundsQuery::Initialize()
   vtkMath::UninitializeBounds(this->Bounds.data());
 }
 
+void vtkCellGridBoundsQuery::Reduce(vtkCellGridQuery* threadLocalQuery)
+{
+  auto* local = vtkCellGridBoundsQuery::SafeDownCast(threadLocalQuery);
+  if (!local)
+  {
+    return;
+  }
+  vtkBoundingBox bbox(local->Bounds.data());
+  this->AddBounds(bbox);
+}
+
 void vtkCellGridBoundsQuery::GetBounds(double* bds)
 {
   if (!bds)
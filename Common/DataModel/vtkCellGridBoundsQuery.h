@@ -37,6 +37,8 @@ public:
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
   void Initialize() override;
+  vtkCellGridQuery* NewThreadLocalQuery() override { return vtkCellGridBoundsQuery::New(); }
+  void Reduce(vtkCellGridQuery* threadLocalQuery) override;
   void GetBounds(double* bds) VTK_SIZEHINT(6);
   void AddBounds(vtkBoundingBox& bbox);
 
@@ -25,6 +25,11 @@
  * The responders have an opportunity to modify the state of the query object,
  * so these methods are a chance to prepare your query's state and then perform
  * reduce-like computations after all the cells have been handled.
+ *
+ * Queries whose results can be computed for subsets of cells and then combined
+ * should override NewThreadLocalQuery() and Reduce(). Responders then process
+ * ranges of cells concurrently (see vtkCellGridResponder::ForEachCellRange()),
+ * each thread filling its own query which is reduced into this one.
  */
 
 #ifndef vtkCellGridQuery_h
@@ -50,6 +55,22 @@ public:
   /// Override this if your query-result state requires finalization.
   virtual void Finalize() {}
 
+  /**
+   * Return a new query with the settings of this one, to be initialized and
+   * filled by a responder for a subset of the cells in one thread, then passed
+   * to Reduce(). The caller owns the returned reference.
+   *
+   * The default returns nullptr: the query cannot be split and responders
+   * process their cells serially.
+   */
+  virtual vtkCellGridQuery* NewThreadLocalQuery() { return nullptr; }
+
+  /**
+   * Combine the results of a query returned by NewThreadLocalQuery() into
+   * this query. Thread-local queries are reduced in no particular order.
+   */
+  virtual void Reduce(vtkCellGridQuery* vtkNotUsed(threadLocalQuery)) {}
+
 protected:
   vtkCellGridQuery() = default;
   ~vtkCellGridQuery() override = default;
@@ -17,12 +17,19 @@
  * @brief   Respond to a query on one particular type of cell.
  *
  * This is pure virtual base class that all responder types must inherit.
+ *
+ * Responders should loop over their cells with ForEachCellRange(), which
+ * processes ranges of cells concurrently when the query supports it.
  */
 
 #ifndef vtkCellGridResponder_h
 #define vtkCellGridResponder_h
 
+#include "vtkCellGridQuery.h"
 #include "vtkCellGridResponderBase.h"
+#include "vtkSMPThreadLocal.h" // For ForEachCellRange.
+#include "vtkSMPTools.h"       // For ForEachCellRange.
+#include "vtkSmartPointer.h"   // For ForEachCellRange.
 
 VTK_ABI_NAMESPACE_BEGIN
 template <typename QueryClass>
@@ -53,9 +60,67 @@ protected:
   vtkCellGridResponder() = default;
   ~vtkCellGridResponder() override = default;
 
+  /**
+   * Call \a functor(localQuery, begin, end) for consecutive ranges of the
+   * cells [0, \a numberOfCells[, where localQuery is the QueryClass* to fill
+   * with the responses for cells [begin, end[.
+   *
+   * When \a query provides thread-local queries, the ranges are processed
+   * concurrently with vtkSMPTools: each thread fills its own initialized
+   * thread-local query, which is then reduced into \a query. Otherwise,
+   * \a functor is called once for all the cells with \a query itself.
+   * The \a functor must only modify the query it is given.
+   */
+  template <typename Functor>
+  void ForEachCellRange(QueryClass* query, vtkIdType numberOfCells, Functor&& functor)
+  {
+    auto probe = vtk::TakeSmartPointer(query->NewThreadLocalQuery());
+    if (!QueryClass::SafeDownCast(probe))
+    {
+      functor(query, 0, numberOfCells);
+      return;
+    }
+    CellRangeWorker<Functor> worker(query, functor);
+    vtkSMPTools::For(0, numberOfCells, worker);
+  }
+
 private:
   vtkCellGridResponder(const vtkCellGridResponder&) = delete;
   void operator=(const vtkCellGridResponder&) = delete;
+
+  template <typename Functor>
+  struct CellRangeWorker
+  {
+    QueryClass* Query;
+    Functor& Function;
+    vtkSMPThreadLocal<vtkSmartPointer<QueryClass>> LocalQuery;
+
+    CellRangeWorker(QueryClass* query, Functor& function)
+      : Query(query)
+      , Function(function)
+    {
+    }
+
+    void Initialize()
+    {
+      auto& local = this->LocalQuery.Local();
+      local = vtk::TakeSmartPointer(QueryClass::SafeDownCast(this->Query->NewThreadLocalQuery()));
+      local->Initialize();
+    }
+
+    void operator()(vtkIdType begin, vtkIdType end)
+    {
+      this->Function(this->LocalQuery.Local().GetPointer(), begin, end);
+    }
+
+    void Reduce()
+    {
+      for (auto& local : this->LocalQuery)
+      {
+        this->Query->Reduce(local);
+      }
+    }
+  };
 };
 
 VTK_ABI_NAMESPACE_END
@@ -18,6 +18,8 @@
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 
+#include <utility>
+
 VTK_ABI_NAMESPACE_BEGIN
 
 vtkStandardNewMacro(vtkCellGridSidesQuery);
@@ -34,6 +36,34 @@ void vtkCellGridSidesQuery::Initialize()
   this->Hashes.clear();
 }
 
+void vtkCellGridSidesQuery::Reduce(vtkCellGridQuery* threadLocalQuery)
+{
+  auto* local = vtkCellGridSidesQuery::SafeDownCast(threadLocalQuery);
+  if (!local)
+  {
+    return;
+  }
+  if (this->Hashes.empty())
+  {
+    this->Hashes = std::move(local->Hashes);
+    local->Hashes.clear();
+    return;
+  }
+  for (auto& entry : local->Hashes)
+  {
+    auto& sides = this->Hashes[entry.first].Sides;
+    if (sides.empty())
+    {
+      sides = std::move(entry.second.Sides);
+    }
+    else
+    {
+      sides.insert(entry.second.Sides.begin(), entry.second.Sides.end());
+    }
+  }
+  local->Hashes.clear();
+}
+
 void vtkCellGridSidesQuery::Finalize()
 {
   this->Sides.clear();
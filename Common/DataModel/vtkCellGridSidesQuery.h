@@ -50,6 +50,8 @@ public:
 
   void Initialize() override;
   void Finalize() override;
+  vtkCellGridQuery* NewThreadLocalQuery() override { return vtkCellGridSidesQuery::New(); }
+  void Reduce(vtkCellGridQuery* threadLocalQuery) override;
 
   std::map<vtkStringToken,
     std::unordered_map<vtkStringToken, std::unordered_map<vtkIdType, std::set<int>>>>&
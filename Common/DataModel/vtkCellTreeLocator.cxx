@@ -24,6 +24,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <array>
@@ -304,6 +306,9 @@ struct CellPointTraversal
 //------------------------------------------------------------------------------
 // This class builds the CellTree according to the algorithm given in the paper.
 // This class is derived from the avtCellLocatorBIH class in VisIT.
+// The nodes with many cells are split one at a time, with parallel loops over
+// their cells. The smaller nodes are the roots of subtrees, which are built
+// in parallel with the serial algorithm.
 template <typename T>
 struct CellTreeBuilder
 {
@@ -333,6 +338,19 @@ private:
         this->Max = max;
       }
     }
+
+    inline void Merge(const Bucket& other)
+    {
+      this->Cnt += other.Cnt;
+      if (other.Min < this->Min)
+      {
+        this->Min = other.Min;
+      }
+      if (other.Max > this->Max)
+      {
+        this->Max = other.Max;
+      }
+    }
   };
 
   struct CellInfo
@@ -366,7 +384,7 @@ private:
     {
     }
 
-    inline bool operator()(const CellInfo& pc)
+    inline bool operator()(const CellInfo& pc) const
     {
       return pc.Min[this->D] + pc.Max[this->D] < this->P;
     }
@@ -388,6 +406,15 @@ private:
 
   using TCellTree = CellTree<T>;
   using TCellTreeNode = typename TCellTree::TCellTreeNode;
+  using NodeVector = std::vector<TCellTreeNode>;
+  using SplitStackType = std::stack<SplitInfo>;
+
+  // Nodes with more cells than this are split with parallel loops.
+  enum
+  {
+    ParallelSplitSize = 32768,
+    ChunkSize = 8192
+  };
 
   vtkCellTreeLocator* Locator;
   TCellTree& Tree;
@@ -396,8 +423,9 @@ private:
   int NumberOfNodesPerLeaf;
 
   std::vector<CellInfo> CellsInfo;
-  std::vector<CellTreeNode<T>> Nodes;
-  std::stack<SplitInfo> SplitStack;
+  std::vector<CellInfo> Scratch; // for the parallel partitions
+  NodeVector Nodes;
+  SplitStackType SplitStack;
 
   struct BucketsType : public std::array<std::vector<Bucket>, 3>
   {
@@ -451,26 +479,43 @@ private:
   }
 
   // -------------------------------------------------------------------------
-  void Split(T index, double min[3], double max[3], BucketsType& buckets)
+  void FindMinMaxInParallel(const CellInfo* begin, const CellInfo* end, double* min, double* max)
   {
-    const T& start = this->Nodes[index].Start();
-    const T& size = this->Nodes[index].Size();
-
-    if (size < this->NumberOfNodesPerLeaf)
+    if (begin == end)
     {
       return;
     }
 
-    CellInfo* begin = &(this->CellsInfo[start]);
-    CellInfo* end = this->CellsInfo.data() + start + size;
-    CellInfo* mid = begin;
-
-    const double ext[3] = { max[0] - min[0], max[1] - min[1], max[2] - min[2] };
-    const double iext[3] = { this->NumberOfBuckets / ext[0], this->NumberOfBuckets / ext[1],
-      this->NumberOfBuckets / ext[2] };
+    const std::array<double, 6> initial = { { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX,
+      -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX } };
+    vtkSMPThreadLocal<std::array<double, 6>> localMinMax(initial);
+    vtkSMPTools::For(0, end - begin, ChunkSize, [&](vtkIdType first, vtkIdType last) {
+      std::array<double, 6>& minMax = localMinMax.Local();
+      double chunkMin[3], chunkMax[3];
+      this->FindMinMax(begin + first, begin + last, chunkMin, chunkMax);
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        minMax[d] = std::min(minMax[d], chunkMin[d]);
+        minMax[d + 3] = std::max(minMax[d + 3], chunkMax[d]);
+      }
+    });
 
-    buckets.Reset();
+    std::copy(initial.begin(), initial.begin() + 3, min);
+    std::copy(initial.begin() + 3, initial.end(), max);
+    for (const std::array<double, 6>& minMax : localMinMax)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        min[d] = std::min(min[d], minMax[d]);
+        max[d] = std::max(max[d], minMax[d + 3]);
+      }
+    }
+  }
 
+  // -------------------------------------------------------------------------
+  void FillBuckets(const CellInfo* begin, const CellInfo* end, const double min[3],
+    const double iext[3], BucketsType& buckets)
+  {
     for (const CellInfo* pc = begin; pc != end; ++pc)
     {
       for (uint8_t d = 0; d < 3; ++d)
@@ -483,6 +528,103 @@ private:
         buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
       }
     }
+  }
+
+  // -------------------------------------------------------------------------
+  void FillBucketsInParallel(const CellInfo* begin, const CellInfo* end, const double min[3],
+    const double iext[3], BucketsType& buckets)
+  {
+    vtkSMPThreadLocal<BucketsType> localBuckets(BucketsType(this->NumberOfBuckets));
+    vtkSMPTools::For(0, end - begin, ChunkSize, [&](vtkIdType first, vtkIdType last) {
+      this->FillBuckets(begin + first, begin + last, min, iext, localBuckets.Local());
+    });
+
+    for (const BucketsType& local : localBuckets)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        for (int n = 0; n < this->NumberOfBuckets; ++n)
+        {
+          buckets[d][n].Merge(local[d][n]);
+        }
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // A stable partition: the cells of each chunk are counted, then scattered
+  // to the scratch array at the offsets given by the counts, and copied back.
+  CellInfo* PartitionInParallel(CellInfo* begin, CellInfo* end, const LeftPredicate& pred)
+  {
+    const vtkIdType size = end - begin;
+    const vtkIdType numChunks = (size + ChunkSize - 1) / ChunkSize;
+    std::vector<vtkIdType> leftOffsets(numChunks + 1, 0);
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType first, vtkIdType last) {
+      for (vtkIdType chunk = first; chunk < last; ++chunk)
+      {
+        CellInfo* chunkEnd = begin + std::min((chunk + 1) * ChunkSize, size);
+        leftOffsets[chunk + 1] = std::count_if(begin + chunk * ChunkSize, chunkEnd, pred);
+      }
+    });
+    for (vtkIdType chunk = 0; chunk < numChunks; ++chunk)
+    {
+      leftOffsets[chunk + 1] += leftOffsets[chunk];
+    }
+    const vtkIdType numLeft = leftOffsets[numChunks];
+
+    this->Scratch.resize(static_cast<size_t>(size));
+    CellInfo* scratch = this->Scratch.data();
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType first, vtkIdType last) {
+      for (vtkIdType chunk = first; chunk < last; ++chunk)
+      {
+        CellInfo* left = scratch + leftOffsets[chunk];
+        CellInfo* right = scratch + numLeft + chunk * ChunkSize - leftOffsets[chunk];
+        const CellInfo* chunkEnd = begin + std::min((chunk + 1) * ChunkSize, size);
+        for (const CellInfo* pc = begin + chunk * ChunkSize; pc != chunkEnd; ++pc)
+        {
+          *(pred(*pc) ? left++ : right++) = *pc;
+        }
+      }
+    });
+    vtkSMPTools::For(0, size, ChunkSize, [&](vtkIdType first, vtkIdType last) {
+      std::copy(scratch + first, scratch + last, begin + first);
+    });
+
+    return begin + numLeft;
+  }
+
+  // -------------------------------------------------------------------------
+  // Split the node at index, adding its children to the nodes and to the
+  // stack of nodes to split.
+  void Split(NodeVector& nodes, SplitStackType& splitStack, T index, double min[3],
+    double max[3], BucketsType& buckets, bool parallel)
+  {
+    const T& start = nodes[index].Start();
+    const T& size = nodes[index].Size();
+
+    if (size < this->NumberOfNodesPerLeaf)
+    {
+      return;
+    }
+
+    CellInfo* begin = &(this->CellsInfo[start]);
+    CellInfo* end = this->CellsInfo.data() + start + size;
+    CellInfo* mid = begin;
+
+    const double ext[3] = { max[0] - min[0], max[1] - min[1], max[2] - min[2] };
+    const double iext[3] = { this->NumberOfBuckets / ext[0], this->NumberOfBuckets / ext[1],
+      this->NumberOfBuckets / ext[2] };
+
+    buckets.Reset();
+
+    if (parallel)
+    {
+      this->FillBucketsInParallel(begin, end, min, iext, buckets);
+    }
+    else
+    {
+      this->FillBuckets(begin, end, min, iext, buckets);
+    }
 
     double cost = VTK_DOUBLE_MAX;
     double plane = VTK_DOUBLE_MIN; // bad value in case it doesn't get setx
@@ -539,7 +681,14 @@ private:
 
     if (cost != VTK_DOUBLE_MAX)
     {
-      mid = std::partition(begin, end, LeftPredicate(dim, plane));
+      if (parallel)
+      {
+        mid = this->PartitionInParallel(begin, end, LeftPredicate(dim, plane));
+      }
+      else
+      {
+        mid = std::partition(begin, end, LeftPredicate(dim, plane));
+      }
     }
 
     // fallback
@@ -553,8 +702,16 @@ private:
 
     double lMin[3], lMax[3], rMin[3], rMax[3];
 
-    this->FindMinMax(begin, mid, lMin, lMax);
-    this->FindMinMax(mid, end, rMin, rMax);
+    if (parallel)
+    {
+      this->FindMinMaxInParallel(begin, mid, lMin, lMax);
+      this->FindMinMaxInParallel(mid, end, rMin, rMax);
+    }
+    else
+    {
+      this->FindMinMax(begin, mid, lMin, lMax);
+      this->FindMinMax(mid, end, rMin, rMax);
+    }
 
     double clip[2] = { lMax[dim], rMin[dim] };
 
@@ -562,11 +719,11 @@ private:
     child[0].MakeLeaf(begin - this->CellsInfo.data(), mid - begin);
     child[1].MakeLeaf(mid - this->CellsInfo.data(), end - mid);
 
-    this->Nodes[index].MakeNode(static_cast<T>(this->Nodes.size()), dim, clip);
-    this->Nodes.insert(this->Nodes.end(), child, child + 2);
+    nodes[index].MakeNode(static_cast<T>(nodes.size()), dim, clip);
+    nodes.insert(nodes.end(), child, child + 2);
 
-    this->SplitStack.emplace(this->Nodes[index].GetRightChildIndex(), rMin, rMax);
-    this->SplitStack.emplace(this->Nodes[index].GetLeftChildIndex(), lMin, lMax);
+    splitStack.emplace(nodes[index].GetRightChildIndex(), rMin, rMax);
+    splitStack.emplace(nodes[index].GetLeftChildIndex(), lMin, lMax);
   }
 
 public:
@@ -581,35 +738,34 @@ public:
     const auto numberOfCells = static_cast<T>(this->DataSet->GetNumberOfCells());
     this->CellsInfo.resize(static_cast<size_t>(numberOfCells));
 
+    // The bounds of the first cell are computed serially, to cause the non
+    // thread safe initialization that GetCellBounds() may do.
+    auto setCellsInfo = [this](vtkIdType first, vtkIdType last) {
+      double cellBounds[6], *cellBoundsPtr;
+      for (vtkIdType i = first; i < last; ++i)
+      {
+        cellBoundsPtr = cellBounds;
+        this->CellsInfo[i].Ind = static_cast<T>(i);
+        this->Locator->GetCellBounds(i, cellBoundsPtr);
+
+        for (uint8_t d = 0; d < 3; ++d)
+        {
+          this->CellsInfo[i].Min[d] = cellBoundsPtr[2 * d + 0];
+          this->CellsInfo[i].Max[d] = cellBoundsPtr[2 * d + 1];
+        }
+      }
+    };
+    setCellsInfo(0, std::min<vtkIdType>(1, numberOfCells));
+    vtkSMPTools::For(1, numberOfCells, setCellsInfo);
+
     double min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
     double max[3] = {
       -VTK_DOUBLE_MAX,
       -VTK_DOUBLE_MAX,
       -VTK_DOUBLE_MAX,
     };
-
-    double cellBounds[6], *cellBoundsPtr;
-    cellBoundsPtr = cellBounds;
-    for (T i = 0; i < numberOfCells; ++i)
-    {
-      this->CellsInfo[i].Ind = i;
-      this->Locator->GetCellBounds(i, cellBoundsPtr);
-
-      for (uint8_t d = 0; d < 3; ++d)
-      {
-        this->CellsInfo[i].Min[d] = cellBoundsPtr[2 * d + 0];
-        this->CellsInfo[i].Max[d] = cellBoundsPtr[2 * d + 1];
-
-        if (this->CellsInfo[i].Min[d] < min[d])
-        {
-          min[d] = this->CellsInfo[i].Min[d];
-        }
-        if (this->CellsInfo[i].Max[d] > max[d])
-        {
-          max[d] = this->CellsInfo[i].Max[d];
-        }
-      }
-    }
+    this->FindMinMaxInParallel(
+      this->CellsInfo.data(), this->CellsInfo.data() + this->CellsInfo.size(), min, max);
 
     this->Tree.DataBBox[0] = min[0];
     this->Tree.DataBBox[1] = max[0];
@@ -633,12 +789,69 @@ public:
 
   void operator()()
   {
-    auto& buckets = this->Buckets;
+    // Split the large nodes with parallel loops, and keep the other nodes
+    // as the roots of the subtrees.
+    std::vector<SplitInfo> subtrees;
     while (!this->SplitStack.empty())
     {
       auto splitInfo = std::move(this->SplitStack.top());
       this->SplitStack.pop();
-      this->Split(splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets);
+      if (this->Nodes[splitInfo.Index].Size() > ParallelSplitSize)
+      {
+        this->Split(this->Nodes, this->SplitStack, splitInfo.Index, splitInfo.Min, splitInfo.Max,
+          this->Buckets, true);
+      }
+      else
+      {
+        subtrees.push_back(std::move(splitInfo));
+      }
+    }
+    this->Scratch = std::vector<CellInfo>();
+
+    // Build each subtree in its own vector of nodes, starting from its root.
+    std::vector<NodeVector> subtreeNodes(subtrees.size());
+    vtkSMPThreadLocal<BucketsType> localBuckets(BucketsType(this->NumberOfBuckets));
+    vtkSMPTools::For(0, static_cast<vtkIdType>(subtrees.size()), 1,
+      [&](vtkIdType first, vtkIdType last) {
+        BucketsType& buckets = localBuckets.Local();
+        SplitStackType splitStack;
+        for (vtkIdType i = first; i < last; ++i)
+        {
+          NodeVector& nodes = subtreeNodes[i];
+          nodes.push_back(this->Nodes[subtrees[i].Index]);
+          splitStack.emplace(0, subtrees[i].Min, subtrees[i].Max);
+          while (!splitStack.empty())
+          {
+            auto splitInfo = std::move(splitStack.top());
+            splitStack.pop();
+            this->Split(
+              nodes, splitStack, splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets, false);
+          }
+        }
+      });
+
+    // Append the nodes of the subtrees, the root of each subtree replacing
+    // the node that it was built from.
+    for (size_t i = 0; i < subtrees.size(); ++i)
+    {
+      const NodeVector& nodes = subtreeNodes[i];
+      const T offset = static_cast<T>(this->Nodes.size()) - 1;
+      for (size_t n = 0; n < nodes.size(); ++n)
+      {
+        TCellTreeNode node = nodes[n];
+        if (node.IsNode())
+        {
+          node.SetChildren(node.GetLeftChildIndex() + offset);
+        }
+        if (n == 0)
+        {
+          this->Nodes[subtrees[i].Index] = node;
+        }
+        else
+        {
+          this->Nodes.push_back(node);
+        }
+      }
     }
   }
 
@@ -660,12 +873,14 @@ public:
       ni->SetChildren(nn - this->Tree.Nodes.begin() - 2);
     }
 
-    const auto numberOfCells = static_cast<size_t>(this->DataSet->GetNumberOfCells());
-    this->Tree.Leaves.resize(numberOfCells);
-    for (size_t i = 0; i < numberOfCells; ++i)
-    {
-      this->Tree.Leaves[i] = this->CellsInfo[i].Ind;
-    }
+    const auto numberOfCells = static_cast<vtkIdType>(this->DataSet->GetNumberOfCells());
+    this->Tree.Leaves.resize(static_cast<size_t>(numberOfCells));
+    vtkSMPTools::For(0, numberOfCells, [this](vtkIdType first, vtkIdType last) {
+      for (vtkIdType i = first; i < last; ++i)
+      {
+        this->Tree.Leaves[i] = this->CellsInfo[i].Ind;
+      }
+    });
     this->CellsInfo.clear();
   }
 };
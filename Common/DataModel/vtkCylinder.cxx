@@ -13,12 +13,46 @@
 
 =========================================================================*/
 #include "vtkCylinder.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCylinder);
 
+namespace
+{
+// Evaluate the cylinder equation at the tuples of an array, in parallel.
+struct CylinderWorker
+{
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output, const double center[3],
+    const double axis[3], double radius)
+  {
+    using OutputValueType = vtk::GetAPIType<OutputArrayType>;
+    const double c0 = center[0], c1 = center[1], c2 = center[2];
+    const double a0 = axis[0], a1 = axis[1], a2 = axis[2];
+    const double r2 = radius * radius;
+
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      const auto points = vtk::DataArrayTupleRange<3>(input, begin, end);
+      auto values = vtk::DataArrayValueRange<1>(output, begin, end);
+      auto value = values.begin();
+      for (const auto point : points)
+      {
+        const double d0 = static_cast<double>(point[0]) - c0;
+        const double d1 = static_cast<double>(point[1]) - c1;
+        const double d2 = static_cast<double>(point[2]) - c2;
+        const double proj = a0 * d0 + a1 * d1 + a2 * d2;
+        *value++ = static_cast<OutputValueType>(((d0 * d0 + d1 * d1 + d2 * d2) - proj * proj) - r2);
+      }
+    });
+  }
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Construct cylinder radius of 0.5.
 vtkCylinder::vtkCylinder()
@@ -49,6 +83,22 @@ double vtkCylinder::EvaluateFunction(double x[3])
   return ((vtkMath::Dot(x2C, x2C) - proj * proj) - this->Radius * this->Radius);
 }
 
+//------------------------------------------------------------------------------
+void vtkCylinder::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
+
+  CylinderWorker worker;
+  using Dispatcher =
+    vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals, vtkArrayDispatch::Reals>;
+  if (!Dispatcher::Execute(input, output, worker, this->Center, this->Axis, this->Radius))
+  {
+    // Use vtkDataArray API if dispatch fails.
+    worker(input, output, this->Center, this->Axis, this->Radius);
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate cylinder function gradient (along potentially oriented axis). The
 // gradient is always in the radial direction, and thus must be projected
@@ -57,8 +57,10 @@ public:
   ///@{
   /**
    * Evaluate cylinder equation F(r) = r^2 - Radius^2.
+   * The points of a float or double array are evaluated in parallel.
    */
   using vtkImplicitFunction::EvaluateFunction;
+  void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
   double EvaluateFunction(double x[3]) override;
   ///@}
 
@@ -246,6 +246,21 @@ double* vtkDataSet::GetScalarRange()
   return this->ScalarRange;
 }
 
+//------------------------------------------------------------------------------
+void vtkDataSet::PrepareForMultithreadedAccess()
+{
+  this->ComputeBounds();
+  this->ComputeScalarRange();
+  if (this->GetNumberOfCells() > 0)
+  {
+    // builds the structures behind the cell queries, such as the cells of
+    // vtkPolyData
+    this->GetCellType(0);
+    vtkNew<vtkGenericCell> cell;
+    this->GetCell(0, cell);
+  }
+}
+
 //------------------------------------------------------------------------------
 // Return a pointer to the geometry bounding box in the form
 // (xmin,xmax, ymin,ymax, zmin,zmax).
@@ -329,6 +344,12 @@ vtkMTimeType vtkDataSet::GetMTime()
   return (mtime > result ? mtime : result);
 }
 
+//------------------------------------------------------------------------------
+vtkMTimeType vtkDataSet::GetMeshMTime()
+{
+  return this->vtkObject::GetMTime();
+}
+
 //------------------------------------------------------------------------------
 vtkCell* vtkDataSet::FindAndGetCell(double x[3], vtkCell* cell, vtkIdType cellId, double tol2,
   int& subId, double pcoords[3], double* weights)
@@ -288,6 +288,17 @@ public:
    */
   vtkMTimeType GetMTime() override;
 
+  /**
+   * Return the mesh (geometry/topology) modification time.
+   * This time is different from the usual MTime which also takes into
+   * account the modification of the point, cell and field data. It lets
+   * consumers tell a change of the mesh from a change of the attributes
+   * only. The default implementation returns the MTime of the data set
+   * itself, which every change to its structure updates.
+   * THIS METHOD IS THREAD SAFE
+   */
+  virtual vtkMTimeType GetMeshMTime();
+
   /**
    * Return a pointer to this dataset's cell data.
    * THIS METHOD IS THREAD SAFE
@@ -312,6 +323,20 @@ public:
    */
   virtual void ComputeBounds();
 
+  /**
+   * Build the internal structures that the queries documented as thread safe
+   * if first called from a single thread build on demand: the bounds, the
+   * scalar range, the cells and, in the subclasses, the links and the point
+   * locator. Afterwards these queries (GetCell(cellId, vtkGenericCell*),
+   * GetCellType(), GetCellPoints(cellId, npts, pts, ptIds), GetCellBounds(),
+   * GetPointCells(), GetCellNeighbors(), GetBounds(double[6]), FindPoint(),
+   * FindCell(..., vtkGenericCell*, ...)) only read the data set and can be
+   * called from several threads at once without any locking, as long as
+   * the data set is not modified. Call it again after modifying the data set.
+   * THIS METHOD IS NOT THREAD SAFE.
+   */
+  virtual void PrepareForMultithreadedAccess();
+
   /**
    * Return a pointer to the geometry bounding box in the form
    * (xmin,xmax, ymin,ymax, zmin,zmax).
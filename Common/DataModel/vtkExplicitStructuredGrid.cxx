@@ -504,6 +504,16 @@ void vtkExplicitStructuredGrid::SetExtent(int extent[6])
   this->SetExtent(extent[0], extent[1], extent[2], extent[3], extent[4], extent[5]);
 }
 
+//------------------------------------------------------------------------------
+void vtkExplicitStructuredGrid::PrepareForMultithreadedAccess()
+{
+  if (!this->Links)
+  {
+    this->BuildLinks();
+  }
+  this->Superclass::PrepareForMultithreadedAccess();
+}
+
 //------------------------------------------------------------------------------
 void vtkExplicitStructuredGrid::BuildLinks()
 {
@@ -169,6 +169,12 @@ public:
    */
   void BuildLinks();
 
+  /**
+   * Also build the links if they are missing. See
+   * vtkDataSet::PrepareForMultithreadedAccess().
+   */
+  void PrepareForMultithreadedAccess() override;
+
   ///@{
   /**
    * Set/Get the links that you created possibly without using BuildLinks.
@@ -307,6 +313,14 @@ public:
    */
   unsigned long GetActualMemorySize() override;
 
+  /**
+   * Overwritten to also handle the data/links loop.
+   */
+  bool UsesGarbageCollector() const override
+  {
+    return this->Links != nullptr || this->Superclass::UsesGarbageCollector();
+  }
+
   /**
    * Check faces are numbered correctly regarding ijk numbering
    * If not this will reorganize cell points order
@@ -21,21 +21,49 @@
 #include "vtkInformation.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPTools.h"
+#include "vtkStringToken.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <array>
+#include <atomic>
+#include <cstring>
 #include <limits>
+#include <mutex>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkFieldData);
 vtkStandardExtendedNewMacro(vtkFieldData);
 
+// The index of the arrays by name is built when looking up an array, and
+// invalidated whenever the arrays of the field change, but AddArray() keeps it
+// up to date. As several threads may look up arrays at the same time, it is
+// only built under the mutex while invalid, and never changed while valid.
+// The field data is not notified when its arrays are renamed, so renames are
+// detected by comparing the name times of the arrays with the time the index
+// was last known to be up to date.
+struct vtkFieldData::vtkNameIndex
+{
+  // the first array with each name hash
+  std::unordered_map<vtkStringToken::Hash, int> Indices;
+  int NumberOfArrays = 0;
+  std::atomic<bool> Valid{ false };
+  std::atomic<vtkMTimeType> NameTime{ 0 };
+  std::mutex Mutex;
+};
+
 namespace
 {
 using CachedGhostRangeType = std::tuple<vtkMTimeType, vtkMTimeType, std::vector<double>>;
 
+//------------------------------------------------------------------------------
+vtkStringToken::Hash HashName(const char* name)
+{
+  return vtkStringToken::StringHash(name, std::strlen(name));
+}
+
 //------------------------------------------------------------------------------
 // This function is used to generalize the call to vtkDataArray::GetRange
 // and vtkDataArray::GetFiniteRange without having to copy / paste.
@@ -260,6 +288,8 @@ vtkFieldData::vtkFieldData()
   this->GhostsToSkip = 0;
   this->GhostArray = nullptr;
 
+  this->NameIndex = new vtkNameIndex;
+
   this->CopyAllOn();
 }
 
@@ -268,6 +298,7 @@ vtkFieldData::~vtkFieldData()
 {
   this->Initialize();
   this->ClearFieldFlags();
+  delete this->NameIndex;
 }
 
 //------------------------------------------------------------------------------
@@ -288,6 +319,7 @@ void vtkFieldData::InitializeFields()
   this->GhostArray = nullptr;
   this->NumberOfArrays = 0;
   this->NumberOfActiveArrays = 0;
+  this->NameIndex->Valid = false;
   this->Modified();
 }
 
@@ -404,6 +436,7 @@ void vtkFieldData::AllocateArrays(int num)
       }
     }
     this->NumberOfArrays = num;
+    this->NameIndex->Valid = false;
   }
   else // num > this->NumberOfArrays
   {
@@ -489,6 +522,7 @@ void vtkFieldData::SetArray(int i, vtkAbstractArray* data)
       std::get<2>(range[1]).resize(2 * data->GetNumberOfComponents());
       this->Data[i]->Register(this);
     }
+    this->NameIndex->Valid = false;
     this->Modified();
   }
 }
@@ -630,6 +664,22 @@ vtkAbstractArray* vtkFieldData::GetAbstractArray(const char* arrayName, int& ind
   {
     return nullptr;
   }
+  if (this->UpdateNameIndex())
+  {
+    const auto& indices = this->NameIndex->Indices;
+    auto iter = indices.find(::HashName(arrayName));
+    if (iter == indices.end())
+    {
+      return nullptr;
+    }
+    const char* name = this->GetArrayName(iter->second);
+    if (name && (strcmp(name, arrayName) == 0))
+    {
+      index = iter->second;
+      return this->Data[index];
+    }
+    // another name with the same hash, compare all the names.
+  }
   for (int i = 0; i < this->GetNumberOfArrays(); ++i)
   {
     const char* name = this->GetArrayName(i);
@@ -650,18 +700,79 @@ int vtkFieldData::AddArray(vtkAbstractArray* array)
     return -1;
   }
 
+  // rebuild the index if arrays were renamed, so that it can be kept up to date.
+  if (!this->UpdateNameIndex())
+  {
+    this->NameIndex->Valid = false;
+    this->UpdateNameIndex();
+  }
+
+  const char* name = array->GetName();
   int index;
-  this->GetAbstractArray(array->GetName(), index);
+  this->GetAbstractArray(name, index);
 
-  if (index == -1)
+  const bool append = index == -1;
+  if (append)
   {
     index = this->NumberOfActiveArrays;
     this->NumberOfActiveArrays++;
   }
   this->SetArray(index, array);
+
+  // an array replaced by another one has the same name.
+  if (append && name)
+  {
+    this->NameIndex->Indices.emplace(::HashName(name), index);
+  }
+  this->NameIndex->NumberOfArrays = this->NumberOfActiveArrays;
+  this->NameIndex->Valid = true;
   return index;
 }
 
+//------------------------------------------------------------------------------
+bool vtkFieldData::UpdateNameIndex()
+{
+  vtkNameIndex& nameIndex = *this->NameIndex;
+  if (!nameIndex.Valid.load(std::memory_order_acquire) ||
+    nameIndex.NumberOfArrays != this->GetNumberOfArrays())
+  {
+    std::lock_guard<std::mutex> lock(nameIndex.Mutex);
+    if (!nameIndex.Valid.load(std::memory_order_relaxed) ||
+      nameIndex.NumberOfArrays != this->GetNumberOfArrays())
+    {
+      nameIndex.NameTime = vtkAbstractArray::GetLatestNameTime();
+      nameIndex.Indices.clear();
+      for (int i = 0; i < this->GetNumberOfArrays(); ++i)
+      {
+        const char* name = this->GetArrayName(i);
+        if (name)
+        {
+          nameIndex.Indices.emplace(::HashName(name), i);
+        }
+      }
+      nameIndex.NumberOfArrays = this->GetNumberOfArrays();
+      nameIndex.Valid.store(true, std::memory_order_release);
+    }
+  }
+
+  // Arrays were named since the index was known to be up to date. If none of
+  // them is ours, it is still up to date.
+  const vtkMTimeType latestNameTime = vtkAbstractArray::GetLatestNameTime();
+  const vtkMTimeType nameTime = nameIndex.NameTime;
+  if (latestNameTime != nameTime)
+  {
+    for (int i = 0; i < this->GetNumberOfArrays(); ++i)
+    {
+      if (this->Data[i] && this->Data[i]->GetNameTime() > nameTime)
+      {
+        return false;
+      }
+    }
+    nameIndex.NameTime = latestNameTime;
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 bool vtkFieldData::GetRange(const char* name, double range[2], int comp)
 {
@@ -737,6 +848,7 @@ void vtkFieldData::RemoveArray(int index)
   this->Ranges[this->NumberOfActiveArrays] = std::array<CachedGhostRangeType, 2>();
   this->FiniteRanges[this->NumberOfActiveArrays] = std::array<CachedGhostRangeType, 2>();
   this->Data[this->NumberOfActiveArrays] = nullptr;
+  this->NameIndex->Valid = false;
   this->Modified();
 }
 
@@ -179,7 +179,8 @@ public:
    * Return the array with the name given. Returns nullptr if array not found.
    * Unlike GetArray(), this method returns a vtkAbstractArray and can be used
    * to access any array type. Also returns index of array if found, -1
-   * otherwise.
+   * otherwise. The arrays are found from an index of the hashes of their
+   * names, so that the time taken does not depend on the number of arrays.
    */
   vtkAbstractArray* GetAbstractArray(const char* arrayName, int& index);
 
@@ -487,6 +488,16 @@ private:
   vtkFieldData(const vtkFieldData&) = delete;
   void operator=(const vtkFieldData&) = delete;
 
+  /**
+   * Build the index of the arrays by name if needed. Return false if arrays
+   * were renamed since it was built, in which case it cannot be used until
+   * the arrays of the field change.
+   */
+  bool UpdateNameIndex();
+
+  struct vtkNameIndex;
+  vtkNameIndex* NameIndex;
+
 public:
   class VTKCOMMONDATAMODEL_EXPORT BasicIterator
   {
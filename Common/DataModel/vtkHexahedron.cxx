@@ -27,6 +27,7 @@
 #include "vtkPolygon.h"
 #include "vtkQuad.h"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -64,34 +65,19 @@ vtkHexahedron::~vtkHexahedron()
   this->Quad->Delete();
 }
 
+namespace
+{
 //------------------------------------------------------------------------------
-//  Method to calculate parametric coordinates in an eight noded
-//  linear hexahedron element from global coordinates.
-//
-int vtkHexahedron::EvaluatePosition(const double x[3], double closestPoint[3], int& subId,
-  double pcoords[3], double& dist2, double weights[])
+// Scale for an acceptable determinant of the Jacobian, from a bound on the
+// volume of the hexahedron.
+double DeterminantTolerance(const double* pts)
 {
-  double params[3] = { 0.5, 0.5, 0.5 };
-  double derivs[24];
-
-  // Efficient point access
-  const auto pointsArray = vtkDoubleArray::FastDownCast(this->Points->GetData());
-  if (!pointsArray)
-  {
-    vtkErrorMacro(<< "Points should be double type");
-    return 0;
-  }
-  const double* pts = pointsArray->GetPointer(0);
-
-  const double *pt0, *pt1;
-
-  // compute a bound on the volume to get a scale for an acceptable determinant
   vtkIdType diagonals[4][2] = { { 0, 6 }, { 1, 7 }, { 2, 4 }, { 3, 5 } };
   double longestDiagonal = 0;
   for (int i = 0; i < 4; i++)
   {
-    pt0 = pts + 3 * diagonals[i][0];
-    pt1 = pts + 3 * diagonals[i][1];
+    const double* pt0 = pts + 3 * diagonals[i][0];
+    const double* pt1 = pts + 3 * diagonals[i][1];
     double d2 = vtkMath::Distance2BetweenPoints(pt0, pt1);
     if (longestDiagonal < d2)
     {
@@ -100,10 +86,19 @@ int vtkHexahedron::EvaluatePosition(const double x[3], double closestPoint[3], i
   }
   // longestDiagonal value is already squared
   double volumeBound = longestDiagonal * std::sqrt(longestDiagonal);
-  double determinantTolerance = 1e-20 < .00001 * volumeBound ? 1e-20 : .00001 * volumeBound;
+  return 1e-20 < .00001 * volumeBound ? 1e-20 : .00001 * volumeBound;
+}
+
+//------------------------------------------------------------------------------
+// Compute the parametric coordinates of x with Newton's method. Returns 1 if
+// x is inside the hexahedron, 0 if it is outside and -1 if the method failed.
+int ComputeParametricCoordinates(const double* pts, const double x[3],
+  double determinantTolerance, double pcoords[3], double weights[8])
+{
+  double params[3] = { 0.5, 0.5, 0.5 };
+  double derivs[24];
 
   //  set initial position for Newton's method
-  subId = 0;
   pcoords[0] = pcoords[1] = pcoords[2] = 0.5;
 
   //  enter iteration loop
@@ -180,8 +175,36 @@ int vtkHexahedron::EvaluatePosition(const double x[3], double closestPoint[3], i
 
   double lowerlimit = 0.0 - VTK_HEX_OUTSIDE_CELL_TOLERANCE;
   double upperlimit = 1.0 + VTK_HEX_OUTSIDE_CELL_TOLERANCE;
-  if (pcoords[0] >= lowerlimit && pcoords[0] <= upperlimit && pcoords[1] >= lowerlimit &&
-    pcoords[1] <= upperlimit && pcoords[2] >= lowerlimit && pcoords[2] <= upperlimit)
+  return pcoords[0] >= lowerlimit && pcoords[0] <= upperlimit && pcoords[1] >= lowerlimit &&
+    pcoords[1] <= upperlimit && pcoords[2] >= lowerlimit && pcoords[2] <= upperlimit;
+}
+}
+
+//------------------------------------------------------------------------------
+//  Method to calculate parametric coordinates in an eight noded
+//  linear hexahedron element from global coordinates.
+//
+int vtkHexahedron::EvaluatePosition(const double x[3], double closestPoint[3], int& subId,
+  double pcoords[3], double& dist2, double weights[])
+{
+  // Efficient point access
+  const auto pointsArray = vtkDoubleArray::FastDownCast(this->Points->GetData());
+  if (!pointsArray)
+  {
+    vtkErrorMacro(<< "Points should be double type");
+    return 0;
+  }
+  const double* pts = pointsArray->GetPointer(0);
+
+  subId = 0;
+  const int inside =
+    ::ComputeParametricCoordinates(pts, x, ::DeterminantTolerance(pts), pcoords, weights);
+  if (inside == -1)
+  {
+    return -1;
+  }
+
+  if (inside == 1)
   {
     if (closestPoint)
     {
@@ -219,6 +242,31 @@ int vtkHexahedron::EvaluatePosition(const double x[3], double closestPoint[3], i
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkHexahedron::EvaluatePositions(vtkIdType numPoints, const double* const x[3],
+  double* const pcoords[3], double* weights, int* inside)
+{
+  const auto pointsArray = vtkDoubleArray::FastDownCast(this->Points->GetData());
+  if (!pointsArray)
+  {
+    vtkErrorMacro(<< "Points should be double type");
+    std::fill(inside, inside + numPoints, 0);
+    return;
+  }
+  const double* pts = pointsArray->GetPointer(0);
+  const double determinantTolerance = ::DeterminantTolerance(pts);
+
+  for (vtkIdType i = 0; i < numPoints; i++)
+  {
+    const double p[3] = { x[0][i], x[1][i], x[2][i] };
+    double pc[3];
+    inside[i] = ::ComputeParametricCoordinates(pts, p, determinantTolerance, pc, weights + 8 * i);
+    pcoords[0][i] = pc[0];
+    pcoords[1][i] = pc[1];
+    pcoords[2][i] = pc[2];
+  }
+}
+
 //------------------------------------------------------------------------------
 // Compute iso-parametric interpolation functions
 //
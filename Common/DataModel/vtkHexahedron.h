@@ -122,6 +122,18 @@ public:
    */
   static int* GetTriangleCases(int caseId);
 
+  /**
+   * Compute the parametric coordinates and the interpolation weights of
+   * numPoints points with respect to this hexahedron, like EvaluatePosition()
+   * without the closest points. The coordinates of point i are x[0][i],
+   * x[1][i] and x[2][i], its parametric coordinates are returned the same way
+   * in pcoords and its weights in weights[8 * i] to weights[8 * i + 7]. inside[i]
+   * is set to the value EvaluatePosition() returns for point i. The tolerance of the
+   * Newton iterations is computed once for all the points.
+   */
+  void EvaluatePositions(vtkIdType numPoints, const double* const x[3], double* const pcoords[3],
+    double* weights, int* inside);
+
   static void InterpolationFunctions(const double pcoords[3], double weights[8]);
   static void InterpolationDerivs(const double pcoords[3], double derivs[24]);
   ///@{
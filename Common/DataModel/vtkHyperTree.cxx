@@ -27,6 +27,7 @@ PURPOSE.  See the above copyright notice for more information.
 #include <deque>
 #include <limits>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 //------------------------------------------------------------------------------
@@ -137,8 +138,42 @@ struct vtkCompactHyperTreeData
   // Storage to record the parent of each tree vertex
   std::vector<unsigned int> ParentToElderChild_stl;
 
+  // Once packed (see vtkHyperTree::PackStructures), the parents are a slice
+  // of a buffer shared by several trees, and ParentToElderChild_stl is empty
+  std::shared_ptr<const std::vector<unsigned int>> PackedBuffer;
+  size_t PackedOffset = 0;
+  size_t PackedSize = 0;
+
   // Storage to record the local to global id mapping
   std::vector<vtkIdType> GlobalIndexTable_stl;
+
+  const unsigned int* GetParentToElderChild() const
+  {
+    return this->PackedBuffer ? this->PackedBuffer->data() + this->PackedOffset
+                              : this->ParentToElderChild_stl.data();
+  }
+
+  size_t GetParentToElderChildSize() const
+  {
+    return this->PackedBuffer ? this->PackedSize : this->ParentToElderChild_stl.size();
+  }
+
+  // Move the parents back to the storage of the tree, before modifying them.
+  // keepValues is false when they are about to be overwritten.
+  void Unpack(bool keepValues = true)
+  {
+    if (this->PackedBuffer)
+    {
+      if (keepValues)
+      {
+        const unsigned int* first = this->PackedBuffer->data() + this->PackedOffset;
+        this->ParentToElderChild_stl.assign(first, first + this->PackedSize);
+      }
+      this->PackedBuffer = nullptr;
+      this->PackedOffset = 0;
+      this->PackedSize = 0;
+    }
+  }
 };
 
 //=============================================================================
@@ -196,7 +231,10 @@ public:
   void BuildFromBreadthFirstOrderDescriptor(
     vtkBitArray* descriptor, vtkIdType numberOfBits, vtkIdType startIndex) override
   {
+    this->CompactDatas->Unpack(false);
     this->CompactDatas->ParentToElderChild_stl.clear();
+    // One value per described vertex: a single allocation
+    this->CompactDatas->ParentToElderChild_stl.reserve(std::max(numberOfBits, vtkIdType(1)));
     int numberOfDepths = 1;
     vtkIdType numberOfCoarseVertices = 0;
     vtkIdType numberOfVertices = 1;
@@ -243,6 +281,7 @@ public:
     vtkIdType nbVerticesOfLastdepth, vtkBitArray* isParent, vtkBitArray* isMasked,
     vtkBitArray* outIsMasked) override
   {
+    this->CompactDatas->Unpack(false);
     if (isParent == nullptr)
     {
       this->CompactDatas->ParentToElderChild_stl.resize(1);
@@ -403,7 +442,7 @@ public:
   {
     assert("pre: valid_range" &&
       index_parent < static_cast<unsigned int>(this->Datas->NumberOfVertices));
-    return this->CompactDatas->ParentToElderChild_stl[index_parent];
+    return this->CompactDatas->GetParentToElderChild()[index_parent];
   }
 
   //---------------------------------------------------------------------------
@@ -412,8 +451,8 @@ public:
   // not modification.
   const unsigned int* GetElderChildIndexArray(size_t& nbElements) const override
   {
-    nbElements = this->CompactDatas->ParentToElderChild_stl.size();
-    return this->CompactDatas->ParentToElderChild_stl.data();
+    nbElements = this->CompactDatas->GetParentToElderChildSize();
+    return this->CompactDatas->GetParentToElderChild();
   }
 
   //---------------------------------------------------------------------------
@@ -423,6 +462,7 @@ public:
     assert("pre: not_leaf" && this->IsLeaf(index));
     // The leaf becomes a node and is not anymore a leaf
     // Nodes get constructed with leaf flags set to 1.
+    this->CompactDatas->Unpack();
     if (static_cast<vtkIdType>(this->CompactDatas->ParentToElderChild_stl.size()) <= index)
     {
       this->CompactDatas->ParentToElderChild_stl.resize(
@@ -448,7 +488,7 @@ public:
   {
     // in bytes
     return static_cast<unsigned long>(
-      sizeof(unsigned int) * this->CompactDatas->ParentToElderChild_stl.size() +
+      sizeof(unsigned int) * this->CompactDatas->GetParentToElderChildSize() +
       sizeof(vtkIdType) * this->CompactDatas->GlobalIndexTable_stl.size() +
       3 * sizeof(unsigned char) + 6 * sizeof(vtkIdType));
   }
@@ -457,7 +497,7 @@ public:
   bool IsTerminalNode(vtkIdType index) const override
   {
     assert("pre: valid_range" && index >= 0 && index < this->Datas->NumberOfVertices);
-    if (static_cast<unsigned long>(index) >= this->CompactDatas->ParentToElderChild_stl.size())
+    if (static_cast<unsigned long>(index) >= this->CompactDatas->GetParentToElderChildSize())
     {
       return false;
     }
@@ -476,8 +516,8 @@ public:
   bool IsLeaf(vtkIdType index) const override
   {
     assert("pre: valid_range" && index >= 0 && index < this->Datas->NumberOfVertices);
-    return static_cast<unsigned long>(index) >= this->CompactDatas->ParentToElderChild_stl.size() ||
-      this->CompactDatas->ParentToElderChild_stl[index] ==
+    return static_cast<unsigned long>(index) >= this->CompactDatas->GetParentToElderChildSize() ||
+      this->CompactDatas->GetParentToElderChild()[index] ==
       std::numeric_limits<unsigned int>::max() ||
       this->Datas->NumberOfVertices == 1;
   }
@@ -486,24 +526,21 @@ public:
   bool IsChildLeaf(vtkIdType index_parent, unsigned int ichild) const
   {
     assert("pre: valid_range" && index_parent >= 0 && index_parent < this->Datas->NumberOfVertices);
-    if (static_cast<unsigned long>(index_parent) >=
-      this->CompactDatas->ParentToElderChild_stl.size())
+    const size_t size = this->CompactDatas->GetParentToElderChildSize();
+    if (static_cast<unsigned long>(index_parent) >= size)
     {
       return false;
     }
     assert("pre: valid_range" && ichild < this->NumberOfChildren);
-    vtkIdType index_child = this->CompactDatas->ParentToElderChild_stl[index_parent] + ichild;
-    return static_cast<unsigned long>(index_child) >=
-      this->CompactDatas->ParentToElderChild_stl.size() ||
-      this->CompactDatas->ParentToElderChild_stl[index_child] ==
+    const unsigned int* parentToElderChild = this->CompactDatas->GetParentToElderChild();
+    vtkIdType index_child = parentToElderChild[index_parent] + ichild;
+    return static_cast<unsigned long>(index_child) >= size ||
+      parentToElderChild[index_child] ==
       std::numeric_limits<unsigned int>::max();
   }
 
   //---------------------------------------------------------------------------
-  const std::vector<unsigned int>& GetParentElderChild() const
-  {
-    return this->CompactDatas->ParentToElderChild_stl;
-  }
+  vtkCompactHyperTreeData* GetCompactData() const { return this->CompactDatas.get(); }
 
   //---------------------------------------------------------------------------
   const std::vector<vtkIdType>& GetGlobalIndexTable() const
@@ -519,6 +556,7 @@ protected:
   void InitializePrivate() override
   {
     // Set default tree structure with a single node at the root
+    this->CompactDatas->Unpack(false);
     this->CompactDatas->ParentToElderChild_stl.resize(1);
     this->CompactDatas->ParentToElderChild_stl[0] = 0;
     // By default, the root don't have parent
@@ -528,11 +566,13 @@ protected:
   //---------------------------------------------------------------------------
   void PrintSelfPrivate(ostream& os, vtkIndent indent) override
   {
-    os << indent << "ParentToElderChild: " << this->CompactDatas->ParentToElderChild_stl.size()
-       << endl;
-    for (unsigned int i = 0; i < this->CompactDatas->ParentToElderChild_stl.size(); ++i)
+    const size_t size = this->CompactDatas->GetParentToElderChildSize();
+    const unsigned int* parentToElderChild = this->CompactDatas->GetParentToElderChild();
+    os << indent << "ParentToElderChild: " << size
+       << (this->CompactDatas->PackedBuffer ? " (packed)" : "") << endl;
+    for (size_t i = 0; i < size; ++i)
     {
-      os << this->CompactDatas->ParentToElderChild_stl[i] << " ";
+      os << parentToElderChild[i] << " ";
     }
     os << endl;
 
@@ -612,4 +652,38 @@ vtkHyperTree* vtkHyperTree::CreateInstance(unsigned char factor, unsigned char d
   ht->Initialize(factor, dimension, pow(factor, dimension));
   return ht;
 }
+
+//------------------------------------------------------------------------------
+void vtkHyperTree::PackStructures(vtkHyperTree** trees, vtkIdType numberOfTrees)
+{
+  // Trees may share their structure (CopyStructure): pack each one once
+  std::vector<vtkCompactHyperTreeData*> datas;
+  std::unordered_set<vtkCompactHyperTreeData*> visited;
+  size_t size = 0;
+  for (vtkIdType i = 0; i < numberOfTrees; ++i)
+  {
+    vtkCompactHyperTree* tree = vtkCompactHyperTree::SafeDownCast(trees[i]);
+    if (tree && visited.insert(tree->GetCompactData()).second)
+    {
+      datas.push_back(tree->GetCompactData());
+      size += tree->GetCompactData()->GetParentToElderChildSize();
+    }
+  }
+
+  auto buffer = std::make_shared<std::vector<unsigned int>>();
+  buffer->reserve(size);
+  for (vtkCompactHyperTreeData* data : datas)
+  {
+    // the structure may already be packed, in another buffer
+    const unsigned int* first = data->GetParentToElderChild();
+    const size_t numberOfValues = data->GetParentToElderChildSize();
+    const size_t offset = buffer->size();
+    buffer->insert(buffer->end(), first, first + numberOfValues);
+    std::vector<unsigned int>().swap(data->ParentToElderChild_stl);
+    data->PackedBuffer = buffer;
+    data->PackedOffset = offset;
+    data->PackedSize = numberOfValues;
+    data->GlobalIndexTable_stl.shrink_to_fit();
+  }
+}
 VTK_ABI_NAMESPACE_END
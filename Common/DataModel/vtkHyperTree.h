@@ -374,6 +374,17 @@ public:
    */
   VTK_NEWINSTANCE
   static vtkHyperTree* CreateInstance(unsigned char branchFactor, unsigned char dimension);
+
+  /**
+   * Store the structures of the given trees, one after the other, in a single
+   * buffer shared by all of them, instead of one growing buffer per tree.
+   * This saves the allocations and the slack of the per tree buffers, and
+   * keeps the trees close in memory. Modifying a packed tree moves its
+   * structure back to a buffer of its own.
+   * This method is called by the Squeeze method of hypertree grid.
+   */
+  static void PackStructures(vtkHyperTree** trees, vtkIdType numberOfTrees);
+
   /**
    * Return memory used in bytes.
    * NB: Ignore the attribute array because its size is added by the data set.
@@ -50,6 +50,7 @@ PURPOSE.  See the above copyright notice for more information.
 #include <array>
 #include <cassert>
 #include <deque>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkInformationKeyMacro(vtkHyperTreeGrid, LEVELS, Integer);
@@ -319,6 +320,15 @@ void vtkHyperTreeGrid::Squeeze()
         htfreeze->UnRegister(this);
       }
     }
+
+    // Store the structures of all the trees in a single buffer
+    std::vector<vtkHyperTree*> trees;
+    trees.reserve(this->HyperTrees.size());
+    for (auto& it : this->HyperTrees)
+    {
+      trees.push_back(it.second);
+    }
+    vtkHyperTree::PackStructures(trees.data(), static_cast<vtkIdType>(trees.size()));
     this->FreezeState = true;
   }
 }
@@ -1471,12 +1481,14 @@ void vtkHyperTreeGrid::GetLevelZeroOriginAndSizeFromIndex(
   unsigned int i, j, k;
   this->GetLevelZeroCoordinatesFromIndex(treeindex, i, j, k);
 
+  // GetComponent, unlike GetTuple1, does not use the internal tuple of the
+  // arrays, and cursors may be initialized concurrently
   vtkDataArray* xCoords = this->XCoordinates;
   vtkDataArray* yCoords = this->YCoordinates;
   vtkDataArray* zCoords = this->ZCoordinates;
-  Origin[0] = xCoords->GetTuple1(i);
-  Origin[1] = yCoords->GetTuple1(j);
-  Origin[2] = zCoords->GetTuple1(k);
+  Origin[0] = xCoords->GetComponent(i, 0);
+  Origin[1] = yCoords->GetComponent(j, 0);
+  Origin[2] = zCoords->GetComponent(k, 0);
 
   if (this->Dimensions[0] == 1)
   {
@@ -1484,7 +1496,7 @@ void vtkHyperTreeGrid::GetLevelZeroOriginAndSizeFromIndex(
   }
   else
   {
-    Size[0] = xCoords->GetTuple1(i + 1) - Origin[0];
+    Size[0] = xCoords->GetComponent(i + 1, 0) - Origin[0];
   }
   if (this->Dimensions[1] == 1)
   {
@@ -1492,7 +1504,7 @@ void vtkHyperTreeGrid::GetLevelZeroOriginAndSizeFromIndex(
   }
   else
   {
-    Size[1] = yCoords->GetTuple1(j + 1) - Origin[1];
+    Size[1] = yCoords->GetComponent(j + 1, 0) - Origin[1];
   }
   if (this->Dimensions[2] == 1)
   {
@@ -1500,7 +1512,7 @@ void vtkHyperTreeGrid::GetLevelZeroOriginAndSizeFromIndex(
   }
   else
   {
-    Size[2] = zCoords->GetTuple1(k + 1) - Origin[2];
+    Size[2] = zCoords->GetComponent(k + 1, 0) - Origin[2];
   }
 }
 
@@ -1516,9 +1528,9 @@ void vtkHyperTreeGrid::GetLevelZeroOriginFromIndex(vtkIdType treeindex, double*
   vtkDataArray* xCoords = this->XCoordinates;
   vtkDataArray* yCoords = this->YCoordinates;
   vtkDataArray* zCoords = this->ZCoordinates;
-  Origin[0] = xCoords->GetTuple1(i);
-  Origin[1] = yCoords->GetTuple1(j);
-  Origin[2] = zCoords->GetTuple1(k);
+  Origin[0] = xCoords->GetComponent(i, 0);
+  Origin[1] = yCoords->GetComponent(j, 0);
+  Origin[2] = zCoords->GetComponent(k, 0);
 }
 
 //------------------------------------------------------------------------------
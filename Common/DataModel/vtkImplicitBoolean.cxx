@@ -14,14 +14,75 @@
 =========================================================================*/
 #include "vtkImplicitBoolean.h"
 
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
 #include "vtkImplicitFunctionCollection.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 
+#include <algorithm>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImplicitBoolean);
 
+namespace
+{
+// Combine the values of one of the functions into the values of the boolean,
+// like EvaluateFunction(double x[3]) does.
+void CombineValues(int operation, const double* values, double* combined, vtkIdType numValues)
+{
+  vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
+    switch (operation)
+    {
+      case vtkImplicitBoolean::VTK_UNION:
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          combined[i] = std::min(combined[i], values[i]);
+        }
+        break;
+      case vtkImplicitBoolean::VTK_INTERSECTION:
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          combined[i] = std::max(combined[i], values[i]);
+        }
+        break;
+      case vtkImplicitBoolean::VTK_UNION_OF_MAGNITUDES:
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          combined[i] = std::min(combined[i], std::fabs(values[i]));
+        }
+        break;
+      default: // difference
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          combined[i] = std::max(combined[i], -values[i]);
+        }
+        break;
+    }
+  });
+}
+
+// Copy the combined values to the output array.
+struct CopyWorker
+{
+  template <typename OutputArrayType>
+  void operator()(OutputArrayType* output, vtkDoubleArray* combined)
+  {
+    using OutputValueType = vtk::GetAPIType<OutputArrayType>;
+    vtkSMPTools::For(0, output->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      const auto src = vtk::DataArrayValueRange<1>(combined, begin, end);
+      auto dst = vtk::DataArrayValueRange<1>(output, begin, end);
+      std::transform(src.cbegin(), src.cend(), dst.begin(),
+        [](double value) { return static_cast<OutputValueType>(value); });
+    });
+  }
+};
+} // anonymous namespace
+
 // Construct with union operation.
 vtkImplicitBoolean::vtkImplicitBoolean()
 {
@@ -147,6 +208,59 @@ double vtkImplicitBoolean::EvaluateFunction(double x[3])
   return value;
 }
 
+// Evaluate boolean combinations of implicit function using current operator,
+// one function at a time for all the points of the input.
+void vtkImplicitBoolean::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  const vtkIdType numValues = input->GetNumberOfTuples();
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(numValues);
+  if (this->FunctionList->GetNumberOfItems() == 0)
+  {
+    output->Fill(0.0);
+    return;
+  }
+
+  // the values of the output are combined in place when they are doubles
+  vtkSmartPointer<vtkDoubleArray> combined = vtkDoubleArray::FastDownCast(output);
+  if (!combined)
+  {
+    combined = vtkSmartPointer<vtkDoubleArray>::New();
+    combined->SetNumberOfTuples(numValues);
+  }
+  vtkNew<vtkDoubleArray> values;
+  values->SetNumberOfTuples(numValues);
+
+  vtkCollectionSimpleIterator sit;
+  vtkImplicitFunction* f;
+  this->FunctionList->InitTraversal(sit);
+  if (this->OperationType == VTK_DIFFERENCE)
+  {
+    f = this->FunctionList->GetNextImplicitFunction(sit);
+    f->FunctionValue(input, combined);
+  }
+  else
+  {
+    combined->Fill(this->OperationType == VTK_INTERSECTION ? -VTK_DOUBLE_MAX : VTK_DOUBLE_MAX);
+  }
+  while ((f = this->FunctionList->GetNextImplicitFunction(sit)))
+  {
+    f->FunctionValue(input, values);
+    CombineValues(
+      this->OperationType, values->GetPointer(0), combined->GetPointer(0), numValues);
+  }
+
+  if (combined.GetPointer() != output)
+  {
+    CopyWorker worker;
+    if (!vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>::Execute(
+          output, worker, combined))
+    {
+      worker(output, combined.GetPointer()); // Use vtkDataArray API if dispatch fails.
+    }
+  }
+}
+
 // Evaluate gradient of boolean combination.
 void vtkImplicitBoolean::EvaluateGradient(double x[3], double g[3])
 {
@@ -63,8 +63,11 @@ public:
   ///@{
   /**
    * Evaluate boolean combinations of implicit function using current operator.
+   * The points of an array are evaluated by each function at once, using their
+   * own array evaluation, and the values are combined in parallel.
    */
   using vtkImplicitFunction::EvaluateFunction;
+  void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
   double EvaluateFunction(double x[3]) override;
   ///@}
 
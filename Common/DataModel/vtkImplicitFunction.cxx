@@ -18,6 +18,8 @@
 #include "vtkArrayDispatch.h"
 #include "vtkDataArrayRange.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
 #include "vtkTransform.h"
 
 #include <algorithm>
@@ -111,6 +113,18 @@ void vtkImplicitFunction::FunctionValue(vtkDataArray* input, vtkDataArray* outpu
   {
     this->EvaluateFunction(input, output);
   }
+  else if (input->GetNumberOfComponents() == 3)
+  {
+    // transform all the points at once to use the array evaluation of the subclass
+    vtkNew<vtkPoints> points;
+    points->SetData(input);
+    vtkNew<vtkPoints> transformed;
+    transformed->SetDataTypeToDouble();
+    this->Transform->TransformPoints(points, transformed);
+    output->SetNumberOfComponents(1);
+    output->SetNumberOfTuples(input->GetNumberOfTuples());
+    this->EvaluateFunction(transformed->GetData(), output);
+  }
   else // pass point through transform
   {
     FunctionWorker<TransformFunction> worker(TransformFunction(this, this->Transform));
@@ -67,6 +67,10 @@ public:
 
   static vtkIncrementalOctreePointLocator* New();
 
+  // Re-use any superclass signatures that we don't override.
+  using vtkAbstractPointLocator::FindClosestNPoints;
+  using vtkAbstractPointLocator::FindPointsWithinRadius;
+
   ///@{
   /**
    * Set/Get the maximum number of points that a leaf node may maintain.
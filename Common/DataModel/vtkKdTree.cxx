@@ -29,6 +29,7 @@
 #include "vtkDataSetCollection.h"
 #include "vtkFloatArray.h"
 #include "vtkGarbageCollector.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
@@ -40,6 +41,8 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -49,6 +52,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -656,52 +660,52 @@ float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
     }
   }
 
-  double* weights = new double[maxCellSize];
-
-  float* cptr = center;
-  double dcenter[3];
-
-  if (set)
-  {
-    for (int j = 0; j < totalCells; j++)
+  // The centers are computed in parallel, with a generic cell and weights
+  // per thread. The first cell is fetched serially, since GetCell() can
+  // build the cells of some data sets on its first call.
+  vtkSMPThreadLocalObject<vtkGenericCell> cells;
+  auto computeCenters = [&](vtkDataSet* data, float* cptr) {
+    int nCells = data->GetNumberOfCells();
+    if (nCells == 0)
     {
-      this->ComputeCellCenter(set->GetCell(j), dcenter, weights);
-      cptr[0] = static_cast<float>(dcenter[0]);
-      cptr[1] = static_cast<float>(dcenter[1]);
-      cptr[2] = static_cast<float>(dcenter[2]);
-      cptr += 3;
-      if (j % 1000 == 0)
+      return;
+    }
+    data->GetCell(0, cells.Local());
+    vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+      vtkGenericCell* cell = cells.Local();
+      std::vector<double> weights(maxCellSize);
+      double dcenter[3];
+      for (vtkIdType j = begin; j < end; j++)
       {
-        this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
+        data->GetCell(j, cell);
+        this->ComputeCellCenter(cell, dcenter, weights.data());
+        cptr[3 * j] = static_cast<float>(dcenter[0]);
+        cptr[3 * j + 1] = static_cast<float>(dcenter[1]);
+        cptr[3 * j + 2] = static_cast<float>(dcenter[2]);
       }
-    }
+    });
+  };
+
+  if (set)
+  {
+    computeCenters(set, center);
   }
   else
   {
+    float* cptr = center;
+    int doneCells = 0;
     vtkCollectionSimpleIterator cookie;
     this->DataSets->InitTraversal(cookie);
     for (vtkDataSet* iset = this->DataSets->GetNextDataSet(cookie); iset != nullptr;
          iset = this->DataSets->GetNextDataSet(cookie))
     {
-      int nCells = iset->GetNumberOfCells();
-
-      for (int j = 0; j < nCells; j++)
-      {
-        this->ComputeCellCenter(iset->GetCell(j), dcenter, weights);
-        cptr[0] = static_cast<float>(dcenter[0]);
-        cptr[1] = static_cast<float>(dcenter[1]);
-        cptr[2] = static_cast<float>(dcenter[2]);
-        cptr += 3;
-        if (j % 1000 == 0)
-        {
-          this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-        }
-      }
+      computeCenters(iset, cptr);
+      cptr += 3 * iset->GetNumberOfCells();
+      doneCells += iset->GetNumberOfCells();
+      this->UpdateSubOperationProgress(static_cast<double>(doneCells) / totalCells);
     }
   }
 
-  delete[] weights;
-
   this->UpdateSubOperationProgress(1.0);
   return center;
 }
@@ -931,7 +935,7 @@ void vtkKdTree::BuildLocatorInternal()
 
     this->ProgressOffset += this->ProgressScale;
     this->ProgressScale = 0.7;
-    this->DivideRegion(kd, ptarray, nullptr, 0);
+    this->DivideRegionInParallel(kd, ptarray, nullptr);
 
     TIMERDONE("Build tree");
 
@@ -1274,13 +1278,13 @@ int vtkKdTree::DivideTest(int size, int level)
 }
 
 //------------------------------------------------------------------------------
-int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+bool vtkKdTree::SplitRegion(vtkKdNode* kd, float* c1, int* ids, int level)
 {
   int ok = this->DivideTest(kd->GetNumberOfPoints(), level);
 
   if (!ok)
   {
-    return 0;
+    return false;
   }
 
   int maxdim = this->SelectCutDirection(kd);
@@ -1329,9 +1333,15 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
 
   this->DoMedianFind(kd, c1, ids, dim1, dim2, dim3);
 
-  if (kd->GetLeft() == nullptr)
+  return kd->GetLeft() != nullptr; // or unable to divide region further
+}
+
+//------------------------------------------------------------------------------
+int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+{
+  if (!this->SplitRegion(kd, c1, ids, level))
   {
-    return 0; // unable to divide region further
+    return 0;
   }
 
   int nleft = kd->GetLeft()->GetNumberOfPoints();
@@ -1346,6 +1356,61 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// The upper levels are split breadth first, until there are enough regions
+// to keep the threads busy. The regions own disjoint ranges of the centers
+// and ids, so their subtrees are then divided in parallel. The tree is the
+// same as the one built by DivideRegion() alone.
+void vtkKdTree::DivideRegionInParallel(vtkKdNode* kd, float* c1, int* ids)
+{
+  struct Region
+  {
+    vtkKdNode* Node;
+    float* Centers;
+    int* Ids;
+    int Level;
+  };
+
+  const size_t targetRegions =
+    8 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  const int minPoints = 4096; // smaller regions are not worth a task of their own
+
+  std::vector<Region> regions(1, Region{ kd, c1, ids, 0 });
+  std::vector<Region> next;
+  bool divided = true;
+  while (divided && regions.size() < targetRegions)
+  {
+    divided = false;
+    next.clear();
+    for (const Region& r : regions)
+    {
+      if (r.Node->GetNumberOfPoints() >= minPoints &&
+        this->SplitRegion(r.Node, r.Centers, r.Ids, r.Level))
+      {
+        int nleft = r.Node->GetLeft()->GetNumberOfPoints();
+        next.push_back(Region{ r.Node->GetLeft(), r.Centers, r.Ids, r.Level + 1 });
+        next.push_back(Region{ r.Node->GetRight(), r.Centers + nleft * 3,
+          r.Ids ? r.Ids + nleft : nullptr, r.Level + 1 });
+        divided = true;
+      }
+      else
+      {
+        next.push_back(r);
+      }
+    }
+    regions.swap(next);
+  }
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(regions.size()), 1,
+    [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        const Region& r = regions[i];
+        this->DivideRegion(r.Node, r.Centers, r.Ids, r.Level);
+      }
+    });
+}
+
 //------------------------------------------------------------------------------
 // Rearrange the point array.  Try dim1 first.  If there's a problem
 // go to dim2, then dim3.
@@ -1892,7 +1957,7 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
 
   TIMER("Build tree");
 
-  this->DivideRegion(kd, points, ptIds, 0);
+  this->DivideRegionInParallel(kd, points, ptIds);
 
   this->SetActualLevel();
   this->BuildRegionList();
@@ -783,6 +783,14 @@ protected:
 
   int DivideRegion(vtkKdNode* kd, float* c1, int* ids, int nlevels);
 
+  // Split a region in two at the median of its centers, if it passes
+  // DivideTest(). Returns false if the region was not split.
+  bool SplitRegion(vtkKdNode* kd, float* c1, int* ids, int level);
+
+  // Divide the region like DivideRegion(), with the subtrees of the upper
+  // levels divided in parallel.
+  void DivideRegionInParallel(vtkKdNode* kd, float* c1, int* ids);
+
   void DoMedianFind(vtkKdNode* kd, float* c1, int* ids, int d1, int d2, int d3);
 
   void SelfRegister(vtkKdNode* kd);
@@ -175,6 +175,7 @@ public:
   int IsHomogeneous() override;
   void Allocate(vtkIdType numCells, int extSize = 1000) override;
   vtkMTimeType GetMTime() override;
+  vtkMTimeType GetMeshMTime() override;
 
   void SetImplementation(ImplementationType* impl);
   ImplementationType* GetImplementation();
@@ -201,6 +201,13 @@ vtkMTimeType vtkMappedUnstructuredGrid<Implementation, CellIterator>::GetMTime()
   return std::max(this->MTime.GetMTime(), this->Impl->GetMTime());
 }
 
+//------------------------------------------------------------------------------
+template <class Implementation, class CellIterator>
+vtkMTimeType vtkMappedUnstructuredGrid<Implementation, CellIterator>::GetMeshMTime()
+{
+  return std::max(this->Superclass::GetMeshMTime(), this->Impl->GetMTime());
+}
+
 //------------------------------------------------------------------------------
 template <class Implementation, class CellIterator>
 vtkMappedUnstructuredGrid<Implementation, CellIterator>::vtkMappedUnstructuredGrid()
@@ -55,6 +55,10 @@ public:
 
   static vtkOctreePointLocator* New();
 
+  // Re-use any superclass signatures that we don't override.
+  using vtkAbstractPointLocator::FindClosestNPoints;
+  using vtkAbstractPointLocator::FindPointsWithinRadius;
+
   ///@{
   /**
    * Maximum number of points per spatial region.  Default is 100.
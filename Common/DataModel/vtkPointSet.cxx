@@ -153,6 +153,17 @@ vtkMTimeType vtkPointSet::GetMTime()
   return dsTime;
 }
 
+//------------------------------------------------------------------------------
+vtkMTimeType vtkPointSet::GetMeshMTime()
+{
+  vtkMTimeType meshTime = vtkDataSet::GetMeshMTime();
+  if (this->Points && this->Points->GetMTime() > meshTime)
+  {
+    meshTime = this->Points->GetMTime();
+  }
+  return meshTime;
+}
+
 //------------------------------------------------------------------------------
 void vtkPointSet::BuildPointLocator()
 {
@@ -210,6 +221,17 @@ void vtkPointSet::BuildCellLocator()
   this->CellLocator->BuildLocator();
 }
 
+//------------------------------------------------------------------------------
+void vtkPointSet::PrepareForMultithreadedAccess()
+{
+  this->Superclass::PrepareForMultithreadedAccess();
+  this->BuildPointLocator();
+  if (this->CellLocator)
+  {
+    this->BuildCellLocator();
+  }
+}
+
 //------------------------------------------------------------------------------
 vtkIdType vtkPointSet::FindPoint(double x[3])
 {
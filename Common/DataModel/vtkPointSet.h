@@ -219,6 +219,11 @@ public:
    */
   vtkMTimeType GetMTime() override;
 
+  /**
+   * Get the mesh MTime, which also considers its vtkPoints MTime.
+   */
+  vtkMTimeType GetMeshMTime() override;
+
   /**
    * Compute the (X, Y, Z)  bounds of the data.
    */
@@ -229,6 +234,13 @@ public:
    */
   void Squeeze() override;
 
+  /**
+   * Also build the point locator, and update the cell locator if there is
+   * one, so that FindPoint() and FindCell() can be called from several
+   * threads. See vtkDataSet::PrepareForMultithreadedAccess().
+   */
+  void PrepareForMultithreadedAccess() override;
+
   ///@{
   /**
    * Specify point array to define point coordinates.
@@ -257,9 +269,14 @@ public:
 
   ///@{
   /**
-   * Overwritten to handle the data/locator loop
+   * Overwritten to handle the data/locator loop. Data sets without locators
+   * are in no loop, and are released without a garbage collection check,
+   * which matters when releasing the many blocks of a composite dataset.
    */
-  bool UsesGarbageCollector() const override { return true; }
+  bool UsesGarbageCollector() const override
+  {
+    return this->PointLocator != nullptr || this->CellLocator != nullptr;
+  }
   ///@}
 
   ///@{
@@ -35,6 +35,7 @@
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticCellLinks.h"
 #include "vtkTriangle.h"
 #include "vtkTriangleStrip.h"
 #include "vtkUnsignedCharArray.h"
@@ -925,6 +926,20 @@ void vtkPolyData::DeleteLinks()
   this->Links = nullptr;
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyData::PrepareForMultithreadedAccess()
+{
+  if (!this->Cells)
+  {
+    this->BuildCells();
+  }
+  if (!this->Links)
+  {
+    this->BuildLinks();
+  }
+  this->Superclass::PrepareForMultithreadedAccess();
+}
+
 //------------------------------------------------------------------------------
 // Create upward links from points to cells that use each point. Enables
 // topologically complex queries.
@@ -938,18 +953,34 @@ void vtkPolyData::BuildLinks(int initialSize)
   {
     return;
   }
+  // Create appropriate links. Currently, it's either a vtkCellLinks (when
+  // the dataset is editable) or vtkStaticCellLinks (when the dataset is
+  // not editable). Static links cannot be edited, so they are replaced if
+  // the dataset became editable since they were built.
+  if (this->Links && this->Editable &&
+    this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
+  {
+    this->Links = nullptr;
+  }
   if (!this->Links)
   {
-    this->Links = vtkSmartPointer<vtkCellLinks>::New();
-    if (initialSize > 0)
+    if (!this->Editable)
     {
-      this->Links->Allocate(initialSize);
+      this->Links = vtkSmartPointer<vtkStaticCellLinks>::New();
+    }
+    else
+    {
+      this->Links = vtkSmartPointer<vtkCellLinks>::New();
+      if (initialSize > 0)
+      {
+        static_cast<vtkCellLinks*>(this->Links.Get())->Allocate(initialSize);
+      }
     }
     this->Links->SetDataSet(this);
   }
-  else if (initialSize > 0)
+  else if (initialSize > 0 && this->Editable)
   {
-    this->Links->Allocate(initialSize);
+    static_cast<vtkCellLinks*>(this->Links.Get())->Allocate(initialSize);
     this->Links->SetDataSet(this);
   }
   else if (this->Points->GetMTime() > this->Links->GetMTime())
@@ -964,14 +995,15 @@ void vtkPolyData::SetLinks(vtkAbstractCellLinks* links)
 {
   if (this->Links != links)
   {
-    if (auto cellLinks = vtkCellLinks::SafeDownCast(links))
+    if (links == nullptr || vtkCellLinks::SafeDownCast(links) ||
+      vtkStaticCellLinks::SafeDownCast(links))
     {
-      this->Links = cellLinks;
+      this->Links = links;
       this->Modified();
     }
     else
     {
-      vtkErrorMacro("Only vtkCellLinks are currently supported.");
+      vtkErrorMacro("Only vtkCellLinks and vtkStaticCellLinks are currently supported.");
     }
   }
 }
@@ -997,6 +1029,25 @@ void vtkPolyData::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
+{
+  if (this->Links->GetType() == vtkAbstractCellLinks::CELL_LINKS)
+  {
+    vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
+
+    ncells = links->GetNcells(ptId);
+    cells = links->GetCells(ptId);
+  }
+  else
+  {
+    vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
+
+    ncells = links->GetNcells(ptId);
+    cells = links->GetCells(ptId);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
@@ -1010,8 +1061,7 @@ void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
   }
   cellIds->Reset();
 
-  numCells = this->Links->GetNcells(ptId);
-  cells = this->Links->GetCells(ptId);
+  this->GetPointCells(ptId, numCells, cells);
 
   for (i = 0; i < numCells; i++)
   {
@@ -1172,7 +1222,7 @@ void vtkPolyData::ReverseCell(vtkIdType cellId)
 // use this method, make sure points are available and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 {
-  return this->Links->InsertNextPoint(numLinks);
+  return static_cast<vtkCellLinks*>(this->Links.Get())->InsertNextPoint(numLinks);
 }
 
 //------------------------------------------------------------------------------
@@ -1182,7 +1232,7 @@ vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 // and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(double x[3], int numLinks)
 {
-  this->Links->InsertNextPoint(numLinks);
+  static_cast<vtkCellLinks*>(this->Links.Get())->InsertNextPoint(numLinks);
   return this->Points->InsertNextPoint(x);
 }
 
@@ -1196,10 +1246,11 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 
   id = this->InsertNextCell(type, npts, pts);
 
+  vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
   for (i = 0; i < npts; i++)
   {
-    this->Links->ResizeCellList(pts[i], 1);
-    this->Links->AddCellReference(id, pts[i]);
+    links->ResizeCellList(pts[i], 1);
+    links->AddCellReference(id, pts[i]);
   }
 
   return id;
@@ -1212,7 +1263,7 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  this->Links->RemoveCellReference(cellId, ptId);
+  static_cast<vtkCellLinks*>(this->Links.Get())->RemoveCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1222,7 +1273,7 @@ void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::AddReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  this->Links->AddCellReference(cellId, ptId);
+  static_cast<vtkCellLinks*>(this->Links.Get())->AddCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1258,9 +1309,10 @@ void vtkPolyData::ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 void vtkPolyData::ReplaceLinkedCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 {
   this->ReplaceCell(cellId, npts, pts);
+  vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
   for (int i = 0; i < npts; i++)
   {
-    this->Links->InsertNextCellReference(pts[i], cellId);
+    links->InsertNextCellReference(pts[i], cellId);
   }
 }
 
@@ -1273,14 +1325,13 @@ void vtkPolyData::GetCellEdgeNeighbors(
 {
   cellIds->Reset();
 
-  const vtkCellLinks::Link& link1(this->Links->GetLink(p1));
-  const vtkCellLinks::Link& link2(this->Links->GetLink(p2));
-
-  const vtkIdType* cells1 = link1.cells;
-  const vtkIdType* cells1End = cells1 + link1.ncells;
+  vtkIdType ncells1, ncells2;
+  vtkIdType *cells1, *cells2;
+  this->GetPointCells(p1, ncells1, cells1);
+  this->GetPointCells(p2, ncells2, cells2);
 
-  const vtkIdType* cells2 = link2.cells;
-  const vtkIdType* cells2End = cells2 + link2.ncells;
+  const vtkIdType* cells1End = cells1 + ncells1;
+  const vtkIdType* cells2End = cells2 + ncells2;
 
   while (cells1 != cells1End)
   {
@@ -1316,8 +1367,9 @@ void vtkPolyData::GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList
 
   // load list with candidate cells, remove current cell
   vtkIdType ptId = ptIds->GetId(0);
-  int numPrime = this->Links->GetNcells(ptId);
-  vtkIdType* primeCells = this->Links->GetCells(ptId);
+  vtkIdType numPrime;
+  vtkIdType* primeCells;
+  this->GetPointCells(ptId, numPrime, primeCells);
   numPts = ptIds->GetNumberOfIds();
 
   // for each potential cell
@@ -1330,8 +1382,9 @@ void vtkPolyData::GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList
       for (allFound = 1, i = 1; i < numPts && allFound; i++)
       {
         ptId = ptIds->GetId(i);
-        int numCurrent = this->Links->GetNcells(ptId);
-        vtkIdType* currentCells = this->Links->GetCells(ptId);
+        vtkIdType numCurrent;
+        vtkIdType* currentCells;
+        this->GetPointCells(ptId, numCurrent, currentCells);
         oneFound = 0;
         for (j = 0; j < numCurrent; j++)
         {
@@ -1557,7 +1610,7 @@ void vtkPolyData::DeepCopy(vtkDataObject* dataObject)
     }
     if (polyData->Links)
     {
-      this->Links = vtkSmartPointer<vtkCellLinks>::Take(polyData->Links->NewInstance());
+      this->Links = vtkSmartPointer<vtkAbstractCellLinks>::Take(polyData->Links->NewInstance());
       this->Links->DeepCopy(polyData->Links);
     }
     else
@@ -374,17 +374,27 @@ public:
 
   /**
    * Create upward links from points to cells that use each point. Enables
-   * topologically complex queries. Normally the links array is allocated
-   * based on the number of points in the vtkPolyData. The optional
-   * initialSize parameter can be used to allocate a larger size initially.
+   * topologically complex queries. Unless the dataset is Editable, the links
+   * are a vtkStaticCellLinks built in parallel; they cannot be modified
+   * incrementally. Editable datasets use a vtkCellLinks, whose links array is
+   * normally allocated based on the number of points in the vtkPolyData. The
+   * optional initialSize parameter can be used to allocate a larger size
+   * initially.
    */
   void BuildLinks(int initialSize = 0);
 
+  /**
+   * Also build the cells and the links if they are missing. See
+   * vtkDataSet::PrepareForMultithreadedAccess().
+   */
+  void PrepareForMultithreadedAccess() override;
+
   ///@{
   /**
    * Set/Get the links that you created possibly without using BuildLinks.
    *
-   * Note: Only vtkCellLinks are currently supported.
+   * Note: Only vtkCellLinks and vtkStaticCellLinks are currently supported,
+   * and only vtkCellLinks can be edited.
    */
   virtual void SetLinks(vtkAbstractCellLinks* links);
   vtkGetSmartPointerMacro(Links, vtkAbstractCellLinks);
@@ -625,6 +635,14 @@ public:
    */
   unsigned long GetActualMemorySize() override;
 
+  /**
+   * Overwritten to also handle the data/links loop.
+   */
+  bool UsesGarbageCollector() const override
+  {
+    return this->Links != nullptr || this->Superclass::UsesGarbageCollector();
+  }
+
   ///@{
   /**
    * Shallow and Deep copy.
@@ -689,7 +707,7 @@ public:
    * track the changes on the mesh separately from the data arrays
    * (eg. static mesh over time with transient data).
    */
-  virtual vtkMTimeType GetMeshMTime();
+  vtkMTimeType GetMeshMTime() override;
 
   /**
    * Get MTime which also considers its cell array MTime.
@@ -739,7 +757,7 @@ protected:
   // supporting structures for more complex topological operations
   // built only when necessary
   vtkSmartPointer<CellMap> Cells;
-  vtkSmartPointer<vtkCellLinks> Links;
+  vtkSmartPointer<vtkAbstractCellLinks> Links;
 
   vtkNew<vtkIdList> LegacyBuffer;
 
@@ -758,13 +776,6 @@ private:
   void operator=(const vtkPolyData&) = delete;
 };
 
-//------------------------------------------------------------------------------
-inline void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
-{
-  ncells = this->Links->GetNcells(ptId);
-  cells = this->Links->GetCells(ptId);
-}
-
 //------------------------------------------------------------------------------
 inline vtkIdType vtkPolyData::GetNumberOfCells()
 {
@@ -866,7 +877,7 @@ inline int vtkPolyData::IsPointUsedByCell(vtkIdType ptId, vtkIdType cellId)
 //------------------------------------------------------------------------------
 inline void vtkPolyData::DeletePoint(vtkIdType ptId)
 {
-  this->Links->DeletePoint(ptId);
+  static_cast<vtkCellLinks*>(this->Links.Get())->DeletePoint(ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -884,7 +895,7 @@ inline void vtkPolyData::RemoveCellReference(vtkIdType cellId)
   this->GetCellPoints(cellId, npts, pts);
   for (vtkIdType i = 0; i < npts; i++)
   {
-    this->Links->RemoveCellReference(cellId, pts[i]);
+    static_cast<vtkCellLinks*>(this->Links.Get())->RemoveCellReference(cellId, pts[i]);
   }
 }
 
@@ -897,14 +908,14 @@ inline void vtkPolyData::AddCellReference(vtkIdType cellId)
   this->GetCellPoints(cellId, npts, pts);
   for (vtkIdType i = 0; i < npts; i++)
   {
-    this->Links->AddCellReference(cellId, pts[i]);
+    static_cast<vtkCellLinks*>(this->Links.Get())->AddCellReference(cellId, pts[i]);
   }
 }
 
 //------------------------------------------------------------------------------
 inline void vtkPolyData::ResizeCellList(vtkIdType ptId, int size)
 {
-  this->Links->ResizeCellList(ptId, size);
+  static_cast<vtkCellLinks*>(this->Links.Get())->ResizeCellList(ptId, size);
 }
 
 //------------------------------------------------------------------------------
@@ -13,14 +13,46 @@
 
 =========================================================================*/
 #include "vtkSphere.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSphere);
 
+namespace
+{
+// Evaluate the sphere equation at the tuples of an array, in parallel.
+struct SphereWorker
+{
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(
+    InputArrayType* input, OutputArrayType* output, const double center[3], double radius)
+  {
+    using OutputValueType = vtk::GetAPIType<OutputArrayType>;
+    const double c0 = center[0], c1 = center[1], c2 = center[2];
+    const double r2 = radius * radius;
+
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      const auto points = vtk::DataArrayTupleRange<3>(input, begin, end);
+      auto values = vtk::DataArrayValueRange<1>(output, begin, end);
+      auto value = values.begin();
+      for (const auto point : points)
+      {
+        const double d0 = static_cast<double>(point[0]) - c0;
+        const double d1 = static_cast<double>(point[1]) - c1;
+        const double d2 = static_cast<double>(point[2]) - c2;
+        *value++ = static_cast<OutputValueType>((d0 * d0 + d1 * d1 + d2 * d2) - r2);
+      }
+    });
+  }
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Construct sphere with center at (0,0,0) and radius=0.5.
 vtkSphere::vtkSphere()
@@ -42,6 +74,21 @@ double vtkSphere::EvaluateFunction(double x[3])
     this->Radius * this->Radius);
 }
 
+//------------------------------------------------------------------------------
+void vtkSphere::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
+
+  SphereWorker worker;
+  using Dispatcher =
+    vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals, vtkArrayDispatch::Reals>;
+  if (!Dispatcher::Execute(input, output, worker, this->Center, this->Radius))
+  {
+    worker(input, output, this->Center, this->Radius); // Use vtkDataArray API if dispatch fails.
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate sphere gradient.
 void vtkSphere::EvaluateGradient(double x[3], double n[3])
@@ -26,7 +26,13 @@
  * edge neighbors)and construct other local topological information. This
  * class is a faster implementation of vtkCellLinks. However, it cannot be
  * incrementally constructed; it is meant to be constructed once (statically)
- * and must be rebuilt if the cells change.
+ * and must be rebuilt if the cells change. Unless SequentialProcessing is
+ * enabled, the links of vtkPolyData, vtkUnstructuredGrid and
+ * vtkExplicitStructuredGrid are built in parallel: the point uses are
+ * counted into an atomic histogram, converted into offsets with a parallel
+ * prefix sum, and the cell ids are then scattered in parallel. Whichever
+ * way they are built, the cells using a point are listed in increasing id
+ * order.
  *
  * This is a templated implementation for vtkStaticCellLinks. The reason for
  * the templating is to gain performance and reduce memory by using smaller
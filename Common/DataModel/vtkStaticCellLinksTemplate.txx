@@ -24,8 +24,10 @@
 #include "vtkPolyData.h"
 #include "vtkSMPTools.h"
 #include "vtkUnstructuredGrid.h"
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <vector>
 
 #include <type_traits>
 
@@ -127,7 +129,7 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkDataSet* ds)
   // Traverse data to determine number of uses of each point. Also count the
   // number of links to allocate.
   this->Offsets = new TIds[this->NumPts + 1];
-  std::fill_n(this->Offsets, this->NumPts, 0);
+  std::fill_n(this->Offsets, this->NumPts + 1, 0);
 
   for (this->LinksSize = 0, cellId = 0; cellId < this->NumCells; cellId++)
   {
@@ -153,8 +155,9 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkDataSet* ds)
   // Now build the links. The summation from the prefix sum indicates where
   // the cells are to be inserted. Each time a cell is inserted, the offset
   // is decremented. In the end, the offset array is also constructed as it
-  // points to the beginning of each cell run.
-  for (cellId = 0; cellId < this->NumCells; ++cellId)
+  // points to the beginning of each cell run. The cells are visited from last
+  // to first so that each run lists its cells in increasing order.
+  for (cellId = this->NumCells - 1; cellId >= 0; --cellId)
   {
     ds->GetCellPoints(cellId, cellPts);
     npts = cellPts->GetNumberOfIds();
@@ -211,10 +214,11 @@ struct BuildLinks
     // Now build the links. The summation from the prefix sum indicates where
     // the cells are to be inserted. Each time a cell is inserted, the offset
     // is decremented. In the end, the offset array is also constructed as it
-    // points to the beginning of each cell run.
+    // points to the beginning of each cell run. The cells are visited from
+    // last to first so that each run lists its cells in increasing order.
     ValueType ptIdOffset;
     size_t ptId;
-    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    for (vtkIdType cellId = numCells - 1; cellId >= 0; --cellId)
     {
       for (ptIdOffset = cellOffsets[cellId]; ptIdOffset < cellOffsets[cellId + 1]; ++ptIdOffset)
       {
@@ -301,6 +305,9 @@ VTK_ABI_NAMESPACE_END
 
 //----------------------------------------------------------------------------
 // Threaded implementation of BuildLinks() using vtkSMPTools and std::atomic.
+// The point uses are counted into an atomic histogram, the histogram is
+// turned into offsets with a blocked parallel prefix sum, then the cell ids
+// are scattered in parallel and each run of cell ids is sorted.
 
 namespace
 { // anonymous
@@ -330,22 +337,82 @@ struct InsertLinks
   std::atomic<TIds>* Counts;
   const TIds* Offsets;
   TIds* Links;
+  TIds IdOffset;
 
-  InsertLinks(vtkCellArray* cellArray, std::atomic<TIds>* counts, const TIds* offsets, TIds* links)
+  InsertLinks(vtkCellArray* cellArray, std::atomic<TIds>* counts, const TIds* offsets, TIds* links,
+    TIds idOffset = 0)
     : CellArray(cellArray)
     , Counts(counts)
     , Offsets(offsets)
     , Links(links)
+    , IdOffset(idOffset)
   {
   }
 
   void operator()(vtkIdType cellId, vtkIdType endCellId)
   {
     this->CellArray->Visit(vtkSCLT_detail::BuildLinksThreaded{}, this->Offsets, this->Counts,
-      this->Links, cellId, endCellId);
+      this->Links, cellId, endCellId, this->IdOffset);
   }
 };
 
+// Exclusive prefix sum of the point use counts into offsets (numPts+1
+// values). Blocks of points are summed in parallel, the block sums are
+// scanned serially, and then every block is scanned in parallel starting
+// from the sum of the blocks before it.
+template <typename TIds>
+void PrefixSumUses(const std::atomic<TIds>* counts, TIds* offsets, vtkIdType numPts)
+{
+  const vtkIdType blockSize = 16384;
+  const vtkIdType numBlocks = (numPts + blockSize - 1) / blockSize;
+  std::vector<TIds> blockOffsets(numBlocks + 1, 0);
+
+  vtkSMPTools::For(0, numBlocks, [&](vtkIdType block, vtkIdType endBlock) {
+    for (; block < endBlock; ++block)
+    {
+      const vtkIdType endPtId = std::min(numPts, (block + 1) * blockSize);
+      TIds sum = 0;
+      for (vtkIdType ptId = block * blockSize; ptId < endPtId; ++ptId)
+      {
+        sum += counts[ptId].load(std::memory_order_relaxed);
+      }
+      blockOffsets[block + 1] = sum;
+    }
+  });
+
+  for (vtkIdType block = 0; block < numBlocks; ++block)
+  {
+    blockOffsets[block + 1] += blockOffsets[block];
+  }
+
+  vtkSMPTools::For(0, numBlocks, [&](vtkIdType block, vtkIdType endBlock) {
+    for (; block < endBlock; ++block)
+    {
+      const vtkIdType endPtId = std::min(numPts, (block + 1) * blockSize);
+      TIds offset = blockOffsets[block];
+      for (vtkIdType ptId = block * blockSize; ptId < endPtId; ++ptId)
+      {
+        offsets[ptId] = offset;
+        offset += counts[ptId].load(std::memory_order_relaxed);
+      }
+    }
+  });
+  offsets[numPts] = blockOffsets[numBlocks];
+}
+
+// The threads scatter the cell ids in an arbitrary order; sort every run so
+// that the result is deterministic and matches the serial build.
+template <typename TIds>
+void SortLinks(const TIds* offsets, TIds* links, vtkIdType numPts)
+{
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      std::sort(links + offsets[ptId], links + offsets[ptId + 1]);
+    }
+  });
+}
+
 } // anonymous
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -375,19 +442,13 @@ void vtkStaticCellLinksTemplate<TIds>::ThreadedBuildLinks(
   vtkSMPTools::For(0, numCells, count);
 
   // Perform prefix sum to determine offsets
-  vtkIdType ptId, npts;
   this->Offsets = new TIds[numPts + 1];
-  this->Offsets[0] = 0;
-  for (ptId = 1; ptId < numPts; ++ptId)
-  {
-    npts = counts[ptId - 1];
-    this->Offsets[ptId] = this->Offsets[ptId - 1] + npts;
-  }
-  this->Offsets[numPts] = this->LinksSize;
+  PrefixSumUses(counts, this->Offsets, numPts);
 
   // Now insert cell ids into cell links.
   InsertLinks<TIds> insertLinks(cellArray, counts, this->Offsets, this->Links);
   vtkSMPTools::For(0, numCells, insertLinks);
+  SortLinks(this->Offsets, this->Links, numPts);
 
   // Clean up
   delete[] counts;
@@ -428,8 +489,15 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkExplicitStructuredGrid* esg
   // We're going to get into the guts of the class
   vtkCellArray* cellArray = esgrid->GetCells();
 
-  // Use serial implementation. TODO: add threaded implementation
-  this->SerialBuildLinks(numPts, numCells, cellArray);
+  // Use serial or threaded implementations
+  if (!this->SequentialProcessing)
+  {
+    this->ThreadedBuildLinks(numPts, numCells, cellArray);
+  }
+  else
+  {
+    this->SerialBuildLinks(numPts, numCells, cellArray);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -471,18 +539,52 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkPolyData* pd)
   this->Links = new TIds[this->LinksSize + 1];
   this->Links[this->LinksSize] = this->NumPts;
   this->Offsets = new TIds[this->NumPts + 1];
-  this->Offsets[this->NumPts] = this->LinksSize;
-  std::fill_n(this->Offsets, this->NumPts + 1, 0);
 
   // Now create the links.
   vtkIdType npts, CellId, ptId;
 
+  if (!this->SequentialProcessing)
+  {
+    // Count the point uses of the four arrays in the same atomic histogram
+    std::atomic<TIds>* counts = new std::atomic<TIds>[this->NumPts]();
+    for (j = 0; j < 4; ++j)
+    {
+      if (numCells[j] > 0)
+      {
+        CountUses<TIds> count(cellArrays[j], counts);
+        vtkSMPTools::For(0, numCells[j], count);
+      }
+    }
+
+    PrefixSumUses(counts, this->Offsets, this->NumPts);
+
+    // Scatter the cell ids, offset by the cells of the preceding arrays
+    for (CellId = 0, j = 0; j < 4; ++j)
+    {
+      if (numCells[j] > 0)
+      {
+        InsertLinks<TIds> insertLinks(
+          cellArrays[j], counts, this->Offsets, this->Links, static_cast<TIds>(CellId));
+        vtkSMPTools::For(0, numCells[j], insertLinks);
+      }
+      CellId += numCells[j];
+    }
+    SortLinks(this->Offsets, this->Links, this->NumPts);
+
+    delete[] counts;
+    return;
+  }
+
+  std::fill_n(this->Offsets, this->NumPts + 1, 0);
+
   // Visit the four arrays
-  for (CellId = 0, j = 0; j < 4; ++j)
+  for (j = 0; j < 4; ++j)
   {
     // Count number of point uses
-    cellArrays[j]->Visit(vtkSCLT_detail::CountPoints{}, this->Offsets, 0, numCells[j], CellId);
-    CellId += numCells[j];
+    if (numCells[j] > 0)
+    {
+      cellArrays[j]->Visit(vtkSCLT_detail::CountPoints{}, this->Offsets, 0, numCells[j]);
+    }
   } // for each of the four polydata cell arrays
 
   // Perform prefix sum (inclusive scan)
@@ -495,11 +597,15 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkPolyData* pd)
   // Now build the links. The summation from the prefix sum indicates where
   // the cells are to be inserted. Each time a cell is inserted, the offset
   // is decremented. In the end, the offset array is also constructed as it
-  // points to the beginning of each cell run.
-  for (CellId = 0, j = 0; j < 4; ++j)
+  // points to the beginning of each cell run. The arrays are visited from
+  // last to first so that each run lists its cells in increasing order.
+  for (CellId = this->NumCells, j = 3; j >= 0; --j)
   {
-    cellArrays[j]->Visit(vtkSCLT_detail::BuildLinks{}, this->Offsets, this->Links, CellId);
-    CellId += numCells[j];
+    CellId -= numCells[j];
+    if (numCells[j] > 0)
+    {
+      cellArrays[j]->Visit(vtkSCLT_detail::BuildLinks{}, this->Offsets, this->Links, CellId);
+    }
   } // for each of the four polydata arrays
   this->Offsets[this->NumPts] = this->LinksSize;
 }
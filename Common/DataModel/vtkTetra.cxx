@@ -26,6 +26,7 @@
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -139,6 +140,72 @@ int vtkTetra::EvaluatePosition(const double x[3], double closestPoint[3], int& s
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkTetra::EvaluatePositions(vtkIdType numPoints, const double* const x[3],
+  double* const pcoords[3], double* weights, int* inside)
+{
+  const auto pointsArray = vtkDoubleArray::FastDownCast(this->Points->GetData());
+  if (!pointsArray)
+  {
+    vtkErrorMacro(<< "Points should be double type");
+    std::fill(inside, inside + numPoints, 0);
+    return;
+  }
+  const double* pts = pointsArray->GetPointer(0);
+  const double* pt4 = pts;
+
+  double c1[3], c2[3], c3[3];
+  for (int i = 0; i < 3; i++)
+  {
+    c1[i] = pts[3 + i] - pt4[i];
+    c2[i] = pts[6 + i] - pt4[i];
+    c3[i] = pts[9 + i] - pt4[i];
+  }
+  const double det = vtkMath::Determinant3x3(c1, c2, c3);
+  if (det == 0.0)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      std::fill(pcoords[i], pcoords[i] + numPoints, 0.0);
+    }
+    std::fill(inside, inside + numPoints, -1);
+    return;
+  }
+
+  // The parametric coordinates are the products of x - pt4 with the rows of
+  // the inverse of the matrix (c1, c2, c3).
+  double r[3], s[3], t[3];
+  vtkMath::Cross(c2, c3, r);
+  vtkMath::Cross(c3, c1, s);
+  vtkMath::Cross(c1, c2, t);
+  for (int i = 0; i < 3; i++)
+  {
+    r[i] /= det;
+    s[i] /= det;
+    t[i] /= det;
+  }
+
+  for (vtkIdType i = 0; i < numPoints; i++)
+  {
+    const double rhs0 = x[0][i] - pt4[0];
+    const double rhs1 = x[1][i] - pt4[1];
+    const double rhs2 = x[2][i] - pt4[2];
+    const double pc0 = rhs0 * r[0] + rhs1 * r[1] + rhs2 * r[2];
+    const double pc1 = rhs0 * s[0] + rhs1 * s[1] + rhs2 * s[2];
+    const double pc2 = rhs0 * t[0] + rhs1 * t[1] + rhs2 * t[2];
+    const double p4 = 1.0 - pc0 - pc1 - pc2;
+    pcoords[0][i] = pc0;
+    pcoords[1][i] = pc1;
+    pcoords[2][i] = pc2;
+    weights[4 * i] = p4;
+    weights[4 * i + 1] = pc0;
+    weights[4 * i + 2] = pc1;
+    weights[4 * i + 3] = pc2;
+    inside[i] = pc0 >= -0.001 && pc0 <= 1.001 && pc1 >= -0.001 && pc1 <= 1.001 && pc2 >= -0.001 &&
+      pc2 <= 1.001 && p4 >= -0.001 && p4 <= 1.001;
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkTetra::GetCentroid(double centroid[3]) const
 {
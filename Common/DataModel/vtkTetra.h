@@ -190,6 +190,18 @@ public:
    */
   int JacobianInverse(double** inverse, double derivs[12]);
 
+  /**
+   * Compute the parametric coordinates and the interpolation weights of
+   * numPoints points with respect to this tetrahedron, like EvaluatePosition()
+   * without the closest points. The coordinates of point i are x[0][i],
+   * x[1][i] and x[2][i], its parametric coordinates are returned the same way
+   * in pcoords and its weights in weights[4 * i] to weights[4 * i + 3]. inside[i]
+   * is set to the value EvaluatePosition() returns for point i. The linear system
+   * of the tetrahedron is inverted once for all the points.
+   */
+  void EvaluatePositions(vtkIdType numPoints, const double* const x[3], double* const pcoords[3],
+    double* weights, int* inside);
+
   static void InterpolationFunctions(const double pcoords[3], double weights[4]);
   static void InterpolationDerivs(const double pcoords[3], double derivs[12]);
   ///@{
@@ -1520,6 +1520,17 @@ void vtkUnstructuredGrid::BuildLinks()
   this->Links->BuildLinks();
 }
 
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::PrepareForMultithreadedAccess()
+{
+  if (!this->Links)
+  {
+    this->BuildLinks();
+  }
+  this->GetDistinctCellTypesArray();
+  this->Superclass::PrepareForMultithreadedAccess();
+}
+
 //------------------------------------------------------------------------------
 vtkAbstractCellLinks* vtkUnstructuredGrid::GetCellLinks()
 {
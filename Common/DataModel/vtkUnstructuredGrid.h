@@ -283,6 +283,12 @@ public:
    */
   void BuildLinks();
 
+  /**
+   * Also build the links if they are missing and the distinct cell types.
+   * See vtkDataSet::PrepareForMultithreadedAccess().
+   */
+  void PrepareForMultithreadedAccess() override;
+
   ///@{
   /**
    * Set/Get the links that you created possibly without using BuildLinks.
@@ -416,6 +422,14 @@ public:
    */
   unsigned long GetActualMemorySize() override;
 
+  /**
+   * Overwritten to also handle the data/links loop.
+   */
+  bool UsesGarbageCollector() const override
+  {
+    return this->Links != nullptr || this->Superclass::UsesGarbageCollector();
+  }
+
   ///@{
   /**
    * Shallow and Deep copy.
@@ -480,7 +494,7 @@ public:
    * track the changes on the mesh separately from the data arrays
    * (eg. static mesh over time with transient data).
    */
-  virtual vtkMTimeType GetMeshMTime();
+  vtkMTimeType GetMeshMTime() override;
 
   /**
    * A static method for converting a polyhedron vtkCellArray of format
@@ -27,6 +27,7 @@
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -209,29 +210,18 @@ vtkWedge::~vtkWedge()
 static const int VTK_WEDGE_MAX_ITERATION = 10;
 static const double VTK_WEDGE_CONVERGED = 1.e-03;
 
+namespace
+{
 //------------------------------------------------------------------------------
-int vtkWedge::EvaluatePosition(const double x[3], double closestPoint[3], int& subId,
-  double pcoords[3], double& dist2, double weights[])
+// Scale for an acceptable determinant of the Jacobian, from a bound on the
+// volume of the wedge.
+double DeterminantTolerance(const double* pts)
 {
-  double params[3] = { 0.5, 0.5, 0.5 };
-  double derivs[18];
-
-  // Efficient point access
-  const auto pointsArray = vtkDoubleArray::FastDownCast(this->Points->GetData());
-  if (!pointsArray)
-  {
-    vtkErrorMacro(<< "Points should be double type");
-    return 0;
-  }
-  const double* pts = pointsArray->GetPointer(0);
-  const double *pt0, *pt1;
-
-  // compute a bound on the volume to get a scale for an acceptable determinant
   double longestEdge = 0;
   for (int i = 0; i < 9; i++)
   {
-    pt0 = pts + 3 * edges[i][0];
-    pt1 = pts + 3 * edges[i][1];
+    const double* pt0 = pts + 3 * edges[i][0];
+    const double* pt1 = pts + 3 * edges[i][1];
     double d2 = vtkMath::Distance2BetweenPoints(pt0, pt1);
     if (longestEdge < d2)
     {
@@ -240,10 +230,19 @@ int vtkWedge::EvaluatePosition(const double x[3], double closestPoint[3], int& s
   }
   // longestEdge value is already squared
   double volumeBound = longestEdge * std::sqrt(longestEdge);
-  double determinantTolerance = 1e-20 < .00001 * volumeBound ? 1e-20 : .00001 * volumeBound;
+  return 1e-20 < .00001 * volumeBound ? 1e-20 : .00001 * volumeBound;
+}
+
+//------------------------------------------------------------------------------
+// Compute the parametric coordinates of x with Newton's method. Returns 1 if
+// x is inside the wedge, 0 if it is outside and -1 if the method failed.
+int ComputeParametricCoordinates(const double* pts, const double x[3],
+  double determinantTolerance, double pcoords[3], double weights[6])
+{
+  double params[3] = { 0.5, 0.5, 0.5 };
+  double derivs[18];
 
   //  set initial position for Newton's method
-  subId = 0;
   pcoords[0] = pcoords[1] = pcoords[2] = 0.5;
 
   //  enter iteration loop
@@ -278,7 +277,6 @@ int vtkWedge::EvaluatePosition(const double x[3], double closestPoint[3], int& s
     double d = vtkMath::Determinant3x3(rcol, scol, tcol);
     if (fabs(d) < determinantTolerance)
     {
-      vtkDebugMacro(<< "Determinant incorrect, iteration " << iteration);
       return -1;
     }
 
@@ -317,8 +315,34 @@ int vtkWedge::EvaluatePosition(const double x[3], double closestPoint[3], int& s
 
   vtkWedge::InterpolationFunctions(pcoords, weights);
 
-  if (pcoords[0] >= -0.001 && pcoords[0] <= 1.001 && pcoords[1] >= -0.001 && pcoords[1] <= 1.001 &&
-    pcoords[2] >= -0.001 && pcoords[2] <= 1.001 && pcoords[0] + pcoords[1] <= 1.001)
+  return pcoords[0] >= -0.001 && pcoords[0] <= 1.001 && pcoords[1] >= -0.001 &&
+    pcoords[1] <= 1.001 && pcoords[2] >= -0.001 && pcoords[2] <= 1.001 &&
+    pcoords[0] + pcoords[1] <= 1.001;
+}
+}
+
+//------------------------------------------------------------------------------
+int vtkWedge::EvaluatePosition(const double x[3], double closestPoint[3], int& subId,
+  double pcoords[3], double& dist2, double weights[])
+{
+  // Efficient point access
+  const auto pointsArray = vtkDoubleArray::FastDownCast(this->Points->GetData());
+  if (!pointsArray)
+  {
+    vtkErrorMacro(<< "Points should be double type");
+    return 0;
+  }
+  const double* pts = pointsArray->GetPointer(0);
+
+  subId = 0;
+  const int inside =
+    ::ComputeParametricCoordinates(pts, x, ::DeterminantTolerance(pts), pcoords, weights);
+  if (inside == -1)
+  {
+    return -1;
+  }
+
+  if (inside == 1)
   {
     if (closestPoint)
     {
@@ -356,6 +380,31 @@ int vtkWedge::EvaluatePosition(const double x[3], double closestPoint[3], int& s
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkWedge::EvaluatePositions(vtkIdType numPoints, const double* const x[3],
+  double* const pcoords[3], double* weights, int* inside)
+{
+  const auto pointsArray = vtkDoubleArray::FastDownCast(this->Points->GetData());
+  if (!pointsArray)
+  {
+    vtkErrorMacro(<< "Points should be double type");
+    std::fill(inside, inside + numPoints, 0);
+    return;
+  }
+  const double* pts = pointsArray->GetPointer(0);
+  const double determinantTolerance = ::DeterminantTolerance(pts);
+
+  for (vtkIdType i = 0; i < numPoints; i++)
+  {
+    const double p[3] = { x[0][i], x[1][i], x[2][i] };
+    double pc[3];
+    inside[i] = ::ComputeParametricCoordinates(pts, p, determinantTolerance, pc, weights + 6 * i);
+    pcoords[0][i] = pc[0];
+    pcoords[1][i] = pc[1];
+    pcoords[2][i] = pc[2];
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkWedge::EvaluateLocation(
   int& vtkNotUsed(subId), const double pcoords[3], double x[3], double* weights)
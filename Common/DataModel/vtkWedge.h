@@ -130,6 +130,18 @@ public:
    */
   int GetParametricCenter(double pcoords[3]) override;
 
+  /**
+   * Compute the parametric coordinates and the interpolation weights of
+   * numPoints points with respect to this wedge, like EvaluatePosition()
+   * without the closest points. The coordinates of point i are x[0][i],
+   * x[1][i] and x[2][i], its parametric coordinates are returned the same way
+   * in pcoords and its weights in weights[6 * i] to weights[6 * i + 5]. inside[i]
+   * is set to the value EvaluatePosition() returns for point i. The tolerance of the
+   * Newton iterations is computed once for all the points.
+   */
+  void EvaluatePositions(vtkIdType numPoints, const double* const x[3], double* const pcoords[3],
+    double* weights, int* inside);
+
   static void InterpolationFunctions(const double pcoords[3], double weights[6]);
   static void InterpolationDerivs(const double pcoords[3], double derivs[18]);
   ///@{
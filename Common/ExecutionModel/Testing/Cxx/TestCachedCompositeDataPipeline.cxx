@@ -0,0 +1,154 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCachedCompositeDataPipeline.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkCachedCompositeDataPipeline reuses the outputs computed for
+// a parameter value when the value is set back, and that the memory budget
+// is honored.
+
+#include "vtkCachedCompositeDataPipeline.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkInformation.h"
+#include "vtkInformationStringKey.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+// Pass its input through with its parameter in the field data, and count
+// its executions.
+class ParameterFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static ParameterFilter* New();
+  vtkTypeMacro(ParameterFilter, vtkPolyDataAlgorithm);
+
+  void SetValue(double value)
+  {
+    if (this->Value != value)
+    {
+      this->Value = value;
+      this->GetInformation()->Set(
+        vtkCachedCompositeDataPipeline::CACHE_STATE(), "value=" + std::to_string(value));
+      this->Modified();
+    }
+  }
+
+  int NumberOfExecutions = 0;
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    ++this->NumberOfExecutions;
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->ShallowCopy(vtkPolyData::GetData(inputVector[0]));
+    vtkNew<vtkDoubleArray> value;
+    value->SetName("Value");
+    value->InsertNextValue(this->Value);
+    output->GetFieldData()->AddArray(value);
+    return 1;
+  }
+
+  double Value = 0.0;
+};
+vtkStandardNewMacro(ParameterFilter);
+
+bool CheckUpdate(ParameterFilter* filter, vtkCachedCompositeDataPipeline* executive, double value,
+  int expectedExecutions, vtkIdType expectedHits)
+{
+  filter->SetValue(value);
+  filter->Update();
+  bool success = true;
+  vtkDataArray* array = filter->GetOutput()->GetFieldData()->GetArray("Value");
+  if (!array || array->GetTuple1(0) != value)
+  {
+    vtkLog(ERROR, "Wrong output for value " << value);
+    success = false;
+  }
+  if (filter->GetOutput()->GetNumberOfPoints() == 0)
+  {
+    vtkLog(ERROR, "Empty output for value " << value);
+    success = false;
+  }
+  if (filter->NumberOfExecutions != expectedExecutions)
+  {
+    vtkLog(ERROR,
+      "The filter executed " << filter->NumberOfExecutions << " times instead of "
+                             << expectedExecutions);
+    success = false;
+  }
+  if (executive->GetNumberOfCacheHits() != expectedHits)
+  {
+    vtkLog(ERROR,
+      "Got " << executive->GetNumberOfCacheHits() << " cache hits instead of " << expectedHits);
+    success = false;
+  }
+  return success;
+}
+}
+
+int TestCachedCompositeDataPipeline(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<ParameterFilter> filter;
+  vtkNew<vtkCachedCompositeDataPipeline> executive;
+  filter->SetExecutive(executive);
+  filter->SetInputConnection(sphere->GetOutputPort());
+
+  bool success = CheckUpdate(filter, executive, 1.0, 1, 0);
+  success &= CheckUpdate(filter, executive, 2.0, 2, 0);
+  // going back and forth between known values hits the cache
+  success &= CheckUpdate(filter, executive, 1.0, 2, 1);
+  success &= CheckUpdate(filter, executive, 2.0, 2, 2);
+  if (vtkCachedCompositeDataPipeline::GetCacheMemoryUsage() == 0)
+  {
+    vtkLog(ERROR, "The cache is empty");
+    success = false;
+  }
+
+  // a modified input invalidates the cached outputs
+  sphere->SetThetaResolution(16);
+  success &= CheckUpdate(filter, executive, 1.0, 3, 2);
+
+  // nothing is kept without budget
+  const unsigned long budget = vtkCachedCompositeDataPipeline::GetCacheMemoryBudget();
+  vtkCachedCompositeDataPipeline::SetCacheMemoryBudget(0);
+  if (vtkCachedCompositeDataPipeline::GetCacheMemoryUsage() != 0)
+  {
+    vtkLog(ERROR, "The cache is not empty without budget");
+    success = false;
+  }
+  success &= CheckUpdate(filter, executive, 2.0, 4, 2);
+  success &= CheckUpdate(filter, executive, 1.0, 5, 2);
+  vtkCachedCompositeDataPipeline::SetCacheMemoryBudget(budget);
+
+  if (vtkCachedCompositeDataPipeline::GetTotalNumberOfCacheMisses() != 5)
+  {
+    vtkLog(ERROR,
+      "Got " << vtkCachedCompositeDataPipeline::GetTotalNumberOfCacheMisses()
+             << " cache misses instead of 5");
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
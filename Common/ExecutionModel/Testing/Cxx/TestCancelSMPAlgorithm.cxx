@@ -0,0 +1,161 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCancelSMPAlgorithm.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that setting AbortExecute while an algorithm runs a vtkSMPTools loop
+// that checks vtkSMPTools::IsCancelled() stops the loop and gives an empty
+// output marked ABORTED, even though the algorithm never calls CheckAbort().
+// Also check that the loops that do not check it, such as the computation of
+// the range of an input array, still run to completion so that the caches
+// they fill stay valid.
+
+#include "vtkDoubleArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 100000;
+
+class SMPSource : public vtkPolyDataAlgorithm
+{
+public:
+  static SMPSource* New();
+  vtkTypeMacro(SMPSource, vtkPolyDataAlgorithm);
+
+  // Set AbortExecute from the loop after this many points, -1 to never.
+  vtkIdType AbortAfter = -1;
+  std::atomic<vtkIdType> NumberOfProcessedPoints{ 0 };
+
+protected:
+  SMPSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector* outInfoVec) override
+  {
+    vtkPolyData* output = vtkPolyData::GetData(outInfoVec);
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(NumberOfPoints);
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Values");
+    values->SetNumberOfTuples(NumberOfPoints);
+    this->NumberOfProcessedPoints = 0;
+    vtkSMPTools::For(0, NumberOfPoints, 100, [&](vtkIdType begin, vtkIdType end) {
+      if (vtkSMPTools::IsCancelled())
+      {
+        return;
+      }
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        points->SetPoint(i, i, 0.0, 0.0);
+        values->SetValue(i, i);
+      }
+      const vtkIdType processed = (this->NumberOfProcessedPoints += end - begin);
+      if (this->AbortAfter >= 0 && processed >= this->AbortAfter)
+      {
+        // as another thread would do, without modifying the algorithm
+        this->AbortExecute = 1;
+      }
+    });
+    output->SetPoints(points);
+    output->GetPointData()->AddArray(values);
+    return 1;
+  }
+};
+vtkStandardNewMacro(SMPSource);
+
+// Abort itself, then compute the range of the input point array.
+class RangeFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static RangeFilter* New();
+  vtkTypeMacro(RangeFilter, vtkPolyDataAlgorithm);
+
+  double Range[2] = { 0.0, 0.0 };
+
+protected:
+  int RequestData(
+    vtkInformation*, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inInfoVec[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outInfoVec);
+    this->AbortExecute = 1;
+    input->GetPointData()->GetArray("Values")->GetRange(this->Range, 0);
+    output->ShallowCopy(input);
+    return 1;
+  }
+};
+vtkStandardNewMacro(RangeFilter);
+}
+
+int TestCancelSMPAlgorithm(int, char*[])
+{
+  vtkNew<SMPSource> source;
+  source->AbortAfter = NumberOfPoints / 10;
+  source->Update();
+
+  int retVal = EXIT_SUCCESS;
+  if (!source->GetOutputInformation(0)->Get(vtkAlgorithm::ABORTED()) ||
+    source->GetOutput()->GetNumberOfPoints() != 0)
+  {
+    std::cerr << "The aborted source should have an empty output marked ABORTED" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+  if (source->NumberOfProcessedPoints >= NumberOfPoints)
+  {
+    std::cerr << "The loop of the aborted source did not stop early" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  source->SetAbortExecute(0);
+  source->AbortAfter = -1;
+  source->Modified();
+  source->Update();
+  if (source->GetOutputInformation(0)->Get(vtkAlgorithm::ABORTED()) ||
+    source->GetOutput()->GetNumberOfPoints() != NumberOfPoints ||
+    source->NumberOfProcessedPoints != NumberOfPoints)
+  {
+    std::cerr << "The source should run to completion once AbortExecute is cleared" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  // The aborted filter does not cut the range computation of its input short,
+  // which would leave a wrong range in the cache of the array.
+  vtkNew<RangeFilter> rangeFilter;
+  rangeFilter->SetInputConnection(source->GetOutputPort());
+  rangeFilter->Update();
+  vtkDataArray* values = source->GetOutput()->GetPointData()->GetArray("Values");
+  double range[2];
+  values->GetRange(range, 0);
+  if (!rangeFilter->GetOutputInformation(0)->Get(vtkAlgorithm::ABORTED()) ||
+    rangeFilter->Range[0] != 0.0 || rangeFilter->Range[1] != NumberOfPoints - 1 ||
+    range[0] != 0.0 || range[1] != NumberOfPoints - 1)
+  {
+    std::cerr << "The aborted filter computed the range [" << rangeFilter->Range[0] << ", "
+              << rangeFilter->Range[1] << "] and left [" << range[0] << ", " << range[1]
+              << "] in the cache of its input" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  return retVal;
+}
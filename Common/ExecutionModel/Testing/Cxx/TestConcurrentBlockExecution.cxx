@@ -0,0 +1,132 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestConcurrentBlockExecution.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that algorithms setting CONCURRENT_BLOCK_EXECUTION give the same
+// composite output as when their blocks are processed one at a time.
+
+#include "vtkCellDataToPointData.h"
+#include "vtkCompositeDataPipeline.h"
+#include "vtkDataSet.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPointDataToCellData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkThreshold.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const unsigned int NumberOfBlocks = 16;
+
+bool CompareOutputs(vtkMultiBlockDataSet* concurrent, vtkMultiBlockDataSet* serial)
+{
+  if (!concurrent || !serial || concurrent->GetNumberOfBlocks() != NumberOfBlocks ||
+    serial->GetNumberOfBlocks() != NumberOfBlocks)
+  {
+    std::cerr << "Unexpected composite output structure" << std::endl;
+    return false;
+  }
+  for (unsigned int i = 0; i < NumberOfBlocks; ++i)
+  {
+    auto concurrentBlock = vtkDataSet::SafeDownCast(concurrent->GetBlock(i));
+    auto serialBlock = vtkDataSet::SafeDownCast(serial->GetBlock(i));
+    if (!concurrentBlock != !serialBlock)
+    {
+      std::cerr << "Block " << i << " is missing in one of the outputs" << std::endl;
+      return false;
+    }
+    if (concurrentBlock &&
+      (concurrentBlock->GetNumberOfCells() != serialBlock->GetNumberOfCells() ||
+        concurrentBlock->GetNumberOfPoints() != serialBlock->GetNumberOfPoints() ||
+        concurrentBlock->GetPointData()->GetNumberOfArrays() !=
+          serialBlock->GetPointData()->GetNumberOfArrays()))
+    {
+      std::cerr << "Block " << i << " differs between the outputs" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestConcurrentBlockExecution(int, char*[])
+{
+  // Blocks of different sizes, with an empty block in the middle.
+  vtkNew<vtkMultiBlockDataSet> input;
+  input->SetNumberOfBlocks(NumberOfBlocks);
+  for (unsigned int i = 0; i < NumberOfBlocks; ++i)
+  {
+    if (i == NumberOfBlocks / 2)
+    {
+      continue;
+    }
+    vtkNew<vtkRTAnalyticSource> source;
+    const int extent = 4 + static_cast<int>(i);
+    source->SetWholeExtent(-extent, extent, -extent, extent, -extent, extent);
+    source->Update();
+    vtkNew<vtkImageData> block;
+    block->ShallowCopy(source->GetOutput());
+    input->SetBlock(i, block);
+  }
+
+  // Turn the point scalars into cell data, then threshold and average back to
+  // points, all of which are marked for concurrent block execution.
+  auto makePipeline = [&input](bool concurrent, vtkNew<vtkPointDataToCellData>& toCells,
+                        vtkNew<vtkThreshold>& threshold, vtkNew<vtkCellDataToPointData>& toPoints) {
+    toCells->SetInputData(input);
+    threshold->SetInputConnection(toCells->GetOutputPort());
+    threshold->SetInputArrayToProcess(
+      0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "RTData");
+    threshold->SetLowerThreshold(100.0);
+    threshold->SetUpperThreshold(200.0);
+    toPoints->SetInputConnection(threshold->GetOutputPort());
+    if (!concurrent)
+    {
+      threshold->GetInformation()->Remove(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION());
+      toPoints->GetInformation()->Remove(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION());
+    }
+    toPoints->Update();
+  };
+
+  vtkNew<vtkPointDataToCellData> toCells;
+  vtkNew<vtkThreshold> threshold;
+  vtkNew<vtkCellDataToPointData> toPoints;
+  if (!threshold->GetInformation()->Get(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION()) ||
+    !toPoints->GetInformation()->Get(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION()))
+  {
+    std::cerr << "vtkThreshold and vtkCellDataToPointData should allow concurrent block execution"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  makePipeline(true, toCells, threshold, toPoints);
+
+  vtkNew<vtkPointDataToCellData> serialToCells;
+  vtkNew<vtkThreshold> serialThreshold;
+  vtkNew<vtkCellDataToPointData> serialToPoints;
+  makePipeline(false, serialToCells, serialThreshold, serialToPoints);
+
+  if (!CompareOutputs(vtkMultiBlockDataSet::SafeDownCast(threshold->GetOutputDataObject(0)),
+        vtkMultiBlockDataSet::SafeDownCast(serialThreshold->GetOutputDataObject(0))) ||
+    !CompareOutputs(vtkMultiBlockDataSet::SafeDownCast(toPoints->GetOutputDataObject(0)),
+      vtkMultiBlockDataSet::SafeDownCast(serialToPoints->GetOutputDataObject(0))))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
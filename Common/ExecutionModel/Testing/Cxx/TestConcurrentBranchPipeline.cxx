@@ -0,0 +1,124 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestConcurrentBranchPipeline.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkConcurrentBranchPipeline updates the branches gathered by an
+// append filter once each, and the source they share only once, whether the
+// branches are declared re-entrant or not.
+
+#include "vtkAppendPolyData.h"
+#include "vtkConcurrentBranchPipeline.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSphereSource.h"
+
+#include <atomic>
+#include <cstdlib>
+
+namespace
+{
+// Pass its input through and count its executions.
+class CountingFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static CountingFilter* New();
+  vtkTypeMacro(CountingFilter, vtkPolyDataAlgorithm);
+
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    ++this->NumberOfExecutions;
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->ShallowCopy(input);
+    return 1;
+  }
+};
+vtkStandardNewMacro(CountingFilter);
+
+bool RunPipeline(bool reentrant)
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<CountingFilter> source;
+  source->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkAppendPolyData> append;
+
+  const int numBranches = 4;
+  vtkNew<CountingFilter> branches[numBranches];
+  for (auto& branch : branches)
+  {
+    branch->SetInputConnection(source->GetOutputPort());
+    append->AddInputConnection(branch->GetOutputPort());
+  }
+  if (reentrant)
+  {
+    sphere->GetInformation()->Set(vtkConcurrentBranchPipeline::REENTRANT(), 1);
+    source->GetInformation()->Set(vtkConcurrentBranchPipeline::REENTRANT(), 1);
+    for (auto& branch : branches)
+    {
+      branch->GetInformation()->Set(vtkConcurrentBranchPipeline::REENTRANT(), 1);
+    }
+  }
+
+  bool success = true;
+  for (int update = 0; update < 2; ++update)
+  {
+    // modify the shared upstream part so that everything executes again
+    sphere->SetThetaResolution(8 + update);
+    append->Update();
+
+    const vtkIdType expected = numBranches * sphere->GetOutput()->GetNumberOfPoints();
+    if (append->GetOutput()->GetNumberOfPoints() != expected)
+    {
+      vtkLog(ERROR,
+        "Wrong number of points: " << append->GetOutput()->GetNumberOfPoints() << " instead of "
+                                   << expected);
+      success = false;
+    }
+    if (source->NumberOfExecutions != update + 1)
+    {
+      vtkLog(ERROR, "The shared filter executed " << source->NumberOfExecutions << " times");
+      success = false;
+    }
+    for (auto& branch : branches)
+    {
+      if (branch->NumberOfExecutions != update + 1)
+      {
+        vtkLog(ERROR, "A branch executed " << branch->NumberOfExecutions << " times");
+        success = false;
+      }
+    }
+  }
+  return success;
+}
+}
+
+int TestConcurrentBranchPipeline(int, char*[])
+{
+  vtkNew<vtkConcurrentBranchPipeline> prototype;
+  vtkAlgorithm::SetDefaultExecutivePrototype(prototype);
+
+  bool success = RunPipeline(true);
+  success &= RunPipeline(false);
+
+  vtkAlgorithm::SetDefaultExecutivePrototype(nullptr);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
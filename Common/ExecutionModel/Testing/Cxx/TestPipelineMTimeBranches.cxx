@@ -0,0 +1,117 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPipelineMTimeBranches.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that updating a pipeline whose branches are repeatedly split and
+// merged computes the modified time of each algorithm once, and still
+// executes the algorithms downstream of a modified one.
+
+#include "vtkAppendPolyData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+// Pass its input through, and count its executions and pipeline modified
+// time requests.
+class CountingFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static CountingFilter* New();
+  vtkTypeMacro(CountingFilter, vtkPolyDataAlgorithm);
+
+  int NumberOfExecutions = 0;
+  int NumberOfMTimeRequests = 0;
+
+  int ComputePipelineMTime(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec, int requestFromOutputPort, vtkMTimeType* mtime) override
+  {
+    ++this->NumberOfMTimeRequests;
+    return this->Superclass::ComputePipelineMTime(
+      request, inInfoVec, outInfoVec, requestFromOutputPort, mtime);
+  }
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    ++this->NumberOfExecutions;
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->ShallowCopy(input);
+    return 1;
+  }
+};
+vtkStandardNewMacro(CountingFilter);
+}
+
+int TestPipelineMTimeBranches(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<CountingFilter> source;
+  source->SetInputConnection(sphere->GetOutputPort());
+
+  // each stage splits the output of the previous one in two branches and
+  // merges them again, so that the source is reached through 2^12 paths.
+  const int numStages = 12;
+  std::vector<vtkSmartPointer<vtkAlgorithm>> algorithms;
+  vtkAlgorithm* last = source;
+  for (int i = 0; i < numStages; ++i)
+  {
+    vtkNew<vtkAppendPolyData> append;
+    for (int j = 0; j < 2; ++j)
+    {
+      vtkNew<CountingFilter> branch;
+      branch->SetInputConnection(last->GetOutputPort());
+      append->AddInputConnection(branch->GetOutputPort());
+      algorithms.emplace_back(branch);
+    }
+    algorithms.emplace_back(append);
+    last = append;
+  }
+
+  for (int update = 1; update <= 3; ++update)
+  {
+    last->Update();
+    if (source->NumberOfMTimeRequests != update || source->NumberOfExecutions != 1)
+    {
+      vtkLog(ERROR,
+        "Source computed its modified time " << source->NumberOfMTimeRequests
+                                             << " times and executed "
+                                             << source->NumberOfExecutions << " times after "
+                                             << update << " updates.");
+      return EXIT_FAILURE;
+    }
+  }
+
+  sphere->SetThetaResolution(16);
+  last->Update();
+  if (source->NumberOfExecutions != 2 ||
+    vtkPolyData::SafeDownCast(last->GetOutputDataObject(0))->GetNumberOfPoints() !=
+      (1 << numStages) * sphere->GetOutput()->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, "Pipeline was not updated after modifying the sphere.");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
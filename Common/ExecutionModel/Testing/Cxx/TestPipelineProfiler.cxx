@@ -0,0 +1,152 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPipelineProfiler.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkPipelineProfiler records the executions of a pipeline,
+// including the internal pipeline of a filter as children, and writes them
+// as a Chrome trace, with the vtkSMPTools loops they run if requested.
+
+#include "vtkElevationFilter.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Run an internal vtkElevationFilter on its input.
+class InternalPipelineFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static InternalPipelineFilter* New();
+  vtkTypeMacro(InternalPipelineFilter, vtkPolyDataAlgorithm);
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkNew<vtkElevationFilter> elevation;
+    elevation->SetInputData(vtkPolyData::GetData(inputVector[0]));
+    elevation->Update();
+    vtkPolyData::GetData(outputVector)->ShallowCopy(elevation->GetOutput());
+    return 1;
+  }
+};
+vtkStandardNewMacro(InternalPipelineFilter);
+
+vtkIdType FindEvent(vtkPipelineProfiler* profiler, const std::string& className)
+{
+  for (vtkIdType i = 0; i < profiler->GetNumberOfEvents(); ++i)
+  {
+    if (profiler->GetEventClassName(i) == className)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+}
+
+int TestPipelineProfiler(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<InternalPipelineFilter> filter;
+  filter->SetInputConnection(sphere->GetOutputPort());
+
+  vtkNew<vtkPipelineProfiler> profiler;
+  profiler->StartProfiling();
+  filter->Update();
+  profiler->StopProfiling();
+
+  // nothing is recorded once stopped
+  const vtkIdType numberOfEvents = profiler->GetNumberOfEvents();
+  sphere->SetThetaResolution(16);
+  filter->Update();
+  if (profiler->GetNumberOfEvents() != numberOfEvents)
+  {
+    vtkLog(ERROR, "Events recorded after StopProfiling()");
+    return EXIT_FAILURE;
+  }
+
+  const vtkIdType sphereEvent = FindEvent(profiler, "vtkSphereSource");
+  const vtkIdType filterEvent = FindEvent(profiler, "InternalPipelineFilter");
+  const vtkIdType elevationEvent = FindEvent(profiler, "vtkElevationFilter");
+  if (sphereEvent < 0 || filterEvent < 0 || elevationEvent < 0)
+  {
+    vtkLog(ERROR, "Missing events");
+    return EXIT_FAILURE;
+  }
+  if (profiler->GetEventParent(sphereEvent) != -1 || profiler->GetEventParent(filterEvent) != -1 ||
+    profiler->GetEventParent(elevationEvent) != filterEvent)
+  {
+    vtkLog(ERROR, "Wrong parent events");
+    return EXIT_FAILURE;
+  }
+  if (profiler->GetEventStartTime(elevationEvent) < profiler->GetEventStartTime(filterEvent) ||
+    profiler->GetEventWallTime(elevationEvent) > profiler->GetEventWallTime(filterEvent))
+  {
+    vtkLog(ERROR, "The internal execution is not nested in its parent");
+    return EXIT_FAILURE;
+  }
+  if (profiler->GetEventOutputSize(sphereEvent) <= 0 ||
+    profiler->GetEventInputSize(filterEvent) != profiler->GetEventOutputSize(sphereEvent))
+  {
+    vtkLog(ERROR, "Wrong data sizes");
+    return EXIT_FAILURE;
+  }
+
+  std::ostringstream trace;
+  profiler->WriteChromeTrace(trace);
+  if (trace.str().find("\"traceEvents\"") == std::string::npos ||
+    trace.str().find("\"name\":\"vtkElevationFilter\"") == std::string::npos)
+  {
+    vtkLog(ERROR, "Unexpected trace: " << trace.str());
+    return EXIT_FAILURE;
+  }
+
+  // the loops of vtkElevationFilter are nested in its execution
+  profiler->ClearEvents();
+  profiler->ProfileSMPOn();
+  profiler->StartProfiling();
+  filter->Modified();
+  filter->Update();
+  profiler->StopProfiling();
+  if (vtkSMPTools::GetInstrumentation())
+  {
+    vtkLog(ERROR, "The instrumentation of vtkSMPTools is still enabled");
+    return EXIT_FAILURE;
+  }
+  trace.str("");
+  profiler->WriteChromeTrace(trace);
+  const std::string parent =
+    "\"parent\":" + std::to_string(FindEvent(profiler, "vtkElevationFilter"));
+  const std::size_t loop = trace.str().find("\"cat\":\"vtkSMPTools\"");
+  if (loop == std::string::npos || trace.str().find(parent, loop) == std::string::npos)
+  {
+    vtkLog(ERROR, "Missing vtkSMPTools events: " << trace.str());
+    return EXIT_FAILURE;
+  }
+
+  profiler->PrintSummary(std::cout);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestUpdateTimeStepAsync.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkStreamingDemandDrivenPipeline::UpdateTimeStepAsync() updates
+// the requested time step in the background, and that requests made while it
+// runs wait for it.
+
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPassInputTypeAlgorithm.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+// Produces a single point whose x coordinate is the time step, slowly.
+class TimeStepSource : public vtkPolyDataAlgorithm
+{
+public:
+  static TimeStepSource* New();
+  vtkTypeMacro(TimeStepSource, vtkPolyDataAlgorithm);
+
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+protected:
+  TimeStepSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector* outInfoVec)
+    override
+  {
+    const double steps[5] = { 0.0, 1.0, 2.0, 3.0, 4.0 };
+    const double range[2] = { 0.0, 4.0 };
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(0);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), steps, 5);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector* outInfoVec) override
+  {
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(0);
+    const double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    vtkNew<vtkPoints> points;
+    points->InsertNextPoint(time, 0.0, 0.0);
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    output->SetPoints(points);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    ++this->NumberOfExecutions;
+    return 1;
+  }
+};
+vtkStandardNewMacro(TimeStepSource);
+
+class PassFilter : public vtkPassInputTypeAlgorithm
+{
+public:
+  static PassFilter* New();
+  vtkTypeMacro(PassFilter, vtkPassInputTypeAlgorithm);
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override
+  {
+    vtkDataObject* input = vtkDataObject::GetData(inInfoVec[0], 0);
+    vtkDataObject* output = vtkDataObject::GetData(outInfoVec, 0);
+    output->ShallowCopy(input);
+    return 1;
+  }
+};
+vtkStandardNewMacro(PassFilter);
+
+bool CheckTime(vtkDataObject* data, double time, const char* what)
+{
+  vtkPolyData* polyData = vtkPolyData::SafeDownCast(data);
+  if (!polyData || polyData->GetNumberOfPoints() != 1 || polyData->GetPoint(0)[0] != time ||
+    polyData->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) != time)
+  {
+    std::cerr << "Wrong " << what << " for time step " << time << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestUpdateTimeStepAsync(int, char*[])
+{
+  vtkNew<TimeStepSource> source;
+  vtkNew<PassFilter> filter;
+  filter->SetInputConnection(source->GetOutputPort());
+  filter->UpdateTimeStep(0.0);
+  vtkStreamingDemandDrivenPipeline* executive =
+    vtkStreamingDemandDrivenPipeline::SafeDownCast(source->GetExecutive());
+
+  int retVal = EXIT_SUCCESS;
+
+  // Prefetch the next time step, then request it from downstream: the source
+  // must not execute again.
+  auto future = executive->UpdateTimeStepAsync(0, 1.0);
+  filter->UpdateTimeStep(1.0);
+  if (!CheckTime(future.get(), 1.0, "prefetched data") ||
+    !CheckTime(filter->GetOutputDataObject(0), 1.0, "filter output"))
+  {
+    retVal = EXIT_FAILURE;
+  }
+  if (source->NumberOfExecutions != 2)
+  {
+    std::cerr << "The source executed " << source->NumberOfExecutions << " times instead of 2"
+              << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  // A request for another time step waits for the background update, whose
+  // result stays valid afterwards.
+  future = executive->UpdateTimeStepAsync(0, 2.0);
+  filter->UpdateTimeStep(3.0);
+  if (!CheckTime(future.get(), 2.0, "prefetched data") ||
+    !CheckTime(filter->GetOutputDataObject(0), 3.0, "filter output"))
+  {
+    retVal = EXIT_FAILURE;
+  }
+
+  return retVal;
+}
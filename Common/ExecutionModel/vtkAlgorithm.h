@@ -571,8 +571,12 @@ public:
   ///@{
   /**
    * Bring this algorithm's outputs up-to-date.
+   * The Python wrappers let other Python threads run during the update
+   * methods, so that threads can update independent pipelines concurrently.
    */
+  VTK_UNBLOCKTHREADS
   virtual void Update(int port);
+  VTK_UNBLOCKTHREADS
   virtual void Update();
   ///@}
 
@@ -598,6 +602,7 @@ public:
    * Available requests include UPDATE_PIECE_NUMBER(), UPDATE_NUMBER_OF_PIECES()
    * UPDATE_EXTENT() etc etc.
    */
+  VTK_UNBLOCKTHREADS
   virtual vtkTypeBool Update(int port, vtkInformationVector* requests);
 
   /**
@@ -605,6 +610,7 @@ public:
    * to its first output port. See documentation for
    * Update(int port, vtkInformationVector* requests) for details.
    */
+  VTK_UNBLOCKTHREADS
   virtual vtkTypeBool Update(vtkInformation* requests);
 
   /**
@@ -613,6 +619,7 @@ public:
    * Update(int port, vtkInformationVector* requests) for details.
    * Supports piece and extent (optional) requests.
    */
+  VTK_UNBLOCKTHREADS
   virtual int UpdatePiece(
     int piece, int numPieces, int ghostLevels, const int extents[6] = nullptr);
 
@@ -621,6 +628,7 @@ public:
    * to its first output port.
    * Supports extent request.
    */
+  VTK_UNBLOCKTHREADS
   virtual int UpdateExtent(const int extents[6]);
 
   /**
@@ -629,17 +637,20 @@ public:
    * Update(int port, vtkInformationVector* requests) for details.
    * Supports time, piece (optional) and extent (optional) requests.
    */
+  VTK_UNBLOCKTHREADS
   virtual int UpdateTimeStep(double time, int piece = -1, int numPieces = 1, int ghostLevels = 0,
     const int extents[6] = nullptr);
 
   /**
    * Bring the algorithm's information up-to-date.
    */
+  VTK_UNBLOCKTHREADS
   virtual void UpdateInformation();
 
   /**
    * Create output object(s).
    */
+  VTK_UNBLOCKTHREADS
   virtual void UpdateDataObject();
 
   /**
@@ -650,6 +661,7 @@ public:
   /**
    * Bring this algorithm's outputs up-to-date.
    */
+  VTK_UNBLOCKTHREADS
   virtual void UpdateWholeExtent();
 
   /**
@@ -0,0 +1,356 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCachedCompositeDataPipeline.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCachedCompositeDataPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationDoubleKey.h"
+#include "vtkInformationIdTypeKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationIntegerVectorKey.h"
+#include "vtkInformationStringKey.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <atomic>
+#include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCachedCompositeDataPipeline);
+
+vtkInformationKeyMacro(vtkCachedCompositeDataPipeline, CACHE_STATE, String);
+vtkInformationKeyMacro(vtkCachedCompositeDataPipeline, CACHE_ENTRY, IdType);
+
+namespace
+{
+//------------------------------------------------------------------------------
+struct CacheEntry
+{
+  vtkExecutive* Owner;
+  std::string Key;
+  vtkIdType Id;
+  unsigned long Size;
+  std::vector<vtkSmartPointer<vtkDataObject>> Outputs;
+};
+
+//------------------------------------------------------------------------------
+// The cache shared by all the executives. Entries are sorted from the most
+// to the least recently used.
+struct Cache
+{
+  std::mutex Mutex;
+  std::list<CacheEntry> Entries;
+  std::map<std::pair<vtkExecutive*, std::string>, std::list<CacheEntry>::iterator> Index;
+  unsigned long Budget = 1048576;
+  unsigned long Usage = 0;
+  vtkIdType NextId = 1;
+  std::atomic<vtkIdType> Hits{ 0 };
+  std::atomic<vtkIdType> Misses{ 0 };
+
+  static Cache& GetInstance()
+  {
+    static Cache instance;
+    return instance;
+  }
+
+  // Must be called with the mutex locked.
+  void Erase(std::list<CacheEntry>::iterator entry)
+  {
+    this->Usage -= entry->Size;
+    this->Index.erase(std::make_pair(entry->Owner, entry->Key));
+    this->Entries.erase(entry);
+  }
+
+  // Must be called with the mutex locked.
+  void Trim()
+  {
+    while (this->Usage > this->Budget && !this->Entries.empty())
+    {
+      this->Erase(std::prev(this->Entries.end()));
+    }
+  }
+
+  // Must be called with the mutex locked.
+  void EraseAll(vtkExecutive* owner)
+  {
+    for (auto entry = this->Entries.begin(); entry != this->Entries.end();)
+    {
+      auto next = std::next(entry);
+      if (!owner || entry->Owner == owner)
+      {
+        this->Erase(entry);
+      }
+      entry = next;
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+void SetCacheEntry(vtkInformationVector* outInfoVec, vtkIdType id)
+{
+  for (int i = 0; i < outInfoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+    if (id > 0)
+    {
+      outInfo->Set(vtkCachedCompositeDataPipeline::CACHE_ENTRY(), id);
+    }
+    else
+    {
+      outInfo->Remove(vtkCachedCompositeDataPipeline::CACHE_ENTRY());
+    }
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::vtkCachedCompositeDataPipeline() = default;
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::~vtkCachedCompositeDataPipeline()
+{
+  this->ReleaseCachedOutputs();
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ReleaseCachedOutputs()
+{
+  Cache& cache = Cache::GetInstance();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.EraseAll(this);
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::SetCacheMemoryBudget(unsigned long kibibytes)
+{
+  Cache& cache = Cache::GetInstance();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Budget = kibibytes;
+  cache.Trim();
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkCachedCompositeDataPipeline::GetCacheMemoryBudget()
+{
+  Cache& cache = Cache::GetInstance();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return cache.Budget;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkCachedCompositeDataPipeline::GetCacheMemoryUsage()
+{
+  Cache& cache = Cache::GetInstance();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return cache.Usage;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkCachedCompositeDataPipeline::GetTotalNumberOfCacheHits()
+{
+  return Cache::GetInstance().Hits;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkCachedCompositeDataPipeline::GetTotalNumberOfCacheMisses()
+{
+  return Cache::GetInstance().Misses;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ResetCacheStatistics()
+{
+  Cache& cache = Cache::GetInstance();
+  cache.Hits = 0;
+  cache.Misses = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ClearCache()
+{
+  Cache& cache = Cache::GetInstance();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.EraseAll(nullptr);
+}
+
+//------------------------------------------------------------------------------
+bool vtkCachedCompositeDataPipeline::ComputeCacheKey(
+  vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, std::string& key)
+{
+  // Streaming algorithms executing several times for one request and sinks
+  // have nothing to cache.
+  if (this->ContinueExecuting || outInfoVec->GetNumberOfInformationObjects() == 0)
+  {
+    return false;
+  }
+
+  std::ostringstream stream;
+  stream.precision(std::numeric_limits<double>::max_digits10);
+
+  vtkInformation* algorithmInfo = this->Algorithm->GetInformation();
+  if (algorithmInfo->Has(CACHE_STATE()))
+  {
+    stream << "state:" << algorithmInfo->Get(CACHE_STATE()) << ';';
+  }
+  else
+  {
+    stream << "mtime:" << this->Algorithm->GetMTime() << ';';
+  }
+
+  for (int i = 0; i < this->Algorithm->GetNumberOfInputPorts(); ++i)
+  {
+    for (int j = 0; j < inInfoVec[i]->GetNumberOfInformationObjects(); ++j)
+    {
+      vtkInformation* inInfo = inInfoVec[i]->GetInformationObject(j);
+      vtkDataObject* input = inInfo->Get(vtkDataObject::DATA_OBJECT());
+      if (inInfo->Has(CACHE_ENTRY()))
+      {
+        stream << "input:" << i << ',' << j << ":entry:" << inInfo->Get(CACHE_ENTRY()) << ';';
+      }
+      else if (input)
+      {
+        stream << "input:" << i << ',' << j << ":mtime:" << input->GetMTime() << ';';
+      }
+    }
+  }
+
+  vtkInformationKey* requestKeys[] = { UPDATE_TIME_STEP(), UPDATE_PIECE_NUMBER(),
+    UPDATE_NUMBER_OF_PIECES(), UPDATE_NUMBER_OF_GHOST_LEVELS(), UPDATE_EXTENT(),
+    UPDATE_COMPOSITE_INDICES(), LOAD_REQUESTED_BLOCKS() };
+  for (int i = 0; i < outInfoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+    stream << "output:" << i;
+    for (vtkInformationKey* requestKey : requestKeys)
+    {
+      if (outInfo->Has(requestKey))
+      {
+        stream << ':' << requestKey->GetName() << '=';
+        requestKey->Print(stream, outInfo);
+      }
+    }
+    stream << ';';
+  }
+
+  key = stream.str();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  std::string key;
+  if (!this->ComputeCacheKey(inInfoVec, outInfoVec, key))
+  {
+    SetCacheEntry(outInfoVec, 0);
+    return this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  }
+
+  Cache& cache = Cache::GetInstance();
+  std::vector<vtkSmartPointer<vtkDataObject>> cachedOutputs;
+  vtkIdType entryId = 0;
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    auto found = cache.Index.find(std::make_pair(static_cast<vtkExecutive*>(this), key));
+    if (found != cache.Index.end())
+    {
+      // Move the entry to the front of the least recently used list.
+      cache.Entries.splice(cache.Entries.begin(), cache.Entries, found->second);
+      cachedOutputs = found->second->Outputs;
+      entryId = found->second->Id;
+    }
+  }
+
+  if (entryId > 0)
+  {
+    // Go through the usual start and end of execution so that observers
+    // and the output information are updated as if the algorithm executed.
+    this->ExecuteDataStart(request, inInfoVec, outInfoVec);
+    for (int i = 0; i < outInfoVec->GetNumberOfInformationObjects(); ++i)
+    {
+      vtkDataObject* output =
+        outInfoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+      if (output && cachedOutputs[i])
+      {
+        output->ShallowCopy(cachedOutputs[i]);
+      }
+    }
+    this->ExecuteDataEnd(request, inInfoVec, outInfoVec);
+    SetCacheEntry(outInfoVec, entryId);
+    ++this->NumberOfCacheHits;
+    ++cache.Hits;
+    return 1;
+  }
+
+  ++this->NumberOfCacheMisses;
+  ++cache.Misses;
+  int result = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  if (!result || this->ContinueExecuting || this->Algorithm->GetAbortOutput())
+  {
+    SetCacheEntry(outInfoVec, 0);
+    return result;
+  }
+
+  CacheEntry entry;
+  entry.Owner = this;
+  entry.Key = key;
+  entry.Size = 0;
+  for (int i = 0; i < outInfoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkDataObject* output =
+      outInfoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    vtkSmartPointer<vtkDataObject> copy;
+    if (output)
+    {
+      copy = vtk::TakeSmartPointer(output->NewInstance());
+      copy->ShallowCopy(output);
+      entry.Size += copy->GetActualMemorySize();
+    }
+    entry.Outputs.push_back(copy);
+  }
+
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  if (entry.Size > cache.Budget)
+  {
+    SetCacheEntry(outInfoVec, 0);
+    return result;
+  }
+  entry.Id = cache.NextId++;
+  SetCacheEntry(outInfoVec, entry.Id);
+  cache.Usage += entry.Size;
+  cache.Entries.push_front(std::move(entry));
+  cache.Index[std::make_pair(static_cast<vtkExecutive*>(this), cache.Entries.front().Key)] =
+    cache.Entries.begin();
+  cache.Trim();
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfCacheHits: " << this->NumberOfCacheHits << "\n";
+  os << indent << "NumberOfCacheMisses: " << this->NumberOfCacheMisses << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,165 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCachedCompositeDataPipeline.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkCachedCompositeDataPipeline
+ * @brief   Executive caching the outputs of its algorithm within a memory budget
+ *
+ * vtkCachedCompositeDataPipeline behaves like vtkCompositeDataPipeline but
+ * keeps shallow copies of the outputs of its algorithm. When the algorithm
+ * needs to execute, the executive first looks for outputs computed earlier
+ * for the same request and reuses them instead of calling the algorithm.
+ * Outputs are cached for:
+ *
+ * - the state of the algorithm: the string set with CACHE_STATE() in the
+ *   information of the algorithm (see vtkAlgorithm::GetInformation()), or
+ *   its modification time if none is set,
+ * - the inputs: the cache entry they come from if they are produced by a
+ *   vtkCachedCompositeDataPipeline, their modification time otherwise,
+ * - the request on each output: time step, piece, number of pieces, ghost
+ *   levels, update extent and composite indices.
+ *
+ * Since the modification time of an algorithm changes with each of its
+ * parameters, setting CACHE_STATE() is needed to hit the cache when a
+ * parameter is toggled back and forth. The string must describe all the
+ * parameters that affect the output:
+ *
+ * \code{.cpp}
+ * contour->SetValue(0, value);
+ * contour->GetInformation()->Set(
+ *   vtkCachedCompositeDataPipeline::CACHE_STATE(), "value=" + std::to_string(value));
+ * \endcode
+ *
+ * Requests for other time steps on the other hand hit the cache without
+ * any help, which makes scrubbing through time back and forth cheap.
+ *
+ * All the instances share one cache, limited to a memory budget. When it is
+ * exceeded, the least recently used outputs are released first, whatever
+ * executive they belong to. The numbers of hits and misses are recorded for
+ * each executive and globally.
+ *
+ * Unlike vtkCachedStreamingDemandDrivenPipeline, which reuses image data
+ * containing the requested extent, an output is reused only for an
+ * identical request. It works with any data type, including composite data.
+ *
+ * @warning
+ * Cached outputs share their arrays with the outputs of the algorithm:
+ * algorithms modifying their input in place must not be used downstream.
+ *
+ * @sa
+ * vtkCachedStreamingDemandDrivenPipeline vtkCompositeDataPipeline
+ */
+
+#ifndef vtkCachedCompositeDataPipeline_h
+#define vtkCachedCompositeDataPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+#include <string> // For std::string
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformationIdTypeKey;
+class vtkInformationStringKey;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkCachedCompositeDataPipeline
+  : public vtkCompositeDataPipeline
+{
+public:
+  static vtkCachedCompositeDataPipeline* New();
+  vtkTypeMacro(vtkCachedCompositeDataPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Number of times the outputs of the algorithm were found in the cache or
+   * had to be computed.
+   */
+  vtkGetMacro(NumberOfCacheHits, vtkIdType);
+  vtkGetMacro(NumberOfCacheMisses, vtkIdType);
+  ///@}
+
+  /**
+   * Release the outputs of this executive's algorithm held in the cache.
+   */
+  void ReleaseCachedOutputs();
+
+  ///@{
+  /**
+   * Memory budget, in kibibytes, of the cache shared by all instances. It
+   * defaults to 1048576 (1 GiB). Lowering it releases the least recently
+   * used outputs right away.
+   */
+  static void SetCacheMemoryBudget(unsigned long kibibytes);
+  static unsigned long GetCacheMemoryBudget();
+  ///@}
+
+  /**
+   * Memory, in kibibytes, used by the outputs held in the shared cache.
+   */
+  static unsigned long GetCacheMemoryUsage();
+
+  ///@{
+  /**
+   * Number of hits and misses of all the instances since the last call to
+   * ResetCacheStatistics().
+   */
+  static vtkIdType GetTotalNumberOfCacheHits();
+  static vtkIdType GetTotalNumberOfCacheMisses();
+  static void ResetCacheStatistics();
+  ///@}
+
+  /**
+   * Release all the outputs held in the shared cache.
+   */
+  static void ClearCache();
+
+  /**
+   * Key set in the information of an algorithm to describe the parameters
+   * affecting its outputs. It replaces the modification time of the
+   * algorithm in the cache keys.
+   */
+  static vtkInformationStringKey* CACHE_STATE();
+
+  /**
+   * Key set by the executive in the information of each output to identify
+   * the cache entry holding it, so that downstream executives can use it in
+   * their own cache keys.
+   */
+  static vtkInformationIdTypeKey* CACHE_ENTRY();
+
+protected:
+  vtkCachedCompositeDataPipeline();
+  ~vtkCachedCompositeDataPipeline() override;
+
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
+  /**
+   * Build the key identifying the outputs the algorithm would produce for
+   * the current request. Returns false if the outputs cannot be cached.
+   */
+  virtual bool ComputeCacheKey(
+    vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, std::string& key);
+
+  vtkIdType NumberOfCacheHits = 0;
+  vtkIdType NumberOfCacheMisses = 0;
+
+private:
+  vtkCachedCompositeDataPipeline(const vtkCachedCompositeDataPipeline&) = delete;
+  void operator=(const vtkCachedCompositeDataPipeline&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -31,11 +31,17 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationVector.h"
+#include "vtkMemoryResource.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPProgressObserver.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
 #include "vtkTrivialProducer.h"
@@ -50,11 +56,171 @@ vtkInformationKeyMacro(vtkCompositeDataPipeline, UPDATE_COMPOSITE_INDICES, Integ
 vtkInformationKeyMacro(vtkCompositeDataPipeline, DATA_COMPOSITE_INDICES, IntegerVector);
 vtkInformationKeyMacro(vtkCompositeDataPipeline, SUPPRESS_RESET_PI, Integer);
 vtkInformationKeyMacro(vtkCompositeDataPipeline, BLOCK_AMOUNT_OF_DETAIL, Double);
+vtkInformationKeyMacro(vtkCompositeDataPipeline, CONCURRENT_BLOCK_EXECUTION, Integer);
+
+//------------------------------------------------------------------------------
+namespace
+{
+vtkInformationVector** Clone(vtkInformationVector** src, int n)
+{
+  vtkInformationVector** dst = new vtkInformationVector*[n];
+  for (int i = 0; i < n; ++i)
+  {
+    dst[i] = vtkInformationVector::New();
+    dst[i]->Copy(src[i], 1);
+  }
+  return dst;
+}
+void DeleteAll(vtkInformationVector** dst, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    dst[i]->Delete();
+  }
+  delete[] dst;
+}
+}
+
+//------------------------------------------------------------------------------
+class ProcessBlockData : public vtkObjectBase
+{
+public:
+  vtkBaseTypeMacro(ProcessBlockData, vtkObjectBase);
+  vtkInformationVector** In;
+  vtkInformationVector* Out;
+  int InSize;
+
+  static ProcessBlockData* New()
+  {
+    // Can't use object factory macros, this is not a vtkObject.
+    ProcessBlockData* ret = new ProcessBlockData;
+    ret->InitializeObjectBase();
+    return ret;
+  }
+
+  void Construct(
+    vtkInformationVector** inInfoVec, int inInfoVecSize, vtkInformationVector* outInfoVec)
+  {
+    this->InSize = inInfoVecSize;
+    this->In = Clone(inInfoVec, inInfoVecSize);
+    this->Out = vtkInformationVector::New();
+    this->Out->Copy(outInfoVec, 1);
+  }
+
+  ~ProcessBlockData() override
+  {
+    DeleteAll(this->In, this->InSize);
+    this->Out->Delete();
+  }
+
+protected:
+  ProcessBlockData()
+    : In(nullptr)
+    , Out(nullptr)
+    , InSize(0)
+  {
+  }
+};
+
+//------------------------------------------------------------------------------
+class ProcessBlock
+{
+public:
+  ProcessBlock(vtkCompositeDataPipeline* exec, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
+    const std::vector<vtkDataObject*>& inObjs, std::vector<vtkDataObject*>& outObjs)
+    : Exec(exec)
+    , InInfoVec(inInfoVec)
+    , OutInfoVec(outInfoVec)
+    , CompositePort(compositePort)
+    , Connection(connection)
+    , Request(request)
+    , InObjs(inObjs)
+    , OutObjs(outObjs.data())
+  {
+    int numInputPorts = this->Exec->GetNumberOfInputPorts();
+    this->InfoPrototype = vtkSmartPointer<ProcessBlockData>::New();
+    this->InfoPrototype->Construct(this->InInfoVec, numInputPorts, this->OutInfoVec);
+  }
+
+  ~ProcessBlock()
+  {
+    vtkSMPThreadLocal<vtkInformationVector**>::iterator itr1 = this->InInfoVecs.begin();
+    vtkSMPThreadLocal<vtkInformationVector**>::iterator end1 = this->InInfoVecs.end();
+    while (itr1 != end1)
+    {
+      DeleteAll(*itr1, this->InfoPrototype->InSize);
+      ++itr1;
+    }
+
+    vtkSMPThreadLocal<vtkInformationVector*>::iterator itr2 = this->OutInfoVecs.begin();
+    vtkSMPThreadLocal<vtkInformationVector*>::iterator end2 = this->OutInfoVecs.end();
+    while (itr2 != end2)
+    {
+      (*itr2)->Delete();
+      ++itr2;
+    }
+  }
+
+  void Initialize()
+  {
+    vtkInformationVector**& inInfoVec = this->InInfoVecs.Local();
+    vtkInformationVector*& outInfoVec = this->OutInfoVecs.Local();
+
+    inInfoVec = Clone(this->InfoPrototype->In, this->InfoPrototype->InSize);
+    outInfoVec = vtkInformationVector::New();
+    outInfoVec->Copy(this->InfoPrototype->Out, 1);
+
+    vtkInformation*& request = this->Requests.Local();
+    request->Copy(this->Request, 1);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkInformationVector** inInfoVec = this->InInfoVecs.Local();
+    vtkInformationVector* outInfoVec = this->OutInfoVecs.Local();
+    vtkInformation* request = this->Requests.Local();
+
+    vtkInformation* inInfo = inInfoVec[this->CompositePort]->GetInformationObject(this->Connection);
+
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (this->Exec->GetAlgorithm()->GetAbortOutput())
+      {
+        break;
+      }
+      std::vector<vtkDataObject*> outObjList = this->Exec->ExecuteSimpleAlgorithmForBlock(
+        &inInfoVec[0], outInfoVec, inInfo, request, this->InObjs[i]);
+      for (int j = 0; j < outInfoVec->GetNumberOfInformationObjects(); ++j)
+      {
+        this->OutObjs[i * outInfoVec->GetNumberOfInformationObjects() + j] = outObjList[j];
+      }
+    }
+  }
+
+  void Reduce() {}
+
+protected:
+  vtkCompositeDataPipeline* Exec;
+  vtkInformationVector** InInfoVec;
+  vtkInformationVector* OutInfoVec;
+  vtkSmartPointer<ProcessBlockData> InfoPrototype;
+  int CompositePort;
+  int Connection;
+  vtkInformation* Request;
+  const std::vector<vtkDataObject*>& InObjs;
+  vtkDataObject** OutObjs;
+
+  vtkSMPThreadLocal<vtkInformationVector**> InInfoVecs;
+  vtkSMPThreadLocal<vtkInformationVector*> OutInfoVecs;
+  vtkSMPThreadLocalObject<vtkInformation> Requests;
+};
 
 //------------------------------------------------------------------------------
 vtkCompositeDataPipeline::vtkCompositeDataPipeline()
 {
   this->InLocalLoop = 0;
+  this->InConcurrentLoop = false;
   this->InformationCache = vtkInformation::New();
 
   this->GenericRequest = vtkInformation::New();
@@ -280,10 +446,18 @@ void vtkCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* iter,
     ++num_blocks;
   }
 
+  auto algo = this->GetAlgorithm();
+  if (num_blocks > 1 && algo->GetInformation()->Get(CONCURRENT_BLOCK_EXECUTION()) &&
+    !vtkSMPTools::IsParallelScope())
+  {
+    this->ExecuteEachConcurrently(
+      iter, inInfoVec, outInfoVec, compositePort, connection, request, compositeOutputs);
+    return;
+  }
+
   const double progress_scale = 1.0 / num_blocks;
   vtkIdType block_index = 0;
 
-  auto algo = this->GetAlgorithm();
   for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem(), ++block_index)
   {
     if (algo->GetAbortOutput())
@@ -319,6 +493,99 @@ void vtkCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* iter,
   algo->SetProgressShiftScale(0.0, 1.0);
 }
 
+//------------------------------------------------------------------------------
+void vtkCompositeDataPipeline::ExecuteEachConcurrently(vtkCompositeDataIterator* iter,
+  vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, int compositePort,
+  int connection, vtkInformation* request,
+  std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutputs)
+{
+  // from input data objects  itr -> (inObjs, indices)
+  // inObjs are the non-null objects that we will loop over.
+  // indices map the input objects to inObjs
+  std::vector<vtkDataObject*> inObjs;
+  std::vector<int> indices;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkDataObject* dobj = iter->GetCurrentDataObject();
+    if (dobj)
+    {
+      inObjs.push_back(dobj);
+      indices.push_back(static_cast<int>(inObjs.size()) - 1);
+    }
+    else
+    {
+      indices.push_back(-1);
+    }
+  }
+
+  // instantiate outObjs, the output objects that will be created from inObjs
+  const int numOutputs = outInfoVec->GetNumberOfInformationObjects();
+  std::vector<vtkDataObject*> outObjs;
+  outObjs.resize(indices.size() * numOutputs, nullptr);
+
+  // create the parallel task processBlock
+  ProcessBlock processBlock(
+    this, inInfoVec, outInfoVec, compositePort, connection, request, inObjs, outObjs);
+
+  vtkSmartPointer<vtkProgressObserver> origPo(this->Algorithm->GetProgressObserver());
+  vtkNew<vtkSMPProgressObserver> po;
+  this->Algorithm->SetProgressObserver(po);
+  this->InConcurrentLoop = true;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(inObjs.size()), processBlock);
+  this->InConcurrentLoop = false;
+  this->Algorithm->SetProgressObserver(origPo);
+
+  int i = 0;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem(), i++)
+  {
+    int j = indices[i];
+    if (j >= 0)
+    {
+      for (int k = 0; k < numOutputs; ++k)
+      {
+        vtkDataObject* outObj = outObjs[j * numOutputs + k];
+        if (compositeOutputs[k])
+        {
+          compositeOutputs[k]->SetDataSet(iter, outObj);
+        }
+        if (outObj)
+        {
+          outObj->FastDelete();
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkCompositeDataPipeline::CallAlgorithm(vtkInformation* request, int direction,
+  vtkInformationVector** inInfo, vtkInformationVector* outInfo)
+{
+  if (!this->InConcurrentLoop)
+  {
+    return this->Superclass::CallAlgorithm(request, direction, inInfo, outInfo);
+  }
+
+  // Copy default information in the direction of information flow.
+  this->CopyDefaultInformation(request, direction, inInfo, outInfo);
+
+  // Invoke the request on the algorithm, in the thread of the block.
+  int result;
+  {
+    vtkMemoryResourceScope memoryScope(this->MemoryResource);
+    result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  }
+
+  // If the algorithm failed report it now.
+  if (!result)
+  {
+    vtkErrorMacro("Algorithm " << this->Algorithm->GetObjectDescription()
+                               << " returned failure for request: " << *request);
+  }
+
+  return result;
+}
+
 //------------------------------------------------------------------------------
 // Execute a simple (non-composite-aware) filter multiple times, once per
 // block. Collect the result in a composite dataset that is of the same
@@ -433,7 +700,9 @@ void vtkCompositeDataPipeline::ExecuteSimpleAlgorithm(vtkInformation* request,
       }
     }
 
-    this->ExecuteEach(iter, inInfoVec, outInfoVec, compositePort, 0, r, compositeOutputs);
+    vtkSMPTools::CancellableScope(this->Algorithm->AbortExecute, [&]() {
+      this->ExecuteEach(iter, inInfoVec, outInfoVec, compositePort, 0, r, compositeOutputs);
+    });
 
     // True when the pipeline is iterating over the current (simple)
     // filter to produce composite output. In this case,
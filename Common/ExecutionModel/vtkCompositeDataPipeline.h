@@ -36,7 +36,9 @@
  * vtkCompositeDataPipeline is assigned to a simple filter,
  * it will invoke the  vtkStreamingDemandDrivenPipeline passes in a loop,
  * passing a different block each time and will collect the results in a
- * composite dataset.
+ * composite dataset. If the simple filter sets CONCURRENT_BLOCK_EXECUTION()
+ * in its information, the blocks are processed concurrently with
+ * vtkSMPTools instead.
  * @sa
  *  vtkCompositeDataSet
  */
@@ -116,6 +118,30 @@ public:
    */
   static vtkInformationDoubleKey* BLOCK_AMOUNT_OF_DETAIL();
 
+  /**
+   * CONCURRENT_BLOCK_EXECUTION is a key placed in the information of an
+   * algorithm that is not composite dataset-aware to tell the executive that
+   * the algorithm can process several blocks at the same time. Such an
+   * algorithm implements all pipeline passes in a re-entrant way: it keeps
+   * no state of the current execution in its members and only uses the
+   * request, information objects and data objects it is given. When set to a
+   * non-zero value, the blocks of a composite input are processed
+   * concurrently with vtkSMPTools, each thread using its own copy of the
+   * request and of the information vectors.
+   *
+   * \code
+   * filter->GetInformation()->Set(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION(), 1);
+   * \endcode
+   */
+  static vtkInformationIntegerKey* CONCURRENT_BLOCK_EXECUTION();
+
+  /**
+   * Overridden to leave the executive state alone while blocks are processed
+   * concurrently.
+   */
+  int CallAlgorithm(vtkInformation* request, int direction, vtkInformationVector** inInfo,
+    vtkInformationVector* outInfo) override;
+
 protected:
   vtkCompositeDataPipeline();
   ~vtkCompositeDataPipeline() override;
@@ -160,6 +186,18 @@ protected:
     vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
     std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutput);
 
+  /**
+   * Process the blocks of the iterator concurrently with vtkSMPTools. Used by
+   * ExecuteEach() for algorithms setting CONCURRENT_BLOCK_EXECUTION() and by
+   * vtkThreadedCompositeDataPipeline.
+   */
+  void ExecuteEachConcurrently(vtkCompositeDataIterator* iter, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
+    std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutput);
+
+  // True while ExecuteEachConcurrently() processes blocks.
+  bool InConcurrentLoop;
+
   std::vector<vtkDataObject*> ExecuteSimpleAlgorithmForBlock(vtkInformationVector** inInfoVec,
     vtkInformationVector* outInfoVec, vtkInformation* inInfo, vtkInformation* request,
     vtkDataObject* dobj);
@@ -210,6 +248,7 @@ protected:
 private:
   vtkCompositeDataPipeline(const vtkCompositeDataPipeline&) = delete;
   void operator=(const vtkCompositeDataPipeline&) = delete;
+  friend class ProcessBlock;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -0,0 +1,186 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkConcurrentBranchPipeline.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkConcurrentBranchPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkInformation.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+
+#include <map>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkConcurrentBranchPipeline);
+
+vtkInformationKeyMacro(vtkConcurrentBranchPipeline, REENTRANT, Integer);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// An input connection of the algorithm and the executive producing it.
+struct Branch
+{
+  vtkExecutive* Producer;
+  int ProducerPort;
+  int Result;
+};
+
+//------------------------------------------------------------------------------
+// Walk the pipeline upstream of the given executive and check that all the
+// algorithms met can be executed from another thread. Results are cached in
+// visited since branches often share their upstream part.
+bool IsConcurrent(vtkExecutive* executive, std::map<vtkExecutive*, bool>& visited)
+{
+  auto found = visited.find(executive);
+  if (found != visited.end())
+  {
+    return found->second;
+  }
+
+  vtkAlgorithm* algorithm = executive->GetAlgorithm();
+  bool concurrent = vtkConcurrentBranchPipeline::SafeDownCast(executive) && algorithm &&
+    algorithm->GetInformation()->Get(vtkConcurrentBranchPipeline::REENTRANT());
+  for (int i = 0; concurrent && i < executive->GetNumberOfInputPorts(); ++i)
+  {
+    for (int j = 0; concurrent && j < algorithm->GetNumberOfInputConnections(i); ++j)
+    {
+      if (vtkExecutive* input = executive->GetInputExecutive(i, j))
+      {
+        concurrent = IsConcurrent(input, visited);
+      }
+    }
+  }
+  visited[executive] = concurrent;
+  return concurrent;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkConcurrentBranchPipeline::vtkConcurrentBranchPipeline() = default;
+
+//------------------------------------------------------------------------------
+vtkConcurrentBranchPipeline::~vtkConcurrentBranchPipeline() = default;
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkConcurrentBranchPipeline::ProcessRequest(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  if (request->Has(REQUEST_DATA()))
+  {
+    // Several concurrent branches may reach this executive: the first one
+    // updates it while the others wait, then find it up to date.
+    std::lock_guard<std::recursive_mutex> lock(this->DataMutex);
+    return this->Superclass::ProcessRequest(request, inInfoVec, outInfoVec);
+  }
+  return this->Superclass::ProcessRequest(request, inInfoVec, outInfoVec);
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentBranchPipeline::ForwardUpstream(vtkInformation* request)
+{
+  // Only the data pass is worth running concurrently, the other passes are
+  // cheap and forwarded serially.
+  if (!request->Has(REQUEST_DATA()) || this->SharedInputInformation)
+  {
+    return this->Superclass::ForwardUpstream(request);
+  }
+
+  // Split the input connections between the branches that can be updated
+  // concurrently and the others.
+  std::vector<Branch> serialBranches;
+  std::vector<Branch> concurrentBranches;
+  std::map<vtkExecutive*, bool> visited;
+  for (int i = 0; i < this->GetNumberOfInputPorts(); ++i)
+  {
+    for (int j = 0; j < this->Algorithm->GetNumberOfInputConnections(i); ++j)
+    {
+      if (vtkExecutive* e = this->GetInputExecutive(i, j))
+      {
+        Branch branch{ e, this->Algorithm->GetInputConnection(i, j)->GetIndex(), 1 };
+        if (IsConcurrent(e, visited))
+        {
+          concurrentBranches.push_back(branch);
+        }
+        else
+        {
+          serialBranches.push_back(branch);
+        }
+      }
+    }
+  }
+  if (concurrentBranches.size() < 2)
+  {
+    return this->Superclass::ForwardUpstream(request);
+  }
+
+  if (!this->Algorithm->ModifyRequest(request, BeforeForward))
+  {
+    return 0;
+  }
+
+  int result = 1;
+  int port = request->Get(FROM_OUTPUT_PORT());
+  for (Branch& branch : serialBranches)
+  {
+    request->Set(FROM_OUTPUT_PORT(), branch.ProducerPort);
+    if (!branch.Producer->ProcessRequest(
+          request, branch.Producer->GetInputInformation(), branch.Producer->GetOutputInformation()))
+    {
+      result = 0;
+    }
+  }
+  request->Set(FROM_OUTPUT_PORT(), port);
+
+  // Each branch gets its own copy of the request since executives write
+  // into it while forwarding it.
+  vtkSMPTools::For(0, static_cast<vtkIdType>(concurrentBranches.size()), 1,
+    [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType b = begin; b < end; ++b)
+      {
+        Branch& branch = concurrentBranches[b];
+        vtkNew<vtkInformation> branchRequest;
+        branchRequest->Copy(request);
+        branchRequest->Set(FROM_OUTPUT_PORT(), branch.ProducerPort);
+        branch.Result = branch.Producer->ProcessRequest(branchRequest,
+          branch.Producer->GetInputInformation(), branch.Producer->GetOutputInformation());
+      }
+    });
+  for (const Branch& branch : concurrentBranches)
+  {
+    if (!branch.Result)
+    {
+      result = 0;
+    }
+  }
+
+  if (!this->Algorithm->ModifyRequest(request, AfterForward))
+  {
+    return 0;
+  }
+
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentBranchPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,103 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkConcurrentBranchPipeline.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkConcurrentBranchPipeline
+ * @brief   Executive that updates independent input branches in parallel
+ *
+ * vtkConcurrentBranchPipeline behaves like vtkCompositeDataPipeline except
+ * when it forwards REQUEST_DATA to the producers of its inputs. When the
+ * algorithm has several input connections, the branches of the pipeline
+ * upstream of them are updated concurrently using vtkSMPTools, instead of
+ * one after another. This lets, for instance, a contour, a slice and a glyph
+ * branch connected to one reader and gathered by an append filter execute
+ * at the same time.
+ *
+ * Running an algorithm on another thread is only safe if the algorithm is
+ * re-entrant, so a branch is updated concurrently only if every algorithm
+ * upstream of the input connection, up to the sources, is managed by a
+ * vtkConcurrentBranchPipeline and declares itself re-entrant:
+ *
+ * \code{.cpp}
+ * filter->GetInformation()->Set(vtkConcurrentBranchPipeline::REENTRANT(), 1);
+ * \endcode
+ *
+ * The other branches are updated serially on the calling thread before the
+ * concurrent ones. Algorithms shared by several branches, such as the reader
+ * of the example above, execute only once: a vtkConcurrentBranchPipeline
+ * processes one REQUEST_DATA at a time, so the branches that reach it wait
+ * for the first one to bring it up to date.
+ *
+ * The simplest way to use this executive for a whole pipeline is to set it
+ * as the default executive prototype before creating the algorithms, see
+ * vtkAlgorithm::SetDefaultExecutivePrototype().
+ *
+ * @warning
+ * Progress and error events of the algorithms of concurrent branches are
+ * invoked from the threads of vtkSMPTools. With the STDThread backend, the
+ * vtkSMPTools loops of these algorithms run serially unless nested
+ * parallelism is enabled.
+ *
+ * @sa
+ * vtkCompositeDataPipeline vtkThreadedCompositeDataPipeline vtkSMPTools
+ */
+
+#ifndef vtkConcurrentBranchPipeline_h
+#define vtkConcurrentBranchPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+#include <mutex> // For std::recursive_mutex
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformationIntegerKey;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkConcurrentBranchPipeline : public vtkCompositeDataPipeline
+{
+public:
+  static vtkConcurrentBranchPipeline* New();
+  vtkTypeMacro(vtkConcurrentBranchPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Generalized interface for asking the executive to fulfill update
+   * requests. REQUEST_DATA is processed by one thread at a time.
+   */
+  vtkTypeBool ProcessRequest(vtkInformation* request, vtkInformationVector** inInfo,
+    vtkInformationVector* outInfo) override;
+
+  /**
+   * Key set to 1 in the information of an algorithm (see
+   * vtkAlgorithm::GetInformation()) to declare that it can execute
+   * concurrently with other algorithms.
+   */
+  static vtkInformationIntegerKey* REENTRANT();
+
+protected:
+  vtkConcurrentBranchPipeline();
+  ~vtkConcurrentBranchPipeline() override;
+
+  int ForwardUpstream(vtkInformation* request) override;
+  using Superclass::ForwardUpstream;
+
+private:
+  vtkConcurrentBranchPipeline(const vtkConcurrentBranchPipeline&) = delete;
+  void operator=(const vtkConcurrentBranchPipeline&) = delete;
+
+  std::recursive_mutex DataMutex;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -33,10 +33,24 @@
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
 #include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 
+#include <atomic>
 #include <vector>
 
+namespace
+{
+// Executives reached through several paths, as in pipelines where branches
+// from a same source are merged again, are visited once per path by the
+// pipeline modified time request, which is exponential in the number of such
+// merges. Each UpdatePipelineMTime() is thus a pass with its own number, and
+// the executives reuse their pipeline modified time within a pass.
+std::atomic<vtkMTimeType> PipelineMTimePasses(0);
+thread_local vtkMTimeType CurrentPipelineMTimePass = 0;
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDemandDrivenPipeline);
 
@@ -54,6 +68,8 @@ vtkDemandDrivenPipeline::vtkDemandDrivenPipeline()
   this->DataObjectRequest = nullptr;
   this->DataRequest = nullptr;
   this->PipelineMTime = 0;
+  this->PipelineMTimePass = 0;
+  this->PipelineMTimePort = -1;
 }
 
 //------------------------------------------------------------------------------
@@ -85,6 +101,14 @@ int vtkDemandDrivenPipeline::ComputePipelineMTime(vtkInformation* request,
   vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, int requestFromOutputPort,
   vtkMTimeType* mtime)
 {
+  // Nothing was modified since the time was computed in this pass.
+  if (::CurrentPipelineMTimePass != 0 && this->PipelineMTimePass == ::CurrentPipelineMTimePass &&
+    this->PipelineMTimePort == requestFromOutputPort)
+  {
+    *mtime = this->PipelineMTime;
+    return 1;
+  }
+
   // The pipeline's MTime starts with this algorithm's MTime.
   // Invoke the request on the algorithm.
   this->InAlgorithm = 1;
@@ -141,6 +165,8 @@ int vtkDemandDrivenPipeline::ComputePipelineMTime(vtkInformation* request,
     }
   }
   *mtime = this->PipelineMTime;
+  this->PipelineMTimePass = ::CurrentPipelineMTimePass;
+  this->PipelineMTimePort = requestFromOutputPort;
   return 1;
 }
 
@@ -316,10 +342,22 @@ int vtkDemandDrivenPipeline::UpdatePipelineMTime()
     return 0;
   }
 
+  // Start a new pass, unless in the pass of a pipeline updating this one.
+  const bool newPass = ::CurrentPipelineMTimePass == 0;
+  if (newPass)
+  {
+    ::CurrentPipelineMTimePass = ++::PipelineMTimePasses;
+  }
+
   // Send the request for pipeline modified time.
   vtkMTimeType mtime;
   this->ComputePipelineMTime(
     nullptr, this->GetInputInformation(), this->GetOutputInformation(), -1, &mtime);
+
+  if (newPass)
+  {
+    ::CurrentPipelineMTimePass = 0;
+  }
   return 1;
 }
 
@@ -457,9 +495,13 @@ int vtkDemandDrivenPipeline::ExecuteData(
   vtkInformation* request, vtkInformationVector** inInfo, vtkInformationVector* outInfo)
 {
   this->ExecuteDataStart(request, inInfo, outInfo);
-  // Invoke the request on the algorithm.
+  // Invoke the request on the algorithm. Its SMP loops can check
+  // vtkSMPTools::IsCancelled() to stop early once its AbortExecute flag is set.
   //   vtkMTimeType mTimeBefore = this->Algorithm->GetMTime();
-  int result = this->CallAlgorithm(request, vtkExecutive::RequestDownstream, inInfo, outInfo);
+  int result = 0;
+  vtkSMPTools::CancellableScope(this->Algorithm->AbortExecute, [&]() {
+    result = this->CallAlgorithm(request, vtkExecutive::RequestDownstream, inInfo, outInfo);
+  });
   //   if (mTimeBefore != this->Algorithm->GetMTime())
   //     {
   //     vtkWarningMacro(<< this->Algorithm->GetClassName()
@@ -517,6 +559,7 @@ void vtkDemandDrivenPipeline::ExecuteDataStart(
   }
 
   // Tell observers the algorithm is about to execute.
+  vtkPipelineProfiler::BeginExecution(this->Algorithm);
   this->Algorithm->InvokeEvent(vtkCommand::StartEvent, nullptr);
 
   // If there is an aborted input, set AbortOutput. Otherwise, run as normal
@@ -539,6 +582,13 @@ void vtkDemandDrivenPipeline::ExecuteDataEnd(
 {
   this->Algorithm->UpdateProgress(1.0);
 
+  // The SMP loops of the algorithm may have skipped work if it was asked to
+  // abort, even if it did not check for it.
+  if (this->Algorithm->GetAbortExecute())
+  {
+    this->Algorithm->SetAbortOutput(true);
+  }
+
   int i, j;
   // The algorithm has either finished or aborted.
   if (this->Algorithm->GetAbortOutput())
@@ -557,6 +607,7 @@ void vtkDemandDrivenPipeline::ExecuteDataEnd(
   }
 
   // Tell observers the algorithm is done executing.
+  vtkPipelineProfiler::EndExecution(this->Algorithm, inInfoVec, outputs);
   this->Algorithm->InvokeEvent(vtkCommand::EndEvent, nullptr);
 
   // Tell outputs they have been generated.
@@ -218,6 +218,11 @@ protected:
   // executives.
   vtkMTimeType PipelineMTime;
 
+  // Pass of UpdatePipelineMTime() and output port for which PipelineMTime was
+  // last computed.
+  vtkMTimeType PipelineMTimePass;
+  int PipelineMTimePort;
+
   // Time when information or data were last generated.
   vtkTimeStamp DataObjectTime;
   vtkTimeStamp InformationTime;
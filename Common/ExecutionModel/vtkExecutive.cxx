@@ -25,6 +25,7 @@
 #include "vtkInformationIterator.h"
 #include "vtkInformationKeyVectorKey.h"
 #include "vtkInformationVector.h"
+#include "vtkMemoryResource.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
@@ -121,12 +122,14 @@ vtkExecutive::vtkExecutive()
   this->InAlgorithm = 0;
   this->SharedInputInformation = nullptr;
   this->SharedOutputInformation = nullptr;
+  this->MemoryResource = nullptr;
 }
 
 //------------------------------------------------------------------------------
 vtkExecutive::~vtkExecutive()
 {
   this->SetAlgorithm(nullptr);
+  this->SetMemoryResource(nullptr);
   if (this->OutputInformation)
   {
     this->OutputInformation->Delete();
@@ -146,8 +149,12 @@ void vtkExecutive::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Algorithm: (none)\n";
   }
+  os << indent << "MemoryResource: " << this->MemoryResource << "\n";
 }
 
+//------------------------------------------------------------------------------
+vtkCxxSetObjectMacro(vtkExecutive, MemoryResource, vtkMemoryResource);
+
 //------------------------------------------------------------------------------
 void vtkExecutive::SetAlgorithm(vtkAlgorithm* newAlgorithm)
 {
@@ -732,7 +739,11 @@ int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
 
   // Invoke the request on the algorithm.
   this->InAlgorithm = 1;
-  int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  int result;
+  {
+    vtkMemoryResourceScope memoryScope(this->MemoryResource);
+    result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  }
   this->InAlgorithm = 0;
 
   // If the algorithm failed report it now.
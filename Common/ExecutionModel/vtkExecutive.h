@@ -43,6 +43,7 @@ class vtkInformationIntegerKey;
 class vtkInformationRequestKey;
 class vtkInformationKeyVectorKey;
 class vtkInformationVector;
+class vtkMemoryResource;
 
 class VTKCOMMONEXECUTIONMODEL_EXPORT vtkExecutive : public vtkObject
 {
@@ -172,6 +173,19 @@ public:
   void SetSharedOutputInformation(vtkInformationVector* outInfoVec);
   ///@}
 
+  ///@{
+  /**
+   * Set the memory resource made current while the algorithm processes a
+   * request, so that it allocates the arrays the algorithm creates. A
+   * vtkPoolMemoryResource lets an algorithm that executes again reuse the
+   * memory of its previous output, and the counters of the resource measure
+   * the memory allocated by the algorithm. Initial value is a null pointer, in
+   * which case the current resource of the calling thread is used.
+   */
+  virtual void SetMemoryResource(vtkMemoryResource*);
+  vtkGetObjectMacro(MemoryResource, vtkMemoryResource);
+  ///@}
+
   ///@{
   /**
    * Participate in garbage collection.
@@ -280,6 +294,8 @@ protected:
   vtkInformationVector** SharedInputInformation;
   vtkInformationVector* SharedOutputInformation;
 
+  vtkMemoryResource* MemoryResource;
+
 private:
   // Store an information object for each output port of the algorithm.
   vtkInformationVector* OutputInformation;
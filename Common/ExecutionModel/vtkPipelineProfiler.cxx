@@ -0,0 +1,547 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPipelineProfiler.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPipelineProfiler.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPipelineProfiler);
+
+struct vtkPipelineProfiler::vtkInternals
+{
+  struct Event
+  {
+    vtkAlgorithm* Algorithm = nullptr;
+    std::string Name;
+    std::string ClassName;
+    vtkIdType Parent = -1;
+    int Thread = -1;
+    double StartTime = 0.0;
+    double StartCPUTime = 0.0;
+    double WallTime = 0.0;
+    double CPUTime = 0.0;
+    vtkTypeInt64 InputSize = 0;
+    vtkTypeInt64 OutputSize = 0;
+  };
+
+  // An instrumented vtkSMPTools::For() loop.
+  struct SMPEvent
+  {
+    std::string CallSite;
+    std::string Backend;
+    vtkIdType Parent = -1;
+    int Thread = -1;
+    double StartTime = 0.0;
+    vtk::detail::smp::vtkSMPToolsInstrumentation::Call Call;
+  };
+
+  std::mutex Mutex;
+  std::vector<Event> Events;
+  std::vector<SMPEvent> SMPEvents;
+  bool ListeningToSMP = false;
+  bool SMPInstrumentationWasEnabled = false;
+  std::map<std::thread::id, int> Threads;
+  double Origin = -1.0;
+  int NumberOfSMPThreads = 1;
+
+  // Record an instrumented loop in the trace of the active profiler.
+  static void RecordSMPCall(
+    const vtk::detail::smp::vtkSMPToolsInstrumentation::Call& call, void* clientData);
+
+  Event GetEvent(vtkIdType event)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    if (event < 0 || event >= static_cast<vtkIdType>(this->Events.size()))
+    {
+      return Event();
+    }
+    return this->Events[event];
+  }
+};
+
+namespace
+{
+std::atomic<vtkPipelineProfiler*> ActiveProfiler(nullptr);
+
+// Events being recorded on this thread, innermost last.
+thread_local std::vector<std::pair<vtkPipelineProfiler*, vtkIdType>> OpenEvents;
+
+//------------------------------------------------------------------------------
+// Profiler started from the VTK_PIPELINE_PROFILE environment variable. It
+// writes its trace when the process exits.
+struct EnvironmentProfiler
+{
+  vtkSmartPointer<vtkPipelineProfiler> Profiler;
+  std::string FileName;
+
+  EnvironmentProfiler()
+  {
+    const char* fileName = std::getenv("VTK_PIPELINE_PROFILE");
+    // Do not take over a profiler started by the application.
+    if (fileName && *fileName && !ActiveProfiler.load())
+    {
+      this->FileName = fileName;
+      this->Profiler = vtkSmartPointer<vtkPipelineProfiler>::New();
+      this->Profiler->SetProfileSMP(vtkSMPTools::GetInstrumentation());
+      this->Profiler->StartProfiling();
+    }
+  }
+
+  ~EnvironmentProfiler()
+  {
+    if (this->Profiler)
+    {
+      this->Profiler->StopProfiling();
+      this->Profiler->WriteChromeTrace(this->FileName.c_str());
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler* GetActiveProfiler()
+{
+  static EnvironmentProfiler environmentProfiler;
+  return ActiveProfiler.load();
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 GetDataSize(vtkInformationVector* infoVec)
+{
+  vtkTypeInt64 size = 0;
+  for (int i = 0; infoVec && i < infoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    if (vtkDataObject* data = infoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT()))
+    {
+      size += static_cast<vtkTypeInt64>(data->GetActualMemorySize()) * 1024;
+    }
+  }
+  return size;
+}
+
+//------------------------------------------------------------------------------
+// Index of the innermost event being recorded by the profiler on this
+// thread, -1 if none.
+vtkIdType GetOpenEvent(vtkPipelineProfiler* profiler)
+{
+  for (auto open = OpenEvents.rbegin(); open != OpenEvents.rend(); ++open)
+  {
+    if (open->first == profiler)
+    {
+      return open->second;
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+void WriteJSONString(ostream& os, const std::string& str)
+{
+  os << '"';
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) >= 0x20)
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::vtkInternals::RecordSMPCall(
+  const vtk::detail::smp::vtkSMPToolsInstrumentation::Call& call, void*)
+{
+  using vtk::detail::smp::vtkSMPToolsInstrumentation;
+  vtkPipelineProfiler* profiler = ActiveProfiler.load();
+  if (!profiler)
+  {
+    return;
+  }
+  // The loop ended just now, the instrumentation having its own clock.
+  const double endTime = vtkTimerLog::GetUniversalTime();
+  const double duration = vtkSMPToolsInstrumentation::GetTime() - call.StartTime;
+
+  vtkInternals::SMPEvent event;
+  event.CallSite = vtkSMPToolsInstrumentation::GetCallSiteName(*call.CallSite);
+  event.Backend = call.Backend ? call.Backend : "";
+  event.Parent = GetOpenEvent(profiler);
+  event.Call = call;
+
+  vtkInternals* internals = profiler->Internals.get();
+  std::lock_guard<std::mutex> lock(internals->Mutex);
+  if (!internals->ListeningToSMP)
+  {
+    return;
+  }
+  auto thread = internals->Threads.emplace(
+    std::this_thread::get_id(), static_cast<int>(internals->Threads.size()));
+  event.Thread = thread.first->second;
+  event.StartTime = endTime - duration - internals->Origin;
+  internals->SMPEvents.push_back(std::move(event));
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::vtkPipelineProfiler()
+  : ProfileSMP(false)
+  , Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::~vtkPipelineProfiler()
+{
+  this->StopProfiling();
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::StartProfiling()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    if (this->Internals->Origin < 0.0)
+    {
+      this->Internals->Origin = vtkTimerLog::GetUniversalTime();
+    }
+    this->Internals->NumberOfSMPThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+    if (this->ProfileSMP && !this->Internals->ListeningToSMP)
+    {
+      this->Internals->ListeningToSMP = true;
+      this->Internals->SMPInstrumentationWasEnabled = vtkSMPTools::GetInstrumentation();
+    }
+  }
+  ActiveProfiler.store(this);
+  if (this->Internals->ListeningToSMP)
+  {
+    vtk::detail::smp::vtkSMPToolsInstrumentation::SetListener(
+      &vtkInternals::RecordSMPCall, nullptr);
+    vtkSMPTools::SetInstrumentation(true);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::StopProfiling()
+{
+  vtkPipelineProfiler* self = this;
+  ActiveProfiler.compare_exchange_strong(self, nullptr);
+
+  bool wasEnabled = false;
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    if (!this->Internals->ListeningToSMP)
+    {
+      return;
+    }
+    this->Internals->ListeningToSMP = false;
+    wasEnabled = this->Internals->SMPInstrumentationWasEnabled;
+  }
+  if (!ActiveProfiler.load())
+  {
+    vtk::detail::smp::vtkSMPToolsInstrumentation::SetListener(nullptr, nullptr);
+  }
+  vtkSMPTools::SetInstrumentation(wasEnabled);
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineProfiler::GetProfiling()
+{
+  return ActiveProfiler.load() == this;
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::ClearEvents()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  this->Internals->Events.clear();
+  this->Internals->SMPEvents.clear();
+  this->Internals->Threads.clear();
+  this->Internals->Origin = this->GetProfiling() ? vtkTimerLog::GetUniversalTime() : -1.0;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPipelineProfiler::GetNumberOfEvents()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return static_cast<vtkIdType>(this->Internals->Events.size());
+}
+
+//------------------------------------------------------------------------------
+std::string vtkPipelineProfiler::GetEventName(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).Name;
+}
+
+//------------------------------------------------------------------------------
+std::string vtkPipelineProfiler::GetEventClassName(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).ClassName;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPipelineProfiler::GetEventParent(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).Parent;
+}
+
+//------------------------------------------------------------------------------
+int vtkPipelineProfiler::GetEventThread(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).Thread;
+}
+
+//------------------------------------------------------------------------------
+double vtkPipelineProfiler::GetEventStartTime(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).StartTime;
+}
+
+//------------------------------------------------------------------------------
+double vtkPipelineProfiler::GetEventWallTime(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).WallTime;
+}
+
+//------------------------------------------------------------------------------
+double vtkPipelineProfiler::GetEventCPUTime(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).CPUTime;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkPipelineProfiler::GetEventInputSize(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).InputSize;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkPipelineProfiler::GetEventOutputSize(vtkIdType event)
+{
+  return this->Internals->GetEvent(event).OutputSize;
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::BeginExecution(vtkAlgorithm* algorithm)
+{
+  vtkPipelineProfiler* profiler = GetActiveProfiler();
+  if (!profiler || !algorithm)
+  {
+    return;
+  }
+
+  vtkInternals::Event event;
+  event.Algorithm = algorithm;
+  event.Name = algorithm->GetObjectDescription();
+  event.ClassName = algorithm->GetClassName();
+  event.Parent = GetOpenEvent(profiler);
+
+  vtkInternals* internals = profiler->Internals.get();
+  std::lock_guard<std::mutex> lock(internals->Mutex);
+  auto thread = internals->Threads.emplace(
+    std::this_thread::get_id(), static_cast<int>(internals->Threads.size()));
+  event.Thread = thread.first->second;
+  event.StartTime = vtkTimerLog::GetUniversalTime() - internals->Origin;
+  event.StartCPUTime = vtkTimerLog::GetCPUTime();
+  OpenEvents.emplace_back(profiler, static_cast<vtkIdType>(internals->Events.size()));
+  internals->Events.push_back(std::move(event));
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::EndExecution(
+  vtkAlgorithm* algorithm, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  if (OpenEvents.empty() || !algorithm)
+  {
+    return;
+  }
+  const double endCPUTime = vtkTimerLog::GetCPUTime();
+  const double endTime = vtkTimerLog::GetUniversalTime();
+
+  // The innermost open event should belong to the algorithm, but an
+  // execution may have failed to end.
+  auto open = OpenEvents.end();
+  vtkInternals* internals = nullptr;
+  vtkIdType index = -1;
+  while (open != OpenEvents.begin())
+  {
+    --open;
+    internals = open->first->Internals.get();
+    index = open->second;
+    std::lock_guard<std::mutex> lock(internals->Mutex);
+    if (index < static_cast<vtkIdType>(internals->Events.size()) &&
+      internals->Events[index].Algorithm == algorithm)
+    {
+      break;
+    }
+    index = -1;
+  }
+  if (index < 0)
+  {
+    return;
+  }
+  OpenEvents.erase(open, OpenEvents.end());
+
+  vtkTypeInt64 inputSize = 0;
+  for (int i = 0; inInfoVec && i < algorithm->GetNumberOfInputPorts(); ++i)
+  {
+    inputSize += GetDataSize(inInfoVec[i]);
+  }
+  const vtkTypeInt64 outputSize = GetDataSize(outInfoVec);
+
+  std::lock_guard<std::mutex> lock(internals->Mutex);
+  auto& event = internals->Events[index];
+  event.WallTime = endTime - internals->Origin - event.StartTime;
+  event.CPUTime = endCPUTime - event.StartCPUTime;
+  event.InputSize = inputSize;
+  event.OutputSize = outputSize;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineProfiler::WriteChromeTrace(const char* fileName)
+{
+  if (!fileName)
+  {
+    vtkErrorMacro("No file name specified.");
+    return false;
+  }
+  std::ofstream file(fileName);
+  if (!file)
+  {
+    vtkErrorMacro("Cannot open " << fileName << " for writing.");
+    return false;
+  }
+  this->WriteChromeTrace(file);
+  return static_cast<bool>(file);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::WriteChromeTrace(ostream& os)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  const int numberOfSMPThreads = this->Internals->NumberOfSMPThreads;
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  for (std::size_t i = 0; i < this->Internals->Events.size(); ++i)
+  {
+    const auto& event = this->Internals->Events[i];
+    const double utilization =
+      event.WallTime > 0.0 ? event.CPUTime / (event.WallTime * numberOfSMPThreads) : 0.0;
+    os << (i ? ",\n" : "\n") << "{\"name\":";
+    WriteJSONString(os, event.ClassName);
+    os << ",\"cat\":\"vtkAlgorithm\",\"ph\":\"X\",\"pid\":1"
+       << ",\"tid\":" << event.Thread
+       << ",\"ts\":" << static_cast<vtkTypeInt64>(event.StartTime * 1e6)
+       << ",\"dur\":" << static_cast<vtkTypeInt64>(event.WallTime * 1e6)
+       << ",\"args\":{\"object\":";
+    WriteJSONString(os, event.Name);
+    os << ",\"event\":" << i << ",\"parent\":" << event.Parent
+       << ",\"cpu_time_s\":" << event.CPUTime << ",\"smp_utilization\":" << utilization
+       << ",\"input_bytes\":" << event.InputSize << ",\"output_bytes\":" << event.OutputSize
+       << "}}";
+  }
+  for (std::size_t i = 0; i < this->Internals->SMPEvents.size(); ++i)
+  {
+    const auto& event = this->Internals->SMPEvents[i];
+    const auto& call = event.Call;
+    os << (i || !this->Internals->Events.empty() ? ",\n" : "\n") << "{\"name\":";
+    WriteJSONString(os, event.CallSite);
+    os << ",\"cat\":\"vtkSMPTools\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.Thread
+       << ",\"ts\":" << static_cast<vtkTypeInt64>(event.StartTime * 1e6)
+       << ",\"dur\":" << static_cast<vtkTypeInt64>(call.WallTime * 1e6)
+       << ",\"args\":{\"backend\":";
+    WriteJSONString(os, event.Backend);
+    os << ",\"parent\":" << event.Parent << ",\"nesting_depth\":" << call.NestingDepth
+       << ",\"iterations\":" << call.NumberOfIterations << ",\"grain\":" << call.Grain
+       << ",\"chunks\":" << call.NumberOfChunks << ",\"threads\":" << call.NumberOfThreads
+       << ",\"busy_time_s\":" << call.BusyTime << ",\"idle_time_s\":" << call.IdleTime
+       << ",\"thread_busy_time_s\":{";
+    for (std::size_t t = 0; t < call.Threads.size(); ++t)
+    {
+      os << (t ? "," : "") << '"' << call.Threads[t].Thread << "\":" << call.Threads[t].BusyTime;
+    }
+    os << "}}}";
+  }
+  os << "\n]}\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::PrintSummary(ostream& os)
+{
+  struct Total
+  {
+    std::string Name;
+    vtkIdType Count = 0;
+    double WallTime = 0.0;
+    double CPUTime = 0.0;
+    vtkTypeInt64 OutputSize = 0;
+  };
+  std::vector<Total> totals;
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    std::map<std::string, std::size_t> index;
+    for (const auto& event : this->Internals->Events)
+    {
+      auto found = index.emplace(event.Name, totals.size());
+      if (found.second)
+      {
+        totals.emplace_back();
+        totals.back().Name = event.Name;
+      }
+      Total& total = totals[found.first->second];
+      ++total.Count;
+      total.WallTime += event.WallTime;
+      total.CPUTime += event.CPUTime;
+      total.OutputSize = event.OutputSize;
+    }
+  }
+  std::sort(totals.begin(), totals.end(),
+    [](const Total& a, const Total& b) { return a.WallTime > b.WallTime; });
+
+  for (const Total& total : totals)
+  {
+    os << total.Name << ": " << total.Count << " executions, " << total.WallTime
+       << " s wall clock, " << total.CPUTime << " s CPU, last output " << total.OutputSize
+       << " bytes\n";
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Profiling: " << this->GetProfiling() << "\n";
+  os << indent << "ProfileSMP: " << this->ProfileSMP << "\n";
+  os << indent << "NumberOfEvents: " << this->GetNumberOfEvents() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,167 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPipelineProfiler.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPipelineProfiler
+ * @brief   Record the executions of all the algorithms of the pipelines
+ *
+ * While a vtkPipelineProfiler is profiling, every REQUEST_DATA processed by
+ * a vtkDemandDrivenPipeline (or one of its subclasses) is recorded as an
+ * event holding:
+ *
+ * - the algorithm and the thread executing it,
+ * - its start time and wall clock duration,
+ * - the CPU time of the process during the execution, from which the
+ *   utilization of the vtkSMPTools threads is estimated,
+ * - the memory size of its inputs and outputs, in bytes, as computed by
+ *   vtkDataObject::GetActualMemorySize(),
+ * - its parent event: the execution, on the same thread, of the algorithm
+ *   that updated an internal pipeline from its RequestData.
+ *
+ * The events can be written in the Chrome trace event JSON format, which
+ * chrome://tracing and https://ui.perfetto.dev display as a timeline, or
+ * summarized per algorithm with PrintSummary(). With ProfileSMP on, the
+ * trace also shows the vtkSMPTools loops run by the algorithms.
+ *
+ * \code{.cpp}
+ * vtkNew<vtkPipelineProfiler> profiler;
+ * profiler->StartProfiling();
+ * mapper->Update();
+ * profiler->StopProfiling();
+ * profiler->WriteChromeTrace("pipeline.json");
+ * \endcode
+ *
+ * Only one profiler records events at a time. Without changing an
+ * application, profiling is enabled for the whole process by setting the
+ * environment variable VTK_PIPELINE_PROFILE to the name of the trace file,
+ * which is written when the process exits.
+ *
+ * @sa
+ * vtkExecutionTimer vtkTimerLog vtkLogger
+ */
+
+#ifndef vtkPipelineProfiler_h
+#define vtkPipelineProfiler_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <memory> // For std::unique_ptr
+#include <string> // For std::string
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkInformationVector;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkPipelineProfiler : public vtkObject
+{
+public:
+  static vtkPipelineProfiler* New();
+  vtkTypeMacro(vtkPipelineProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Start or stop recording the executions of the algorithms. Starting a
+   * profiler stops the one that was profiling.
+   */
+  void StartProfiling();
+  void StopProfiling();
+  bool GetProfiling();
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get whether the instrumented vtkSMPTools::For() loops run while
+   * profiling are recorded as well, in the trace only. Their events are
+   * nested in the execution of the algorithm running them and give the
+   * number of chunks, the nesting depth and the busy and idle times of the
+   * threads, see vtkSMPTools::GetForStatistics(). The instrumentation of the
+   * loops is enabled while profiling. Off by default, unless the profiler is
+   * started from the environment while the VTK_SMP_INSTRUMENTATION
+   * environment variable is set.
+   */
+  vtkSetMacro(ProfileSMP, bool);
+  vtkGetMacro(ProfileSMP, bool);
+  vtkBooleanMacro(ProfileSMP, bool);
+  ///@}
+
+  /**
+   * Remove the recorded events.
+   */
+  void ClearEvents();
+
+  /**
+   * Number of recorded events, the executions of the algorithms.
+   */
+  vtkIdType GetNumberOfEvents();
+
+  ///@{
+  /**
+   * Properties of a recorded event. Times are in seconds, the start time
+   * being relative to the first call to StartProfiling() after
+   * ClearEvents(). Sizes are in bytes. The parent is the index of the
+   * enclosing event, -1 if there is none.
+   */
+  std::string GetEventName(vtkIdType event);
+  std::string GetEventClassName(vtkIdType event);
+  vtkIdType GetEventParent(vtkIdType event);
+  int GetEventThread(vtkIdType event);
+  double GetEventStartTime(vtkIdType event);
+  double GetEventWallTime(vtkIdType event);
+  double GetEventCPUTime(vtkIdType event);
+  vtkTypeInt64 GetEventInputSize(vtkIdType event);
+  vtkTypeInt64 GetEventOutputSize(vtkIdType event);
+  ///@}
+
+  ///@{
+  /**
+   * Write the events in the Chrome trace event JSON format.
+   */
+  bool WriteChromeTrace(const char* fileName);
+  void WriteChromeTrace(ostream& os);
+  ///@}
+
+  /**
+   * Print, for each algorithm, the number of executions and the total
+   * times, from the most to the least expensive in wall clock time.
+   */
+  void PrintSummary(ostream& os);
+
+  ///@{
+  /**
+   * Called by the executives around the execution of an algorithm. They do
+   * nothing if no profiler is profiling.
+   */
+  static void BeginExecution(vtkAlgorithm* algorithm);
+  static void EndExecution(
+    vtkAlgorithm* algorithm, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
+  ///@}
+
+protected:
+  vtkPipelineProfiler();
+  ~vtkPipelineProfiler() override;
+
+  bool ProfileSMP;
+
+private:
+  vtkPipelineProfiler(const vtkPipelineProfiler&) = delete;
+  void operator=(const vtkPipelineProfiler&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
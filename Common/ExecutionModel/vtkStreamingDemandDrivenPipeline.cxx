@@ -39,6 +39,9 @@
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
+#include <mutex>
+#include <thread>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkStreamingDemandDrivenPipeline);
 
@@ -90,9 +93,18 @@ void vtkSDDPSetUpdateExtentToWholeExtent(vtkInformation* info)
 }
 }
 
+//------------------------------------------------------------------------------
+struct vtkStreamingDemandDrivenPipeline::vtkAsyncUpdate
+{
+  std::mutex Mutex;
+  // runs the update started by UpdateTimeStepAsync()
+  std::thread Thread;
+};
+
 //------------------------------------------------------------------------------
 vtkStreamingDemandDrivenPipeline::vtkStreamingDemandDrivenPipeline()
 {
+  this->AsyncUpdate = new vtkAsyncUpdate;
   this->ContinueExecuting = 0;
   this->UpdateExtentRequest = nullptr;
   this->UpdateTimeRequest = nullptr;
@@ -105,6 +117,17 @@ vtkStreamingDemandDrivenPipeline::vtkStreamingDemandDrivenPipeline()
 //------------------------------------------------------------------------------
 vtkStreamingDemandDrivenPipeline::~vtkStreamingDemandDrivenPipeline()
 {
+  {
+    // The background thread releases its reference to the algorithm last and
+    // may thus be the one destroying this executive.
+    std::lock_guard<std::mutex> lock(this->AsyncUpdate->Mutex);
+    if (this->AsyncUpdate->Thread.get_id() == std::this_thread::get_id())
+    {
+      this->AsyncUpdate->Thread.detach();
+    }
+  }
+  this->WaitForAsyncUpdate();
+  delete this->AsyncUpdate;
   if (this->UpdateExtentRequest)
   {
     this->UpdateExtentRequest->Delete();
@@ -136,6 +159,9 @@ vtkTypeBool vtkStreamingDemandDrivenPipeline ::ProcessRequest(
     return 0;
   }
 
+  // Do not process requests while the outputs are updated in the background.
+  this->WaitForAsyncUpdate();
+
   // Look for specially supported requests.
   if (request->Has(REQUEST_UPDATE_TIME()))
   {
@@ -674,6 +700,66 @@ void vtkStreamingDemandDrivenPipeline ::ResetPipelineInformation(int port, vtkIn
   info->Remove(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT());
 }
 
+//------------------------------------------------------------------------------
+std::shared_future<vtkSmartPointer<vtkDataObject>>
+vtkStreamingDemandDrivenPipeline::UpdateTimeStepAsync(int port, double time)
+{
+  this->WaitForAsyncUpdate();
+
+  std::promise<vtkSmartPointer<vtkDataObject>> promise;
+  std::shared_future<vtkSmartPointer<vtkDataObject>> result = promise.get_future().share();
+  if (!this->Algorithm || port < 0 || port >= this->Algorithm->GetNumberOfOutputPorts())
+  {
+    vtkErrorMacro("UpdateTimeStepAsync called with invalid port " << port);
+    promise.set_value(nullptr);
+    return result;
+  }
+
+  // The thread holds a reference to the algorithm so that it stays alive
+  // until the update is done.
+  vtkSmartPointer<vtkAlgorithm> algorithm = this->Algorithm;
+  auto update = [this, port, time](vtkSmartPointer<vtkAlgorithm> vtkNotUsed(alg),
+                  std::promise<vtkSmartPointer<vtkDataObject>> output) {
+    vtkNew<vtkInformation> request;
+    request->Set(UPDATE_TIME_STEP(), time);
+    vtkNew<vtkInformationVector> requests;
+    requests->SetInformationObject(port, request);
+    vtkSmartPointer<vtkDataObject> copy;
+    vtkDataObject* data = this->Update(port, requests) ? this->GetOutputData(port) : nullptr;
+    if (data)
+    {
+      copy.TakeReference(data->NewInstance());
+      copy->ShallowCopy(data);
+    }
+    output.set_value(copy);
+  };
+
+  // Hold the lock until the thread is stored, so that the requests it makes
+  // know they come from the background thread.
+  std::lock_guard<std::mutex> lock(this->AsyncUpdate->Mutex);
+  this->AsyncUpdate->Thread = std::thread(update, algorithm, std::move(promise));
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkStreamingDemandDrivenPipeline::WaitForAsyncUpdate()
+{
+  std::thread thread;
+  {
+    std::lock_guard<std::mutex> lock(this->AsyncUpdate->Mutex);
+    if (this->AsyncUpdate->Thread.get_id() == std::this_thread::get_id())
+    {
+      // requests made by the background update itself
+      return;
+    }
+    thread = std::move(this->AsyncUpdate->Thread);
+  }
+  if (thread.joinable())
+  {
+    thread.join();
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkStreamingDemandDrivenPipeline::PropagateUpdateExtent(int outputPort)
 {
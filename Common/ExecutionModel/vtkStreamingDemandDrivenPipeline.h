@@ -28,6 +28,9 @@
 
 #include "vtkCommonExecutionModelModule.h" // For export macro
 #include "vtkDemandDrivenPipeline.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+
+#include <future> // For std::shared_future
 
 #define VTK_UPDATE_EXTENT_COMBINE 1
 #define VTK_UPDATE_EXTENT_REPLACE 2
@@ -92,6 +95,27 @@ public:
    */
   virtual vtkTypeBool Update(int port, vtkInformationVector* requests);
 
+#if !defined(__VTK_WRAP__)
+  /**
+   * Update the given output port for the given time step on a background
+   * thread and return a future holding a shallow copy of the output, or
+   * nullptr if the update failed. This lets a reader decode the next time
+   * step while the data of the current one is consumed, for instance by
+   * rendering. The output of the algorithm and of the algorithms upstream
+   * must not be accessed until the future is ready, but requests reaching
+   * this executive, including the ones forwarded by downstream algorithms,
+   * wait for the background update first. Only one background update runs
+   * at a time: a new one waits for the previous one to finish.
+   */
+  std::shared_future<vtkSmartPointer<vtkDataObject>> UpdateTimeStepAsync(int port, double time);
+#endif
+
+  /**
+   * Wait for the background update started by UpdateTimeStepAsync(), if
+   * any, to finish.
+   */
+  void WaitForAsyncUpdate();
+
   /**
    * Propagate the update request from the given output port back
    * through the pipeline.  Should be called only when information is
@@ -318,6 +342,9 @@ protected:
   int LastPropogateUpdateExtentShortCircuited;
 
 private:
+  struct vtkAsyncUpdate;
+  vtkAsyncUpdate* AsyncUpdate;
+
   vtkStreamingDemandDrivenPipeline(const vtkStreamingDemandDrivenPipeline&) = delete;
   void operator=(const vtkStreamingDemandDrivenPipeline&) = delete;
 };
@@ -23,6 +23,10 @@
  * algorithm implement all pipeline passes in a re-entrant way. It should
  * store/retrieve all state changes using input and output information
  * objects, which are unique to each thread.
+ *
+ * To process blocks concurrently only for the algorithms known to be
+ * re-entrant, keep the default vtkCompositeDataPipeline and set
+ * vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION() on those algorithms.
  */
 
 #ifndef vtkThreadedCompositeDataPipeline_h
@@ -60,7 +64,6 @@ protected:
 private:
   vtkThreadedCompositeDataPipeline(const vtkThreadedCompositeDataPipeline&) = delete;
   void operator=(const vtkThreadedCompositeDataPipeline&) = delete;
-  friend class ProcessBlock;
 };
 
 VTK_ABI_NAMESPACE_END
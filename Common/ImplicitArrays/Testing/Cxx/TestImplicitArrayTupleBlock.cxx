@@ -0,0 +1,86 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestImplicitArrayTupleBlock.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkImplicitArray.h"
+
+#include "vtkDataArrayRange.h"
+#include "vtkFloatArray.h"
+#include "vtkNew.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+struct Identity
+{
+  int operator()(int idx) const { return idx; }
+};
+}
+
+int TestImplicitArrayTupleBlock(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  int res = EXIT_SUCCESS;
+  vtkNew<vtkImplicitArray<::Identity>> identity;
+  identity->SetNumberOfComponents(3);
+  identity->SetNumberOfTuples(1000);
+
+  std::vector<double> block(3 * 10);
+  identity->GetTupleBlock(500, 510, block.data());
+  for (int iVal = 0; iVal < 30; iVal++)
+  {
+    if (block[iVal] != 1500 + iVal)
+    {
+      res = EXIT_FAILURE;
+      std::cout << iVal << "th value of the tuple block is not equal to " << 1500 + iVal
+                << std::endl;
+    }
+  }
+
+  // ranges made on a vtkDataArray use the block method
+  vtkDataArray* identityBase = identity;
+  const auto tuples = vtk::DataArrayTupleRange(identityBase, 100, 200);
+  tuples.GetTuples(5, 15, block.data());
+  for (int iVal = 0; iVal < 30; iVal++)
+  {
+    if (block[iVal] != 315 + iVal)
+    {
+      res = EXIT_FAILURE;
+      std::cout << iVal << "th value of the range tuples is not equal to " << 315 + iVal
+                << std::endl;
+    }
+  }
+
+  // the deep copy into a dispatched array reads the implicit array by blocks
+  vtkNew<vtkFloatArray> copied;
+  copied->DeepCopy(identity);
+  if (copied->GetNumberOfComponents() != 3 || copied->GetNumberOfTuples() != 1000)
+  {
+    res = EXIT_FAILURE;
+    std::cout << "deep copied array does not have the size of the implicit array" << std::endl;
+  }
+  auto copiedRange = vtk::DataArrayValueRange<3>(copied);
+  int iArr = 0;
+  for (auto val : copiedRange)
+  {
+    if (val != iArr)
+    {
+      res = EXIT_FAILURE;
+      std::cout << iArr << " deep copied entry is not equal to its index!" << std::endl;
+    }
+    iArr++;
+  }
+
+  return res;
+}
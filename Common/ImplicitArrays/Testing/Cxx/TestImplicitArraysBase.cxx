@@ -17,6 +17,7 @@
 #include "vtkArrayDispatch.h"
 #include "vtkDataArrayRange.h"
 #include "vtkIntArray.h"
+#include "vtkSmartPointer.h"
 
 #include <cstdlib>
 
@@ -177,6 +178,23 @@ int TestImplicitArraysBase(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
   }
   arr42->Squeeze();
 
+  vtkDataArray* arr42Base = arr42;
+  auto instance = vtk::TakeSmartPointer(arr42Base->NewInstance());
+  if (!vtkIntArray::SafeDownCast(instance))
+  {
+    res = EXIT_FAILURE;
+    std::cout << "new instance is not an int array!" << std::endl;
+  }
+  else
+  {
+    instance->InsertNextTuple1(7);
+    if (instance->GetTuple1(0) != 7)
+    {
+      res = EXIT_FAILURE;
+      std::cout << "new instance entry is not equal to inserted 7!" << std::endl;
+    }
+  }
+
   vtkNew<vtkImplicitArray<::ConstStruct>> genericConstArr;
   genericConstArr->ConstructBackend(42);
   genericConstArr->SetNumberOfComponents(2);
@@ -0,0 +1,121 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestStructuredConnectivityArray.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkStructuredConnectivityArray.h"
+
+#include "vtkDataArrayRange.h"
+#include "vtkNew.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+vtkIdType PointId(const int dims[3], int i, int j, int k)
+{
+  return i + j * static_cast<vtkIdType>(dims[0]) + k * static_cast<vtkIdType>(dims[0]) * dims[1];
+}
+
+// Explicit connectivity built cell by cell, the way vtkStructuredGrid::GetCell
+// orders the points of its hexahedra and quads.
+std::vector<vtkIdType> ExplicitConnectivity(const int dims[3])
+{
+  std::vector<vtkIdType> connectivity;
+  const int ni = dims[0] > 1 ? dims[0] - 1 : 1;
+  const int nj = dims[1] > 1 ? dims[1] - 1 : 1;
+  const int nk = dims[2] > 1 ? dims[2] - 1 : 1;
+  for (int k = 0; k < nk; ++k)
+  {
+    for (int j = 0; j < nj; ++j)
+    {
+      for (int i = 0; i < ni; ++i)
+      {
+        if (dims[0] > 1 && dims[1] > 1 && dims[2] > 1)
+        {
+          connectivity.insert(connectivity.end(),
+            { PointId(dims, i, j, k), PointId(dims, i + 1, j, k), PointId(dims, i + 1, j + 1, k),
+              PointId(dims, i, j + 1, k), PointId(dims, i, j, k + 1),
+              PointId(dims, i + 1, j, k + 1), PointId(dims, i + 1, j + 1, k + 1),
+              PointId(dims, i, j + 1, k + 1) });
+        }
+        else if (dims[1] == 1)
+        {
+          // quads in the XZ plane
+          connectivity.insert(connectivity.end(),
+            { PointId(dims, i, j, k), PointId(dims, i + 1, j, k), PointId(dims, i + 1, j, k + 1),
+              PointId(dims, i, j, k + 1) });
+        }
+      }
+    }
+  }
+  return connectivity;
+}
+
+bool TestDimensions(const int dims[3], int expectedCellSize)
+{
+  auto backend = std::make_shared<vtkStructuredConnectivityImplicitBackend<vtkIdType>>(dims);
+  vtkNew<vtkStructuredConnectivityArray<vtkIdType>> connectivity;
+  connectivity->SetBackend(backend);
+  connectivity->SetNumberOfComponents(1);
+  connectivity->SetNumberOfTuples(backend->GetNumberOfCells() * backend->GetCellSize());
+
+  if (backend->GetCellSize() != expectedCellSize)
+  {
+    std::cout << "Wrong cell size " << backend->GetCellSize() << std::endl;
+    return false;
+  }
+
+  const std::vector<vtkIdType> expected = ExplicitConnectivity(dims);
+  if (static_cast<vtkIdType>(expected.size()) != connectivity->GetNumberOfValues())
+  {
+    std::cout << "Wrong connectivity size " << connectivity->GetNumberOfValues() << std::endl;
+    return false;
+  }
+  vtkIdType index = 0;
+  for (auto value : vtk::DataArrayValueRange<1>(connectivity))
+  {
+    if (value != expected[index])
+    {
+      std::cout << "Wrong point id " << value << " at index " << index << ", expected "
+                << expected[index] << std::endl;
+      return false;
+    }
+    ++index;
+  }
+  return true;
+}
+}
+
+int TestStructuredConnectivityArray(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  int res = EXIT_SUCCESS;
+
+  const int hexDims[3] = { 3, 4, 5 };
+  if (!TestDimensions(hexDims, 8))
+  {
+    std::cout << "vtkStructuredConnectivityArray failed with hexahedra" << std::endl;
+    res = EXIT_FAILURE;
+  }
+
+  const int quadDims[3] = { 4, 1, 3 };
+  if (!TestDimensions(quadDims, 4))
+  {
+    std::cout << "vtkStructuredConnectivityArray failed with quads" << std::endl;
+    res = EXIT_FAILURE;
+  }
+
+  return res;
+}
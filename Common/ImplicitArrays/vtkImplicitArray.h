@@ -45,7 +45,8 @@
  *
  * Being a "read_only" array, any attempt to set a value in the array will result in a warning
  * message with no change to the backend itself. This may evolve in future versions of the class as
- * the needs of users become clearer.
+ * the needs of users become clearer. For the same reason, `NewInstance` returns an AOS
+ * array of the same value type, that filters can fill with their output values.
  *
  * The `GetVoidPointer` method will create an internal vtkAOSDataArrayTemplate and populate it with
  * the values from the implicit array and can thus be very memory intensive. The `Squeeze` method
@@ -142,7 +143,8 @@ class vtkImplicitArray
 
 public:
   using SelfType = vtkImplicitArray<BackendT>;
-  vtkTemplateTypeMacro(SelfType, GenericDataArrayType);
+  vtkAbstractTemplateTypeMacro(SelfType, GenericDataArrayType);
+  vtkAOSArrayNewInstanceMacro(SelfType);
   using ValueType = typename GenericDataArrayType::ValueType;
   using BackendType = BackendT;
 
@@ -0,0 +1,41 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkStructuredConnectivityArray.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkStructuredConnectivityArray_h
+#define vtkStructuredConnectivityArray_h
+
+#include "vtkCommonImplicitArraysModule.h"            // for export macro
+#include "vtkImplicitArray.h"                         // for the array
+#include "vtkStructuredConnectivityImplicitBackend.h" // for the array backend
+
+/**
+ * \var vtkStructuredConnectivityArray
+ * \brief A utility alias for the implicit connectivity of structured cells
+ *
+ * It holds no memory: 8 vtkIdType per hexahedron are saved compared to an
+ * explicit connectivity array. Unlike the other implicit arrays of this
+ * module, it is not instantiated in the library and not part of the
+ * dispatchers; it is meant for integral value types only.
+ *
+ * @sa
+ * vtkImplicitArray vtkStructuredConnectivityImplicitBackend vtkAffineArray
+ */
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename T>
+using vtkStructuredConnectivityArray =
+  vtkImplicitArray<vtkStructuredConnectivityImplicitBackend<T>>;
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkStructuredConnectivityArray_h
@@ -0,0 +1,145 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkStructuredConnectivityImplicitBackend.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkStructuredConnectivityImplicitBackend_h
+#define vtkStructuredConnectivityImplicitBackend_h
+
+#include "vtkCommonImplicitArraysModule.h"
+#include "vtkType.h" // for vtkIdType
+
+/**
+ * \struct vtkStructuredConnectivityImplicitBackend
+ * \brief A utility structure serving as a backend for the connectivity of structured cells
+ *
+ * This structure exposes the topology of a structured data set (vtkImageData,
+ * vtkRectilinearGrid, vtkStructuredGrid, or the initial topology of a
+ * vtkExplicitStructuredGrid) as the flat connectivity array a vtkCellArray
+ * would hold, without storing it. At construction it takes the point
+ * dimensions of the data set. Every cell has the same number of points: 8
+ * (hexahedra) if the three dimensions are larger than one, 4 (quads) if two
+ * are, 2 (lines) if one is, 1 (vertex) otherwise. Cells are ordered like
+ * vtkStructuredData::ComputeCellId() and their points like the
+ * VTK_HEXAHEDRON, VTK_QUAD, VTK_LINE or VTK_VERTEX cells that
+ * vtkStructuredGrid::GetCell() returns, so the value at index
+ *
+ *   cellId * cellSize + i
+ *
+ * is the id of the i-th point of cell cellId. The matching offsets array is
+ * a vtkAffineArray with a slope of GetCellSize() and an intercept of 0.
+ *
+ * An example of potential usage in a vtkImplicitArray
+ * ```
+ * int dims[3] = { nx, ny, nz };
+ * vtkStructuredConnectivityImplicitBackend<vtkIdType> backend(dims);
+ * vtkNew<vtkImplicitArray<vtkStructuredConnectivityImplicitBackend<vtkIdType>>> connectivity;
+ * connectivity->SetBackend(
+ *   std::make_shared<vtkStructuredConnectivityImplicitBackend<vtkIdType>>(dims));
+ * connectivity->SetNumberOfComponents(1);
+ * connectivity->SetNumberOfTuples(backend.GetNumberOfCells() * backend.GetCellSize());
+ * ```
+ *
+ * @sa
+ * vtkImplicitArray vtkAffineImplicitBackend vtkStructuredConnectivityArray
+ */
+VTK_ABI_NAMESPACE_BEGIN
+template <typename ValueType>
+struct vtkStructuredConnectivityImplicitBackend final
+{
+  /**
+   * A non-trivially constructible constructor
+   *
+   * \param pointDimensions the number of points along each axis
+   */
+  vtkStructuredConnectivityImplicitBackend(const int pointDimensions[3])
+  {
+    int axes[3];
+    int numAxes = 0;
+    vtkIdType pointStride = 1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      this->PointStrides[axis] = pointStride;
+      this->CellDimensions[axis] = pointDimensions[axis] > 1 ? pointDimensions[axis] - 1 : 1;
+      pointStride *= pointDimensions[axis];
+      if (pointDimensions[axis] > 1)
+      {
+        axes[numAxes++] = axis;
+      }
+    }
+    this->CellSizeShift = numAxes;
+
+    // Corners of the unit cell in the order of vtkHexahedron, vtkQuad,
+    // vtkLine and vtkVertex
+    static const int corners[8][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 },
+      { 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 } };
+    for (int corner = 0; corner < this->GetCellSize(); ++corner)
+    {
+      this->CornerOffsets[corner] = 0;
+      for (int i = 0; i < numAxes; ++i)
+      {
+        this->CornerOffsets[corner] += corners[corner][i] * this->PointStrides[axes[i]];
+      }
+    }
+  }
+
+  /**
+   * The main call method for the backend
+   *
+   * \param index the index in the flat connectivity array
+   * \return the id of the point at that index
+   */
+  ValueType operator()(int index) const
+  {
+    const vtkIdType cellId = static_cast<vtkIdType>(index) >> this->CellSizeShift;
+    const int corner = index & (this->GetCellSize() - 1);
+    const vtkIdType i = cellId % this->CellDimensions[0];
+    const vtkIdType jk = cellId / this->CellDimensions[0];
+    const vtkIdType j = jk % this->CellDimensions[1];
+    const vtkIdType k = jk / this->CellDimensions[1];
+    return static_cast<ValueType>(i * this->PointStrides[0] + j * this->PointStrides[1] +
+      k * this->PointStrides[2] + this->CornerOffsets[corner]);
+  }
+
+  /**
+   * The number of points of every cell
+   */
+  int GetCellSize() const { return 1 << this->CellSizeShift; }
+
+  /**
+   * The number of cells of the data set
+   */
+  vtkIdType GetNumberOfCells() const
+  {
+    return this->CellDimensions[0] * this->CellDimensions[1] * this->CellDimensions[2];
+  }
+
+  /**
+   * The number of cells along each axis, 1 along collapsed axes
+   */
+  vtkIdType CellDimensions[3];
+  /**
+   * The id increment from one point to the next along each axis
+   */
+  vtkIdType PointStrides[3];
+  /**
+   * The id offset of each point of a cell from its first point
+   */
+  vtkIdType CornerOffsets[8];
+  /**
+   * The base 2 logarithm of the number of points of every cell
+   */
+  int CellSizeShift;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkStructuredConnectivityImplicitBackend_h
@@ -20,6 +20,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <functional>
 #include <memory>
 #include <numeric>
 
@@ -90,6 +92,131 @@ static int Test_kernel_generation();
 static int Test_csd();
 static int Test_transpose();
 static int Test_octave();
+static int Test_fft_prime_sizes();
+static int Test_rfftn();
+
+// Compute the DFT of a multi-dimensional array directly, for the given
+// output index along each axis.
+static vtkFFT::ComplexNumber DirectDft(const std::vector<vtkFFT::ScalarNumber>& in,
+  const std::vector<std::size_t>& shape, const std::vector<std::size_t>& freq)
+{
+  double re = 0.0;
+  double im = 0.0;
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    double phase = 0.0;
+    std::size_t rest = i;
+    for (std::size_t axis = shape.size(); axis-- > 0;)
+    {
+      const std::size_t m = rest % shape[axis];
+      rest /= shape[axis];
+      phase += static_cast<double>((m * freq[axis]) % shape[axis]) / shape[axis];
+    }
+    re += in[i] * std::cos(-2.0 * vtkMath::Pi() * phase);
+    im += in[i] * std::sin(-2.0 * vtkMath::Pi() * phase);
+  }
+  return vtkFFT::ComplexNumber{ re, im };
+}
+
+int Test_fft_prime_sizes()
+{
+  std::cout << "Test_fft_prime_sizes..";
+
+  // 1009 is computed as a convolution, 17 with the generic butterflies
+  int status = 0;
+  for (std::size_t size : { std::size_t(17), std::size_t(1009) })
+  {
+    std::vector<vtkFFT::ScalarNumber> signal(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      signal[i] = std::sin(0.1 * i * i) + 0.5;
+    }
+    auto spectrum = vtkFFT::Fft(signal);
+    auto inverse = vtkFFT::IFft(spectrum);
+    if (spectrum.size() != size || inverse.size() != size)
+    {
+      std::cerr << "..wrong size for " << size << "..";
+      status++;
+      continue;
+    }
+    for (std::size_t k = 0; k < size; k += 7)
+    {
+      if (!FuzzyCompare(spectrum[k], DirectDft(signal, { size }, { k }), 1e-9))
+      {
+        std::cerr << "..wrong frequency " << k << " for size " << size << "..";
+        status++;
+        break;
+      }
+    }
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      if (!FuzzyCompare(inverse[i], vtkFFT::ComplexNumber{ signal[i], 0.0 }, 1e-12))
+      {
+        std::cerr << "..wrong inverse for size " << size << "..";
+        status++;
+        break;
+      }
+    }
+  }
+
+  std::cout << (status ? "..FAILED" : ".PASSED") << std::endl;
+  return status;
+}
+
+int Test_rfftn()
+{
+  std::cout << "Test_rfftn..";
+
+  int status = 0;
+  const std::vector<std::vector<std::size_t>> shapes = { { 6 }, { 7 }, { 3, 4, 5 }, { 5, 1, 3 },
+    { 17, 9, 8 } };
+  for (const auto& shape : shapes)
+  {
+    const std::size_t size =
+      std::accumulate(shape.begin(), shape.end(), std::size_t(1), std::multiplies<std::size_t>());
+    std::vector<vtkFFT::ScalarNumber> signal(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      signal[i] = std::cos(0.37 * i * i) - 0.25;
+    }
+
+    auto spectrum = vtkFFT::RFftN(signal, shape);
+    const std::size_t half = shape.back() / 2 + 1;
+    if (spectrum.size() != size / shape.back() * half)
+    {
+      std::cerr << "..wrong number of frequencies..";
+      status++;
+      continue;
+    }
+    std::vector<std::size_t> freq(shape.size());
+    for (std::size_t i = 0; i < spectrum.size(); ++i)
+    {
+      std::size_t rest = i;
+      for (std::size_t axis = shape.size(); axis-- > 0;)
+      {
+        const std::size_t length = (axis + 1 == shape.size() ? half : shape[axis]);
+        freq[axis] = rest % length;
+        rest /= length;
+      }
+      if (!FuzzyCompare(spectrum[i], DirectDft(signal, shape, freq), 1e-9))
+      {
+        std::cerr << "..wrong frequency " << i << " of a real transform..";
+        status++;
+        break;
+      }
+    }
+
+    auto inverse = vtkFFT::IRFftN(spectrum, shape);
+    if (inverse.size() != size || !FuzzyCompare(inverse, signal, 1e-12))
+    {
+      std::cerr << "..wrong inverse of a real transform..";
+      status++;
+    }
+  }
+
+  std::cout << (status ? "..FAILED" : ".PASSED") << std::endl;
+  return status;
+}
 
 int UnitTestFFT(int, char*[])
 {
@@ -107,6 +234,8 @@ int UnitTestFFT(int, char*[])
   status += Test_csd();
   status += Test_transpose();
   status += Test_octave();
+  status += Test_fft_prime_sizes();
+  status += Test_rfftn();
 
   if (status != 0)
   {
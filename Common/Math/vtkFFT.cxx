@@ -18,32 +18,250 @@
 #include "vtkObjectFactory.h"
 #include "vtkSMPTools.h"
 
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
-vtkStandardNewMacro(vtkFFT);
+namespace
+{
+using ComplexNumber = vtkFFT::ComplexNumber;
+using ScalarNumber = vtkFFT::ScalarNumber;
 
 //------------------------------------------------------------------------------
-std::vector<vtkFFT::ComplexNumber> vtkFFT::Fft(const std::vector<ComplexNumber>& in)
+// The plan of a complex transform of a given size and direction. Sizes with
+// large prime factors, for which the generic butterflies of kissfft cost
+// O(size * factor), are computed with the chirp-z algorithm of Bluestein as
+// a convolution of a fast size. A plan is not modified by Execute, so it can
+// be shared by several threads.
+class vtkFFTPlan
 {
-  if (in.size() <= 1)
+public:
+  vtkFFTPlan(std::size_t size, bool inverse);
+  ~vtkFFTPlan();
+
+  // Input and output may be the same array.
+  void Execute(const ComplexNumber* input, ComplexNumber* output) const;
+
+private:
+  vtkFFTPlan(const vtkFFTPlan&) = delete;
+  void operator=(const vtkFFTPlan&) = delete;
+
+  // An estimate of the number of operations of a transform of this size.
+  static double Cost(std::size_t size);
+
+  std::size_t Size;
+  kiss_fft_cfg Direct = nullptr;
+
+  std::size_t ConvolutionSize = 0;
+  kiss_fft_cfg Forward = nullptr;
+  kiss_fft_cfg Backward = nullptr;
+  std::vector<ComplexNumber> Chirp;
+  std::vector<ComplexNumber> KernelFft;
+};
+
+//------------------------------------------------------------------------------
+double vtkFFTPlan::Cost(std::size_t size)
+{
+  double factors = 0.0;
+  std::size_t n = size;
+  for (std::size_t p = 2; p * p <= n; ++p)
   {
-    return {};
+    while (n % p == 0)
+    {
+      factors += static_cast<double>(p);
+      n /= p;
+    }
   }
+  if (n > 1)
+  {
+    factors += static_cast<double>(n);
+  }
+  return static_cast<double>(size) * factors;
+}
 
-  kiss_fft_cfg cfg =
-    kiss_fft_alloc(static_cast<int>(in.size()), 0 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
+//------------------------------------------------------------------------------
+vtkFFTPlan::vtkFFTPlan(std::size_t size, bool inverse)
+  : Size(size)
+{
+  if (size <= 1)
+  {
+    return;
+  }
+
+  const std::size_t convolutionSize =
+    static_cast<std::size_t>(kiss_fft_next_fast_size(static_cast<int>(2 * size - 1)));
+  if (vtkFFTPlan::Cost(size) <= 3.0 * vtkFFTPlan::Cost(convolutionSize))
   {
-    std::vector<vtkFFT::ComplexNumber> result(in.size());
+    this->Direct = kiss_fft_alloc(static_cast<int>(size), inverse ? 1 : 0, nullptr, nullptr);
+    return;
+  }
 
-    kiss_fft(cfg, in.data(), result.data());
-    kiss_fft_free(cfg);
+  this->ConvolutionSize = convolutionSize;
+  this->Forward = kiss_fft_alloc(static_cast<int>(convolutionSize), 0, nullptr, nullptr);
+  this->Backward = kiss_fft_alloc(static_cast<int>(convolutionSize), 1, nullptr, nullptr);
 
-    return result;
+  // nk = (n^2 + k^2 - (k-n)^2) / 2, so that the transform is a convolution
+  // with the chirp exp(i*pi*m^2/size), whose angle is computed modulo 2*pi
+  // to keep its precision for large m
+  const double sign = inverse ? 1.0 : -1.0;
+  this->Chirp.resize(size);
+  for (std::size_t m = 0; m < size; ++m)
+  {
+    const unsigned long long m2 = (static_cast<unsigned long long>(m) * m) % (2 * size);
+    const double angle = sign * vtkMath::Pi() * static_cast<double>(m2) / size;
+    this->Chirp[m] = ComplexNumber{ static_cast<ScalarNumber>(std::cos(angle)),
+      static_cast<ScalarNumber>(std::sin(angle)) };
   }
-  return {};
+
+  std::vector<ComplexNumber> kernel(convolutionSize, ComplexNumber{ 0.0, 0.0 });
+  kernel[0] = vtkFFT::Conjugate(this->Chirp[0]);
+  for (std::size_t m = 1; m < size; ++m)
+  {
+    kernel[m] = kernel[convolutionSize - m] = vtkFFT::Conjugate(this->Chirp[m]);
+  }
+  this->KernelFft.resize(convolutionSize);
+  if (this->Forward)
+  {
+    kiss_fft(this->Forward, kernel.data(), this->KernelFft.data());
+  }
+  // include the scaling of the inverse transform of the convolution
+  for (auto& value : this->KernelFft)
+  {
+    value = value / static_cast<ScalarNumber>(convolutionSize);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkFFTPlan::~vtkFFTPlan()
+{
+  kiss_fft_free(this->Direct);
+  kiss_fft_free(this->Forward);
+  kiss_fft_free(this->Backward);
+}
+
+//------------------------------------------------------------------------------
+void vtkFFTPlan::Execute(const ComplexNumber* input, ComplexNumber* output) const
+{
+  if (this->Size <= 1)
+  {
+    std::copy(input, input + this->Size, output);
+  }
+  else if (this->Direct)
+  {
+    kiss_fft(this->Direct, input, output);
+  }
+  else if (this->Forward && this->Backward)
+  {
+    std::vector<ComplexNumber> work(this->ConvolutionSize, ComplexNumber{ 0.0, 0.0 });
+    std::vector<ComplexNumber> workFft(this->ConvolutionSize);
+    for (std::size_t m = 0; m < this->Size; ++m)
+    {
+      work[m] = input[m] * this->Chirp[m];
+    }
+    kiss_fft(this->Forward, work.data(), workFft.data());
+    for (std::size_t m = 0; m < this->ConvolutionSize; ++m)
+    {
+      workFft[m] = workFft[m] * this->KernelFft[m];
+    }
+    kiss_fft(this->Backward, workFft.data(), work.data());
+    for (std::size_t m = 0; m < this->Size; ++m)
+    {
+      output[m] = work[m] * this->Chirp[m];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Get the plan of a transform from the cache, or create it.
+std::shared_ptr<const vtkFFTPlan> vtkFFTGetPlan(std::size_t size, bool inverse)
+{
+  // the plans in use stay valid if the cache is cleared
+  static constexpr std::size_t maxNumberOfPlans = 64;
+  static std::mutex mutex;
+  static std::map<std::pair<std::size_t, bool>, std::shared_ptr<const vtkFFTPlan>> plans;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto key = std::make_pair(size, inverse);
+  auto it = plans.find(key);
+  if (it != plans.end())
+  {
+    return it->second;
+  }
+  if (plans.size() >= maxNumberOfPlans)
+  {
+    plans.clear();
+  }
+  auto plan = std::make_shared<const vtkFFTPlan>(size, inverse);
+  plans[key] = plan;
+  return plan;
+}
+
+//------------------------------------------------------------------------------
+// Transform in place the lines of a complex array along one axis, where the
+// array has "outer" blocks of "length" lines of "inner" contiguous values.
+// Several lines are gathered at once, so that memory is read contiguously.
+void vtkFFTTransformAxis(ComplexNumber* data, std::size_t outer, std::size_t length,
+  std::size_t inner, bool inverse)
+{
+  if (length <= 1)
+  {
+    return;
+  }
+  auto plan = vtkFFTGetPlan(length, inverse);
+  constexpr std::size_t blockSize = 16;
+  const std::size_t blocksPerOuter = (inner + blockSize - 1) / blockSize;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(outer * blocksPerOuter),
+    [&](vtkIdType begin, vtkIdType end) {
+      std::vector<ComplexNumber> lines(blockSize * length);
+      std::vector<ComplexNumber> spectra(blockSize * length);
+      for (vtkIdType task = begin; task < end; ++task)
+      {
+        const std::size_t o = static_cast<std::size_t>(task) / blocksPerOuter;
+        const std::size_t first = (static_cast<std::size_t>(task) % blocksPerOuter) * blockSize;
+        const std::size_t count = std::min(blockSize, inner - first);
+        ComplexNumber* base = data + o * length * inner + first;
+        for (std::size_t m = 0; m < length; ++m)
+        {
+          for (std::size_t b = 0; b < count; ++b)
+          {
+            lines[b * length + m] = base[m * inner + b];
+          }
+        }
+        for (std::size_t b = 0; b < count; ++b)
+        {
+          plan->Execute(&lines[b * length], &spectra[b * length]);
+        }
+        for (std::size_t m = 0; m < length; ++m)
+        {
+          for (std::size_t b = 0; b < count; ++b)
+          {
+            base[m * inner + b] = spectra[b * length + m];
+          }
+        }
+      }
+    });
+}
+}
+
+vtkStandardNewMacro(vtkFFT);
+
+//------------------------------------------------------------------------------
+std::vector<vtkFFT::ComplexNumber> vtkFFT::Fft(const std::vector<ComplexNumber>& in)
+{
+  if (in.size() <= 1)
+  {
+    return {};
+  }
+
+  std::vector<vtkFFT::ComplexNumber> result(in.size());
+  vtkFFTGetPlan(in.size(), false)->Execute(in.data(), result.data());
+  return result;
 }
 
 //------------------------------------------------------------------------------
@@ -74,12 +292,7 @@ void vtkFFT::Fft(ComplexNumber* input, std::size_t size, ComplexNumber* result)
     return;
   }
 
-  kiss_fft_cfg cfg = kiss_fft_alloc(static_cast<int>(size), 0 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
-  {
-    kiss_fft(cfg, input, result);
-    kiss_fft_free(cfg);
-  }
+  vtkFFTGetPlan(size, false)->Execute(input, result);
 }
 
 //------------------------------------------------------------------------------
@@ -220,22 +433,22 @@ std::vector<vtkFFT::ComplexNumber> vtkFFT::IFft(const std::vector<vtkFFT::Comple
     return {};
   }
 
-  std::size_t outSize = in.size();
-  kiss_fft_cfg cfg =
-    kiss_fft_alloc(static_cast<int>(outSize), 1 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
-  {
-    std::vector<vtkFFT::ComplexNumber> result(outSize);
-
-    kiss_fft(cfg, in.data(), result.data());
-    std::for_each(result.begin(), result.end(), [outSize](vtkFFT::ComplexNumber& x) {
-      x = vtkFFT::ComplexNumber{ x.r / outSize, x.i / outSize };
-    });
-    kiss_fft_free(cfg);
+  std::vector<vtkFFT::ComplexNumber> result(in.size());
+  vtkFFT::IFft(const_cast<ComplexNumber*>(in.data()), in.size(), result.data());
+  return result;
+}
 
-    return result;
+//------------------------------------------------------------------------------
+void vtkFFT::IFft(ComplexNumber* input, std::size_t size, ComplexNumber* result)
+{
+  if (size == 0)
+  {
+    return;
   }
-  return {};
+
+  vtkFFTGetPlan(size, true)->Execute(input, result);
+  const ScalarNumber scale = static_cast<ScalarNumber>(size);
+  std::for_each(result, result + size, [scale](vtkFFT::ComplexNumber& x) { x = x / scale; });
 }
 
 //------------------------------------------------------------------------------
@@ -263,6 +476,172 @@ std::vector<vtkFFT::ScalarNumber> vtkFFT::IRFft(const std::vector<vtkFFT::Comple
   return {};
 }
 
+//------------------------------------------------------------------------------
+std::vector<vtkFFT::ComplexNumber> vtkFFT::RFftN(
+  const std::vector<ScalarNumber>& in, const std::vector<std::size_t>& shape)
+{
+  if (shape.empty() ||
+    in.size() !=
+      std::accumulate(shape.begin(), shape.end(), std::size_t(1), std::multiplies<std::size_t>()) ||
+    in.empty())
+  {
+    return {};
+  }
+
+  std::vector<vtkFFT::ComplexNumber> result(in.size() / shape.back() * (shape.back() / 2 + 1));
+  vtkFFT::RFftN(in.data(), shape, result.data());
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkFFT::RFftN(
+  const ScalarNumber* input, const std::vector<std::size_t>& shape, ComplexNumber* result)
+{
+  if (shape.empty() || std::find(shape.begin(), shape.end(), 0) != shape.end())
+  {
+    return;
+  }
+
+  // The lines of the last axis are transformed two at a time, as the real
+  // and imaginary parts of a complex line, whose transform z gives the two
+  // transforms as (z[k] + conj(z[n-k]))/2 and (z[k] - conj(z[n-k]))/2i.
+  const std::size_t n = shape.back();
+  const std::size_t half = n / 2 + 1;
+  const std::size_t numLines =
+    std::accumulate(shape.begin(), shape.end() - 1, std::size_t(1), std::multiplies<std::size_t>());
+  auto plan = vtkFFTGetPlan(n, false);
+  const vtkIdType numPairs = static_cast<vtkIdType>((numLines + 1) / 2);
+  vtkSMPTools::For(0, numPairs, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<ComplexNumber> line(n);
+    std::vector<ComplexNumber> spectrum(n);
+    for (vtkIdType pair = begin; pair < end; ++pair)
+    {
+      const std::size_t first = 2 * static_cast<std::size_t>(pair);
+      const bool hasSecond = (first + 1 < numLines);
+      const ScalarNumber* x = input + first * n;
+      for (std::size_t k = 0; k < n; ++k)
+      {
+        line[k] = ComplexNumber{ x[k], hasSecond ? x[n + k] : ScalarNumber(0) };
+      }
+      plan->Execute(line.data(), spectrum.data());
+      ComplexNumber* a = result + first * half;
+      ComplexNumber* b = a + half;
+      for (std::size_t k = 0; k < half; ++k)
+      {
+        const ComplexNumber z = spectrum[k];
+        const ComplexNumber w = vtkFFT::Conjugate(spectrum[(n - k) % n]);
+        a[k] = ComplexNumber{ (z.r + w.r) / 2, (z.i + w.i) / 2 };
+        if (hasSecond)
+        {
+          b[k] = ComplexNumber{ (z.i - w.i) / 2, (w.r - z.r) / 2 };
+        }
+      }
+    }
+  });
+
+  // then the other axes, in place
+  std::size_t inner = half;
+  for (std::size_t axis = shape.size() - 1; axis-- > 0;)
+  {
+    const std::size_t outer = std::accumulate(
+      shape.begin(), shape.begin() + axis, std::size_t(1), std::multiplies<std::size_t>());
+    vtkFFTTransformAxis(result, outer, shape[axis], inner, false);
+    inner *= shape[axis];
+  }
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkFFT::ScalarNumber> vtkFFT::IRFftN(
+  const std::vector<ComplexNumber>& in, const std::vector<std::size_t>& shape)
+{
+  if (shape.empty() || std::find(shape.begin(), shape.end(), 0) != shape.end())
+  {
+    return {};
+  }
+  const std::size_t size =
+    std::accumulate(shape.begin(), shape.end(), std::size_t(1), std::multiplies<std::size_t>());
+  if (in.size() != size / shape.back() * (shape.back() / 2 + 1))
+  {
+    return {};
+  }
+
+  std::vector<ComplexNumber> work(in);
+  std::vector<vtkFFT::ScalarNumber> result(size);
+  vtkFFT::IRFftN(work.data(), shape, result.data());
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkFFT::IRFftN(
+  ComplexNumber* input, const std::vector<std::size_t>& shape, ScalarNumber* result)
+{
+  if (shape.empty() || std::find(shape.begin(), shape.end(), 0) != shape.end())
+  {
+    return;
+  }
+
+  // first the axes before the last one, in place
+  const std::size_t n = shape.back();
+  const std::size_t half = n / 2 + 1;
+  std::size_t inner = half;
+  for (std::size_t axis = shape.size() - 1; axis-- > 0;)
+  {
+    const std::size_t outer = std::accumulate(
+      shape.begin(), shape.begin() + axis, std::size_t(1), std::multiplies<std::size_t>());
+    vtkFFTTransformAxis(input, outer, shape[axis], inner, true);
+    inner *= shape[axis];
+  }
+
+  // Then the lines of the last axis, two at a time: the hermitian spectra
+  // a and b of two real lines are combined as a + ib, whose inverse has the
+  // two lines as its real and imaginary parts. The imaginary parts of the
+  // zero and Nyquist frequencies are ignored, as they are for a real line.
+  const std::size_t numLines = inner / half;
+  const ScalarNumber scale = static_cast<ScalarNumber>(numLines * n);
+  auto plan = vtkFFTGetPlan(n, true);
+  const vtkIdType numPairs = static_cast<vtkIdType>((numLines + 1) / 2);
+  vtkSMPTools::For(0, numPairs, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<ComplexNumber> line(n);
+    std::vector<ComplexNumber> values(n);
+    for (vtkIdType pair = begin; pair < end; ++pair)
+    {
+      const std::size_t first = 2 * static_cast<std::size_t>(pair);
+      const bool hasSecond = (first + 1 < numLines);
+      const ComplexNumber* a = input + first * half;
+      const ComplexNumber* b = a + half;
+      for (std::size_t k = 0; k < n; ++k)
+      {
+        const bool mirrored = (k >= half);
+        const std::size_t j = (mirrored ? n - k : k);
+        const bool realOnly = (j == 0 || 2 * j == n);
+        ComplexNumber x = a[j];
+        ComplexNumber y = (hasSecond ? b[j] : ComplexNumber{ 0.0, 0.0 });
+        if (realOnly)
+        {
+          x.i = 0.0;
+          y.i = 0.0;
+        }
+        else if (mirrored)
+        {
+          x = vtkFFT::Conjugate(x);
+          y = vtkFFT::Conjugate(y);
+        }
+        line[k] = ComplexNumber{ x.r - y.i, x.i + y.r };
+      }
+      plan->Execute(line.data(), values.data());
+      ScalarNumber* out = result + first * n;
+      for (std::size_t k = 0; k < n; ++k)
+      {
+        out[k] = values[k].r / scale;
+        if (hasSecond)
+        {
+          out[n + k] = values[k].i / scale;
+        }
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 std::vector<vtkFFT::ScalarNumber> vtkFFT::FftFreq(int windowLength, double sampleSpacing)
 {
@@ -19,6 +19,10 @@
  * vtkFFT provides methods to perform Discrete Fourier Transforms (DFT).
  * These include providing forward and reverse Fourier transforms.
  * The current implementation uses the third-party library kissfft.
+ * The plans of the complex transforms are cached by size and shared by
+ * all threads, and sizes with large prime factors are computed with the
+ * chirp-z algorithm of Bluestein so that they are not much slower than
+ * the other ones.
  *
  * The terminology tries to follow the Numpy terminology, that is :
  *  - Fft means the Fast Fourier Transform algorithm
@@ -165,6 +169,7 @@ public:
    *  output has n scalar points in case of success and empty in case of failure
    */
   static std::vector<ComplexNumber> IFft(const std::vector<ComplexNumber>& in);
+  static void IFft(ComplexNumber* input, std::size_t size, ComplexNumber* result);
 
   /**
    * Compute the inverse of @c RFft. The input is expected to be in the form returned by @c Rfft,
@@ -176,6 +181,43 @@ public:
    */
   static std::vector<ScalarNumber> IRFft(const std::vector<ComplexNumber>& in);
 
+  ///@{
+  /**
+   * Compute the multi-dimensional DFT for real input. As in Numpy, the last axis of @c shape is
+   * contiguous in memory, and only the non-negative frequencies of the last axis are computed,
+   * since the other ones are their complex conjugates.
+   *
+   *  input has shape[0] * ... * shape[d-1] scalar points
+   *  output has shape[0] * ... * ((shape[d-1] / 2) + 1) complex points in case of success and
+   *  empty in case of failure
+   *
+   * The lines along each axis are transformed with several threads.
+   */
+#ifndef __VTK_WRAP__
+  static std::vector<ComplexNumber> RFftN(
+    const std::vector<ScalarNumber>& in, const std::vector<std::size_t>& shape);
+  static void RFftN(
+    const ScalarNumber* input, const std::vector<std::size_t>& shape, ComplexNumber* result);
+#endif
+  ///@}
+
+  ///@{
+  /**
+   * Compute the inverse of @c RFftN, where @c shape is the shape of the real output.
+   * The pointer-based version uses its input as workspace and overwrites it.
+   *
+   *  input has shape[0] * ... * ((shape[d-1] / 2) + 1) complex points
+   *  output has shape[0] * ... * shape[d-1] scalar points in case of success and empty in case
+   *  of failure
+   */
+#ifndef __VTK_WRAP__
+  static std::vector<ScalarNumber> IRFftN(
+    const std::vector<ComplexNumber>& in, const std::vector<std::size_t>& shape);
+  static void IRFftN(
+    ComplexNumber* input, const std::vector<std::size_t>& shape, ScalarNumber* result);
+#endif
+  ///@}
+
   /**
    * Return the absolute value (also known as norm, modulus, or magnitude) of complex number
    */
@@ -34,7 +34,7 @@ vtkPythonArchiver::~vtkPythonArchiver()
   // have been finalized before the VTK object is released.
   if (Py_IsInitialized())
   {
-    vtkPythonScopeGilEnsurer gilEnsurer;
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
     Py_XDECREF(this->Object);
   }
 }
@@ -81,7 +81,7 @@ static PyObject* VTKToPython(vtkObjectBase* obj)
 //------------------------------------------------------------------------------
 int vtkPythonArchiver::CheckResult(const char* method, const vtkSmartPyObject& res)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   if (!res)
   {
     vtkErrorMacro("Failure when calling method: \"" << method << "\":");
@@ -105,7 +105,7 @@ int vtkPythonArchiver::CheckResult(const char* method, const vtkSmartPyObject& r
 //------------------------------------------------------------------------------
 void vtkPythonArchiver::SetPythonObject(PyObject* obj)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
 
   if (!obj)
   {
@@ -121,7 +121,7 @@ void vtkPythonArchiver::SetPythonObject(PyObject* obj)
 //------------------------------------------------------------------------------
 void vtkPythonArchiver::OpenArchive()
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   const char* mname = "OpenArchive";
   VTK_GET_METHOD(method, this->Object, mname, )
 
@@ -137,7 +137,7 @@ void vtkPythonArchiver::OpenArchive()
 //------------------------------------------------------------------------------
 void vtkPythonArchiver::CloseArchive()
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   const char* mname = "CloseArchive";
   VTK_GET_METHOD(method, this->Object, mname, )
 
@@ -154,7 +154,7 @@ void vtkPythonArchiver::CloseArchive()
 void vtkPythonArchiver::InsertIntoArchive(
   const std::string& relativePath, const char* data, std::size_t size)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   const char* mname = "InsertIntoArchive";
   VTK_GET_METHOD(method, this->Object, mname, )
 
@@ -176,7 +176,7 @@ void vtkPythonArchiver::InsertIntoArchive(
 //------------------------------------------------------------------------------
 bool vtkPythonArchiver::Contains(const std::string& relativePath)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   const char* mname = "Contains";
   VTK_GET_METHOD(method, this->Object, mname, false)
 
@@ -196,7 +196,7 @@ void vtkPythonArchiver::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject str;
   if (this->Object)
   {
@@ -22,8 +22,10 @@
 #include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 
 #include <mutex> // for std::mutex
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 
@@ -151,21 +153,57 @@ void vtkAbstractTransform::TransformVectorAtPoint(
 }
 
 //------------------------------------------------------------------------------
-// Transform a series of points.
+namespace
+{
+// Transforms are applied point by point through virtual calls, which cost
+// much more than the linear transformations: threading pays off for fewer
+// points than in vtkLinearTransform.
+constexpr vtkIdType VTK_SMP_THRESHOLD = 1000;
+
+template <typename Functor>
+void vtkTransformForEachPoint(vtkIdType n, Functor&& functor)
+{
+  if (n >= VTK_SMP_THRESHOLD)
+  {
+    vtkSMPTools::For(0, n, functor);
+  }
+  else
+  {
+    functor(0, n);
+  }
+}
+
+// Append n tuples to the array, keeping its tuples, and return the id of the
+// first new tuple.
+vtkIdType vtkTransformAppendTuples(vtkDataArray* array, vtkIdType n)
+{
+  vtkIdType m = array->GetNumberOfTuples();
+  array->Resize(m + n);
+  array->SetNumberOfTuples(m + n);
+  return m;
+}
+}
+
+//------------------------------------------------------------------------------
+// Transform a series of points.  Once updated, the transformation does not
+// change, so the points are transformed concurrently.
 void vtkAbstractTransform::TransformPoints(vtkPoints* in, vtkPoints* out)
 {
   this->Update();
 
-  double point[3];
-  vtkIdType i;
   vtkIdType n = in->GetNumberOfPoints();
+  vtkIdType m = vtkTransformAppendTuples(out->GetData(), n);
 
-  for (i = 0; i < n; i++)
-  {
-    in->GetPoint(i, point);
-    this->InternalTransformPoint(point, point);
-    out->InsertNextPoint(point);
-  }
+  vtkTransformForEachPoint(n, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double point[3];
+    for (; ptId < endPtId; ++ptId)
+    {
+      in->GetPoint(ptId, point);
+      this->InternalTransformPoint(point, point);
+      out->SetPoint(m + ptId, point);
+    }
+  });
+  out->Modified();
 }
 
 //------------------------------------------------------------------------------
@@ -182,42 +220,54 @@ void vtkAbstractTransform::TransformPointsNormalsVectors(vtkPoints* inPts, vtkPo
 {
   this->Update();
 
-  double matrix[3][3];
-  double coord[3];
-
-  vtkIdType i;
   vtkIdType n = inPts->GetNumberOfPoints();
-
-  for (i = 0; i < n; i++)
+  vtkIdType mPts = vtkTransformAppendTuples(outPts->GetData(), n);
+  vtkIdType mNms = inNms ? vtkTransformAppendTuples(outNms, n) : 0;
+  vtkIdType mVrs = inVrs ? vtkTransformAppendTuples(outVrs, n) : 0;
+  std::vector<vtkIdType> mVrsArr;
+  if (inVrsArr)
   {
-    inPts->GetPoint(i, coord);
-    this->InternalTransformDerivative(coord, coord, matrix);
-    outPts->InsertNextPoint(coord);
-
-    if (inVrs)
+    for (int iArr = 0; iArr < nOptionalVectors; iArr++)
     {
-      inVrs->GetTuple(i, coord);
-      vtkMath::Multiply3x3(matrix, coord, coord);
-      outVrs->InsertNextTuple(coord);
+      mVrsArr.push_back(vtkTransformAppendTuples(outVrsArr[iArr], n));
     }
-    if (inVrsArr)
+  }
+
+  vtkTransformForEachPoint(n, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double matrix[3][3];
+    double coord[3];
+    for (; ptId < endPtId; ++ptId)
     {
-      for (int iArr = 0; iArr < nOptionalVectors; iArr++)
+      inPts->GetPoint(ptId, coord);
+      this->InternalTransformDerivative(coord, coord, matrix);
+      outPts->SetPoint(mPts + ptId, coord);
+
+      if (inVrs)
       {
-        inVrsArr[iArr]->GetTuple(i, coord);
+        inVrs->GetTuple(ptId, coord);
         vtkMath::Multiply3x3(matrix, coord, coord);
-        outVrsArr[iArr]->InsertNextTuple(coord);
+        outVrs->SetTuple(mVrs + ptId, coord);
+      }
+      if (inVrsArr)
+      {
+        for (int iArr = 0; iArr < nOptionalVectors; iArr++)
+        {
+          inVrsArr[iArr]->GetTuple(ptId, coord);
+          vtkMath::Multiply3x3(matrix, coord, coord);
+          outVrsArr[iArr]->SetTuple(mVrsArr[iArr] + ptId, coord);
+        }
+      }
+      if (inNms)
+      {
+        inNms->GetTuple(ptId, coord);
+        vtkMath::Transpose3x3(matrix, matrix);
+        vtkMath::LinearSolve3x3(matrix, coord, coord);
+        vtkMath::Normalize(coord);
+        outNms->SetTuple(mNms + ptId, coord);
       }
     }
-    if (inNms)
-    {
-      inNms->GetTuple(i, coord);
-      vtkMath::Transpose3x3(matrix, matrix);
-      vtkMath::LinearSolve3x3(matrix, coord, coord);
-      vtkMath::Normalize(coord);
-      outNms->InsertNextTuple(coord);
-    }
-  }
+  });
+  outPts->Modified();
 }
 
 //------------------------------------------------------------------------------
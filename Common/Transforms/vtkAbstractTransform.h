@@ -214,13 +214,16 @@ public:
 
   /**
    * Apply the transformation to a series of points, and append the
-   * results to outPts.
+   * results to outPts.  The points are transformed concurrently with
+   * vtkSMPTools, so subclasses that do not override this method must
+   * implement InternalTransformPoint() in a thread safe way.
    */
   virtual void TransformPoints(vtkPoints* inPts, vtkPoints* outPts);
 
   /**
    * Apply the transformation to a combination of points, normals
-   * and vectors.
+   * and vectors.  As in TransformPoints(), the points are transformed
+   * concurrently, calling InternalTransformDerivative().
    */
   virtual void TransformPointsNormalsVectors(vtkPoints* inPts, vtkPoints* outPts,
     vtkDataArray* inNms, vtkDataArray* outNms, vtkDataArray* inVrs, vtkDataArray* outVrs,
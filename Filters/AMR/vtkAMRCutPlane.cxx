@@ -25,11 +25,14 @@
 #include "vtkInformationVector.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOverlappingAMR.h"
 #include "vtkPlane.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -165,13 +168,13 @@ int vtkAMRCutPlane::RequestData(vtkInformation* vtkNotUsed(rqst),
   vtkPlane* cutPlane = this->GetCutPlane(inputAMR);
   assert("pre: cutPlane should not be nullptr!" && (cutPlane != nullptr));
 
-  unsigned int blockIdx = 0;
-  unsigned int level = 0;
+  // STEP 2: Gather the blocks, only those that intersect the plane are cut
+  std::vector<vtkUniformGrid*> grids;
+  std::vector<vtkUniformGrid*> gridsToCut;
   bool abort = false;
-  for (; level < inputAMR->GetNumberOfLevels() && !abort; ++level)
+  for (unsigned int level = 0; level < inputAMR->GetNumberOfLevels() && !abort; ++level)
   {
-    unsigned int dataIdx = 0;
-    for (; dataIdx < inputAMR->GetNumberOfDataSets(level); ++dataIdx)
+    for (unsigned int dataIdx = 0; dataIdx < inputAMR->GetNumberOfDataSets(level); ++dataIdx)
     {
       if (this->CheckAbort())
       {
@@ -179,52 +182,86 @@ int vtkAMRCutPlane::RequestData(vtkInformation* vtkNotUsed(rqst),
         break;
       }
       vtkUniformGrid* grid = inputAMR->GetDataSet(level, dataIdx);
-      if (this->UseNativeCutter == 1)
+      grids.push_back(grid);
+      if (grid != nullptr)
       {
-        if (grid != nullptr)
-        {
-          vtkNew<vtkCutter> myCutter;
-          myCutter->SetInputData(grid);
-          myCutter->SetCutFunction(cutPlane);
-          myCutter->SetContainerAlgorithm(this);
-          myCutter->Update();
-          mbds->SetBlock(blockIdx, myCutter->GetOutput());
-          ++blockIdx;
-        }
-        else
+        double bounds[6];
+        grid->GetBounds(bounds);
+        if (this->PlaneIntersectsAMRBox(cutPlane, bounds))
         {
-          mbds->SetBlock(blockIdx, nullptr);
-          ++blockIdx;
+          gridsToCut.push_back(grid);
         }
       }
+    } // END for all data
+  }   // END for all levels
+
+  // STEP 3: Cut the blocks concurrently, one block per iteration
+  const vtkIdType numberOfCuts = static_cast<vtkIdType>(gridsToCut.size());
+  std::vector<vtkSmartPointer<vtkDataSet>> cuts(numberOfCuts);
+  vtkSMPTools::For(0, numberOfCuts, [&](vtkIdType begin, vtkIdType end) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      if (this->UseNativeCutter == 1)
+      {
+        vtkNew<vtkCutter> myCutter;
+        myCutter->SetInputData(gridsToCut[i]);
+        myCutter->SetCutFunction(cutPlane);
+        myCutter->Update();
+        cuts[i] = myCutter->GetOutput();
+      }
       else
       {
-        if (grid != nullptr)
-        {
-          this->CutAMRBlock(cutPlane, blockIdx, grid, mbds);
-          ++blockIdx;
-        }
-        else
-        {
-          mbds->SetBlock(blockIdx, nullptr);
-          ++blockIdx;
-        }
+        cuts[i] = this->CutAMRBlock(cutPlane, gridsToCut[i]);
       }
-    } // END for all data
-  }   // END for all levels
+    }
+  });
+
+  // STEP 4: Fill the output in the order of the blocks
+  unsigned int blockIdx = 0;
+  vtkIdType cutIdx = 0;
+  for (vtkUniformGrid* grid : grids)
+  {
+    vtkSmartPointer<vtkDataSet> block;
+    if (cutIdx < numberOfCuts && grid == gridsToCut[cutIdx])
+    {
+      block = cuts[cutIdx++];
+    }
+    else if (grid != nullptr)
+    {
+      // The plane misses the block, the cut is empty
+      if (this->UseNativeCutter == 1)
+      {
+        block = vtkSmartPointer<vtkPolyData>::New();
+      }
+      else
+      {
+        block = vtkSmartPointer<vtkUnstructuredGrid>::New();
+      }
+    }
+    mbds->SetBlock(blockIdx, block);
+    ++blockIdx;
+  }
 
   cutPlane->Delete();
   return 1;
 }
 
 //------------------------------------------------------------------------------
-void vtkAMRCutPlane::CutAMRBlock(
-  vtkPlane* cutPlane, unsigned int blockIdx, vtkUniformGrid* grid, vtkMultiBlockDataSet* output)
+vtkSmartPointer<vtkUnstructuredGrid> vtkAMRCutPlane::CutAMRBlock(
+  vtkPlane* cutPlane, vtkUniformGrid* grid)
 {
-  assert("pre: multiblock output object is nullptr!" && (output != nullptr));
   assert("pre: grid is nullptr" && (grid != nullptr));
 
-  vtkUnstructuredGrid* mesh = vtkUnstructuredGrid::New();
+  vtkNew<vtkUnstructuredGrid> mesh;
   vtkPoints* meshPts = vtkPoints::New();
   meshPts->SetDataTypeToDouble();
   vtkCellArray* cells = vtkCellArray::New();
@@ -261,8 +298,8 @@ void vtkAMRCutPlane::CutAMRBlock(
   else
   {
     vtkErrorMacro("Cannot cut a grid of dimension=" << grid->GetDataDimension());
-    output->SetBlock(blockIdx, nullptr);
-    return;
+    cells->Delete();
+    return nullptr;
   }
 
   // Insert the cells
@@ -274,10 +311,7 @@ void vtkAMRCutPlane::CutAMRBlock(
     grid, grdPntMapping, mesh->GetNumberOfPoints(), mesh->GetPointData());
   this->ExtractCellDataFromGrid(grid, extractedCells, mesh->GetCellData());
 
-  output->SetBlock(blockIdx, mesh);
-  mesh->Delete();
-  grdPntMapping.clear();
-  extractedCells.clear();
+  return mesh;
 }
 
 //------------------------------------------------------------------------------
@@ -19,6 +19,9 @@
  *  A concrete instance of vtkMultiBlockDataSet that provides functionality for
  * cutting an AMR dataset (an instance of vtkOverlappingAMR) with user supplied
  * implicit plane function defined by a normal and center.
+ *
+ * The blocks that intersect the plane are cut concurrently with vtkSMPTools,
+ * the other blocks are output as empty datasets without being processed.
  */
 
 #ifndef vtkAMRCutPlane_h
@@ -26,6 +29,7 @@
 
 #include "vtkFiltersAMRModule.h" // For export macro
 #include "vtkMultiBlockDataSetAlgorithm.h"
+#include "vtkSmartPointer.h" // For return value
 
 #include <map>    // For STL map
 #include <vector> // For STL vector
@@ -44,6 +48,7 @@ class vtkPoints;
 class vtkCellArray;
 class vtkPointData;
 class vtkCellData;
+class vtkUnstructuredGrid;
 
 class VTKFILTERSAMR_EXPORT vtkAMRCutPlane : public vtkMultiBlockDataSetAlgorithm
 {
@@ -178,10 +183,11 @@ protected:
   bool IsAMRData2D(vtkOverlappingAMR* input);
 
   /**
-   * Applies cutting to an AMR block
+   * Applies cutting to an AMR block, returns the cells of the grid that
+   * intersect the plane. This method may be called concurrently for
+   * different grids.
    */
-  void CutAMRBlock(
-    vtkPlane* cutPlane, unsigned int blockIdx, vtkUniformGrid* grid, vtkMultiBlockDataSet* dataSet);
+  vtkSmartPointer<vtkUnstructuredGrid> CutAMRBlock(vtkPlane* cutPlane, vtkUniformGrid* grid);
 
   int LevelOfResolution;
   double Center[3];
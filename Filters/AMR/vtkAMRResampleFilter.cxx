@@ -17,7 +17,6 @@
 #include "vtkAMRInformation.h"
 #include "vtkAMRUtilities.h"
 #include "vtkBoundingBox.h"
-#include "vtkCell.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataPipeline.h"
 #include "vtkDataArray.h"
@@ -32,16 +31,15 @@
 #include "vtkObjectFactory.h"
 #include "vtkOverlappingAMR.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUniformGrid.h"
 #include "vtkUniformGridPartitioner.h"
 
-#include "vtkTimerLog.h"
-
 #include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <sstream>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkAMRResampleFilter);
@@ -299,16 +297,13 @@ void vtkAMRResampleFilter::ComputeCellCentroid(vtkUniformGrid* g, vtkIdType cell
   assert("pre: centroid is nullptr" && (c != nullptr));
   assert("pre: cell index out-of-bounds" && (cellIdx >= 0) && (cellIdx < g->GetNumberOfCells()));
 
-  vtkCell* myCell = g->GetCell(cellIdx);
-  assert("post: cell is nullptr!" && (myCell != nullptr));
-
-  double pc[3]; // the parametric center
-  double* weights = new double[myCell->GetNumberOfPoints()];
-  assert("post: weights vector is nullptr" && (weights != nullptr));
-
-  int subId = myCell->GetParametricCenter(pc);
-  myCell->EvaluateLocation(subId, pc, c, weights);
-  delete[] weights;
+  // The cells are axis-aligned boxes, unlike GetCell() this is thread-safe
+  double bounds[6];
+  g->GetCellBounds(cellIdx, bounds);
+  for (int i = 0; i < 3; ++i)
+  {
+    c[i] = 0.5 * (bounds[2 * i] + bounds[2 * i + 1]);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -338,69 +333,60 @@ void vtkAMRResampleFilter::TransferToCellCenters(vtkUniformGrid* g, vtkOverlappi
     return;
   }
 
-  // TODO: this is a very naive implementation and should be optimized. However,
-  // mostly this filter is used to transfer the solution to the grid nodes and
-  // not on the cell nodes.
-  vtkIdType cellIdx = 0;
-  for (; cellIdx < g->GetNumberOfCells(); ++cellIdx)
-  {
-    double qPoint[3];
-    this->ComputeCellCentroid(g, cellIdx, qPoint);
-
-    unsigned int level = 0;
-    for (; level < amrds->GetNumberOfDataSets(level); ++level)
+  // Each cell center takes the solution of the finest loaded grid containing it.
+  const unsigned int numLevels = amrds->GetNumberOfLevels();
+  vtkSMPTools::For(0, g->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+    SearchStatistics stats;
+    for (vtkIdType cellIdx = begin; cellIdx < end; ++cellIdx)
     {
-      unsigned int dataIdx = 0;
-      for (; dataIdx < amrds->GetNumberOfDataSets(level); ++dataIdx)
+      double qPoint[3];
+      this->ComputeCellCentroid(g, cellIdx, qPoint);
+
+      for (unsigned int level = numLevels; level > 0; --level)
       {
+        unsigned int donorGridId = 0;
         int donorCellIdx = -1;
-        vtkUniformGrid* donorGrid = amrds->GetDataSet(level, dataIdx);
-        if ((donorGrid != nullptr) && this->FoundDonor(qPoint, donorGrid, donorCellIdx))
+        if (!this->SearchForDonorGridAtLevel(
+              qPoint, amrds, level - 1, donorGridId, donorCellIdx, stats))
+        {
+          continue;
+        }
+        vtkUniformGrid* donorGrid = amrds->GetDataSet(level - 1, donorGridId);
+        if (donorGrid != nullptr)
         {
           assert("pre: donorCellIdx is invalid" && (donorCellIdx >= 0) &&
             (donorCellIdx < donorGrid->GetNumberOfCells()));
-          CD = donorGrid->GetCellData();
-          this->CopyData(fieldData, cellIdx, CD, donorCellIdx);
-        } // END if
-      }   // END for all datasets
-    }     // END for all levels
-  }       // END for all cells
+          this->CopyData(fieldData, cellIdx, donorGrid->GetCellData(), donorCellIdx);
+          break;
+        }
+      } // END for all levels
+    }   // END for all cells
+  });
 }
 
 //------------------------------------------------------------------------------
 bool vtkAMRResampleFilter::SearchForDonorGridAtLevel(double q[3], vtkOverlappingAMR* amrds,
-  unsigned int level, unsigned int& donorGridId, int& donorCellIdx)
+  unsigned int level, unsigned int& donorGridId, int& donorCellIdx, SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && (amrds != nullptr));
-  this->NumberOfBlocksTestedForLevel = 0;
-  std::ostringstream oss;
-  oss << "SearchLevel-" << level;
+  stats.NumberOfBlocksTestedForLevel = 0;
 
-  vtkTimerLog::MarkStartEvent(oss.str().c_str());
-
-  for (donorGridId = 0; donorGridId < amrds->GetNumberOfDataSets(level); ++donorGridId)
+  // The block locator of the AMR meta-data only tests the grids near q.
+  vtkAMRInformation* amrInfo = amrds->GetAMRInfo();
+  if (!amrInfo->FindGrid(q, static_cast<int>(level), donorGridId))
   {
-    donorCellIdx = -1;
-    this->NumberOfBlocksTestedForLevel++;
-    if (amrds->GetAMRInfo()->FindCell(q, level, donorGridId, donorCellIdx))
-    {
-      assert("pre: donorCellIdx is invalid" && (donorCellIdx >= 0)); //  &&
-      // (donorCellIdx < donorGrid->GetNumberOfCells()) );
-      vtkTimerLog::MarkEndEvent(oss.str().c_str());
-      return true;
-    } // END if
-
-  } // END for all data at level
-
-  // No suitable grid is found at the requested level, set donorGrid to nullptr
-  // to indicate that to the caller.
-  vtkTimerLog::MarkEndEvent(oss.str().c_str());
-  return false;
+    // No suitable grid is found at the requested level
+    return false;
+  }
+  stats.NumberOfBlocksTestedForLevel = 1;
+  donorCellIdx = -1;
+  return amrInfo->FindCell(q, level, donorGridId, donorCellIdx);
 }
 
 //------------------------------------------------------------------------------
 int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLevel,
-  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid)
+  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid,
+  SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && amrds != nullptr);
 
@@ -414,14 +400,14 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
   // STEP 0: Check the previously cached donor-grid
   if (hadDonorGrid)
   {
-    this->NumberOfBlocksTested++;
+    stats.NumberOfBlocksTested++;
     bool res(true);
     if (!amrds->GetAMRInfo()->FindCell(q, donorLevel, donorGridId, donorCellIdx))
     {
       // Lets see if the point is contained by a grid at the same donar level
-      res = this->SearchForDonorGridAtLevel(q, amrds, donorLevel, donorGridId, donorCellIdx);
+      res = this->SearchForDonorGridAtLevel(q, amrds, donorLevel, donorGridId, donorCellIdx, stats);
       donorGrid = res ? amrds->GetDataSet(donorLevel, donorGridId) : nullptr;
-      this->NumberOfBlocksTested += this->NumberOfBlocksTestedForLevel;
+      stats.NumberOfBlocksTested += stats.NumberOfBlocksTestedForLevel;
     }
 
     // If donorGrid is still not nullptr then we found the grid and potential starting
@@ -431,7 +417,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
       assert("pre: donorCellIdx is invalid" && (donorCellIdx >= 0) &&
         (donorCellIdx < donorGrid->GetNumberOfCells()));
 
-      this->NumberOfTimesFoundOnDonorLevel++;
+      stats.NumberOfTimesFoundOnDonorLevel++;
 
       // Initialize values for step 1 s.t. that the search will start from the
       // current donorLevel
@@ -445,7 +431,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
     {
       // if we are here then the point is not contained in any of the level 0
       // blocks!
-      this->NumberOfFailedPoints++;
+      stats.NumberOfFailedPoints++;
       donorGrid = nullptr;
       donorLevel = 0;
       return -1;
@@ -485,16 +471,17 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
   {
     if (incLevel == 1)
     {
-      this->NumberOfTimesLevelUp++;
+      stats.NumberOfTimesLevelUp++;
     }
     else
     {
-      this->NumberOfTimesLevelDown++;
+      stats.NumberOfTimesLevelDown++;
     }
-    bool res = this->SearchForDonorGridAtLevel(q, amrds, level, donorGridId, donorCellIdx);
+    bool res =
+      this->SearchForDonorGridAtLevel(q, amrds, level, donorGridId, donorCellIdx, stats);
     donorGrid = res ? amrds->GetDataSet(level, donorGridId) : nullptr;
 
-    this->NumberOfBlocksTested += this->NumberOfBlocksTestedForLevel;
+    stats.NumberOfBlocksTested += stats.NumberOfBlocksTestedForLevel;
     if (res)
     {
       donorLevel = level;
@@ -525,7 +512,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
       // resolution, so we will use the solution we found previously
       // THIS SHOULD NOW NOT HAPPEN!!
       // vtkErrorMacro("Could not find point in an unblanked cell.");
-      this->NumberOfBlocksVisSkipped += this->NumberOfBlocksTestedForLevel;
+      stats.NumberOfBlocksVisSkipped += stats.NumberOfBlocksTestedForLevel;
       donorGrid = currentGrid;
       donorCellIdx = currentCellIdx;
       donorLevel = currentLevel;
@@ -537,7 +524,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
     {
       // we are not able to find a grid/cell that contains the query point, in
       // this case we will just return.
-      this->NumberOfFailedPoints++;
+      stats.NumberOfFailedPoints++;
       donorCellIdx = -1;
       donorGrid = nullptr;
       donorLevel = 0;
@@ -549,14 +536,14 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
 }
 
 //------------------------------------------------------------------------------
-bool vtkAMRResampleFilter::SearchGridAncestors(
-  double q[3], vtkOverlappingAMR* amrds, unsigned int& level, unsigned int& gridId, int& cellId)
+bool vtkAMRResampleFilter::SearchGridAncestors(double q[3], vtkOverlappingAMR* amrds,
+  unsigned int& level, unsigned int& gridId, int& cellId, SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && (amrds != nullptr));
   unsigned int *parents, plevel;
   for (; level > 0; --level)
   {
-    ++this->NumberOfTimesLevelUp;
+    ++stats.NumberOfTimesLevelUp;
     // Get the parents of the grid
 
     unsigned int numParents;
@@ -582,7 +569,8 @@ bool vtkAMRResampleFilter::SearchGridAncestors(
 
 //------------------------------------------------------------------------------
 void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR* amrds,
-  unsigned int maxLevel, unsigned int& level, unsigned int& gridId, int& cellId)
+  unsigned int maxLevel, unsigned int& level, unsigned int& gridId, int& cellId,
+  SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && (amrds != nullptr));
   unsigned int *children, clevel, n, i;
@@ -605,7 +593,7 @@ void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR*
         // children and can instead search that grid's
         // children
         gridId = children[i];
-        ++this->NumberOfTimesLevelDown;
+        ++stats.NumberOfTimesLevelDown;
         break;
       }
     }
@@ -613,7 +601,7 @@ void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR*
     {
       // We tested some children that we didn't need to if
       // we had visibility info
-      this->NumberOfBlocksVisSkipped += n;
+      stats.NumberOfBlocksVisSkipped += n;
       // If we are here then no child contains the point
       // so don't search any further
       return;
@@ -623,7 +611,8 @@ void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR*
 
 //------------------------------------------------------------------------------
 int vtkAMRResampleFilter::ProbeGridPointInAMRGraph(double q[3], unsigned int& donorLevel,
-  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached)
+  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached,
+  SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && amrds != nullptr);
 
@@ -636,13 +625,13 @@ int vtkAMRResampleFilter::ProbeGridPointInAMRGraph(double q[3], unsigned int& do
     if (!amrds->GetAMRInfo()->FindCell(q, donorLevel, donorGridId, donorCellIdx))
     {
       // Lets find the grid's ancestor that contains the point
-      bool res = this->SearchGridAncestors(q, amrds, donorLevel, donorGridId, donorCellIdx);
+      bool res = this->SearchGridAncestors(q, amrds, donorLevel, donorGridId, donorCellIdx, stats);
       donorGrid = res ? amrds->GetDataSet(donorLevel, donorGridId) : nullptr;
     }
     else
     {
       donorGrid = amrds->GetDataSet(donorLevel, donorGridId);
-      ++this->NumberOfTimesFoundOnDonorLevel;
+      ++stats.NumberOfTimesFoundOnDonorLevel;
     }
     // if the point is not contained in an ancestor then lets just assume its on level
     // 0 which is the default
@@ -651,19 +640,19 @@ int vtkAMRResampleFilter::ProbeGridPointInAMRGraph(double q[3], unsigned int& do
   // If there is no initial donor grid then search level 0
   if (donorGrid == nullptr)
   {
-    bool res = SearchForDonorGridAtLevel(q, amrds, 0, donorGridId, donorCellIdx);
+    bool res = this->SearchForDonorGridAtLevel(q, amrds, 0, donorGridId, donorCellIdx, stats);
     // If we still can't find a grid then the point is not contained in the
     // AMR Data
     if (!res)
     {
-      this->NumberOfFailedPoints++;
+      stats.NumberOfFailedPoints++;
       donorLevel = 0;
       return -1;
     }
   }
 
   // Now search the descendants of the donor grid
-  this->SearchGridDecendants(q, amrds, maxLevel, donorLevel, donorGridId, donorCellIdx);
+  this->SearchGridDecendants(q, amrds, maxLevel, donorLevel, donorGridId, donorCellIdx, stats);
   return (donorCellIdx);
 }
 
@@ -711,63 +700,66 @@ void vtkAMRResampleFilter::TransferToGridNodes(vtkUniformGrid* g, vtkOverlapping
     maxLevelToLoad = amrds->GetNumberOfLevels();
   }
 
-  // STEP 3: Loop through all the points and find the donors.
-  unsigned int donorLevel = 0;
-  unsigned int donorGridId = 0;
-  double qPoint[3];
-  vtkIdType pIdx;
-  int donorCellIdx;
-  bool useCached(false);
-  // Do we have parent/child meta information (yes, we always do)
-  if (this->AMRMetaData)
-  {
-    for (pIdx = 0; pIdx < g->GetNumberOfPoints(); ++pIdx)
-    {
-      g->GetPoint(pIdx, qPoint);
-      donorCellIdx = this->ProbeGridPointInAMRGraph(
-        qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached);
-      if (donorCellIdx != -1)
-      {
-        useCached = true;
-        vtkUniformGrid* amrGrid = amrds->GetDataSet(donorLevel, donorGridId);
-        this->AverageLevel += donorLevel;
-        CD = amrGrid->GetCellData();
-        this->CopyData(PD, pIdx, CD, donorCellIdx);
-      }
-      else
-      {
-        useCached = false;
-        // Point is outside the domain, blank it
-        g->BlankPoint(pIdx);
-      }
-    } // END for all grid nodes
-  }
-  else
+  // STEP 3: Loop through all the points and find the donors. Each thread
+  // starts the search of a point from the donor of its previous point.
+  struct LocalProbe
   {
-    for (pIdx = 0; pIdx < g->GetNumberOfPoints(); ++pIdx)
+    SearchStatistics Statistics;
+    double LevelSum = 0.0;
+    std::vector<vtkIdType> PointsToBlank;
+  };
+  vtkSMPThreadLocal<LocalProbe> localProbes;
+  vtkSMPTools::For(0, g->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+    LocalProbe& probe = localProbes.Local();
+    unsigned int donorLevel = 0;
+    unsigned int donorGridId = 0;
+    bool useCached(false);
+    for (vtkIdType pIdx = begin; pIdx < end; ++pIdx)
     {
+      double qPoint[3];
       g->GetPoint(pIdx, qPoint);
 
-      donorCellIdx = this->ProbeGridPointInAMR(
-        qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached);
+      // Do we have parent/child meta information (yes, we always do)
+      int donorCellIdx = this->AMRMetaData
+        ? this->ProbeGridPointInAMRGraph(
+            qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached, probe.Statistics)
+        : this->ProbeGridPointInAMR(
+            qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached, probe.Statistics);
 
       if (donorCellIdx != -1)
       {
         useCached = true;
-        this->AverageLevel += donorLevel;
+        probe.LevelSum += donorLevel;
         vtkUniformGrid* donorGrid = amrds->GetDataSet(donorLevel, donorGridId);
         assert(donorGrid != nullptr);
-        CD = donorGrid->GetCellData();
-        this->CopyData(PD, pIdx, CD, donorCellIdx);
+        this->CopyData(PD, pIdx, donorGrid->GetCellData(), donorCellIdx);
       }
       else
       {
         useCached = false;
-        // Point is outside the domain, blank it
-        g->BlankPoint(pIdx);
+        // Point is outside the domain, it is blanked below
+        probe.PointsToBlank.push_back(pIdx);
       }
     } // END for all grid nodes
+  });
+
+  // Blanking allocates the ghost array on demand, so it is done serially.
+  for (LocalProbe& probe : localProbes)
+  {
+    for (vtkIdType pIdx : probe.PointsToBlank)
+    {
+      g->BlankPoint(pIdx);
+    }
+    const SearchStatistics& stats = probe.Statistics;
+    this->NumberOfBlocksTested += stats.NumberOfBlocksTested;
+    this->NumberOfBlocksVisSkipped += stats.NumberOfBlocksVisSkipped;
+    this->NumberOfTimesFoundOnDonorLevel += stats.NumberOfTimesFoundOnDonorLevel;
+    this->NumberOfTimesLevelUp += stats.NumberOfTimesLevelUp;
+    this->NumberOfTimesLevelDown += stats.NumberOfTimesLevelDown;
+    this->NumberOfFailedPoints += stats.NumberOfFailedPoints;
+    this->AverageLevel += probe.LevelSum;
   }
+
   std::cerr << "********* Resample Stats *************\n";
   double c = this->NumberOfSamples[0] * this->NumberOfSamples[1] * this->NumberOfSamples[2];
   double b = g->GetNumberOfPoints();
@@ -797,6 +789,13 @@ void vtkAMRResampleFilter::TransferSolution(vtkUniformGrid* g, vtkOverlappingAMR
   assert("pre: uniform grid is nullptr" && (g != nullptr));
   assert("pre: AMR data-structure is nullptr" && (amrds != nullptr));
 
+  // The grids are probed concurrently, the index of the loaded blocks that
+  // GetDataSet() generates on its first call has to be built beforehand.
+  if (amrds->GetNumberOfLevels() > 0 && amrds->GetNumberOfDataSets(0) > 0)
+  {
+    amrds->GetDataSet(0, 0);
+  }
+
   if (this->TransferToNodes == 1)
   {
     this->TransferToGridNodes(g, amrds);
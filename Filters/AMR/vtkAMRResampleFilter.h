@@ -23,6 +23,10 @@
  *  number of blocks correspond to the number of processors utilized for the
  *  operation.
  *
+ *  The points, or the cells, of the uniform grid are probed concurrently with
+ *  vtkSMPTools, searching the AMR grids of each level with the block locator
+ *  of vtkAMRInformation.
+ *
  * @warning
  *  Data of the input AMR dataset is assumed to be cell-centered.
  *
@@ -172,7 +176,6 @@ protected:
   double BiasVector[3];
 
   // Debugging Stuff
-  int NumberOfBlocksTestedForLevel;
   int NumberOfBlocksTested;
   int NumberOfBlocksVisSkipped;
   int NumberOfTimesFoundOnDonorLevel;
@@ -183,6 +186,21 @@ protected:
 
   std::vector<int> BlocksToLoad; // Holds the ids of the blocks to load.
 
+  /**
+   * Counters of the donor searches, which are accumulated by each thread and
+   * added to the debugging counters above once the solution is transferred.
+   */
+  struct SearchStatistics
+  {
+    int NumberOfBlocksTestedForLevel = 0;
+    int NumberOfBlocksTested = 0;
+    int NumberOfBlocksVisSkipped = 0;
+    int NumberOfTimesFoundOnDonorLevel = 0;
+    int NumberOfTimesLevelUp = 0;
+    int NumberOfTimesLevelDown = 0;
+    int NumberOfFailedPoints = 0;
+  };
+
   /**
    * Checks if this filter instance is running on more than one processes
    */
@@ -230,7 +248,7 @@ protected:
    * is not found, donorGrid is set to nullptr.
    */
   bool SearchForDonorGridAtLevel(double q[3], vtkOverlappingAMR* amrds, unsigned int level,
-    unsigned int& gridId, int& donorCellIdx);
+    unsigned int& gridId, int& donorCellIdx, SearchStatistics& stats);
 
   /**
    * Finds the AMR grid that contains the point q. If donorGrid points to a
@@ -239,7 +257,7 @@ protected:
    * contains the probe point q.
    */
   int ProbeGridPointInAMR(double q[3], unsigned int& donorLevel, unsigned int& donorGridId,
-    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid);
+    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid, SearchStatistics& stats);
 
   /**
    * Finds the AMR grid that contains the point q. If donorGrid points to a
@@ -248,7 +266,7 @@ protected:
    * contains the probe point q. - Makes use of Parent/Child Info
    */
   int ProbeGridPointInAMRGraph(double q[3], unsigned int& donorLevel, unsigned int& donorGridId,
-    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached);
+    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached, SearchStatistics& stats);
 
   /**
    * Transfers the solution from the AMR dataset to the cell-centers of
@@ -362,14 +380,14 @@ protected:
    * The search is limited to levels < maxLevel
    */
   void SearchGridDecendants(double q[3], vtkOverlappingAMR* amrds, unsigned int maxLevel,
-    unsigned int& level, unsigned int& gridId, int& id);
+    unsigned int& level, unsigned int& gridId, int& id, SearchStatistics& stats);
 
   /**
    * Find an ancestor of the specified grid that contains the point.
    * If none is found then the original grid information is returned
    */
-  bool SearchGridAncestors(
-    double q[3], vtkOverlappingAMR* amrds, unsigned int& level, unsigned int& gridId, int& id);
+  bool SearchGridAncestors(double q[3], vtkOverlappingAMR* amrds, unsigned int& level,
+    unsigned int& gridId, int& id, SearchStatistics& stats);
 
 private:
   vtkAMRResampleFilter(const vtkAMRResampleFilter&) = delete;
@@ -15,7 +15,6 @@
 
 #include "vtkAMRSliceFilter.h"
 #include "vtkAMRBox.h"
-#include "vtkCell.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataPipeline.h"
 #include "vtkDataArray.h"
@@ -30,6 +29,7 @@
 #include "vtkParallelAMRUtilities.h"
 #include "vtkPlane.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredData.h"
@@ -331,52 +331,74 @@ void vtkAMRSliceFilter::GetAMRSliceInPlane(
   out->SetOrigin(p->GetOrigin());
   vtkTimerLog::MarkStartEvent("AMRSlice::GetAMRSliceInPlane");
 
-  std::vector<int> dataIndices(out->GetNumberOfLevels(), 0);
-  for (unsigned int i = 0; i < this->BlocksToLoad.size(); i++)
+  // The blocks are sliced concurrently, each thread slicing whole blocks, and
+  // the slices are then added to the output in order.
+  const vtkIdType numBlocks = static_cast<vtkIdType>(this->BlocksToLoad.size());
+  std::vector<unsigned int> levels(numBlocks);
+  std::vector<unsigned int> dataIndices(numBlocks);
+  std::vector<vtkUniformGrid*> grids(numBlocks);
+  for (vtkIdType i = 0; i < numBlocks; i++)
   {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-    int flatIndex = this->BlocksToLoad[i];
-    unsigned int level;
-    unsigned int dataIdx;
-    inp->GetLevelAndIndex(flatIndex, level, dataIdx);
-    vtkUniformGrid* grid = inp->GetDataSet(level, dataIdx);
-    vtkUniformGrid* slice = nullptr;
+    inp->GetLevelAndIndex(this->BlocksToLoad[i], levels[i], dataIndices[i]);
+    grids[i] = inp->GetDataSet(levels[i], dataIndices[i]);
+  }
 
-    if (grid)
-    {
-      // Get the 3-D Grid dimensions
-      int dims[3];
-      grid->GetDimensions(dims);
-      slice = this->GetSlice(p->GetOrigin(), dims, grid->GetOrigin(), grid->GetSpacing());
-      assert("Dimension of slice must be 2-D" && (slice->GetDataDimension() == 2));
-      assert("2-D slice is nullptr" && (slice != nullptr));
-      this->GetSliceCellData(slice, grid);
-      this->GetSlicePointData(slice, grid);
-    }
-    else
+  double* sliceOrigin = p->GetOrigin();
+  std::vector<vtkSmartPointer<vtkUniformGrid>> slices(numBlocks);
+  vtkSMPTools::For(0, numBlocks, [&](vtkIdType begin, vtkIdType end) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType i = begin; i < end; i++)
     {
-      int dims[3];
-      double spacing[3];
-      double origin[3];
-      inp->GetSpacing(level, spacing);
-      inp->GetAMRBox(level, dataIdx).GetNumberOfNodes(dims);
-      inp->GetOrigin(level, dataIdx, origin);
-      slice = this->GetSlice(p->GetOrigin(), dims, origin, spacing);
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      vtkUniformGrid* grid = grids[i];
+      vtkSmartPointer<vtkUniformGrid> slice;
+      if (grid)
+      {
+        // Get the 3-D Grid dimensions
+        int dims[3];
+        grid->GetDimensions(dims);
+        slice.TakeReference(
+          this->GetSlice(sliceOrigin, dims, grid->GetOrigin(), grid->GetSpacing()));
+        assert("2-D slice is nullptr" && (slice != nullptr));
+        assert("Dimension of slice must be 2-D" && (slice->GetDataDimension() == 2));
+        this->GetSliceCellData(slice, grid);
+        this->GetSlicePointData(slice, grid);
+      }
+      else
+      {
+        int dims[3];
+        double spacing[3];
+        double origin[3];
+        inp->GetSpacing(levels[i], spacing);
+        inp->GetAMRBox(levels[i], dataIndices[i]).GetNumberOfNodes(dims);
+        inp->GetOrigin(levels[i], dataIndices[i], origin);
+        slice.TakeReference(this->GetSlice(sliceOrigin, dims, origin, spacing));
+      }
+      slices[i] = slice;
     }
+  });
 
+  std::vector<int> outIndices(out->GetNumberOfLevels(), 0);
+  for (vtkIdType i = 0; i < numBlocks && slices[i]; i++)
+  {
+    unsigned int level = levels[i];
+    vtkUniformGrid* slice = slices[i];
     vtkAMRBox box(slice->GetOrigin(), slice->GetDimensions(), slice->GetSpacing(), out->GetOrigin(),
       out->GetGridDescription());
     out->SetSpacing(level, slice->GetSpacing());
-    out->SetAMRBox(level, dataIndices[level], box);
-    if (grid)
+    out->SetAMRBox(level, outIndices[level], box);
+    if (grids[i])
     {
-      out->SetDataSet(level, dataIndices[level], slice);
+      out->SetDataSet(level, outIndices[level], slice);
     }
-    slice->Delete();
-    dataIndices[level]++;
+    outIndices[level]++;
   }
 
   vtkTimerLog::MarkEndEvent("AMRSlice::GetAMRSliceInPlane");
@@ -398,13 +420,13 @@ void vtkAMRSliceFilter::ComputeCellCenter(vtkUniformGrid* ug, int cellIdx, doubl
   assert(
     "pre: cell index out-of-bounds!" && ((cellIdx >= 0) && (cellIdx < ug->GetNumberOfCells())));
 
-  vtkCell* myCell = ug->GetCell(cellIdx);
-  assert("post: cell is nullptr" && (myCell != nullptr));
-
-  double pCenter[3];
-  double weights[8];
-  int subId = myCell->GetParametricCenter(pCenter);
-  myCell->EvaluateLocation(subId, pCenter, centroid, weights);
+  // The cells are axis-aligned, their center is the center of their bounds
+  double bounds[6];
+  ug->GetCellBounds(cellIdx, bounds);
+  for (int i = 0; i < 3; ++i)
+  {
+    centroid[i] = 0.5 * (bounds[2 * i] + bounds[2 * i + 1]);
+  }
 }
 
 //------------------------------------------------------------------------------
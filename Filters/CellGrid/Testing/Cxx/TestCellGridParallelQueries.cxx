@@ -0,0 +1,158 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCellGridParallelQueries.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkCellAttribute.h"
+#include "vtkCellGrid.h"
+#include "vtkCellGridBoundsQuery.h"
+#include "vtkCellGridComputeSurface.h"
+#include "vtkCellGridResponders.h"
+#include "vtkCellGridSidesQuery.h"
+#include "vtkDGBoundsResponder.h"
+#include "vtkDGHex.h"
+#include "vtkDGSidesResponder.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkTypeInt64Array.h"
+
+#include <array>
+
+namespace
+{
+
+// Build a grid of n x n x n unit hexahedra, with enough cells for the
+// responders to process them in several ranges.
+vtkSmartPointer<vtkCellGrid> CreateHexahedra(int n)
+{
+  auto grid = vtkSmartPointer<vtkCellGrid>::New();
+  auto cell = vtkCellMetadata::NewInstance<vtkDGHex>(grid);
+
+  vtkNew<vtkDoubleArray> coords;
+  coords->SetName("points");
+  coords->SetNumberOfComponents(3);
+  coords->SetNumberOfTuples((n + 1) * (n + 1) * (n + 1));
+  vtkIdType pointId = 0;
+  for (int kk = 0; kk <= n; ++kk)
+  {
+    for (int jj = 0; jj <= n; ++jj)
+    {
+      for (int ii = 0; ii <= n; ++ii)
+      {
+        coords->SetTuple3(pointId++, ii, jj, kk);
+      }
+    }
+  }
+  auto* coordsGroup = grid->GetAttributes(vtkStringToken("coordinates"));
+  coordsGroup->AddArray(coords);
+  coordsGroup->SetVectors(coords);
+
+  vtkNew<vtkTypeInt64Array> conn;
+  conn->SetName("conn");
+  conn->SetNumberOfComponents(8);
+  conn->SetNumberOfTuples(n * n * n);
+  vtkIdType cellId = 0;
+  std::array<vtkTypeInt64, 8> entry;
+  for (int kk = 0; kk < n; ++kk)
+  {
+    for (int jj = 0; jj < n; ++jj)
+    {
+      for (int ii = 0; ii < n; ++ii)
+      {
+        for (int corner = 0; corner < 8; ++corner)
+        {
+          // Reference coordinates are in [-1, 1].
+          const auto& param = cell->GetCornerParameter(corner);
+          int di = param[0] > 0 ? 1 : 0;
+          int dj = param[1] > 0 ? 1 : 0;
+          int dk = param[2] > 0 ? 1 : 0;
+          entry[corner] = (ii + di) + (n + 1) * ((jj + dj) + (n + 1) * (kk + dk));
+        }
+        conn->SetTypedTuple(cellId++, entry.data());
+      }
+    }
+  }
+  grid->GetAttributes(vtkStringToken("DGHex"))->AddArray(conn);
+
+  vtkNew<vtkCellAttribute> shape;
+  shape->Initialize(
+    vtkStringToken("shape"), vtkStringToken("DG HGRAD C1"), vtkStringToken("ℝ³"), 3);
+  vtkCellAttribute::ArraysForCellType arrays;
+  arrays[vtkStringToken("DGHex")] = conn;
+  arrays[vtkStringToken("coordinates")] = coords;
+  shape->SetArraysForCellType(vtkStringToken("DGHex"), arrays);
+  grid->AddCellAttribute(shape);
+  grid->SetShapeAttribute(shape);
+  return grid;
+}
+
+} // anonymous namespace
+
+int TestCellGridParallelQueries(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  vtkCellMetadata::RegisterType<vtkDGHex>();
+  vtkNew<vtkDGBoundsResponder> boundsResponder;
+  vtkNew<vtkDGSidesResponder> sidesResponder;
+  vtkCellMetadata::GetResponders()->RegisterQueryResponder<vtkDGHex, vtkCellGridBoundsQuery>(
+    boundsResponder.GetPointer());
+  vtkCellMetadata::GetResponders()->RegisterQueryResponder<vtkDGHex, vtkCellGridSidesQuery>(
+    sidesResponder.GetPointer());
+
+  const int n = 20;
+  auto grid = CreateHexahedra(n);
+
+  // Check the results of the serial and threaded backends.
+  const char* backends[] = { "Sequential", "STDThread" };
+  for (const char* backend : backends)
+  {
+    if (!vtkSMPTools::SetBackend(backend))
+    {
+      continue;
+    }
+    vtkSMPTools::Initialize(4);
+    std::cout << "Backend " << vtkSMPTools::GetBackend() << "\n";
+
+    vtkNew<vtkCellGridBoundsQuery> boundsQuery;
+    if (!grid->Query(boundsQuery))
+    {
+      std::cerr << "ERROR: Bounds query failed.\n";
+      return EXIT_FAILURE;
+    }
+    std::array<double, 6> bounds;
+    boundsQuery->GetBounds(bounds.data());
+    if (bounds != std::array<double, 6>{ 0., 1. * n, 0., 1. * n, 0., 1. * n })
+    {
+      std::cerr << "ERROR: Bad bounds " << bounds[0] << " " << bounds[1] << ", " << bounds[2]
+                << " " << bounds[3] << ", " << bounds[4] << " " << bounds[5] << "\n";
+      return EXIT_FAILURE;
+    }
+
+    vtkNew<vtkCellGridComputeSurface> extractSurface;
+    extractSurface->SetInputDataObject(grid);
+    extractSurface->Update();
+    auto* output = vtkCellGrid::SafeDownCast(extractSurface->GetOutputDataObject(0));
+    auto* sides = vtkIdTypeArray::SafeDownCast(
+      output->GetAttributes(vtkStringToken("quadrilateral sides of DGHex"))->GetScalars());
+    if (!sides || sides->GetNumberOfTuples() != 6 * n * n)
+    {
+      std::cerr << "ERROR: Expected " << 6 * n * n << " sides, got "
+                << (sides ? sides->GetNumberOfTuples() : -1) << ".\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
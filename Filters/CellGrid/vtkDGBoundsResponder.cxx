@@ -24,7 +24,7 @@
 #include "vtkStringToken.h"
 #include "vtkTypeInt64Array.h"
 
-#include <unordered_set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 
@@ -53,38 +53,34 @@ bool vtkDGBoundsResponder::Query(
   {
     return false;
   }
-  std::unordered_set<std::int64_t> pointIDs;
-  int nc = conn->GetNumberOfComponents();
-  std::vector<vtkTypeInt64> entry;
-  entry.resize(nc);
-  for (vtkIdType ii = 0; ii < conn->GetNumberOfTuples(); ++ii)
-  {
-    conn->GetTypedTuple(ii, &entry[0]);
-    for (int jj = 0; jj < nc; ++jj)
-    {
-      pointIDs.insert(entry[jj]);
-    }
-  }
-  if (pts->GetNumberOfTuples() > 0)
+  if (pts->GetNumberOfTuples() == 0)
   {
-    std::vector<double> pcoord;
-    int dim = pts->GetNumberOfComponents();
-    pcoord.resize(dim);
-
-    // Initialize the bounds:
-    vtkBoundingBox bbox;
-    pts->GetTuple(
-      0, &pcoord[0]); // TODO: Check isnan/isinf() on each component and iterate if true.
-    bbox.SetMinPoint(&pcoord[0]);
-    bbox.SetMaxPoint(&pcoord[0]);
-
-    for (const auto& pointID : pointIDs)
-    {
-      pts->GetTuple(pointID, &pcoord[0]);
-      bbox.AddPoint(&pcoord[0]);
-    }
-    query->AddBounds(bbox);
+    return true;
   }
+  int nc = conn->GetNumberOfComponents();
+  int dim = pts->GetNumberOfComponents();
+  // Points shared by cells are added to the bounds once per cell, which is
+  // cheaper than collecting the unique points first.
+  this->ForEachCellRange(query, conn->GetNumberOfTuples(),
+    [&](vtkCellGridBoundsQuery* localQuery, vtkIdType begin, vtkIdType end) {
+      std::vector<vtkTypeInt64> entry(nc);
+      double pcoord[3] = { 0.0, 0.0, 0.0 };
+      vtkBoundingBox bbox;
+      for (vtkIdType ii = begin; ii < end; ++ii)
+      {
+        conn->GetTypedTuple(ii, entry.data());
+        for (int jj = 0; jj < nc; ++jj)
+        {
+          // TODO: Check isnan/isinf() on each component and skip if true.
+          for (int kk = 0; kk < dim && kk < 3; ++kk)
+          {
+            pcoord[kk] = pts->GetComponent(entry[jj], kk);
+          }
+          bbox.AddPoint(pcoord);
+        }
+      }
+      localQuery->AddBounds(bbox);
+    });
   return true;
 }
 
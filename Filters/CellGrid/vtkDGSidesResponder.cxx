@@ -24,7 +24,7 @@
 #include "vtkStringToken.h"
 #include "vtkTypeInt64Array.h"
 
-#include <unordered_set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 
@@ -46,43 +46,44 @@ bool vtkDGSidesResponder::Query(
   {
     return false;
   }
-  std::unordered_set<std::int64_t> pointIDs;
   int nc = conn->GetNumberOfComponents();
   int minSideDim = dgCellType->GetDimension() - 1; // We only care about sides of dimension d-1.
   int numSideTypes = dgCellType->GetNumberOfSideTypes();
-  std::vector<vtkTypeInt64> entry;
-  std::vector<vtkIdType> side;
-  entry.resize(nc);
   // Loop over elements, one per tuple of conn:
-  for (vtkIdType ii = 0; ii < conn->GetNumberOfTuples(); ++ii)
-  {
-    conn->GetTypedTuple(ii, &entry[0]);
-    // Loop over types of side (one entry per shape) of the element:
-    for (int sideType = 0; sideType < numSideTypes; ++sideType)
-    {
-      auto range = dgCellType->GetSideRangeForType(sideType);
-      auto shape = dgCellType->GetSideShape(range.first);
-      // Only hash sides of dimension d-1
-      if (vtkDGCell::GetShapeDimension(shape) < minSideDim)
-      {
-        break;
-      }
-      auto shapeName = vtkDGCell::GetShapeName(shape);
-      // Loop over sides of the given type:
-      for (int sideIdx = range.first; sideIdx < range.second; ++sideIdx)
+  this->ForEachCellRange(query, conn->GetNumberOfTuples(),
+    [&](vtkCellGridSidesQuery* localQuery, vtkIdType begin, vtkIdType end) {
+      std::vector<vtkTypeInt64> entry(nc);
+      std::vector<vtkIdType> side;
+      for (vtkIdType ii = begin; ii < end; ++ii)
       {
-        const auto& sideConn = dgCellType->GetSideConnectivity(sideIdx);
-        side.resize(sideConn.size());
-        int jj = 0;
-        for (const auto& sidePointIndex : sideConn)
+        conn->GetTypedTuple(ii, entry.data());
+        // Loop over types of side (one entry per shape) of the element:
+        for (int sideType = 0; sideType < numSideTypes; ++sideType)
         {
-          side[jj++] = entry[sidePointIndex];
+          auto range = dgCellType->GetSideRangeForType(sideType);
+          auto shape = dgCellType->GetSideShape(range.first);
+          // Only hash sides of dimension d-1
+          if (vtkDGCell::GetShapeDimension(shape) < minSideDim)
+          {
+            break;
+          }
+          auto shapeName = vtkDGCell::GetShapeName(shape);
+          // Loop over sides of the given type:
+          for (int sideIdx = range.first; sideIdx < range.second; ++sideIdx)
+          {
+            const auto& sideConn = dgCellType->GetSideConnectivity(sideIdx);
+            side.resize(sideConn.size());
+            int jj = 0;
+            for (const auto& sidePointIndex : sideConn)
+            {
+              side[jj++] = entry[sidePointIndex];
+            }
+            // Hash the sideIdx'th side of element ii and add it to the local query's storage.
+            localQuery->AddSide(cellAttrName, ii, sideIdx, shapeName, side);
+          }
         }
-        // Hash the sideIdx'th side of element ii and add it to the query's storage.
-        query->AddSide(cellAttrName, ii, sideIdx, shapeName, side);
       }
-    }
-  }
+    });
   return true;
 }
 
@@ -0,0 +1,196 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestAppendImplicitArrays.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkAppendPolyData and vtkAppendFilter give the same output with
+// and without implicit arrays, and that the appended arrays are not copied
+// when implicit arrays are used.
+
+#include "vtkAppendFilter.h"
+#include "vtkAppendPolyData.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCompositeArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> MakeStrip(int numberOfTriangles, float offset)
+{
+  vtkNew<vtkPolyData> strip;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkFloatArray> normals;
+  normals->SetNumberOfComponents(3);
+  for (int i = 0; i < numberOfTriangles + 2; ++i)
+  {
+    points->InsertNextPoint(offset + i, i % 2, 0.0);
+    scalars->InsertNextValue(offset + i);
+    normals->InsertNextTuple3(0.0, 0.0, 1.0);
+  }
+  strip->SetPoints(points);
+  strip->GetPointData()->SetScalars(scalars);
+  strip->GetPointData()->SetNormals(normals);
+
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  for (vtkIdType i = 0; i < numberOfTriangles; ++i)
+  {
+    const vtkIdType triangle[3] = { i, i + 1, i + 2 };
+    polys->InsertNextCell(3, triangle);
+    cellIds->InsertNextValue(static_cast<int>(offset) + i);
+  }
+  strip->SetPolys(polys);
+  strip->GetCellData()->AddArray(cellIds);
+  return strip;
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameOutputs(vtkPointSet* a, vtkPointSet* b)
+{
+  if (a->GetNumberOfCells() != b->GetNumberOfCells() ||
+    !SameArrays(a->GetPoints()->GetData(), b->GetPoints()->GetData()))
+  {
+    std::cerr << "Different points or number of cells" << std::endl;
+    return false;
+  }
+  vtkNew<vtkIdList> cellA;
+  vtkNew<vtkIdList> cellB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellPoints(cellId, cellA);
+    b->GetCellPoints(cellId, cellB);
+    bool same = cellA->GetNumberOfIds() == cellB->GetNumberOfIds();
+    for (vtkIdType i = 0; same && i < cellA->GetNumberOfIds(); ++i)
+    {
+      same = cellA->GetId(i) == cellB->GetId(i);
+    }
+    if (!same)
+    {
+      std::cerr << "Cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+  }
+  if (!SameArrays(a->GetPointData()->GetScalars(), b->GetPointData()->GetScalars()) ||
+    !SameArrays(a->GetPointData()->GetNormals(), b->GetPointData()->GetNormals()) ||
+    !SameArrays(a->GetCellData()->GetArray("CellIds"), b->GetCellData()->GetArray("CellIds")))
+  {
+    std::cerr << "Different arrays" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool IsConcatenated(vtkPointSet* output)
+{
+  return vtkCompositeArray<float>::SafeDownCast(output->GetPoints()->GetData()) &&
+    vtkCompositeArray<float>::SafeDownCast(output->GetPointData()->GetScalars()) &&
+    vtkCompositeArray<float>::SafeDownCast(output->GetPointData()->GetNormals()) &&
+    vtkCompositeArray<int>::SafeDownCast(output->GetCellData()->GetArray("CellIds"));
+}
+}
+
+int TestAppendImplicitArrays(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> inputs[3] = { MakeStrip(10, 0.0f), MakeStrip(1, 100.0f),
+    MakeStrip(25, 200.0f) };
+
+  vtkSmartPointer<vtkPolyData> appendedPolyData[2];
+  vtkSmartPointer<vtkUnstructuredGrid> appendedGrids[2];
+  for (int useImplicitArrays = 0; useImplicitArrays < 2; ++useImplicitArrays)
+  {
+    vtkNew<vtkAppendPolyData> appendPolyData;
+    appendPolyData->SetUseImplicitArrays(useImplicitArrays != 0);
+    vtkNew<vtkAppendFilter> appendFilter;
+    appendFilter->SetUseImplicitArrays(useImplicitArrays != 0);
+    for (vtkPolyData* input : inputs)
+    {
+      appendPolyData->AddInputData(input);
+      appendFilter->AddInputData(input);
+    }
+    appendPolyData->Update();
+    appendFilter->Update();
+    appendedPolyData[useImplicitArrays] = appendPolyData->GetOutput();
+    appendedGrids[useImplicitArrays] = appendFilter->GetOutput();
+  }
+
+  if (!SameOutputs(appendedPolyData[0], appendedPolyData[1]) ||
+    !SameOutputs(appendedGrids[0], appendedGrids[1]))
+  {
+    return EXIT_FAILURE;
+  }
+  if (IsConcatenated(appendedPolyData[0]) || !IsConcatenated(appendedPolyData[1]))
+  {
+    std::cerr << "vtkAppendPolyData did not follow UseImplicitArrays" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (IsConcatenated(appendedGrids[0]) || !IsConcatenated(appendedGrids[1]))
+  {
+    std::cerr << "vtkAppendFilter did not follow UseImplicitArrays" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!appendedPolyData[1]->GetPointData()->GetNormals() ||
+    !appendedGrids[1]->GetPointData()->GetScalars())
+  {
+    std::cerr << "Attributes were lost" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Merging points cannot reuse the input arrays
+  vtkNew<vtkAppendFilter> merge;
+  merge->UseImplicitArraysOn();
+  merge->MergePointsOn();
+  for (vtkPolyData* input : inputs)
+  {
+    merge->AddInputData(input);
+  }
+  merge->Update();
+  if (IsConcatenated(merge->GetOutput()))
+  {
+    std::cerr << "Merged points should not be concatenated" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
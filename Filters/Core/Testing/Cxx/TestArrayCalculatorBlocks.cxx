@@ -0,0 +1,204 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestArrayCalculatorBlocks.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the values computed by vtkArrayCalculator around the size of the
+// blocks of tuples its inputs are gathered by, and the implicit arrays it
+// generates for constant and affine results.
+
+#include <vtkAffineArray.h>
+#include <vtkArrayCalculator.h>
+#include <vtkConstantArray.h>
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkSmartPointer.h>
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// n points at (i, 2i, 0) with the arrays a = i * i and v = (i, -i, 1)
+vtkSmartPointer<vtkPolyData> MakeInput(vtkIdType n)
+{
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(n);
+  vtkNew<vtkFloatArray> a;
+  a->SetName("a");
+  a->SetNumberOfTuples(n);
+  vtkNew<vtkDoubleArray> v;
+  v->SetName("v");
+  v->SetNumberOfComponents(3);
+  v->SetNumberOfTuples(n);
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    const double x = static_cast<double>(i);
+    points->SetPoint(i, x, 2 * x, 0.0);
+    a->SetValue(i, static_cast<float>(x * x));
+    v->SetTuple3(i, x, -x, 1.0);
+  }
+  auto input = vtkSmartPointer<vtkPolyData>::New();
+  input->SetPoints(points);
+  input->GetPointData()->AddArray(a);
+  input->GetPointData()->AddArray(v);
+  return input;
+}
+
+vtkDataArray* Calculate(vtkArrayCalculator* calc, vtkPolyData* input, const char* function,
+  vtkArrayCalculator::FunctionParserTypes parserType)
+{
+  calc->SetInputData(input);
+  calc->SetFunctionParserType(parserType);
+  calc->SetAttributeTypeToPointData();
+  calc->RemoveAllVariables();
+  calc->AddScalarArrayName("a");
+  calc->AddVectorArrayName("v");
+  calc->AddCoordinateScalarVariable("x", 0);
+  calc->AddCoordinateScalarVariable("y", 1);
+  calc->AddCoordinateVectorVariable("p", 0, 1, 2);
+  calc->SetFunction(function);
+  calc->SetResultArrayName("Result");
+  calc->Update();
+  return vtkDataSet::SafeDownCast(calc->GetOutput())->GetPointData()->GetArray("Result");
+}
+
+bool CheckBlocks(vtkIdType n, vtkArrayCalculator::FunctionParserTypes parserType)
+{
+  vtkSmartPointer<vtkPolyData> input = MakeInput(n);
+
+  vtkNew<vtkArrayCalculator> scalarCalc;
+  vtkDataArray* scalars = Calculate(scalarCalc, input, "a + 3*y - x", parserType);
+  vtkNew<vtkArrayCalculator> vectorCalc;
+  vtkDataArray* vectors = Calculate(vectorCalc, input, "v + 2*p", parserType);
+  if (!scalars || !vectors || scalars->GetNumberOfTuples() != n ||
+    vectors->GetNumberOfTuples() != n || vectors->GetNumberOfComponents() != 3)
+  {
+    std::cerr << "Missing or wrongly sized results for " << n << " tuples" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    const double x = static_cast<double>(i);
+    const double* vector = vectors->GetTuple3(i);
+    if (scalars->GetTuple1(i) != x * x + 5 * x || vector[0] != 3 * x || vector[1] != 3 * x ||
+      vector[2] != 1.0)
+    {
+      std::cerr << "Wrong result at tuple " << i << " of " << n << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CheckImplicitResults(vtkArrayCalculator::FunctionParserTypes parserType)
+{
+  const vtkIdType n = 257;
+  vtkSmartPointer<vtkPolyData> input = MakeInput(n);
+
+  // A constant function is stored in a vtkConstantArray
+  vtkNew<vtkArrayCalculator> constantCalc;
+  constantCalc->ImplicitResultsOn();
+  vtkDataArray* result = Calculate(constantCalc, input, "2 + 1", parserType);
+  auto constantArray = vtkArrayDownCast<vtkConstantArray<double>>(result);
+  if (!constantArray || constantArray->GetNumberOfTuples() != n ||
+    constantArray->GetValue(n - 1) != 3.0)
+  {
+    std::cerr << "A constant function does not give a vtkConstantArray" << std::endl;
+    return false;
+  }
+  result = Calculate(constantCalc, input, "iHat + jHat + kHat", parserType);
+  if (!vtkArrayDownCast<vtkConstantArray<double>>(result) || result->GetNumberOfTuples() != n ||
+    result->GetNumberOfComponents() != 3 || result->GetComponent(n - 1, 2) != 1.0)
+  {
+    std::cerr << "A constant vector function does not give a vtkConstantArray" << std::endl;
+    return false;
+  }
+  // The components of this result differ: it is stored in a regular array
+  result = Calculate(constantCalc, input, "2*iHat", parserType);
+  if (!vtkArrayDownCast<vtkDoubleArray>(result) || result->GetComponent(n - 1, 0) != 2.0 ||
+    result->GetComponent(n - 1, 1) != 0.0)
+  {
+    std::cerr << "A constant vector of different components is not in a regular array"
+              << std::endl;
+    return false;
+  }
+
+  // An affine result is stored in a vtkAffineArray, of the result type
+  vtkNew<vtkArrayCalculator> affineCalc;
+  affineCalc->ImplicitResultsOn();
+  affineCalc->SetResultArrayType(VTK_INT);
+  result = Calculate(affineCalc, input, "3*x + 4", parserType);
+  auto affineArray = vtkArrayDownCast<vtkAffineArray<int>>(result);
+  if (!affineArray || affineArray->GetNumberOfTuples() != n ||
+    affineArray->GetValue(n - 1) != 3 * (n - 1) + 4)
+  {
+    std::cerr << "An affine function does not give a vtkAffineArray" << std::endl;
+    return false;
+  }
+  // Not affine
+  result = Calculate(affineCalc, input, "a + 1", parserType);
+  if (!vtkArrayDownCast<vtkIntArray>(result) || result->GetTuple1(n - 1) != (n - 1) * (n - 1) + 1)
+  {
+    std::cerr << "A non affine function is not in a regular array" << std::endl;
+    return false;
+  }
+
+  // Implicit results are off by default
+  vtkNew<vtkArrayCalculator> regularCalc;
+  result = Calculate(regularCalc, input, "2 + 1", parserType);
+  if (!vtkArrayDownCast<vtkDoubleArray>(result) || result->GetNumberOfTuples() != n ||
+    result->GetTuple1(n - 1) != 3.0)
+  {
+    std::cerr << "A constant function does not give a regular array by default" << std::endl;
+    return false;
+  }
+  result = Calculate(regularCalc, input, "3*x + 4", parserType);
+  if (!vtkArrayDownCast<vtkDoubleArray>(result) || result->GetTuple1(n - 1) != 3 * (n - 1) + 4)
+  {
+    std::cerr << "An affine function does not give a regular array by default" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestArrayCalculatorBlocks(int, char*[])
+{
+  for (int i = 0; i < vtkArrayCalculator::NumberOfFunctionParserTypes; ++i)
+  {
+    auto parserType = static_cast<vtkArrayCalculator::FunctionParserTypes>(i);
+    // The inputs are gathered by blocks of 256 tuples. With the sequential
+    // backend, the whole range is processed by a single call of the functor.
+    for (vtkIdType n : { 1, 255, 256, 257, 513 })
+    {
+      bool success = true;
+      vtkSMPTools::LocalScope(
+        vtkSMPTools::Config{ "Sequential" }, [&]() { success = CheckBlocks(n, parserType); });
+      if (!success || !CheckBlocks(n, parserType))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+    if (!CheckImplicitResults(parserType))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,272 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCleanPolyDataThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the threaded point merging of vtkCleanPolyData gives the same
+// output as the incremental vtkMergePoints path, including for the
+// vtkStringArray attributes, and that it is on by default.
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCleanPolyData.h>
+#include <vtkDoubleArray.h>
+#include <vtkIdList.h>
+#include <vtkIntArray.h>
+#include <vtkMinimalStandardRandomSequence.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
+#include <vtkVariant.h>
+#include <vtkVariantArray.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+// Points lie on a coarse lattice so that many of them coincide, and cells
+// of all types are built from random points so that many are degenerate.
+void InitializePolyData(vtkPolyData* polyData, int dataType)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+
+  const vtkIdType numPts = 2000;
+  vtkNew<vtkPoints> points;
+  points->SetDataType(dataType);
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("PointScalars");
+  pointScalars->SetNumberOfTuples(numPts);
+  vtkNew<vtkStringArray> pointNames;
+  pointNames->SetName("PointNames");
+  pointNames->SetNumberOfTuples(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      x[i] = 0.5 * static_cast<int>(random->GetNextRangeValue(0, 8));
+    }
+    points->SetPoint(ptId, x);
+    pointScalars->SetValue(ptId, static_cast<double>(ptId));
+    pointNames->SetValue(ptId, "point " + std::to_string(ptId));
+  }
+  polyData->SetPoints(points);
+  polyData->GetPointData()->SetScalars(pointScalars);
+  polyData->GetPointData()->AddArray(pointNames);
+
+  vtkNew<vtkCellArray> cells[4];
+  const int maxSizes[4] = { 3, 4, 6, 7 };
+  vtkNew<vtkIdList> cellPts;
+  vtkIdType numCells = 0;
+  for (int k = 0; k < 4; ++k)
+  {
+    for (int c = 0; c < 300; ++c, ++numCells)
+    {
+      const vtkIdType npts = 1 + static_cast<vtkIdType>(random->GetNextRangeValue(0, maxSizes[k]));
+      cellPts->SetNumberOfIds(npts);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        cellPts->SetId(i, static_cast<vtkIdType>(random->GetNextRangeValue(0, numPts)));
+      }
+      cells[k]->InsertNextCell(cellPts);
+    }
+  }
+  polyData->SetVerts(cells[0]);
+  polyData->SetLines(cells[1]);
+  polyData->SetPolys(cells[2]);
+  polyData->SetStrips(cells[3]);
+
+  vtkNew<vtkIntArray> cellScalars;
+  cellScalars->SetName("CellScalars");
+  cellScalars->SetNumberOfTuples(numCells);
+  vtkNew<vtkStringArray> cellNames;
+  cellNames->SetName("CellNames");
+  cellNames->SetNumberOfTuples(numCells);
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    cellScalars->SetValue(cellId, static_cast<int>(cellId));
+    cellNames->SetValue(cellId, "cell " + std::to_string(cellId));
+  }
+  polyData->GetCellData()->SetScalars(cellScalars);
+  polyData->GetCellData()->AddArray(cellNames);
+}
+
+bool SameCells(vtkCellArray* a, vtkCellArray* b)
+{
+  if (a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellAtId(cellId, ptsA);
+    b->GetCellAtId(cellId, ptsB);
+    if (ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType i = 0; i < ptsA->GetNumberOfIds(); ++i)
+    {
+      if (ptsA->GetId(i) != ptsB->GetId(i))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents() ||
+    a->GetDataType() != b->GetDataType())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Compare the arrays that are not vtkDataArray, such as vtkStringArray
+bool SameValues(vtkAbstractArray* a, vtkAbstractArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues() ||
+    a->GetDataType() != b->GetDataType())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetVariantValue(i) != b->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int Compare(vtkPolyData* input, bool convertCells)
+{
+  vtkSmartPointer<vtkPolyData> outputs[2];
+  for (int threaded = 0; threaded < 2; ++threaded)
+  {
+    vtkNew<vtkCleanPolyData> clean;
+    clean->SetInputData(input);
+    clean->SetThreadedPointMerging(threaded != 0);
+    clean->SetConvertLinesToPoints(convertCells);
+    clean->SetConvertPolysToLines(convertCells);
+    clean->SetConvertStripsToPolys(convertCells);
+    clean->Update();
+    outputs[threaded] = clean->GetOutput();
+  }
+
+  vtkPolyData* serial = outputs[0];
+  vtkPolyData* threaded = outputs[1];
+  if (!SameArrays(serial->GetPoints()->GetData(), threaded->GetPoints()->GetData()))
+  {
+    std::cerr << "Points differ: " << serial->GetNumberOfPoints() << " vs "
+              << threaded->GetNumberOfPoints() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameCells(serial->GetVerts(), threaded->GetVerts()) ||
+    !SameCells(serial->GetLines(), threaded->GetLines()) ||
+    !SameCells(serial->GetPolys(), threaded->GetPolys()) ||
+    !SameCells(serial->GetStrips(), threaded->GetStrips()))
+  {
+    std::cerr << "Cells differ" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameArrays(serial->GetPointData()->GetScalars(), threaded->GetPointData()->GetScalars()) ||
+    !SameArrays(serial->GetCellData()->GetScalars(), threaded->GetCellData()->GetScalars()))
+  {
+    std::cerr << "Attributes differ" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int a = 0; a < serial->GetPointData()->GetNumberOfArrays(); ++a)
+  {
+    vtkAbstractArray* array = serial->GetPointData()->GetAbstractArray(a);
+    if (!SameValues(array, threaded->GetPointData()->GetAbstractArray(array->GetName())))
+    {
+      std::cerr << "Point arrays " << array->GetName() << " differ" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (!SameValues(serial->GetCellData()->GetAbstractArray("CellNames"),
+        threaded->GetCellData()->GetAbstractArray("CellNames")))
+  {
+    std::cerr << "Cell arrays CellNames differ" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+int TestCleanPolyDataThreaded(int, char*[])
+{
+  vtkNew<vtkCleanPolyData> defaultClean;
+  if (!defaultClean->GetThreadedPointMerging())
+  {
+    std::cerr << "ThreadedPointMerging is not on by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (int dataType : { VTK_FLOAT, VTK_DOUBLE })
+  {
+    vtkNew<vtkPolyData> input;
+    InitializePolyData(input, dataType);
+    for (bool convertCells : { true, false })
+    {
+      if (Compare(input, convertCells) != EXIT_SUCCESS)
+      {
+        std::cerr << "Failure for data type " << dataType << ", cell conversion " << convertCells
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    // vtkVariantArray attributes are not supported by the threaded engine,
+    // vtkCleanPolyData falls back to the incremental path for them.
+    vtkNew<vtkVariantArray> pointVariants;
+    pointVariants->SetName("PointVariants");
+    pointVariants->SetNumberOfTuples(input->GetNumberOfPoints());
+    for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+    {
+      pointVariants->SetValue(ptId, vtkVariant(ptId));
+    }
+    input->GetPointData()->AddArray(pointVariants);
+    if (Compare(input, false) != EXIT_SUCCESS)
+    {
+      std::cerr << "Failure for data type " << dataType << " with a vtkVariantArray" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
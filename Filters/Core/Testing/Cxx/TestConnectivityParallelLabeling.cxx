@@ -0,0 +1,215 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestConnectivityParallelLabeling.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkConnectivityFilter and vtkPolyDataConnectivityFilter extract
+// the same cells and regions with and without parallel labeling.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkConnectivityFilter.h"
+#include "vtkDataArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataConnectivityFilter.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// Strips of triangles, the two longest of the same length, whose point ids are
+// interleaved, plus a vertex and a point used by no cell.
+void MakeStrips(vtkPolyData* polyData, vtkUnstructuredGrid* grid)
+{
+  const int numStrips = 5;
+  const int lengths[numStrips] = { 12, 6, 3, 12, 1 };
+  const int maxPts = 14;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numStrips * maxPts + 2);
+  for (int strip = 0; strip < numStrips; ++strip)
+  {
+    for (int i = 0; i < maxPts; ++i)
+    {
+      points->SetPoint(i * numStrips + strip, i, i % 2, strip);
+    }
+  }
+  const vtkIdType vertexId = numStrips * maxPts;
+  points->SetPoint(vertexId, -1.0, 0.0, 0.0);
+  points->SetPoint(vertexId + 1, -2.0, 0.0, 0.0);
+  polyData->SetPoints(points);
+  grid->SetPoints(points);
+
+  vtkNew<vtkCellArray> polys;
+  grid->Allocate();
+  // cells of different strips are interleaved too
+  for (int i = 0; i < 12; ++i)
+  {
+    for (int strip = numStrips - 1; strip >= 0; --strip)
+    {
+      if (i < lengths[strip])
+      {
+        const vtkIdType triangle[3] = { i * numStrips + strip, (i + 1) * numStrips + strip,
+          (i + 2) * numStrips + strip };
+        polys->InsertNextCell(3, triangle);
+        grid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+      }
+    }
+  }
+  polyData->SetPolys(polys);
+
+  vtkNew<vtkCellArray> verts;
+  verts->InsertNextCell(1, &vertexId);
+  polyData->SetVerts(verts);
+  grid->InsertNextCell(VTK_VERTEX, 1, &vertexId);
+}
+
+bool SameOutputs(vtkPointSet* a, vtkPointSet* b, vtkIdType numInputCells)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+    a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    std::cerr << "Different number of points or cells" << std::endl;
+    return false;
+  }
+  vtkDataArray* pointRegionsA = a->GetPointData()->GetArray("RegionId");
+  vtkDataArray* pointRegionsB = b->GetPointData()->GetArray("RegionId");
+  vtkDataArray* cellRegionsA = a->GetCellData()->GetArray("RegionId");
+  vtkDataArray* cellRegionsB = b->GetCellData()->GetArray("RegionId");
+  if (!pointRegionsA != !pointRegionsB || !cellRegionsA != !cellRegionsB)
+  {
+    std::cerr << "Different RegionId arrays" << std::endl;
+    return false;
+  }
+  // vtkConnectivityFilter indexes its cell RegionId array by input cell, so
+  // it only matches the output cells when they are all extracted
+  if (a->GetNumberOfCells() != numInputCells)
+  {
+    cellRegionsA = cellRegionsB = nullptr;
+  }
+
+  // points are not in the same order, compare them through the cells
+  vtkNew<vtkIdList> cellA;
+  vtkNew<vtkIdList> cellB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    if (cellRegionsA &&
+      cellRegionsA->GetComponent(cellId, 0) != cellRegionsB->GetComponent(cellId, 0))
+    {
+      std::cerr << "Cell " << cellId << " has a different region" << std::endl;
+      return false;
+    }
+    a->GetCellPoints(cellId, cellA);
+    b->GetCellPoints(cellId, cellB);
+    if (cellA->GetNumberOfIds() != cellB->GetNumberOfIds())
+    {
+      std::cerr << "Cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < cellA->GetNumberOfIds(); ++i)
+    {
+      double x[3], y[3];
+      a->GetPoint(cellA->GetId(i), x);
+      b->GetPoint(cellB->GetId(i), y);
+      if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2] ||
+        (pointRegionsA &&
+          pointRegionsA->GetComponent(cellA->GetId(i), 0) !=
+            pointRegionsB->GetComponent(cellB->GetId(i), 0)))
+      {
+        std::cerr << "Point " << i << " of cell " << cellId << " differs" << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename FilterT>
+bool TestFilter(vtkPointSet* input, const char* name)
+{
+  for (int mode = VTK_EXTRACT_POINT_SEEDED_REGIONS; mode <= VTK_EXTRACT_CLOSEST_POINT_REGION;
+       ++mode)
+  {
+    vtkSmartPointer<FilterT> filters[2];
+    for (int parallel = 0; parallel < 2; ++parallel)
+    {
+      vtkNew<FilterT> filter;
+      filter->SetInputData(input);
+      filter->SetExtractionMode(mode);
+      filter->SetUseParallelLabeling(parallel != 0);
+      filter->ColorRegionsOn();
+      filter->AddSeed(22);
+      filter->AddSeed(3);
+      filter->AddSpecifiedRegion(0);
+      filter->AddSpecifiedRegion(2);
+      filter->SetClosestPoint(4.0, 1.0, 3.0);
+      filter->Update();
+      filters[parallel] = filter;
+    }
+    if (!SameOutputs(vtkPointSet::SafeDownCast(filters[0]->GetOutput()),
+          vtkPointSet::SafeDownCast(filters[1]->GetOutput()), input->GetNumberOfCells()) ||
+      filters[0]->GetNumberOfExtractedRegions() != filters[1]->GetNumberOfExtractedRegions())
+    {
+      std::cerr << name << " differs for " << filters[0]->GetExtractionModeAsString()
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestConnectivityParallelLabeling(int, char*[])
+{
+  vtkNew<vtkPolyData> polyData;
+  vtkNew<vtkUnstructuredGrid> grid;
+  MakeStrips(polyData, grid);
+
+  if (!TestFilter<vtkConnectivityFilter>(polyData, "vtkConnectivityFilter on vtkPolyData") ||
+    !TestFilter<vtkConnectivityFilter>(grid, "vtkConnectivityFilter") ||
+    !TestFilter<vtkPolyDataConnectivityFilter>(polyData, "vtkPolyDataConnectivityFilter"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkPolyDataConnectivityFilter> filter;
+  filter->SetInputData(polyData);
+  filter->UseParallelLabelingOn();
+  filter->SetExtractionModeToAllRegions();
+  filter->Update();
+  // regions are numbered by their first cell: the vertex, then the strips in
+  // reverse order
+  const vtkIdType expectedSizes[6] = { 1, 1, 12, 3, 6, 12 };
+  vtkIdTypeArray* sizes = filter->GetRegionSizes();
+  if (filter->GetNumberOfExtractedRegions() != 6)
+  {
+    std::cerr << "Expected 6 regions, got " << filter->GetNumberOfExtractedRegions() << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int region = 0; region < 6; ++region)
+  {
+    if (sizes->GetValue(region) != expectedSizes[region])
+    {
+      std::cerr << "Region " << region << " has " << sizes->GetValue(region)
+                << " cells instead of " << expectedSizes[region] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,286 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestContourGridParallel.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the threaded contouring of vtkContourGrid gives the same output
+// as the sequential one on a grid mixing quadratic, 2D and 1D cells.
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkContourFilter.h>
+#include <vtkContourGrid.h>
+#include <vtkDoubleArray.h>
+#include <vtkIdList.h>
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// Number of quadratic hexahedra along each axis.
+const int NumberOfHexahedra = 17;
+const int NumberOfNodes = 2 * NumberOfHexahedra + 1;
+
+vtkIdType NodeId(int i, int j, int k)
+{
+  return i + NumberOfNodes * (j + NumberOfNodes * k);
+}
+
+// Quadratic hexahedra fill a cube whose bottom face is covered by quads and
+// triangles, and whose bottom edge is covered by lines, so that the cells of
+// all dimensions share contour points.
+void InitializeGrid(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkPoints> points;
+  points->SetDataType(VTK_DOUBLE);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  for (int k = 0; k < NumberOfNodes; ++k)
+  {
+    for (int j = 0; j < NumberOfNodes; ++j)
+    {
+      for (int i = 0; i < NumberOfNodes; ++i)
+      {
+        const double x[3] = { 0.1 * i, 0.1 * j, 0.1 * k };
+        points->InsertNextPoint(x);
+        vectors->InsertNextTuple(x);
+        scalars->InsertNextValue(
+          std::sqrt((x[0] - 0.4) * (x[0] - 0.4) + (x[1] - 1.1) * (x[1] - 1.1) + x[2] * x[2]));
+      }
+    }
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->SetScalars(scalars);
+  grid->GetPointData()->AddArray(vectors);
+
+  // Node offsets of a quadratic hexahedron, corners first, then mid-edges.
+  const int hexNodes[20][3] = { { 0, 0, 0 }, { 2, 0, 0 }, { 2, 2, 0 }, { 0, 2, 0 }, { 0, 0, 2 },
+    { 2, 0, 2 }, { 2, 2, 2 }, { 0, 2, 2 }, { 1, 0, 0 }, { 2, 1, 0 }, { 1, 2, 0 }, { 0, 1, 0 },
+    { 1, 0, 2 }, { 2, 1, 2 }, { 1, 2, 2 }, { 0, 1, 2 }, { 0, 0, 1 }, { 2, 0, 1 }, { 2, 2, 1 },
+    { 0, 2, 1 } };
+  grid->AllocateEstimate(NumberOfHexahedra * NumberOfHexahedra * NumberOfHexahedra, 20);
+  for (int k = 0; k < NumberOfNodes - 1; k += 2)
+  {
+    for (int j = 0; j < NumberOfNodes - 1; j += 2)
+    {
+      for (int i = 0; i < NumberOfNodes - 1; i += 2)
+      {
+        vtkIdType pts[20];
+        for (int n = 0; n < 20; ++n)
+        {
+          pts[n] = NodeId(i + hexNodes[n][0], j + hexNodes[n][1], k + hexNodes[n][2]);
+        }
+        grid->InsertNextCell(VTK_QUADRATIC_HEXAHEDRON, 20, pts);
+      }
+    }
+  }
+  for (int j = 0; j < NumberOfNodes - 1; ++j)
+  {
+    for (int i = 0; i < NumberOfNodes - 1; ++i)
+    {
+      if ((i + j) % 2)
+      {
+        const vtkIdType quad[4] = { NodeId(i, j, 0), NodeId(i + 1, j, 0), NodeId(i + 1, j + 1, 0),
+          NodeId(i, j + 1, 0) };
+        grid->InsertNextCell(VTK_QUAD, 4, quad);
+      }
+      else
+      {
+        const vtkIdType tri1[3] = { NodeId(i, j, 0), NodeId(i + 1, j, 0), NodeId(i + 1, j + 1, 0) };
+        const vtkIdType tri2[3] = { NodeId(i, j, 0), NodeId(i + 1, j + 1, 0), NodeId(i, j + 1, 0) };
+        grid->InsertNextCell(VTK_TRIANGLE, 3, tri1);
+        grid->InsertNextCell(VTK_TRIANGLE, 3, tri2);
+      }
+    }
+  }
+  for (int i = 0; i < NumberOfNodes - 1; ++i)
+  {
+    const vtkIdType line[2] = { NodeId(i, 0, 0), NodeId(i + 1, 0, 0) };
+    grid->InsertNextCell(VTK_LINE, 2, line);
+  }
+
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  cellIds->SetNumberOfTuples(grid->GetNumberOfCells());
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    cellIds->SetValue(cellId, static_cast<int>(cellId));
+  }
+  grid->GetCellData()->AddArray(cellIds);
+}
+
+bool SameCells(vtkCellArray* a, vtkCellArray* b)
+{
+  if (a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellAtId(cellId, ptsA);
+    b->GetCellAtId(cellId, ptsB);
+    if (ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType i = 0; i < ptsA->GetNumberOfIds(); ++i)
+    {
+      if (ptsA->GetId(i) != ptsB->GetId(i))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents() ||
+    a->GetDataType() != b->GetDataType())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameAttributes(vtkFieldData* a, vtkFieldData* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    if (!SameArrays(a->GetArray(i), b->GetArray(a->GetArrayName(i))))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameOutputs(vtkPolyData* serial, vtkPolyData* threaded)
+{
+  if (!SameArrays(serial->GetPoints()->GetData(), threaded->GetPoints()->GetData()))
+  {
+    std::cerr << "Points differ: " << serial->GetNumberOfPoints() << " vs "
+              << threaded->GetNumberOfPoints() << std::endl;
+    return false;
+  }
+  if (!SameCells(serial->GetVerts(), threaded->GetVerts()) ||
+    !SameCells(serial->GetLines(), threaded->GetLines()) ||
+    !SameCells(serial->GetPolys(), threaded->GetPolys()))
+  {
+    std::cerr << "Cells differ" << std::endl;
+    return false;
+  }
+  if (!SameAttributes(serial->GetPointData(), threaded->GetPointData()) ||
+    !SameAttributes(serial->GetCellData(), threaded->GetCellData()))
+  {
+    std::cerr << "Attributes differ" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int Compare(vtkUnstructuredGrid* input, bool generateTriangles, bool computeScalars, int precision)
+{
+  vtkSmartPointer<vtkPolyData> outputs[2];
+  for (int threaded = 0; threaded < 2; ++threaded)
+  {
+    vtkNew<vtkContourGrid> contour;
+    contour->SetInputData(input);
+    contour->SetValue(0, 0.35);
+    contour->SetValue(1, 0.9);
+    contour->SetValue(2, 1.6);
+    contour->SetGenerateTriangles(generateTriangles);
+    contour->SetComputeScalars(computeScalars);
+    contour->SetOutputPointsPrecision(precision);
+    contour->SetUseParallelContouring(threaded != 0);
+    contour->Update();
+    outputs[threaded] = contour->GetOutput();
+  }
+  if (outputs[0]->GetNumberOfPolys() == 0 || outputs[0]->GetNumberOfLines() == 0 ||
+    outputs[0]->GetNumberOfVerts() == 0)
+  {
+    std::cerr << "Expected verts, lines and polys" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return SameOutputs(outputs[0], outputs[1]) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+}
+
+int TestContourGridParallel(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> input;
+  InitializeGrid(input);
+  for (bool generateTriangles : { true, false })
+  {
+    for (bool computeScalars : { true, false })
+    {
+      for (int precision : { vtkAlgorithm::SINGLE_PRECISION, vtkAlgorithm::DOUBLE_PRECISION })
+      {
+        if (Compare(input, generateTriangles, computeScalars, precision) != EXIT_SUCCESS)
+        {
+          std::cerr << "Failure for triangles " << generateTriangles << ", scalars "
+                    << computeScalars << ", precision " << precision << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  // The option is forwarded by vtkContourFilter for non-linear cells.
+  vtkSmartPointer<vtkPolyData> outputs[2];
+  for (int threaded = 0; threaded < 2; ++threaded)
+  {
+    vtkNew<vtkContourFilter> contour;
+    contour->SetInputData(input);
+    contour->GenerateValues(4, 0.2, 1.8);
+    contour->ComputeNormalsOff();
+    contour->SetUseParallelContouring(threaded != 0);
+    contour->Update();
+    outputs[threaded] = vtkPolyData::SafeDownCast(contour->GetOutput());
+  }
+  if (!SameOutputs(outputs[0], outputs[1]))
+  {
+    std::cerr << "Failure for vtkContourFilter" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
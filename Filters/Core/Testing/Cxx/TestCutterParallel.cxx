@@ -0,0 +1,288 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCutterParallel.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that cutting an unstructured grid in parallel with vtkCutter gives
+// the same output as the sequential cut for several implicit functions. The
+// output points are in double precision, where both cuts merge exactly the
+// same points.
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCutter.h>
+#include <vtkCylinder.h>
+#include <vtkDoubleArray.h>
+#include <vtkIdList.h>
+#include <vtkImplicitBoolean.h>
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+#include <vtkSphere.h>
+#include <vtkTransform.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const int NumberOfNodes = 31;
+
+vtkIdType NodeId(int i, int j, int k)
+{
+  return i + NumberOfNodes * (j + NumberOfNodes * k);
+}
+
+// Hexahedra and tetrahedra fill a cube whose bottom face is covered by quads
+// and whose bottom edge is covered by lines.
+void InitializeGrid(vtkUnstructuredGrid* grid, int pointsType)
+{
+  vtkNew<vtkPoints> points;
+  points->SetDataType(pointsType);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (int k = 0; k < NumberOfNodes; ++k)
+  {
+    for (int j = 0; j < NumberOfNodes; ++j)
+    {
+      for (int i = 0; i < NumberOfNodes; ++i)
+      {
+        points->InsertNextPoint(0.1 * i, 0.1 * j, 0.1 * k);
+        scalars->InsertNextValue(i + 2 * j - k);
+      }
+    }
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->SetScalars(scalars);
+
+  grid->AllocateEstimate(NumberOfNodes * NumberOfNodes * NumberOfNodes, 8);
+  for (int k = 0; k < NumberOfNodes - 1; ++k)
+  {
+    for (int j = 0; j < NumberOfNodes - 1; ++j)
+    {
+      for (int i = 0; i < NumberOfNodes - 1; ++i)
+      {
+        const vtkIdType hex[8] = { NodeId(i, j, k), NodeId(i + 1, j, k), NodeId(i + 1, j + 1, k),
+          NodeId(i, j + 1, k), NodeId(i, j, k + 1), NodeId(i + 1, j, k + 1),
+          NodeId(i + 1, j + 1, k + 1), NodeId(i, j + 1, k + 1) };
+        if ((i + j + k) % 2)
+        {
+          grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+        }
+        else
+        {
+          const int tetras[5][4] = { { 0, 1, 3, 4 }, { 1, 2, 3, 6 }, { 1, 4, 5, 6 },
+            { 3, 4, 6, 7 }, { 1, 3, 4, 6 } };
+          for (const auto& tetra : tetras)
+          {
+            const vtkIdType pts[4] = { hex[tetra[0]], hex[tetra[1]], hex[tetra[2]],
+              hex[tetra[3]] };
+            grid->InsertNextCell(VTK_TETRA, 4, pts);
+          }
+        }
+      }
+    }
+  }
+  for (int j = 0; j < NumberOfNodes - 1; ++j)
+  {
+    for (int i = 0; i < NumberOfNodes - 1; ++i)
+    {
+      const vtkIdType quad[4] = { NodeId(i, j, 0), NodeId(i + 1, j, 0), NodeId(i + 1, j + 1, 0),
+        NodeId(i, j + 1, 0) };
+      grid->InsertNextCell(VTK_QUAD, 4, quad);
+    }
+  }
+  for (int i = 0; i < NumberOfNodes - 1; ++i)
+  {
+    const vtkIdType line[2] = { NodeId(i, 0, 0), NodeId(i + 1, 0, 0) };
+    grid->InsertNextCell(VTK_LINE, 2, line);
+  }
+
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  cellIds->SetNumberOfTuples(grid->GetNumberOfCells());
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    cellIds->SetValue(cellId, static_cast<int>(cellId));
+  }
+  grid->GetCellData()->AddArray(cellIds);
+}
+
+bool SameCells(vtkCellArray* a, vtkCellArray* b)
+{
+  if (a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellAtId(cellId, ptsA);
+    b->GetCellAtId(cellId, ptsB);
+    if (ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType i = 0; i < ptsA->GetNumberOfIds(); ++i)
+    {
+      if (ptsA->GetId(i) != ptsB->GetId(i))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents() ||
+    a->GetDataType() != b->GetDataType())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameAttributes(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays() ||
+    !a->GetScalars() != !b->GetScalars() ||
+    (a->GetScalars() && !SameArrays(a->GetScalars(), b->GetScalars())))
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    if (a->GetArrayName(i) && !SameArrays(a->GetArray(i), b->GetArray(a->GetArrayName(i))))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameOutputs(vtkPolyData* serial, vtkPolyData* threaded)
+{
+  if (!SameArrays(serial->GetPoints()->GetData(), threaded->GetPoints()->GetData()))
+  {
+    std::cerr << "Points differ: " << serial->GetNumberOfPoints() << " vs "
+              << threaded->GetNumberOfPoints() << std::endl;
+    return false;
+  }
+  if (!SameCells(serial->GetVerts(), threaded->GetVerts()) ||
+    !SameCells(serial->GetLines(), threaded->GetLines()) ||
+    !SameCells(serial->GetPolys(), threaded->GetPolys()))
+  {
+    std::cerr << "Cells differ" << std::endl;
+    return false;
+  }
+  if (!SameAttributes(serial->GetPointData(), threaded->GetPointData()) ||
+    !SameAttributes(serial->GetCellData(), threaded->GetCellData()))
+  {
+    std::cerr << "Attributes differ" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int Compare(vtkUnstructuredGrid* input, vtkImplicitFunction* function, bool generateCutScalars,
+  bool generateTriangles)
+{
+  vtkSmartPointer<vtkPolyData> outputs[2];
+  for (int threaded = 0; threaded < 2; ++threaded)
+  {
+    vtkNew<vtkCutter> cutter;
+    cutter->SetInputData(input);
+    cutter->SetCutFunction(function);
+    cutter->SetValue(0, -0.2);
+    cutter->SetValue(1, 0.0);
+    cutter->SetValue(2, 0.3);
+    cutter->SetGenerateCutScalars(generateCutScalars);
+    cutter->SetGenerateTriangles(generateTriangles);
+    cutter->SetOutputPointsPrecision(vtkAlgorithm::DOUBLE_PRECISION);
+    cutter->SetUseParallelCutting(threaded != 0);
+    cutter->Update();
+    outputs[threaded] = cutter->GetOutput();
+  }
+  if (outputs[0]->GetNumberOfPolys() == 0)
+  {
+    std::cerr << "Expected polys" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return SameOutputs(outputs[0], outputs[1]) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+}
+
+int TestCutterParallel(int, char*[])
+{
+  vtkNew<vtkSphere> sphere;
+  sphere->SetCenter(1.2, 0.4, 0.0);
+  sphere->SetRadius(1.3);
+
+  vtkNew<vtkCylinder> cylinder;
+  cylinder->SetCenter(2.0, 2.0, 1.5);
+  cylinder->SetAxis(1.0, 1.0, 0.0);
+  cylinder->SetRadius(0.7);
+  vtkNew<vtkImplicitBoolean> boolean;
+  boolean->SetOperationTypeToUnion();
+  boolean->AddFunction(sphere);
+  boolean->AddFunction(cylinder);
+
+  vtkNew<vtkTransform> transform;
+  transform->RotateZ(30.0);
+  transform->Scale(1.0, 2.0, 1.0);
+  vtkNew<vtkSphere> transformedSphere;
+  transformedSphere->SetCenter(0.8, 0.0, 0.2);
+  transformedSphere->SetRadius(1.1);
+  transformedSphere->SetTransform(transform);
+
+  vtkImplicitFunction* functions[3] = { sphere, boolean, transformedSphere };
+  for (int pointsType : { VTK_FLOAT, VTK_DOUBLE })
+  {
+    vtkNew<vtkUnstructuredGrid> input;
+    InitializeGrid(input, pointsType);
+    for (vtkImplicitFunction* function : functions)
+    {
+      for (bool generateCutScalars : { false, true })
+      {
+        for (bool generateTriangles : { true, false })
+        {
+          if (Compare(input, function, generateCutScalars, generateTriangles) != EXIT_SUCCESS)
+          {
+            std::cerr << "Failure for " << function->GetClassName() << ", points type "
+                      << pointsType << ", cut scalars " << generateCutScalars << ", triangles "
+                      << generateTriangles << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -15,8 +15,15 @@
 
 #include <vtkCellArray.h>
 #include <vtkDecimatePro.h>
+#include <vtkMath.h>
 #include <vtkSmartPointer.h>
 
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <utility>
+
 namespace
 {
 void InitializePolyData(vtkPolyData* polyData, int dataType)
@@ -116,6 +123,77 @@ int DecimatePro(int dataType, int outputPointsPrecision)
 
   return points->GetDataType();
 }
+
+// Decimate a torus by tiles, and check that the target reduction is reached
+// and that the output is still closed, i.e. that no crack opened between the
+// tiles: every edge is used by an even number of triangles.
+bool DecimateProTiles()
+{
+  const int resolutionU = 200;
+  const int resolutionV = 50;
+  vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+  vtkSmartPointer<vtkCellArray> polys = vtkSmartPointer<vtkCellArray>::New();
+  for (int j = 0; j < resolutionV; ++j)
+  {
+    for (int i = 0; i < resolutionU; ++i)
+    {
+      const double u = 2.0 * vtkMath::Pi() * i / resolutionU;
+      const double v = 2.0 * vtkMath::Pi() * j / resolutionV;
+      const double r = 1.0 + 0.3 * std::cos(v) + 0.05 * std::sin(7.0 * u);
+      points->InsertNextPoint(r * std::cos(u), r * std::sin(u), 0.3 * std::sin(v));
+
+      const vtkIdType a = j * resolutionU + i;
+      const vtkIdType b = j * resolutionU + (i + 1) % resolutionU;
+      const vtkIdType c = ((j + 1) % resolutionV) * resolutionU + i;
+      const vtkIdType d = ((j + 1) % resolutionV) * resolutionU + (i + 1) % resolutionU;
+      const vtkIdType triangle1[3] = { a, b, d };
+      const vtkIdType triangle2[3] = { a, d, c };
+      polys->InsertNextCell(3, triangle1);
+      polys->InsertNextCell(3, triangle2);
+    }
+  }
+  vtkSmartPointer<vtkPolyData> inputPolyData = vtkSmartPointer<vtkPolyData>::New();
+  inputPolyData->SetPoints(points);
+  inputPolyData->SetPolys(polys);
+
+  vtkSmartPointer<vtkDecimatePro> decimatePro = vtkSmartPointer<vtkDecimatePro>::New();
+  decimatePro->SetInputData(inputPolyData);
+  decimatePro->SetTargetReduction(0.8);
+  decimatePro->PreserveTopologyOn();
+  decimatePro->SetNumberOfTiles(8);
+  decimatePro->Update();
+  vtkPolyData* outputPolyData = decimatePro->GetOutput();
+
+  const vtkIdType numInputTris = inputPolyData->GetNumberOfPolys();
+  const vtkIdType numOutputTris = outputPolyData->GetNumberOfPolys();
+  if (numOutputTris > 0.2 * numInputTris + 2 || numOutputTris < 0.2 * numInputTris - 2)
+  {
+    std::cerr << "Decimated " << numInputTris << " triangles to " << numOutputTris << std::endl;
+    return false;
+  }
+
+  std::map<std::pair<vtkIdType, vtkIdType>, int> edges;
+  for (vtkIdType cellId = 0; cellId < numOutputTris; ++cellId)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    outputPolyData->GetCellPoints(cellId, npts, pts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      edges[std::minmax(pts[i], pts[(i + 1) % npts])]++;
+    }
+  }
+  for (const auto& edge : edges)
+  {
+    if (edge.second % 2)
+    {
+      std::cerr << "Edge " << edge.first.first << "-" << edge.first.second << " is used by "
+                << edge.second << " triangles" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
 }
 
 int TestDecimatePro(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
@@ -162,5 +240,10 @@ int TestDecimatePro(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     return EXIT_FAILURE;
   }
 
+  if (!DecimateProTiles())
+  {
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
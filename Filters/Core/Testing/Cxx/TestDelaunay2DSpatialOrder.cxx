@@ -0,0 +1,92 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDelaunay2DSpatialOrder.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the spatially sorted insertion order of vtkDelaunay2D gives
+// the same triangulation as the input order, on random terrain samples.
+
+#include "vtkCellArray.h"
+#include "vtkDelaunay2D.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+std::vector<std::array<vtkIdType, 3>> SortedTriangles(vtkPolyData* output)
+{
+  std::vector<std::array<vtkIdType, 3>> triangles;
+  vtkCellArray* polys = output->GetPolys();
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (vtkIdType cellId = 0; cellId < polys->GetNumberOfCells(); cellId++)
+  {
+    polys->GetCellAtId(cellId, npts, pts);
+    std::array<vtkIdType, 3> tri = { { pts[0], pts[1], pts[2] } };
+    std::sort(tri.begin(), tri.end());
+    triangles.push_back(tri);
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+bool CompareOrders(vtkPolyData* input, double alpha)
+{
+  vtkNew<vtkDelaunay2D> reference;
+  reference->SetInputData(input);
+  reference->SetAlpha(alpha);
+  reference->Update();
+
+  vtkNew<vtkDelaunay2D> spatial;
+  spatial->SetInputData(input);
+  spatial->SetAlpha(alpha);
+  spatial->SpatialPointInsertionOn();
+  spatial->Update();
+
+  auto expected = SortedTriangles(reference->GetOutput());
+  auto triangles = SortedTriangles(spatial->GetOutput());
+  if (expected.empty() || triangles != expected)
+  {
+    std::cerr << "Alpha " << alpha << ": " << triangles.size() << " triangles instead of "
+              << expected.size() << ", or different triangles" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDelaunay2DSpatialOrder(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(4321);
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i < 5000; i++)
+  {
+    double x = random->GetNextRangeValue(0.0, 10.0);
+    double y = random->GetNextRangeValue(0.0, 10.0);
+    points->InsertNextPoint(x, y, std::sin(x) * std::cos(y));
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+
+  bool success = CompareOrders(input, 0.0);
+  success &= CompareOrders(input, 0.2);
+  return (success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -19,6 +19,11 @@
 #include <vtkSmartPointer.h>
 #include <vtkUnstructuredGrid.h>
 
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <vector>
+
 namespace
 {
 void InitializeUnstructuredGrid(vtkUnstructuredGrid* unstructuredGrid, int dataType)
@@ -84,6 +89,64 @@ int Delaunay3D(int dataType, int outputPointsPrecision)
 
   return points ? points->GetDataType() : VTK_DOUBLE;
 }
+
+// Get the tetrahedra of a triangulation as sorted point ids.
+std::vector<std::array<vtkIdType, 4>> GetTetras(vtkUnstructuredGrid* grid)
+{
+  std::vector<std::array<vtkIdType, 4>> tetras;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    grid->GetCellPoints(cellId, npts, pts);
+    std::array<vtkIdType, 4> tetra = { { pts[0], pts[1], pts[2], pts[3] } };
+    std::sort(tetra.begin(), tetra.end());
+    tetras.push_back(tetra);
+  }
+  std::sort(tetras.begin(), tetras.end());
+  return tetras;
+}
+
+// Points in general position have a unique Delaunay triangulation, which
+// must not depend on the insertion order.
+bool CompareInsertionOrders()
+{
+  vtkSmartPointer<vtkMinimalStandardRandomSequence> randomSequence =
+    vtkSmartPointer<vtkMinimalStandardRandomSequence>::New();
+  randomSequence->SetSeed(3);
+  vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+  points->SetDataTypeToDouble();
+  for (int i = 0; i < 1000; ++i)
+  {
+    double point[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      randomSequence->Next();
+      point[j] = randomSequence->GetValue();
+    }
+    points->InsertNextPoint(point);
+  }
+  vtkSmartPointer<vtkUnstructuredGrid> input = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  input->SetPoints(points);
+
+  vtkSmartPointer<vtkDelaunay3D> delaunay = vtkSmartPointer<vtkDelaunay3D>::New();
+  delaunay->SetInputData(input);
+  delaunay->SetInsertionOrderToInputOrder();
+  delaunay->Update();
+  std::vector<std::array<vtkIdType, 4>> expected = GetTetras(delaunay->GetOutput());
+
+  delaunay->SetInsertionOrderToSpatialOrder();
+  delaunay->Update();
+  std::vector<std::array<vtkIdType, 4>> tetras = GetTetras(delaunay->GetOutput());
+
+  if (expected.empty() || tetras != expected)
+  {
+    std::cerr << "The spatial insertion order gives " << tetras.size() << " tetrahedra, instead of "
+              << expected.size() << " with the input order" << std::endl;
+    return false;
+  }
+  return true;
+}
 }
 
 int TestDelaunay3D(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
@@ -138,5 +201,10 @@ int TestDelaunay3D(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     return EXIT_FAILURE;
   }
 
+  if (!CompareInsertionOrders())
+  {
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
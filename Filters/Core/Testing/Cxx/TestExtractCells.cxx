@@ -1,3 +1,4 @@
+#include "vtkCellArray.h"
 #include "vtkExtractCells.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
@@ -33,6 +34,11 @@ int TestExtractCells(int argc, char* argv[])
     vtkLogF(ERROR, "ERROR: failed to extract polyhedral elements;");
     return EXIT_FAILURE;
   }
+  if (extractor->GetOutput()->GetCells()->IsStorage64Bit())
+  {
+    vtkLogF(ERROR, "ERROR: expected 32-bit connectivity for a small output");
+    return EXIT_FAILURE;
+  }
 
   vtkNew<vtkUnstructuredGrid> emptyUG;
   extractor->SetInputDataObject(emptyUG);
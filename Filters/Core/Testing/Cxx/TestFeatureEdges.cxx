@@ -364,6 +364,70 @@ bool TestMixedTypes()
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool TestEdgeTypes()
+{
+  // Three triangles sharing the edge (0, 1), two triangles folded along the
+  // edge (5, 6) and two coplanar triangles sharing the edge (9, 10).
+  vtkNew<vtkPoints> points;
+  const double coordinates[13][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0.5, 1, 0 }, { 0.5, -1, 0 },
+    { 0.5, 0, 1 }, { 3, 0, 0 }, { 4, 0, 0 }, { 3.5, 1, 0 }, { 3.5, 0, 1 }, { 6, 0, 0 },
+    { 7, 0, 0 }, { 6.5, 1, 0 }, { 6.5, -1, 0 } };
+  for (const double* x : coordinates)
+  {
+    points->InsertNextPoint(x);
+  }
+  vtkNew<vtkCellArray> polys;
+  const vtkIdType triangles[7][3] = { { 0, 1, 2 }, { 1, 0, 3 }, { 0, 1, 4 }, { 5, 6, 7 },
+    { 6, 5, 8 }, { 9, 10, 11 }, { 10, 9, 12 } };
+  for (const vtkIdType* triangle : triangles)
+  {
+    polys->InsertNextCell(3, triangle);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+
+  vtkNew<vtkFeatureEdges> edges;
+  edges->SetInputData(polyData);
+  edges->ExtractAllEdgeTypesOn();
+
+  // boundary, non-manifold, feature and manifold edge counts, with and
+  // without feature edges. Edges that are not feature edges are only
+  // reported as manifold edges when feature edges are off.
+  const double typeValues[4] = { 0.0, 0.222222, 0.444444, 0.666667 };
+  const int expectedCounts[2][4] = { { 14, 1, 1, 0 }, { 14, 1, 0, 2 } };
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    edges->SetFeatureEdges(pass == 0);
+    edges->Update();
+
+    vtkPolyData* out = edges->GetOutput();
+    vtkDataArray* types = out->GetCellData()->GetArray("Edge Types");
+    if (!types || out->GetNumberOfPoints() != 13)
+    {
+      vtkLog(ERROR, "Feature edges did not generate the expected points and edge types");
+      return false;
+    }
+    for (int type = 0; type < 4; ++type)
+    {
+      int count = 0;
+      for (vtkIdType id = 0; id < types->GetNumberOfTuples(); ++id)
+      {
+        count += std::abs(types->GetComponent(id, 0) - typeValues[type]) < 1e-5 ? 1 : 0;
+      }
+      if (count != expectedCounts[pass][type])
+      {
+        vtkLog(ERROR,
+          "Feature edges generated " << count << " edges of type " << type << " instead of "
+                                     << expectedCounts[pass][type]);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 void InitializePolyData(vtkPolyData* polyData, int dataType)
 {
@@ -467,7 +531,7 @@ int FeatureEdges(int dataType, int outputPointsPrecision)
 //----------------------------------------------------------------------------
 int TestFeatureEdges(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
 {
-  if (!TestMixedTypes())
+  if (!TestMixedTypes() || !TestEdgeTypes())
   {
     return EXIT_FAILURE;
   }
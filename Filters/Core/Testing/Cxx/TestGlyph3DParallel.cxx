@@ -0,0 +1,200 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGlyph3DParallel.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkGlyph3D gives the same output with the sequential SMP backend
+// and the default one, and that each visible point gets its own glyph.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkGlyph3D.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> RunGlyph3D(vtkPolyData* input, vtkPolyData* source)
+{
+  vtkNew<vtkGlyph3D> glyph;
+  glyph->SetInputData(input);
+  glyph->SetSourceData(source);
+  glyph->SetScaleModeToScaleByVector();
+  glyph->SetColorModeToColorByScalar();
+  glyph->SetScaleFactor(0.5);
+  glyph->GeneratePointIdsOn();
+  glyph->FillCellDataOn();
+  glyph->Update();
+  return glyph->GetOutput();
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameOutputs(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfCells() != b->GetNumberOfCells() ||
+    !SameArrays(a->GetPoints()->GetData(), b->GetPoints()->GetData()))
+  {
+    std::cerr << "Different points or number of cells" << std::endl;
+    return false;
+  }
+  vtkNew<vtkIdList> cellA;
+  vtkNew<vtkIdList> cellB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellPoints(cellId, cellA);
+    b->GetCellPoints(cellId, cellB);
+    bool same = cellA->GetNumberOfIds() == cellB->GetNumberOfIds();
+    for (vtkIdType i = 0; same && i < cellA->GetNumberOfIds(); ++i)
+    {
+      same = cellA->GetId(i) == cellB->GetId(i);
+    }
+    if (!same)
+    {
+      std::cerr << "Cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+  }
+  for (const char* name : { "Scalars", "GlyphVector", "Normals", "InputPointIds" })
+  {
+    if (!SameArrays(a->GetPointData()->GetArray(name), b->GetPointData()->GetArray(name)))
+    {
+      std::cerr << "Point array " << name << " differs" << std::endl;
+      return false;
+    }
+  }
+  if (!SameArrays(a->GetCellData()->GetArray("Scalars"), b->GetCellData()->GetArray("Scalars")))
+  {
+    std::cerr << "Cell array Scalars differs" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestGlyph3DParallel(int, char*[])
+{
+  // A triangle with normals as the glyph
+  vtkNew<vtkPolyData> source;
+  vtkNew<vtkPoints> sourcePoints;
+  sourcePoints->InsertNextPoint(0.0, -0.2, 0.0);
+  sourcePoints->InsertNextPoint(1.0, 0.0, 0.0);
+  sourcePoints->InsertNextPoint(0.0, 0.2, 0.1);
+  source->SetPoints(sourcePoints);
+  vtkNew<vtkCellArray> triangles;
+  const vtkIdType triangle[3] = { 0, 1, 2 };
+  triangles->InsertNextCell(3, triangle);
+  source->SetPolys(triangles);
+  vtkNew<vtkFloatArray> sourceNormals;
+  sourceNormals->SetNumberOfComponents(3);
+  for (int i = 0; i < 3; ++i)
+  {
+    sourceNormals->InsertNextTuple3(0.0, 0.0, 1.0);
+  }
+  source->GetPointData()->SetNormals(sourceNormals);
+
+  // A lattice of points with rotating vectors, where every fifth point is hidden
+  vtkNew<vtkPolyData> input;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  const int dim = 40;
+  for (int k = 0; k < 4; ++k)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      for (int i = 0; i < dim; ++i)
+      {
+        const vtkIdType id = points->InsertNextPoint(i, j, k);
+        vectors->InsertNextTuple3(0.01 * j - 0.2, 0.02 * i, k == 2 ? 0.0 : 0.1 * k + 0.05);
+        scalars->InsertNextValue(static_cast<float>(id));
+        ghosts->InsertNextValue(id % 5 == 0 ? vtkDataSetAttributes::HIDDENPOINT : 0);
+      }
+    }
+  }
+  input->SetPoints(points);
+  input->GetPointData()->SetVectors(vectors);
+  input->GetPointData()->SetScalars(scalars);
+  input->GetPointData()->AddArray(ghosts);
+
+  const std::string defaultBackend = vtkSMPTools::GetBackend();
+  vtkSMPTools::SetBackend("Sequential");
+  vtkSmartPointer<vtkPolyData> sequential = RunGlyph3D(input, source);
+  vtkSMPTools::SetBackend(defaultBackend.c_str());
+  vtkSmartPointer<vtkPolyData> parallel = RunGlyph3D(input, source);
+
+  const vtkIdType numGlyphs = input->GetNumberOfPoints() - input->GetNumberOfPoints() / 5;
+  if (parallel->GetNumberOfPoints() != 3 * numGlyphs || parallel->GetNumberOfCells() != numGlyphs)
+  {
+    std::cerr << "Expected " << numGlyphs << " glyphs, got " << parallel->GetNumberOfCells()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameOutputs(sequential, parallel))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Glyphs follow the order of the visible input points
+  vtkIdTypeArray* pointIds =
+    vtkIdTypeArray::SafeDownCast(parallel->GetPointData()->GetArray("InputPointIds"));
+  vtkIdType glyph = 0;
+  for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+  {
+    if (ptId % 5 == 0)
+    {
+      continue;
+    }
+    if (pointIds->GetValue(3 * glyph) != ptId || pointIds->GetValue(3 * glyph + 2) != ptId)
+    {
+      std::cerr << "Glyph " << glyph << " does not come from point " << ptId << std::endl;
+      return EXIT_FAILURE;
+    }
+    ++glyph;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPieceStreamer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Stream a sphere in pieces and check that the pieces cover the whole
+// sphere, one at a time.
+
+#include "vtkCallbackCommand.h"
+#include "vtkCommand.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPieceStreamer.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+struct Reduction
+{
+  int NumberOfPieces = 0;
+  vtkIdType NumberOfCells = 0;
+};
+
+void AccumulatePiece(vtkObject*, unsigned long, void* clientData, void* callData)
+{
+  auto reduction = static_cast<Reduction*>(clientData);
+  auto piece = static_cast<vtkPolyData*>(callData);
+  ++reduction->NumberOfPieces;
+  reduction->NumberOfCells += piece->GetNumberOfCells();
+}
+}
+
+int TestPieceStreamer(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(32);
+  sphere->SetPhiResolution(16);
+  sphere->Update();
+  const vtkIdType wholeNumberOfCells = sphere->GetOutput()->GetNumberOfCells();
+  double wholeBounds[6];
+  sphere->GetOutput()->GetBounds(wholeBounds);
+
+  const int numberOfPieces = 4;
+  vtkNew<vtkPieceStreamer> streamer;
+  streamer->SetInputConnection(sphere->GetOutputPort());
+  streamer->SetNumberOfPieces(numberOfPieces);
+
+  Reduction reduction;
+  vtkNew<vtkCallbackCommand> callback;
+  callback->SetCallback(AccumulatePiece);
+  callback->SetClientData(&reduction);
+  streamer->AddObserver(vtkCommand::UpdateDataEvent, callback);
+  streamer->Update();
+
+  if (reduction.NumberOfPieces != numberOfPieces || reduction.NumberOfCells != wholeNumberOfCells)
+  {
+    vtkLog(ERROR,
+      "Observed " << reduction.NumberOfPieces << " pieces with " << reduction.NumberOfCells
+                  << " cells instead of " << numberOfPieces << " with " << wholeNumberOfCells);
+    return EXIT_FAILURE;
+  }
+
+  vtkTable* output = streamer->GetOutput();
+  if (output->GetNumberOfRows() != numberOfPieces)
+  {
+    vtkLog(ERROR, "Wrong number of rows: " << output->GetNumberOfRows());
+    return EXIT_FAILURE;
+  }
+  auto cells = vtkIdTypeArray::SafeDownCast(output->GetColumnByName("NumberOfCells"));
+  auto bounds = vtkDoubleArray::SafeDownCast(output->GetColumnByName("Bounds"));
+  if (!cells || !bounds)
+  {
+    vtkLog(ERROR, "Missing columns");
+    return EXIT_FAILURE;
+  }
+  vtkIdType numberOfCells = 0;
+  double unionBounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+    VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+  for (vtkIdType row = 0; row < numberOfPieces; ++row)
+  {
+    numberOfCells += cells->GetValue(row);
+    if (cells->GetValue(row) >= wholeNumberOfCells)
+    {
+      vtkLog(ERROR, "Piece " << row << " is the whole sphere");
+      return EXIT_FAILURE;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      unionBounds[2 * i] = std::min(unionBounds[2 * i], bounds->GetComponent(row, 2 * i));
+      unionBounds[2 * i + 1] = std::max(unionBounds[2 * i + 1], bounds->GetComponent(row, 2 * i + 1));
+    }
+  }
+  if (numberOfCells != wholeNumberOfCells)
+  {
+    vtkLog(ERROR, "The pieces have " << numberOfCells << " cells instead of " << wholeNumberOfCells);
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < 6; ++i)
+  {
+    if (std::abs(unionBounds[i] - wholeBounds[i]) > 1e-6)
+    {
+      vtkLog(ERROR, "The pieces do not cover the bounds of the sphere");
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
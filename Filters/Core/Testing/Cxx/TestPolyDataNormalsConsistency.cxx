@@ -0,0 +1,127 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPolyDataNormalsConsistency.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkPolyDataNormals consistently orders the polygons of a mesh
+// large enough for its traversal waves to be processed in parallel.
+
+#include "vtkCellArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataNormals.h"
+#include "vtkPolygon.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+// A grid of triangles in the z = 0 plane, with about half of them reversed,
+// and a second grid translated along z and made of quads.
+vtkNew<vtkPolyData> MakeMesh(int size)
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < 2; ++k)
+  {
+    for (int j = 0; j <= size; ++j)
+    {
+      for (int i = 0; i <= size; ++i)
+      {
+        points->InsertNextPoint(i, j, 10.0 * k);
+      }
+    }
+  }
+  const vtkIdType offset = (size + 1) * (size + 1);
+  vtkNew<vtkCellArray> polys;
+  for (int j = 0; j < size; ++j)
+  {
+    for (int i = 0; i < size; ++i)
+    {
+      const vtkIdType p = j * (size + 1) + i;
+      vtkIdType t1[3] = { p, p + 1, p + size + 2 };
+      vtkIdType t2[3] = { p, p + size + 2, p + size + 1 };
+      if ((i * 7 + j * 13) % 3 == 0)
+      {
+        std::swap(t1[0], t1[1]);
+      }
+      if ((i * 5 + j * 11) % 2 == 0)
+      {
+        std::swap(t2[1], t2[2]);
+      }
+      polys->InsertNextCell(3, t1);
+      polys->InsertNextCell(3, t2);
+    }
+  }
+  for (int j = 0; j < size; ++j)
+  {
+    for (int i = 0; i < size; ++i)
+    {
+      const vtkIdType p = offset + j * (size + 1) + i;
+      vtkIdType q[4] = { p, p + 1, p + size + 2, p + size + 1 };
+      if ((i + j) % 2 == 0)
+      {
+        std::reverse(q, q + 4);
+      }
+      polys->InsertNextCell(4, q);
+    }
+  }
+  vtkNew<vtkPolyData> mesh;
+  mesh->SetPoints(points);
+  mesh->SetPolys(polys);
+  return mesh;
+}
+
+// Return true if the normals of all polygons point along sign * z.
+bool CheckOrientation(vtkPolyData* output, int sign)
+{
+  vtkIdType npts;
+  const vtkIdType* pts;
+  double n[3];
+  vtkCellArray* polys = output->GetPolys();
+  const vtkIdType numPolys = polys->GetNumberOfCells();
+  for (vtkIdType cellId = 0; cellId < numPolys; ++cellId)
+  {
+    polys->GetCellAtId(cellId, npts, pts);
+    vtkPolygon::ComputeNormal(output->GetPoints(), static_cast<int>(npts), pts, n);
+    if (sign * n[2] <= 0.0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPolyDataNormalsConsistency(int, char*[])
+{
+  vtkNew<vtkPolyData> mesh = MakeMesh(600);
+
+  // the first polygon of each grid, which seeds the traversal, is reversed
+  vtkNew<vtkPolyDataNormals> normals;
+  normals->SetInputData(mesh);
+  normals->SplittingOff();
+  normals->ConsistencyOn();
+  for (int sign : { -1, 1 })
+  {
+    normals->SetFlipNormals(sign > 0);
+    normals->Update();
+    if (!CheckOrientation(normals->GetOutput(), sign))
+    {
+      vtkLog(ERROR, "Polygons are not consistently ordered with FlipNormals " << (sign > 0));
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
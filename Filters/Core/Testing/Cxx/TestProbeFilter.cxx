@@ -14,12 +14,21 @@
 =========================================================================*/
 
 #include "vtkArrayCalculator.h"
+#include "vtkCellData.h"
+#include "vtkCellTypeSource.h"
 #include "vtkDataArray.h"
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
 #include "vtkLineSource.h"
 #include "vtkNew.h"
 #include "vtkPointData.h"
+#include "vtkPointSource.h"
+#include "vtkPoints.h"
 #include "vtkProbeFilter.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <iostream>
 
 // Gets the number of points the probe filter counted as valid.
 // The parameter should be the output of the probe filter
@@ -85,9 +94,115 @@ int TestProbeFilterThreshold()
   return (validIgnore == 2) ? 0 : 1;
 }
 
-// Currently only tests the ComputeThreshold and Threshold.  Other tests
-// should be added
+// Checks that the arrays of both outputs hold the same values.
+bool SameProbedValues(vtkDataSet* output1, vtkDataSet* output2)
+{
+  for (const char* name : { "PointField", "CellField", "vtkValidPointMask" })
+  {
+    vtkDataArray* array1 = output1->GetPointData()->GetArray(name);
+    vtkDataArray* array2 = output2->GetPointData()->GetArray(name);
+    if (!array1 || !array2 || array1->GetNumberOfTuples() != array2->GetNumberOfTuples())
+    {
+      std::cerr << "Missing or mismatching array " << name << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < array1->GetNumberOfTuples(); ++i)
+    {
+      if (std::abs(array1->GetTuple1(i) - array2->GetTuple1(i)) > 1e-12)
+      {
+        std::cerr << "Different values of " << name << " at point " << i << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Fills the source arrays with values depending on the time.
+void SetSourceValues(vtkUnstructuredGrid* source, double time)
+{
+  vtkDataArray* pointField = source->GetPointData()->GetArray("PointField");
+  for (vtkIdType i = 0; i < source->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    source->GetPoint(i, x);
+    pointField->SetTuple1(i, std::sin(x[0] + time) * x[1] + x[2] * time);
+  }
+  pointField->Modified();
+  vtkDataArray* cellField = source->GetCellData()->GetArray("CellField");
+  for (vtkIdType i = 0; i < source->GetNumberOfCells(); ++i)
+  {
+    cellField->SetTuple1(i, i * time);
+  }
+  cellField->Modified();
+}
+
+// Tests that the cached probe plan gives the same result as probing from
+// scratch when the source attributes or the meshes change.
+int TestProbeFilterCachePlan()
+{
+  vtkNew<vtkCellTypeSource> cells;
+  cells->SetCellType(VTK_TETRA);
+  cells->SetBlocksDimensions(6, 5, 4);
+  cells->Update();
+  vtkNew<vtkUnstructuredGrid> source;
+  source->ShallowCopy(cells->GetOutput());
+  vtkNew<vtkDoubleArray> pointField;
+  pointField->SetName("PointField");
+  pointField->SetNumberOfTuples(source->GetNumberOfPoints());
+  source->GetPointData()->AddArray(pointField);
+  vtkNew<vtkDoubleArray> cellField;
+  cellField->SetName("CellField");
+  cellField->SetNumberOfTuples(source->GetNumberOfCells());
+  source->GetCellData()->AddArray(cellField);
+
+  // some probe points lie outside of the source
+  vtkNew<vtkPointSource> points;
+  points->SetCenter(3.0, 2.5, 2.0);
+  points->SetRadius(3.5);
+  points->SetNumberOfPoints(2000);
+  points->Update();
+
+  vtkNew<vtkProbeFilter> cached;
+  cached->SetInputData(points->GetOutput());
+  cached->SetSourceData(source);
+  cached->CacheProbePlanOn();
+  vtkNew<vtkProbeFilter> reference;
+  reference->SetInputData(points->GetOutput());
+  reference->SetSourceData(source);
+
+  for (int step = 0; step < 4; ++step)
+  {
+    SetSourceValues(source, 0.1 * step);
+    if (step == 2)
+    {
+      // move the source mesh, the plan must be recomputed
+      vtkPoints* sourcePoints = source->GetPoints();
+      for (vtkIdType i = 0; i < sourcePoints->GetNumberOfPoints(); ++i)
+      {
+        double x[3];
+        sourcePoints->GetPoint(i, x);
+        x[0] *= 0.9;
+        sourcePoints->SetPoint(i, x);
+      }
+      sourcePoints->Modified();
+      SetSourceValues(source, 0.1 * step);
+    }
+    cached->Update();
+    reference->Update();
+    if (!SameProbedValues(cached->GetOutput(), reference->GetOutput()))
+    {
+      std::cerr << "The cached probe plan gives a different result at step " << step
+                << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
 int TestProbeFilter(int, char*[])
 {
-  return TestProbeFilterThreshold();
+  int result = TestProbeFilterThreshold();
+  result |= TestProbeFilterCachePlan();
+  return result;
 }
@@ -0,0 +1,139 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestQuadricDecimationSMP.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the threaded initialization of vtkQuadricDecimation produces
+// the same mesh as a sequential execution, and that the batched collapse
+// mode reaches the target reduction.
+
+#include <vtkCellArray.h>
+#include <vtkDataArray.h>
+#include <vtkElevationFilter.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkQuadricDecimation.h>
+#include <vtkSMPTools.h>
+#include <vtkSmartPointer.h>
+#include <vtkSphereSource.h>
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+
+const double TargetReduction = 0.8;
+
+vtkSmartPointer<vtkPolyData> Decimate(
+  vtkPolyData* input, bool attributes, bool volume, bool batched = false)
+{
+  vtkNew<vtkQuadricDecimation> decimator;
+  decimator->SetInputData(input);
+  decimator->SetTargetReduction(TargetReduction);
+  decimator->SetAttributeErrorMetric(attributes);
+  decimator->SetVolumePreservation(volume);
+  decimator->SetBatchedCollapse(batched);
+  decimator->Update();
+  if (batched && decimator->GetActualReduction() < TargetReduction)
+  {
+    std::cerr << "Batched decimation only reached a reduction of "
+              << decimator->GetActualReduction() << std::endl;
+    return nullptr;
+  }
+  return decimator->GetOutput();
+}
+
+bool SameMesh(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+    a->GetNumberOfPolys() != b->GetNumberOfPolys())
+  {
+    std::cerr << "Size mismatch: " << a->GetNumberOfPolys() << " vs " << b->GetNumberOfPolys()
+              << " triangles" << std::endl;
+    return false;
+  }
+  for (vtkIdType ptId = 0; ptId < a->GetNumberOfPoints(); ++ptId)
+  {
+    double pa[3], pb[3];
+    a->GetPoint(ptId, pa);
+    b->GetPoint(ptId, pb);
+    if (pa[0] != pb[0] || pa[1] != pb[1] || pa[2] != pb[2])
+    {
+      std::cerr << "Point " << ptId << " differs" << std::endl;
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellPoints(cellId, ptsA);
+    b->GetCellPoints(cellId, ptsB);
+    for (vtkIdType i = 0; i < ptsA->GetNumberOfIds(); ++i)
+    {
+      if (ptsA->GetId(i) != ptsB->GetId(i))
+      {
+        std::cerr << "Cell " << cellId << " differs" << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestQuadricDecimationSMP(int, char*[])
+{
+  // open sphere so that boundary constraints are exercised too
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(60);
+  sphere->SetPhiResolution(60);
+  sphere->SetStartTheta(20.0);
+  sphere->SetEndTheta(300.0);
+
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->Update();
+  vtkPolyData* input = vtkPolyData::SafeDownCast(elevation->GetOutput());
+
+  for (int options = 0; options < 4; ++options)
+  {
+    const bool attributes = (options & 1) != 0;
+    const bool volume = (options & 2) != 0;
+
+    vtkSmartPointer<vtkPolyData> sequential;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1, "Sequential", false },
+      [&]() { sequential = Decimate(input, attributes, volume); });
+    vtkSmartPointer<vtkPolyData> threaded = Decimate(input, attributes, volume);
+
+    if (!SameMesh(sequential, threaded))
+    {
+      std::cerr << "Threaded decimation differs from sequential decimation (attributes: "
+                << attributes << ", volume preservation: " << volume << ")" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // the batched mode collapses edges in a different order, but stops as
+    // soon as the target is reached, like the default mode
+    vtkSmartPointer<vtkPolyData> batched = Decimate(input, attributes, volume, true);
+    if (!batched || std::abs(batched->GetNumberOfPolys() - sequential->GetNumberOfPolys()) > 4)
+    {
+      std::cerr << "Batched decimation did not honor the target reduction (attributes: "
+                << attributes << ", volume preservation: " << volume << ")" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestSmoothPolyDataFilterJacobi.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Smooth a noisy sphere with the Jacobi iterations of vtkSmoothPolyDataFilter,
+// check that the noise is reduced as with the Gauss-Seidel iterations, and
+// that the result does not depend on the number of threads.
+
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmoothPolyDataFilter.h"
+#include "vtkSphereSource.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// standard deviation of the distance of the points to the origin
+double Roughness(vtkPolyData* polyData)
+{
+  vtkPoints* points = polyData->GetPoints();
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  double sum = 0.0, sum2 = 0.0;
+  for (vtkIdType i = 0; i < numPts; i++)
+  {
+    double x[3];
+    points->GetPoint(i, x);
+    const double r = vtkMath::Norm(x);
+    sum += r;
+    sum2 += r * r;
+  }
+  const double mean = sum / numPts;
+  return std::sqrt(std::max(0.0, sum2 / numPts - mean * mean));
+}
+}
+
+int TestSmoothPolyDataFilterJacobi(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(60);
+  sphere->SetPhiResolution(40);
+  sphere->Update();
+
+  // move the points randomly along the radius
+  vtkNew<vtkPolyData> noisy;
+  noisy->DeepCopy(sphere->GetOutput());
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(5123);
+  vtkPoints* points = noisy->GetPoints();
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); i++)
+  {
+    double x[3];
+    points->GetPoint(i, x);
+    const double scale = random->GetNextRangeValue(0.95, 1.05);
+    points->SetPoint(i, scale * x[0], scale * x[1], scale * x[2]);
+  }
+  const double noise = Roughness(noisy);
+
+  vtkNew<vtkSmoothPolyDataFilter> gaussSeidel;
+  gaussSeidel->SetInputData(noisy);
+  gaussSeidel->SetNumberOfIterations(30);
+  gaussSeidel->SetRelaxationFactor(0.2);
+  gaussSeidel->SetOutputPointsPrecision(vtkAlgorithm::DOUBLE_PRECISION);
+  gaussSeidel->Update();
+
+  vtkNew<vtkSmoothPolyDataFilter> jacobi;
+  jacobi->SetInputData(noisy);
+  jacobi->SetNumberOfIterations(30);
+  jacobi->SetRelaxationFactor(0.2);
+  jacobi->SetOutputPointsPrecision(vtkAlgorithm::DOUBLE_PRECISION);
+  jacobi->SetIterationMethodToJacobi();
+  jacobi->Update();
+
+  const double gaussSeidelRoughness = Roughness(gaussSeidel->GetOutput());
+  const double jacobiRoughness = Roughness(jacobi->GetOutput());
+  std::cout << "Roughness: noisy " << noise << ", Gauss-Seidel " << gaussSeidelRoughness
+            << ", Jacobi " << jacobiRoughness << std::endl;
+  if (gaussSeidelRoughness > 0.5 * noise || jacobiRoughness > 0.5 * noise)
+  {
+    std::cerr << "The noise was not reduced" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the Jacobi iterations do not depend on the order in which the points
+  // are processed, so the result must be the same with a single thread
+  vtkNew<vtkPolyData> reference;
+  reference->DeepCopy(jacobi->GetOutput());
+  vtkSMPTools::Initialize(1);
+  jacobi->Modified();
+  jacobi->Update();
+  vtkSMPTools::Initialize();
+  vtkPoints* result = jacobi->GetOutput()->GetPoints();
+  for (vtkIdType i = 0; i < result->GetNumberOfPoints(); i++)
+  {
+    double x[3], y[3];
+    result->GetPoint(i, x);
+    reference->GetPoints()->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      std::cerr << "Point " << i << " depends on the number of threads" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // constrained to the original sphere, the points stay on its surface
+  jacobi->SetSourceData(sphere->GetOutput());
+  jacobi->SetInputData(sphere->GetOutput());
+  jacobi->Update();
+  result = jacobi->GetOutput()->GetPoints();
+  for (vtkIdType i = 0; i < result->GetNumberOfPoints(); i++)
+  {
+    double x[3];
+    result->GetPoint(i, x);
+    if (vtkMath::Norm(x) > 0.5 + 1e-6 || vtkMath::Norm(x) < 0.49)
+    {
+      std::cerr << "Point " << i << " left the source surface" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,174 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestTriangleFilterParallel.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkTriangleFilter gives the same output with the sequential SMP
+// backend and the default one, and that triangles follow the input cells.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTriangleFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> RunTriangleFilter(vtkPolyData* input)
+{
+  vtkNew<vtkTriangleFilter> triangles;
+  triangles->SetInputData(input);
+  triangles->Update();
+  return triangles->GetOutput();
+}
+
+bool SameOutputs(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    std::cerr << "Different number of cells" << std::endl;
+    return false;
+  }
+  vtkDataArray* idsA = a->GetCellData()->GetArray("CellIds");
+  vtkDataArray* idsB = b->GetCellData()->GetArray("CellIds");
+  vtkNew<vtkIdList> cellA;
+  vtkNew<vtkIdList> cellB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellPoints(cellId, cellA);
+    b->GetCellPoints(cellId, cellB);
+    bool same = cellA->GetNumberOfIds() == cellB->GetNumberOfIds() &&
+      idsA->GetComponent(cellId, 0) == idsB->GetComponent(cellId, 0);
+    for (vtkIdType i = 0; same && i < cellA->GetNumberOfIds(); ++i)
+    {
+      same = cellA->GetId(i) == cellB->GetId(i);
+    }
+    if (!same)
+    {
+      std::cerr << "Cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestTriangleFilterParallel(int, char*[])
+{
+  // A grid of triangles, quads and hexagons, plus a poly-vertex, a polyline
+  // and a strip
+  const int dim = 60;
+  vtkNew<vtkPolyData> input;
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j <= dim; ++j)
+  {
+    for (int i = 0; i <= 2 * dim; ++i)
+    {
+      points->InsertNextPoint(0.5 * i, j, 0.01 * ((i * j) % 7));
+    }
+  }
+  input->SetPoints(points);
+  const vtkIdType row = 2 * dim + 1;
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  vtkIdType numTriangles = 0;
+  for (vtkIdType j = 0; j < dim; ++j)
+  {
+    for (vtkIdType i = 0; i < dim; ++i)
+    {
+      const vtkIdType p = j * row + 2 * i;
+      switch ((i + j) % 3)
+      {
+        case 0:
+        {
+          const vtkIdType triangle[3] = { p, p + 2, p + row + 2 };
+          polys->InsertNextCell(3, triangle);
+          numTriangles += 1;
+          break;
+        }
+        case 1:
+        {
+          const vtkIdType quad[4] = { p, p + 2, p + row + 2, p + row };
+          polys->InsertNextCell(4, quad);
+          numTriangles += 2;
+          break;
+        }
+        default:
+        {
+          const vtkIdType hexagon[6] = { p, p + 1, p + 2, p + row + 2, p + row + 1, p + row };
+          polys->InsertNextCell(6, hexagon);
+          numTriangles += 4;
+          break;
+        }
+      }
+    }
+  }
+  input->SetPolys(polys);
+  vtkNew<vtkCellArray> verts;
+  const vtkIdType polyVertex[3] = { 0, 1, 2 };
+  verts->InsertNextCell(3, polyVertex);
+  input->SetVerts(verts);
+  vtkNew<vtkCellArray> lines;
+  const vtkIdType polyLine[4] = { 0, 1, 2, 3 };
+  lines->InsertNextCell(4, polyLine);
+  input->SetLines(lines);
+  vtkNew<vtkCellArray> strips;
+  const vtkIdType strip[5] = { 0, row, 1, row + 1, 2 };
+  strips->InsertNextCell(5, strip);
+  input->SetStrips(strips);
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    cellIds->InsertNextValue(static_cast<int>(cellId));
+  }
+  input->GetCellData()->AddArray(cellIds);
+
+  const std::string defaultBackend = vtkSMPTools::GetBackend();
+  vtkSMPTools::SetBackend("Sequential");
+  vtkSmartPointer<vtkPolyData> sequential = RunTriangleFilter(input);
+  vtkSMPTools::SetBackend(defaultBackend.c_str());
+  vtkSmartPointer<vtkPolyData> parallel = RunTriangleFilter(input);
+
+  // 3 vertices, 3 line segments, the triangles of the polygons and 3 of the
+  // strip
+  if (parallel->GetNumberOfCells() != numTriangles + 9)
+  {
+    std::cerr << "Expected " << numTriangles + 9 << " cells, got " << parallel->GetNumberOfCells()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameOutputs(sequential, parallel))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Triangles follow the order of the input polygons
+  vtkDataArray* outCellIds = parallel->GetCellData()->GetArray("CellIds");
+  for (vtkIdType cellId = 1; cellId < parallel->GetNumberOfCells(); ++cellId)
+  {
+    if (outCellIds->GetComponent(cellId, 0) < outCellIds->GetComponent(cellId - 1, 0))
+    {
+      std::cerr << "Cell " << cellId << " is out of order" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
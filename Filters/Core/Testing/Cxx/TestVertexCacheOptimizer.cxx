@@ -0,0 +1,186 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestVertexCacheOptimizer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkIdTypeArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkVertexCacheOptimizer.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Return the coordinates of the points of the triangle, starting from its
+// smallest point, to compare triangles whatever the numbering of the points.
+std::array<double, 9> TriangleKey(vtkPolyData* polyData, vtkIdType cellId)
+{
+  vtkIdType npts;
+  const vtkIdType* pts;
+  polyData->GetCellPoints(cellId, npts, pts);
+  std::array<std::array<double, 3>, 3> x;
+  for (int i = 0; i < 3; ++i)
+  {
+    polyData->GetPoint(pts[i], x[i].data());
+  }
+  std::rotate(x.begin(), std::min_element(x.begin(), x.end()), x.end());
+  std::array<double, 9> key;
+  for (int i = 0; i < 9; ++i)
+  {
+    key[i] = x[i / 3][i % 3];
+  }
+  return key;
+}
+}
+
+int TestVertexCacheOptimizer(int, char*[])
+{
+  // Triangulate a grid, and shuffle its points and its triangles.
+  const int resolution = 100;
+  const vtkIdType numPts = (resolution + 1) * (resolution + 1);
+  std::mt19937 random(0);
+  std::vector<vtkIdType> pointIds(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    pointIds[i] = i;
+  }
+  std::shuffle(pointIds.begin(), pointIds.end(), random);
+
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkIdTypeArray> pointTags;
+  pointTags->SetName("PointTags");
+  pointTags->SetNumberOfValues(numPts);
+  for (int j = 0; j <= resolution; ++j)
+  {
+    for (int i = 0; i <= resolution; ++i)
+    {
+      const vtkIdType id = pointIds[j * (resolution + 1) + i];
+      points->SetPoint(id, i, j, 0.);
+      pointTags->SetValue(id, j * (resolution + 1) + i);
+    }
+  }
+
+  std::vector<std::array<vtkIdType, 3>> triangles;
+  for (int j = 0; j < resolution; ++j)
+  {
+    for (int i = 0; i < resolution; ++i)
+    {
+      const vtkIdType p = j * (resolution + 1) + i;
+      const vtkIdType q = p + resolution + 1;
+      triangles.push_back({ pointIds[p], pointIds[p + 1], pointIds[q + 1] });
+      triangles.push_back({ pointIds[p], pointIds[q + 1], pointIds[q] });
+    }
+  }
+  // Batches of triangles are optimized independently: only shuffle the
+  // triangles of each row of the grid, so that batches remain compact.
+  for (auto row = triangles.begin(); row != triangles.end(); row += 2 * resolution)
+  {
+    std::shuffle(row, row + 2 * resolution, random);
+  }
+
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkIdTypeArray> cellTags;
+  cellTags->SetName("CellTags");
+  for (const auto& triangle : triangles)
+  {
+    polys->InsertNextCell(3, triangle.data());
+  }
+  // A quad, output after the triangles.
+  const vtkIdType quad[4] = { pointIds[0], pointIds[1], pointIds[resolution + 2],
+    pointIds[resolution + 1] };
+  polys->InsertNextCell(4, quad);
+  for (vtkIdType cellId = 0; cellId < polys->GetNumberOfCells(); ++cellId)
+  {
+    cellTags->InsertNextValue(cellId);
+  }
+
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->SetPolys(polys);
+  input->GetPointData()->AddArray(pointTags);
+  input->GetCellData()->AddArray(cellTags);
+
+  vtkNew<vtkVertexCacheOptimizer> optimizer;
+  optimizer->SetInputData(input);
+  optimizer->SetBatchSize(5000);
+  optimizer->Update();
+  vtkPolyData* output = optimizer->GetOutput();
+
+  const double inputRatio = vtkVertexCacheOptimizer::ComputeAverageCacheMissRatio(input);
+  const double outputRatio = vtkVertexCacheOptimizer::ComputeAverageCacheMissRatio(output);
+  std::cout << "ACMR: " << inputRatio << " -> " << outputRatio << std::endl;
+  if (outputRatio > 0.8 || outputRatio > 0.5 * inputRatio)
+  {
+    std::cerr << "The triangles are not ordered for the vertex cache." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (output->GetNumberOfPoints() != numPts ||
+    output->GetNumberOfPolys() != input->GetNumberOfPolys())
+  {
+    std::cerr << "Wrong number of points or polygons." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The point data follows the points.
+  auto outPointTags =
+    vtkIdTypeArray::SafeDownCast(output->GetPointData()->GetArray("PointTags"));
+  for (vtkIdType id = 0; id < numPts; ++id)
+  {
+    double x[3];
+    output->GetPoint(id, x);
+    const vtkIdType tag = outPointTags->GetValue(id);
+    if (x[0] != tag % (resolution + 1) || x[1] != tag / (resolution + 1))
+    {
+      std::cerr << "Wrong point data for point " << id << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Each polygon is the input polygon of its cell data, and the triangles are
+  // all there.
+  auto outCellTags = vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("CellTags"));
+  std::vector<bool> found(input->GetNumberOfPolys(), false);
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfPolys(); ++cellId)
+  {
+    const vtkIdType tag = outCellTags->GetValue(cellId);
+    if (found[tag] || output->GetCellSize(cellId) != input->GetCellSize(tag))
+    {
+      std::cerr << "Wrong cell data for cell " << cellId << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+    found[tag] = true;
+    if (output->GetCellSize(cellId) == 3 &&
+      TriangleKey(output, cellId) != TriangleKey(input, tag))
+    {
+      std::cerr << "Cell " << cellId << " is not input cell " << tag << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (outCellTags->GetValue(output->GetNumberOfPolys() - 1) != input->GetNumberOfPolys() - 1)
+  {
+    std::cerr << "The quad is not the last polygon." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
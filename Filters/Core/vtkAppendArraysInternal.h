@@ -0,0 +1,155 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAppendArraysInternal.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkAppendArraysInternal
+ * @brief   concatenate the arrays of appended datasets without copying them
+ *
+ * vtkAppendArraysInternal gathers the helpers used by vtkAppendFilter and
+ * vtkAppendPolyData to present the arrays of their inputs as vtkCompositeArray
+ * instances instead of copying them into the output. Building such an array
+ * only costs a lookup per input; the values are read from the input arrays on
+ * demand, and a contiguous copy is only made if a consumer requests a raw
+ * pointer to the data.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkAppendFilter vtkAppendPolyData vtkCompositeArray
+ */
+
+#ifndef vtkAppendArraysInternal_h
+#define vtkAppendArraysInternal_h
+
+#include "vtkCompositeArray.h" // For vtk::ConcatenateDataArrays
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkSmartPointer.h"
+
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Concatenate arrays of the same value type and number of components into a
+// vtkCompositeArray. Returns nullptr when the arrays do not match or are too
+// large to be indexed by the composite array.
+vtkSmartPointer<vtkDataArray> ConcatenateArrays(const std::vector<vtkDataArray*>& arrays)
+{
+  if (arrays.empty())
+  {
+    return nullptr;
+  }
+  const int dataType = arrays[0]->GetDataType();
+  const int numComps = arrays[0]->GetNumberOfComponents();
+  vtkIdType numValues = 0;
+  for (vtkDataArray* array : arrays)
+  {
+    if (!array || array->GetDataType() != dataType || array->GetNumberOfComponents() != numComps)
+    {
+      return nullptr;
+    }
+    numValues += array->GetNumberOfValues();
+  }
+  if (numValues >= VTK_INT_MAX)
+  {
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkDataArray> composite;
+  switch (dataType)
+  {
+    vtkTemplateMacro(composite = vtk::ConcatenateDataArrays<VTK_TT>(arrays));
+    default:
+      return nullptr;
+  }
+  if (composite)
+  {
+    composite->SetName(arrays[0]->GetName());
+    composite->CopyComponentNames(arrays[0]);
+  }
+  return composite;
+}
+
+//------------------------------------------------------------------------------
+// Replace every array of output, allocated with CopyAllocate() from a
+// vtkDataSetAttributes::FieldList built over inputs, by the concatenation of
+// the matching input arrays. Named arrays are matched by name and unnamed ones
+// by attribute type. If one of the arrays cannot be concatenated, for instance
+// a vtkStringArray, output is left unchanged and false is returned: its arrays
+// then have to be filled by copying.
+bool ConcatenateAttributes(vtkDataSetAttributes* output,
+  const std::vector<vtkDataSetAttributes*>& inputs, vtkIdType numberOfTuples)
+{
+  const int numArrays = output->GetNumberOfArrays();
+  std::vector<vtkSmartPointer<vtkDataArray>> composites(numArrays);
+  std::vector<int> attributes(numArrays);
+  for (int arrayIdx = 0; arrayIdx < numArrays; ++arrayIdx)
+  {
+    vtkAbstractArray* outArray = output->GetAbstractArray(arrayIdx);
+    const char* name = outArray->GetName();
+    attributes[arrayIdx] = output->IsArrayAnAttribute(arrayIdx);
+    if (!name && attributes[arrayIdx] < 0)
+    {
+      return false;
+    }
+
+    std::vector<vtkDataArray*> arrays;
+    arrays.reserve(inputs.size());
+    for (vtkDataSetAttributes* input : inputs)
+    {
+      vtkAbstractArray* inArray =
+        name ? input->GetAbstractArray(name) : input->GetAbstractAttribute(attributes[arrayIdx]);
+      arrays.push_back(vtkDataArray::SafeDownCast(inArray));
+      if (!arrays.back() || arrays.back()->GetDataType() != outArray->GetDataType())
+      {
+        return false;
+      }
+    }
+    composites[arrayIdx] = ConcatenateArrays(arrays);
+    if (!composites[arrayIdx] || composites[arrayIdx]->GetNumberOfTuples() != numberOfTuples)
+    {
+      return false;
+    }
+    composites[arrayIdx]->SetName(name);
+  }
+
+  // Named arrays replace the output arrays in place and keep their attribute
+  // flags, unnamed ones are attributes and are set as such.
+  for (int arrayIdx = 0; arrayIdx < numArrays; ++arrayIdx)
+  {
+    if (composites[arrayIdx]->GetName())
+    {
+      output->AddArray(composites[arrayIdx]);
+    }
+  }
+  for (int arrayIdx = 0; arrayIdx < numArrays; ++arrayIdx)
+  {
+    if (!composites[arrayIdx]->GetName())
+    {
+      output->SetAttribute(composites[arrayIdx], attributes[arrayIdx]);
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+#endif // vtkAppendArraysInternal_h
+// VTK-HeaderTest-Exclude: vtkAppendArraysInternal.h
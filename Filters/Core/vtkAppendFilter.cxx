@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkAppendFilter.h"
 
+#include "vtkAppendArraysInternal.h"
 #include "vtkBoundingBox.h"
 #include "vtkCell.h"
 #include "vtkCellData.h"
@@ -25,12 +26,14 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkAppendFilter);
@@ -43,6 +46,7 @@ vtkAppendFilter::vtkAppendFilter()
   this->OutputPointsPrecision = DEFAULT_PRECISION;
   this->Tolerance = 0.0;
   this->ToleranceIsAbsolute = true;
+  this->UseImplicitArrays = false;
 }
 
 //------------------------------------------------------------------------------
@@ -226,8 +230,37 @@ int vtkAppendFilter::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
+  // When they all have the output type, the input points can be referenced
+  // by a composite array rather than copied.
+  bool concatenatedPoints = false;
+  if (this->UseImplicitArrays && !reallyMergePoints)
+  {
+    std::vector<vtkDataArray*> pointArrays;
+    bool havePointSets = true;
+    inputs->InitTraversal(iter);
+    while (havePointSets && (dataSet = inputs->GetNextDataSet(iter)))
+    {
+      vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataSet);
+      if (pointSet && pointSet->GetPoints())
+      {
+        pointArrays.push_back(pointSet->GetPoints()->GetData());
+      }
+      else
+      {
+        havePointSets = dataSet->GetNumberOfPoints() == 0;
+      }
+    }
+    vtkSmartPointer<vtkDataArray> points =
+      havePointSets ? ConcatenateArrays(pointArrays) : nullptr;
+    if (points && points->GetDataType() == newPts->GetDataType())
+    {
+      newPts->SetData(points);
+      concatenatedPoints = true;
+    }
+  }
+
   // If we aren't merging points, we need to allocate the points here.
-  if (!reallyMergePoints)
+  if (!reallyMergePoints && !concatenatedPoints)
   {
     newPts->SetNumberOfPoints(totalNumPts);
   }
@@ -320,8 +353,11 @@ int vtkAppendFilter::RequestData(vtkInformation* vtkNotUsed(request),
       else
       {
         globalIndices[ptId + ptOffset] = ptId + ptOffset;
-        dataSet->GetPoint(ptId, p);
-        newPts->SetPoint(ptId + ptOffset, p);
+        if (!concatenatedPoints)
+        {
+          dataSet->GetPoint(ptId, p);
+          newPts->SetPoint(ptId + ptOffset, p);
+        }
       }
 
       // Update progress
@@ -389,9 +425,9 @@ int vtkAppendFilter::RequestData(vtkInformation* vtkNotUsed(request),
   }
   output->GetCellData()->CopyAllOn(vtkDataSetAttributes::COPYTUPLE);
 
-  // Now copy the array data
-  this->AppendArrays(
-    vtkDataObject::POINT, inputVector, globalIndices, output, newPts->GetNumberOfPoints());
+  // Now copy the array data. Without merging, points are appended in order.
+  this->AppendArrays(vtkDataObject::POINT, inputVector, reallyMergePoints ? globalIndices : nullptr,
+    output, newPts->GetNumberOfPoints());
   this->UpdateProgress(0.75);
   this->AppendArrays(vtkDataObject::CELL, inputVector, nullptr, output, output->GetNumberOfCells());
   this->UpdateProgress(1.0);
@@ -458,6 +494,24 @@ void vtkAppendFilter::AppendArrays(int attributesType, vtkInformationVector** in
   vtkDataSetAttributes* outputData = output->GetAttributes(attributesType);
   outputData->CopyAllocate(fieldList, totalNumberOfElements);
 
+  // Without a point map, the input arrays are appended one after the other
+  // and may be referenced by composite arrays rather than copied.
+  if (this->UseImplicitArrays && globalIds == nullptr)
+  {
+    std::vector<vtkDataSetAttributes*> inputsData;
+    for (inputs->InitTraversal(iter); (dataSet = inputs->GetNextDataSet(iter));)
+    {
+      if (auto inputData = dataSet->GetAttributes(attributesType))
+      {
+        inputsData.push_back(inputData);
+      }
+    }
+    if (ConcatenateAttributes(outputData, inputsData, totalNumberOfElements))
+    {
+      return;
+    }
+  }
+
   // copy arrays.
   int inputIndex;
   vtkIdType offset = 0;
@@ -521,5 +575,6 @@ void vtkAppendFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "MergePoints:" << (this->MergePoints ? "On" : "Off") << "\n";
   os << indent << "OutputPointsPrecision: " << this->OutputPointsPrecision << "\n";
   os << indent << "Tolerance: " << this->Tolerance << "\n";
+  os << indent << "UseImplicitArrays: " << (this->UseImplicitArrays ? "On" : "Off") << "\n";
 }
 VTK_ABI_NAMESPACE_END
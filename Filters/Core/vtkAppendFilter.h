@@ -113,6 +113,22 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * When on, the output points and attribute arrays are vtkCompositeArray
+   * instances that reference the input arrays instead of copies of them, so
+   * appending many inputs only costs a lookup per input and array. Values are
+   * then read from the inputs on demand, and a contiguous copy is only made
+   * when a consumer asks for a raw pointer to the data. Points of differing
+   * types, and point or cell data holding arrays that cannot be concatenated
+   * (such as string arrays), are copied as usual. Nothing is concatenated when
+   * points are merged. Connectivity is always copied. Default is off.
+   */
+  vtkSetMacro(UseImplicitArrays, bool);
+  vtkGetMacro(UseImplicitArrays, bool);
+  vtkBooleanMacro(UseImplicitArrays, bool);
+  ///@}
+
 protected:
   vtkAppendFilter();
   ~vtkAppendFilter() override;
@@ -137,6 +153,8 @@ protected:
   // the diagonal of the bounding box of the input.
   bool ToleranceIsAbsolute;
 
+  bool UseImplicitArrays;
+
 private:
   vtkAppendFilter(const vtkAppendFilter&) = delete;
   void operator=(const vtkAppendFilter&) = delete;
@@ -15,6 +15,7 @@
 #include "vtkAppendPolyData.h"
 
 #include "vtkAlgorithmOutput.h"
+#include "vtkAppendArraysInternal.h"
 #include "vtkArrayDispatch.h"
 #include "vtkAssume.h"
 #include "vtkCellArray.h"
@@ -31,6 +32,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkAppendPolyData);
@@ -41,6 +43,7 @@ vtkAppendPolyData::vtkAppendPolyData()
   this->ParallelStreaming = 0;
   this->UserManagedInputs = 0;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
+  this->UseImplicitArrays = false;
 }
 
 //------------------------------------------------------------------------------
@@ -286,7 +289,31 @@ int vtkAppendPolyData::ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[],
     newPts->SetDataType(VTK_DOUBLE);
   }
 
-  newPts->SetNumberOfPoints(numPts);
+  // When they all have the output type, the input points can be referenced
+  // by a composite array rather than copied.
+  bool concatenatedPoints = false;
+  if (this->UseImplicitArrays)
+  {
+    std::vector<vtkDataArray*> pointArrays;
+    for (idx = 0; idx < numInputs; ++idx)
+    {
+      ds = inputs[idx];
+      if (ds != nullptr && ds->GetNumberOfPoints() > 0)
+      {
+        pointArrays.push_back(ds->GetPoints()->GetData());
+      }
+    }
+    vtkSmartPointer<vtkDataArray> points = ConcatenateArrays(pointArrays);
+    if (points && points->GetDataType() == newPts->GetDataType())
+    {
+      newPts->SetData(points);
+      concatenatedPoints = true;
+    }
+  }
+  if (!concatenatedPoints)
+  {
+    newPts->SetNumberOfPoints(numPts);
+  }
 
   newVerts = vtkCellArray::New();
   bool allocated = newVerts->AllocateExact(numVerts, sizeVerts);
@@ -333,6 +360,34 @@ int vtkAppendPolyData::ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[],
   outputPD->CopyAllocate(ptList, numPts);
   outputCD->CopyAllocate(cellList, numCells);
 
+  bool concatenatedPointData = false;
+  bool concatenatedCellData = false;
+  if (this->UseImplicitArrays)
+  {
+    std::vector<vtkDataSetAttributes*> pointData;
+    std::vector<vtkDataSetAttributes*> cellData;
+    for (idx = 0; idx < numInputs; ++idx)
+    {
+      ds = inputs[idx];
+      if (ds != nullptr && ds->GetNumberOfPoints() > 0)
+      {
+        pointData.push_back(ds->GetPointData());
+      }
+      if (ds != nullptr && ds->GetNumberOfCells() > 0)
+      {
+        cellData.push_back(ds->GetCellData());
+      }
+    }
+    concatenatedPointData = ConcatenateAttributes(outputPD, pointData, numPts);
+    // The output groups the cells by kind, so it only keeps the order of the
+    // input cells when they are all of the same kind.
+    if (numVerts == numCells || numLines == numCells || numPolys == numCells ||
+      numStrips == numCells)
+    {
+      concatenatedCellData = ConcatenateAttributes(outputCD, cellData, numCells);
+    }
+  }
+
   // loop over all input sets
   vtkIdType ptOffset = 0;
   vtkIdType vertOffset = 0;
@@ -371,8 +426,14 @@ int vtkAppendPolyData::ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[],
       if (ds->GetNumberOfPoints() > 0)
       {
         // copy points directly
-        this->AppendData(newPts->GetData(), inPts->GetData(), ptOffset);
-        outputPD->CopyData(ptList, inPD, countPD, ptOffset, numPts, 0);
+        if (!concatenatedPoints)
+        {
+          this->AppendData(newPts->GetData(), inPts->GetData(), ptOffset);
+        }
+        if (!concatenatedPointData)
+        {
+          outputPD->CopyData(ptList, inPD, countPD, ptOffset, numPts, 0);
+        }
         ++countPD;
       }
 
@@ -391,16 +452,20 @@ int vtkAppendPolyData::ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[],
         this->AppendCells(newStrips, inStrips, ptOffset);
 
         // copy cell data
-        outputCD->CopyData(cellList, inCD, countCD, vertOffset, ds->GetNumberOfVerts(), vertsIndex);
+        if (!concatenatedCellData)
+        {
+          outputCD->CopyData(
+            cellList, inCD, countCD, vertOffset, ds->GetNumberOfVerts(), vertsIndex);
+          outputCD->CopyData(
+            cellList, inCD, countCD, linesOffset, ds->GetNumberOfLines(), linesIndex);
+          outputCD->CopyData(
+            cellList, inCD, countCD, polysOffset, ds->GetNumberOfPolys(), polysIndex);
+          outputCD->CopyData(
+            cellList, inCD, countCD, stripsOffset, ds->GetNumberOfStrips(), stripsIndex);
+        }
         vertOffset += ds->GetNumberOfVerts();
-        outputCD->CopyData(
-          cellList, inCD, countCD, linesOffset, ds->GetNumberOfLines(), linesIndex);
         linesOffset += ds->GetNumberOfLines();
-        outputCD->CopyData(
-          cellList, inCD, countCD, polysOffset, ds->GetNumberOfPolys(), polysIndex);
         polysOffset += ds->GetNumberOfPolys();
-        outputCD->CopyData(
-          cellList, inCD, countCD, stripsOffset, ds->GetNumberOfStrips(), stripsIndex);
         stripsOffset += ds->GetNumberOfStrips();
         ++countCD;
       }
@@ -549,6 +614,7 @@ void vtkAppendPolyData::PrintSelf(ostream& os, vtkIndent indent)
   os << "ParallelStreaming:" << (this->ParallelStreaming ? "On" : "Off") << endl;
   os << "UserManagedInputs:" << (this->UserManagedInputs ? "On" : "Off") << endl;
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << endl;
+  os << indent << "UseImplicitArrays: " << (this->UseImplicitArrays ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -121,6 +121,24 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * When on, the output points and attribute arrays are vtkCompositeArray
+   * instances that reference the input arrays instead of copies of them, so
+   * appending many inputs only costs a lookup per input and array. Values are
+   * then read from the inputs on demand, and a contiguous copy is only made
+   * when a consumer asks for a raw pointer to the data. Points of differing
+   * types, and point or cell data holding arrays that cannot be concatenated
+   * (such as string arrays), are copied as usual. Cell data is only
+   * concatenated when all the cells are of the same kind (vertices, lines,
+   * polygons or strips), since the output orders cells by kind first.
+   * Connectivity is always copied. Default is off.
+   */
+  vtkSetMacro(UseImplicitArrays, bool);
+  vtkGetMacro(UseImplicitArrays, bool);
+  vtkBooleanMacro(UseImplicitArrays, bool);
+  ///@}
+
   int ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[], int numInputs)
     VTK_SIZEHINT(inputs, numInputs);
 
@@ -131,6 +149,7 @@ protected:
   // Flag for selecting parallel streaming behavior
   vtkTypeBool ParallelStreaming;
   int OutputPointsPrecision;
+  bool UseImplicitArrays;
 
   // Usual data generation method
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
@@ -14,10 +14,13 @@
 =========================================================================*/
 #include "vtkArrayCalculator.h"
 
+#include "vtkAffineArray.h"
 #include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkConstantArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
 #include "vtkExprTkFunctionParser.h"
@@ -35,6 +38,10 @@
 #include "vtkTable.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkArrayCalculator);
@@ -60,6 +67,7 @@ vtkArrayCalculator::vtkArrayCalculator()
   this->CoordinateResults = 0;
   this->ResultNormals = false;
   this->ResultTCoords = false;
+  this->ImplicitResults = false;
   this->ReplaceInvalidValues = 0;
   this->ReplacementValue = 0.0;
   this->IgnoreMissingArrays = false;
@@ -105,6 +113,100 @@ enum ResultType
   VECTOR_RESULT
 } resultType = SCALAR_RESULT;
 
+//------------------------------------------------------------------------------
+// Copy the given components of a range of tuples of an array, interleaved in
+// values, dispatching the array once for the whole range.
+struct vtkArrayCalculatorGatherWorker
+{
+  template <typename TArray>
+  void operator()(TArray* array, vtkIdType begin, vtkIdType end, const int* components,
+    int numberOfComponents, double* values)
+  {
+    for (const auto tuple : vtk::DataArrayTupleRange(array, begin, end))
+    {
+      for (int c = 0; c < numberOfComponents; ++c)
+      {
+        *values++ = static_cast<double>(tuple[components[c]]);
+      }
+    }
+  }
+};
+
+void vtkArrayCalculatorGather(vtkDataArray* array, vtkIdType begin, vtkIdType end,
+  const int* components, int numberOfComponents, double* values)
+{
+  vtkArrayCalculatorGatherWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(
+        array, worker, begin, end, components, numberOfComponents, values))
+  {
+    worker(array, begin, end, components, numberOfComponents, values);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Create a vtkConstantArray of the given number of tuples holding the first
+// tuple of an array, if all its components are equal.
+struct vtkArrayCalculatorConstantWorker
+{
+  template <typename TArray>
+  void operator()(TArray* array, vtkIdType numTuples, vtkSmartPointer<vtkDataArray>& result)
+  {
+    using ValueType = vtk::GetAPIType<TArray>;
+    const auto tuple = vtk::DataArrayTupleRange(array, 0, 1)[0];
+    const ValueType value = tuple[0];
+    if (!std::all_of(
+          tuple.begin(), tuple.end(), [value](ValueType component) { return component == value; }))
+    {
+      return;
+    }
+    vtkNew<vtkConstantArray<ValueType>> constantArray;
+    constantArray->SetBackend(std::make_shared<vtkConstantImplicitBackend<ValueType>>(value));
+    constantArray->SetNumberOfComponents(array->GetNumberOfComponents());
+    constantArray->SetNumberOfTuples(numTuples);
+    result = constantArray;
+  }
+};
+
+//------------------------------------------------------------------------------
+// Create a vtkAffineArray holding the values of an array, if they are exactly
+// an affine function of their index.
+struct vtkArrayCalculatorAffineWorker
+{
+  template <typename TArray>
+  void operator()(TArray* array, vtkSmartPointer<vtkDataArray>& result)
+  {
+    using ValueType = vtk::GetAPIType<TArray>;
+    const auto values = vtk::DataArrayValueRange(array);
+    const vtkIdType numValues = values.size();
+    // The backend takes the index of the values as an int
+    if (numValues < 2 || numValues > VTK_INT_MAX)
+    {
+      return;
+    }
+    auto backend = std::make_shared<vtkAffineImplicitBackend<ValueType>>(
+      static_cast<ValueType>(values[1] - values[0]), values[0]);
+    std::atomic<bool> isAffine(true);
+    vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end && isAffine.load(std::memory_order_relaxed); ++i)
+      {
+        if (values[i] != (*backend)(static_cast<int>(i)))
+        {
+          isAffine = false;
+        }
+      }
+    });
+    if (!isAffine)
+    {
+      return;
+    }
+    vtkNew<vtkAffineArray<ValueType>> affineArray;
+    affineArray->SetBackend(backend);
+    affineArray->SetNumberOfComponents(array->GetNumberOfComponents());
+    affineArray->SetNumberOfTuples(array->GetNumberOfTuples());
+    result = affineArray;
+  }
+};
+
 //------------------------------------------------------------------------------
 template <typename TFunctionParser, typename TResultArray>
 class vtkArrayCalculatorFunctor
@@ -143,9 +245,17 @@ private:
 
   TResultArray* ResultArray;
 
+  // The input values are gathered by blocks of tuples, to read the arrays
+  // with a single dispatch per block instead of a virtual call per tuple.
+  static constexpr vtkIdType BlockSize = 256;
+  bool UseCoordinates;
+  vtkDataArray* Points;
+  int BlockTupleSize;
+
   // // thread local
   vtkSMPThreadLocal<vtkSmartPointer<TFunctionParser>> FunctionParser;
   vtkSMPThreadLocal<std::vector<double>> Tuple;
+  vtkSMPThreadLocal<std::vector<double>> Block;
   int MaxTupleSize;
 
 public:
@@ -209,6 +319,22 @@ public:
         this->MaxTupleSize = std::max(this->MaxTupleSize, vectorArray->GetNumberOfComponents());
       }
     }
+
+    this->UseCoordinates =
+      (this->AttributeType == vtkDataObject::POINT ||
+        this->AttributeType == vtkDataObject::VERTEX) &&
+      (this->CoordinateScalarVariableNamesSize > 0 || this->CoordinateVectorVariableNamesSize > 0);
+    vtkPointSet* pointSet = vtkPointSet::SafeDownCast(this->DsInput);
+    this->Points = pointSet && pointSet->GetPoints() ? pointSet->GetPoints()->GetData() : nullptr;
+    this->BlockTupleSize = this->UseCoordinates ? 3 : 0;
+    for (vtkDataArray* array : this->ScalarArrays)
+    {
+      this->BlockTupleSize += array ? 1 : 0;
+    }
+    for (vtkDataArray* array : this->VectorArrays)
+    {
+      this->BlockTupleSize += array ? 3 : 0;
+    }
   }
 
   /**
@@ -218,6 +344,7 @@ public:
   {
     auto& functionParser = this->FunctionParser.Local();
     this->Tuple.Local().resize(static_cast<size_t>(this->MaxTupleSize));
+    this->Block.Local().resize(static_cast<size_t>(BlockSize * this->BlockTupleSize));
     auto tuple = this->Tuple.Local().data();
     int i;
 
@@ -331,67 +458,106 @@ public:
   {
     auto resultArrayItr = vtk::DataArrayTupleRange(this->ResultArray, begin, end).begin();
     auto& functionParser = this->FunctionParser.Local();
-    auto tuple = this->Tuple.Local().data();
-    vtkDataArray* currentArray;
+    double* block = this->Block.Local().data();
+    static const int xyz[3] = { 0, 1, 2 };
     int j = 0;
 
-    for (vtkIdType i = begin; i < end; i++, resultArrayItr++)
+    for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += BlockSize)
     {
+      const vtkIdType blockEnd = std::min(blockBegin + BlockSize, end);
+      const vtkIdType blockLength = blockEnd - blockBegin;
+
+      // Gather the values of the variables for the tuples of the block
+      double* values = block;
       for (j = 0; j < this->ScalarArrayNamesSize; j++)
       {
-        if ((currentArray = this->ScalarArrays[j]))
+        if (vtkDataArray* currentArray = this->ScalarArrays[j])
         {
-          currentArray->GetTuple(i, tuple);
-          functionParser->SetScalarVariableValue(
-            this->ScalarArrayIndices[j], tuple[this->SelectedScalarComponents[j]]);
+          vtkArrayCalculatorGather(
+            currentArray, blockBegin, blockEnd, &this->SelectedScalarComponents[j], 1, values);
+          values += blockLength;
         }
       }
       for (j = 0; j < this->VectorArrayNamesSize; j++)
       {
-        if ((currentArray = this->VectorArrays[j]))
+        if (vtkDataArray* currentArray = this->VectorArrays[j])
         {
-          currentArray->GetTuple(i, tuple);
-          functionParser->SetVectorVariableValue(this->VectorArrayIndices[j],
-            tuple[this->SelectedVectorComponents[j][0]],
-            tuple[this->SelectedVectorComponents[j][1]],
-            tuple[this->SelectedVectorComponents[j][2]]);
+          vtkArrayCalculatorGather(currentArray, blockBegin, blockEnd,
+            this->SelectedVectorComponents[j].GetData(), 3, values);
+          values += 3 * blockLength;
         }
       }
-      if (this->AttributeType == vtkDataObject::POINT ||
-        this->AttributeType == vtkDataObject::VERTEX)
+      if (this->UseCoordinates)
       {
-        double pt[3];
-        if (this->DsInput)
+        if (this->Points)
         {
-          this->DsInput->GetPoint(i, pt);
+          vtkArrayCalculatorGather(this->Points, blockBegin, blockEnd, xyz, 3, values);
         }
         else
         {
-          this->GraphInput->GetPoint(i, pt);
+          for (vtkIdType i = blockBegin; i < blockEnd; i++)
+          {
+            double* pt = values + 3 * (i - blockBegin);
+            if (this->DsInput)
+            {
+              this->DsInput->GetPoint(i, pt);
+            }
+            else
+            {
+              this->GraphInput->GetPoint(i, pt);
+            }
+          }
         }
-        for (j = 0; j < this->CoordinateScalarVariableNamesSize; j++)
+      }
+
+      for (vtkIdType i = 0; i < blockLength; i++, resultArrayItr++)
+      {
+        values = block;
+        for (j = 0; j < this->ScalarArrayNamesSize; j++)
         {
-          functionParser->SetScalarVariableValue(
-            j + this->ScalarArrayNamesSize, pt[this->SelectedCoordinateScalarComponents[j]]);
+          if (this->ScalarArrays[j])
+          {
+            functionParser->SetScalarVariableValue(this->ScalarArrayIndices[j], values[i]);
+            values += blockLength;
+          }
         }
-        for (j = 0; j < this->CoordinateVectorVariableNamesSize; j++)
+        for (j = 0; j < this->VectorArrayNamesSize; j++)
         {
-          functionParser->SetVectorVariableValue(j + this->VectorArrayNamesSize,
-            pt[this->SelectedCoordinateVectorComponents[j][0]],
-            pt[this->SelectedCoordinateVectorComponents[j][1]],
-            pt[this->SelectedCoordinateVectorComponents[j][2]]);
+          if (this->VectorArrays[j])
+          {
+            const double* tuple = values + 3 * i;
+            functionParser->SetVectorVariableValue(
+              this->VectorArrayIndices[j], tuple[0], tuple[1], tuple[2]);
+            values += 3 * blockLength;
+          }
+        }
+        if (this->UseCoordinates)
+        {
+          const double* pt = values + 3 * i;
+          for (j = 0; j < this->CoordinateScalarVariableNamesSize; j++)
+          {
+            functionParser->SetScalarVariableValue(
+              j + this->ScalarArrayNamesSize, pt[this->SelectedCoordinateScalarComponents[j]]);
+          }
+          for (j = 0; j < this->CoordinateVectorVariableNamesSize; j++)
+          {
+            functionParser->SetVectorVariableValue(j + this->VectorArrayNamesSize,
+              pt[this->SelectedCoordinateVectorComponents[j][0]],
+              pt[this->SelectedCoordinateVectorComponents[j][1]],
+              pt[this->SelectedCoordinateVectorComponents[j][2]]);
+          }
+        }
+        if (resultType == SCALAR_RESULT)
+        {
+          (*resultArrayItr)[0] = functionParser->GetScalarResult();
+        }
+        else
+        {
+          auto result = functionParser->GetVectorResult();
+          (*resultArrayItr)[0] = result[0];
+          (*resultArrayItr)[1] = result[1];
+          (*resultArrayItr)[2] = result[2];
         }
-      }
-      if (resultType == SCALAR_RESULT)
-      {
-        (*resultArrayItr)[0] = functionParser->GetScalarResult();
-      }
-      else
-      {
-        auto result = functionParser->GetVectorResult();
-        (*resultArrayItr)[0] = result[0];
-        (*resultArrayItr)[1] = result[1];
-        (*resultArrayItr)[2] = result[2];
       }
     }
   }
@@ -620,7 +786,6 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject* input, vtkDataObject* o
   {
     resultPoints = vtkSmartPointer<vtkPoints>::New();
     resultPoints->SetDataType(this->ResultArrayType);
-    resultPoints->SetNumberOfPoints(numTuples);
     resultArray = resultPoints->GetData();
   }
   else if (this->CoordinateResults != 0)
@@ -643,18 +808,19 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject* input, vtkDataObject* o
       vtkArrayDownCast<vtkDataArray>(vtkAbstractArray::CreateArray(this->ResultArrayType)));
   }
 
+  // The first tuple is evaluated here, the others once the function is known
+  // not to be constant.
   if (resultType == SCALAR_RESULT)
   {
     resultArray->SetNumberOfComponents(1);
-    resultArray->SetNumberOfTuples(numTuples);
+    resultArray->SetNumberOfTuples(1);
     double scalarResult = functionParser->GetScalarResult();
     resultArray->SetTuple(0, &scalarResult);
   }
   else
   {
-    resultArray->Allocate(numTuples * 3);
     resultArray->SetNumberOfComponents(3);
-    resultArray->SetNumberOfTuples(numTuples);
+    resultArray->SetNumberOfTuples(1);
     resultArray->SetTuple(0, functionParser->GetVectorResult());
   }
 
@@ -706,23 +872,88 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject* input, vtkDataObject* o
     }
   }
 
-  vtkArrayCalculatorWorker<TFunctionParser> arrayCalculatorWorker;
-  if (!vtkArrayDispatch::Dispatch::Execute(resultArray.Get(), arrayCalculatorWorker, dsInput,
-        graphInput, inFD, attributeType, this->Function, this->ReplaceInvalidValues,
-        this->ReplacementValue, this->IgnoreMissingArrays, this->ScalarArrayNames,
-        this->VectorArrayNames, this->ScalarVariableNames, this->VectorVariableNames,
-        this->SelectedScalarComponents, this->SelectedVectorComponents,
-        this->CoordinateScalarVariableNames, this->CoordinateVectorVariableNames,
-        this->SelectedCoordinateScalarComponents, this->SelectedCoordinateVectorComponents,
-        scalarArrays, vectorArrays, scalarArrayIndices, vectorArrayIndices, numTuples))
+  // Coordinates are only fetched when the function uses them
+  bool coordinatesNeeded = false;
+  for (const std::string& name : this->CoordinateScalarVariableNames)
+  {
+    int idx = functionParser->GetScalarVariableIndex(name);
+    coordinatesNeeded |= idx >= 0 && functionParser->GetScalarVariableNeeded(idx);
+  }
+  for (const std::string& name : this->CoordinateVectorVariableNames)
+  {
+    int idx = functionParser->GetVectorVariableIndex(name);
+    coordinatesNeeded |= idx >= 0 && functionParser->GetVectorVariableNeeded(idx);
+  }
+  const std::vector<std::string> noNames;
+  const std::vector<int> noScalarComponents;
+  const std::vector<vtkTuple<int, 3>> noVectorComponents;
+  const auto& coordinateScalarVariableNames =
+    coordinatesNeeded ? this->CoordinateScalarVariableNames : noNames;
+  const auto& coordinateVectorVariableNames =
+    coordinatesNeeded ? this->CoordinateVectorVariableNames : noNames;
+  const auto& selectedCoordinateScalarComponents =
+    coordinatesNeeded ? this->SelectedCoordinateScalarComponents : noScalarComponents;
+  const auto& selectedCoordinateVectorComponents =
+    coordinatesNeeded ? this->SelectedCoordinateVectorComponents : noVectorComponents;
+
+  auto isSet = [](vtkDataArray* array) { return array != nullptr; };
+  const bool arraysNeeded = std::any_of(scalarArrays.begin(), scalarArrays.end(), isSet) ||
+    std::any_of(vectorArrays.begin(), vectorArrays.end(), isSet);
+  const bool implicitResults = this->ImplicitResults && !resultPoints;
+  vtkSmartPointer<vtkDataArray> implicitArray;
+  if (!arraysNeeded && !coordinatesNeeded)
+  {
+    // The function is constant: store or copy the result of the first tuple
+    if (implicitResults)
+    {
+      vtkArrayCalculatorConstantWorker constantWorker;
+      vtkArrayDispatch::Dispatch::Execute(
+        resultArray.Get(), constantWorker, numTuples, implicitArray);
+    }
+    if (!implicitArray)
+    {
+      // SetNumberOfTuples does not keep the values of the array
+      const int numComps = resultArray->GetNumberOfComponents();
+      std::vector<double> constantTuple(numComps);
+      resultArray->GetTuple(0, constantTuple.data());
+      resultArray->SetNumberOfTuples(numTuples);
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        resultArray->FillComponent(comp, constantTuple[comp]);
+      }
+    }
+  }
+  else
+  {
+    resultArray->SetNumberOfTuples(numTuples);
+    vtkArrayCalculatorWorker<TFunctionParser> arrayCalculatorWorker;
+    if (!vtkArrayDispatch::Dispatch::Execute(resultArray.Get(), arrayCalculatorWorker, dsInput,
+          graphInput, inFD, attributeType, this->Function, this->ReplaceInvalidValues,
+          this->ReplacementValue, this->IgnoreMissingArrays, this->ScalarArrayNames,
+          this->VectorArrayNames, this->ScalarVariableNames, this->VectorVariableNames,
+          this->SelectedScalarComponents, this->SelectedVectorComponents,
+          coordinateScalarVariableNames, coordinateVectorVariableNames,
+          selectedCoordinateScalarComponents, selectedCoordinateVectorComponents, scalarArrays,
+          vectorArrays, scalarArrayIndices, vectorArrayIndices, numTuples))
+    {
+      arrayCalculatorWorker(resultArray.Get(), dsInput, graphInput, inFD, attributeType,
+        this->Function, this->ReplaceInvalidValues, this->ReplacementValue,
+        this->IgnoreMissingArrays, this->ScalarArrayNames, this->VectorArrayNames,
+        this->ScalarVariableNames, this->VectorVariableNames, this->SelectedScalarComponents,
+        this->SelectedVectorComponents, coordinateScalarVariableNames,
+        coordinateVectorVariableNames, selectedCoordinateScalarComponents,
+        selectedCoordinateVectorComponents, scalarArrays, vectorArrays, scalarArrayIndices,
+        vectorArrayIndices, numTuples);
+    }
+    if (implicitResults)
+    {
+      vtkArrayCalculatorAffineWorker affineWorker;
+      vtkArrayDispatch::Dispatch::Execute(resultArray.Get(), affineWorker, implicitArray);
+    }
+  }
+  if (implicitArray)
   {
-    arrayCalculatorWorker(resultArray.Get(), dsInput, graphInput, inFD, attributeType,
-      this->Function, this->ReplaceInvalidValues, this->ReplacementValue, this->IgnoreMissingArrays,
-      this->ScalarArrayNames, this->VectorArrayNames, this->ScalarVariableNames,
-      this->VectorVariableNames, this->SelectedScalarComponents, this->SelectedVectorComponents,
-      this->CoordinateScalarVariableNames, this->CoordinateVectorVariableNames,
-      this->SelectedCoordinateScalarComponents, this->SelectedCoordinateVectorComponents,
-      scalarArrays, vectorArrays, scalarArrayIndices, vectorArrayIndices, numTuples);
+    resultArray = implicitArray;
   }
 
   output->ShallowCopy(input);
@@ -1219,6 +1450,7 @@ void vtkArrayCalculator::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
 
   os << indent << "Coordinate Results: " << this->CoordinateResults << endl;
+  os << indent << "Implicit Results: " << (this->ImplicitResults ? "On" : "Off") << endl;
   os << indent << "Attribute Type: " << this->GetAttributeTypeAsString() << endl;
   os << indent << "Replace Invalid Values: " << (this->ReplaceInvalidValues ? "On" : "Off") << endl;
   os << indent << "Replacement Value: " << this->ReplacementValue << endl;
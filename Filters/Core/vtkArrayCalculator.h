@@ -191,6 +191,22 @@ public:
   vtkBooleanMacro(ResultTCoords, bool);
   ///@}
 
+  ///@{
+  /**
+   * Set whether to store the results in implicit arrays when possible. A
+   * function that uses no array nor coordinate is evaluated once and stored in
+   * a vtkConstantArray when all the components of its result are equal, and a
+   * result whose values are an affine function of their index is stored in a
+   * vtkAffineArray. It is ignored if CoordinateResults is true, or if
+   * ResultArrayType is VTK_BIT.
+   * Initial value is false, since implicit arrays have no contiguous memory and
+   * the code that expects a vtkAOSDataArrayTemplate result would not find it.
+   */
+  vtkGetMacro(ImplicitResults, bool);
+  vtkSetMacro(ImplicitResults, bool);
+  vtkBooleanMacro(ImplicitResults, bool);
+  ///@}
+
   /**
    * Returns a string representation of the calculator's AttributeType
    */
@@ -363,6 +379,7 @@ protected:
   vtkTypeBool CoordinateResults;
   bool ResultNormals;
   bool ResultTCoords;
+  bool ImplicitResults;
   std::vector<std::string> CoordinateScalarVariableNames;
   std::vector<std::string> CoordinateVectorVariableNames;
   std::vector<int> SelectedCoordinateScalarComponents;
@@ -19,6 +19,7 @@
 #include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCell.h"
 #include "vtkCellData.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkIdList.h"
@@ -349,6 +350,9 @@ vtkCellDataToPointData::vtkCellDataToPointData()
   this->ProcessAllArrays = true;
   this->PieceInvariant = true;
   this->Implementation = new Internals();
+
+  // RequestData() only uses its arguments, blocks can be processed concurrently.
+  this->GetInformation()->Set(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION(), 1);
 }
 
 //------------------------------------------------------------------------------
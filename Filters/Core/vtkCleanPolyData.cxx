@@ -14,8 +14,11 @@
 =========================================================================*/
 #include "vtkCleanPolyData.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
+#include "vtkDataArrayRange.h"
 #include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
@@ -25,9 +28,14 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStringArray.h"
 
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCleanPolyData);
@@ -48,6 +56,340 @@ bool InsertPointUsingGlobalId(vtkIdType globalId, vtkPoints* newPts,
   ptId = it->second;
   return false;
 }
+
+//------------------------------------------------------------------------------
+// Threaded engine used when exactly coincident points are merged (zero
+// tolerance) without global ids. It produces the same output as the
+// incremental vtkMergePoints path: output points are numbered in the order in
+// which they are first used while traversing verts, lines, polys and strips,
+// and the degenerate cell rules are the same.
+struct ThreadedMerge
+{
+  // Output cell categories, in the order they are stored in vtkPolyData.
+  enum Category : unsigned char
+  {
+    VERT = 0,
+    LINE = 1,
+    POLY = 2,
+    STRIP = 3,
+    NUMBER_OF_CATEGORIES = 4,
+    DROPPED = 5
+  };
+
+  vtkCleanPolyData* Self;
+  vtkPolyData* Input;
+  vtkPolyData* Output;
+  vtkCellArray* InCells[NUMBER_OF_CATEGORIES];
+  vtkIdType CellBase[NUMBER_OF_CATEGORIES + 1];
+  std::vector<vtkIdType> PointMap;
+
+  ThreadedMerge(vtkCleanPolyData* self, vtkPolyData* input, vtkPolyData* output)
+    : Self(self)
+    , Input(input)
+    , Output(output)
+  {
+    this->InCells[VERT] = input->GetVerts();
+    this->InCells[LINE] = input->GetLines();
+    this->InCells[POLY] = input->GetPolys();
+    this->InCells[STRIP] = input->GetStrips();
+    this->CellBase[0] = 0;
+    for (int k = 0; k < NUMBER_OF_CATEGORIES; ++k)
+    {
+      this->CellBase[k + 1] = this->CellBase[k] + this->InCells[k]->GetNumberOfCells();
+    }
+  }
+
+  // Remap the points of a cell of the given input category, removing
+  // consecutive duplicates as the incremental path does, and return the
+  // category of the resulting output cell.
+  unsigned char ClassifyCell(
+    int category, vtkIdType npts, const vtkIdType* pts, vtkIdType* newPts, vtkIdType& numNewPts)
+  {
+    const vtkIdType* pointMap = this->PointMap.data();
+    numNewPts = 0;
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      const vtkIdType ptId = pointMap[pts[i]];
+      if (category == VERT || i == 0 || ptId != newPts[numNewPts - 1])
+      {
+        newPts[numNewPts++] = ptId;
+      }
+    }
+
+    switch (category)
+    {
+      case VERT:
+        return numNewPts > 0 ? VERT : DROPPED;
+      case LINE:
+        if (numNewPts >= 2)
+        {
+          return LINE;
+        }
+        break;
+      case POLY:
+        if (numNewPts > 2 && newPts[0] == newPts[numNewPts - 1])
+        {
+          numNewPts--;
+        }
+        if (numNewPts > 2)
+        {
+          return POLY;
+        }
+        if (numNewPts == 2)
+        {
+          return (npts == 2 || this->Self->GetConvertPolysToLines()) ? LINE : DROPPED;
+        }
+        break;
+      default: // STRIP
+        if (numNewPts > 1 && newPts[0] == newPts[numNewPts - 1])
+        {
+          numNewPts--;
+        }
+        if (numNewPts > 3)
+        {
+          return STRIP;
+        }
+        if (numNewPts == 3)
+        {
+          return (npts == 3 || this->Self->GetConvertStripsToPolys()) ? POLY : DROPPED;
+        }
+        if (numNewPts == 2)
+        {
+          return (npts == 2 || this->Self->GetConvertPolysToLines()) ? LINE : DROPPED;
+        }
+        break;
+    }
+    return (numNewPts == 1 && (npts == 1 || this->Self->GetConvertLinesToPoints())) ? VERT
+                                                                                   : DROPPED;
+  }
+
+  // Merge the points, assign output point ids by order of first use and copy
+  // the output points and point data. Returns the number of output points.
+  vtkIdType MergePoints(vtkPoints* newPts)
+  {
+    vtkPoints* inPts = this->Input->GetPoints();
+    const vtkIdType numPts = inPts->GetNumberOfPoints();
+
+    // Apply OperateOnPoint() and store the result with the output precision,
+    // points are compared with the precision they will have in the output.
+    // OperateOnPoint() is called from this thread only, since subclasses may
+    // not support concurrent calls.
+    vtkNew<vtkPoints> mappedPts;
+    mappedPts->SetDataType(newPts->GetDataType());
+    mappedPts->SetNumberOfPoints(numPts);
+    double x[3], newx[3];
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      inPts->GetPoint(ptId, x);
+      this->Self->OperateOnPoint(x, newx);
+      mappedPts->SetPoint(ptId, newx);
+    }
+
+    // Bin the points and find the exactly coincident ones.
+    vtkNew<vtkPolyData> mappedData;
+    mappedData->SetPoints(mappedPts);
+    vtkNew<vtkStaticPointLocator> locator;
+    locator->SetDataSet(mappedData);
+    locator->BuildLocator();
+    std::vector<vtkIdType> mergeMap(numPts);
+    locator->MergePoints(0.0, mergeMap.data());
+
+    // Number the merged points in the order of their first use. This is a
+    // lightweight sequential pass over the connectivity.
+    std::vector<vtkIdType> newIds(numPts, -1);
+    std::vector<vtkIdType> sourceIds;
+    for (int k = 0; k < NUMBER_OF_CATEGORIES; ++k)
+    {
+      this->InCells[k]->Visit(FirstUse{}, mergeMap.data(), newIds.data(), sourceIds);
+    }
+    const vtkIdType numNewPts = static_cast<vtkIdType>(sourceIds.size());
+
+    this->PointMap.resize(numPts);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        this->PointMap[ptId] = newIds[mergeMap[ptId]];
+      }
+    });
+
+    // Copy the points and their data from the first input point using them.
+    vtkPointData* inPD = this->Input->GetPointData();
+    vtkPointData* outPD = this->Output->GetPointData();
+    outPD->CopyAllocate(inPD, numNewPts);
+    newPts->SetNumberOfPoints(numNewPts);
+    ArrayList arrays;
+    arrays.AddArrays(numNewPts, inPD, outPD, 0.0, false);
+    vtkSMPTools::For(0, numNewPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      double pt[3];
+      for (; ptId < endPtId; ++ptId)
+      {
+        const vtkIdType sourceId = sourceIds[ptId];
+        mappedPts->GetPoint(sourceId, pt);
+        newPts->SetPoint(ptId, pt);
+        arrays.Copy(sourceId, ptId);
+      }
+    });
+
+    return numNewPts;
+  }
+
+  // Whether all the arrays of the attributes are copied by ArrayList, which
+  // handles vtkDataArray and vtkStringArray but skips vtkVariantArray.
+  static bool SupportsArrays(vtkDataSetAttributes* attributes)
+  {
+    for (int i = 0; i < attributes->GetNumberOfArrays(); ++i)
+    {
+      vtkAbstractArray* array = attributes->GetAbstractArray(i);
+      if (!vtkArrayDownCast<vtkDataArray>(array) && !vtkArrayDownCast<vtkStringArray>(array))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  struct FirstUse
+  {
+    template <typename CellStateT>
+    void operator()(CellStateT& state, const vtkIdType* mergeMap, vtkIdType* newIds,
+      std::vector<vtkIdType>& sourceIds)
+    {
+      for (const auto ptId : vtk::DataArrayValueRange<1>(state.GetConnectivity()))
+      {
+        vtkIdType& newId = newIds[mergeMap[ptId]];
+        if (newId < 0)
+        {
+          newId = static_cast<vtkIdType>(sourceIds.size());
+          sourceIds.push_back(static_cast<vtkIdType>(ptId));
+        }
+      }
+    }
+  };
+
+  // Rewrite the cells using the point map, in two threaded passes: the first
+  // one classifies the cells, the second one writes them once their output
+  // locations are known.
+  void RewriteCells()
+  {
+    const vtkIdType numCells = this->CellBase[NUMBER_OF_CATEGORIES];
+    const int maxCellSize = this->Input->GetMaxCellSize();
+    std::vector<unsigned char> categories(numCells);
+    std::vector<vtkIdType> sizes(numCells);
+
+    vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      std::vector<vtkIdType> newPts(maxCellSize);
+      vtkIdType npts, numNewPts;
+      const vtkIdType* pts;
+      for (int k = 0; k < NUMBER_OF_CATEGORIES; ++k)
+      {
+        const vtkIdType begin = std::max(cellId, this->CellBase[k]);
+        const vtkIdType end = std::min(endCellId, this->CellBase[k + 1]);
+        if (begin >= end)
+        {
+          continue;
+        }
+        auto iter = vtk::TakeSmartPointer(this->InCells[k]->NewIterator());
+        for (vtkIdType id = begin; id < end; ++id)
+        {
+          iter->GetCellAtId(id - this->CellBase[k], npts, pts);
+          categories[id] = this->ClassifyCell(k, npts, pts, newPts.data(), numNewPts);
+          sizes[id] = numNewPts;
+        }
+      }
+    });
+
+    // Output locations of the cells. The cells of each category are kept in
+    // traversal order.
+    std::vector<vtkIdType> cellOffsets(numCells);
+    std::vector<vtkIdType> connOffsets(numCells);
+    vtkIdType numOutCells[NUMBER_OF_CATEGORIES] = { 0, 0, 0, 0 };
+    vtkIdType numOutConn[NUMBER_OF_CATEGORIES] = { 0, 0, 0, 0 };
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      const unsigned char category = categories[cellId];
+      if (category != DROPPED)
+      {
+        cellOffsets[cellId] = numOutCells[category]++;
+        connOffsets[cellId] = numOutConn[category];
+        numOutConn[category] += sizes[cellId];
+      }
+    }
+
+    vtkIdType outBase[NUMBER_OF_CATEGORIES];
+    vtkIdType numTotalCells = 0;
+    vtkNew<vtkIdTypeArray> offsets[NUMBER_OF_CATEGORIES];
+    vtkNew<vtkIdTypeArray> connectivity[NUMBER_OF_CATEGORIES];
+    for (int k = 0; k < NUMBER_OF_CATEGORIES; ++k)
+    {
+      outBase[k] = numTotalCells;
+      numTotalCells += numOutCells[k];
+      offsets[k]->SetNumberOfValues(numOutCells[k] + 1);
+      offsets[k]->SetValue(numOutCells[k], numOutConn[k]);
+      connectivity[k]->SetNumberOfValues(numOutConn[k]);
+    }
+
+    vtkCellData* inCD = this->Input->GetCellData();
+    vtkCellData* outCD = this->Output->GetCellData();
+    outCD->CopyAllOn(vtkDataSetAttributes::COPYTUPLE);
+    outCD->CopyAllocate(inCD, numTotalCells);
+    ArrayList arrays;
+    arrays.AddArrays(numTotalCells, inCD, outCD, 0.0, false);
+
+    vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      std::vector<vtkIdType> newPts(maxCellSize);
+      vtkIdType npts, numNewPts;
+      const vtkIdType* pts;
+      for (int k = 0; k < NUMBER_OF_CATEGORIES; ++k)
+      {
+        const vtkIdType begin = std::max(cellId, this->CellBase[k]);
+        const vtkIdType end = std::min(endCellId, this->CellBase[k + 1]);
+        if (begin >= end)
+        {
+          continue;
+        }
+        auto iter = vtk::TakeSmartPointer(this->InCells[k]->NewIterator());
+        for (vtkIdType id = begin; id < end; ++id)
+        {
+          const unsigned char category = categories[id];
+          if (category == DROPPED)
+          {
+            continue;
+          }
+          iter->GetCellAtId(id - this->CellBase[k], npts, pts);
+          this->ClassifyCell(k, npts, pts, newPts.data(), numNewPts);
+          std::copy(newPts.begin(), newPts.begin() + numNewPts,
+            connectivity[category]->GetPointer(connOffsets[id]));
+          offsets[category]->SetValue(cellOffsets[id], connOffsets[id]);
+          arrays.Copy(id, outBase[category] + cellOffsets[id]);
+        }
+      }
+    });
+
+    for (int k = 0; k < NUMBER_OF_CATEGORIES; ++k)
+    {
+      if (numOutCells[k] > 0 || this->InCells[k]->GetNumberOfCells() > 0)
+      {
+        vtkNew<vtkCellArray> cells;
+        cells->SetData(offsets[k], connectivity[k]);
+        switch (k)
+        {
+          case VERT:
+            this->Output->SetVerts(cells);
+            break;
+          case LINE:
+            this->Output->SetLines(cells);
+            break;
+          case POLY:
+            this->Output->SetPolys(cells);
+            break;
+          default:
+            this->Output->SetStrips(cells);
+            break;
+        }
+      }
+    }
+  }
+};
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -69,6 +411,7 @@ vtkCleanPolyData::vtkCleanPolyData()
   this->Locator = nullptr;
   this->PieceInvariant = 1;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
+  this->ThreadedPointMerging = true;
 }
 
 //------------------------------------------------------------------------------
@@ -152,8 +495,6 @@ int vtkCleanPolyData::RequestData(vtkInformation* vtkNotUsed(request),
     vtkDebugMacro(<< "No data to Operate On!");
     return 1;
   }
-  vtkIdType* updatedPts = new vtkIdType[input->GetMaxCellSize()];
-
   vtkIdType numNewPts;
   vtkIdType numUsedPts = 0;
   vtkPoints* newPts = inPts->NewInstance();
@@ -172,7 +513,34 @@ int vtkCleanPolyData::RequestData(vtkInformation* vtkNotUsed(request),
     newPts->SetDataType(VTK_DOUBLE);
   }
 
+  // Exactly coincident points are merged by the threaded engine when
+  // possible. It produces the same output as the vtkMergePoints path below.
+  const double tol = this->ToleranceIsAbsolute ? this->AbsoluteTolerance
+                                               : this->Tolerance * input->GetLength();
+  if (this->PointMerging && this->ThreadedPointMerging && tol == 0.0 &&
+    !vtkIdTypeArray::SafeDownCast(input->GetPointData()->GetGlobalIds()) &&
+    (newPts->GetDataType() == VTK_FLOAT || newPts->GetDataType() == VTK_DOUBLE) &&
+    (!this->Locator || vtkMergePoints::SafeDownCast(this->Locator)) &&
+    ThreadedMerge::SupportsArrays(input->GetPointData()) &&
+    ThreadedMerge::SupportsArrays(input->GetCellData()))
+  {
+    vtkDebugMacro(<< "Using threaded point merging");
+    ThreadedMerge merge(this, input, output);
+    numNewPts = merge.MergePoints(newPts);
+    this->UpdateProgress(0.5);
+    if (!this->CheckAbort())
+    {
+      merge.RewriteCells();
+    }
+    vtkDebugMacro(<< "Removed " << numPts - numNewPts << " points");
+    output->SetPoints(newPts);
+    newPts->Delete();
+    output->Squeeze();
+    return 1;
+  }
+
   newPts->Allocate(numPts);
+  vtkIdType* updatedPts = new vtkIdType[input->GetMaxCellSize()];
 
   // we'll be needing these
   vtkIdType inCellID, newId;
@@ -750,6 +1118,7 @@ void vtkCleanPolyData::PrintSelf(ostream& os, vtkIndent indent)
   }
   os << indent << "PieceInvariant: " << (this->PieceInvariant ? "On\n" : "Off\n");
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "ThreadedPointMerging: " << (this->ThreadedPointMerging ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -40,7 +40,8 @@
  * segments (with two identical end points) will be removed.
  *
  * If tolerance is specified precisely=0.0, then vtkCleanPolyData will use
- * the vtkMergePoints object to merge points (which is faster). Otherwise the
+ * the vtkMergePoints object to merge points (which is faster), or a threaded
+ * equivalent if ThreadedPointMerging is on. Otherwise the
  * slower vtkIncrementalPointLocator is used.  Before inserting points into the point
  * locator, this class calls a function OperateOnPoint which can be used (in
  * subclasses) to further refine the cleaning process. See
@@ -214,6 +215,23 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether exactly coincident points (i.e., a zero tolerance) are
+   * merged using a threaded engine built on vtkStaticPointLocator instead of
+   * the incremental vtkMergePoints locator. The output is the same, but both
+   * the point merging and the rewriting of the cells are done in parallel.
+   * The threaded engine is used only when no global point ids are present,
+   * the output points are float or double, the locator is either unset or a
+   * vtkMergePoints, and the point and cell data only hold vtkDataArray and
+   * vtkStringArray arrays. OperateOnPoint() is still invoked from a single
+   * thread. By default this is on, since the output does not change.
+   */
+  vtkSetMacro(ThreadedPointMerging, bool);
+  vtkGetMacro(ThreadedPointMerging, bool);
+  vtkBooleanMacro(ThreadedPointMerging, bool);
+  ///@}
+
 protected:
   vtkCleanPolyData();
   ~vtkCleanPolyData() override;
@@ -233,6 +251,7 @@ protected:
 
   vtkTypeBool PieceInvariant;
   int OutputPointsPrecision;
+  bool ThreadedPointMerging;
 
 private:
   vtkCleanPolyData(const vtkCleanPolyData&) = delete;
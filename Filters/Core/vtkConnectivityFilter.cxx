@@ -16,6 +16,7 @@
 
 #include "vtkCell.h"
 #include "vtkCellData.h"
+#include "vtkConnectivityLabelingInternal.h"
 #include "vtkDataSet.h"
 #include "vtkDemandDrivenPipeline.h"
 #include "vtkFloatArray.h"
@@ -28,9 +29,11 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkObjectFactoryNewMacro(vtkConnectivityFilter);
@@ -62,6 +65,8 @@ vtkConnectivityFilter::vtkConnectivityFilter()
   this->NewCellScalars = nullptr;
 
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
+
+  this->UseParallelLabeling = false;
 }
 
 vtkConnectivityFilter::~vtkConnectivityFilter()
@@ -238,7 +243,11 @@ int vtkConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(request),
   this->PointIds = vtkIdList::New();
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
 
-  if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  if (this->UseParallelLabeling && !this->InScalars)
+  {
+    this->LabelRegionsInParallel(input, largestRegionId);
+  }
+  else if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION)
   { // visit all cells marking with region number
@@ -631,6 +640,78 @@ void vtkConnectivityFilter::TraverseAndMark(vtkDataSet* input)
   } // while wave is not empty
 }
 
+//------------------------------------------------------------------------------
+// Mark the cells and points the same way as TraverseAndMark(), labeling the
+// regions of all the cells at once with a concurrent union-find. Points are
+// numbered in input order.
+void vtkConnectivityFilter::LabelRegionsInParallel(vtkDataSet* input, vtkIdType& largestRegionId)
+{
+  ConnectedRegions regions;
+  if (!regions.Label(input, this))
+  {
+    return;
+  }
+  this->UpdateProgress(0.5);
+
+  if (this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS ||
+    this->ExtractionMode == VTK_EXTRACT_CELL_SEEDED_REGIONS ||
+    this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION)
+  { // everything connected to the seeds is considered in the same region
+    std::vector<vtkIdType> seedRegionIds;
+    if (this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION)
+    {
+      seedRegionIds.push_back(
+        regions.PointRegionIds[ConnectedRegions::FindClosestPoint(input, this->ClosestPoint)]);
+    }
+    else
+    {
+      const std::vector<vtkIdType>& regionIds =
+        this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS ? regions.PointRegionIds
+                                                                 : regions.CellRegionIds;
+      for (vtkIdType i = 0; i < this->Seeds->GetNumberOfIds(); ++i)
+      {
+        const vtkIdType id = this->Seeds->GetId(i);
+        if (id >= 0 && id < static_cast<vtkIdType>(regionIds.size()))
+        {
+          seedRegionIds.push_back(regionIds[id]);
+        }
+      }
+    }
+    regions.KeepSeededRegions(seedRegionIds);
+  }
+  else
+  {
+    vtkIdType maxCellsInRegion = 0;
+    for (size_t regionId = 0; regionId < regions.RegionSizes.size(); ++regionId)
+    {
+      if (regions.RegionSizes[regionId] > maxCellsInRegion)
+      {
+        maxCellsInRegion = regions.RegionSizes[regionId];
+        largestRegionId = static_cast<vtkIdType>(regionId);
+      }
+    }
+    this->RegionNumber = static_cast<vtkIdType>(regions.RegionSizes.size());
+  }
+  for (size_t regionId = 0; regionId < regions.RegionSizes.size(); ++regionId)
+  {
+    this->RegionSizes->InsertValue(static_cast<vtkIdType>(regionId), regions.RegionSizes[regionId]);
+  }
+
+  vtkIdType* cellRegionIds = this->NewCellScalars->GetPointer(0);
+  vtkSMPTools::For(0, input->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      this->Visited[cellId] = regions.CellRegionIds[cellId];
+      if (this->Visited[cellId] >= 0)
+      {
+        cellRegionIds[cellId] = this->Visited[cellId];
+      }
+    }
+  });
+  this->PointNumber = regions.MapPoints(this->PointMap, this->NewScalars);
+  this->UpdateProgress(0.9);
+}
+
 void vtkConnectivityFilter::OrderRegionIds(
   vtkIdTypeArray* pointRegionIds, vtkIdTypeArray* cellRegionIds)
 {
@@ -789,5 +870,6 @@ void vtkConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
   double* range = this->GetScalarRange();
   os << indent << "Scalar Range: (" << range[0] << ", " << range[1] << ")\n";
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Use Parallel Labeling: " << (this->UseParallelLabeling ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -216,6 +216,20 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off the labeling of regions in parallel. If on, regions are
+   * labeled with a concurrent union-find over the points of the cells instead
+   * of a wave traversal of the cells. The extracted cells and their RegionIds
+   * are the same, but the output points keep their input order instead of
+   * the traversal order. Scalar connectivity needs the wave traversal, so
+   * this flag is ignored when ScalarConnectivity is on. Default is off.
+   */
+  vtkSetMacro(UseParallelLabeling, bool);
+  vtkGetMacro(UseParallelLabeling, bool);
+  vtkBooleanMacro(UseParallelLabeling, bool);
+  ///@}
+
 protected:
   vtkConnectivityFilter();
   ~vtkConnectivityFilter() override;
@@ -244,8 +258,12 @@ protected:
 
   int RegionIdAssignmentMode;
 
+  bool UseParallelLabeling;
+
   void TraverseAndMark(vtkDataSet* input);
 
+  void LabelRegionsInParallel(vtkDataSet* input, vtkIdType& largestRegionId);
+
   void OrderRegionIds(vtkIdTypeArray* pointRegionIds, vtkIdTypeArray* cellRegionIds);
 
 private:
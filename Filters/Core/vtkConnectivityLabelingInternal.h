@@ -0,0 +1,364 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkConnectivityLabelingInternal.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkConnectivityLabelingInternal
+ * @brief   label the connected regions of a dataset in parallel
+ *
+ * vtkConnectivityLabelingInternal gathers the helpers used by
+ * vtkConnectivityFilter and vtkPolyDataConnectivityFilter to label connected
+ * regions with a concurrent union-find instead of a wave traversal. The points
+ * of each cell are merged into the same set, the sets being linked by their
+ * smallest point id with compare and swap operations and compressed by path
+ * halving, so no point to cell links are needed. Regions are then numbered in
+ * the order of their first cell, which is the numbering of the wave traversal.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkConnectivityFilter vtkPolyDataConnectivityFilter
+ */
+
+#ifndef vtkConnectivityLabelingInternal_h
+#define vtkConnectivityLabelingInternal_h
+
+#include "vtkAlgorithm.h"
+#include "vtkDataSet.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Connected regions of the cells of a dataset, two cells being connected when
+// they share a point.
+struct ConnectedRegions
+{
+  std::vector<vtkIdType> CellRegionIds;  // region of each cell, -1 if not kept
+  std::vector<vtkIdType> PointRegionIds; // region of each point, -1 if not kept
+  std::vector<vtkIdType> RegionSizes;    // number of cells of each region
+
+  //------------------------------------------------------------------------------
+  // Label all the regions of input. Points used by no cell get no region.
+  // Returns false if filter was aborted.
+  bool Label(vtkDataSet* input, vtkAlgorithm* filter)
+  {
+    const vtkIdType numPts = input->GetNumberOfPoints();
+    const vtkIdType numCells = input->GetNumberOfCells();
+    this->CellRegionIds.assign(numCells, -1);
+    this->PointRegionIds.assign(numPts, -1);
+    this->RegionSizes.clear();
+    if (numCells < 1)
+    {
+      return true;
+    }
+
+    // build the cells once so that the threaded calls are thread safe
+    vtkNew<vtkIdList> cellPtIds;
+    input->GetCellPoints(0, cellPtIds);
+
+    // merge the points of each cell
+    std::unique_ptr<std::atomic<vtkIdType>[]> parents(new std::atomic<vtkIdType>[numPts]);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        parents[ptId].store(ptId, std::memory_order_relaxed);
+      }
+    });
+    vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+    vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdList* ptIds = tlPtIds.Local();
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      vtkIdType checkAbortInterval = std::min((end - begin) / 10 + 1, (vtkIdType)1000);
+      vtkIdType npts;
+      const vtkIdType* pts;
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        if (cellId % checkAbortInterval == 0)
+        {
+          if (isFirst)
+          {
+            filter->CheckAbort();
+          }
+          if (filter->GetAbortOutput())
+          {
+            break;
+          }
+        }
+        input->GetCellPoints(cellId, npts, pts, ptIds);
+        for (vtkIdType i = 1; i < npts; ++i)
+        {
+          ConnectedRegions::Union(parents.get(), pts[0], pts[i]);
+        }
+      }
+    });
+    if (filter->GetAbortOutput())
+    {
+      return false;
+    }
+
+    // the root of a set is its smallest point id, find the first cell of
+    // each set
+    std::vector<vtkIdType> roots(numPts);
+    std::unique_ptr<std::atomic<vtkIdType>[]> firstCells(new std::atomic<vtkIdType>[numPts]);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        roots[ptId] = ConnectedRegions::Find(parents.get(), ptId);
+        firstCells[ptId].store(numCells, std::memory_order_relaxed);
+      }
+    });
+    parents.reset();
+
+    std::vector<vtkIdType> cellRoots(numCells);
+    vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdList* ptIds = tlPtIds.Local();
+      vtkIdType npts;
+      const vtkIdType* pts;
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        input->GetCellPoints(cellId, npts, pts, ptIds);
+        if (npts < 1)
+        {
+          // a cell without points is a region of its own
+          cellRoots[cellId] = -1;
+          continue;
+        }
+        const vtkIdType root = roots[pts[0]];
+        cellRoots[cellId] = root;
+        std::atomic<vtkIdType>& firstCell = firstCells[root];
+        vtkIdType current = firstCell.load(std::memory_order_relaxed);
+        while (cellId < current &&
+          !firstCell.compare_exchange_weak(current, cellId, std::memory_order_relaxed))
+        {
+        }
+      }
+    });
+
+    // number the regions in the order of their first cell
+    std::vector<vtkIdType> regionIds(numCells);
+    vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        const vtkIdType root = cellRoots[cellId];
+        regionIds[cellId] =
+          (root < 0 || firstCells[root].load(std::memory_order_relaxed) == cellId) ? 1 : 0;
+      }
+    });
+    const vtkIdType lastIsFirst = regionIds.back();
+    vtkSMPTools::ExclusiveScan(
+      regionIds.begin(), regionIds.end(), regionIds.begin(), static_cast<vtkIdType>(0));
+    this->RegionSizes.resize(regionIds.back() + lastIsFirst);
+
+    std::unique_ptr<std::atomic<vtkIdType>[]> sizes(
+      new std::atomic<vtkIdType>[this->RegionSizes.size()]);
+    for (size_t regionId = 0; regionId < this->RegionSizes.size(); ++regionId)
+    {
+      sizes[regionId].store(0, std::memory_order_relaxed);
+    }
+    vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        const vtkIdType root = cellRoots[cellId];
+        const vtkIdType regionId = root < 0
+          ? regionIds[cellId]
+          : regionIds[firstCells[root].load(std::memory_order_relaxed)];
+        this->CellRegionIds[cellId] = regionId;
+        sizes[regionId].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        const vtkIdType firstCell = firstCells[roots[ptId]].load(std::memory_order_relaxed);
+        if (firstCell < numCells)
+        {
+          this->PointRegionIds[ptId] = regionIds[firstCell];
+        }
+      }
+    });
+    for (size_t regionId = 0; regionId < this->RegionSizes.size(); ++regionId)
+    {
+      this->RegionSizes[regionId] = sizes[regionId].load(std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  //------------------------------------------------------------------------------
+  // Keep only the regions in seedRegionIds, merged into region 0 the way the
+  // seeded extraction modes report them. Negative region ids are ignored.
+  void KeepSeededRegions(const std::vector<vtkIdType>& seedRegionIds)
+  {
+    std::vector<char> kept(this->RegionSizes.size(), 0);
+    vtkIdType numKeptCells = 0;
+    for (vtkIdType regionId : seedRegionIds)
+    {
+      if (regionId >= 0 && !kept[regionId])
+      {
+        kept[regionId] = 1;
+        numKeptCells += this->RegionSizes[regionId];
+      }
+    }
+    auto keep = [&kept](std::vector<vtkIdType>& ids) {
+      vtkSMPTools::For(0, static_cast<vtkIdType>(ids.size()), [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          ids[i] = (ids[i] >= 0 && kept[ids[i]]) ? 0 : -1;
+        }
+      });
+    };
+    keep(this->CellRegionIds);
+    keep(this->PointRegionIds);
+    this->RegionSizes.assign(1, numKeptCells);
+  }
+
+  //------------------------------------------------------------------------------
+  // Number the kept points in increasing id order into pointMap, -1 for the
+  // other points, and write the region of each kept point at its new id in
+  // pointRegionIds. Returns the number of kept points.
+  vtkIdType MapPoints(vtkIdType* pointMap, vtkIdTypeArray* pointRegionIds) const
+  {
+    const vtkIdType numPts = static_cast<vtkIdType>(this->PointRegionIds.size());
+    if (numPts < 1)
+    {
+      return 0;
+    }
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        pointMap[ptId] = this->PointRegionIds[ptId] >= 0 ? 1 : 0;
+      }
+    });
+    const vtkIdType lastKept = pointMap[numPts - 1];
+    vtkSMPTools::ExclusiveScan(pointMap, pointMap + numPts, pointMap, static_cast<vtkIdType>(0));
+    const vtkIdType numKeptPts = pointMap[numPts - 1] + lastKept;
+    vtkIdType* regionIds = pointRegionIds->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        if (this->PointRegionIds[ptId] >= 0)
+        {
+          regionIds[pointMap[ptId]] = this->PointRegionIds[ptId];
+        }
+        else
+        {
+          pointMap[ptId] = -1;
+        }
+      }
+    });
+    return numKeptPts;
+  }
+
+  //------------------------------------------------------------------------------
+  // Return the id of the point of input closest to x, the smallest id among
+  // equally close points.
+  static vtkIdType FindClosestPoint(vtkDataSet* input, const double x[3])
+  {
+    struct Closest
+    {
+      double Distance2;
+      vtkIdType PointId;
+    };
+    vtkSMPThreadLocal<Closest> tlClosest(Closest{ VTK_DOUBLE_MAX, -1 });
+    vtkSMPTools::For(0, input->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+      Closest& closest = tlClosest.Local();
+      double p[3];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        input->GetPoint(ptId, p);
+        const double dist2 = vtkMath::Distance2BetweenPoints(p, x);
+        if (dist2 < closest.Distance2 || (dist2 == closest.Distance2 && ptId < closest.PointId))
+        {
+          closest.Distance2 = dist2;
+          closest.PointId = ptId;
+        }
+      }
+    });
+    Closest result{ VTK_DOUBLE_MAX, 0 };
+    for (const Closest& closest : tlClosest)
+    {
+      if (closest.PointId >= 0 &&
+        (closest.Distance2 < result.Distance2 ||
+          (closest.Distance2 == result.Distance2 && closest.PointId < result.PointId)))
+      {
+        result = closest;
+      }
+    }
+    return result.PointId;
+  }
+
+private:
+  //------------------------------------------------------------------------------
+  // Return the root of the set of ptId, halving the path to it.
+  static vtkIdType Find(std::atomic<vtkIdType>* parents, vtkIdType ptId)
+  {
+    vtkIdType parent = parents[ptId].load(std::memory_order_relaxed);
+    while (parent != ptId)
+    {
+      const vtkIdType grandParent = parents[parent].load(std::memory_order_relaxed);
+      if (grandParent != parent)
+      {
+        parents[ptId].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+      }
+      ptId = grandParent;
+      parent = parents[ptId].load(std::memory_order_relaxed);
+    }
+    return ptId;
+  }
+
+  //------------------------------------------------------------------------------
+  // Merge the sets of two points, the larger root being linked to the smaller
+  // one so that the root of a set is always its smallest point id.
+  static void Union(std::atomic<vtkIdType>* parents, vtkIdType ptId0, vtkIdType ptId1)
+  {
+    while (true)
+    {
+      ptId0 = ConnectedRegions::Find(parents, ptId0);
+      ptId1 = ConnectedRegions::Find(parents, ptId1);
+      if (ptId0 == ptId1)
+      {
+        return;
+      }
+      if (ptId0 > ptId1)
+      {
+        std::swap(ptId0, ptId1);
+      }
+      vtkIdType expected = ptId1;
+      if (parents[ptId1].compare_exchange_strong(expected, ptId0, std::memory_order_relaxed))
+      {
+        return;
+      }
+    }
+  }
+};
+
+} // anonymous namespace
+
+#endif // vtkConnectivityLabelingInternal_h
+// VTK-HeaderTest-Exclude: vtkConnectivityLabelingInternal.h
@@ -76,6 +76,7 @@ vtkContourFilter::vtkContourFilter()
   this->GenerateTriangles = 1;
   this->ArrayComponent = 0;
   this->FastMode = false;
+  this->UseParallelContouring = false;
 
   this->ContourGrid->SetContainerAlgorithm(this);
   this->Contour3DLinearGrid->SetContainerAlgorithm(this);
@@ -412,6 +413,7 @@ int vtkContourFilter::RequestData(
       this->ContourGrid->SetComputeScalars(this->ComputeScalars);
       this->ContourGrid->SetOutputPointsPrecision(this->OutputPointsPrecision);
       this->ContourGrid->SetGenerateTriangles(this->GenerateTriangles);
+      this->ContourGrid->SetUseParallelContouring(this->UseParallelContouring);
       this->ContourGrid->SetUseScalarTree(this->UseScalarTree);
       if (this->UseScalarTree) // special treatment to reuse it
       {
@@ -759,6 +761,7 @@ void vtkContourFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Precision of the output points: " << this->OutputPointsPrecision << "\n";
   os << indent << "ArrayComponent: " << this->ArrayComponent << "\n";
   os << indent << "Fast Mode: " << (this->FastMode ? "On\n" : "Off\n");
+  os << indent << "Use Parallel Contouring: " << (this->UseParallelContouring ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
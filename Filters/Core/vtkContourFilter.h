@@ -216,6 +216,18 @@ public:
   vtkBooleanMacro(FastMode, bool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off contouring the cells in parallel when the input is a
+   * vtkUnstructuredGrid processed by vtkContourGrid, i.e. containing
+   * non-linear or lower dimensional cells. See
+   * vtkContourGrid::SetUseParallelContouring(). Default is off.
+   */
+  vtkSetMacro(UseParallelContouring, bool);
+  vtkGetMacro(UseParallelContouring, bool);
+  vtkBooleanMacro(UseParallelContouring, bool);
+  ///@}
+
 protected:
   vtkContourFilter();
   ~vtkContourFilter() override;
@@ -238,6 +250,7 @@ protected:
   int ArrayComponent;
   vtkTypeBool GenerateTriangles;
   bool FastMode;
+  bool UseParallelContouring;
 
   vtkNew<vtkContourGrid> ContourGrid;
   vtkNew<vtkContour3DLinearGrid> Contour3DLinearGrid;
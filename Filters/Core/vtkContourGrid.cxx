@@ -16,6 +16,7 @@
 
 #include "vtkCell.h"
 #include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkContourHelper.h"
@@ -25,6 +26,8 @@
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkGenericCell.h"
+#include "vtkIdListCollection.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -35,14 +38,19 @@
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
 #include "vtkPolyDataNormals.h"
+#include "vtkPolygonBuilder.h"
+#include "vtkSMPTools.h"
 #include "vtkSimpleScalarTree.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridBase.h"
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkContourGrid);
@@ -57,6 +65,7 @@ vtkContourGrid::vtkContourGrid()
   this->ComputeNormals = 0;
   this->ComputeScalars = 1;
   this->GenerateTriangles = 1;
+  this->UseParallelContouring = false;
 
   this->Locator = nullptr;
 
@@ -110,19 +119,10 @@ vtkMTimeType vtkContourGrid::GetMTime()
 }
 
 //------------------------------------------------------------------------------
-void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData* output,
-  vtkDataArray* inScalars, vtkIdType numContours, double* values, int computeScalars,
-  int useScalarTree, vtkScalarTree* scalarTree, bool generateTriangles)
+// Return the point data to interpolate from.
+static vtkSmartPointer<vtkPointData> vtkContourGridInputPointData(
+  vtkDataSet* input, vtkDataArray* inScalars)
 {
-  vtkIdType i;
-  bool abortExecute = false;
-  vtkIncrementalPointLocator* locator = self->GetLocator();
-  vtkNew<vtkGenericCell> cell;
-  vtkCellArray *newVerts, *newLines, *newPolys;
-  vtkPoints* newPts;
-  vtkIdType numCells, estimatedSize;
-  vtkNew<vtkDoubleArray> cellScalars;
-
   vtkPointData* inPdOriginal = input->GetPointData();
 
   // We don't want to change the active scalars in the input, but we
@@ -142,6 +142,39 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
   {
     inPd->AddArray(oldScalars);
   }
+  return inPd;
+}
+
+//------------------------------------------------------------------------------
+// Return the data type of the output points.
+static int vtkContourGridOutputPointsType(vtkContourGrid* self, vtkPointSet* input)
+{
+  if (self->GetOutputPointsPrecision() == vtkAlgorithm::SINGLE_PRECISION)
+  {
+    return VTK_FLOAT;
+  }
+  else if (self->GetOutputPointsPrecision() == vtkAlgorithm::DOUBLE_PRECISION)
+  {
+    return VTK_DOUBLE;
+  }
+  return input->GetPoints()->GetDataType();
+}
+
+//------------------------------------------------------------------------------
+void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData* output,
+  vtkDataArray* inScalars, vtkIdType numContours, double* values, int computeScalars,
+  int useScalarTree, vtkScalarTree* scalarTree, bool generateTriangles)
+{
+  vtkIdType i;
+  bool abortExecute = false;
+  vtkIncrementalPointLocator* locator = self->GetLocator();
+  vtkNew<vtkGenericCell> cell;
+  vtkCellArray *newVerts, *newLines, *newPolys;
+  vtkPoints* newPts;
+  vtkIdType numCells, estimatedSize;
+  vtkNew<vtkDoubleArray> cellScalars;
+
+  vtkSmartPointer<vtkPointData> inPd = vtkContourGridInputPointData(input, inScalars);
   vtkPointData* outPd = output->GetPointData();
 
   vtkCellData* inCd = input->GetCellData();
@@ -170,18 +203,7 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
   newPts = vtkPoints::New();
 
   // set precision for the points in the output
-  if (self->GetOutputPointsPrecision() == vtkAlgorithm::DEFAULT_PRECISION)
-  {
-    newPts->SetDataType(grid->GetPoints()->GetDataType());
-  }
-  else if (self->GetOutputPointsPrecision() == vtkAlgorithm::SINGLE_PRECISION)
-  {
-    newPts->SetDataType(VTK_FLOAT);
-  }
-  else if (self->GetOutputPointsPrecision() == vtkAlgorithm::DOUBLE_PRECISION)
-  {
-    newPts->SetDataType(VTK_DOUBLE);
-  }
+  newPts->SetDataType(vtkContourGridOutputPointsType(self, grid));
 
   newPts->Allocate(estimatedSize, estimatedSize);
   newVerts = vtkCellArray::New();
@@ -373,6 +395,547 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
   output->Squeeze();
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Number of cells of a given dimension contoured together by the threaded
+// path. Batches do not depend on the number of threads, and are merged in
+// order, so the output does not either.
+const vtkIdType ContourBatchSize = 4096;
+
+// Compute the range of the scalars of a cell.
+void ComputeScalarRange(vtkDataArray* cellScalars, double range[2])
+{
+  range[0] = std::numeric_limits<double>::max();
+  range[1] = std::numeric_limits<double>::lowest();
+  for (const double val : vtk::DataArrayValueRange(cellScalars))
+  {
+    range[0] = std::min(range[0], val);
+    range[1] = std::max(range[1], val);
+  }
+}
+
+// Output of the contouring of a batch of cells. Batches without any
+// contoured cell keep null members.
+struct ContourBatch
+{
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkCellArray> Verts;
+  vtkSmartPointer<vtkCellArray> Lines;
+  vtkSmartPointer<vtkCellArray> Polys;
+  vtkSmartPointer<vtkPointData> PointData;
+  vtkSmartPointer<vtkCellData> CellData;
+
+  // When the triangles of the 3D cells are merged into polygons, this is
+  // done once the output point ids are known, as they define the polygons
+  // vtkPolygonBuilder produces. Until then, PolyGroups holds the index of
+  // the first triangle of each contour of a 3D cell, then the number of
+  // triangles. Once merged, PolySources holds the index in CellData of the
+  // data of each polygon.
+  std::vector<vtkIdType> PolyGroups;
+  std::vector<vtkIdType> PolySources;
+
+  vtkIdType GetNumberOfPoints() const
+  {
+    return this->Points ? this->Points->GetNumberOfPoints() : 0;
+  }
+};
+
+// Contour the cells of one dimension, batch by batch. Each batch has its own
+// points, locator, cells and attributes, laid out as the sequential path
+// lays out those of the whole output.
+struct ContourCells
+{
+  vtkContourGrid* Self;
+  vtkUnstructuredGrid* Input;
+  vtkDataArray* InScalars;
+  vtkPointData* InPd;
+  vtkCellData* InCd;
+  vtkIdType NumContours;
+  const double* Values;
+  bool ComputeScalars;
+  bool GenerateTriangles;
+  int PointsType;
+  int Dimension;
+  const unsigned char* CellTypeDimensions;
+  ContourBatch* Batches;
+
+  bool InRange(const double range[2]) const
+  {
+    for (vtkIdType i = 0; i < this->NumContours; i++)
+    {
+      if (this->Values[i] >= range[0] && this->Values[i] <= range[1])
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void operator()(vtkIdType batchId, vtkIdType endBatchId)
+  {
+    const vtkIdType numCells = this->Input->GetNumberOfCells();
+    vtkNew<vtkGenericCell> cell;
+    vtkNew<vtkIdList> ptIds;
+    vtkNew<vtkDoubleArray> cellScalars;
+    cellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
+    std::vector<vtkIdType> cellIds;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; batchId < endBatchId; ++batchId)
+    {
+      const vtkIdType beginCellId = batchId * ContourBatchSize;
+      const vtkIdType endCellId = std::min(beginCellId + ContourBatchSize, numCells);
+      if (isFirst)
+      {
+        if (this->Dimension == 3)
+        {
+          this->Self->UpdateProgress(static_cast<double>(beginCellId) / numCells);
+        }
+        this->Self->CheckAbort();
+      }
+      if (this->Self->GetAbortOutput())
+      {
+        break;
+      }
+
+      // Select the cells crossed by a contour and compute their bounds, which
+      // are used to bin the points of the batch.
+      double bounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+        VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+      cellIds.clear();
+      for (vtkIdType cellId = beginCellId; cellId < endCellId; ++cellId)
+      {
+        int cellType = this->Input->GetCellType(cellId);
+        if (cellType >= VTK_NUMBER_OF_CELL_TYPES)
+        { // Protect against new cell types added.
+          vtkGenericWarningMacro("Unknown cell type " << cellType);
+          continue;
+        }
+        if (this->CellTypeDimensions[cellType] != this->Dimension)
+        {
+          continue;
+        }
+        this->Input->GetCellPoints(cellId, ptIds);
+        cellScalars->SetNumberOfTuples(ptIds->GetNumberOfIds());
+        this->InScalars->GetTuples(ptIds, cellScalars);
+        double range[2];
+        ComputeScalarRange(cellScalars, range);
+        if (!this->InRange(range))
+        {
+          continue;
+        }
+        cellIds.push_back(cellId);
+        for (vtkIdType i = 0; i < ptIds->GetNumberOfIds(); ++i)
+        {
+          double x[3];
+          this->Input->GetPoint(ptIds->GetId(i), x);
+          for (int j = 0; j < 3; ++j)
+          {
+            bounds[2 * j] = std::min(bounds[2 * j], x[j]);
+            bounds[2 * j + 1] = std::max(bounds[2 * j + 1], x[j]);
+          }
+        }
+      }
+      if (cellIds.empty())
+      {
+        continue;
+      }
+
+      ContourBatch& batch = this->Batches[batchId];
+      const vtkIdType estimatedSize =
+        std::max(static_cast<vtkIdType>(cellIds.size()) * this->NumContours, vtkIdType(64));
+      batch.Points = vtkSmartPointer<vtkPoints>::New();
+      batch.Points->SetDataType(this->PointsType);
+      batch.Points->Allocate(estimatedSize);
+      batch.Verts = vtkSmartPointer<vtkCellArray>::New();
+      batch.Lines = vtkSmartPointer<vtkCellArray>::New();
+      batch.Polys = vtkSmartPointer<vtkCellArray>::New();
+      batch.PointData = vtkSmartPointer<vtkPointData>::New();
+      batch.CellData = vtkSmartPointer<vtkCellData>::New();
+      if (!this->ComputeScalars)
+      {
+        batch.PointData->CopyScalarsOff();
+      }
+      batch.PointData->InterpolateAllocate(this->InPd, estimatedSize);
+      batch.CellData->CopyAllocate(this->InCd, estimatedSize);
+      vtkNew<vtkMergePoints> locator;
+      locator->InitPointInsertion(batch.Points, bounds, estimatedSize);
+
+      const bool deferMerge = !this->GenerateTriangles && this->Dimension == 3;
+      vtkContourHelper helper(locator, batch.Verts, batch.Lines, batch.Polys, this->InPd,
+        this->InCd, batch.PointData, batch.CellData, static_cast<int>(estimatedSize),
+        this->GenerateTriangles || deferMerge);
+      for (vtkIdType cellId : cellIds)
+      {
+        this->Input->GetCellPoints(cellId, ptIds);
+        cellScalars->SetNumberOfTuples(ptIds->GetNumberOfIds());
+        this->InScalars->GetTuples(ptIds, cellScalars);
+        double range[2];
+        ComputeScalarRange(cellScalars, range);
+        this->Input->GetCell(cellId, cell);
+        this->Input->SetCellOrderAndRationalWeights(cellId, cell);
+        for (vtkIdType i = 0; i < this->NumContours; i++)
+        {
+          if ((this->Values[i] >= range[0]) && (this->Values[i] <= range[1]))
+          {
+            if (deferMerge)
+            {
+              batch.PolyGroups.push_back(batch.Polys->GetNumberOfCells());
+            }
+            helper.Contour(cell, this->Values[i], cellScalars, cellId);
+          }
+        }
+      }
+      if (deferMerge)
+      {
+        batch.PolyGroups.push_back(batch.Polys->GetNumberOfCells());
+      }
+    }
+  }
+};
+
+// Merge the triangles of each contour of a 3D cell of a batch into polygons
+// as vtkContourHelper does, using the output point ids.
+void MergeTriangles(ContourBatch& batch, const vtkIdType* batchPointMap)
+{
+  const vtkIdType cellDataOffset = batch.Verts->GetNumberOfCells() +
+    batch.Lines->GetNumberOfCells();
+  vtkNew<vtkCellArray> polys;
+  polys->AllocateEstimate(batch.Polys->GetNumberOfCells(), 4);
+  vtkPolygonBuilder polyBuilder;
+  vtkNew<vtkIdListCollection> polyCollection;
+  vtkNew<vtkIdList> cellPts;
+  std::vector<std::pair<vtkIdType, vtkIdType>> localIds;
+  for (size_t group = 0; group + 1 < batch.PolyGroups.size(); ++group)
+  {
+    const vtkIdType firstCellId = batch.PolyGroups[group];
+    const vtkIdType endCellId = batch.PolyGroups[group + 1];
+    if (firstCellId == endCellId)
+    {
+      continue;
+    }
+    polyBuilder.Reset();
+    localIds.clear();
+    for (vtkIdType cellId = firstCellId; cellId < endCellId; ++cellId)
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      batch.Polys->GetCellAtId(cellId, npts, pts, cellPts);
+      if (npts == 3)
+      {
+        vtkIdType tri[3];
+        for (int i = 0; i < 3; ++i)
+        {
+          tri[i] = batchPointMap[pts[i]];
+          localIds.emplace_back(tri[i], pts[i]);
+        }
+        polyBuilder.InsertTriangle(tri);
+      }
+      else // for whatever reason, the cell contouring is already outputting polys
+      {
+        polys->InsertNextCell(npts, pts);
+        batch.PolySources.push_back(cellDataOffset + cellId);
+      }
+    }
+
+    // Go back to the batch point ids, which are merged in the same way.
+    std::sort(localIds.begin(), localIds.end());
+    polyBuilder.GetPolygons(polyCollection);
+    int nPolys = polyCollection->GetNumberOfItems();
+    for (int polyId = 0; polyId < nPolys; ++polyId)
+    {
+      vtkIdList* poly = polyCollection->GetItem(polyId);
+      if (poly->GetNumberOfIds() != 0)
+      {
+        for (vtkIdType i = 0; i < poly->GetNumberOfIds(); ++i)
+        {
+          auto local = std::lower_bound(localIds.begin(), localIds.end(),
+            std::make_pair(poly->GetId(i), vtkIdType(0)));
+          poly->SetId(i, local->second);
+        }
+        polys->InsertNextCell(poly);
+        batch.PolySources.push_back(cellDataOffset + firstCellId);
+      }
+      poly->Delete();
+    }
+    polyCollection->RemoveAllItems();
+  }
+  batch.Polys = polys;
+}
+
+// Copy the tuples of the arrays of a batch to the arrays of the output. The
+// arrays of both were allocated from the same input attributes, so they
+// match one to one.
+void CopyTuples(vtkDataSetAttributes* batchAttributes, vtkIdType batchStart, vtkIdType numTuples,
+  vtkDataSetAttributes* outAttributes, vtkIdType outId)
+{
+  const int numArrays = outAttributes->GetNumberOfArrays();
+  for (int a = 0; a < numArrays; ++a)
+  {
+    vtkAbstractArray* batchArray = batchAttributes->GetAbstractArray(a);
+    vtkAbstractArray* outArray = outAttributes->GetAbstractArray(a);
+    const vtkIdType n = std::min(numTuples, batchArray->GetNumberOfTuples() - batchStart);
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      outArray->SetTuple(outId + i, batchStart + i, batchArray);
+    }
+  }
+}
+
+// Gather the cells of one type of all the batches, in batch order, using the
+// output point ids.
+vtkSmartPointer<vtkCellArray> GatherCells(const std::vector<ContourBatch>& batches,
+  vtkSmartPointer<vtkCellArray> ContourBatch::*cells, const std::vector<vtkIdType>& pointOffsets,
+  const std::vector<vtkIdType>& pointMap, std::vector<vtkIdType>& cellOffsets)
+{
+  const vtkIdType numBatches = static_cast<vtkIdType>(batches.size());
+  std::vector<vtkIdType> connOffsets(numBatches + 1, 0);
+  cellOffsets.assign(numBatches + 1, 0);
+  for (vtkIdType batchId = 0; batchId < numBatches; ++batchId)
+  {
+    vtkCellArray* batchCells = batches[batchId].*cells;
+    cellOffsets[batchId + 1] =
+      cellOffsets[batchId] + (batchCells ? batchCells->GetNumberOfCells() : 0);
+    connOffsets[batchId + 1] =
+      connOffsets[batchId] + (batchCells ? batchCells->GetNumberOfConnectivityIds() : 0);
+  }
+  const vtkIdType numCells = cellOffsets[numBatches];
+  if (numCells == 0)
+  {
+    return nullptr;
+  }
+
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numCells + 1);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(connOffsets[numBatches]);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* connPtr = connectivity->GetPointer(0);
+  vtkSMPTools::For(0, numBatches, [&](vtkIdType beginBatch, vtkIdType endBatch) {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+    {
+      vtkCellArray* batchCells = batches[batchId].*cells;
+      if (!batchCells)
+      {
+        continue;
+      }
+      const vtkIdType* batchPointMap = pointMap.data() + pointOffsets[batchId];
+      vtkIdType cellId = cellOffsets[batchId];
+      vtkIdType connId = connOffsets[batchId];
+      auto iter = vtk::TakeSmartPointer(batchCells->NewIterator());
+      for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+      {
+        iter->GetCurrentCell(npts, pts);
+        offsetsPtr[cellId++] = connId;
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          connPtr[connId++] = batchPointMap[pts[i]];
+        }
+      }
+    }
+  });
+  offsetsPtr[numCells] = connOffsets[numBatches];
+  auto newCells = vtkSmartPointer<vtkCellArray>::New();
+  newCells->SetData(offsets, connectivity);
+  return newCells;
+}
+}
+
+//------------------------------------------------------------------------------
+// Threaded version of vtkContourGridExecute for vtkUnstructuredGrid inputs
+// and exact point merging. The cells of each dimension are contoured by
+// batches, then the points of all the batches are merged: exactly coincident
+// points are found with a static point locator and numbered in the order in
+// which the sequential path inserts them.
+static void vtkContourGridThreadedExecute(vtkContourGrid* self, vtkUnstructuredGrid* input,
+  vtkPolyData* output, vtkDataArray* inScalars, vtkIdType numContours, double* values,
+  int computeScalars, bool generateTriangles)
+{
+  vtkSmartPointer<vtkPointData> inPd = vtkContourGridInputPointData(input, inScalars);
+  vtkCellData* inCd = input->GetCellData();
+  vtkPointData* outPd = output->GetPointData();
+  vtkCellData* outCd = output->GetCellData();
+  const vtkIdType numCells = input->GetNumberOfCells();
+  const int pointsType = vtkContourGridOutputPointsType(self, input);
+
+  // These methods are thread safe once they have been called from a single
+  // thread.
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkIdList> ptIds;
+  input->GetCell(0, cell);
+  input->GetCellPoints(0, ptIds);
+  input->GetCellType(0);
+
+  // Contour the cells by increasing dimension, as the sequential path does.
+  unsigned char cellTypeDimensions[VTK_NUMBER_OF_CELL_TYPES];
+  vtkCutter::GetCellTypeDimensions(cellTypeDimensions);
+  const vtkIdType numBatchesPerDimension = (numCells - 1) / ContourBatchSize + 1;
+  std::vector<ContourBatch> batches(3 * numBatchesPerDimension);
+  ContourCells contourer{ self, input, inScalars, inPd, inCd, numContours, values,
+    computeScalars != 0, generateTriangles, pointsType, 0, cellTypeDimensions, nullptr };
+  for (int dimension = 1; dimension <= 3 && !self->GetAbortOutput(); ++dimension)
+  {
+    contourer.Dimension = dimension;
+    contourer.Batches = batches.data() + (dimension - 1) * numBatchesPerDimension;
+    vtkSMPTools::For(0, numBatchesPerDimension, contourer);
+  }
+
+  // Merge the exactly coincident points of all the batches.
+  const vtkIdType numBatches = static_cast<vtkIdType>(batches.size());
+  std::vector<vtkIdType> pointOffsets(numBatches + 1, 0);
+  for (vtkIdType batchId = 0; batchId < numBatches; ++batchId)
+  {
+    pointOffsets[batchId + 1] = pointOffsets[batchId] + batches[batchId].GetNumberOfPoints();
+  }
+  const vtkIdType numBatchPts = pointOffsets[numBatches];
+  vtkNew<vtkPoints> batchPts;
+  batchPts->SetDataType(pointsType);
+  batchPts->SetNumberOfPoints(numBatchPts);
+  vtkSMPTools::For(0, numBatches, [&](vtkIdType beginBatch, vtkIdType endBatch) {
+    double x[3];
+    for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+    {
+      const vtkIdType numPts = batches[batchId].GetNumberOfPoints();
+      for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+      {
+        batches[batchId].Points->GetPoint(ptId, x);
+        batchPts->SetPoint(pointOffsets[batchId] + ptId, x);
+      }
+    }
+  });
+  std::vector<vtkIdType> mergeMap(numBatchPts);
+  if (numBatchPts > 0)
+  {
+    vtkNew<vtkPolyData> batchData;
+    batchData->SetPoints(batchPts);
+    vtkNew<vtkStaticPointLocator> locator;
+    locator->SetDataSet(batchData);
+    locator->BuildLocator();
+    locator->MergePoints(0.0, mergeMap.data());
+  }
+
+  // Number the merged points in the order of their first insertion. This is a
+  // lightweight sequential pass.
+  std::vector<vtkIdType> newIds(numBatchPts, -1);
+  std::vector<vtkIdType> sourceIds;
+  for (vtkIdType ptId = 0; ptId < numBatchPts; ++ptId)
+  {
+    vtkIdType& newId = newIds[mergeMap[ptId]];
+    if (newId < 0)
+    {
+      newId = static_cast<vtkIdType>(sourceIds.size());
+      sourceIds.push_back(ptId);
+    }
+  }
+  const vtkIdType numNewPts = static_cast<vtkIdType>(sourceIds.size());
+  std::vector<vtkIdType> pointMap(numBatchPts);
+  vtkSMPTools::For(0, numBatchPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      pointMap[ptId] = newIds[mergeMap[ptId]];
+    }
+  });
+
+  // Copy the points and their data from the first batch point they merge.
+  vtkNew<vtkPoints> newPts;
+  newPts->SetDataType(pointsType);
+  newPts->SetNumberOfPoints(numNewPts);
+  if (!computeScalars)
+  {
+    outPd->CopyScalarsOff();
+  }
+  outPd->InterpolateAllocate(inPd, numNewPts);
+  for (int a = 0; a < outPd->GetNumberOfArrays(); ++a)
+  {
+    outPd->GetAbstractArray(a)->SetNumberOfTuples(numNewPts);
+  }
+  vtkSMPTools::For(0, numNewPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double x[3];
+    for (; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType sourceId = sourceIds[ptId];
+      const vtkIdType batchId =
+        std::upper_bound(pointOffsets.begin(), pointOffsets.end(), sourceId) -
+        pointOffsets.begin() - 1;
+      batchPts->GetPoint(sourceId, x);
+      newPts->SetPoint(ptId, x);
+      CopyTuples(batches[batchId].PointData, sourceId - pointOffsets[batchId], 1, outPd, ptId);
+    }
+  });
+  output->SetPoints(newPts);
+
+  if (!generateTriangles)
+  {
+    vtkSMPTools::For(0, numBatches, [&](vtkIdType beginBatch, vtkIdType endBatch) {
+      for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+      {
+        if (!batches[batchId].PolyGroups.empty())
+        {
+          MergeTriangles(batches[batchId], pointMap.data() + pointOffsets[batchId]);
+        }
+      }
+    });
+  }
+
+  // Gather the verts, lines and polys of the batches, then their data. The
+  // cell data of each batch is ordered as verts, lines and polys.
+  std::vector<vtkIdType> vertOffsets, lineOffsets, polyOffsets;
+  auto newVerts = GatherCells(batches, &ContourBatch::Verts, pointOffsets, pointMap, vertOffsets);
+  auto newLines = GatherCells(batches, &ContourBatch::Lines, pointOffsets, pointMap, lineOffsets);
+  auto newPolys = GatherCells(batches, &ContourBatch::Polys, pointOffsets, pointMap, polyOffsets);
+  if (newVerts)
+  {
+    output->SetVerts(newVerts);
+  }
+  if (newLines)
+  {
+    output->SetLines(newLines);
+  }
+  if (newPolys)
+  {
+    output->SetPolys(newPolys);
+  }
+
+  const vtkIdType numVerts = vertOffsets[numBatches];
+  const vtkIdType numLines = lineOffsets[numBatches];
+  const vtkIdType numNewCells = numVerts + numLines + polyOffsets[numBatches];
+  outCd->CopyAllocate(inCd, numNewCells);
+  for (int a = 0; a < outCd->GetNumberOfArrays(); ++a)
+  {
+    outCd->GetAbstractArray(a)->SetNumberOfTuples(numNewCells);
+  }
+  vtkSMPTools::For(0, numBatches, [&](vtkIdType beginBatch, vtkIdType endBatch) {
+    for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+    {
+      vtkCellData* batchCd = batches[batchId].CellData;
+      if (!batchCd)
+      {
+        continue;
+      }
+      const vtkIdType batchVerts = vertOffsets[batchId + 1] - vertOffsets[batchId];
+      const vtkIdType batchLines = lineOffsets[batchId + 1] - lineOffsets[batchId];
+      const vtkIdType batchPolys = polyOffsets[batchId + 1] - polyOffsets[batchId];
+      CopyTuples(batchCd, 0, batchVerts, outCd, vertOffsets[batchId]);
+      CopyTuples(batchCd, batchVerts, batchLines, outCd, numVerts + lineOffsets[batchId]);
+      const vtkIdType firstPolyId = numVerts + numLines + polyOffsets[batchId];
+      if (batches[batchId].PolyGroups.empty())
+      {
+        CopyTuples(batchCd, batchVerts + batchLines, batchPolys, outCd, firstPolyId);
+      }
+      else
+      {
+        const std::vector<vtkIdType>& polySources = batches[batchId].PolySources;
+        for (vtkIdType polyId = 0; polyId < batchPolys; ++polyId)
+        {
+          CopyTuples(batchCd, polySources[polyId], 1, outCd, firstPolyId + polyId);
+        }
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 // Contouring filter for unstructured grids.
 //
@@ -422,8 +985,19 @@ int vtkContourGrid::RequestData(vtkInformation* vtkNotUsed(request),
     scalarTree->SetScalars(inScalars);
   }
 
-  vtkContourGridExecute(this, input, output, inScalars, numContours, values, computeScalars,
-    useScalarTree, scalarTree, this->GenerateTriangles != 0);
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (this->UseParallelContouring && !useScalarTree && grid &&
+    vtkMergePoints::SafeDownCast(this->Locator))
+  {
+    vtkDebugMacro(<< "Using threaded contouring");
+    vtkContourGridThreadedExecute(this, grid, output, inScalars, numContours, values,
+      computeScalars, this->GenerateTriangles != 0);
+  }
+  else
+  {
+    vtkContourGridExecute(this, input, output, inScalars, numContours, values, computeScalars,
+      useScalarTree, scalarTree, this->GenerateTriangles != 0);
+  }
 
   if (this->ComputeNormals)
   {
@@ -526,6 +1100,7 @@ void vtkContourGrid::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Compute Normals: " << (this->ComputeNormals ? "On\n" : "Off\n");
   os << indent << "Compute Scalars: " << (this->ComputeScalars ? "On\n" : "Off\n");
   os << indent << "Use Scalar Tree: " << (this->UseScalarTree ? "On\n" : "Off\n");
+  os << indent << "Use Parallel Contouring: " << (this->UseParallelContouring ? "On\n" : "Off\n");
 
   this->ContourValues->PrintSelf(os, indent.GetNextIndent());
 
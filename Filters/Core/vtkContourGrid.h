@@ -155,6 +155,21 @@ public:
   vtkBooleanMacro(GenerateTriangles, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off contouring the cells in parallel. If on, and the input is a
+   * vtkUnstructuredGrid contoured without a scalar tree and with a
+   * vtkMergePoints locator (the default), batches of cells are contoured
+   * concurrently and their points are then merged. The output is the same as
+   * the one produced sequentially, except that single precision points that
+   * coincide once rounded are always merged, where the sequential contouring
+   * may keep some of them apart. Default is off.
+   */
+  vtkSetMacro(UseParallelContouring, bool);
+  vtkGetMacro(UseParallelContouring, bool);
+  vtkBooleanMacro(UseParallelContouring, bool);
+  ///@}
+
   /**
    * Create default locator. Used to create one when none is
    * specified. The locator is used to merge coincident points.
@@ -182,6 +197,7 @@ protected:
   vtkTypeBool ComputeNormals;
   vtkTypeBool ComputeScalars;
   vtkTypeBool GenerateTriangles;
+  bool UseParallelContouring;
 
   vtkIncrementalPointLocator* Locator;
 
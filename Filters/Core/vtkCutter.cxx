@@ -19,6 +19,7 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
+#include "vtkContourGrid.h"
 #include "vtkContourHelper.h"
 #include "vtkContourValues.h"
 #include "vtkDataSet.h"
@@ -41,17 +42,62 @@
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearSynchronizedTemplates.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkSynchronizedTemplates3D.h"
 #include "vtkSynchronizedTemplatesCutter3D.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridBase.h"
 
 #include <algorithm>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Evaluate the cut function at ranges of points through the FunctionValue
+// batch API, using arrays that wrap the matching parts of the point
+// coordinates and of the scalars.
+template <typename TPointsArray>
+struct EvaluateCutFunction
+{
+  vtkImplicitFunction* Function;
+  TPointsArray* Points;
+  vtkDoubleArray* Scalars;
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkSmartPointer<TPointsArray> points = vtkSmartPointer<TPointsArray>::New();
+    points->SetNumberOfComponents(3);
+    points->SetArray(this->Points->GetPointer(3 * begin), 3 * (end - begin), 1);
+    vtkNew<vtkDoubleArray> scalars;
+    scalars->SetArray(this->Scalars->GetPointer(begin), end - begin, 1);
+    this->Function->FunctionValue(points, scalars);
+  }
+};
+
+void ComputeCutScalars(vtkImplicitFunction* function, vtkDataArray* points, vtkDoubleArray* scalars)
+{
+  scalars->SetNumberOfTuples(points->GetNumberOfTuples());
+  if (vtkFloatArray* floatPoints = vtkArrayDownCast<vtkFloatArray>(points))
+  {
+    EvaluateCutFunction<vtkFloatArray> evaluate = { function, floatPoints, scalars };
+    vtkSMPTools::For(0, points->GetNumberOfTuples(), evaluate);
+  }
+  else if (vtkDoubleArray* doublePoints = vtkArrayDownCast<vtkDoubleArray>(points))
+  {
+    EvaluateCutFunction<vtkDoubleArray> evaluate = { function, doublePoints, scalars };
+    vtkSMPTools::For(0, points->GetNumberOfTuples(), evaluate);
+  }
+  else
+  {
+    function->FunctionValue(points, scalars);
+  }
+}
+}
+
 vtkObjectFactoryNewMacro(vtkCutter);
 vtkCxxSetObjectMacro(vtkCutter, CutFunction, vtkImplicitFunction);
 vtkCxxSetObjectMacro(vtkCutter, Locator, vtkIncrementalPointLocator);
@@ -66,9 +112,11 @@ vtkCutter::vtkCutter(vtkImplicitFunction* cf)
   this->GenerateCutScalars = 0;
   this->Locator = nullptr;
   this->GenerateTriangles = 1;
+  this->UseParallelCutting = false;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
 
   this->PlaneCutter->SetContainerAlgorithm(this);
+  this->ContourGrid->SetContainerAlgorithm(this);
   this->SynchronizedTemplates3D->SetContainerAlgorithm(this);
   this->SynchronizedTemplatesCutter3D->SetContainerAlgorithm(this);
   this->GridSynchronizedTemplates->SetContainerAlgorithm(this);
@@ -415,6 +463,12 @@ int vtkCutter::RequestData(
     {
       executePlaneCutter();
     }
+    else if (this->UseParallelCutting && this->SortBy == VTK_SORT_BY_VALUE &&
+      vtkUnstructuredGrid::SafeDownCast(input) &&
+      (!this->Locator || vtkMergePoints::SafeDownCast(this->Locator)))
+    {
+      this->ThreadedUnstructuredGridCutter(input, output);
+    }
     else
     {
       this->UnstructuredGridCutter(input, output);
@@ -1039,6 +1093,68 @@ void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
   output->Squeeze();
 }
 
+//------------------------------------------------------------------------------
+// Same output as UnstructuredGridCutter sorting by value, the cut scalars
+// being computed and contoured by several threads.
+void vtkCutter::ThreadedUnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
+{
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input);
+  vtkPointData* inPD = grid->GetPointData();
+
+  vtkNew<vtkDoubleArray> cutScalars;
+  cutScalars->SetName("cutScalars");
+  ComputeCutScalars(this->CutFunction, grid->GetPoints()->GetData(), cutScalars);
+  if (this->CheckAbort())
+  {
+    return;
+  }
+
+  vtkNew<vtkUnstructuredGrid> contourData;
+  contourData->ShallowCopy(grid);
+  if (this->GenerateCutScalars)
+  {
+    contourData->GetPointData()->SetScalars(cutScalars);
+  }
+  else
+  {
+    contourData->GetPointData()->AddArray(cutScalars);
+  }
+
+  vtkIdType numContours = this->GetNumberOfContours();
+  this->ContourGrid->SetDebug(this->GetDebug());
+  this->ContourGrid->SetOutputPointsPrecision(this->OutputPointsPrecision);
+  this->ContourGrid->SetInputData(contourData);
+  this->ContourGrid->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "cutScalars");
+  this->ContourGrid->SetNumberOfContours(numContours);
+  for (vtkIdType i = 0; i < numContours; i++)
+  {
+    this->ContourGrid->SetValue(i, this->GetValue(i));
+  }
+  this->ContourGrid->SetComputeScalars(this->GenerateCutScalars);
+  this->ContourGrid->ComputeNormalsOff();
+  this->ContourGrid->SetGenerateTriangles(this->GetGenerateTriangles());
+  this->ContourGrid->UseParallelContouringOn();
+  this->ContourGrid->Update();
+  output->ShallowCopy(this->ContourGrid->GetOutput());
+  this->ContourGrid->SetInputData(nullptr);
+
+  // Match the attributes of the sequential cut: the cut scalars are unnamed,
+  // and the scalars of the input stay active when they are not replaced.
+  vtkPointData* outPD = output->GetPointData();
+  if (this->GenerateCutScalars)
+  {
+    if (outPD->GetScalars())
+    {
+      outPD->GetScalars()->SetName(nullptr);
+    }
+  }
+  else if (inPD->GetScalars() && inPD->GetScalars()->GetName())
+  {
+    outPD->SetActiveScalars(inPD->GetScalars()->GetName());
+  }
+}
+
 //------------------------------------------------------------------------------
 // Specify a spatial locator for merging points. By default,
 // an instance of vtkMergePoints is used.
@@ -1088,6 +1204,7 @@ void vtkCutter::PrintSelf(ostream& os, vtkIndent indent)
   this->ContourValues->PrintSelf(os, indent.GetNextIndent());
 
   os << indent << "Generate Cut Scalars: " << (this->GenerateCutScalars ? "On\n" : "Off\n");
+  os << indent << "Use Parallel Cutting: " << (this->UseParallelCutting ? "On\n" : "Off\n");
 
   os << indent << "Precision of the output points: " << this->OutputPointsPrecision << "\n";
 }
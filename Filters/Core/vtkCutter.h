@@ -58,6 +58,7 @@
 #define VTK_SORT_BY_CELL 1
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkContourGrid;
 class vtkGridSynchronizedTemplates3D;
 class vtkImplicitFunction;
 class vtkIncrementalPointLocator;
@@ -170,6 +171,23 @@ public:
   vtkBooleanMacro(GenerateTriangles, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off cutting unstructured grids in parallel. If on, and the input
+   * is a vtkUnstructuredGrid sorted by value with a vtkMergePoints locator (the
+   * default), the cut function is evaluated by several threads and the cells
+   * are then contoured concurrently by vtkContourGrid, see
+   * vtkContourGrid::SetUseParallelContouring(). The cut function must
+   * then be safe to evaluate from several threads, which is the case of the
+   * analytic functions such as vtkSphere, vtkCylinder or vtkImplicitBoolean
+   * combinations of them, but not of vtkImplicitDataSet for instance.
+   * Default is off.
+   */
+  vtkSetMacro(UseParallelCutting, bool);
+  vtkGetMacro(UseParallelCutting, bool);
+  vtkBooleanMacro(UseParallelCutting, bool);
+  ///@}
+
   ///@{
   /**
    * Specify a spatial locator for merging points. By default,
@@ -233,6 +251,7 @@ protected:
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int FillInputPortInformation(int port, vtkInformation* info) override;
   void UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output);
+  void ThreadedUnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output);
   void DataSetCutter(vtkDataSet* input, vtkPolyData* output);
   void StructuredPointsCutter(
     vtkDataSet*, vtkPolyData*, vtkInformation*, vtkInformationVector**, vtkInformationVector*);
@@ -240,12 +259,14 @@ protected:
   void RectilinearGridCutter(vtkDataSet*, vtkPolyData*);
   vtkImplicitFunction* CutFunction;
   vtkTypeBool GenerateTriangles;
+  bool UseParallelCutting;
 
   vtkNew<vtkSynchronizedTemplates3D> SynchronizedTemplates3D;
   vtkNew<vtkSynchronizedTemplatesCutter3D> SynchronizedTemplatesCutter3D;
   vtkNew<vtkGridSynchronizedTemplates3D> GridSynchronizedTemplates;
   vtkNew<vtkRectilinearSynchronizedTemplates> RectilinearSynchronizedTemplates;
   vtkNew<vtkPlaneCutter> PlaneCutter;
+  vtkNew<vtkContourGrid> ContourGrid;
 
   vtkIncrementalPointLocator* Locator;
   int SortBy;
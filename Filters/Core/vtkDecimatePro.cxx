@@ -17,17 +17,27 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDoubleArray.h"
+#include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLine.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPriorityQueue.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDecimatePro);
 
@@ -85,11 +95,13 @@ vtkDecimatePro::vtkDecimatePro()
   this->BoundaryVertexDeletion = 1;
   this->InflectionPointRatio = 10.0;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+  this->NumberOfTiles = 1;
 
   this->Queue = nullptr;
   this->VertexError = nullptr;
 
   this->Mesh = nullptr;
+  this->NumberOfLockedPoints = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -104,6 +116,10 @@ vtkDecimatePro::~vtkDecimatePro()
   {
     this->VertexError->Delete();
   }
+  if (this->Mesh)
+  {
+    this->Mesh->Delete();
+  }
   this->Neighbors->Delete();
   this->EdgeLengths->Delete();
   delete this->V;
@@ -125,32 +141,13 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPolyData* input = vtkPolyData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
-  vtkIdType i, ptId, numPts, numTris, collapseId;
-  vtkPoints* inPts;
-  vtkPoints* newPts;
-  vtkCellArray* inPolys;
-  vtkCellArray* newPolys;
-  double error, previousError = 0.0, reduction;
-  int type;
-  vtkIdType npts;
-  const vtkIdType* pts;
-  vtkIdType totalEliminated, numRecycles, numPops;
-  vtkIdType ncells;
-  vtkIdType pt1, pt2, cellId, fedges[2];
-  vtkIdType* cells;
-  vtkIdList* CollapseTris;
+  vtkIdType i, numPts, numTris;
   double max;
   if (!input)
   {
     vtkErrorMacro(<< "No input!");
     return 1;
   }
-  vtkPointData* outputPD = output->GetPointData();
-  vtkPointData* inPD = input->GetPointData();
-  vtkPointData* meshPD = nullptr;
-  vtkIdType *map, numNewPts, totalPts;
-  vtkIdType newCellPts[3];
-  bool abortExecute = false;
 
   vtkDebugMacro(<< "Executing progressive decimation...");
 
@@ -178,11 +175,6 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
     this->Error = (this->AbsoluteError >= VTK_DOUBLE_MAX ? VTK_DOUBLE_MAX : this->AbsoluteError);
   }
   this->Tolerance = VTK_TOLERANCE * input->GetLength();
-  this->CosAngle = cos(vtkMath::RadiansFromDegrees(this->FeatureAngle));
-  this->Split = (this->Splitting && !this->PreserveTopology);
-  this->VertexDegree = this->Degree;
-  this->TheSplitAngle = this->SplitAngle;
-  this->SplitState = VTK_STATE_UNSPLIT;
 
   // Lets check to make sure there are only triangles in the input.
   {
@@ -197,66 +189,114 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
-  // Build cell data structure. Need to copy triangle connectivity data
-  // so we can modify it.
-  if (this->TargetReduction > 0.0)
+  if (this->TargetReduction <= 0.0)
   {
-    inPts = input->GetPoints();
-    inPolys = input->GetPolys();
+    output->CopyStructure(input);
+    output->GetPointData()->PassData(input->GetPointData());
+    output->GetCellData()->PassData(input->GetCellData());
+    // vtkWarningMacro(<<"Reduction == 0: passing data through unchanged");
+    return 1;
+  }
 
-    // this static should be eliminated
-    if (this->Mesh != nullptr)
-    {
-      this->Mesh->Delete();
-      this->Mesh = nullptr;
-    }
-    this->Mesh = vtkPolyData::New();
+  if (this->NumberOfTiles > 1 && numTris > this->NumberOfTiles)
+  {
+    this->DecimateTiles(input, output);
+  }
+  else
+  {
+    this->NumberOfLockedPoints = 0;
+    this->Decimate(input, this->TargetReduction, true);
+    this->BuildOutput(output);
+  }
 
-    newPts = vtkPoints::New();
+  return 1;
+}
 
-    if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
-    {
-      newPts->SetDataType(inPts->GetDataType());
-    }
-    else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
-    {
-      newPts->SetDataType(VTK_FLOAT);
-    }
-    else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
-    {
-      newPts->SetDataType(VTK_DOUBLE);
-    }
+//------------------------------------------------------------------------------
+// Decimate the triangles of input into this->Mesh, deleting the fraction
+// targetReduction of them. Error and Tolerance must have been set.
+void vtkDecimatePro::Decimate(vtkPolyData* input, double targetReduction, bool reportProgress)
+{
+  vtkIdType i, ptId, numPts, numTris, collapseId;
+  vtkPoints* inPts;
+  vtkPoints* newPts;
+  vtkCellArray* inPolys;
+  vtkCellArray* newPolys;
+  double error, previousError = 0.0, reduction;
+  int type;
+  vtkIdType npts;
+  vtkIdType totalEliminated, numRecycles, numPops;
+  vtkIdType ncells;
+  vtkIdType pt1, pt2, fedges[2];
+  vtkIdType* cells;
+  vtkIdList* CollapseTris;
+  vtkPointData* inPD = input->GetPointData();
+  vtkPointData* meshPD = nullptr;
+  vtkIdType totalPts;
+  bool abortExecute = false;
 
-    newPts->SetNumberOfPoints(numPts);
-    newPts->DeepCopy(inPts);
-    this->Mesh->SetPoints(newPts);
-    newPts->Delete(); // registered by Mesh and preserved
+  this->NumberOfRemainingTris = numTris = input->GetNumberOfPolys();
+  numPts = input->GetNumberOfPoints();
+  this->CosAngle = cos(vtkMath::RadiansFromDegrees(this->FeatureAngle));
+  this->Split = (this->Splitting && !this->PreserveTopology);
+  this->VertexDegree = this->Degree;
+  this->TheSplitAngle = this->SplitAngle;
+  this->SplitState = VTK_STATE_UNSPLIT;
 
-    newPolys = vtkCellArray::New();
-    newPolys->DeepCopy(inPolys);
-    this->Mesh->SetPolys(newPolys);
-    newPolys->Delete(); // registered by Mesh and preserved
+  // Build cell data structure. Need to copy triangle connectivity data
+  // so we can modify it.
+  inPts = input->GetPoints();
+  inPolys = input->GetPolys();
 
-    meshPD = this->Mesh->GetPointData();
-    meshPD->DeepCopy(inPD);
-    meshPD->CopyAllocate(meshPD, input->GetNumberOfPoints());
+  // this static should be eliminated
+  if (this->Mesh != nullptr)
+  {
+    this->Mesh->Delete();
+    this->Mesh = nullptr;
+  }
+  this->Mesh = vtkPolyData::New();
 
-    this->Mesh->BuildLinks();
+  newPts = vtkPoints::New();
+
+  if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
+  {
+    newPts->SetDataType(inPts->GetDataType());
   }
-  else
+  else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
   {
-    output->CopyStructure(input);
-    output->GetPointData()->PassData(input->GetPointData());
-    output->GetCellData()->PassData(input->GetCellData());
-    // vtkWarningMacro(<<"Reduction == 0: passing data through unchanged");
-    return 1;
+    newPts->SetDataType(VTK_FLOAT);
+  }
+  else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+  {
+    newPts->SetDataType(VTK_DOUBLE);
   }
 
+  newPts->SetNumberOfPoints(numPts);
+  newPts->DeepCopy(inPts);
+  this->Mesh->SetPoints(newPts);
+  newPts->Delete(); // registered by Mesh and preserved
+
+  newPolys = vtkCellArray::New();
+  newPolys->DeepCopy(inPolys);
+  this->Mesh->SetPolys(newPolys);
+  newPolys->Delete(); // registered by Mesh and preserved
+
+  meshPD = this->Mesh->GetPointData();
+  meshPD->DeepCopy(inPD);
+  meshPD->CopyAllocate(meshPD, input->GetNumberOfPoints());
+
+  this->Mesh->EditableOn();
+  this->Mesh->BuildLinks();
+
   // Initialize data structures: priority queue and errors.
   this->InitializeQueue(numPts);
 
   if (this->AccumulateError)
   {
+    if (this->VertexError)
+    {
+      this->VertexError->Delete();
+    }
     this->VertexError = vtkDoubleArray::New();
     this->VertexError->Allocate(numPts, static_cast<vtkIdType>(0.25 * numPts));
     for (i = 0; i < numPts; i++)
@@ -283,7 +323,7 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
   npts = this->Mesh->GetNumberOfPoints();
   for (ptId = 0; ptId < npts && !abortExecute; ptId++)
   {
-    if (!(ptId % 10000))
+    if (reportProgress && !(ptId % 10000))
     {
       vtkDebugMacro(<< "Inserting vertex #" << ptId);
       this->UpdateProgress(0.25 * ptId / npts); // 25% spent inserting
@@ -291,7 +331,10 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
     }
     this->Insert(ptId);
   }
-  this->UpdateProgress(0.25); // 25% spent inserting
+  if (reportProgress)
+  {
+    this->UpdateProgress(0.25); // 25% spent inserting
+  }
 
   CollapseTris = vtkIdList::New();
   CollapseTris->Allocate(100, 100);
@@ -303,13 +346,12 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
   // (While this is happening we keep track of operations on the data -
   // this forms the core of the progressive mesh representation.)
   for (totalEliminated = 0, reduction = 0.0, numRecycles = 0, numPops = 0;
-       reduction < this->TargetReduction && (ptId = this->Pop(error)) >= 0 && !abortExecute;
-       numPops++)
+       reduction < targetReduction && (ptId = this->Pop(error)) >= 0 && !abortExecute; numPops++)
   {
-    if (numPops && !(numPops % 5000))
+    if (reportProgress && numPops && !(numPops % 5000))
     {
       vtkDebugMacro(<< "Deleting vertex #" << numPops);
-      this->UpdateProgress(0.25 + 0.75 * (reduction / this->TargetReduction));
+      this->UpdateProgress(0.25 + 0.75 * (reduction / targetReduction));
       abortExecute = this->CheckAbort();
     }
 
@@ -368,14 +410,32 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
                 << "\n\tAdded " << totalPts - numPts << " points (" << numPts << " to " << totalPts
                 << " points)");
 
+  this->DeleteQueue();
+}
+
+//------------------------------------------------------------------------------
+// Create the output from the remaining triangles of this->Mesh, and release
+// the mesh.
+void vtkDecimatePro::BuildOutput(vtkPolyData* output)
+{
+  vtkIdType i, ptId, cellId, ncells, npts;
+  vtkIdType* cells;
+  const vtkIdType* pts;
+  vtkIdType *map, numNewPts, totalPts;
+  vtkIdType newCellPts[3];
+  vtkPointData* outputPD = output->GetPointData();
+  vtkPointData* meshPD = this->Mesh->GetPointData();
+  vtkPoints* newPts = this->Mesh->GetPoints();
+  vtkIdType numTris = this->Mesh->GetNumberOfCells();
+
   //
   // Create output and release memory
   //
   vtkDebugMacro(<< "Creating output...");
-  this->DeleteQueue();
 
   // Grab the points that are left; copy point data. Remember that splitting
   // data may have added new points.
+  totalPts = this->Mesh->GetNumberOfPoints();
   map = new vtkIdType[totalPts];
   for (i = 0; i < totalPts; i++)
   {
@@ -407,8 +467,8 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
   newPts->Squeeze();
 
   // Now renumber connectivity
-  newPolys = vtkCellArray::New();
-  newPolys->AllocateEstimate(numTris - totalEliminated, 3);
+  vtkCellArray* newPolys = vtkCellArray::New();
+  newPolys->AllocateEstimate(this->NumberOfRemainingTris, 3);
 
   for (cellId = 0; cellId < numTris; cellId++)
   {
@@ -432,8 +492,303 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
     this->Mesh = nullptr;
   }
   newPolys->Delete();
+}
 
-  return 1;
+namespace
+{
+// Assign the triangles of [begin, end) to numTiles tiles, numbered from
+// firstTile, by recursive bisection of their centroids along the longest
+// axis of their bounds.
+void BisectTiles(vtkIdType* begin, vtkIdType* end, int numTiles, int firstTile,
+  const std::vector<double>& centroids, std::vector<int>& tileOfTri)
+{
+  if (numTiles == 1 || end - begin < 2)
+  {
+    for (vtkIdType* it = begin; it != end; ++it)
+    {
+      tileOfTri[*it] = firstTile;
+    }
+    return;
+  }
+
+  double bounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+    VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+  for (vtkIdType* it = begin; it != end; ++it)
+  {
+    const double* c = centroids.data() + 3 * (*it);
+    for (int j = 0; j < 3; ++j)
+    {
+      bounds[2 * j] = std::min(bounds[2 * j], c[j]);
+      bounds[2 * j + 1] = std::max(bounds[2 * j + 1], c[j]);
+    }
+  }
+  int axis = 0;
+  for (int j = 1; j < 3; ++j)
+  {
+    if (bounds[2 * j + 1] - bounds[2 * j] > bounds[2 * axis + 1] - bounds[2 * axis])
+    {
+      axis = j;
+    }
+  }
+
+  const int numLeftTiles = numTiles / 2;
+  vtkIdType* middle = begin + (end - begin) * numLeftTiles / numTiles;
+  std::nth_element(begin, middle, end, [&centroids, axis](vtkIdType a, vtkIdType b) {
+    return centroids[3 * a + axis] < centroids[3 * b + axis];
+  });
+  BisectTiles(begin, middle, numLeftTiles, firstTile, centroids, tileOfTri);
+  BisectTiles(middle, end, numTiles - numLeftTiles, firstTile + numLeftTiles, centroids, tileOfTri);
+}
+}
+
+//------------------------------------------------------------------------------
+// Decimate spatial tiles of the input concurrently, locking the points they
+// share, then decimate the merged tiles serially to reach the target
+// reduction.
+void vtkDecimatePro::DecimateTiles(vtkPolyData* input, vtkPolyData* output)
+{
+  vtkPoints* inPts = input->GetPoints();
+  vtkCellArray* inPolys = input->GetPolys();
+  vtkPointData* inPD = input->GetPointData();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numTris = inPolys->GetNumberOfCells();
+  const int numTiles = this->NumberOfTiles;
+
+  // Partition the triangles into tiles.
+  std::vector<double> centroids(3 * numTris);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+  vtkSMPTools::For(0, numTris, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* cellPts = tlCellPts.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double x[3];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      inPolys->GetCellAtId(cellId, npts, pts, cellPts);
+      double* c = centroids.data() + 3 * cellId;
+      c[0] = c[1] = c[2] = 0.0;
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        inPts->GetPoint(pts[i], x);
+        c[0] += x[0] / npts;
+        c[1] += x[1] / npts;
+        c[2] += x[2] / npts;
+      }
+    }
+  });
+  std::vector<vtkIdType> tris(numTris);
+  std::iota(tris.begin(), tris.end(), 0);
+  std::vector<int> tileOfTri(numTris);
+  BisectTiles(tris.data(), tris.data() + numTris, numTiles, 0, centroids, tileOfTri);
+  centroids.clear();
+  centroids.shrink_to_fit();
+
+  // Sort the triangles by tile, keeping their order, and lock the points
+  // used by several tiles.
+  std::vector<vtkIdType> tileOffsets(numTiles + 1, 0);
+  for (vtkIdType cellId = 0; cellId < numTris; ++cellId)
+  {
+    tileOffsets[tileOfTri[cellId] + 1]++;
+  }
+  std::partial_sum(tileOffsets.begin(), tileOffsets.end(), tileOffsets.begin());
+  std::vector<vtkIdType> insertAt(tileOffsets.begin(), tileOffsets.end() - 1);
+  const int lockedPoint = -2;
+  std::vector<int> tileOfPoint(numPts, -1);
+  vtkNew<vtkIdList> cellPts;
+  for (vtkIdType cellId = 0; cellId < numTris; ++cellId)
+  {
+    const int tile = tileOfTri[cellId];
+    tris[insertAt[tile]++] = cellId;
+    vtkIdType npts;
+    const vtkIdType* pts;
+    inPolys->GetCellAtId(cellId, npts, pts, cellPts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      int& pointTile = tileOfPoint[pts[i]];
+      pointTile = (pointTile == -1 || pointTile == tile) ? tile : lockedPoint;
+    }
+  }
+  tileOfTri.clear();
+  tileOfTri.shrink_to_fit();
+
+  // Decimate the tiles concurrently. Each tile is decimated by its own
+  // instance, whose mesh is kept until the tiles are merged. The locked
+  // points come first in each tile, and are listed with the other input
+  // points of the tile in tilePoints.
+  std::vector<vtkSmartPointer<vtkDecimatePro>> tileDecimators(numTiles);
+  for (auto& decimator : tileDecimators)
+  {
+    decimator = vtkSmartPointer<vtkDecimatePro>::New();
+    decimator->FeatureAngle = this->FeatureAngle;
+    decimator->SplitAngle = this->SplitAngle;
+    decimator->Splitting = this->Splitting;
+    decimator->PreSplitMesh = this->PreSplitMesh;
+    decimator->BoundaryVertexDeletion = this->BoundaryVertexDeletion;
+    decimator->PreserveTopology = this->PreserveTopology;
+    decimator->Degree = this->Degree;
+    decimator->AccumulateError = this->AccumulateError;
+    decimator->InflectionPointRatio = this->InflectionPointRatio;
+    decimator->Error = this->Error;
+    decimator->Tolerance = this->Tolerance;
+  }
+  std::vector<std::vector<vtkIdType>> tilePoints(numTiles);
+  vtkSMPThreadLocal<std::vector<vtkIdType>> tlPointMap;
+  bool isFirst = vtkSMPTools::GetSingleThread();
+  vtkSMPTools::For(0, numTiles, 1, [&](vtkIdType beginTile, vtkIdType endTile) {
+    std::vector<vtkIdType>& pointMap = tlPointMap.Local();
+    pointMap.resize(numPts, -1);
+    vtkIdList* tileCellPts = tlCellPts.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double x[3];
+    for (vtkIdType tile = beginTile; tile < endTile; ++tile)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+
+      // Gather the points of the tile, locked ones first.
+      std::vector<vtkIdType>& ptIds = tilePoints[tile];
+      for (vtkIdType i = tileOffsets[tile]; i < tileOffsets[tile + 1]; ++i)
+      {
+        inPolys->GetCellAtId(tris[i], npts, pts, tileCellPts);
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          if (pointMap[pts[j]] < 0)
+          {
+            pointMap[pts[j]] = 0;
+            ptIds.push_back(pts[j]);
+          }
+        }
+      }
+      auto isLocked = [&](vtkIdType ptId) { return tileOfPoint[ptId] == lockedPoint; };
+      const vtkIdType numLocked =
+        std::stable_partition(ptIds.begin(), ptIds.end(), isLocked) - ptIds.begin();
+
+      const vtkIdType numTilePts = static_cast<vtkIdType>(ptIds.size());
+      vtkNew<vtkPoints> tilePts;
+      tilePts->SetDataType(inPts->GetDataType());
+      tilePts->SetNumberOfPoints(numTilePts);
+      vtkNew<vtkPolyData> tileMesh;
+      vtkPointData* tilePD = tileMesh->GetPointData();
+      tilePD->CopyAllocate(inPD, numTilePts);
+      for (vtkIdType i = 0; i < numTilePts; ++i)
+      {
+        pointMap[ptIds[i]] = i;
+        inPts->GetPoint(ptIds[i], x);
+        tilePts->SetPoint(i, x);
+        tilePD->CopyData(inPD, ptIds[i], i);
+      }
+
+      vtkNew<vtkCellArray> tilePolys;
+      tilePolys->AllocateExact(tileOffsets[tile + 1] - tileOffsets[tile],
+        3 * (tileOffsets[tile + 1] - tileOffsets[tile]));
+      for (vtkIdType i = tileOffsets[tile]; i < tileOffsets[tile + 1]; ++i)
+      {
+        inPolys->GetCellAtId(tris[i], npts, pts, tileCellPts);
+        tilePolys->InsertNextCell(npts);
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          tilePolys->InsertCellPoint(pointMap[pts[j]]);
+        }
+      }
+      for (vtkIdType ptId : ptIds)
+      {
+        pointMap[ptId] = -1;
+      }
+      tileMesh->SetPoints(tilePts);
+      tileMesh->SetPolys(tilePolys);
+
+      vtkDecimatePro* decimator = tileDecimators[tile];
+      decimator->NumberOfLockedPoints = numLocked;
+      decimator->Decimate(tileMesh, this->TargetReduction, false);
+    }
+  });
+  if (this->GetAbortOutput())
+  {
+    return;
+  }
+  this->UpdateProgress(0.5);
+  tris.clear();
+  tris.shrink_to_fit();
+
+  // Merge the tiles in order. The points split by the tiles are new points,
+  // the input points shared by several tiles are merged back.
+  vtkNew<vtkPolyData> merged;
+  vtkNew<vtkPoints> mergedPts;
+  mergedPts->SetDataType(inPts->GetDataType());
+  mergedPts->Allocate(numPts);
+  vtkNew<vtkCellArray> mergedPolys;
+  vtkPointData* mergedPD = merged->GetPointData();
+  mergedPD->CopyAllocate(tileDecimators[0]->Mesh->GetPointData(), numPts);
+  std::vector<vtkIdType> mergedIds(numPts, -1);
+  for (int tile = 0; tile < numTiles; ++tile)
+  {
+    vtkPolyData* mesh = tileDecimators[tile]->Mesh;
+    vtkPointData* meshPD = mesh->GetPointData();
+    const std::vector<vtkIdType>& ptIds = tilePoints[tile];
+    const vtkIdType numTilePts = static_cast<vtkIdType>(ptIds.size());
+    std::vector<vtkIdType> localIds(mesh->GetNumberOfPoints(), -1);
+    vtkIdType npts;
+    const vtkIdType* pts;
+    vtkIdType newCellPts[3];
+    for (vtkIdType cellId = 0; cellId < mesh->GetNumberOfCells(); ++cellId)
+    {
+      if (mesh->GetCellType(cellId) != VTK_TRIANGLE)
+      {
+        continue;
+      }
+      mesh->GetCellPoints(cellId, npts, pts);
+      for (vtkIdType j = 0; j < 3; ++j)
+      {
+        vtkIdType& localId = localIds[pts[j]];
+        if (localId < 0)
+        {
+          vtkIdType* mergedId = pts[j] < numTilePts ? &mergedIds[ptIds[pts[j]]] : &localId;
+          if (*mergedId < 0)
+          {
+            *mergedId = mergedPts->InsertNextPoint(mesh->GetPoint(pts[j]));
+            mergedPD->CopyData(meshPD, pts[j], *mergedId);
+          }
+          localId = *mergedId;
+        }
+        newCellPts[j] = localId;
+      }
+      mergedPolys->InsertNextCell(3, newCellPts);
+    }
+    tileDecimators[tile] = nullptr;
+  }
+  merged->SetPoints(mergedPts);
+  merged->SetPolys(mergedPolys);
+  vtkDebugMacro(<< "Decimated " << numTiles << " tiles from " << numTris << " to "
+                << mergedPolys->GetNumberOfCells() << " triangles");
+
+  // Delete the remaining triangles, mostly along the tile boundaries.
+  const vtkIdType numMergedTris = mergedPolys->GetNumberOfCells();
+  const double reduction = 1.0 -
+    (1.0 - this->TargetReduction) * numTris / std::max<vtkIdType>(numMergedTris, 1);
+  this->NumberOfLockedPoints = 0;
+  if (reduction > 0.0)
+  {
+    this->Decimate(merged, reduction, true);
+  }
+  else
+  {
+    if (this->Mesh != nullptr)
+    {
+      this->Mesh->Delete();
+    }
+    this->Mesh = merged;
+    this->Mesh->Register(this);
+    this->Mesh->BuildLinks();
+    this->NumberOfRemainingTris = numMergedTris;
+  }
+  this->BuildOutput(output);
 }
 
 //------------------------------------------------------------------------------
@@ -476,7 +831,7 @@ void vtkDecimatePro::SplitMesh()
   vtkIdType ncells;
 
   this->CosAngle = cos(vtkMath::RadiansFromDegrees(this->SplitAngle));
-  for (ptId = 0; ptId < this->Mesh->GetNumberOfPoints(); ptId++)
+  for (ptId = this->NumberOfLockedPoints; ptId < this->Mesh->GetNumberOfPoints(); ptId++)
   {
     this->Mesh->GetPoint(ptId, this->X);
     this->Mesh->GetPointCells(ptId, ncells, cells);
@@ -1585,6 +1940,12 @@ void vtkDecimatePro::Insert(vtkIdType ptId, double error)
   vtkIdType fedges[2];
   vtkIdType ncells;
 
+  // locked points are never deleted nor split
+  if (ptId < this->NumberOfLockedPoints)
+  {
+    return;
+  }
+
   // on value of error, we need to compute it or just insert the point
   if (error < -this->Tolerance)
   {
@@ -1728,5 +2089,6 @@ void vtkDecimatePro::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Number Of Inflection Points: " << this->GetNumberOfInflectionPoints() << "\n";
 
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Number Of Tiles: " << this->NumberOfTiles << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -61,6 +61,14 @@
  * is a conservative global error bounds and decimation error, but requires
  * additional memory and time to compute.
  *
+ * Large meshes can be decimated concurrently by setting NumberOfTiles above
+ * one. The triangles are then partitioned into spatially compact tiles, by
+ * recursive bisection of their centroids, and the tiles are decimated
+ * concurrently with vtkSMPTools while the vertices they share are locked
+ * (i.e., neither deleted nor split). A final serial pass over the merged
+ * tiles then deletes the vertices along the tile boundaries as needed to
+ * reach the TargetReduction. All the other parameters apply to both passes.
+ *
  * @warning
  * To guarantee a given level of reduction, the ivar PreserveTopology must
  * be off; the ivar Splitting is on; the ivar BoundaryVertexDeletion is on;
@@ -73,6 +81,12 @@
  * @warning
  * Once mesh splitting begins, the feature angle is set to the split angle.
  *
+ * @warning
+ * When NumberOfTiles is above one, the inflection points are those of the
+ * final pass only, and the errors accumulated by AccumulateError restart
+ * from zero in the final pass. The output also differs from the output of
+ * the serial algorithm, since the vertices are not deleted in the same order.
+ *
  * @sa
  * vtkDecimate vtkQuadricClustering vtkQuadricDecimation
  */
@@ -276,6 +290,16 @@ public:
    */
   double* GetInflectionPoints();
 
+  ///@{
+  /**
+   * Set/Get the number of tiles decimated concurrently before the final
+   * serial pass. The default of one decimates the whole mesh serially. Tiles
+   * of a few tens of thousands of triangles or more amortize the final pass.
+   */
+  vtkSetClampMacro(NumberOfTiles, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfTiles, int);
+  ///@}
+
   ///@{
   /**
    * Set/get the desired precision for the output types. See the documentation
@@ -307,6 +331,7 @@ protected:
   double InflectionPointRatio;
   vtkDoubleArray* InflectionPoints;
   int OutputPointsPrecision;
+  int NumberOfTiles;
 
   // to replace a static object
   vtkIdList* Neighbors;
@@ -395,6 +420,10 @@ protected:
   };
 
 private:
+  void Decimate(vtkPolyData* input, double targetReduction, bool reportProgress);
+  void BuildOutput(vtkPolyData* output);
+  void DecimateTiles(vtkPolyData* input, vtkPolyData* output);
+
   void InitializeQueue(vtkIdType numPts);
   void DeleteQueue();
   void Insert(vtkIdType id, double error = -1.0);
@@ -424,6 +453,7 @@ private:
   double TheSplitAngle;            // Split angle
   int SplitState;                  // State of the splitting process
   double Error;                    // Maximum allowable surface error
+  vtkIdType NumberOfLockedPoints;  // Points [0, NumberOfLockedPoints) are never deleted
 
   vtkDecimatePro(const vtkDecimatePro&) = delete;
   void operator=(const vtkDecimatePro&) = delete;
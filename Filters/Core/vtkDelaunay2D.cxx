@@ -25,11 +25,15 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <set>
+#include <utility>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -45,6 +49,7 @@ vtkDelaunay2D::vtkDelaunay2D()
   this->BoundingTriangulation = 0;
   this->Offset = 1.0;
   this->RandomPointInsertion = 0;
+  this->SpatialPointInsertion = 0;
   this->Transform = nullptr;
   this->ProjectionPlaneMode = VTK_DELAUNAY_XY_PLANE;
 
@@ -337,6 +342,127 @@ struct GCDTraversal
   // else that is going on.
   vtkIdType GetPointId(vtkIdType idx) { return ((this->Prime * idx + this->Offset) % this->NPts); }
 };
+
+// Number of bits of each coordinate in the Hilbert keys
+const int HilbertBits = 28;
+
+// Maximum number of rounds of the biased randomized insertion order
+const int MaxRounds = 30;
+
+// Compute the index of a point along a 2D Hilbert curve, from coordinates
+// that are quantized on HilbertBits bits (J. Skilling, "Programming the
+// Hilbert curve", 2004).
+uint64_t HilbertKey(unsigned int x[2])
+{
+  const unsigned int m = 1u << (HilbertBits - 1);
+
+  // inverse undo
+  for (unsigned int q = m; q > 1; q >>= 1)
+  {
+    const unsigned int p = q - 1;
+    for (int i = 0; i < 2; i++)
+    {
+      if (x[i] & q)
+      {
+        x[0] ^= p;
+      }
+      else
+      {
+        const unsigned int t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // gray encode
+  x[1] ^= x[0];
+  unsigned int t = 0;
+  for (unsigned int q = m; q > 1; q >>= 1)
+  {
+    if (x[1] & q)
+    {
+      t ^= q - 1;
+    }
+  }
+  x[0] ^= t;
+  x[1] ^= t;
+
+  // interleave the bits, most significant first
+  uint64_t key = 0;
+  for (int b = HilbertBits - 1; b >= 0; b--)
+  {
+    key = (key << 2) | (((x[0] >> b) & 1u) << 1) | ((x[1] >> b) & 1u);
+  }
+  return key;
+}
+
+// The round of a point in the biased randomized insertion order. A point is
+// in round r with probability 2^-(r+1). A hash of the point id replaces a
+// random generator, so that the order is deterministic.
+int InsertionRound(vtkIdType ptId)
+{
+  uint64_t h = static_cast<uint64_t>(ptId) + 0x9e3779b97f4a7c15ull;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+  h ^= (h >> 31);
+  int round = 0;
+  while (round < MaxRounds && (h & 1u))
+  {
+    h >>= 1;
+    round++;
+  }
+  return round;
+}
+
+// Sort the first numPts points (x-y coordinates only) in the biased
+// randomized insertion order: the rounds are inserted from the smallest to
+// the largest, and the points of each round follow a Hilbert curve.
+void ComputeSpatialOrder(const double* points, vtkIdType numPts, std::vector<vtkIdType>& order)
+{
+  double bounds[4] = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+  for (vtkIdType ptId = 0; ptId < numPts; ptId++)
+  {
+    const double* x = points + 3 * ptId;
+    bounds[0] = std::min(bounds[0], x[0]);
+    bounds[1] = std::max(bounds[1], x[0]);
+    bounds[2] = std::min(bounds[2], x[1]);
+    bounds[3] = std::max(bounds[3], x[1]);
+  }
+  double scale[2];
+  const double maxCoord = static_cast<double>((1u << HilbertBits) - 1);
+  for (int i = 0; i < 2; i++)
+  {
+    const double length = bounds[2 * i + 1] - bounds[2 * i];
+    scale[i] = (length > 0.0 ? maxCoord / length : 0.0);
+  }
+
+  using KeyId = std::pair<uint64_t, vtkIdType>;
+  std::vector<KeyId> keys(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    unsigned int ij[2];
+    for (vtkIdType ptId = begin; ptId < end; ptId++)
+    {
+      const double* x = points + 3 * ptId;
+      for (int i = 0; i < 2; i++)
+      {
+        const double c = (x[i] - bounds[2 * i]) * scale[i];
+        ij[i] = static_cast<unsigned int>(std::min(std::max(c, 0.0), maxCoord));
+      }
+      const uint64_t round = static_cast<uint64_t>(MaxRounds - InsertionRound(ptId));
+      keys[ptId] = KeyId((round << (2 * HilbertBits)) | HilbertKey(ij), ptId);
+    }
+  });
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  order.resize(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      order[i] = keys[i].second;
+    }
+  });
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -518,18 +644,31 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
 
   this->Mesh->SetPoints(points);
   this->Mesh->SetPolys(triangles);
+  this->Mesh->EditableOn();
   this->Mesh->BuildLinks(); // build cell structure
 
   // For each point; find triangle containing point. Then evaluate three
   // neighboring triangles for Delaunay criterion. Triangles that do not
   // satisfy criterion have their edges swapped. This continues recursively
   // until all triangles have been shown to be Delaunay. The points may be
-  // traversed in given order, or pseudo-random order.
+  // traversed in given order, pseudo-random order, or spatially sorted order.
   //
   GCDTraversal gcdIter(numPoints);
-  for (auto idx = 0; idx < numPoints; idx++)
+  std::vector<vtkIdType> order;
+  if (this->SpatialPointInsertion)
+  {
+    ComputeSpatialOrder(this->Points, numPoints, order);
+  }
+  for (vtkIdType idx = 0; idx < numPoints; idx++)
   {
-    ptId = (this->RandomPointInsertion ? gcdIter.GetPointId(idx) : idx);
+    if (!order.empty())
+    {
+      ptId = order[idx];
+    }
+    else
+    {
+      ptId = (this->RandomPointInsertion ? gcdIter.GetPointId(idx) : idx);
+    }
     this->GetPoint(ptId, x);
     nei[0] = (-1); // where we are coming from...nowhere initially
 
@@ -624,10 +763,10 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
       tri[0] = 0; // no triangle found
     }
 
-    if (!(ptId % 1000))
+    if (!(idx % 1000))
     {
-      vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      vtkDebugMacro(<< "point #" << idx);
+      this->UpdateProgress(static_cast<double>(idx) / numPoints);
       if (this->CheckAbort())
       {
         break;
@@ -1652,6 +1791,8 @@ void vtkDelaunay2D::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent << "Offset: " << this->Offset << "\n";
   os << indent << "Random Point Insertion: " << (this->RandomPointInsertion ? "On" : "Off") << "\n";
+  os << indent << "Spatial Point Insertion: " << (this->SpatialPointInsertion ? "On" : "Off")
+     << "\n";
   os << indent << "Bounding Triangulation: " << (this->BoundingTriangulation ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -68,7 +68,9 @@
  * problems are present, you will see a warning message to this effect at
  * the end of the triangulation process. Note also that the
  * RandomPointInsertion mode can be set which will insert the points in
- * pseudo-random order.
+ * pseudo-random order, and the SpatialPointInsertion mode can be set which
+ * will insert them in a spatially coherent order (much faster for large
+ * point sets).
  *
  * To create constrained meshes, you must define an additional
  * input. This input is an instance of vtkPolyData which contains
@@ -267,6 +269,22 @@ public:
   vtkBooleanMacro(RandomPointInsertion, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to insert the points in a spatially coherent order. The
+   * points are inserted in rounds of increasing size (a biased randomized
+   * insertion order), and the points of each round follow a Hilbert curve,
+   * so that each point is usually found close to the triangle of the
+   * previous one. This greatly speeds up the triangulation of large point
+   * sets such as terrain samples. The order is computed in parallel. When
+   * on, this option takes precedence over RandomPointInsertion. It is off by
+   * default.
+   */
+  vtkSetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkGetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkBooleanMacro(SpatialPointInsertion, vtkTypeBool);
+  ///@}
+
 protected:
   vtkDelaunay2D();
 
@@ -277,6 +295,7 @@ protected:
   vtkTypeBool BoundingTriangulation;
   double Offset;
   vtkTypeBool RandomPointInsertion;
+  vtkTypeBool SpatialPointInsertion;
 
   // Transform input points (if necessary)
   vtkSmartPointer<vtkAbstractTransform> Transform;
@@ -25,10 +25,16 @@
 #include "vtkPointData.h"
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDelaunay3D);
 
@@ -122,6 +128,135 @@ vtkDelaunayTetra* vtkTetraArray::Resize(vtkIdType sz)
   return this->Array;
 }
 
+namespace
+{
+// Number of bits of each coordinate in the Hilbert keys
+const int HilbertBits = 19;
+
+// Maximum number of rounds of the biased randomized insertion order
+const int MaxRounds = 30;
+
+//------------------------------------------------------------------------------
+// Compute the index of a point along a 3D Hilbert curve, from coordinates
+// that are quantized on HilbertBits bits (J. Skilling, "Programming the
+// Hilbert curve", 2004).
+uint64_t HilbertKey(unsigned int x[3])
+{
+  const unsigned int m = 1u << (HilbertBits - 1);
+
+  // inverse undo
+  for (unsigned int q = m; q > 1; q >>= 1)
+  {
+    const unsigned int p = q - 1;
+    for (int i = 0; i < 3; i++)
+    {
+      if (x[i] & q)
+      {
+        x[0] ^= p;
+      }
+      else
+      {
+        const unsigned int t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // gray encode
+  x[1] ^= x[0];
+  x[2] ^= x[1];
+  unsigned int t = 0;
+  for (unsigned int q = m; q > 1; q >>= 1)
+  {
+    if (x[2] & q)
+    {
+      t ^= q - 1;
+    }
+  }
+  x[0] ^= t;
+  x[1] ^= t;
+  x[2] ^= t;
+
+  // interleave the bits, most significant first
+  uint64_t key = 0;
+  for (int b = HilbertBits - 1; b >= 0; b--)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      key = (key << 1) | ((x[i] >> b) & 1u);
+    }
+  }
+  return key;
+}
+
+//------------------------------------------------------------------------------
+// The round of a point in the biased randomized insertion order. A point is
+// in round r with probability 2^-(r+1), so that the last round holds about
+// half of the points. A hash of the point id is used instead of a random
+// generator, which keeps the order deterministic and the computation
+// parallel.
+int InsertionRound(vtkIdType ptId)
+{
+  uint64_t h = static_cast<uint64_t>(ptId) + 0x9e3779b97f4a7c15ull;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+  h ^= (h >> 31);
+  int round = 0;
+  while (round < MaxRounds && (h & 1u))
+  {
+    h >>= 1;
+    round++;
+  }
+  return round;
+}
+
+//------------------------------------------------------------------------------
+// Sort the points in the biased randomized insertion order: the rounds are
+// inserted from the smallest (the highest round number) to the largest, and
+// the points of each round follow a Hilbert curve.
+void ComputeSpatialOrder(vtkPoints* points, std::vector<vtkIdType>& order)
+{
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  double bounds[6];
+  points->GetBounds(bounds);
+  double scale[3];
+  const double maxCoord = static_cast<double>((1u << HilbertBits) - 1);
+  for (int i = 0; i < 3; i++)
+  {
+    const double length = bounds[2 * i + 1] - bounds[2 * i];
+    scale[i] = (length > 0.0 ? maxCoord / length : 0.0);
+  }
+
+  using KeyId = std::pair<uint64_t, vtkIdType>;
+  std::vector<KeyId> keys(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    unsigned int ijk[3];
+    for (vtkIdType ptId = begin; ptId < end; ptId++)
+    {
+      points->GetPoint(ptId, x);
+      for (int i = 0; i < 3; i++)
+      {
+        const double c = (x[i] - bounds[2 * i]) * scale[i];
+        ijk[i] = static_cast<unsigned int>(std::min(std::max(c, 0.0), maxCoord));
+      }
+      const uint64_t round = static_cast<uint64_t>(MaxRounds - InsertionRound(ptId));
+      keys[ptId] = KeyId((round << (3 * HilbertBits)) | HilbertKey(ijk), ptId);
+    }
+  });
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  order.resize(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      order[i] = keys[i].second;
+    }
+  });
+}
+}
+
 // vtkDelaunay3D methods
 //
 
@@ -139,6 +274,7 @@ vtkDelaunay3D::vtkDelaunay3D()
   this->BoundingTriangulation = 0;
   this->Offset = 2.5;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+  this->InsertionOrder = INPUT_ORDER;
   this->Locator = nullptr;
   this->TetraArray = nullptr;
   this->References = nullptr;
@@ -493,20 +629,28 @@ int vtkDelaunay3D::RequestData(vtkInformation* vtkNotUsed(request),
 
   Mesh = this->InitPointInsertion(center, this->Offset * tol, numPoints, points);
 
+  // Compute the insertion order, if not the input order
+  std::vector<vtkIdType> order;
+  if (this->InsertionOrder == SPATIAL_ORDER)
+  {
+    ComputeSpatialOrder(inPoints, order);
+  }
+
   // Insert each point into triangulation. Points laying "inside"
   // of tetra cause tetra to be deleted, leaving a void with bounding
   // faces. Combination of point and each face is used to form new
   // tetrahedra.
-  for (ptId = 0; ptId < numPoints; ptId++)
+  for (i = 0; i < numPoints; i++)
   {
+    ptId = (order.empty() ? i : order[i]);
     inPoints->GetPoint(ptId, x);
 
     this->InsertPoint(Mesh, points, ptId, x, holeTetras);
 
-    if (!(ptId % 250))
+    if (!(i % 250))
     {
-      vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      vtkDebugMacro(<< "point #" << i);
+      this->UpdateProgress(static_cast<double>(i) / numPoints);
       if (this->CheckAbort())
       {
         break;
@@ -1074,6 +1218,8 @@ void vtkDelaunay3D::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Insertion Order: "
+     << (this->InsertionOrder == SPATIAL_ORDER ? "Spatial Order\n" : "Input Order\n");
 }
 
 //------------------------------------------------------------------------------
@@ -58,9 +58,10 @@
  * Points arranged on a regular lattice (termed degenerate cases) can be
  * triangulated in more than one way (at least according to the Delaunay
  * criterion). The choice of triangulation (as implemented by
- * this algorithm) depends on the order of the input points. The first four
- * points will form a tetrahedron; other degenerate points (relative to this
- * initial tetrahedron) will not break it.
+ * this algorithm) depends on the order in which the points are inserted
+ * (see InsertionOrder). The first four inserted points will form a
+ * tetrahedron; other degenerate points (relative to this initial
+ * tetrahedron) will not break it.
  *
  * @warning
  * Points that are coincident (or nearly so) may be discarded by the
@@ -198,6 +199,34 @@ public:
   vtkBooleanMacro(BoundingTriangulation, vtkTypeBool);
   ///@}
 
+  /**
+   * The orders in which the points can be inserted into the triangulation.
+   */
+  enum InsertionOrders
+  {
+    INPUT_ORDER = 0,
+    SPATIAL_ORDER = 1
+  };
+
+  ///@{
+  /**
+   * Specify the order in which the points are inserted. INPUT_ORDER (the
+   * default) inserts the points in the order of the input. SPATIAL_ORDER
+   * uses a biased randomized insertion order (BRIO): the points are spread
+   * over rounds of geometrically increasing sizes, and the points of each
+   * round are sorted along a Hilbert curve. Consecutive points are then
+   * close to each other, which makes the search for the enclosing
+   * tetrahedron much faster on large inputs, while the rounds keep the
+   * triangulation balanced as it grows. The ordering is computed in
+   * parallel and is deterministic. Note that degenerate inputs (e.g. points
+   * on a lattice) may be triangulated differently in each order.
+   */
+  vtkSetClampMacro(InsertionOrder, int, INPUT_ORDER, SPATIAL_ORDER);
+  vtkGetMacro(InsertionOrder, int);
+  void SetInsertionOrderToInputOrder() { this->SetInsertionOrder(INPUT_ORDER); }
+  void SetInsertionOrderToSpatialOrder() { this->SetInsertionOrder(SPATIAL_ORDER); }
+  ///@}
+
   ///@{
   /**
    * Set / get a spatial locator for merging points. By default,
@@ -279,6 +308,7 @@ protected:
   vtkTypeBool BoundingTriangulation;
   double Offset;
   int OutputPointsPrecision;
+  int InsertionOrder;
 
   vtkIncrementalPointLocator* Locator; // help locate points faster
 
@@ -34,6 +34,8 @@
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkTimeStamp.h"
+#include "vtkTypeInt32Array.h"
+#include "vtkTypeInt64Array.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -213,12 +215,62 @@ struct ExtractCellsBatchInfo
   std::vector<ExtractCellsBatch> Batches;
 };
 
+//------------------------------------------------------------------------------
+/* Fills the offsets and connectivity arrays, of vtkTypeInt32Array or
+ * vtkTypeInt64Array type, of the cells identified by `work`.
+ */
+template <typename ArrayT, typename CellWorkT>
+vtkSmartPointer<vtkCellArray> FillConnectivity(vtkDataSet* input, const CellWorkT& work,
+  ExtractCellsBatchInfo& batchInfo, vtkIdType connectivitySize)
+{
+  using ValueType = typename ArrayT::ValueType;
+  const auto outputNumCells = work.GetNumberOfCells();
+
+  // set cell array connectivity
+  vtkNew<ArrayT> connectivity;
+  connectivity->SetNumberOfValues(connectivitySize);
+  // set cell array offsets
+  vtkNew<ArrayT> offsets;
+  offsets->SetNumberOfValues(outputNumCells + 1);
+  vtkSMPThreadLocalObject<vtkIdList> TLCellPointIds;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(batchInfo.Batches.size()),
+    [&](vtkIdType begin, vtkIdType end) {
+      vtkIdType numCellPts, cellId, cellIndex, ptId;
+      const vtkIdType* cellPts;
+      auto& cellPointIds = TLCellPointIds.Local();
+      for (vtkIdType batchId = begin; batchId < end; ++batchId)
+      {
+        ExtractCellsBatch& batch = batchInfo.Batches[batchId];
+        for (cellIndex = batch.BeginCellIndex; cellIndex < batch.EndCellIndex; ++cellIndex)
+        {
+          cellId = work.GetCellId(cellIndex);
+          input->GetCellPoints(cellId, numCellPts, cellPts, cellPointIds);
+          offsets->SetValue(cellIndex, static_cast<ValueType>(batch.BeginCellsConnectivity));
+          for (ptId = 0; ptId < numCellPts; ++ptId)
+          {
+            connectivity->SetValue(batch.BeginCellsConnectivity++,
+              static_cast<ValueType>(work.GetPointId(cellPts[ptId])));
+          }
+        }
+      }
+    });
+  // set last offset
+  offsets->SetValue(outputNumCells, static_cast<ValueType>(connectivitySize));
+  // set cell array
+  vtkSmartPointer<vtkCellArray> cells = vtkSmartPointer<vtkCellArray>::New();
+  cells->SetData(offsets, connectivity);
+  return cells;
+}
+
 //------------------------------------------------------------------------------
 /* Extracts cells identified by `work` from the input.
  * Returns ExtractedCellsT with connectivity and cell-types array set.
+ * The connectivity uses 32-bit storage when `outputNumPoints` and the
+ * connectivity size fit, like vtkTableBasedClipDataSet.
  */
 template <typename CellWorkT>
-ExtractedCellsT ExtractCells(vtkDataSet* input, const CellWorkT& work, unsigned int batchSize)
+ExtractedCellsT ExtractCells(
+  vtkDataSet* input, const CellWorkT& work, vtkIdType outputNumPoints, unsigned int batchSize)
 {
   const auto outputNumCells = work.GetNumberOfCells();
 
@@ -273,36 +325,21 @@ ExtractedCellsT ExtractCells(vtkDataSet* input, const CellWorkT& work, unsigned
     connectivitySize += batch.CellsConnectivitySize;
   }
 
-  // set cell array connectivity
-  vtkNew<vtkIdTypeArray> connectivity;
-  connectivity->SetNumberOfValues(connectivitySize);
-  // set cell array offsets
-  vtkNew<vtkIdTypeArray> offsets;
-  offsets->SetNumberOfValues(outputNumCells + 1);
-  vtkSMPTools::For(0, static_cast<vtkIdType>(numberOfBatches), [&](vtkIdType begin, vtkIdType end) {
-    vtkIdType numCellPts, cellId, cellIndex, ptId;
-    const vtkIdType* cellPts;
-    auto& cellPointIds = TLCellPointIds.Local();
-    for (vtkIdType batchId = begin; batchId < end; ++batchId)
-    {
-      ExtractCellsBatch& batch = batchInfo.Batches[batchId];
-      for (cellIndex = batch.BeginCellIndex; cellIndex < batch.EndCellIndex; ++cellIndex)
-      {
-        cellId = work.GetCellId(cellIndex);
-        input->GetCellPoints(cellId, numCellPts, cellPts, cellPointIds);
-        offsets->SetValue(cellIndex, batch.BeginCellsConnectivity);
-        for (ptId = 0; ptId < numCellPts; ++ptId)
-        {
-          connectivity->SetValue(batch.BeginCellsConnectivity++, work.GetPointId(cellPts[ptId]));
-        }
-      }
-    }
-  });
-  // set last offset
-  offsets->SetValue(outputNumCells, connectivitySize);
-  // set cell array
-  result.Connectivity.TakeReference(vtkCellArray::New());
-  result.Connectivity->SetData(offsets, connectivity);
+  // identify the required output id type
+#ifdef VTK_USE_64BIT_IDS
+  if (connectivitySize > VTK_TYPE_INT32_MAX || outputNumPoints > VTK_TYPE_INT32_MAX)
+  {
+    result.Connectivity =
+      FillConnectivity<vtkTypeInt64Array>(input, work, batchInfo, connectivitySize);
+  }
+  else
+#else
+  (void)outputNumPoints;
+#endif
+  {
+    result.Connectivity =
+      FillConnectivity<vtkTypeInt32Array>(input, work, batchInfo, connectivitySize);
+  }
   return result;
 }
 
@@ -671,7 +708,7 @@ int vtkExtractCells::RequestData(vtkInformation* vtkNotUsed(request),
   }
 
   // Extract cells
-  auto cells = ::ExtractCells(input, work, this->BatchSize);
+  auto cells = ::ExtractCells(input, work, pts->GetNumberOfPoints(), this->BatchSize);
   this->UpdateProgress(0.85);
   if (this->CheckAbort())
   {
@@ -724,7 +761,8 @@ bool vtkExtractCells::Copy(vtkDataSet* input, vtkUnstructuredGrid* output)
   }
 
   const auto numCells = input->GetNumberOfCells();
-  auto cells = ::ExtractCells(input, AllElementsWork{ 0, numCells }, this->BatchSize);
+  auto cells = ::ExtractCells(
+    input, AllElementsWork{ 0, numCells }, input->GetNumberOfPoints(), this->BatchSize);
   output->SetCells(cells.CellTypes, cells.Connectivity, nullptr, nullptr);
 
   // copy cell/point arrays.
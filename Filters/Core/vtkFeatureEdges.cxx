@@ -27,11 +27,17 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleStrip.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkFeatureEdges);
@@ -40,6 +46,212 @@ namespace
 {
 constexpr unsigned char CELL_NOT_VISIBLE =
   vtkDataSetAttributes::HIDDENCELL | vtkDataSetAttributes::DUPLICATECELL;
+
+// Type of each polygon edge, computed before the output is generated.
+enum EdgeType : unsigned char
+{
+  NO_EDGE = 0,
+  BOUNDARY_EDGE,
+  NON_MANIFOLD_EDGE,
+  FEATURE_EDGE,
+  MANIFOLD_EDGE
+};
+
+// The polygon an edge tuple comes from, and the id of the edge, which is the
+// position of its first point in the polygon connectivity.
+struct EdgeOwner
+{
+  vtkIdType CellId;
+  vtkIdType EdgeId;
+};
+using EdgeTupleType = EdgeTuple<vtkIdType, EdgeOwner>;
+using EdgeLocatorType = vtkStaticEdgeLocatorTemplate<vtkIdType, EdgeOwner>;
+
+//------------------------------------------------------------------------------
+// Gather the edges of all the polygons.
+struct ExtractPolyEdges
+{
+  vtkCellArray* Polys;
+  EdgeTupleType* Edges;
+  vtkSMPThreadLocalObject<vtkIdList> TempIds;
+
+  ExtractPolyEdges(vtkCellArray* polys, EdgeTupleType* edges)
+    : Polys(polys)
+    , Edges(edges)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkIdList* tempIds = this->TempIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      this->Polys->GetCellAtId(cellId, npts, pts, tempIds);
+      const vtkIdType offset = this->Polys->GetOffset(cellId);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        this->Edges[offset + i] =
+          EdgeTupleType(pts[i], pts[(i + 1) % npts], EdgeOwner{ cellId, offset + i });
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+struct ComputePolyNormals
+{
+  vtkPoints* Points;
+  vtkCellArray* Polys;
+  vtkFloatArray* Normals;
+  vtkSMPThreadLocalObject<vtkIdList> TempIds;
+
+  ComputePolyNormals(vtkPoints* points, vtkCellArray* polys, vtkFloatArray* normals)
+    : Points(points)
+    , Polys(polys)
+    , Normals(normals)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkIdList* tempIds = this->TempIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double n[3];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      this->Polys->GetCellAtId(cellId, npts, pts, tempIds);
+      vtkPolygon::ComputeNormal(this->Points, static_cast<int>(npts), pts, n);
+      this->Normals->SetTuple(cellId, n);
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+// Classify the edges of each group of identical edges. The neighbors of a
+// polygon across an edge are the other polygons of the group; they are
+// visited in increasing id order, as the cell links would give them.
+struct ClassifyEdges
+{
+  EdgeTupleType* Edges;
+  const vtkIdType* GroupOffsets;
+  const vtkIdType* InputCellIds;
+  const unsigned char* Ghosts;
+  vtkFloatArray* Normals;
+  double CosAngle;
+  bool BoundaryEdges;
+  bool NonManifoldEdges;
+  bool FeatureEdges;
+  bool ManifoldEdges;
+  bool RemoveGhostInterfaces;
+  unsigned char* Types;
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    for (vtkIdType group = begin; group < end; ++group)
+    {
+      EdgeTupleType* first = this->Edges + this->GroupOffsets[group];
+      EdgeTupleType* last = this->Edges + this->GroupOffsets[group + 1];
+      std::sort(first, last, [](const EdgeTupleType& a, const EdgeTupleType& b) {
+        return a.Data.EdgeId < b.Data.EdgeId;
+      });
+      for (const EdgeTupleType* edge = first; edge != last; ++edge)
+      {
+        this->Types[edge->Data.EdgeId] = this->Classify(edge->Data.CellId, first, last);
+      }
+    }
+  }
+
+  bool IsVisible(vtkIdType cellId) const
+  {
+    return !this->Ghosts ||
+      !(this->Ghosts[this->InputCellIds ? this->InputCellIds[cellId] : cellId] & CELL_NOT_VISIBLE);
+  }
+
+  unsigned char Classify(
+    vtkIdType cellId, const EdgeTupleType* first, const EdgeTupleType* last) const
+  {
+    vtkIdType numNei = 0;
+    vtkIdType numVisibleNei = 0;
+    vtkIdType firstVisibleNei = -1;
+    vtkIdType numGhostNei = 0;
+    // position, among the ghost neighbors, of the first one before cellId
+    vtkIdType firstGhostNeiBefore = -1;
+    bool neiBefore = false;
+    vtkIdType previousNei = -1;
+    for (; first != last; ++first)
+    {
+      const vtkIdType nei = first->Data.CellId;
+      if (nei == cellId || nei == previousNei)
+      {
+        continue;
+      }
+      previousNei = nei;
+      ++numNei;
+      neiBefore |= nei < cellId;
+      if (this->IsVisible(nei))
+      {
+        if (firstVisibleNei < 0)
+        {
+          firstVisibleNei = nei;
+        }
+        ++numVisibleNei;
+      }
+      else
+      {
+        if (nei < cellId && firstGhostNeiBefore < 0)
+        {
+          firstGhostNeiBefore = numGhostNei;
+        }
+        ++numGhostNei;
+      }
+    }
+
+    // Ignoring edges that are not visible
+    if (numGhostNei > 0 && this->RemoveGhostInterfaces)
+    {
+      return NO_EDGE;
+    }
+    if (this->BoundaryEdges && numVisibleNei < 1)
+    {
+      return BOUNDARY_EDGE;
+    }
+    if (this->NonManifoldEdges && numVisibleNei > 1)
+    {
+      // make sure that this edge is only created once. When there are ghost
+      // cells, only the ghost neighbors are checked.
+      if (this->Ghosts)
+      {
+        const vtkIdType j = firstGhostNeiBefore < 0 ? numGhostNei : firstGhostNeiBefore;
+        return j >= numVisibleNei ? NON_MANIFOLD_EDGE : NO_EDGE;
+      }
+      return neiBefore ? NO_EDGE : NON_MANIFOLD_EDGE;
+    }
+    if (this->FeatureEdges && numVisibleNei == 1 && firstVisibleNei > cellId)
+    {
+      double neiTuple[3];
+      double cellTuple[3];
+      this->Normals->GetTuple(firstVisibleNei, neiTuple);
+      this->Normals->GetTuple(cellId, cellTuple);
+      return vtkMath::Dot(neiTuple, cellTuple) <= this->CosAngle ? FEATURE_EDGE : NO_EDGE;
+    }
+    if (this->ManifoldEdges && numVisibleNei == 1 && firstVisibleNei > cellId)
+    {
+      return MANIFOLD_EDGE;
+    }
+    return NO_EDGE;
+  }
+};
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -89,19 +301,17 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPoints* newPts;
   vtkFloatArray* newScalars = nullptr;
   vtkCellArray* newLines;
-  vtkPolyData* Mesh;
   int i;
-  vtkIdType j, numNei;
   vtkIdType numBEdges, numNonManifoldEdges, numFedges, numManifoldEdges;
-  double scalar, n[3], x1[3], x2[3];
+  double scalar, x1[3], x2[3];
   double cosAngle = 0;
   vtkIdType lineIds[2];
   vtkIdType npts = 0;
   const vtkIdType* pts = nullptr;
-  vtkCellArray *inPolys, *inStrips, *newPolys;
+  vtkCellArray *inPolys, *inStrips;
+  vtkSmartPointer<vtkCellArray> newPolys;
   vtkFloatArray* polyNormals = nullptr;
-  vtkIdType numPts, numCells, numPolys, numStrips, numLines, nei;
-  vtkIdList* neighbors;
+  vtkIdType numPts, numCells, numPolys, numStrips, numLines;
   vtkIdType p1, p2, newId;
   vtkPointData *pd = input->GetPointData(), *outPD = output->GetPointData();
   vtkCellData *cd = input->GetCellData(), *outCD = output->GetCellData();
@@ -147,8 +357,6 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
   }
 
   // Build cell structure.  Might have to triangulate the strips.
-  Mesh = vtkPolyData::New();
-  Mesh->SetPoints(inPts);
   inPolys = input->GetPolys();
   vtkIdType numberOfNewPolys = numPolys;
 
@@ -195,7 +403,7 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
 
   if (numStrips > 0)
   {
-    newPolys = vtkCellArray::New();
+    newPolys = vtkSmartPointer<vtkCellArray>::New();
     if (numPolys > 0)
     {
       newPolys->DeepCopy(inPolys);
@@ -212,16 +420,11 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
       decomposedStripIdToStripIdMap.insert({ numberOfNewPolys, ++stripId });
       vtkTriangleStrip::DecomposeStrip(npts, pts, newPolys);
     }
-
-    Mesh->SetPolys(newPolys);
-    newPolys->Delete();
   }
   else
   {
     newPolys = inPolys;
-    Mesh->SetPolys(newPolys);
   }
-  Mesh->BuildLinks();
 
   // Allocate storage for lines/points (arbitrary allocation sizes)
   //
@@ -262,30 +465,62 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
   }
   this->Locator->InitPointInsertion(newPts, input->GetBounds());
 
-  // Loop over all polygons generating boundary, non-manifold,
-  // and feature edges
+  // Compute the polygon normals used to find feature edges
   //
+  vtkIdType numNewPolys = newPolys->GetNumberOfCells();
   if (this->FeatureEdges)
   {
     polyNormals = vtkFloatArray::New();
     polyNormals->SetNumberOfComponents(3);
-    polyNormals->Allocate(3 * newPolys->GetNumberOfCells());
-
-    vtkIdType cellId;
-    for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts); cellId++)
-    {
-      vtkPolygon::ComputeNormal(inPts, npts, pts, n);
-      polyNormals->InsertTuple(cellId, n);
-    }
+    polyNormals->SetNumberOfTuples(numNewPolys);
+    ComputePolyNormals normals(inPts, newPolys, polyNormals);
+    vtkSMPTools::For(0, numNewPolys, normals);
 
     cosAngle = cos(vtkMath::RadiansFromDegrees(this->FeatureAngle));
   }
 
-  neighbors = vtkIdList::New();
-  neighbors->Allocate(VTK_CELL_SIZE);
+  // Map the polygons, including the triangles of the strips, to the input cells
+  std::vector<vtkIdType> inputCellIds;
+  if (numPolys != numCells)
+  {
+    inputCellIds.resize(numNewPolys);
+    vtkSMPTools::For(0, numNewPolys, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType newCellId = begin; newCellId < end; ++newCellId)
+      {
+        if (newCellId < numPolys) // we currently are on a Poly
+        {
+          inputCellIds[newCellId] = polyIdToCellIdMap->GetId(newCellId);
+        }
+        else // we are dealing with triangle strips
+        {
+          auto it = decomposedStripIdToStripIdMap.lower_bound(newCellId + 1);
+          inputCellIds[newCellId] = stripIdToCellIdMap->GetId(it->second);
+        }
+      }
+    });
+  }
+
+  // Group the identical edges of all polygons, and classify them in
+  // parallel as boundary, non-manifold, feature or manifold edges
+  //
+  vtkIdType numEdges = newPolys->GetNumberOfConnectivityIds();
+  std::vector<EdgeTupleType> edges(numEdges);
+  ExtractPolyEdges extractEdges(newPolys, edges.data());
+  vtkSMPTools::For(0, numNewPolys, extractEdges);
+
+  EdgeLocatorType edgeLocator;
+  vtkIdType numUniqueEdges;
+  const vtkIdType* groupOffsets = edgeLocator.MergeEdges(numEdges, edges.data(), numUniqueEdges);
+
+  std::vector<unsigned char> edgeTypes(numEdges, NO_EDGE);
+  ClassifyEdges classify{ edges.data(), groupOffsets,
+    inputCellIds.empty() ? nullptr : inputCellIds.data(), ghosts, polyNormals, cosAngle,
+    this->BoundaryEdges, this->NonManifoldEdges, this->FeatureEdges, this->ManifoldEdges,
+    this->RemoveGhostInterfaces, edgeTypes.data() };
+  vtkSMPTools::For(0, numUniqueEdges, classify);
 
   bool abort = false;
-  vtkIdType progressInterval = newPolys->GetNumberOfCells() / 20 + 1;
+  vtkIdType progressInterval = numNewPolys / 20 + 1;
 
   numBEdges = numNonManifoldEdges = numFedges = numManifoldEdges = 0;
   vtkIdType newCellId, cellId;
@@ -310,8 +545,8 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
         p1 = pts[pointId];
         p2 = pts[pointId + 1];
 
-        Mesh->GetPoint(p1, x1);
-        Mesh->GetPoint(p2, x2);
+        inPts->GetPoint(p1, x1);
+        inPts->GetPoint(p2, x2);
 
         if (this->Locator->InsertUniquePoint(x1, lineIds[0]))
         {
@@ -334,8 +569,12 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
+  // Generate the output edges in polygon order, so that points are merged
+  // in the same order whatever the number of threads
+  //
+  vtkIdType edgeId = 0;
   for (newCellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts) && !abort;
-       newCellId++)
+       newCellId++, edgeId += npts)
   {
     if (!(newCellId % progressInterval)) // manage progress / early abort
     {
@@ -343,135 +582,41 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
       abort = this->CheckAbort();
     }
 
-    if (numPolys == numCells) // Input only has Polys
-    {
-      cellId = newCellId;
-    }
-    else if (newCellId < numPolys) // Input has mixed types, and we currently are on a Poly
-    {
-      cellId = polyIdToCellIdMap->GetId(newCellId);
-    }
-    else // Input has mixed types and we are dealing with triangle strips
-    {
-      auto it = decomposedStripIdToStripIdMap.lower_bound(newCellId + 1);
-      cellId = stripIdToCellIdMap->GetId(it->second);
-    }
-
+    cellId = inputCellIds.empty() ? newCellId : inputCellIds[newCellId];
     if (ghosts && ghosts[cellId] & CELL_NOT_VISIBLE)
     {
       continue;
     }
 
-    // Used with non manifold edges when there are ghost cells in the input
-    vtkNew<vtkIdList> edgesRemapping;
-
     for (i = 0; i < npts; i++)
     {
-      p1 = pts[i];
-      p2 = pts[(i + 1) % npts];
-
-      Mesh->GetCellEdgeNeighbors(newCellId, p1, p2, neighbors);
-      numNei = neighbors->GetNumberOfIds();
-
-      vtkIdType numNeiWithoutGhosts = numNei;
-      vtkIdType firstNeighbor = 0;
-      if (ghosts)
-      {
-        for (j = 0; j < numNei; ++j)
-        {
-          vtkIdType neiId = neighbors->GetId(j);
-          vtkIdType neighborCellIdInInput;
-          if (numPolys == numCells)
-          {
-            neighborCellIdInInput = neiId;
-          }
-          else if (neiId < numPolys)
-          {
-            neighborCellIdInInput = polyIdToCellIdMap->GetId(neiId);
-          }
-          else
-          {
-            auto it = decomposedStripIdToStripIdMap.lower_bound(neiId + 1);
-            neighborCellIdInInput = stripIdToCellIdMap->GetId(it->second);
-          }
-          if (ghosts[neighborCellIdInInput] & CELL_NOT_VISIBLE)
-          {
-            if (this->NonManifoldEdges)
-            {
-              edgesRemapping->InsertNextId(j);
-            }
-            if (j == firstNeighbor)
-            {
-              ++firstNeighbor;
-            }
-            --numNeiWithoutGhosts;
-          }
-        }
-      }
-      // Ignoring edges that are not visible
-      if (numNeiWithoutGhosts != numNei && this->RemoveGhostInterfaces)
-      {
-        continue;
-      }
-
-      if (this->BoundaryEdges && numNeiWithoutGhosts < 1)
+      switch (edgeTypes[edgeId + i])
       {
-        numBEdges++;
-        scalar = 0.0;
-      }
-
-      else if (this->NonManifoldEdges && numNeiWithoutGhosts > 1)
-      {
-        // check to make sure that this edge hasn't been created before
-        for (j = 0; j < (ghosts ? edgesRemapping->GetNumberOfIds() : numNei); j++)
-        {
-          if (neighbors->GetId(ghosts ? edgesRemapping->GetId(j) : j) < newCellId)
-          {
-            break;
-          }
-        }
-        edgesRemapping->Reset();
-        if (j >= numNeiWithoutGhosts)
-        {
+        case BOUNDARY_EDGE:
+          numBEdges++;
+          scalar = 0.0;
+          break;
+        case NON_MANIFOLD_EDGE:
           numNonManifoldEdges++;
           scalar = 0.222222;
-        }
-        else
-        {
-          continue;
-        }
-      }
-      else if (this->FeatureEdges && numNeiWithoutGhosts == 1 &&
-        (nei = neighbors->GetId(firstNeighbor)) > newCellId)
-      {
-        double neiTuple[3];
-        double cellTuple[3];
-        polyNormals->GetTuple(nei, neiTuple);
-        polyNormals->GetTuple(newCellId, cellTuple);
-        if (vtkMath::Dot(neiTuple, cellTuple) <= cosAngle)
-        {
+          break;
+        case FEATURE_EDGE:
           numFedges++;
           scalar = 0.444444;
-        }
-        else
-        {
+          break;
+        case MANIFOLD_EDGE:
+          numManifoldEdges++;
+          scalar = 0.666667;
+          break;
+        default:
           continue;
-        }
-      }
-      else if (this->ManifoldEdges && numNeiWithoutGhosts == 1 &&
-        neighbors->GetId(firstNeighbor) > newCellId)
-      {
-        numManifoldEdges++;
-        scalar = 0.666667;
-      }
-      else
-      {
-        continue;
       }
+      p1 = pts[i];
+      p2 = pts[(i + 1) % npts];
 
       // Add edge to output
-      Mesh->GetPoint(p1, x1);
-      Mesh->GetPoint(p2, x2);
+      inPts->GetPoint(p1, x1);
+      inPts->GetPoint(p2, x2);
 
       if (this->Locator->InsertUniquePoint(x1, lineIds[0]))
       {
@@ -505,11 +650,8 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
     polyNormals->Delete();
   }
 
-  Mesh->Delete();
-
   output->SetPoints(newPts);
   newPts->Delete();
-  neighbors->Delete();
 
   output->SetLines(newLines);
   newLines->Delete();
@@ -14,7 +14,9 @@
 =========================================================================*/
 #include "vtkGlyph3D.h"
 
+#include "vtkArrayListTemplate.h"
 #include "vtkCell.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
@@ -22,10 +24,13 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
@@ -33,10 +38,380 @@
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkGlyph3D);
 vtkCxxSetObjectMacro(vtkGlyph3D, SourceTransform, vtkTransform);
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Return the only cell array of the source holding cells, or nullptr if the
+// source cannot be glyphed in parallel. With a single cell array the source
+// cell ids follow the connectivity order, so every glyph is a fixed size block
+// of output points, cells and connectivity.
+vtkCellArray* GetParallelGlyphCells(vtkPolyData* source, vtkDataArray* sourceNormals,
+  vtkDataArray* sourceTCoords, vtkIdType numSourceCells)
+{
+  vtkPoints* sourcePts = source->GetPoints();
+  vtkIdType numSourcePts = sourcePts ? sourcePts->GetNumberOfPoints() : 0;
+  if (numSourcePts < 1 || numSourceCells < 1 ||
+    (sourcePts->GetDataType() != VTK_FLOAT && sourcePts->GetDataType() != VTK_DOUBLE))
+  {
+    return nullptr;
+  }
+  if (sourceNormals &&
+    ((sourceNormals->GetDataType() != VTK_FLOAT && sourceNormals->GetDataType() != VTK_DOUBLE) ||
+      sourceNormals->GetNumberOfComponents() != 3 ||
+      sourceNormals->GetNumberOfTuples() != numSourcePts))
+  {
+    return nullptr;
+  }
+  if (sourceTCoords && sourceTCoords->GetNumberOfTuples() < numSourcePts)
+  {
+    return nullptr;
+  }
+
+  vtkCellArray* cellArrays[4] = { source->GetVerts(), source->GetLines(), source->GetPolys(),
+    source->GetStrips() };
+  for (vtkCellArray* cells : cellArrays)
+  {
+    if (cells && cells->GetNumberOfCells() > 0)
+    {
+      return cells->GetNumberOfCells() == numSourceCells ? cells : nullptr;
+    }
+  }
+  return nullptr;
+}
+
+//------------------------------------------------------------------------------
+// Copy a source array into a contiguous block of doubles, converting it if
+// needed. Converting float to double is exact, so transforming the copy gives
+// the same result as transforming the source array.
+const double* GetDoubleTuples(vtkDataArray* array, std::vector<double>& buffer)
+{
+  if (array->GetDataType() == VTK_DOUBLE)
+  {
+    return static_cast<double*>(array->GetVoidPointer(0));
+  }
+  const vtkIdType numValues = array->GetNumberOfValues();
+  const float* values = static_cast<float*>(array->GetVoidPointer(0));
+  buffer.assign(values, values + numValues);
+  return buffer.data();
+}
+
+//------------------------------------------------------------------------------
+// Same arithmetic as vtkLinearTransform::TransformPoints()
+template <typename T>
+void TransformGlyphPoints(double matrix[4][4], const double* in, T* out, vtkIdType numPts)
+{
+  for (vtkIdType i = 0; i < numPts; ++i, in += 3, out += 3)
+  {
+    out[0] = static_cast<T>(
+      matrix[0][0] * in[0] + matrix[0][1] * in[1] + matrix[0][2] * in[2] + matrix[0][3]);
+    out[1] = static_cast<T>(
+      matrix[1][0] * in[0] + matrix[1][1] * in[1] + matrix[1][2] * in[2] + matrix[1][3]);
+    out[2] = static_cast<T>(
+      matrix[2][0] * in[0] + matrix[2][1] * in[1] + matrix[2][2] * in[2] + matrix[2][3]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Glyph the input points in parallel. Each visible input point has been
+// assigned a glyph index beforehand, which gives the range of output points,
+// cells and connectivity it writes. The per point transform is built exactly
+// as in the serial path and applied with the same arithmetic as
+// vtkLinearTransform, so the output does not depend on the number of threads.
+struct GlyphPointsWorker
+{
+  enum ScalarsOutput
+  {
+    NO_SCALARS,
+    SCALE_SCALARS,
+    COPY_SCALARS,
+    MAGNITUDE_SCALARS
+  };
+
+  vtkGlyph3D* Filter;
+  vtkDataSet* Input;
+  const vtkIdType* GlyphIds;
+  vtkDataArray* SScalars;
+  vtkDataArray* CScalars;
+  vtkDataArray* Vectors;
+
+  int ScaleMode;
+  int Scaling;
+  double ScaleFactor;
+  int Clamping;
+  double Range[2];
+  double Den;
+  int Orient;
+  ScalarsOutput Scalars;
+
+  vtkIdType NumSourcePts;
+  vtkIdType NumSourceCells;
+  vtkIdType SourceConnectivitySize;
+  const double* SourcePts;
+  const double* SourceNormals;
+  const vtkIdType* SourceOffsets;
+  const vtkIdType* SourceConnectivity;
+  const float* SourceTCoords;
+  int NumTCoordComps;
+
+  float* OutFloatPts;
+  double* OutDoublePts;
+  float* OutNormals;
+  float* OutVectors;
+  float* OutTCoords;
+  vtkDataArray* OutScalars;
+  vtkIdType* OutPointIds;
+  vtkIdType* OutOffsets;
+  vtkIdType* OutConnectivity;
+  ArrayList* PointArrays;
+  ArrayList* CellArrays;
+
+  vtkSMPThreadLocalObject<vtkTransform> Transform;
+
+  void Initialize() {}
+
+  void operator()(vtkIdType inPtId, vtkIdType endPtId)
+  {
+    vtkTransform* trans = this->Transform.Local();
+    double x[3], v[3], vNew[3], s = 0.0, vMag = 0.0;
+    double scalex, scaley, scalez;
+    double normalsMatrix[4][4];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType checkAbortInterval = std::min((endPtId - inPtId) / 10 + 1, (vtkIdType)1000);
+
+    for (; inPtId < endPtId; ++inPtId)
+    {
+      if (inPtId % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->Filter->CheckAbort();
+        }
+        if (this->Filter->GetAbortOutput())
+        {
+          break;
+        }
+      }
+
+      const vtkIdType glyph = this->GlyphIds[inPtId];
+      if (glyph < 0)
+      {
+        continue;
+      }
+      const vtkIdType ptIncr = glyph * this->NumSourcePts;
+      const vtkIdType cellIncr = glyph * this->NumSourceCells;
+      const vtkIdType connIncr = glyph * this->SourceConnectivitySize;
+
+      scalex = scaley = scalez = 1.0;
+      if (this->SScalars)
+      {
+        s = this->SScalars->GetComponent(inPtId, 0);
+        if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
+        {
+          scalex = scaley = scalez = s;
+        }
+      }
+
+      if (this->Vectors)
+      {
+        v[0] = 0;
+        v[1] = 0;
+        v[2] = 0;
+        this->Vectors->GetTuple(inPtId, v);
+        vMag = vtkMath::Norm(v);
+        if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
+        {
+          scalex = v[0];
+          scaley = v[1];
+          scalez = v[2];
+        }
+        else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
+        {
+          scalex = scaley = scalez = vMag;
+        }
+      }
+
+      // Clamp data scale if enabled
+      if (this->Clamping)
+      {
+        scalex = (scalex < this->Range[0] ? this->Range[0]
+                                          : (scalex > this->Range[1] ? this->Range[1] : scalex));
+        scalex = (scalex - this->Range[0]) / this->Den;
+        scaley = (scaley < this->Range[0] ? this->Range[0]
+                                          : (scaley > this->Range[1] ? this->Range[1] : scaley));
+        scaley = (scaley - this->Range[0]) / this->Den;
+        scalez = (scalez < this->Range[0] ? this->Range[0]
+                                          : (scalez > this->Range[1] ? this->Range[1] : scalez));
+        scalez = (scalez - this->Range[0]) / this->Den;
+      }
+
+      // Copy all topology (transformation independent)
+      for (vtkIdType cellId = 0; cellId < this->NumSourceCells; ++cellId)
+      {
+        this->OutOffsets[cellIncr + cellId] = connIncr + this->SourceOffsets[cellId];
+      }
+      vtkIdType* outConn = this->OutConnectivity + connIncr;
+      for (vtkIdType i = 0; i < this->SourceConnectivitySize; ++i)
+      {
+        outConn[i] = this->SourceConnectivity[i] + ptIncr;
+      }
+
+      // translate Source to Input point
+      trans->Identity();
+      this->Input->GetPoint(inPtId, x);
+      trans->Translate(x[0], x[1], x[2]);
+
+      if (this->Vectors)
+      {
+        // Copy Input vector
+        float* outVector = this->OutVectors + 3 * ptIncr;
+        for (vtkIdType i = 0; i < this->NumSourcePts; ++i, outVector += 3)
+        {
+          outVector[0] = static_cast<float>(v[0]);
+          outVector[1] = static_cast<float>(v[1]);
+          outVector[2] = static_cast<float>(v[2]);
+        }
+        if (this->Orient && vMag > 0.0)
+        {
+          // if there is no y or z component
+          if (v[1] == 0.0 && v[2] == 0.0)
+          {
+            if (v[0] < 0) // just flip x if we need to
+            {
+              trans->RotateWXYZ(180.0, 0, 1, 0);
+            }
+          }
+          else
+          {
+            vNew[0] = (v[0] + vMag) / 2.0;
+            vNew[1] = v[1] / 2.0;
+            vNew[2] = v[2] / 2.0;
+            trans->RotateWXYZ(180.0, vNew[0], vNew[1], vNew[2]);
+          }
+        }
+      }
+
+      if (this->SourceTCoords)
+      {
+        const vtkIdType numValues = this->NumTCoordComps * this->NumSourcePts;
+        std::copy(this->SourceTCoords, this->SourceTCoords + numValues,
+          this->OutTCoords + this->NumTCoordComps * ptIncr);
+      }
+
+      // Copy scalar value
+      switch (this->Scalars)
+      {
+        case SCALE_SCALARS:
+          std::fill_n(static_cast<float*>(this->OutScalars->GetVoidPointer(0)) + ptIncr,
+            this->NumSourcePts, static_cast<float>(scalex));
+          break;
+        case COPY_SCALARS:
+          for (vtkIdType i = 0; i < this->NumSourcePts; ++i)
+          {
+            this->OutScalars->SetTuple(ptIncr + i, inPtId, this->CScalars);
+          }
+          break;
+        case MAGNITUDE_SCALARS:
+          std::fill_n(static_cast<float*>(this->OutScalars->GetVoidPointer(0)) + ptIncr,
+            this->NumSourcePts, static_cast<float>(vMag));
+          break;
+        default:
+          break;
+      }
+
+      // scale data if appropriate
+      if (this->Scaling)
+      {
+        if (this->ScaleMode == VTK_DATA_SCALING_OFF)
+        {
+          scalex = scaley = scalez = this->ScaleFactor;
+        }
+        else
+        {
+          scalex *= this->ScaleFactor;
+          scaley *= this->ScaleFactor;
+          scalez *= this->ScaleFactor;
+        }
+
+        if (scalex == 0.0)
+        {
+          scalex = 1.0e-10;
+        }
+        if (scaley == 0.0)
+        {
+          scaley = 1.0e-10;
+        }
+        if (scalez == 0.0)
+        {
+          scalez = 1.0e-10;
+        }
+        trans->Scale(scalex, scaley, scalez);
+      }
+
+      // multiply points and normals by resulting matrix
+      double(*matrix)[4] = trans->GetMatrix()->Element;
+      if (this->OutFloatPts)
+      {
+        TransformGlyphPoints(
+          matrix, this->SourcePts, this->OutFloatPts + 3 * ptIncr, this->NumSourcePts);
+      }
+      else
+      {
+        TransformGlyphPoints(
+          matrix, this->SourcePts, this->OutDoublePts + 3 * ptIncr, this->NumSourcePts);
+      }
+
+      if (this->SourceNormals)
+      {
+        // to transform the normal, multiply by the transposed inverse matrix
+        vtkMatrix4x4::DeepCopy(*normalsMatrix, trans->GetMatrix());
+        vtkMatrix4x4::Invert(*normalsMatrix, *normalsMatrix);
+        vtkMatrix4x4::Transpose(*normalsMatrix, *normalsMatrix);
+        const double* in = this->SourceNormals;
+        float* outNormal = this->OutNormals + 3 * ptIncr;
+        for (vtkIdType i = 0; i < this->NumSourcePts; ++i, in += 3, outNormal += 3)
+        {
+          outNormal[0] = static_cast<float>(normalsMatrix[0][0] * in[0] +
+            normalsMatrix[0][1] * in[1] + normalsMatrix[0][2] * in[2]);
+          outNormal[1] = static_cast<float>(normalsMatrix[1][0] * in[0] +
+            normalsMatrix[1][1] * in[1] + normalsMatrix[1][2] * in[2]);
+          outNormal[2] = static_cast<float>(normalsMatrix[2][0] * in[0] +
+            normalsMatrix[2][1] * in[1] + normalsMatrix[2][2] * in[2]);
+          vtkMath::Normalize(outNormal);
+        }
+      }
+
+      // Copy point data from source
+      for (vtkIdType i = 0; i < this->NumSourcePts; ++i)
+      {
+        this->PointArrays->Copy(inPtId, ptIncr + i);
+      }
+      if (this->CellArrays)
+      {
+        for (vtkIdType i = 0; i < this->NumSourceCells; ++i)
+        {
+          this->CellArrays->Copy(inPtId, cellIncr + i);
+        }
+      }
+
+      // If point ids are to be generated, do it here
+      if (this->OutPointIds)
+      {
+        std::fill_n(this->OutPointIds + ptIncr, this->NumSourcePts, inPtId);
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Construct object with scaling on, scaling mode is by scalar value,
 // scale factor = 1.0, the range is (0,1), orient geometry is on, and
@@ -397,328 +772,537 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     newTCoords->SetName("TCoords");
   }
 
-  // Setting up for calls to PolyData::InsertNextCell()
-  output->AllocateEstimate(numPts * numSourceCells, 3);
-
-  transformedSourcePts->SetDataTypeToDouble();
-  transformedSourcePts->Allocate(numSourcePts);
-
-  // Traverse all Input points, transforming Source points and copying
-  // point attributes.
-  //
-  ptIncr = 0;
-  cellIncr = 0;
-  for (inPtId = 0; inPtId < numPts; inPtId++)
+  // Without indexing every glyph has the same number of points and cells, so
+  // once the visible points are known each of them owns a fixed block of the
+  // output and the glyphs are generated in parallel. The camera following mode
+  // stays serial since its output vectors depend on the previous glyph.
+  vtkCellArray* sourceCells = nullptr;
+  if (this->IndexMode == VTK_INDEXING_OFF && this->VectorMode != VTK_FOLLOW_CAMERA_DIRECTION)
   {
-    scalex = scaley = scalez = 1.0;
-    if (!(inPtId % 10000))
-    {
-      this->UpdateProgress(static_cast<double>(inPtId) / numPts);
-      if (this->CheckAbort())
-      {
-        break;
-      }
-    }
-
-    // Get the scalar and vector data
-    if (inSScalars)
+    sourceCells = GetParallelGlyphCells(source, sourceNormals, sourceTCoords, numSourceCells);
+  }
+  if (sourceCells)
+  {
+    vtkDataArray* array3D = nullptr;
+    if (haveVectors)
     {
-      s = inSScalars->GetComponent(inPtId, 0);
-      if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
+      array3D = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
+      if (array3D->GetNumberOfComponents() > 3)
       {
-        scalex = scaley = scalez = s;
+        vtkErrorMacro(<< "vtkDataArray " << array3D->GetName()
+                      << " has more than 3 components.\n");
+        pts->Delete();
+        trans->Delete();
+        newPts->Delete();
+        newVectors->Delete();
+        return false;
       }
     }
 
-    if (haveVectors)
+    // Visibility may be overridden by subclasses, so it is evaluated serially
+    // and in order. Each visible point gets the index of its glyph.
+    std::vector<vtkIdType> glyphIds(numPts);
+    vtkIdType numGlyphs = 0;
+    for (inPtId = 0; inPtId < numPts; inPtId++)
     {
-      if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
+      if ((inGhostLevels &&
+            inGhostLevels[inPtId] &
+              (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT)) ||
+        (inputUG && !inputUG->IsPointVisible(inPtId)) || !this->IsPointVisible(input, inPtId))
       {
-        vMag = 1.0; // v will be set later
+        glyphIds[inPtId] = -1;
       }
       else
       {
-        vtkDataArray* array3D = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
-        if (array3D->GetNumberOfComponents() > 3)
-        {
-          vtkErrorMacro(<< "vtkDataArray " << array3D->GetName()
-                        << " has more than 3 components.\n");
-          pts->Delete();
-          trans->Delete();
-          if (newPts)
-          {
-            newPts->Delete();
-          }
-          if (newVectors)
-          {
-            newVectors->Delete();
-          }
-          return false;
-        }
-
-        v[0] = 0;
-        v[1] = 0;
-        v[2] = 0;
-        array3D->GetTuple(inPtId, v);
-        vMag = vtkMath::Norm(v);
-        if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
-        {
-          scalex = v[0];
-          scaley = v[1];
-          scalez = v[2];
-        }
-        else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
-        {
-          scalex = scaley = scalez = vMag;
-        }
+        glyphIds[inPtId] = numGlyphs++;
       }
     }
+    const vtkIdType numOutPts = numGlyphs * numSourcePts;
+    const vtkIdType numOutCells = numGlyphs * numSourceCells;
 
-    // Clamp data scale if enabled
-    if (this->Clamping)
+    // Gather the source geometry once
+    std::vector<double> sourcePtsBuffer, sourceNormalsBuffer;
+    const double* sourcePtsData;
+    if (this->SourceTransform)
     {
-      scalex = (scalex < this->Range[0] ? this->Range[0]
-                                        : (scalex > this->Range[1] ? this->Range[1] : scalex));
-      scalex = (scalex - this->Range[0]) / den;
-      scaley = (scaley < this->Range[0] ? this->Range[0]
-                                        : (scaley > this->Range[1] ? this->Range[1] : scaley));
-      scaley = (scaley - this->Range[0]) / den;
-      scalez = (scalez < this->Range[0] ? this->Range[0]
-                                        : (scalez > this->Range[1] ? this->Range[1] : scalez));
-      scalez = (scalez - this->Range[0]) / den;
+      transformedSourcePts->SetDataTypeToDouble();
+      this->SourceTransform->TransformPoints(sourcePts, transformedSourcePts);
+      sourcePtsData = static_cast<double*>(transformedSourcePts->GetVoidPointer(0));
     }
-
-    // Compute index into table of glyphs
-    if (this->IndexMode != VTK_INDEXING_OFF)
+    else
     {
-      if (this->IndexMode == VTK_INDEXING_BY_SCALAR)
-      {
-        value = s;
-      }
-      else
-      {
-        value = vMag;
-      }
-
-      int index = static_cast<int>((value - this->Range[0]) * numberOfSources / den);
-      index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
+      sourcePtsData = GetDoubleTuples(sourcePts->GetData(), sourcePtsBuffer);
+    }
+    const double* sourceNormalsData =
+      haveNormals ? GetDoubleTuples(sourceNormals, sourceNormalsBuffer) : nullptr;
 
-      source = this->GetSource(index, sourceVector);
-      if (source != nullptr)
+    std::vector<float> sourceTCoordsData;
+    int numTCoordComps = 0;
+    if (haveTCoords)
+    {
+      numTCoordComps = sourceTCoords->GetNumberOfComponents();
+      sourceTCoordsData.resize(numTCoordComps * numSourcePts);
+      for (i = 0; i < numSourcePts; i++)
       {
-        sourcePts = source->GetPoints();
-        sourceNormals = source->GetPointData()->GetNormals();
-        numSourcePts = sourcePts->GetNumberOfPoints();
-        numSourceCells = source->GetNumberOfCells();
+        sourceTCoords->GetTuple(i, tc);
+        for (int comp = 0; comp < numTCoordComps; ++comp)
+        {
+          sourceTCoordsData[numTCoordComps * i + comp] = static_cast<float>(tc[comp]);
+        }
       }
     }
 
-    // Make sure we're not indexing into empty glyph
-    if (source == nullptr)
+    std::vector<vtkIdType> sourceOffsets, sourceConnectivity;
+    sourceOffsets.reserve(numSourceCells);
+    sourceConnectivity.reserve(sourceCells->GetNumberOfConnectivityIds());
+    vtkIdType sourceNumCellPts;
+    const vtkIdType* sourceCellPts;
+    for (sourceCells->InitTraversal(); sourceCells->GetNextCell(sourceNumCellPts, sourceCellPts);)
     {
-      continue;
+      sourceOffsets.push_back(static_cast<vtkIdType>(sourceConnectivity.size()));
+      sourceConnectivity.insert(
+        sourceConnectivity.end(), sourceCellPts, sourceCellPts + sourceNumCellPts);
     }
+    const vtkIdType sourceConnectivitySize = static_cast<vtkIdType>(sourceConnectivity.size());
 
-    // Check ghost points.
-    // If we are processing a piece, we do not want to duplicate glyphs on the borders.
-    if (inGhostLevels &&
-      inGhostLevels[inPtId] &
-        (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT))
+    // Allocate the output
+    newPts->SetNumberOfPoints(numOutPts);
+    if (pointIds)
     {
-      continue;
+      pointIds->SetNumberOfTuples(numOutPts);
     }
-
-    if (inputUG && !inputUG->IsPointVisible(inPtId))
+    if (newScalars)
     {
-      // input is a vtkUniformGrid and the current point is blanked. Don't glyph
-      // it.
-      continue;
+      newScalars->SetNumberOfTuples(numOutPts);
     }
-
-    if (!this->IsPointVisible(input, inPtId))
+    if (newVectors)
     {
-      continue;
+      newVectors->SetNumberOfTuples(numOutPts);
+    }
+    if (newNormals)
+    {
+      newNormals->SetNumberOfTuples(numOutPts);
+    }
+    if (newTCoords)
+    {
+      newTCoords->SetNumberOfTuples(numOutPts);
+    }
+    vtkNew<vtkIdTypeArray> outOffsets;
+    outOffsets->SetNumberOfValues(numOutCells + 1);
+    outOffsets->SetValue(numOutCells, numGlyphs * sourceConnectivitySize);
+    vtkNew<vtkIdTypeArray> outConnectivity;
+    outConnectivity->SetNumberOfValues(numGlyphs * sourceConnectivitySize);
+
+    ArrayList pointArrays;
+    pointArrays.AddArrays(numOutPts, pd, outputPD, 0.0, false);
+    ArrayList cellArrays;
+    if (this->FillCellData)
+    {
+      cellArrays.AddArrays(numOutCells, pd, outputCD, 0.0, false);
     }
 
-    // Now begin copying/transforming glyph
-    trans->Identity();
-
-    // Copy all topology (transformation independent)
-    for (cellId = 0; cellId < numSourceCells; cellId++)
+    GlyphPointsWorker worker;
+    worker.Filter = this;
+    worker.Input = input;
+    worker.GlyphIds = glyphIds.data();
+    worker.SScalars = inSScalars;
+    worker.CScalars = inCScalars;
+    worker.Vectors = array3D;
+    worker.ScaleMode = this->ScaleMode;
+    worker.Scaling = this->Scaling;
+    worker.ScaleFactor = this->ScaleFactor;
+    worker.Clamping = this->Clamping;
+    worker.Range[0] = this->Range[0];
+    worker.Range[1] = this->Range[1];
+    worker.Den = den;
+    worker.Orient = this->Orient;
+    worker.Scalars = GlyphPointsWorker::NO_SCALARS;
+    if (inSScalars && this->ColorMode == VTK_COLOR_BY_SCALE)
+    {
+      worker.Scalars = GlyphPointsWorker::SCALE_SCALARS;
+    }
+    else if (inCScalars && this->ColorMode == VTK_COLOR_BY_SCALAR)
+    {
+      worker.Scalars = GlyphPointsWorker::COPY_SCALARS;
+    }
+    else if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
+    {
+      worker.Scalars = GlyphPointsWorker::MAGNITUDE_SCALARS;
+    }
+    worker.NumSourcePts = numSourcePts;
+    worker.NumSourceCells = numSourceCells;
+    worker.SourceConnectivitySize = sourceConnectivitySize;
+    worker.SourcePts = sourcePtsData;
+    worker.SourceNormals = sourceNormalsData;
+    worker.SourceOffsets = sourceOffsets.data();
+    worker.SourceConnectivity = sourceConnectivity.data();
+    worker.SourceTCoords = haveTCoords ? sourceTCoordsData.data() : nullptr;
+    worker.NumTCoordComps = numTCoordComps;
+    worker.OutFloatPts = nullptr;
+    worker.OutDoublePts = nullptr;
+    if (newPts->GetDataType() == VTK_FLOAT)
+    {
+      worker.OutFloatPts = static_cast<float*>(newPts->GetVoidPointer(0));
+    }
+    else
+    {
+      worker.OutDoublePts = static_cast<double*>(newPts->GetVoidPointer(0));
+    }
+    worker.OutNormals = newNormals ? static_cast<float*>(newNormals->GetVoidPointer(0)) : nullptr;
+    worker.OutVectors = newVectors ? static_cast<float*>(newVectors->GetVoidPointer(0)) : nullptr;
+    worker.OutTCoords = newTCoords ? static_cast<float*>(newTCoords->GetVoidPointer(0)) : nullptr;
+    worker.OutScalars = newScalars;
+    worker.OutPointIds = pointIds ? pointIds->GetPointer(0) : nullptr;
+    worker.OutOffsets = outOffsets->GetPointer(0);
+    worker.OutConnectivity = outConnectivity->GetPointer(0);
+    worker.PointArrays = &pointArrays;
+    worker.CellArrays = this->FillCellData ? &cellArrays : nullptr;
+    vtkSMPTools::For(0, numPts, worker);
+
+    vtkNew<vtkCellArray> cells;
+    cells->SetData(outOffsets, outConnectivity);
+    if (sourceCells == source->GetVerts())
+    {
+      output->SetVerts(cells);
+    }
+    else if (sourceCells == source->GetLines())
+    {
+      output->SetLines(cells);
+    }
+    else if (sourceCells == source->GetPolys())
+    {
+      output->SetPolys(cells);
+    }
+    else
+    {
+      output->SetStrips(cells);
+    }
+  }
+  else
+  {
+    // Setting up for calls to PolyData::InsertNextCell()
+    output->AllocateEstimate(numPts * numSourceCells, 3);
+
+    transformedSourcePts->SetDataTypeToDouble();
+    transformedSourcePts->Allocate(numSourcePts);
+
+    // Traverse all Input points, transforming Source points and copying
+    // point attributes.
+    //
+    ptIncr = 0;
+    cellIncr = 0;
+    for (inPtId = 0; inPtId < numPts; inPtId++)
     {
-      source->GetCellPoints(cellId, pointIdList);
-      cellPts = pointIdList;
-      npts = cellPts->GetNumberOfIds();
-      for (pts->Reset(), i = 0; i < npts; i++)
+      scalex = scaley = scalez = 1.0;
+      if (!(inPtId % 10000))
       {
-        pts->InsertId(i, cellPts->GetId(i) + ptIncr);
+        this->UpdateProgress(static_cast<double>(inPtId) / numPts);
+        if (this->CheckAbort())
+        {
+          break;
+        }
       }
-      output->InsertNextCell(source->GetCellType(cellId), pts);
-    }
 
-    // translate Source to Input point
-    input->GetPoint(inPtId, x);
-    trans->Translate(x[0], x[1], x[2]);
-
-    if (haveVectors)
-    {
-      // Copy Input vector
-      for (i = 0; i < numSourcePts; i++)
+      // Get the scalar and vector data
+      if (inSScalars)
       {
-        newVectors->InsertTuple(i + ptIncr, v);
+        s = inSScalars->GetComponent(inPtId, 0);
+        if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
+        {
+          scalex = scaley = scalez = s;
+        }
       }
-      if (this->Orient)
+
+      if (haveVectors)
       {
         if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
         {
-          // v = glyphNormal_World (glyph normal direction in World coordinate system)
-          v[0] = this->FollowedCameraPosition[0] - x[0];
-          v[1] = this->FollowedCameraPosition[1] - x[1];
-          v[2] = this->FollowedCameraPosition[2] - x[2];
-          vtkMath::Normalize(v);
-          double glyphRight_World[3]; // glyph right direction in World coordinate system
-          vtkMath::Cross(this->FollowedCameraViewUp, v, glyphRight_World);
-          // glyph up direction in World coordinate system
-          // (approximately the same as this->FollowedCameraViewUp, but slightly adjusted to be
-          // orthogonal to the normal direction)
-          double glyphUp_World[3];
-          vtkMath::Cross(v, glyphRight_World, glyphUp_World);
-          double glyphToWorld[16] = { glyphRight_World[0], glyphUp_World[0], v[0], 0.0,
-            glyphRight_World[1], glyphUp_World[1], v[1], 0.0, glyphRight_World[2], glyphUp_World[2],
-            v[2], 0.0, 0.0, 0.0, 0.0, 1.0 };
-          trans->Concatenate(glyphToWorld);
-        }
-        else if (vMag > 0.0)
+          vMag = 1.0; // v will be set later
+        }
+        else
         {
-          // if there is no y or z component
-          if (v[1] == 0.0 && v[2] == 0.0)
+          vtkDataArray* array3D = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
+          if (array3D->GetNumberOfComponents() > 3)
           {
-            if (v[0] < 0) // just flip x if we need to
+            vtkErrorMacro(<< "vtkDataArray " << array3D->GetName()
+                          << " has more than 3 components.\n");
+            pts->Delete();
+            trans->Delete();
+            if (newPts)
             {
-              trans->RotateWXYZ(180.0, 0, 1, 0);
+              newPts->Delete();
+            }
+            if (newVectors)
+            {
+              newVectors->Delete();
             }
+            return false;
           }
-          else
+
+          v[0] = 0;
+          v[1] = 0;
+          v[2] = 0;
+          array3D->GetTuple(inPtId, v);
+          vMag = vtkMath::Norm(v);
+          if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
           {
-            vNew[0] = (v[0] + vMag) / 2.0;
-            vNew[1] = v[1] / 2.0;
-            vNew[2] = v[2] / 2.0;
-            trans->RotateWXYZ(180.0, vNew[0], vNew[1], vNew[2]);
+            scalex = v[0];
+            scaley = v[1];
+            scalez = v[2];
+          }
+          else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
+          {
+            scalex = scaley = scalez = vMag;
           }
         }
       }
-    }
 
-    if (haveTCoords)
-    {
-      for (i = 0; i < numSourcePts; i++)
+      // Clamp data scale if enabled
+      if (this->Clamping)
       {
-        sourceTCoords->GetTuple(i, tc);
-        newTCoords->InsertTuple(i + ptIncr, tc);
+        scalex = (scalex < this->Range[0] ? this->Range[0]
+                                          : (scalex > this->Range[1] ? this->Range[1] : scalex));
+        scalex = (scalex - this->Range[0]) / den;
+        scaley = (scaley < this->Range[0] ? this->Range[0]
+                                          : (scaley > this->Range[1] ? this->Range[1] : scaley));
+        scaley = (scaley - this->Range[0]) / den;
+        scalez = (scalez < this->Range[0] ? this->Range[0]
+                                          : (scalez > this->Range[1] ? this->Range[1] : scalez));
+        scalez = (scalez - this->Range[0]) / den;
       }
-    }
 
-    // determine scale factor from scalars if appropriate
-    // Copy scalar value
-    if (inSScalars && (this->ColorMode == VTK_COLOR_BY_SCALE))
-    {
-      for (i = 0; i < numSourcePts; i++)
+      // Compute index into table of glyphs
+      if (this->IndexMode != VTK_INDEXING_OFF)
       {
-        newScalars->InsertTuple(i + ptIncr, &scalex); // = scaley = scalez
+        if (this->IndexMode == VTK_INDEXING_BY_SCALAR)
+        {
+          value = s;
+        }
+        else
+        {
+          value = vMag;
+        }
+
+        int index = static_cast<int>((value - this->Range[0]) * numberOfSources / den);
+        index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
+
+        source = this->GetSource(index, sourceVector);
+        if (source != nullptr)
+        {
+          sourcePts = source->GetPoints();
+          sourceNormals = source->GetPointData()->GetNormals();
+          numSourcePts = sourcePts->GetNumberOfPoints();
+          numSourceCells = source->GetNumberOfCells();
+        }
       }
-    }
-    else if (inCScalars && (this->ColorMode == VTK_COLOR_BY_SCALAR))
-    {
-      for (i = 0; i < numSourcePts; i++)
+
+      // Make sure we're not indexing into empty glyph
+      if (source == nullptr)
       {
-        outputPD->CopyTuple(inCScalars, newScalars, inPtId, ptIncr + i);
+        continue;
       }
-    }
-    if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
-    {
-      for (i = 0; i < numSourcePts; i++)
+
+      // Check ghost points.
+      // If we are processing a piece, we do not want to duplicate glyphs on the borders.
+      if (inGhostLevels &&
+        inGhostLevels[inPtId] &
+          (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT))
       {
-        newScalars->InsertTuple(i + ptIncr, &vMag);
+        continue;
       }
-    }
 
-    // scale data if appropriate
-    if (this->Scaling)
-    {
-      if (this->ScaleMode == VTK_DATA_SCALING_OFF)
+      if (inputUG && !inputUG->IsPointVisible(inPtId))
       {
-        scalex = scaley = scalez = this->ScaleFactor;
+        // input is a vtkUniformGrid and the current point is blanked. Don't glyph
+        // it.
+        continue;
       }
-      else
+
+      if (!this->IsPointVisible(input, inPtId))
       {
-        scalex *= this->ScaleFactor;
-        scaley *= this->ScaleFactor;
-        scalez *= this->ScaleFactor;
+        continue;
       }
 
-      if (scalex == 0.0)
+      // Now begin copying/transforming glyph
+      trans->Identity();
+
+      // Copy all topology (transformation independent)
+      for (cellId = 0; cellId < numSourceCells; cellId++)
       {
-        scalex = 1.0e-10;
+        source->GetCellPoints(cellId, pointIdList);
+        cellPts = pointIdList;
+        npts = cellPts->GetNumberOfIds();
+        for (pts->Reset(), i = 0; i < npts; i++)
+        {
+          pts->InsertId(i, cellPts->GetId(i) + ptIncr);
+        }
+        output->InsertNextCell(source->GetCellType(cellId), pts);
       }
-      if (scaley == 0.0)
+
+      // translate Source to Input point
+      input->GetPoint(inPtId, x);
+      trans->Translate(x[0], x[1], x[2]);
+
+      if (haveVectors)
       {
-        scaley = 1.0e-10;
+        // Copy Input vector
+        for (i = 0; i < numSourcePts; i++)
+        {
+          newVectors->InsertTuple(i + ptIncr, v);
+        }
+        if (this->Orient)
+        {
+          if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
+          {
+            // v = glyphNormal_World (glyph normal direction in World coordinate system)
+            v[0] = this->FollowedCameraPosition[0] - x[0];
+            v[1] = this->FollowedCameraPosition[1] - x[1];
+            v[2] = this->FollowedCameraPosition[2] - x[2];
+            vtkMath::Normalize(v);
+            double glyphRight_World[3]; // glyph right direction in World coordinate system
+            vtkMath::Cross(this->FollowedCameraViewUp, v, glyphRight_World);
+            // glyph up direction in World coordinate system
+            // (approximately the same as this->FollowedCameraViewUp, but slightly adjusted to be
+            // orthogonal to the normal direction)
+            double glyphUp_World[3];
+            vtkMath::Cross(v, glyphRight_World, glyphUp_World);
+            double glyphToWorld[16] = { glyphRight_World[0], glyphUp_World[0], v[0], 0.0,
+              glyphRight_World[1], glyphUp_World[1], v[1], 0.0, glyphRight_World[2],
+              glyphUp_World[2], v[2], 0.0, 0.0, 0.0, 0.0, 1.0 };
+            trans->Concatenate(glyphToWorld);
+          }
+          else if (vMag > 0.0)
+          {
+            // if there is no y or z component
+            if (v[1] == 0.0 && v[2] == 0.0)
+            {
+              if (v[0] < 0) // just flip x if we need to
+              {
+                trans->RotateWXYZ(180.0, 0, 1, 0);
+              }
+            }
+            else
+            {
+              vNew[0] = (v[0] + vMag) / 2.0;
+              vNew[1] = v[1] / 2.0;
+              vNew[2] = v[2] / 2.0;
+              trans->RotateWXYZ(180.0, vNew[0], vNew[1], vNew[2]);
+            }
+          }
+        }
       }
-      if (scalez == 0.0)
+
+      if (haveTCoords)
       {
-        scalez = 1.0e-10;
+        for (i = 0; i < numSourcePts; i++)
+        {
+          sourceTCoords->GetTuple(i, tc);
+          newTCoords->InsertTuple(i + ptIncr, tc);
+        }
       }
-      trans->Scale(scalex, scaley, scalez);
-    }
 
-    // multiply points and normals by resulting matrix
-    if (this->SourceTransform)
-    {
-      transformedSourcePts->Reset();
-      this->SourceTransform->TransformPoints(sourcePts, transformedSourcePts);
-      trans->TransformPoints(transformedSourcePts, newPts);
-    }
-    else
-    {
-      trans->TransformPoints(sourcePts, newPts);
-    }
+      // determine scale factor from scalars if appropriate
+      // Copy scalar value
+      if (inSScalars && (this->ColorMode == VTK_COLOR_BY_SCALE))
+      {
+        for (i = 0; i < numSourcePts; i++)
+        {
+          newScalars->InsertTuple(i + ptIncr, &scalex); // = scaley = scalez
+        }
+      }
+      else if (inCScalars && (this->ColorMode == VTK_COLOR_BY_SCALAR))
+      {
+        for (i = 0; i < numSourcePts; i++)
+        {
+          outputPD->CopyTuple(inCScalars, newScalars, inPtId, ptIncr + i);
+        }
+      }
+      if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
+      {
+        for (i = 0; i < numSourcePts; i++)
+        {
+          newScalars->InsertTuple(i + ptIncr, &vMag);
+        }
+      }
 
-    if (haveNormals)
-    {
-      trans->TransformNormals(sourceNormals, newNormals);
-    }
+      // scale data if appropriate
+      if (this->Scaling)
+      {
+        if (this->ScaleMode == VTK_DATA_SCALING_OFF)
+        {
+          scalex = scaley = scalez = this->ScaleFactor;
+        }
+        else
+        {
+          scalex *= this->ScaleFactor;
+          scaley *= this->ScaleFactor;
+          scalez *= this->ScaleFactor;
+        }
 
-    // Copy point data from source (if possible)
-    if (pd)
-    {
-      for (i = 0; i < numSourcePts; ++i)
+        if (scalex == 0.0)
+        {
+          scalex = 1.0e-10;
+        }
+        if (scaley == 0.0)
+        {
+          scaley = 1.0e-10;
+        }
+        if (scalez == 0.0)
+        {
+          scalez = 1.0e-10;
+        }
+        trans->Scale(scalex, scaley, scalez);
+      }
+
+      // multiply points and normals by resulting matrix
+      if (this->SourceTransform)
       {
-        srcPointIdList->SetId(i, inPtId);
-        dstPointIdList->SetId(i, ptIncr + i);
+        transformedSourcePts->Reset();
+        this->SourceTransform->TransformPoints(sourcePts, transformedSourcePts);
+        trans->TransformPoints(transformedSourcePts, newPts);
       }
-      outputPD->CopyData(pd, srcPointIdList, dstPointIdList);
-      if (this->FillCellData)
+      else
+      {
+        trans->TransformPoints(sourcePts, newPts);
+      }
+
+      if (haveNormals)
+      {
+        trans->TransformNormals(sourceNormals, newNormals);
+      }
+
+      // Copy point data from source (if possible)
+      if (pd)
       {
-        for (i = 0; i < numSourceCells; ++i)
+        for (i = 0; i < numSourcePts; ++i)
         {
-          srcCellIdList->SetId(i, inPtId);
-          dstCellIdList->SetId(i, cellIncr + i);
+          srcPointIdList->SetId(i, inPtId);
+          dstPointIdList->SetId(i, ptIncr + i);
+        }
+        outputPD->CopyData(pd, srcPointIdList, dstPointIdList);
+        if (this->FillCellData)
+        {
+          for (i = 0; i < numSourceCells; ++i)
+          {
+            srcCellIdList->SetId(i, inPtId);
+            dstCellIdList->SetId(i, cellIncr + i);
+          }
+          outputCD->CopyData(pd, srcCellIdList, dstCellIdList);
         }
-        outputCD->CopyData(pd, srcCellIdList, dstCellIdList);
       }
-    }
 
-    // If point ids are to be generated, do it here
-    if (this->GeneratePointIds)
-    {
-      for (i = 0; i < numSourcePts; i++)
+      // If point ids are to be generated, do it here
+      if (this->GeneratePointIds)
       {
-        pointIds->InsertNextValue(inPtId);
+        for (i = 0; i < numSourcePts; i++)
+        {
+          pointIds->InsertNextValue(inPtId);
+        }
       }
-    }
 
-    ptIncr += numSourcePts;
-    cellIncr += numSourceCells;
+      ptIncr += numSourcePts;
+      cellIncr += numSourceCells;
+    }
   }
 
   // Update ourselves and release memory
@@ -18,9 +18,11 @@
 #include "vtkCellLocator.h"
 #include "vtkGenericCell.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTriangleFilter.h"
 
@@ -118,6 +120,32 @@ double vtkImplicitPolyDataDistance::EvaluateFunction(double x[3])
     x, g, p); // get distance value returned, normal and closest point not used
 }
 
+//------------------------------------------------------------------------------
+void vtkImplicitPolyDataDistance::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  vtkIdType numTuples = input->GetNumberOfTuples();
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(numTuples);
+
+  if (this->Input == nullptr || this->Input->GetNumberOfCells() == 0)
+  {
+    vtkErrorMacro(<< "No polygons to evaluate function!");
+    output->Fill(this->NoValue);
+    return;
+  }
+
+  // The locator and the links of the input are built in SetInput(), so the
+  // points can be evaluated concurrently.
+  vtkSMPTools::For(0, numTuples, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double x[3], g[3], p[3];
+    for (; ptId < endPtId; ++ptId)
+    {
+      input->GetTuple(ptId, x);
+      output->SetComponent(ptId, 0, this->SharedEvaluate(x, g, p));
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 double vtkImplicitPolyDataDistance::EvaluateFunctionAndGetClosestPoint(
   double x[3], double closestPoint[3])
@@ -187,6 +215,7 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
     cell->EvaluatePosition(p, closestPoint, subId, pcoords, dist2, weights);
 
     vtkIdList* idList = vtkIdList::New();
+    vtkNew<vtkIdList> cellPointIds;
     int count = 0;
     for (int i = 0; i < 3; i++)
     {
@@ -239,7 +268,10 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
         }
         else
         {
-          vtkPolygon::ComputeNormal(this->Input->GetCell(idList->GetId(i))->GetPoints(), norm);
+          vtkIdType npts;
+          const vtkIdType* pts;
+          this->Input->GetCellPoints(idList->GetId(i), npts, pts, cellPointIds);
+          vtkPolygon::ComputeNormal(this->Input->GetPoints(), static_cast<int>(npts), pts, norm);
         }
         awnorm[0] += norm[0];
         awnorm[1] += norm[1];
@@ -273,6 +305,9 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
       this->Input->GetPointCells(a, idList);
       for (int i = 0; i < idList->GetNumberOfIds(); i++)
       {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        this->Input->GetCellPoints(idList->GetId(i), npts, pts, cellPointIds);
         double norm[3];
         if (cnorms)
         {
@@ -280,19 +315,19 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
         }
         else
         {
-          vtkPolygon::ComputeNormal(this->Input->GetCell(idList->GetId(i))->GetPoints(), norm);
+          vtkPolygon::ComputeNormal(this->Input->GetPoints(), static_cast<int>(npts), pts, norm);
         }
 
         // Compute angle at point a
-        int b = this->Input->GetCell(idList->GetId(i))->GetPointId(0);
-        int c = this->Input->GetCell(idList->GetId(i))->GetPointId(1);
+        vtkIdType b = pts[0];
+        vtkIdType c = pts[1];
         if (a == b)
         {
-          b = this->Input->GetCell(idList->GetId(i))->GetPointId(2);
+          b = pts[2];
         }
         else if (a == c)
         {
-          c = this->Input->GetCell(idList->GetId(i))->GetPointId(2);
+          c = pts[2];
         }
         double pa[3], pb[3], pc[3];
         this->Input->GetPoint(a, pa);
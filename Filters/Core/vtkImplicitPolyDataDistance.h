@@ -65,6 +65,12 @@ public:
   using vtkImplicitFunction::EvaluateFunction;
   double EvaluateFunction(double x[3]) override;
 
+  /**
+   * Evaluate the function at each point of the input array of 3-component
+   * tuples. The points are evaluated concurrently with vtkSMPTools.
+   */
+  void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
+
   /**
    * Evaluate function gradient of nearest triangle to point x[3].
    */
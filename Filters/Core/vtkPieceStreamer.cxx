@@ -0,0 +1,193 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPieceStreamer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPieceStreamer.h"
+
+#include "vtkCommand.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTable.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPieceStreamer);
+
+//------------------------------------------------------------------------------
+vtkPieceStreamer::vtkPieceStreamer()
+{
+  this->SetNumberOfInputPorts(1);
+  this->SetNumberOfOutputPorts(1);
+}
+
+//------------------------------------------------------------------------------
+vtkPieceStreamer::~vtkPieceStreamer() = default;
+
+//------------------------------------------------------------------------------
+void vtkPieceStreamer::SetNumberOfPieces(int num)
+{
+  num = num < 1 ? 1 : num;
+  if (this->NumberOfPasses == static_cast<unsigned int>(num))
+  {
+    return;
+  }
+
+  this->Modified();
+  this->NumberOfPasses = num;
+}
+
+//------------------------------------------------------------------------------
+vtkTable* vtkPieceStreamer::GetOutput()
+{
+  return vtkTable::SafeDownCast(this->GetOutputDataObject(0));
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  int outPiece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  int outNumPieces = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+  if (outNumPieces < 1)
+  {
+    outPiece = 0;
+    outNumPieces = 1;
+  }
+
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(),
+    outPiece * static_cast<int>(this->NumberOfPasses) + static_cast<int>(this->CurrentIndex));
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(),
+    outNumPieces * static_cast<int>(this->NumberOfPasses));
+  inInfo->Set(
+    vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), this->GhostLevels);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::ExecutePass(
+  vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector))
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkDataObject* piece = inInfo->Get(vtkDataObject::DATA_OBJECT());
+  int pieceNumber = inInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+
+  if (this->CurrentIndex == 0)
+  {
+    this->Statistics->Initialize();
+    const char* idNames[] = { "NumberOfPoints", "NumberOfCells" };
+    vtkNew<vtkIntArray> pieces;
+    pieces->SetName("Piece");
+    this->Statistics->AddColumn(pieces);
+    for (const char* name : idNames)
+    {
+      vtkNew<vtkIdTypeArray> column;
+      column->SetName(name);
+      this->Statistics->AddColumn(column);
+    }
+    vtkNew<vtkDoubleArray> bounds;
+    bounds->SetName("Bounds");
+    bounds->SetNumberOfComponents(6);
+    this->Statistics->AddColumn(bounds);
+    vtkNew<vtkIdTypeArray> size;
+    size->SetName("MemorySize");
+    this->Statistics->AddColumn(size);
+  }
+
+  double bounds[6];
+  vtkMath::UninitializeBounds(bounds);
+  vtkIdType numberOfPoints = 0;
+  vtkIdType numberOfCells = 0;
+  if (auto dataSet = vtkDataSet::SafeDownCast(piece))
+  {
+    numberOfPoints = dataSet->GetNumberOfPoints();
+    numberOfCells = dataSet->GetNumberOfCells();
+    if (numberOfPoints > 0)
+    {
+      dataSet->GetBounds(bounds);
+    }
+  }
+  else if (auto composite = vtkCompositeDataSet::SafeDownCast(piece))
+  {
+    numberOfPoints = composite->GetNumberOfPoints();
+    numberOfCells = composite->GetNumberOfCells();
+    if (numberOfPoints > 0)
+    {
+      composite->GetBounds(bounds);
+    }
+  }
+
+  vtkIntArray::SafeDownCast(this->Statistics->GetColumnByName("Piece"))
+    ->InsertNextValue(pieceNumber);
+  vtkIdTypeArray::SafeDownCast(this->Statistics->GetColumnByName("NumberOfPoints"))
+    ->InsertNextValue(numberOfPoints);
+  vtkIdTypeArray::SafeDownCast(this->Statistics->GetColumnByName("NumberOfCells"))
+    ->InsertNextValue(numberOfCells);
+  vtkDoubleArray::SafeDownCast(this->Statistics->GetColumnByName("Bounds"))
+    ->InsertNextTypedTuple(bounds);
+  vtkIdTypeArray::SafeDownCast(this->Statistics->GetColumnByName("MemorySize"))
+    ->InsertNextValue(piece ? static_cast<vtkIdType>(piece->GetActualMemorySize()) : 0);
+
+  this->UpdateProgress(static_cast<double>(this->CurrentIndex + 1) / this->NumberOfPasses);
+  return piece ? this->ProcessPiece(piece, pieceNumber) : 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::ProcessPiece(vtkDataObject* piece, int vtkNotUsed(pieceNumber))
+{
+  this->InvokeEvent(vtkCommand::UpdateDataEvent, piece);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::PostExecute(
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  vtkTable* output = vtkTable::GetData(outputVector);
+  output->ShallowCopy(this->Statistics);
+  this->Statistics->Initialize();
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkDataObject");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::FillOutputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkTable");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkPieceStreamer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfPieces: " << this->NumberOfPasses << endl;
+  os << indent << "GhostLevels: " << this->GhostLevels << endl;
+}
+VTK_ABI_NAMESPACE_END
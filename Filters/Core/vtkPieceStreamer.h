@@ -0,0 +1,111 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPieceStreamer.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPieceStreamer
+ * @brief   Stream any input pipeline piece by piece into a reduction
+ *
+ * vtkPieceStreamer updates its input pipeline once per piece, requesting
+ * piece i of NumberOfPieces with UPDATE_PIECE_NUMBER and
+ * UPDATE_NUMBER_OF_PIECES. Unlike vtkPolyDataStreamer, it does not keep the
+ * pieces: each one is handed to ProcessPiece() and dropped when the next
+ * piece is requested, so the memory used by the pipeline is bounded by the
+ * size of one piece whatever the size of the whole dataset. Any data type is
+ * accepted, including composite datasets.
+ *
+ * By default ProcessPiece() invokes vtkCommand::UpdateDataEvent with the
+ * piece as call data, so that an observer can accumulate a reduction
+ * (histogram, integration, ...). Subclasses can override it instead, and
+ * PostExecute() to produce their result.
+ *
+ * The output is a vtkTable with one row per piece holding its piece number,
+ * its numbers of points and cells, its bounds and its memory size in
+ * kibibytes.
+ *
+ * The input pipeline is only divided if its source can produce pieces, as
+ * the XML readers, vtkHDFReader or vtkIOSSReader do. To stream pieces to
+ * disk instead, set the number of pieces of an XML writer.
+ *
+ * @sa
+ * vtkStreamerBase vtkPolyDataStreamer
+ */
+
+#ifndef vtkPieceStreamer_h
+#define vtkPieceStreamer_h
+
+#include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkNew.h"               // For vtkNew
+#include "vtkStreamerBase.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataObject;
+class vtkTable;
+
+class VTKFILTERSCORE_EXPORT vtkPieceStreamer : public vtkStreamerBase
+{
+public:
+  static vtkPieceStreamer* New();
+  vtkTypeMacro(vtkPieceStreamer, vtkStreamerBase);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set the number of pieces the input is divided into. Default is 1.
+   */
+  void SetNumberOfPieces(int num);
+  int GetNumberOfPieces() { return static_cast<int>(this->NumberOfPasses); }
+  ///@}
+
+  ///@{
+  /**
+   * Set the number of ghost levels requested with each piece. Default is 0.
+   */
+  vtkSetClampMacro(GhostLevels, int, 0, VTK_INT_MAX);
+  vtkGetMacro(GhostLevels, int);
+  ///@}
+
+  /**
+   * Get the output table.
+   */
+  vtkTable* GetOutput();
+
+protected:
+  vtkPieceStreamer();
+  ~vtkPieceStreamer() override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int ExecutePass(vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+  int PostExecute(vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * Called once per piece. The piece belongs to the input pipeline and is
+   * only valid during the call. The default implementation invokes
+   * vtkCommand::UpdateDataEvent with the piece as call data.
+   */
+  virtual int ProcessPiece(vtkDataObject* piece, int pieceNumber);
+
+  int GhostLevels = 0;
+
+private:
+  vtkPieceStreamer(const vtkPieceStreamer&) = delete;
+  void operator=(const vtkPieceStreamer&) = delete;
+
+  vtkNew<vtkTable> Statistics;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -17,6 +17,7 @@
 #include "vtkCell.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkConnectivityLabelingInternal.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
@@ -28,6 +29,7 @@
 #include "vtkPolyData.h"
 
 #include <algorithm> // for fill_n
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPolyDataConnectivityFilter);
@@ -59,6 +61,7 @@ vtkPolyDataConnectivityFilter::vtkPolyDataConnectivityFilter()
   this->VisitedPointIds = vtkIdList::New();
 
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+  this->UseParallelLabeling = false;
 }
 
 vtkPolyDataConnectivityFilter::~vtkPolyDataConnectivityFilter()
@@ -130,11 +133,15 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
     }
   }
 
-  // Build cell structure
+  // Build cell structure, the parallel labeling does not need the links
   //
+  const bool parallelLabeling = this->UseParallelLabeling && !this->InScalars;
   this->Mesh = vtkPolyData::New();
   this->Mesh->CopyStructure(input);
-  this->Mesh->BuildLinks();
+  if (!parallelLabeling)
+  {
+    this->Mesh->BuildLinks();
+  }
   this->UpdateProgress(0.10);
 
   // Remove all visited point ids
@@ -186,7 +193,11 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
   vtkIdType checkAbortInterval = 0;
 
-  if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  if (parallelLabeling)
+  {
+    this->LabelRegionsInParallel(largestRegionId);
+  }
+  else if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION)
   { // visit all cells marking with region number
@@ -543,6 +554,69 @@ void vtkPolyDataConnectivityFilter::TraverseAndMark()
   } // while wave is not empty
 }
 
+//------------------------------------------------------------------------------
+// Mark the cells and points the same way as TraverseAndMark(), labeling the
+// regions of all the cells at once with a concurrent union-find. Points are
+// numbered in input order.
+void vtkPolyDataConnectivityFilter::LabelRegionsInParallel(vtkIdType& largestRegionId)
+{
+  ConnectedRegions regions;
+  if (!regions.Label(this->Mesh, this))
+  {
+    return;
+  }
+  this->UpdateProgress(0.5);
+
+  if (this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS ||
+    this->ExtractionMode == VTK_EXTRACT_CELL_SEEDED_REGIONS ||
+    this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION)
+  { // everything connected to the seeds is considered in the same region
+    std::vector<vtkIdType> seedRegionIds;
+    if (this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION)
+    {
+      seedRegionIds.push_back(
+        regions.PointRegionIds[ConnectedRegions::FindClosestPoint(this->Mesh, this->ClosestPoint)]);
+    }
+    else
+    {
+      const std::vector<vtkIdType>& regionIds =
+        this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS ? regions.PointRegionIds
+                                                                 : regions.CellRegionIds;
+      for (vtkIdType i = 0; i < this->Seeds->GetNumberOfIds(); ++i)
+      {
+        const vtkIdType id = this->Seeds->GetId(i);
+        if (id >= 0 && id < static_cast<vtkIdType>(regionIds.size()))
+        {
+          seedRegionIds.push_back(regionIds[id]);
+        }
+      }
+    }
+    regions.KeepSeededRegions(seedRegionIds);
+  }
+  else
+  {
+    vtkIdType maxCellsInRegion = 0;
+    for (size_t regionId = 0; regionId < regions.RegionSizes.size(); ++regionId)
+    {
+      if (regions.RegionSizes[regionId] > maxCellsInRegion)
+      {
+        maxCellsInRegion = regions.RegionSizes[regionId];
+        largestRegionId = static_cast<vtkIdType>(regionId);
+      }
+    }
+    this->RegionNumber = static_cast<vtkIdType>(regions.RegionSizes.size());
+  }
+  for (size_t regionId = 0; regionId < regions.RegionSizes.size(); ++regionId)
+  {
+    this->RegionSizes->InsertValue(static_cast<vtkIdType>(regionId), regions.RegionSizes[regionId]);
+  }
+
+  std::copy(regions.CellRegionIds.begin(), regions.CellRegionIds.end(), this->Visited);
+  this->PointNumber =
+    regions.MapPoints(this->PointMap, vtkArrayDownCast<vtkIdTypeArray>(this->NewScalars));
+  this->UpdateProgress(0.9);
+}
+
 //------------------------------------------------------------------------------
 int vtkPolyDataConnectivityFilter::IsScalarConnected(vtkIdType cellId)
 {
@@ -686,5 +760,6 @@ void vtkPolyDataConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Use Parallel Labeling: " << (this->UseParallelLabeling ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -228,6 +228,21 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off the labeling of regions in parallel. If on, regions are
+   * labeled with a concurrent union-find over the points of the cells instead
+   * of a wave traversal of the cells, which also avoids building the point to
+   * cell links. The extracted cells and their RegionIds are the same, but the
+   * output points keep their input order instead of the traversal order.
+   * Scalar connectivity needs the wave traversal, so this flag is ignored when
+   * ScalarConnectivity is on. Default is off.
+   */
+  vtkSetMacro(UseParallelLabeling, bool);
+  vtkGetMacro(UseParallelLabeling, bool);
+  vtkBooleanMacro(UseParallelLabeling, bool);
+  ///@}
+
 protected:
   vtkPolyDataConnectivityFilter();
   ~vtkPolyDataConnectivityFilter() override;
@@ -253,6 +268,8 @@ protected:
 
   void TraverseAndMark();
 
+  void LabelRegionsInParallel(vtkIdType& largestRegionId);
+
   // used to support algorithm execution
   vtkDataArray* CellScalars;
   vtkIdList* NeighborCellPointIds;
@@ -272,6 +289,7 @@ protected:
 
   vtkTypeBool MarkVisitedPointIds;
   int OutputPointsPrecision;
+  bool UseParallelLabeling;
 
 private:
   vtkPolyDataConnectivityFilter(const vtkPolyDataConnectivityFilter&) = delete;
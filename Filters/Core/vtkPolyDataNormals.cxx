@@ -31,6 +31,8 @@
 #include "vtkSMPTools.h"
 #include "vtkTriangleStrip.h"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 //-----------------------------------------------------------------------------
@@ -59,6 +61,219 @@ vtkPolyDataNormals::vtkPolyDataNormals()
 static constexpr char VTK_CELL_NOT_VISITED = 0;
 static constexpr char VTK_CELL_VISITED = 1;
 
+//-----------------------------------------------------------------------------
+// Find the neighbors of the polygons of a wave that belong to the next wave,
+// and whether their ordering has to be reversed. Waves with enough polygons
+// are processed in parallel: each polygon records its unvisited neighbors,
+// and a neighbor shared by several polygons is claimed by the first one in
+// the wave. This gives the same next wave, in the same order, as the serial
+// traversal.
+struct vtkPolyDataNormals::TraverseAndOrderFunctor
+{
+  // Waves smaller than this are processed serially
+  static constexpr vtkIdType MinimumParallelWaveSize = 1024;
+
+  struct Candidate
+  {
+    vtkIdType WaveIndex; // index in the wave of the polygon adding the neighbor
+    vtkIdType Sequence;  // gives the order of the neighbors of a polygon
+    vtkIdType CellId;
+    bool Reverse;
+  };
+
+  struct LocalData
+  {
+    vtkSmartPointer<vtkIdList> CellPointIds;
+    vtkSmartPointer<vtkIdList> CellIds;
+    vtkSmartPointer<vtkIdList> NeighborPointIds;
+    std::vector<Candidate> Candidates;
+  };
+
+  vtkPolyData* OldMesh;
+  vtkPolyData* NewMesh;
+  std::vector<char>& Visited;
+  bool NonManifoldTraversal;
+  vtkIdList* Wave;
+  // For each polygon, the smallest index in the wave of the polygons adding
+  // it to the next wave. Only allocated when a wave is processed in parallel.
+  std::unique_ptr<std::atomic<vtkIdType>[]> Claims;
+  vtkSMPThreadLocal<LocalData> TLData;
+
+  TraverseAndOrderFunctor(
+    vtkPolyData* oldMesh, vtkPolyData* newMesh, std::vector<char>& visited, bool nonManifold)
+    : OldMesh(oldMesh)
+    , NewMesh(newMesh)
+    , Visited(visited)
+    , NonManifoldTraversal(nonManifold)
+    , Wave(nullptr)
+  {
+  }
+
+  LocalData& GetLocalData()
+  {
+    auto& tlData = this->TLData.Local();
+    if (!tlData.CellIds)
+    {
+      tlData.CellPointIds = vtkSmartPointer<vtkIdList>::New();
+      tlData.CellIds = vtkSmartPointer<vtkIdList>::New();
+      tlData.NeighborPointIds = vtkSmartPointer<vtkIdList>::New();
+    }
+    return tlData;
+  }
+
+  // Call func(neighbor, reverse) for each unvisited edge neighbor of cellId
+  // that the traversal propagates to.
+  template <typename TFunc>
+  void ForEachNeighbor(vtkIdType cellId, LocalData& tlData, TFunc&& func)
+  {
+    const vtkIdType* pts;
+    const vtkIdType* neiPts;
+    vtkIdType npts;
+    vtkIdType numNeiPts;
+    vtkIdList* cellIds = tlData.CellIds;
+
+    this->NewMesh->GetCellPoints(cellId, npts, pts, tlData.CellPointIds);
+
+    for (vtkIdType j = 0, j1 = 1; j < npts; ++j, (j1 = (++j1 < npts) ? j1 : 0))
+    {
+      this->OldMesh->GetCellEdgeNeighbors(cellId, pts[j], pts[j1], cellIds);
+
+      //  Check the direction of the neighbor ordering.  Should be
+      //  consistent with us (i.e., if we are n1->n2, neighbor should be n2->n1).
+      if (cellIds->GetNumberOfIds() == 1 || this->NonManifoldTraversal)
+      {
+        for (vtkIdType k = 0; k < cellIds->GetNumberOfIds(); k++)
+        {
+          const vtkIdType neighbor = cellIds->GetId(k);
+          if (this->Visited[neighbor] == VTK_CELL_NOT_VISITED)
+          {
+            this->NewMesh->GetCellPoints(neighbor, numNeiPts, neiPts, tlData.NeighborPointIds);
+
+            vtkIdType l;
+            for (l = 0; l < numNeiPts; l++)
+            {
+              if (neiPts[l] == pts[j1])
+              {
+                break;
+              }
+            }
+
+            //  Have to reverse ordering if neighbor not consistent
+            func(neighbor, neiPts[(l + 1) % numNeiPts] != pts[j]);
+          }
+        }
+      }
+    }
+  }
+
+  // Process the wave, adding the next wave to wave2. Return the number of
+  // reversed polygons.
+  vtkIdType Execute(vtkIdList* wave, vtkIdList* wave2)
+  {
+    const vtkIdType numIds = wave->GetNumberOfIds();
+    vtkIdType numFlips = 0;
+    if (numIds < MinimumParallelWaveSize)
+    {
+      LocalData& tlData = this->GetLocalData();
+      for (vtkIdType i = 0; i < numIds; i++)
+      {
+        this->ForEachNeighbor(wave->GetId(i), tlData, [&](vtkIdType neighbor, bool reverse) {
+          if (reverse)
+          {
+            numFlips++;
+            this->NewMesh->ReverseCell(neighbor);
+          }
+          this->Visited[neighbor] = VTK_CELL_VISITED;
+          wave2->InsertNextId(neighbor);
+        });
+      }
+      return numFlips;
+    }
+
+    if (!this->Claims)
+    {
+      const vtkIdType numPolys = static_cast<vtkIdType>(this->Visited.size());
+      this->Claims.reset(new std::atomic<vtkIdType>[numPolys]);
+      vtkSMPTools::For(0, numPolys, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType cellId = begin; cellId < end; ++cellId)
+        {
+          this->Claims[cellId].store(VTK_ID_MAX, std::memory_order_relaxed);
+        }
+      });
+    }
+
+    this->Wave = wave;
+    vtkSMPTools::For(0, numIds, *this);
+
+    // Keep the neighbors added by the first polygon of the wave using them,
+    // in the order of the serial traversal.
+    std::vector<Candidate> next;
+    for (auto& tlData : this->TLData)
+    {
+      for (const Candidate& candidate : tlData.Candidates)
+      {
+        if (this->Claims[candidate.CellId].load(std::memory_order_relaxed) == candidate.WaveIndex)
+        {
+          next.push_back(candidate);
+          numFlips += candidate.Reverse ? 1 : 0;
+        }
+      }
+      tlData.Candidates.clear();
+    }
+    vtkSMPTools::Sort(next.begin(), next.end(), [](const Candidate& a, const Candidate& b) {
+      return a.WaveIndex < b.WaveIndex || (a.WaveIndex == b.WaveIndex && a.Sequence < b.Sequence);
+    });
+
+    const vtkIdType numNext = static_cast<vtkIdType>(next.size());
+    wave2->SetNumberOfIds(numNext);
+    vtkSMPTools::For(0, numNext, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const Candidate& candidate = next[i];
+        if (candidate.Reverse)
+        {
+          this->NewMesh->ReverseCell(candidate.CellId);
+        }
+        this->Visited[candidate.CellId] = VTK_CELL_VISITED;
+        this->Claims[candidate.CellId].store(VTK_ID_MAX, std::memory_order_relaxed);
+        wave2->SetId(i, candidate.CellId);
+      }
+    });
+    return numFlips;
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    LocalData& tlData = this->GetLocalData();
+    std::vector<Candidate>& candidates = tlData.Candidates;
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      const size_t first = candidates.size();
+      this->ForEachNeighbor(this->Wave->GetId(i), tlData, [&](vtkIdType neighbor, bool reverse) {
+        // a neighbor across several edges is only added once
+        for (size_t c = first; c < candidates.size(); ++c)
+        {
+          if (candidates[c].CellId == neighbor)
+          {
+            return;
+          }
+        }
+        candidates.push_back(
+          Candidate{ i, static_cast<vtkIdType>(candidates.size()), neighbor, reverse });
+        std::atomic<vtkIdType>& claim = this->Claims[neighbor];
+        vtkIdType current = claim.load(std::memory_order_relaxed);
+        while (i < current && !claim.compare_exchange_weak(current, i, std::memory_order_relaxed))
+        {
+        }
+      });
+    }
+  }
+
+  void Reduce() {}
+};
+
 //-----------------------------------------------------------------------------
 // Generate normals for polygon meshes
 int vtkPolyDataNormals::RequestData(vtkInformation* vtkNotUsed(request),
@@ -199,12 +414,11 @@ int vtkPolyDataNormals::RequestData(vtkInformation* vtkNotUsed(request),
     // The visited array keeps track of which polygons have been visited.
     std::vector<char> visited;
     visited.resize(numPolys, VTK_CELL_NOT_VISITED);
-    vtkNew<vtkIdList> wave, wave2, cellPointIds, cellIds, neighborPointIds;
+    vtkNew<vtkIdList> wave, wave2;
     wave->Allocate(numPolys / 4 + 1, numPolys);
     wave2->Allocate(numPolys / 4 + 1, numPolys);
-    cellPointIds->Allocate(VTK_CELL_SIZE);
-    cellIds->Allocate(VTK_CELL_SIZE);
-    neighborPointIds->Allocate(VTK_CELL_SIZE);
+    TraverseAndOrderFunctor traversal(
+      oldMesh, newMesh, visited, this->NonManifoldTraversal != 0);
 
     if (this->AutoOrientNormals)
     {
@@ -297,8 +511,7 @@ int vtkPolyDataNormals::RequestData(vtkInformation* vtkNotUsed(request),
           }
           wave->InsertNextId(leftmostCellID);
           visited[leftmostCellID] = VTK_CELL_VISITED;
-          this->TraverseAndOrder(oldMesh, newMesh, wave, wave2, cellPointIds, cellIds,
-            neighborPointIds, visited, this->NumFlips);
+          this->TraverseAndOrder(traversal, wave, wave2, this->NumFlips);
           wave->Reset();
           wave2->Reset();
         } // if found leftmost cell
@@ -323,8 +536,7 @@ int vtkPolyDataNormals::RequestData(vtkInformation* vtkNotUsed(request),
           }
           wave->InsertNextId(cellId);
           visited[cellId] = VTK_CELL_VISITED;
-          this->TraverseAndOrder(oldMesh, newMesh, wave, wave2, cellPointIds, cellIds,
-            neighborPointIds, visited, this->NumFlips);
+          this->TraverseAndOrder(traversal, wave, wave2, this->NumFlips);
         }
         wave->Reset();
         wave2->Reset();
@@ -598,64 +810,13 @@ int vtkPolyDataNormals::RequestData(vtkInformation* vtkNotUsed(request),
 
 //-----------------------------------------------------------------------------
 //  Propagate wave of consistently ordered polygons.
-void vtkPolyDataNormals::TraverseAndOrder(vtkPolyData* oldMesh, vtkPolyData* newMesh,
-  vtkIdList* wave, vtkIdList* wave2, vtkIdList* cellPointIds, vtkIdList* cellIds,
-  vtkIdList* neighborPointIds, std::vector<char>& visited, vtkIdType& numFlips)
+void vtkPolyDataNormals::TraverseAndOrder(
+  TraverseAndOrderFunctor& traversal, vtkIdList* wave, vtkIdList* wave2, vtkIdType& numFlips)
 {
-  vtkIdType i, k;
-  int j, l, j1;
-  vtkIdType numIds, cellId;
-  const vtkIdType* pts;
-  const vtkIdType* neiPts;
-  vtkIdType npts;
-  vtkIdType numNeiPts;
-  vtkIdType neighbor;
-
   // propagate wave until nothing left in wave
-  while ((numIds = wave->GetNumberOfIds()) > 0)
+  while (wave->GetNumberOfIds() > 0)
   {
-    for (i = 0; i < numIds; i++)
-    {
-      cellId = wave->GetId(i);
-
-      newMesh->GetCellPoints(cellId, npts, pts, cellPointIds);
-
-      for (j = 0, j1 = 1; j < npts; ++j, (j1 = (++j1 < npts) ? j1 : 0)) // for each edge neighbor
-      {
-        oldMesh->GetCellEdgeNeighbors(cellId, pts[j], pts[j1], cellIds);
-
-        //  Check the direction of the neighbor ordering.  Should be
-        //  consistent with us (i.e., if we are n1->n2, neighbor should be n2->n1).
-        if (cellIds->GetNumberOfIds() == 1 || this->NonManifoldTraversal)
-        {
-          for (k = 0; k < cellIds->GetNumberOfIds(); k++)
-          {
-            neighbor = cellIds->GetId(k);
-            if (visited[neighbor] == VTK_CELL_NOT_VISITED)
-            {
-              newMesh->GetCellPoints(neighbor, numNeiPts, neiPts, neighborPointIds);
-
-              for (l = 0; l < numNeiPts; l++)
-              {
-                if (neiPts[l] == pts[j1])
-                {
-                  break;
-                }
-              }
-
-              //  Have to reverse ordering if neighbor not consistent
-              if (neiPts[(l + 1) % numNeiPts] != pts[j])
-              {
-                numFlips++;
-                newMesh->ReverseCell(neighbor);
-              }
-              visited[neighbor] = VTK_CELL_VISITED;
-              wave2->InsertNextId(neighbor);
-            } // if cell not visited
-          }   // for each edge neighbor
-        }     // for manifold or non-manifold traversal allowed
-      }       // for all edges of this polygon
-    }         // for all cells in wave
+    numFlips += traversal.Execute(wave, wave2);
 
     // swap wave and proceed with propagation
     std::swap(wave, wave2);
@@ -201,12 +201,12 @@ private:
   double CosAngle;
 
   struct MarkAndSplitFunctor;
+  struct TraverseAndOrderFunctor;
 
-  // Uses the list of cell ids (this->Wave) to propagate a wave of
-  // checked and properly ordered polygons.
-  void TraverseAndOrder(vtkPolyData* oldMesh, vtkPolyData* newMesh, vtkIdList* wave,
-    vtkIdList* wave2, vtkIdList* cellPointIds, vtkIdList* cellIds, vtkIdList* neighborPointIds,
-    std::vector<char>& visited, vtkIdType& numFlips);
+  // Uses the list of cell ids (wave) to propagate a wave of checked and
+  // properly ordered polygons. Large waves are processed in parallel.
+  void TraverseAndOrder(
+    TraverseAndOrderFunctor& traversal, vtkIdList* wave, vtkIdList* wave2, vtkIdType& numFlips);
 
   // check all the points whether they lie on a feature
   // edge. If so, split the point (i.e., duplicate it) to topologically
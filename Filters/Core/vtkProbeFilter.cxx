@@ -23,6 +23,8 @@
 #include "vtkClosestPointStrategy.h"
 #include "vtkFindCellStrategy.h"
 #include "vtkGenericCell.h"
+#include "vtkHexahedron.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
@@ -37,7 +39,9 @@
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTetra.h"
 #include "vtkUnstructuredGrid.h"
+#include "vtkWedge.h"
 
 #include <algorithm>
 #include <vector>
@@ -50,6 +54,8 @@ vtkCxxSetObjectMacro(vtkProbeFilter, FindCellStrategy, vtkFindCellStrategy);
 namespace
 {
 constexpr double CELL_TOLERANCE_FACTOR_SQR = 1e-6;
+// Number of points evaluated at once in the linear 3D cells
+constexpr int BATCH_SIZE = 64;
 
 constexpr unsigned char CELL_GHOST_MASK =
   vtkDataSetAttributes::HIDDENCELL | vtkDataSetAttributes::DUPLICATECELL;
@@ -63,8 +69,86 @@ inline bool IsBlankedCell(vtkUnsignedCharArray* gcells, vtkIdType cellId)
   }
   return false;
 }
+
+// Modification time of the source mesh, including its ghost cells which
+// discard some of the probed cells.
+vtkMTimeType GetSourceMeshMTime(vtkDataSet* source)
+{
+  vtkMTimeType time = source->GetMeshMTime();
+  vtkDataArray* ghosts = source->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName());
+  if (ghosts)
+  {
+    time = std::max(time, ghosts->GetMTime());
+  }
+  return time;
+}
 }
 
+//------------------------------------------------------------------------------
+// Source cell and interpolation weights found for each input point, stored
+// with a fixed stride of MaxCellSize. CellIds is -1 for the points that were
+// not probed with success.
+class vtkProbeFilter::ProbePlan
+{
+public:
+  vtkMTimeType InputTime = 0;
+  vtkMTimeType SourceTime = 0;
+  vtkMTimeType FilterTime = 0;
+  vtkIdType NumberOfPoints = 0;
+  vtkIdType NumberOfSourceCells = 0;
+  bool Recording = false;
+  bool Complete = false;
+
+  int MaxCellSize = 0;
+  std::vector<vtkIdType> CellIds;
+  std::vector<int> Sizes;
+  std::vector<vtkIdType> PointIds;
+  std::vector<double> Weights;
+
+  void Initialize(vtkProbeFilter* filter, vtkDataSet* input, vtkDataSet* source)
+  {
+    this->InputTime = input->GetMeshMTime();
+    this->SourceTime = ::GetSourceMeshMTime(source);
+    this->FilterTime = filter->GetMTime();
+    this->NumberOfPoints = input->GetNumberOfPoints();
+    this->NumberOfSourceCells = source->GetNumberOfCells();
+    this->Complete = false;
+    this->MaxCellSize = 0;
+    this->CellIds.clear();
+    this->Sizes.clear();
+    this->PointIds.clear();
+    this->Weights.clear();
+  }
+
+  bool IsValid(vtkProbeFilter* filter, vtkDataSet* input, vtkDataSet* source)
+  {
+    return this->Complete && this->InputTime == input->GetMeshMTime() &&
+      this->SourceTime == ::GetSourceMeshMTime(source) && this->FilterTime == filter->GetMTime() &&
+      this->NumberOfPoints == input->GetNumberOfPoints() &&
+      this->NumberOfSourceCells == source->GetNumberOfCells();
+  }
+
+  void Allocate(int maxCellSize)
+  {
+    const size_t numPts = static_cast<size_t>(this->NumberOfPoints);
+    this->MaxCellSize = maxCellSize;
+    this->CellIds.assign(numPts, -1);
+    this->Sizes.assign(numPts, 0);
+    this->PointIds.resize(numPts * maxCellSize);
+    this->Weights.resize(numPts * maxCellSize);
+  }
+
+  void Record(vtkIdType pointId, vtkIdType cellId, vtkIdList* ids, const double* weights)
+  {
+    const size_t offset = static_cast<size_t>(pointId) * this->MaxCellSize;
+    const vtkIdType numIds = ids->GetNumberOfIds();
+    this->CellIds[pointId] = cellId;
+    this->Sizes[pointId] = static_cast<int>(numIds);
+    std::copy_n(ids->GetPointer(0), numIds, this->PointIds.data() + offset);
+    std::copy_n(weights, numIds, this->Weights.data() + offset);
+  }
+};
+
 //------------------------------------------------------------------------------
 vtkProbeFilter::vtkProbeFilter()
 {
@@ -88,6 +172,8 @@ vtkProbeFilter::vtkProbeFilter()
   this->Tolerance = 1.0;
   this->ComputeTolerance = true;
   this->SnapToCellWithClosestPoint = false;
+  this->CacheProbePlan = false;
+  this->Plan = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -105,6 +191,7 @@ vtkProbeFilter::~vtkProbeFilter()
 
   delete this->PointList;
   delete this->CellList;
+  delete this->Plan;
 }
 
 //------------------------------------------------------------------------------
@@ -399,7 +486,86 @@ void vtkProbeFilter::Probe(vtkDataSet* input, vtkDataSet* source, vtkDataSet* ou
   this->BuildFieldList(source);
   this->InitializeForProbing(input, output);
   this->InitializeSourceArrays(source);
+
+  if (!this->CacheProbePlan)
+  {
+    delete this->Plan;
+    this->Plan = nullptr;
+    this->DoProbing(input, 0, source, output);
+    return;
+  }
+
+  if (this->Plan && this->Plan->IsValid(this, input, source))
+  {
+    this->ProbeWithPlan(source, output);
+    return;
+  }
+
+  // The plan is recorded by ProbeEmptyPoints(), the other probing methods
+  // leave it incomplete.
+  if (!this->Plan)
+  {
+    this->Plan = new ProbePlan;
+  }
+  this->Plan->Initialize(this, input, source);
+  this->Plan->Recording = true;
   this->DoProbing(input, 0, source, output);
+  this->Plan->Recording = false;
+}
+
+//------------------------------------------------------------------------------
+void vtkProbeFilter::ProbeWithPlan(vtkDataSet* source, vtkDataSet* output)
+{
+  vtkDebugMacro(<< "Probing data with the cached plan");
+
+  ProbePlan* plan = this->Plan;
+  vtkPointData* sourcePD = source->GetPointData();
+  vtkPointData* outPD = output->GetPointData();
+  char* maskArray = this->MaskPoints->GetPointer(0);
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+
+  vtkSMPTools::For(0, plan->NumberOfPoints, [&](vtkIdType beginPointId, vtkIdType endPointId) {
+    vtkIdList* ids = tlIds.Local();
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType checkAbortInterval = std::min((endPointId - beginPointId) / 10 + 1, (vtkIdType)1000);
+
+    for (vtkIdType pointId = beginPointId; pointId < endPointId; ++pointId)
+    {
+      if (pointId % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+      }
+
+      const vtkIdType cellId = plan->CellIds[pointId];
+      if (cellId < 0)
+      {
+        continue;
+      }
+      const size_t offset = static_cast<size_t>(pointId) * plan->MaxCellSize;
+      const int numIds = plan->Sizes[pointId];
+      ids->SetNumberOfIds(numIds);
+      std::copy_n(plan->PointIds.data() + offset, numIds, ids->GetPointer(0));
+      outPD->InterpolatePoint(
+        *this->PointList, sourcePD, 0, pointId, ids, plan->Weights.data() + offset);
+      for (size_t i = 0, numArrays = this->InputCellArrays.size(); i < numArrays; ++i)
+      {
+        if (vtkDataArray* sourceArray = this->SourceCellArrays[i])
+        {
+          this->InputCellArrays[i]->SetTuple(pointId, cellId, sourceArray);
+        }
+      }
+      maskArray[pointId] = static_cast<char>(1);
+    }
+  });
+
+  this->MaskPoints->Modified();
 }
 
 //------------------------------------------------------------------------------
@@ -417,6 +583,7 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
   vtkCharArray* MaskArray;
   double Tol2;
   int MaxCellSize;
+  ProbePlan* Plan;
 
   struct LocalData
   {
@@ -438,7 +605,8 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
 public:
   ProbeEmptyPointsWorklet(vtkProbeFilter* probeFilter, int sourceIndex, vtkDataSet* input,
     vtkDataSet* source, vtkPointData* outputPD, vtkFindCellStrategy* strategy,
-    vtkUnsignedCharArray* sourceGhostFlags, vtkCharArray* maskArray, double tol2, int maxCellSize)
+    vtkUnsignedCharArray* sourceGhostFlags, vtkCharArray* maskArray, double tol2, int maxCellSize,
+    ProbePlan* plan)
     : ProbeFilter(probeFilter)
     , SourceIdx(sourceIndex)
     , Input(input)
@@ -451,6 +619,7 @@ public:
     , MaskArray(maskArray)
     , Tol2(tol2)
     , MaxCellSize(maxCellSize)
+    , Plan(plan)
   {
     // instantiate the cell map for polydata
     vtkNew<vtkGenericCell> cell;
@@ -658,6 +827,10 @@ public:
           }
         }
         maskArray[pointId] = static_cast<char>(1);
+        if (this->Plan)
+        {
+          this->Plan->Record(pointId, lastCellId, currentCell->PointIds, weights);
+        }
       }
     }
   }
@@ -759,10 +932,20 @@ void vtkProbeFilter::ProbeEmptyPoints(
     }
   }
 
+  ProbePlan* plan = this->Plan && this->Plan->Recording ? this->Plan : nullptr;
+  if (plan)
+  {
+    plan->Allocate(maxCellSize);
+  }
+
   ProbeEmptyPointsWorklet worker(this, srcIdx, input, source, outPD, strategy, sourceGhostFlags,
-    this->MaskPoints, tol2, maxCellSize);
+    this->MaskPoints, tol2, maxCellSize, plan);
   vtkSMPTools::For(0, input->GetNumberOfPoints(), worker);
 
+  if (plan)
+  {
+    plan->Complete = !this->GetAbortOutput();
+  }
   this->MaskPoints->Modified();
 }
 
@@ -838,6 +1021,93 @@ void vtkProbeFilter::ProbeImagePointsInCell(vtkGenericCell* cell, vtkIdType cell
   {
     tol2 = this->Tolerance * this->Tolerance;
   }
+  auto probePoint = [&](vtkIdType ptId, double* weights) {
+    // Interpolate the point data
+    outPD->InterpolatePoint(*this->PointList, pd, srcBlockId, ptId, cell->PointIds, weights);
+
+    // Assign cell data
+    for (size_t i = 0, numArrays = this->InputCellArrays.size(); i < numArrays; ++i)
+    {
+      auto inputArray = this->InputCellArrays[i];
+      auto sourceArray = this->SourceCellArrays[i];
+      if (sourceArray)
+      {
+        inputArray->SetTuple(ptId, cellId, sourceArray);
+      }
+    }
+
+    maskArray[ptId] = static_cast<char>(1);
+  };
+
+  // The linear 3D cells evaluate batches of points at once, without virtual
+  // calls. The distance to the cell is 0 inside them.
+  const int cellType = cell->GetCellType();
+  if (cellType == VTK_TETRA || cellType == VTK_HEXAHEDRON || cellType == VTK_WEDGE)
+  {
+    const int numCellPts = static_cast<int>(cell->GetNumberOfPoints());
+    double xBuf[3][BATCH_SIZE], pcoordsBuf[3][BATCH_SIZE], weights[8 * BATCH_SIZE];
+    int inside[BATCH_SIZE];
+    vtkIdType ptIds[BATCH_SIZE];
+    const double* const x[3] = { xBuf[0], xBuf[1], xBuf[2] };
+    double* const pcoords[3] = { pcoordsBuf[0], pcoordsBuf[1], pcoordsBuf[2] };
+    vtkIdType numBatched = 0;
+    auto evaluateBatch = [&]() {
+      vtkCell* representative = cell->GetRepresentativeCell();
+      if (cellType == VTK_TETRA)
+      {
+        static_cast<vtkTetra*>(representative)
+          ->EvaluatePositions(numBatched, x, pcoords, weights, inside);
+      }
+      else if (cellType == VTK_HEXAHEDRON)
+      {
+        static_cast<vtkHexahedron*>(representative)
+          ->EvaluatePositions(numBatched, x, pcoords, weights, inside);
+      }
+      else
+      {
+        static_cast<vtkWedge*>(representative)
+          ->EvaluatePositions(numBatched, x, pcoords, weights, inside);
+      }
+      for (vtkIdType i = 0; i < numBatched; ++i)
+      {
+        if (inside[i] == 1)
+        {
+          probePoint(ptIds[i], weights + numCellPts * i);
+        }
+      }
+      numBatched = 0;
+    };
+
+    for (int iz = idxBounds[4]; iz <= idxBounds[5]; iz++)
+    {
+      for (int iy = idxBounds[2]; iy <= idxBounds[3]; iy++)
+      {
+        for (int ix = idxBounds[0]; ix <= idxBounds[1]; ix++)
+        {
+          // skip processed points
+          const vtkIdType ptId = ix + dim[0] * (iy + dim[1] * iz);
+          if (maskArray[ptId] == 1)
+          {
+            continue;
+          }
+          ptIds[numBatched] = ptId;
+          xBuf[0][numBatched] = start[0] + ix * spacing[0];
+          xBuf[1][numBatched] = start[1] + iy * spacing[1];
+          xBuf[2][numBatched] = start[2] + iz * spacing[2];
+          if (++numBatched == BATCH_SIZE)
+          {
+            evaluateBatch();
+          }
+        }
+      }
+    }
+    if (numBatched > 0)
+    {
+      evaluateBatch();
+    }
+    return;
+  }
+
   for (int iz = idxBounds[4]; iz <= idxBounds[5]; iz++)
   {
     double p[3];
@@ -862,21 +1132,7 @@ void vtkProbeFilter::ProbeImagePointsInCell(vtkGenericCell* cell, vtkIdType cell
 
         if (inside == 1 && dist2 <= tol2)
         {
-          // Interpolate the point data
-          outPD->InterpolatePoint(*this->PointList, pd, srcBlockId, ptId, cell->PointIds, wtsBuff);
-
-          // Assign cell data
-          for (size_t i = 0, numArrays = this->InputCellArrays.size(); i < numArrays; ++i)
-          {
-            auto inputArray = this->InputCellArrays[i];
-            auto sourceArray = this->SourceCellArrays[i];
-            if (sourceArray)
-            {
-              inputArray->SetTuple(ptId, cellId, sourceArray);
-            }
-          }
-
-          maskArray[ptId] = static_cast<char>(1);
+          probePoint(ptId, wtsBuff);
         }
       }
     }
@@ -1292,5 +1548,6 @@ void vtkProbeFilter::PrintSelf(ostream& os, vtkIndent indent)
      << (this->FindCellStrategy ? this->FindCellStrategy->GetClassName() : "NULL") << "\n";
   os << indent << "CellLocatorPrototype: "
      << (this->CellLocatorPrototype ? this->CellLocatorPrototype->GetClassName() : "NULL") << "\n";
+  os << indent << "CacheProbePlan: " << (this->CacheProbePlan ? "On" : "Off") << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -239,6 +239,26 @@ public:
   vtkGetObjectMacro(CellLocatorPrototype, vtkAbstractCellLocator);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether to cache the probe plan, i.e. the source cell and the
+   * interpolation weights found for each input point. The plan is reused as
+   * long as the meshes of the input and the source, and the parameters of
+   * this filter, are not modified, so that the next executions only
+   * interpolate the source attributes. This is useful to probe transient
+   * data at fixed locations.
+   *
+   * Default is off.
+   *
+   * Note: the plan is not used when the input or the source is a
+   * vtkImageData, which are probed with faster dedicated paths, nor by
+   * vtkCompositeDataProbeFilter for composite sources.
+   */
+  vtkSetMacro(CacheProbePlan, bool);
+  vtkBooleanMacro(CacheProbePlan, bool);
+  vtkGetMacro(CacheProbePlan, bool);
+  ///@}
+
 protected:
   vtkProbeFilter();
   ~vtkProbeFilter() override;
@@ -288,6 +308,7 @@ protected:
   double Tolerance;
   bool ComputeTolerance;
   bool SnapToCellWithClosestPoint;
+  bool CacheProbePlan;
 
   char* ValidPointMaskArrayName;
   vtkIdTypeArray* ValidPoints;
@@ -328,6 +349,12 @@ private:
 
   class ProbeEmptyPointsWorklet;
 
+  // Interpolate the source attributes with the cached probe plan.
+  void ProbeWithPlan(vtkDataSet* source, vtkDataSet* output);
+
+  class ProbePlan;
+  ProbePlan* Plan;
+
   std::vector<vtkDataArray*> InputCellArrays;
   std::vector<vtkDataArray*> SourceCellArrays;
 };
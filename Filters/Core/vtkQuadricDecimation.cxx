@@ -49,12 +49,19 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPriorityQueue.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkQuadricDecimation);
 
@@ -284,6 +291,7 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   }
   this->Mesh->GetFieldData()->PassData(input->GetFieldData());
   this->Mesh->BuildCells();
+  this->Mesh->EditableOn();
   this->Mesh->BuildLinks();
 
   this->ErrorQuadrics = new vtkQuadricDecimation::ErrorQuadric[numPts];
@@ -348,28 +356,31 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   this->UpdateProgress(0.15);
 
   vtkDebugMacro(<< "Computing Costs");
-  // Compute the cost of and target point for collapsing each edge.
-  for (i = 0; i < this->Edges->GetNumberOfEdges(); i++)
+  // Compute the cost of and target point for collapsing each edge. The edges
+  // are independent from each other so this is done in parallel; the costs
+  // are then queued in edge order to keep the collapse sequence unchanged.
+  const vtkIdType numEdges = this->Edges->GetNumberOfEdges();
+  std::vector<double> costs(numEdges);
+  this->TargetPoints->SetNumberOfTuples(numEdges);
+  this->ComputeCosts(numEdges, nullptr, costs.data());
+  for (i = 0; i < numEdges; i++)
   {
-    if (this->AttributeErrorMetric)
-    {
-      cost = this->ComputeCost2(i, x);
-    }
-    else
-    {
-      cost = this->ComputeCost(i, x);
-    }
-    this->EdgeCosts->Insert(cost, i);
-    this->TargetPoints->InsertTuple(i, x);
+    this->EdgeCosts->Insert(costs[i], i);
   }
   this->UpdateProgress(0.20);
 
   // Okay collapse edges until desired reduction is reached
   this->ActualReduction = 0.0;
   this->NumberOfEdgeCollapses = 0;
+  bool abort = false;
+  if (this->BatchedCollapse)
+  {
+    // the loop below then stops right away: the target is reached or no
+    // edge can be collapsed anymore
+    abort = !this->CollapseEdgeBatches(numTris, numDeletedTris);
+  }
   edgeId = this->EdgeCosts->Pop(0, cost);
 
-  bool abort = false;
   while (
     !abort && edgeId >= 0 && cost < VTK_DOUBLE_MAX && this->ActualReduction < this->TargetReduction)
   {
@@ -471,22 +482,7 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
 void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
 {
   vtkPolyData* input = this->Mesh;
-  double* QEM;
-  vtkIdType ptId;
-  int i, j;
-  vtkCellArray* polys;
-  vtkIdType npts;
-  const vtkIdType* pts = nullptr;
-  double point0[3], point1[3], point2[3];
-  double n[3];
-  double tempP1[3], tempP2[3], d, triArea2;
-  double data[16];
-  double *A[4], x[4];
-  int index[4];
-  A[0] = data;
-  A[1] = data + 4;
-  A[2] = data + 8;
-  A[3] = data + 12;
+  const int quadricSize = 11 + 4 * this->NumberOfComponents;
 
   double regularizationVariance = 0.0;
   if (this->Regularize)
@@ -494,23 +490,21 @@ void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
     regularizationVariance = std::pow(this->Regularization, 2);
   }
 
-  // allocate local QEM sparse matrix
-  QEM = new double[11 + 4 * this->NumberOfComponents];
-
-  // clear and allocate global QEM array
-  for (ptId = 0; ptId < numPts; ptId++)
-  {
-    this->ErrorQuadrics[ptId].Quadric = new double[11 + 4 * this->NumberOfComponents];
-    for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
-    {
-      this->ErrorQuadrics[ptId].Quadric[i] = 0.0;
-    }
-  }
+  // Compute the QEM of the face pts, together with its unit normal n, plane
+  // offset d and area. Returns false if the attribute matrix is singular.
+  auto computeFaceQuadric = [&](const vtkIdType* pts, double* QEM, double n[3], double& d,
+                              double& triArea2) -> bool {
+    int i;
+    double point0[3], point1[3], point2[3];
+    double tempP1[3], tempP2[3];
+    double data[16];
+    double *A[4], x[4];
+    int index[4];
+    A[0] = data;
+    A[1] = data + 4;
+    A[2] = data + 8;
+    A[3] = data + 12;
 
-  polys = input->GetPolys();
-  // compute the QEM for each face
-  for (polys->InitTraversal(); polys->GetNextCell(npts, pts);)
-  {
     input->GetPoint(pts[0], point0);
     input->GetPoint(pts[1], point1);
     input->GetPoint(pts[2], point2);
@@ -560,243 +554,315 @@ void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
         regularizationVariance * (vtkMath::Dot(point0, point0) + 1 + 3 * regularizationVariance);
     }
 
-    if (this->AttributeErrorMetric)
+    if (!this->AttributeErrorMetric)
     {
-      for (i = 0; i < 3; i++)
+      return true;
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+      A[0][i] = point0[i];
+      A[1][i] = point1[i];
+      A[2][i] = point2[i];
+      A[3][i] = n[i];
+    }
+    A[0][3] = A[1][3] = A[2][3] = 1;
+    A[3][3] = 0;
+
+    // should handle poorly condition matrix better
+    if (!vtkMath::LUFactorLinearSystem(A, index, 4))
+    {
+      // do not let the attribute part of a previous face leak into this one
+      std::fill(QEM + 11, QEM + quadricSize, 0.0);
+      return false;
+    }
+
+    for (i = 0; i < this->NumberOfComponents; i++)
+    {
+      x[3] = 0;
+      if (i < this->AttributeComponents[0])
       {
-        A[0][i] = point0[i];
-        A[1][i] = point1[i];
-        A[2][i] = point2[i];
-        A[3][i] = n[i];
+        x[0] = input->GetPointData()->GetScalars()->GetComponent(pts[0], i) *
+          this->AttributeScale[0];
+        x[1] = input->GetPointData()->GetScalars()->GetComponent(pts[1], i) *
+          this->AttributeScale[0];
+        x[2] = input->GetPointData()->GetScalars()->GetComponent(pts[2], i) *
+          this->AttributeScale[0];
       }
-      A[0][3] = A[1][3] = A[2][3] = 1;
-      A[3][3] = 0;
-
-      // should handle poorly condition matrix better
-      if (vtkMath::LUFactorLinearSystem(A, index, 4))
+      else if (i < this->AttributeComponents[1])
       {
-        for (i = 0; i < this->NumberOfComponents; i++)
-        {
-          x[3] = 0;
-          if (i < this->AttributeComponents[0])
-          {
-            x[0] = input->GetPointData()->GetScalars()->GetComponent(pts[0], i) *
-              this->AttributeScale[0];
-            x[1] = input->GetPointData()->GetScalars()->GetComponent(pts[1], i) *
-              this->AttributeScale[0];
-            x[2] = input->GetPointData()->GetScalars()->GetComponent(pts[2], i) *
-              this->AttributeScale[0];
-          }
-          else if (i < this->AttributeComponents[1])
-          {
-            x[0] = input->GetPointData()->GetVectors()->GetComponent(
-                     pts[0], i - this->AttributeComponents[0]) *
-              this->AttributeScale[1];
-            x[1] = input->GetPointData()->GetVectors()->GetComponent(
-                     pts[1], i - this->AttributeComponents[0]) *
-              this->AttributeScale[1];
-            x[2] = input->GetPointData()->GetVectors()->GetComponent(
-                     pts[2], i - this->AttributeComponents[0]) *
-              this->AttributeScale[1];
-          }
-          else if (i < this->AttributeComponents[2])
-          {
-            x[0] = input->GetPointData()->GetNormals()->GetComponent(
-                     pts[0], i - this->AttributeComponents[1]) *
-              this->AttributeScale[2];
-            x[1] = input->GetPointData()->GetNormals()->GetComponent(
-                     pts[1], i - this->AttributeComponents[1]) *
-              this->AttributeScale[2];
-            x[2] = input->GetPointData()->GetNormals()->GetComponent(
-                     pts[2], i - this->AttributeComponents[1]) *
-              this->AttributeScale[2];
-          }
-          else if (i < this->AttributeComponents[3])
-          {
-            x[0] = input->GetPointData()->GetTCoords()->GetComponent(
-                     pts[0], i - this->AttributeComponents[2]) *
-              this->AttributeScale[3];
-            x[1] = input->GetPointData()->GetTCoords()->GetComponent(
-                     pts[1], i - this->AttributeComponents[2]) *
-              this->AttributeScale[3];
-            x[2] = input->GetPointData()->GetTCoords()->GetComponent(
-                     pts[2], i - this->AttributeComponents[2]) *
-              this->AttributeScale[3];
-          }
-          else if (i < this->AttributeComponents[4])
-          {
-            x[0] = input->GetPointData()->GetTensors()->GetComponent(
-                     pts[0], i - this->AttributeComponents[3]) *
-              this->AttributeScale[4];
-            x[1] = input->GetPointData()->GetTensors()->GetComponent(
-                     pts[1], i - this->AttributeComponents[3]) *
-              this->AttributeScale[4];
-            x[2] = input->GetPointData()->GetTensors()->GetComponent(
-                     pts[2], i - this->AttributeComponents[3]) *
-              this->AttributeScale[4];
-          }
-          vtkMath::LUSolveLinearSystem(A, index, x, 4);
+        x[0] = input->GetPointData()->GetVectors()->GetComponent(
+                 pts[0], i - this->AttributeComponents[0]) *
+          this->AttributeScale[1];
+        x[1] = input->GetPointData()->GetVectors()->GetComponent(
+                 pts[1], i - this->AttributeComponents[0]) *
+          this->AttributeScale[1];
+        x[2] = input->GetPointData()->GetVectors()->GetComponent(
+                 pts[2], i - this->AttributeComponents[0]) *
+          this->AttributeScale[1];
+      }
+      else if (i < this->AttributeComponents[2])
+      {
+        x[0] = input->GetPointData()->GetNormals()->GetComponent(
+                 pts[0], i - this->AttributeComponents[1]) *
+          this->AttributeScale[2];
+        x[1] = input->GetPointData()->GetNormals()->GetComponent(
+                 pts[1], i - this->AttributeComponents[1]) *
+          this->AttributeScale[2];
+        x[2] = input->GetPointData()->GetNormals()->GetComponent(
+                 pts[2], i - this->AttributeComponents[1]) *
+          this->AttributeScale[2];
+      }
+      else if (i < this->AttributeComponents[3])
+      {
+        x[0] = input->GetPointData()->GetTCoords()->GetComponent(
+                 pts[0], i - this->AttributeComponents[2]) *
+          this->AttributeScale[3];
+        x[1] = input->GetPointData()->GetTCoords()->GetComponent(
+                 pts[1], i - this->AttributeComponents[2]) *
+          this->AttributeScale[3];
+        x[2] = input->GetPointData()->GetTCoords()->GetComponent(
+                 pts[2], i - this->AttributeComponents[2]) *
+          this->AttributeScale[3];
+      }
+      else if (i < this->AttributeComponents[4])
+      {
+        x[0] = input->GetPointData()->GetTensors()->GetComponent(
+                 pts[0], i - this->AttributeComponents[3]) *
+          this->AttributeScale[4];
+        x[1] = input->GetPointData()->GetTensors()->GetComponent(
+                 pts[1], i - this->AttributeComponents[3]) *
+          this->AttributeScale[4];
+        x[2] = input->GetPointData()->GetTensors()->GetComponent(
+                 pts[2], i - this->AttributeComponents[3]) *
+          this->AttributeScale[4];
+      }
+      vtkMath::LUSolveLinearSystem(A, index, x, 4);
 
-          // add in the contribution of this element into the QEM
-          QEM[0] += x[0] * x[0];
-          QEM[1] += x[0] * x[1];
-          QEM[2] += x[0] * x[2];
-          QEM[3] += x[3] * x[0];
+      // add in the contribution of this element into the QEM
+      QEM[0] += x[0] * x[0];
+      QEM[1] += x[0] * x[1];
+      QEM[2] += x[0] * x[2];
+      QEM[3] += x[3] * x[0];
 
-          QEM[4] += x[1] * x[1];
-          QEM[5] += x[1] * x[2];
-          QEM[6] += x[3] * x[1];
+      QEM[4] += x[1] * x[1];
+      QEM[5] += x[1] * x[2];
+      QEM[6] += x[3] * x[1];
 
-          QEM[7] += x[2] * x[2];
-          QEM[8] += x[3] * x[2];
+      QEM[7] += x[2] * x[2];
+      QEM[8] += x[3] * x[2];
 
-          QEM[9] += x[3] * x[3];
+      QEM[9] += x[3] * x[3];
 
-          QEM[11 + i * 4] = -x[0];
-          QEM[12 + i * 4] = -x[1];
-          QEM[13 + i * 4] = -x[2];
-          QEM[14 + i * 4] = -x[3];
-        }
-      }
-      else
-      {
-        vtkErrorMacro(<< "Unable to factor attribute matrix!");
-      }
+      QEM[11 + i * 4] = -x[0];
+      QEM[12 + i * 4] = -x[1];
+      QEM[13 + i * 4] = -x[2];
+      QEM[14 + i * 4] = -x[3];
     }
-
-    // add the QEM to all points of the face
-    for (i = 0; i < 3; i++)
+    return true;
+  };
+
+  // Rather than scattering the QEM of each face to its points, each point
+  // gathers the QEM of the faces using it so that points can be processed in
+  // parallel. The cell links list the faces in increasing order, hence the
+  // quadrics are summed in the same order as a serial traversal of the faces
+  // and the result does not depend on the number of threads.
+  std::atomic<bool> factorFailed(false);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<double> QEM(quadricSize);
+    vtkNew<vtkIdList> cellPtIds;
+    vtkIdType ncells, npts;
+    vtkIdType* cells;
+    const vtkIdType* pts;
+    double n[3], d, triArea2;
+
+    for (vtkIdType ptId = begin; ptId < end; ptId++)
     {
-      for (j = 0; j < 11 + 4 * this->NumberOfComponents; j++)
-      {
-        this->ErrorQuadrics[pts[i]].Quadric[j] += QEM[j] * triArea2;
-      }
+      double* quadric = new double[quadricSize];
+      std::fill(quadric, quadric + quadricSize, 0.0);
+      this->ErrorQuadrics[ptId].Quadric = quadric;
 
-      // Set volume constraint values g_vol and d_vol
-      if (this->VolumePreservation)
+      input->GetPointCells(ptId, ncells, cells);
+      for (vtkIdType c = 0; c < ncells; c++)
       {
-        // Vector g_vol
-        for (j = 0; j < 3; j++)
+        // degenerate faces are listed once per use of the point
+        if (c > 0 && cells[c] == cells[c - 1])
+        {
+          continue;
+        }
+        input->GetCellPoints(cells[c], npts, pts, cellPtIds);
+        if (!computeFaceQuadric(pts, QEM.data(), n, d, triArea2))
+        {
+          factorFailed = true;
+        }
+
+        // add the QEM of the face to this point, once per use
+        for (int i = 0; i < 3; i++)
         {
-          this->VolumeConstraints[pts[i] * 4 + j] +=
-            n[j] * triArea2 * 2.0; // triangle normal with length triArea * 2
+          if (pts[i] != ptId)
+          {
+            continue;
+          }
+          for (int j = 0; j < quadricSize; j++)
+          {
+            quadric[j] += QEM[j] * triArea2;
+          }
+
+          // Set volume constraint values g_vol and d_vol
+          if (this->VolumePreservation)
+          {
+            // Vector g_vol
+            for (int j = 0; j < 3; j++)
+            {
+              this->VolumeConstraints[ptId * 4 + j] +=
+                n[j] * triArea2 * 2.0; // triangle normal with length triArea * 2
+            }
+            // Scalar d_vol
+            this->VolumeConstraints[ptId * 4 + 3] +=
+              -d * triArea2 * 2.0; // (triangle normal with length triArea * 2) * (pts[0] position)
+          }
         }
-        // Scalar d_vol
-        this->VolumeConstraints[pts[i] * 4 + 3] +=
-          -d * triArea2 * 2.0; // (triangle normal with length triArea * 2) * (pts[0] position)
       }
     }
-  } // for all triangles
+  });
 
-  delete[] QEM;
+  if (factorFailed)
+  {
+    vtkErrorMacro(<< "Unable to factor attribute matrix!");
+  }
 }
 
+//------------------------------------------------------------------------------
 void vtkQuadricDecimation::AddBoundaryConstraints()
 {
   vtkPolyData* input = this->Mesh;
-  double* QEM;
-  vtkIdType cellId;
-  int i, j;
-  vtkIdType npts;
-  const vtkIdType* pts;
-  double t0[3], t1[3], t2[3];
-  double e0[3], e1[3], n[3], c, w;
-  vtkIdList* cellIds = vtkIdList::New();
-
-  // allocate local QEM space matrix
-  QEM = new double[11 + 4 * this->NumberOfComponents];
 
-  for (cellId = 0; cellId < input->GetNumberOfCells(); cellId++)
-  {
-    input->GetCellPoints(cellId, npts, pts);
-
-    for (i = 0; i < 3; i++)
+  // As for the face quadrics, each point gathers the constraints of the
+  // boundary edges it belongs to, in increasing face order.
+  vtkSMPTools::For(0, input->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+    double QEM[11];
+    int i, j;
+    vtkIdType ncells, npts;
+    vtkIdType* cells;
+    const vtkIdType* pts;
+    double t0[3], t1[3], t2[3];
+    double e0[3], e1[3], n[3], c, w;
+    vtkNew<vtkIdList> cellIds;
+    vtkNew<vtkIdList> cellPtIds;
+
+    for (vtkIdType ptId = begin; ptId < end; ptId++)
     {
-      input->GetCellEdgeNeighbors(cellId, pts[i], pts[(i + 1) % 3], cellIds);
-      if (cellIds->GetNumberOfIds() == 0)
+      input->GetPointCells(ptId, ncells, cells);
+      for (vtkIdType k = 0; k < ncells; k++)
       {
-        // this is a boundary
-        input->GetPoint(pts[(i + 2) % 3], t0);
-        input->GetPoint(pts[i], t1);
-        input->GetPoint(pts[(i + 1) % 3], t2);
-
-        // computing a plane which is orthogonal to line t1, t2 and incident
-        // with it
-        for (j = 0; j < 3; j++)
+        const vtkIdType cellId = cells[k];
+        // degenerate faces are listed once per use of the point
+        if (k > 0 && cellId == cells[k - 1])
         {
-          e0[j] = t2[j] - t1[j];
-        }
-        for (j = 0; j < 3; j++)
-        {
-          e1[j] = t0[j] - t1[j];
+          continue;
         }
+        input->GetCellPoints(cellId, npts, pts, cellPtIds);
 
-        // compute n so that it is orthogonal to e0 and parallel to the
-        // triangle
-        c = vtkMath::Dot(e0, e1) / (e0[0] * e0[0] + e0[1] * e0[1] + e0[2] * e0[2]);
-        for (j = 0; j < 3; j++)
+        for (i = 0; i < 3; i++)
         {
-          n[j] = e1[j] - c * e0[j];
-        }
-        vtkMath::Normalize(n);
+          if (pts[i] != ptId && pts[(i + 1) % 3] != ptId)
+          {
+            continue;
+          }
+          input->GetCellEdgeNeighbors(cellId, pts[i], pts[(i + 1) % 3], cellIds);
+          if (cellIds->GetNumberOfIds() != 0)
+          {
+            continue;
+          }
+
+          // this is a boundary
+          input->GetPoint(pts[(i + 2) % 3], t0);
+          input->GetPoint(pts[i], t1);
+          input->GetPoint(pts[(i + 1) % 3], t2);
+
+          // computing a plane which is orthogonal to line t1, t2 and incident
+          // with it
+          for (j = 0; j < 3; j++)
+          {
+            e0[j] = t2[j] - t1[j];
+          }
+          for (j = 0; j < 3; j++)
+          {
+            e1[j] = t0[j] - t1[j];
+          }
+
+          // compute n so that it is orthogonal to e0 and parallel to the
+          // triangle
+          c = vtkMath::Dot(e0, e1) / (e0[0] * e0[0] + e0[1] * e0[1] + e0[2] * e0[2]);
+          for (j = 0; j < 3; j++)
+          {
+            n[j] = e1[j] - c * e0[j];
+          }
+          vtkMath::Normalize(n);
 
 #if defined(_MSC_VER) && _MSC_VER >= 1929
-        // Visual Studio toolset starting at toolset 14.29.30133, when building in Release mode
-        // incorrectly optimizes away the line
-        //    QEM[9] = d * d;
-        // By making volatile, we are telling the compiler not to optimize out
-        // or reorder operations regarding this variable.
-        volatile
+          // Visual Studio toolset starting at toolset 14.29.30133, when building in Release mode
+          // incorrectly optimizes away the line
+          //    QEM[9] = d * d;
+          // By making volatile, we are telling the compiler not to optimize out
+          // or reorder operations regarding this variable.
+          volatile
 #endif
-          double d = -vtkMath::Dot(n, t1);
-        // The above line might merit some review: The same quadric gets added to t1 and t2 and one
-        // might prefer adding a quadric calculated using t1 at t1 and using t2 at t2
-        w = vtkMath::Norm(e0);
+            double d = -vtkMath::Dot(n, t1);
+          // The above line might merit some review: The same quadric gets added to t1 and t2 and
+          // one might prefer adding a quadric calculated using t1 at t1 and using t2 at t2
+          w = vtkMath::Norm(e0);
 
-        if (!this->WeighBoundaryConstraintsByLength)
-        {
-          /*
-           * The argument for using area instead of length is based on homogeneity here: The quadric
-           * field is already weighted by triangle area. It makes sense weighting the boundary
-           * constraints by area instead of length. Length technically has zero measure in terms of
-           * units of area. The squared version also seems to give more coherent results at the
-           * boundary.
-           */
-          w *= w;
-        }
-        w *= this->BoundaryWeightFactor;
+          if (!this->WeighBoundaryConstraintsByLength)
+          {
+            /*
+             * The argument for using area instead of length is based on homogeneity here: The
+             * quadric field is already weighted by triangle area. It makes sense weighting the
+             * boundary constraints by area instead of length. Length technically has zero measure
+             * in terms of units of area. The squared version also seems to give more coherent
+             * results at the boundary.
+             */
+            w *= w;
+          }
+          w *= this->BoundaryWeightFactor;
 
-        // could possible add in
-        // angle weights??
-        QEM[0] = n[0] * n[0];
-        QEM[1] = n[0] * n[1];
-        QEM[2] = n[0] * n[2];
-        QEM[3] = d * n[0];
+          // could possible add in
+          // angle weights??
+          QEM[0] = n[0] * n[0];
+          QEM[1] = n[0] * n[1];
+          QEM[2] = n[0] * n[2];
+          QEM[3] = d * n[0];
 
-        QEM[4] = n[1] * n[1];
-        QEM[5] = n[1] * n[2];
-        QEM[6] = d * n[1];
+          QEM[4] = n[1] * n[1];
+          QEM[5] = n[1] * n[2];
+          QEM[6] = d * n[1];
 
-        QEM[7] = n[2] * n[2];
-        QEM[8] = d * n[2];
+          QEM[7] = n[2] * n[2];
+          QEM[8] = d * n[2];
 
-        QEM[9] = d * d;
+          QEM[9] = d * d;
 
-        QEM[10] = 1;
+          QEM[10] = 1;
 
-        // need to add orthogonal plane with the other Attributes, but this
-        // is not clear??
-        // check to interaction with attribute data
-        for (j = 0; j < 11; j++)
-        {
-          this->ErrorQuadrics[pts[i]].Quadric[j] += QEM[j] * w;
-          this->ErrorQuadrics[pts[(i + 1) % 3]].Quadric[j] += QEM[j] * w;
+          // need to add orthogonal plane with the other Attributes, but this
+          // is not clear??
+          // check to interaction with attribute data
+          double* quadric = this->ErrorQuadrics[ptId].Quadric;
+          for (j = 0; j < 11; j++)
+          {
+            if (pts[i] == ptId)
+            {
+              quadric[j] += QEM[j] * w;
+            }
+            if (pts[(i + 1) % 3] == ptId)
+            {
+              quadric[j] += QEM[j] * w;
+            }
+          }
         }
       }
     }
-  }
-  cellIds->Delete();
-  delete[] QEM;
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -857,12 +923,38 @@ void vtkQuadricDecimation::FindAffectedEdges(vtkIdType p1Id, vtkIdType p2Id, vtk
   }
 }
 
-// FIXME: memory allocation clean up
+//------------------------------------------------------------------------------
 void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
+{
+  this->UpdateEdgeData(pt0Id, pt1Id, nullptr);
+}
+
+// FIXME: memory allocation clean up
+void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id, vtkIdList* costEdges)
 {
   vtkIdList* changedEdges = vtkIdList::New();
   vtkIdType i, edgeId, edge[2];
-  double cost;
+
+  // Compute cost (target point/data) and add to priority cue, unless the
+  // caller computes the costs itself.
+  auto updateCost = [this, costEdges](vtkIdType id) {
+    if (costEdges)
+    {
+      costEdges->InsertNextId(id);
+      return;
+    }
+    double cost;
+    if (this->AttributeErrorMetric)
+    {
+      cost = this->ComputeCost2(id, this->TempX);
+    }
+    else
+    {
+      cost = this->ComputeCost(id, this->TempX);
+    }
+    this->EdgeCosts->Insert(cost, id);
+    this->TargetPoints->InsertTuple(id, this->TempX);
+  };
 
   // Find all edges with exactly either of these 2 endpoints.
   this->FindAffectedEdges(pt0Id, pt1Id, changedEdges);
@@ -889,17 +981,7 @@ void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
         this->Edges->InsertEdge(edge[1], pt0Id, edgeId);
         this->EndPoint1List->InsertId(edgeId, edge[1]);
         this->EndPoint2List->InsertId(edgeId, pt0Id);
-        // Compute cost (target point/data) and add to priority cue.
-        if (this->AttributeErrorMetric)
-        {
-          cost = this->ComputeCost2(edgeId, this->TempX);
-        }
-        else
-        {
-          cost = this->ComputeCost(edgeId, this->TempX);
-        }
-        this->EdgeCosts->Insert(cost, edgeId);
-        this->TargetPoints->InsertTuple(edgeId, this->TempX);
+        updateCost(edgeId);
       }
     }
     else if (edge[1] == pt1Id)
@@ -910,39 +992,200 @@ void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
         this->Edges->InsertEdge(edge[0], pt0Id, edgeId);
         this->EndPoint1List->InsertId(edgeId, edge[0]);
         this->EndPoint2List->InsertId(edgeId, pt0Id);
-        // Compute cost (target point/data) and add to priority cue.
-        if (this->AttributeErrorMetric)
+        updateCost(edgeId);
+      }
+    }
+    else
+    { // This edge already has one point as the merged point.
+      updateCost(changedEdges->GetId(i));
+    }
+  }
+
+  changedEdges->Delete();
+}
+
+//------------------------------------------------------------------------------
+void vtkQuadricDecimation::ComputeCosts(vtkIdType numEdges, const vtkIdType* edgeIds, double* costs)
+{
+  const int dim = 3 + this->NumberOfComponents + this->VolumePreservation;
+  double* targets = this->TargetPoints->GetPointer(0);
+  vtkSMPTools::For(0, numEdges, [&](vtkIdType begin, vtkIdType end) {
+    // per-thread scratch space replacing the Temp* members
+    std::vector<double> quad(11 + 4 * this->NumberOfComponents + this->VolumePreservation);
+    std::vector<double> b(dim);
+    std::vector<double> data(dim * dim);
+    std::vector<double*> A(dim);
+    for (int row = 0; row < dim; ++row)
+    {
+      A[row] = data.data() + row * dim;
+    }
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType edge = edgeIds ? edgeIds[i] : i;
+      double* target = targets + edge * dim;
+      costs[i] = this->AttributeErrorMetric
+        ? this->ComputeCost2(edge, target, quad.data(), A.data(), b.data())
+        : this->ComputeCost(edge, target, quad.data());
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+bool vtkQuadricDecimation::CollapseEdgeBatches(vtkIdType numTris, vtkIdType& numDeletedTris)
+{
+  // A point is locked while it belongs to the neighborhood of an edge
+  // collapsed in the current batch, i.e. to a triangle using one of its end
+  // points. Removed points stay removed.
+  enum PointState : unsigned char
+  {
+    FREE = 0,
+    LOCKED = 1,
+    REMOVED = 2
+  };
+  const vtkIdType numPts = this->Mesh->GetNumberOfPoints();
+  std::vector<unsigned char> pointStates(numPts, FREE);
+  std::vector<vtkIdType> lockedPts;
+  std::vector<std::pair<vtkIdType, double>> skippedEdges;
+  std::vector<double> costs;
+  std::vector<double> x(3 + this->NumberOfComponents + this->VolumePreservation);
+  vtkNew<vtkIdList> costEdges;
+  vtkIdType endPtIds[2];
+  vtkIdType ncells, *cells, npts;
+  const vtkIdType* pts;
+  double cost;
+
+  while (this->ActualReduction < this->TargetReduction)
+  {
+    vtkDebugMacro(<< "Collapsing edge#" << this->NumberOfEdgeCollapses);
+    this->UpdateProgress(0.20 + 0.80 * this->NumberOfEdgeCollapses / numPts);
+    if (this->CheckAbort())
+    {
+      return false;
+    }
+
+    // Take at most the number of collapses still needed, each one deleting
+    // about two triangles, and a tenth of the queued edges so that the batch
+    // stays among the cheapest ones.
+    const vtkIdType numNeeded = static_cast<vtkIdType>(
+      std::ceil((this->TargetReduction * numTris - numDeletedTris) / 2.0));
+    const vtkIdType batchSize = std::max<vtkIdType>(
+      1, std::min(numNeeded, this->EdgeCosts->GetNumberOfItems() / 10));
+    costEdges->Reset();
+    skippedEdges.clear();
+    lockedPts.clear();
+    vtkIdType numCollapses = 0;
+    bool exhausted = false;
+    for (vtkIdType n = 0; n < batchSize && this->ActualReduction < this->TargetReduction; ++n)
+    {
+      const vtkIdType edgeId = this->EdgeCosts->Pop(0, cost);
+      if (edgeId < 0 || cost >= VTK_DOUBLE_MAX)
+      {
+        if (edgeId >= 0)
         {
-          cost = this->ComputeCost2(edgeId, this->TempX);
+          this->EdgeCosts->Insert(cost, edgeId);
         }
-        else
+        exhausted = true;
+        break;
+      }
+      endPtIds[0] = this->EndPoint1List->GetId(edgeId);
+      endPtIds[1] = this->EndPoint2List->GetId(edgeId);
+
+      // Skip the edge if an end point is in the neighborhood of an edge
+      // already collapsed in this batch: its cost is outdated, and the
+      // edges updated by the two collapses would overlap.
+      if (pointStates[endPtIds[0]] != FREE || pointStates[endPtIds[1]] != FREE)
+      {
+        skippedEdges.emplace_back(edgeId, cost);
+        continue;
+      }
+
+      this->TargetPoints->GetTuple(edgeId, x.data());
+      if (!this->IsGoodPlacement(endPtIds[0], endPtIds[1], x.data()))
+      {
+        vtkDebugMacro(<< "Poor placement detected " << edgeId << " " << cost);
+        this->EdgeCosts->Insert(VTK_DOUBLE_MAX, edgeId);
+        continue;
+      }
+
+      for (int k = 0; k < 2; k++)
+      {
+        this->Mesh->GetPointCells(endPtIds[k], ncells, cells);
+        for (vtkIdType i = 0; i < ncells; i++)
         {
-          cost = this->ComputeCost(edgeId, this->TempX);
+          this->Mesh->GetCellPoints(cells[i], npts, pts);
+          for (vtkIdType j = 0; j < npts; j++)
+          {
+            if (pointStates[pts[j]] == FREE)
+            {
+              pointStates[pts[j]] = LOCKED;
+              lockedPts.push_back(pts[j]);
+            }
+          }
         }
-        this->EdgeCosts->Insert(cost, edgeId);
-        this->TargetPoints->InsertTuple(edgeId, this->TempX);
       }
+      pointStates[endPtIds[0]] = LOCKED;
+      pointStates[endPtIds[1]] = REMOVED;
+      lockedPts.push_back(endPtIds[0]);
+
+      this->NumberOfEdgeCollapses++;
+      numCollapses++;
+      this->SetPointAttributeArray(endPtIds, x.data());
+      this->AddQuadric(endPtIds[1], endPtIds[0]);
+      this->UpdateEdgeData(endPtIds[0], endPtIds[1], costEdges);
+      numDeletedTris += this->CollapseEdge(endPtIds[0], endPtIds[1]);
+      this->ActualReduction = (double)numDeletedTris / numTris;
     }
-    else
-    { // This edge already has one point as the merged point.
-      if (this->AttributeErrorMetric)
+
+    // No collapsed edge has an end point in the neighborhood of another one,
+    // so each edge to update depends on a single collapse and the costs can
+    // be computed concurrently.
+    const vtkIdType numCostEdges = costEdges->GetNumberOfIds();
+    costs.resize(numCostEdges);
+    // Resize() keeps the target points of the other edges, which
+    // SetNumberOfTuples() alone would discard when growing the array
+    this->TargetPoints->Resize(this->Edges->GetNumberOfEdges());
+    this->TargetPoints->SetNumberOfTuples(this->Edges->GetNumberOfEdges());
+    this->ComputeCosts(numCostEdges, costEdges->GetPointer(0), costs.data());
+    for (vtkIdType i = 0; i < numCostEdges; i++)
+    {
+      this->EdgeCosts->Insert(costs[i], costEdges->GetId(i));
+    }
+
+    // Requeue the skipped edges, unless a collapse removed one of their end
+    // points. Insert() ignores the edges that were just updated.
+    for (const auto& edge : skippedEdges)
+    {
+      if (pointStates[this->EndPoint1List->GetId(edge.first)] != REMOVED &&
+        pointStates[this->EndPoint2List->GetId(edge.first)] != REMOVED)
       {
-        cost = this->ComputeCost2(changedEdges->GetId(i), this->TempX);
+        this->EdgeCosts->Insert(edge.second, edge.first);
       }
-      else
+    }
+    for (vtkIdType ptId : lockedPts)
+    {
+      if (pointStates[ptId] == LOCKED)
       {
-        cost = this->ComputeCost(changedEdges->GetId(i), this->TempX);
+        pointStates[ptId] = FREE;
       }
-      this->EdgeCosts->Insert(cost, changedEdges->GetId(i));
-      this->TargetPoints->InsertTuple(changedEdges->GetId(i), this->TempX);
+    }
+
+    if (exhausted && numCollapses == 0)
+    {
+      break;
     }
   }
 
-  changedEdges->Delete();
+  return true;
 }
 
 //------------------------------------------------------------------------------
 double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
+{
+  return this->ComputeCost(edgeId, x, this->TempQuad);
+}
+
+//------------------------------------------------------------------------------
+double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x, double* quad)
 {
   static const double errorNumber = 1e-10;
   double temp[3], A[3][3], b[3];
@@ -959,20 +1202,20 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
 
   for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
   {
-    this->TempQuad[i] =
+    quad[i] =
       this->ErrorQuadrics[pointIds[0]].Quadric[i] + this->ErrorQuadrics[pointIds[1]].Quadric[i];
   }
 
-  A[0][0] = this->TempQuad[0];
-  A[0][1] = A[1][0] = this->TempQuad[1];
-  A[0][2] = A[2][0] = this->TempQuad[2];
-  A[1][1] = this->TempQuad[4];
-  A[1][2] = A[2][1] = this->TempQuad[5];
-  A[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
-  b[0] = -this->TempQuad[3];
-  b[1] = -this->TempQuad[6];
-  b[2] = -this->TempQuad[8];
+  b[0] = -quad[3];
+  b[1] = -quad[6];
+  b[2] = -quad[8];
 
   norm = vtkMath::Norm(A[0]);
   normTemp = vtkMath::Norm(A[1]);
@@ -1024,7 +1267,7 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
 
   // Compute the cost
   // x'*quad*x
-  index = this->TempQuad;
+  index = quad;
   for (i = 0; i < 4; i++)
   {
     cost += (*index++) * newPoint[i] * newPoint[i];
@@ -1039,6 +1282,13 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
 
 //------------------------------------------------------------------------------
 double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
+{
+  return this->ComputeCost2(edgeId, x, this->TempQuad, this->TempA, this->TempB);
+}
+
+//------------------------------------------------------------------------------
+double vtkQuadricDecimation::ComputeCost2(
+  vtkIdType edgeId, double* x, double* quad, double** A, double* b)
 {
   // this function is so ugly because the functionality of converting an QEM
   // into a dense matrix was not extracted into a separate function and
@@ -1054,29 +1304,29 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
 
   for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
   {
-    this->TempQuad[i] =
+    quad[i] =
       this->ErrorQuadrics[pointIds[0]].Quadric[i] + this->ErrorQuadrics[pointIds[1]].Quadric[i];
   }
 
   // copy the temp quad into TempA
   // converting from the sparse matrix format into a dense
-  this->TempA[0][0] = this->TempQuad[0];
-  this->TempA[0][1] = this->TempA[1][0] = this->TempQuad[1];
-  this->TempA[0][2] = this->TempA[2][0] = this->TempQuad[2];
-  this->TempA[1][1] = this->TempQuad[4];
-  this->TempA[1][2] = this->TempA[2][1] = this->TempQuad[5];
-  this->TempA[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
-  this->TempB[0] = -this->TempQuad[3];
-  this->TempB[1] = -this->TempQuad[6];
-  this->TempB[2] = -this->TempQuad[8];
+  b[0] = -quad[3];
+  b[1] = -quad[6];
+  b[2] = -quad[8];
 
   for (i = 3; i < 3 + this->NumberOfComponents; i++)
   {
-    this->TempA[0][i] = this->TempA[i][0] = this->TempQuad[11 + 4 * (i - 3)];
-    this->TempA[1][i] = this->TempA[i][1] = this->TempQuad[11 + 4 * (i - 3) + 1];
-    this->TempA[2][i] = this->TempA[i][2] = this->TempQuad[11 + 4 * (i - 3) + 2];
-    this->TempB[i] = -this->TempQuad[11 + 4 * (i - 3) + 3];
+    A[0][i] = A[i][0] = quad[11 + 4 * (i - 3)];
+    A[1][i] = A[i][1] = quad[11 + 4 * (i - 3) + 1];
+    A[2][i] = A[i][2] = quad[11 + 4 * (i - 3) + 2];
+    b[i] = -quad[11 + 4 * (i - 3) + 3];
   }
 
   // Set zero to all components of the submatrix a[3:n;3:n] and al to its diagonal
@@ -1086,11 +1336,11 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i == j)
       {
-        this->TempA[i][j] = this->TempQuad[10];
+        A[i][j] = quad[10];
       }
       else
       {
-        this->TempA[i][j] = 0;
+        A[i][j] = 0;
       }
     }
   }
@@ -1101,48 +1351,48 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i >= 3)
       {
-        this->TempA[i][3 + this->NumberOfComponents] = 0;
-        this->TempA[3 + this->NumberOfComponents][i] = 0;
+        A[i][3 + this->NumberOfComponents] = 0;
+        A[3 + this->NumberOfComponents][i] = 0;
       }
       else
       {
-        this->TempA[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[i][3 + this->NumberOfComponents] +=
+        A[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[i][3 + this->NumberOfComponents] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] +=
+        A[3 + this->NumberOfComponents][i] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
       }
     }
     // Add constraint to b
-    this->TempB[3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + 3];
-    this->TempB[3 + this->NumberOfComponents] += this->VolumeConstraints[pointIds[1] * 4 + 3];
+    b[3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + 3];
+    b[3 + this->NumberOfComponents] += this->VolumeConstraints[pointIds[1] * 4 + 3];
   }
 
   for (i = 0; i < 3 + this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    x[i] = this->TempB[i];
+    x[i] = b[i];
   }
 
   // solve A*x = b
   // this clobers A
   // need to develop a quality of the solution test??
   solveOk = vtkMath::SolveLinearSystem(
-    this->TempA, x, 3 + this->NumberOfComponents + this->VolumePreservation);
+    A, x, 3 + this->NumberOfComponents + this->VolumePreservation);
 
   // need to copy back into A
-  this->TempA[0][0] = this->TempQuad[0];
-  this->TempA[0][1] = this->TempA[1][0] = this->TempQuad[1];
-  this->TempA[0][2] = this->TempA[2][0] = this->TempQuad[2];
-  this->TempA[1][1] = this->TempQuad[4];
-  this->TempA[1][2] = this->TempA[2][1] = this->TempQuad[5];
-  this->TempA[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
   for (i = 3; i < 3 + this->NumberOfComponents; i++)
   {
-    this->TempA[0][i] = this->TempA[i][0] = this->TempQuad[11 + 4 * (i - 3)];
-    this->TempA[1][i] = this->TempA[i][1] = this->TempQuad[11 + 4 * (i - 3) + 1];
-    this->TempA[2][i] = this->TempA[i][2] = this->TempQuad[11 + 4 * (i - 3) + 2];
+    A[0][i] = A[i][0] = quad[11 + 4 * (i - 3)];
+    A[1][i] = A[i][1] = quad[11 + 4 * (i - 3) + 1];
+    A[2][i] = A[i][2] = quad[11 + 4 * (i - 3) + 2];
   }
 
   for (i = 3; i < 3 + this->NumberOfComponents; i++)
@@ -1151,11 +1401,11 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i == j)
       {
-        this->TempA[i][j] = this->TempQuad[10];
+        A[i][j] = quad[10];
       }
       else
       {
-        this->TempA[i][j] = 0;
+        A[i][j] = 0;
       }
     }
   }
@@ -1166,16 +1416,16 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i >= 3)
       {
-        this->TempA[i][3 + this->NumberOfComponents] = 0;
-        this->TempA[3 + this->NumberOfComponents][i] = 0;
+        A[i][3 + this->NumberOfComponents] = 0;
+        A[3 + this->NumberOfComponents][i] = 0;
       }
       else
       {
-        this->TempA[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[i][3 + this->NumberOfComponents] +=
+        A[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[i][3 + this->NumberOfComponents] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] +=
+        A[3 + this->NumberOfComponents][i] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
       }
     }
@@ -1209,7 +1459,7 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
       temp2[i] = 0;
       for (j = 0; j < 3 + this->NumberOfComponents; ++j)
       {
-        temp2[i] += this->TempA[i][j] * v[j];
+        temp2[i] += A[i][j] * v[j];
       }
     }
 
@@ -1227,13 +1477,13 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
         temp[i] = 0;
         for (j = 0; j < 3 + this->NumberOfComponents; ++j)
         {
-          temp[i] += this->TempA[i][j] * pt1[j];
+          temp[i] += A[i][j] * pt1[j];
         }
       }
 
       for (i = 0; i < 3 + this->NumberOfComponents; i++)
       {
-        temp[i] = this->TempB[i] - temp[i];
+        temp[i] = b[i] - temp[i];
       }
 
       for (i = 0; i < 3 + this->NumberOfComponents; i++)
@@ -1267,18 +1517,18 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
   // x'*A*x - 2*b*x + d
   for (i = 0; i < 3 + this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    cost += this->TempA[i][i] * x[i] * x[i];
+    cost += A[i][i] * x[i] * x[i];
     for (j = i + 1; j < 3 + this->NumberOfComponents + this->VolumePreservation; j++)
     {
-      cost += 2.0 * this->TempA[i][j] * x[i] * x[j];
+      cost += 2.0 * A[i][j] * x[i] * x[j];
     }
   }
   for (i = 0; i < 3 + this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    cost -= 2.0 * this->TempB[i] * x[i];
+    cost -= 2.0 * b[i] * x[i];
   }
 
-  cost += this->TempQuad[9];
+  cost += quad[9];
 
   return cost;
 }
@@ -1548,6 +1798,7 @@ void vtkQuadricDecimation::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Attribute Error Metric: " << (this->AttributeErrorMetric ? "On\n" : "Off\n");
   os << indent << "Volume Preservation: " << (this->VolumePreservation ? "On\n" : "Off\n");
+  os << indent << "Batched Collapse: " << (this->BatchedCollapse ? "On\n" : "Off\n");
   os << indent << "Scalars Attribute: " << (this->ScalarsAttribute ? "On\n" : "Off\n");
   os << indent << "Vectors Attribute: " << (this->VectorsAttribute ? "On\n" : "Off\n");
   os << indent << "Normals Attribute: " << (this->NormalsAttribute ? "On\n" : "Off\n");
@@ -48,6 +48,12 @@
  * Attributes" is also a good take on the subject especially as it pertains
  * to the error metric applied to attributes.
  *
+ * The computation of the quadrics and of the initial edge costs is threaded
+ * using vtkSMPTools. The edge collapses themselves remain sequential so the
+ * output does not depend on the number of threads. With BatchedCollapse on,
+ * edges are instead collapsed in batches and the costs of the edges around
+ * them are updated in parallel, at the expense of the strict cost ordering.
+ *
  * @par Thanks:
  * Thanks to Bradley Lowekamp of the National Library of Medicine/NIH for
  * contributing this class.
@@ -198,6 +204,22 @@ public:
   vtkGetMacro(TensorsWeight, double);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether edges are collapsed in batches instead of one at a time
+   * in order of increasing cost. Each batch takes the cheapest edges of the
+   * queue and collapses those whose neighborhoods (the triangles using their
+   * end points) do not overlap, then the costs of the edges around them are
+   * recomputed in parallel with vtkSMPTools. Edges are therefore no longer
+   * collapsed in strict cost order and the output differs from the one of
+   * the default mode, in exchange for speed on large meshes. The target
+   * reduction is still honored. By default this is off.
+   */
+  vtkSetMacro(BatchedCollapse, bool);
+  vtkGetMacro(BatchedCollapse, bool);
+  vtkBooleanMacro(BatchedCollapse, bool);
+  ///@}
+
   ///@{
   /**
    * Get the actual reduction. This value is only valid after the
@@ -248,6 +270,32 @@ protected:
   double ComputeCost2(vtkIdType edgeId, double* x);
   ///@}
 
+  ///@{
+  /**
+   * Same as above, but using the caller provided scratch buffers instead of
+   * the Temp* members so that costs can be evaluated concurrently. quad must
+   * hold as many values as TempQuad, A and b as many as TempA and TempB.
+   */
+  double ComputeCost(vtkIdType edgeId, double* x, double* quad);
+  double ComputeCost2(vtkIdType edgeId, double* x, double* quad, double** A, double* b);
+  ///@}
+
+  /**
+   * Compute in parallel the costs and target points of numEdges edges, whose
+   * ids are given by edgeIds, or are 0 to numEdges-1 if edgeIds is nullptr.
+   * The costs are stored in costs and the target points in TargetPoints,
+   * which must already hold a tuple for each edge.
+   */
+  void ComputeCosts(vtkIdType numEdges, const vtkIdType* edgeIds, double* costs);
+
+  /**
+   * Collapse batches of edges with disjoint neighborhoods until the target
+   * reduction is reached (see BatchedCollapse). numDeletedTris is updated
+   * with the number of deleted triangles. Returns false if the execution was
+   * aborted.
+   */
+  bool CollapseEdgeBatches(vtkIdType numTris, vtkIdType& numDeletedTris);
+
   /**
    * Find all edges that will have an endpoint change ids because of an edge
    * collapse.  p1Id and p2Id are the endpoints of the edge.  p2Id is the
@@ -266,6 +314,12 @@ protected:
   void ComputeNumberOfComponents();
   void UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id);
 
+  /**
+   * Same as above, but if costEdges is not nullptr the ids of the edges whose
+   * cost must be recomputed are appended to it instead of being queued.
+   */
+  void UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id, vtkIdList* costEdges);
+
   ///@{
   /**
    * Helper function to set and get the point and it's attributes as an array
@@ -291,6 +345,7 @@ protected:
   vtkTypeBool VolumePreservation;
 
   bool MapPointData = false;
+  bool BatchedCollapse = false;
 
   vtkTypeBool ScalarsAttribute;
   vtkTypeBool VectorsAttribute;
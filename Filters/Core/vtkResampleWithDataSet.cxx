@@ -158,6 +158,16 @@ bool vtkResampleWithDataSet::GetSnapToCellWithClosestPoint()
   return this->Prober->GetSnapToCellWithClosestPoint();
 }
 
+void vtkResampleWithDataSet::SetCacheProbePlan(bool arg)
+{
+  this->Prober->SetCacheProbePlan(arg);
+}
+
+bool vtkResampleWithDataSet::GetCacheProbePlan()
+{
+  return this->Prober->GetCacheProbePlan();
+}
+
 //------------------------------------------------------------------------------
 vtkMTimeType vtkResampleWithDataSet::GetMTime()
 {
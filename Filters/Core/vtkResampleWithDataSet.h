@@ -166,6 +166,20 @@ public:
   vtkBooleanMacro(SnapToCellWithClosestPoint, bool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether to cache the probe plan, i.e. the source cell and the
+   * interpolation weights found for each input point, so that the next
+   * executions with the same meshes only interpolate the source attributes.
+   * See vtkProbeFilter::SetCacheProbePlan.
+   *
+   * Default is off.
+   */
+  void SetCacheProbePlan(bool arg);
+  bool GetCacheProbePlan();
+  vtkBooleanMacro(CacheProbePlan, bool);
+  ///@}
+
   ///@{
   /*
    * Set/Get the prototype cell locator to use for probing the source dataset.
@@ -18,6 +18,7 @@
 #include "vtkCellData.h"
 #include "vtkCellLocator.h"
 #include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
@@ -25,11 +26,16 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleFilter.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSmoothPolyDataFilter);
@@ -132,6 +138,8 @@ vtkSmoothPolyDataFilter::vtkSmoothPolyDataFilter()
 
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
 
+  this->IterationMethod = GAUSS_SEIDEL;
+
   this->SmoothPoints = nullptr;
 
   // optional second input
@@ -186,16 +194,45 @@ struct vtkSPDF_InternalParams
   T factor;
   T conv;
   vtkIdType numPts;
-  vtkMeshVertexPtr vertexPtr;
+  // the points connected to point i are neighbors[offsets[i]] to
+  // neighbors[offsets[i+1]-1]; fixed points have none
+  const vtkIdType* offsets;
+  const vtkIdType* neighbors;
   vtkPolyData* source;
   vtkSmoothPoints* SmoothPoints;
-  double* w;
   vtkCellLocator* cellLocator;
 };
 
+// Move x to the closest point of the source surface, starting the search from
+// the cell in which the point was last found.
+void vtkSPDF_ConstrainPoint(vtkPolyData* source, vtkCellLocator* cellLocator,
+  vtkSmoothPoint* sPtr, vtkGenericCell* cell, double* w, double x[3])
+{
+  double closestPt[3], dist2;
+  bool inCell = false;
+  if (sPtr->cellId >= 0) // in cell
+  {
+    source->GetCell(sPtr->cellId, cell);
+    inCell = cell->EvaluatePosition(x, closestPt, sPtr->subId, sPtr->p, dist2, w) != 0;
+  }
+  if (!inCell) // not in cell anymore
+  {
+    cellLocator->FindClosestPoint(x, closestPt, cell, sPtr->cellId, sPtr->subId, dist2);
+  }
+  for (int k = 0; k < 3; ++k)
+  {
+    x[k] = closestPt[k];
+  }
+}
+
+// Gauss-Seidel iterations: the points are moved in place, one after the
+// other, so that each point sees the already moved positions of the points
+// that precede it.
 template <typename T>
 void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
 {
+  vtkNew<vtkGenericCell> cell;
+  std::vector<double> w(params.source ? params.source->GetMaxCellSize() : 0);
   int iterationNumber = 0;
   for (T maxDist = std::numeric_limits<T>::max();
        maxDist > params.conv && iterationNumber < params.numberOfIterations; ++iterationNumber)
@@ -212,20 +249,19 @@ void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
     maxDist = 0.0;
     T* newPtsCoords = static_cast<T*>(params.newPts->GetVoidPointer(0));
     T* start = newPtsCoords;
-    vtkMeshVertexPtr vertsPtr = params.vertexPtr;
-    vtkIdType npts, *edgeIdPtr;
+    vtkIdType npts;
+    const vtkIdType* edgeIdPtr;
     T dist, deltaX[3];
-    double dist2, xNew[3], closestPt[3];
+    double xNew[3];
 
     // For each non-fixed vertex of the mesh, move the point toward the mean
     // position of its connected neighbors using the relaxation factor.
     for (vtkIdType i = 0; i < params.numPts; ++i)
     {
-      if (vertsPtr->type != VTK_FIXED_VERTEX && vertsPtr->edges &&
-        (npts = vertsPtr->edges->GetNumberOfIds()) > 0)
+      if ((npts = params.offsets[i + 1] - params.offsets[i]) > 0)
       {
         deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
-        edgeIdPtr = vertsPtr->edges->GetPointer(0);
+        edgeIdPtr = params.neighbors + params.offsets[i];
         // Compute the mean (cumulated) direction vector
         for (vtkIdType j = 0; j < npts; ++j)
         {
@@ -250,23 +286,8 @@ void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
         // Constrain point to surface
         if (params.source)
         {
-          vtkSmoothPoint* sPtr = params.SmoothPoints->GetSmoothPoint(i);
-          vtkCell* cell = nullptr;
-
-          if (sPtr->cellId >= 0) // in cell
-          {
-            cell = params.source->GetCell(sPtr->cellId);
-          }
-
-          if (!cell ||
-            cell->EvaluatePosition(xNew, closestPt, sPtr->subId, sPtr->p, dist2, params.w) == 0)
-          { // not in cell anymore
-            params.cellLocator->FindClosestPoint(xNew, closestPt, sPtr->cellId, sPtr->subId, dist2);
-          }
-          for (int k = 0; k < 3; ++k)
-          {
-            xNew[k] = closestPt[k];
-          }
+          vtkSPDF_ConstrainPoint(params.source, params.cellLocator,
+            params.SmoothPoints->GetSmoothPoint(i), cell, w.data(), xNew);
           params.newPts->SetPoint(i, xNew);
         }
 
@@ -279,13 +300,152 @@ void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
       {
         newPtsCoords += 3;
       }
-      ++vertsPtr;
     } // for all points
   }   // for not converged or within iteration count
 
   vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
 }
 
+// One Jacobi iteration: the points are moved from the positions of the
+// previous iteration (Src) to a second buffer (Dst), so that all the points
+// can be moved in parallel. The convergence measure is reduced over the
+// threads.
+template <typename T>
+struct vtkSPDF_JacobiIteration
+{
+  vtkSPDF_InternalParams<T>& Params;
+  const T* Src;
+  T* Dst;
+  vtkSMPThreadLocalObject<vtkGenericCell>& Cell;
+  vtkSMPThreadLocal<std::vector<double>>& Weights;
+  vtkSMPThreadLocal<T> LocalMaxDist;
+  T MaxDist;
+
+  vtkSPDF_JacobiIteration(vtkSPDF_InternalParams<T>& params, const T* src, T* dst,
+    vtkSMPThreadLocalObject<vtkGenericCell>& cell, vtkSMPThreadLocal<std::vector<double>>& w)
+    : Params(params)
+    , Src(src)
+    , Dst(dst)
+    , Cell(cell)
+    , Weights(w)
+    , MaxDist(0)
+  {
+  }
+
+  void Initialize()
+  {
+    this->LocalMaxDist.Local() = 0;
+    if (this->Params.source)
+    {
+      this->Weights.Local().resize(this->Params.source->GetMaxCellSize());
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    T& maxDist = this->LocalMaxDist.Local();
+    vtkGenericCell* cell = this->Cell.Local();
+    double* w = this->Weights.Local().data();
+    T deltaX[3];
+    double xNew[3];
+
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const T* x = this->Src + 3 * i;
+      T* newX = this->Dst + 3 * i;
+      const vtkIdType npts = this->Params.offsets[i + 1] - this->Params.offsets[i];
+      if (npts == 0)
+      {
+        newX[0] = x[0];
+        newX[1] = x[1];
+        newX[2] = x[2];
+        continue;
+      }
+
+      // Compute the mean (cumulated) direction vector and move the point
+      deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
+      const vtkIdType* edgeIdPtr = this->Params.neighbors + this->Params.offsets[i];
+      for (vtkIdType j = 0; j < npts; ++j, ++edgeIdPtr)
+      {
+        for (int k = 0; k < 3; ++k)
+        {
+          deltaX[k] += this->Src[3 * (*edgeIdPtr) + k];
+        }
+      }
+      for (int k = 0; k < 3; ++k)
+      {
+        newX[k] = x[k] + this->Params.factor * (deltaX[k] / npts - x[k]);
+      }
+
+      // Constrain point to surface
+      if (this->Params.source)
+      {
+        for (int k = 0; k < 3; ++k)
+        {
+          xNew[k] = newX[k];
+        }
+        vtkSPDF_ConstrainPoint(this->Params.source, this->Params.cellLocator,
+          this->Params.SmoothPoints->GetSmoothPoint(i), cell, w, xNew);
+        for (int k = 0; k < 3; ++k)
+        {
+          newX[k] = static_cast<T>(xNew[k]);
+        }
+      }
+
+      const T dist = vtkMath::Norm(deltaX);
+      if (dist > maxDist)
+      {
+        maxDist = dist;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for (const T& dist : this->LocalMaxDist)
+    {
+      this->MaxDist = std::max(this->MaxDist, dist);
+    }
+  }
+};
+
+template <typename T>
+void vtkSPDF_MovePointsJacobi(vtkSPDF_InternalParams<T>& params)
+{
+  T* coords = static_cast<T*>(params.newPts->GetVoidPointer(0));
+  std::vector<T> buffer(coords, coords + 3 * params.numPts);
+  T* src = coords;
+  T* dst = buffer.data();
+  vtkSMPThreadLocalObject<vtkGenericCell> cell;
+  vtkSMPThreadLocal<std::vector<double>> w;
+
+  int iterationNumber = 0;
+  for (T maxDist = std::numeric_limits<T>::max();
+       maxDist > params.conv && iterationNumber < params.numberOfIterations; ++iterationNumber)
+  {
+    if (iterationNumber && !(iterationNumber % 5))
+    {
+      params.spdf->UpdateProgress(0.5 + 0.5 * iterationNumber / params.numberOfIterations);
+      if (params.spdf->CheckAbort())
+      {
+        break;
+      }
+    }
+
+    vtkSPDF_JacobiIteration<T> iteration(params, src, dst, cell, w);
+    vtkSMPTools::For(0, params.numPts, iteration);
+    maxDist = iteration.MaxDist;
+    std::swap(src, dst);
+  }
+
+  if (src != coords)
+  {
+    std::copy(src, src + 3 * params.numPts, coords);
+  }
+
+  vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
+}
+
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -316,7 +476,6 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   double CosFeatureAngle; // Cosine of angle between adjacent polys
   double CosEdgeAngle;    // Cosine of angle between adjacent edges
   double closestPt[3], dist2;
-  std::vector<double> w;
   vtkIdType numSimple = 0, numBEdges = 0, numFixed = 0, numFEdges = 0;
   vtkPolyData* Mesh;
   vtkPoints* inPts;
@@ -642,6 +801,33 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   (void)numFixed;
   (void)numFEdges;
 
+  // Gather the points connected to each point that can be smoothed in flat
+  // arrays, and free up the connectivity storage
+  std::vector<vtkIdType> offsets(numPts + 1);
+  offsets[0] = 0;
+  for (i = 0; i < numPts; i++)
+  {
+    npts = 0;
+    if (Verts[i].type != VTK_FIXED_VERTEX && Verts[i].edges)
+    {
+      npts = Verts[i].edges->GetNumberOfIds();
+    }
+    offsets[i + 1] = offsets[i] + npts;
+  }
+  std::vector<vtkIdType> neighbors(offsets[numPts]);
+  for (i = 0; i < numPts; i++)
+  {
+    if (offsets[i + 1] > offsets[i])
+    {
+      std::copy(Verts[i].edges->begin(), Verts[i].edges->end(), neighbors.begin() + offsets[i]);
+    }
+    if (Verts[i].edges)
+    {
+      Verts[i].edges->Delete();
+      Verts[i].edges = nullptr;
+    }
+  }
+
   vtkDebugMacro(<< "Beginning smoothing iterations...");
 
   // We've setup the topology...now perform Laplacian smoothing
@@ -672,9 +858,13 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
     this->SmoothPoints = std::unique_ptr<vtkSmoothPoints>(new vtkSmoothPoints);
     vtkSmoothPoint* sPtr;
     cellLocator.TakeReference(vtkCellLocator::New());
-    w.reserve(source->GetMaxCellSize());
     cellLocator->SetDataSet(source);
     cellLocator->BuildLocator();
+    // the cells of the source are built once, before the threads query them
+    if (source->NeedToBuildCells())
+    {
+      source->BuildCells();
+    }
 
     for (i = 0; i < numPts; i++)
     {
@@ -695,18 +885,32 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   if (newPts->GetDataType() == VTK_DOUBLE)
   {
     vtkSPDF_InternalParams<double> params = { this, this->NumberOfIterations, newPts,
-      this->RelaxationFactor, conv, numPts, Verts, source, this->SmoothPoints.get(), w.data(),
-      cellLocator };
+      this->RelaxationFactor, conv, numPts, offsets.data(), neighbors.data(), source,
+      this->SmoothPoints.get(), cellLocator };
 
-    vtkSPDF_MovePoints(params);
+    if (this->IterationMethod == JACOBI)
+    {
+      vtkSPDF_MovePointsJacobi(params);
+    }
+    else
+    {
+      vtkSPDF_MovePoints(params);
+    }
   }
   else
   {
     vtkSPDF_InternalParams<float> params = { this, this->NumberOfIterations, newPts,
-      static_cast<float>(this->RelaxationFactor), static_cast<float>(conv), numPts, Verts, source,
-      this->SmoothPoints.get(), w.data(), cellLocator };
+      static_cast<float>(this->RelaxationFactor), static_cast<float>(conv), numPts,
+      offsets.data(), neighbors.data(), source, this->SmoothPoints.get(), cellLocator };
 
-    vtkSPDF_MovePoints(params);
+    if (this->IterationMethod == JACOBI)
+    {
+      vtkSPDF_MovePointsJacobi(params);
+    }
+    else
+    {
+      vtkSPDF_MovePoints(params);
+    }
   }
 
   // Release memory if it's been allocated
@@ -756,16 +960,6 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   output->SetPolys(input->GetPolys());
   output->SetStrips(input->GetStrips());
 
-  // free up connectivity storage
-  for (i = 0; i < numPts; i++)
-  {
-    if (Verts[i].edges)
-    {
-      Verts[i].edges->Delete();
-      Verts[i].edges = nullptr;
-    }
-  }
-
   return 1;
 }
 
@@ -808,5 +1002,7 @@ void vtkSmoothPolyDataFilter::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Iteration Method: "
+     << (this->IterationMethod == JACOBI ? "Jacobi\n" : "Gauss-Seidel\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -77,6 +77,14 @@
  * second input: the Source. If defined, the input mesh is constrained to
  * lie on the surface defined by the Source ivar.
  *
+ * By default, the points are moved in place one after the other during an
+ * iteration (Gauss-Seidel iterations), so that the result depends on the
+ * order of the points. With the Jacobi IterationMethod, all the points are
+ * moved from their positions at the previous iteration, which allows the
+ * iterations to be performed in parallel with vtkSMPTools at the cost of an
+ * additional copy of the points. Jacobi iterations smooth slightly less per
+ * iteration.
+ *
  *
  * @warning
  * The Laplacian operation reduces high frequency information in the geometry
@@ -225,6 +233,29 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  /**
+   * The methods used to perform the smoothing iterations.
+   */
+  enum IterationMethods
+  {
+    GAUSS_SEIDEL = 0,
+    JACOBI = 1
+  };
+
+  ///@{
+  /**
+   * Specify how the points are moved during an iteration. With GAUSS_SEIDEL
+   * (the default), the points are moved in place, serially. With JACOBI,
+   * the points are moved from their positions at the previous iteration
+   * into a second buffer, in parallel. Both methods support all the other
+   * options, including the Source.
+   */
+  vtkSetClampMacro(IterationMethod, int, GAUSS_SEIDEL, JACOBI);
+  vtkGetMacro(IterationMethod, int);
+  void SetIterationMethodToGaussSeidel() { this->SetIterationMethod(GAUSS_SEIDEL); }
+  void SetIterationMethodToJacobi() { this->SetIterationMethod(JACOBI); }
+  ///@}
+
 protected:
   vtkSmoothPolyDataFilter();
   ~vtkSmoothPolyDataFilter() override;
@@ -242,6 +273,7 @@ protected:
   vtkTypeBool GenerateErrorScalars;
   vtkTypeBool GenerateErrorVectors;
   int OutputPointsPrecision;
+  int IterationMethod;
 
   std::unique_ptr<vtkSmoothPoints> SmoothPoints;
 
@@ -17,6 +17,7 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdListCollection.h"
@@ -61,6 +62,9 @@ vtkSynchronizedTemplates3D::vtkSynchronizedTemplates3D()
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+
+  // RequestData() only uses its arguments, blocks can be processed concurrently.
+  this->GetInformation()->Set(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION(), 1);
 }
 
 //------------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
@@ -54,6 +55,9 @@ vtkSynchronizedTemplatesCutter3D::vtkSynchronizedTemplatesCutter3D()
 {
   this->CutFunction = nullptr;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
+
+  // The cut function may not support concurrent evaluation.
+  this->GetInformation()->Remove(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION());
 }
 
 //------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 
 #include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkEventForwarderCommand.h"
 #include "vtkExtractCells.h"
 #include "vtkIdList.h"
@@ -48,6 +49,9 @@ vtkThreshold::vtkThreshold()
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS_THEN_CELLS, vtkDataSetAttributes::SCALARS);
+
+  // RequestData() only uses its arguments, blocks can be processed concurrently.
+  this->GetInformation()->Set(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION(), 1);
 }
 
 vtkThreshold::~vtkThreshold() = default;
@@ -274,7 +278,6 @@ int vtkThreshold::RequestData(
 
   // are we using pointScalars?
   int fieldAssociation = this->GetInputArrayAssociation(0, inputVector);
-  this->NumberOfComponents = inScalars->GetNumberOfComponents();
   bool usePointScalars = fieldAssociation == vtkDataObject::FIELD_ASSOCIATION_POINTS;
 
   auto keptCellsList = vtkSmartPointer<vtkIdList>::New(); // maps old point ids into new
@@ -323,24 +326,25 @@ template <typename TScalarsArray>
 int vtkThreshold::EvaluateCell(
   TScalarsArray& scalars, const vtkIdType* cellPts, vtkIdType numCellPts)
 {
+  const int numComponents = static_cast<int>(scalars.GetTupleSize());
   int c(0);
   int keepCell(0);
   switch (this->ComponentMode)
   {
     case VTK_COMPONENT_MODE_USE_SELECTED:
-      c = this->SelectedComponent < this->NumberOfComponents ? this->SelectedComponent : 0;
+      c = this->SelectedComponent < numComponents ? this->SelectedComponent : 0;
       keepCell = EvaluateCell(scalars, c, cellPts, numCellPts);
       break;
     case VTK_COMPONENT_MODE_USE_ANY:
       keepCell = 0;
-      for (c = 0; (!keepCell) && (c < this->NumberOfComponents); c++)
+      for (c = 0; (!keepCell) && (c < numComponents); c++)
       {
         keepCell = EvaluateCell(scalars, c, cellPts, numCellPts);
       }
       break;
     case VTK_COMPONENT_MODE_USE_ALL:
       keepCell = 1;
-      for (c = 0; keepCell && (c < this->NumberOfComponents); c++)
+      for (c = 0; keepCell && (c < numComponents); c++)
       {
         keepCell = EvaluateCell(scalars, c, cellPts, numCellPts);
       }
@@ -370,24 +374,25 @@ int vtkThreshold::EvaluateCell(
 template <typename TScalarsArray>
 int vtkThreshold::EvaluateComponents(TScalarsArray& scalars, vtkIdType id)
 {
+  const int numComponents = static_cast<int>(scalars.GetTupleSize());
   int keepCell = 0;
   int c;
   switch (this->ComponentMode)
   {
     case VTK_COMPONENT_MODE_USE_SELECTED:
-      c = this->SelectedComponent < this->NumberOfComponents ? this->SelectedComponent : 0;
+      c = this->SelectedComponent < numComponents ? this->SelectedComponent : 0;
       keepCell = (this->*(this->ThresholdFunction))(static_cast<double>(scalars[id][c]));
       break;
     case VTK_COMPONENT_MODE_USE_ANY:
       keepCell = 0;
-      for (c = 0; (!keepCell) && (c < this->NumberOfComponents); c++)
+      for (c = 0; (!keepCell) && (c < numComponents); c++)
       {
         keepCell = (this->*(this->ThresholdFunction))(static_cast<double>(scalars[id][c]));
       }
       break;
     case VTK_COMPONENT_MODE_USE_ALL:
       keepCell = 1;
-      for (c = 0; keepCell && (c < this->NumberOfComponents); c++)
+      for (c = 0; keepCell && (c < numComponents); c++)
       {
         keepCell = (this->*(this->ThresholdFunction))(static_cast<double>(scalars[id][c]));
       }
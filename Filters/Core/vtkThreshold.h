@@ -277,8 +277,6 @@ protected:
 private:
   vtkThreshold(const vtkThreshold&) = delete;
   void operator=(const vtkThreshold&) = delete;
-
-  int NumberOfComponents;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -14,19 +14,137 @@
 =========================================================================*/
 #include "vtkTriangleFilter.h"
 
+#include "vtkArrayListTemplate.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangleStrip.h"
 
+#include <algorithm>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTriangleFilter);
 
+namespace
+{
+// Polygons are triangulated in parallel by batches of consecutive cells. Each
+// batch keeps its triangles so that they are written in input order.
+const vtkIdType PolygonBatchSize = 1000;
+
+struct TriangleBatch
+{
+  std::vector<vtkIdType> Triangles;   // three point ids per triangle
+  std::vector<vtkIdType> SourceCells; // input cell of each triangle
+};
+
+struct TriangulatePolygons
+{
+  vtkCellArray* Polys;
+  vtkPoints* Points;
+  vtkIdType FirstCellId; // input cell id of the first polygon
+  double Tolerance;
+  std::vector<TriangleBatch>& Batches;
+  vtkTriangleFilter* Filter;
+
+  vtkSMPThreadLocalObject<vtkPolygon> Polygon;
+  vtkSMPThreadLocalObject<vtkIdList> CellPointIds;
+  vtkSMPThreadLocalObject<vtkIdList> TrianglePointIds;
+
+  TriangulatePolygons(vtkCellArray* polys, vtkPoints* points, vtkIdType firstCellId,
+    double tolerance, std::vector<TriangleBatch>& batches, vtkTriangleFilter* filter)
+    : Polys(polys)
+    , Points(points)
+    , FirstCellId(firstCellId)
+    , Tolerance(tolerance)
+    , Batches(batches)
+    , Filter(filter)
+  {
+  }
+
+  void Initialize()
+  {
+    // It may be necessary to specify a custom tessellation tolerance.
+    if (this->Tolerance > 0.0)
+    {
+      this->Polygon.Local()->SetTolerance(this->Tolerance); // Tighten tessellation tolerance
+    }
+  }
+
+  void operator()(vtkIdType beginBatch, vtkIdType endBatch)
+  {
+    vtkPolygon* poly = this->Polygon.Local();
+    vtkIdList* cellPtIds = this->CellPointIds.Local();
+    vtkIdList* ptIds = this->TrianglePointIds.Local();
+    const vtkIdType numPolys = this->Polys->GetNumberOfCells();
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double x[3];
+
+    for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+    {
+      if (isFirst)
+      {
+        this->Filter->CheckAbort();
+      }
+      if (this->Filter->GetAbortOutput())
+      {
+        break;
+      }
+
+      TriangleBatch& batch = this->Batches[batchId];
+      const vtkIdType endCellId = std::min((batchId + 1) * PolygonBatchSize, numPolys);
+      for (vtkIdType cellId = batchId * PolygonBatchSize; cellId < endCellId; ++cellId)
+      {
+        this->Polys->GetCellAtId(cellId, npts, pts, cellPtIds);
+        if (npts == 0)
+        {
+          continue;
+        }
+        if (npts == 3)
+        {
+          batch.Triangles.insert(batch.Triangles.end(), pts, pts + 3);
+          batch.SourceCells.push_back(this->FirstCellId + cellId);
+        }
+        else // triangulate polygon
+        {
+          // initialize polygon
+          poly->PointIds->SetNumberOfIds(npts);
+          poly->Points->SetNumberOfPoints(npts);
+          for (vtkIdType i = 0; i < npts; i++)
+          {
+            poly->PointIds->SetId(i, pts[i]);
+            this->Points->GetPoint(pts[i], x);
+            poly->Points->SetPoint(i, x);
+          }
+          poly->Triangulate(ptIds);
+          const vtkIdType numSimplices = ptIds->GetNumberOfIds() / 3;
+          for (vtkIdType i = 0; i < numSimplices; i++)
+          {
+            for (int j = 0; j < 3; j++)
+            {
+              batch.Triangles.push_back(poly->PointIds->GetId(ptIds->GetId(3 * i + j)));
+            }
+            batch.SourceCells.push_back(this->FirstCellId + cellId);
+          } // for each simplex
+        }   // triangulate polygon
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
 //-------------------------------------------------------------------------
 int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -41,10 +159,9 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   vtkIdType numCells = input->GetNumberOfCells();
   vtkIdType cellNum = 0;
-  vtkIdType numPts, newId;
   vtkIdType npts = 0;
   const vtkIdType* pts = nullptr;
-  int i, j;
+  int i;
   vtkCellData* inCD = input->GetCellData();
   vtkCellData* outCD = output->GetCellData();
   vtkIdType updateInterval;
@@ -53,7 +170,11 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   bool abort = false;
   updateInterval = numCells / 100 + 1;
-  outCD->CopyAllocate(inCD, numCells);
+
+  // input cell of each output cell, the cell data is copied once all the
+  // output cells are known
+  std::vector<vtkIdType> sourceCells;
+  sourceCells.reserve(numCells);
 
   // Do each of the verts, lines, polys, and strips separately
   // verts
@@ -62,7 +183,6 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
     cells = input->GetVerts();
     if (this->PassVerts)
     {
-      newId = output->GetNumberOfCells();
       vtkNew<vtkCellArray> newCells;
       newCells->AllocateCopy(cells);
       for (cells->InitTraversal(); cells->GetNextCell(npts, pts) && !abort; cellNum++)
@@ -77,13 +197,13 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
           for (i = 0; i < npts; i++)
           {
             newCells->InsertNextCell(1, pts + i);
-            outCD->CopyData(inCD, cellNum, newId++);
+            sourceCells.push_back(cellNum);
           }
         }
         else
         {
           newCells->InsertNextCell(1, pts);
-          outCD->CopyData(inCD, cellNum, newId++);
+          sourceCells.push_back(cellNum);
         }
       }
       output->SetVerts(newCells);
@@ -100,7 +220,6 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
     cells = input->GetLines();
     if (this->PassLines)
     {
-      newId = output->GetNumberOfCells();
       vtkNew<vtkCellArray> newCells;
       newCells->AllocateCopy(cells);
       for (cells->InitTraversal(); cells->GetNextCell(npts, pts) && !abort; cellNum++)
@@ -115,13 +234,13 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
           for (i = 0; i < (npts - 1); i++)
           {
             newCells->InsertNextCell(2, pts + i);
-            outCD->CopyData(inCD, cellNum, newId++);
+            sourceCells.push_back(cellNum);
           }
         }
         else
         {
           newCells->InsertNextCell(2, pts);
-          outCD->CopyData(inCD, cellNum, newId++);
+          sourceCells.push_back(cellNum);
         }
       } // for all lines
       output->SetLines(newCells);
@@ -138,69 +257,56 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
   if (!abort && input->GetPolys()->GetNumberOfCells() > 0)
   {
     cells = input->GetPolys();
-    newId = output->GetNumberOfCells();
-    newPolys = vtkSmartPointer<vtkCellArray>::New();
-    newPolys->AllocateCopy(cells);
-    output->SetPolys(newPolys);
-    vtkNew<vtkIdList> ptIds;
-    ptIds->Allocate(VTK_CELL_SIZE);
-    int numSimplices;
-    vtkIdType triPts[3];
-    // It may be necessary to specify a custom tessellation
-    // tolerance.
-    vtkNew<vtkPolygon> poly;
-    if (this->Tolerance > 0.0)
-    {
-      poly->SetTolerance(this->Tolerance); // Tighten tessellation tolerance
-    }
+    const vtkIdType numPolys = cells->GetNumberOfCells();
+    const vtkIdType numBatches = (numPolys - 1) / PolygonBatchSize + 1;
+    std::vector<TriangleBatch> batches(numBatches);
+    TriangulatePolygons triangulator(cells, inPts, cellNum, this->Tolerance, batches, this);
+    vtkSMPTools::For(0, numBatches, triangulator);
+    abort = this->GetAbortOutput();
+    cellNum += numPolys;
 
-    for (cells->InitTraversal(); cells->GetNextCell(npts, pts) && !abort; cellNum++)
+    // gather the triangles of all the batches in input order
+    std::vector<vtkIdType> batchOffsets(numBatches + 1, 0);
+    for (vtkIdType batchId = 0; batchId < numBatches; ++batchId)
     {
-      if (!(cellNum % updateInterval)) // manage progress reports / early abort
-      {
-        this->UpdateProgress((float)cellNum / numCells);
-        abort = this->CheckAbort();
-      }
-      if (npts == 0)
-      {
-        continue;
-      }
-      if (npts == 3)
-      {
-        newPolys->InsertNextCell(3, pts);
-        outCD->CopyData(inCD, cellNum, newId++);
-      }
-      else // triangulate polygon
+      batchOffsets[batchId + 1] =
+        batchOffsets[batchId] + static_cast<vtkIdType>(batches[batchId].SourceCells.size());
+    }
+    const vtkIdType numTris = batchOffsets[numBatches];
+    const vtkIdType firstTriId = static_cast<vtkIdType>(sourceCells.size());
+    sourceCells.resize(firstTriId + numTris);
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(numTris + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(3 * numTris);
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    vtkIdType* connPtr = connectivity->GetPointer(0);
+    vtkSMPTools::For(0, numBatches, [&](vtkIdType beginBatch, vtkIdType endBatch) {
+      for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
       {
-        // initialize polygon
-        poly->PointIds->SetNumberOfIds(npts);
-        poly->Points->SetNumberOfPoints(npts);
-        for (i = 0; i < npts; i++)
+        const TriangleBatch& batch = batches[batchId];
+        const vtkIdType firstId = batchOffsets[batchId];
+        std::copy(batch.Triangles.begin(), batch.Triangles.end(), connPtr + 3 * firstId);
+        std::copy(batch.SourceCells.begin(), batch.SourceCells.end(),
+          sourceCells.begin() + firstTriId + firstId);
+        const vtkIdType batchTris = static_cast<vtkIdType>(batch.SourceCells.size());
+        for (vtkIdType triId = 0; triId < batchTris; ++triId)
         {
-          poly->PointIds->SetId(i, pts[i]);
-          poly->Points->SetPoint(i, inPts->GetPoint(pts[i]));
+          offsetsPtr[firstId + triId] = 3 * (firstId + triId);
         }
-        poly->Triangulate(ptIds);
-        numPts = ptIds->GetNumberOfIds();
-        numSimplices = numPts / 3;
-        for (i = 0; i < numSimplices; i++)
-        {
-          for (j = 0; j < 3; j++)
-          {
-            triPts[j] = poly->PointIds->GetId(ptIds->GetId(3 * i + j));
-          }
-          newPolys->InsertNextCell(3, triPts);
-          outCD->CopyData(inCD, cellNum, newId++);
-        } // for each simplex
-      }   // triangulate polygon
-    }
+      }
+    });
+    offsetsPtr[numTris] = 3 * numTris;
+    newPolys = vtkSmartPointer<vtkCellArray>::New();
+    newPolys->SetData(offsets, connectivity);
+    output->SetPolys(newPolys);
+    this->UpdateProgress(static_cast<double>(cellNum) / numCells);
   }
 
   // strips
   if (!abort && input->GetStrips()->GetNumberOfCells() > 0)
   {
     cells = input->GetStrips();
-    newId = output->GetNumberOfCells();
     if (newPolys == nullptr)
     {
       newPolys = vtkSmartPointer<vtkCellArray>::New();
@@ -217,11 +323,23 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
       vtkTriangleStrip::DecomposeStrip(npts, pts, newPolys);
       for (i = 0; i < (npts - 2); i++)
       {
-        outCD->CopyData(inCD, cellNum, newId++);
+        sourceCells.push_back(cellNum);
       }
     } // for all strips
   }
 
+  // Copy the cell data of the output cells
+  const vtkIdType numNewCells = static_cast<vtkIdType>(sourceCells.size());
+  outCD->CopyAllocate(inCD, numNewCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numNewCells, inCD, outCD, 0.0, false);
+  vtkSMPTools::For(0, numNewCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      cellArrays.Copy(sourceCells[cellId], cellId);
+    }
+  });
+
   // Update output
   output->SetPoints(input->GetPoints());
   output->GetPointData()->PassData(input->GetPointData());
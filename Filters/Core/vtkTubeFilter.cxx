@@ -14,18 +14,28 @@
 =========================================================================*/
 #include "vtkTubeFilter.h"
 
+#include "vtkArrayListTemplate.h"
 #include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolyLine.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTubeFilter);
@@ -83,6 +93,32 @@ struct IdPointsEqual
   vtkPoints* Points;
 };
 
+// Buffers used by a thread to tube one polyline at a time. The VTK objects
+// are created by the first call to GetIterator(), in the thread using them.
+struct TubeLineBuffers
+{
+  std::vector<vtkIdType> Ids;
+  std::vector<vtkIdType> SourceIds;
+  vtkSmartPointer<vtkCellArrayIterator> Iterator;
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkCellArray> Line;
+  vtkSmartPointer<vtkFloatArray> Normals;
+
+  vtkCellArrayIterator* GetIterator(vtkCellArray* lines)
+  {
+    if (!this->Iterator)
+    {
+      this->Iterator.TakeReference(lines->NewIterator());
+      this->Points = vtkSmartPointer<vtkPoints>::New();
+      this->Points->SetDataTypeToDouble();
+      this->Line = vtkSmartPointer<vtkCellArray>::New();
+      this->Normals = vtkSmartPointer<vtkFloatArray>::New();
+      this->Normals->SetNumberOfComponents(3);
+    }
+    return this->Iterator;
+  }
+};
+
 }
 
 int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
@@ -108,19 +144,8 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPoints* inPts;
   vtkIdType numPts;
   vtkIdType numLines;
-  vtkIdType numNewPts, numNewCells;
-  vtkPoints* newPts;
-  int deleteNormals = 0;
-  vtkFloatArray* newNormals;
-  vtkIdType i;
+  vtkIdType numNewPts, numNewCells, numNewConn;
   double range[2], maxSpeed = 0;
-  vtkCellArray* newStrips;
-  vtkIdType npts = 0;
-  const vtkIdType* ptsOrig = nullptr;
-  vtkIdType offset = 0;
-  vtkFloatArray* newTCoords = nullptr;
-  bool abort = false;
-  vtkIdType inCellId;
   double oldRadius = 1.0;
 
   // Check input and initialize
@@ -133,69 +158,12 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  // Create the geometry and topology
-  numNewPts = numPts * this->NumberOfSides;
-  newPts = vtkPoints::New();
-
-  // Set the desired precision for the points in the output.
-  if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
-  {
-    newPts->SetDataType(inPts->GetDataType());
-  }
-  else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
-  {
-    newPts->SetDataType(VTK_FLOAT);
-  }
-  else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
-  {
-    newPts->SetDataType(VTK_DOUBLE);
-  }
-
-  newPts->Allocate(numNewPts);
-  newNormals = vtkFloatArray::New();
-  newNormals->SetName("TubeNormals");
-  newNormals->SetNumberOfComponents(3);
-  newNormals->Allocate(3 * numNewPts);
-  newStrips = vtkCellArray::New();
-  newStrips->AllocateEstimate(1, numNewPts);
-  vtkCellArray* singlePolyline = vtkCellArray::New();
-
-  // Point data: copy scalars, vectors, tcoords. Normals may be computed here.
-  outPD->CopyNormalsOff();
-  if ((this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS && inScalars) ||
-    this->GenerateTCoords == VTK_TCOORDS_FROM_LENGTH ||
-    this->GenerateTCoords == VTK_TCOORDS_FROM_NORMALIZED_LENGTH)
-  {
-    newTCoords = vtkFloatArray::New();
-    newTCoords->SetNumberOfComponents(2);
-    newTCoords->Allocate(numNewPts);
-    outPD->CopyTCoordsOff();
-  }
-  outPD->CopyAllocate(pd, numNewPts);
-
-  int generateNormals = 0;
-  if (!(inNormals = pd->GetNormals()) || this->UseDefaultNormal)
-  {
-    deleteNormals = 1;
-    inNormals = vtkFloatArray::New();
-    inNormals->SetNumberOfComponents(3);
-    inNormals->SetNumberOfTuples(numPts);
-
-    if (this->UseDefaultNormal)
-    {
-      for (i = 0; i < numPts; i++)
-      {
-        inNormals->SetTuple(i, this->DefaultNormal);
-      }
-    }
-    else
-    {
-      // Normal generation has been moved to lower in the function.
-      // This allows each different polylines to share vertices, but have
-      // their normals (and hence their tubes) calculated independently
-      generateNormals = 1;
-    }
-  }
+  // Normals are taken from the input, set to the default normal, or computed
+  // for each polyline independently. This allows different polylines to share
+  // vertices, but have their normals (and hence their tubes) calculated
+  // independently.
+  inNormals = this->UseDefaultNormal ? nullptr : pd->GetNormals();
+  const bool generateNormals = !inNormals && !this->UseDefaultNormal;
 
   // If varying width, get appropriate info.
   //
@@ -226,69 +194,228 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
     maxSpeed = inVectors->GetMaxNorm();
   }
 
-  // Copy selected parts of cell data; certainly don't want normals
-  //
-  numNewCells = inLines->GetNumberOfCells() * this->NumberOfSides + 2;
-  outCD->CopyNormalsOff();
-  outCD->CopyAllocate(cd, numNewCells);
-
-  //  Create points along each polyline that are connected into NumberOfSides
-  //  triangle strips. Texture coordinates are optionally generated.
-  //
   this->Theta = 2.0 * vtkMath::Pi() / this->NumberOfSides;
-  vtkPolyLine* lineNormalGenerator = vtkPolyLine::New();
-  // the line cellIds start after the last vert cellId
-  inCellId = input->GetNumberOfVerts();
-  int checkAbortInterval = std::min(numLines / 10 + 1, (vtkIdType)1000);
-  int progressCounter = 0;
-  for (inLines->InitTraversal(); inLines->GetNextCell(npts, ptsOrig) && !abort; inCellId++)
-  {
-    this->UpdateProgress((double)inCellId / numLines);
-    if (progressCounter % checkAbortInterval == 0 && this->CheckAbort())
+
+  // The polylines are tubed concurrently, in two passes. The first pass
+  // removes the degenerate segments of each polyline and checks that a tube
+  // can be generated around it. The output of each polyline is then located
+  // with a prefix sum, and the second pass generates the tubes in place.
+  vtkSMPThreadLocal<TubeLineBuffers> localBuffers;
+
+  // Fill the buffers with the point ids of a polyline, without its degenerate
+  // segments, and with the normals of these points. Return the number of
+  // points left, 0 if the polyline is skipped, or -1 if no tube can be
+  // generated around it.
+  auto prepareLine = [&](vtkIdType lineId, TubeLineBuffers& buffers) -> vtkIdType {
+    vtkIdType npts;
+    const vtkIdType* ptsOrig;
+    buffers.GetIterator(inLines)->GetCellAtId(lineId, npts, ptsOrig);
+    if (npts < 2)
     {
-      abort = this->CheckAbort();
-      break;
+      return 0; // skip tubing this polyline
     }
-    progressCounter++;
 
     // Make a copy of point indices to avoid modifying input polydata cells
     // while removing degenerate lines.
-    if (npts < 2)
-    {
-      continue; // skip tubing this polyline
-    }
-    std::vector<vtkIdType> ptsCopy(ptsOrig, ptsOrig + npts);
-    vtkIdType* pts = ptsCopy.data();
+    buffers.Ids.assign(ptsOrig, ptsOrig + npts);
+    vtkIdType* pts = buffers.Ids.data();
 
     // remove degenerate lines to avoid warnings
     npts = static_cast<vtkIdType>(std::unique(pts, pts + npts, IdPointsEqual(inPts)) - pts);
     if (npts < 2)
     {
-      continue; // skip tubing this polyline
+      return 0; // skip tubing this polyline
     }
 
-    // If necessary calculate normals, each polyline calculates its
-    // normals independently, avoiding conflicts at shared vertices.
+    vtkDataArray* lineNormals = buffers.Normals;
+    lineNormals->SetNumberOfTuples(npts);
     if (generateNormals)
     {
-      singlePolyline->Reset(); // avoid instantiation
-      singlePolyline->InsertNextCell(npts, pts);
-      vtkPolyLine::GenerateSlidingNormals(inPts, singlePolyline, inNormals);
+      double x[3];
+      buffers.Points->SetNumberOfPoints(npts);
+      buffers.Line->Reset();
+      buffers.Line->InsertNextCell(static_cast<int>(npts));
+      for (vtkIdType j = 0; j < npts; j++)
+      {
+        inPts->GetPoint(pts[j], x);
+        buffers.Points->SetPoint(j, x);
+        buffers.Line->InsertCellPoint(j);
+      }
+      vtkPolyLine::GenerateSlidingNormals(buffers.Points, buffers.Line, lineNormals);
+    }
+    else
+    {
+      double n[3] = { this->DefaultNormal[0], this->DefaultNormal[1], this->DefaultNormal[2] };
+      for (vtkIdType j = 0; j < npts; j++)
+      {
+        if (inNormals)
+        {
+          inNormals->GetTuple(pts[j], n);
+        }
+        lineNormals->SetTuple(j, n);
+      }
+    }
+
+    // Check that the points around the polyline can be generated.
+    if (!this->GeneratePoints(0, npts, pts, inPts, nullptr, nullptr, nullptr, inScalars, range,
+          inVectors, maxSpeed, lineNormals))
+    {
+      return -1;
     }
+    return npts;
+  };
 
-    // Generate the points around the polyline. The tube is not stripped
-    // if the polyline is bad.
+  // Run functor(lineId, buffers) for all polylines, concurrently.
+  auto forEachLine = [&](const std::function<void(vtkIdType, TubeLineBuffers&)>& functor) {
+    vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+      TubeLineBuffers& buffers = localBuffers.Local();
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      vtkIdType checkAbortInterval = std::min((endLineId - lineId) / 10 + 1, (vtkIdType)1000);
+      for (; lineId < endLineId; ++lineId)
+      {
+        if (lineId % checkAbortInterval == 0)
+        {
+          if (isFirst)
+          {
+            this->CheckAbort();
+          }
+          if (this->GetAbortOutput())
+          {
+            break;
+          }
+        }
+        functor(lineId, buffers);
+      }
+    });
+  };
+
+  // First pass: the number of points of each polyline to tube.
+  std::vector<vtkIdType> lineNumberOfPoints(numLines);
+  std::atomic<vtkIdType> numberOfBadLines(0);
+  forEachLine([&](vtkIdType lineId, TubeLineBuffers& buffers) {
+    vtkIdType npts = prepareLine(lineId, buffers);
+    if (npts < 0)
+    {
+      ++numberOfBadLines;
+      npts = 0;
+    }
+    lineNumberOfPoints[lineId] = npts;
+  });
+  this->UpdateProgress(0.5);
+  if (numberOfBadLines > 0)
+  {
+    vtkWarningMacro(<< "Could not generate points for " << numberOfBadLines << " polylines!");
+  }
+
+  // Locate the output of each polyline.
+  const vtkIdType numSideStrips = (this->NumberOfSides + this->OnRatio - 1) / this->OnRatio;
+  std::vector<vtkIdType> pointOffsets(numLines + 1, 0);
+  std::vector<vtkIdType> cellOffsets(numLines + 1, 0);
+  std::vector<vtkIdType> connOffsets(numLines + 1, 0);
+  for (vtkIdType lineId = 0; lineId < numLines; lineId++)
+  {
+    const vtkIdType npts = lineNumberOfPoints[lineId];
+    pointOffsets[lineId + 1] = pointOffsets[lineId];
+    cellOffsets[lineId + 1] = cellOffsets[lineId];
+    connOffsets[lineId + 1] = connOffsets[lineId];
+    if (npts > 0)
+    {
+      pointOffsets[lineId + 1] = this->ComputeOffset(pointOffsets[lineId], npts);
+      cellOffsets[lineId + 1] += numSideStrips + (this->Capping ? 2 : 0);
+      connOffsets[lineId + 1] +=
+        numSideStrips * 2 * npts + (this->Capping ? 2 * this->NumberOfSides : 0);
+    }
+  }
+  numNewPts = pointOffsets[numLines];
+  numNewCells = cellOffsets[numLines];
+  numNewConn = connOffsets[numLines];
+
+  // Create the geometry and topology
+  vtkNew<vtkPoints> newPts;
+
+  // Set the desired precision for the points in the output.
+  if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
+  {
+    newPts->SetDataType(inPts->GetDataType());
+  }
+  else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
+  {
+    newPts->SetDataType(VTK_FLOAT);
+  }
+  else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+  {
+    newPts->SetDataType(VTK_DOUBLE);
+  }
+
+  newPts->SetNumberOfPoints(numNewPts);
+  vtkNew<vtkFloatArray> newNormals;
+  newNormals->SetName("TubeNormals");
+  newNormals->SetNumberOfComponents(3);
+  newNormals->SetNumberOfTuples(numNewPts);
+  vtkNew<vtkIdTypeArray> newOffsets;
+  newOffsets->SetNumberOfValues(numNewCells + 1);
+  newOffsets->SetValue(numNewCells, numNewConn);
+  vtkNew<vtkIdTypeArray> newConnectivity;
+  newConnectivity->SetNumberOfValues(numNewConn);
+
+  // Point data: copy scalars, vectors, tcoords. Normals may be computed here.
+  vtkSmartPointer<vtkFloatArray> newTCoords;
+  outPD->CopyNormalsOff();
+  if ((this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS && inScalars) ||
+    this->GenerateTCoords == VTK_TCOORDS_FROM_LENGTH ||
+    this->GenerateTCoords == VTK_TCOORDS_FROM_NORMALIZED_LENGTH)
+  {
+    newTCoords = vtkSmartPointer<vtkFloatArray>::New();
+    newTCoords->SetNumberOfComponents(2);
+    newTCoords->SetNumberOfTuples(numNewPts);
+    outPD->CopyTCoordsOff();
+  }
+  outPD->CopyAllocate(pd, numNewPts);
+  ArrayList pointArrays;
+  pointArrays.AddArrays(numNewPts, pd, outPD, 0.0, false);
+
+  // Copy selected parts of cell data; certainly don't want normals
+  //
+  outCD->CopyNormalsOff();
+  outCD->CopyAllocate(cd, numNewCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numNewCells, cd, outCD, 0.0, false);
+
+  // Second pass: create points along each polyline that are connected into
+  // NumberOfSides triangle strips. Texture coordinates are optionally
+  // generated.
+  //
+  // the line cellIds start after the last vert cellId
+  const vtkIdType firstLineCellId = input->GetNumberOfVerts();
+  vtkIdType* offsets = newOffsets->GetPointer(0);
+  vtkIdType* connectivity = newConnectivity->GetPointer(0);
+  forEachLine([&](vtkIdType lineId, TubeLineBuffers& buffers) {
+    if (lineNumberOfPoints[lineId] == 0 || prepareLine(lineId, buffers) <= 0)
+    {
+      return;
+    }
+    const vtkIdType npts = lineNumberOfPoints[lineId];
+    const vtkIdType* pts = buffers.Ids.data();
+    const vtkIdType offset = pointOffsets[lineId];
+
+    // Generate the points around the polyline.
     //
-    if (!this->GeneratePoints(offset, npts, pts, inPts, newPts, pd, outPD, newNormals, inScalars,
-          range, inVectors, maxSpeed, inNormals))
+    buffers.SourceIds.resize(pointOffsets[lineId + 1] - offset);
+    this->GeneratePoints(offset, npts, pts, inPts, newPts, buffers.SourceIds.data(), newNormals,
+      inScalars, range, inVectors, maxSpeed, buffers.Normals);
+    for (vtkIdType i = 0; i < static_cast<vtkIdType>(buffers.SourceIds.size()); i++)
     {
-      vtkWarningMacro(<< "Could not generate points!");
-      continue; // skip tubing this polyline
+      pointArrays.Copy(buffers.SourceIds[i], offset + i);
     }
 
     // Generate the strips for this polyline (including caps)
     //
-    this->GenerateStrips(offset, npts, pts, inCellId, cd, outCD, newStrips);
+    this->GenerateStrips(
+      offset, npts, cellOffsets[lineId], connOffsets[lineId], offsets, connectivity);
+    for (vtkIdType cellId = cellOffsets[lineId]; cellId < cellOffsets[lineId + 1]; cellId++)
+    {
+      cellArrays.Copy(firstLineCellId + lineId, cellId);
+    }
 
     // Generate the texture coordinates for this polyline
     //
@@ -296,13 +423,7 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
     {
       this->GenerateTextureCoords(offset, npts, pts, inPts, inScalars, newTCoords);
     }
-
-    // Compute the new offset for the next polyline
-    offset = this->ComputeOffset(offset, npts);
-
-  } // for all polylines
-
-  singlePolyline->Delete();
+  });
 
   // reset the radius to ite original value if necessary
   if (this->VaryRadius == VTK_VARY_RADIUS_BY_ABSOLUTE_SCALAR)
@@ -312,26 +433,18 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   // Update ourselves
   //
-  if (deleteNormals)
-  {
-    inNormals->Delete();
-  }
-
   if (newTCoords)
   {
     outPD->SetTCoords(newTCoords);
-    newTCoords->Delete();
   }
 
   output->SetPoints(newPts);
-  newPts->Delete();
 
+  vtkNew<vtkCellArray> newStrips;
+  newStrips->SetData(newOffsets, newConnectivity);
   output->SetStrips(newStrips);
-  newStrips->Delete();
 
   outPD->SetNormals(newNormals);
-  newNormals->Delete();
-  lineNormalGenerator->Delete();
 
   output->Squeeze();
 
@@ -339,9 +452,9 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
 }
 
 int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
-  vtkPoints* inPts, vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD,
-  vtkFloatArray* newNormals, vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors,
-  double maxSpeed, vtkDataArray* inNormals)
+  vtkPoints* inPts, vtkPoints* newPts, vtkIdType* sourceIds, vtkFloatArray* newNormals,
+  vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors, double maxSpeed,
+  vtkDataArray* lineNormals)
 {
   vtkIdType j;
   int i, k;
@@ -355,6 +468,7 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
   // double bevelAngle;
   double w[3];
   double nP[3];
+  double v[3];
   double sFactor = 1.0;
   double normal[3];
   vtkIdType ptId = offset;
@@ -400,11 +514,11 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
       }
     }
 
-    inNormals->GetTuple(pts[j], n);
+    lineNormals->GetTuple(j, n);
 
     if (vtkMath::Normalize(sNext) == 0.0)
     {
-      vtkWarningMacro(<< "Coincident points!");
+      // Coincident points
       return 0;
     }
 
@@ -415,12 +529,8 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     // if s is zero then just use sPrev cross n
     if (vtkMath::Normalize(s) == 0.0)
     {
-      vtkDebugMacro(<< "Using alternate bevel vector");
       vtkMath::Cross(sPrev, n, s);
-      if (vtkMath::Normalize(s) == 0.0)
-      {
-        vtkDebugMacro(<< "Using alternate bevel vector");
-      }
+      vtkMath::Normalize(s);
     }
 
     /*    if ( (bevelAngle = vtkMath::Dot(sNext,sPrev)) > 1.0 )
@@ -442,8 +552,7 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     vtkMath::Cross(s, n, w);
     if (vtkMath::Normalize(w) == 0.0)
     {
-      vtkWarningMacro(<< "Bad normal s = " << s[0] << " " << s[1] << " " << s[2] << " n = " << n[0]
-                      << " " << n[1] << " " << n[2]);
+      // Bad normal
       return 0;
     }
 
@@ -459,7 +568,8 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     }
     else if (inVectors && this->VaryRadius == VTK_VARY_RADIUS_BY_VECTOR)
     {
-      sFactor = sqrt((double)maxSpeed / vtkMath::Norm(inVectors->GetTuple(pts[j])));
+      inVectors->GetTuple(pts[j], v);
+      sFactor = sqrt((double)maxSpeed / vtkMath::Norm(v));
       if (sFactor > this->RadiusFactor)
       {
         sFactor = this->RadiusFactor;
@@ -467,19 +577,24 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     }
     else if (inVectors && this->VaryRadius == VTK_VARY_RADIUS_BY_VECTOR_NORM)
     {
-      sFactor =
-        1.0 + (this->RadiusFactor - 1.0) * vtkMath::Norm(inVectors->GetTuple(pts[j])) / maxSpeed;
+      inVectors->GetTuple(pts[j], v);
+      sFactor = 1.0 + (this->RadiusFactor - 1.0) * vtkMath::Norm(v) / maxSpeed;
     }
     else if (inScalars && this->VaryRadius == VTK_VARY_RADIUS_BY_ABSOLUTE_SCALAR)
     {
       sFactor = inScalars->GetComponent(pts[j], 0);
       if (sFactor < 0.0)
       {
-        vtkWarningMacro(<< "Scalar value less than zero, skipping line");
+        // Scalar value less than zero, skipping line
         return 0;
       }
     }
 
+    if (!newPts)
+    {
+      continue; // only checking that the points can be generated
+    }
+
     // create points around line
     if (this->SidesShareVertices)
     {
@@ -490,9 +605,9 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
           normal[i] = w[i] * cos((double)k * this->Theta) + nP[i] * sin((double)k * this->Theta);
           s[i] = p[i] + this->Radius * sFactor * normal[i];
         }
-        newPts->InsertPoint(ptId, s);
-        newNormals->InsertTuple(ptId, normal);
-        outPD->CopyData(pd, pts[j], ptId);
+        newPts->SetPoint(ptId, s);
+        newNormals->SetTuple(ptId, normal);
+        sourceIds[ptId - offset] = pts[j];
         ptId++;
       } // for each side
     }
@@ -517,19 +632,19 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
             nP[i] * sin((double)(k + 0.5) * this->Theta);
           s[i] = p[i] + this->Radius * sFactor * normal[i];
         }
-        newPts->InsertPoint(ptId, s);
-        newNormals->InsertTuple(ptId, n_right);
-        outPD->CopyData(pd, pts[j], ptId);
-        newPts->InsertPoint(ptId + 1, s);
-        newNormals->InsertTuple(ptId + 1, n_left);
-        outPD->CopyData(pd, pts[j], ptId + 1);
+        newPts->SetPoint(ptId, s);
+        newNormals->SetTuple(ptId, n_right);
+        sourceIds[ptId - offset] = pts[j];
+        newPts->SetPoint(ptId + 1, s);
+        newNormals->SetTuple(ptId + 1, n_left);
+        sourceIds[ptId + 1 - offset] = pts[j];
         ptId += 2;
       } // for each side
     }   // else separate vertices
   }     // for all points in polyline
 
   // Produce end points for cap. They are placed at tail end of points.
-  if (this->Capping)
+  if (newPts && this->Capping)
   {
     int numCapSides = this->NumberOfSides;
     int capIncr = 1;
@@ -543,13 +658,13 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     for (k = 0; k < numCapSides; k += capIncr)
     {
       newPts->GetPoint(offset + k, s);
-      newPts->InsertPoint(ptId, s);
-      newNormals->InsertTuple(ptId, startCapNorm);
-      outPD->CopyData(pd, pts[0], ptId);
+      newPts->SetPoint(ptId, s);
+      newNormals->SetTuple(ptId, startCapNorm);
+      sourceIds[ptId - offset] = pts[0];
       ptId++;
     }
     // the end cap
-    int endOffset = offset + (npts - 1) * this->NumberOfSides;
+    vtkIdType endOffset = offset + (npts - 1) * this->NumberOfSides;
     if (!this->SidesShareVertices)
     {
       endOffset = offset + 2 * (npts - 1) * this->NumberOfSides;
@@ -557,9 +672,9 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     for (k = 0; k < numCapSides; k += capIncr)
     {
       newPts->GetPoint(endOffset + k, s);
-      newPts->InsertPoint(ptId, s);
-      newNormals->InsertTuple(ptId, endCapNorm);
-      outPD->CopyData(pd, pts[npts - 1], ptId);
+      newPts->SetPoint(ptId, s);
+      newNormals->SetTuple(ptId, endCapNorm);
+      sourceIds[ptId - offset] = pts[npts - 1];
       ptId++;
     }
   } // if capping
@@ -567,13 +682,13 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
   return 1;
 }
 
-void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
-  const vtkIdType* vtkNotUsed(pts), vtkIdType inCellId, vtkCellData* cd, vtkCellData* outCD,
-  vtkCellArray* newStrips)
+void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts, vtkIdType cellId,
+  vtkIdType connId, vtkIdType* cellOffsets, vtkIdType* connectivity)
 {
-  vtkIdType i, outCellId;
+  vtkIdType i;
   int k;
   int i1, i2, i3;
+  vtkIdType* conn = connectivity + connId;
 
   if (this->SidesShareVertices)
   {
@@ -581,13 +696,12 @@ void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
     {
       i1 = k % this->NumberOfSides;
       i2 = (k + 1) % this->NumberOfSides;
-      outCellId = newStrips->InsertNextCell(npts * 2);
-      outCD->CopyData(cd, inCellId, outCellId);
+      cellOffsets[cellId++] = conn - connectivity;
       for (i = 0; i < npts; i++)
       {
         i3 = i * this->NumberOfSides;
-        newStrips->InsertCellPoint(offset + i2 + i3);
-        newStrips->InsertCellPoint(offset + i1 + i3);
+        *conn++ = offset + i2 + i3;
+        *conn++ = offset + i1 + i3;
       }
     } // for each side of the tube
   }
@@ -597,13 +711,12 @@ void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
     {
       i1 = 2 * (k % this->NumberOfSides) + 1;
       i2 = 2 * ((k + 1) % this->NumberOfSides);
-      outCellId = newStrips->InsertNextCell(npts * 2);
-      outCD->CopyData(cd, inCellId, outCellId);
+      cellOffsets[cellId++] = conn - connectivity;
       for (i = 0; i < npts; i++)
       {
         i3 = i * 2 * this->NumberOfSides;
-        newStrips->InsertCellPoint(offset + i2 + i3);
-        newStrips->InsertCellPoint(offset + i1 + i3);
+        *conn++ = offset + i2 + i3;
+        *conn++ = offset + i1 + i3;
       }
     } // for each side of the tube
   }
@@ -613,7 +726,6 @@ void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
   if (this->Capping)
   {
     vtkIdType startIdx = offset + npts * this->NumberOfSides;
-    vtkIdType idx;
 
     if (!this->SidesShareVertices)
     {
@@ -621,44 +733,38 @@ void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
     }
 
     // The start cap
-    outCellId = newStrips->InsertNextCell(this->NumberOfSides);
-    outCD->CopyData(cd, inCellId, outCellId);
-    newStrips->InsertCellPoint(startIdx);
-    newStrips->InsertCellPoint(startIdx + 1);
+    cellOffsets[cellId++] = conn - connectivity;
+    *conn++ = startIdx;
+    *conn++ = startIdx + 1;
     for (i1 = this->NumberOfSides - 1, i2 = 2, k = 0; k < (this->NumberOfSides - 2); k++)
     {
       if ((k % 2))
       {
-        idx = startIdx + i2;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = startIdx + i2;
         i2++;
       }
       else
       {
-        idx = startIdx + i1;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = startIdx + i1;
         i1--;
       }
     }
 
     // The end cap - reversed order to be consistent with normal
     startIdx += this->NumberOfSides;
-    outCellId = newStrips->InsertNextCell(this->NumberOfSides);
-    outCD->CopyData(cd, inCellId, outCellId);
-    newStrips->InsertCellPoint(startIdx);
-    newStrips->InsertCellPoint(startIdx + this->NumberOfSides - 1);
+    cellOffsets[cellId++] = conn - connectivity;
+    *conn++ = startIdx;
+    *conn++ = startIdx + this->NumberOfSides - 1;
     for (i1 = this->NumberOfSides - 2, i2 = 1, k = 0; k < (this->NumberOfSides - 2); k++)
     {
       if ((k % 2))
       {
-        idx = startIdx + i1;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = startIdx + i1;
         i1--;
       }
       else
       {
-        idx = startIdx + i2;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = startIdx + i2;
         i2++;
       }
     }
@@ -681,15 +787,15 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
   double s0, s;
   if (this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS)
   {
-    s0 = inScalars->GetTuple1(pts[0]);
+    s0 = inScalars->GetComponent(pts[0], 0);
     for (i = 0; i < npts; i++)
     {
-      s = inScalars->GetTuple1(pts[i]);
+      s = inScalars->GetComponent(pts[i], 0);
       tc = (s - s0) / this->TextureLength;
       for (k = 0; k < numSides; k++)
       {
         double tcy = static_cast<double>(k) / (numSides - 1);
-        newTCoords->InsertTuple2(offset + i * numSides + k, tc, tcy);
+        newTCoords->SetTuple2(offset + i * numSides + k, tc, tcy);
       }
     }
   }
@@ -705,7 +811,7 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
       for (k = 0; k < numSides; k++)
       {
         double tcy = static_cast<double>(k) / (numSides - 1);
-        newTCoords->InsertTuple2(offset + i * numSides + k, tc, tcy);
+        newTCoords->SetTuple2(offset + i * numSides + k, tc, tcy);
       }
 
       xPrev[0] = x[0];
@@ -735,7 +841,7 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
       for (k = 0; k < numSides; k++)
       {
         double tcy = static_cast<double>(k) / (numSides - 1);
-        newTCoords->InsertTuple2(offset + i * numSides + k, tc, tcy);
+        newTCoords->SetTuple2(offset + i * numSides + k, tc, tcy);
       }
       xPrev[0] = x[0];
       xPrev[1] = x[1];
@@ -752,13 +858,13 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
     // start cap
     for (ik = 0; ik < this->NumberOfSides; ik++)
     {
-      newTCoords->InsertTuple2(startIdx + ik, 0.0, 0.0);
+      newTCoords->SetTuple2(startIdx + ik, 0.0, 0.0);
     }
 
     // end cap
     for (ik = 0; ik < this->NumberOfSides; ik++)
     {
-      newTCoords->InsertTuple2(startIdx + this->NumberOfSides + ik, tc, 0.0);
+      newTCoords->SetTuple2(startIdx + this->NumberOfSides + ik, tc, 0.0);
     }
   }
 }
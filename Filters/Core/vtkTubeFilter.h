@@ -35,6 +35,9 @@
  * common use is to combine this filter with vtkStreamTracer to generate
  * streamtubes.
  *
+ * The polylines are tubed concurrently with vtkSMPTools: a first pass counts
+ * the points of each tube, and a second one generates them in place.
+ *
  * @warning
  * The number of tube sides must be greater than 3. If you wish to use fewer
  * sides (i.e., a ribbon), use vtkRibbonFilter.
@@ -253,13 +256,16 @@ protected:
   int OutputPointsPrecision;
   double TextureLength; // this length is mapped to [0,1) texture space
 
-  // Helper methods
+  // Helper methods. They write the output of a polyline in place, in arrays
+  // sized for the whole output, so that polylines can be tubed concurrently.
+  // lineNormals holds the normals of the npts points of the polyline, and
+  // sourceIds receives the input point id of each generated point. When
+  // newPts is nullptr, GeneratePoints only checks that a tube can be generated.
   int GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkPoints* inPts,
-    vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD, vtkFloatArray* newNormals,
-    vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors, double maxSpeed,
-    vtkDataArray* inNormals);
-  void GenerateStrips(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkIdType inCellId,
-    vtkCellData* cd, vtkCellData* outCD, vtkCellArray* newStrips);
+    vtkPoints* newPts, vtkIdType* sourceIds, vtkFloatArray* newNormals, vtkDataArray* inScalars,
+    double range[2], vtkDataArray* inVectors, double maxSpeed, vtkDataArray* lineNormals);
+  void GenerateStrips(vtkIdType offset, vtkIdType npts, vtkIdType cellId, vtkIdType connId,
+    vtkIdType* cellOffsets, vtkIdType* connectivity);
   void GenerateTextureCoords(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
     vtkPoints* inPts, vtkDataArray* inScalars, vtkFloatArray* newTCoords);
   vtkIdType ComputeOffset(vtkIdType offset, vtkIdType npts);
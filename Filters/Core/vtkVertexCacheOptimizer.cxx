@@ -0,0 +1,485 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkVertexCacheOptimizer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkVertexCacheOptimizer.h"
+
+#include "vtkArrayListTemplate.h"
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkVertexCacheOptimizer);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Score of a vertex, from its position in the simulated LRU cache (-1 when
+// not in the cache) and its number of triangles left, as proposed by Tom
+// Forsyth in "Linear-Speed Vertex Cache Optimisation".
+float VertexScore(int cachePosition, vtkIdType numberOfTriangles, int cacheSize)
+{
+  if (numberOfTriangles == 0)
+  {
+    return -1.f; // no triangle left to use this vertex
+  }
+
+  float score = 0.f;
+  if (cachePosition >= 0)
+  {
+    if (cachePosition < 3)
+    {
+      // The vertices of the last triangle get a fixed score, so that the
+      // next triangle does not favor any of its edges.
+      score = 0.75f;
+    }
+    else
+    {
+      score = 1.f - static_cast<float>(cachePosition - 3) / (cacheSize - 3);
+      score = std::pow(score, 1.5f);
+    }
+  }
+
+  // Boost the vertices with few triangles left, to get rid of them before
+  // they leave the cache.
+  score += 2.f * std::pow(static_cast<float>(numberOfTriangles), -0.5f);
+  return score;
+}
+
+//------------------------------------------------------------------------------
+// Order the numberOfTriangles triangles of connectivity, writing the indices
+// of the triangles in their new order into order.
+void OptimizeTriangles(
+  const vtkIdType* connectivity, vtkIdType numberOfTriangles, int cacheSize, vtkIdType* order)
+{
+  const vtkIdType numberOfCorners = 3 * numberOfTriangles;
+
+  // Number the vertices of the batch from 0.
+  std::vector<vtkIdType> vertices(connectivity, connectivity + numberOfCorners);
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+  const vtkIdType numberOfVertices = static_cast<vtkIdType>(vertices.size());
+  std::vector<vtkIdType> corners(numberOfCorners);
+  for (vtkIdType i = 0; i < numberOfCorners; ++i)
+  {
+    corners[i] = std::lower_bound(vertices.begin(), vertices.end(), connectivity[i]) -
+      vertices.begin();
+  }
+
+  // The triangles of each vertex. The triangles left are kept at the front
+  // of the range of each vertex.
+  std::vector<vtkIdType> trianglesLeft(numberOfVertices, 0);
+  for (vtkIdType v : corners)
+  {
+    ++trianglesLeft[v];
+  }
+  std::vector<vtkIdType> offsets(numberOfVertices + 1, 0);
+  for (vtkIdType v = 0; v < numberOfVertices; ++v)
+  {
+    offsets[v + 1] = offsets[v] + trianglesLeft[v];
+  }
+  std::vector<vtkIdType> vertexTriangles(numberOfCorners);
+  {
+    std::vector<vtkIdType> fill(offsets.begin(), offsets.end() - 1);
+    for (vtkIdType i = 0; i < numberOfCorners; ++i)
+    {
+      vertexTriangles[fill[corners[i]]++] = i / 3;
+    }
+  }
+
+  std::vector<int> cachePositions(numberOfVertices, -1);
+  std::vector<float> vertexScores(numberOfVertices);
+  for (vtkIdType v = 0; v < numberOfVertices; ++v)
+  {
+    vertexScores[v] = VertexScore(-1, trianglesLeft[v], cacheSize);
+  }
+  std::vector<float> triangleScores(numberOfTriangles);
+  vtkIdType best = 0;
+  for (vtkIdType t = 0; t < numberOfTriangles; ++t)
+  {
+    const vtkIdType* tri = corners.data() + 3 * t;
+    triangleScores[t] = vertexScores[tri[0]] + vertexScores[tri[1]] + vertexScores[tri[2]];
+    if (triangleScores[t] > triangleScores[best])
+    {
+      best = t;
+    }
+  }
+
+  std::vector<bool> emitted(numberOfTriangles, false);
+  std::deque<vtkIdType> cache;
+  vtkIdType nextNotEmitted = 0;
+  for (vtkIdType i = 0; i < numberOfTriangles; ++i)
+  {
+    if (best < 0)
+    {
+      // None of the triangles of the vertices in the cache is left: start
+      // again from any triangle left.
+      while (emitted[nextNotEmitted])
+      {
+        ++nextNotEmitted;
+      }
+      best = nextNotEmitted;
+    }
+
+    order[i] = best;
+    emitted[best] = true;
+    const vtkIdType* tri = corners.data() + 3 * best;
+
+    // Remove the triangle from the triangles left of its vertices, and move
+    // its vertices to the front of the cache.
+    for (int c = 2; c >= 0; --c)
+    {
+      const vtkIdType v = tri[c];
+      vtkIdType* first = vertexTriangles.data() + offsets[v];
+      vtkIdType* last = first + trianglesLeft[v];
+      std::iter_swap(std::find(first, last, best), last - 1);
+      --trianglesLeft[v];
+
+      auto it = std::find(cache.begin(), cache.end(), v);
+      if (it != cache.end())
+      {
+        cache.erase(it);
+      }
+      cache.push_front(v);
+    }
+
+    // Update the scores of the vertices in the cache, and of the vertices
+    // that just left it, then the scores of their triangles.
+    for (size_t k = 0; k < cache.size(); ++k)
+    {
+      const vtkIdType v = cache[k];
+      cachePositions[v] = k < static_cast<size_t>(cacheSize) ? static_cast<int>(k) : -1;
+      vertexScores[v] = VertexScore(cachePositions[v], trianglesLeft[v], cacheSize);
+    }
+    best = -1;
+    float bestScore = -1.f;
+    for (vtkIdType v : cache)
+    {
+      const vtkIdType* first = vertexTriangles.data() + offsets[v];
+      for (const vtkIdType* t = first; t < first + trianglesLeft[v]; ++t)
+      {
+        const vtkIdType* other = corners.data() + 3 * (*t);
+        triangleScores[*t] =
+          vertexScores[other[0]] + vertexScores[other[1]] + vertexScores[other[2]];
+        if (triangleScores[*t] > bestScore)
+        {
+          bestScore = triangleScores[*t];
+          best = *t;
+        }
+      }
+    }
+    if (cache.size() > static_cast<size_t>(cacheSize))
+    {
+      cache.resize(cacheSize);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Copy cells, mapping their point ids when pointMap is not null.
+vtkSmartPointer<vtkCellArray> MapCells(vtkCellArray* cells, const vtkIdType* pointMap)
+{
+  if (!pointMap || cells->GetNumberOfCells() == 0)
+  {
+    return cells;
+  }
+  vtkNew<vtkCellArray> newCells;
+  newCells->AllocateExact(cells->GetNumberOfCells(), cells->GetNumberOfConnectivityIds());
+  std::vector<vtkIdType> ids;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    ids.resize(npts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      ids[i] = pointMap[pts[i]];
+    }
+    newCells->InsertNextCell(npts, ids.data());
+  }
+  return newCells;
+}
+} // end anon namespace
+
+//------------------------------------------------------------------------------
+vtkVertexCacheOptimizer::vtkVertexCacheOptimizer()
+{
+  this->CacheSize = 32;
+  this->BatchSize = 65536;
+  this->ReorderPoints = true;
+}
+
+//------------------------------------------------------------------------------
+int vtkVertexCacheOptimizer::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector);
+
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numVerts = input->GetNumberOfVerts();
+  const vtkIdType numLines = input->GetNumberOfLines();
+  const vtkIdType numPolys = input->GetNumberOfPolys();
+  const vtkIdType numCells = input->GetNumberOfCells();
+  vtkCellArray* inPolys = input->GetPolys();
+
+  // Gather the triangles, and the other polygons.
+  std::vector<vtkIdType> triangles;
+  std::vector<vtkIdType> triangleCells;
+  std::vector<vtkIdType> otherCells;
+  triangles.reserve(3 * numPolys);
+  triangleCells.reserve(numPolys);
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    auto iter = vtk::TakeSmartPointer(inPolys->NewIterator());
+    for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+    {
+      iter->GetCurrentCell(npts, pts);
+      if (npts == 3)
+      {
+        triangles.insert(triangles.end(), pts, pts + 3);
+        triangleCells.push_back(iter->GetCurrentCellId());
+      }
+      else
+      {
+        otherCells.push_back(iter->GetCurrentCellId());
+      }
+    }
+  }
+  const vtkIdType numTriangles = static_cast<vtkIdType>(triangleCells.size());
+
+  // Order the triangles of each batch.
+  std::vector<vtkIdType> order(numTriangles);
+  const vtkIdType numBatches = (numTriangles + this->BatchSize - 1) / this->BatchSize;
+  vtkSMPTools::For(0, numBatches, 1, [&](vtkIdType batch, vtkIdType endBatch) {
+    for (; batch < endBatch; ++batch)
+    {
+      const vtkIdType first = batch * this->BatchSize;
+      const vtkIdType count = std::min(this->BatchSize, numTriangles - first);
+      OptimizeTriangles(triangles.data() + 3 * first, count, this->CacheSize, &order[first]);
+      for (vtkIdType i = first; i < first + count; ++i)
+      {
+        order[i] += first;
+      }
+    }
+  });
+  this->UpdateProgress(0.5);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // The new polygons: the ordered triangles, then the other polygons.
+  vtkNew<vtkIdTypeArray> polyOffsets;
+  vtkNew<vtkIdTypeArray> polyConnectivity;
+  polyOffsets->SetNumberOfValues(numPolys + 1);
+  polyConnectivity->SetNumberOfValues(inPolys->GetNumberOfConnectivityIds());
+  vtkIdType* newOffsets = polyOffsets->GetPointer(0);
+  vtkIdType* newConnectivity = polyConnectivity->GetPointer(0);
+  vtkSMPTools::For(0, numTriangles, [&](vtkIdType i, vtkIdType end) {
+    for (; i < end; ++i)
+    {
+      const vtkIdType* tri = triangles.data() + 3 * order[i];
+      newOffsets[i] = 3 * i;
+      std::copy(tri, tri + 3, newConnectivity + 3 * i);
+    }
+  });
+  vtkIdType connectivityId = 3 * numTriangles;
+  vtkIdType polyId = numTriangles;
+  for (vtkIdType cellId : otherCells)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    inPolys->GetCellAtId(cellId, npts, pts);
+    newOffsets[polyId++] = connectivityId;
+    connectivityId = std::copy(pts, pts + npts, newConnectivity + connectivityId) - newConnectivity;
+  }
+  newOffsets[numPolys] = connectivityId;
+
+  // Renumber the points in the order the cells use them.
+  std::vector<vtkIdType> pointMap;
+  if (this->ReorderPoints && numPts > 0)
+  {
+    pointMap.assign(numPts, -1);
+    vtkIdType nextId = 0;
+    auto numberPoints = [&](vtkCellArray* cells) {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+      for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+      {
+        iter->GetCurrentCell(npts, pts);
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          if (pointMap[pts[i]] < 0)
+          {
+            pointMap[pts[i]] = nextId++;
+          }
+        }
+      }
+    };
+    numberPoints(input->GetVerts());
+    numberPoints(input->GetLines());
+    for (vtkIdType i = 0; i < connectivityId; ++i)
+    {
+      if (pointMap[newConnectivity[i]] < 0)
+      {
+        pointMap[newConnectivity[i]] = nextId++;
+      }
+    }
+    numberPoints(input->GetStrips());
+    for (vtkIdType& id : pointMap)
+    {
+      if (id < 0)
+      {
+        id = nextId++; // unused point
+      }
+    }
+
+    vtkSMPTools::For(0, connectivityId, [&](vtkIdType i, vtkIdType end) {
+      for (; i < end; ++i)
+      {
+        newConnectivity[i] = pointMap[newConnectivity[i]];
+      }
+    });
+
+    // Move the points and their data.
+    vtkPoints* inPts = input->GetPoints();
+    vtkNew<vtkPoints> newPts;
+    newPts->SetDataType(inPts->GetDataType());
+    newPts->SetNumberOfPoints(numPts);
+    vtkPointData* outPD = output->GetPointData();
+    outPD->CopyAllocate(input->GetPointData(), numPts);
+    ArrayList pointArrays;
+    pointArrays.AddArrays(numPts, input->GetPointData(), outPD, 0.0, false);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      double x[3];
+      for (; ptId < endPtId; ++ptId)
+      {
+        inPts->GetPoint(ptId, x);
+        newPts->SetPoint(pointMap[ptId], x);
+        pointArrays.Copy(ptId, pointMap[ptId]);
+      }
+    });
+    output->SetPoints(newPts);
+  }
+  else
+  {
+    output->SetPoints(input->GetPoints());
+    output->GetPointData()->PassData(input->GetPointData());
+  }
+
+  const vtkIdType* map = pointMap.empty() ? nullptr : pointMap.data();
+  output->SetVerts(MapCells(input->GetVerts(), map));
+  output->SetLines(MapCells(input->GetLines(), map));
+  vtkNew<vtkCellArray> newPolys;
+  newPolys->SetData(polyOffsets, polyConnectivity);
+  output->SetPolys(newPolys);
+  output->SetStrips(MapCells(input->GetStrips(), map));
+
+  // Move the cell data along with the polygons.
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(input->GetCellData(), numCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numCells, input->GetCellData(), outCD, 0.0, false);
+  const vtkIdType firstPoly = numVerts + numLines;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    for (; cellId < endCellId; ++cellId)
+    {
+      vtkIdType inCellId = cellId;
+      const vtkIdType polyIndex = cellId - firstPoly;
+      if (polyIndex >= 0 && polyIndex < numTriangles)
+      {
+        inCellId = firstPoly + triangleCells[order[polyIndex]];
+      }
+      else if (polyIndex >= numTriangles && polyIndex < numPolys)
+      {
+        inCellId = firstPoly + otherCells[polyIndex - numTriangles];
+      }
+      cellArrays.Copy(inCellId, cellId);
+    }
+  });
+
+  output->GetFieldData()->PassData(input->GetFieldData());
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+double vtkVertexCacheOptimizer::ComputeAverageCacheMissRatio(vtkPolyData* polyData, int cacheSize)
+{
+  if (!polyData || polyData->GetNumberOfPolys() == 0 || cacheSize < 1)
+  {
+    return 0.0;
+  }
+
+  // Simulate a FIFO cache, as used by the hardware.
+  std::deque<vtkIdType> cache;
+  vtkIdType misses = 0;
+  vtkIdType numberOfTriangles = 0;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  auto iter = vtk::TakeSmartPointer(polyData->GetPolys()->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    if (npts != 3)
+    {
+      continue;
+    }
+    ++numberOfTriangles;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (std::find(cache.begin(), cache.end(), pts[i]) == cache.end())
+      {
+        ++misses;
+        cache.push_back(pts[i]);
+        if (cache.size() > static_cast<size_t>(cacheSize))
+        {
+          cache.pop_front();
+        }
+      }
+    }
+  }
+  return numberOfTriangles ? static_cast<double>(misses) / numberOfTriangles : 0.0;
+}
+
+//------------------------------------------------------------------------------
+void vtkVertexCacheOptimizer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "BatchSize: " << this->BatchSize << endl;
+  os << indent << "ReorderPoints: " << (this->ReorderPoints ? "On" : "Off") << endl;
+}
+VTK_ABI_NAMESPACE_END
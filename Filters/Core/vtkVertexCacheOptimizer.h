@@ -0,0 +1,121 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkVertexCacheOptimizer.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkVertexCacheOptimizer
+ * @brief   reorder triangles and points for efficient rendering
+ *
+ * vtkVertexCacheOptimizer reorders the triangles of its input so that
+ * consecutive triangles share their vertices as much as possible. GPUs keep
+ * the last transformed vertices in a small cache, so rendering the reordered
+ * triangles runs the vertex shader fewer times. The triangles are ordered
+ * with the linear-speed vertex cache optimisation of Tom Forsyth, which
+ * greedily picks the next triangle from a score favoring the vertices
+ * recently used and the vertices with few triangles left.
+ *
+ * The triangles are optimized by batches of BatchSize consecutive triangles,
+ * processed concurrently with vtkSMPTools. As the cache only holds a few
+ * dozens of vertices, optimizing large batches independently costs little,
+ * provided that the triangles of a batch are close to each other, as in the
+ * output of most sources and readers.
+ *
+ * When ReorderPoints is on, the points are then renumbered in the order the
+ * cells first use them, so that fetching the vertices also follows memory
+ * order. Unused points are kept, after the used ones.
+ *
+ * Vertices, lines and triangle strips are passed through, and polygons that
+ * are not triangles are output after the triangles. The cell data is
+ * reordered along with the cells, and the point data along with the points.
+ * Use vtkTriangleFilter first to optimize all the polygons.
+ *
+ * ComputeAverageCacheMissRatio() evaluates the ordering of the triangles of
+ * a polydata.
+ *
+ * @sa
+ * vtkStripper vtkTriangleFilter
+ */
+
+#ifndef vtkVertexCacheOptimizer_h
+#define vtkVertexCacheOptimizer_h
+
+#include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkPolyDataAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSCORE_EXPORT vtkVertexCacheOptimizer : public vtkPolyDataAlgorithm
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkVertexCacheOptimizer* New();
+  vtkTypeMacro(vtkVertexCacheOptimizer, vtkPolyDataAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of vertices of the cache the triangles are ordered
+   * for. Orderings are little sensitive to this size, and the default of 32
+   * suits most GPUs.
+   */
+  vtkSetClampMacro(CacheSize, int, 4, 256);
+  vtkGetMacro(CacheSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of consecutive triangles optimized together. Batches
+   * are optimized concurrently. The default is 65536.
+   */
+  vtkSetClampMacro(BatchSize, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(BatchSize, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get whether the points are renumbered in the order the cells use
+   * them. On by default.
+   */
+  vtkSetMacro(ReorderPoints, bool);
+  vtkGetMacro(ReorderPoints, bool);
+  vtkBooleanMacro(ReorderPoints, bool);
+  ///@}
+
+  /**
+   * Return the average cache miss ratio (ACMR) of the triangles of the
+   * polygons of the given polydata, in their order, for a FIFO cache of
+   * cacheSize vertices: the number of vertices transformed per triangle,
+   * between about 0.5 for well ordered large meshes and 3.
+   */
+  static double ComputeAverageCacheMissRatio(vtkPolyData* polyData, int cacheSize = 32);
+
+protected:
+  vtkVertexCacheOptimizer();
+  ~vtkVertexCacheOptimizer() override = default;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  int CacheSize;
+  vtkIdType BatchSize;
+  bool ReorderPoints;
+
+private:
+  vtkVertexCacheOptimizer(const vtkVertexCacheOptimizer&) = delete;
+  void operator=(const vtkVertexCacheOptimizer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,134 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestValueSelectorSortedIndex.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// This tests that repeated value and threshold selections of the same array,
+// which go through the sorted index cached by vtkValueSelector, select the same
+// rows as a scan of the array, and that the index follows the array changes.
+
+#include "vtkDoubleArray.h"
+#include "vtkExtractSelection.h"
+#include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkSelection.h"
+#include "vtkSelectionNode.h"
+#include "vtkTable.h"
+#include "vtkValueSelector.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+vtkIdType ExtractRows(vtkTable* table, int contentType, vtkDataArray* selectionList)
+{
+  vtkNew<vtkSelectionNode> node;
+  node->SetContentType(contentType);
+  node->SetFieldType(vtkSelectionNode::ROW);
+  node->SetSelectionList(selectionList);
+  vtkNew<vtkSelection> selection;
+  selection->AddNode(node);
+
+  vtkNew<vtkExtractSelection> extract;
+  extract->SetInputData(0, table);
+  extract->SetInputData(1, selection);
+  extract->Update();
+  auto output = vtkTable::SafeDownCast(extract->GetOutputDataObject(0));
+  return output ? output->GetNumberOfRows() : -1;
+}
+
+bool CheckRows(const char* what, int run, vtkIdType rows, vtkIdType expected)
+{
+  if (rows != expected)
+  {
+    std::cerr << what << ", run " << run << ": expected " << expected << " rows, got " << rows
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestValueSelectorSortedIndex(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  const vtkIdType numberOfRows = 1000;
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  ints->SetNumberOfTuples(numberOfRows);
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetName("Doubles");
+  doubles->SetNumberOfTuples(numberOfRows);
+  for (vtkIdType i = 0; i < numberOfRows; ++i)
+  {
+    ints->SetValue(i, static_cast<int>((i * 7919) % 100));
+    doubles->SetValue(i, i % 10 == 0 ? vtkMath::Nan() : std::sin(static_cast<double>(i)));
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(ints);
+  table->AddColumn(doubles);
+
+  vtkNew<vtkIntArray> values;
+  values->SetName("Ints");
+  values->InsertNextValue(3);
+  values->InsertNextValue(42);
+  values->InsertNextValue(1000);
+
+  vtkNew<vtkDoubleArray> thresholds;
+  thresholds->SetName("Doubles");
+  thresholds->SetNumberOfComponents(2);
+  thresholds->InsertNextTuple2(-0.5, 0.25);
+  thresholds->InsertNextTuple2(0.0, 0.75);
+  thresholds->InsertNextTuple2(0.9, 0.8);
+
+  bool success = true;
+  for (int step = 0; step < 2; ++step)
+  {
+    vtkIdType expectedValues = 0;
+    vtkIdType expectedThresholds = 0;
+    for (vtkIdType i = 0; i < numberOfRows; ++i)
+    {
+      const int value = ints->GetValue(i);
+      expectedValues += value == 3 || value == 42 ? 1 : 0;
+      const double threshold = doubles->GetValue(i);
+      expectedThresholds += threshold >= -0.5 && threshold <= 0.75 ? 1 : 0;
+    }
+
+    // the first run scans the array, the second builds the index, the last uses it
+    for (int run = 0; run < 3; ++run)
+    {
+      success &= ::CheckRows("Values", run,
+        ::ExtractRows(table, vtkSelectionNode::VALUES, values), expectedValues);
+      success &= ::CheckRows("Thresholds", run,
+        ::ExtractRows(table, vtkSelectionNode::THRESHOLDS, thresholds), expectedThresholds);
+    }
+    if (!ints->GetInformation()->Has(vtkValueSelector::SORTED_INDEX()))
+    {
+      std::cerr << "No sorted index cached in the array." << std::endl;
+      success = false;
+    }
+
+    // the index must not be used anymore once the arrays are modified
+    for (vtkIdType i = 0; i < numberOfRows; i += 2)
+    {
+      ints->SetValue(i, 42);
+      doubles->SetValue(i, 0.5);
+    }
+    ints->Modified();
+    doubles->Modified();
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
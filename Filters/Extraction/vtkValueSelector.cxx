@@ -20,6 +20,8 @@
 #include "vtkDataObject.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPTools.h"
 #include "vtkSelectionNode.h"
@@ -27,12 +29,100 @@
 #include "vtkSortDataArray.h"
 #include "vtkStringArray.h"
 
+#include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 VTK_ABI_NAMESPACE_BEGIN
+vtkInformationKeyMacro(vtkValueSelector, SORTED_INDEX, ObjectBase);
+
 namespace
 {
 
+//------------------------------------------------------------------------------
+// Ids of the tuples of a field array, sorted by the value of one component,
+// for the array as of ArrayMTime. It is cached in the information of the array,
+// so that selecting values of the same array again only takes a few binary
+// searches instead of a scan of the whole array.
+class vtkValueSelectorSortedIndex : public vtkObject
+{
+public:
+  static vtkValueSelectorSortedIndex* New();
+  vtkTypeMacro(vtkValueSelectorSortedIndex, vtkObject);
+
+  vtkMTimeType ArrayMTime = 0;
+  int Component = 0;
+  bool Built = false;
+  std::vector<vtkIdType> Order;
+
+protected:
+  vtkValueSelectorSortedIndex() = default;
+  ~vtkValueSelectorSortedIndex() override = default;
+
+private:
+  vtkValueSelectorSortedIndex(const vtkValueSelectorSortedIndex&) = delete;
+  void operator=(const vtkValueSelectorSortedIndex&) = delete;
+};
+vtkStandardNewMacro(vtkValueSelectorSortedIndex);
+
+//------------------------------------------------------------------------------
+// Return the sorted index of the given component of the array, or nullptr when
+// the array should be scanned. Sorting costs more than a scan, so the index is
+// only built the second time the same, unmodified, array is selected, then it
+// is reused until the array is modified.
+template <typename ArrayType>
+const std::vector<vtkIdType>* GetSortedIndex(ArrayType* array, int comp)
+{
+  // creating the information modifies the array: do it before getting its time
+  vtkInformation* info = array->GetInformation();
+  const vtkMTimeType mtime = array->GetMTime();
+  auto* index =
+    vtkValueSelectorSortedIndex::SafeDownCast(info->Get(vtkValueSelector::SORTED_INDEX()));
+  if (!index || index->ArrayMTime != mtime || index->Component != comp)
+  {
+    vtkNew<vtkValueSelectorSortedIndex> newIndex;
+    newIndex->ArrayMTime = mtime;
+    newIndex->Component = comp;
+    info->Set(vtkValueSelector::SORTED_INDEX(), newIndex);
+    return nullptr;
+  }
+
+  if (!index->Built)
+  {
+    const auto range = vtk::DataArrayTupleRange(array);
+    std::vector<vtkIdType>& order = index->Order;
+    order.resize(static_cast<size_t>(range.size()));
+    std::iota(order.begin(), order.end(), 0);
+    // NaN never matches a selection, and cannot be sorted
+    order.erase(std::remove_if(order.begin(), order.end(),
+                  [&](vtkIdType id) { return !(range[id][comp] == range[id][comp]); }),
+      order.end());
+    vtkSMPTools::Sort(order.begin(), order.end(),
+      [&](vtkIdType a, vtkIdType b) { return range[a][comp] < range[b][comp]; });
+    order.shrink_to_fit();
+    index->Built = true;
+  }
+  return &index->Order;
+}
+
+//------------------------------------------------------------------------------
+// Mark the tuples of the sorted index with a value in [low, high] as inside.
+template <typename ArrayType, typename ValueType>
+void SelectSortedRange(ArrayType* array, int comp, const std::vector<vtkIdType>& order,
+  ValueType low, ValueType high, vtkSignedCharArray* insidednessArray)
+{
+  const auto range = vtk::DataArrayTupleRange(array);
+  auto first = std::lower_bound(order.begin(), order.end(), low,
+    [&](vtkIdType id, ValueType value) { return range[id][comp] < value; });
+  auto last = std::upper_bound(first, order.end(), high,
+    [&](ValueType value, vtkIdType id) { return value < range[id][comp]; });
+  for (; first < last; ++first)
+  {
+    insidednessArray->SetValue(*first, 1);
+  }
+}
+
 struct ThresholdSelectionListReshaper
 {
 protected:
@@ -93,7 +183,16 @@ struct ArrayValueMatchFunctor
 
     vtkSignedCharArray* insidednessArray = this->InsidednessArray;
     VTK_ASSUME(insidednessArray->GetNumberOfTuples() == fArray->GetNumberOfTuples());
-    if (comp >= 0)
+    const std::vector<vtkIdType>* order = comp >= 0 ? ::GetSortedIndex(fArray, comp) : nullptr;
+    if (order)
+    {
+      insidednessArray->FillValue(0);
+      for (const ValueType* value = haystack_begin; value != haystack_end; ++value)
+      {
+        ::SelectSortedRange(fArray, comp, *order, *value, *value, insidednessArray);
+      }
+    }
+    else if (comp >= 0)
     {
       vtkSMPTools::For(0, fArray->GetNumberOfTuples(), [=](vtkIdType begin, vtkIdType end) {
         const auto fRange = vtk::DataArrayTupleRange(fArray, begin, end);
@@ -178,7 +277,19 @@ struct ArrayValueRangeFunctor
 
     const int comp = fArray->GetNumberOfComponents() == 1 ? 0 : this->ComponentNo;
 
-    if (comp >= 0)
+    const std::vector<vtkIdType>* order = comp >= 0 ? ::GetSortedIndex(fArray, comp) : nullptr;
+    if (order)
+    {
+      this->InsidednessArray->FillValue(0);
+      const auto selRange = vtk::DataArrayTupleRange<2>(selList);
+      using STupleCRefType = typename decltype(selRange)::ConstTupleReferenceType;
+      for (STupleCRefType range : selRange)
+      {
+        ::SelectSortedRange(fArray, comp, *order, static_cast<ValueType>(range[0]),
+          static_cast<ValueType>(range[1]), this->InsidednessArray);
+      }
+    }
+    else if (comp >= 0)
     {
       vtkSMPTools::For(0, fArray->GetNumberOfTuples(),
         [this, comp, fArray, selList](vtkIdType begin, vtkIdType end) {
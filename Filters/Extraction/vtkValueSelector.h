@@ -35,6 +35,14 @@
  *   array to select on is defined by the name given the SelectionList itself.
  *   If the SelectionList has no name (or is an empty string), then the active
  *   scalars from the dataset will be chosen.
+ *
+ * * When the values of the same component of the same field array are selected
+ *   again, without the array being modified in between, the ids of its tuples
+ *   sorted by value are cached in the information of the array (see
+ *   SORTED_INDEX()). Later selections of this array only search the values of
+ *   the selection list in this index, instead of scanning the whole array,
+ *   which speeds up interactive queries on large arrays. The index is rebuilt
+ *   once the array is modified (its MTime changes).
  */
 
 #ifndef vtkValueSelector_h
@@ -46,6 +54,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkConvertSelection;
+class vtkInformationObjectBaseKey;
 
 class VTKFILTERSEXTRACTION_EXPORT vtkValueSelector : public vtkSelector
 {
@@ -60,6 +69,12 @@ public:
   void Initialize(vtkSelectionNode* node) override;
   void Finalize() override;
 
+  /**
+   * Key of the information of the field arrays that holds their sorted
+   * index, used to speed up repeated selections of the same array.
+   */
+  static vtkInformationObjectBaseKey* SORTED_INDEX();
+
 protected:
   vtkValueSelector();
   ~vtkValueSelector() override;
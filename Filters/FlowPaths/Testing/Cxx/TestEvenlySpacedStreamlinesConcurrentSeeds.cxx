@@ -0,0 +1,112 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestEvenlySpacedStreamlinesConcurrentSeeds.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that integrating several candidate seeds concurrently generates the
+// same streamlines as integrating them one at a time, in 2D and in 3D.
+
+#include "vtkDoubleArray.h"
+#include "vtkEvenlySpacedStreamlines2D.h"
+#include "vtkEvenlySpacedStreamlines3D.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// cellular flow in XY, with a flow along Z that changes with X in 3D
+void CreateField(vtkImageData* image, int nz)
+{
+  image->SetDimensions(64, 64, nz);
+  image->SetOrigin(-32, -32, 0);
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("velocity");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    double p[3];
+    image->GetPoint(i, p);
+    vectors->SetTuple3(
+      i, std::sin(p[1] / 8) + 0.1, std::cos(p[0] / 8), nz > 1 ? 0.5 * std::sin(p[0] / 10) : 0.0);
+  }
+  image->GetPointData()->SetVectors(vectors);
+}
+
+bool Compare(vtkEvenlySpacedStreamlines2D* stream, const char* name)
+{
+  stream->SetNumberOfConcurrentSeeds(1);
+  stream->Update();
+  vtkNew<vtkPolyData> serial;
+  serial->DeepCopy(stream->GetOutput());
+
+  stream->SetNumberOfConcurrentSeeds(8);
+  stream->Update();
+  vtkPolyData* concurrent = stream->GetOutput();
+
+  if (serial->GetNumberOfCells() < 10)
+  {
+    std::cerr << name << ": expected more streamlines, got " << serial->GetNumberOfCells()
+              << std::endl;
+    return false;
+  }
+  if (serial->GetNumberOfPoints() != concurrent->GetNumberOfPoints() ||
+    serial->GetNumberOfCells() != concurrent->GetNumberOfCells())
+  {
+    std::cerr << name << ": " << concurrent->GetNumberOfPoints() << " points and "
+              << concurrent->GetNumberOfCells() << " streamlines with concurrent seeds instead of "
+              << serial->GetNumberOfPoints() << " and " << serial->GetNumberOfCells() << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < serial->GetNumberOfPoints(); ++i)
+  {
+    double p[3], q[3];
+    serial->GetPoint(i, p);
+    concurrent->GetPoint(i, q);
+    if (p[0] != q[0] || p[1] != q[1] || p[2] != q[2])
+    {
+      std::cerr << name << ": point " << i << " differs with concurrent seeds" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestEvenlySpacedStreamlinesConcurrentSeeds(int, char*[])
+{
+  vtkNew<vtkImageData> plane;
+  CreateField(plane, 1);
+  vtkNew<vtkEvenlySpacedStreamlines2D> stream2D;
+  stream2D->SetInputData(plane);
+  stream2D->SetInitialIntegrationStep(0.2);
+  stream2D->SetSeparatingDistance(2);
+  stream2D->SetStartPosition(1, 1, 0);
+
+  vtkNew<vtkImageData> volume;
+  CreateField(volume, 16);
+  vtkNew<vtkEvenlySpacedStreamlines3D> stream3D;
+  stream3D->SetInputData(volume);
+  stream3D->SetInitialIntegrationStep(0.2);
+  stream3D->SetSeparatingDistance(4);
+  stream3D->SetStartPosition(1, 1, 8);
+
+  bool success = Compare(stream2D, "2D");
+  success = Compare(stream3D, "3D") && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
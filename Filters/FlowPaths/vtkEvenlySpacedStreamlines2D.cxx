@@ -45,15 +45,87 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkPolyLine.h"
 #include "vtkRungeKutta2.h"
 #include "vtkRungeKutta4.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamTracer.h"
 
 #include <algorithm>
 #include <array>
+#include <deque>
 #include <iostream>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Output of a stream tracer integrating several seeds, split by seed: the
+// ids of the points of each seed, in output order, and the ids of its cells.
+struct SeedStreamlines
+{
+  vtkSmartPointer<vtkPolyData> Lines;
+  std::vector<std::vector<vtkIdType>> PointIds;
+  std::vector<std::vector<vtkIdType>> CellIds;
+};
+
+void IntegrateSeeds(
+  vtkStreamTracer* tracer, const std::vector<std::array<double, 3>>& seeds, SeedStreamlines& out)
+{
+  vtkNew<vtkPoints> seedPoints;
+  seedPoints->SetDataTypeToDouble();
+  for (const auto& seed : seeds)
+  {
+    seedPoints->InsertNextPoint(seed.data());
+  }
+  vtkNew<vtkPolyData> source;
+  source->SetPoints(seedPoints);
+  tracer->SetSourceData(source);
+  tracer->Update();
+  out.Lines = vtkSmartPointer<vtkPolyData>::New();
+  out.Lines->ShallowCopy(tracer->GetOutput());
+  tracer->SetSourceData(nullptr);
+
+  out.PointIds.assign(seeds.size(), std::vector<vtkIdType>());
+  out.CellIds.assign(seeds.size(), std::vector<vtkIdType>());
+  std::vector<int> pointSeeds(out.Lines->GetNumberOfPoints(), -1);
+  vtkIntArray* seedIds =
+    vtkArrayDownCast<vtkIntArray>(out.Lines->GetCellData()->GetArray("SeedIds"));
+  for (vtkIdType cellId = 0; seedIds && cellId < out.Lines->GetNumberOfCells(); ++cellId)
+  {
+    int seedId = seedIds->GetValue(cellId);
+    out.CellIds[seedId].push_back(cellId);
+    vtkIdType npts;
+    const vtkIdType* pts;
+    out.Lines->GetCellPoints(cellId, npts, pts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      pointSeeds[pts[i]] = seedId;
+    }
+  }
+  for (vtkIdType pointId = 0; pointId < out.Lines->GetNumberOfPoints(); ++pointId)
+  {
+    if (pointSeeds[pointId] < 0)
+    {
+      // a seed that could not be integrated only outputs its own position
+      double point[3];
+      out.Lines->GetPoint(pointId, point);
+      for (std::size_t seedId = 0; seedId < seeds.size() && pointSeeds[pointId] < 0; ++seedId)
+      {
+        if (static_cast<float>(point[0]) == static_cast<float>(seeds[seedId][0]) &&
+          static_cast<float>(point[1]) == static_cast<float>(seeds[seedId][1]) &&
+          static_cast<float>(point[2]) == static_cast<float>(seeds[seedId][2]))
+        {
+          pointSeeds[pointId] = static_cast<int>(seedId);
+        }
+      }
+    }
+    if (pointSeeds[pointId] >= 0)
+    {
+      out.PointIds[pointSeeds[pointId]].push_back(pointId);
+    }
+  }
+}
+}
+
 vtkObjectFactoryNewMacro(vtkEvenlySpacedStreamlines2D);
 vtkCxxSetObjectMacro(vtkEvenlySpacedStreamlines2D, Integrator, vtkInitialValueProblemSolver);
 vtkCxxSetObjectMacro(
@@ -75,6 +147,7 @@ vtkEvenlySpacedStreamlines2D::vtkEvenlySpacedStreamlines2D()
   this->LoopAngle = 0.349066; // 20 degrees in radians
   this->MaximumNumberOfSteps = 2000;
   this->MinimumNumberOfLoopPoints = 4;
+  this->NumberOfConcurrentSeeds = 0;
   this->DirectionStart = 0;
   // invalid integration direction so that we trigger a change the first time
   this->PreviousDirection = 0;
@@ -118,10 +191,9 @@ int vtkEvenlySpacedStreamlines2D::RequestData(vtkInformation* vtkNotUsed(request
   }
   double bounds[6];
   vtkEvenlySpacedStreamlines2D::GetBounds(this->InputData, bounds);
-  if (!vtkMathUtilities::FuzzyCompare(bounds[4], bounds[5]))
+  if (!this->CheckBounds(bounds))
   {
     this->InputData->UnRegister(this);
-    vtkErrorMacro("vtkEvenlySpacedStreamlines2D does not support planes not aligned with XY.");
     return 0;
   }
   std::array<double, 3> v = { { bounds[1] - bounds[0], bounds[3] - bounds[2],
@@ -142,121 +214,325 @@ int vtkEvenlySpacedStreamlines2D::RequestData(vtkInformation* vtkNotUsed(request
   this->ClosedLoopMaximumDistanceArcLength =
     this->ConvertToLength(this->ClosedLoopMaximumDistance, this->IntegrationStepUnit, cellLength);
   this->InitializeSuperposedGrid(bounds);
-  auto streamTracer = vtkSmartPointer<vtkStreamTracer>::New();
-  streamTracer->SetInputDataObject(this->InputData);
-  streamTracer->SetMaximumPropagation(length);
-  streamTracer->SetMaximumNumberOfSteps(this->MaximumNumberOfSteps);
-  streamTracer->SetIntegrationDirection(vtkStreamTracer::BOTH);
-  streamTracer->SetInputArrayToProcess(0, this->GetInputArrayInformation(0));
-  streamTracer->SetStartPosition(this->StartPosition);
-  streamTracer->SetTerminalSpeed(this->TerminalSpeed);
-  streamTracer->SetInitialIntegrationStep(this->InitialIntegrationStep);
-  streamTracer->SetIntegrationStepUnit(this->IntegrationStepUnit);
-  streamTracer->SetIntegrator(this->Integrator);
-  streamTracer->SetComputeVorticity(this->ComputeVorticity);
-  streamTracer->SetInterpolatorPrototype(this->InterpolatorPrototype);
+  auto newStreamTracer = [&]() {
+    auto tracer = vtkSmartPointer<vtkStreamTracer>::New();
+    tracer->SetInputDataObject(this->InputData);
+    tracer->SetMaximumPropagation(length);
+    tracer->SetMaximumNumberOfSteps(this->MaximumNumberOfSteps);
+    tracer->SetIntegrationDirection(vtkStreamTracer::BOTH);
+    tracer->SetInputArrayToProcess(0, this->GetInputArrayInformation(0));
+    tracer->SetStartPosition(this->StartPosition);
+    tracer->SetTerminalSpeed(this->TerminalSpeed);
+    tracer->SetInitialIntegrationStep(this->InitialIntegrationStep);
+    tracer->SetIntegrationStepUnit(this->IntegrationStepUnit);
+    tracer->SetIntegrator(this->Integrator);
+    tracer->SetComputeVorticity(this->ComputeVorticity);
+    tracer->SetInterpolatorPrototype(this->InterpolatorPrototype);
+    tracer->SetContainerAlgorithm(this);
+    return tracer;
+  };
+  auto streamTracer = newStreamTracer();
   // we end streamlines after one loop iteration
   streamTracer->AddCustomTerminationCallback(&vtkEvenlySpacedStreamlines2D::IsStreamlineLooping,
     this, vtkStreamTracer::FIXED_REASONS_FOR_TERMINATION_COUNT);
-  streamTracer->SetContainerAlgorithm(this);
+  this->PreviousDirection = 0;
   streamTracer->Update();
 
   auto streamline = vtkSmartPointer<vtkPolyData>::New();
   streamline->ShallowCopy(streamTracer->GetOutput());
   this->AddToAllPoints(streamline);
-
-  auto append = vtkSmartPointer<vtkAppendPolyData>::New();
-  append->UserManagedInputsOn();
-  append->SetNumberOfInputs(2);
-  output->ShallowCopy(streamline);
-  append->SetContainerAlgorithm(this);
+  std::vector<vtkSmartPointer<vtkPolyData>> outputStreamlines(1, streamline);
   int currentSeedId = 1;
-  int processedSeedId = 0;
 
   this->Streamlines->RemoveAllItems();
   this->Streamlines->AddItem(streamline);
-  // we also end streamlines when they are close to other streamlines
-  streamTracer->AddCustomTerminationCallback(
+  // The candidate seeds are integrated together, and end when they are close
+  // to the streamlines accepted before them. As the callback only reads
+  // AllPoints, it can be called from the threads of the stream tracer. The
+  // loops and the streamlines accepted with the same batch are checked by
+  // ExtractStreamline afterwards.
+  auto seedTracer = newStreamTracer();
+  seedTracer->AddCustomTerminationCallback(
     &vtkEvenlySpacedStreamlines2D::IsStreamlineTooCloseToOthers, this,
     vtkStreamTracer::FIXED_REASONS_FOR_TERMINATION_COUNT + 1);
+  int numberOfConcurrentSeeds = this->NumberOfConcurrentSeeds;
+  if (numberOfConcurrentSeeds == 0)
+  {
+    int numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+    numberOfConcurrentSeeds = numberOfThreads > 1 ? 2 * numberOfThreads : 1;
+  }
 
   const char* velocityName = this->GetInputArrayToProcessName();
   double deltaOne = this->SeparatingDistanceArcLength / 1000;
   double delta[3] = { deltaOne, deltaOne, deltaOne };
+  double separatingDistance2 =
+    this->SeparatingDistanceArcLength * this->SeparatingDistanceArcLength;
+  // candidate seeds, in the order they are tried when integrating one
+  // streamline at a time
+  std::deque<std::array<double, 3>> candidates;
+  std::vector<std::array<double, 3>> newSeeds;
+  std::vector<std::array<double, 3>> batch;
+  std::vector<std::array<double, 3>> concurrentSeeds;
+  std::vector<int> concurrentIndices;
+  SeedStreamlines concurrentStreamlines;
+  SeedStreamlines singleStreamline;
   int maxNumberOfItems = 0;
   float lastProgress = 0.0;
-  while (this->Streamlines->GetNumberOfItems())
+  while (!this->CheckAbort())
   {
     int numberOfItems = this->Streamlines->GetNumberOfItems();
     if (numberOfItems > maxNumberOfItems)
     {
       maxNumberOfItems = numberOfItems;
     }
-    if (processedSeedId % 10 == 0)
+    float progress = (static_cast<float>(maxNumberOfItems) - numberOfItems) / maxNumberOfItems;
+    if (progress > lastProgress)
     {
-      float progress = (static_cast<float>(maxNumberOfItems) - numberOfItems) / maxNumberOfItems;
-      if (progress > lastProgress)
+      this->UpdateProgress(progress);
+      lastProgress = progress;
+    }
+
+    // Gather the next candidates which are not too close to the current
+    // streamlines. A candidate close to a seed of the batch is likely to be
+    // rejected, so it is not integrated with the others.
+    batch.clear();
+    concurrentSeeds.clear();
+    concurrentIndices.clear();
+    while (static_cast<int>(concurrentSeeds.size()) < numberOfConcurrentSeeds)
+    {
+      if (candidates.empty())
       {
-        this->UpdateProgress(progress);
-        if (this->CheckAbort())
+        if (!this->Streamlines->GetNumberOfItems())
         {
           break;
         }
-        lastProgress = progress;
+        streamline = vtkPolyData::SafeDownCast(this->Streamlines->GetItemAsObject(0));
+        vtkDataArray* velocity = streamline->GetPointData()->GetArray(velocityName);
+        for (vtkIdType pointId = 0; pointId < streamline->GetNumberOfPoints(); ++pointId)
+        {
+          double point[3];
+          streamline->GetPoint(pointId, point);
+          newSeeds.clear();
+          this->GenerateSeeds(point, velocity->GetTuple(pointId), newSeeds);
+          candidates.insert(candidates.end(), newSeeds.begin(), newSeeds.end());
+        }
+        this->Streamlines->RemoveItem(0);
+        continue;
       }
+      std::array<double, 3> newSeed = candidates.front();
+      candidates.pop_front();
+      if (vtkMath::PointIsWithinBounds(newSeed.data(), bounds, delta) &&
+        !this->ForEachCell(newSeed.data(), &vtkEvenlySpacedStreamlines2D::IsTooClose<DISTANCE>))
+      {
+        if (std::none_of(concurrentSeeds.begin(), concurrentSeeds.end(),
+              [&](const std::array<double, 3>& seed) {
+                return vtkMath::Distance2BetweenPoints(seed.data(), newSeed.data()) <
+                  separatingDistance2;
+              }))
+        {
+          concurrentIndices.push_back(static_cast<int>(concurrentSeeds.size()));
+          concurrentSeeds.push_back(newSeed);
+        }
+        else
+        {
+          concurrentIndices.push_back(-1);
+        }
+        batch.push_back(newSeed);
+      }
+    }
+    if (batch.empty())
+    {
+      break;
     }
+    IntegrateSeeds(seedTracer, concurrentSeeds, concurrentStreamlines);
 
-    streamline = vtkPolyData::SafeDownCast(this->Streamlines->GetItemAsObject(0));
-    vtkDataArray* velocity = streamline->GetPointData()->GetArray(velocityName);
-    for (vtkIdType pointId = 0; pointId < streamline->GetNumberOfPoints(); ++pointId)
+    // accept the candidates in order, each one against the streamlines
+    // accepted before it.
+    for (std::size_t i = 0; i < batch.size() && !this->GetAbortOutput(); ++i)
     {
-      // generate 2 new seeds for every streamline point
-      double newSeedVector[3];
-      double normal[3] = { 0, 0, 1 };
-      vtkMath::Cross(normal, velocity->GetTuple(pointId), newSeedVector);
-      // floating point errors move newSeedVector out of XY plane.
-      newSeedVector[2] = 0;
-      vtkMath::Normalize(newSeedVector);
-      vtkMath::MultiplyScalar(newSeedVector, this->SeparatingDistanceArcLength);
-      double point[3];
-      streamline->GetPoint(pointId, point);
-      std::array<std::array<double, 3>, 2> newSeeds;
-      vtkMath::Add(point, newSeedVector, newSeeds[0].data());
-      vtkMath::Subtract(point, newSeedVector, newSeeds[1].data());
+      if (this->ForEachCell(batch[i].data(), &vtkEvenlySpacedStreamlines2D::IsTooClose<DISTANCE>))
+      {
+        continue;
+      }
+      SeedStreamlines* integrated = &concurrentStreamlines;
+      int index = concurrentIndices[i];
+      if (index < 0)
+      {
+        IntegrateSeeds(seedTracer, { batch[i] }, singleStreamline);
+        integrated = &singleStreamline;
+        index = 0;
+      }
+      auto newStreamline = vtkSmartPointer<vtkPolyData>::New();
+      this->ExtractStreamline(integrated->Lines, integrated->PointIds[index],
+        integrated->CellIds[index], velocityName, newStreamline);
 
-      for (auto newSeed : newSeeds)
+      vtkIntArray* seedIds =
+        vtkIntArray::SafeDownCast(newStreamline->GetCellData()->GetArray("SeedIds"));
+      for (int cellId = 0; cellId < newStreamline->GetNumberOfCells(); ++cellId)
       {
-        if (vtkMath::PointIsWithinBounds(newSeed.data(), bounds, delta) &&
-          !this->ForEachCell(newSeed.data(), &vtkEvenlySpacedStreamlines2D::IsTooClose<DISTANCE>))
-        {
-          streamTracer->SetStartPosition(newSeed.data());
-          streamTracer->Update();
-          auto newStreamline = vtkSmartPointer<vtkPolyData>::New();
-          newStreamline->ShallowCopy(streamTracer->GetOutput());
-
-          vtkIntArray* seedIds =
-            vtkIntArray::SafeDownCast(newStreamline->GetCellData()->GetArray("SeedIds"));
-          for (int cellId = 0; cellId < newStreamline->GetNumberOfCells(); ++cellId)
-          {
-            seedIds->SetValue(cellId, currentSeedId);
-          }
-          currentSeedId++;
-          this->AddToAllPoints(newStreamline);
-          append->SetInputDataByNumber(0, output);
-          append->SetInputDataByNumber(1, newStreamline);
-          append->Update();
-          output->ShallowCopy(append->GetOutput());
-          this->Streamlines->AddItem(newStreamline);
-        }
+        seedIds->SetValue(cellId, currentSeedId);
       }
+      currentSeedId++;
+      this->AddToAllPoints(newStreamline);
+      outputStreamlines.push_back(newStreamline);
+      this->Streamlines->AddItem(newStreamline);
     }
-    this->Streamlines->RemoveItem(0);
-    ++processedSeedId;
   }
+
+  auto append = vtkSmartPointer<vtkAppendPolyData>::New();
+  append->UserManagedInputsOn();
+  append->SetNumberOfInputs(static_cast<int>(outputStreamlines.size()));
+  for (std::size_t i = 0; i < outputStreamlines.size(); ++i)
+  {
+    append->SetInputDataByNumber(static_cast<int>(i), outputStreamlines[i]);
+  }
+  append->SetContainerAlgorithm(this);
+  append->Update();
+  output->ShallowCopy(append->GetOutput());
   this->InputData->UnRegister(this);
   return 1;
 }
 
+//------------------------------------------------------------------------------
+bool vtkEvenlySpacedStreamlines2D::CheckBounds(const double bounds[6])
+{
+  if (!vtkMathUtilities::FuzzyCompare(bounds[4], bounds[5]))
+  {
+    vtkErrorMacro("vtkEvenlySpacedStreamlines2D does not support planes not aligned with XY.");
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkEvenlySpacedStreamlines2D::GenerateSeeds(
+  const double point[3], const double velocity[3], std::vector<std::array<double, 3>>& seeds)
+{
+  // generate 2 new seeds for every streamline point
+  double newSeedVector[3];
+  double normal[3] = { 0, 0, 1 };
+  vtkMath::Cross(normal, velocity, newSeedVector);
+  // floating point errors move newSeedVector out of XY plane.
+  newSeedVector[2] = 0;
+  vtkMath::Normalize(newSeedVector);
+  vtkMath::MultiplyScalar(newSeedVector, this->SeparatingDistanceArcLength);
+  std::array<double, 3> newSeed;
+  vtkMath::Add(point, newSeedVector, newSeed.data());
+  seeds.push_back(newSeed);
+  vtkMath::Subtract(point, newSeedVector, newSeed.data());
+  seeds.push_back(newSeed);
+}
+
+//------------------------------------------------------------------------------
+void vtkEvenlySpacedStreamlines2D::ExtractStreamline(vtkPolyData* lines,
+  const std::vector<vtkIdType>& pointIds, const std::vector<vtkIdType>& cellIds,
+  const char* velocityName, vtkPolyData* streamline)
+{
+  vtkPointData* linesPD = lines->GetPointData();
+  vtkCellData* linesCD = lines->GetCellData();
+  vtkDataArray* velocity = linesPD->GetArray(velocityName);
+  vtkIntArray* reasons = vtkArrayDownCast<vtkIntArray>(linesCD->GetArray("ReasonForTermination"));
+
+  // Replay the termination callbacks along each line, as if it was
+  // integrated after the streamlines accepted so far, to find where it stops.
+  std::vector<vtkIdType> numberOfPoints(cellIds.size());
+  std::vector<int> reasonsForTermination(cellIds.size());
+  std::vector<bool> removed(pointIds.size(), false);
+  vtkNew<vtkPoints> linePoints;
+  linePoints->SetDataType(lines->GetPoints()->GetDataType());
+  vtkSmartPointer<vtkDataArray> lineVelocity;
+  lineVelocity.TakeReference(velocity->NewInstance());
+  lineVelocity->SetNumberOfComponents(velocity->GetNumberOfComponents());
+  for (std::size_t i = 0; i < cellIds.size(); ++i)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    lines->GetCellPoints(cellIds[i], npts, pts);
+    int reason = reasons->GetValue(cellIds[i]);
+    // the stream tracer does not call the callbacks on the last point of
+    // lines out of length, out of steps, or (mostly) stagnating
+    bool checkLastPoint = reason != vtkStreamTracer::OUT_OF_LENGTH &&
+      reason != vtkStreamTracer::OUT_OF_STEPS && reason != vtkStreamTracer::STAGNATION;
+    double p0[3], p1[3], v1[3];
+    lines->GetPoint(pts[0], p0);
+    lines->GetPoint(pts[1], p1);
+    vtkMath::Subtract(p1, p0, v1);
+    int direction = vtkMath::Dot(v1, velocity->GetTuple(pts[0])) < 0 ? -1 : 1;
+
+    linePoints->Reset();
+    lineVelocity->Reset();
+    // restart the loop detection
+    this->PreviousDirection = 0;
+    vtkIdType count = npts;
+    for (vtkIdType j = 0; j < npts && (j < npts - 1 || checkLastPoint); ++j)
+    {
+      linePoints->InsertNextPoint(lines->GetPoint(pts[j]));
+      lineVelocity->InsertNextTuple(pts[j], velocity);
+      if (vtkEvenlySpacedStreamlines2D::IsStreamlineLooping(
+            this, linePoints, lineVelocity, direction))
+      {
+        reason = vtkStreamTracer::FIXED_REASONS_FOR_TERMINATION_COUNT;
+        count = j + 1;
+        break;
+      }
+      if (vtkEvenlySpacedStreamlines2D::IsStreamlineTooCloseToOthers(
+            this, linePoints, lineVelocity, direction))
+      {
+        reason = vtkStreamTracer::FIXED_REASONS_FOR_TERMINATION_COUNT + 1;
+        count = j + 1;
+        break;
+      }
+    }
+    numberOfPoints[i] = count;
+    reasonsForTermination[i] = reason;
+    for (vtkIdType j = count; j < npts; ++j)
+    {
+      removed[std::lower_bound(pointIds.begin(), pointIds.end(), pts[j]) - pointIds.begin()] =
+        true;
+    }
+  }
+
+  // copy the remaining points in the order of the stream tracer output
+  vtkNew<vtkPoints> points;
+  points->SetDataType(lines->GetPoints()->GetDataType());
+  vtkPointData* outputPD = streamline->GetPointData();
+  outputPD->CopyAllocate(linesPD, static_cast<vtkIdType>(pointIds.size()));
+  std::vector<vtkIdType> newPointIds(pointIds.size(), -1);
+  for (std::size_t i = 0; i < pointIds.size(); ++i)
+  {
+    if (!removed[i])
+    {
+      newPointIds[i] = points->InsertNextPoint(lines->GetPoint(pointIds[i]));
+      outputPD->CopyData(linesPD, pointIds[i], newPointIds[i]);
+    }
+  }
+  streamline->SetPoints(points);
+
+  vtkNew<vtkCellArray> polyLines;
+  vtkCellData* outputCD = streamline->GetCellData();
+  outputCD->CopyAllocate(linesCD, static_cast<vtkIdType>(cellIds.size()));
+  for (std::size_t i = 0; i < cellIds.size(); ++i)
+  {
+    if (numberOfPoints[i] < 2)
+    {
+      continue;
+    }
+    vtkIdType npts;
+    const vtkIdType* pts;
+    lines->GetCellPoints(cellIds[i], npts, pts);
+    vtkIdType newCellId = polyLines->InsertNextCell(numberOfPoints[i]);
+    for (vtkIdType j = 0; j < numberOfPoints[i]; ++j)
+    {
+      polyLines->InsertCellPoint(
+        newPointIds[std::lower_bound(pointIds.begin(), pointIds.end(), pts[j]) - pointIds.begin()]);
+    }
+    outputCD->CopyData(linesCD, cellIds[i], newCellId);
+    vtkArrayDownCast<vtkIntArray>(outputCD->GetArray("ReasonForTermination"))
+      ->SetValue(newCellId, reasonsForTermination[i]);
+  }
+  streamline->SetLines(polyLines);
+}
+
 //------------------------------------------------------------------------------
 int vtkEvenlySpacedStreamlines2D::ComputeCellLength(double* cellLength)
 {
@@ -327,10 +603,8 @@ bool vtkEvenlySpacedStreamlines2D::IsStreamlineLooping(
 
   double p0Point[3];
   points->GetPoint(p0, p0Point);
-  int ijk[3] = { 0, 0, 0 };
-  ijk[0] = floor(p0Point[0] / This->SeparatingDistanceArcLength);
-  ijk[1] = floor(p0Point[1] / This->SeparatingDistanceArcLength);
-  vtkIdType cellId = This->SuperposedGrid->ComputeCellId(&ijk[0]);
+  int ijk[3];
+  vtkIdType cellId = This->ComputeSuperposedCellId(p0Point, ijk);
 
   bool retVal = This->ForEachCell(
     p0Point, &vtkEvenlySpacedStreamlines2D::IsLooping, points, velocity, direction);
@@ -350,34 +624,36 @@ bool vtkEvenlySpacedStreamlines2D::ForEachCell(
   double* point, CellCheckerType checker, vtkPoints* points, vtkDataArray* velocity, int direction)
 {
   // point current cell
-  int ijk[3] = { 0, 0, 0 };
-  ijk[0] = floor(point[0] / this->SeparatingDistanceArcLength);
-  ijk[1] = floor(point[1] / this->SeparatingDistanceArcLength);
-  vtkIdType cellId = this->SuperposedGrid->ComputeCellId(&ijk[0]);
+  int ijk[3];
+  vtkIdType cellId = this->ComputeSuperposedCellId(point, ijk);
   if ((this->*checker)(point, cellId, points, velocity, direction))
   {
     return true;
   }
-  // and check cells around the current cell
-  std::array<std::array<int, 3>, 8> around = { {
-    { { ijk[0] - 1, ijk[1] + 1, ijk[2] } },
-    { { ijk[0], ijk[1] + 1, ijk[2] } },
-    { { ijk[0] + 1, ijk[1] + 1, ijk[2] } },
-    { { ijk[0] - 1, ijk[1], ijk[2] } },
-    { { ijk[0] + 1, ijk[1], ijk[2] } },
-    { { ijk[0] - 1, ijk[1] - 1, ijk[2] } },
-    { { ijk[0], ijk[1] - 1, ijk[2] } },
-    { { ijk[0] + 1, ijk[1] - 1, ijk[2] } },
-  } };
+  // and check cells around the current cell, in the same layer for a 2D grid
   int extent[6];
   this->SuperposedGrid->GetExtent(extent);
-  for (auto cellPos : around)
+  int layers = extent[4] == extent[5] ? 0 : 1;
+  int cellPos[3];
+  for (cellPos[2] = ijk[2] - layers; cellPos[2] <= ijk[2] + layers; ++cellPos[2])
   {
-    cellId = this->SuperposedGrid->ComputeCellId(cellPos.data());
-    if (cellPos[0] >= extent[0] && cellPos[0] < extent[1] && cellPos[1] >= extent[2] &&
-      cellPos[1] < extent[3] && (this->*checker)(point, cellId, points, velocity, direction))
+    for (cellPos[1] = ijk[1] - 1; cellPos[1] <= ijk[1] + 1; ++cellPos[1])
     {
-      return true;
+      for (cellPos[0] = ijk[0] - 1; cellPos[0] <= ijk[0] + 1; ++cellPos[0])
+      {
+        if ((cellPos[0] == ijk[0] && cellPos[1] == ijk[1] && cellPos[2] == ijk[2]) ||
+          cellPos[0] < extent[0] || cellPos[0] >= extent[1] || cellPos[1] < extent[2] ||
+          cellPos[1] >= extent[3] ||
+          (layers && (cellPos[2] < extent[4] || cellPos[2] >= extent[5])))
+        {
+          continue;
+        }
+        cellId = this->SuperposedGrid->ComputeCellId(cellPos);
+        if ((this->*checker)(point, cellId, points, velocity, direction))
+        {
+          return true;
+        }
+      }
     }
   }
   return false;
@@ -715,16 +991,35 @@ int vtkEvenlySpacedStreamlines2D::CheckInputs(
 //------------------------------------------------------------------------------
 void vtkEvenlySpacedStreamlines2D::InitializeSuperposedGrid(double* bounds)
 {
+  bool planar = vtkMathUtilities::FuzzyCompare(bounds[4], bounds[5]);
   this->SuperposedGrid->SetExtent(floor(bounds[0] / this->SeparatingDistanceArcLength),
     ceil(bounds[1] / this->SeparatingDistanceArcLength),
     floor(bounds[2] / this->SeparatingDistanceArcLength),
-    ceil(bounds[3] / this->SeparatingDistanceArcLength), 0, 0);
+    ceil(bounds[3] / this->SeparatingDistanceArcLength),
+    planar ? 0 : floor(bounds[4] / this->SeparatingDistanceArcLength),
+    planar ? 0 : ceil(bounds[5] / this->SeparatingDistanceArcLength));
   this->SuperposedGrid->SetSpacing(this->SeparatingDistanceArcLength,
     this->SeparatingDistanceArcLength, this->SeparatingDistanceArcLength);
   this->InitializePoints(this->AllPoints);
   this->InitializePoints(this->CurrentPoints);
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkEvenlySpacedStreamlines2D::ComputeSuperposedCellId(const double point[3], int ijk[3])
+{
+  const int* extent = this->SuperposedGrid->GetExtent();
+  for (int i = 0; i < 3; ++i)
+  {
+    // a 2D grid has a single layer of cells, and points on the boundary of
+    // the bounds go to the closest cell
+    ijk[i] = extent[2 * i] == extent[2 * i + 1]
+      ? extent[2 * i]
+      : vtkMath::ClampValue(static_cast<int>(floor(point[i] / this->SeparatingDistanceArcLength)),
+          extent[2 * i], extent[2 * i + 1] - 1);
+  }
+  return this->SuperposedGrid->ComputeCellId(ijk);
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 void vtkEvenlySpacedStreamlines2D::InitializePoints(T& points)
@@ -756,10 +1051,8 @@ void vtkEvenlySpacedStreamlines2D::AddToAllPoints(vtkPolyData* streamline)
     {
       double point[3];
       points->GetPoint(i, point);
-      int ijk[3] = { 0, 0, 0 };
-      ijk[0] = floor(point[0] / this->SeparatingDistanceArcLength);
-      ijk[1] = floor(point[1] / this->SeparatingDistanceArcLength);
-      vtkIdType cellId = this->SuperposedGrid->ComputeCellId(ijk);
+      int ijk[3];
+      vtkIdType cellId = this->ComputeSuperposedCellId(point, ijk);
       this->AllPoints[cellId].push_back({ { point[0], point[1], point[2] } });
     }
   }
@@ -875,5 +1168,6 @@ void vtkEvenlySpacedStreamlines2D::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Integrator: " << this->Integrator << endl;
   os << indent << "Vorticity computation: " << (this->ComputeVorticity ? " On" : " Off") << endl;
+  os << indent << "Number of concurrent seeds: " << this->NumberOfConcurrentSeeds << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -78,6 +78,16 @@
  * The starting point, or the so-called 'seed', of the first streamline is set
  * by setting StartPosition
  *
+ * The seeds of the other streamlines are taken at SeparatingDistance of the
+ * previous streamlines, and several of them can be integrated concurrently
+ * (see NumberOfConcurrentSeeds). They are accepted in the same order as
+ * when integrated one at a time, and each streamline is cut where it
+ * would have stopped, so the points of the output do not depend on the
+ * number of concurrent seeds.
+ *
+ * @sa
+ * vtkEvenlySpacedStreamlines3D for volumes.
+ *
  * @sa
  * vtkStreamTracer vtkRibbonFilter vtkRuledSurfaceFilter vtkInitialValueProblemSolver
  * vtkRungeKutta2 vtkRungeKutta4 vtkRungeKutta45 vtkParticleTracerBase
@@ -259,6 +269,19 @@ public:
   vtkGetMacro(ComputeVorticity, bool);
   ///@}
 
+  ///@{
+  /**
+   * Specify how many candidate seeds are integrated concurrently. The
+   * candidates are integrated against the streamlines accepted before them,
+   * then accepted one after another, so some integrations are wasted when a
+   * candidate ends up too close to a streamline of the same batch. Use 1 to
+   * integrate one streamline at a time. The default, 0, uses twice the number
+   * of threads of vtkSMPTools, or 1 if it runs a single thread.
+   */
+  vtkSetClampMacro(NumberOfConcurrentSeeds, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfConcurrentSeeds, int);
+  ///@}
+
   /**
    * The object used to interpolate the velocity field during
    * integration is of the same class as this prototype.
@@ -301,7 +324,20 @@ protected:
   double ConvertToLength(double interval, int unit, double cellLength);
 
   static void GetBounds(vtkCompositeDataSet* cds, double bounds[6]);
+  /**
+   * Check that the input data with these bounds is supported. The default
+   * only accepts data in a plane parallel to XY.
+   */
+  virtual bool CheckBounds(const double bounds[6]);
+  /**
+   * Append the candidate seeds placed at SeparatingDistance of a
+   * streamline point with the given velocity. The default places two seeds
+   * in the XY plane, on each side of the streamline.
+   */
+  virtual void GenerateSeeds(
+    const double point[3], const double velocity[3], std::vector<std::array<double, 3>>& seeds);
   void InitializeSuperposedGrid(double* bounds);
+  vtkIdType ComputeSuperposedCellId(const double point[3], int ijk[3]);
   void AddToAllPoints(vtkPolyData* streamline);
   void AddToCurrentPoints(vtkIdType pointId);
   template <typename T>
@@ -322,6 +358,8 @@ protected:
     double* point, vtkIdType cellId, vtkPoints* points, vtkDataArray* velocity, int direction);
   const char* GetInputArrayToProcessName();
   int ComputeCellLength(double* cellLength);
+  void ExtractStreamline(vtkPolyData* lines, const std::vector<vtkIdType>& pointIds,
+    const std::vector<vtkIdType>& cellIds, const char* velocityName, vtkPolyData* streamline);
 
   // starting from global x-y-z position
   double StartPosition[3];
@@ -346,6 +384,7 @@ protected:
   vtkIdType MaximumNumberOfSteps;
   vtkIdType MinimumNumberOfStreamlinePoints;
   vtkIdType MinimumNumberOfLoopPoints;
+  int NumberOfConcurrentSeeds;
 
   // Prototype showing the integrator type to be set by the user.
   vtkInitialValueProblemSolver* Integrator;
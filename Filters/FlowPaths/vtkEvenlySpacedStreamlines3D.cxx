@@ -0,0 +1,57 @@
+/*=========================================================================
+
+Program:   Visualization Toolkit
+Module:    vtkEvenlySpacedStreamlines3D.cxx
+
+Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+All rights reserved.
+See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+This software is distributed WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkEvenlySpacedStreamlines3D.h"
+
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkObjectFactoryNewMacro(vtkEvenlySpacedStreamlines3D);
+
+//------------------------------------------------------------------------------
+bool vtkEvenlySpacedStreamlines3D::CheckBounds(const double vtkNotUsed(bounds)[6])
+{
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkEvenlySpacedStreamlines3D::GenerateSeeds(
+  const double point[3], const double velocity[3], std::vector<std::array<double, 3>>& seeds)
+{
+  double direction[3] = { velocity[0], velocity[1], velocity[2] };
+  if (vtkMath::Normalize(direction) == 0.0)
+  {
+    return;
+  }
+  // generate 4 new seeds around every streamline point
+  std::array<std::array<double, 3>, 2> newSeedVectors;
+  vtkMath::Perpendiculars(direction, newSeedVectors[0].data(), newSeedVectors[1].data(), 0.0);
+  for (auto& newSeedVector : newSeedVectors)
+  {
+    vtkMath::MultiplyScalar(newSeedVector.data(), this->SeparatingDistanceArcLength);
+    std::array<double, 3> newSeed;
+    vtkMath::Add(point, newSeedVector.data(), newSeed.data());
+    seeds.push_back(newSeed);
+    vtkMath::Subtract(point, newSeedVector.data(), newSeed.data());
+    seeds.push_back(newSeed);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkEvenlySpacedStreamlines3D::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
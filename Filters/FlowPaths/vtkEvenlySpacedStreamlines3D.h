@@ -0,0 +1,65 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkEvenlySpacedStreamlines3D.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkEvenlySpacedStreamlines3D
+ * @brief   Evenly spaced streamline generator for volumes.
+ *
+ * vtkEvenlySpacedStreamlines3D extends the placement algorithm of
+ * vtkEvenlySpacedStreamlines2D to 3D vector fields. The streamlines are
+ * separated by SeparatingDistance in all directions: the superposed grid
+ * used to find the neighboring streamline points has cells in the three
+ * dimensions, and four candidate seeds are placed around every streamline
+ * point, in the plane orthogonal to the velocity.
+ *
+ * As in 2D, several candidate seeds are integrated concurrently (see
+ * NumberOfConcurrentSeeds), which does not change the output points.
+ *
+ * @sa
+ * vtkEvenlySpacedStreamlines2D vtkStreamTracer
+ */
+
+#ifndef vtkEvenlySpacedStreamlines3D_h
+#define vtkEvenlySpacedStreamlines3D_h
+
+#include "vtkEvenlySpacedStreamlines2D.h"
+#include "vtkFiltersFlowPathsModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSFLOWPATHS_EXPORT vtkEvenlySpacedStreamlines3D : public vtkEvenlySpacedStreamlines2D
+{
+public:
+  vtkTypeMacro(vtkEvenlySpacedStreamlines3D, vtkEvenlySpacedStreamlines2D);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Construct object with the same defaults as vtkEvenlySpacedStreamlines2D.
+   */
+  static vtkEvenlySpacedStreamlines3D* New();
+
+protected:
+  vtkEvenlySpacedStreamlines3D() = default;
+  ~vtkEvenlySpacedStreamlines3D() override = default;
+
+  bool CheckBounds(const double bounds[6]) override;
+  void GenerateSeeds(const double point[3], const double velocity[3],
+    std::vector<std::array<double, 3>>& seeds) override;
+
+private:
+  vtkEvenlySpacedStreamlines3D(const vtkEvenlySpacedStreamlines3D&) = delete;
+  void operator=(const vtkEvenlySpacedStreamlines3D&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -18,6 +18,7 @@
 #include "vtkParticleTracerBase.h"
 
 #include "vtkAbstractParticleWriter.h"
+#include "vtkBoundingBox.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellLocatorStrategy.h"
@@ -634,6 +635,20 @@ bool vtkParticleTracerBase::InsideBounds(double point[])
   return false;
 }
 
+//------------------------------------------------------------------------------
+void vtkParticleTracerBase::GetLocalBounds(double bounds[6])
+{
+  vtkBoundingBox box;
+  for (int t = 0; t < 2; ++t)
+  {
+    for (size_t i = 0; i < (this->CachedBounds[t].size()); ++i)
+    {
+      box.AddBounds((this->CachedBounds[t])[i].b);
+    }
+  }
+  box.GetBounds(bounds);
+}
+
 //------------------------------------------------------------------------------
 void vtkParticleTracerBase::TestParticles(
   ParticleVector& candidates, ParticleVector& passed, int& count)
@@ -520,6 +520,10 @@ protected:
   // utility function we use to test if a point is inside any of our local datasets
   bool InsideBounds(double point[]);
 
+  // utility function that returns the bounds enclosing all of our local datasets,
+  // invalid bounds when there is none
+  void GetLocalBounds(double bounds[6]);
+
   void CalculateVorticity(
     vtkGenericCell* cell, double pcoords[3], vtkDoubleArray* cellVectors, double vorticity[3]);
 
@@ -0,0 +1,356 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestClipDataSetThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the parallel clipping of vtkClipDataSet and vtkBoxClipDataSet, used
+// with their default vtkMergePoints locator, against their serial clipping,
+// used with a subclass of vtkMergePoints. For an input clipped in a single
+// chunk, the outputs must be the same. Otherwise the triangulations may
+// differ, but the cells of each dimension must have the same total size.
+
+#include "vtkAppendFilter.h"
+#include "vtkBoxClipDataSet.h"
+#include "vtkCellData.h"
+#include "vtkCellTypeSource.h"
+#include "vtkClipDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPlane.h"
+#include "vtkPointData.h"
+#include "vtkMath.h"
+#include "vtkMergePoints.h"
+#include "vtkPoints.h"
+#include "vtkTetra.h"
+#include "vtkTriangle.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// Merges the points as vtkMergePoints, but is not used by the parallel clipping
+class SerialMergePoints : public vtkMergePoints
+{
+public:
+  static SerialMergePoints* New();
+  vtkTypeMacro(SerialMergePoints, vtkMergePoints);
+};
+vtkStandardNewMacro(SerialMergePoints);
+
+// A row of cubes given as polyhedra
+void AddPolyhedra(vtkUnstructuredGrid* grid, int numCubes, int size)
+{
+  const double step = 0.5 * size / numCubes;
+  vtkPoints* points = grid->GetPoints();
+  const vtkIdType first = points->GetNumberOfPoints();
+  for (int i = 0; i <= numCubes; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      points->InsertNextPoint(
+        0.25 * size + step * i, 0.2 * size + 2 * step * (j & 1), 0.2 * size + 2 * step * (j >> 1));
+    }
+  }
+  for (int i = 0; i < numCubes; ++i)
+  {
+    const vtkIdType p = first + 4 * i;
+    const vtkIdType cube[8] = { p, p + 1, p + 3, p + 2, p + 4, p + 5, p + 7, p + 6 };
+    const vtkIdType faces[] = { 4, p, p + 1, p + 3, p + 2, 4, p + 4, p + 6, p + 7, p + 5, 4, p,
+      p + 4, p + 5, p + 1, 4, p + 2, p + 3, p + 7, p + 6, 4, p, p + 2, p + 6, p + 4, 4, p + 1,
+      p + 5, p + 7, p + 3 };
+    grid->InsertNextCell(VTK_POLYHEDRON, 8, cube, 6, faces);
+  }
+}
+
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid(int size)
+{
+  vtkNew<vtkAppendFilter> append;
+  for (int type : { VTK_HEXAHEDRON, VTK_TETRA, VTK_WEDGE, VTK_QUADRATIC_TETRA, VTK_TRIANGLE,
+         VTK_QUAD, VTK_LINE })
+  {
+    vtkNew<vtkCellTypeSource> source;
+    source->SetCellType(type);
+    source->SetBlocksDimensions(size, size - 1, size - 2);
+    source->SetOutputPrecision(vtkAlgorithm::DOUBLE_PRECISION);
+    source->Update();
+    append->AddInputData(source->GetOutput());
+  }
+  append->Update();
+
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->DeepCopy(append->GetOutput());
+  AddPolyhedra(grid, 20, size);
+  grid->GetPointData()->SetActiveScalars("DistanceToCenter");
+  for (vtkIdType i = 0; i < grid->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    grid->GetPoint(i, x);
+    grid->GetPointData()->GetArray("DistanceToCenter")->InsertTuple1(i, x[0] + x[1]);
+    grid->GetPointData()->GetArray("Polynomial")->InsertTuple1(i, x[2]);
+  }
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellIds");
+  cellIds->SetNumberOfValues(grid->GetNumberOfCells());
+  for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+  {
+    cellIds->SetValue(i, i);
+  }
+  grid->GetCellData()->AddArray(cellIds);
+  return grid;
+}
+
+bool CompareAttributes(
+  vtkDataSetAttributes* attributes1, vtkDataSetAttributes* attributes2, bool values = true)
+{
+  if (attributes1->GetNumberOfArrays() != attributes2->GetNumberOfArrays())
+  {
+    std::cerr << "Different numbers of arrays" << std::endl;
+    return false;
+  }
+  for (int a = 0; a < attributes1->GetNumberOfArrays(); ++a)
+  {
+    vtkDataArray* array1 = attributes1->GetArray(a);
+    vtkDataArray* array2 = attributes2->GetArray(array1->GetName());
+    if (!array2 || (values && array1->GetNumberOfTuples() != array2->GetNumberOfTuples()) ||
+      array1->GetNumberOfComponents() != array2->GetNumberOfComponents())
+    {
+      std::cerr << "Different array " << array1->GetName() << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; values && i < array1->GetNumberOfValues(); ++i)
+    {
+      const int nComp = array1->GetNumberOfComponents();
+      if (array1->GetComponent(i / nComp, i % nComp) != array2->GetComponent(i / nComp, i % nComp))
+      {
+        std::cerr << "Different values of " << array1->GetName() << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Total length, area and volume of the cells of each dimension
+void GetSizes(vtkUnstructuredGrid* grid, double sizes[4])
+{
+  std::fill(sizes, sizes + 4, 0.0);
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkIdList> ids;
+  vtkNew<vtkPoints> points;
+  for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+  {
+    grid->GetCell(i, cell);
+    const int dimension = cell->GetCellDimension();
+    cell->Triangulate(0, ids, points);
+    for (vtkIdType j = 0; j + dimension < points->GetNumberOfPoints(); j += dimension + 1)
+    {
+      double x[4][3];
+      for (int k = 0; k <= dimension; ++k)
+      {
+        points->GetPoint(j + k, x[k]);
+      }
+      switch (dimension)
+      {
+        case 1:
+          sizes[1] += std::sqrt(vtkMath::Distance2BetweenPoints(x[0], x[1]));
+          break;
+        case 2:
+          sizes[2] += vtkTriangle::TriangleArea(x[0], x[1], x[2]);
+          break;
+        case 3:
+          sizes[3] += std::abs(vtkTetra::ComputeVolume(x[0], x[1], x[2], x[3]));
+          break;
+      }
+    }
+  }
+}
+
+// Compare the outputs of an input clipped in several chunks
+bool CompareSizes(vtkUnstructuredGrid* threaded, vtkUnstructuredGrid* serial, const char* name)
+{
+  double threadedSizes[4];
+  double serialSizes[4];
+  GetSizes(threaded, threadedSizes);
+  GetSizes(serial, serialSizes);
+  for (int dimension = 1; dimension < 4; ++dimension)
+  {
+    const double expected = serialSizes[dimension];
+    if (expected == 0.0 || std::abs(threadedSizes[dimension] - expected) > 1e-9 * expected)
+    {
+      std::cerr << name << ": size " << threadedSizes[dimension] << " instead of " << expected
+                << " for the cells of dimension " << dimension << std::endl;
+      return false;
+    }
+  }
+  return CompareAttributes(threaded->GetPointData(), serial->GetPointData(), false) &&
+    CompareAttributes(threaded->GetCellData(), serial->GetCellData(), false);
+}
+
+bool Compare(
+  vtkUnstructuredGrid* threaded, vtkUnstructuredGrid* serial, const char* name, bool chunks)
+{
+  if (chunks)
+  {
+    return CompareSizes(threaded, serial, name);
+  }
+
+  if (threaded->GetNumberOfPoints() != serial->GetNumberOfPoints() ||
+    threaded->GetNumberOfCells() != serial->GetNumberOfCells())
+  {
+    std::cerr << name << ": " << threaded->GetNumberOfPoints() << " points and "
+              << threaded->GetNumberOfCells() << " cells instead of "
+              << serial->GetNumberOfPoints() << " and " << serial->GetNumberOfCells()
+              << std::endl;
+    return false;
+  }
+  if (serial->GetNumberOfCells() == 0)
+  {
+    std::cerr << name << ": empty output" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < serial->GetNumberOfPoints(); ++i)
+  {
+    double x1[3], x2[3];
+    threaded->GetPoint(i, x1);
+    serial->GetPoint(i, x2);
+    if (x1[0] != x2[0] || x1[1] != x2[1] || x1[2] != x2[2])
+    {
+      std::cerr << name << ": different point " << i << std::endl;
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ids1;
+  vtkNew<vtkIdList> ids2;
+  for (vtkIdType i = 0; i < serial->GetNumberOfCells(); ++i)
+  {
+    threaded->GetCellPoints(i, ids1);
+    serial->GetCellPoints(i, ids2);
+    bool same = threaded->GetCellType(i) == serial->GetCellType(i) &&
+      ids1->GetNumberOfIds() == ids2->GetNumberOfIds();
+    for (vtkIdType j = 0; same && j < ids1->GetNumberOfIds(); ++j)
+    {
+      same = ids1->GetId(j) == ids2->GetId(j);
+    }
+    if (!same)
+    {
+      std::cerr << name << ": different cell " << i << std::endl;
+      return false;
+    }
+  }
+  if (!CompareAttributes(threaded->GetPointData(), serial->GetPointData()) ||
+    !CompareAttributes(threaded->GetCellData(), serial->GetCellData()))
+  {
+    std::cerr << name << ": different attributes" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestClipDataSet(vtkUnstructuredGrid* grid, bool chunks, bool clipFunction)
+{
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(0.5 * grid->GetBounds()[1], 0.4 * grid->GetBounds()[3], 0.3);
+  plane->SetNormal(1.0, 0.6, 0.3);
+
+  vtkNew<vtkClipDataSet> threaded;
+  vtkNew<vtkClipDataSet> serial;
+  vtkNew<SerialMergePoints> locator;
+  serial->SetLocator(locator);
+  for (vtkClipDataSet* clip : { threaded.Get(), serial.Get() })
+  {
+    clip->SetInputData(grid);
+    if (clipFunction)
+    {
+      clip->SetClipFunction(plane);
+      clip->GenerateClipScalarsOn();
+    }
+    else
+    {
+      clip->SetValue(0.8 * grid->GetBounds()[1]);
+    }
+    clip->GenerateClippedOutputOn();
+    clip->Update();
+  }
+  return Compare(threaded->GetOutput(), serial->GetOutput(), "vtkClipDataSet", chunks) &&
+    Compare(threaded->GetClippedOutput(), serial->GetClippedOutput(), "vtkClipDataSet clipped",
+      chunks);
+}
+
+bool TestBoxClipDataSet(vtkUnstructuredGrid* grid, bool chunks, bool oriented, bool clippedOutput)
+{
+  const double* bounds = grid->GetBounds();
+  vtkNew<vtkBoxClipDataSet> threaded;
+  vtkNew<vtkBoxClipDataSet> serial;
+  vtkNew<SerialMergePoints> locator;
+  serial->SetLocator(locator);
+  for (vtkBoxClipDataSet* clip : { threaded.Get(), serial.Get() })
+  {
+    clip->SetInputData(grid);
+    if (oriented)
+    {
+      const double n[6][3] = { { -1, -0.2, 0 }, { 1, 0.2, 0 }, { 0, -1, 0 }, { 0, 1, 0 },
+        { 0, 0, -1 }, { 0, 0, 1 } };
+      const double o[6][3] = { { 0.2 * bounds[1], 0, 0 }, { 0.7 * bounds[1], 0, 0 },
+        { 0, -0.5, 0 }, { 0, 0.75 * bounds[3], 0 }, { 0, 0, -0.5 }, { 0, 0, 0.6 * bounds[5] } };
+      clip->SetBoxClip(n[0], o[0], n[1], o[1], n[2], o[2], n[3], o[3], n[4], o[4], n[5], o[5]);
+    }
+    else
+    {
+      clip->SetBoxClip(
+        0.2 * bounds[1], 0.7 * bounds[1], -0.5, 0.75 * bounds[3], -0.5, 0.6 * bounds[5]);
+    }
+    clip->SetGenerateClippedOutput(clippedOutput);
+    clip->Update();
+  }
+  bool status = Compare(threaded->GetOutput(), serial->GetOutput(), "vtkBoxClipDataSet", chunks);
+  if (clippedOutput)
+  {
+    status = status &&
+      Compare(threaded->GetClippedOutput(), serial->GetClippedOutput(), "vtkBoxClipDataSet clipped",
+        chunks);
+  }
+  return status;
+}
+}
+
+int TestClipDataSetThreaded(int, char*[])
+{
+  // inputs clipped in a single chunk, then in several chunks
+  for (int size : { 6, 12 })
+  {
+    vtkSmartPointer<vtkUnstructuredGrid> grid = MakeGrid(size);
+    const bool chunks = grid->GetNumberOfCells() > 10000;
+    if (!TestClipDataSet(grid, chunks, false) || !TestClipDataSet(grid, chunks, true))
+    {
+      return EXIT_FAILURE;
+    }
+    for (bool oriented : { false, true })
+    {
+      for (bool clippedOutput : { false, true })
+      {
+        if (!TestBoxClipDataSet(grid, chunks, oriented, clippedOutput))
+        {
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
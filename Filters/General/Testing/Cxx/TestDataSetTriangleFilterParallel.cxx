@@ -0,0 +1,147 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDataSetTriangleFilterParallel.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkDataSetTriangleFilter gives the same output with the
+// sequential SMP backend and the default one, on structured and unstructured
+// inputs.
+
+#include "vtkCellData.h"
+#include "vtkDataSetTriangleFilter.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkSmartPointer<vtkUnstructuredGrid> RunTriangleFilter(vtkDataSet* input, bool tetrahedraOnly)
+{
+  vtkNew<vtkDataSetTriangleFilter> triangles;
+  triangles->SetInputData(input);
+  triangles->SetTetrahedraOnly(tetrahedraOnly);
+  triangles->Update();
+  return triangles->GetOutput();
+}
+
+bool SameOutputs(vtkUnstructuredGrid* a, vtkUnstructuredGrid* b)
+{
+  if (a->GetNumberOfCells() != b->GetNumberOfCells() || a->GetNumberOfCells() == 0 ||
+    a->GetNumberOfPoints() != b->GetNumberOfPoints())
+  {
+    std::cerr << "Different number of points or cells" << std::endl;
+    return false;
+  }
+  vtkDataArray* idsA = a->GetCellData()->GetArray("CellIds");
+  vtkDataArray* idsB = b->GetCellData()->GetArray("CellIds");
+  vtkNew<vtkIdList> cellA;
+  vtkNew<vtkIdList> cellB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellPoints(cellId, cellA);
+    b->GetCellPoints(cellId, cellB);
+    bool same = a->GetCellType(cellId) == b->GetCellType(cellId) &&
+      cellA->GetNumberOfIds() == cellB->GetNumberOfIds() &&
+      idsA->GetComponent(cellId, 0) == idsB->GetComponent(cellId, 0);
+    for (vtkIdType i = 0; same && i < cellA->GetNumberOfIds(); ++i)
+    {
+      same = cellA->GetId(i) == cellB->GetId(i);
+    }
+    if (!same)
+    {
+      std::cerr << "Cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestInput(vtkDataSet* input, const char* name)
+{
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    cellIds->InsertNextValue(static_cast<int>(cellId));
+  }
+  input->GetCellData()->AddArray(cellIds);
+
+  const std::string defaultBackend = vtkSMPTools::GetBackend();
+  for (int tetrahedraOnly = 0; tetrahedraOnly < 2; ++tetrahedraOnly)
+  {
+    vtkSMPTools::SetBackend("Sequential");
+    vtkSmartPointer<vtkUnstructuredGrid> sequential =
+      RunTriangleFilter(input, tetrahedraOnly != 0);
+    vtkSMPTools::SetBackend(defaultBackend.c_str());
+    vtkSmartPointer<vtkUnstructuredGrid> parallel = RunTriangleFilter(input, tetrahedraOnly != 0);
+    if (!SameOutputs(sequential, parallel))
+    {
+      std::cerr << name << " differs with TetrahedraOnly " << tetrahedraOnly << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestDataSetTriangleFilterParallel(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(25, 20, 12);
+
+  // Hexahedra, wedges and quads sharing the points of the image
+  vtkNew<vtkUnstructuredGrid> grid;
+  vtkNew<vtkPoints> points;
+  for (vtkIdType ptId = 0; ptId < image->GetNumberOfPoints(); ++ptId)
+  {
+    points->InsertNextPoint(image->GetPoint(ptId));
+  }
+  grid->SetPoints(points);
+  grid->Allocate();
+  vtkNew<vtkIdList> cellPtIds;
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    image->GetCellPoints(cellId, cellPtIds);
+    // voxel to hexahedron ordering
+    const vtkIdType* p = cellPtIds->GetPointer(0);
+    const vtkIdType hexahedron[8] = { p[0], p[1], p[3], p[2], p[4], p[5], p[7], p[6] };
+    const vtkIdType wedge[6] = { p[0], p[1], p[2], p[4], p[5], p[6] };
+    const vtkIdType quad[4] = { p[0], p[1], p[3], p[2] };
+    switch (cellId % 3)
+    {
+      case 0:
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hexahedron);
+        break;
+      case 1:
+        grid->InsertNextCell(VTK_WEDGE, 6, wedge);
+        break;
+      default:
+        grid->InsertNextCell(VTK_QUAD, 4, quad);
+        break;
+    }
+  }
+
+  if (!TestInput(image, "vtkImageData") || !TestInput(grid, "vtkUnstructuredGrid"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
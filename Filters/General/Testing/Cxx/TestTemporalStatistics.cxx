@@ -0,0 +1,174 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestTemporalStatistics.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the average, minimum, maximum and standard deviation computed by
+// vtkTemporalStatistics over several time steps against hand-computed values.
+// The values are stored in a vtkDoubleArray and in a vtkSOADataArrayTemplate,
+// which is not dispatched by default and takes the fallback paths.
+
+#include "vtkTemporalStatistics.h"
+
+#include "vtkDoubleArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// The value of point p at time step t is (p % 7) + Offsets[t]. The offsets
+// have an average of 2, a minimum of -2, a maximum of 5, and their squared
+// deviations from the average sum to 1 + 4 + 16 + 9 = 30.
+const double Offsets[4] = { 1.0, 4.0, -2.0, 5.0 };
+const int NumberOfTimeSteps = 4;
+const vtkIdType NumberOfPoints = 1000;
+
+class TemporalValuesSource : public vtkPolyDataAlgorithm
+{
+public:
+  static TemporalValuesSource* New();
+  vtkTypeMacro(TemporalValuesSource, vtkPolyDataAlgorithm);
+
+protected:
+  TemporalValuesSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const double times[NumberOfTimeSteps] = { 0.0, 1.0, 2.0, 3.0 };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), times, NumberOfTimeSteps);
+    const double range[2] = { times[0], times[NumberOfTimeSteps - 1] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    int step = 0;
+    if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()))
+    {
+      step = static_cast<int>(
+        std::lround(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())));
+    }
+
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(NumberOfPoints);
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Values");
+    values->SetNumberOfTuples(NumberOfPoints);
+    vtkNew<vtkSOADataArrayTemplate<double>> soaValues;
+    soaValues->SetName("SOAValues");
+    soaValues->SetNumberOfComponents(2);
+    soaValues->SetNumberOfTuples(NumberOfPoints);
+    for (vtkIdType p = 0; p < NumberOfPoints; ++p)
+    {
+      const double value = static_cast<double>(p % 7) + Offsets[step];
+      points->SetPoint(p, static_cast<double>(p), 0.0, 0.0);
+      values->SetValue(p, value);
+      soaValues->SetTypedComponent(p, 0, value);
+      soaValues->SetTypedComponent(p, 1, -value);
+    }
+    output->SetPoints(points);
+    output->GetPointData()->AddArray(values);
+    output->GetPointData()->AddArray(soaValues);
+    return 1;
+  }
+
+private:
+  TemporalValuesSource(const TemporalValuesSource&) = delete;
+  void operator=(const TemporalValuesSource&) = delete;
+};
+vtkStandardNewMacro(TemporalValuesSource);
+
+// Check that a component of an array is sign * (p % 7) + offset at point p
+bool CheckArray(
+  vtkPointData* pointData, const char* name, int component, double sign, double offset)
+{
+  vtkDataArray* array = pointData->GetArray(name);
+  if (!array || array->GetNumberOfTuples() != NumberOfPoints)
+  {
+    std::cerr << "Missing or wrongly sized array " << name << std::endl;
+    return false;
+  }
+  for (vtkIdType p = 0; p < NumberOfPoints; ++p)
+  {
+    const double expected = sign * static_cast<double>(p % 7) + offset;
+    if (std::abs(array->GetComponent(p, component) - expected) > 1e-12)
+    {
+      std::cerr << "Wrong value " << array->GetComponent(p, component) << " of " << name
+                << " component " << component << " at point " << p << ", expected " << expected
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestTemporalStatistics(int, char*[])
+{
+  vtkNew<TemporalValuesSource> source;
+  vtkNew<vtkTemporalStatistics> statistics;
+  statistics->SetInputConnection(source->GetOutputPort());
+  statistics->Update();
+
+  vtkPointData* pointData = vtkPolyData::SafeDownCast(statistics->GetOutputDataObject(0))
+                              ->GetPointData();
+  const double stddev = std::sqrt(30.0 / NumberOfTimeSteps);
+  // The second component of SOAValues is the opposite of the first one: its
+  // minimum is the opposite of the maximum and conversely.
+  if (!CheckArray(pointData, "Values_average", 0, 1.0, 2.0) ||
+    !CheckArray(pointData, "Values_minimum", 0, 1.0, -2.0) ||
+    !CheckArray(pointData, "Values_maximum", 0, 1.0, 5.0) ||
+    !CheckArray(pointData, "Values_stddev", 0, 0.0, stddev) ||
+    !CheckArray(pointData, "SOAValues_average", 0, 1.0, 2.0) ||
+    !CheckArray(pointData, "SOAValues_average", 1, -1.0, -2.0) ||
+    !CheckArray(pointData, "SOAValues_minimum", 0, 1.0, -2.0) ||
+    !CheckArray(pointData, "SOAValues_minimum", 1, -1.0, -5.0) ||
+    !CheckArray(pointData, "SOAValues_maximum", 0, 1.0, 5.0) ||
+    !CheckArray(pointData, "SOAValues_maximum", 1, -1.0, 2.0) ||
+    !CheckArray(pointData, "SOAValues_stddev", 0, 0.0, stddev) ||
+    !CheckArray(pointData, "SOAValues_stddev", 1, 0.0, stddev))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The average alone, without the standard deviation
+  statistics->ComputeStandardDeviationOff();
+  statistics->Update();
+  pointData = vtkPolyData::SafeDownCast(statistics->GetOutputDataObject(0))->GetPointData();
+  if (pointData->GetArray("Values_stddev") ||
+    !CheckArray(pointData, "Values_average", 0, 1.0, 2.0) ||
+    !CheckArray(pointData, "SOAValues_average", 0, 1.0, 2.0) ||
+    !CheckArray(pointData, "SOAValues_average", 1, -1.0, -2.0))
+  {
+    std::cerr << "Wrong average without the standard deviation" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
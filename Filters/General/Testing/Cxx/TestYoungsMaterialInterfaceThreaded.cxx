@@ -0,0 +1,270 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestYoungsMaterialInterfaceThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkYoungsMaterialInterface produces the same output with the
+// sequential SMP backend and with the default one. The input has enough
+// cells to be processed by many chunks, and cell data arrays of one and
+// several components that are copied to the output. The materials do not
+// share cells: the reconstruction of a cell cut by several materials relies
+// on a vtkConvexPointSet triangulation that depends on the previous cells.
+
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkYoungsMaterialInterface.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// Two disjoint spherical materials in a grid of 40^3 cells
+vtkSmartPointer<vtkMultiBlockDataSet> MakeInput()
+{
+  const int res = 40;
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(res + 1, res + 1, res + 1);
+  image->SetSpacing(1.0 / res, 1.0 / res, 1.0 / res);
+  const vtkIdType nCells = image->GetNumberOfCells();
+
+  vtkNew<vtkDoubleArray> fraction1;
+  fraction1->SetName("Fraction1");
+  fraction1->SetNumberOfTuples(nCells);
+  vtkNew<vtkDoubleArray> fraction2;
+  fraction2->SetName("Fraction2");
+  fraction2->SetNumberOfTuples(nCells);
+  vtkNew<vtkDoubleArray> normal1;
+  normal1->SetName("Normal1");
+  normal1->SetNumberOfComponents(3);
+  normal1->SetNumberOfTuples(nCells);
+  vtkNew<vtkFloatArray> normal2X;
+  normal2X->SetName("Normal2X");
+  normal2X->SetNumberOfTuples(nCells);
+  vtkNew<vtkFloatArray> normal2Y;
+  normal2Y->SetName("Normal2Y");
+  normal2Y->SetNumberOfTuples(nCells);
+  vtkNew<vtkFloatArray> normal2Z;
+  normal2Z->SetName("Normal2Z");
+  normal2Z->SetNumberOfTuples(nCells);
+  vtkNew<vtkDoubleArray> ordering;
+  ordering->SetName("Ordering");
+  ordering->SetNumberOfTuples(nCells);
+  vtkNew<vtkFloatArray> cellValues;
+  cellValues->SetName("CellValues");
+  cellValues->SetNumberOfComponents(3);
+  cellValues->SetNumberOfTuples(nCells);
+
+  const double centers[2][3] = { { 0.3, 0.3, 0.5 }, { 0.7, 0.65, 0.5 } };
+  for (vtkIdType ci = 0; ci < nCells; ++ci)
+  {
+    const int ijk[3] = { static_cast<int>(ci % res), static_cast<int>((ci / res) % res),
+      static_cast<int>(ci / (res * res)) };
+    double x[3];
+    double gradients[2][3];
+    double distances[2];
+    for (int m = 0; m < 2; ++m)
+    {
+      distances[m] = 0.0;
+      for (int k = 0; k < 3; ++k)
+      {
+        x[k] = (ijk[k] + 0.5) / res;
+        gradients[m][k] = x[k] - centers[m][k];
+        distances[m] += gradients[m][k] * gradients[m][k];
+      }
+      distances[m] = std::sqrt(distances[m]);
+    }
+    // the fractions vary linearly over a few cells around the sphere surfaces
+    const double f1 = std::min(1.0, std::max(0.0, 0.5 + (0.15 - distances[0]) * res / 4));
+    const double f2 = std::min(1.0, std::max(0.0, 0.5 + (0.15 - distances[1]) * res / 4));
+    fraction1->SetValue(ci, f1);
+    fraction2->SetValue(ci, f2);
+    normal1->SetTuple(ci, gradients[0]);
+    normal2X->SetValue(ci, static_cast<float>(gradients[1][0]));
+    normal2Y->SetValue(ci, static_cast<float>(gradients[1][1]));
+    normal2Z->SetValue(ci, static_cast<float>(gradients[1][2]));
+    ordering->SetValue(ci, (ci % 7) < 3 ? 1.0 : 0.0);
+    cellValues->SetTuple3(ci, x[0], x[1], static_cast<double>(ci));
+  }
+  image->GetCellData()->AddArray(fraction1);
+  image->GetCellData()->AddArray(fraction2);
+  image->GetCellData()->AddArray(normal1);
+  image->GetCellData()->AddArray(normal2X);
+  image->GetCellData()->AddArray(normal2Y);
+  image->GetCellData()->AddArray(normal2Z);
+  image->GetCellData()->AddArray(ordering);
+  image->GetCellData()->AddArray(cellValues);
+
+  vtkNew<vtkDoubleArray> pointValues;
+  pointValues->SetName("PointValues");
+  pointValues->SetNumberOfComponents(2);
+  pointValues->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType pi = 0; pi < image->GetNumberOfPoints(); ++pi)
+  {
+    double x[3];
+    image->GetPoint(pi, x);
+    pointValues->SetTuple2(pi, x[0] * x[1], x[2]);
+  }
+  image->GetPointData()->AddArray(pointValues);
+
+  auto input = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  input->SetNumberOfBlocks(1);
+  input->SetBlock(0, image);
+  return input;
+}
+
+vtkSmartPointer<vtkMultiBlockDataSet> Reconstruct(
+  vtkMultiBlockDataSet* input, bool onionPeel, bool fillMaterial)
+{
+  vtkNew<vtkYoungsMaterialInterface> youngs;
+  youngs->SetInputData(input);
+  youngs->SetNumberOfMaterials(2);
+  youngs->SetMaterialArrays(0, "Fraction1", "Normal1", "Ordering");
+  youngs->SetMaterialArrays(1, "Fraction2", "Normal2X", "Normal2Y", "Normal2Z", "Ordering");
+  youngs->SetVolumeFractionRange(0.01, 0.99);
+  youngs->SetOnionPeel(onionPeel);
+  youngs->SetFillMaterial(fillMaterial);
+  youngs->Update();
+  auto output = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  output->ShallowCopy(youngs->GetOutput());
+  return output;
+}
+
+bool SameArrays(vtkDataSetAttributes* attributes1, vtkDataSetAttributes* attributes2)
+{
+  if (attributes1->GetNumberOfArrays() != attributes2->GetNumberOfArrays())
+  {
+    std::cerr << "Different numbers of arrays" << std::endl;
+    return false;
+  }
+  for (int a = 0; a < attributes1->GetNumberOfArrays(); ++a)
+  {
+    vtkDataArray* array1 = attributes1->GetArray(a);
+    vtkDataArray* array2 = attributes2->GetArray(array1->GetName());
+    if (!array2 || array1->GetNumberOfTuples() != array2->GetNumberOfTuples() ||
+      array1->GetNumberOfComponents() != array2->GetNumberOfComponents())
+    {
+      std::cerr << "Different array " << array1->GetName() << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < array1->GetNumberOfTuples(); ++i)
+    {
+      for (int c = 0; c < array1->GetNumberOfComponents(); ++c)
+      {
+        if (array1->GetComponent(i, c) != array2->GetComponent(i, c))
+        {
+          std::cerr << "Different values of " << array1->GetName() << " at tuple " << i
+                    << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool SameOutputs(vtkMultiBlockDataSet* output1, vtkMultiBlockDataSet* output2)
+{
+  vtkSmartPointer<vtkCompositeDataIterator> it1;
+  it1.TakeReference(output1->NewIterator());
+  vtkSmartPointer<vtkCompositeDataIterator> it2;
+  it2.TakeReference(output2->NewIterator());
+  vtkIdType nCells = 0;
+  for (it1->InitTraversal(), it2->InitTraversal(); !it1->IsDoneWithTraversal();
+       it1->GoToNextItem(), it2->GoToNextItem())
+  {
+    vtkDataSet* block1 = vtkDataSet::SafeDownCast(it1->GetCurrentDataObject());
+    vtkDataSet* block2 =
+      it2->IsDoneWithTraversal() ? nullptr : vtkDataSet::SafeDownCast(it2->GetCurrentDataObject());
+    if (!block1 || !block2 || block1->GetNumberOfPoints() != block2->GetNumberOfPoints() ||
+      block1->GetNumberOfCells() != block2->GetNumberOfCells())
+    {
+      std::cerr << "Different blocks" << std::endl;
+      return false;
+    }
+    for (vtkIdType pi = 0; pi < block1->GetNumberOfPoints(); ++pi)
+    {
+      double x1[3];
+      double x2[3];
+      block1->GetPoint(pi, x1);
+      block2->GetPoint(pi, x2);
+      if (x1[0] != x2[0] || x1[1] != x2[1] || x1[2] != x2[2])
+      {
+        std::cerr << "Different points at " << pi << std::endl;
+        return false;
+      }
+    }
+    for (vtkIdType ci = 0; ci < block1->GetNumberOfCells(); ++ci)
+    {
+      vtkNew<vtkIdList> ids1;
+      vtkNew<vtkIdList> ids2;
+      block1->GetCellPoints(ci, ids1);
+      block2->GetCellPoints(ci, ids2);
+      if (block1->GetCellType(ci) != block2->GetCellType(ci) ||
+        ids1->GetNumberOfIds() != ids2->GetNumberOfIds() ||
+        !std::equal(ids1->begin(), ids1->end(), ids2->begin()))
+      {
+        std::cerr << "Different cells at " << ci << std::endl;
+        return false;
+      }
+    }
+    if (!SameArrays(block1->GetPointData(), block2->GetPointData()) ||
+      !SameArrays(block1->GetCellData(), block2->GetCellData()))
+    {
+      return false;
+    }
+    nCells += block1->GetNumberOfCells();
+  }
+  if (!it2->IsDoneWithTraversal() || nCells == 0)
+  {
+    std::cerr << "Different or empty outputs" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestYoungsMaterialInterfaceThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkMultiBlockDataSet> input = MakeInput();
+  for (int onionPeel = 0; onionPeel < 2; ++onionPeel)
+  {
+    for (int fillMaterial = 0; fillMaterial < 2; ++fillMaterial)
+    {
+      vtkSmartPointer<vtkMultiBlockDataSet> serial;
+      vtkSMPTools::LocalScope(vtkSMPTools::Config{ "Sequential" },
+        [&]() { serial = Reconstruct(input, onionPeel != 0, fillMaterial != 0); });
+      vtkSmartPointer<vtkMultiBlockDataSet> threaded =
+        Reconstruct(input, onionPeel != 0, fillMaterial != 0);
+      if (!SameOutputs(serial, threaded))
+      {
+        std::cerr << "The threaded output differs from the serial one with OnionPeel "
+                  << onionPeel << " and FillMaterial " << fillMaterial << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
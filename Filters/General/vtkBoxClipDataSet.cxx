@@ -20,6 +20,7 @@
 
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkClipDataSetInternal.h"
 #include "vtkExecutive.h"
 #include "vtkFloatArray.h"
 #include "vtkGenericCell.h"
@@ -39,6 +40,158 @@
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// Clip a cell into a chunk of vtkClipChunks
+struct BoxClipCellWorker
+{
+  vtkBoxClipDataSet* Filter;
+  unsigned int Orientation;
+  int NumberOfOutputs;
+  vtkPointData* InPD;
+  vtkCellData* InCD;
+
+  void operator()(vtkGenericCell* cell, vtkIdType cellId, vtkClipChunks::Chunk& chunk)
+  {
+    vtkBoxClipDataSet* self = this->Filter;
+    vtkPoints* points = chunk.Points;
+    vtkIncrementalPointLocator* locator = chunk.Locator;
+    vtkCellArray* conn[2] = { chunk.Cells[0], chunk.Cells[1] };
+    vtkPointData* outPD[2] = { chunk.PointData, chunk.PointData };
+    vtkCellData* outCD[2] = { chunk.CellData[0], chunk.CellData[1] };
+    vtkPointData* inPD = this->InPD;
+    vtkCellData* inCD = this->InCD;
+    vtkIdType first[2] = { conn[0]->GetNumberOfCells(),
+      this->NumberOfOutputs == 2 ? conn[1]->GetNumberOfCells() : 0 };
+
+    const int dimension = cell->GetCellDimension();
+    if (this->NumberOfOutputs == 2)
+    {
+      switch (dimension)
+      {
+        case 3:
+          if (this->Orientation)
+          {
+            self->ClipHexahedronInOut(
+              points, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          else
+          {
+            self->ClipBoxInOut(points, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          break;
+        case 2:
+          if (this->Orientation)
+          {
+            self->ClipHexahedronInOut2D(
+              points, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          else
+          {
+            self->ClipBoxInOut2D(points, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          break;
+        case 1:
+          if (this->Orientation)
+          {
+            self->ClipHexahedronInOut1D(
+              points, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          else
+          {
+            self->ClipBoxInOut1D(points, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          break;
+        case 0:
+          if (this->Orientation)
+          {
+            self->ClipHexahedronInOut0D(cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          else
+          {
+            self->ClipBoxInOut0D(cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+          }
+          break;
+      }
+    }
+    else
+    {
+      switch (dimension)
+      {
+        case 3:
+          if (this->Orientation)
+          {
+            self->ClipHexahedron(
+              points, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          else
+          {
+            self->ClipBox(points, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          break;
+        case 2:
+          if (this->Orientation)
+          {
+            self->ClipHexahedron2D(
+              points, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          else
+          {
+            self->ClipBox2D(points, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          break;
+        case 1:
+          if (this->Orientation)
+          {
+            self->ClipHexahedron1D(
+              points, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          else
+          {
+            self->ClipBox1D(points, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          break;
+        case 0:
+          if (this->Orientation)
+          {
+            self->ClipHexahedron0D(cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          else
+          {
+            self->ClipBox0D(cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          }
+          break;
+      }
+    }
+
+    // For each new cell added, got to set the type of the cell
+    for (int o = 0; o < this->NumberOfOutputs; o++)
+    {
+      for (vtkIdType id = first[o]; id < conn[o]->GetNumberOfCells(); id++)
+      {
+        const vtkIdType npts = conn[o]->GetCellSize(id);
+        int cellType = VTK_TETRA;
+        switch (dimension)
+        {
+          case 0:
+            cellType = (npts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX);
+            break;
+          case 1:
+            cellType = (npts > 2 ? VTK_POLY_LINE : VTK_LINE);
+            break;
+          case 2:
+            cellType = (npts == 3 ? VTK_TRIANGLE : (npts == 4 ? VTK_QUAD : VTK_POLYGON));
+            break;
+        }
+        const vtkIdType newCellId = chunk.Types[o]->InsertNextValue(cellType);
+        outCD[o]->CopyData(inCD, cellId, newCellId);
+      }
+    }
+  }
+};
+}
+
 vtkStandardNewMacro(vtkBoxClipDataSet);
 vtkCxxSetObjectMacro(vtkBoxClipDataSet, Locator, vtkIncrementalPointLocator);
 //------------------------------------------------------------------------------
@@ -230,14 +383,37 @@ int vtkBoxClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     types[1]->Allocate(estimatedSize, estimatedSize / 2);
   }
 
-  newPoints = vtkPoints::New();
-  newPoints->Allocate(numPts, numPts / 2);
-
   // locator used to merge potentially duplicate points
   if (this->Locator == nullptr)
   {
     this->CreateDefaultLocator();
   }
+
+  vtkDataArray* scalars = this->GetInputArrayToProcess(0, inputVector);
+  unsigned int orientation = this->GetOrientation(); // Test if there is a transformation
+
+  // The cells are clipped in parallel when the points are merged by the
+  // default vtkMergePoints locator.
+  if (CanClipCellsInParallel(input, this->Locator))
+  {
+    conn[0]->Delete();
+    types[0]->Delete();
+    if (this->GenerateClippedOutput)
+    {
+      conn[1]->Delete();
+      types[1]->Delete();
+    }
+    vtkClipChunks chunks(
+      input, inPD, inCD, numOutputs, VTK_FLOAT, this->GenerateClipScalars || scalars);
+    BoxClipCellWorker worker{ this, orientation, numOutputs, inPD, inCD };
+    vtkUnstructuredGrid* outputs[2] = { output, clippedOutput };
+    chunks.Execute(this, worker, outputs, true);
+    output->Squeeze();
+    return 1;
+  }
+
+  newPoints = vtkPoints::New();
+  newPoints->Allocate(numPts, numPts / 2);
   this->Locator->InitPointInsertion(newPoints, input->GetBounds());
 
   outPD[0] = output->GetPointData();
@@ -246,7 +422,6 @@ int vtkBoxClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     outPD[1] = output->GetPointData();
   }
 
-  vtkDataArray* scalars = this->GetInputArrayToProcess(0, inputVector);
   if (!this->GenerateClipScalars && !scalars)
   {
     outPD[0]->CopyScalarsOff();
@@ -287,8 +462,6 @@ int vtkBoxClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   num[0] = num[1] = 0;
   numNew[0] = numNew[1] = 0;
 
-  unsigned int orientation = this->GetOrientation(); // Test if there is a transformation
-
   // clock_t init_tmp = clock();
   for (cellId = 0; cellId < numCells && !abort; cellId++)
   {
@@ -33,6 +33,10 @@
  * The vtkBoxClipDataSet will triangulate all types of 3D cells (i.e, create tetrahedra).
  * This is necessary to preserve compatibility across face neighbors.
  *
+ * With the default vtkMergePoints locator, the cells are clipped in parallel
+ * with vtkSMPTools. The output may then differ from the serial output in
+ * point and cell order only.
+ *
  * To use this filter,you can decide if you will be clipping with a box or a hexahedral box.
  * 1) Set orientation
  *    if(SetOrientation(0)): box (parallel with coordinate axis)
@@ -18,6 +18,7 @@
 #include "vtkCallbackCommand.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkClipDataSetInternal.h"
 #include "vtkClipVolume.h"
 #include "vtkExecutive.h"
 #include "vtkFloatArray.h"
@@ -31,12 +32,103 @@
 #include "vtkNonLinearCell.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
 #include "vtkPolyhedron.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// Type of the cells generated by clipping a cell
+VTKCellType GetClippedCellType(vtkGenericCell* cell, vtkIdType npts, bool sameCell)
+{
+  if (sameCell)
+  {
+    return static_cast<VTKCellType>(cell->GetCellType());
+  }
+  else if (cell->GetCellType() == VTK_POLYHEDRON)
+  {
+    return VTK_POLYHEDRON;
+  }
+  else
+  {
+    switch (cell->GetCellDimension())
+    {
+      case 0: // points are generated--------------------------------
+        return (npts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX);
+
+      case 1: // lines are generated---------------------------------
+        return (npts > 2 ? VTK_POLY_LINE : VTK_LINE);
+
+      case 2: // polygons are generated------------------------------
+        return (npts == 3 ? VTK_TRIANGLE : (npts == 4 ? VTK_QUAD : VTK_POLYGON));
+
+      case 3: // tetrahedra or wedges are generated------------------
+        return (npts == 4 ? VTK_TETRA : VTK_WEDGE);
+
+      default:
+        vtkErrorWithObjectMacro(nullptr, "Dimension cannot be lower than 0 or higher than 3");
+        break;
+    }
+  }
+
+  return VTK_EMPTY_CELL;
+}
+
+//------------------------------------------------------------------------------
+// Clip a cell into a chunk of vtkClipChunks
+struct ClipCellWorker
+{
+  vtkDataArray* ClipScalars;
+  double Value;
+  int InsideOut;
+  bool StableClipNonLinear;
+  int NumberOfOutputs;
+  vtkPointData* InPD;
+  vtkCellData* InCD;
+  vtkSMPThreadLocalObject<vtkFloatArray> CellScalars;
+
+  void operator()(vtkGenericCell* cell, vtkIdType cellId, vtkClipChunks::Chunk& chunk)
+  {
+    vtkFloatArray* cellScalars = this->CellScalars.Local();
+    vtkIdList* cellIds = cell->GetPointIds();
+    const vtkIdType npts = cell->GetPoints()->GetNumberOfPoints();
+    for (vtkIdType i = 0; i < npts; i++)
+    {
+      double s = this->ClipScalars->GetComponent(cellIds->GetId(i), 0);
+      cellScalars->InsertTuple(i, &s);
+    }
+    vtkNonLinearCell* nonLinearCell = vtkNonLinearCell::SafeDownCast(cell->GetRepresentativeCell());
+
+    for (int o = 0; o < this->NumberOfOutputs; ++o)
+    {
+      vtkCellArray* conn = chunk.Cells[o];
+      const vtkIdType first = conn->GetNumberOfCells();
+      bool sameCell = false;
+      if (this->StableClipNonLinear && nonLinearCell != nullptr)
+      {
+        sameCell = nonLinearCell->StableClip(this->Value, cellScalars, chunk.Locator, conn,
+          this->InPD, chunk.PointData, this->InCD, cellId, chunk.CellData[o], this->InsideOut);
+      }
+      else
+      {
+        cell->Clip(this->Value, cellScalars, chunk.Locator, conn, this->InPD, chunk.PointData,
+          this->InCD, cellId, chunk.CellData[o], this->InsideOut);
+      }
+      for (vtkIdType id = first; id < conn->GetNumberOfCells(); ++id)
+      {
+        chunk.Types[o]->InsertNextValue(
+          GetClippedCellType(cell, conn->GetCellSize(id), sameCell));
+      }
+    }
+  }
+};
+}
+
 vtkStandardNewMacro(vtkClipDataSet);
 vtkCxxSetObjectMacro(vtkClipDataSet, ClipFunction, vtkImplicitFunction);
 
@@ -276,14 +368,11 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     newPoints->SetDataType(VTK_DOUBLE);
   }
 
-  newPoints->Allocate(numPts, numPts / 2);
-
   // locator used to merge potentially duplicate points
   if (this->Locator == nullptr)
   {
     this->CreateDefaultLocator();
   }
-  this->Locator->InitPointInsertion(newPoints, input->GetBounds());
 
   // Determine whether we're clipping with input scalars or a clip function
   // and do necessary setup.
@@ -298,11 +387,20 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     {
       inPD->SetScalars(tmpScalars);
     }
-    double pt[3];
-    for (i = 0; i < numPts; i++)
+    vtkPointSet* pointSet = vtkPointSet::SafeDownCast(input);
+    if (pointSet && pointSet->GetPoints())
     {
-      input->GetPoint(i, pt);
-      tmpScalars->SetValue(i, this->ClipFunction->FunctionValue(pt));
+      // evaluate all the points at once
+      this->ClipFunction->FunctionValue(pointSet->GetPoints()->GetData(), tmpScalars);
+    }
+    else
+    {
+      double pt[3];
+      for (i = 0; i < numPts; i++)
+      {
+        input->GetPoint(i, pt);
+        tmpScalars->SetValue(i, this->ClipFunction->FunctionValue(pt));
+      }
     }
     clipScalars = tmpScalars;
   }
@@ -334,6 +432,34 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   //  {
   //  outPD->CopyScalarsOn();
   //  }
+  double value = 0.0;
+  if (this->UseValueAsOffset || !this->ClipFunction)
+  {
+    value = this->Value;
+  }
+
+  // The cells are clipped in parallel when the points are merged by the
+  // default vtkMergePoints locator.
+  if (CanClipCellsInParallel(input, this->Locator))
+  {
+    vtkClipChunks chunks(input, inPD, inCD, numOutputs, newPoints->GetDataType(), true);
+    ClipCellWorker worker{ clipScalars, value, this->InsideOut, this->StableClipNonLinear,
+      numOutputs, inPD, inCD, {} };
+    vtkUnstructuredGrid* outputs[2] = { output, clippedOutput };
+    chunks.Execute(this, worker, outputs, false);
+
+    if (this->ClipFunction)
+    {
+      clipScalars->Delete();
+      inPD->Delete();
+    }
+    output->Squeeze();
+    return 1;
+  }
+
+  newPoints->Allocate(numPts, numPts / 2);
+  this->Locator->InitPointInsertion(newPoints, input->GetBounds());
+
   vtkDataSetAttributes* tempDSA = vtkDataSetAttributes::New();
   tempDSA->InterpolateAllocate(inPD, 1, 2);
   outPD->InterpolateAllocate(inPD, estimatedSize, estimatedSize / 2);
@@ -378,12 +504,6 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
       cellScalars->InsertTuple(i, &s);
     }
 
-    double value = 0.0;
-    if (this->UseValueAsOffset || !this->ClipFunction)
-    {
-      value = this->Value;
-    }
-
     // perform the clipping
     for (i = 0; i < numOutputs; ++i)
     {
@@ -404,46 +524,12 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
       }
     }
 
-    auto getCellType = [](vtkGenericCell* gCell, vtkIdType nPts, bool isSameCell) {
-      if (isSameCell)
-      {
-        return static_cast<VTKCellType>(gCell->GetCellType());
-      }
-      else if (gCell->GetCellType() == VTK_POLYHEDRON)
-      {
-        return VTK_POLYHEDRON;
-      }
-      else
-      {
-        switch (gCell->GetCellDimension())
-        {
-          case 0: // points are generated--------------------------------
-            return (nPts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX);
-
-          case 1: // lines are generated---------------------------------
-            return (nPts > 2 ? VTK_POLY_LINE : VTK_LINE);
-
-          case 2: // polygons are generated------------------------------
-            return (nPts == 3 ? VTK_TRIANGLE : (nPts == 4 ? VTK_QUAD : VTK_POLYGON));
-
-          case 3: // tetrahedra or wedges are generated------------------
-            return (nPts == 4 ? VTK_TETRA : VTK_WEDGE);
-
-          default:
-            vtkErrorWithObjectMacro(nullptr, "Dimension cannot be lower than 0 or higher than 3");
-            break;
-        }
-      }
-
-      return VTK_EMPTY_CELL;
-    };
-
     for (i = 0; i < numOutputs; i++)
     {
       for (j = 0; j < numNew[i]; j++)
       {
         conn[i]->GetNextCell(npts, pts);
-        types[i]->InsertNextValue(getCellType(cell, npts, sameCell[i]));
+        types[i]->InsertNextValue(GetClippedCellType(cell, npts, sameCell[i]));
       }
     }
   }
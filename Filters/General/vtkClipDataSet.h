@@ -47,6 +47,12 @@
  * second output is the part of the cell that is clipped away. Set the
  * GenerateClippedData boolean on if you wish to access this output data.
  *
+ * With the default vtkMergePoints locator, the cells of the input are
+ * clipped in parallel with vtkSMPTools. The input
+ * is split into chunks of cells and the coincident points of the chunks are
+ * merged afterwards, so the output may differ from the serial output in
+ * point and cell order only.
+ *
  * @warning
  * vtkClipDataSet will triangulate all types of 3D cells (i.e., create
  * tetrahedra). This is true even if the cell is not actually cut. This
@@ -0,0 +1,569 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkClipDataSetInternal.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkClipDataSetInternal
+ * @brief   clip the cells of a dataset one by one in parallel
+ *
+ * vtkClipDataSetInternal gathers the helpers used by vtkClipDataSet and
+ * vtkBoxClipDataSet to clip cells with the generic per-cell algorithms using
+ * vtkSMPTools.
+ *
+ * The per-cell algorithms triangulate the cells according to the order of the
+ * ids given by the point locator, so two cells sharing a face must see its
+ * points in the same order for their triangulations to match. The cells are
+ * thus split into chunks of contiguous cells, and the cells whose points are
+ * only used by the cells of their chunk are clipped in parallel, each chunk
+ * having its own points, vtkMergePoints locator, point data and cells. The
+ * points of the chunks are then merged, sorting them by coordinates, and
+ * numbered in the order of the chunks. Finally the cells sharing points with
+ * other chunks are clipped serially with a locator holding the merged points,
+ * so that the points of each chunk keep their order.
+ *
+ * The output only depends on the size of the chunks, not on the number of
+ * threads, and is the same as the serial output for inputs of a single chunk.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkClipDataSet vtkBoxClipDataSet
+ */
+
+#ifndef vtkClipDataSetInternal_h
+#define vtkClipDataSetInternal_h
+
+#include "vtkAlgorithm.h"
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellData.h"
+#include "vtkDataSet.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Returns true if the cells of the input can be clipped in parallel: the
+// points must be merged by a vtkMergePoints locator, which the chunks use, and
+// the cells must not be Bezier wedges, whose shape functions share static cells.
+bool CanClipCellsInParallel(vtkDataSet* input, vtkIncrementalPointLocator* locator)
+{
+  if (strcmp(locator->GetClassName(), "vtkMergePoints") != 0)
+  {
+    return false;
+  }
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (!grid)
+  {
+    return true;
+  }
+  vtkUnsignedCharArray* types = grid->GetDistinctCellTypesArray();
+  for (vtkIdType i = 0; types && i < types->GetNumberOfTuples(); ++i)
+  {
+    if (types->GetValue(i) == VTK_BEZIER_WEDGE)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// The cells of a dataset clipped by chunks, into one output or two when the
+// clipped output is generated.
+class vtkClipChunks
+{
+public:
+  // Number of contiguous cells clipped by a chunk
+  static constexpr vtkIdType ChunkSize = 10000;
+
+  // Output of the clipping of some cells
+  struct Chunk
+  {
+    vtkSmartPointer<vtkPoints> Points;
+    vtkSmartPointer<vtkMergePoints> Locator;
+    vtkSmartPointer<vtkPointData> PointData;
+    vtkSmartPointer<vtkCellArray> Cells[2];
+    vtkSmartPointer<vtkUnsignedCharArray> Types[2];
+    vtkSmartPointer<vtkCellData> CellData[2];
+  };
+
+  vtkClipChunks(vtkDataSet* input, vtkPointData* inPD, vtkCellData* inCD, int numOutputs,
+    int pointsType, bool copyScalars)
+    : Input(input)
+    , InPD(inPD)
+    , InCD(inCD)
+    , NumberOfOutputs(numOutputs)
+    , PointsType(pointsType)
+    , CopyScalars(copyScalars)
+  {
+    input->GetBounds(this->Bounds);
+  }
+
+  //------------------------------------------------------------------------------
+  // Clip each cell with clipCell(cell, cellId, chunk), which inserts the
+  // output of the cell into the chunk, then gather the chunks into the
+  // outputs, which share their points. The point data of the clipped output
+  // is only set if clippedPointData is true.
+  template <typename CellClipper>
+  void Execute(vtkAlgorithm* filter, CellClipper& clipCell, vtkUnstructuredGrid* outputs[2],
+    bool clippedPointData)
+  {
+    const vtkIdType numCells = this->Input->GetNumberOfCells();
+    if (numCells == 0)
+    {
+      return;
+    }
+    this->Chunks.resize((numCells + ChunkSize - 1) / ChunkSize);
+    this->Shared.assign(numCells, 0);
+
+    // Call this once to make sure GetCell() is thread safe
+    vtkNew<vtkGenericCell> firstCell;
+    this->Input->GetCell(0, firstCell);
+
+    this->FindSharedCells(filter);
+    if (filter->GetAbortOutput())
+    {
+      return;
+    }
+
+    vtkSMPThreadLocalObject<vtkGenericCell> cells;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->Chunks.size()), 1,
+      [&](vtkIdType begin, vtkIdType end) {
+        vtkGenericCell* cell = cells.Local();
+        bool isFirst = vtkSMPTools::GetSingleThread();
+        for (vtkIdType chunkId = begin; chunkId < end; ++chunkId)
+        {
+          if (isFirst)
+          {
+            filter->CheckAbort();
+          }
+          if (filter->GetAbortOutput())
+          {
+            return;
+          }
+          const vtkIdType firstCellId = chunkId * ChunkSize;
+          const vtkIdType endCellId = std::min(numCells, firstCellId + ChunkSize);
+          Chunk& chunk = this->Chunks[chunkId];
+          this->InitializeChunk(chunk, endCellId - firstCellId);
+          chunk.Locator->InitPointInsertion(chunk.Points, this->Bounds);
+          for (vtkIdType cellId = firstCellId; cellId < endCellId; ++cellId)
+          {
+            if (!this->Shared[cellId])
+            {
+              this->Input->GetCell(cellId, cell);
+              clipCell(cell, cellId, chunk);
+            }
+          }
+          chunk.Locator = nullptr; // release the search structure
+        }
+      });
+    if (filter->GetAbortOutput())
+    {
+      return;
+    }
+
+    // The cells shared with other chunks are clipped serially, starting from
+    // the merged points of the chunks.
+    const vtkIdType numShared = std::count(this->Shared.begin(), this->Shared.end(), 1);
+    this->InitializeChunk(this->Last, numShared);
+    vtkSmartPointer<vtkPoints> mergedPoints = this->MergePoints();
+    const vtkIdType numMerged = mergedPoints->GetNumberOfPoints();
+    this->Last.Points->Allocate(numMerged + numShared);
+    this->Last.Locator->InitPointInsertion(this->Last.Points, this->Bounds);
+    for (vtkIdType i = 0; i < numMerged; ++i)
+    {
+      this->Last.Locator->InsertNextPoint(mergedPoints->GetPoint(i));
+    }
+    mergedPoints = nullptr;
+
+    vtkNew<vtkGenericCell> cell;
+    vtkIdType checkAbortInterval = std::min(numCells / 10 + 1, (vtkIdType)1000);
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      if (cellId % checkAbortInterval == 0 && filter->CheckAbort())
+      {
+        return;
+      }
+      if (this->Shared[cellId])
+      {
+        this->Input->GetCell(cellId, cell);
+        clipCell(cell, cellId, this->Last);
+      }
+    }
+    this->Last.Locator = nullptr;
+
+    for (int o = 0; o < this->NumberOfOutputs; ++o)
+    {
+      this->MergeCells(o, outputs[o]);
+      outputs[o]->SetPoints(this->Last.Points);
+    }
+    outputs[0]->GetPointData()->ShallowCopy(this->Last.PointData);
+    if (this->NumberOfOutputs == 2 && clippedPointData)
+    {
+      outputs[1]->GetPointData()->ShallowCopy(this->Last.PointData);
+    }
+  }
+
+private:
+  //------------------------------------------------------------------------------
+  // Flag the cells using points also used by the cells of other chunks.
+  void FindSharedCells(vtkAlgorithm* filter)
+  {
+    const vtkIdType numCells = this->Input->GetNumberOfCells();
+    const vtkIdType numChunks = static_cast<vtkIdType>(this->Chunks.size());
+
+    // The chunk using each point, -2 when used by several chunks
+    std::vector<std::atomic<vtkIdType>> owners(this->Input->GetNumberOfPoints());
+    vtkSMPTools::For(0, static_cast<vtkIdType>(owners.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        owners[ptId] = -1;
+      }
+    });
+
+    vtkSMPThreadLocalObject<vtkIdList> idLists;
+    vtkSMPTools::For(0, numChunks, 1, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdList* ids = idLists.Local();
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      for (vtkIdType chunkId = begin; chunkId < end; ++chunkId)
+      {
+        if (isFirst)
+        {
+          filter->CheckAbort();
+        }
+        if (filter->GetAbortOutput())
+        {
+          return;
+        }
+        const vtkIdType endCellId = std::min(numCells, (chunkId + 1) * ChunkSize);
+        for (vtkIdType cellId = chunkId * ChunkSize; cellId < endCellId; ++cellId)
+        {
+          this->Input->GetCellPoints(cellId, ids);
+          for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+          {
+            vtkIdType owner = -1;
+            if (!owners[ids->GetId(i)].compare_exchange_strong(owner, chunkId) &&
+              owner != chunkId)
+            {
+              owners[ids->GetId(i)] = -2;
+            }
+          }
+        }
+      }
+    });
+    if (filter->GetAbortOutput())
+    {
+      return;
+    }
+
+    vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdList* ids = idLists.Local();
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        this->Input->GetCellPoints(cellId, ids);
+        for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+        {
+          if (owners[ids->GetId(i)] == -2)
+          {
+            this->Shared[cellId] = 1;
+            break;
+          }
+        }
+      }
+    });
+  }
+
+  //------------------------------------------------------------------------------
+  void InitializeChunk(Chunk& chunk, vtkIdType numCells)
+  {
+    chunk.Points = vtkSmartPointer<vtkPoints>::New();
+    chunk.Points->SetDataType(this->PointsType);
+    chunk.Points->Allocate(numCells);
+    chunk.Locator = vtkSmartPointer<vtkMergePoints>::New();
+    chunk.PointData = vtkSmartPointer<vtkPointData>::New();
+    if (!this->CopyScalars)
+    {
+      chunk.PointData->CopyScalarsOff();
+    }
+    chunk.PointData->InterpolateAllocate(this->InPD, numCells);
+    for (int o = 0; o < this->NumberOfOutputs; ++o)
+    {
+      chunk.Cells[o] = vtkSmartPointer<vtkCellArray>::New();
+      chunk.Cells[o]->AllocateEstimate(numCells, 4);
+      chunk.Types[o] = vtkSmartPointer<vtkUnsignedCharArray>::New();
+      chunk.Types[o]->Allocate(numCells);
+      chunk.CellData[o] = vtkSmartPointer<vtkCellData>::New();
+      chunk.CellData[o]->CopyAllocate(this->InCD, numCells);
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  // Give the arrays and attributes of the chunk attributes to the output, with
+  // the given number of tuples.
+  static void AllocateAttributes(
+    vtkDataSetAttributes* output, vtkDataSetAttributes* chunk, vtkIdType numTuples)
+  {
+    output->CopyStructure(chunk);
+    int attributes[vtkDataSetAttributes::NUM_ATTRIBUTES];
+    chunk->GetAttributeIndices(attributes);
+    for (int i = 0; i < vtkDataSetAttributes::NUM_ATTRIBUTES; ++i)
+    {
+      if (attributes[i] >= 0)
+      {
+        output->SetActiveAttribute(attributes[i], i);
+      }
+    }
+    for (int a = 0; a < output->GetNumberOfArrays(); ++a)
+    {
+      output->GetAbstractArray(a)->SetNumberOfTuples(numTuples);
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  // Merge the points inserted by several chunks: the points are sorted by
+  // coordinates, then by number, so that each point is merged with the first
+  // point inserted at the same coordinates by a previous chunk. The merged
+  // points keep the order of their first insertion, and their data is set in
+  // the point data of the shared cells.
+  vtkSmartPointer<vtkPoints> MergePoints()
+  {
+    const vtkIdType numChunks = static_cast<vtkIdType>(this->Chunks.size());
+    this->PointOffsets.assign(numChunks + 1, 0);
+    for (vtkIdType c = 0; c < numChunks; ++c)
+    {
+      this->PointOffsets[c + 1] =
+        this->PointOffsets[c] + this->Chunks[c].Points->GetNumberOfPoints();
+    }
+    const vtkIdType numPoints = this->PointOffsets[numChunks];
+    std::vector<double> coords(3 * numPoints);
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType c = begin; c < end; ++c)
+      {
+        vtkPoints* points = this->Chunks[c].Points;
+        for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+        {
+          points->GetPoint(i, &coords[3 * (this->PointOffsets[c] + i)]);
+        }
+      }
+    });
+
+    std::vector<vtkIdType> order(numPoints);
+    std::iota(order.begin(), order.end(), 0);
+    vtkSMPTools::Sort(order.begin(), order.end(), [&](vtkIdType a, vtkIdType b) {
+      const double* pa = &coords[3 * a];
+      const double* pb = &coords[3 * b];
+      if (pa[0] != pb[0])
+      {
+        return pa[0] < pb[0];
+      }
+      if (pa[1] != pb[1])
+      {
+        return pa[1] < pb[1];
+      }
+      if (pa[2] != pb[2])
+      {
+        return pa[2] < pb[2];
+      }
+      return a < b;
+    });
+    // The points of a chunk that its locator did not merge are kept
+    auto chunkOf = [this](vtkIdType id) {
+      return std::upper_bound(this->PointOffsets.begin(), this->PointOffsets.end(), id) -
+        this->PointOffsets.begin();
+    };
+    std::vector<vtkIdType> firstIds(numPoints);
+    vtkIdType groupId = -1;
+    for (vtkIdType i = 0; i < numPoints; ++i)
+    {
+      const vtkIdType id = order[i];
+      const bool same = groupId >= 0 && coords[3 * id] == coords[3 * groupId] &&
+        coords[3 * id + 1] == coords[3 * groupId + 1] &&
+        coords[3 * id + 2] == coords[3 * groupId + 2];
+      if (!same)
+      {
+        groupId = id;
+      }
+      firstIds[id] = same && chunkOf(id) != chunkOf(groupId) ? groupId : id;
+    }
+    order.clear();
+    order.shrink_to_fit();
+
+    this->PointMap.resize(numPoints);
+    vtkIdType numMerged = 0;
+    for (vtkIdType i = 0; i < numPoints; ++i)
+    {
+      this->PointMap[i] = firstIds[i] == i ? numMerged++ : this->PointMap[firstIds[i]];
+    }
+
+    auto mergedPoints = vtkSmartPointer<vtkPoints>::New();
+    mergedPoints->SetDataType(this->PointsType);
+    mergedPoints->SetNumberOfPoints(numMerged);
+    vtkPointData* outPD = this->Last.PointData;
+    for (int a = 0; a < outPD->GetNumberOfArrays(); ++a)
+    {
+      outPD->GetAbstractArray(a)->SetNumberOfTuples(numMerged);
+    }
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType c = begin; c < end; ++c)
+      {
+        vtkPointData* chunkPD = this->Chunks[c].PointData;
+        for (vtkIdType i = 0; i < this->Chunks[c].Points->GetNumberOfPoints(); ++i)
+        {
+          const vtkIdType id = this->PointOffsets[c] + i;
+          if (firstIds[id] == id)
+          {
+            const vtkIdType mergedId = this->PointMap[id];
+            mergedPoints->SetPoint(mergedId, &coords[3 * id]);
+            for (int a = 0; a < outPD->GetNumberOfArrays(); ++a)
+            {
+              outPD->GetAbstractArray(a)->SetTuple(mergedId, i, chunkPD->GetAbstractArray(a));
+            }
+          }
+        }
+        this->Chunks[c].Points = nullptr;
+        this->Chunks[c].PointData = nullptr;
+      }
+    });
+    return mergedPoints;
+  }
+
+  //------------------------------------------------------------------------------
+  // Concatenate the cells of the chunks, renumbering their points, then the
+  // shared cells into an output. The polyhedra are given as face streams.
+  void MergeCells(int o, vtkUnstructuredGrid* output)
+  {
+    std::vector<const Chunk*> parts;
+    for (const Chunk& chunk : this->Chunks)
+    {
+      parts.push_back(&chunk);
+    }
+    parts.push_back(&this->Last);
+    const vtkIdType numParts = static_cast<vtkIdType>(parts.size());
+
+    std::vector<vtkIdType> cellOffsets(numParts + 1, 0);
+    std::vector<vtkIdType> connOffsets(numParts + 1, 0);
+    for (vtkIdType c = 0; c < numParts; ++c)
+    {
+      vtkCellArray* cells = parts[c]->Cells[o];
+      cellOffsets[c + 1] = cellOffsets[c] + cells->GetNumberOfCells();
+      connOffsets[c + 1] = connOffsets[c] + cells->GetNumberOfConnectivityIds();
+    }
+    const vtkIdType numCells = cellOffsets[numParts];
+
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(numCells + 1);
+    offsets->SetValue(numCells, connOffsets[numParts]);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(connOffsets[numParts]);
+    vtkNew<vtkUnsignedCharArray> types;
+    types->SetNumberOfValues(numCells);
+    vtkCellData* outCD = output->GetCellData();
+    this->AllocateAttributes(outCD, this->Last.CellData[o], numCells);
+
+    vtkSMPTools::For(0, numParts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType c = begin; c < end; ++c)
+      {
+        const Chunk& chunk = *parts[c];
+        // The points of the shared cells are already merged
+        const vtkIdType* map =
+          c < numParts - 1 ? this->PointMap.data() + this->PointOffsets[c] : nullptr;
+        auto mapId = [map](vtkIdType id) { return map ? map[id] : id; };
+        vtkIdType cellId = cellOffsets[c];
+        vtkIdType connId = connOffsets[c];
+        auto iter = vtk::TakeSmartPointer(chunk.Cells[o]->NewIterator());
+        for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+        {
+          vtkIdType npts;
+          const vtkIdType* pts;
+          iter->GetCurrentCell(npts, pts);
+          const vtkIdType chunkCellId = iter->GetCurrentCellId();
+          const unsigned char type = chunk.Types[o]->GetValue(chunkCellId);
+          offsets->SetValue(cellId, connId);
+          types->SetValue(cellId, type);
+          for (int a = 0; a < outCD->GetNumberOfArrays(); ++a)
+          {
+            outCD->GetAbstractArray(a)->SetTuple(
+              cellId, chunkCellId, chunk.CellData[o]->GetAbstractArray(a));
+          }
+          if (type == VTK_POLYHEDRON)
+          {
+            // [nFaces, nFace0Pts, ids..., nFace1Pts, ids...]
+            connectivity->SetValue(connId, pts[0]);
+            for (vtkIdType i = 1; i < npts; i += pts[i] + 1)
+            {
+              connectivity->SetValue(connId + i, pts[i]);
+              for (vtkIdType j = 1; j <= pts[i]; ++j)
+              {
+                connectivity->SetValue(connId + i + j, mapId(pts[i + j]));
+              }
+            }
+          }
+          else
+          {
+            for (vtkIdType i = 0; i < npts; ++i)
+            {
+              connectivity->SetValue(connId + i, mapId(pts[i]));
+            }
+          }
+          ++cellId;
+          connId += npts;
+        }
+      }
+    });
+
+    vtkNew<vtkCellArray> cells;
+    cells->SetData(offsets, connectivity);
+    output->SetCells(types, cells);
+  }
+
+  vtkDataSet* Input;
+  vtkPointData* InPD;
+  vtkCellData* InCD;
+  int NumberOfOutputs;
+  int PointsType;
+  bool CopyScalars;
+  double Bounds[6];
+  std::vector<Chunk> Chunks;
+  Chunk Last; // the cells shared by several chunks
+  std::vector<unsigned char> Shared;
+  std::vector<vtkIdType> PointOffsets;
+  std::vector<vtkIdType> PointMap;
+};
+
+} // anonymous namespace
+
+#endif // vtkClipDataSetInternal_h
+// VTK-HeaderTest-Exclude: vtkClipDataSetInternal.h
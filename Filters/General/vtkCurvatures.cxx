@@ -28,11 +28,14 @@
 #include "vtkPolyData.h"
 #include "vtkPolyDataNormals.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangle.h"
 #include "vtkTriangleFilter.h"
 #include "vtkTriangleStrip.h"
 
-#include <memory> // For unique_ptr
+#include <algorithm> // For std::min
+#include <memory>    // For unique_ptr
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCurvatures);
@@ -77,9 +80,6 @@ void vtkCurvatures::GetMeanCurvature(vtkPolyData* mesh)
   int numPts = polyData->GetNumberOfPoints();
 
   //     create-allocate
-  const vtkNew<vtkIdList> vertices;
-  const vtkNew<vtkIdList> vertices_n;
-  const vtkNew<vtkIdList> neighbours;
   const vtkNew<vtkDoubleArray> meanCurvature;
   meanCurvature->SetName("Mean_Curvature");
   meanCurvature->SetNumberOfComponents(1);
@@ -87,21 +87,10 @@ void vtkCurvatures::GetMeanCurvature(vtkPolyData* mesh)
   // Get the array so we can write to it directly
   double* meanCurvatureData = meanCurvature->GetPointer(0);
 
-  //     create-allocate
-  double n_f[3]; // normal of facet (could be stored for later?)
-  double n_n[3]; // normal of edge
-  double t[3];   // to store the cross product of n_f n_n
-  double ore[3]; // origin of e
-  double end[3]; // end of e
-  double oth[3]; //     third vertex necessary for comp of n
-  double vn0[3];
-  double vn1[3]; // vertices for computation of neighbour's n
-  double vn2[3];
-  double e[3]; // edge (oriented)
-
+  // The links are only read by the threads below
   polyData->BuildLinks();
   // data init
-  const int F = polyData->GetNumberOfCells();
+  const vtkIdType F = polyData->GetNumberOfCells();
   // init, preallocate the mean curvature
   const std::unique_ptr<int[]> num_neighb(new int[numPts]);
   for (int v = 0; v < numPts; v++)
@@ -110,81 +99,145 @@ void vtkCurvatures::GetMeanCurvature(vtkPolyData* mesh)
     num_neighb[v] = 0;
   }
 
+  // offsets of the edges of each facet in the edge arrays
+  const std::unique_ptr<vtkIdType[]> edgeOffsets(new vtkIdType[F + 1]);
+  edgeOffsets[0] = 0;
+  for (vtkIdType f = 0; f < F; ++f)
+  {
+    edgeOffsets[f + 1] = edgeOffsets[f] + polyData->GetCellSize(f);
+  }
+  const std::unique_ptr<double[]> edgeCurvature(new double[edgeOffsets[F]]);
+  const std::unique_ptr<bool[]> edgeComputed(new bool[edgeOffsets[F]]());
+
   //     main loop
   vtkDebugMacro(<< "Main loop: loop over facets such that id > id of neighb");
   vtkDebugMacro(<< "so that every edge comes only once");
 
-  for (vtkIdType f = 0; f < F; ++f)
-  {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-    polyData->GetCellPoints(f, vertices);
-    const vtkIdType nv = vertices->GetNumberOfIds();
-
-    for (vtkIdType v = 0; v < nv; v++)
+  // The contribution of an edge only depends on its two facets: the facets
+  // are processed in parallel, and the contributions are accumulated
+  // afterwards in the order of the facets.
+  vtkSMPThreadLocalObject<vtkIdList> tlVertices;
+  vtkSMPThreadLocalObject<vtkIdList> tlVerticesN;
+  vtkSMPThreadLocalObject<vtkIdList> tlNeighbours;
+  vtkSMPTools::For(0, F, [&](vtkIdType begin, vtkIdType endFacet) {
+    vtkIdList* vertices = tlVertices.Local();
+    vtkIdList* vertices_n = tlVerticesN.Local();
+    vtkIdList* neighbours = tlNeighbours.Local();
+
+    double n_f[3]; // normal of facet (could be stored for later?)
+    double n_n[3]; // normal of edge
+    double t[3];   // to store the cross product of n_f n_n
+    double ore[3]; // origin of e
+    double end[3]; // end of e
+    double oth[3]; //     third vertex necessary for comp of n
+    double vn0[3];
+    double vn1[3]; // vertices for computation of neighbour's n
+    double vn2[3];
+    double e[3]; // edge (oriented)
+
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    const vtkIdType checkAbortInterval =
+      std::min((endFacet - begin) / 10 + 1, static_cast<vtkIdType>(1000));
+    for (vtkIdType f = begin; f < endFacet; ++f)
     {
-      // get neighbour
-      const vtkIdType v_l = vertices->GetId(v);
-      const vtkIdType v_r = vertices->GetId((v + 1) % nv);
-      const vtkIdType v_o = vertices->GetId((v + 2) % nv);
-      polyData->GetCellEdgeNeighbors(f, v_l, v_r, neighbours);
-
-      vtkIdType n; // n short for neighbor
-
-      // compute only if there is really ONE neighbour
-      // AND meanCurvature has not been computed yet!
-      // (ensured by n > f)
-      if (neighbours->GetNumberOfIds() == 1 && (n = neighbours->GetId(0)) > f)
+      if (f % checkAbortInterval == 0)
       {
-        double Hf; // temporary store
-
-        // find 3 corners of f: in order!
-        polyData->GetPoint(v_l, ore);
-        polyData->GetPoint(v_r, end);
-        polyData->GetPoint(v_o, oth);
-        // compute normal of f
-        vtkTriangle::ComputeNormal(ore, end, oth, n_f);
-        // compute common edge
-        e[0] = end[0];
-        e[1] = end[1];
-        e[2] = end[2];
-        e[0] -= ore[0];
-        e[1] -= ore[1];
-        e[2] -= ore[2];
-        const double length = vtkMath::Normalize(e);
-        double Af = vtkTriangle::TriangleArea(ore, end, oth);
-        // find 3 corners of n: in order!
-        polyData->GetCellPoints(n, vertices_n);
-        polyData->GetPoint(vertices_n->GetId(0), vn0);
-        polyData->GetPoint(vertices_n->GetId(1), vn1);
-        polyData->GetPoint(vertices_n->GetId(2), vn2);
-        Af += double(vtkTriangle::TriangleArea(vn0, vn1, vn2));
-        // compute normal of n
-        vtkTriangle::ComputeNormal(vn0, vn1, vn2, n_n);
-        // the cosine is n_f * n_n
-        const double cs = vtkMath::Dot(n_f, n_n);
-        // the sin is (n_f x n_n) * e
-        vtkMath::Cross(n_f, n_n, t);
-        const double sn = vtkMath::Dot(t, e);
-        // signed angle in [-pi,pi]
-        if (sn != 0.0 || cs != 0.0)
+        if (isFirst)
         {
-          const double angle = atan2(sn, cs);
-          Hf = length * angle;
+          this->CheckAbort();
         }
-        else
+        if (this->GetAbortOutput())
         {
-          Hf = 0.0;
+          break;
         }
-        // add weighted Hf to scalar at v_l and v_r
-        if (Af != 0.0)
+      }
+      vtkIdType nv;
+      const vtkIdType* verts;
+      polyData->GetCellPoints(f, nv, verts, vertices);
+
+      for (vtkIdType v = 0; v < nv; v++)
+      {
+        double& Hf = edgeCurvature[edgeOffsets[f] + v];
+
+        // get neighbour
+        const vtkIdType v_l = verts[v];
+        const vtkIdType v_r = verts[(v + 1) % nv];
+        const vtkIdType v_o = verts[(v + 2) % nv];
+        polyData->GetCellEdgeNeighbors(f, v_l, v_r, neighbours);
+
+        vtkIdType n; // n short for neighbor
+
+        // compute only if there is really ONE neighbour
+        // AND meanCurvature has not been computed yet!
+        // (ensured by n > f)
+        if (neighbours->GetNumberOfIds() == 1 && (n = neighbours->GetId(0)) > f)
         {
-          (Hf /= Af) *= 3.0;
+          // find 3 corners of f: in order!
+          polyData->GetPoint(v_l, ore);
+          polyData->GetPoint(v_r, end);
+          polyData->GetPoint(v_o, oth);
+          // compute normal of f
+          vtkTriangle::ComputeNormal(ore, end, oth, n_f);
+          // compute common edge
+          e[0] = end[0];
+          e[1] = end[1];
+          e[2] = end[2];
+          e[0] -= ore[0];
+          e[1] -= ore[1];
+          e[2] -= ore[2];
+          const double length = vtkMath::Normalize(e);
+          double Af = vtkTriangle::TriangleArea(ore, end, oth);
+          // find 3 corners of n: in order!
+          vtkIdType nv_n;
+          const vtkIdType* verts_n;
+          polyData->GetCellPoints(n, nv_n, verts_n, vertices_n);
+          polyData->GetPoint(verts_n[0], vn0);
+          polyData->GetPoint(verts_n[1], vn1);
+          polyData->GetPoint(verts_n[2], vn2);
+          Af += double(vtkTriangle::TriangleArea(vn0, vn1, vn2));
+          // compute normal of n
+          vtkTriangle::ComputeNormal(vn0, vn1, vn2, n_n);
+          // the cosine is n_f * n_n
+          const double cs = vtkMath::Dot(n_f, n_n);
+          // the sin is (n_f x n_n) * e
+          vtkMath::Cross(n_f, n_n, t);
+          const double sn = vtkMath::Dot(t, e);
+          // signed angle in [-pi,pi]
+          if (sn != 0.0 || cs != 0.0)
+          {
+            const double angle = atan2(sn, cs);
+            Hf = length * angle;
+          }
+          else
+          {
+            Hf = 0.0;
+          }
+          // weighted Hf, added to scalar at v_l and v_r below
+          if (Af != 0.0)
+          {
+            (Hf /= Af) *= 3.0;
+          }
+          edgeComputed[edgeOffsets[f] + v] = true;
         }
-        meanCurvatureData[v_l] += Hf;
-        meanCurvatureData[v_r] += Hf;
+      }
+    }
+  });
+
+  const vtkNew<vtkIdList> vertices;
+  for (vtkIdType f = 0; f < F; ++f)
+  {
+    vtkIdType nv;
+    const vtkIdType* verts;
+    polyData->GetCellPoints(f, nv, verts, vertices);
+    for (vtkIdType v = 0; v < nv; v++)
+    {
+      const vtkIdType edge = edgeOffsets[f] + v;
+      if (edgeComputed[edge])
+      {
+        const vtkIdType v_l = verts[v];
+        const vtkIdType v_r = verts[(v + 1) % nv];
+        meanCurvatureData[v_l] += edgeCurvature[edge];
+        meanCurvatureData[v_r] += edgeCurvature[edge];
         num_neighb[v_l] += 1;
         num_neighb[v_r] += 1;
       }
@@ -273,15 +326,9 @@ void vtkCurvatures::GetGaussCurvature(vtkPolyData* output)
 void vtkCurvatures::ComputeGaussCurvature(
   vtkCellArray* facets, vtkPolyData* output, double* gaussCurvatureData)
 {
-  double v0[3], v1[3], v2[3], e0[3], e1[3], e2[3];
-
-  double A, alpha0, alpha1, alpha2;
-
-  vtkIdType f;
-  const vtkIdType* vert = nullptr;
-
   // other data
   vtkIdType Nv = output->GetNumberOfPoints();
+  const vtkIdType numFacets = facets->GetNumberOfCells();
 
   const std::unique_ptr<double[]> K(new double[Nv]);
   const std::unique_ptr<double[]> dA(new double[Nv]);
@@ -292,51 +339,87 @@ void vtkCurvatures::ComputeGaussCurvature(
     dA[k] = 0.0;
   }
 
-  facets->InitTraversal();
-  while (facets->GetNextCell(f, vert))
-  {
-    if (this->CheckAbort())
+  // The area and the angles of the facets are computed in parallel, and
+  // accumulated afterwards in the order of the facets: area, then the angles
+  // at the three corners.
+  const std::unique_ptr<double[]> facetData(new double[4 * numFacets]);
+  vtkSMPThreadLocalObject<vtkIdList> tlVertices;
+  vtkSMPTools::For(0, numFacets, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* vertices = tlVertices.Local();
+    double v0[3], v1[3], v2[3], e0[3], e1[3], e2[3];
+    vtkIdType npts;
+    const vtkIdType* vert;
+
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    const vtkIdType checkAbortInterval =
+      std::min((end - begin) / 10 + 1, static_cast<vtkIdType>(1000));
+    for (vtkIdType f = begin; f < end; f++)
     {
-      break;
+      if (f % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+      }
+      facets->GetCellAtId(f, npts, vert, vertices);
+      output->GetPoint(vert[0], v0);
+      output->GetPoint(vert[1], v1);
+      output->GetPoint(vert[2], v2);
+      // edges
+      e0[0] = v1[0];
+      e0[1] = v1[1];
+      e0[2] = v1[2];
+      e0[0] -= v0[0];
+      e0[1] -= v0[1];
+      e0[2] -= v0[2];
+
+      e1[0] = v2[0];
+      e1[1] = v2[1];
+      e1[2] = v2[2];
+      e1[0] -= v1[0];
+      e1[1] -= v1[1];
+      e1[2] -= v1[2];
+
+      e2[0] = v0[0];
+      e2[1] = v0[1];
+      e2[2] = v0[2];
+      e2[0] -= v2[0];
+      e2[1] -= v2[1];
+      e2[2] -= v2[2];
+
+      double* data = facetData.get() + 4 * f;
+      // surf. area
+      data[0] = double(vtkTriangle::TriangleArea(v0, v1, v2));
+      // alpha1, alpha2 and alpha0, the angles at the three corners
+      data[1] = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e2, e0);
+      data[2] = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e0, e1);
+      data[3] = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e1, e2);
     }
-    output->GetPoint(vert[0], v0);
-    output->GetPoint(vert[1], v1);
-    output->GetPoint(vert[2], v2);
-    // edges
-    e0[0] = v1[0];
-    e0[1] = v1[1];
-    e0[2] = v1[2];
-    e0[0] -= v0[0];
-    e0[1] -= v0[1];
-    e0[2] -= v0[2];
-
-    e1[0] = v2[0];
-    e1[1] = v2[1];
-    e1[2] = v2[2];
-    e1[0] -= v1[0];
-    e1[1] -= v1[1];
-    e1[2] -= v1[2];
-
-    e2[0] = v0[0];
-    e2[1] = v0[1];
-    e2[2] = v0[2];
-    e2[0] -= v2[0];
-    e2[1] -= v2[1];
-    e2[2] -= v2[2];
-
-    alpha0 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e1, e2);
-    alpha1 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e2, e0);
-    alpha2 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e0, e1);
-
-    // surf. area
-    A = double(vtkTriangle::TriangleArea(v0, v1, v2));
+  });
+  if (this->GetAbortOutput())
+  {
+    return;
+  }
+
+  const vtkNew<vtkIdList> vertices;
+  for (vtkIdType f = 0; f < numFacets; f++)
+  {
+    vtkIdType npts;
+    const vtkIdType* vert;
+    facets->GetCellAtId(f, npts, vert, vertices);
+    const double* data = facetData.get() + 4 * f;
     // UPDATE
-    dA[vert[0]] += A;
-    dA[vert[1]] += A;
-    dA[vert[2]] += A;
-    K[vert[0]] -= alpha1;
-    K[vert[1]] -= alpha2;
-    K[vert[2]] -= alpha0;
+    dA[vert[0]] += data[0];
+    dA[vert[1]] += data[0];
+    dA[vert[2]] += data[0];
+    K[vert[0]] -= data[1];
+    K[vert[1]] -= data[2];
+    K[vert[2]] -= data[3];
   }
 
   // put curvature in vtkArray
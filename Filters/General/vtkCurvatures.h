@@ -53,6 +53,10 @@
  *  can be set and the Curvature reported by the Mean calculation will
  * be inverted.
  *
+ * The Gauss and mean curvatures are computed in parallel with vtkSMPTools,
+ * using the cell links of the mesh (see vtkPolyData::BuildLinks()) to find
+ * the neighbors of the edges.
+ *
  * For a little more information see
  * <a href="https://public.kitware.com/pipermail/vtkusers/2002-July/012198.html"
  * >Computing curvature of a surface</a>
@@ -14,10 +14,14 @@
 =========================================================================*/
 #include "vtkDataSetTriangleFilter.h"
 
+#include "vtkArrayListTemplate.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellType.h"
+#include "vtkCellTypes.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -25,14 +29,324 @@
 #include "vtkOrderedTriangulator.h"
 #include "vtkPointData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
 #include "vtkStructuredPoints.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDataSetTriangleFilter);
 
+namespace
+{
+// Cells are split into simplices in parallel by batches of consecutive cells.
+// Each batch keeps its simplices so that they are written in input order.
+const vtkIdType CellBatchSize = 1000;
+
+struct SimplexBatch
+{
+  std::vector<unsigned char> Types;
+  std::vector<vtkIdType> Connectivity;
+  std::vector<vtkIdType> SourceCells; // input cell of each simplex
+
+  // Add the simplices of dim points listed in ptIds, generated by cellId.
+  void AddSimplices(int dim, vtkIdList* ptIds, vtkIdType cellId)
+  {
+    unsigned char type = VTK_EMPTY_CELL;
+    switch (dim)
+    {
+      case 1:
+        type = VTK_VERTEX;
+        break;
+      case 2:
+        type = VTK_LINE;
+        break;
+      case 3:
+        type = VTK_TRIANGLE;
+        break;
+      case 4:
+        type = VTK_TETRA;
+        break;
+    }
+    const vtkIdType numSimplices = ptIds->GetNumberOfIds() / dim;
+    const vtkIdType* ids = ptIds->GetPointer(0);
+    this->Connectivity.insert(this->Connectivity.end(), ids, ids + numSimplices * dim);
+    this->Types.insert(this->Types.end(), static_cast<std::size_t>(numSimplices), type);
+    this->SourceCells.insert(
+      this->SourceCells.end(), static_cast<std::size_t>(numSimplices), cellId);
+  }
+};
+
+// Shared state of the functors generating the simplices of a range of cells.
+struct SimplexGenerator
+{
+  vtkDataSet* Input;
+  vtkIdType NumberOfCells;
+  bool TetrahedraOnly;
+  std::vector<SimplexBatch>& Batches;
+  vtkDataSetTriangleFilter* Filter;
+
+  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkSMPThreadLocalObject<vtkIdList> CellPointIds;
+  vtkSMPThreadLocalObject<vtkPoints> CellPoints;
+
+  SimplexGenerator(vtkDataSet* input, vtkIdType numCells, bool tetrahedraOnly,
+    std::vector<SimplexBatch>& batches, vtkDataSetTriangleFilter* filter)
+    : Input(input)
+    , NumberOfCells(numCells)
+    , TetrahedraOnly(tetrahedraOnly)
+    , Batches(batches)
+    , Filter(filter)
+  {
+  }
+
+  // Returns true when the remaining batches have to be skipped.
+  bool CheckAbort(bool isFirst)
+  {
+    if (isFirst)
+    {
+      this->Filter->CheckAbort();
+    }
+    return this->Filter->GetAbortOutput() != 0;
+  }
+
+  vtkIdType BatchEnd(vtkIdType batchId) const
+  {
+    return std::min((batchId + 1) * CellBatchSize, this->NumberOfCells);
+  }
+};
+
+// Structured cells are split with alternating parity so that the faces
+// of neighboring cells match.
+struct StructuredSimplices : public SimplexGenerator
+{
+  int Dimensions[3]; // number of cells along each axis
+
+  StructuredSimplices(vtkDataSet* input, const int dimensions[3], bool tetrahedraOnly,
+    std::vector<SimplexBatch>& batches, vtkDataSetTriangleFilter* filter)
+    : SimplexGenerator(input,
+        static_cast<vtkIdType>(dimensions[0]) * dimensions[1] *
+          (dimensions[2] > 0 ? dimensions[2] : 1),
+        tetrahedraOnly, batches, filter)
+  {
+    std::copy(dimensions, dimensions + 3, this->Dimensions);
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType beginBatch, vtkIdType endBatch)
+  {
+    vtkGenericCell* cell = this->Cell.Local();
+    vtkIdList* cellPtIds = this->CellPointIds.Local();
+    vtkPoints* cellPts = this->CellPoints.Local();
+    const vtkIdType sliceSize = static_cast<vtkIdType>(this->Dimensions[0]) * this->Dimensions[1];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+
+    for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+    {
+      if (this->CheckAbort(isFirst))
+      {
+        break;
+      }
+
+      SimplexBatch& batch = this->Batches[batchId];
+      const vtkIdType endId = this->BatchEnd(batchId);
+      for (vtkIdType inId = batchId * CellBatchSize; inId < endId; ++inId)
+      {
+        const vtkIdType i = inId % this->Dimensions[0];
+        const vtkIdType j = (inId % sliceSize) / this->Dimensions[0];
+        const vtkIdType k = inId / sliceSize;
+        this->Input->GetCell(inId, cell);
+        cell->Triangulate((i + j + k) % 2, cellPtIds, cellPts);
+
+        const int dim = cell->GetCellDimension() + 1;
+        if (!this->TetrahedraOnly || dim == 4)
+        {
+          batch.AddSimplices(dim, cellPtIds, inId);
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+// 3D cells use the ordered triangulator. The ordered triangulator is used
+// to create templates on the fly. Once the templates are created then they
+// are used to produce the final triangulation.
+struct UnstructuredSimplices : public SimplexGenerator
+{
+  vtkSMPThreadLocalObject<vtkOrderedTriangulator> Triangulator;
+  vtkSMPThreadLocalObject<vtkCellArray> Tetras;
+
+  UnstructuredSimplices(vtkDataSet* input, bool tetrahedraOnly,
+    std::vector<SimplexBatch>& batches, vtkDataSetTriangleFilter* filter)
+    : SimplexGenerator(input, input->GetNumberOfCells(), tetrahedraOnly, batches, filter)
+  {
+  }
+
+  void Initialize()
+  {
+    vtkOrderedTriangulator* triangulator = this->Triangulator.Local();
+    triangulator->PreSortedOff();
+    triangulator->UseTemplatesOn();
+  }
+
+  void operator()(vtkIdType beginBatch, vtkIdType endBatch)
+  {
+    vtkGenericCell* cell = this->Cell.Local();
+    vtkIdList* cellPtIds = this->CellPointIds.Local();
+    vtkPoints* cellPts = this->CellPoints.Local();
+    vtkOrderedTriangulator* triangulator = this->Triangulator.Local();
+    vtkCellArray* tetras = this->Tetras.Local();
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    double x[3];
+
+    for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+    {
+      if (this->CheckAbort(isFirst))
+      {
+        break;
+      }
+
+      SimplexBatch& batch = this->Batches[batchId];
+      const vtkIdType endId = this->BatchEnd(batchId);
+      for (vtkIdType cellId = batchId * CellBatchSize; cellId < endId; ++cellId)
+      {
+        this->Input->GetCell(cellId, cell);
+        int dim = cell->GetCellDimension();
+
+        if (cell->GetCellType() == VTK_POLYHEDRON) // polyhedron
+        {
+          cell->Triangulate(0, cellPtIds, cellPts);
+          batch.AddSimplices(4, cellPtIds, cellId);
+        }
+
+        else if (dim == 3) // use ordered triangulation
+        {
+          const int numPts = cell->GetNumberOfPoints();
+          double *p, *pPtr = cell->GetParametricCoords();
+          triangulator->InitTriangulation(0.0, 1.0, 0.0, 1.0, 0.0, 1.0, numPts);
+          const int type = cell->GetCellType();
+          int j;
+          for (p = pPtr, j = 0; j < numPts; j++, p += 3)
+          {
+            // the wedge is "flipped" compared to other cells in that
+            // the normal of the first face points out instead of in
+            // so we flip the way we pass the points to the triangulator
+            const vtkIdType wedgemap[18] = { 3, 4, 5, 0, 1, 2, 9, 10, 11, 6, 7, 8, 12, 13, 14, 15,
+              16, 17 };
+            vtkIdType ptId;
+            if (type == VTK_WEDGE || type == VTK_QUADRATIC_WEDGE ||
+              type == VTK_QUADRATIC_LINEAR_WEDGE || type == VTK_BIQUADRATIC_QUADRATIC_WEDGE)
+            {
+              ptId = cell->PointIds->GetId(wedgemap[j]);
+              cell->Points->GetPoint(wedgemap[j], x);
+            }
+            else
+            {
+              ptId = cell->PointIds->GetId(j);
+              cell->Points->GetPoint(j, x);
+            }
+            triangulator->InsertPoint(ptId, x, p, 0);
+          }                          // for all cell points
+          if (cell->IsPrimaryCell()) // use templates if topology is fixed
+          {
+            int numEdges = cell->GetNumberOfEdges();
+            triangulator->TemplateTriangulate(type, numPts, numEdges);
+          }
+          else // use ordered triangulator
+          {
+            triangulator->Triangulate();
+          }
+
+          tetras->Reset();
+          const vtkIdType numTets = triangulator->AddTetras(0, tetras);
+          for (vtkIdType tetId = 0; tetId < numTets; ++tetId)
+          {
+            vtkIdType npts;
+            const vtkIdType* pts;
+            tetras->GetCellAtId(tetId, npts, pts, cellPtIds);
+            batch.Connectivity.insert(batch.Connectivity.end(), pts, pts + npts);
+            batch.Types.push_back(VTK_TETRA);
+            batch.SourceCells.push_back(cellId);
+          }
+        }
+
+        else if (!this->TetrahedraOnly) // 2D or lower dimension
+        {
+          cell->Triangulate(0, cellPtIds, cellPts);
+          batch.AddSimplices(dim + 1, cellPtIds, cellId);
+        } // if 2D or less cell
+      }   // for all cells
+    }
+  }
+
+  void Reduce() {}
+};
+
+// Gather the simplices of all the batches in input order into output, and
+// copy their cell data from inCD.
+void BuildSimplices(const std::vector<SimplexBatch>& batches, vtkCellData* inCD,
+  vtkUnstructuredGrid* output)
+{
+  const vtkIdType numBatches = static_cast<vtkIdType>(batches.size());
+  std::vector<vtkIdType> cellOffsets(numBatches + 1, 0);
+  std::vector<vtkIdType> connOffsets(numBatches + 1, 0);
+  for (vtkIdType batchId = 0; batchId < numBatches; ++batchId)
+  {
+    cellOffsets[batchId + 1] =
+      cellOffsets[batchId] + static_cast<vtkIdType>(batches[batchId].Types.size());
+    connOffsets[batchId + 1] =
+      connOffsets[batchId] + static_cast<vtkIdType>(batches[batchId].Connectivity.size());
+  }
+  const vtkIdType numNewCells = cellOffsets[numBatches];
+
+  vtkNew<vtkUnsignedCharArray> types;
+  types->SetNumberOfValues(numNewCells);
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numNewCells + 1);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(connOffsets[numBatches]);
+  unsigned char* typesPtr = types->GetPointer(0);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* connPtr = connectivity->GetPointer(0);
+
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(inCD, numNewCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numNewCells, inCD, outCD, 0.0, false);
+
+  vtkSMPTools::For(0, numBatches, [&](vtkIdType beginBatch, vtkIdType endBatch) {
+    for (vtkIdType batchId = beginBatch; batchId < endBatch; ++batchId)
+    {
+      const SimplexBatch& batch = batches[batchId];
+      const vtkIdType firstId = cellOffsets[batchId];
+      vtkIdType offset = connOffsets[batchId];
+      std::copy(batch.Types.begin(), batch.Types.end(), typesPtr + firstId);
+      std::copy(batch.Connectivity.begin(), batch.Connectivity.end(), connPtr + offset);
+      const vtkIdType batchCells = static_cast<vtkIdType>(batch.Types.size());
+      for (vtkIdType cellId = 0; cellId < batchCells; ++cellId)
+      {
+        offsetsPtr[firstId + cellId] = offset;
+        offset += vtkCellTypes::GetDimension(batch.Types[cellId]) + 1;
+        cellArrays.Copy(batch.SourceCells[cellId], firstId + cellId);
+      }
+    }
+  });
+  offsetsPtr[numNewCells] = connOffsets[numBatches];
+
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(offsets, connectivity);
+  output->SetCells(types, cells);
+}
+} // anonymous namespace
+
 vtkDataSetTriangleFilter::vtkDataSetTriangleFilter()
 {
   this->Triangulator = vtkOrderedTriangulator::New();
@@ -76,27 +390,21 @@ int vtkDataSetTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
 void vtkDataSetTriangleFilter::StructuredExecute(vtkDataSet* input, vtkUnstructuredGrid* output)
 {
-  int dimensions[3], i, j, k, l, m;
-  vtkIdType newCellId, inId;
-  vtkCellData* inCD = input->GetCellData();
-  vtkCellData* outCD = output->GetCellData();
-  vtkPoints* cellPts = vtkPoints::New();
-  vtkPoints* newPoints = vtkPoints::New();
-  vtkIdList* cellPtIds = vtkIdList::New();
-  int numSimplices, numPts, dim, type;
-  vtkIdType pts[4], num;
+  int dimensions[3];
+  vtkNew<vtkPoints> newPoints;
 
   // Create an array of points. This does an explicit creation
   // of each point.
-  num = input->GetNumberOfPoints();
+  vtkIdType num = input->GetNumberOfPoints();
   newPoints->SetNumberOfPoints(num);
-  for (i = 0; i < num; ++i)
-  {
-    newPoints->SetPoint(i, input->GetPoint(i));
-  }
-
-  outCD->CopyAllocate(inCD, input->GetNumberOfCells() * 5);
-  output->Allocate(input->GetNumberOfCells() * 5);
+  vtkSMPTools::For(0, num, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      input->GetPoint(i, x);
+      newPoints->SetPoint(i, x);
+    }
+  });
 
   if (input->IsA("vtkStructuredPoints"))
   {
@@ -129,96 +437,32 @@ void vtkDataSetTriangleFilter::StructuredExecute(vtkDataSet* input, vtkUnstructu
   dimensions[1] = dimensions[1] - 1;
   dimensions[2] = dimensions[2] - 1;
 
-  vtkIdType numSlices = (dimensions[2] > 0 ? dimensions[2] : 1);
-  bool abort = false;
-  for (k = 0; k < numSlices && !abort; k++)
+  std::vector<SimplexBatch> batches;
+  StructuredSimplices generator(input, dimensions, this->TetrahedraOnly != 0, batches, this);
+  if (generator.NumberOfCells > 0)
   {
-    this->UpdateProgress(static_cast<double>(k) / numSlices);
-    abort = this->CheckAbort();
-
-    for (j = 0; j < dimensions[1]; j++)
-    {
-      for (i = 0; i < dimensions[0]; i++)
-      {
-        inId = i + (j + (k * dimensions[1])) * dimensions[0];
-        vtkCell* cell = input->GetCell(i, j, k);
-        if ((i + j + k) % 2 == 0)
-        {
-          cell->Triangulate(0, cellPtIds, cellPts);
-        }
-        else
-        {
-          cell->Triangulate(1, cellPtIds, cellPts);
-        }
+    // Make sure GetCell() is thread safe
+    vtkNew<vtkGenericCell> cell;
+    input->GetCell(0, cell);
 
-        dim = cell->GetCellDimension() + 1;
-
-        numPts = cellPtIds->GetNumberOfIds();
-        numSimplices = numPts / dim;
-        type = 0;
-        switch (dim)
-        {
-          case 1:
-            type = VTK_VERTEX;
-            break;
-          case 2:
-            type = VTK_LINE;
-            break;
-          case 3:
-            type = VTK_TRIANGLE;
-            break;
-          case 4:
-            type = VTK_TETRA;
-            break;
-        }
-        if (!this->TetrahedraOnly || type == VTK_TETRA)
-        {
-          for (l = 0; l < numSimplices; l++)
-          {
-            for (m = 0; m < dim; m++)
-            {
-              pts[m] = cellPtIds->GetId(dim * l + m);
-            }
-            // copy cell data
-            newCellId = output->InsertNextCell(type, dim, pts);
-            outCD->CopyData(inCD, inId, newCellId);
-          } // for all simplices
-        }
-      } // i dimension
-    }   // j dimension
-  }     // k dimension
+    batches.resize((generator.NumberOfCells - 1) / CellBatchSize + 1);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(batches.size()), generator);
+  }
+  BuildSimplices(batches, input->GetCellData(), output);
+  this->UpdateProgress(1.0);
 
   // Update output
   output->SetPoints(newPoints);
   output->GetPointData()->PassData(input->GetPointData());
-  output->Squeeze();
-
-  newPoints->Delete();
-  cellPts->Delete();
-  cellPtIds->Delete();
 }
 
-// 3D cells use the ordered triangulator. The ordered triangulator is used
-// to create templates on the fly. Once the templates are created then they
-// are used to produce the final triangulation.
-//
 void vtkDataSetTriangleFilter::UnstructuredExecute(
   vtkDataSet* dataSetInput, vtkUnstructuredGrid* output)
 {
   vtkPointSet* input = static_cast<vtkPointSet*>(dataSetInput); // has to be
   vtkIdType numCells = input->GetNumberOfCells();
-  vtkGenericCell* cell;
-  vtkIdType newCellId, j;
-  int k;
   vtkCellData* inCD = input->GetCellData();
   vtkCellData* outCD = output->GetCellData();
-  vtkPoints* cellPts;
-  vtkIdList* cellPtIds;
-  vtkIdType ptId, numTets, ncells;
-  int numPts, type;
-  int numSimplices, dim;
-  vtkIdType pts[4];
-  double x[3];
 
   if (numCells == 0)
   {
@@ -262,143 +506,25 @@ void vtkDataSetTriangleFilter::UnstructuredExecute(
     }
   }
 
-  cell = vtkGenericCell::New();
-  cellPts = vtkPoints::New();
-  cellPtIds = vtkIdList::New();
-
-  // Create an array of points
   vtkCellData* tempCD = vtkCellData::New();
   tempCD->ShallowCopy(inCD);
   tempCD->SetActiveGlobalIds(nullptr);
 
-  outCD->CopyAllocate(tempCD, input->GetNumberOfCells() * 5);
-  output->Allocate(input->GetNumberOfCells() * 5);
-
   // Points are passed through
   output->SetPoints(input->GetPoints());
   output->GetPointData()->PassData(input->GetPointData());
 
-  int abort = 0;
-  vtkIdType updateTime = numCells / 20 + 1; // update roughly every 5%
-  for (vtkIdType cellId = 0; cellId < numCells && !abort; cellId++)
-  {
-    if (!(cellId % updateTime))
-    {
-      this->UpdateProgress(static_cast<double>(cellId) / numCells);
-      abort = this->CheckAbort();
-    }
-
-    input->GetCell(cellId, cell);
-    dim = cell->GetCellDimension();
-
-    if (cell->GetCellType() == VTK_POLYHEDRON) // polyhedron
-    {
-      dim = 4;
-      cell->Triangulate(0, cellPtIds, cellPts);
-      numPts = cellPtIds->GetNumberOfIds();
-
-      numSimplices = numPts / dim;
-      type = VTK_TETRA;
-
-      for (j = 0; j < numSimplices; j++)
-      {
-        for (k = 0; k < dim; k++)
-        {
-          pts[k] = cellPtIds->GetId(dim * j + k);
-        }
-        // copy cell data
-        newCellId = output->InsertNextCell(type, dim, pts);
-        outCD->CopyData(tempCD, cellId, newCellId);
-      }
-    }
-
-    else if (dim == 3) // use ordered triangulation
-    {
-      numPts = cell->GetNumberOfPoints();
-      double *p, *pPtr = cell->GetParametricCoords();
-      this->Triangulator->InitTriangulation(0.0, 1.0, 0.0, 1.0, 0.0, 1.0, numPts);
-      for (p = pPtr, j = 0; j < numPts; j++, p += 3)
-      {
-        // the wedge is "flipped" compared to other cells in that
-        // the normal of the first face points out instead of in
-        // so we flip the way we pass the points to the triangulator
-        const vtkIdType wedgemap[18] = { 3, 4, 5, 0, 1, 2, 9, 10, 11, 6, 7, 8, 12, 13, 14, 15, 16,
-          17 };
-        type = cell->GetCellType();
-        if (type == VTK_WEDGE || type == VTK_QUADRATIC_WEDGE ||
-          type == VTK_QUADRATIC_LINEAR_WEDGE || type == VTK_BIQUADRATIC_QUADRATIC_WEDGE)
-        {
-          ptId = cell->PointIds->GetId(wedgemap[j]);
-          cell->Points->GetPoint(wedgemap[j], x);
-        }
-        else
-        {
-          ptId = cell->PointIds->GetId(j);
-          cell->Points->GetPoint(j, x);
-        }
-        this->Triangulator->InsertPoint(ptId, x, p, 0);
-      }                          // for all cell points
-      if (cell->IsPrimaryCell()) // use templates if topology is fixed
-      {
-        int numEdges = cell->GetNumberOfEdges();
-        this->Triangulator->TemplateTriangulate(cell->GetCellType(), numPts, numEdges);
-      }
-      else // use ordered triangulator
-      {
-        this->Triangulator->Triangulate();
-      }
-
-      ncells = output->GetNumberOfCells();
-      numTets = this->Triangulator->AddTetras(0, output);
+  // Make sure GetCell() is thread safe
+  vtkNew<vtkGenericCell> cell;
+  input->GetCell(0, cell);
 
-      for (j = 0; j < numTets; j++)
-      {
-        outCD->CopyData(tempCD, cellId, ncells + j);
-      }
-    }
-
-    else if (!this->TetrahedraOnly) // 2D or lower dimension
-    {
-      dim++;
-      cell->Triangulate(0, cellPtIds, cellPts);
-      numPts = cellPtIds->GetNumberOfIds();
-
-      numSimplices = numPts / dim;
-      type = 0;
-      switch (dim)
-      {
-        case 1:
-          type = VTK_VERTEX;
-          break;
-        case 2:
-          type = VTK_LINE;
-          break;
-        case 3:
-          type = VTK_TRIANGLE;
-          break;
-      }
-
-      for (j = 0; j < numSimplices; j++)
-      {
-        for (k = 0; k < dim; k++)
-        {
-          pts[k] = cellPtIds->GetId(dim * j + k);
-        }
-        // copy cell data
-        newCellId = output->InsertNextCell(type, dim, pts);
-        outCD->CopyData(tempCD, cellId, newCellId);
-      }
-    } // if 2D or less cell
-  }   // for all cells
-
-  // Update output
-  output->Squeeze();
+  std::vector<SimplexBatch> batches((numCells - 1) / CellBatchSize + 1);
+  UnstructuredSimplices generator(input, this->TetrahedraOnly != 0, batches, this);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(batches.size()), generator);
+  BuildSimplices(batches, tempCD, output);
+  this->UpdateProgress(1.0);
 
   tempCD->Delete();
-
-  cellPts->Delete();
-  cellPtIds->Delete();
-  cell->Delete();
 }
 
 int vtkDataSetTriangleFilter::FillInputPortInformation(int, vtkInformation* info)
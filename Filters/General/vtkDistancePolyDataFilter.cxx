@@ -16,11 +16,14 @@
 
 #include "vtkCellData.h"
 #include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
 #include "vtkImplicitPolyDataDistance.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangle.h"
 
@@ -100,14 +103,17 @@ void vtkDistancePolyDataFilter::GetPolyDataDistance(vtkPolyData* mesh, vtkPolyDa
   pointArray->SetNumberOfComponents(1);
   pointArray->SetNumberOfTuples(numPts);
 
-  for (vtkIdType ptId = 0; ptId < numPts; ptId++)
-  {
-    double pt[3];
-    mesh->GetPoint(ptId, pt);
-    double val = imp->EvaluateFunction(pt);
-    double dist = SignedDistance ? (NegateDistance ? -val : val) : fabs(val);
-    pointArray->SetValue(ptId, dist);
-  }
+  // vtkImplicitPolyDataDistance can be evaluated concurrently.
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ptId++)
+    {
+      double pt[3];
+      mesh->GetPoint(ptId, pt);
+      double val = imp->EvaluateFunction(pt);
+      double dist = SignedDistance ? (NegateDistance ? -val : val) : fabs(val);
+      pointArray->SetValue(ptId, dist);
+    }
+  });
 
   mesh->GetPointData()->AddArray(pointArray);
   pointArray->Delete();
@@ -123,19 +129,24 @@ void vtkDistancePolyDataFilter::GetPolyDataDistance(vtkPolyData* mesh, vtkPolyDa
     cellArray->SetNumberOfComponents(1);
     cellArray->SetNumberOfTuples(numCells);
 
-    for (vtkIdType cellId = 0; cellId < numCells; cellId++)
-    {
-      vtkCell* cell = mesh->GetCell(cellId);
-      int subId;
-      double pcoords[3], x[3], weights[VTK_MAXIMUM_NUMBER_OF_POINTS];
-
-      cell->GetParametricCenter(pcoords);
-      cell->EvaluateLocation(subId, pcoords, x, weights);
-
-      double val = imp->EvaluateFunction(x);
-      double dist = SignedDistance ? (NegateDistance ? -val : val) : fabs(val);
-      cellArray->SetValue(cellId, dist);
-    }
+    // The cells of the mesh are built, so GetCell() is thread safe.
+    vtkSMPThreadLocalObject<vtkGenericCell> localCell;
+    vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      vtkGenericCell* cell = localCell.Local();
+      for (; cellId < endCellId; cellId++)
+      {
+        mesh->GetCell(cellId, cell);
+        int subId;
+        double pcoords[3], x[3], weights[VTK_MAXIMUM_NUMBER_OF_POINTS];
+
+        cell->GetParametricCenter(pcoords);
+        cell->EvaluateLocation(subId, pcoords, x, weights);
+
+        double val = imp->EvaluateFunction(x);
+        double dist = SignedDistance ? (NegateDistance ? -val : val) : fabs(val);
+        cellArray->SetValue(cellId, dist);
+      }
+    });
 
     mesh->GetCellData()->AddArray(cellArray);
     cellArray->Delete();
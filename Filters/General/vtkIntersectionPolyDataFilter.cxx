@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkIntersectionPolyDataFilter.h"
 
+#include "vtkBVHCellLocator.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCleanPolyData.h"
@@ -24,7 +25,7 @@
 #include "vtkInformationVector.h"
 #include "vtkLine.h"
 #include "vtkLongArray.h"
-#include "vtkOBBTree.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
 #include "vtkPointData.h"
@@ -32,6 +33,9 @@
 #include "vtkPoints.h"
 #include "vtkPolyDataNormals.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkTransform.h"
@@ -40,8 +44,12 @@
 #include "vtkTriangleFilter.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
+#include <set>
+#include <utility>
+#include <vector>
 
 //------------------------------------------------------------------------------
 // Helper typedefs and data structures.
@@ -61,6 +69,21 @@ struct simPolygon
   int orientation;
 };
 
+// The intersection line of a triangle of each input
+struct TriangleIntersection
+{
+  vtkIdType CellId0;
+  vtkIdType CellId1;
+  double Points[2][3];
+  double SurfaceId[2];
+
+  bool operator<(const TriangleIntersection& other) const
+  {
+    return this->CellId0 < other.CellId0 ||
+      (this->CellId0 == other.CellId0 && this->CellId1 < other.CellId1);
+  }
+};
+
 }
 
 typedef std::multimap<vtkIdType, vtkIdType> IntersectionMapType;
@@ -85,14 +108,18 @@ public:
   Impl();
   virtual ~Impl();
 
-  // Finds all triangle triangle intersections between two input OOBTrees
-  static int FindTriangleIntersections(
-    vtkOBBNode* node0, vtkOBBNode* node1, vtkMatrix4x4* transform, void* arg);
+  // Finds all triangle triangle intersections between the two input meshes,
+  // in parallel, and adds them to the intersection lines and maps
+  void FindTriangleIntersections();
 
   // Runs the split mesh for the designated input surface
   int SplitMesh(int inputIndex, vtkPolyData* output, vtkPolyData* intersectionLines);
 
 protected:
+  // Adds the intersection line of two triangles to the intersection lines
+  // and maps
+  void AddTriangleIntersection(const TriangleIntersection& inter);
+
   // Split cells into polygons created by intersection lines
   vtkCellArray* SplitCell(vtkPolyData* input, vtkIdType cellId, const vtkIdType* cellPts,
     IntersectionMapType* map, vtkPolyData* interLines, int inputIndex, int numCurrCells);
@@ -136,10 +163,11 @@ protected:
 
 public:
   vtkPolyData* Mesh[2];
-  vtkOBBTree* OBBTree1;
 
-  // Stores the intersection lines.
+  // Stores the intersection lines, and their end points to avoid
+  // duplicate lines.
   vtkCellArray* IntersectionLines;
+  std::set<std::pair<vtkIdType, vtkIdType>> LineSet;
 
   vtkIdTypeArray* SurfaceId;
   vtkIdTypeArray* NewCellIds[2];
@@ -187,8 +215,7 @@ protected:
 
 //------------------------------------------------------------------------------
 vtkIntersectionPolyDataFilter::Impl::Impl()
-  : OBBTree1(nullptr)
-  , IntersectionLines(nullptr)
+  : IntersectionLines(nullptr)
   , SurfaceId(nullptr)
   , PointMerger(nullptr)
 {
@@ -221,246 +248,266 @@ vtkIntersectionPolyDataFilter::Impl::~Impl()
 }
 
 //------------------------------------------------------------------------------
-int vtkIntersectionPolyDataFilter::Impl ::FindTriangleIntersections(
-  vtkOBBNode* node0, vtkOBBNode* node1, vtkMatrix4x4* transform, void* arg)
+void vtkIntersectionPolyDataFilter::Impl::FindTriangleIntersections()
 {
-  vtkIntersectionPolyDataFilter::Impl* info =
-    reinterpret_cast<vtkIntersectionPolyDataFilter::Impl*>(arg);
-
-  // Set up local structures to hold Impl array information
-  vtkPolyData* mesh0 = info->Mesh[0];
-  vtkPolyData* mesh1 = info->Mesh[1];
-  vtkOBBTree* obbTree1 = info->OBBTree1;
-  vtkCellArray* intersectionLines = info->IntersectionLines;
-  vtkIdTypeArray* intersectionSurfaceId = info->SurfaceId;
-  vtkIdTypeArray* intersectionCellIds0 = info->CellIds[0];
-  vtkIdTypeArray* intersectionCellIds1 = info->CellIds[1];
-  vtkPointLocator* pointMerger = info->PointMerger;
-  double tolerance = info->Tolerance;
-
-  // The number of cells in OBBTree
-  int numCells0 = node0->Cells->GetNumberOfIds();
-
-  for (vtkIdType id0 = 0; id0 < numCells0; id0++)
-  {
-    vtkIdType cellId0 = node0->Cells->GetId(id0);
-    int type0 = mesh0->GetCellType(cellId0);
-
-    // Make sure the cell is a triangle
-    if (type0 == VTK_TRIANGLE)
+  vtkPolyData* mesh0 = this->Mesh[0];
+  vtkPolyData* mesh1 = this->Mesh[1];
+  const double tolerance = this->Tolerance;
+
+  // Build the cells before the parallel section
+  mesh0->BuildCells();
+  mesh1->BuildCells();
+
+  // The candidate triangles of the second mesh are those whose bounds
+  // overlap the bounds of a triangle of the first mesh.
+  vtkNew<vtkBVHCellLocator> locator;
+  locator->SetDataSet(mesh1);
+  locator->BuildLocator();
+
+  // Each thread tests its own range of triangles of the first mesh
+  vtkSMPThreadLocal<std::vector<TriangleIntersection>> localIntersections;
+  vtkSMPThreadLocalObject<vtkIdList> localCandidates;
+  vtkSMPThreadLocalObject<vtkIdList> localPtIds;
+  vtkSMPTools::For(0, mesh0->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+    std::vector<TriangleIntersection>& intersections = localIntersections.Local();
+    vtkIdList* candidates = localCandidates.Local();
+    vtkIdList* ptIds = localPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* triPtIds;
+    double triPts0[3][3], triPts1[3][3], bounds[6];
+    for (vtkIdType cellId0 = begin; cellId0 < end; cellId0++)
     {
-      vtkIdType npts0;
-      const vtkIdType* triPtIds0;
-      mesh0->GetCellPoints(cellId0, npts0, triPtIds0);
-      double triPts0[3][3];
-      for (vtkIdType id = 0; id < npts0; id++)
+      if (mesh0->GetCellType(cellId0) != VTK_TRIANGLE)
       {
-        mesh0->GetPoint(triPtIds0[id], triPts0[id]);
+        continue;
       }
+      mesh0->GetCellPoints(cellId0, npts, triPtIds, ptIds);
+      for (int i = 0; i < 3; i++)
+      {
+        mesh0->GetPoint(triPtIds[i], triPts0[i]);
+      }
+      for (int j = 0; j < 3; j++)
+      {
+        bounds[2 * j] = std::min({ triPts0[0][j], triPts0[1][j], triPts0[2][j] }) - tolerance;
+        bounds[2 * j + 1] = std::max({ triPts0[0][j], triPts0[1][j], triPts0[2][j] }) + tolerance;
+      }
+      locator->FindCellsWithinBounds(bounds, candidates);
 
-      if (obbTree1->TriangleIntersectsNode(node1, triPts0[0], triPts0[1], triPts0[2], transform))
+      for (vtkIdType c = 0; c < candidates->GetNumberOfIds(); c++)
       {
-        int numCells1 = node1->Cells->GetNumberOfIds();
-        for (vtkIdType id1 = 0; id1 < numCells1; id1++)
+        const vtkIdType cellId1 = candidates->GetId(c);
+        if (mesh1->GetCellType(cellId1) != VTK_TRIANGLE)
         {
-          vtkIdType cellId1 = node1->Cells->GetId(id1);
-          int type1 = mesh1->GetCellType(cellId1);
-          if (type1 == VTK_TRIANGLE)
-          {
-            // See if the two cells actually intersect. If they do,
-            // add an entry into the intersection maps and add an
-            // intersection line.
-            vtkIdType npts1;
-            const vtkIdType* triPtIds1;
-            mesh1->GetCellPoints(cellId1, npts1, triPtIds1);
-
-            double triPts1[3][3];
-            for (vtkIdType id = 0; id < npts1; id++)
-            {
-              mesh1->GetPoint(triPtIds1[id], triPts1[id]);
-            }
+          continue;
+        }
+        mesh1->GetCellPoints(cellId1, npts, triPtIds, ptIds);
+        for (int i = 0; i < 3; i++)
+        {
+          mesh1->GetPoint(triPtIds[i], triPts1[i]);
+        }
 
-            int coplanar = 0;
-            double outpt0[3], outpt1[3];
-            double surfaceid[2];
-            int intersects = vtkIntersectionPolyDataFilter::TriangleTriangleIntersection(triPts0[0],
-              triPts0[1], triPts0[2], triPts1[0], triPts1[1], triPts1[2], coplanar, outpt0, outpt1,
-              surfaceid, tolerance);
+        // Coplanar triangle intersection is not handled. TODO
+        TriangleIntersection inter;
+        int coplanar = 0;
+        int intersects = vtkIntersectionPolyDataFilter::TriangleTriangleIntersection(triPts0[0],
+          triPts0[1], triPts0[2], triPts1[0], triPts1[1], triPts1[2], coplanar, inter.Points[0],
+          inter.Points[1], inter.SurfaceId, tolerance);
+        if (intersects && !coplanar)
+        {
+          inter.CellId0 = cellId0;
+          inter.CellId1 = cellId1;
+          intersections.push_back(inter);
+        }
+      }
+    }
+  });
 
-            if (coplanar)
-            {
-              // Coplanar triangle intersection is not handled.
-              // This intersection will not be included in the output. TODO
-              // vtkDebugMacro(<<"Coplanar");
-              intersects = 0;
-              continue;
-            }
+  // The intersections are added in a deterministic order, since the point
+  // merging and the line ids depend on it.
+  std::vector<TriangleIntersection> intersections;
+  for (auto& local : localIntersections)
+  {
+    intersections.insert(intersections.end(), local.begin(), local.end());
+  }
+  vtkSMPTools::Sort(intersections.begin(), intersections.end());
+  for (const TriangleIntersection& inter : intersections)
+  {
+    this->AddTriangleIntersection(inter);
+  }
+}
 
-            // If actual intersection, add point and cell to edge, line,
-            // and surface maps!
-            if (intersects)
-            {
-              vtkIdType lineId = intersectionLines->GetNumberOfCells();
+//------------------------------------------------------------------------------
+void vtkIntersectionPolyDataFilter::Impl::AddTriangleIntersection(const TriangleIntersection& inter)
+{
+  // Set up local structures to hold Impl array information
+  vtkPolyData* mesh0 = this->Mesh[0];
+  vtkPolyData* mesh1 = this->Mesh[1];
+  vtkCellArray* intersectionLines = this->IntersectionLines;
+  vtkIdTypeArray* intersectionSurfaceId = this->SurfaceId;
+  vtkIdTypeArray* intersectionCellIds0 = this->CellIds[0];
+  vtkIdTypeArray* intersectionCellIds1 = this->CellIds[1];
+  vtkPointLocator* pointMerger = this->PointMerger;
 
-              vtkIdType ptId0, ptId1;
-              int unique[2];
-              unique[0] = pointMerger->InsertUniquePoint(outpt0, ptId0);
-              unique[1] = pointMerger->InsertUniquePoint(outpt1, ptId1);
+  const vtkIdType cellId0 = inter.CellId0;
+  const vtkIdType cellId1 = inter.CellId1;
+  const double* surfaceid = inter.SurfaceId;
+  double outpt0[3] = { inter.Points[0][0], inter.Points[0][1], inter.Points[0][2] };
+  double outpt1[3] = { inter.Points[1][0], inter.Points[1][1], inter.Points[1][2] };
+  vtkIdType npts0, npts1;
+  const vtkIdType* triPtIds0;
+  const vtkIdType* triPtIds1;
+  mesh0->GetCellPoints(cellId0, npts0, triPtIds0);
+  mesh1->GetCellPoints(cellId1, npts1, triPtIds1);
 
-              int addline = 1;
-              if (ptId0 == ptId1)
-              {
-                addline = 0;
-              }
+  vtkIdType lineId = intersectionLines->GetNumberOfCells();
 
-              if (ptId0 == ptId1 && surfaceid[0] != surfaceid[1])
-              {
-                intersectionSurfaceId->InsertValue(ptId0, 3);
-              }
-              else
-              {
-                if (unique[0])
-                {
-                  intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
-                }
-                else
-                {
-                  if (intersectionSurfaceId->GetValue(ptId0) != 3)
-                  {
-                    intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
-                  }
-                }
-                if (unique[1])
-                {
-                  intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
-                }
-                else
-                {
-                  if (intersectionSurfaceId->GetValue(ptId1) != 3)
-                  {
-                    intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
-                  }
-                }
-              }
+  vtkIdType ptId0, ptId1;
+  int unique[2];
+  unique[0] = pointMerger->InsertUniquePoint(outpt0, ptId0);
+  unique[1] = pointMerger->InsertUniquePoint(outpt1, ptId1);
 
-              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+  int addline = 1;
+  if (ptId0 == ptId1)
+  {
+    addline = 0;
+  }
 
-              // Check to see if duplicate line. Line can only be a duplicate
-              // line if both points are not unique and they don't
-              // equal each other
-              if (!unique[0] && !unique[1] && ptId0 != ptId1)
-              {
-                vtkSmartPointer<vtkPolyData> lineTest = vtkSmartPointer<vtkPolyData>::New();
-                lineTest->SetPoints(pointMerger->GetPoints());
-                lineTest->SetLines(intersectionLines);
-                lineTest->BuildLinks();
-                int newLine = info->CheckLine(lineTest, ptId0, ptId1);
-                if (newLine == 0)
-                {
-                  addline = 0;
-                }
-              }
-              if (addline)
-              {
-                // If the line is new and does not consist of two identical
-                // points, add the line to the intersection and update
-                // mapping information
-                intersectionLines->InsertNextCell(2);
-                intersectionLines->InsertCellPoint(ptId0);
-                intersectionLines->InsertCellPoint(ptId1);
-
-                intersectionCellIds0->InsertNextValue(cellId0);
-                intersectionCellIds1->InsertNextValue(cellId1);
-
-                info->PointCellIds[0]->InsertValue(ptId0, cellId0);
-                info->PointCellIds[0]->InsertValue(ptId1, cellId0);
-                info->PointCellIds[1]->InsertValue(ptId0, cellId1);
-                info->PointCellIds[1]->InsertValue(ptId1, cellId1);
-
-                info->IntersectionMap[0]->insert(std::make_pair(cellId0, lineId));
-                info->IntersectionMap[1]->insert(std::make_pair(cellId1, lineId));
-
-                // Check which edges of cellId0 and cellId1 outpt0 and
-                // outpt1 are on, if any.
-                int isOnEdge = 0;
-                int m0p0 = 0, m0p1 = 0, m1p0 = 0, m1p1 = 0;
-                for (vtkIdType edgeId = 0; edgeId < 3; edgeId++)
-                {
-                  isOnEdge = info->AddToPointEdgeMap(
-                    0, ptId0, outpt0, mesh0, cellId0, edgeId, lineId, triPtIds0);
-                  if (isOnEdge != -1)
-                  {
-                    m0p0++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    0, ptId1, outpt1, mesh0, cellId0, edgeId, lineId, triPtIds0);
-                  if (isOnEdge != -1)
-                  {
-                    m0p1++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    1, ptId0, outpt0, mesh1, cellId1, edgeId, lineId, triPtIds1);
-                  if (isOnEdge != -1)
-                  {
-                    m1p0++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    1, ptId1, outpt1, mesh1, cellId1, edgeId, lineId, triPtIds1);
-                  if (isOnEdge != -1)
-                  {
-                    m1p1++;
-                  }
-                }
-                // Special cases caught by tolerance and not from the Point
-                // Merger
-                if (m0p0 > 0 && m1p0 > 0)
-                {
-                  intersectionSurfaceId->InsertValue(ptId0, 3);
-                }
-                if (m0p1 > 0 && m1p1 > 0)
-                {
-                  intersectionSurfaceId->InsertValue(ptId1, 3);
-                }
-              }
-              // Add information about origin surface to std::maps for
-              // checks later
-              if (intersectionSurfaceId->GetValue(ptId0) == 1)
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-              }
-              else if (intersectionSurfaceId->GetValue(ptId0) == 2)
-              {
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              }
-              else
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              }
-              if (intersectionSurfaceId->GetValue(ptId1) == 1)
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-              }
-              else if (intersectionSurfaceId->GetValue(ptId1) == 2)
-              {
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
-              }
-              else
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
-              }
-            }
-          }
-        }
+  if (ptId0 == ptId1 && surfaceid[0] != surfaceid[1])
+  {
+    intersectionSurfaceId->InsertValue(ptId0, 3);
+  }
+  else
+  {
+    if (unique[0])
+    {
+      intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
+    }
+    else
+    {
+      if (intersectionSurfaceId->GetValue(ptId0) != 3)
+      {
+        intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
+      }
+    }
+    if (unique[1])
+    {
+      intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
+    }
+    else
+    {
+      if (intersectionSurfaceId->GetValue(ptId1) != 3)
+      {
+        intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
       }
     }
   }
 
-  return 1;
+  this->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+  this->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+  this->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+  this->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+
+  // Check to see if duplicate line. Line can only be a duplicate
+  // line if both points are not unique and they don't
+  // equal each other
+  if (!unique[0] && !unique[1] && ptId0 != ptId1)
+  {
+    if (this->LineSet.count(std::make_pair(std::min(ptId0, ptId1), std::max(ptId0, ptId1))))
+    {
+      addline = 0;
+    }
+  }
+  if (addline)
+  {
+    // If the line is new and does not consist of two identical
+    // points, add the line to the intersection and update
+    // mapping information
+    intersectionLines->InsertNextCell(2);
+    intersectionLines->InsertCellPoint(ptId0);
+    intersectionLines->InsertCellPoint(ptId1);
+    this->LineSet.insert(std::make_pair(std::min(ptId0, ptId1), std::max(ptId0, ptId1)));
+
+    intersectionCellIds0->InsertNextValue(cellId0);
+    intersectionCellIds1->InsertNextValue(cellId1);
+
+    this->PointCellIds[0]->InsertValue(ptId0, cellId0);
+    this->PointCellIds[0]->InsertValue(ptId1, cellId0);
+    this->PointCellIds[1]->InsertValue(ptId0, cellId1);
+    this->PointCellIds[1]->InsertValue(ptId1, cellId1);
+
+    this->IntersectionMap[0]->insert(std::make_pair(cellId0, lineId));
+    this->IntersectionMap[1]->insert(std::make_pair(cellId1, lineId));
+
+    // Check which edges of cellId0 and cellId1 outpt0 and
+    // outpt1 are on, if any.
+    int isOnEdge = 0;
+    int m0p0 = 0, m0p1 = 0, m1p0 = 0, m1p1 = 0;
+    for (vtkIdType edgeId = 0; edgeId < 3; edgeId++)
+    {
+      isOnEdge = this->AddToPointEdgeMap(
+        0, ptId0, outpt0, mesh0, cellId0, edgeId, lineId, triPtIds0);
+      if (isOnEdge != -1)
+      {
+        m0p0++;
+      }
+      isOnEdge = this->AddToPointEdgeMap(
+        0, ptId1, outpt1, mesh0, cellId0, edgeId, lineId, triPtIds0);
+      if (isOnEdge != -1)
+      {
+        m0p1++;
+      }
+      isOnEdge = this->AddToPointEdgeMap(
+        1, ptId0, outpt0, mesh1, cellId1, edgeId, lineId, triPtIds1);
+      if (isOnEdge != -1)
+      {
+        m1p0++;
+      }
+      isOnEdge = this->AddToPointEdgeMap(
+        1, ptId1, outpt1, mesh1, cellId1, edgeId, lineId, triPtIds1);
+      if (isOnEdge != -1)
+      {
+        m1p1++;
+      }
+    }
+    // Special cases caught by tolerance and not from the Point
+    // Merger
+    if (m0p0 > 0 && m1p0 > 0)
+    {
+      intersectionSurfaceId->InsertValue(ptId0, 3);
+    }
+    if (m0p1 > 0 && m1p1 > 0)
+    {
+      intersectionSurfaceId->InsertValue(ptId1, 3);
+    }
+  }
+  // Add information about origin surface to std::maps for
+  // checks later
+  if (intersectionSurfaceId->GetValue(ptId0) == 1)
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+  }
+  else if (intersectionSurfaceId->GetValue(ptId0) == 2)
+  {
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+  }
+  else
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+  }
+  if (intersectionSurfaceId->GetValue(ptId1) == 1)
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+  }
+  else if (intersectionSurfaceId->GetValue(ptId1) == 2)
+  {
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+  }
+  else
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -2285,40 +2332,12 @@ int vtkIntersectionPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
   vtkSmartPointer<vtkPolyData> mesh1 = vtkSmartPointer<vtkPolyData>::New();
   mesh1->DeepCopy(input1);
 
-  // Find the triangle-triangle intersections between mesh0 and mesh1
-  vtkSmartPointer<vtkOBBTree> obbTree0 = vtkSmartPointer<vtkOBBTree>::New();
-  obbTree0->SetDataSet(mesh0);
-  obbTree0->SetNumberOfCellsPerNode(10);
-  obbTree0->SetMaxLevel(1000000);
-  obbTree0->SetTolerance(this->Tolerance);
-  obbTree0->AutomaticOn();
-  obbTree0->BuildLocator();
-
-  if (this->CheckAbort())
-  {
-    return 1;
-  }
-
-  vtkSmartPointer<vtkOBBTree> obbTree1 = vtkSmartPointer<vtkOBBTree>::New();
-  obbTree1->SetDataSet(mesh1);
-  obbTree1->SetNumberOfCellsPerNode(10);
-  obbTree1->SetMaxLevel(1000000);
-  obbTree1->SetTolerance(this->Tolerance);
-  obbTree1->AutomaticOn();
-  obbTree1->BuildLocator();
-
-  if (this->CheckAbort())
-  {
-    return 1;
-  }
-
   // Set up the structure for determining exact triangle-triangle
   // intersections.
   vtkIntersectionPolyDataFilter::Impl* impl = new vtkIntersectionPolyDataFilter::Impl();
   impl->ParentFilter = this;
   impl->Mesh[0] = mesh0;
   impl->Mesh[1] = mesh1;
-  impl->OBBTree1 = obbTree1;
   impl->Tolerance = this->Tolerance;
   impl->RelativeSubtriangleArea = this->RelativeSubtriangleArea;
 
@@ -2382,8 +2401,7 @@ int vtkIntersectionPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
   }
 
   // This performs the triangle intersection search
-  obbTree0->IntersectWithOBBTree(
-    obbTree1, nullptr, vtkIntersectionPolyDataFilter::Impl::FindTriangleIntersections, impl);
+  impl->FindTriangleIntersections();
 
   int rawLines = outputIntersection->GetNumberOfLines();
 
@@ -38,6 +38,7 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include "vtkSmartPointer.h"
@@ -77,7 +78,7 @@ struct AccumulateAverage
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(), std::plus<T>{});
+    vtkSMPTools::Transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(), std::plus<T>{});
   }
 };
 
@@ -92,7 +93,7 @@ struct AccumulateMinimum
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
+    vtkSMPTools::Transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
       [](T v1, T v2) -> T { return std::min(v1, v2); });
   }
 };
@@ -108,7 +109,7 @@ struct AccumulateMaximum
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
+    vtkSMPTools::Transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
       [](T v1, T v2) -> T { return std::max(v1, v2); });
   }
 };
@@ -130,11 +131,13 @@ struct AccumulateStdDev
     const auto prevValues = vtk::DataArrayValueRange(prevArray);
     auto outValues = vtk::DataArrayValueRange(outArray);
 
-    for (vtkIdType i = 0; i < inValues.size(); ++i)
-    {
-      const double temp = inValues[i] - (prevValues[i] / pass);
-      outValues[i] += static_cast<T>(pass * temp * temp / (pass + 1.));
-    }
+    vtkSMPTools::For(0, inValues.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const double temp = inValues[i] - (prevValues[i] / pass);
+        outValues[i] += static_cast<T>(pass * temp * temp / (pass + 1.));
+      }
+    });
   }
 };
 
@@ -146,10 +149,12 @@ struct FinishAverage
   {
     auto range = vtk::DataArrayValueRange(array);
     using RefT = typename decltype(range)::ReferenceType;
-    for (RefT ref : range)
-    {
-      ref /= sumSize;
-    }
+    vtkSMPTools::For(0, range.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (RefT ref : vtk::DataArrayValueRange(array, begin, end))
+      {
+        ref /= sumSize;
+      }
+    });
   }
 };
 
@@ -163,10 +168,12 @@ struct FinishStdDev
     auto range = vtk::DataArrayValueRange(array);
     using RefT = typename decltype(range)::ReferenceType;
     using ValueT = typename decltype(range)::ValueType;
-    for (RefT ref : range)
-    {
-      ref = static_cast<ValueT>(std::sqrt(static_cast<double>(ref) / sumSize));
-    }
+    vtkSMPTools::For(0, range.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (RefT ref : vtk::DataArrayValueRange(array, begin, end))
+      {
+        ref = static_cast<ValueT>(std::sqrt(static_cast<double>(ref) / sumSize));
+      }
+    });
   }
 };
 
@@ -564,7 +571,7 @@ void vtkTemporalStatistics::AccumulateArrays(vtkFieldData* inFd, vtkFieldData* o
       AccumulateAverage worker;
       if (!Dispatcher::Execute(inArray, outArray, worker))
       { // Fallback to slow path:
-        worker(inArray, stdevOutArray);
+        worker(inArray, outArray);
       }
 
       // Alert change in data.
@@ -43,6 +43,10 @@
  * timestep.  Thus, the average statistic may be quite different from an
  * integration of the variable if the time spacing varies.
  *
+ * The statistics are accumulated in a single pass over the time steps, with
+ * a numerically stable update of the standard deviation. The values of each
+ * array are accumulated concurrently with vtkSMPTools.
+ *
  * @par Thanks:
  * This class was originally written by Kenneth Moreland (kmorel@sandia.gov)
  * from Sandia National Laboratories.
@@ -29,6 +29,7 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
 #include "vtkEmptyCell.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
@@ -36,10 +37,14 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkIntArray.h"
 #include "vtkMath.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
@@ -52,6 +57,7 @@ PURPOSE.  See the above copyright notice for more information.
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -403,12 +409,11 @@ struct vtkYoungsMaterialInterface_Mat
   vtkDataArray* orderingArray;
 
   // temporary
-  vtkIdType numberOfCells;
-  vtkIdType numberOfPoints;
   vtkIdType cellCount;
   vtkIdType cellArrayCount;
   vtkIdType pointCount;
-  vtkIdType* pointMap;
+  std::unordered_map<vtkIdType, vtkIdType> pointMap; // input point -> output point
+  std::vector<vtkIdType> pointSources; // input point of each output point, -1 if generated
 
   // output
   std::vector<unsigned char> cellTypes;
@@ -450,7 +455,52 @@ static inline void vtkYoungsMaterialInterface_GetPointData(int nPointData,
 
 #define GET_POINT_DATA(a, i, t)                                                                    \
   vtkYoungsMaterialInterface_GetPointData(                                                         \
-    nPointData, inPointArrays, input, prevPointsMap, nmat, Mats, a, i, t)
+    nPointData, inPointArrays, input, prevPointsMap, nmat, chunkMats, a, i, t)
+
+// Create the empty output arrays of a material, like the input arrays. The
+// last point array holds the point coordinates.
+static void vtkYoungsMaterialInterface_NewOutputArrays(vtkYoungsMaterialInterface_Mat& mat,
+  int nCellData, vtkDataArray** inCellArrays, int nPointData, vtkDataArray** inPointArrays)
+{
+  mat.cellCount = 0;
+  mat.cellArrayCount = 0;
+  mat.pointCount = 0;
+
+  mat.outCellArrays = new vtkDataArray*[nCellData];
+  for (int i = 0; i < nCellData; ++i)
+  {
+    mat.outCellArrays[i] = vtkDataArray::CreateDataArray(inCellArrays[i]->GetDataType());
+    mat.outCellArrays[i]->SetName(inCellArrays[i]->GetName());
+    mat.outCellArrays[i]->SetNumberOfComponents(inCellArrays[i]->GetNumberOfComponents());
+  }
+
+  mat.outPointArrays = new vtkDataArray*[nPointData];
+  for (int i = 0; i < (nPointData - 1); i++)
+  {
+    mat.outPointArrays[i] = vtkDataArray::CreateDataArray(inPointArrays[i]->GetDataType());
+    mat.outPointArrays[i]->SetName(inPointArrays[i]->GetName());
+    mat.outPointArrays[i]->SetNumberOfComponents(inPointArrays[i]->GetNumberOfComponents());
+  }
+  mat.outPointArrays[nPointData - 1] = vtkDoubleArray::New();
+  mat.outPointArrays[nPointData - 1]->SetName("Points");
+  mat.outPointArrays[nPointData - 1]->SetNumberOfComponents(3);
+}
+
+// Delete the output arrays of a material.
+static void vtkYoungsMaterialInterface_DeleteOutputArrays(
+  vtkYoungsMaterialInterface_Mat& mat, int nCellData, int nPointData)
+{
+  for (int i = 0; i < nCellData; i++)
+  {
+    mat.outCellArrays[i]->Delete();
+  }
+  for (int i = 0; i < nPointData; i++)
+  {
+    mat.outPointArrays[i]->Delete();
+  }
+  delete[] mat.outCellArrays;
+  delete[] mat.outPointArrays;
+}
 
 struct CellInfo
 {
@@ -482,6 +532,17 @@ struct CellInfo
   }
 };
 
+// The output of each material for a range of consecutive cells, with point
+// ids local to the range, and the debug statistics of the range.
+struct vtkYoungsMaterialInterface_Chunk
+{
+  std::vector<vtkYoungsMaterialInterface_Mat> Mats;
+  vtkIdType PrimaryTriangulationfailed = 0;
+  vtkIdType Triangulationfailed = 0;
+  vtkIdType NullNormal = 0;
+  vtkIdType NoInterfaceFound = 0;
+};
+
 int vtkYoungsMaterialInterface::CellProduceInterface(
   int dim, int np, double fraction, double minFrac, double maxFrac)
 {
@@ -714,747 +775,813 @@ int vtkYoungsMaterialInterface::RequestData(vtkInformation* vtkNotUsed(request),
             nullptr; // TODO: we certainly can do better to avoid material calculations
         }
 
-        Mats[m].numberOfCells = 0;
-        Mats[m].cellCount = 0;
-        Mats[m].cellArrayCount = 0;
-
-        Mats[m].outCellArrays = new vtkDataArray*[nCellData];
-        for (int i = 0; i < nCellData; ++i)
-        {
-          Mats[m].outCellArrays[i] = vtkDataArray::CreateDataArray(inCellArrays[i]->GetDataType());
-          Mats[m].outCellArrays[i]->SetName(inCellArrays[i]->GetName());
-          Mats[m].outCellArrays[i]->SetNumberOfComponents(inCellArrays[i]->GetNumberOfComponents());
-        }
-
-        Mats[m].numberOfPoints = 0;
-        Mats[m].pointCount = 0;
-        Mats[m].outPointArrays = new vtkDataArray*[nPointData];
-
-        for (int i = 0; i < (nPointData - 1); i++)
-        {
-          Mats[m].outPointArrays[i] =
-            vtkDataArray::CreateDataArray(inPointArrays[i]->GetDataType());
-          Mats[m].outPointArrays[i]->SetName(inPointArrays[i]->GetName());
-          Mats[m].outPointArrays[i]->SetNumberOfComponents(
-            inPointArrays[i]->GetNumberOfComponents());
-        }
-        Mats[m].outPointArrays[nPointData - 1] = vtkDoubleArray::New();
-        Mats[m].outPointArrays[nPointData - 1]->SetName("Points");
-        Mats[m].outPointArrays[nPointData - 1]->SetNumberOfComponents(3);
+        Mats[m].outCellArrays = nullptr;
+        Mats[m].outPointArrays = nullptr;
       }
     }
 
-    // --------------- per material number of interfaces estimation ------------
-    for (vtkIdType c = 0; c < nCells; c++)
+    // --------------------------- core computation --------------------------
+    // The cells are processed concurrently by chunks of consecutive cells.
+    // Each chunk has its own output for each material, with point ids local
+    // to the chunk, and the outputs of the chunks are merged in order. The
+    // chunks only depend on the number of cells, so that the output does not
+    // depend on the number of threads.
+    const vtkIdType chunkSize = std::max<vtkIdType>(1000, nCells / 1024);
+    const vtkIdType nChunks = (nCells + chunkSize - 1) / chunkSize;
+    std::vector<vtkYoungsMaterialInterface_Chunk> chunks(nChunks);
+
+    // Build the cell structures of the input before the concurrent GetCell calls.
+    if (nCells > 0)
     {
-      vtkCell* vtkcell = input->GetCell(c);
-      int cellDim = vtkcell->GetCellDimension();
-      int np = vtkcell->GetNumberOfPoints();
-      int nf = vtkcell->GetNumberOfFaces();
+      vtkNew<vtkGenericCell> firstCell;
+      input->GetCell(0, firstCell);
+    }
 
-      for (int m = 0; m < nmat; m++)
+    vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+    vtkSMPThreadLocalObject<vtkPoints> tlPts;
+    vtkSMPThreadLocalObject<vtkConvexPointSet> tlCpsCell;
+    vtkSMPThreadLocalObject<vtkGenericCell> tlGenericCell;
+    vtkSMPThreadLocal<std::vector<double>> tlInterpolatedValues;
+    vtkSMPThreadLocal<std::vector<vtkYoungsMaterialInterface_IndexedValue>> tlMatOrdering;
+    vtkSMPThreadLocal<std::vector<std::pair<int, vtkIdType>>> tlPrevPointsMap;
+    vtkSMPThreadLocal<std::vector<double>> tlCellTuple;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+
+    vtkSMPTools::For(0, nChunks, 1, [&](vtkIdType firstChunk, vtkIdType lastChunk) {
+      vtkIdList* ptIds = tlPtIds.Local();
+      vtkPoints* pts = tlPts.Local();
+      vtkConvexPointSet* cpsCell = tlCpsCell.Local();
+      vtkGenericCell* genericCell = tlGenericCell.Local();
+      std::vector<double>& interpolatedValuesBuffer = tlInterpolatedValues.Local();
+      interpolatedValuesBuffer.resize(MAX_CELL_POINTS * pointDataComponents);
+      double* interpolatedValues = interpolatedValuesBuffer.data();
+      std::vector<vtkYoungsMaterialInterface_IndexedValue>& matOrderingBuffer =
+        tlMatOrdering.Local();
+      matOrderingBuffer.resize(nmat);
+      vtkYoungsMaterialInterface_IndexedValue* matOrdering = matOrderingBuffer.data();
+      std::vector<std::pair<int, vtkIdType>>& prevPointsMap = tlPrevPointsMap.Local();
+      prevPointsMap.reserve(MAX_CELL_POINTS * nmat);
+      // GetTuple(i) and GetTuple1 share one buffer per array, read tuples in
+      // a buffer of this thread instead
+      std::vector<double>& cellTuple = tlCellTuple.Local();
+
+      for (vtkIdType chunkId = firstChunk; chunkId < lastChunk; ++chunkId)
       {
-        double fraction =
-          (Mats[m].fractionArray != nullptr) ? Mats[m].fractionArray->GetTuple1(c) : 0;
-        if (this->CellProduceInterface(
-              cellDim, np, fraction, this->VolumeFractionRange[0], this->VolumeFractionRange[1]))
+        if (isFirst)
         {
-          if (cellDim == 2)
-          {
-            Mats[m].numberOfPoints += 2;
-          }
-          else
-          {
-            Mats[m].numberOfPoints += nf;
-          }
-          if (this->FillMaterial)
-          {
-            Mats[m].numberOfPoints += np - 1;
-          }
-          Mats[m].numberOfCells++;
+          this->CheckAbort();
         }
-      }
-    }
-
-    // allocation of output arrays
-    for (int m = 0; m < nmat; m++)
-    {
-      vtkDebugMacro(<< "Mat #" << m << " : cells=" << Mats[m].numberOfCells << ", points="
-                    << Mats[m].numberOfPoints << ", FillMaterial=" << this->FillMaterial << "\n");
-      for (int i = 0; i < nCellData; i++)
-      {
-        Mats[m].outCellArrays[i]->Allocate(
-          Mats[m].numberOfCells * Mats[m].outCellArrays[i]->GetNumberOfComponents());
-      }
-      for (int i = 0; i < nPointData; i++)
-      {
-        Mats[m].outPointArrays[i]->Allocate(
-          Mats[m].numberOfPoints * Mats[m].outPointArrays[i]->GetNumberOfComponents());
-      }
-      Mats[m].cellTypes.reserve(Mats[m].numberOfCells);
-      Mats[m].cells.reserve(Mats[m].numberOfCells + Mats[m].numberOfPoints);
-      Mats[m].pointMap = new vtkIdType[nPoints];
-      for (vtkIdType i = 0; i < nPoints; i++)
-      {
-        Mats[m].pointMap[i] = -1;
-      }
-    }
-
-    // --------------------------- core computation --------------------------
-    vtkIdList* ptIds = vtkIdList::New();
-    vtkPoints* pts = vtkPoints::New();
-    vtkConvexPointSet* cpsCell = vtkConvexPointSet::New();
-
-    double* interpolatedValues = new double[MAX_CELL_POINTS * pointDataComponents];
-    vtkYoungsMaterialInterface_IndexedValue* matOrdering =
-      new vtkYoungsMaterialInterface_IndexedValue[nmat];
-
-    std::vector<std::pair<int, vtkIdType>> prevPointsMap;
-    prevPointsMap.reserve(MAX_CELL_POINTS * nmat);
-
-    for (vtkIdType ci = 0; ci < nCells; ci++)
-    {
-      if (this->CheckAbort())
-      {
-        break;
-      }
-      int interfaceEdges[MAX_CELL_POINTS * 2];
-      double interfaceWeights[MAX_CELL_POINTS];
-      int nInterfaceEdges;
-
-      int insidePointIds[MAX_CELL_POINTS];
-      int nInsidePoints;
-
-      int outsidePointIds[MAX_CELL_POINTS];
-      int nOutsidePoints;
-
-      int outCellPointIds[MAX_CELL_POINTS];
-      int nOutCellPoints;
-
-      double referenceVolume = 1.0;
-      double normal[3];
-      bool normaleNulle = false;
-
-      prevPointsMap.clear();
-
-      // sort materials
-      int nEffectiveMat = 0;
-      for (int mi = 0; mi < nmat; mi++)
-      {
-        matOrdering[mi].index = mi;
-        matOrdering[mi].value =
-          (Mats[mi].orderingArray != nullptr) ? Mats[mi].orderingArray->GetTuple1(ci) : 0.0;
-
-        double fraction =
-          (Mats[mi].fractionArray != nullptr) ? Mats[mi].fractionArray->GetTuple1(ci) : 0;
-        if (this->UseFractionAsDistance || fraction > this->VolumeFractionRange[0])
-          nEffectiveMat++;
-      }
-      std::stable_sort(matOrdering, matOrdering + nmat);
-
-      // read cell information for the first iteration
-      // a temporary cell will then be generated after each iteration for the next one.
-      vtkCell* vtkcell = input->GetCell(ci);
-      CellInfo cell;
-      cell.dim = vtkcell->GetCellDimension();
-      cell.np = vtkcell->GetNumberOfPoints();
-      cell.nf = vtkcell->GetNumberOfFaces();
-      cell.type = vtkcell->GetCellType();
-
-      /* copy points and point ids to lacal arrays.
-         IMPORTANT NOTE : A negative point id refers to a point in the previous material.
-         the material number and real point id can be found through the prevPointsMap. */
-      for (int p = 0; p < cell.np; p++)
-      {
-        cell.pointIds[p] = vtkcell->GetPointId(p);
-        DBG_ASSERT(cell.pointIds[p] >= 0 && cell.pointIds[p] < nPoints);
-        vtkcell->GetPoints()->GetPoint(p, cell.points[p]);
-      }
-
-      /* Triangulate cell.
-         IMPORTANT NOTE: triangulation is given with mesh point ids (not local cell ids)
-         and are translated to cell local point ids. */
-      cell.needTriangulation = false;
-      cell.triangulationOk = (vtkcell->Triangulate(ci, ptIds, pts) != 0);
-      cell.ntri = 0;
-      if (cell.triangulationOk)
-      {
-        cell.ntri = ptIds->GetNumberOfIds() / (cell.dim + 1);
-        for (int i = 0; i < (cell.ntri * (cell.dim + 1)); i++)
+        if (this->GetAbortOutput())
         {
-          vtkIdType j =
-            std::find(cell.pointIds, cell.pointIds + cell.np, ptIds->GetId(i)) - cell.pointIds;
-          DBG_ASSERT(j >= 0 && j < cell.np);
-          cell.triangulation[i] = j;
+          break;
         }
-      }
-      else
-      {
-        debugStats_PrimaryTriangulationfailed++;
-        vtkWarningMacro(<< "Triangulation failed on primary cell\n");
-      }
 
-      // get 3D cell edges.
-      if (cell.dim == 3)
-      {
-        vtkCell3D* cell3D = vtkCell3D::SafeDownCast(vtkcell);
-        cell.nEdges = vtkcell->GetNumberOfEdges();
-        for (int i = 0; i < cell.nEdges; i++)
+        vtkYoungsMaterialInterface_Chunk& chunk = chunks[chunkId];
+        chunk.Mats.assign(Mats, Mats + nmat);
+        for (auto& chunkMat : chunk.Mats)
         {
-          const vtkIdType* edgePoints;
-          cell3D->GetEdgePoints(i, edgePoints);
-          cell.edges[i][0] = edgePoints[0];
-          DBG_ASSERT(cell.edges[i][0] >= 0 && cell.edges[i][0] < cell.np);
-          cell.edges[i][1] = edgePoints[1];
-          DBG_ASSERT(cell.edges[i][1] >= 0 && cell.edges[i][1] < cell.np);
+          vtkYoungsMaterialInterface_NewOutputArrays(
+            chunkMat, nCellData, inCellArrays, nPointData, inPointArrays);
         }
-      }
+        vtkYoungsMaterialInterface_Mat* chunkMats = chunk.Mats.data();
 
-      // For debugging : ensure that we don't read anything from cell, but only from previously
-      // filled arrays
-      vtkcell = nullptr;
+        const vtkIdType lastCell = std::min(nCells, (chunkId + 1) * chunkSize);
+        for (vtkIdType ci = chunkId * chunkSize; ci < lastCell; ci++)
+        {
+          int interfaceEdges[MAX_CELL_POINTS * 2];
+          double interfaceWeights[MAX_CELL_POINTS];
+          int nInterfaceEdges;
 
-      int processedEfectiveMat = 0;
+          int insidePointIds[MAX_CELL_POINTS];
+          int nInsidePoints;
 
-      // Loop for each material. Current cell is iteratively cut.
-      for (int mi = 0; mi < nmat; mi++)
-      {
-        int m =
-          this->ReverseMaterialOrder ? matOrdering[nmat - 1 - mi].index : matOrdering[mi].index;
+          int outsidePointIds[MAX_CELL_POINTS];
+          int nOutsidePoints;
 
-        // Get volume fraction and interface plane normal from input arrays
-        double fraction =
-          (Mats[m].fractionArray != nullptr) ? Mats[m].fractionArray->GetTuple1(ci) : 0;
+          int outCellPointIds[MAX_CELL_POINTS];
+          int nOutCellPoints;
 
-        // Normalize remaining volume fraction
-        fraction = (referenceVolume > 0) ? (fraction / referenceVolume) : 0.0;
+          double referenceVolume = 1.0;
+          double normal[3];
+          bool normaleNulle = false;
 
-        if (this->CellProduceInterface(cell.dim, cell.np, fraction, this->VolumeFractionRange[0],
-              this->VolumeFractionRange[1]))
-        {
-          CellInfo nextCell; // empty cell by default
-          int interfaceCellType = VTK_EMPTY_CELL;
+          prevPointsMap.clear();
 
-          if ((!mi) || (!this->OnionPeel))
+          // sort materials
+          int nEffectiveMat = 0;
+          for (int mi = 0; mi < nmat; mi++)
           {
-            normal[0] = 0;
-            normal[1] = 0;
-            normal[2] = 0;
-
-            if (Mats[m].normalArray != nullptr)
-              Mats[m].normalArray->GetTuple(ci, normal);
-            if (Mats[m].normalXArray != nullptr)
-              normal[0] = Mats[m].normalXArray->GetTuple1(ci);
-            if (Mats[m].normalYArray != nullptr)
-              normal[1] = Mats[m].normalYArray->GetTuple1(ci);
-            if (Mats[m].normalZArray != nullptr)
-              normal[2] = Mats[m].normalZArray->GetTuple1(ci);
-
-            // work-around for degenerated normals
-            if (vtkMath::Norm(normal) == 0.0) // should it be <EPSILON ?
-            {
-              debugStats_NullNormal++;
-              normaleNulle = true;
-              normal[0] = 1.0;
-              normal[1] = 0.0;
-              normal[2] = 0.0;
-            }
-            else
-            {
-              vtkMath::Normalize(normal);
-            }
-            if (this->InverseNormal)
-            {
-              normal[0] = -normal[0];
-              normal[1] = -normal[1];
-              normal[2] = -normal[2];
-            }
+            matOrdering[mi].index = mi;
+            matOrdering[mi].value = (chunkMats[mi].orderingArray != nullptr)
+              ? chunkMats[mi].orderingArray->GetComponent(ci, 0)
+              : 0.0;
+
+            double fraction = (chunkMats[mi].fractionArray != nullptr)
+              ? chunkMats[mi].fractionArray->GetComponent(ci, 0)
+              : 0;
+            if (this->UseFractionAsDistance || fraction > this->VolumeFractionRange[0])
+              nEffectiveMat++;
           }
-
-          // count how many materials we've processed so far
-          if (fraction > this->VolumeFractionRange[0])
+          std::stable_sort(matOrdering, matOrdering + nmat);
+
+          // read cell information for the first iteration
+          // a temporary cell will then be generated after each iteration for the next one.
+          input->GetCell(ci, genericCell);
+          vtkCell* vtkcell = genericCell->GetRepresentativeCell();
+          CellInfo cell;
+          cell.dim = vtkcell->GetCellDimension();
+          cell.np = vtkcell->GetNumberOfPoints();
+          cell.nf = vtkcell->GetNumberOfFaces();
+          cell.type = vtkcell->GetCellType();
+
+          /* copy points and point ids to lacal arrays.
+             IMPORTANT NOTE : A negative point id refers to a point in the previous material.
+             the material number and real point id can be found through the prevPointsMap. */
+          for (int p = 0; p < cell.np; p++)
           {
-            processedEfectiveMat++;
+            cell.pointIds[p] = vtkcell->GetPointId(p);
+            DBG_ASSERT(cell.pointIds[p] >= 0 && cell.pointIds[p] < nPoints);
+            vtkcell->GetPoints()->GetPoint(p, cell.points[p]);
           }
 
-          // -= case where the entire input cell is passed through =-
-          if ((!this->UseFractionAsDistance && fraction > this->VolumeFractionRange[1] &&
-                this->FillMaterial) ||
-            (this->UseFractionAsDistance && normaleNulle))
+          /* Triangulate cell.
+             IMPORTANT NOTE: triangulation is given with mesh point ids (not local cell ids)
+             and are translated to cell local point ids. */
+          cell.needTriangulation = false;
+          cell.triangulationOk = (vtkcell->Triangulate(ci, ptIds, pts) != 0);
+          cell.ntri = 0;
+          if (cell.triangulationOk)
           {
-            interfaceCellType = cell.type;
-            // Mats[m].cellTypes.push_back( cell.type );
-            nOutCellPoints = nInsidePoints = cell.np;
-            nInterfaceEdges = 0;
-            nOutsidePoints = 0;
-            for (int p = 0; p < cell.np; p++)
+            cell.ntri = ptIds->GetNumberOfIds() / (cell.dim + 1);
+            for (int i = 0; i < (cell.ntri * (cell.dim + 1)); i++)
             {
-              outCellPointIds[p] = insidePointIds[p] = p;
+              vtkIdType j =
+                std::find(cell.pointIds, cell.pointIds + cell.np, ptIds->GetId(i)) - cell.pointIds;
+              DBG_ASSERT(j >= 0 && j < cell.np);
+              cell.triangulation[i] = j;
             }
-            // remaining volume is an empty cell (nextCell is left as is)
           }
-
-          // -= case where the entire cell is ignored =-
-
-          else if (!this->UseFractionAsDistance &&
-            (fraction < this->VolumeFractionRange[0] ||
-              (fraction > this->VolumeFractionRange[1] && !this->FillMaterial) ||
-              !cell.triangulationOk))
+          else
           {
-            interfaceCellType = VTK_EMPTY_CELL;
-            // Mats[m].cellTypes.push_back( VTK_EMPTY_CELL );
-
-            nOutCellPoints = 0;
-            nInterfaceEdges = 0;
-            nInsidePoints = 0;
-            nOutsidePoints = 0;
-
-            // remaining volume is the same cell
-            nextCell = cell;
+            chunk.PrimaryTriangulationfailed++;
+            vtkWarningMacro(<< "Triangulation failed on primary cell\n");
+          }
 
-            if (!cell.triangulationOk)
+          // get 3D cell edges.
+          if (cell.dim == 3)
+          {
+            vtkCell3D* cell3D = vtkCell3D::SafeDownCast(vtkcell);
+            cell.nEdges = vtkcell->GetNumberOfEdges();
+            for (int i = 0; i < cell.nEdges; i++)
             {
-              debugStats_Triangulationfailed++;
-              vtkWarningMacro(<< "Cell triangulation failed\n");
+              const vtkIdType* edgePoints;
+              cell3D->GetEdgePoints(i, edgePoints);
+              cell.edges[i][0] = edgePoints[0];
+              DBG_ASSERT(cell.edges[i][0] >= 0 && cell.edges[i][0] < cell.np);
+              cell.edges[i][1] = edgePoints[1];
+              DBG_ASSERT(cell.edges[i][1] >= 0 && cell.edges[i][1] < cell.np);
             }
           }
 
-          // -= 2D case =-
-          else if (cell.dim == 2)
+          // For debugging : ensure that we don't read anything from cell, but only from previously
+          // filled arrays
+          vtkcell = nullptr;
+
+          int processedEfectiveMat = 0;
+
+          // Loop for each material. Current cell is iteratively cut.
+          for (int mi = 0; mi < nmat; mi++)
           {
-            int nRemCellPoints;
-            int remCellPointIds[MAX_CELL_POINTS];
+            int m =
+              this->ReverseMaterialOrder ? matOrdering[nmat - 1 - mi].index : matOrdering[mi].index;
 
-            int triangles[MAX_CELL_POINTS][3];
-            for (int i = 0; i < cell.ntri; i++)
-              for (int j = 0; j < 3; j++)
-              {
-                triangles[i][j] = cell.triangulation[i * 3 + j];
-                DBG_ASSERT(triangles[i][j] >= 0 && triangles[i][j] < cell.np);
-              }
+            // Get volume fraction and interface plane normal from input arrays
+            double fraction = (chunkMats[m].fractionArray != nullptr)
+              ? chunkMats[m].fractionArray->GetComponent(ci, 0)
+              : 0;
 
-            bool interfaceFound = vtkYoungsMaterialInterfaceCellCut::cellInterfaceD(cell.points,
-              cell.np, triangles, cell.ntri, fraction, normal, this->AxisSymetric != 0,
-              this->UseFractionAsDistance != 0, interfaceEdges, interfaceWeights, nOutCellPoints,
-              outCellPointIds, nRemCellPoints, remCellPointIds);
+            // Normalize remaining volume fraction
+            fraction = (referenceVolume > 0) ? (fraction / referenceVolume) : 0.0;
 
-            if (interfaceFound)
+            if (this->CellProduceInterface(cell.dim, cell.np, fraction,
+                  this->VolumeFractionRange[0], this->VolumeFractionRange[1]))
             {
-              nInterfaceEdges = 2;
-              interfaceCellType = this->FillMaterial ? VTK_POLYGON : VTK_LINE;
-              // Mats[m].cellTypes.push_back( this->FillMaterial ? VTK_POLYGON : VTK_LINE );
-
-              // remaining volume is a polygon
-              nextCell.dim = 2;
-              nextCell.np = nRemCellPoints;
-              nextCell.nf = nRemCellPoints;
-              nextCell.type = VTK_POLYGON;
-
-              // build polygon triangulation for next iteration
-              nextCell.ntri = nextCell.np - 2;
-              for (int i = 0; i < nextCell.ntri; i++)
-              {
-                nextCell.triangulation[i * 3 + 0] = 0;
-                nextCell.triangulation[i * 3 + 1] = i + 1;
-                nextCell.triangulation[i * 3 + 2] = i + 2;
-              }
-              nextCell.triangulationOk = true;
-              nextCell.needTriangulation = false;
+              CellInfo nextCell; // empty cell by default
+              int interfaceCellType = VTK_EMPTY_CELL;
 
-              // populate prevPointsMap and next iteration cell point ids
-              int ni = 0;
-              for (int i = 0; i < nRemCellPoints; i++)
+              if ((!mi) || (!this->OnionPeel))
               {
-                vtkIdType id = remCellPointIds[i];
-                if (id < 0)
+                normal[0] = 0;
+                normal[1] = 0;
+                normal[2] = 0;
+
+                if (chunkMats[m].normalArray != nullptr)
+                  chunkMats[m].normalArray->GetTuple(ci, normal);
+                if (chunkMats[m].normalXArray != nullptr)
+                  normal[0] = chunkMats[m].normalXArray->GetComponent(ci, 0);
+                if (chunkMats[m].normalYArray != nullptr)
+                  normal[1] = chunkMats[m].normalYArray->GetComponent(ci, 0);
+                if (chunkMats[m].normalZArray != nullptr)
+                  normal[2] = chunkMats[m].normalZArray->GetComponent(ci, 0);
+
+                // work-around for degenerated normals
+                if (vtkMath::Norm(normal) == 0.0) // should it be <EPSILON ?
                 {
-                  id = -(int)(prevPointsMap.size() + 1);
-                  DBG_ASSERT((-id - 1) == prevPointsMap.size());
-                  prevPointsMap.emplace_back(
-                    m, Mats[m].pointCount + ni); // intersection points will be added first
-                  ni++;
+                  chunk.NullNormal++;
+                  normaleNulle = true;
+                  normal[0] = 1.0;
+                  normal[1] = 0.0;
+                  normal[2] = 0.0;
                 }
                 else
                 {
-                  DBG_ASSERT(id >= 0 && id < cell.np);
-                  id = cell.pointIds[id];
+                  vtkMath::Normalize(normal);
+                }
+                if (this->InverseNormal)
+                {
+                  normal[0] = -normal[0];
+                  normal[1] = -normal[1];
+                  normal[2] = -normal[2];
                 }
-                nextCell.pointIds[i] = id;
               }
-              DBG_ASSERT(ni == nInterfaceEdges);
 
-              // filter out points inside material volume
-              nInsidePoints = 0;
-              for (int i = 0; i < nOutCellPoints; i++)
+              // count how many materials we've processed so far
+              if (fraction > this->VolumeFractionRange[0])
               {
-                if (outCellPointIds[i] >= 0)
-                  insidePointIds[nInsidePoints++] = outCellPointIds[i];
+                processedEfectiveMat++;
               }
 
-              if (!this->FillMaterial) // keep only interface points
-
+              // -= case where the entire input cell is passed through =-
+              if ((!this->UseFractionAsDistance && fraction > this->VolumeFractionRange[1] &&
+                    this->FillMaterial) ||
+                (this->UseFractionAsDistance && normaleNulle))
               {
-                int n = 0;
-                for (int i = 0; i < nOutCellPoints; i++)
+                interfaceCellType = cell.type;
+                // Mats[m].cellTypes.push_back( cell.type );
+                nOutCellPoints = nInsidePoints = cell.np;
+                nInterfaceEdges = 0;
+                nOutsidePoints = 0;
+                for (int p = 0; p < cell.np; p++)
                 {
-                  if (outCellPointIds[i] < 0)
-                    outCellPointIds[n++] = outCellPointIds[i];
+                  outCellPointIds[p] = insidePointIds[p] = p;
                 }
-                nOutCellPoints = n;
+                // remaining volume is an empty cell (nextCell is left as is)
               }
-            }
-            else
-            {
-              vtkWarningMacro(<< "no interface found for cell " << ci << ", mi=" << mi
-                              << ", m=" << m << ", frac=" << fraction << "\n");
-              nInterfaceEdges = 0;
-              nOutCellPoints = 0;
-              nInsidePoints = 0;
-              nOutsidePoints = 0;
-              interfaceCellType = VTK_EMPTY_CELL;
-              // Mats[m].cellTypes.push_back( VTK_EMPTY_CELL );
-              // remaining volume is the original cell left unmodified
-              nextCell = cell;
-            }
-          }
 
-          // -= 3D case =-
+              // -= case where the entire cell is ignored =-
 
-          else
-          {
-            int tetras[MAX_CELL_POINTS][4];
-            for (int i = 0; i < cell.ntri; i++)
-              for (int j = 0; j < 4; j++)
+              else if (!this->UseFractionAsDistance &&
+                (fraction < this->VolumeFractionRange[0] ||
+                  (fraction > this->VolumeFractionRange[1] && !this->FillMaterial) ||
+                  !cell.triangulationOk))
               {
-                tetras[i][j] = cell.triangulation[i * 4 + j];
-              }
+                interfaceCellType = VTK_EMPTY_CELL;
+                // Mats[m].cellTypes.push_back( VTK_EMPTY_CELL );
 
-            // compute interface polygon
-            vtkYoungsMaterialInterfaceCellCut::cellInterface3D(cell.np, cell.points, cell.nEdges,
-              cell.edges, cell.ntri, tetras, fraction, normal, this->UseFractionAsDistance != 0,
-              nInterfaceEdges, interfaceEdges, interfaceWeights, nInsidePoints, insidePointIds,
-              nOutsidePoints, outsidePointIds);
+                nOutCellPoints = 0;
+                nInterfaceEdges = 0;
+                nInsidePoints = 0;
+                nOutsidePoints = 0;
 
-            if (nInterfaceEdges > cell.nf ||
-              nInterfaceEdges < 3) // degenerated case, considered as null interface
-            {
-              debugStats_NoInterfaceFound++;
-              vtkDebugMacro(<< "no interface found for cell " << ci << ", mi=" << mi << ", m=" << m
-                            << ", frac=" << fraction << "\n");
-              nInterfaceEdges = 0;
-              nOutCellPoints = 0;
-              nInsidePoints = 0;
-              nOutsidePoints = 0;
-              interfaceCellType = VTK_EMPTY_CELL;
-              // Mats[m].cellTypes.push_back( VTK_EMPTY_CELL );
-
-              // in this case, next iteration cell is the same
-              nextCell = cell;
-            }
-            else
-            {
-              nOutCellPoints = 0;
+                // remaining volume is the same cell
+                nextCell = cell;
 
-              for (int e = 0; e < nInterfaceEdges; e++)
-              {
-                outCellPointIds[nOutCellPoints++] = -e - 1;
+                if (!cell.triangulationOk)
+                {
+                  chunk.Triangulationfailed++;
+                  vtkWarningMacro(<< "Cell triangulation failed\n");
+                }
               }
 
-              if (this->FillMaterial)
+              // -= 2D case =-
+              else if (cell.dim == 2)
               {
-                interfaceCellType = VTK_CONVEX_POINT_SET;
-                // Mats[m].cellTypes.push_back( VTK_CONVEX_POINT_SET );
-                for (int p = 0; p < nInsidePoints; p++)
+                int nRemCellPoints;
+                int remCellPointIds[MAX_CELL_POINTS];
+
+                int triangles[MAX_CELL_POINTS][3];
+                for (int i = 0; i < cell.ntri; i++)
+                  for (int j = 0; j < 3; j++)
+                  {
+                    triangles[i][j] = cell.triangulation[i * 3 + j];
+                    DBG_ASSERT(triangles[i][j] >= 0 && triangles[i][j] < cell.np);
+                  }
+
+                bool interfaceFound = vtkYoungsMaterialInterfaceCellCut::cellInterfaceD(
+                  cell.points, cell.np, triangles, cell.ntri, fraction, normal,
+                  this->AxisSymetric != 0, this->UseFractionAsDistance != 0, interfaceEdges,
+                  interfaceWeights, nOutCellPoints, outCellPointIds, nRemCellPoints,
+                  remCellPointIds);
+
+                if (interfaceFound)
+                {
+                  nInterfaceEdges = 2;
+                  interfaceCellType = this->FillMaterial ? VTK_POLYGON : VTK_LINE;
+                  // Mats[m].cellTypes.push_back( this->FillMaterial ? VTK_POLYGON : VTK_LINE );
+
+                  // remaining volume is a polygon
+                  nextCell.dim = 2;
+                  nextCell.np = nRemCellPoints;
+                  nextCell.nf = nRemCellPoints;
+                  nextCell.type = VTK_POLYGON;
+
+                  // build polygon triangulation for next iteration
+                  nextCell.ntri = nextCell.np - 2;
+                  for (int i = 0; i < nextCell.ntri; i++)
+                  {
+                    nextCell.triangulation[i * 3 + 0] = 0;
+                    nextCell.triangulation[i * 3 + 1] = i + 1;
+                    nextCell.triangulation[i * 3 + 2] = i + 2;
+                  }
+                  nextCell.triangulationOk = true;
+                  nextCell.needTriangulation = false;
+
+                  // populate prevPointsMap and next iteration cell point ids
+                  int ni = 0;
+                  for (int i = 0; i < nRemCellPoints; i++)
+                  {
+                    vtkIdType id = remCellPointIds[i];
+                    if (id < 0)
+                    {
+                      id = -(int)(prevPointsMap.size() + 1);
+                      DBG_ASSERT((-id - 1) == prevPointsMap.size());
+                      prevPointsMap.emplace_back(
+                        m, chunkMats[m].pointCount + ni); // intersection points will be added first
+                      ni++;
+                    }
+                    else
+                    {
+                      DBG_ASSERT(id >= 0 && id < cell.np);
+                      id = cell.pointIds[id];
+                    }
+                    nextCell.pointIds[i] = id;
+                  }
+                  DBG_ASSERT(ni == nInterfaceEdges);
+
+                  // filter out points inside material volume
+                  nInsidePoints = 0;
+                  for (int i = 0; i < nOutCellPoints; i++)
+                  {
+                    if (outCellPointIds[i] >= 0)
+                      insidePointIds[nInsidePoints++] = outCellPointIds[i];
+                  }
+
+                  if (!this->FillMaterial) // keep only interface points
+
+                  {
+                    int n = 0;
+                    for (int i = 0; i < nOutCellPoints; i++)
+                    {
+                      if (outCellPointIds[i] < 0)
+                        outCellPointIds[n++] = outCellPointIds[i];
+                    }
+                    nOutCellPoints = n;
+                  }
+                }
+                else
                 {
-                  outCellPointIds[nOutCellPoints++] = insidePointIds[p];
+                  vtkWarningMacro(<< "no interface found for cell " << ci << ", mi=" << mi
+                                  << ", m=" << m << ", frac=" << fraction << "\n");
+                  nInterfaceEdges = 0;
+                  nOutCellPoints = 0;
+                  nInsidePoints = 0;
+                  nOutsidePoints = 0;
+                  interfaceCellType = VTK_EMPTY_CELL;
+                  // Mats[m].cellTypes.push_back( VTK_EMPTY_CELL );
+                  // remaining volume is the original cell left unmodified
+                  nextCell = cell;
                 }
               }
+
+              // -= 3D case =-
+
               else
               {
-                interfaceCellType = VTK_POLYGON;
-                // Mats[m].cellTypes.push_back( VTK_POLYGON );
-              }
+                int tetras[MAX_CELL_POINTS][4];
+                for (int i = 0; i < cell.ntri; i++)
+                  for (int j = 0; j < 4; j++)
+                  {
+                    tetras[i][j] = cell.triangulation[i * 4 + j];
+                  }
 
-              // NB: Remaining volume is a convex point set
-              // IMPORTANT NOTE: next iteration cell cannot be entirely built right now.
-              // in this particular case we'll finish it at the end of the material loop.
-              // If no other material remains to be processed, then skip this step.
-              if (mi < (nmat - 1) && processedEfectiveMat < nEffectiveMat)
-              {
-                nextCell.type = VTK_CONVEX_POINT_SET;
-                nextCell.np = nInterfaceEdges + nOutsidePoints;
-                vtkcell = cpsCell;
-                vtkcell->Points->Reset();
-                vtkcell->PointIds->Reset();
-                vtkcell->Points->SetNumberOfPoints(nextCell.np);
-                vtkcell->PointIds->SetNumberOfIds(nextCell.np);
-                for (int i = 0; i < nextCell.np; i++)
+                // compute interface polygon
+                vtkYoungsMaterialInterfaceCellCut::cellInterface3D(cell.np, cell.points,
+                  cell.nEdges, cell.edges, cell.ntri, tetras, fraction, normal,
+                  this->UseFractionAsDistance != 0, nInterfaceEdges, interfaceEdges,
+                  interfaceWeights, nInsidePoints, insidePointIds, nOutsidePoints,
+                  outsidePointIds);
+
+                if (nInterfaceEdges > cell.nf ||
+                  nInterfaceEdges < 3) // degenerated case, considered as null interface
                 {
-                  vtkcell->PointIds->SetId(i, i);
+                  chunk.NoInterfaceFound++;
+                  vtkDebugMacro(<< "no interface found for cell " << ci << ", mi=" << mi
+                                << ", m=" << m << ", frac=" << fraction << "\n");
+                  nInterfaceEdges = 0;
+                  nOutCellPoints = 0;
+                  nInsidePoints = 0;
+                  nOutsidePoints = 0;
+                  interfaceCellType = VTK_EMPTY_CELL;
+                  // Mats[m].cellTypes.push_back( VTK_EMPTY_CELL );
+
+                  // in this case, next iteration cell is the same
+                  nextCell = cell;
                 }
-                // nf, ntri and triangulation have to be computed later on, when point coords are
-                // computed
-                nextCell.needTriangulation = true;
-              }
+                else
+                {
+                  nOutCellPoints = 0;
 
-              for (int i = 0; i < nInterfaceEdges; i++)
-              {
-                vtkIdType id = -(int)(prevPointsMap.size() + 1);
-                DBG_ASSERT((-id - 1) == prevPointsMap.size());
-                // Interpolated points will be added consecutively
-                prevPointsMap.emplace_back(m, Mats[m].pointCount + i);
-                nextCell.pointIds[i] = id;
-              }
-              for (int i = 0; i < nOutsidePoints; i++)
-              {
-                nextCell.pointIds[nInterfaceEdges + i] = cell.pointIds[outsidePointIds[i]];
-              }
-            }
+                  for (int e = 0; e < nInterfaceEdges; e++)
+                  {
+                    outCellPointIds[nOutCellPoints++] = -e - 1;
+                  }
 
-            // check correctness of next cell's point ids
-            for (int i = 0; i < nextCell.np; i++)
-            {
-              DBG_ASSERT(
-                (nextCell.pointIds[i] < 0 && (-nextCell.pointIds[i] - 1) < prevPointsMap.size()) ||
-                (nextCell.pointIds[i] >= 0 && nextCell.pointIds[i] < nPoints));
-            }
-          } // End 3D case
+                  if (this->FillMaterial)
+                  {
+                    interfaceCellType = VTK_CONVEX_POINT_SET;
+                    // Mats[m].cellTypes.push_back( VTK_CONVEX_POINT_SET );
+                    for (int p = 0; p < nInsidePoints; p++)
+                    {
+                      outCellPointIds[nOutCellPoints++] = insidePointIds[p];
+                    }
+                  }
+                  else
+                  {
+                    interfaceCellType = VTK_POLYGON;
+                    // Mats[m].cellTypes.push_back( VTK_POLYGON );
+                  }
 
-          //  create output cell
-          if (interfaceCellType != VTK_EMPTY_CELL)
-          {
+                  // NB: Remaining volume is a convex point set
+                  // IMPORTANT NOTE: next iteration cell cannot be entirely built right now.
+                  // in this particular case we'll finish it at the end of the material loop.
+                  // If no other material remains to be processed, then skip this step.
+                  if (mi < (nmat - 1) && processedEfectiveMat < nEffectiveMat)
+                  {
+                    nextCell.type = VTK_CONVEX_POINT_SET;
+                    nextCell.np = nInterfaceEdges + nOutsidePoints;
+                    vtkcell = cpsCell;
+                    vtkcell->Points->Reset();
+                    vtkcell->PointIds->Reset();
+                    vtkcell->Points->SetNumberOfPoints(nextCell.np);
+                    vtkcell->PointIds->SetNumberOfIds(nextCell.np);
+                    for (int i = 0; i < nextCell.np; i++)
+                    {
+                      vtkcell->PointIds->SetId(i, i);
+                    }
+                    // nf, ntri and triangulation have to be computed later on, when point coords
+                    // are computed
+                    nextCell.needTriangulation = true;
+                  }
 
-            // set type of cell
-            Mats[m].cellTypes.push_back(interfaceCellType);
+                  for (int i = 0; i < nInterfaceEdges; i++)
+                  {
+                    vtkIdType id = -(int)(prevPointsMap.size() + 1);
+                    DBG_ASSERT((-id - 1) == prevPointsMap.size());
+                    // Interpolated points will be added consecutively
+                    prevPointsMap.emplace_back(m, chunkMats[m].pointCount + i);
+                    nextCell.pointIds[i] = id;
+                  }
+                  for (int i = 0; i < nOutsidePoints; i++)
+                  {
+                    nextCell.pointIds[nInterfaceEdges + i] = cell.pointIds[outsidePointIds[i]];
+                  }
+                }
 
-            // interpolate point values for cut edges
-            for (int e = 0; e < nInterfaceEdges; e++)
-            {
-              double t = interfaceWeights[e];
-              for (int p = 0; p < nPointData; p++)
-              {
-                double v0[16];
-                double v1[16];
-                int nc = Mats[m].outPointArrays[p]->GetNumberOfComponents();
-                int ep0 = cell.pointIds[interfaceEdges[e * 2 + 0]];
-                int ep1 = cell.pointIds[interfaceEdges[e * 2 + 1]];
-                GET_POINT_DATA(p, ep0, v0);
-                GET_POINT_DATA(p, ep1, v1);
-                for (int c = 0; c < nc; c++)
+                // check correctness of next cell's point ids
+                for (int i = 0; i < nextCell.np; i++)
                 {
-                  interpolatedValues[e * pointDataComponents + pointArrayOffset[p] + c] =
-                    v0[c] + t * (v1[c] - v0[c]);
+                  DBG_ASSERT((nextCell.pointIds[i] < 0 &&
+                               (-nextCell.pointIds[i] - 1) < prevPointsMap.size()) ||
+                    (nextCell.pointIds[i] >= 0 && nextCell.pointIds[i] < nPoints));
                 }
-              }
-            }
+              } // End 3D case
 
-            // copy point values
-            for (int e = 0; e < nInterfaceEdges; e++)
-            {
-              for (int a = 0; a < nPointData; a++)
-              {
-                DBG_ASSERT(nptId == Mats[m].outPointArrays[a]->GetNumberOfTuples());
-                Mats[m].outPointArrays[a]->InsertNextTuple(
-                  interpolatedValues + e * pointDataComponents + pointArrayOffset[a]);
-              }
-            }
-            int pointsCopied = 0;
-            int prevMatInterfToBeAdded = 0;
-            if (this->FillMaterial)
-            {
-              for (int p = 0; p < nInsidePoints; p++)
+              //  create output cell
+              if (interfaceCellType != VTK_EMPTY_CELL)
               {
-                vtkIdType ptId = cell.pointIds[insidePointIds[p]];
-                if (ptId >= 0)
+
+                // set type of cell
+                chunkMats[m].cellTypes.push_back(interfaceCellType);
+
+                // interpolate point values for cut edges
+                for (int e = 0; e < nInterfaceEdges; e++)
                 {
-                  if (Mats[m].pointMap[ptId] == -1)
+                  double t = interfaceWeights[e];
+                  for (int p = 0; p < nPointData; p++)
                   {
-                    vtkIdType nptId = Mats[m].pointCount + nInterfaceEdges + pointsCopied;
-                    Mats[m].pointMap[ptId] = nptId;
-                    pointsCopied++;
-                    for (int a = 0; a < nPointData; a++)
+                    double v0[16];
+                    double v1[16];
+                    int nc = chunkMats[m].outPointArrays[p]->GetNumberOfComponents();
+                    int ep0 = cell.pointIds[interfaceEdges[e * 2 + 0]];
+                    int ep1 = cell.pointIds[interfaceEdges[e * 2 + 1]];
+                    GET_POINT_DATA(p, ep0, v0);
+                    GET_POINT_DATA(p, ep1, v1);
+                    for (int c = 0; c < nc; c++)
                     {
-                      DBG_ASSERT(nptId == Mats[m].outPointArrays[a]->GetNumberOfTuples());
-                      double tuple[16];
-                      GET_POINT_DATA(a, ptId, tuple);
-                      Mats[m].outPointArrays[a]->InsertNextTuple(tuple);
+                      interpolatedValues[e * pointDataComponents + pointArrayOffset[p] + c] =
+                        v0[c] + t * (v1[c] - v0[c]);
                     }
                   }
                 }
-                else
-                {
-                  prevMatInterfToBeAdded++;
-                }
-              }
-            }
 
-            // Populate connectivity array and add extra points from previous
-            // edge intersections that are used but not inserted yet
-            int prevMatInterfAdded = 0;
-            Mats[m].cells.push_back(nOutCellPoints);
-            Mats[m].cellArrayCount++;
-            for (int p = 0; p < nOutCellPoints; ++p)
-            {
-              int nptId;
-              int pointIndex = outCellPointIds[p];
-              if (pointIndex >= 0)
-              {
-                // An original point is encountered (not an edge intersection)
-                DBG_ASSERT(pointIndex >= 0 && pointIndex < cell.np);
-                vtkIdType ptId = cell.pointIds[pointIndex];
-                if (ptId >= 0)
+                // copy point values
+                for (int e = 0; e < nInterfaceEdges; e++)
                 {
-                  // Interface from a previous iteration
-                  DBG_ASSERT(ptId >= 0 && ptId < nPoints);
-                  nptId = Mats[m].pointMap[ptId];
+                  for (int a = 0; a < nPointData; a++)
+                  {
+                    DBG_ASSERT(nptId == chunkMats[m].outPointArrays[a]->GetNumberOfTuples());
+                    chunkMats[m].outPointArrays[a]->InsertNextTuple(
+                      interpolatedValues + e * pointDataComponents + pointArrayOffset[a]);
+                  }
                 }
-                else
+                chunkMats[m].pointSources.insert(
+                  chunkMats[m].pointSources.end(), nInterfaceEdges, -1);
+                int pointsCopied = 0;
+                int prevMatInterfToBeAdded = 0;
+                if (this->FillMaterial)
                 {
-                  nptId = Mats[m].pointCount + nInterfaceEdges + pointsCopied + prevMatInterfAdded;
-                  prevMatInterfAdded++;
-                  for (int a = 0; a < nPointData; a++)
+                  for (int p = 0; p < nInsidePoints; p++)
                   {
-                    DBG_ASSERT(nptId == Mats[m].outPointArrays[a]->GetNumberOfTuples());
-                    double tuple[16];
-                    GET_POINT_DATA(a, ptId, tuple);
-                    Mats[m].outPointArrays[a]->InsertNextTuple(tuple);
+                    vtkIdType ptId = cell.pointIds[insidePointIds[p]];
+                    if (ptId >= 0)
+                    {
+                      vtkIdType nptId = chunkMats[m].pointCount + nInterfaceEdges + pointsCopied;
+                      if (chunkMats[m].pointMap.emplace(ptId, nptId).second)
+                      {
+                        chunkMats[m].pointSources.push_back(ptId);
+                        pointsCopied++;
+                        for (int a = 0; a < nPointData; a++)
+                        {
+                          DBG_ASSERT(nptId == chunkMats[m].outPointArrays[a]->GetNumberOfTuples());
+                          double tuple[16];
+                          GET_POINT_DATA(a, ptId, tuple);
+                          chunkMats[m].outPointArrays[a]->InsertNextTuple(tuple);
+                        }
+                      }
+                    }
+                    else
+                    {
+                      prevMatInterfToBeAdded++;
+                    }
                   }
                 }
-              }
-              else
-              {
-                int interfaceIndex = -pointIndex - 1;
-                DBG_ASSERT(interfaceIndex >= 0 && interfaceIndex < nInterfaceEdges);
-                nptId = Mats[m].pointCount + interfaceIndex;
-              }
-              DBG_ASSERT(nptId >= 0 &&
-                nptId <
-                  (Mats[m].pointCount + nInterfaceEdges + pointsCopied + prevMatInterfToBeAdded));
-              Mats[m].cells.push_back(nptId);
-              Mats[m].cellArrayCount++;
-            }
-            (void)prevMatInterfToBeAdded;
 
-            Mats[m].pointCount += nInterfaceEdges + pointsCopied + prevMatInterfAdded;
+                // Populate connectivity array and add extra points from previous
+                // edge intersections that are used but not inserted yet
+                int prevMatInterfAdded = 0;
+                chunkMats[m].cells.push_back(nOutCellPoints);
+                chunkMats[m].cellArrayCount++;
+                for (int p = 0; p < nOutCellPoints; ++p)
+                {
+                  int nptId;
+                  int pointIndex = outCellPointIds[p];
+                  if (pointIndex >= 0)
+                  {
+                    // An original point is encountered (not an edge intersection)
+                    DBG_ASSERT(pointIndex >= 0 && pointIndex < cell.np);
+                    vtkIdType ptId = cell.pointIds[pointIndex];
+                    if (ptId >= 0)
+                    {
+                      // Interface from a previous iteration
+                      DBG_ASSERT(ptId >= 0 && ptId < nPoints);
+                      nptId = chunkMats[m].pointMap[ptId];
+                    }
+                    else
+                    {
+                      nptId = chunkMats[m].pointCount + nInterfaceEdges + pointsCopied +
+                        prevMatInterfAdded;
+                      prevMatInterfAdded++;
+                      chunkMats[m].pointSources.push_back(-1);
+                      for (int a = 0; a < nPointData; a++)
+                      {
+                        DBG_ASSERT(nptId == chunkMats[m].outPointArrays[a]->GetNumberOfTuples());
+                        double tuple[16];
+                        GET_POINT_DATA(a, ptId, tuple);
+                        chunkMats[m].outPointArrays[a]->InsertNextTuple(tuple);
+                      }
+                    }
+                  }
+                  else
+                  {
+                    int interfaceIndex = -pointIndex - 1;
+                    DBG_ASSERT(interfaceIndex >= 0 && interfaceIndex < nInterfaceEdges);
+                    nptId = chunkMats[m].pointCount + interfaceIndex;
+                  }
+                  DBG_ASSERT(nptId >= 0 &&
+                    nptId < (chunkMats[m].pointCount + nInterfaceEdges + pointsCopied +
+                              prevMatInterfToBeAdded));
+                  chunkMats[m].cells.push_back(nptId);
+                  chunkMats[m].cellArrayCount++;
+                }
+                (void)prevMatInterfToBeAdded;
 
-            // Copy cell arrays
-            for (int a = 0; a < nCellData; a++)
-            {
-              Mats[m].outCellArrays[a]->InsertNextTuple(inCellArrays[a]->GetTuple(ci));
-            }
-            Mats[m].cellCount++;
+                chunkMats[m].pointCount += nInterfaceEdges + pointsCopied + prevMatInterfAdded;
 
-            // Check for equivalence between counters and container sizes
-            DBG_ASSERT(Mats[m].cellCount == Mats[m].cellTypes.size());
-            DBG_ASSERT(Mats[m].cellArrayCount == Mats[m].cells.size());
+                // Copy cell arrays
+                for (int a = 0; a < nCellData; a++)
+                {
+                  cellTuple.resize(inCellArrays[a]->GetNumberOfComponents());
+                  inCellArrays[a]->GetTuple(ci, cellTuple.data());
+                  chunkMats[m].outCellArrays[a]->InsertNextTuple(cellTuple.data());
+                }
+                chunkMats[m].cellCount++;
 
-            // Populate next iteration cell point coordinates
-            for (int i = 0; i < nextCell.np; i++)
-            {
-              DBG_ASSERT(
-                (nextCell.pointIds[i] < 0 && (-nextCell.pointIds[i] - 1) < prevPointsMap.size()) ||
-                (nextCell.pointIds[i] >= 0 && nextCell.pointIds[i] < nPoints));
-              GET_POINT_DATA((nPointData - 1), nextCell.pointIds[i], nextCell.points[i]);
-            }
+                // Check for equivalence between counters and container sizes
+                DBG_ASSERT(chunkMats[m].cellCount == chunkMats[m].cellTypes.size());
+                DBG_ASSERT(chunkMats[m].cellArrayCount == chunkMats[m].cells.size());
 
-            // for the convex point set, we need to first compute point coords before triangulation
-            // (no fixed topology)
-            if (nextCell.needTriangulation && mi < (nmat - 1) &&
-              processedEfectiveMat < nEffectiveMat)
-            {
-              //                       for(int myi = 0;myi<nextCell.np;myi++)
-              //                       {
-              //                                cerr<<"p["<<myi<<"]=("<<nextCell.points[myi][0]<<','<<nextCell.points[myi][1]<<','<<nextCell.points[myi][2]<<")
-              //                                ";
-              //                       }
-              //                       cerr<<endl;
-
-              vtkcell->Initialize();
-              nextCell.nf = vtkcell->GetNumberOfFaces();
-              if (nextCell.dim == 3)
-              {
-                vtkCell3D* cell3D = vtkCell3D::SafeDownCast(vtkcell);
-                nextCell.nEdges = vtkcell->GetNumberOfEdges();
-                for (int i = 0; i < nextCell.nEdges; i++)
+                // Populate next iteration cell point coordinates
+                for (int i = 0; i < nextCell.np; i++)
                 {
-                  const vtkIdType* edgePoints;
-                  cell3D->GetEdgePoints(i, edgePoints);
-                  nextCell.edges[i][0] = edgePoints[0];
-                  DBG_ASSERT(nextCell.edges[i][0] >= 0 && nextCell.edges[i][0] < nextCell.np);
-                  nextCell.edges[i][1] = edgePoints[1];
-                  DBG_ASSERT(nextCell.edges[i][1] >= 0 && nextCell.edges[i][1] < nextCell.np);
+                  DBG_ASSERT((nextCell.pointIds[i] < 0 &&
+                               (-nextCell.pointIds[i] - 1) < prevPointsMap.size()) ||
+                    (nextCell.pointIds[i] >= 0 && nextCell.pointIds[i] < nPoints));
+                  GET_POINT_DATA((nPointData - 1), nextCell.pointIds[i], nextCell.points[i]);
                 }
-              }
-              nextCell.triangulationOk = (vtkcell->Triangulate(ci, ptIds, pts) != 0);
-              nextCell.ntri = 0;
-              if (nextCell.triangulationOk)
-              {
-                nextCell.ntri = ptIds->GetNumberOfIds() / (nextCell.dim + 1);
-                for (int i = 0; i < (nextCell.ntri * (nextCell.dim + 1)); i++)
+
+                // for the convex point set, we need to first compute point coords before
+                // triangulation (no fixed topology)
+                if (nextCell.needTriangulation && mi < (nmat - 1) &&
+                  processedEfectiveMat < nEffectiveMat)
                 {
-                  vtkIdType j = ptIds->GetId(i); // cell ids have been set with local ids
-                  DBG_ASSERT(j >= 0 && j < nextCell.np);
-                  nextCell.triangulation[i] = j;
+                  //                       for(int myi = 0;myi<nextCell.np;myi++)
+                  //                       {
+                  //                                cerr<<"p["<<myi<<"]=("<<nextCell.points[myi][0]<<','<<nextCell.points[myi][1]<<','<<nextCell.points[myi][2]<<")
+                  //                                ";
+                  //                       }
+                  //                       cerr<<endl;
+
+                  vtkcell->Initialize();
+                  nextCell.nf = vtkcell->GetNumberOfFaces();
+                  if (nextCell.dim == 3)
+                  {
+                    vtkCell3D* cell3D = vtkCell3D::SafeDownCast(vtkcell);
+                    nextCell.nEdges = vtkcell->GetNumberOfEdges();
+                    for (int i = 0; i < nextCell.nEdges; i++)
+                    {
+                      const vtkIdType* edgePoints;
+                      cell3D->GetEdgePoints(i, edgePoints);
+                      nextCell.edges[i][0] = edgePoints[0];
+                      DBG_ASSERT(nextCell.edges[i][0] >= 0 && nextCell.edges[i][0] < nextCell.np);
+                      nextCell.edges[i][1] = edgePoints[1];
+                      DBG_ASSERT(nextCell.edges[i][1] >= 0 && nextCell.edges[i][1] < nextCell.np);
+                    }
+                  }
+                  nextCell.triangulationOk = (vtkcell->Triangulate(ci, ptIds, pts) != 0);
+                  nextCell.ntri = 0;
+                  if (nextCell.triangulationOk)
+                  {
+                    nextCell.ntri = ptIds->GetNumberOfIds() / (nextCell.dim + 1);
+                    for (int i = 0; i < (nextCell.ntri * (nextCell.dim + 1)); i++)
+                    {
+                      vtkIdType j = ptIds->GetId(i); // cell ids have been set with local ids
+                      DBG_ASSERT(j >= 0 && j < nextCell.np);
+                      nextCell.triangulation[i] = j;
+                    }
+                  }
+                  else
+                  {
+                    chunk.Triangulationfailed++;
+                    vtkWarningMacro(<< "Triangulation failed. Info: cell " << ci << ", material "
+                                    << mi << ", np=" << nextCell.np << ", nf=" << nextCell.nf
+                                    << ", ne=" << nextCell.nEdges << "\n");
+                  }
+                  nextCell.needTriangulation = false;
+                  vtkcell = nullptr;
                 }
-              }
+
+                // switch to next cell
+                cell = nextCell;
+
+              } // end of 'interface was found'
+
               else
               {
-                debugStats_Triangulationfailed++;
-                vtkWarningMacro(<< "Triangulation failed. Info: cell " << ci << ", material " << mi
-                                << ", np=" << nextCell.np << ", nf=" << nextCell.nf
-                                << ", ne=" << nextCell.nEdges << "\n");
+                vtkcell = nullptr;
               }
-              nextCell.needTriangulation = false;
-              vtkcell = nullptr;
-            }
 
-            // switch to next cell
-            cell = nextCell;
+            } // end of 'cell is ok'
 
-          } // end of 'interface was found'
+            //                      else // cell is ignored
+            //                      {
+            //                              //vtkWarningMacro(<<"ignoring cell #"<<ci<<", m="<<m<<",
+            //                              mi="<<mi<<", frac="<<fraction<<"\n");
+            //                      }
 
-          else
+            // update reference volume
+            referenceVolume -= fraction;
+
+          } // for materials
+
+        } // for cells
+      }   // for chunks
+    });
+
+    for (const auto& chunk : chunks)
+    {
+      debugStats_PrimaryTriangulationfailed += chunk.PrimaryTriangulationfailed;
+      debugStats_Triangulationfailed += chunk.Triangulationfailed;
+      debugStats_NullNormal += chunk.NullNormal;
+      debugStats_NoInterfaceFound += chunk.NoInterfaceFound;
+    }
+
+    // Merge the outputs of the chunks, concurrently for each material. The
+    // input points copied by several chunks are merged, as if the cells were
+    // processed at once.
+    vtkSMPTools::For(0, nmat, 1, [&](vtkIdType firstMat, vtkIdType lastMat) {
+      for (vtkIdType m = firstMat; m < lastMat; ++m)
+      {
+        vtkYoungsMaterialInterface_Mat& mat = Mats[m];
+        vtkYoungsMaterialInterface_NewOutputArrays(
+          mat, nCellData, inCellArrays, nPointData, inPointArrays);
+        std::vector<vtkIdType> pointMap(this->FillMaterial ? nPoints : 0, -1);
+        std::vector<vtkIdType> chunkPointMap;
+        for (auto& chunk : chunks)
+        {
+          if (chunk.Mats.empty()) // aborted
           {
-            vtkcell = nullptr;
+            continue;
           }
+          vtkYoungsMaterialInterface_Mat& chunkMat = chunk.Mats[m];
 
-        } // end of 'cell is ok'
-
-        //                      else // cell is ignored
-        //                      {
-        //                              //vtkWarningMacro(<<"ignoring cell #"<<ci<<", m="<<m<<",
-        //                              mi="<<mi<<", frac="<<fraction<<"\n");
-        //                      }
+          // copy points by runs of points not copied yet
+          chunkPointMap.resize(chunkMat.pointCount);
+          vtkIdType runStart = 0;
+          for (vtkIdType p = 0; p <= chunkMat.pointCount; ++p)
+          {
+            vtkIdType source = p < chunkMat.pointCount ? chunkMat.pointSources[p] : -1;
+            bool merged = source >= 0 && pointMap[source] >= 0;
+            if (merged || p == chunkMat.pointCount)
+            {
+              for (int a = 0; a < nPointData && p > runStart; a++)
+              {
+                mat.outPointArrays[a]->InsertTuples(
+                  mat.pointCount, p - runStart, runStart, chunkMat.outPointArrays[a]);
+              }
+              mat.pointCount += p - runStart;
+              runStart = p + 1;
+            }
+            if (p == chunkMat.pointCount)
+            {
+              break;
+            }
+            if (merged)
+            {
+              chunkPointMap[p] = pointMap[source];
+            }
+            else
+            {
+              chunkPointMap[p] = mat.pointCount + p - runStart;
+              if (source >= 0)
+              {
+                pointMap[source] = chunkPointMap[p];
+              }
+            }
+          }
 
-        // update reference volume
-        referenceVolume -= fraction;
+          // renumber connectivity
+          mat.cells.reserve(mat.cells.size() + chunkMat.cellArrayCount);
+          for (vtkIdType i = 0; i < chunkMat.cellArrayCount;)
+          {
+            vtkIdType npts = chunkMat.cells[i++];
+            mat.cells.push_back(npts);
+            for (vtkIdType p = 0; p < npts; ++p)
+            {
+              mat.cells.push_back(chunkPointMap[chunkMat.cells[i++]]);
+            }
+          }
+          mat.cellArrayCount += chunkMat.cellArrayCount;
+          mat.cellTypes.insert(
+            mat.cellTypes.end(), chunkMat.cellTypes.begin(), chunkMat.cellTypes.end());
+          for (int a = 0; a < nCellData; a++)
+          {
+            mat.outCellArrays[a]->InsertTuples(
+              mat.cellCount, chunkMat.cellCount, 0, chunkMat.outCellArrays[a]);
+          }
+          mat.cellCount += chunkMat.cellCount;
 
-      } // for materials
+          vtkYoungsMaterialInterface_DeleteOutputArrays(chunkMat, nCellData, nPointData);
+          chunkMat = vtkYoungsMaterialInterface_Mat();
+        }
+      }
+    });
+    chunks.clear();
 
-    } // for cells
     delete[] pointArrayOffset;
     delete[] inPointArrays;
     delete[] inCellArrays;
 
-    ptIds->Delete();
-    pts->Delete();
-    cpsCell->Delete();
-    delete[] interpolatedValues;
-    delete[] matOrdering;
-
     // finish output creation
     //       output->SetNumberOfBlocks( nmat );
     for (int m = 0; m < nmat; m++)
     {
       if (Mats[m].cellCount > 0 && Mats[m].pointCount > 0)
       {
-        vtkDebugMacro(<< "Mat #" << m << " : cellCount=" << Mats[m].cellCount << ", numberOfCells="
-                      << Mats[m].numberOfCells << ", pointCount=" << Mats[m].pointCount
-                      << ", numberOfPoints=" << Mats[m].numberOfPoints << "\n");
+        vtkDebugMacro(<< "Mat #" << m << " : cellCount=" << Mats[m].cellCount
+                      << ", pointCount=" << Mats[m].pointCount
+                      << ", FillMaterial=" << this->FillMaterial << "\n");
       }
 
-      delete[] Mats[m].pointMap;
-
       vtkSmartPointer<vtkUnstructuredGrid> ugOutput = vtkSmartPointer<vtkUnstructuredGrid>::New();
 
       // set points
@@ -0,0 +1,169 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDataSetSurfaceFilterThreadedHashing.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkDataSetSurfaceFilter gives the same output, down to the
+// order of points and cells, with and without ThreadedFaceHashing.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkCellTypes.h"
+#include "vtkCellTypeSource.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkDataSetSurfaceFilter.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid(int cellType)
+{
+  vtkNew<vtkCellTypeSource> source;
+  source->SetCellType(cellType);
+  source->SetBlocksDimensions(4, 3, 3);
+  source->Update();
+  return vtkUnstructuredGrid::SafeDownCast(source->GetOutput());
+}
+
+// Copy the cells of several grids in a single grid, without merging points.
+vtkSmartPointer<vtkUnstructuredGrid> MakeMixedGrid()
+{
+  auto mixed = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  vtkNew<vtkPoints> points;
+  mixed->SetPoints(points);
+  mixed->Allocate();
+  vtkNew<vtkIdList> cellPoints;
+  for (int cellType : { VTK_LINE, VTK_TRIANGLE, VTK_HEXAHEDRON, VTK_TETRA, VTK_WEDGE, VTK_PYRAMID })
+  {
+    vtkSmartPointer<vtkUnstructuredGrid> grid = MakeGrid(cellType);
+    const vtkIdType offset = points->GetNumberOfPoints();
+    for (vtkIdType i = 0; i < grid->GetNumberOfPoints(); ++i)
+    {
+      points->InsertNextPoint(grid->GetPoint(i));
+    }
+    for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+    {
+      grid->GetCellPoints(i, cellPoints);
+      for (vtkIdType j = 0; j < cellPoints->GetNumberOfIds(); ++j)
+      {
+        cellPoints->SetId(j, cellPoints->GetId(j) + offset);
+      }
+      mixed->InsertNextCell(grid->GetCellType(i), cellPoints);
+    }
+  }
+
+  // hide some of the cells
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfValues(mixed->GetNumberOfCells());
+  for (vtkIdType i = 0; i < mixed->GetNumberOfCells(); ++i)
+  {
+    ghosts->SetValue(i, i % 7 == 0 ? vtkDataSetAttributes::HIDDENCELL : 0);
+  }
+  mixed->GetCellData()->AddArray(ghosts);
+  return mixed;
+}
+
+vtkSmartPointer<vtkPolyData> ExtractSurface(vtkUnstructuredGrid* grid, bool threaded)
+{
+  vtkNew<vtkDataSetSurfaceFilter> surface;
+  surface->SetInputData(grid);
+  surface->SetThreadedFaceHashing(threaded);
+  surface->PassThroughCellIdsOn();
+  surface->PassThroughPointIdsOn();
+  surface->Update();
+  return surface->GetOutput();
+}
+
+bool SameCells(vtkCellArray* cells, vtkCellArray* expectedCells)
+{
+  if (cells->GetNumberOfCells() != expectedCells->GetNumberOfCells() ||
+    cells->GetNumberOfConnectivityIds() != expectedCells->GetNumberOfConnectivityIds())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < cells->GetNumberOfConnectivityIds(); ++i)
+  {
+    if (cells->GetConnectivityArray()->GetComponent(i, 0) !=
+      expectedCells->GetConnectivityArray()->GetComponent(i, 0))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameIds(vtkDataSetAttributes* data, vtkDataSetAttributes* expectedData, const char* name)
+{
+  vtkIdTypeArray* ids = vtkIdTypeArray::SafeDownCast(data->GetArray(name));
+  vtkIdTypeArray* expectedIds = vtkIdTypeArray::SafeDownCast(expectedData->GetArray(name));
+  if (!ids || !expectedIds || ids->GetNumberOfValues() != expectedIds->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < ids->GetNumberOfValues(); ++i)
+  {
+    if (ids->GetValue(i) != expectedIds->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestGrid(vtkUnstructuredGrid* grid, const char* name)
+{
+  vtkSmartPointer<vtkPolyData> expected = ExtractSurface(grid, false);
+  vtkSmartPointer<vtkPolyData> surface = ExtractSurface(grid, true);
+  if (expected->GetNumberOfPolys() == 0)
+  {
+    std::cerr << "No surface extracted for " << name << std::endl;
+    return false;
+  }
+  if (surface->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+    !SameCells(surface->GetVerts(), expected->GetVerts()) ||
+    !SameCells(surface->GetLines(), expected->GetLines()) ||
+    !SameCells(surface->GetPolys(), expected->GetPolys()) ||
+    !SameIds(surface->GetPointData(), expected->GetPointData(), "vtkOriginalPointIds") ||
+    !SameIds(surface->GetCellData(), expected->GetCellData(), "vtkOriginalCellIds"))
+  {
+    std::cerr << "Threaded face hashing gives a different surface for " << name << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDataSetSurfaceFilterThreadedHashing(int, char*[])
+{
+  bool success = true;
+  const int cellTypes[6] = { VTK_TETRA, VTK_HEXAHEDRON, VTK_WEDGE, VTK_PYRAMID,
+    VTK_PENTAGONAL_PRISM, VTK_HEXAGONAL_PRISM };
+  for (int cellType : cellTypes)
+  {
+    success &= TestGrid(MakeGrid(cellType), vtkCellTypes::GetClassNameFromTypeId(cellType));
+  }
+  success &= TestGrid(MakeMixedGrid(), "mixed grid");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
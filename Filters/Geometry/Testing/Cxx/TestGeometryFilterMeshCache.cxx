@@ -0,0 +1,154 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGeometryFilterMeshCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Test that vtkGeometryFilter with CacheMesh on reuses the extracted surface
+// when only the attributes of its input change, and extracts it again when
+// the input mesh changes.
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkGeometryFilter.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+vtkNew<vtkDoubleArray> MakeArray(const char* name, vtkIdType numTuples, double offset)
+{
+  vtkNew<vtkDoubleArray> array;
+  array->SetName(name);
+  array->SetNumberOfTuples(numTuples);
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    array->SetValue(i, offset + i);
+  }
+  return array;
+}
+
+// Check that the output arrays hold the values of the input arrays at the
+// originating ids.
+bool CheckAttributes(vtkDataSetAttributes* inData, vtkDataSetAttributes* outData,
+  const char* arrayName, const char* idsName)
+{
+  auto inArray = vtkDoubleArray::SafeDownCast(inData->GetArray(arrayName));
+  auto outArray = vtkDoubleArray::SafeDownCast(outData->GetArray(arrayName));
+  auto ids = vtkIdTypeArray::SafeDownCast(outData->GetArray(idsName));
+  if (!inArray || !outArray || !ids || outArray->GetNumberOfTuples() != ids->GetNumberOfTuples())
+  {
+    std::cerr << "Missing or incomplete " << arrayName << " array in the output" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < outArray->GetNumberOfTuples(); ++i)
+  {
+    if (outArray->GetValue(i) != inArray->GetValue(ids->GetValue(i)))
+    {
+      std::cerr << "Wrong " << arrayName << " value at " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestGeometryFilterMeshCache(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(6, 5, 4);
+  const vtkIdType numPts = image->GetNumberOfPoints();
+  const vtkIdType numCells = image->GetNumberOfCells();
+  image->GetPointData()->SetScalars(MakeArray("PointScalars", numPts, 0.0));
+  image->GetPointData()->AddArray(MakeArray("OtherPointScalars", numPts, 100.0));
+  image->GetCellData()->SetScalars(MakeArray("CellScalars", numCells, 0.0));
+
+  vtkNew<vtkGeometryFilter> filter;
+  filter->SetInputData(image);
+  filter->CacheMeshOn();
+  filter->PassThroughPointIdsOn();
+  filter->PassThroughCellIdsOn();
+  filter->Update();
+  vtkPolyData* output = filter->GetOutput();
+  // Hold on to the points so that new points cannot get the same address.
+  vtkSmartPointer<vtkPoints> points = output->GetPoints();
+  const vtkIdType numOutputCells = output->GetNumberOfCells();
+
+  int retVal = EXIT_SUCCESS;
+
+  // Change values of an input array in place.
+  auto pointScalars = vtkDoubleArray::SafeDownCast(image->GetPointData()->GetScalars());
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    pointScalars->SetValue(i, -1.0 * i);
+  }
+  pointScalars->Modified();
+  filter->Update();
+  if (output->GetPoints() != points || output->GetNumberOfCells() != numOutputCells)
+  {
+    std::cerr << "The mesh was extracted again after an array modification" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+  if (!CheckAttributes(image->GetPointData(), output->GetPointData(), "PointScalars",
+        filter->GetOriginalPointIdsName()) ||
+    !CheckAttributes(image->GetCellData(), output->GetCellData(), "CellScalars",
+      filter->GetOriginalCellIdsName()))
+  {
+    retVal = EXIT_FAILURE;
+  }
+
+  // Change the active scalars of the input.
+  image->GetPointData()->SetActiveScalars("OtherPointScalars");
+  filter->Update();
+  if (output->GetPoints() != points)
+  {
+    std::cerr << "The mesh was extracted again after an active scalars change" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+  if (!output->GetPointData()->GetScalars() ||
+    strcmp(output->GetPointData()->GetScalars()->GetName(), "OtherPointScalars") != 0)
+  {
+    std::cerr << "The active scalars were not passed to the output" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  // Change the input mesh.
+  image->SetSpacing(2.0, 2.0, 2.0);
+  filter->Update();
+  if (output->GetPoints() == points || output->GetBounds()[1] != 10.0)
+  {
+    std::cerr << "The mesh was not extracted again after a mesh modification" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  // Without the cache, the mesh is always extracted again.
+  filter->CacheMeshOff();
+  filter->Update();
+  points = output->GetPoints();
+  image->GetPointData()->SetActiveScalars("PointScalars");
+  filter->Update();
+  if (output->GetPoints() == points)
+  {
+    std::cerr << "The mesh was reused with CacheMesh off" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  return retVal;
+}
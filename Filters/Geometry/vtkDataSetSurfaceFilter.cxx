@@ -40,6 +40,8 @@
 #include "vtkPyramid.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridGeometryFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredData.h"
@@ -57,10 +59,12 @@
 #include "vtkWedge.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <numeric>
 #include <unordered_map>
+#include <vector>
 
 namespace
 {
@@ -294,6 +298,474 @@ bool StructuredExecuteWithBlanking(
   return true;
 }
 
+// Faces of a cell as they are inserted in the quad hash by
+// UnstructuredGridExecuteInternal. Each face is reordered like
+// Insert{Tri,Quad,Polygon}InHash reorder it, so its first point is the bin
+// of the face in the quad hash.
+enum FaceKind : unsigned char
+{
+  TRI_FACE,
+  QUAD_FACE,
+  POLYGON_FACE
+};
+
+class HashedFaceList
+{
+public:
+  void Reset()
+  {
+    this->Ids.clear();
+    this->Offsets.assign(1, 0);
+    this->Kinds.clear();
+  }
+
+  vtkIdType GetNumberOfFaces() const { return static_cast<vtkIdType>(this->Kinds.size()); }
+  FaceKind GetKind(vtkIdType face) const { return this->Kinds[face]; }
+  int GetNumberOfPoints(vtkIdType face) const
+  {
+    return static_cast<int>(this->Offsets[face + 1] - this->Offsets[face]);
+  }
+  const vtkIdType* GetPoints(vtkIdType face) const
+  {
+    return this->Ids.data() + this->Offsets[face];
+  }
+
+  void AddTri(vtkIdType a, vtkIdType b, vtkIdType c)
+  {
+    vtkIdType tmp;
+    if (b < a && b < c)
+    {
+      tmp = a;
+      a = b;
+      b = c;
+      c = tmp;
+    }
+    else if (c < a && c < b)
+    {
+      tmp = a;
+      a = c;
+      c = b;
+      b = tmp;
+    }
+    const vtkIdType ids[3] = { a, b, c };
+    this->Add(TRI_FACE, ids, 3);
+  }
+
+  void AddQuad(vtkIdType a, vtkIdType b, vtkIdType c, vtkIdType d)
+  {
+    vtkIdType tmp;
+    if (b < a && b < c && b < d)
+    {
+      tmp = a;
+      a = b;
+      b = c;
+      c = d;
+      d = tmp;
+    }
+    else if (c < a && c < b && c < d)
+    {
+      tmp = a;
+      a = c;
+      c = tmp;
+      tmp = b;
+      b = d;
+      d = tmp;
+    }
+    else if (d < a && d < b && d < c)
+    {
+      tmp = a;
+      a = d;
+      d = c;
+      c = b;
+      b = tmp;
+    }
+    const vtkIdType ids[4] = { a, b, c, d };
+    this->Add(QUAD_FACE, ids, 4);
+  }
+
+  void AddPolygon(const vtkIdType* ids, int numPts)
+  {
+    if (numPts == 0)
+    {
+      return;
+    }
+    int offset = 0;
+    for (int i = 0; i < numPts; i++)
+    {
+      if (ids[i] < ids[offset])
+      {
+        offset = i;
+      }
+    }
+    for (int i = 0; i < numPts; i++)
+    {
+      this->Ids.push_back(ids[(offset + i) % numPts]);
+    }
+    this->Offsets.push_back(static_cast<vtkIdType>(this->Ids.size()));
+    this->Kinds.push_back(POLYGON_FACE);
+  }
+
+  // Whether a face of kind `kind` inserted in the quad hash matches the
+  // entry `q` of the same bin, using the test of the corresponding
+  // Insert*InHash method.
+  static bool Match(FaceKind kind, const vtkIdType* pts, int numPts, const vtkIdType* q, int qNumPts)
+  {
+    switch (kind)
+    {
+      case TRI_FACE:
+        return qNumPts == 3 &&
+          ((pts[1] == q[1] && pts[2] == q[2]) || (pts[1] == q[2] && pts[2] == q[1]));
+      case QUAD_FACE:
+        return qNumPts == 4 && pts[2] == q[2] &&
+          ((pts[1] == q[1] && pts[3] == q[3]) || (pts[1] == q[3] && pts[3] == q[1]));
+      default:
+        if (numPts != qNumPts || pts[0] != q[0])
+        {
+          return false;
+        }
+        if (numPts > 1 && pts[1] == q[1])
+        {
+          return std::equal(pts + 2, pts + numPts, q + 2);
+        }
+        for (int i = 1; i < numPts; ++i)
+        {
+          if (pts[numPts - i] != q[i])
+          {
+            return false;
+          }
+        }
+        return true;
+    }
+  }
+
+private:
+  void Add(FaceKind kind, const vtkIdType* ids, int numPts)
+  {
+    this->Ids.insert(this->Ids.end(), ids, ids + numPts);
+    this->Offsets.push_back(static_cast<vtkIdType>(this->Ids.size()));
+    this->Kinds.push_back(kind);
+  }
+
+  std::vector<vtkIdType> Ids;
+  std::vector<vtkIdType> Offsets{ 0 };
+  std::vector<FaceKind> Kinds;
+};
+
+// Fill `faces` with the faces of a linear 3D cell, in the order in which
+// UnstructuredGridExecuteInternal inserts them in the quad hash.
+void GetHashedFaces(vtkUnstructuredGrid* input, vtkIdType cellId, vtkGenericCell* cell,
+  vtkIdList* pointIdList, HashedFaceList& faces)
+{
+  faces.Reset();
+  vtkIdType numCellPts;
+  const vtkIdType* ids;
+  switch (input->GetCellType(cellId))
+  {
+    case VTK_HEXAHEDRON:
+      input->GetCellPoints(cellId, numCellPts, ids, pointIdList);
+      faces.AddQuad(ids[0], ids[1], ids[5], ids[4]);
+      faces.AddQuad(ids[0], ids[3], ids[2], ids[1]);
+      faces.AddQuad(ids[0], ids[4], ids[7], ids[3]);
+      faces.AddQuad(ids[1], ids[2], ids[6], ids[5]);
+      faces.AddQuad(ids[2], ids[3], ids[7], ids[6]);
+      faces.AddQuad(ids[4], ids[5], ids[6], ids[7]);
+      break;
+
+    case VTK_VOXEL:
+      input->GetCellPoints(cellId, numCellPts, ids, pointIdList);
+      faces.AddQuad(ids[0], ids[1], ids[5], ids[4]);
+      faces.AddQuad(ids[0], ids[2], ids[3], ids[1]);
+      faces.AddQuad(ids[0], ids[4], ids[6], ids[2]);
+      faces.AddQuad(ids[1], ids[3], ids[7], ids[5]);
+      faces.AddQuad(ids[2], ids[6], ids[7], ids[3]);
+      faces.AddQuad(ids[4], ids[5], ids[7], ids[6]);
+      break;
+
+    case VTK_TETRA:
+      input->GetCellPoints(cellId, numCellPts, ids, pointIdList);
+      faces.AddTri(ids[0], ids[1], ids[3]);
+      faces.AddTri(ids[0], ids[2], ids[1]);
+      faces.AddTri(ids[0], ids[3], ids[2]);
+      faces.AddTri(ids[1], ids[2], ids[3]);
+      break;
+
+    case VTK_PENTAGONAL_PRISM:
+      input->GetCellPoints(cellId, numCellPts, ids, pointIdList);
+      faces.AddQuad(ids[0], ids[1], ids[6], ids[5]);
+      faces.AddQuad(ids[1], ids[2], ids[7], ids[6]);
+      faces.AddQuad(ids[2], ids[3], ids[8], ids[7]);
+      faces.AddQuad(ids[3], ids[4], ids[9], ids[8]);
+      faces.AddQuad(ids[4], ids[0], ids[5], ids[9]);
+      faces.AddPolygon(ids, 5);
+      faces.AddPolygon(&ids[5], 5);
+      break;
+
+    case VTK_HEXAGONAL_PRISM:
+      input->GetCellPoints(cellId, numCellPts, ids, pointIdList);
+      faces.AddQuad(ids[0], ids[1], ids[7], ids[6]);
+      faces.AddQuad(ids[1], ids[2], ids[8], ids[7]);
+      faces.AddQuad(ids[2], ids[3], ids[9], ids[8]);
+      faces.AddQuad(ids[3], ids[4], ids[10], ids[9]);
+      faces.AddQuad(ids[4], ids[5], ids[11], ids[10]);
+      faces.AddQuad(ids[5], ids[0], ids[6], ids[11]);
+      faces.AddPolygon(ids, 6);
+      faces.AddPolygon(&ids[6], 6);
+      break;
+
+    case VTK_PYRAMID:
+      input->GetCellPoints(cellId, numCellPts, ids, pointIdList);
+      faces.AddQuad(ids[3], ids[2], ids[1], ids[0]);
+      faces.AddTri(ids[0], ids[1], ids[4]);
+      faces.AddTri(ids[1], ids[2], ids[4]);
+      faces.AddTri(ids[2], ids[3], ids[4]);
+      faces.AddTri(ids[3], ids[0], ids[4]);
+      break;
+
+    case VTK_WEDGE:
+      input->GetCellPoints(cellId, numCellPts, ids, pointIdList);
+      faces.AddQuad(ids[0], ids[2], ids[5], ids[3]);
+      faces.AddQuad(ids[1], ids[0], ids[3], ids[4]);
+      faces.AddQuad(ids[2], ids[1], ids[4], ids[5]);
+      faces.AddTri(ids[0], ids[1], ids[2]);
+      faces.AddTri(ids[3], ids[5], ids[4]);
+      break;
+
+    default:
+    {
+      input->GetCell(cellId, cell);
+      if (cell->GetCellDimension() != 3)
+      {
+        break;
+      }
+      const int numFaces = cell->GetNumberOfFaces();
+      for (int j = 0; j < numFaces; j++)
+      {
+        vtkCell* face = cell->GetFace(j);
+        vtkIdList* facePts = face->PointIds;
+        switch (face->GetNumberOfPoints())
+        {
+          case 4:
+            faces.AddQuad(facePts->GetId(0), facePts->GetId(1), facePts->GetId(2),
+              facePts->GetId(3));
+            break;
+          case 3:
+            faces.AddTri(facePts->GetId(0), facePts->GetId(1), facePts->GetId(2));
+            break;
+          default:
+            faces.AddPolygon(facePts->GetPointer(0), facePts->GetNumberOfIds());
+            break;
+        }
+      }
+    }
+  }
+}
+
+bool AllCellsLinear(vtkUnstructuredGrid* input)
+{
+  vtkUnsignedCharArray* types = input->GetDistinctCellTypesArray();
+  for (vtkIdType i = 0; types && i < types->GetNumberOfValues(); ++i)
+  {
+    if (!vtkCellTypes::IsLinear(types->GetValue(i)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Threaded replacement of the quad hash for the faces of the linear 3D cells
+ * of an unstructured grid. The faces are grouped in the bins of the quad
+ * hash (the first point of the reordered face) with a counting sort, and
+ * sorted in each bin by cell and by order of insertion in the cell. Each bin
+ * then replays the insertions of the quad hash, in parallel with the other
+ * bins since faces of different bins never match. Traversing the visible
+ * faces bin after bin gives the faces of the quad hash traversal, in the
+ * same order.
+ */
+class ThreadedFaceHash
+{
+public:
+  struct Face
+  {
+    vtkIdType CellId;
+    vtkIdType FaceId;
+    bool operator<(const Face& other) const
+    {
+      return this->CellId < other.CellId ||
+        (this->CellId == other.CellId && this->FaceId < other.FaceId);
+    }
+  };
+
+  void Build(vtkUnstructuredGrid* input, vtkUnsignedCharArray* ghostCells);
+
+  vtkIdType GetNumberOfBins() const { return static_cast<vtkIdType>(this->BinOffsets.size()) - 1; }
+  vtkIdType GetBinBegin(vtkIdType bin) const { return this->BinOffsets[bin]; }
+  vtkIdType GetBinEnd(vtkIdType bin) const { return this->BinOffsets[bin + 1]; }
+  const Face& GetFace(vtkIdType face) const { return this->Faces[face]; }
+  bool IsVisible(vtkIdType face) const { return this->Visible[face] != 0; }
+
+private:
+  struct LocalData
+  {
+    vtkSmartPointer<vtkGenericCell> Cell;
+    vtkSmartPointer<vtkIdList> PointIds;
+    HashedFaceList Faces;
+    std::vector<vtkIdType> Entries;
+    std::vector<vtkIdType> EntryIds;
+    std::vector<vtkIdType> EntryOffsets;
+  };
+
+  // Calls `f(cellId, faces)` for the visible 3D cells in [begin, end)
+  template <typename Functor>
+  void ForEachCell(vtkIdType begin, vtkIdType end, Functor&& f)
+  {
+    LocalData& local = this->Local.Local();
+    if (!local.Cell)
+    {
+      local.Cell = vtkSmartPointer<vtkGenericCell>::New();
+      local.PointIds = vtkSmartPointer<vtkIdList>::New();
+    }
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      if (vtkCellTypes::GetDimension(this->Input->GetCellType(cellId)) != 3 ||
+        (this->GhostCells &&
+          (this->GhostCells[cellId] & vtkDataSetAttributes::CellGhostTypes::HIDDENCELL)))
+      {
+        continue;
+      }
+      GetHashedFaces(this->Input, cellId, local.Cell, local.PointIds, local.Faces);
+      f(cellId, local.Faces);
+    }
+  }
+
+  void ReplayBin(vtkIdType bin, LocalData& local);
+
+  vtkUnstructuredGrid* Input = nullptr;
+  const unsigned char* GhostCells = nullptr;
+  vtkSMPThreadLocal<LocalData> Local;
+  std::vector<vtkIdType> BinOffsets;
+  std::vector<Face> Faces;
+  std::vector<unsigned char> Visible;
+};
+
+void ThreadedFaceHash::Build(vtkUnstructuredGrid* input, vtkUnsignedCharArray* ghostCells)
+{
+  this->Input = input;
+  this->GhostCells = ghostCells ? ghostCells->GetPointer(0) : nullptr;
+  const vtkIdType numCells = input->GetNumberOfCells();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+
+  // Count the faces of each bin
+  std::unique_ptr<std::atomic<vtkIdType>[]> binCounts(new std::atomic<vtkIdType>[numPts]);
+  vtkSMPTools::Fill(binCounts.get(), binCounts.get() + numPts, 0);
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      this->ForEachCell(begin, end,
+        [&](vtkIdType, const HashedFaceList& faces)
+        {
+          for (vtkIdType face = 0; face < faces.GetNumberOfFaces(); ++face)
+          {
+            binCounts[faces.GetPoints(face)[0]].fetch_add(1, std::memory_order_relaxed);
+          }
+        });
+    });
+
+  this->BinOffsets.resize(numPts + 1);
+  vtkSMPTools::Transform(binCounts.get(), binCounts.get() + numPts, this->BinOffsets.begin(),
+    [](const std::atomic<vtkIdType>& count) { return count.load(std::memory_order_relaxed); });
+  this->BinOffsets[numPts] = 0;
+  vtkSMPTools::ExclusiveScan(this->BinOffsets.begin(), this->BinOffsets.end(),
+    this->BinOffsets.begin(), vtkIdType(0));
+
+  // Fill the bins, reusing the counts as insertion positions
+  vtkSMPTools::Transform(this->BinOffsets.begin(), this->BinOffsets.end() - 1, binCounts.get(),
+    [](vtkIdType offset) { return offset; });
+  this->Faces.resize(this->BinOffsets[numPts]);
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      this->ForEachCell(begin, end,
+        [&](vtkIdType cellId, const HashedFaceList& faces)
+        {
+          for (vtkIdType face = 0; face < faces.GetNumberOfFaces(); ++face)
+          {
+            const vtkIdType position =
+              binCounts[faces.GetPoints(face)[0]].fetch_add(1, std::memory_order_relaxed);
+            this->Faces[position] = Face{ cellId, face };
+          }
+        });
+    });
+  binCounts.reset();
+
+  // Replay the quad hash insertions in each bin
+  this->Visible.assign(this->Faces.size(), 0);
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      LocalData& local = this->Local.Local();
+      if (!local.Cell)
+      {
+        local.Cell = vtkSmartPointer<vtkGenericCell>::New();
+        local.PointIds = vtkSmartPointer<vtkIdList>::New();
+      }
+      for (vtkIdType bin = begin; bin < end; ++bin)
+      {
+        this->ReplayBin(bin, local);
+      }
+    });
+}
+
+void ThreadedFaceHash::ReplayBin(vtkIdType bin, LocalData& local)
+{
+  const vtkIdType begin = this->BinOffsets[bin];
+  const vtkIdType end = this->BinOffsets[bin + 1];
+  if (begin == end)
+  {
+    return;
+  }
+  std::sort(this->Faces.begin() + begin, this->Faces.begin() + end);
+
+  // The entries of the bin, with a copy of their points
+  local.Entries.clear();
+  local.EntryIds.clear();
+  local.EntryOffsets.assign(1, 0);
+  vtkIdType currentCellId = -1;
+  for (vtkIdType i = begin; i < end; ++i)
+  {
+    const Face& face = this->Faces[i];
+    if (face.CellId != currentCellId)
+    {
+      GetHashedFaces(this->Input, face.CellId, local.Cell, local.PointIds, local.Faces);
+      currentCellId = face.CellId;
+    }
+    const FaceKind kind = local.Faces.GetKind(face.FaceId);
+    const int numPts = local.Faces.GetNumberOfPoints(face.FaceId);
+    const vtkIdType* pts = local.Faces.GetPoints(face.FaceId);
+    bool matched = false;
+    for (std::size_t entry = 0; entry < local.Entries.size(); ++entry)
+    {
+      const vtkIdType* entryPts = local.EntryIds.data() + local.EntryOffsets[entry];
+      const int entryNumPts =
+        static_cast<int>(local.EntryOffsets[entry + 1] - local.EntryOffsets[entry]);
+      if (HashedFaceList::Match(kind, pts, numPts, entryPts, entryNumPts))
+      {
+        // hide the first matching entry, like the quad hash
+        this->Visible[local.Entries[entry]] = 0;
+        matched = true;
+        break;
+      }
+    }
+    if (!matched)
+    {
+      local.Entries.push_back(i);
+      local.EntryIds.insert(local.EntryIds.end(), pts, pts + numPts);
+      local.EntryOffsets.push_back(static_cast<vtkIdType>(local.EntryIds.size()));
+      this->Visible[i] = 1;
+    }
+  }
+}
 }
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -364,6 +836,7 @@ vtkDataSetSurfaceFilter::vtkDataSetSurfaceFilter()
   this->NonlinearSubdivisionLevel = 1;
 
   this->Delegation = false;
+  this->ThreadedFaceHashing = false;
 }
 
 //------------------------------------------------------------------------------
@@ -1297,6 +1770,7 @@ void vtkDataSetSurfaceFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "NonlinearSubdivisionLevel: " << this->GetNonlinearSubdivisionLevel() << endl;
   os << indent << "FastMode: " << this->GetFastMode() << endl;
   os << indent << "Delegation: " << this->GetDelegation() << endl;
+  os << indent << "ThreadedFaceHashing: " << this->GetThreadedFaceHashing() << endl;
 }
 
 //========================================================================
@@ -1485,6 +1959,15 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecuteInternal(
   this->NumberOfNewCells = 0;
   this->InitializeQuadHash(numPts);
 
+  // The faces of linear 3D cells may be hashed in parallel instead of being
+  // inserted in the quad hash, see ThreadedFaceHash.
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input);
+  std::unique_ptr<ThreadedFaceHash> faceHash;
+  if (this->ThreadedFaceHashing && grid && AllCellsLinear(grid))
+  {
+    faceHash.reset(new ThreadedFaceHash);
+  }
+
   // Allocate
   //
   newPts = vtkPoints::New();
@@ -1568,6 +2051,10 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecuteInternal(
     progressCount++;
 
     cellType = input->GetCellType(cellId);
+    if (faceHash && vtkCellTypes::GetDimension(cellType) == 3)
+    {
+      continue;
+    }
 
     switch (cellType)
     {
@@ -2133,6 +2620,54 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecuteInternal(
   } // for all cells.
 
   // Now transfer geometry from hash to output (only triangles and quads).
+  if (faceHash && !abort)
+  {
+    faceHash->Build(grid, ghostCells);
+    HashedFaceList faces;
+    std::vector<vtkIdType> faceIds;
+    vtkFastGeomQuad quad;
+    quad.Next = nullptr;
+    vtkIdType currentCellId = -1;
+    for (vtkIdType bin = 0; bin < faceHash->GetNumberOfBins(); ++bin)
+    {
+      for (vtkIdType face = faceHash->GetBinBegin(bin); face < faceHash->GetBinEnd(bin); ++face)
+      {
+        if (!faceHash->IsVisible(face))
+        {
+          continue;
+        }
+        const ThreadedFaceHash::Face& hashedFace = faceHash->GetFace(face);
+        if (hashedFace.CellId != currentCellId)
+        {
+          GetHashedFaces(grid, hashedFace.CellId, cell, pointIdList, faces);
+          currentCellId = hashedFace.CellId;
+        }
+        const vtkIdType* facePts = faces.GetPoints(hashedFace.FaceId);
+        quad.numPts = faces.GetNumberOfPoints(hashedFace.FaceId);
+        quad.SourceId = hashedFace.CellId;
+        faceIds.resize(quad.numPts);
+        quad.ptArray = faceIds.data();
+
+        // Same as the quad hash traversal below
+        bool oneHidden = false;
+        for (i = 0; i < quad.numPts; i++)
+        {
+          if (ghosts && (ghosts->GetValue(facePts[i]) & vtkDataSetAttributes::HIDDENPOINT))
+          {
+            oneHidden = true;
+          }
+          quad.ptArray[i] = this->GetOutputPointId(facePts[i], input, newPts, outputPD);
+        }
+        if (oneHidden)
+        {
+          continue;
+        }
+        newPolys->InsertNextCell(quad.numPts, quad.ptArray);
+        this->RecordOrigCellId(this->NumberOfNewCells, &quad);
+        outputCD->CopyData(inputCD, quad.SourceId, this->NumberOfNewCells++);
+      }
+    }
+  }
   this->InitQuadHashTraversal();
   while ((q = this->GetNextVisibleQuadFromHash()))
   {
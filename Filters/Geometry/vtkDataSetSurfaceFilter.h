@@ -208,6 +208,19 @@ public:
   vtkBooleanMacro(Delegation, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off threaded hashing of the faces of unstructured grids. When on,
+   * and all the cells of the unstructured grid are linear, the faces of the
+   * 3D cells are matched in parallel with vtkSMPTools instead of being
+   * inserted one at a time in the face hash. The output, including the order
+   * of its points and cells, is the same. By default this is off.
+   */
+  vtkSetMacro(ThreadedFaceHashing, bool);
+  vtkGetMacro(ThreadedFaceHashing, bool);
+  vtkBooleanMacro(ThreadedFaceHashing, bool);
+  ///@}
+
   ///@{
   /**
    * Direct access methods so that this class can be used as an
@@ -356,6 +369,7 @@ protected:
   int NonlinearSubdivisionLevel;
   vtkTypeBool Delegation;
   bool FastMode;
+  bool ThreadedFaceHashing;
 
 private:
   int UnstructuredGridBaseExecute(vtkDataSet* input, vtkPolyData* output);
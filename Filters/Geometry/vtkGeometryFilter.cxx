@@ -22,11 +22,14 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellTypes.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSetSurfaceFilter.h"
 #include "vtkGenericCell.h"
 #include "vtkHexagonalPrism.h"
 #include "vtkHexahedron.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -39,6 +42,7 @@
 #include "vtkPyramid.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStaticCellLinksTemplate.h"
 #include "vtkStaticFaceHashMapTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -49,6 +53,7 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkVoxel.h"
+#include "vtkWeakPointer.h"
 #include "vtkWedge.h"
 
 #include <cstring>
@@ -67,6 +72,71 @@ static constexpr unsigned char MASKED_CELL_VALUE_NOT_VISIBLE =
 
 static constexpr unsigned char MASKED_POINT_VALUE = vtkDataSetAttributes::HIDDENPOINT;
 
+//------------------------------------------------------------------------------
+// The output mesh of the last execution, and what it was extracted from.
+struct vtkGeometryFilter::vtkMeshCache
+{
+  vtkNew<vtkPolyData> Mesh;
+  // Originating ids of the output points, nullptr if the output points are
+  // the input points.
+  vtkSmartPointer<vtkIdList> PointIds;
+  vtkNew<vtkIdList> CellIds;
+
+  vtkWeakPointer<vtkDataSet> Input;
+  vtkWeakPointer<vtkPolyData> ExcludedFaces;
+  vtkWeakPointer<vtkUnsignedCharArray> PointGhosts;
+  vtkWeakPointer<vtkUnsignedCharArray> CellGhosts;
+  vtkMTimeType InputMeshTime = 0;
+  vtkIdType NumberOfInputPoints = 0;
+  vtkIdType NumberOfInputCells = 0;
+  vtkTimeStamp BuildTime;
+  bool Valid = false;
+
+  void Release()
+  {
+    this->Valid = false;
+    this->Mesh->Initialize();
+    this->PointIds = nullptr;
+    this->CellIds->Initialize();
+  }
+};
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Copy the ids of an array of originating ids, failing on ids of generated
+// points or cells.
+bool CopyOriginatingIds(vtkIdTypeArray* ids, vtkIdType numIds, vtkIdList* list)
+{
+  if (!ids || ids->GetNumberOfComponents() != 1 || ids->GetNumberOfTuples() != numIds)
+  {
+    return false;
+  }
+  list->SetNumberOfIds(numIds);
+  vtkIdType* listIds = list->GetPointer(0);
+  for (vtkIdType i = 0; i < numIds; ++i)
+  {
+    listIds[i] = ids->GetValue(i);
+    if (listIds[i] < 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void AddOriginatingIds(const char* name, vtkIdList* list, vtkDataSetAttributes* outData)
+{
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName(name);
+  ids->SetNumberOfComponents(1);
+  ids->SetNumberOfTuples(list->GetNumberOfIds());
+  std::copy(list->begin(), list->end(), ids->GetPointer(0));
+  outData->AddArray(ids);
+}
+}
+
 //------------------------------------------------------------------------------
 // Construct with all types of clipping turned off.
 vtkGeometryFilter::vtkGeometryFilter()
@@ -102,6 +172,9 @@ vtkGeometryFilter::vtkGeometryFilter()
   this->OriginalCellIdsName = nullptr;
   this->OriginalPointIdsName = nullptr;
 
+  this->CacheMesh = false;
+  this->MeshCache = new vtkMeshCache;
+
   // optional 2nd input
   this->SetNumberOfInputPorts(2);
 
@@ -110,6 +183,10 @@ vtkGeometryFilter::vtkGeometryFilter()
 
   // Enable delegation to an internal vtkDataSetSurfaceFilter.
   this->Delegation = true;
+
+  // Apart from the mesh cache, which is left alone when blocks are processed
+  // concurrently, RequestData() only uses its arguments.
+  this->GetInformation()->Set(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION(), 1);
 }
 
 //------------------------------------------------------------------------------
@@ -118,6 +195,7 @@ vtkGeometryFilter::~vtkGeometryFilter()
   this->SetLocator(nullptr);
   this->SetOriginalCellIdsName(nullptr);
   this->SetOriginalPointIdsName(nullptr);
+  delete this->MeshCache;
 }
 
 //------------------------------------------------------------------------------
@@ -227,25 +305,175 @@ int vtkGeometryFilter::RequestData(vtkInformation* vtkNotUsed(request),
     std::copy(wholeExt32, wholeExt32 + 6, wholeExtent);
   }
 
+  // When only the attributes of the input changed since the last execution,
+  // map them onto the cached mesh instead of extracting it again. The cache
+  // holds a single mesh and is not used when blocks of a composite input are
+  // processed concurrently.
+  const bool useCache = !vtkSMPTools::IsParallelScope();
+  if (useCache && !this->CacheMesh)
+  {
+    this->MeshCache->Release();
+  }
+  else if (useCache && this->ReuseMeshCache(input, excFaces, output))
+  {
+    return 1;
+  }
+
+  // The cache needs the originating point and cell ids, generate them even
+  // if they are not requested unless the input has arrays of the same name.
+  const vtkTypeBool passThroughPointIds = this->PassThroughPointIds;
+  const vtkTypeBool passThroughCellIds = this->PassThroughCellIds;
+  const bool updateCache = useCache && this->CacheMesh &&
+    (passThroughPointIds || !input->GetPointData()->HasArray(this->GetOriginalPointIdsName())) &&
+    (passThroughCellIds || !input->GetCellData()->HasArray(this->GetOriginalCellIdsName()));
+  if (updateCache)
+  {
+    this->PassThroughPointIds = 1;
+    this->PassThroughCellIds = 1;
+  }
+
   // Prepare to delegate based on dataset type and characteristics.
+  int ret;
   if (vtkPolyData::SafeDownCast(input))
   {
-    return this->PolyDataExecute(input, output, excFaces);
+    ret = this->PolyDataExecute(input, output, excFaces);
   }
   else if (vtkUnstructuredGridBase::SafeDownCast(input))
   {
-    return this->UnstructuredGridExecute(input, output, nullptr, excFaces);
+    ret = this->UnstructuredGridExecute(input, output, nullptr, excFaces);
   }
   else if (vtkImageData::SafeDownCast(input) || vtkRectilinearGrid::SafeDownCast(input) ||
     vtkStructuredGrid::SafeDownCast(input))
   {
-    return this->StructuredExecute(input, output, wholeExtent, excFaces);
+    ret = this->StructuredExecute(input, output, wholeExtent, excFaces);
   }
   else
   {
     // Use the general case
-    return this->DataSetExecute(input, output, excFaces);
+    ret = this->DataSetExecute(input, output, excFaces);
+  }
+
+  if (updateCache)
+  {
+    this->PassThroughPointIds = passThroughPointIds;
+    this->PassThroughCellIds = passThroughCellIds;
+    if (ret)
+    {
+      this->UpdateMeshCache(
+        input, excFaces, output, passThroughPointIds != 0, passThroughCellIds != 0);
+    }
+  }
+  if (useCache && !(updateCache && ret))
+  {
+    this->MeshCache->Release();
+  }
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+bool vtkGeometryFilter::ReuseMeshCache(vtkDataSet* input, vtkPolyData* exc, vtkPolyData* output)
+{
+  vtkMeshCache* cache = this->MeshCache;
+  vtkPointData* inPD = input->GetPointData();
+  vtkCellData* inCD = input->GetCellData();
+
+  // The ghost arrays and the excluded faces select the output cells, they
+  // count as part of the mesh.
+  auto unchanged = [cache](vtkObject* current, vtkObject* cached) {
+    return current == cached && (!current || current->GetMTime() < cache->BuildTime);
+  };
+  if (!cache->Valid || cache->Input.Get() != input ||
+    cache->InputMeshTime != input->GetMeshMTime() ||
+    cache->NumberOfInputPoints != input->GetNumberOfPoints() ||
+    cache->NumberOfInputCells != input->GetNumberOfCells() ||
+    this->GetMTime() > cache->BuildTime || !unchanged(exc, cache->ExcludedFaces.Get()) ||
+    !unchanged(inPD->GetGhostArray(), cache->PointGhosts.Get()) ||
+    !unchanged(inCD->GetGhostArray(), cache->CellGhosts.Get()))
+  {
+    return false;
+  }
+
+  vtkDebugMacro(<< "Input mesh unchanged, mapping the attributes onto the cached mesh");
+  output->CopyStructure(cache->Mesh);
+
+  vtkPointData* outPD = output->GetPointData();
+  if (cache->PointIds)
+  {
+    outPD->CopyAllocate(inPD, cache->PointIds->GetNumberOfIds());
+    outPD->CopyData(inPD, cache->PointIds);
+    if (this->PassThroughPointIds)
+    {
+      AddOriginatingIds(this->GetOriginalPointIdsName(), cache->PointIds, outPD);
+    }
+  }
+  else
+  {
+    outPD->PassData(inPD);
+  }
+
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(inCD, cache->CellIds->GetNumberOfIds());
+  outCD->CopyData(inCD, cache->CellIds);
+  if (this->PassThroughCellIds)
+  {
+    AddOriginatingIds(this->GetOriginalCellIdsName(), cache->CellIds, outCD);
   }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkGeometryFilter::UpdateMeshCache(
+  vtkDataSet* input, vtkPolyData* exc, vtkPolyData* output, bool keepPointIds, bool keepCellIds)
+{
+  vtkMeshCache* cache = this->MeshCache;
+  cache->Release();
+
+  vtkPointData* outPD = output->GetPointData();
+  vtkCellData* outCD = output->GetCellData();
+  const char* pointIdsName = this->GetOriginalPointIdsName();
+  const char* cellIdsName = this->GetOriginalCellIdsName();
+  vtkIdTypeArray* pointIds = vtkIdTypeArray::SafeDownCast(outPD->GetArray(pointIdsName));
+  vtkIdTypeArray* cellIds = vtkIdTypeArray::SafeDownCast(outCD->GetArray(cellIdsName));
+
+  // Without merging the output points may be the input points, in which case
+  // no point ids are generated. Points generated by the subdivision of
+  // nonlinear cells have no originating id, such outputs are not cached.
+  bool valid = CopyOriginatingIds(cellIds, output->GetNumberOfCells(), cache->CellIds);
+  if (pointIds)
+  {
+    cache->PointIds = vtkSmartPointer<vtkIdList>::New();
+    valid &= CopyOriginatingIds(pointIds, output->GetNumberOfPoints(), cache->PointIds);
+  }
+  else
+  {
+    valid &= output->GetNumberOfPoints() == input->GetNumberOfPoints();
+  }
+
+  if (!keepPointIds)
+  {
+    outPD->RemoveArray(pointIdsName);
+  }
+  if (!keepCellIds)
+  {
+    outCD->RemoveArray(cellIdsName);
+  }
+
+  if (!valid)
+  {
+    cache->Release();
+    return;
+  }
+
+  cache->Mesh->CopyStructure(output);
+  cache->Input = input;
+  cache->ExcludedFaces = exc;
+  cache->PointGhosts = input->GetPointData()->GetGhostArray();
+  cache->CellGhosts = input->GetCellData()->GetGhostArray();
+  cache->InputMeshTime = input->GetMeshMTime();
+  cache->NumberOfInputPoints = input->GetNumberOfPoints();
+  cache->NumberOfInputCells = input->GetNumberOfCells();
+  cache->BuildTime.Modified();
+  cache->Valid = true;
 }
 
 //------------------------------------------------------------------------------
@@ -318,6 +546,7 @@ void vtkGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Fast Mode: " << (this->FastMode ? "On\n" : "Off\n");
   os << indent << "Remove Ghost Interfaces: " << (this->RemoveGhostInterfaces ? "On\n" : "Off\n")
      << "\n";
+  os << indent << "Cache Mesh: " << (this->CacheMesh ? "On\n" : "Off\n");
 
   os << indent << "PieceInvariant: " << this->GetPieceInvariant() << endl;
   os << indent << "PassThroughCellIds: " << (this->GetPassThroughCellIds() ? "On\n" : "Off\n");
@@ -421,6 +421,25 @@ public:
   vtkGetMacro(RemoveGhostInterfaces, bool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether the extracted surface is cached between executions.
+   * When on, the filter keeps the output mesh along with the ids of the
+   * input points and cells each output point and cell comes from. If the
+   * filter re-executes while neither its parameters, nor the input mesh (see
+   * vtkDataSet::GetMeshMTime()), nor the input ghost arrays, nor the excluded
+   * faces have changed (e.g. only the active scalars or the values of an
+   * array of the input were modified), the cached mesh is reused and only the
+   * point and cell data are mapped onto it again.
+   *
+   * Off by default, since the cache holds on to the output mesh and to one id
+   * per output point and cell.
+   */
+  vtkSetMacro(CacheMesh, bool);
+  vtkGetMacro(CacheMesh, bool);
+  vtkBooleanMacro(CacheMesh, bool);
+  ///@}
+
   ///@{
   /**
    * Direct access methods so that this class can be used as an
@@ -487,7 +506,16 @@ protected:
 
   vtkTypeBool Delegation;
 
+  bool CacheMesh;
+
 private:
+  struct vtkMeshCache;
+  vtkMeshCache* MeshCache;
+
+  bool ReuseMeshCache(vtkDataSet* input, vtkPolyData* exc, vtkPolyData* output);
+  void UpdateMeshCache(vtkDataSet* input, vtkPolyData* exc, vtkPolyData* output,
+    bool keepPointIds, bool keepCellIds);
+
   vtkGeometryFilter(const vtkGeometryFilter&) = delete;
   void operator=(const vtkGeometryFilter&) = delete;
 };
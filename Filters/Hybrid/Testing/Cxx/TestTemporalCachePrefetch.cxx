@@ -0,0 +1,133 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestTemporalCachePrefetch.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkTemporalDataSetCache prefetches the next time steps in the
+// background and keeps the size of its cache below its memory limit.
+
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTemporalDataSetCache.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// A sphere with 10 time steps that counts its executions.
+class vtkCountingSphereSource : public vtkSphereSource
+{
+public:
+  static vtkCountingSphereSource* New();
+  vtkTypeMacro(vtkCountingSphereSource, vtkSphereSource);
+
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+protected:
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    if (!this->Superclass::RequestInformation(request, inputVector, outputVector))
+    {
+      return 0;
+    }
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    double steps[10];
+    for (int i = 0; i < 10; ++i)
+    {
+      steps[i] = i;
+    }
+    double range[2] = { steps[0], steps[9] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), steps, 10);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    ++this->NumberOfExecutions;
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    int result = this->Superclass::RequestData(request, inputVector, outputVector);
+    vtkDataObject::GetData(outInfo)->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    return result;
+  }
+};
+vtkStandardNewMacro(vtkCountingSphereSource);
+
+bool Check(vtkTemporalDataSetCache* cache, vtkCountingSphereSource* source, double time,
+  int numberOfExecutions)
+{
+  cache->UpdateTimeStep(time);
+  cache->WaitForPrefetch();
+  vtkDataObject* output = cache->GetOutputDataObject(0);
+  if (output->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) != time)
+  {
+    std::cerr << "Wrong time step in the output for time " << time << std::endl;
+    return false;
+  }
+  if (source->NumberOfExecutions != numberOfExecutions)
+  {
+    std::cerr << "Expected " << numberOfExecutions << " executions of the source after time "
+              << time << ", got " << source->NumberOfExecutions << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestTemporalCachePrefetch(int, char*[])
+{
+  vtkNew<vtkCountingSphereSource> source;
+  source->SetThetaResolution(64);
+  source->SetPhiResolution(64);
+
+  vtkNew<vtkTemporalDataSetCache> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetCacheSize(10);
+  cache->SetNumberOfPrefetchedTimeSteps(2);
+
+  // time 0 is requested, 1 and 2 are prefetched
+  if (!Check(cache, source, 0.0, 3))
+  {
+    return EXIT_FAILURE;
+  }
+  // 1 is in the cache, 3 is prefetched
+  if (!Check(cache, source, 1.0, 4))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // room for a bit more than 2 time steps
+  const vtkIdType stepSize = static_cast<vtkIdType>(source->GetOutput()->GetActualMemorySize());
+  cache->SetCacheMemoryLimit(stepSize * 5 / 2);
+  for (double time = 5.0; time < 10.0; time += 1.0)
+  {
+    cache->UpdateTimeStep(time);
+    cache->WaitForPrefetch();
+    if (cache->GetCacheMemorySize() > cache->GetCacheMemoryLimit())
+    {
+      std::cerr << "The cache uses " << cache->GetCacheMemorySize() << " KiB for a limit of "
+                << cache->GetCacheMemoryLimit() << " KiB" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -17,6 +17,7 @@
 #include "vtkBitArray.h"
 #include "vtkCamera.h"
 #include "vtkCellData.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkInformation.h"
@@ -74,6 +75,9 @@ vtkAdaptiveDataSetSurfaceFilter::vtkAdaptiveDataSetSurfaceFilter()
   this->FixedLevelMax = -1;
   this->DynamicDecimateLevelMax = 0;
 
+  // RequestData() keeps its state in members, blocks must be processed one at a time.
+  this->GetInformation()->Remove(vtkCompositeDataPipeline::CONCURRENT_BLOCK_EXECUTION());
+
   // Default Locator is 0
   this->Merging = false;
 
@@ -27,16 +27,23 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkMultiThreader.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImplicitModeller);
@@ -256,8 +263,6 @@ void vtkImplicitModellerAppendExecute(vtkImplicitModeller* self, vtkDataSet* inp
   // allocate weights for the EvaluatePosition
   double* weights = new double[input->GetMaxCellSize()];
 
-  std::cout << id << std::endl;
-
   // Traverse each voxel; using CellLocator to find the closest point
   vtkGenericCell* cell = vtkGenericCell::New();
 
@@ -473,28 +478,25 @@ static VTK_THREAD_RETURN_TYPE vtkImplicitModeller_ThreadedAppend(void* arg)
 }
 
 //------------------------------------------------------------------------------
-// Templated append for VTK_CELL_MODE process mode and any type of output data
+// Templated append for VTK_CELL_MODE process mode and any type of output data.
+// The output is split into slabs along z, processed concurrently. Each slab
+// only updates its own voxels, from the cells close enough to it, in the order
+// of the cells, so that the result does not depend on the number of threads.
 template <class OT>
 void vtkImplicitModellerAppendExecute(
   vtkImplicitModeller* self, vtkDataSet* input, vtkImageData* outData, double maxDistance, OT*)
 {
-  int i, j, k, updateTime;
-  vtkIdType cellNum;
-  double adjBounds[6];
-  double pcoords[3];
-  int outExt[6];
-  double x[3], prevDistance2, distance, distance2;
-  int subId;
-  double closestPoint[3];
-  double* weights = new double[input->GetMaxCellSize()];
-  double maxDistance2;
-  double *spacing, *origin;
-
-  spacing = outData->GetSpacing();
-  origin = outData->GetOrigin();
+  const vtkIdType numCells = input->GetNumberOfCells();
+  if (numCells == 0)
+  {
+    return;
+  }
 
-  maxDistance2 = maxDistance * maxDistance;
+  double* spacing = outData->GetSpacing();
+  double* origin = outData->GetOrigin();
+  const double maxDistance2 = maxDistance * maxDistance;
   int* sampleDimensions = self->GetSampleDimensions();
+  const int maxCellSize = input->GetMaxCellSize();
 
   // so we know how to scale if desired
   double scaleFactor = 0;         // 0 used to indicate not scaling
@@ -510,79 +512,126 @@ void vtkImplicitModellerAppendExecute(
     }
   }
 
-  //
-  // Traverse all cells; computing distance function on volume points.
-  //
-  vtkCell* cell;
-  updateTime = input->GetNumberOfCells() / 50; // update every 2%
-  if (updateTime < 1)
-  {
-    updateTime = 1;
-  }
-
-  for (cellNum = 0; cellNum < input->GetNumberOfCells(); cellNum++)
+  // Compute the extent of the volume each cell affects. Getting a cell first
+  // makes GetCell() thread safe.
+  vtkNew<vtkGenericCell> firstCell;
+  input->GetCell(0, firstCell);
+  vtkSMPThreadLocalObject<vtkGenericCell> localCell;
+  std::vector<int> cellExtents(6 * numCells);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkGenericCell* cell = localCell.Local();
+    for (; cellId < endCellId; ++cellId)
+    {
+      input->GetCell(cellId, cell);
+      const double* bounds = cell->GetBounds();
+      int* outExt = &cellExtents[6 * cellId];
+      for (int i = 0; i < 3; i++)
+      {
+        outExt[i * 2] = (int)((double)(bounds[2 * i] - maxDistance - origin[i]) / spacing[i]);
+        outExt[i * 2 + 1] =
+          (int)((double)(bounds[2 * i + 1] + maxDistance - origin[i]) / spacing[i]);
+        if (outExt[i * 2] < 0)
+        {
+          outExt[i * 2] = 0;
+        }
+        if (outExt[i * 2 + 1] >= sampleDimensions[i])
+        {
+          outExt[i * 2 + 1] = sampleDimensions[i] - 1;
+        }
+      }
+    }
+  });
+
+  // Gather the cells of each slab.
+  const int numSlabs =
+    std::min(sampleDimensions[2], 4 * vtkSMPTools::GetEstimatedNumberOfThreads());
+  auto slabOf = [&](int k) {
+    return static_cast<int>(static_cast<vtkIdType>(k) * numSlabs / sampleDimensions[2]);
+  };
+  std::vector<std::vector<vtkIdType>> slabCells(numSlabs);
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
   {
-    cell = input->GetCell(cellNum);
-    const double* bounds = cell->GetBounds();
-    for (i = 0; i < 3; i++)
+    const int* outExt = &cellExtents[6 * cellId];
+    if (outExt[0] > outExt[1] || outExt[2] > outExt[3] || outExt[4] > outExt[5])
     {
-      adjBounds[2 * i] = bounds[2 * i] - maxDistance;
-      adjBounds[2 * i + 1] = bounds[2 * i + 1] + maxDistance;
+      continue;
     }
+    for (int slab = slabOf(outExt[4]); slab <= slabOf(outExt[5]); ++slab)
+    {
+      slabCells[slab].push_back(cellId);
+    }
+  }
 
-    // compute dimensional bounds in data set
-    for (i = 0; i < 3; i++)
+  //
+  // Traverse all cells of each slab; computing distance function on volume points.
+  //
+  vtkSMPThreadLocal<std::vector<double>> localWeights;
+  std::atomic<int> slabsDone(0);
+  vtkSMPTools::For(0, numSlabs, 1, [&](vtkIdType slab, vtkIdType endSlab) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkGenericCell* cell = localCell.Local();
+    std::vector<double>& weights = localWeights.Local();
+    weights.resize(maxCellSize);
+    double x[3], prevDistance2, distance, distance2;
+    double pcoords[3], closestPoint[3];
+    int subId;
+    for (; slab < endSlab; ++slab)
     {
-      outExt[i * 2] = (int)((double)(adjBounds[2 * i] - origin[i]) / spacing[i]);
-      outExt[i * 2 + 1] = (int)((double)(adjBounds[2 * i + 1] - origin[i]) / spacing[i]);
-      if (outExt[i * 2] < 0)
+      if (isFirst)
       {
-        outExt[i * 2] = 0;
+        self->UpdateProgress(static_cast<double>(slabsDone) / numSlabs);
+        self->CheckAbort();
       }
-      if (outExt[i * 2 + 1] >= sampleDimensions[i])
+      if (self->GetAbortOutput())
       {
-        outExt[i * 2 + 1] = sampleDimensions[i] - 1;
+        break;
       }
-    }
-
-    vtkImageIterator<OT> outIt(outData, outExt);
 
-    for (k = outExt[4]; k <= outExt[5]; k++)
-    {
-      x[2] = spacing[2] * k + origin[2];
-      for (j = outExt[2]; j <= outExt[3]; j++)
+      // the first z index of the slab is the smallest with slabOf(k) == slab
+      const int slabMin =
+        static_cast<int>((slab * sampleDimensions[2] + numSlabs - 1) / numSlabs);
+      const int slabMax =
+        static_cast<int>(((slab + 1) * sampleDimensions[2] + numSlabs - 1) / numSlabs) - 1;
+      for (vtkIdType cellId : slabCells[slab])
       {
-        x[1] = spacing[1] * j + origin[1];
-        OT* outSI = outIt.BeginSpan();
-        for (i = outExt[0]; i <= outExt[1]; i++)
-        {
-          x[0] = spacing[0] * i + origin[0];
+        input->GetCell(cellId, cell);
+        int outExt[6];
+        std::copy_n(&cellExtents[6 * cellId], 6, outExt);
+        outExt[4] = std::max(outExt[4], slabMin);
+        outExt[5] = std::min(outExt[5], slabMax);
 
-          ConvertToDoubleDistance(*outSI, distance, prevDistance2, toDoubleScaleFactor);
+        vtkImageIterator<OT> outIt(outData, outExt);
 
-          // union combination of distances
-          if (cell->EvaluatePosition(x, closestPoint, subId, pcoords, distance2, weights) != -1 &&
-            distance2 < prevDistance2 && distance2 <= maxDistance2)
+        for (int k = outExt[4]; k <= outExt[5]; k++)
+        {
+          x[2] = spacing[2] * k + origin[2];
+          for (int j = outExt[2]; j <= outExt[3]; j++)
           {
-            distance = sqrt(distance2);
-            SetOutputDistance(distance, outSI, capValue, scaleFactor);
+            x[1] = spacing[1] * j + origin[1];
+            OT* outSI = outIt.BeginSpan();
+            for (int i = outExt[0]; i <= outExt[1]; i++)
+            {
+              x[0] = spacing[0] * i + origin[0];
+
+              ConvertToDoubleDistance(*outSI, distance, prevDistance2, toDoubleScaleFactor);
+
+              // union combination of distances
+              if (cell->EvaluatePosition(
+                    x, closestPoint, subId, pcoords, distance2, weights.data()) != -1 &&
+                distance2 < prevDistance2 && distance2 <= maxDistance2)
+              {
+                distance = sqrt(distance2);
+                SetOutputDistance(distance, outSI, capValue, scaleFactor);
+              }
+              outSI++;
+            }
+            outIt.NextSpan();
           }
-          outSI++;
         }
-        outIt.NextSpan();
       }
+      ++slabsDone;
     }
-
-    if (cellNum % updateTime == 0)
-    {
-      self->UpdateProgress(double(cellNum + 1) / input->GetNumberOfCells());
-      if (self->CheckAbort())
-      {
-        break;
-      }
-    }
-  }
-  delete[] weights;
+  });
 }
 
 // Append a data set to the existing output. To use this function,
@@ -65,6 +65,9 @@
  * thread processes a different "slab" of the output.  Also, if the input is
  * vtkPolyData, it is appropriately clipped for each thread; that is, each
  * thread only considers the input which could affect its slab of the output.
+ * The PerCell process mode is threaded with vtkSMPTools in the same way: each
+ * slab of the output is processed concurrently, from the cells which could
+ * affect it.
  * <P>
  * This filter can now produce output of any type supported by vtkImageData.
  * However to support this change, additional sqrts must be executed during the
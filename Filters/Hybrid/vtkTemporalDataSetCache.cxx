@@ -21,9 +21,12 @@
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkThreadedCallbackQueue.h"
 
 #include <algorithm>
 #include <vector>
@@ -57,8 +60,56 @@ public:
   vtkTDSCMemkindRAII(vtkTDSCMemkindRAII const&) = default;
 };
 
+//------------------------------------------------------------------------------
+// An executive that keeps the upstream pipeline to the background thread
+// while it prefetches time steps.
+class vtkTemporalDataSetCachePipeline : public vtkCompositeDataPipeline
+{
+public:
+  static vtkTemporalDataSetCachePipeline* New();
+  vtkTypeMacro(vtkTemporalDataSetCachePipeline, vtkCompositeDataPipeline);
+
+  vtkTypeBool ProcessRequest(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override
+  {
+    vtkTemporalDataSetCache* cache = vtkTemporalDataSetCache::SafeDownCast(this->GetAlgorithm());
+    if (cache)
+    {
+      cache->WaitForPrefetch();
+    }
+    vtkTypeBool result = this->Superclass::ProcessRequest(request, inInfoVec, outInfoVec);
+    if (cache)
+    {
+      cache->StartPrefetch();
+    }
+    return result;
+  }
+
+protected:
+  vtkTemporalDataSetCachePipeline() = default;
+  ~vtkTemporalDataSetCachePipeline() override = default;
+
+private:
+  vtkTemporalDataSetCachePipeline(const vtkTemporalDataSetCachePipeline&) = delete;
+  void operator=(const vtkTemporalDataSetCachePipeline&) = delete;
+};
+vtkStandardNewMacro(vtkTemporalDataSetCachePipeline);
+
+//------------------------------------------------------------------------------
+struct vtkTemporalDataSetCache::vtkInternals
+{
+  vtkSmartPointer<vtkThreadedCallbackQueue> Queue;
+  vtkThreadedCallbackQueue::SharedFutureBasePointer Prefetch;
+
+  // planned by the last RequestData
+  std::vector<double> PrefetchTimes;
+  vtkSmartPointer<vtkInformation> PrefetchRequest;
+  vtkMTimeType PrefetchUpdateTime = 0;
+};
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkTemporalDataSetCache);
+vtkCxxSetObjectMacro(vtkTemporalDataSetCache, Controller, vtkMultiProcessController);
 
 //------------------------------------------------------------------------------
 vtkTemporalDataSetCache::vtkTemporalDataSetCache()
@@ -69,11 +120,17 @@ vtkTemporalDataSetCache::vtkTemporalDataSetCache()
   this->CacheInMemkind = false;
   this->IsASource = false;
   this->Ejected = nullptr;
+  this->NumberOfPrefetchedTimeSteps = 0;
+  this->CacheMemoryLimit = 0;
+  this->Controller = nullptr;
+  this->Internals.reset(new vtkInternals);
+  this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
 //------------------------------------------------------------------------------
 vtkTemporalDataSetCache::~vtkTemporalDataSetCache()
 {
+  this->WaitForPrefetch();
   CacheType::iterator pos = this->Cache.begin();
   for (; pos != this->Cache.end();)
   {
@@ -81,6 +138,13 @@ vtkTemporalDataSetCache::~vtkTemporalDataSetCache()
     this->Cache.erase(pos++);
   }
   this->SetEjected(nullptr);
+  this->SetController(nullptr);
+}
+
+//------------------------------------------------------------------------------
+vtkExecutive* vtkTemporalDataSetCache::CreateDefaultExecutive()
+{
+  return vtkTemporalDataSetCachePipeline::New();
 }
 
 //------------------------------------------------------------------------------
@@ -140,6 +204,9 @@ void vtkTemporalDataSetCache::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "NumberOfPrefetchedTimeSteps: " << this->NumberOfPrefetchedTimeSteps << endl;
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << endl;
+  os << indent << "Controller: " << this->Controller << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -151,6 +218,7 @@ void vtkTemporalDataSetCache::SetCacheSize(int size)
     return;
   }
 
+  this->WaitForPrefetch();
   // if growing the cache, there is no need to do anything
   this->CacheSize = size;
   if (this->Cache.size() <= static_cast<unsigned long>(size))
@@ -487,6 +555,13 @@ int vtkTemporalDataSetCache::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
+  this->EvictToMemoryLimit(upTime);
+  this->PlanPrefetch(inInfo, input, upTime);
+  // the prefetched time steps stay valid until the pipeline is modified
+  vtkDemandDrivenPipeline* ddp = vtkDemandDrivenPipeline::SafeDownCast(this->GetExecutive());
+  this->Internals->PrefetchUpdateTime =
+    ddp ? std::max(outputUpdateTime, ddp->GetPipelineMTime()) : outputUpdateTime;
+
   this->CheckAbort();
   return 1;
 }
@@ -509,7 +584,180 @@ void vtkTemporalDataSetCache::ReplaceCacheItem(
 }
 
 //------------------------------------------------------------------------------
-void vtkTemporalDataSetCache::SetEjected(vtkDataObject* victim)
+vtkIdType vtkTemporalDataSetCache::GetCacheMemorySize()
+{
+  this->WaitForPrefetch();
+  vtkIdType size = 0;
+  for (const auto& item : this->Cache)
+  {
+    size += static_cast<vtkIdType>(item.second.second->GetActualMemorySize());
+  }
+  return size;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkTemporalDataSetCache::GetGlobalValue(vtkIdType value, int operation)
+{
+  vtkIdType global = value;
+  if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+  {
+    this->Controller->AllReduce(&value, &global, 1, operation);
+  }
+  return global;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::EvictToMemoryLimit(double keep)
+{
+  if (this->CacheMemoryLimit <= 0)
+  {
+    return;
+  }
+  // the processes take the same decisions so that their caches stay the same
+  while (this->GetGlobalValue(this->GetCacheMemorySize(), vtkCommunicator::MAX_OP) >
+    this->CacheMemoryLimit)
+  {
+    CacheType::iterator oldest = this->Cache.end();
+    for (auto pos = this->Cache.begin(); pos != this->Cache.end(); ++pos)
+    {
+      if (pos->first != keep &&
+        (oldest == this->Cache.end() || pos->second.first < oldest->second.first))
+      {
+        oldest = pos;
+      }
+    }
+    if (!this->GetGlobalValue(oldest != this->Cache.end() ? 1 : 0, vtkCommunicator::MIN_OP))
+    {
+      break;
+    }
+    oldest->second.second->UnRegister(this);
+    this->Cache.erase(oldest);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::PlanPrefetch(
+  vtkInformation* inInfo, vtkDataObject* input, double time)
+{
+  typedef vtkStreamingDemandDrivenPipeline vtkSDDP;
+  vtkInternals& internals = *this->Internals;
+  internals.PrefetchTimes.clear();
+  if (this->NumberOfPrefetchedTimeSteps <= 0 || this->IsASource ||
+    !inInfo->Has(vtkSDDP::TIME_STEPS()))
+  {
+    return;
+  }
+
+  // the room left assumes the next time steps are as large as the input
+  vtkIdType room = this->CacheSize - static_cast<vtkIdType>(this->Cache.size());
+  if (this->CacheMemoryLimit > 0)
+  {
+    const vtkIdType stepSize = this->GetGlobalValue(
+      static_cast<vtkIdType>(input->GetActualMemorySize()), vtkCommunicator::MAX_OP);
+    const vtkIdType used =
+      this->GetGlobalValue(this->GetCacheMemorySize(), vtkCommunicator::MAX_OP);
+    if (stepSize > 0)
+    {
+      room = std::min(room, (this->CacheMemoryLimit - used) / stepSize);
+    }
+  }
+
+  const double* steps = inInfo->Get(vtkSDDP::TIME_STEPS());
+  const double* stepsEnd = steps + inInfo->Length(vtkSDDP::TIME_STEPS());
+  const double* next = std::upper_bound(steps, stepsEnd, time);
+  for (int i = 0; i < this->NumberOfPrefetchedTimeSteps && next != stepsEnd && room > 0;
+       ++i, ++next)
+  {
+    if (this->Cache.find(*next) == this->Cache.end())
+    {
+      internals.PrefetchTimes.push_back(*next);
+      --room;
+    }
+  }
+
+  // update the same piece as the current request
+  internals.PrefetchRequest = vtkSmartPointer<vtkInformation>::New();
+  vtkInformation* request = internals.PrefetchRequest;
+  if (inInfo->Has(vtkSDDP::UPDATE_PIECE_NUMBER()))
+  {
+    request->CopyEntry(inInfo, vtkSDDP::UPDATE_PIECE_NUMBER());
+    request->CopyEntry(inInfo, vtkSDDP::UPDATE_NUMBER_OF_PIECES());
+    request->CopyEntry(inInfo, vtkSDDP::UPDATE_NUMBER_OF_GHOST_LEVELS());
+  }
+  if (inInfo->Has(vtkSDDP::UPDATE_EXTENT()))
+  {
+    request->CopyEntry(inInfo, vtkSDDP::UPDATE_EXTENT());
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::StartPrefetch()
+{
+  vtkInternals& internals = *this->Internals;
+  if (internals.PrefetchTimes.empty())
+  {
+    return;
+  }
+  int port = 0;
+  vtkSmartPointer<vtkAlgorithm> input = this->GetInputAlgorithm(0, 0, port);
+  std::vector<double> times;
+  times.swap(internals.PrefetchTimes);
+  if (!input)
+  {
+    return;
+  }
+  if (!internals.Queue)
+  {
+    internals.Queue = vtkSmartPointer<vtkThreadedCallbackQueue>::New();
+  }
+  vtkSmartPointer<vtkInformation> request = internals.PrefetchRequest;
+  const vtkMTimeType updateTime = internals.PrefetchUpdateTime;
+  internals.Prefetch = internals.Queue->Push([this, input, port, times, request, updateTime]() {
+    this->PrefetchTimeSteps(input, port, times, request, updateTime);
+  });
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::PrefetchTimeSteps(vtkAlgorithm* input, int port,
+  const std::vector<double>& times, vtkInformation* request, vtkMTimeType updateTime)
+{
+  for (double time : times)
+  {
+    vtkNew<vtkInformation> info;
+    info->Copy(request);
+    info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), time);
+    vtkNew<vtkInformationVector> requests;
+    requests->SetInformationObject(port, info);
+    if (!input->Update(port, requests))
+    {
+      return;
+    }
+    vtkDataObject* data = input->GetOutputDataObject(port);
+    if (!data || !data->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP()))
+    {
+      return;
+    }
+    const double dataTime = data->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP());
+    if (this->Cache.find(dataTime) == this->Cache.end())
+    {
+      this->ReplaceCacheItem(data, dataTime, updateTime);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::WaitForPrefetch()
+{
+  if (this->Internals && this->Internals->Prefetch)
+  {
+    this->Internals->Prefetch->Wait();
+    this->Internals->Prefetch = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::SetEjected
+(vtkDataObject* victim)
 {
   if (this->Ejected != victim)
   {
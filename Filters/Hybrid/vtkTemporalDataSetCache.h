@@ -18,6 +18,12 @@
  *
  * vtkTemporalDataSetCache cache time step requests of a temporal dataset,
  * when cached data is requested it is returned using a shallow copy.
+ *
+ * The cache can prefetch the time steps following the requested one on a
+ * background thread of a vtkThreadedCallbackQueue, while the requested one is
+ * used downstream, and bound the memory of the cached time steps. With a
+ * controller, the processes agree on what to evict and prefetch so that they
+ * keep caching the same time steps.
  * @par Thanks:
  * Ken Martin (Kitware) and John Bidiscombe of
  * CSCS - Swiss National Supercomputing Centre
@@ -35,9 +41,12 @@
 
 #include "vtkAlgorithm.h"
 #include <map>    // used for the cache
+#include <memory> // for std::unique_ptr
 #include <vector> // used for the timestep records
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkMultiProcessController;
+
 class VTKFILTERSHYBRID_EXPORT vtkTemporalDataSetCache : public vtkAlgorithm
 {
 public:
@@ -74,6 +83,49 @@ public:
   vtkBooleanMacro(IsASource, bool);
   ///@}
 
+  ///@{
+  /**
+   * Number of time steps following the requested one that are updated and
+   * cached on a background thread after each request. The upstream pipeline
+   * runs on that thread, so it must not communicate with other processes,
+   * and it must not be modified before WaitForPrefetch() returns.
+   * It defaults to 0, no prefetching.
+   */
+  vtkSetClampMacro(NumberOfPrefetchedTimeSteps, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPrefetchedTimeSteps, int);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum memory of the cached time steps in kibibytes, as given by
+   * vtkDataObject::GetActualMemorySize(). Beyond it the least recently used
+   * time steps are removed, and time steps are prefetched only when they fit.
+   * It defaults to 0, only CacheSize limits the cache.
+   */
+  vtkSetClampMacro(CacheMemoryLimit, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(CacheMemoryLimit, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Controller used to compare the memory of the caches of all the processes
+   * against CacheMemoryLimit, so that they all remove and prefetch the same
+   * time steps. It defaults to the global controller.
+   */
+  void SetController(vtkMultiProcessController*);
+  vtkGetObjectMacro(Controller, vtkMultiProcessController);
+  ///@}
+
+  /**
+   * Memory of the time steps cached by this process in kibibytes.
+   */
+  vtkIdType GetCacheMemorySize();
+
+  /**
+   * Block until the time steps being prefetched are cached.
+   */
+  void WaitForPrefetch();
+
 protected:
   vtkTemporalDataSetCache();
   ~vtkTemporalDataSetCache() override;
@@ -92,6 +144,12 @@ protected:
   int FillInputPortInformation(int port, vtkInformation* info) override;
   int FillOutputPortInformation(int vtkNotUsed(port), vtkInformation* info) override;
 
+  /**
+   * Create an executive that waits for the prefetched time steps before each
+   * request and starts prefetching after them.
+   */
+  vtkExecutive* CreateDefaultExecutive() override;
+
   virtual int RequestInformation(
     vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector);
 
@@ -114,6 +172,30 @@ private:
   void SetEjected(vtkDataObject*);
   vtkGetObjectMacro(Ejected, vtkDataObject);
   vtkDataObject* Ejected;
+
+  // remove the least recently used time steps, but keep, until all the
+  // processes fit in CacheMemoryLimit
+  void EvictToMemoryLimit(double keep);
+
+  // choose the time steps to prefetch after time, and the request to update
+  // them with
+  void PlanPrefetch(vtkInformation* inInfo, vtkDataObject* input, double time);
+
+  // prefetch the planned time steps on the background thread
+  void StartPrefetch();
+  void PrefetchTimeSteps(vtkAlgorithm* input, int port, const std::vector<double>& times,
+    vtkInformation* request, vtkMTimeType updateTime);
+
+  vtkIdType GetGlobalValue(vtkIdType value, int operation);
+
+  int NumberOfPrefetchedTimeSteps;
+  vtkIdType CacheMemoryLimit;
+  vtkMultiProcessController* Controller;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+
+  friend class vtkTemporalDataSetCachePipeline;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -20,14 +20,20 @@
 #include "vtkCellData.h"
 #include "vtkHyperTree.h"
 #include "vtkHyperTreeGrid.h"
+#include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include "vtkHyperTreeGridNonOrientedGeometryCursor.h"
+#include "vtkHyperTreeGridTreesInternal.h"
+
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkHyperTreeGridCellCenters);
@@ -159,28 +165,63 @@ void vtkHyperTreeGridCellCenters::ProcessTrees()
   // Retrieve material mask
   this->InMask = this->Input->HasMask() ? this->Input->GetMask() : nullptr;
 
-  // Iterate over all hyper trees
-  vtkIdType index;
-  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-  this->Input->InitializeTreeIterator(it);
-  vtkNew<vtkHyperTreeGridNonOrientedGeometryCursor> cursor;
-  while (it.GetNextTree(index))
+  // Gather the cell centers of each batch of trees concurrently
+  vtkHyperTreeGridTreesInternal trees(this->Input);
+  std::vector<vtkSmartPointer<vtkIdList>> batchLeafIds(trees.GetNumberOfBatches());
+  std::vector<vtkSmartPointer<vtkPoints>> batchPoints(trees.GetNumberOfBatches());
+  trees.For([&](vtkIdType batch, const vtkIdType* first, const vtkIdType* last) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkNew<vtkIdList> leafIds;
+    vtkNew<vtkPoints> points;
+    points->SetDataType(this->Points->GetDataType());
+    vtkNew<vtkHyperTreeGridNonOrientedGeometryCursor> cursor;
+    for (const vtkIdType* index = first; index != last; ++index)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      // Initialize new geometric cursor at root of current tree
+      this->Input->InitializeNonOrientedGeometryCursor(cursor, *index);
+      // Generate leaf cell centers recursively
+      this->RecursivelyProcessTree(cursor, leafIds, points);
+    }
+    batchLeafIds[batch] = leafIds;
+    batchPoints[batch] = points;
+  });
+
+  // Append the batches in the order of the trees
+  vtkIdType np = 0;
+  for (const auto& points : batchPoints)
+  {
+    np += points ? points->GetNumberOfPoints() : 0;
+  }
+  this->Points->SetNumberOfPoints(np);
+  vtkIdType outId = 0;
+  for (vtkIdType batch = 0; batch < trees.GetNumberOfBatches(); ++batch)
   {
-    if (this->CheckAbort())
+    vtkPoints* points = batchPoints[batch];
+    if (!points || !points->GetNumberOfPoints())
     {
-      break;
+      continue;
     }
-    // Initialize new geometric cursor at root of current tree
-    this->Input->InitializeNonOrientedGeometryCursor(cursor, index);
-    // Generate leaf cell centers recursively
-    this->RecursivelyProcessTree(cursor);
-  } // it
+    this->Points->InsertPoints(outId, points->GetNumberOfPoints(), 0, points);
+    // Copy cell center data from leaf data, when needed
+    if (this->VertexCells)
+    {
+      this->OutData->CopyData(this->InData, batchLeafIds[batch], outId);
+    }
+    outId += points->GetNumberOfPoints();
+  }
 
   // Set output geometry and topology if required
   this->Output->SetPoints(this->Points);
   if (this->VertexCells)
   {
-    vtkIdType np = this->Points->GetNumberOfPoints();
     vtkCellArray* vertices = vtkCellArray::New();
     vertices->AllocateEstimate(np, 1);
     for (vtkIdType i = 0; i < np; ++i)
@@ -198,7 +239,7 @@ void vtkHyperTreeGridCellCenters::ProcessTrees()
 
 //------------------------------------------------------------------------------
 void vtkHyperTreeGridCellCenters::RecursivelyProcessTree(
-  vtkHyperTreeGridNonOrientedGeometryCursor* cursor)
+  vtkHyperTreeGridNonOrientedGeometryCursor* cursor, vtkIdList* leafIds, vtkPoints* points)
 {
   // Create cell center if cursor is at leaf
   if (cursor->IsLeaf())
@@ -216,14 +257,9 @@ void vtkHyperTreeGridCellCenters::RecursivelyProcessTree(
     double pt[3];
     cursor->GetPoint(pt);
 
-    // Insert next point
-    vtkIdType outId = this->Points->InsertNextPoint(pt);
-
-    // Copy cell center data from leaf data, when needed
-    if (this->VertexCells)
-    {
-      this->OutData->CopyData(this->InData, id, outId);
-    }
+    // Insert next point, and remember its leaf for the data
+    points->InsertNextPoint(pt);
+    leafIds->InsertNextId(id);
   }
   else
   {
@@ -231,13 +267,13 @@ void vtkHyperTreeGridCellCenters::RecursivelyProcessTree(
     int numChildren = this->Input->GetNumberOfChildren();
     for (int child = 0; child < numChildren; ++child)
     {
-      if (this->CheckAbort())
+      if (this->GetAbortOutput())
       {
         break;
       }
       cursor->ToChild(child);
       // Recurse
-      this->RecursivelyProcessTree(cursor);
+      this->RecursivelyProcessTree(cursor, leafIds, points);
       cursor->ToParent();
     } // child
   }   // else
@@ -51,6 +51,7 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkBitArray;
 class vtkDataSetAttributes;
 class vtkHyperTreeGrid;
+class vtkIdList;
 class vtkPolyData;
 class vtkHyperTreeGridNonOrientedGeometryCursor;
 
@@ -71,14 +72,17 @@ protected:
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
   /**
-   * Main routine to process individual trees in the grid
+   * Main routine to process individual trees in the grid. Trees are processed
+   * concurrently, and the cell centers are appended in the order of the trees.
    */
   virtual void ProcessTrees();
 
   /**
-   * Recursively descend into tree down to leaves
+   * Recursively descend into tree down to leaves, appending the centers of
+   * the unmasked leaves to points and their global indices to leafIds.
    */
-  void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedGeometryCursor*);
+  void RecursivelyProcessTree(
+    vtkHyperTreeGridNonOrientedGeometryCursor*, vtkIdList* leafIds, vtkPoints* points);
 
   vtkHyperTreeGrid* Input;
   vtkPolyData* Output;
@@ -20,10 +20,12 @@
 #include "vtkInformation.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include "vtkUniformHyperTreeGrid.h"
 
 #include "vtkHyperTreeGridNonOrientedCursor.h"
+#include "vtkHyperTreeGridTreesInternal.h"
 
 #include <cmath>
 
@@ -91,23 +93,48 @@ int vtkHyperTreeGridEvaluateCoarse::ProcessTrees(vtkHyperTreeGrid* input, vtkDat
   this->InData = input->GetCellData();
   this->OutData = output->GetCellData();
   this->OutData->CopyAllocate(this->InData);
-  // Iterate over all input and output hyper trees
-  vtkIdType index;
-  vtkHyperTreeGrid::vtkHyperTreeGridIterator in;
-  output->InitializeTreeIterator(in);
-  vtkNew<vtkHyperTreeGridNonOrientedCursor> outCursor;
-  while (in.GetNextTree(index))
+  // Start from the input values: leaves keep them, and so do coarse cells
+  // when the operator does not change them
+  this->OutData->CopyData(this->InData, 0, this->InData->GetNumberOfTuples(), 0);
+  if (this->Operator == vtkHyperTreeGridEvaluateCoarse::OPERATOR_DON_T_CHANGE)
+  {
+    this->UpdateProgress(1.);
+    return 1;
+  }
+
+  // Coarse values only depend on the cells of their tree, so trees are
+  // processed concurrently, unless bits, packed in bytes shared by
+  // neighboring cells, are written.
+  bool concurrent = true;
+  for (int i = 0; i < this->OutData->GetNumberOfArrays(); ++i)
   {
-    if (this->CheckAbort())
+    if (vtkBitArray::SafeDownCast(this->OutData->GetAbstractArray(i)))
     {
-      break;
+      concurrent = false;
     }
-    // Initialize new cursor at root of current output tree
-    output->InitializeNonOrientedCursor(outCursor, index);
-    // Recursively
-    this->ProcessNode(outCursor);
-    // Clean up
   }
+  vtkHyperTreeGridTreesInternal trees(output);
+  trees.For(
+    [&](vtkIdType, const vtkIdType* first, const vtkIdType* last) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      vtkNew<vtkHyperTreeGridNonOrientedCursor> outCursor;
+      for (const vtkIdType* index = first; index != last; ++index)
+      {
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+        // Initialize new cursor at root of current output tree
+        output->InitializeNonOrientedCursor(outCursor, *index);
+        // Recursively
+        this->ProcessNode(outCursor);
+      }
+    },
+    concurrent);
   this->UpdateProgress(1.);
   return 1;
 }
@@ -115,38 +142,21 @@ int vtkHyperTreeGridEvaluateCoarse::ProcessTrees(vtkHyperTreeGrid* input, vtkDat
 //------------------------------------------------------------------------------
 void vtkHyperTreeGridEvaluateCoarse::ProcessNode(vtkHyperTreeGridNonOrientedCursor* outCursor)
 {
-  vtkIdType id = outCursor->GetGlobalNodeIndex();
+  // Leaves keep the input values, copied up front
   if (outCursor->IsLeaf())
   {
-    this->OutData->CopyData(this->InData, id, id);
-    return;
-  }
-  // If not operation
-  if (this->Operator == vtkHyperTreeGridEvaluateCoarse::OPERATOR_DON_T_CHANGE)
-  {
-    this->OutData->CopyData(this->InData, id, id);
-    // Coarse
-    for (int ichild = 0; ichild < this->NbChilds; ++ichild)
-    {
-      if (this->CheckAbort())
-      {
-        break;
-      }
-      outCursor->ToChild(ichild);
-      // We go through the children's cells
-      ProcessNode(outCursor);
-      outCursor->ToParent();
-    }
     return;
   }
+  vtkIdType id = outCursor->GetGlobalNodeIndex();
   //
   int nbArray = this->InData->GetNumberOfArrays();
   //
   std::vector<std::vector<std::vector<double>>> values(nbArray);
+  std::vector<double> tmp;
   // Coarse
   for (int ichild = 0; ichild < this->NbChilds; ++ichild)
   {
-    if (this->CheckAbort())
+    if (this->GetAbortOutput())
     {
       break;
     }
@@ -160,9 +170,11 @@ void vtkHyperTreeGridEvaluateCoarse::ProcessNode(vtkHyperTreeGridNonOrientedCurs
       vtkDataArray* arr = this->OutData->GetArray(i);
       int nbC = arr->GetNumberOfComponents();
       values[i].resize(nbC);
-      if (!this->Mask || !this->Mask->GetTuple1(idChild))
+      if (!this->Mask || !this->Mask->GetValue(idChild))
       {
-        double* tmp = arr->GetTuple(idChild);
+        // not the internal tuple of the array, which is not thread safe
+        tmp.resize(nbC);
+        arr->GetTuple(idChild, tmp.data());
         for (int iC = 0; iC < nbC; ++iC)
         {
           values[i][iC].push_back(tmp[iC]);
@@ -174,7 +186,7 @@ void vtkHyperTreeGridEvaluateCoarse::ProcessNode(vtkHyperTreeGridNonOrientedCurs
   // Reduction operation
   for (int i = 0; i < nbArray; ++i)
   {
-    if (this->CheckAbort())
+    if (this->GetAbortOutput())
     {
       break;
     }
@@ -0,0 +1,132 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHyperTreeGridTreesInternal.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHyperTreeGridTreesInternal
+ * @brief   process the root trees of a hyper tree grid concurrently
+ *
+ * The root trees of a vtkHyperTreeGrid are independent from each other, so
+ * filters that only look at one tree at a time can process them
+ * concurrently. vtkHyperTreeGridTreesInternal gathers the indices of the
+ * trees, in the order of vtkHyperTreeGrid::vtkHyperTreeGridIterator, and
+ * splits them into contiguous batches, processed with vtkSMPTools. A batch
+ * is processed by a single thread, which creates its own cursors and fills
+ * its own output buffers. As batches follow the order of the trees,
+ * appending their outputs in batch order gives the same output as a serial
+ * traversal, whatever the number of threads.
+ *
+ * The cell scales of the trees are cached lazily, and may be shared by
+ * trees (vtkUniformHyperTreeGrid): they are computed up front, so that
+ * geometry cursors may be used concurrently.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkHyperTreeGridCellCenters vtkHyperTreeGridEvaluateCoarse
+ */
+
+#ifndef vtkHyperTreeGridTreesInternal_h
+#define vtkHyperTreeGridTreesInternal_h
+
+#include "vtkHyperTree.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkHyperTreeGridScales.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkHyperTreeGridTreesInternal
+{
+public:
+  vtkHyperTreeGridTreesInternal(vtkHyperTreeGrid* htg)
+  {
+    vtkIdType index;
+    vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
+    htg->InitializeTreeIterator(it);
+    while (vtkHyperTree* tree = it.GetNextTree(index))
+    {
+      if (tree->HasScales())
+      {
+        tree->GetScales()->GetScale(tree->GetNumberOfLevels());
+      }
+      this->TreeIndices.push_back(index);
+    }
+
+    // A few batches per thread balance the load, as trees may differ a lot in
+    // size, while keeping the number of output buffers to merge small.
+    const vtkIdType numberOfTrees = static_cast<vtkIdType>(this->TreeIndices.size());
+    if (numberOfTrees == 0)
+    {
+      return;
+    }
+    const vtkIdType numberOfBatches = std::min(
+      numberOfTrees, static_cast<vtkIdType>(8 * vtkSMPTools::GetEstimatedNumberOfThreads()));
+    this->BatchOffsets.resize(numberOfBatches + 1);
+    for (vtkIdType batch = 0; batch <= numberOfBatches; ++batch)
+    {
+      this->BatchOffsets[batch] = batch * numberOfTrees / numberOfBatches;
+    }
+  }
+
+  /**
+   * Return the number of batches of trees. There are fewer batches than trees
+   * only when there are many trees.
+   */
+  vtkIdType GetNumberOfBatches() const
+  {
+    return static_cast<vtkIdType>(this->BatchOffsets.size()) - 1;
+  }
+
+  /**
+   * Call functor(batch, first, last) for each batch of trees, concurrently,
+   * where [first, last) is the range of the indices of the trees of the batch.
+   * The functor is called once per batch, by a single thread. When concurrent
+   * is false, the batches are processed in order by the calling thread, for
+   * outputs that do not support concurrent writes.
+   */
+  template <typename Functor>
+  void For(Functor&& functor, bool concurrent = true) const
+  {
+    auto processBatches = [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType batch = begin; batch < end; ++batch)
+      {
+        const vtkIdType* indices = this->TreeIndices.data();
+        functor(
+          batch, indices + this->BatchOffsets[batch], indices + this->BatchOffsets[batch + 1]);
+      }
+    };
+    if (concurrent)
+    {
+      vtkSMPTools::For(0, this->GetNumberOfBatches(), 1, processBatches);
+    }
+    else
+    {
+      processBatches(0, this->GetNumberOfBatches());
+    }
+  }
+
+private:
+  std::vector<vtkIdType> TreeIndices;
+  std::vector<vtkIdType> BatchOffsets = { 0 };
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkHyperTreeGridTreesInternal_h
+// VTK-HeaderTest-Exclude: vtkHyperTreeGridTreesInternal.h
@@ -0,0 +1,112 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    UnitTestFastWindingNumber.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the winding numbers of a sphere, and the classification of points
+// by vtkSelectEnclosedPoints with winding numbers, away from the surface.
+
+#include "vtkDataArray.h"
+#include "vtkFastWindingNumber.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSelectEnclosedPoints.h"
+#include "vtkSphereSource.h"
+
+#include <cmath>
+#include <iostream>
+
+int UnitTestFastWindingNumber(int, char*[])
+{
+  const double center[3] = { 1.0, 2.0, 3.0 };
+  const double radius = 2.0;
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(center[0], center[1], center[2]);
+  sphere->SetRadius(radius);
+  sphere->SetPhiResolution(40);
+  sphere->SetThetaResolution(60);
+  sphere->Update();
+
+  vtkNew<vtkFastWindingNumber> fast;
+  fast->SetSurface(sphere->GetOutput());
+  fast->BuildTree();
+
+  // With a huge accuracy, no node is approximated
+  vtkNew<vtkFastWindingNumber> exact;
+  exact->SetSurface(sphere->GetOutput());
+  exact->SetAccuracy(1.0e10);
+  exact->BuildTree();
+
+  int status = 0;
+  if (std::abs(exact->EvaluateWindingNumber(center) - 1.0) > 1.0e-9)
+  {
+    std::cerr << "Wrong winding number at the center: " << exact->EvaluateWindingNumber(center)
+              << std::endl;
+    status = 1;
+  }
+
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8775070);
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i < 5000; i++)
+  {
+    double x[3];
+    for (int j = 0; j < 3; j++)
+    {
+      x[j] = random->GetNextRangeValue(center[j] - 1.5 * radius, center[j] + 1.5 * radius);
+    }
+    const double r = std::sqrt(vtkMath::Distance2BetweenPoints(x, center));
+    if (std::abs(r - radius) < 0.05 * radius)
+    {
+      continue;
+    }
+    points->InsertNextPoint(x);
+
+    const double w = fast->EvaluateWindingNumber(x);
+    const double we = exact->EvaluateWindingNumber(x);
+    if (std::abs(w - we) > 0.1 || (r < radius) != fast->IsInside(x) ||
+      std::abs(we - (r < radius ? 1.0 : 0.0)) > 1.0e-6)
+    {
+      std::cerr << "Wrong winding number " << w << " (exact " << we << ") at distance " << r
+                << std::endl;
+      status = 1;
+      break;
+    }
+  }
+
+  vtkNew<vtkPolyData> cloud;
+  cloud->SetPoints(points);
+  vtkNew<vtkSelectEnclosedPoints> select;
+  select->SetInputData(cloud);
+  select->SetSurfaceConnection(sphere->GetOutputPort());
+  select->SetInsideTestMethodToWindingNumber();
+  select->Update();
+  vtkDataArray* selected = select->GetOutput()->GetPointData()->GetArray("SelectedPoints");
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ptId++)
+  {
+    double x[3];
+    points->GetPoint(ptId, x);
+    const bool inside = vtkMath::Distance2BetweenPoints(x, center) < radius * radius;
+    if ((selected->GetTuple1(ptId) != 0.0) != inside)
+    {
+      std::cerr << "Point " << ptId << " wrongly selected" << std::endl;
+      status = 1;
+      break;
+    }
+  }
+
+  return status;
+}
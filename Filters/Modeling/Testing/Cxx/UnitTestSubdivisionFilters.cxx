@@ -19,9 +19,13 @@
 #include "vtkLoopSubdivisionFilter.h"
 
 #include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkQuad.h"
+#include "vtkSphereSource.h"
 #include "vtkTriangle.h"
 
 #include "vtkCommand.h"
@@ -32,6 +36,8 @@
 
 template <typename T>
 int TestSubdivision();
+template <typename T>
+int TestClosedSurface();
 
 int UnitTestSubdivisionFilters(int, char*[])
 {
@@ -40,6 +46,8 @@ int UnitTestSubdivisionFilters(int, char*[])
   status += TestSubdivision<vtkButterflySubdivisionFilter>();
   status += TestSubdivision<vtkLinearSubdivisionFilter>();
   status += TestSubdivision<vtkLoopSubdivisionFilter>();
+  status += TestClosedSurface<vtkLinearSubdivisionFilter>();
+  status += TestClosedSurface<vtkLoopSubdivisionFilter>();
 
   return status;
 }
@@ -200,3 +208,56 @@ int TestSubdivision()
 
   return status;
 }
+
+template <typename T>
+int TestClosedSurface()
+{
+  vtkSmartPointer<vtkSphereSource> sphere = vtkSmartPointer<vtkSphereSource>::New();
+  sphere->SetThetaResolution(12);
+  sphere->SetPhiResolution(8);
+  sphere->Update();
+  vtkSmartPointer<vtkPolyData> surface = vtkSmartPointer<vtkPolyData>::New();
+  surface->ShallowCopy(sphere->GetOutput());
+  const vtkIdType numPts = surface->GetNumberOfPoints();
+  const vtkIdType numCells = surface->GetNumberOfCells();
+
+  vtkSmartPointer<vtkIdTypeArray> cellIds = vtkSmartPointer<vtkIdTypeArray>::New();
+  cellIds->SetName("CellIds");
+  cellIds->SetNumberOfValues(numCells);
+  for (vtkIdType cellId = 0; cellId < numCells; cellId++)
+  {
+    cellIds->SetValue(cellId, cellId);
+  }
+  surface->GetCellData()->AddArray(cellIds);
+
+  vtkSmartPointer<T> subdivision = vtkSmartPointer<T>::New();
+  std::cout << "Testing " << subdivision->GetClassName() << " on a closed surface...";
+  subdivision->SetInputData(surface);
+  subdivision->SetNumberOfSubdivisions(2);
+  subdivision->Update();
+  vtkPolyData* output = subdivision->GetOutput();
+
+  // Each level adds a point per edge, and splits each triangle in 4
+  const vtkIdType numEdges = numPts + numCells - 2;
+  const vtkIdType expectedNumPts = numPts + numEdges + 2 * numEdges + 3 * numCells;
+  if (output->GetNumberOfPoints() != expectedNumPts ||
+    output->GetNumberOfCells() != 16 * numCells ||
+    output->GetPointData()->GetNormals()->GetNumberOfTuples() != expectedNumPts)
+  {
+    std::cout << "FAILED: " << output->GetNumberOfPoints() << " points and "
+              << output->GetNumberOfCells() << " cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkIdTypeArray* outputIds =
+    vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("CellIds"));
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); cellId++)
+  {
+    if (!outputIds || outputIds->GetValue(cellId) != cellId / 16)
+    {
+      std::cout << "FAILED: wrong cell data of cell " << cellId << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::cout << "PASSED" << std::endl;
+  return EXIT_SUCCESS;
+}
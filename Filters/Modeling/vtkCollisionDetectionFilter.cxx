@@ -57,6 +57,7 @@
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
 #include "vtkMatrixToLinearTransform.h"
+#include "vtkNew.h"
 #include "vtkOBBTree.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
@@ -64,6 +65,8 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
@@ -71,6 +74,10 @@
 #include "vtkTrivialProducer.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCollisionDetectionFilter);
 
@@ -282,170 +289,169 @@ vtkMatrix4x4* vtkCollisionDetectionFilter::GetMatrix(int i)
   return this->Matrix[i];
 }
 
-static int ComputeCollisions(
-  vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4* Xform, void* clientdata)
+namespace
 {
-  // This is hard-coded for triangles but could be easily changed to allow for allow n-sided
-  // polygons
-  int numIdsA, numIdsB;
-  vtkIdList *IdsA, *IdsB, *pointIdsA, *pointIdsB;
-  vtkCellArray* cells;
-  vtkIdType cellPtIds[2];
-  vtkIdTypeArray *contactcells1, *contactcells2;
-  vtkPoints* contactpoints;
-  IdsA = nodeA->Cells;
-  IdsB = nodeB->Cells;
-  numIdsA = IdsA->GetNumberOfIds();
-  numIdsB = IdsB->GetNumberOfIds();
-
-  // clientdata is a pointer to this object... need to cast it as such
-  vtkCollisionDetectionFilter* self = reinterpret_cast<vtkCollisionDetectionFilter*>(clientdata);
-
-  // Turn off debugging here if its on... otherwise there's squawks every update/box test
-  int DebugWasOn = 0;
-  int FirstContact = 0;
-  if (self->GetDebug())
-  {
-    self->DebugOff();
-    DebugWasOn = 1;
-  }
-  vtkPolyData* inputA = vtkPolyData::SafeDownCast(self->GetInput(0));
-  vtkPolyData* inputB = vtkPolyData::SafeDownCast(self->GetInput(1));
-  contactcells1 = self->GetContactCells(0);
-  contactcells2 = self->GetContactCells(1);
-  contactpoints = self->GetOutput(2)->GetPoints();
+// A contact between a cell of each input, with its points in world space.
+struct vtkCollisionContact
+{
+  vtkIdType CellIds[2];
+  double Points[2][3];
+};
 
-  if (self->GetCollisionMode() == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS)
-  {
-    cells = self->GetOutput(2)->GetLines();
-  }
-  else
-  {
-    cells = self->GetOutput(2)->GetVerts();
+// The state shared by the box tests, gathered before the traversal of the
+// OBB trees so that the cells are tested without calling back the filter.
+struct vtkCollisionContext
+{
+  vtkCollisionDetectionFilter* Self;
+  vtkPolyData* Inputs[2];
+  vtkMatrix4x4* Matrix0;
+  int CollisionMode;
+  double Tolerance;
+  int NumberOfBoxTests;
+  vtkIdTypeArray* ContactCells[2];
+  vtkPoints* ContactPoints;
+  vtkCellArray* ContactCellArray;
+  // The pairs of overlapping leaf nodes, when the cells are tested after the
+  // traversal.
+  std::vector<std::pair<vtkOBBNode*, vtkOBBNode*>> NodePairs;
+};
+
+// Load the first three points of a cell, transformed by xform if given, and
+// compute their bounds.
+void LoadTriangle(vtkPolyData* input, vtkIdType cellId, vtkMatrix4x4* xform, vtkIdList* ptIds,
+  double pts[9], double bounds[6])
+{
+  vtkIdType npts;
+  const vtkIdType* cellPts;
+  input->GetCellPoints(cellId, npts, cellPts, ptIds);
+  bounds[0] = bounds[2] = bounds[4] = VTK_DOUBLE_MAX;
+  bounds[1] = bounds[3] = bounds[5] = VTK_DOUBLE_MIN;
+  for (int n = 0; n < 3; n++)
+  {
+    double* x = pts + 3 * n;
+    input->GetPoint(cellPts[n], x);
+    if (xform)
+    {
+      double in[4] = { x[0], x[1], x[2], 1.0 };
+      double out[4];
+      xform->MultiplyPoint(in, out);
+      x[0] = out[0] / out[3];
+      x[1] = out[1] / out[3];
+      x[2] = out[2] / out[3];
+    }
+    for (int p = 0; p < 3; p++)
+    {
+      bounds[2 * p] = std::min(bounds[2 * p], x[p]);
+      bounds[2 * p + 1] = std::max(bounds[2 * p + 1], x[p]);
+    }
   }
+}
 
-  float Tolerance = self->GetCellTolerance();
-  if (self->GetCollisionMode() == vtkCollisionDetectionFilter::VTK_FIRST_CONTACT)
-  {
-    FirstContact = 1;
-  }
-  vtkIdType cellIdA, cellIdB;
+// Test the cells of two leaf nodes for collision, Xform transforming the
+// points of input B into the coordinates of input A, and append the contacts
+// found. This is hard-coded for triangles but could be easily changed to allow
+// for n-sided polygons. Only the cell points are read, so that pairs of nodes
+// can be tested concurrently.
+void CollideNodes(const vtkCollisionContext& context, vtkOBBNode* nodeA, vtkOBBNode* nodeB,
+  vtkMatrix4x4* Xform, vtkIdList* ptIds, std::vector<vtkCollisionContact>& contacts)
+{
+  vtkIdList* IdsA = nodeA->Cells;
+  vtkIdList* IdsB = nodeB->Cells;
+  vtkIdType numIdsA = IdsA->GetNumberOfIds();
+  vtkIdType numIdsB = IdsB->GetNumberOfIds();
+  bool firstContact = context.CollisionMode == vtkCollisionDetectionFilter::VTK_FIRST_CONTACT;
 
-  double x1[4], x2[4], xnew[4];
   double ptsA[9], ptsB[9];
   double boundsA[6], boundsB[6];
-  vtkIdType i, j, k, m, n, p, v;
-  double *point, in[4], out[4];
-
-  // Loop thru the cells/points in IdsA
-  for (i = 0; i < numIdsA; i++)
+  double x1[4], x2[4], xnew[4];
+  for (vtkIdType i = 0; i < numIdsA; i++)
   {
-    cellIdA = IdsA->GetId(i);
-    pointIdsA = inputA->GetCell(cellIdA)->GetPointIds();
-    inputA->GetCellBounds(cellIdA, boundsA);
-
-    // Initialize ptsA
-    // It might speed things up if ptsA and ptsB only had to be an
-    // array of pointers to the cell vertices, rather than allocating here.
-    for (j = 0; j < 3; j++)
-    {
-      for (k = 0; k < 3; k++)
-      {
-        ptsA[j * 3 + k] = inputA->GetPoints()->GetPoint(pointIdsA->GetId(j))[k];
-      }
-    }
+    vtkIdType cellIdA = IdsA->GetId(i);
+    LoadTriangle(context.Inputs[0], cellIdA, nullptr, ptIds, ptsA, boundsA);
 
     // Loop thru each cell IdsB and test for collision
-    for (m = 0; m < numIdsB; m++)
+    for (vtkIdType m = 0; m < numIdsB; m++)
     {
-      cellIdB = IdsB->GetId(m);
-      pointIdsB = inputB->GetCell(cellIdB)->GetPointIds();
-      inputB->GetCellBounds(cellIdB, boundsB);
+      vtkIdType cellIdB = IdsB->GetId(m);
+      LoadTriangle(context.Inputs[1], cellIdB, Xform, ptIds, ptsB, boundsB);
 
-      // Initialize ptsB
-      for (n = 0; n < 3; n++)
-      {
-        point = inputB->GetPoints()->GetPoint(pointIdsB->GetId(n));
-        // transform the vertex
-        in[0] = point[0];
-        in[1] = point[1];
-        in[2] = point[2];
-        in[3] = 1.0;
-        Xform->MultiplyPoint(in, out);
-        out[0] = out[0] / out[3];
-        out[1] = out[1] / out[3];
-        out[2] = out[2] / out[3];
-        for (p = 0; p < 3; p++)
-        {
-          ptsB[n * 3 + p] = out[p];
-        }
-      }
-      // Calculate the bounds for the xformed cell
-      boundsB[0] = boundsB[2] = boundsB[4] = VTK_DOUBLE_MAX;
-      boundsB[1] = boundsB[3] = boundsB[5] = VTK_DOUBLE_MIN;
-      for (v = 0; v < 9; v = v + 3)
+      if (context.Self->IntersectPolygonWithPolygon(
+            3, ptsA, boundsA, 3, ptsB, boundsB, context.Tolerance, x1, x2, context.CollisionMode))
       {
-        if (ptsB[v] < boundsB[0])
-          boundsB[0] = ptsB[v];
-        if (ptsB[v] > boundsB[1])
-          boundsB[1] = ptsB[v];
-        if (ptsB[v + 1] < boundsB[2])
-          boundsB[2] = ptsB[v + 1];
-        if (ptsB[v + 1] > boundsB[3])
-          boundsB[3] = ptsB[v + 1];
-        if (ptsB[v + 2] < boundsB[4])
-          boundsB[4] = ptsB[v + 2];
-        if (ptsB[v + 2] > boundsB[5])
-          boundsB[5] = ptsB[v + 2];
-      }
-      // Test for intersection
-      if (contactcells1 && contactcells2 &&
-        self->IntersectPolygonWithPolygon(
-          3, ptsA, boundsA, 3, ptsB, boundsB, Tolerance, x1, x2, self->GetCollisionMode()))
-      {
-        contactcells1->InsertNextValue(cellIdA);
-        contactcells2->InsertNextValue(cellIdB);
+        vtkCollisionContact contact;
+        contact.CellIds[0] = cellIdA;
+        contact.CellIds[1] = cellIdB;
         // transform x back to "world space"
-        // could speed this up by testing for identity matrix
-        // and skipping the next transform.
         x1[3] = x2[3] = 1.0;
-        self->GetMatrix(0)->MultiplyPoint(x1, xnew);
-        xnew[0] = xnew[0] / xnew[3];
-        xnew[1] = xnew[1] / xnew[3];
-        xnew[2] = xnew[2] / xnew[3];
-        cellPtIds[0] = contactpoints->InsertNextPoint(xnew);
-        if (self->GetCollisionMode() == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS)
+        double* x[2] = { x1, x2 };
+        for (int k = 0; k < 2; k++)
         {
-          self->GetMatrix(0)->MultiplyPoint(x2, xnew);
-          xnew[0] = xnew[0] / xnew[3];
-          xnew[1] = xnew[1] / xnew[3];
-          xnew[2] = xnew[2] / xnew[3];
-          cellPtIds[1] = contactpoints->InsertNextPoint(xnew);
-          // insert a new line
-          cells->InsertNextCell(2, cellPtIds);
+          context.Matrix0->MultiplyPoint(x[k], xnew);
+          contact.Points[k][0] = xnew[0] / xnew[3];
+          contact.Points[k][1] = xnew[1] / xnew[3];
+          contact.Points[k][2] = xnew[2] / xnew[3];
         }
-        else
+        contacts.push_back(contact);
+        if (firstContact)
         {
-          // insert a new vert
-          cells->InsertNextCell(1, cellPtIds);
-        }
-
-        if (FirstContact)
-        {
-          // return the negative of the number of box tests to find first contact
-          // this will call a halt to the proceedings
-          if (DebugWasOn)
-            self->DebugOn();
-          return (-1 - self->GetNumberOfBoxTests());
+          return;
         }
       }
     }
   }
-  if (DebugWasOn)
-    self->DebugOn();
+}
+
+// Append contacts to the outputs of the filter.
+void InsertContacts(vtkCollisionContext& context, const std::vector<vtkCollisionContact>& contacts)
+{
+  vtkIdType cellPtIds[2];
+  for (const auto& contact : contacts)
+  {
+    context.ContactCells[0]->InsertNextValue(contact.CellIds[0]);
+    context.ContactCells[1]->InsertNextValue(contact.CellIds[1]);
+    cellPtIds[0] = context.ContactPoints->InsertNextPoint(contact.Points[0]);
+    if (context.CollisionMode == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS)
+    {
+      cellPtIds[1] = context.ContactPoints->InsertNextPoint(contact.Points[1]);
+      // insert a new line
+      context.ContactCellArray->InsertNextCell(2, cellPtIds);
+    }
+    else
+    {
+      // insert a new vert
+      context.ContactCellArray->InsertNextCell(1, cellPtIds);
+    }
+  }
+}
+
+// vtkOBBTree::IntersectWithOBBTree callback testing the cells of the nodes
+// right away, to stop the traversal at the first contact.
+int ComputeCollisions(vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4* Xform, void* clientdata)
+{
+  vtkCollisionContext* context = static_cast<vtkCollisionContext*>(clientdata);
+  vtkNew<vtkIdList> ptIds;
+  std::vector<vtkCollisionContact> contacts;
+  CollideNodes(*context, nodeA, nodeB, Xform, ptIds, contacts);
+  if (!contacts.empty())
+  {
+    InsertContacts(*context, contacts);
+    // return the negative of the number of box tests to find first contact
+    // this will call a halt to the proceedings
+    return (-1 - context->NumberOfBoxTests);
+  }
   return 1;
 }
 
+// vtkOBBTree::IntersectWithOBBTree callback collecting the pairs of
+// overlapping leaf nodes, whose cells are tested concurrently afterwards.
+int GatherNodePairs(vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4*, void* clientdata)
+{
+  vtkCollisionContext* context = static_cast<vtkCollisionContext*>(clientdata);
+  context->NodePairs.emplace_back(nodeA, nodeB);
+  return 1;
+}
+}
+
 // Description:
 // Perform a collision detection
 int vtkCollisionDetectionFilter::RequestData(vtkInformation* vtkNotUsed(request),
@@ -541,8 +547,58 @@ int vtkCollisionDetectionFilter::RequestData(vtkInformation* vtkNotUsed(request)
   Tree0->SetTolerance(this->BoxTolerance);
   Tree1->SetTolerance(this->BoxTolerance);
 
+  vtkCollisionContext context;
+  context.Self = this;
+  context.Inputs[0] = input[0];
+  context.Inputs[1] = input[1];
+  context.Matrix0 = this->GetMatrix(0);
+  context.CollisionMode = this->CollisionMode;
+  context.Tolerance = this->CellTolerance;
+  context.NumberOfBoxTests = this->NumberOfBoxTests;
+  context.ContactCells[0] = contactcells0;
+  context.ContactCells[1] = contactcells1;
+  context.ContactPoints = output[2]->GetPoints();
+  context.ContactCellArray = this->CollisionMode == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS
+    ? output[2]->GetLines()
+    : output[2]->GetVerts();
+  for (int i = 0; i < 2; i++)
+  {
+    if (input[i]->NeedToBuildCells())
+    {
+      input[i]->BuildCells();
+    }
+  }
+
   // Do the collision detection...
-  int boxTests = Tree0->IntersectWithOBBTree(Tree1, matrix, ComputeCollisions, this);
+  int boxTests;
+  if (this->CollisionMode == vtkCollisionDetectionFilter::VTK_FIRST_CONTACT)
+  {
+    // Test the cells during the traversal, to stop at the first contact.
+    boxTests = Tree0->IntersectWithOBBTree(Tree1, matrix, ComputeCollisions, &context);
+  }
+  else
+  {
+    // Collect the overlapping leaf nodes, then test their cells concurrently.
+    // The contacts of each pair of nodes are kept apart and inserted in the
+    // order of the traversal, so that the output does not depend on threading.
+    boxTests = Tree0->IntersectWithOBBTree(Tree1, matrix, GatherNodePairs, &context);
+    const auto& nodePairs = context.NodePairs;
+    std::vector<std::vector<vtkCollisionContact>> pairContacts(nodePairs.size());
+    vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(nodePairs.size()),
+      [&](vtkIdType begin, vtkIdType end) {
+        vtkIdList* ptIds = tlPtIds.Local();
+        for (vtkIdType pairId = begin; pairId < end; ++pairId)
+        {
+          CollideNodes(context, nodePairs[pairId].first, nodePairs[pairId].second, matrix, ptIds,
+            pairContacts[pairId]);
+        }
+      });
+    for (const auto& contacts : pairContacts)
+    {
+      InsertContacts(context, contacts);
+    }
+  }
 
   matrix->Delete();
   tmpMatrix->Delete();
@@ -0,0 +1,344 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkFastWindingNumber.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkFastWindingNumber.h"
+
+#include "vtkCellArray.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkFastWindingNumber);
+
+//------------------------------------------------------------------------------
+// The hierarchy is a binary tree whose nodes are stored in an array, the two
+// children of a node being next to each other. The triangles are stored in
+// the order of the leaves, so that each node covers a range of triangles.
+struct vtkFastWindingNumber::vtkInternals
+{
+  struct Node
+  {
+    double Center[3];     // area weighted centroid of the triangles
+    double AreaVector[3]; // sum of the area vectors of the triangles
+    double Radius2;       // squared radius of a ball around Center holding the triangles
+    vtkIdType Begin;      // first triangle
+    vtkIdType End;        // one past the last triangle
+    vtkIdType Child;      // first child, or -1 for a leaf
+  };
+
+  std::vector<double> Triangles; // 9 coordinates per triangle
+  std::vector<Node> Nodes;
+};
+
+namespace
+{
+// Enough for a tree that is split at the median, whatever the number of
+// triangles.
+constexpr int MaxStackSize = 128;
+
+//------------------------------------------------------------------------------
+// Append the triangles of the polygons and strips of the surface
+void CollectTriangles(vtkPolyData* surface, std::vector<double>& triangles)
+{
+  auto addTriangle = [&](vtkIdType p0, vtkIdType p1, vtkIdType p2) {
+    double x[3];
+    for (vtkIdType ptId : { p0, p1, p2 })
+    {
+      surface->GetPoint(ptId, x);
+      triangles.insert(triangles.end(), x, x + 3);
+    }
+  };
+
+  vtkIdType npts;
+  const vtkIdType* pts;
+  vtkCellArray* polys = surface->GetPolys();
+  for (vtkIdType cellId = 0; cellId < polys->GetNumberOfCells(); cellId++)
+  {
+    polys->GetCellAtId(cellId, npts, pts);
+    for (vtkIdType i = 1; i + 1 < npts; i++)
+    {
+      addTriangle(pts[0], pts[i], pts[i + 1]);
+    }
+  }
+  vtkCellArray* strips = surface->GetStrips();
+  for (vtkIdType cellId = 0; cellId < strips->GetNumberOfCells(); cellId++)
+  {
+    strips->GetCellAtId(cellId, npts, pts);
+    for (vtkIdType i = 0; i + 2 < npts; i++)
+    {
+      if (i % 2)
+      {
+        addTriangle(pts[i + 1], pts[i], pts[i + 2]);
+      }
+      else
+      {
+        addTriangle(pts[i], pts[i + 1], pts[i + 2]);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// The signed solid angle of a triangle seen from the origin, given the
+// coordinates of its vertices relative to it (A. Van Oosterom and J.
+// Strackee, "The Solid Angle of a Plane Triangle", 1983).
+double SolidAngle(const double a[3], const double b[3], const double c[3])
+{
+  const double la = vtkMath::Norm(a);
+  const double lb = vtkMath::Norm(b);
+  const double lc = vtkMath::Norm(c);
+  double bc[3];
+  vtkMath::Cross(b, c, bc);
+  const double det = vtkMath::Dot(a, bc);
+  const double den =
+    la * lb * lc + vtkMath::Dot(a, b) * lc + vtkMath::Dot(b, c) * la + vtkMath::Dot(c, a) * lb;
+  return 2.0 * std::atan2(det, den);
+}
+}
+
+//------------------------------------------------------------------------------
+vtkFastWindingNumber::vtkFastWindingNumber()
+{
+  this->Accuracy = 2.0;
+  this->NumberOfTrianglesPerLeaf = 8;
+}
+
+//------------------------------------------------------------------------------
+vtkFastWindingNumber::~vtkFastWindingNumber() = default;
+
+//------------------------------------------------------------------------------
+vtkCxxSetSmartPointerMacro(vtkFastWindingNumber, Surface, vtkPolyData);
+
+//------------------------------------------------------------------------------
+vtkPolyData* vtkFastWindingNumber::GetSurface()
+{
+  return this->Surface;
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::FreeTree()
+{
+  this->Internals.reset();
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::BuildTree()
+{
+  if (this->Internals && this->BuildTime > this->GetMTime() &&
+    (!this->Surface || this->BuildTime > this->Surface->GetMTime()))
+  {
+    return;
+  }
+
+  this->Internals.reset(new vtkInternals);
+  this->BuildTime.Modified();
+  if (!this->Surface)
+  {
+    return;
+  }
+
+  std::vector<double> triangles;
+  CollectTriangles(this->Surface, triangles);
+  const vtkIdType numTris = static_cast<vtkIdType>(triangles.size() / 9);
+  if (numTris == 0)
+  {
+    return;
+  }
+
+  std::vector<double> centroids(3 * numTris);
+  std::vector<vtkIdType> order(numTris);
+  vtkSMPTools::For(0, numTris, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType triId = begin; triId < end; triId++)
+    {
+      const double* t = triangles.data() + 9 * triId;
+      for (int i = 0; i < 3; i++)
+      {
+        centroids[3 * triId + i] = (t[i] + t[3 + i] + t[6 + i]) / 3.0;
+      }
+      order[triId] = triId;
+    }
+  });
+
+  // Split the nodes at the median of the centroids, along the longest axis
+  // of their bounds.
+  std::vector<vtkInternals::Node>& nodes = this->Internals->Nodes;
+  nodes.push_back(vtkInternals::Node{ {}, {}, 0.0, 0, numTris, -1 });
+  std::vector<vtkIdType> stack(1, 0);
+  while (!stack.empty())
+  {
+    const vtkIdType nodeId = stack.back();
+    stack.pop_back();
+    const vtkIdType begin = nodes[nodeId].Begin;
+    const vtkIdType end = nodes[nodeId].End;
+    if (end - begin <= this->NumberOfTrianglesPerLeaf)
+    {
+      continue;
+    }
+
+    double bounds[6] = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX,
+      VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      const double* c = centroids.data() + 3 * order[i];
+      for (int j = 0; j < 3; j++)
+      {
+        bounds[2 * j] = std::min(bounds[2 * j], c[j]);
+        bounds[2 * j + 1] = std::max(bounds[2 * j + 1], c[j]);
+      }
+    }
+    int axis = 0;
+    for (int j = 1; j < 3; j++)
+    {
+      if (bounds[2 * j + 1] - bounds[2 * j] > bounds[2 * axis + 1] - bounds[2 * axis])
+      {
+        axis = j;
+      }
+    }
+
+    const vtkIdType mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+      [&](vtkIdType t0, vtkIdType t1) {
+        return centroids[3 * t0 + axis] < centroids[3 * t1 + axis];
+      });
+
+    const vtkIdType child = static_cast<vtkIdType>(nodes.size());
+    nodes[nodeId].Child = child;
+    nodes.push_back(vtkInternals::Node{ {}, {}, 0.0, begin, mid, -1 });
+    nodes.push_back(vtkInternals::Node{ {}, {}, 0.0, mid, end, -1 });
+    stack.push_back(child);
+    stack.push_back(child + 1);
+  }
+
+  // Store the triangles in the order of the leaves
+  std::vector<double>& sorted = this->Internals->Triangles;
+  sorted.resize(triangles.size());
+  vtkSMPTools::For(0, numTris, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      std::copy_n(triangles.data() + 9 * order[i], 9, sorted.data() + 9 * i);
+    }
+  });
+
+  // Compute the dipole of each node from its triangles
+  vtkSMPTools::For(0, static_cast<vtkIdType>(nodes.size()), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType nodeId = begin; nodeId < end; nodeId++)
+    {
+      vtkInternals::Node& node = nodes[nodeId];
+      double area = 0.0;
+      double center[3] = { 0.0, 0.0, 0.0 };
+      double average[3] = { 0.0, 0.0, 0.0 };
+      double areaVector[3] = { 0.0, 0.0, 0.0 };
+      for (vtkIdType triId = node.Begin; triId < node.End; triId++)
+      {
+        const double* t = sorted.data() + 9 * triId;
+        double e1[3], e2[3], n[3];
+        for (int i = 0; i < 3; i++)
+        {
+          e1[i] = t[3 + i] - t[i];
+          e2[i] = t[6 + i] - t[i];
+        }
+        vtkMath::Cross(e1, e2, n);
+        const double a = 0.5 * vtkMath::Norm(n);
+        for (int i = 0; i < 3; i++)
+        {
+          const double c = (t[i] + t[3 + i] + t[6 + i]) / 3.0;
+          center[i] += a * c;
+          average[i] += c;
+          areaVector[i] += 0.5 * n[i];
+        }
+        area += a;
+      }
+      const double numTrisInNode = static_cast<double>(node.End - node.Begin);
+      for (int i = 0; i < 3; i++)
+      {
+        node.Center[i] = (area > 0.0 ? center[i] / area : average[i] / numTrisInNode);
+        node.AreaVector[i] = areaVector[i];
+      }
+      double radius2 = 0.0;
+      for (vtkIdType i = 9 * node.Begin; i < 9 * node.End; i += 3)
+      {
+        radius2 = std::max(radius2, vtkMath::Distance2BetweenPoints(node.Center, &sorted[i]));
+      }
+      node.Radius2 = radius2;
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+double vtkFastWindingNumber::EvaluateWindingNumber(const double x[3]) const
+{
+  if (!this->Internals || this->Internals->Nodes.empty())
+  {
+    return 0.0;
+  }
+
+  const std::vector<vtkInternals::Node>& nodes = this->Internals->Nodes;
+  const double* triangles = this->Internals->Triangles.data();
+  const double accuracy2 = this->Accuracy * this->Accuracy;
+  double solidAngle = 0.0;
+
+  vtkIdType stack[MaxStackSize];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0)
+  {
+    const vtkInternals::Node& node = nodes[stack[--stackSize]];
+    double d[3] = { node.Center[0] - x[0], node.Center[1] - x[1], node.Center[2] - x[2] };
+    const double dist2 = vtkMath::Dot(d, d);
+    if (dist2 > accuracy2 * node.Radius2)
+    {
+      // far enough to be seen as a single dipole
+      solidAngle += vtkMath::Dot(d, node.AreaVector) / (dist2 * std::sqrt(dist2));
+    }
+    else if (node.Child < 0)
+    {
+      for (vtkIdType triId = node.Begin; triId < node.End; triId++)
+      {
+        const double* t = triangles + 9 * triId;
+        double a[3], b[3], c[3];
+        for (int i = 0; i < 3; i++)
+        {
+          a[i] = t[i] - x[i];
+          b[i] = t[3 + i] - x[i];
+          c[i] = t[6 + i] - x[i];
+        }
+        solidAngle += SolidAngle(a, b, c);
+      }
+    }
+    else
+    {
+      stack[stackSize++] = node.Child;
+      stack[stackSize++] = node.Child + 1;
+    }
+  }
+
+  return solidAngle / (4.0 * vtkMath::Pi());
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Surface: " << this->Surface.Get() << "\n";
+  os << indent << "Accuracy: " << this->Accuracy << "\n";
+  os << indent << "Number Of Triangles Per Leaf: " << this->NumberOfTrianglesPerLeaf << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,138 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkFastWindingNumber.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkFastWindingNumber
+ * @brief   evaluate the winding number of a surface at arbitrary points
+ *
+ * vtkFastWindingNumber computes the generalized winding number of a
+ * polygonal surface at query points: the sum of the signed solid angles of
+ * its polygons seen from the point, divided by 4 pi. For a closed surface
+ * whose polygons are consistently oriented with outward normals, it is one
+ * inside and zero outside, and it degrades gracefully (to values in between)
+ * near holes and defects. A point is thus classified as inside when its
+ * winding number is at least 0.5.
+ *
+ * The triangles of the surface (polygons and strips are triangulated on the
+ * fly) are organized in a bounding volume hierarchy. Each node stores the
+ * sum of the area vectors of its triangles, placed at their area weighted
+ * centroid: seen from far enough, a node contributes like a single dipole,
+ * and its triangles need not be visited (A. Jacobson et al., "Robust
+ * Inside-Outside Segmentation using Generalized Winding Numbers", 2013, and
+ * G. Barill et al., "Fast Winding Numbers for Soups and Clouds", 2018). The
+ * cost of a query is thus logarithmic in the number of triangles.
+ *
+ * Once BuildTree() has been called, EvaluateWindingNumber() and IsInside()
+ * are thread safe.
+ *
+ * @sa
+ * vtkSelectEnclosedPoints vtkExtractEnclosedPoints
+ */
+
+#ifndef vtkFastWindingNumber_h
+#define vtkFastWindingNumber_h
+
+#include "vtkFiltersModelingModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+
+#include <memory> // For unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkPolyData;
+
+class VTKFILTERSMODELING_EXPORT vtkFastWindingNumber : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkFastWindingNumber* New();
+  vtkTypeMacro(vtkFastWindingNumber, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the surface whose winding number is evaluated. Its polygons
+   * should be consistently oriented, with normals pointing outward.
+   */
+  virtual void SetSurface(vtkPolyData* surface);
+  vtkPolyData* GetSurface();
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the ratio of the distance of a node of the hierarchy to the
+   * radius of the node, above which the node is approximated by a single
+   * dipole. Larger values are more accurate but slower. The default is 2.
+   */
+  vtkSetClampMacro(Accuracy, double, 1.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(Accuracy, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of triangles in a leaf of the hierarchy.
+   * The default is 8.
+   */
+  vtkSetClampMacro(NumberOfTrianglesPerLeaf, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfTrianglesPerLeaf, int);
+  ///@}
+
+  /**
+   * Build the hierarchy, if the surface or the parameters have changed
+   * since the last build. This must be called before the queries, and is
+   * not thread safe.
+   */
+  void BuildTree();
+
+  /**
+   * Release the hierarchy.
+   */
+  void FreeTree();
+
+  /**
+   * Return the winding number of the surface at x. BuildTree() must have
+   * been called first. This method is thread safe.
+   */
+  double EvaluateWindingNumber(const double x[3]) const;
+
+  /**
+   * Return whether the winding number of the surface at x is at least
+   * 0.5. BuildTree() must have been called first. This method is thread
+   * safe.
+   */
+  bool IsInside(const double x[3]) const { return this->EvaluateWindingNumber(x) >= 0.5; }
+
+protected:
+  vtkFastWindingNumber();
+  ~vtkFastWindingNumber() override;
+
+  vtkSmartPointer<vtkPolyData> Surface;
+  double Accuracy;
+  int NumberOfTrianglesPerLeaf;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+  vtkTimeStamp BuildTime;
+
+private:
+  vtkFastWindingNumber(const vtkFastWindingNumber&) = delete;
+  void operator=(const vtkFastWindingNumber&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -48,9 +48,15 @@
 
 #include "vtkCellLocator.h"
 #include "vtkGenericCell.h"
-#include "vtkKdTreePointLocator.h"
 #include "vtkPointSet.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
+#include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkHausdorffDistancePointSetFilter);
@@ -105,12 +111,12 @@ int vtkHausdorffDistancePointSetFilter::RequestData(vtkInformation* vtkNotUsed(r
   this->RelativeDistance[1] = 0.0;
   this->HausdorffDistance = 0.0;
 
-  // TODO: using vtkStaticCellLocator, vtkStaticPointLocator is going to be much faster.
-  // Need to investigate and replace if appropriate.
-  vtkSmartPointer<vtkKdTreePointLocator> pointLocatorA =
-    vtkSmartPointer<vtkKdTreePointLocator>::New();
-  vtkSmartPointer<vtkKdTreePointLocator> pointLocatorB =
-    vtkSmartPointer<vtkKdTreePointLocator>::New();
+  // The locators are thread safe once built, so the distances are computed
+  // concurrently.
+  vtkSmartPointer<vtkStaticPointLocator> pointLocatorA =
+    vtkSmartPointer<vtkStaticPointLocator>::New();
+  vtkSmartPointer<vtkStaticPointLocator> pointLocatorB =
+    vtkSmartPointer<vtkStaticPointLocator>::New();
 
   vtkSmartPointer<vtkCellLocator> cellLocatorA = vtkSmartPointer<vtkCellLocator>::New();
   vtkSmartPointer<vtkCellLocator> cellLocatorB = vtkSmartPointer<vtkCellLocator>::New();
@@ -130,13 +136,6 @@ int vtkHausdorffDistancePointSetFilter::RequestData(vtkInformation* vtkNotUsed(r
     cellLocatorB->BuildLocator();
   }
 
-  double dist;
-  double currentPoint[3];
-  double closestPoint[3];
-  vtkIdType cellId;
-  vtkSmartPointer<vtkGenericCell> cell = vtkSmartPointer<vtkGenericCell>::New();
-  int subId;
-
   vtkSmartPointer<vtkDoubleArray> distanceAToB = vtkSmartPointer<vtkDoubleArray>::New();
   distanceAToB->SetNumberOfComponents(1);
   distanceAToB->SetNumberOfTuples(inputA->GetNumberOfPoints());
@@ -147,63 +146,67 @@ int vtkHausdorffDistancePointSetFilter::RequestData(vtkInformation* vtkNotUsed(r
   distanceBToA->SetNumberOfTuples(inputB->GetNumberOfPoints());
   distanceBToA->SetName("Distance");
 
-  // Find the nearest neighbors to each point and add edges between them,
-  // if they do not already exist and they are not self loops
-  for (int i = 0; i < inputA->GetNumberOfPoints(); i++)
-  {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-    inputA->GetPoint(i, currentPoint);
-    if (this->TargetDistanceMethod == POINT_TO_POINT)
-    {
-      vtkIdType closestPointId = pointLocatorB->FindClosestPoint(currentPoint);
-      inputB->GetPoint(closestPointId, closestPoint);
-    }
-    else
-    {
-      cellLocatorB->FindClosestPoint(currentPoint, closestPoint, cell, cellId, subId, dist);
-    }
-
-    dist = std::sqrt(std::pow(currentPoint[0] - closestPoint[0], 2) +
-      std::pow(currentPoint[1] - closestPoint[1], 2) +
-      std::pow(currentPoint[2] - closestPoint[2], 2));
-    distanceAToB->SetValue(i, dist);
-
-    if (dist > this->RelativeDistance[0])
-    {
-      this->RelativeDistance[0] = dist;
-    }
-  }
-
-  for (int i = 0; i < inputB->GetNumberOfPoints(); i++)
-  {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-    inputB->GetPoint(i, currentPoint);
-    if (this->TargetDistanceMethod == POINT_TO_POINT)
+  // Compute the distance from each point of source to target, and return the
+  // largest one.
+  auto computeDistances = [this](vtkPointSet* source, vtkPointSet* target,
+                            vtkStaticPointLocator* pointLocator, vtkCellLocator* cellLocator,
+                            vtkDoubleArray* distances) {
+    vtkSMPThreadLocal<double> localMaxDistance(0.0);
+    vtkSMPThreadLocalObject<vtkGenericCell> localCell;
+    vtkSMPTools::For(0, source->GetNumberOfPoints(), [&](vtkIdType ptId, vtkIdType endPtId) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      vtkIdType checkAbortInterval = std::min((endPtId - ptId) / 10 + 1, (vtkIdType)1000);
+      vtkGenericCell* cell = localCell.Local();
+      double& maxDistance = localMaxDistance.Local();
+      double currentPoint[3];
+      double closestPoint[3];
+      double dist;
+      vtkIdType cellId;
+      int subId;
+      for (; ptId < endPtId; ++ptId)
+      {
+        if (ptId % checkAbortInterval == 0)
+        {
+          if (isFirst)
+          {
+            this->CheckAbort();
+          }
+          if (this->GetAbortOutput())
+          {
+            break;
+          }
+        }
+        source->GetPoint(ptId, currentPoint);
+        if (this->TargetDistanceMethod == POINT_TO_POINT)
+        {
+          vtkIdType closestPointId = pointLocator->FindClosestPoint(currentPoint);
+          target->GetPoint(closestPointId, closestPoint);
+        }
+        else
+        {
+          cellLocator->FindClosestPoint(currentPoint, closestPoint, cell, cellId, subId, dist);
+        }
+
+        dist = std::sqrt(std::pow(currentPoint[0] - closestPoint[0], 2) +
+          std::pow(currentPoint[1] - closestPoint[1], 2) +
+          std::pow(currentPoint[2] - closestPoint[2], 2));
+        distances->SetValue(ptId, dist);
+        maxDistance = std::max(maxDistance, dist);
+      }
+    });
+
+    double maxDistance = 0.0;
+    for (double localMax : localMaxDistance)
     {
-      vtkIdType closestPointId = pointLocatorA->FindClosestPoint(currentPoint);
-      inputA->GetPoint(closestPointId, closestPoint);
+      maxDistance = std::max(maxDistance, localMax);
     }
-    else
-    {
-      cellLocatorA->FindClosestPoint(currentPoint, closestPoint, cell, cellId, subId, dist);
-    }
-
-    dist = std::sqrt(std::pow(currentPoint[0] - closestPoint[0], 2) +
-      std::pow(currentPoint[1] - closestPoint[1], 2) +
-      std::pow(currentPoint[2] - closestPoint[2], 2));
-    distanceBToA->SetValue(i, dist);
+    return maxDistance;
+  };
 
-    if (dist > this->RelativeDistance[1])
-    {
-      this->RelativeDistance[1] = dist;
-    }
-  }
+  this->RelativeDistance[0] =
+    computeDistances(inputA, inputB, pointLocatorB, cellLocatorB, distanceAToB);
+  this->RelativeDistance[1] =
+    computeDistances(inputB, inputA, pointLocatorA, cellLocatorA, distanceBToA);
 
   if (this->RelativeDistance[0] >= RelativeDistance[1])
   {
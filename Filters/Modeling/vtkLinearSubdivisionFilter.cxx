@@ -17,18 +17,91 @@
 #include "vtkCellArray.h"
 #include "vtkEdgeTable.h"
 #include "vtkIdList.h"
+#include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkTriangleSubdivisionInternal.h"
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkLinearSubdivisionFilter);
 
+//------------------------------------------------------------------------------
 void vtkLinearSubdivisionFilter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 }
 
+//------------------------------------------------------------------------------
+int vtkLinearSubdivisionFilter::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector);
+  if (!input || !output || this->NumberOfSubdivisions < 1 || !vtkIsTriangleMesh(input))
+  {
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  vtkDebugMacro(<< "Generating subdivision surface using the linear scheme in parallel");
+  std::vector<vtkIdType> triangles;
+  vtkGetTriangles(input->GetPolys(), triangles);
+  vtkSmartPointer<vtkPoints> points = input->GetPoints();
+  vtkSmartPointer<vtkPointData> pointData = input->GetPointData();
+
+  int level;
+  for (level = 0; level < this->NumberOfSubdivisions; level++)
+  {
+    if (this->CheckAbort())
+    {
+      break;
+    }
+    const vtkIdType numPts = points->GetNumberOfPoints();
+    vtkSubdivisionEdges edges(triangles);
+    if (edges.Build(numPts) > 2)
+    {
+      vtkErrorMacro("Dataset is non-manifold and cannot be subdivided.");
+      vtkErrorMacro("Subdivision failed.");
+      return 0;
+    }
+
+    // The existing points are kept, and a point is added at the middle of
+    // each edge
+    vtkNew<vtkPoints> newPoints;
+    newPoints->SetDataType(points->GetDataType());
+    vtkNew<vtkPointData> newPointData;
+    vtkSubdivisionPoints newPointsBuilder(
+      points, pointData, newPoints, newPointData, numPts + edges.NumberOfEdges);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ptId++)
+      {
+        newPointsBuilder.Copy(ptId, ptId);
+      }
+    });
+    vtkSMPTools::For(0, edges.NumberOfEdges, [&](vtkIdType begin, vtkIdType end) {
+      static const double weights[2] = { .5, .5 };
+      for (vtkIdType edge = begin; edge < end; edge++)
+      {
+        const vtkIdType slot = edges.GetSlot(edge, 0);
+        const vtkIdType ids[2] = { edges.GetPoint1(slot), edges.GetPoint2(slot) };
+        newPointsBuilder.Interpolate(2, ids, weights, edges.GetEdgePoint(edge));
+      }
+    });
+
+    std::vector<vtkIdType> newTriangles;
+    edges.Subdivide(newTriangles);
+    triangles.swap(newTriangles);
+    points = newPoints;
+    pointData = newPointData;
+    this->UpdateProgress(static_cast<double>(level + 1) / this->NumberOfSubdivisions);
+  }
+
+  vtkSetSubdivisionOutput(input, output, points, pointData, triangles, level);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
 int vtkLinearSubdivisionFilter::GenerateSubdivisionPoints(
   vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD)
 {
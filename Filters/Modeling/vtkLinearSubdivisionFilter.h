@@ -20,6 +20,12 @@
  * subdividing its input polydata. Each subdivision iteration create 4
  * new triangles for each triangle in the polydata.
  *
+ * When the input is made of triangles only, the subdivision is done in
+ * parallel with vtkSMPTools: the edges of each level are sorted once to
+ * create their new points, and the intermediate levels are kept as plain
+ * arrays. The output is the same as the one of the serial implementation,
+ * which is still used for other inputs.
+ *
  * @par Thanks:
  * This work was supported by PHS Research Grant No. 1 P41 RR13218-01
  * from the National Center for Research Resources.
@@ -57,6 +63,7 @@ protected:
   vtkLinearSubdivisionFilter() = default;
   ~vtkLinearSubdivisionFilter() override = default;
 
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int GenerateSubdivisionPoints(vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts,
     vtkPointData* outputPD) override;
 
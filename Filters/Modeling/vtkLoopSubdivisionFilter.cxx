@@ -25,8 +25,14 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTriangleSubdivisionInternal.h"
+
+#include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkLoopSubdivisionFilter);
@@ -38,6 +44,156 @@ void vtkLoopSubdivisionFilter::PrintSelf(ostream& os, vtkIndent indent)
 
 static const double LoopWeights[4] = { .375, .375, .125, .125 };
 
+//------------------------------------------------------------------------------
+int vtkLoopSubdivisionFilter::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector);
+  if (!input || !output || this->NumberOfSubdivisions < 1 || !vtkIsTriangleMesh(input))
+  {
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  vtkDebugMacro(<< "Generating subdivision surface using the Loop scheme in parallel");
+  std::vector<vtkIdType> triangles;
+  vtkGetTriangles(input->GetPolys(), triangles);
+  vtkSmartPointer<vtkPoints> points = input->GetPoints();
+  vtkSmartPointer<vtkPointData> pointData = input->GetPointData();
+
+  int level;
+  for (level = 0; level < this->NumberOfSubdivisions; level++)
+  {
+    this->UpdateProgress(static_cast<double>(level + 1) / this->NumberOfSubdivisions);
+    if (this->CheckAbort())
+    {
+      break;
+    }
+    const vtkIdType numPts = points->GetNumberOfPoints();
+    vtkSubdivisionEdges edges(triangles);
+    const vtkIdType maxCells = edges.Build(numPts);
+    if (maxCells > 2)
+    {
+      vtkErrorMacro("Dataset is non-manifold and cannot be subdivided. Edge shared by "
+        << maxCells << " cells");
+      vtkErrorMacro("Subdivision failed.");
+      return 0;
+    }
+
+    // The neighbors of each point, flagged when they are across a boundary edge
+    std::vector<vtkIdType> neighborOffsets(numPts + 1, 0);
+    for (vtkIdType edge = 0; edge < edges.NumberOfEdges; edge++)
+    {
+      const vtkIdType slot = edges.GetSlot(edge, 0);
+      neighborOffsets[edges.GetPoint1(slot) + 1]++;
+      neighborOffsets[edges.GetPoint2(slot) + 1]++;
+    }
+    for (vtkIdType ptId = 0; ptId < numPts; ptId++)
+    {
+      if (neighborOffsets[ptId + 1] == 0)
+      {
+        vtkWarningMacro("Point " << ptId << " is not used by any triangle.");
+        vtkErrorMacro("Subdivision failed.");
+        return 0;
+      }
+      neighborOffsets[ptId + 1] += neighborOffsets[ptId];
+    }
+    std::vector<vtkIdType> neighbors(neighborOffsets[numPts]);
+    std::vector<char> boundaries(neighborOffsets[numPts]);
+    std::vector<vtkIdType> insertions(neighborOffsets.begin(), neighborOffsets.end() - 1);
+    for (vtkIdType edge = 0; edge < edges.NumberOfEdges; edge++)
+    {
+      const vtkIdType slot = edges.GetSlot(edge, 0);
+      const vtkIdType p1 = edges.GetPoint1(slot);
+      const vtkIdType p2 = edges.GetPoint2(slot);
+      const char boundary = edges.GetNumberOfSlots(edge) == 1;
+      boundaries[insertions[p1]] = boundary;
+      neighbors[insertions[p1]++] = p2;
+      boundaries[insertions[p2]] = boundary;
+      neighbors[insertions[p2]++] = p1;
+    }
+
+    vtkNew<vtkPoints> newPoints;
+    vtkNew<vtkPointData> newPointData;
+    vtkSubdivisionPoints newPointsBuilder(
+      points, pointData, newPoints, newPointData, numPts + edges.NumberOfEdges);
+
+    // Generate even points. these are derived from the old points
+    vtkSMPThreadLocal<std::vector<vtkIdType>> tlStencil;
+    vtkSMPThreadLocal<std::vector<double>> tlWeights;
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      std::vector<vtkIdType>& stencil = tlStencil.Local();
+      std::vector<double>& weights = tlWeights.Local();
+      for (vtkIdType ptId = begin; ptId < end; ptId++)
+      {
+        stencil.clear();
+        weights.clear();
+        for (vtkIdType i = neighborOffsets[ptId]; i < neighborOffsets[ptId + 1]; i++)
+        {
+          if (boundaries[i])
+          {
+            stencil.push_back(neighbors[i]);
+          }
+        }
+        if (stencil.size() >= 2) // boundary point
+        {
+          stencil.resize(2);
+          weights.assign({ .125, .125 });
+          stencil.push_back(ptId);
+          weights.push_back(.75);
+        }
+        else
+        {
+          const vtkIdType K = neighborOffsets[ptId + 1] - neighborOffsets[ptId];
+          double beta = 3.0 / 16.0;
+          if (K > 3)
+          {
+            double cosSQ = .375 + .25 * std::cos(2.0 * vtkMath::Pi() / static_cast<double>(K));
+            cosSQ = cosSQ * cosSQ;
+            beta = (.625 - cosSQ) / static_cast<double>(K);
+          }
+          stencil.assign(neighbors.begin() + neighborOffsets[ptId],
+            neighbors.begin() + neighborOffsets[ptId + 1]);
+          weights.assign(K, beta);
+          stencil.push_back(ptId);
+          weights.push_back(1.0 - K * beta);
+        }
+        newPointsBuilder.Interpolate(
+          static_cast<int>(stencil.size()), stencil.data(), weights.data(), ptId);
+      }
+    });
+
+    // Generate odd points, one on each edge
+    vtkSMPTools::For(0, edges.NumberOfEdges, [&](vtkIdType begin, vtkIdType end) {
+      static const double boundaryWeights[2] = { .5, .5 };
+      for (vtkIdType edge = begin; edge < end; edge++)
+      {
+        const vtkIdType slot = edges.GetSlot(edge, 0);
+        vtkIdType stencil[4] = { edges.GetPoint1(slot), edges.GetPoint2(slot), -1, -1 };
+        if (edges.GetNumberOfSlots(edge) == 1)
+        {
+          newPointsBuilder.Interpolate(2, stencil, boundaryWeights, edges.GetEdgePoint(edge));
+        }
+        else
+        {
+          stencil[2] = edges.GetOppositePoint(slot);
+          stencil[3] = edges.GetOppositePoint(edges.GetSlot(edge, 1));
+          newPointsBuilder.Interpolate(4, stencil, LoopWeights, edges.GetEdgePoint(edge));
+        }
+      }
+    });
+
+    std::vector<vtkIdType> newTriangles;
+    edges.Subdivide(newTriangles);
+    triangles.swap(newTriangles);
+    points = newPoints;
+    pointData = newPointData;
+  }
+
+  vtkSetSubdivisionOutput(input, output, points, pointData, triangles, level);
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 int vtkLoopSubdivisionFilter::GenerateSubdivisionPoints(
   vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD)
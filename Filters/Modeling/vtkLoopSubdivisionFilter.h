@@ -34,6 +34,11 @@
  * The filter approximates point data using the same scheme. New
  * triangles create at a subdivision step will have the cell data of
  * their parent cell.
+ * <P>
+ * When the input is made of triangles only, the subdivision is done in
+ * parallel with vtkSMPTools: the edges of each level are sorted once to
+ * find the stencils of the new points, and the intermediate levels are kept
+ * as plain arrays. The serial implementation is still used for other inputs.
  *
  * @par Thanks:
  * This work was supported by PHS Research Grant No. 1 P41 RR13218-01
@@ -71,6 +76,7 @@ protected:
   vtkLoopSubdivisionFilter() = default;
   ~vtkLoopSubdivisionFilter() override = default;
 
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int GenerateSubdivisionPoints(vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts,
     vtkPointData* outputPD) override;
   int GenerateEvenStencil(vtkIdType p1, vtkPolyData* polys, vtkIdList* stencilIds, double* weights);
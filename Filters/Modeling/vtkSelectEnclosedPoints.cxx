@@ -17,6 +17,7 @@
 #include "vtkCellData.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
+#include "vtkFastWindingNumber.h"
 #include "vtkFeatureEdges.h"
 #include "vtkGarbageCollector.h"
 #include "vtkGenericCell.h"
@@ -55,6 +56,7 @@ struct SelectInOutCheck
   double Length;
   double Tolerance;
   vtkStaticCellLocator* Locator;
+  vtkFastWindingNumber* WindingNumber;
   unsigned char* Hits;
   vtkSelectEnclosedPoints* Selector;
   vtkTypeBool InsideOut;
@@ -68,13 +70,14 @@ struct SelectInOutCheck
   vtkSMPThreadLocalObject<vtkGenericCell> Cell;
 
   SelectInOutCheck(vtkIdType numPts, vtkDataSet* ds, vtkPolyData* surface, double bds[6],
-    double tol, vtkStaticCellLocator* loc, unsigned char* hits, vtkSelectEnclosedPoints* sel,
-    vtkTypeBool io, vtkSelectEnclosedPoints* filter)
+    double tol, vtkStaticCellLocator* loc, vtkFastWindingNumber* wn, unsigned char* hits,
+    vtkSelectEnclosedPoints* sel, vtkTypeBool io, vtkSelectEnclosedPoints* filter)
     : NumPts(numPts)
     , DataSet(ds)
     , Surface(surface)
     , Tolerance(tol)
     , Locator(loc)
+    , WindingNumber(wn)
     , Hits(hits)
     , Selector(sel)
     , InsideOut(io)
@@ -89,13 +92,23 @@ struct SelectInOutCheck
     this->Length = sqrt((bds[1] - bds[0]) * (bds[1] - bds[0]) +
       (bds[3] - bds[2]) * (bds[3] - bds[2]) + (bds[5] - bds[4]) * (bds[5] - bds[4]));
 
-    // Precompute a sufficiently large enough random sequence
-    this->Sequence = vtkRandomPool::New();
-    this->Sequence->SetSize((numPts > 1500 ? numPts : 1500));
-    this->Sequence->GeneratePool();
+    // Precompute a sufficiently large enough random sequence for the rays
+    this->Sequence = nullptr;
+    if (!this->WindingNumber)
+    {
+      this->Sequence = vtkRandomPool::New();
+      this->Sequence->SetSize((numPts > 1500 ? numPts : 1500));
+      this->Sequence->GeneratePool();
+    }
   }
 
-  ~SelectInOutCheck() { this->Sequence->Delete(); }
+  ~SelectInOutCheck()
+  {
+    if (this->Sequence)
+    {
+      this->Sequence->Delete();
+    }
+  }
 
   void Initialize()
   {
@@ -126,8 +139,20 @@ struct SelectInOutCheck
       }
       this->DataSet->GetPoint(ptId, x);
 
-      if (vtkSelectEnclosedPoints::IsInsideSurface(x, this->Surface, this->Bounds, this->Length,
-            this->Tolerance, this->Locator, cellIds, cell, counter, this->Sequence, ptId))
+      bool inside;
+      if (this->WindingNumber)
+      {
+        inside = x[0] >= this->Bounds[0] && x[0] <= this->Bounds[1] &&
+          x[1] >= this->Bounds[2] && x[1] <= this->Bounds[3] && x[2] >= this->Bounds[4] &&
+          x[2] <= this->Bounds[5] && this->WindingNumber->IsInside(x);
+      }
+      else
+      {
+        inside = vtkSelectEnclosedPoints::IsInsideSurface(x, this->Surface, this->Bounds,
+          this->Length, this->Tolerance, this->Locator, cellIds, cell, counter, this->Sequence,
+          ptId);
+      }
+      if (inside)
       {
         *hits++ = (this->InsideOut ? 0 : 1);
       }
@@ -141,9 +166,11 @@ struct SelectInOutCheck
   void Reduce() {}
 
   static void Execute(vtkIdType numPts, vtkDataSet* ds, vtkPolyData* surface, double bds[6],
-    double tol, vtkStaticCellLocator* loc, unsigned char* hits, vtkSelectEnclosedPoints* sel)
+    double tol, vtkStaticCellLocator* loc, vtkFastWindingNumber* wn, unsigned char* hits,
+    vtkSelectEnclosedPoints* sel)
   {
-    SelectInOutCheck inOut(numPts, ds, surface, bds, tol, loc, hits, sel, sel->GetInsideOut(), sel);
+    SelectInOutCheck inOut(
+      numPts, ds, surface, bds, tol, loc, wn, hits, sel, sel->GetInsideOut(), sel);
     vtkSMPTools::For(0, numPts, inOut);
   }
 }; // SelectInOutCheck
@@ -159,11 +186,13 @@ vtkSelectEnclosedPoints::vtkSelectEnclosedPoints()
   this->CheckSurface = false;
   this->InsideOut = 0;
   this->Tolerance = 0.0001;
+  this->InsideTestMethod = RAY_CASTING;
 
   this->InsideOutsideArray = nullptr;
 
   // These are needed to support backward compatibility
   this->CellLocator = vtkStaticCellLocator::New();
+  this->WindingNumber = vtkFastWindingNumber::New();
   this->CellIds = vtkIdList::New();
   this->Cell = vtkGenericCell::New();
 }
@@ -183,6 +212,7 @@ vtkSelectEnclosedPoints::~vtkSelectEnclosedPoints()
     loc->Delete();
   }
 
+  this->WindingNumber->Delete();
   this->CellIds->Delete();
   this->Cell->Delete();
 }
@@ -226,8 +256,10 @@ int vtkSelectEnclosedPoints::RequestData(vtkInformation* vtkNotUsed(request),
   unsigned char* hitsPtr = static_cast<unsigned char*>(hits->GetVoidPointer(0));
 
   // Process the points in parallel
-  SelectInOutCheck::Execute(
-    numPts, input, surface, this->Bounds, this->Tolerance, this->CellLocator, hitsPtr, this);
+  vtkFastWindingNumber* windingNumber =
+    (this->InsideTestMethod == WINDING_NUMBER ? this->WindingNumber : nullptr);
+  SelectInOutCheck::Execute(numPts, input, surface, this->Bounds, this->Tolerance,
+    this->CellLocator, windingNumber, hitsPtr, this);
 
   // Copy all the input geometry and data to the output.
   output->CopyStructure(input);
@@ -285,9 +317,17 @@ void vtkSelectEnclosedPoints::Initialize(vtkPolyData* surface)
   surface->GetBounds(this->Bounds);
   this->Length = surface->GetLength();
 
-  // Set up structures for acceleration ray casting
-  this->CellLocator->SetDataSet(surface);
-  this->CellLocator->BuildLocator();
+  // Set up structures for the winding number or for accelerating ray casting
+  if (this->InsideTestMethod == WINDING_NUMBER)
+  {
+    this->WindingNumber->SetSurface(surface);
+    this->WindingNumber->BuildTree();
+  }
+  else
+  {
+    this->CellLocator->SetDataSet(surface);
+    this->CellLocator->BuildLocator();
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -318,6 +358,13 @@ int vtkSelectEnclosedPoints::IsInsideSurface(double x, double y, double z)
 // safe due to the use of the data member CellIds and Cell.
 int vtkSelectEnclosedPoints::IsInsideSurface(double x[3])
 {
+  if (this->InsideTestMethod == WINDING_NUMBER)
+  {
+    const double* bds = this->Bounds;
+    return (x[0] >= bds[0] && x[0] <= bds[1] && x[1] >= bds[2] && x[1] <= bds[3] &&
+      x[2] >= bds[4] && x[2] <= bds[5] && this->WindingNumber->IsInside(x));
+  }
+
   vtkIntersectionCounter counter(this->Tolerance, this->Length);
 
   return vtkSelectEnclosedPoints::IsInsideSurface(x, this->Surface, this->Bounds, this->Length,
@@ -498,6 +545,8 @@ int vtkSelectEnclosedPoints::FillInputPortInformation(int port, vtkInformation*
 void vtkSelectEnclosedPoints::Complete()
 {
   this->CellLocator->FreeSearchStructure();
+  this->WindingNumber->FreeTree();
+  this->WindingNumber->SetSurface(nullptr);
 }
 
 //------------------------------------------------------------------------------
@@ -519,5 +568,8 @@ void vtkSelectEnclosedPoints::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Inside Out: " << (this->InsideOut ? "On\n" : "Off\n");
 
   os << indent << "Tolerance: " << this->Tolerance << "\n";
+
+  os << indent << "Inside Test Method: "
+     << (this->InsideTestMethod == WINDING_NUMBER ? "Winding Number\n" : "Ray Casting\n");
 }
 VTK_ABI_NAMESPACE_END
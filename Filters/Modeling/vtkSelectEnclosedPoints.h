@@ -37,13 +37,20 @@
  * are available (i.e., threshold the output array). Also, see the filter
  * vtkExtractEnclosedPoints which operates on point clouds.
  *
+ * By default, each point is classified by casting random rays and counting
+ * their intersections with the surface. Alternatively, the winding number
+ * of the surface can be evaluated at the point (see vtkFastWindingNumber),
+ * which is faster on large surfaces and more robust near the surface and
+ * with small defects, but requires the polygons of the surface to be
+ * consistently oriented with outward normals.
+ *
  * @warning
  * This class has been threaded with vtkSMPTools. Using TBB or other
  * non-sequential type (set in the CMake variable
  * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
  *
  * @sa
- * vtkMaskPoints vtkExtractEnclosedPoints
+ * vtkMaskPoints vtkExtractEnclosedPoints vtkFastWindingNumber
  */
 
 #ifndef vtkSelectEnclosedPoints_h
@@ -60,6 +67,7 @@ class vtkStaticCellLocator;
 class vtkIdList;
 class vtkGenericCell;
 class vtkRandomPool;
+class vtkFastWindingNumber;
 
 class VTKFILTERSMODELING_EXPORT vtkSelectEnclosedPoints : public vtkDataSetAlgorithm
 {
@@ -122,6 +130,29 @@ public:
    */
   int IsInside(vtkIdType inputPtId);
 
+  /**
+   * The methods used to decide whether a point is inside the surface.
+   */
+  enum InsideTestMethods
+  {
+    RAY_CASTING = 0,
+    WINDING_NUMBER = 1
+  };
+
+  ///@{
+  /**
+   * Specify how the points are classified. With RAY_CASTING (the default),
+   * random rays are cast from the point and their intersections with the
+   * surface are counted. With WINDING_NUMBER, a point is inside when the
+   * winding number of the surface at the point is at least 0.5; the polygons
+   * of the surface must then be consistently oriented with outward normals.
+   */
+  vtkSetClampMacro(InsideTestMethod, int, RAY_CASTING, WINDING_NUMBER);
+  vtkGetMacro(InsideTestMethod, int);
+  void SetInsideTestMethodToRayCasting() { this->SetInsideTestMethod(RAY_CASTING); }
+  void SetInsideTestMethodToWindingNumber() { this->SetInsideTestMethod(WINDING_NUMBER); }
+  ///@}
+
   ///@{
   /**
    * Specify the tolerance on the intersection. The tolerance is expressed as
@@ -171,11 +202,13 @@ protected:
   vtkTypeBool CheckSurface;
   vtkTypeBool InsideOut;
   double Tolerance;
+  int InsideTestMethod;
 
   vtkUnsignedCharArray* InsideOutsideArray;
 
   // Internal structures for accelerating the intersection test
   vtkStaticCellLocator* CellLocator;
+  vtkFastWindingNumber* WindingNumber;
   vtkIdList* CellIds;
   vtkGenericCell* Cell;
   vtkPolyData* Surface;
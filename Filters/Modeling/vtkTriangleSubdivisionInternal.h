@@ -0,0 +1,303 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkTriangleSubdivisionInternal.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkTriangleSubdivisionInternal
+ * @brief   subdivide triangle meshes in parallel
+ *
+ * vtkTriangleSubdivisionInternal gathers the helpers used by
+ * vtkLinearSubdivisionFilter and vtkLoopSubdivisionFilter to subdivide
+ * triangle meshes with vtkSMPTools. Instead of inserting the edges one at a
+ * time in a vtkEdgeTable and looking up the edge neighbors with the links of
+ * an intermediate vtkPolyData, the edges of all the triangles are sorted once
+ * per level with vtkStaticEdgeLocatorTemplate. Each unique edge then receives
+ * its new point, numbered as the serial filters number them, so the output is
+ * the same. The levels are kept as plain arrays of triangles, and only the
+ * last one is turned into a vtkPolyData; the cell data is copied once, from
+ * the input cells to the final cells.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkLinearSubdivisionFilter vtkLoopSubdivisionFilter
+ */
+
+#ifndef vtkTriangleSubdivisionInternal_h
+#define vtkTriangleSubdivisionInternal_h
+
+#include "vtkArrayListTemplate.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Return whether the polydata is made of triangles only, which is what the
+// parallel subdivision handles. Other inputs go through the serial filters.
+bool vtkIsTriangleMesh(vtkPolyData* input)
+{
+  const vtkIdType numCells = input->GetNumberOfCells();
+  return input->GetNumberOfPoints() > 0 && numCells > 0 &&
+    input->GetNumberOfPolys() == numCells && input->GetPolys()->IsHomogeneous() == 3;
+}
+
+//------------------------------------------------------------------------------
+// Gather the point ids of the triangles, 3 per triangle.
+void vtkGetTriangles(vtkCellArray* polys, std::vector<vtkIdType>& triangles)
+{
+  const vtkIdType numTris = polys->GetNumberOfCells();
+  triangles.resize(3 * numTris);
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+  vtkSMPTools::For(0, numTris, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* ids = tlIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (vtkIdType cellId = begin; cellId < end; cellId++)
+    {
+      polys->GetCellAtId(cellId, npts, pts, ids);
+      std::copy(pts, pts + 3, triangles.begin() + 3 * cellId);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// The edges of a triangle mesh. The slot 3*t+e of triangle t is the edge
+// going from its point (e+2)%3 to its point e, opposite to its point (e+1)%3:
+// this is the order in which the serial filters visit the edges. The slots
+// are grouped by edge, and sorted within each edge, so that the first slot
+// of an edge belongs to the triangle with the smallest id.
+struct vtkSubdivisionEdges
+{
+  using EdgeTupleType = EdgeTuple<vtkIdType, vtkIdType>;
+
+  const std::vector<vtkIdType>& Triangles;
+  std::vector<EdgeTupleType> Slots;
+  vtkStaticEdgeLocatorTemplate<vtkIdType, vtkIdType> Locator;
+  const vtkIdType* Offsets;
+  vtkIdType NumberOfEdges;
+  // The new point of each slot. The new points are numbered after the
+  // existing points, in the order of the first slots of the edges.
+  std::vector<vtkIdType> SlotPoints;
+
+  vtkSubdivisionEdges(const std::vector<vtkIdType>& triangles)
+    : Triangles(triangles)
+    , Offsets(nullptr)
+    , NumberOfEdges(0)
+  {
+  }
+
+  // Build the edges of the triangles and number their new points. Return the
+  // largest number of triangles that share an edge.
+  vtkIdType Build(vtkIdType numPts)
+  {
+    const vtkIdType numSlots = static_cast<vtkIdType>(this->Triangles.size());
+    this->Slots.resize(numSlots);
+    vtkSMPTools::For(0, numSlots / 3, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType t = begin; t < end; t++)
+      {
+        for (int e = 0; e < 3; e++)
+        {
+          const vtkIdType slot = 3 * t + e;
+          this->Slots[slot] = EdgeTupleType(this->GetPoint1(slot), this->GetPoint2(slot), slot);
+        }
+      }
+    });
+    this->Offsets = this->Locator.MergeEdges(numSlots, this->Slots.data(), this->NumberOfEdges);
+
+    // Sort the slots of each edge, and mark the first ones
+    this->SlotPoints.assign(numSlots, -1);
+    vtkSMPThreadLocal<vtkIdType> tlMaxSlots(0);
+    vtkSMPTools::For(0, this->NumberOfEdges, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdType& maxSlots = tlMaxSlots.Local();
+      for (vtkIdType edge = begin; edge < end; edge++)
+      {
+        EdgeTupleType* first = this->Slots.data() + this->Offsets[edge];
+        EdgeTupleType* last = this->Slots.data() + this->Offsets[edge + 1];
+        std::sort(first, last,
+          [](const EdgeTupleType& a, const EdgeTupleType& b) { return a.Data < b.Data; });
+        this->SlotPoints[first->Data] = 0;
+        maxSlots = std::max(maxSlots, static_cast<vtkIdType>(last - first));
+      }
+    });
+    vtkIdType maxSlots = 0;
+    for (vtkIdType localMax : tlMaxSlots)
+    {
+      maxSlots = std::max(maxSlots, localMax);
+    }
+
+    // Number the new points, and give them to the other slots of their edge
+    vtkIdType newId = numPts;
+    for (vtkIdType& slotPoint : this->SlotPoints)
+    {
+      if (slotPoint == 0)
+      {
+        slotPoint = newId++;
+      }
+    }
+    vtkSMPTools::For(0, this->NumberOfEdges, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType edge = begin; edge < end; edge++)
+      {
+        const vtkIdType pointId = this->GetEdgePoint(edge);
+        for (vtkIdType i = this->Offsets[edge] + 1; i < this->Offsets[edge + 1]; i++)
+        {
+          this->SlotPoints[this->Slots[i].Data] = pointId;
+        }
+      }
+    });
+    return maxSlots;
+  }
+
+  // The points of a slot, and the point of its triangle opposite to it
+  vtkIdType GetPoint1(vtkIdType slot) const
+  {
+    return this->Triangles[slot - slot % 3 + (slot + 2) % 3];
+  }
+  vtkIdType GetPoint2(vtkIdType slot) const { return this->Triangles[slot]; }
+  vtkIdType GetOppositePoint(vtkIdType slot) const
+  {
+    return this->Triangles[slot - slot % 3 + (slot + 1) % 3];
+  }
+
+  // The slots of an edge, and its new point
+  vtkIdType GetNumberOfSlots(vtkIdType edge) const
+  {
+    return this->Offsets[edge + 1] - this->Offsets[edge];
+  }
+  vtkIdType GetSlot(vtkIdType edge, vtkIdType i) const
+  {
+    return this->Slots[this->Offsets[edge] + i].Data;
+  }
+  vtkIdType GetEdgePoint(vtkIdType edge) const
+  {
+    return this->SlotPoints[this->GetSlot(edge, 0)];
+  }
+
+  // Split each triangle in 4, as vtkInterpolatingSubdivisionFilter and
+  // vtkApproximatingSubdivisionFilter do.
+  void Subdivide(std::vector<vtkIdType>& newTriangles) const
+  {
+    const vtkIdType numTris = static_cast<vtkIdType>(this->Triangles.size()) / 3;
+    newTriangles.resize(12 * numTris);
+    vtkSMPTools::For(0, numTris, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType t = begin; t < end; t++)
+      {
+        const vtkIdType* pts = this->Triangles.data() + 3 * t;
+        const vtkIdType* edgePts = this->SlotPoints.data() + 3 * t;
+        vtkIdType* newPts = newTriangles.data() + 12 * t;
+        const vtkIdType split[12] = { pts[0], edgePts[1], edgePts[0], edgePts[1], pts[1],
+          edgePts[2], edgePts[2], pts[2], edgePts[0], edgePts[1], edgePts[2], edgePts[0] };
+        std::copy(split, split + 12, newPts);
+      }
+    });
+  }
+};
+
+//------------------------------------------------------------------------------
+// Compute the new point outId as the weighted sum of the points ids of
+// inPts, along with its point data.
+struct vtkSubdivisionPoints
+{
+  vtkPoints* InPoints;
+  vtkPoints* OutPoints;
+  ArrayList Arrays;
+
+  // Allocate numOutPts points, and the point data as vtkSubdivisionFilter
+  // subclasses do (CopyAllocate)
+  vtkSubdivisionPoints(vtkPoints* inPts, vtkPointData* inPD, vtkPoints* outPts,
+    vtkPointData* outPD, vtkIdType numOutPts)
+    : InPoints(inPts)
+    , OutPoints(outPts)
+  {
+    outPts->SetNumberOfPoints(numOutPts);
+    outPD->CopyAllocate(inPD, numOutPts);
+    this->Arrays.AddArrays(numOutPts, inPD, outPD, 0.0, false);
+  }
+
+  void Interpolate(int numIds, const vtkIdType* ids, const double* weights, vtkIdType outId)
+  {
+    double x[3] = { 0.0, 0.0, 0.0 };
+    double xx[3];
+    for (int i = 0; i < numIds; i++)
+    {
+      this->InPoints->GetPoint(ids[i], xx);
+      for (int j = 0; j < 3; j++)
+      {
+        x[j] += xx[j] * weights[i];
+      }
+    }
+    this->OutPoints->SetPoint(outId, x);
+    this->Arrays.WeightedAverage(numIds, ids, weights, outId);
+  }
+
+  void Copy(vtkIdType inId, vtkIdType outId)
+  {
+    double x[3];
+    this->InPoints->GetPoint(inId, x);
+    this->OutPoints->SetPoint(outId, x);
+    this->Arrays.Copy(inId, outId);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Set the final level as the output: the triangles, and the cell data of the
+// input, each input triangle having been split in 4 at each level.
+void vtkSetSubdivisionOutput(vtkPolyData* input, vtkPolyData* output, vtkPoints* points,
+  vtkPointData* pointData, const std::vector<vtkIdType>& triangles, int numberOfLevels)
+{
+  const vtkIdType numTris = static_cast<vtkIdType>(triangles.size()) / 3;
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(3 * numTris);
+  std::copy(triangles.begin(), triangles.end(), connectivity->GetPointer(0));
+  vtkNew<vtkCellArray> polys;
+  polys->SetData(3, connectivity);
+
+  output->SetPoints(points);
+  output->SetPolys(polys);
+  output->GetPointData()->PassData(pointData);
+
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(input->GetCellData(), numTris);
+  ArrayList arrays;
+  arrays.AddArrays(numTris, input->GetCellData(), outCD, 0.0, false);
+  const int shift = 2 * numberOfLevels;
+  vtkSMPTools::For(0, numTris, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; cellId++)
+    {
+      arrays.Copy(cellId >> shift, cellId);
+    }
+  });
+}
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkTriangleSubdivisionInternal.h
@@ -0,0 +1,102 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestIntegrateAttributes.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the integrals of vtkIntegrateAttributes over a unit cube, and that
+// they do not depend on the number of threads.
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkIntegrateAttributes.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+bool Compare(const char* name, double value, double expected, double tolerance)
+{
+  if (std::abs(value - expected) > tolerance)
+  {
+    std::cerr << "Expected " << expected << " for " << name << ", got " << value << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool Integrate(vtkImageData* image, int numberOfThreads, double integrals[3])
+{
+  vtkNew<vtkIntegrateAttributes> integrate;
+  integrate->SetInputData(image);
+  vtkSMPTools::LocalScope(
+    vtkSMPTools::Config{ numberOfThreads }, [&]() { integrate->Update(); });
+  vtkUnstructuredGrid* output = integrate->GetOutput();
+  vtkDataArray* volume = output->GetCellData()->GetArray("Volume");
+  vtkDataArray* x = output->GetPointData()->GetArray("X");
+  vtkDataArray* one = output->GetCellData()->GetArray("One");
+  if (!volume || !x || !one)
+  {
+    std::cerr << "Missing integrated arrays" << std::endl;
+    return false;
+  }
+  integrals[0] = volume->GetTuple1(0);
+  integrals[1] = x->GetTuple1(0);
+  integrals[2] = one->GetTuple1(0);
+  return Compare("the volume", integrals[0], 1.0, 1e-12) &&
+    Compare("the integral of x", integrals[1], 0.5, 1e-12) &&
+    Compare("the integral of 1", integrals[2], 1.0, 1e-12);
+}
+}
+
+int TestIntegrateAttributes(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(101, 101, 101);
+  image->SetSpacing(0.01, 0.01, 0.01);
+
+  vtkNew<vtkDoubleArray> x;
+  x->SetName("X");
+  x->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < image->GetNumberOfPoints(); ++ptId)
+  {
+    x->SetValue(ptId, image->GetPoint(ptId)[0]);
+  }
+  image->GetPointData()->AddArray(x);
+
+  vtkNew<vtkDoubleArray> one;
+  one->SetName("One");
+  one->SetNumberOfTuples(image->GetNumberOfCells());
+  one->Fill(1.0);
+  image->GetCellData()->AddArray(one);
+
+  double serial[3];
+  double threaded[3];
+  if (!Integrate(image, 1, serial) || !Integrate(image, 0, threaded))
+  {
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    if (!Compare("the threaded integral", threaded[i], serial[i], 1e-14))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
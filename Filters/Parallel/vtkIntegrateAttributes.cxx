@@ -21,19 +21,26 @@
 #include "vtkCompositeDataSet.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
-#include "vtkPolygon.h"
-#include "vtkTriangle.h"
+#include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkIntegrateAttributes);
@@ -66,6 +73,531 @@ protected:
   }
 };
 
+namespace
+{
+/**
+ * Neumaier's variant of the Kahan summation, so that the integrals of
+ * hundreds of millions of cells do not depend on the order of the cells.
+ */
+struct CompensatedSum
+{
+  double Sum = 0.0;
+  double Compensation = 0.0;
+
+  void Add(double value)
+  {
+    const double sum = this->Sum + value;
+    if (std::abs(this->Sum) >= std::abs(value))
+    {
+      this->Compensation += (this->Sum - sum) + value;
+    }
+    else
+    {
+      this->Compensation += (value - sum) + this->Sum;
+    }
+    this->Sum = sum;
+  }
+
+  void Add(const CompensatedSum& other)
+  {
+    this->Add(other.Sum);
+    this->Add(other.Compensation);
+  }
+
+  double Get() const { return this->Sum + this->Compensation; }
+};
+
+/**
+ * An input array integrated in the components of the output arrays starting
+ * at Offset.
+ */
+struct IntegratedArray
+{
+  vtkDataArray* Input;
+  size_t Offset;
+  int NumberOfComponents;
+};
+
+/**
+ * Offsets of the components of the output arrays, in the order of the arrays.
+ */
+std::vector<size_t> GetOutputOffsets(vtkDataSetAttributes* outda, size_t& numberOfValues)
+{
+  std::vector<size_t> offsets;
+  numberOfValues = 0;
+  for (int cc = 0; cc < outda->GetNumberOfArrays(); ++cc)
+  {
+    offsets.push_back(numberOfValues);
+    vtkDataArray* array = outda->GetArray(cc);
+    numberOfValues += array ? array->GetNumberOfComponents() : 0;
+  }
+  return offsets;
+}
+
+/**
+ * The input arrays of a block matching the output arrays.
+ */
+template <typename FieldListType>
+std::vector<IntegratedArray> GetIntegratedArrays(FieldListType& fieldList, int index,
+  vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, size_t& numberOfValues)
+{
+  const std::vector<size_t> offsets = GetOutputOffsets(outda, numberOfValues);
+  std::vector<IntegratedArray> arrays;
+  auto f = [&](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
+    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
+    vtkDataArray* outArray = vtkDataArray::FastDownCast(aoutArray);
+    if (inArray && outArray)
+    {
+      for (int cc = 0; cc < outda->GetNumberOfArrays(); ++cc)
+      {
+        if (outda->GetArray(cc) == outArray)
+        {
+          arrays.push_back(IntegratedArray{ inArray, offsets[cc],
+            std::min(inArray->GetNumberOfComponents(), outArray->GetNumberOfComponents()) });
+          break;
+        }
+      }
+    }
+  };
+  fieldList.TransformData(index, inda, outda, f);
+  return arrays;
+}
+
+/**
+ * Integrals of the cells of the highest dimension met so far.
+ */
+struct IntegrationResult
+{
+  int Dimension = 0;
+  CompensatedSum Sum;
+  CompensatedSum SumCenter[3];
+  std::vector<CompensatedSum> PointValues;
+  std::vector<CompensatedSum> CellValues;
+  vtkIdType NumberOfSkippedCells = 0;
+
+  // Throw out the results of a lower dimension. Return true if the cells of
+  // this dimension are integrated.
+  bool CompareDimension(int dim)
+  {
+    if (this->Dimension < dim)
+    {
+      this->Sum = CompensatedSum();
+      std::fill(std::begin(this->SumCenter), std::end(this->SumCenter), CompensatedSum());
+      std::fill(this->PointValues.begin(), this->PointValues.end(), CompensatedSum());
+      std::fill(this->CellValues.begin(), this->CellValues.end(), CompensatedSum());
+      this->Dimension = dim;
+      return true;
+    }
+    return this->Dimension == dim;
+  }
+
+  void Add(const IntegrationResult& other)
+  {
+    this->NumberOfSkippedCells += other.NumberOfSkippedCells;
+    if (!this->CompareDimension(other.Dimension))
+    {
+      return;
+    }
+    this->Sum.Add(other.Sum);
+    for (int i = 0; i < 3; ++i)
+    {
+      this->SumCenter[i].Add(other.SumCenter[i]);
+    }
+    for (size_t i = 0; i < this->PointValues.size(); ++i)
+    {
+      this->PointValues[i].Add(other.PointValues[i]);
+    }
+    for (size_t i = 0; i < this->CellValues.size(); ++i)
+    {
+      this->CellValues[i].Add(other.CellValues[i]);
+    }
+  }
+};
+
+/**
+ * Integrate the cells of a data set with thread local results.
+ */
+class IntegrateCells
+{
+public:
+  IntegrateCells(vtkDataSet* input, const std::vector<IntegratedArray>& pointArrays,
+    size_t numberOfPointValues, const std::vector<IntegratedArray>& cellArrays,
+    size_t numberOfCellValues)
+    : Input(input)
+    , GhostArray(input->GetCellGhostArray())
+    , PointArrays(pointArrays)
+    , CellArrays(cellArrays)
+    , NumberOfPointValues(numberOfPointValues)
+    , NumberOfCellValues(numberOfCellValues)
+  {
+    this->Result.PointValues.resize(numberOfPointValues);
+    this->Result.CellValues.resize(numberOfCellValues);
+  }
+
+  void Initialize()
+  {
+    IntegrationResult& result = this->Results.Local();
+    result.PointValues.resize(this->NumberOfPointValues);
+    result.CellValues.resize(this->NumberOfCellValues);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    IntegrationResult& result = this->Results.Local();
+    vtkIdList* cellPtIds = this->CellPointIds.Local();
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      // Make sure we are not integrating ghost/blanked cells.
+      if (this->GhostArray &&
+        (this->GhostArray->GetValue(cellId) &
+          (vtkDataSetAttributes::DUPLICATECELL | vtkDataSetAttributes::HIDDENCELL)))
+      {
+        continue;
+      }
+
+      switch (this->Input->GetCellType(cellId))
+      {
+        // skip empty or 0D Cells
+        case VTK_EMPTY_CELL:
+        case VTK_VERTEX:
+        case VTK_POLY_VERTEX:
+          break;
+
+        case VTK_POLY_LINE:
+        case VTK_LINE:
+          if (result.CompareDimension(1))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            for (vtkIdType i = 0; i + 1 < cellPtIds->GetNumberOfIds(); ++i)
+            {
+              this->IntegrateLine(result, cellId, cellPtIds->GetId(i), cellPtIds->GetId(i + 1));
+            }
+          }
+          break;
+
+        case VTK_TRIANGLE:
+          if (result.CompareDimension(2))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            this->IntegrateTriangle(
+              result, cellId, cellPtIds->GetId(0), cellPtIds->GetId(1), cellPtIds->GetId(2));
+          }
+          break;
+
+        case VTK_TRIANGLE_STRIP:
+          if (result.CompareDimension(2))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            for (vtkIdType i = 0; i + 2 < cellPtIds->GetNumberOfIds(); ++i)
+            {
+              this->IntegrateTriangle(result, cellId, cellPtIds->GetId(i),
+                cellPtIds->GetId(i + 1), cellPtIds->GetId(i + 2));
+            }
+          }
+          break;
+
+        case VTK_POLYGON:
+          // Works for convex polygons, and interpolation is not correct.
+          if (result.CompareDimension(2))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            for (vtkIdType i = 1; i + 1 < cellPtIds->GetNumberOfIds(); ++i)
+            {
+              this->IntegrateTriangle(result, cellId, cellPtIds->GetId(0), cellPtIds->GetId(i),
+                cellPtIds->GetId(i + 1));
+            }
+          }
+          break;
+
+        case VTK_PIXEL:
+          if (result.CompareDimension(2))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            this->IntegratePixel(result, cellId, cellPtIds);
+          }
+          break;
+
+        case VTK_QUAD:
+          if (result.CompareDimension(2))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            this->IntegrateTriangle(
+              result, cellId, cellPtIds->GetId(0), cellPtIds->GetId(1), cellPtIds->GetId(2));
+            this->IntegrateTriangle(
+              result, cellId, cellPtIds->GetId(0), cellPtIds->GetId(3), cellPtIds->GetId(2));
+          }
+          break;
+
+        case VTK_VOXEL:
+          if (result.CompareDimension(3))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            this->IntegrateVoxel(result, cellId, cellPtIds);
+          }
+          break;
+
+        case VTK_TETRA:
+          if (result.CompareDimension(3))
+          {
+            this->Input->GetCellPoints(cellId, cellPtIds);
+            this->IntegrateTetrahedron(result, cellId, cellPtIds->GetId(0), cellPtIds->GetId(1),
+              cellPtIds->GetId(2), cellPtIds->GetId(3));
+          }
+          break;
+
+        default:
+          this->IntegrateGeneralCell(result, cellId, cellPtIds);
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for (const IntegrationResult& result : this->Results)
+    {
+      this->Result.Add(result);
+    }
+  }
+
+  const IntegrationResult& GetResult() const { return this->Result; }
+
+private:
+  // Add the mean of the point values weighted by k.
+  void AddPointValues(IntegrationResult& result, const vtkIdType* ptIds, int numPts, double k)
+  {
+    for (const IntegratedArray& array : this->PointArrays)
+    {
+      for (int j = 0; j < array.NumberOfComponents; ++j)
+      {
+        double dv = 0.0;
+        for (int i = 0; i < numPts; ++i)
+        {
+          dv += array.Input->GetComponent(ptIds[i], j);
+        }
+        result.PointValues[array.Offset + j].Add((dv / numPts) * k);
+      }
+    }
+  }
+
+  void AddCellValues(IntegrationResult& result, vtkIdType cellId, double k)
+  {
+    for (const IntegratedArray& array : this->CellArrays)
+    {
+      for (int j = 0; j < array.NumberOfComponents; ++j)
+      {
+        result.CellValues[array.Offset + j].Add(array.Input->GetComponent(cellId, j) * k);
+      }
+    }
+  }
+
+  void AddCenter(IntegrationResult& result, const double mid[3], double k)
+  {
+    result.Sum.Add(k);
+    for (int i = 0; i < 3; ++i)
+    {
+      result.SumCenter[i].Add(mid[i] * k);
+    }
+  }
+
+  void IntegrateLine(IntegrationResult& result, vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id)
+  {
+    double pt1[3], pt2[3], mid[3];
+    this->Input->GetPoint(pt1Id, pt1);
+    this->Input->GetPoint(pt2Id, pt2);
+
+    // Compute the length of the line.
+    const double length = std::sqrt(vtkMath::Distance2BetweenPoints(pt1, pt2));
+
+    // Compute the middle, which is really just another attribute.
+    for (int i = 0; i < 3; ++i)
+    {
+      mid[i] = (pt1[i] + pt2[i]) * 0.5;
+    }
+    this->AddCenter(result, mid, length);
+
+    // Now integrate the rest of the attributes.
+    const vtkIdType ptIds[2] = { pt1Id, pt2Id };
+    this->AddPointValues(result, ptIds, 2, length);
+    this->AddCellValues(result, cellId, length);
+  }
+
+  void IntegrateTriangle(IntegrationResult& result, vtkIdType cellId, vtkIdType pt1Id,
+    vtkIdType pt2Id, vtkIdType pt3Id)
+  {
+    double pt1[3], pt2[3], pt3[3];
+    double mid[3], v1[3], v2[3];
+    double cross[3];
+    this->Input->GetPoint(pt1Id, pt1);
+    this->Input->GetPoint(pt2Id, pt2);
+    this->Input->GetPoint(pt3Id, pt3);
+
+    // Compute two legs.
+    for (int i = 0; i < 3; ++i)
+    {
+      v1[i] = pt2[i] - pt1[i];
+      v2[i] = pt3[i] - pt1[i];
+    }
+
+    // Use the cross product to compute the area of the parallelogram.
+    vtkMath::Cross(v1, v2, cross);
+    const double k = std::sqrt(vtkMath::Dot(cross, cross)) * 0.5;
+    if (k == 0.0)
+    {
+      return;
+    }
+
+    // Compute the middle, which is really just another attribute.
+    for (int i = 0; i < 3; ++i)
+    {
+      mid[i] = (pt1[i] + pt2[i] + pt3[i]) / 3.0;
+    }
+    this->AddCenter(result, mid, k);
+
+    // Now integrate the rest of the attributes.
+    const vtkIdType ptIds[3] = { pt1Id, pt2Id, pt3Id };
+    this->AddPointValues(result, ptIds, 3, k);
+    this->AddCellValues(result, cellId, k);
+  }
+
+  // For axis aligned rectangular cells
+  void IntegratePixel(IntegrationResult& result, vtkIdType cellId, vtkIdList* cellPtIds)
+  {
+    double pts[4][3];
+    for (int i = 0; i < 4; ++i)
+    {
+      this->Input->GetPoint(cellPtIds->GetId(i), pts[i]);
+    }
+
+    // get the lengths of its 2 orthogonal sides.  Since only 1 coordinate
+    // can be different we can add the differences in all 3 directions
+    const double l = (pts[0][0] - pts[1][0]) + (pts[0][1] - pts[1][1]) + (pts[0][2] - pts[1][2]);
+    const double w = (pts[0][0] - pts[2][0]) + (pts[0][1] - pts[2][1]) + (pts[0][2] - pts[2][2]);
+    const double a = std::abs(l * w);
+
+    // Compute the middle, which is really just another attribute.
+    double mid[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      mid[i] = (pts[0][i] + pts[1][i] + pts[2][i] + pts[3][i]) * 0.25;
+    }
+    this->AddCenter(result, mid, a);
+
+    // Now integrate the rest of the attributes.
+    this->AddPointValues(result, cellPtIds->GetPointer(0), 4, a);
+    this->AddCellValues(result, cellId, a);
+  }
+
+  void IntegrateTetrahedron(IntegrationResult& result, vtkIdType cellId, vtkIdType pt1Id,
+    vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id)
+  {
+    const vtkIdType ptIds[4] = { pt1Id, pt2Id, pt3Id, pt4Id };
+    double pts[4][3];
+    for (int i = 0; i < 4; ++i)
+    {
+      this->Input->GetPoint(ptIds[i], pts[i]);
+    }
+
+    // Compute the principle vectors around pt0 and the centroid
+    double a[3], b[3], c[3], n[3], mid[3];
+    for (int i = 0; i < 3; i++)
+    {
+      a[i] = pts[1][i] - pts[0][i];
+      b[i] = pts[2][i] - pts[0][i];
+      c[i] = pts[3][i] - pts[0][i];
+      mid[i] = (pts[0][i] + pts[1][i] + pts[2][i] + pts[3][i]) * 0.25;
+    }
+
+    // Calculate the volume of the tet which is 1/6 * the box product
+    vtkMath::Cross(a, b, n);
+    const double v = vtkMath::Dot(c, n) / 6.0;
+    this->AddCenter(result, mid, v);
+
+    this->AddCellValues(result, cellId, v);
+    this->AddPointValues(result, ptIds, 4, v);
+  }
+
+  // For axis aligned hexahedral cells
+  void IntegrateVoxel(IntegrationResult& result, vtkIdType cellId, vtkIdList* cellPtIds)
+  {
+    double pts[8][3];
+    for (int i = 0; i < 8; ++i)
+    {
+      this->Input->GetPoint(cellPtIds->GetId(i), pts[i]);
+    }
+
+    // Calculate the volume of the voxel
+    const double l = pts[1][0] - pts[0][0];
+    const double w = pts[2][1] - pts[0][1];
+    const double h = pts[4][2] - pts[0][2];
+    const double v = std::abs(l * w * h);
+
+    // Compute the middle, which is really just another attribute.
+    double mid[3] = { 0.0, 0.0, 0.0 };
+    for (int i = 0; i < 8; ++i)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        mid[j] += pts[i][j] * 0.125;
+      }
+    }
+    this->AddCenter(result, mid, v);
+
+    this->AddCellValues(result, cellId, v);
+    this->AddPointValues(result, cellPtIds->GetPointer(0), 8, v);
+  }
+
+  // Triangulate the cells of other types.
+  void IntegrateGeneralCell(IntegrationResult& result, vtkIdType cellId, vtkIdList* ptIds)
+  {
+    vtkGenericCell* cell = this->Cells.Local();
+    this->Input->GetCell(cellId, cell);
+    const int cellDim = cell->GetCellDimension();
+    if (cellDim == 0 || !result.CompareDimension(cellDim))
+    {
+      return;
+    }
+
+    // There should be a number of points that is a multiple of the number of
+    // points of the simplices from the triangulation
+    cell->Triangulate(1, ptIds, this->CellPoints.Local());
+    const vtkIdType nPnts = ptIds->GetNumberOfIds();
+    if (cellDim > 3 || nPnts % (cellDim + 1))
+    {
+      ++result.NumberOfSkippedCells;
+      return;
+    }
+    const vtkIdType* ids = ptIds->GetPointer(0);
+    for (vtkIdType i = 0; i < nPnts; i += cellDim + 1)
+    {
+      switch (cellDim)
+      {
+        case 1:
+          this->IntegrateLine(result, cellId, ids[i], ids[i + 1]);
+          break;
+        case 2:
+          this->IntegrateTriangle(result, cellId, ids[i], ids[i + 1], ids[i + 2]);
+          break;
+        default:
+          this->IntegrateTetrahedron(result, cellId, ids[i], ids[i + 1], ids[i + 2], ids[i + 3]);
+      }
+    }
+  }
+
+  vtkDataSet* Input;
+  vtkUnsignedCharArray* GhostArray;
+  const std::vector<IntegratedArray>& PointArrays;
+  const std::vector<IntegratedArray>& CellArrays;
+  size_t NumberOfPointValues;
+  size_t NumberOfCellValues;
+
+  vtkSMPThreadLocal<IntegrationResult> Results;
+  vtkSMPThreadLocalObject<vtkIdList> CellPointIds;
+  vtkSMPThreadLocalObject<vtkGenericCell> Cells;
+  vtkSMPThreadLocalObject<vtkPoints> CellPoints;
+  IntegrationResult Result;
+};
+}
+
 //------------------------------------------------------------------------------
 vtkIntegrateAttributes::vtkIntegrateAttributes()
 {
@@ -74,10 +606,6 @@ vtkIntegrateAttributes::vtkIntegrateAttributes()
   this->SumCenter[0] = this->SumCenter[1] = this->SumCenter[2] = 0.0;
   this->Controller = nullptr;
 
-  this->PointFieldList = nullptr;
-  this->CellFieldList = nullptr;
-  this->FieldListIndex = 0;
-
   this->DivideAllCellDataByVolume = false;
 
   this->SetController(vtkMultiProcessController::GetGlobalController());
@@ -128,179 +656,54 @@ void vtkIntegrateAttributes::ExecuteBlock(vtkDataSet* input, vtkUnstructuredGrid
   int fieldset_index, vtkIntegrateAttributes::vtkFieldList& pdList,
   vtkIntegrateAttributes::vtkFieldList& cdList)
 {
-  vtkUnsignedCharArray* ghostArray = input->GetCellGhostArray();
-
-  // This is sort of a hack since it's incredibly painful to change all the
-  // signatures to take the pdList, cdList and fieldset_index.
-  this->PointFieldList = &pdList;
-  this->CellFieldList = &cdList;
-  this->FieldListIndex = fieldset_index;
-
-  vtkIdList* cellPtIds = vtkIdList::New();
-  vtkIdType numCells = input->GetNumberOfCells();
-  vtkIdType cellId;
-  vtkPoints* cellPoints = nullptr; // needed if we need to split 3D cells
-  int cellType;
-  for (cellId = 0; cellId < numCells; ++cellId)
+  const vtkIdType numCells = input->GetNumberOfCells();
+  if (numCells == 0)
   {
-    cellType = input->GetCellType(cellId);
-    // Make sure we are not integrating ghost/blanked cells.
-    if (ghostArray &&
-      (ghostArray->GetValue(cellId) &
-        (vtkDataSetAttributes::DUPLICATECELL | vtkDataSetAttributes::HIDDENCELL)))
-    {
-      continue;
-    }
+    return;
+  }
+  // Make the later calls to GetCell and GetCellPoints thread safe.
+  vtkNew<vtkGenericCell> cell;
+  input->GetCell(0, cell);
+
+  size_t numPointValues = 0;
+  size_t numCellValues = 0;
+  const std::vector<IntegratedArray> pointArrays = GetIntegratedArrays(
+    pdList, fieldset_index, input->GetPointData(), output->GetPointData(), numPointValues);
+  const std::vector<IntegratedArray> cellArrays = GetIntegratedArrays(
+    cdList, fieldset_index, input->GetCellData(), output->GetCellData(), numCellValues);
+
+  IntegrateCells integrate(input, pointArrays, numPointValues, cellArrays, numCellValues);
+  vtkSMPTools::For(0, numCells, integrate);
+  const IntegrationResult& result = integrate.GetResult();
+  if (result.NumberOfSkippedCells > 0)
+  {
+    vtkWarningMacro("Skipped " << result.NumberOfSkippedCells
+                               << " cells with an unexpected triangulation.");
+  }
 
-    switch (cellType)
+  // Add the integrals of this block to the ones of the previous blocks.
+  if (result.Dimension == 0 || !this->CompareIntegrationDimension(output, result.Dimension))
+  {
+    return;
+  }
+  this->Sum += result.Sum.Get();
+  for (int i = 0; i < 3; ++i)
+  {
+    this->SumCenter[i] += result.SumCenter[i].Get();
+  }
+  auto addValues = [](vtkDataSetAttributes* outda, const std::vector<CompensatedSum>& values) {
+    size_t offset = 0;
+    for (int cc = 0; cc < outda->GetNumberOfArrays(); ++cc)
     {
-      // skip empty or 0D Cells
-      case VTK_EMPTY_CELL:
-      case VTK_VERTEX:
-      case VTK_POLY_VERTEX:
-        break;
-
-      case VTK_POLY_LINE:
-      case VTK_LINE:
+      vtkDataArray* outArray = outda->GetArray(cc);
+      for (int j = 0; outArray && j < outArray->GetNumberOfComponents(); ++j)
       {
-        if (this->CompareIntegrationDimension(output, 1))
-        {
-          input->GetCellPoints(cellId, cellPtIds);
-          this->IntegratePolyLine(input, output, cellId, cellPtIds);
-        }
-      }
-      break;
-
-      case VTK_TRIANGLE:
-      {
-        if (this->CompareIntegrationDimension(output, 2))
-        {
-          input->GetCellPoints(cellId, cellPtIds);
-          this->IntegrateTriangle(
-            input, output, cellId, cellPtIds->GetId(0), cellPtIds->GetId(1), cellPtIds->GetId(2));
-        }
-      }
-      break;
-
-      case VTK_TRIANGLE_STRIP:
-      {
-        if (this->CompareIntegrationDimension(output, 2))
-        {
-          input->GetCellPoints(cellId, cellPtIds);
-          this->IntegrateTriangleStrip(input, output, cellId, cellPtIds);
-        }
-      }
-      break;
-
-      case VTK_POLYGON:
-      {
-        if (this->CompareIntegrationDimension(output, 2))
-        {
-          input->GetCellPoints(cellId, cellPtIds);
-          this->IntegratePolygon(input, output, cellId, cellPtIds);
-        }
-      }
-      break;
-
-      case VTK_PIXEL:
-      {
-        if (this->CompareIntegrationDimension(output, 2))
-        {
-          input->GetCellPoints(cellId, cellPtIds);
-          this->IntegratePixel(input, output, cellId, cellPtIds);
-        }
-      }
-      break;
-
-      case VTK_QUAD:
-      {
-        if (this->CompareIntegrationDimension(output, 2))
-        {
-          vtkIdType pt1Id, pt2Id, pt3Id;
-          input->GetCellPoints(cellId, cellPtIds);
-          pt1Id = cellPtIds->GetId(0);
-          pt2Id = cellPtIds->GetId(1);
-          pt3Id = cellPtIds->GetId(2);
-          this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id);
-          pt2Id = cellPtIds->GetId(3);
-          this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id);
-        }
-      }
-      break;
-
-      case VTK_VOXEL:
-      {
-        if (this->CompareIntegrationDimension(output, 3))
-        {
-          input->GetCellPoints(cellId, cellPtIds);
-          this->IntegrateVoxel(input, output, cellId, cellPtIds);
-        }
-      }
-      break;
-
-      case VTK_TETRA:
-      {
-        if (this->CompareIntegrationDimension(output, 3))
-        {
-          vtkIdType pt1Id, pt2Id, pt3Id, pt4Id;
-          input->GetCellPoints(cellId, cellPtIds);
-          pt1Id = cellPtIds->GetId(0);
-          pt2Id = cellPtIds->GetId(1);
-          pt3Id = cellPtIds->GetId(2);
-          pt4Id = cellPtIds->GetId(3);
-          this->IntegrateTetrahedron(input, output, cellId, pt1Id, pt2Id, pt3Id, pt4Id);
-        }
-      }
-      break;
-
-      default:
-      {
-        // We need to explicitly get the cell
-        vtkCell* cell = input->GetCell(cellId);
-        int cellDim = cell->GetCellDimension();
-        if (cellDim == 0)
-        {
-          continue;
-        }
-        if (!this->CompareIntegrationDimension(output, cellDim))
-        {
-          continue;
-        }
-
-        // We will need a place to store points from the cell's
-        // triangulate function
-        if (!cellPoints)
-        {
-          cellPoints = vtkPoints::New();
-        }
-
-        cell->Triangulate(1, cellPtIds, cellPoints);
-        switch (cellDim)
-        {
-          case 1:
-            this->IntegrateGeneral1DCell(input, output, cellId, cellPtIds);
-            break;
-          case 2:
-            this->IntegrateGeneral2DCell(input, output, cellId, cellPtIds);
-            break;
-          case 3:
-            this->IntegrateGeneral3DCell(input, output, cellId, cellPtIds);
-            break;
-          default:
-            vtkWarningMacro("Unsupported Cell Dimension = " << cellDim);
-        }
+        outArray->SetComponent(0, j, outArray->GetComponent(0, j) + values[offset++].Get());
       }
     }
-  }
-  cellPtIds->Delete();
-  if (cellPoints)
-  {
-    cellPoints->Delete();
-  }
-
-  this->PointFieldList = nullptr;
-  this->CellFieldList = nullptr;
-  this->FieldListIndex = 0;
+  };
+  addValues(output->GetPointData(), result.PointValues);
+  addValues(output->GetCellData(), result.CellValues);
 }
 
 //------------------------------------------------------------------------------
@@ -463,23 +866,24 @@ int vtkIntegrateAttributes::RequestData(
     }
     return 1;
   }
-  if (processId > 0)
+
+  // Sum the pieces along a binary tree rooted at process 0, so that each
+  // process receives at most log2(numProcs) pieces.
+  for (int step = 1; step < numProcs; step *= 2)
   {
-    if (processId != globalMin)
+    if (processId % (2 * step) == step)
     {
-      this->SendPiece(output);
+      this->SendPiece(output, processId - step);
+      break;
     }
-  }
-  else
-  {
-    for (int id = 1; id < numProcs; ++id)
+    if (processId + step < numProcs)
     {
-      if (id != globalMin)
-      {
-        this->ReceivePiece(output, id);
-      }
+      this->ReceivePiece(output, processId + step);
     }
+  }
 
+  if (processId == 0)
+  {
     // now that we have all of the sums from each process
     // set the point location with the global value
     if (this->Sum != 0.0)
@@ -530,7 +934,7 @@ int vtkIntegrateAttributes::PieceNodeMinToNode0(vtkUnstructuredGrid* data)
   return globalMin;
 }
 
-void vtkIntegrateAttributes::SendPiece(vtkUnstructuredGrid* src)
+void vtkIntegrateAttributes::SendPiece(vtkUnstructuredGrid* src, int toId)
 {
   assert(this->Controller);
   double msg[5];
@@ -539,10 +943,14 @@ void vtkIntegrateAttributes::SendPiece(vtkUnstructuredGrid* src)
   msg[2] = this->SumCenter[0];
   msg[3] = this->SumCenter[1];
   msg[4] = this->SumCenter[2];
-  this->Controller->Send(msg, 5, 0, vtkIntegrateAttributes::IntegrateAttrInfo);
-  this->Controller->Send(src, 0, vtkIntegrateAttributes::IntegrateAttrData);
-  // Done sending.  Reset src so satellites will have empty data.
+  this->Controller->Send(msg, 5, toId, vtkIntegrateAttributes::IntegrateAttrInfo);
+  this->Controller->Send(src, toId, vtkIntegrateAttributes::IntegrateAttrData);
+  // Done sending.  Reset src so satellites will have empty data, and the
+  // sums so that they are not sent twice.
   src->Initialize();
+  this->Sum = 0.0;
+  this->SumCenter[0] = this->SumCenter[1] = this->SumCenter[2] = 0.0;
+  this->IntegrationDimension = 0;
 }
 
 void vtkIntegrateAttributes::ReceivePiece(vtkUnstructuredGrid* mergeTo, int fromId)
@@ -606,113 +1014,6 @@ void vtkIntegrateAttributes::ZeroAttributes(vtkDataSetAttributes* outda)
     }
   }
 }
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegrateData1(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-  vtkIdType pt1Id, double k, vtkIntegrateAttributes::vtkFieldList& fieldList, int index)
-{
-  auto f = [pt1Id, k](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDataArray* outArray = vtkDataArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
-    {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double dv = vIn1;
-        const double vOut = (dv * k) + outArray->GetComponent(0, j);
-        outArray->SetComponent(0, j, vOut);
-      }
-    }
-  };
-
-  fieldList.TransformData(index, inda, outda, f);
-}
-
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegrateData2(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-  vtkIdType pt1Id, vtkIdType pt2Id, double k, vtkIntegrateAttributes::vtkFieldList& fieldList,
-  int index)
-{
-  auto f = [pt1Id, pt2Id, k](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDataArray* outArray = vtkDataArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
-    {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double vIn2 = inArray->GetComponent(pt2Id, j);
-        const double dv = 0.5 * (vIn1 + vIn2);
-        const double vOut = (dv * k) + outArray->GetComponent(0, j);
-        outArray->SetComponent(0, j, vOut);
-      }
-    }
-  };
-
-  fieldList.TransformData(index, inda, outda, f);
-}
-
-//------------------------------------------------------------------------------
-// Is the extra performance worth duplicating this code with IntergrateData2.
-void vtkIntegrateAttributes::IntegrateData3(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-  vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, double k,
-  vtkIntegrateAttributes::vtkFieldList& fieldList, int index)
-{
-  auto f = [pt1Id, pt2Id, pt3Id, k](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDataArray* outArray = vtkDataArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
-    {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double vIn2 = inArray->GetComponent(pt2Id, j);
-        const double vIn3 = inArray->GetComponent(pt3Id, j);
-        const double dv = (vIn1 + vIn2 + vIn3) / 3.0;
-        const double vOut = (dv * k) + outArray->GetComponent(0, j);
-        outArray->SetComponent(0, j, vOut);
-      }
-    }
-  };
-  fieldList.TransformData(index, inda, outda, f);
-}
-
-//------------------------------------------------------------------------------
-// Is the extra performance worth duplicating this code with IntergrateData2.
-void vtkIntegrateAttributes::IntegrateData4(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-  vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id, double k,
-  vtkIntegrateAttributes::vtkFieldList& fieldList, int index)
-{
-  auto f = [pt1Id, pt2Id, pt3Id, pt4Id, k](
-             vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDataArray* outArray = vtkDataArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
-    {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double vIn2 = inArray->GetComponent(pt2Id, j);
-        const double vIn3 = inArray->GetComponent(pt3Id, j);
-        const double vIn4 = inArray->GetComponent(pt4Id, j);
-        const double dv = (vIn1 + vIn2 + vIn3 + vIn4) * 0.25;
-        const double vOut = (dv * k) + outArray->GetComponent(0, j);
-        outArray->SetComponent(0, j, vOut);
-      }
-    }
-  };
-
-  fieldList.TransformData(index, inda, outda, f);
-}
-
 //------------------------------------------------------------------------------
 // Used to sum arrays from all processes.
 void vtkIntegrateAttributes::IntegrateSatelliteData(
@@ -760,378 +1061,6 @@ void vtkIntegrateAttributes::IntegrateSatelliteData(
   }
 }
 
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegratePolyLine(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* ptIds)
-{
-  double length;
-  double pt1[3], pt2[3], mid[3];
-  vtkIdType numLines, lineIdx;
-  vtkIdType pt1Id, pt2Id;
-
-  numLines = ptIds->GetNumberOfIds() - 1;
-  for (lineIdx = 0; lineIdx < numLines; ++lineIdx)
-  {
-    pt1Id = ptIds->GetId(lineIdx);
-    pt2Id = ptIds->GetId(lineIdx + 1);
-    input->GetPoint(pt1Id, pt1);
-    input->GetPoint(pt2Id, pt2);
-
-    // Compute the length of the line.
-    length = sqrt(vtkMath::Distance2BetweenPoints(pt1, pt2));
-    this->Sum += length;
-
-    // Compute the middle, which is really just another attribute.
-    mid[0] = (pt1[0] + pt2[0]) * 0.5;
-    mid[1] = (pt1[1] + pt2[1]) * 0.5;
-    mid[2] = (pt1[2] + pt2[2]) * 0.5;
-    // Add weighted to sumCenter.
-    this->SumCenter[0] += mid[0] * length;
-    this->SumCenter[1] += mid[1] * length;
-    this->SumCenter[2] += mid[2] * length;
-
-    // Now integrate the rest of the attributes.
-    this->IntegrateData2(input->GetPointData(), output->GetPointData(), pt1Id, pt2Id, length,
-      *this->PointFieldList, this->FieldListIndex);
-    this->IntegrateData1(input->GetCellData(), output->GetCellData(), cellId, length,
-      *this->CellFieldList, this->FieldListIndex);
-  }
-}
-
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegrateGeneral1DCell(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* ptIds)
-{
-  // Determine the number of lines
-  vtkIdType nPnts = ptIds->GetNumberOfIds();
-  // There should be an even number of points from the triangulation
-  if (nPnts % 2)
-  {
-    vtkWarningMacro("Odd number of points(" << nPnts << ")  encountered - skipping "
-                                            << " 1D Cell: " << cellId);
-    return;
-  }
-
-  double length;
-  double pt1[3], pt2[3], mid[3];
-  vtkIdType pid = 0;
-  vtkIdType pt1Id, pt2Id;
-
-  while (pid < nPnts)
-  {
-    pt1Id = ptIds->GetId(pid++);
-    pt2Id = ptIds->GetId(pid++);
-    input->GetPoint(pt1Id, pt1);
-    input->GetPoint(pt2Id, pt2);
-
-    // Compute the length of the line.
-    length = sqrt(vtkMath::Distance2BetweenPoints(pt1, pt2));
-    this->Sum += length;
-
-    // Compute the middle, which is really just another attribute.
-    mid[0] = (pt1[0] + pt2[0]) * 0.5;
-    mid[1] = (pt1[1] + pt2[1]) * 0.5;
-    mid[2] = (pt1[2] + pt2[2]) * 0.5;
-    // Add weighted to sumCenter.
-    this->SumCenter[0] += mid[0] * length;
-    this->SumCenter[1] += mid[1] * length;
-    this->SumCenter[2] += mid[2] * length;
-
-    // Now integrate the rest of the attributes.
-    this->IntegrateData2(input->GetPointData(), output->GetPointData(), pt1Id, pt2Id, length,
-      *this->PointFieldList, this->FieldListIndex);
-    this->IntegrateData1(input->GetCellData(), output->GetCellData(), cellId, length,
-      *this->CellFieldList, this->FieldListIndex);
-  }
-}
-
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegrateTriangleStrip(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* ptIds)
-{
-  vtkIdType numTris, triIdx;
-  vtkIdType pt1Id, pt2Id, pt3Id;
-
-  numTris = ptIds->GetNumberOfIds() - 2;
-  for (triIdx = 0; triIdx < numTris; ++triIdx)
-  {
-    pt1Id = ptIds->GetId(triIdx);
-    pt2Id = ptIds->GetId(triIdx + 1);
-    pt3Id = ptIds->GetId(triIdx + 2);
-    this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id);
-  }
-}
-
-//------------------------------------------------------------------------------
-// Works for convex polygons, and interpoaltion is not correct.
-void vtkIntegrateAttributes::IntegratePolygon(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* ptIds)
-{
-  vtkIdType numTris, triIdx;
-  vtkIdType pt1Id, pt2Id, pt3Id;
-
-  numTris = ptIds->GetNumberOfIds() - 2;
-  pt1Id = ptIds->GetId(0);
-  for (triIdx = 0; triIdx < numTris; ++triIdx)
-  {
-    pt2Id = ptIds->GetId(triIdx + 1);
-    pt3Id = ptIds->GetId(triIdx + 2);
-    this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id);
-  }
-}
-
-//------------------------------------------------------------------------------
-// For axis aligned rectangular cells
-void vtkIntegrateAttributes::IntegratePixel(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds)
-{
-  vtkIdType pt1Id, pt2Id, pt3Id, pt4Id;
-  double pts[4][3];
-  pt1Id = cellPtIds->GetId(0);
-  pt2Id = cellPtIds->GetId(1);
-  pt3Id = cellPtIds->GetId(2);
-  pt4Id = cellPtIds->GetId(3);
-  input->GetPoint(pt1Id, pts[0]);
-  input->GetPoint(pt2Id, pts[1]);
-  input->GetPoint(pt3Id, pts[2]);
-  input->GetPoint(pt4Id, pts[3]);
-
-  double l, w, a, mid[3];
-
-  // get the lengths of its 2 orthogonal sides.  Since only 1 coordinate
-  // can be different we can add the differences in all 3 directions
-  l = (pts[0][0] - pts[1][0]) + (pts[0][1] - pts[1][1]) + (pts[0][2] - pts[1][2]);
-
-  w = (pts[0][0] - pts[2][0]) + (pts[0][1] - pts[2][1]) + (pts[0][2] - pts[2][2]);
-
-  a = fabs(l * w);
-  this->Sum += a;
-  // Compute the middle, which is really just another attribute.
-  mid[0] = (pts[0][0] + pts[1][0] + pts[2][0] + pts[3][0]) * 0.25;
-  mid[1] = (pts[0][1] + pts[1][1] + pts[2][1] + pts[3][1]) * 0.25;
-  mid[2] = (pts[0][2] + pts[1][2] + pts[2][2] + pts[3][2]) * 0.25;
-  // Add weighted to sumCenter.
-  this->SumCenter[0] += mid[0] * a;
-  this->SumCenter[1] += mid[1] * a;
-  this->SumCenter[2] += mid[2] * a;
-
-  // Now integrate the rest of the attributes.
-  this->IntegrateData4(input->GetPointData(), output->GetPointData(), pt1Id, pt2Id, pt3Id, pt4Id, a,
-    *this->PointFieldList, this->FieldListIndex);
-  this->IntegrateData1(input->GetCellData(), output->GetCellData(), cellId, a, *this->CellFieldList,
-    this->FieldListIndex);
-}
-
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegrateTriangle(vtkDataSet* input, vtkUnstructuredGrid* output,
-  vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id)
-{
-  double pt1[3], pt2[3], pt3[3];
-  double mid[3], v1[3], v2[3];
-  double cross[3];
-  double k;
-
-  input->GetPoint(pt1Id, pt1);
-  input->GetPoint(pt2Id, pt2);
-  input->GetPoint(pt3Id, pt3);
-
-  // Compute two legs.
-  v1[0] = pt2[0] - pt1[0];
-  v1[1] = pt2[1] - pt1[1];
-  v1[2] = pt2[2] - pt1[2];
-  v2[0] = pt3[0] - pt1[0];
-  v2[1] = pt3[1] - pt1[1];
-  v2[2] = pt3[2] - pt1[2];
-
-  // Use the cross product to compute the area of the parallelogram.
-  vtkMath::Cross(v1, v2, cross);
-  k = sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]) * 0.5;
-
-  if (k == 0.0)
-  {
-    return;
-  }
-  this->Sum += k;
-
-  // Compute the middle, which is really just another attribute.
-  mid[0] = (pt1[0] + pt2[0] + pt3[0]) / 3.0;
-  mid[1] = (pt1[1] + pt2[1] + pt3[1]) / 3.0;
-  mid[2] = (pt1[2] + pt2[2] + pt3[2]) / 3.0;
-  // Add weighted to sumCenter.
-  this->SumCenter[0] += mid[0] * k;
-  this->SumCenter[1] += mid[1] * k;
-  this->SumCenter[2] += mid[2] * k;
-
-  // Now integrate the rest of the attributes.
-  this->IntegrateData3(input->GetPointData(), output->GetPointData(), pt1Id, pt2Id, pt3Id, k,
-    *this->PointFieldList, this->FieldListIndex);
-  this->IntegrateData1(input->GetCellData(), output->GetCellData(), cellId, k, *this->CellFieldList,
-    this->FieldListIndex);
-}
-
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegrateGeneral2DCell(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* ptIds)
-{
-  vtkIdType nPnts = ptIds->GetNumberOfIds();
-  // There should be a number of points that is a multiple of 3
-  // from the triangulation
-  if (nPnts % 3)
-  {
-    vtkWarningMacro("Number of points (" << nPnts << ") is not divisiable by 3 - skipping "
-                                         << " 2D Cell: " << cellId);
-    return;
-  }
-
-  vtkIdType triIdx = 0;
-  vtkIdType pt1Id, pt2Id, pt3Id;
-
-  while (triIdx < nPnts)
-  {
-    pt1Id = ptIds->GetId(triIdx++);
-    pt2Id = ptIds->GetId(triIdx++);
-    pt3Id = ptIds->GetId(triIdx++);
-    this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id);
-  }
-}
-
-//------------------------------------------------------------------------------
-// For Tetrahedral cells
-void vtkIntegrateAttributes::IntegrateTetrahedron(vtkDataSet* input, vtkUnstructuredGrid* output,
-  vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id)
-{
-  double pts[4][3];
-  input->GetPoint(pt1Id, pts[0]);
-  input->GetPoint(pt2Id, pts[1]);
-  input->GetPoint(pt3Id, pts[2]);
-  input->GetPoint(pt4Id, pts[3]);
-
-  double a[3], b[3], c[3], n[3], v, mid[3];
-  int i;
-  // Compute the principle vectors around pt0 and the
-  // centroid
-  for (i = 0; i < 3; i++)
-  {
-    a[i] = pts[1][i] - pts[0][i];
-    b[i] = pts[2][i] - pts[0][i];
-    c[i] = pts[3][i] - pts[0][i];
-    mid[i] = (pts[0][i] + pts[1][i] + pts[2][i] + pts[3][i]) * 0.25;
-  }
-
-  // Calculate the volume of the tet which is 1/6 * the box product
-  vtkMath::Cross(a, b, n);
-  v = vtkMath::Dot(c, n) / 6.0;
-  this->Sum += v;
-
-  // Add weighted to sumCenter.
-  this->SumCenter[0] += mid[0] * v;
-  this->SumCenter[1] += mid[1] * v;
-  this->SumCenter[2] += mid[2] * v;
-
-  // Integrate the attributes on the cell itself
-  this->IntegrateData1(input->GetCellData(), output->GetCellData(), cellId, v, *this->CellFieldList,
-    this->FieldListIndex);
-
-  // Integrate the attributes associated with the points
-  this->IntegrateData4(input->GetPointData(), output->GetPointData(), pt1Id, pt2Id, pt3Id, pt4Id, v,
-    *this->PointFieldList, this->FieldListIndex);
-}
-
-//------------------------------------------------------------------------------
-// For axis aligned hexahedral cells
-void vtkIntegrateAttributes::IntegrateVoxel(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds)
-{
-  vtkIdType pt1Id, pt2Id, pt3Id, pt4Id, pt5Id;
-  double pts[5][3];
-  pt1Id = cellPtIds->GetId(0);
-  pt2Id = cellPtIds->GetId(1);
-  pt3Id = cellPtIds->GetId(2);
-  pt4Id = cellPtIds->GetId(3);
-  pt5Id = cellPtIds->GetId(4);
-  input->GetPoint(pt1Id, pts[0]);
-  input->GetPoint(pt2Id, pts[1]);
-  input->GetPoint(pt3Id, pts[2]);
-  input->GetPoint(pt4Id, pts[3]);
-  input->GetPoint(pt5Id, pts[4]);
-
-  double l, w, h, v, mid[3];
-
-  // Calculate the volume of the voxel
-  l = pts[1][0] - pts[0][0];
-  w = pts[2][1] - pts[0][1];
-  h = pts[4][2] - pts[0][2];
-  v = fabs(l * w * h);
-  this->Sum += v;
-
-  // Partially Compute the middle, which is really just another attribute.
-  mid[0] = (pts[0][0] + pts[1][0] + pts[2][0] + pts[3][0]) * 0.125;
-  mid[1] = (pts[0][1] + pts[1][1] + pts[2][1] + pts[3][1]) * 0.125;
-  mid[2] = (pts[0][2] + pts[1][2] + pts[2][2] + pts[3][2]) * 0.125;
-
-  // Integrate the attributes on the cell itself
-  this->IntegrateData1(input->GetCellData(), output->GetCellData(), cellId, v, *this->CellFieldList,
-    this->FieldListIndex);
-
-  // Integrate the attributes associated with the points on the bottom face
-  // note that since IntegrateData4 is going to weigh everything by 1/4
-  // we need to pass down 1/2 the volume so they will be weighted by 1/8
-
-  this->IntegrateData4(input->GetPointData(), output->GetPointData(), pt1Id, pt2Id, pt3Id, pt4Id,
-    v * 0.5, *this->PointFieldList, this->FieldListIndex);
-
-  // Now process the top face points
-  pt1Id = cellPtIds->GetId(5);
-  pt2Id = cellPtIds->GetId(6);
-  pt3Id = cellPtIds->GetId(7);
-  input->GetPoint(pt1Id, pts[0]);
-  input->GetPoint(pt2Id, pts[1]);
-  input->GetPoint(pt3Id, pts[2]);
-  // Finish Computing the middle, which is really just another attribute.
-  mid[0] += (pts[0][0] + pts[1][0] + pts[2][0] + pts[4][0]) * 0.125;
-  mid[1] += (pts[0][1] + pts[1][1] + pts[2][1] + pts[4][1]) * 0.125;
-  mid[2] += (pts[0][2] + pts[1][2] + pts[2][2] + pts[4][2]) * 0.125;
-
-  // Add weighted to sumCenter.
-  this->SumCenter[0] += mid[0] * v;
-  this->SumCenter[1] += mid[1] * v;
-  this->SumCenter[2] += mid[2] * v;
-
-  // Integrate the attributes associated with the points on the top face
-  // note that since IntegrateData4 is going to weigh everything by 1/4
-  // we need to pass down 1/2 the volume so they will be weighted by 1/8
-  this->IntegrateData4(input->GetPointData(), output->GetPointData(), pt1Id, pt2Id, pt3Id, pt5Id,
-    v * 0.5, *this->PointFieldList, this->FieldListIndex);
-}
-
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::IntegrateGeneral3DCell(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* ptIds)
-{
-
-  vtkIdType nPnts = ptIds->GetNumberOfIds();
-  // There should be a number of points that is a multiple of 4
-  // from the triangulation
-  if (nPnts % 4)
-  {
-    vtkWarningMacro("Number of points (" << nPnts << ") is not divisiable by 4 - skipping "
-                                         << " 3D Cell: " << cellId);
-    return;
-  }
-
-  vtkIdType tetIdx = 0;
-  vtkIdType pt1Id, pt2Id, pt3Id, pt4Id;
-
-  while (tetIdx < nPnts)
-  {
-    pt1Id = ptIds->GetId(tetIdx++);
-    pt2Id = ptIds->GetId(tetIdx++);
-    pt3Id = ptIds->GetId(tetIdx++);
-    pt4Id = ptIds->GetId(tetIdx++);
-    this->IntegrateTetrahedron(input, output, cellId, pt1Id, pt2Id, pt3Id, pt4Id);
-  }
-}
-
 //------------------------------------------------------------------------------
 void vtkIntegrateAttributes::DivideDataArraysByConstant(
   vtkDataSetAttributes* data, bool skipLastArray, double sum)
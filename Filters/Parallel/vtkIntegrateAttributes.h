@@ -23,6 +23,11 @@
  * The output of this filter is a single point and vertex.  The attributes
  * for this point and cell will contain the integration results
  * for the corresponding input attributes.
+ *
+ * The cells are integrated in parallel with vtkSMPTools, with compensated
+ * sums so that the results barely depend on the number of threads. The
+ * results of the processes are summed along a binary tree rooted at process
+ * 0.
  */
 
 #ifndef vtkIntegrateAttributes_h
@@ -88,30 +93,10 @@ protected:
 
   bool DivideAllCellDataByVolume;
 
-  void IntegratePolyLine(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
-  void IntegratePolygon(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
-  void IntegrateTriangleStrip(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
-  void IntegrateTriangle(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id);
-  void IntegrateTetrahedron(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id);
-  void IntegratePixel(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
-  void IntegrateVoxel(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
-  void IntegrateGeneral1DCell(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
-  void IntegrateGeneral2DCell(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
-  void IntegrateGeneral3DCell(
-    vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdList* cellPtIds);
   void IntegrateSatelliteData(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda);
   void ZeroAttributes(vtkDataSetAttributes* outda);
   int PieceNodeMinToNode0(vtkUnstructuredGrid* data);
-  void SendPiece(vtkUnstructuredGrid* src);
+  void SendPiece(vtkUnstructuredGrid* src, int toId = 0);
   void ReceivePiece(vtkUnstructuredGrid* mergeTo, int fromId);
 
   // This function assumes the data is in the format of the output of this filter with one
@@ -126,24 +111,11 @@ private:
   void operator=(const vtkIntegrateAttributes&) = delete;
 
   class vtkFieldList;
-  vtkFieldList* CellFieldList;
-  vtkFieldList* PointFieldList;
-  int FieldListIndex;
 
   void AllocateAttributes(vtkFieldList& fieldList, vtkDataSetAttributes* outda);
   void ExecuteBlock(vtkDataSet* input, vtkUnstructuredGrid* output, int fieldset_index,
     vtkFieldList& pdList, vtkFieldList& cdList);
 
-  void IntegrateData1(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id,
-    double k, vtkFieldList& fieldlist, int fieldlist_index);
-  void IntegrateData2(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id,
-    vtkIdType pt2Id, double k, vtkFieldList& fieldlist, int fieldlist_index);
-  void IntegrateData3(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id,
-    vtkIdType pt2Id, vtkIdType pt3Id, double k, vtkFieldList& fieldlist, int fieldlist_index);
-  void IntegrateData4(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id,
-    vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id, double k, vtkFieldList& fieldlist,
-    int fieldlist_index);
-
 public:
   enum CommunicationIds
   {
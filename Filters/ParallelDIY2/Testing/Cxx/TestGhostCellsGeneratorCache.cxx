@@ -0,0 +1,183 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGhostCellsGeneratorCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkGhostCellsGenerator reuses its ghost structure when only the
+// values of the data arrays of its input change, through the pipeline and
+// through BeginGhostUpdate / FinishGhostUpdate, and gives the same ghosts as
+// a generator without the cache.
+
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGhostCellsGenerator.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+void FillValues(vtkPartitionedDataSet* pds, double offset)
+{
+  for (unsigned int cc = 0; cc < pds->GetNumberOfPartitions(); ++cc)
+  {
+    vtkDataSet* ds = pds->GetPartition(cc);
+    vtkDataArray* points = ds->GetPointData()->GetArray("PointValues");
+    for (vtkIdType id = 0; id < ds->GetNumberOfPoints(); ++id)
+    {
+      double p[3];
+      ds->GetPoint(id, p);
+      points->SetComponent(id, 0, offset + p[0] + 10.0 * p[1] + 100.0 * p[2]);
+    }
+    points->Modified();
+    vtkDataArray* cells = ds->GetCellData()->GetArray("CellValues");
+    for (vtkIdType id = 0; id < ds->GetNumberOfCells(); ++id)
+    {
+      cells->SetComponent(id, 0, offset + cc * 1000.0 + id);
+      cells->SetComponent(id, 1, -offset);
+    }
+    cells->Modified();
+  }
+}
+
+bool SameValues(vtkDataObject* a, vtkDataObject* b)
+{
+  auto pdsA = vtkPartitionedDataSet::SafeDownCast(a);
+  auto pdsB = vtkPartitionedDataSet::SafeDownCast(b);
+  if (!pdsA || !pdsB || pdsA->GetNumberOfPartitions() != pdsB->GetNumberOfPartitions())
+  {
+    return false;
+  }
+  for (unsigned int cc = 0; cc < pdsA->GetNumberOfPartitions(); ++cc)
+  {
+    vtkDataSet* dsA = pdsA->GetPartition(cc);
+    vtkDataSet* dsB = pdsB->GetPartition(cc);
+    vtkDataArray* arrays[4] = { dsA->GetPointData()->GetArray("PointValues"),
+      dsB->GetPointData()->GetArray("PointValues"), dsA->GetCellData()->GetArray("CellValues"),
+      dsB->GetCellData()->GetArray("CellValues") };
+    for (int i = 0; i < 4; i += 2)
+    {
+      if (!arrays[i] || !arrays[i + 1] ||
+        arrays[i]->GetNumberOfTuples() != arrays[i + 1]->GetNumberOfTuples() ||
+        arrays[i]->GetNumberOfComponents() != arrays[i + 1]->GetNumberOfComponents())
+      {
+        return false;
+      }
+      for (vtkIdType id = 0; id < arrays[i]->GetNumberOfTuples(); ++id)
+      {
+        for (int comp = 0; comp < arrays[i]->GetNumberOfComponents(); ++comp)
+        {
+          if (arrays[i]->GetComponent(id, comp) != arrays[i + 1]->GetComponent(id, comp))
+          {
+            std::cerr << "Value " << id << " of " << arrays[i]->GetName() << " of partition "
+                      << cc << " differs" << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool Check(vtkGhostCellsGenerator* cached, vtkGhostCellsGenerator* reference, bool reused,
+  const char* step)
+{
+  cached->Update();
+  reference->Update();
+  if (cached->GetGhostStructureReused() != reused)
+  {
+    std::cerr << "Expected the ghost structure " << (reused ? "" : "not ") << "to be reused after "
+              << step << std::endl;
+    return false;
+  }
+  if (!SameValues(cached->GetOutputDataObject(0), reference->GetOutputDataObject(0)))
+  {
+    std::cerr << "Wrong ghosts after " << step << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestGhostCellsGeneratorCache(int, char*[])
+{
+  // two images sharing the face x = 4
+  vtkNew<vtkPartitionedDataSet> pds;
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    vtkNew<vtkImageData> image;
+    image->SetExtent(4 * cc, 4 * cc + 4, 0, 4, 0, 4);
+    vtkNew<vtkDoubleArray> points;
+    points->SetName("PointValues");
+    points->SetNumberOfTuples(image->GetNumberOfPoints());
+    image->GetPointData()->AddArray(points);
+    vtkNew<vtkDoubleArray> cells;
+    cells->SetName("CellValues");
+    cells->SetNumberOfComponents(2);
+    cells->SetNumberOfTuples(image->GetNumberOfCells());
+    image->GetCellData()->AddArray(cells);
+    pds->SetPartition(cc, image);
+  }
+  FillValues(pds, 0.0);
+
+  vtkNew<vtkGhostCellsGenerator> cached;
+  cached->SetInputData(pds);
+  cached->SetNumberOfGhostLayers(2);
+  cached->BuildIfRequiredOff();
+  cached->CacheGhostStructureOn();
+  vtkNew<vtkGhostCellsGenerator> reference;
+  reference->SetInputData(pds);
+  reference->SetNumberOfGhostLayers(2);
+  reference->BuildIfRequiredOff();
+
+  if (!Check(cached, reference, false, "the first execution"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  FillValues(pds, 3.0);
+  pds->Modified();
+  if (!Check(cached, reference, true, "a change of the values"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  FillValues(pds, 7.0);
+  if (!cached->BeginGhostUpdate() || !cached->FinishGhostUpdate())
+  {
+    std::cerr << "BeginGhostUpdate failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  reference->Modified();
+  reference->Update();
+  if (!SameValues(cached->GetOutputDataObject(0), reference->GetOutputDataObject(0)))
+  {
+    std::cerr << "Wrong ghosts after FinishGhostUpdate" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the second image moves away from the first one
+  vtkImageData::SafeDownCast(pds->GetPartition(1))->SetExtent(5, 9, 0, 4, 0, 4);
+  FillValues(pds, 11.0);
+  pds->Modified();
+  if (!Check(cached, reference, false, "a change of the geometry"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestRedistributeDataSetFilterIncremental.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkRedistributeDataSetFilter reuses its cuts for an input that
+// barely moved, and regenerates them when the input moved out of the cuts or
+// when they are too unbalanced.
+
+#include "vtkBoundingBox.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkRedistributeDataSetFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+bool Check(vtkRedistributeDataSetFilter* redistribute, bool reused, const char* step)
+{
+  redistribute->Update();
+  std::cout << step << ": imbalance " << redistribute->GetImbalance() << ", "
+            << redistribute->GetNumberOfBytesMoved() << " bytes moved" << std::endl;
+  if (redistribute->GetCutsReused() != reused)
+  {
+    std::cerr << "Expected the cuts " << (reused ? "" : "not ") << "to be reused after " << step
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestRedistributeDataSetFilterIncremental(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(65, 9, 9);
+  vtkNew<vtkDoubleArray> weights;
+  weights->SetName("Weights");
+  weights->SetNumberOfTuples(image->GetNumberOfCells());
+  weights->Fill(1.0);
+  image->GetCellData()->AddArray(weights);
+
+  vtkNew<vtkRedistributeDataSetFilter> redistribute;
+  redistribute->SetInputData(image);
+  redistribute->SetNumberOfPartitions(4);
+  redistribute->SetCellWeightingToArray();
+  redistribute->SetCellWeightsArrayName("Weights");
+  redistribute->UseIncrementalCutsOn();
+  if (!Check(redistribute, false, "the first execution"))
+  {
+    return EXIT_FAILURE;
+  }
+  const std::vector<vtkBoundingBox> cuts = redistribute->GetCuts();
+
+  // within the inflated bounds of the cuts
+  image->SetOrigin(0.2, 0.0, 0.0);
+  if (!Check(redistribute, true, "a small move") || redistribute->GetCuts() != cuts)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // the cells of one cut cost more than the threshold
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    weights->SetValue(cellId, (cellId % 64) < 8 ? 2.0 : 1.0);
+  }
+  weights->Modified();
+  if (!Check(redistribute, false, "a change of the weights") ||
+    redistribute->GetImbalance() <= redistribute->GetMaximumImbalance())
+  {
+    return EXIT_FAILURE;
+  }
+
+  // a large move puts cells out of the cuts
+  image->SetOrigin(10.0, 0.0, 0.0);
+  if (!Check(redistribute, false, "a large move"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  redistribute->UseIncrementalCutsOff();
+  image->SetOrigin(10.1, 0.0, 0.0);
+  if (!Check(redistribute, false, "turning off the incremental cuts"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
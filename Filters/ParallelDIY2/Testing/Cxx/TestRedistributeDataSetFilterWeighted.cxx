@@ -0,0 +1,117 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestRedistributeDataSetFilterWeighted.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the cuts of vtkRedistributeDataSetFilter balance the weights of
+// the cells instead of their number when asked to.
+
+#include "vtkCellData.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkRedistributeDataSetFilter.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// Return true if the sums of the weights of the partitions differ from their
+// mean by less than the tolerance, relative to the mean.
+bool Balanced(vtkPartitionedDataSet* parts, int numberOfParts, double tolerance)
+{
+  if (static_cast<int>(parts->GetNumberOfPartitions()) != numberOfParts)
+  {
+    std::cerr << "Expected " << numberOfParts << " partitions, got "
+              << parts->GetNumberOfPartitions() << std::endl;
+    return false;
+  }
+  std::vector<double> sums(numberOfParts, 0.0);
+  double total = 0.0;
+  for (int cc = 0; cc < numberOfParts; ++cc)
+  {
+    vtkDataSet* part = parts->GetPartition(cc);
+    vtkDataArray* weights = part ? part->GetCellData()->GetArray("Weights") : nullptr;
+    for (vtkIdType id = 0; weights && id < weights->GetNumberOfTuples(); ++id)
+    {
+      sums[cc] += weights->GetComponent(id, 0);
+    }
+    total += sums[cc];
+  }
+  const double mean = total / numberOfParts;
+  for (int cc = 0; cc < numberOfParts; ++cc)
+  {
+    std::cout << "partition " << cc << ": " << sums[cc] << std::endl;
+    if (std::abs(sums[cc] - mean) > tolerance * mean)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestRedistributeDataSetFilterWeighted(int, char*[])
+{
+  // the cells of the last eighth along x cost 10 times more than the others
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(65, 9, 9);
+  vtkNew<vtkDoubleArray> weights;
+  weights->SetName("Weights");
+  weights->SetNumberOfTuples(image->GetNumberOfCells());
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    weights->SetValue(cellId, (cellId % 64) >= 56 ? 10.0 : 1.0);
+  }
+  image->GetCellData()->AddArray(weights);
+
+  vtkNew<vtkRedistributeDataSetFilter> redistribute;
+  redistribute->SetInputData(image);
+  redistribute->SetNumberOfPartitions(4);
+  redistribute->PreservePartitionsInOutputOn();
+  redistribute->Update();
+  if (Balanced(vtkPartitionedDataSet::SafeDownCast(redistribute->GetOutput()), 4, 0.5))
+  {
+    std::cerr << "Uniform weights balance the weights of this image" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  redistribute->SetCellWeightingToArray();
+  redistribute->SetCellWeightsArrayName("Weights");
+  redistribute->Update();
+  if (!Balanced(vtkPartitionedDataSet::SafeDownCast(redistribute->GetOutput()), 4, 0.15))
+  {
+    std::cerr << "Unbalanced weights with ARRAY_CELL_WEIGHTS" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the voxels all have the same estimated cost
+  redistribute->SetCellWeightingToEstimated();
+  redistribute->Update();
+  vtkPartitionedDataSet* parts = vtkPartitionedDataSet::SafeDownCast(redistribute->GetOutput());
+  for (unsigned int cc = 0; cc < parts->GetNumberOfPartitions(); ++cc)
+  {
+    const vtkIdType numCells = parts->GetPartition(cc)->GetNumberOfCells();
+    if (numCells != image->GetNumberOfCells() / 4)
+    {
+      std::cerr << "Expected " << image->GetNumberOfCells() / 4 << " cells in partition " << cc
+                << ", got " << numCells << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
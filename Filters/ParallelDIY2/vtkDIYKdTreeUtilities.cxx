@@ -21,6 +21,7 @@
 #include "vtkCompositeDataSet.h"
 #include "vtkDIYExplicitAssigner.h"
 #include "vtkDIYUtilities.h"
+#include "vtkDoubleArray.h"
 #include "vtkIdTypeArray.h"
 #include "vtkLogger.h"
 #include "vtkMath.h"
@@ -33,9 +34,12 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <tuple>
 
 // clang-format off
@@ -283,10 +287,143 @@ std::vector<vtkBoundingBox> vtkDIYKdTreeUtilities::GenerateCuts(
   return cuts;
 }
 
+//------------------------------------------------------------------------------
+std::vector<vtkBoundingBox> vtkDIYKdTreeUtilities::GenerateCuts(
+  const std::vector<vtkSmartPointer<vtkPoints>>& points,
+  const std::vector<vtkSmartPointer<vtkDoubleArray>>& weights, int number_of_partitions,
+  vtkMultiProcessController* controller, const double* local_bounds /*=nullptr*/)
+{
+  if (number_of_partitions == 0)
+  {
+    return std::vector<vtkBoundingBox>();
+  }
+
+  vtkBoundingBox bbox;
+  if (local_bounds != nullptr)
+  {
+    bbox.SetBounds(local_bounds);
+  }
+  if (!bbox.IsValid())
+  {
+    for (auto& pts : points)
+    {
+      if (pts)
+      {
+        double bds[6];
+        pts->GetBounds(bds);
+        bbox.AddBounds(bds);
+      }
+    }
+  }
+
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(controller);
+
+  // determine global domain bounds.
+  vtkDIYUtilities::AllReduce(comm, bbox);
+
+  if (!bbox.IsValid())
+  {
+    // nothing to split since global bounds are empty.
+    return std::vector<vtkBoundingBox>();
+  }
+
+  if (number_of_partitions == 1)
+  {
+    return std::vector<vtkBoundingBox>{ bbox };
+  }
+
+  const int num_cuts = vtkMath::NearestPowerOfTwo(number_of_partitions);
+
+  std::vector<vtkTuple<double, 3>> coords;
+  std::vector<double> values;
+  for (size_t idx = 0; idx < points.size(); ++idx)
+  {
+    vtkPoints* pts = points[idx];
+    vtkDoubleArray* wts = idx < weights.size() ? weights[idx].GetPointer() : nullptr;
+    const vtkIdType num_points = pts ? pts->GetNumberOfPoints() : 0;
+    for (vtkIdType cc = 0; cc < num_points; ++cc)
+    {
+      coords.emplace_back();
+      pts->GetPoint(cc, coords.back().GetData());
+      values.push_back(wts && cc < wts->GetNumberOfTuples() ? wts->GetValue(cc) : 1.0);
+    }
+  }
+
+  // the children of the box `b` are the boxes `2b` and `2b+1` of the next
+  // level, the leaves end up in the order of the kd-tree.
+  constexpr int hist_bins = 256;
+  std::vector<int> box_ids(coords.size(), 0);
+  std::vector<vtkBoundingBox> cuts{ bbox };
+  while (static_cast<int>(cuts.size()) < num_cuts)
+  {
+    const int num_boxes = static_cast<int>(cuts.size());
+    std::vector<int> axes(num_boxes);
+    for (int b = 0; b < num_boxes; ++b)
+    {
+      double lengths[3];
+      cuts[b].GetLengths(lengths);
+      axes[b] = static_cast<int>(std::max_element(lengths, lengths + 3) - lengths);
+    }
+
+    std::vector<double> local_hists(num_boxes * hist_bins, 0.0);
+    for (size_t cc = 0; cc < coords.size(); ++cc)
+    {
+      const int b = box_ids[cc];
+      const int axis = axes[b];
+      const double length = cuts[b].GetLength(axis);
+      const double offset = coords[cc][axis] - cuts[b].GetMinPoint()[axis];
+      const int bin = length > 0 ? static_cast<int>(offset / length * hist_bins) : 0;
+      local_hists[b * hist_bins + std::min(std::max(bin, 0), hist_bins - 1)] += values[cc];
+    }
+    std::vector<double> hists;
+    diy::mpi::all_reduce(comm, local_hists, hists, std::plus<double>());
+
+    std::vector<double> splits(num_boxes);
+    std::vector<vtkBoundingBox> children(2 * num_boxes);
+    for (int b = 0; b < num_boxes; ++b)
+    {
+      // interpolate the median weight in its bin, split empty boxes in halves.
+      const double* hist = &hists[b * hist_bins];
+      const double half = 0.5 * std::accumulate(hist, hist + hist_bins, 0.0);
+      double position = 0.5 * hist_bins;
+      double sum = 0.0;
+      for (int bin = 0; half > 0 && bin < hist_bins; ++bin)
+      {
+        if (sum + hist[bin] >= half)
+        {
+          position = bin + (half - sum) / hist[bin];
+          break;
+        }
+        sum += hist[bin];
+      }
+
+      const int axis = axes[b];
+      double bds[6];
+      cuts[b].GetBounds(bds);
+      splits[b] = bds[2 * axis] + cuts[b].GetLength(axis) * position / hist_bins;
+      double left[6], right[6];
+      std::copy(bds, bds + 6, left);
+      std::copy(bds, bds + 6, right);
+      left[2 * axis + 1] = right[2 * axis] = splits[b];
+      children[2 * b].SetBounds(left);
+      children[2 * b + 1].SetBounds(right);
+    }
+
+    for (size_t cc = 0; cc < coords.size(); ++cc)
+    {
+      const int b = box_ids[cc];
+      box_ids[cc] = 2 * b + (coords[cc][axes[b]] >= splits[b] ? 1 : 0);
+    }
+    cuts.swap(children);
+  }
+  return cuts;
+}
+
 //------------------------------------------------------------------------------
 vtkSmartPointer<vtkPartitionedDataSet> vtkDIYKdTreeUtilities::Exchange(
   vtkPartitionedDataSet* localParts, vtkMultiProcessController* controller,
-  std::shared_ptr<diy::Assigner> block_assigner /*= nullptr*/)
+  std::shared_ptr<diy::Assigner> block_assigner /*= nullptr*/,
+  vtkTypeUInt64* bytes_sent /*= nullptr*/)
 {
   diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(controller);
   const int nblocks = static_cast<int>(localParts->GetNumberOfPartitions());
@@ -323,7 +460,8 @@ vtkSmartPointer<vtkPartitionedDataSet> vtkDIYKdTreeUtilities::Exchange(
 
   const int myrank = comm.rank();
   diy::all_to_all(master, assigner,
-    [block_assigner, &myrank, localParts](VectorOfVectorOfUG* block, const diy::ReduceProxy& rp) {
+    [block_assigner, &myrank, localParts, bytes_sent](
+      VectorOfVectorOfUG* block, const diy::ReduceProxy& rp) {
       if (rp.in_link().size() == 0)
       {
         // enqueue blocks to send.
@@ -342,6 +480,10 @@ vtkSmartPointer<vtkPartitionedDataSet> vtkDIYKdTreeUtilities::Exchange(
             {
               rp.enqueue(rp.out_link().target(target_rank), partId);
               rp.enqueue<vtkDataSet*>(rp.out_link().target(target_rank), part);
+              if (bytes_sent)
+              {
+                *bytes_sent += static_cast<vtkTypeUInt64>(part->GetActualMemorySize()) * 1024;
+              }
             }
           }
         }
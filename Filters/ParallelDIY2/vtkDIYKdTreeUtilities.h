@@ -36,6 +36,7 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDataObject;
 class vtkDataSet;
+class vtkDoubleArray;
 class vtkIntArray;
 class vtkMultiProcessController;
 class vtkPartitionedDataSet;
@@ -90,6 +91,22 @@ public:
     const std::vector<vtkSmartPointer<vtkPoints>>& points, int number_of_partitions,
     vtkMultiProcessController* controller = nullptr, const double* local_bounds = nullptr);
 
+  /**
+   * Variant of GenerateCuts that balances the sum of the `weights` of the
+   * points instead of their number, with one weight per point of the matching
+   * item of `points`. A null weights array gives a weight of 1 to its points.
+   *
+   * The boxes are bisected recursively along their longest axis at the
+   * median weight, found from histograms of the weights reduced among the
+   * ranks, without moving the points. The cuts follow the same order as the
+   * kd-tree of the other variants, so that `ResizeCuts` and
+   * `ComputeAssignments` apply to them as well.
+   */
+  static std::vector<vtkBoundingBox> GenerateCuts(
+    const std::vector<vtkSmartPointer<vtkPoints>>& points,
+    const std::vector<vtkSmartPointer<vtkDoubleArray>>& weights, int number_of_partitions,
+    vtkMultiProcessController* controller = nullptr, const double* local_bounds = nullptr);
+
   /**
    * Exchange parts in the partitioned dataset among ranks in the parallel group
    * defined by the `controller`. The parts are assigned to ranks in a
@@ -108,9 +125,13 @@ public:
    * block_assigner is an optional parameter that should be set if the user wants
    * to assign blocks in a custom way. The default assigner is the one returned
    * by vtkDIYKdTreeUtilities::CreateAssigner.
+   *
+   * If `bytes_sent` is non-null, the memory size of the parts sent to other
+   * ranks is added to it. Parts assigned to the current rank are not sent.
    */
   static vtkSmartPointer<vtkPartitionedDataSet> Exchange(vtkPartitionedDataSet* parts,
-    vtkMultiProcessController* controller, std::shared_ptr<diy::Assigner> block_assigner = nullptr);
+    vtkMultiProcessController* controller, std::shared_ptr<diy::Assigner> block_assigner = nullptr,
+    vtkTypeUInt64* bytes_sent = nullptr);
 
   /**
    * Generates and adds global cell ids to datasets in `parts`. One this to note
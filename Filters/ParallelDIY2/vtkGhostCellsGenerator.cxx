@@ -16,21 +16,29 @@
 
 #include "vtkGhostCellsGenerator.h"
 
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDIYGhostUtilities.h"
+#include "vtkDIYUtilities.h"
+#include "vtkDataArray.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDataObjectTreeRange.h"
 #include "vtkExplicitStructuredGrid.h"
 #include "vtkHyperTreeGrid.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
+#include "vtkMatrix3x3.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRange.h"
 #include "vtkRectilinearGrid.h"
@@ -38,17 +46,586 @@
 #include "vtkStructuredGrid.h"
 #include "vtkUnstructuredGrid.h"
 
+// clang-format off
+#include "vtk_diy2.h"
+#include VTK_DIY2(diy/mpi.hpp)
+// clang-format on
+
+#include <array>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <string>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkGhostCellsGenerator);
 vtkCxxSetObjectMacro(vtkGhostCellsGenerator, Controller, vtkMultiProcessController);
 
+namespace
+{
+// 3 components array tagging the points and cells of the outputs with the rank, the index of the
+// input and the id in the input of their source while the ghost structure is built
+const char* SOURCE_IDS_ARRAY_NAME = "__vtkGhostCellsGenerator_SourceIds__";
+
+constexpr int REQUESTS_TAG = 2281;
+constexpr int VALUES_TAG = 2282;
+
+//------------------------------------------------------------------------------
+vtkDataSetAttributes* GetAttributes(vtkDataSet* ds, int association)
+{
+  return association ? static_cast<vtkDataSetAttributes*>(ds->GetCellData())
+                     : static_cast<vtkDataSetAttributes*>(ds->GetPointData());
+}
+
+//------------------------------------------------------------------------------
+vtkIdType GetNumberOfElements(vtkDataSet* ds, int association)
+{
+  return association ? ds->GetNumberOfCells() : ds->GetNumberOfPoints();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Objects and values defining the geometry of a dataset, with the modification times of the
+ * objects, so that replacing or modifying any of them changes the signature.
+ */
+struct GeometrySignature
+{
+  std::vector<vtkObject*> Objects;
+  std::vector<vtkMTimeType> Times;
+  std::vector<double> Values;
+
+  void AddObject(vtkObject* object)
+  {
+    this->Objects.push_back(object);
+    this->Times.push_back(object ? object->GetMTime() : 0);
+  }
+
+  void AddExtent(const int extent[6])
+  {
+    this->Values.insert(this->Values.end(), extent, extent + 6);
+  }
+
+  bool operator==(const GeometrySignature& other) const
+  {
+    return this->Objects == other.Objects && this->Times == other.Times &&
+      this->Values == other.Values;
+  }
+};
+
+//------------------------------------------------------------------------------
+GeometrySignature ComputeGeometrySignature(vtkDataSet* ds)
+{
+  GeometrySignature signature;
+  signature.AddObject(ds->GetGhostArray(vtkDataObject::FIELD_ASSOCIATION_POINTS));
+  signature.AddObject(ds->GetGhostArray(vtkDataObject::FIELD_ASSOCIATION_CELLS));
+  if (auto ps = vtkPointSet::SafeDownCast(ds))
+  {
+    signature.AddObject(ps->GetPoints());
+  }
+  if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    signature.AddObject(ug->GetCells());
+    signature.AddObject(ug->GetCellTypesArray());
+    signature.AddObject(ug->GetFaces());
+    signature.AddObject(ug->GetFaceLocations());
+  }
+  else if (auto pd = vtkPolyData::SafeDownCast(ds))
+  {
+    signature.AddObject(pd->GetVerts());
+    signature.AddObject(pd->GetLines());
+    signature.AddObject(pd->GetPolys());
+    signature.AddObject(pd->GetStrips());
+  }
+  else if (auto sg = vtkStructuredGrid::SafeDownCast(ds))
+  {
+    signature.AddExtent(sg->GetExtent());
+  }
+  else if (auto rg = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    signature.AddExtent(rg->GetExtent());
+    signature.AddObject(rg->GetXCoordinates());
+    signature.AddObject(rg->GetYCoordinates());
+    signature.AddObject(rg->GetZCoordinates());
+  }
+  else if (auto im = vtkImageData::SafeDownCast(ds))
+  {
+    signature.AddExtent(im->GetExtent());
+    signature.Values.insert(signature.Values.end(), im->GetOrigin(), im->GetOrigin() + 3);
+    signature.Values.insert(signature.Values.end(), im->GetSpacing(), im->GetSpacing() + 3);
+    const double* direction = im->GetDirectionMatrix()->GetData();
+    signature.Values.insert(signature.Values.end(), direction, direction + 9);
+  }
+  return signature;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Replaces the inputs with shallow copies tagging their points and cells with their sources.
+ * The index of an input is its position in the flat list of all the inputs of the rank.
+ */
+template <class DataSetT>
+void AddSourceIds(std::vector<DataSetT*>& inputs, std::vector<vtkSmartPointer<vtkDataSet>>& copies,
+  vtkIdType& index, int rank)
+{
+  for (DataSetT*& input : inputs)
+  {
+    auto copy = vtkSmartPointer<DataSetT>::Take(input->NewInstance());
+    copy->ShallowCopy(input);
+    for (int association = 0; association < 2; ++association)
+    {
+      const vtkIdType numberOfElements = GetNumberOfElements(copy, association);
+      vtkNew<vtkIdTypeArray> sources;
+      sources->SetName(SOURCE_IDS_ARRAY_NAME);
+      sources->SetNumberOfComponents(3);
+      sources->SetNumberOfTuples(numberOfElements);
+      for (vtkIdType id = 0; id < numberOfElements; ++id)
+      {
+        sources->SetTypedComponent(id, 0, rank);
+        sources->SetTypedComponent(id, 1, index);
+        sources->SetTypedComponent(id, 2, id);
+      }
+      GetAttributes(copy, association)->AddArray(sources);
+    }
+    input = copy;
+    copies.emplace_back(copy);
+    ++index;
+  }
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Leaves of a partition of the input and of the output, by type.
+ */
+struct PartitionLeaves
+{
+  std::vector<vtkImageData*> InputsID, OutputsID;
+  std::vector<vtkRectilinearGrid*> InputsRG, OutputsRG;
+  std::vector<vtkStructuredGrid*> InputsSG, OutputsSG;
+  std::vector<vtkUnstructuredGrid*> InputsUG, OutputsUG;
+  std::vector<vtkPolyData*> InputsPD, OutputsPD;
+
+  PartitionLeaves(vtkDataObject* inputPartition, vtkDataObject* outputPartition)
+    : InputsID(vtkCompositeDataSet::GetDataSets<vtkImageData>(inputPartition))
+    , OutputsID(vtkCompositeDataSet::GetDataSets<vtkImageData>(outputPartition))
+    , InputsRG(vtkCompositeDataSet::GetDataSets<vtkRectilinearGrid>(inputPartition))
+    , OutputsRG(vtkCompositeDataSet::GetDataSets<vtkRectilinearGrid>(outputPartition))
+    , InputsSG(vtkCompositeDataSet::GetDataSets<vtkStructuredGrid>(inputPartition))
+    , OutputsSG(vtkCompositeDataSet::GetDataSets<vtkStructuredGrid>(outputPartition))
+    , InputsUG(vtkCompositeDataSet::GetDataSets<vtkUnstructuredGrid>(inputPartition))
+    , OutputsUG(vtkCompositeDataSet::GetDataSets<vtkUnstructuredGrid>(outputPartition))
+    , InputsPD(vtkCompositeDataSet::GetDataSets<vtkPolyData>(inputPartition))
+    , OutputsPD(vtkCompositeDataSet::GetDataSets<vtkPolyData>(outputPartition))
+  {
+  }
+
+  void Flatten(std::vector<vtkDataSet*>& inputs, std::vector<vtkDataSet*>& outputs) const
+  {
+    inputs.insert(inputs.end(), this->InputsID.begin(), this->InputsID.end());
+    inputs.insert(inputs.end(), this->InputsRG.begin(), this->InputsRG.end());
+    inputs.insert(inputs.end(), this->InputsSG.begin(), this->InputsSG.end());
+    inputs.insert(inputs.end(), this->InputsUG.begin(), this->InputsUG.end());
+    inputs.insert(inputs.end(), this->InputsPD.begin(), this->InputsPD.end());
+    outputs.insert(outputs.end(), this->OutputsID.begin(), this->OutputsID.end());
+    outputs.insert(outputs.end(), this->OutputsRG.begin(), this->OutputsRG.end());
+    outputs.insert(outputs.end(), this->OutputsSG.begin(), this->OutputsSG.end());
+    outputs.insert(outputs.end(), this->OutputsUG.begin(), this->OutputsUG.end());
+    outputs.insert(outputs.end(), this->OutputsPD.begin(), this->OutputsPD.end());
+  }
+};
+
+//------------------------------------------------------------------------------
+void SplitPartitions(vtkDataObject* inputDO, vtkDataObject* outputDO,
+  std::vector<vtkDataObject*>& inputPDSs, std::vector<vtkDataObject*>& outputPDSs)
+{
+  auto inputPDSC = vtkPartitionedDataSetCollection::SafeDownCast(inputDO);
+  auto outputPDSC = vtkPartitionedDataSetCollection::SafeDownCast(outputDO);
+  if (inputPDSC && outputPDSC)
+  {
+    for (unsigned int pdsId = 0; pdsId < inputPDSC->GetNumberOfPartitionedDataSets(); ++pdsId)
+    {
+      inputPDSs.emplace_back(inputPDSC->GetPartitionedDataSet(pdsId));
+      outputPDSs.emplace_back(outputPDSC->GetPartitionedDataSet(pdsId));
+    }
+  }
+  else
+  {
+    inputPDSs.emplace_back(inputDO);
+    outputPDSs.emplace_back(outputDO);
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+struct vtkGhostCellsGenerator::vtkInternals
+{
+  // Data arrays of the inputs copied into the ghosts, for the points (0) and the cells (1).
+  struct ArrayLayout
+  {
+    std::vector<std::string> Names;
+    std::vector<int> NumberOfComponents;
+    int TotalNumberOfComponents = 0;
+  };
+
+  // Element of an output filled from an element of an input of the same rank.
+  struct LocalCopy
+  {
+    vtkIdType Output;
+    vtkIdType OutputId;
+    vtkIdType Input;
+    vtkIdType InputId;
+  };
+
+  // (index, id) pairs of the inputs sent to, or of the outputs received from, a rank, for the
+  // points and the cells
+  using IdLists = std::array<std::vector<vtkIdType>, 2>;
+
+  bool Built = false;
+  int NumberOfGhostLayers = -1;
+  ArrayLayout Layouts[2];
+  std::vector<vtkSmartPointer<vtkDataSet>> Outputs;
+  std::vector<GeometrySignature> Signatures;
+  std::vector<LocalCopy> LocalCopies[2];
+  std::map<int, IdLists> SendLists;
+  std::map<int, IdLists> ReceiveLists;
+
+  // state of the update in progress
+  bool Pending = false;
+  std::vector<std::vector<vtkDataArray*>> PendingArrays[2];
+  std::vector<vtkSmartPointer<vtkDataSet>> PendingOutputs;
+  std::map<int, std::vector<double>> SendBuffers;
+  std::map<int, std::vector<double>> ReceiveBuffers;
+  std::vector<diy::mpi::request> Requests;
+
+  //----------------------------------------------------------------------------
+  void Clear()
+  {
+    this->FinishUpdate();
+    this->Built = false;
+    this->NumberOfGhostLayers = -1;
+    for (int association = 0; association < 2; ++association)
+    {
+      this->Layouts[association] = ArrayLayout();
+      this->LocalCopies[association].clear();
+    }
+    this->Outputs.clear();
+    this->Signatures.clear();
+    this->SendLists.clear();
+    this->ReceiveLists.clear();
+    this->SendBuffers.clear();
+    this->ReceiveBuffers.clear();
+  }
+
+  //----------------------------------------------------------------------------
+  std::vector<vtkDataArray*> GetArrays(vtkDataSet* ds, int association) const
+  {
+    std::vector<vtkDataArray*> arrays;
+    for (const std::string& name : this->Layouts[association].Names)
+    {
+      arrays.push_back(GetAttributes(ds, association)->GetArray(name.c_str()));
+    }
+    return arrays;
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Builds the ghost structure from outputs generated from inputs tagged by AddSourceIds, and
+   * removes the tags. Collective.
+   */
+  bool Build(const std::vector<vtkDataSet*>& inputs, const std::vector<vtkDataSet*>& outputs,
+    int numberOfGhostLayers, diy::mpi::communicator& comm)
+  {
+    this->Clear();
+    const int rank = comm.rank();
+    bool valid = inputs.size() == outputs.size();
+
+    std::map<int, IdLists> requests;
+    for (vtkIdType output = 0; valid && output < static_cast<vtkIdType>(outputs.size()); ++output)
+    {
+      for (int association = 0; association < 2; ++association)
+      {
+        vtkDataSetAttributes* attributes = GetAttributes(outputs[output], association);
+        auto sources = vtkIdTypeArray::SafeDownCast(attributes->GetArray(SOURCE_IDS_ARRAY_NAME));
+        if (!sources)
+        {
+          valid = false;
+          continue;
+        }
+        for (vtkIdType id = 0; id < sources->GetNumberOfTuples(); ++id)
+        {
+          const int source = static_cast<int>(sources->GetTypedComponent(id, 0));
+          const vtkIdType input = sources->GetTypedComponent(id, 1);
+          const vtkIdType inputId = sources->GetTypedComponent(id, 2);
+          if (source == rank)
+          {
+            this->LocalCopies[association].push_back(LocalCopy{ output, id, input, inputId });
+          }
+          else
+          {
+            std::vector<vtkIdType>& received = this->ReceiveLists[source][association];
+            received.push_back(output);
+            received.push_back(id);
+            std::vector<vtkIdType>& requested = requests[source][association];
+            requested.push_back(input);
+            requested.push_back(inputId);
+          }
+        }
+        attributes->RemoveArray(SOURCE_IDS_ARRAY_NAME);
+      }
+      auto copy = vtkSmartPointer<vtkDataSet>::Take(outputs[output]->NewInstance());
+      copy->ShallowCopy(outputs[output]);
+      this->Outputs.emplace_back(copy);
+      this->Signatures.emplace_back(ComputeGeometrySignature(inputs[output]));
+    }
+
+    // the ghosts receive the data arrays common to the inputs and to the outputs, which must be
+    // the same on every rank
+    std::string description;
+    for (int association = 0; valid && !inputs.empty() && association < 2; ++association)
+    {
+      ArrayLayout& layout = this->Layouts[association];
+      vtkDataSetAttributes* inputAttributes = GetAttributes(inputs[0], association);
+      vtkDataSetAttributes* outputAttributes = GetAttributes(outputs[0], association);
+      for (int arrayId = 0; arrayId < outputAttributes->GetNumberOfArrays(); ++arrayId)
+      {
+        vtkDataArray* array = outputAttributes->GetArray(arrayId);
+        const char* name = array ? array->GetName() : nullptr;
+        vtkDataArray* inputArray = name ? inputAttributes->GetArray(name) : nullptr;
+        if (!inputArray || !strcmp(name, vtkDataSetAttributes::GhostArrayName()) ||
+          inputArray->GetNumberOfComponents() != array->GetNumberOfComponents())
+        {
+          continue;
+        }
+        layout.Names.emplace_back(name);
+        layout.NumberOfComponents.push_back(array->GetNumberOfComponents());
+        layout.TotalNumberOfComponents += array->GetNumberOfComponents();
+        description += std::to_string(association) + name + ":" +
+          std::to_string(array->GetNumberOfComponents()) + ";";
+      }
+    }
+    const unsigned long long hash = std::hash<std::string>{}(description);
+    unsigned long long minHash =
+      inputs.empty() ? std::numeric_limits<unsigned long long>::max() : hash;
+    unsigned long long maxHash = inputs.empty() ? 0 : hash;
+    int localValid = valid ? 1 : 0;
+    int globalValid = 0;
+    diy::mpi::all_reduce(comm, minHash, minHash, diy::mpi::minimum<unsigned long long>());
+    diy::mpi::all_reduce(comm, maxHash, maxHash, diy::mpi::maximum<unsigned long long>());
+    diy::mpi::all_reduce(comm, localValid, globalValid, diy::mpi::minimum<int>());
+    if (!globalValid || minHash < maxHash)
+    {
+      this->Clear();
+      return false;
+    }
+
+    // every rank sends the ids it needs to the ranks owning them
+    std::vector<int> requested(comm.size(), 0);
+    for (const auto& item : requests)
+    {
+      requested[item.first] = 1;
+    }
+    std::vector<int> numberOfRequesters;
+    diy::mpi::all_reduce(comm, requested, numberOfRequesters, std::plus<int>());
+
+    std::vector<std::vector<vtkIdType>> messages;
+    std::vector<diy::mpi::request> sends;
+    messages.reserve(requests.size());
+    for (const auto& item : requests)
+    {
+      // the number of points, then the pairs of the points and of the cells
+      std::vector<vtkIdType> message(1, static_cast<vtkIdType>(item.second[0].size() / 2));
+      message.insert(message.end(), item.second[0].begin(), item.second[0].end());
+      message.insert(message.end(), item.second[1].begin(), item.second[1].end());
+      messages.emplace_back(std::move(message));
+      sends.emplace_back(comm.isend(item.first, REQUESTS_TAG, messages.back()));
+    }
+    for (int cc = 0; cc < numberOfRequesters[rank]; ++cc)
+    {
+      diy::mpi::status status = comm.probe(diy::mpi::any_source, REQUESTS_TAG);
+      std::vector<vtkIdType> message;
+      comm.recv(status.source(), REQUESTS_TAG, message);
+      IdLists& lists = this->SendLists[status.source()];
+      const std::size_t numberOfPointIds = message.empty() ? 0 : 2 * message[0];
+      lists[0].assign(message.begin() + 1, message.begin() + 1 + numberOfPointIds);
+      lists[1].assign(message.begin() + 1 + numberOfPointIds, message.end());
+    }
+    for (diy::mpi::request& send : sends)
+    {
+      send.wait();
+    }
+
+    this->NumberOfGhostLayers = numberOfGhostLayers;
+    this->Built = true;
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Returns true on every rank if the ghost structure can update the outputs of inputs on every
+   * rank. Collective.
+   */
+  bool CanUpdate(
+    const std::vector<vtkDataSet*>& inputs, int numberOfGhostLayers, diy::mpi::communicator& comm)
+  {
+    bool valid = this->Built && !this->Pending &&
+      numberOfGhostLayers == this->NumberOfGhostLayers && inputs.size() == this->Signatures.size();
+    for (std::size_t cc = 0; valid && cc < inputs.size(); ++cc)
+    {
+      valid = ComputeGeometrySignature(inputs[cc]) == this->Signatures[cc];
+      for (int association = 0; valid && association < 2; ++association)
+      {
+        const ArrayLayout& layout = this->Layouts[association];
+        const std::vector<vtkDataArray*> arrays = this->GetArrays(inputs[cc], association);
+        for (std::size_t arrayId = 0; valid && arrayId < arrays.size(); ++arrayId)
+        {
+          valid = arrays[arrayId] &&
+            arrays[arrayId]->GetNumberOfComponents() == layout.NumberOfComponents[arrayId] &&
+            arrays[arrayId]->GetNumberOfTuples() == GetNumberOfElements(inputs[cc], association);
+        }
+      }
+    }
+    int localValid = valid ? 1 : 0;
+    int globalValid = 0;
+    diy::mpi::all_reduce(comm, localValid, globalValid, diy::mpi::minimum<int>());
+    return globalValid == 1;
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Fills the outputs with the cached structure and new data arrays holding the values of the
+   * elements copied from the inputs of the rank, and starts exchanging the values of the others.
+   */
+  void BeginUpdate(const std::vector<vtkDataSet*>& inputs, const std::vector<vtkDataSet*>& outputs,
+    diy::mpi::communicator& comm)
+  {
+    std::vector<std::vector<vtkDataArray*>> inputArrays[2];
+    this->PendingOutputs.assign(outputs.begin(), outputs.end());
+    for (std::size_t cc = 0; cc < outputs.size(); ++cc)
+    {
+      vtkDataSet* output = outputs[cc];
+      output->ShallowCopy(this->Outputs[cc]);
+      output->GetFieldData()->ShallowCopy(inputs[cc]->GetFieldData());
+      for (int association = 0; association < 2; ++association)
+      {
+        inputArrays[association].emplace_back(this->GetArrays(inputs[cc], association));
+        std::vector<vtkDataArray*> outputArrays;
+        for (vtkDataArray* inputArray : inputArrays[association].back())
+        {
+          auto array = vtkSmartPointer<vtkDataArray>::Take(
+            vtkDataArray::CreateDataArray(inputArray->GetDataType()));
+          array->SetName(inputArray->GetName());
+          array->SetNumberOfComponents(inputArray->GetNumberOfComponents());
+          array->SetNumberOfTuples(GetNumberOfElements(output, association));
+          GetAttributes(output, association)->AddArray(array);
+          outputArrays.push_back(array);
+        }
+        this->PendingArrays[association].emplace_back(std::move(outputArrays));
+      }
+    }
+
+    for (int association = 0; association < 2; ++association)
+    {
+      for (const LocalCopy& copy : this->LocalCopies[association])
+      {
+        const std::vector<vtkDataArray*>& sources = inputArrays[association][copy.Input];
+        const std::vector<vtkDataArray*>& targets =
+          this->PendingArrays[association][copy.Output];
+        for (std::size_t arrayId = 0; arrayId < sources.size(); ++arrayId)
+        {
+          targets[arrayId]->SetTuple(copy.OutputId, copy.InputId, sources[arrayId]);
+        }
+      }
+    }
+
+    for (const auto& item : this->SendLists)
+    {
+      std::vector<double>& buffer = this->SendBuffers[item.first];
+      buffer.clear();
+      for (int association = 0; association < 2; ++association)
+      {
+        const std::vector<vtkIdType>& ids = item.second[association];
+        for (std::size_t cc = 0; cc < ids.size(); cc += 2)
+        {
+          for (vtkDataArray* array : inputArrays[association][ids[cc]])
+          {
+            for (int component = 0; component < array->GetNumberOfComponents(); ++component)
+            {
+              buffer.push_back(array->GetComponent(ids[cc + 1], component));
+            }
+          }
+        }
+      }
+      this->Requests.emplace_back(comm.isend(item.first, VALUES_TAG, buffer));
+    }
+    for (const auto& item : this->ReceiveLists)
+    {
+      std::vector<double>& buffer = this->ReceiveBuffers[item.first];
+      buffer.resize(item.second[0].size() / 2 * this->Layouts[0].TotalNumberOfComponents +
+        item.second[1].size() / 2 * this->Layouts[1].TotalNumberOfComponents);
+      this->Requests.emplace_back(comm.irecv(item.first, VALUES_TAG, buffer));
+    }
+    this->Pending = true;
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Waits for the values of the update in progress and fills the remaining elements.
+   */
+  bool FinishUpdate()
+  {
+    if (!this->Pending)
+    {
+      return false;
+    }
+    for (diy::mpi::request& request : this->Requests)
+    {
+      request.wait();
+    }
+    for (const auto& item : this->ReceiveLists)
+    {
+      const double* values = this->ReceiveBuffers[item.first].data();
+      for (int association = 0; association < 2; ++association)
+      {
+        const std::vector<vtkIdType>& ids = item.second[association];
+        for (std::size_t cc = 0; cc < ids.size(); cc += 2)
+        {
+          for (vtkDataArray* array : this->PendingArrays[association][ids[cc]])
+          {
+            for (int component = 0; component < array->GetNumberOfComponents(); ++component)
+            {
+              array->SetComponent(ids[cc + 1], component, *values++);
+            }
+          }
+        }
+      }
+    }
+    for (int association = 0; association < 2; ++association)
+    {
+      for (const std::vector<vtkDataArray*>& arrays : this->PendingArrays[association])
+      {
+        for (vtkDataArray* array : arrays)
+        {
+          array->Modified();
+        }
+      }
+      this->PendingArrays[association].clear();
+    }
+    this->PendingOutputs.clear();
+    this->Requests.clear();
+    this->Pending = false;
+    return true;
+  }
+};
+
 //----------------------------------------------------------------------------
 vtkGhostCellsGenerator::vtkGhostCellsGenerator()
   : Controller(nullptr)
   , NumberOfGhostLayers(1)
   , BuildIfRequired(true)
+  , CacheGhostStructure(false)
+  , GhostStructureReused(false)
+  , Internals(new vtkInternals)
 {
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
@@ -56,6 +633,7 @@ vtkGhostCellsGenerator::vtkGhostCellsGenerator()
 //----------------------------------------------------------------------------
 vtkGhostCellsGenerator::~vtkGhostCellsGenerator()
 {
+  this->Internals->FinishUpdate();
   this->SetController(nullptr);
 }
 
@@ -64,6 +642,9 @@ void vtkGhostCellsGenerator::Initialize()
 {
   this->NumberOfGhostLayers = 1;
   this->BuildIfRequired = true;
+  this->CacheGhostStructure = false;
+  this->GhostStructureReused = false;
+  this->Internals->Clear();
   this->SetController(nullptr);
 }
 
@@ -93,24 +674,13 @@ int vtkGhostCellsGenerator::RequestData(
     this->BuildIfRequired ? reqGhostLayers : std::max(reqGhostLayers, this->NumberOfGhostLayers);
 
   std::vector<vtkDataObject*> inputPDSs, outputPDSs;
-
+  ::SplitPartitions(inputDO, outputDO, inputPDSs, outputPDSs);
   if (auto inputPDSC = vtkPartitionedDataSetCollection::SafeDownCast(inputDO))
   {
-    auto outputPDSC = vtkPartitionedDataSetCollection::SafeDownCast(outputDO);
-    outputPDSC->CopyStructure(inputPDSC);
-
-    for (unsigned int pdsId = 0; pdsId < inputPDSC->GetNumberOfPartitionedDataSets(); ++pdsId)
-    {
-      inputPDSs.emplace_back(inputPDSC->GetPartitionedDataSet(pdsId));
-      outputPDSs.emplace_back(outputPDSC->GetPartitionedDataSet(pdsId));
-    }
-  }
-  else
-  {
-    inputPDSs.emplace_back(inputDO);
-    outputPDSs.emplace_back(outputDO);
+    vtkPartitionedDataSetCollection::SafeDownCast(outputDO)->CopyStructure(inputPDSC);
   }
 
+  std::vector<PartitionLeaves> partitions;
   for (int partitionId = 0; partitionId < static_cast<int>(inputPDSs.size()); ++partitionId)
   {
     vtkDataObject* inputPartition = inputPDSs[partitionId];
@@ -163,52 +733,109 @@ int vtkGhostCellsGenerator::RequestData(
       continue;
     }
 
-    std::vector<vtkImageData*> inputsID =
-      vtkCompositeDataSet::GetDataSets<vtkImageData>(inputPartition);
-    std::vector<vtkImageData*> outputsID =
-      vtkCompositeDataSet::GetDataSets<vtkImageData>(outputPartition);
-
-    std::vector<vtkRectilinearGrid*> inputsRG =
-      vtkCompositeDataSet::GetDataSets<vtkRectilinearGrid>(inputPartition);
-    std::vector<vtkRectilinearGrid*> outputsRG =
-      vtkCompositeDataSet::GetDataSets<vtkRectilinearGrid>(outputPartition);
-
-    std::vector<vtkStructuredGrid*> inputsSG =
-      vtkCompositeDataSet::GetDataSets<vtkStructuredGrid>(inputPartition);
-    std::vector<vtkStructuredGrid*> outputsSG =
-      vtkCompositeDataSet::GetDataSets<vtkStructuredGrid>(outputPartition);
+    partitions.emplace_back(inputPartition, outputPartition);
+    const PartitionLeaves& leaves = partitions.back();
+    if (!leaves.InputsID.empty() && !leaves.InputsRG.empty() && !leaves.InputsSG.empty() &&
+      !leaves.InputsUG.empty())
+    {
+      vtkWarningMacro(<< "Ghost cell generator called with mixed types."
+                      << "Ghosts are not exchanged between data sets of different types.");
+    }
+  }
 
-    std::vector<vtkUnstructuredGrid*> inputsUG =
-      vtkCompositeDataSet::GetDataSets<vtkUnstructuredGrid>(inputPartition);
-    std::vector<vtkUnstructuredGrid*> outputsUG =
-      vtkCompositeDataSet::GetDataSets<vtkUnstructuredGrid>(outputPartition);
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(this->Controller);
+  std::vector<vtkDataSet*> allInputs, allOutputs;
+  for (const PartitionLeaves& leaves : partitions)
+  {
+    leaves.Flatten(allInputs, allOutputs);
+  }
 
-    std::vector<vtkPolyData*> inputsPD =
-      vtkCompositeDataSet::GetDataSets<vtkPolyData>(inputPartition);
-    std::vector<vtkPolyData*> outputsPD =
-      vtkCompositeDataSet::GetDataSets<vtkPolyData>(outputPartition);
+  this->GhostStructureReused = this->CacheGhostStructure &&
+    this->Internals->CanUpdate(allInputs, numberOfGhostLayersToCompute, comm);
+  if (this->GhostStructureReused)
+  {
+    this->Internals->BeginUpdate(allInputs, allOutputs, comm);
+    this->Internals->FinishUpdate();
+    return !error;
+  }
 
-    if (!inputsID.empty() && !inputsRG.empty() && !inputsSG.empty() && !inputsUG.empty())
+  // the points and cells of the inputs are tagged with their sources to build the ghost structure
+  std::vector<vtkSmartPointer<vtkDataSet>> taggedInputs;
+  if (this->CacheGhostStructure)
+  {
+    vtkIdType index = 0;
+    for (PartitionLeaves& leaves : partitions)
     {
-      vtkWarningMacro(<< "Ghost cell generator called with mixed types."
-                      << "Ghosts are not exchanged between data sets of different types.");
+      ::AddSourceIds(leaves.InputsID, taggedInputs, index, comm.rank());
+      ::AddSourceIds(leaves.InputsRG, taggedInputs, index, comm.rank());
+      ::AddSourceIds(leaves.InputsSG, taggedInputs, index, comm.rank());
+      ::AddSourceIds(leaves.InputsUG, taggedInputs, index, comm.rank());
+      ::AddSourceIds(leaves.InputsPD, taggedInputs, index, comm.rank());
     }
+  }
 
+  for (PartitionLeaves& leaves : partitions)
+  {
     retVal &= vtkDIYGhostUtilities::GenerateGhostCellsImageData(
-                inputsID, outputsID, numberOfGhostLayersToCompute, this->Controller) &&
+                leaves.InputsID, leaves.OutputsID, numberOfGhostLayersToCompute,
+                this->Controller) &&
       vtkDIYGhostUtilities::GenerateGhostCellsRectilinearGrid(
-        inputsRG, outputsRG, numberOfGhostLayersToCompute, this->Controller) &&
+        leaves.InputsRG, leaves.OutputsRG, numberOfGhostLayersToCompute, this->Controller) &&
       vtkDIYGhostUtilities::GenerateGhostCellsStructuredGrid(
-        inputsSG, outputsSG, numberOfGhostLayersToCompute, this->Controller) &&
+        leaves.InputsSG, leaves.OutputsSG, numberOfGhostLayersToCompute, this->Controller) &&
       vtkDIYGhostUtilities::GenerateGhostCellsUnstructuredGrid(
-        inputsUG, outputsUG, numberOfGhostLayersToCompute, this->Controller) &&
+        leaves.InputsUG, leaves.OutputsUG, numberOfGhostLayersToCompute, this->Controller) &&
       vtkDIYGhostUtilities::GenerateGhostCellsPolyData(
-        inputsPD, outputsPD, numberOfGhostLayersToCompute, this->Controller);
+        leaves.InputsPD, leaves.OutputsPD, numberOfGhostLayersToCompute, this->Controller);
+  }
+
+  if (this->CacheGhostStructure)
+  {
+    this->Internals->Build(allInputs, allOutputs, numberOfGhostLayersToCompute, comm);
+  }
+  else
+  {
+    this->Internals->Clear();
   }
 
   return retVal && !error;
 }
 
+//----------------------------------------------------------------------------
+bool vtkGhostCellsGenerator::BeginGhostUpdate()
+{
+  vtkDataObject* inputDO = this->GetInputDataObject(0, 0);
+  vtkDataObject* outputDO = this->GetOutputDataObject(0);
+  if (!this->CacheGhostStructure || !inputDO || !outputDO)
+  {
+    vtkErrorMacro(<< "BeginGhostUpdate requires CacheGhostStructure and an executed filter.");
+    return false;
+  }
+
+  std::vector<vtkDataObject*> inputPDSs, outputPDSs;
+  ::SplitPartitions(inputDO, outputDO, inputPDSs, outputPDSs);
+  std::vector<vtkDataSet*> inputs, outputs;
+  for (std::size_t partitionId = 0; partitionId < inputPDSs.size(); ++partitionId)
+  {
+    PartitionLeaves(inputPDSs[partitionId], outputPDSs[partitionId]).Flatten(inputs, outputs);
+  }
+
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(this->Controller);
+  if (inputs.size() != outputs.size() ||
+    !this->Internals->CanUpdate(inputs, this->Internals->NumberOfGhostLayers, comm))
+  {
+    return false;
+  }
+  this->Internals->BeginUpdate(inputs, outputs, comm);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkGhostCellsGenerator::FinishGhostUpdate()
+{
+  return this->Internals->FinishUpdate();
+}
+
 //----------------------------------------------------------------------------
 int vtkGhostCellsGenerator::RequestUpdateExtent(
   vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector*)
@@ -225,5 +852,7 @@ void vtkGhostCellsGenerator::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "CacheGhostStructure: " << this->CacheGhostStructure << endl;
+  os << indent << "GhostStructureReused: " << this->GhostStructureReused << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -57,6 +57,13 @@
  * after the ghost points are generated. One can keep track of which process owns a non-ghost copy
  * of the point if an array associating each point with its process id is available in the input.
  *
+ * If `CacheGhostStructure` is on, the filter keeps the ghost structure computed by its last
+ * execution: the output geometry, the neighboring blocks and the lists of points and cells to send
+ * and receive. As long as the geometry of the input does not change, following executions only
+ * move the values of the point and cell data arrays. `BeginGhostUpdate` and `FinishGhostUpdate`
+ * split such an update in two phases, so that work on the cells owned by the rank can overlap the
+ * communication of the values of the ghosts.
+ *
  * @warning If an input already holds ghosts, the input ghost cells should be tagged as
  * `CELLDUPLICATE` in order for this filter to work properly.
  *
@@ -79,6 +86,8 @@
 #include "vtkFiltersParallelDIY2Module.h" // for export macros
 #include "vtkPassInputTypeAlgorithm.h"
 
+#include <memory> // for std::unique_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkMultiProcessController;
 
@@ -129,6 +138,40 @@ public:
   vtkSetClampMacro(NumberOfGhostLayers, int, 0, VTK_INT_MAX);
   ///@}
 
+  ///@{
+  /**
+   * Specify if the filter keeps the ghost structure of its last execution to only update the
+   * values of the point and cell data arrays of the ghosts while the geometry of the input does
+   * not change. The geometry changes when any of the points, cells, extents, coordinates or ghost
+   * arrays of the input datasets are replaced or modified. The values of the data arrays are sent
+   * as doubles. Default is false.
+   */
+  vtkSetMacro(CacheGhostStructure, bool);
+  vtkGetMacro(CacheGhostStructure, bool);
+  vtkBooleanMacro(CacheGhostStructure, bool);
+  ///@}
+
+  /**
+   * Returns true if the most recent execution reused the cached ghost structure.
+   */
+  vtkGetMacro(GhostStructureReused, bool);
+
+  ///@{
+  /**
+   * Split-phase update of the ghosts of the output after the values of the point or cell data
+   * arrays of the input changed, outside of a pipeline update. `BeginGhostUpdate` replaces the
+   * arrays of the output with arrays holding the values of the points and cells owned by the
+   * current rank and starts sending the values of the ghosts, `FinishGhostUpdate` waits for them
+   * and fills the ghosts. Work on the owned points and cells of the output can be done in between.
+   *
+   * Both methods are collective and require `CacheGhostStructure` and a previous execution of the
+   * filter. `BeginGhostUpdate` returns false if the ghost structure cannot be reused, in which
+   * case the filter must be updated instead.
+   */
+  bool BeginGhostUpdate();
+  bool FinishGhostUpdate();
+  ///@}
+
 protected:
   vtkGhostCellsGenerator();
   ~vtkGhostCellsGenerator() override;
@@ -145,10 +188,15 @@ protected:
 
   int NumberOfGhostLayers;
   bool BuildIfRequired;
+  bool CacheGhostStructure;
+  bool GhostStructureReused;
 
 private:
   vtkGhostCellsGenerator(const vtkGhostCellsGenerator&) = delete;
   void operator=(const vtkGhostCellsGenerator&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 };
 
 VTK_ABI_NAMESPACE_END
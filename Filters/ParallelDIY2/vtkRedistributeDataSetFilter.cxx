@@ -16,13 +16,16 @@
 #include "vtkRedistributeDataSetFilter.h"
 
 #include "vtkAppendFilter.h"
+#include "vtkCellCenters.h"
 #include "vtkCellData.h"
+#include "vtkCellTypes.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDIYKdTreeUtilities.h"
 #include "vtkDIYUtilities.h"
 #include "vtkDataAssembly.h"
 #include "vtkDataAssemblyUtilities.h"
 #include "vtkDataObjectTreeRange.h"
+#include "vtkDoubleArray.h"
 #include "vtkExtractCells.h"
 #include "vtkFieldData.h"
 #include "vtkGenericCell.h"
@@ -40,6 +43,7 @@
 #include "vtkPlane.h"
 #include "vtkPlanes.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkStaticCellLinks.h"
@@ -47,11 +51,15 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <numeric>
 
 // clang-format off
 #include "vtk_diy2.h"
 #include VTK_DIY2(diy/assigner.hpp)
+#include VTK_DIY2(diy/mpi.hpp)
 // clang-format on
 
 namespace
@@ -260,6 +268,14 @@ vtkRedistributeDataSetFilter::vtkRedistributeDataSetFilter()
   , EnableDebugging(false)
   , ValidDim{ true, true, true }
   , LoadBalanceAcrossAllBlocks{ true }
+  , CellWeighting(vtkRedistributeDataSetFilter::UNIFORM_CELL_WEIGHTS)
+  , CellWeightsArrayName(nullptr)
+  , UseIncrementalCuts(false)
+  , MaximumImbalance(0.1)
+  , CutsReused(false)
+  , Imbalance(0.0)
+  , NumberOfBytesMoved(0)
+  , PreviousNumberOfPartitions(-1)
 {
   this->SetNumberOfInputPorts(1);
   this->SetNumberOfOutputPorts(1);
@@ -270,6 +286,7 @@ vtkRedistributeDataSetFilter::vtkRedistributeDataSetFilter()
 vtkRedistributeDataSetFilter::~vtkRedistributeDataSetFilter()
 {
   this->SetController(nullptr);
+  this->SetCellWeightsArrayName(nullptr);
 }
 
 //------------------------------------------------------------------------------
@@ -441,6 +458,10 @@ int vtkRedistributeDataSetFilter::RequestData(
   vtkNew<vtkPartitionedDataSetCollection> result;
   result->CopyStructure(inputCollection);
 
+  this->CutsReused = this->UseIncrementalCuts && !this->UseExplicitCuts;
+  this->Imbalance = 0.0;
+  this->NumberOfBytesMoved = 0;
+
   if (this->LoadBalanceAcrossAllBlocks)
   {
     // since we're load balancing across all blocks, build cuts using the whole
@@ -466,7 +487,7 @@ int vtkRedistributeDataSetFilter::RequestData(
     {
       // when not load balancing globally, initialize cuts per partitioned
       // dataset.
-      this->InitializeCuts(inputPTD);
+      this->InitializeCuts(inputPTD, part);
     }
 
     // redistribute each block using cuts already computed (or specified).
@@ -561,7 +582,7 @@ int vtkRedistributeDataSetFilter::RequestData(
 }
 
 //------------------------------------------------------------------------------
-bool vtkRedistributeDataSetFilter::InitializeCuts(vtkDataObjectTree* input)
+bool vtkRedistributeDataSetFilter::InitializeCuts(vtkDataObjectTree* input, unsigned int index)
 {
   assert(vtkPartitionedDataSet::SafeDownCast(input) ||
     vtkPartitionedDataSetCollection::SafeDownCast(input));
@@ -594,11 +615,73 @@ bool vtkRedistributeDataSetFilter::InitializeCuts(vtkDataObjectTree* input)
   }
   else
   {
-    this->Cuts = this->GenerateCuts(input);
+    auto controller = this->GetController();
+    const int num_partitions = (controller && this->GetNumberOfPartitions() == 0)
+      ? controller->GetNumberOfProcesses()
+      : this->GetNumberOfPartitions();
+    if (num_partitions != this->PreviousNumberOfPartitions)
+    {
+      this->PreviousCuts.clear();
+      this->PreviousNumberOfPartitions = num_partitions;
+    }
+
+    if (this->UseIncrementalCuts && index < this->PreviousCuts.size() &&
+      !this->PreviousCuts[index].empty() &&
+      this->ComputeImbalance(input, this->PreviousCuts[index]) &&
+      this->Imbalance <= this->MaximumImbalance)
+    {
+      this->Cuts = this->PreviousCuts[index];
+    }
+    else
+    {
+      this->Cuts = this->GenerateCuts(input);
+      this->CutsReused = false;
+    }
+
+    if (this->UseIncrementalCuts)
+    {
+      this->PreviousCuts.resize(std::max(this->PreviousCuts.size(), size_t(index) + 1));
+      this->PreviousCuts[index] = this->Cuts;
+    }
   }
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkRedistributeDataSetFilter::ComputeImbalance(
+  vtkDataObjectTree* input, const std::vector<vtkBoundingBox>& cuts)
+{
+  // the weights of the cells of each cut, followed by the weight of the cells
+  // outside of all the cuts.
+  std::vector<double> local_weights(cuts.size() + 1, 0.0);
+  for (auto ds : vtkCompositeDataSet::GetDataSets(input))
+  {
+    if (ds->GetNumberOfCells() == 0)
+    {
+      continue;
+    }
+    const auto weights = this->ComputeCellWeights(ds);
+    const auto regions = detail::GenerateCellRegions(ds, cuts, /*duplicate_boundary_cells=*/false);
+    for (vtkIdType cellId = 0; cellId < ds->GetNumberOfCells(); ++cellId)
+    {
+      const size_t cutId = regions[cellId].empty() ? cuts.size() : regions[cellId][0];
+      local_weights[cutId] += weights->GetValue(cellId);
+    }
+  }
+
+  auto comm = vtkDIYUtilities::GetCommunicator(this->Controller);
+  std::vector<double> global_weights;
+  diy::mpi::all_reduce(comm, local_weights, global_weights, std::plus<double>());
+  const double outside = global_weights.back();
+  global_weights.pop_back();
+
+  const double total = std::accumulate(global_weights.begin(), global_weights.end(), 0.0);
+  const double heaviest = *std::max_element(global_weights.begin(), global_weights.end());
+  const double imbalance = total > 0 ? heaviest * cuts.size() / total - 1.0 : 0.0;
+  this->Imbalance = std::max(this->Imbalance, imbalance);
+  return outside == 0;
+}
+
 //------------------------------------------------------------------------------
 std::vector<vtkBoundingBox> vtkRedistributeDataSetFilter::GenerateCuts(vtkDataObject* dobj)
 {
@@ -624,8 +707,83 @@ std::vector<vtkBoundingBox> vtkRedistributeDataSetFilter::GenerateCuts(vtkDataOb
 
   double bds[6];
   bbox.GetBounds(bds);
+  if (this->CellWeighting == vtkRedistributeDataSetFilter::UNIFORM_CELL_WEIGHTS)
+  {
+    return vtkDIYKdTreeUtilities::GenerateCuts(
+      dobj, std::max(1, num_partitions), /*use_cell_centers=*/true, controller, bds);
+  }
+
+  std::vector<vtkSmartPointer<vtkPoints>> centers;
+  std::vector<vtkSmartPointer<vtkDoubleArray>> weights;
+  for (auto ds : vtkCompositeDataSet::GetDataSets(dobj))
+  {
+    vtkNew<vtkDoubleArray> coords;
+    coords->SetNumberOfComponents(3);
+    coords->SetNumberOfTuples(ds->GetNumberOfCells());
+    vtkCellCenters::ComputeCellCenters(ds, coords);
+    vtkNew<vtkPoints> points;
+    points->SetData(coords);
+    centers.emplace_back(points);
+    weights.emplace_back(this->ComputeCellWeights(ds));
+  }
   return vtkDIYKdTreeUtilities::GenerateCuts(
-    dobj, std::max(1, num_partitions), /*use_cell_centers=*/true, controller, bds);
+    centers, weights, std::max(1, num_partitions), controller, bds);
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDoubleArray> vtkRedistributeDataSetFilter::ComputeCellWeights(
+  vtkDataSet* dataset)
+{
+  const vtkIdType numCells = dataset->GetNumberOfCells();
+  vtkNew<vtkDoubleArray> weights;
+  weights->SetNumberOfTuples(numCells);
+
+  vtkDataArray* array = nullptr;
+  if (this->CellWeighting == vtkRedistributeDataSetFilter::ARRAY_CELL_WEIGHTS)
+  {
+    array = this->CellWeightsArrayName
+      ? dataset->GetCellData()->GetArray(this->CellWeightsArrayName)
+      : nullptr;
+    if (array == nullptr && numCells > 0)
+    {
+      vtkWarningMacro("Missing cell weights array '"
+        << (this->CellWeightsArrayName ? this->CellWeightsArrayName : "(none)")
+        << "', using uniform weights.");
+    }
+  }
+
+  // GetCellType and GetCellSize are thread safe once GetCell was called from a
+  // single thread
+  if (numCells > 0)
+  {
+    vtkNew<vtkGenericCell> cell;
+    dataset->GetCell(0, cell);
+  }
+  const bool estimate = this->CellWeighting == vtkRedistributeDataSetFilter::ESTIMATED_CELL_WEIGHTS;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      const int type = dataset->GetCellType(cellId);
+      double weight = type == VTK_EMPTY_CELL ? 0.0 : 1.0;
+      if (array)
+      {
+        weight = std::max(0.0, array->GetComponent(cellId, 0));
+      }
+      else if (estimate && weight > 0.0)
+      {
+        // higher order cells, polyhedra and convex point sets are subdivided
+        // or triangulated by most filters
+        weight = static_cast<double>(dataset->GetCellSize(cellId));
+        if (!vtkCellTypes::IsLinear(static_cast<unsigned char>(type)) ||
+          type == VTK_POLYHEDRON || type == VTK_CONVEX_POINT_SET)
+        {
+          weight *= 2.0;
+        }
+      }
+      weights->SetValue(cellId, weight);
+    }
+  });
+  return weights;
 }
 
 //------------------------------------------------------------------------------
@@ -787,7 +945,8 @@ bool vtkRedistributeDataSetFilter::RedistributeDataSet(
   auto parts = this->SplitDataSet(inputDS, cuts);
   assert(parts->GetNumberOfPartitions() == static_cast<unsigned int>(cuts.size()));
 
-  auto pieces = vtkDIYKdTreeUtilities::Exchange(parts, this->GetController(), this->Assigner);
+  auto pieces = vtkDIYKdTreeUtilities::Exchange(
+    parts, this->GetController(), this->Assigner, &this->NumberOfBytesMoved);
   assert(pieces->GetNumberOfPartitions() == parts->GetNumberOfPartitions());
   outputPDS->CompositeShallowCopy(pieces);
   return true;
@@ -1144,5 +1303,13 @@ void vtkRedistributeDataSetFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ExpandExplicitCuts: " << this->ExpandExplicitCuts << endl;
   os << indent << "EnableDebugging: " << this->EnableDebugging << endl;
   os << indent << "LoadBalanceAcrossAllBlocks: " << this->LoadBalanceAcrossAllBlocks << endl;
+  os << indent << "CellWeighting: " << this->CellWeighting << endl;
+  os << indent << "CellWeightsArrayName: "
+     << (this->CellWeightsArrayName ? this->CellWeightsArrayName : "(none)") << endl;
+  os << indent << "UseIncrementalCuts: " << this->UseIncrementalCuts << endl;
+  os << indent << "MaximumImbalance: " << this->MaximumImbalance << endl;
+  os << indent << "CutsReused: " << this->CutsReused << endl;
+  os << indent << "Imbalance: " << this->Imbalance << endl;
+  os << indent << "NumberOfBytesMoved: " << this->NumberOfBytesMoved << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -46,6 +46,16 @@
  * on when it is known that the data is spatially partitioned as is the case
  * after this filter has executed.
  *
+ * @section vtkRedistributeDataSetFilter-CellWeights  Cell Weights
+ *
+ * By default each cell counts the same when computing the cuts. When the cost
+ * of the cells varies, e.g. with higher order cells or polyhedra processed by
+ * the downstream filters, `CellWeighting` lets the cuts balance the sum of
+ * per-cell weights instead, either estimated from the type and the number of
+ * points of the cells or read from a cell array (see `CellWeightsArrayName`).
+ * Subclasses can provide their own cost model by overriding
+ * `ComputeCellWeights`.
+ *
  * @section vtkRedistributeDataSetFilter-SupportedDataTypes  Supported Data Types
  *
  * vtkRedistributeDataSetFilter is primarily intended for unstructured datasets
@@ -89,6 +99,7 @@ class vtkPartitionedDataSet;
 class vtkMultiBlockDataSet;
 class vtkMultiPieceDataSet;
 class vtkDataObjectTree;
+class vtkDoubleArray;
 
 class VTKFILTERSPARALLELDIY2_EXPORT vtkRedistributeDataSetFilter : public vtkDataObjectAlgorithm
 {
@@ -267,6 +278,94 @@ public:
   vtkBooleanMacro(EnableDebugging, bool);
   ///@}
 
+  enum CellWeightModes
+  {
+    UNIFORM_CELL_WEIGHTS = 0,
+    ESTIMATED_CELL_WEIGHTS = 1,
+    ARRAY_CELL_WEIGHTS = 2
+  };
+
+  ///@{
+  /**
+   * Specify how cells are weighted when generating the cuts.
+   *
+   * \li `UNIFORM_CELL_WEIGHTS` balances the number of cells per partition.
+   * \li `ESTIMATED_CELL_WEIGHTS` balances the estimated cost of the cells,
+   *      their number of points, doubled for non-linear cells and for
+   *      polyhedra and convex point sets.
+   * \li `ARRAY_CELL_WEIGHTS` balances the values of the cell array named by
+   *      `CellWeightsArrayName`, falling back to uniform weights for datasets
+   *      without this array.
+   *
+   * This has no effect when `UseExplicitCuts` is true. Default is
+   * `UNIFORM_CELL_WEIGHTS`.
+   */
+  vtkSetClampMacro(CellWeighting, int, UNIFORM_CELL_WEIGHTS, ARRAY_CELL_WEIGHTS);
+  vtkGetMacro(CellWeighting, int);
+  void SetCellWeightingToUniform() { this->SetCellWeighting(UNIFORM_CELL_WEIGHTS); }
+  void SetCellWeightingToEstimated() { this->SetCellWeighting(ESTIMATED_CELL_WEIGHTS); }
+  void SetCellWeightingToArray() { this->SetCellWeighting(ARRAY_CELL_WEIGHTS); }
+  ///@}
+
+  ///@{
+  /**
+   * Name of the cell array of weights used when `CellWeighting` is
+   * `ARRAY_CELL_WEIGHTS`. Negative weights are treated as 0.
+   */
+  vtkSetStringMacro(CellWeightsArrayName);
+  vtkGetStringMacro(CellWeightsArrayName);
+  ///@}
+
+  ///@{
+  /**
+   * When UseExplicitCuts is false, set this to true to reuse the cuts of the
+   * previous execution as long as they are balanced enough for the current
+   * input, e.g. for time-varying data whose decomposition barely changes. The
+   * cuts are regenerated when the heaviest one holds more than the mean
+   * weight of the cuts times 1 + `MaximumImbalance`, when a cell center lies
+   * outside of all the cuts or when the number of partitions changed.
+   *
+   * When the input of a time step is the output of the previous one, e.g. in
+   * a simulation loop, the cells already on the rank of their cut are not
+   * sent again and only the cells that crossed the boundaries of the cuts
+   * move.
+   *
+   * Default is false.
+   */
+  vtkSetMacro(UseIncrementalCuts, bool);
+  vtkGetMacro(UseIncrementalCuts, bool);
+  vtkBooleanMacro(UseIncrementalCuts, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Largest imbalance of the previous cuts, relative to the mean weight of
+   * the cuts, that lets `UseIncrementalCuts` reuse them. Default is 0.1.
+   */
+  vtkSetClampMacro(MaximumImbalance, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(MaximumImbalance, double);
+  ///@}
+
+  /**
+   * Returns true if the most recent `RequestData` call reused the cuts of the
+   * previous one, see `UseIncrementalCuts`.
+   */
+  vtkGetMacro(CutsReused, bool);
+
+  /**
+   * Returns the imbalance of the previous cuts for the input of the most
+   * recent `RequestData` call, as the largest weight of a cut over the mean
+   * weight of the cuts minus 1. This is only computed when
+   * `UseIncrementalCuts` is true and previous cuts exist, and is 0 otherwise.
+   */
+  vtkGetMacro(Imbalance, double);
+
+  /**
+   * Returns the memory size, in bytes, of the parts of the data that this rank
+   * sent to other ranks during the most recent `RequestData` call.
+   */
+  vtkGetMacro(NumberOfBytesMoved, vtkTypeUInt64);
+
   ///@{
   /**
    * When UseExplicitCuts is false, and input is a
@@ -300,6 +399,15 @@ protected:
    */
   virtual std::vector<vtkBoundingBox> GenerateCuts(vtkDataObject* data);
 
+  /**
+   * This method is called by `GenerateCuts` when `CellWeighting` is not
+   * `UNIFORM_CELL_WEIGHTS` to compute the weight of each cell of the dataset,
+   * and to measure the imbalance of the cuts with `UseIncrementalCuts`.
+   * Subclasses can override this to provide a different cost model. The
+   * returned array must have one non-negative value per cell.
+   */
+  virtual vtkSmartPointer<vtkDoubleArray> ComputeCellWeights(vtkDataSet* dataset);
+
   /**
    * This method is called to split a vtkDataSet into multiple datasets by the
    * vector of `vtkBoundingBox` passed in. The returned vtkPartitionedDataSet
@@ -317,7 +425,8 @@ private:
   vtkRedistributeDataSetFilter(const vtkRedistributeDataSetFilter&) = delete;
   void operator=(const vtkRedistributeDataSetFilter&) = delete;
 
-  bool InitializeCuts(vtkDataObjectTree* input);
+  bool InitializeCuts(vtkDataObjectTree* input, unsigned int index = 0);
+  bool ComputeImbalance(vtkDataObjectTree* input, const std::vector<vtkBoundingBox>& cuts);
   bool Redistribute(vtkPartitionedDataSet* inputDO, vtkPartitionedDataSet* outputPDS,
     const std::vector<vtkBoundingBox>& cuts, vtkIdType* mb_offset = nullptr);
   bool RedistributeDataSet(
@@ -347,6 +456,16 @@ private:
   bool EnableDebugging;
   bool ValidDim[3];
   bool LoadBalanceAcrossAllBlocks;
+  int CellWeighting;
+  char* CellWeightsArrayName;
+  bool UseIncrementalCuts;
+  double MaximumImbalance;
+  bool CutsReused;
+  double Imbalance;
+  vtkTypeUInt64 NumberOfBytesMoved;
+  // cuts of the previous execution for each partitioned dataset of the input
+  std::vector<std::vector<vtkBoundingBox>> PreviousCuts;
+  int PreviousNumberOfPartitions;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -268,127 +268,186 @@ void vtkPParticleTracerBase::AssignUniqueIds(
 bool vtkPParticleTracerBase::SendReceiveParticles(
   RemoteParticleVector& sParticles, RemoteParticleVector& rParticles)
 {
-  int numParticles = static_cast<int>(sParticles.size());
+  const int numProcs = this->Controller->GetNumberOfProcesses();
+  const int myRank = this->Controller->GetLocalProcessId();
+  const int numParticles = static_cast<int>(sParticles.size());
+
+  // A particle is sent only to the processes whose data bounds contain it,
+  // instead of to all the processes, and the exchanges are personalized.
+  double localBounds[6];
+  this->GetLocalBounds(localBounds);
+  std::vector<double> allBounds(6 * numProcs);
+  this->Controller->AllGather(localBounds, allBounds.data(), 6);
+
+  std::vector<std::vector<int>> candidates(numProcs);
+  for (int i = 0; i < numParticles; i++)
+  {
+    const double* pos = sParticles[i].Current.CurrentPosition.x;
+    for (int proc = 0; proc < numProcs; ++proc)
+    {
+      const double* b = &allBounds[6 * proc];
+      if (proc != myRank && pos[0] >= b[0] && pos[0] <= b[1] && pos[1] >= b[2] &&
+        pos[1] <= b[3] && pos[2] >= b[4] && pos[2] <= b[5])
+      {
+        candidates[proc].push_back(i);
+      }
+    }
+  }
 
-  std::vector<int> allNumParticles(this->Controller->GetNumberOfProcesses(), 0);
-  // Broadcast and receive size to/from all other processes.
-  this->Controller->AllGather(&numParticles, allNumParticles.data(), 1);
+  // the number of particles sent to and received from each process
+  std::vector<int> sendCounts(numProcs), recvCounts(numProcs);
+  std::vector<vtkIdType> ones(numProcs, 1), ranks(numProcs);
+  for (int proc = 0; proc < numProcs; ++proc)
+  {
+    sendCounts[proc] = static_cast<int>(candidates[proc].size());
+    ranks[proc] = proc;
+  }
+  vtkCommunicator::CollectiveRequest countsRequest;
+  this->Controller->NoBlockAllToAllV(sendCounts.data(), ones.data(), ranks.data(),
+    recvCounts.data(), ones.data(), ranks.data(), countsRequest);
 
-  // write the message
+  // write the message while the counts are exchanged, each particle padded to
+  // a whole number of doubles
   const int size1 = sizeof(ParticleInformation);
   const int nArrays = this->ProtoPD->GetNumberOfArrays();
-  unsigned int typeSize = 2 * size1;
-  for (int i = 0; i < this->ProtoPD->GetNumberOfArrays(); i++)
+  size_t typeSize = 2 * size1;
+  for (int i = 0; i < nArrays; i++)
   {
     typeSize += this->ProtoPD->GetArray(i)->GetNumberOfComponents() * sizeof(double);
   }
+  const vtkIdType typeLength =
+    static_cast<vtkIdType>((typeSize + sizeof(double) - 1) / sizeof(double));
 
-  vtkIdType messageSize = numParticles * typeSize;
-  std::vector<char> sendMessage(messageSize, 0);
-  for (int i = 0; i < numParticles; i++)
+  std::vector<vtkIdType> sendLengths(numProcs), sendOffsets(numProcs);
+  vtkIdType numSent = 0;
+  for (int proc = 0; proc < numProcs; ++proc)
   {
-    memcpy(&sendMessage[i * typeSize], &sParticles[i].Current, size1);
-    memcpy(&sendMessage[i * typeSize] + size1, &sParticles[i].Previous, size1);
-
-    vtkPointData* pd = sParticles[i].PreviousPD;
-    char* data = &sendMessage[i * typeSize] + 2 * size1;
-    for (int j = 0; j < nArrays; j++)
+    sendOffsets[proc] = numSent;
+    numSent += sendCounts[proc];
+  }
+  std::vector<double> sendMessage(numSent * typeLength, 0.0);
+  for (int proc = 0; proc < numProcs; ++proc)
+  {
+    for (size_t k = 0; k < candidates[proc].size(); ++k)
     {
-      vtkDataArray* arr = pd->GetArray(j);
-      assert(arr->GetNumberOfTuples() == 1);
-      int numComponents = arr->GetNumberOfComponents();
-      double* y = arr->GetTuple(0);
-      int dataSize = sizeof(double) * numComponents;
-      memcpy(data, y, dataSize);
-      data += dataSize;
+      RemoteParticleInfo& particle = sParticles[candidates[proc][k]];
+      char* message = reinterpret_cast<char*>(&sendMessage[(sendOffsets[proc] + k) * typeLength]);
+      memcpy(message, &particle.Current, size1);
+      memcpy(message + size1, &particle.Previous, size1);
+
+      vtkPointData* pd = particle.PreviousPD;
+      char* data = message + 2 * size1;
+      for (int j = 0; j < nArrays; j++)
+      {
+        vtkDataArray* arr = pd->GetArray(j);
+        assert(arr->GetNumberOfTuples() == 1);
+        int numComponents = arr->GetNumberOfComponents();
+        double* y = arr->GetTuple(0);
+        int dataSize = sizeof(double) * numComponents;
+        memcpy(data, y, dataSize);
+        data += dataSize;
+      }
     }
   }
+  countsRequest.Wait();
 
-  std::vector<vtkIdType> messageLength(this->Controller->GetNumberOfProcesses(), 0);
-  std::vector<vtkIdType> messageOffset(this->Controller->GetNumberOfProcesses(), 0);
-  int allMessageSize(0);
-  int numAllParticles(0);
-  for (int i = 0; i < this->Controller->GetNumberOfProcesses(); ++i)
+  std::vector<vtkIdType> recvOffsets(numProcs);
+  vtkIdType numReceived = 0;
+  for (int proc = 0; proc < numProcs; ++proc)
+  {
+    recvOffsets[proc] = numReceived;
+    numReceived += recvCounts[proc];
+  }
+  std::vector<vtkIdType> sendMessageLengths(numProcs), sendMessageOffsets(numProcs);
+  std::vector<vtkIdType> recvMessageLengths(numProcs), recvMessageOffsets(numProcs);
+  for (int proc = 0; proc < numProcs; ++proc)
   {
-    numAllParticles += allNumParticles[i];
-    messageLength[i] = allNumParticles[i] * typeSize;
-    messageOffset[i] = allMessageSize;
-    allMessageSize += messageLength[i];
+    sendMessageLengths[proc] = sendCounts[proc] * typeLength;
+    sendMessageOffsets[proc] = sendOffsets[proc] * typeLength;
+    recvMessageLengths[proc] = recvCounts[proc] * typeLength;
+    recvMessageOffsets[proc] = recvOffsets[proc] * typeLength;
+    sendLengths[proc] = sendCounts[proc];
   }
+  std::vector<vtkIdType> recvLengths(recvCounts.begin(), recvCounts.end());
 
   // receive the message
-
-  std::vector<char> recvMessage(allMessageSize, 0);
-  this->Controller->AllGatherV(messageSize > 0 ? sendMessage.data() : nullptr,
-    allMessageSize > 0 ? recvMessage.data() : nullptr, messageSize, messageLength.data(),
-    messageOffset.data());
-
-  int myRank = this->Controller->GetLocalProcessId();
-
-  // owningProcess is used to make sure that particles that are sent aren't added
-  // on multiple processes
-  std::vector<vtkIdType> owningProcess(numAllParticles, -1);
-  // we automatically ignore particles that we sent
-  int ignoreBegin = messageOffset[myRank] / typeSize;
-  int ignoreEnd = ignoreBegin + messageLength[myRank] / typeSize;
-  for (int i = 0; i < numAllParticles; i++)
+  std::vector<double> recvMessage(numReceived * typeLength, 0.0);
+  vtkCommunicator::CollectiveRequest messageRequest;
+  this->Controller->NoBlockAllToAllV(sendMessage.data(), sendMessageLengths.data(),
+    sendMessageOffsets.data(), recvMessage.data(), recvMessageLengths.data(),
+    recvMessageOffsets.data(), messageRequest);
+  messageRequest.Wait();
+
+  // claim the particles that are in this process's domain for the latest time
+  // step, and return the claims to the senders
+  std::vector<int> claims(numReceived, -1);
+  for (vtkIdType i = 0; i < numReceived; i++)
   {
-    if (i < ignoreBegin || i >= ignoreEnd)
+    ParticleInformation tmpParticle;
+    memcpy(&tmpParticle, &recvMessage[i * typeLength], size1);
+    // since this is first test, avoid bad cache tests
+    this->GetInterpolator()->ClearCache();
+    int searchResult = this->GetInterpolator()->TestPoint(tmpParticle.CurrentPosition.x);
+    if (searchResult == IDStates::INSIDE_ALL || searchResult == IDStates::OUTSIDE_T0)
     {
-      ParticleInformation tmpParticle;
-      memcpy(&tmpParticle, &recvMessage[i * typeSize], size1);
-      // since this is first test, avoid bad cache tests
-      this->GetInterpolator()->ClearCache();
-      int searchResult = this->GetInterpolator()->TestPoint(tmpParticle.CurrentPosition.x);
-      if (searchResult == IDStates::INSIDE_ALL || searchResult == IDStates::OUTSIDE_T0)
-      {
-        // this particle is in this process's domain for the latest time step
-        owningProcess[i] = myRank;
-      }
+      claims[i] = myRank;
     }
   }
-  std::vector<vtkIdType> realOwningProcess(numAllParticles);
-  if (numAllParticles)
+  std::vector<int> sentClaims(numSent, -1);
+  vtkCommunicator::CollectiveRequest claimsRequest;
+  this->Controller->NoBlockAllToAllV(claims.data(), recvLengths.data(), recvOffsets.data(),
+    sentClaims.data(), sendLengths.data(), sendOffsets.data(), claimsRequest);
+  claimsRequest.Wait();
+
+  // the highest claiming process owns a particle, so that it is not added on
+  // multiple processes, and each candidate is told whether it won
+  std::vector<int> owners(numParticles, -1);
+  for (int proc = 0; proc < numProcs; ++proc)
   {
-    this->Controller->AllReduce(
-      owningProcess.data(), realOwningProcess.data(), numAllParticles, vtkCommunicator::MAX_OP);
+    for (size_t k = 0; k < candidates[proc].size(); ++k)
+    {
+      int& owner = owners[candidates[proc][k]];
+      owner = std::max(owner, sentClaims[sendOffsets[proc] + k]);
+    }
   }
-
-  // if any value in realOwningProcess array is not -1 then we know
-  // that a particle was moved to another process and probably needs
-  // to be integrated further
-  bool particlesMoved = false; // assume no particles moved
-
-  // read the message for the particles that we really want
-  int counter = 0;
-  for (std::vector<vtkIdType>::iterator it = realOwningProcess.begin();
-       it != realOwningProcess.end(); ++it)
+  int localMoved = 0;
+  for (int proc = 0; proc < numProcs; ++proc)
   {
-    if (*it != -1)
+    for (size_t k = 0; k < candidates[proc].size(); ++k)
     {
-      particlesMoved = true;
-      if (*it == myRank)
-      {
-        counter++;
-      }
+      const int owner = owners[candidates[proc][k]];
+      sentClaims[sendOffsets[proc] + k] = owner;
+      localMoved |= owner != -1;
     }
   }
-  rParticles.resize(counter);
-  counter = 0;
-  // owningProcess is used to make sure that particles that are sent aren't added
-  // on multiple processes
-
-  for (int i = 0; i < numAllParticles; i++)
+  std::vector<int> receivedOwners(numReceived, -1);
+  vtkCommunicator::CollectiveRequest ownersRequest;
+  this->Controller->NoBlockAllToAllV(sentClaims.data(), sendLengths.data(), sendOffsets.data(),
+    receivedOwners.data(), recvLengths.data(), recvOffsets.data(), ownersRequest);
+
+  // if any particle was moved to another process, it probably needs to be
+  // integrated further on all the processes, find it out while reading the
+  // particles that we really want
+  int particlesMoved = 0;
+  vtkCommunicator::CollectiveRequest movedRequest;
+  this->Controller->NoBlockAllReduce(
+    &localMoved, &particlesMoved, 1, vtkCommunicator::MAX_OP, movedRequest);
+  ownersRequest.Wait();
+
+  rParticles.resize(std::count(receivedOwners.begin(), receivedOwners.end(), myRank));
+  int counter = 0;
+  for (vtkIdType i = 0; i < numReceived; i++)
   {
-    if (realOwningProcess[i] == myRank)
+    if (receivedOwners[i] == myRank)
     {
-      memcpy(&rParticles[counter].Current, &recvMessage[i * typeSize], size1);
-      memcpy(&rParticles[counter].Previous, &recvMessage[i * typeSize] + size1, size1);
+      const char* message = reinterpret_cast<const char*>(&recvMessage[i * typeLength]);
+      memcpy(&rParticles[counter].Current, message, size1);
+      memcpy(&rParticles[counter].Previous, message + size1, size1);
 
       rParticles[counter].PreviousPD = vtkSmartPointer<vtkPointData>::New();
       rParticles[counter].PreviousPD->CopyAllocate(this->ProtoPD);
       vtkPointData* pd = rParticles[counter].PreviousPD;
-      char* data = &recvMessage[i * typeSize] + 2 * size1;
+      const char* data = message + 2 * size1;
       for (int j = 0; j < nArrays; j++)
       {
         vtkDataArray* arr = pd->GetArray(j);
@@ -402,11 +461,12 @@ bool vtkPParticleTracerBase::SendReceiveParticles(
       counter++;
     }
   }
+  movedRequest.Wait();
 
   // don't want the ones that we sent away
   this->MPISendList.clear();
 
-  return particlesMoved;
+  return particlesMoved != 0;
 }
 
 //------------------------------------------------------------------------------
@@ -91,8 +91,10 @@ protected:
 
   /**
    * this is used during classification of seed points and also between iterations
-   * of the main loop as particles leave each processor domain. Returns
-   * true if particles were migrated to any new process.
+   * of the main loop as particles leave each processor domain. Each particle is
+   * only sent to the processes whose data bounds contain it, which claim it, and
+   * it goes to the highest claiming process. Returns true if particles were
+   * migrated to any new process.
    */
   bool SendReceiveParticles(RemoteParticleVector& outofdomain, RemoteParticleVector& received);
 
@@ -0,0 +1,109 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPConnectivityFilterChain.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkPConnectivityFilter labels a region spanning a chain of
+// ranks, where each rank only touches the previous and the next ones, and
+// numbers the other regions contiguously.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkPConnectivityFilter.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// A strip of 4 quads over [rank, rank + 1] x [0, 1] and a quad away from the
+// strip.
+void MakePiece(int rank, vtkPolyData* piece)
+{
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j < 2; ++j)
+  {
+    for (int i = 0; i < 5; ++i)
+    {
+      points->InsertNextPoint(rank + i * 0.25, j, 0.0);
+    }
+  }
+  points->InsertNextPoint(rank + 0.25, 2.0, 0.0);
+  points->InsertNextPoint(rank + 0.75, 2.0, 0.0);
+  points->InsertNextPoint(rank + 0.75, 3.0, 0.0);
+  points->InsertNextPoint(rank + 0.25, 3.0, 0.0);
+
+  vtkNew<vtkCellArray> quads;
+  for (vtkIdType i = 0; i < 4; ++i)
+  {
+    const vtkIdType quad[4] = { i, i + 1, i + 6, i + 5 };
+    quads->InsertNextCell(4, quad);
+  }
+  const vtkIdType quad[4] = { 10, 11, 12, 13 };
+  quads->InsertNextCell(4, quad);
+
+  piece->SetPoints(points);
+  piece->SetPolys(quads);
+}
+}
+
+int TestPConnectivityFilterChain(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv, 0);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+  const int size = controller->GetNumberOfProcesses();
+
+  vtkNew<vtkPolyData> piece;
+  MakePiece(rank, piece);
+
+  vtkNew<vtkPConnectivityFilter> connectivity;
+  connectivity->SetInputData(piece);
+  connectivity->SetExtractionModeToAllRegions();
+  connectivity->ColorRegionsOn();
+  connectivity->Update();
+
+  int success = 1;
+  if (connectivity->GetNumberOfExtractedRegions() != size + 1)
+  {
+    std::cerr << "Expected " << size + 1 << " regions but got "
+              << connectivity->GetNumberOfExtractedRegions() << std::endl;
+    success = 0;
+  }
+
+  // the strip has the lowest region id, then the quads in the order of the ranks
+  vtkDataSet* output = vtkDataSet::SafeDownCast(connectivity->GetOutput());
+  vtkIdTypeArray* regionIds =
+    vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("RegionId"));
+  for (vtkIdType cellId = 0; success && cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    const vtkIdType expected = output->GetCell(cellId)->GetBounds()[2] < 1.5 ? 0 : rank + 1;
+    if (regionIds->GetValue(cellId) != expected)
+    {
+      std::cerr << "Expected region " << expected << " for cell " << cellId << " on rank " << rank
+                << " but got " << regionIds->GetValue(cellId) << std::endl;
+      success = 0;
+    }
+  }
+
+  int globalSuccess = 0;
+  controller->AllReduce(&success, &globalSuccess, 1, vtkCommunicator::MIN_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return globalSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -406,6 +406,242 @@ void ExchangeNumberOfPointsToSend(vtkMPIController* subController,
   subController->WaitAll(requestIdx, recvRequests.data());
 }
 
+/**
+ * Exchange buffers of ids with all the neighbors. The receive buffers must
+ * already have the size of the incoming buffers.
+ */
+void ExchangeWithNeighbors(vtkMPIController* subController, const std::vector<int>& myNeighbors,
+  const std::map<int, std::vector<vtkIdType>>& sendBuffers,
+  std::map<int, std::vector<vtkIdType>>& recvBuffers, int tag)
+{
+  std::vector<vtkMPICommunicator::Request> recvRequests(myNeighbors.size());
+  std::vector<vtkMPICommunicator::Request> sendRequests(myNeighbors.size());
+  int numRecvRequests = 0;
+  int numSendRequests = 0;
+  for (int fromRank : myNeighbors)
+  {
+    std::vector<vtkIdType>& buffer = recvBuffers[fromRank];
+    if (!buffer.empty())
+    {
+      subController->NoBlockReceive(buffer.data(), static_cast<int>(buffer.size()), fromRank, tag,
+        recvRequests[numRecvRequests++]);
+    }
+  }
+  for (int toRank : myNeighbors)
+  {
+    const std::vector<vtkIdType>& buffer = sendBuffers.at(toRank);
+    if (!buffer.empty())
+    {
+      subController->NoBlockSend(buffer.data(), static_cast<int>(buffer.size()), toRank, tag,
+        sendRequests[numSendRequests++]);
+    }
+  }
+  subController->WaitAll(numRecvRequests, recvRequests.data());
+  subController->WaitAll(numSendRequests, sendRequests.data());
+}
+
+/**
+ * Graph of the regions of this rank and of the regions of the neighbors
+ * linked to them. The regions are first united in components with the links
+ * known on this rank, the components spanning several ranks are then
+ * resolved by exchanging values with the neighbors only.
+ */
+class RegionGraph
+{
+public:
+  /**
+   * Build the graph from the links between the local regions and the global
+   * ids of the regions of each neighbor. The neighbors exchange their links
+   * first, so that a link known on one side only is known on both sides.
+   */
+  RegionGraph(vtkMPIController* subController, const std::vector<int>& myNeighbors,
+    vtkIdType numberOfLocalRegions, vtkIdType regionStart,
+    std::map<int, std::set<std::pair<vtkIdType, vtkIdType>>>& links)
+    : SubController(subController)
+    , MyNeighbors(myNeighbors)
+    , NumberOfLocalRegions(numberOfLocalRegions)
+  {
+    const int PCF_LINKS_TAG = 194730;
+    std::map<int, std::vector<vtkIdType>> sendLinks;
+    std::map<int, std::vector<vtkIdType>> sendSizes;
+    std::map<int, std::vector<vtkIdType>> recvLinks;
+    std::map<int, std::vector<vtkIdType>> recvSizes;
+    for (int rank : this->MyNeighbors)
+    {
+      std::vector<vtkIdType>& buffer = sendLinks[rank];
+      for (const auto& link : links[rank])
+      {
+        buffer.push_back(link.second);
+        buffer.push_back(link.first + regionStart);
+      }
+      sendSizes[rank].assign(1, static_cast<vtkIdType>(buffer.size()));
+      recvSizes[rank].resize(1);
+    }
+    ExchangeWithNeighbors(
+      this->SubController, this->MyNeighbors, sendSizes, recvSizes, PCF_LINKS_TAG);
+    for (int rank : this->MyNeighbors)
+    {
+      recvLinks[rank].resize(recvSizes[rank][0]);
+    }
+    ExchangeWithNeighbors(
+      this->SubController, this->MyNeighbors, sendLinks, recvLinks, PCF_LINKS_TAG);
+
+    // The regions of the neighbors come after the local regions, sorted by
+    // neighbor and global id so that both sides of a link agree on the order.
+    std::vector<std::pair<vtkIdType, vtkIdType>> edges;
+    vtkIdType numberOfNodes = this->NumberOfLocalRegions;
+    for (int rank : this->MyNeighbors)
+    {
+      std::set<std::pair<vtkIdType, vtkIdType>>& rankLinks = links[rank];
+      const std::vector<vtkIdType>& buffer = recvLinks[rank];
+      for (size_t i = 0; i + 1 < buffer.size(); i += 2)
+      {
+        rankLinks.insert(std::make_pair(buffer[i] - regionStart, buffer[i + 1]));
+      }
+
+      std::set<vtkIdType> localRegions;
+      std::map<vtkIdType, vtkIdType> remoteRegions;
+      for (const auto& link : rankLinks)
+      {
+        localRegions.insert(link.first);
+        remoteRegions[link.second] = -1;
+      }
+      std::vector<vtkIdType>& sendRegions = this->SendRegions[rank];
+      sendRegions.assign(localRegions.begin(), localRegions.end());
+      std::vector<vtkIdType>& recvRegions = this->ReceiveRegions[rank];
+      for (auto& remote : remoteRegions)
+      {
+        remote.second = numberOfNodes++;
+        recvRegions.push_back(remote.second);
+        this->RemoteGlobalIds.push_back(remote.first);
+      }
+      for (const auto& link : rankLinks)
+      {
+        edges.emplace_back(link.first, remoteRegions[link.second]);
+      }
+    }
+
+    // Union-find of the links known on this rank.
+    std::vector<vtkIdType> parents(numberOfNodes);
+    std::iota(parents.begin(), parents.end(), 0);
+    auto find = [&parents](vtkIdType node) {
+      while (parents[node] != node)
+      {
+        parents[node] = parents[parents[node]];
+        node = parents[node];
+      }
+      return node;
+    };
+    for (const auto& edge : edges)
+    {
+      vtkIdType root0 = find(edge.first);
+      vtkIdType root1 = find(edge.second);
+      if (root0 != root1)
+      {
+        parents[std::max(root0, root1)] = std::min(root0, root1);
+      }
+    }
+    this->Components.resize(numberOfNodes);
+    std::vector<vtkIdType> componentIds(numberOfNodes, -1);
+    for (vtkIdType node = 0; node < numberOfNodes; ++node)
+    {
+      vtkIdType& componentId = componentIds[find(node)];
+      if (componentId < 0)
+      {
+        componentId = this->NumberOfComponents++;
+      }
+      this->Components[node] = componentId;
+    }
+  }
+
+  vtkIdType GetNumberOfNodes() const { return static_cast<vtkIdType>(this->Components.size()); }
+
+  /**
+   * Global id of a region, local or remote.
+   */
+  vtkIdType GetGlobalId(vtkIdType node, vtkIdType regionStart) const
+  {
+    return node < this->NumberOfLocalRegions
+      ? node + regionStart
+      : this->RemoteGlobalIds[node - this->NumberOfLocalRegions];
+  }
+
+  /**
+   * Replace the values of the regions by the minimum of the values of their
+   * connected component across all ranks. Only the values of the regions
+   * linked to the neighbors are exchanged at each iteration, which stops when
+   * no value changed on any rank.
+   */
+  void PropagateMinimum(std::vector<vtkIdType>& values) const
+  {
+    const int PCF_VALUES_TAG = 194731;
+    std::vector<vtkIdType> minima(this->NumberOfComponents);
+    std::map<int, std::vector<vtkIdType>> sendValues;
+    std::map<int, std::vector<vtkIdType>> recvValues;
+    int globalChanged = 0;
+    do
+    {
+      std::fill(minima.begin(), minima.end(), VTK_ID_MAX);
+      for (size_t node = 0; node < values.size(); ++node)
+      {
+        vtkIdType& minimum = minima[this->Components[node]];
+        minimum = std::min(minimum, values[node]);
+      }
+      for (size_t node = 0; node < values.size(); ++node)
+      {
+        values[node] = minima[this->Components[node]];
+      }
+
+      for (int rank : this->MyNeighbors)
+      {
+        const std::vector<vtkIdType>& sendRegions = this->SendRegions.at(rank);
+        std::vector<vtkIdType>& buffer = sendValues[rank];
+        buffer.resize(sendRegions.size());
+        for (size_t i = 0; i < sendRegions.size(); ++i)
+        {
+          buffer[i] = values[sendRegions[i]];
+        }
+        recvValues[rank].resize(this->ReceiveRegions.at(rank).size());
+      }
+      ExchangeWithNeighbors(
+        this->SubController, this->MyNeighbors, sendValues, recvValues, PCF_VALUES_TAG);
+
+      int changed = 0;
+      for (int rank : this->MyNeighbors)
+      {
+        const std::vector<vtkIdType>& recvRegions = this->ReceiveRegions.at(rank);
+        const std::vector<vtkIdType>& buffer = recvValues[rank];
+        for (size_t i = 0; i < recvRegions.size(); ++i)
+        {
+          if (buffer[i] < values[recvRegions[i]])
+          {
+            values[recvRegions[i]] = buffer[i];
+            changed = 1;
+          }
+        }
+      }
+      this->SubController->AllReduce(&changed, &globalChanged, 1, vtkCommunicator::MAX_OP);
+    } while (globalChanged);
+  }
+
+private:
+  vtkMPIController* SubController;
+  const std::vector<int>& MyNeighbors;
+  vtkIdType NumberOfLocalRegions;
+
+  // Component of each local, then remote, region.
+  std::vector<vtkIdType> Components;
+  vtkIdType NumberOfComponents = 0;
+
+  // Global ids of the remote regions.
+  std::vector<vtkIdType> RemoteGlobalIds;
+
+  // For each neighbor, the local regions linked to it and its regions linked
+  // to this rank, in the same order on both ranks.
+  std::map<int, std::vector<vtkIdType>> SendRegions;
+  std::map<int, std::vector<vtkIdType>> ReceiveRegions;
+};
+
 } // end anonymous namespace
 
 vtkStandardNewMacro(vtkPConnectivityFilter);
@@ -577,10 +813,9 @@ int vtkPConnectivityFilter::RequestData(
   //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
   //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
-  // Links from local region ids to remote region ids. Vector index is local
-  // region id, and the set contains linked remote ids.
-  typedef std::vector<std::set<vtkIdType>> RegionLinksType;
-  RegionLinksType links(regionStarts[numRanks]);
+  // Links from local region ids to the global region ids of the neighbors,
+  // for each neighbor.
+  std::map<int, std::set<std::pair<vtkIdType, vtkIdType>>> links;
 
   if (output->GetNumberOfPoints() > 0)
   {
@@ -620,151 +855,64 @@ int vtkPConnectivityFilter::RequestData(
         }
 
         // Save association between local and remote ids
-        vtkIdTypeArray* localRegionIds =
-          vtkIdTypeArray::SafeDownCast(outputPD->GetArray("RegionId"));
-        vtkIdType localRegionId =
-          localRegionIds->GetTypedComponent(localId, 0) + regionStarts[myRank];
-
+        vtkIdType localRegionId = pointRegionIds->GetTypedComponent(localId, 0);
         vtkIdType remoteRegionId = regionIdsFromMyNeighbors[rank]->GetTypedComponent(ptId, 0);
-
-        if (links[localRegionId].count(remoteRegionId) == 0)
-        {
-          // Link not already established. Add it here.
-          links[localRegionId].insert(remoteRegionId);
-        }
+        links[rank].insert(std::make_pair(localRegionId, remoteRegionId));
       }
     }
   }
 
-  // Set up storage for gathering all links from all processors. This is an
-  // interleaved vector containing one regionId and its connected regionId.
-  std::vector<vtkIdType> localLinks;
-  for (size_t i = 0; i < links.size(); ++i)
+  // Resolve the connected components of the regions with a union-find on
+  // each rank and exchanges with the neighbors only. Each region is first
+  // labeled with the lowest global region id of its component.
+  RegionGraph regionGraph(subController, myNeighbors, numRegions, regionStarts[myRank], links);
+  std::vector<vtkIdType> regionLabels(regionGraph.GetNumberOfNodes());
+  for (vtkIdType node = 0; node < regionGraph.GetNumberOfNodes(); ++node)
   {
-    for (std::set<vtkIdType>::iterator iter = std::begin(links[i]); iter != std::end(links[i]);
-         ++iter)
-    {
-      localLinks.push_back(static_cast<vtkIdType>(i));
-      localLinks.push_back(*iter);
-    }
+    regionLabels[node] = regionGraph.GetGlobalId(node, regionStarts[myRank]);
   }
+  regionGraph.PropagateMinimum(regionLabels);
 
-  // Gather all the links on each rank. This is possibly suboptimal, but it
-  // avoids needing a connected components algorithm on a distributed graph.
-  vtkIdType localNumLinks = static_cast<vtkIdType>(localLinks.size());
-  std::vector<vtkIdType> linkCounts(numRanks, -1);
-  std::vector<vtkIdType> linkStarts(numRanks + 1, 0);
-  subController->AllGather(&localNumLinks, linkCounts.data(), 1);
-
-  // Compute starting region IDs on each rank
-  for (int i = 0; i < numRanks; ++i)
-  {
-    linkStarts[i + 1] = linkCounts[i] + linkStarts[i];
-  }
-
-  std::vector<vtkIdType> allLinks(linkStarts[numRanks]);
-
-  subController->AllGatherV(localLinks.data(), allLinks.data(),
-    static_cast<vtkIdType>(localLinks.size()), linkCounts.data(), linkStarts.data());
-
-  // Set up a graph of all the region-to-region links.
-  typedef struct _RegionNode
+  // The regions keeping their own id label their component. Number them
+  // contiguously in the order of their global ids, from the count of such
+  // regions on the previous ranks.
+  vtkIdType numLocalLabels = 0;
+  for (vtkIdType regionId = 0; regionId < numRegions; ++regionId)
   {
-    // Stored for relabeling step
-    vtkIdType OriginalRegionId;
-
-    // Current local region id
-    vtkIdType CurrentRegionId;
-
-    std::vector<vtkIdType> Links;
-  } RegionNode;
-
-  size_t linkIdx = 0;
-  std::vector<RegionNode> regionNodes(regionStarts[numRanks]);
-  for (vtkIdType regionId = 0; regionId < regionStarts[numRanks]; ++regionId)
-  {
-    regionNodes[regionId].OriginalRegionId = regionId;
-    regionNodes[regionId].CurrentRegionId = regionId;
-
-    while (linkIdx < allLinks.size() && allLinks[linkIdx] == regionId)
-    {
-      regionNodes[regionId].Links.push_back(allLinks[linkIdx + 1]);
-      linkIdx += 2;
-    }
+    numLocalLabels += regionLabels[regionId] == regionId + regionStarts[myRank] ? 1 : 0;
   }
-
-  // Now run connected components on this graph. The algorithm labels all
-  // connected nodes in the graph with the lowest region id in the connected
-  // component. This is a breadth-first algorithm. I'm not 100% sure that the
-  // multiple passes in the do-while loop are required, but I suspect there may
-  // be graph configurations where a single pass is not sufficient for the
-  // relabeling to converge.
-  bool componentChanged = false;
-  do
+  std::vector<vtkIdType> labelCounts(numRanks, 0);
+  subController->AllGather(&numLocalLabels, labelCounts.data(), 1);
+  vtkIdType contiguousLabel = std::accumulate(labelCounts.begin(), labelCounts.begin() + myRank,
+    static_cast<vtkIdType>(0));
+  const vtkIdType numContiguousLabels =
+    std::accumulate(labelCounts.begin(), labelCounts.end(), static_cast<vtkIdType>(0));
+
+  // Give the contiguous label of each component to all its regions.
+  std::vector<vtkIdType> regionIdMap(regionGraph.GetNumberOfNodes(), VTK_ID_MAX);
+  for (vtkIdType regionId = 0; regionId < numRegions; ++regionId)
   {
-    componentChanged = false;
-    for (std::vector<RegionNode>::iterator nodeIter = regionNodes.begin();
-         nodeIter != regionNodes.end(); ++nodeIter)
+    if (regionLabels[regionId] == regionId + regionStarts[myRank])
     {
-      for (std::vector<vtkIdType>::iterator linkIter = nodeIter->Links.begin();
-           linkIter != nodeIter->Links.end(); ++linkIter)
-      {
-        vtkIdType linkedRegionId = *linkIter;
-        if (nodeIter->CurrentRegionId < regionNodes[linkedRegionId].CurrentRegionId)
-        {
-          regionNodes[linkedRegionId].CurrentRegionId = nodeIter->CurrentRegionId;
-          componentChanged = true;
-        }
-      }
+      regionIdMap[regionId] = contiguousLabel++;
     }
-  } while (componentChanged);
-
-  // Collect all the current ids remaining after the connected components
-  // algorithm.
-  std::set<vtkIdType> currentRegionIds;
-  for (std::vector<RegionNode>::iterator nodeIter = regionNodes.begin();
-       nodeIter != regionNodes.end(); ++nodeIter)
-  {
-    currentRegionIds.insert(nodeIter->CurrentRegionId);
-  }
-
-  // Create a map from current region id after relabeling to a new, contiguous
-  // label. Maps current region id -> relabeled array.
-  std::map<vtkIdType, vtkIdType> relabeledRegionMap;
-  vtkIdType contiguousLabel = 0;
-  for (std::set<vtkIdType>::iterator setIter = currentRegionIds.begin();
-       setIter != currentRegionIds.end(); ++setIter)
-  {
-    relabeledRegionMap[*setIter] = contiguousLabel++;
-  }
-
-  // Now do the relabing to the contiguous region id.
-  std::vector<vtkIdType> regionIdMap(regionNodes.size(), -1);
-  for (std::vector<RegionNode>::iterator nodeIter = regionNodes.begin();
-       nodeIter != regionNodes.end(); ++nodeIter)
-  {
-    nodeIter->CurrentRegionId = relabeledRegionMap[nodeIter->CurrentRegionId];
   }
+  regionGraph.PropagateMinimum(regionIdMap);
 
   // Relabel the points and cells according to the contiguous renumbering.
   vtkCellData* outputCD = output->GetCellData();
   vtkIdTypeArray* cellRegionIds = vtkIdTypeArray::SafeDownCast(outputCD->GetArray("RegionId"));
   for (vtkIdType i = 0; i < output->GetNumberOfCells(); ++i)
   {
-    // Offset the cellRegionId by the starting region id on this rank.
-    vtkIdType cellRegionId = cellRegionIds->GetValue(i) + regionStarts[myRank];
-    cellRegionIds->SetValue(i, regionNodes[cellRegionId].CurrentRegionId);
+    cellRegionIds->SetValue(i, regionIdMap[cellRegionIds->GetValue(i)]);
   }
 
   for (vtkIdType i = 0; i < output->GetNumberOfPoints(); ++i)
   {
-    // Offset the pointRegionId by the starting region id on this rank.
-    vtkIdType pointRegionId = pointRegionIds->GetValue(i) + regionStarts[myRank];
-    pointRegionIds->SetValue(i, regionNodes[pointRegionId].CurrentRegionId);
+    pointRegionIds->SetValue(i, regionIdMap[pointRegionIds->GetValue(i)]);
   }
 
   // Sum up number of cells in each region.
-  vtkIdType numContiguousLabels = contiguousLabel;
   std::vector<vtkIdType> localRegionSizes(numContiguousLabels, 0);
   if (cellRegionIds)
   {
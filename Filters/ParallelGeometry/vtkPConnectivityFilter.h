@@ -90,23 +90,22 @@
  * RegionId. This signifies that the local RegionId is connected to the remote
  * RegionId associated with the point.
  *
- * + Each rank gathers the local-RegionId-to-remote-RegionId links from all
- * other ranks.
- *
- * + From these links, each rank generates a graph structure of the global
- * links. The graph structure is identical on all ranks. (Optimization
- * opportunity: To reduce communication, this link exchange could be avoided and
- * the graph could be made distributed. This is just more complicated to
- * program, however).
+ * + Each rank sends the local-RegionId-to-remote-RegionId links to its
+ * neighbors, so that both ranks of a link know it.
  *
  * ![Figure 5: Connected region graph depicted by black line
  * segments.](vtkPConnectivityFilterFigure5.png)
  *
- * + Run a connected components algorithm that relabels the RegionIds, yielding
- * the full connectivity graph across ranks. Figure 6 shows an example result.
+ * + Each rank unites its RegionIds and the RegionIds of its neighbors linked
+ * to them with a union-find. The components spanning several ranks are
+ * resolved by exchanging the lowest RegionId of the components with the
+ * neighbors until no RegionId changes on any rank. The graph of the links is
+ * never gathered on a rank. Figure 6 shows an example result.
  *
  * + Relabel the remaining RegionIds by a contiguous set of RegionIds (e.g., go
- * from [0, 5, 8, 9] to [0, 1, 2, 3]).
+ * from [0, 5, 8, 9] to [0, 1, 2, 3]) from the number of remaining RegionIds on
+ * the previous ranks, and send the new RegionIds to the linked regions the
+ * same way.
  *
  * ![Figure 6: Connected components of graph linking RegionIds across
  * ranks.](vtkPConnectivityFilterFigure6.png)
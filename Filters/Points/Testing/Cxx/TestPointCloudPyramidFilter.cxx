@@ -0,0 +1,145 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPointCloudPyramidFilter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointCloudPyramidFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <cmath>
+#include <set>
+
+//------------------------------------------------------------------------------
+int TestPointCloudPyramidFilter(int, char*[])
+{
+  const vtkIdType numPts = 10000;
+  const int numLevels = 5;
+
+  // Random points in the unit cube, with an attribute equal to x
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(numPts);
+  double centroid[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      x[i] = random->GetNextValue();
+      centroid[i] += x[i] / numPts;
+    }
+    points->SetPoint(ptId, x);
+    scalars->SetValue(ptId, static_cast<float>(x[0]));
+  }
+  vtkNew<vtkPolyData> cloud;
+  cloud->SetPoints(points);
+  cloud->GetPointData()->AddArray(scalars);
+
+  vtkNew<vtkPointCloudPyramidFilter> pyramid;
+  pyramid->SetInputData(cloud);
+  pyramid->SetNumberOfLevels(numLevels);
+  pyramid->Update();
+  vtkPolyData* output = pyramid->GetOutput();
+
+  vtkIdTypeArray* levelOffsets =
+    vtkIdTypeArray::SafeDownCast(output->GetFieldData()->GetArray("LevelOffsets"));
+  vtkIdTypeArray* childOffsets =
+    vtkIdTypeArray::SafeDownCast(output->GetFieldData()->GetArray("ChildOffsets"));
+  vtkDataArray* outScalars = output->GetPointData()->GetArray("Scalars");
+  const vtkIdType numOutPts = output->GetNumberOfPoints();
+  if (!levelOffsets || !childOffsets || !outScalars ||
+    levelOffsets->GetNumberOfTuples() != numLevels + 1 ||
+    childOffsets->GetNumberOfTuples() != numOutPts + 1 ||
+    levelOffsets->GetValue(numLevels) != numOutPts)
+  {
+    vtkLog(ERROR, "Missing or inconsistent pyramid arrays.");
+    return EXIT_FAILURE;
+  }
+
+  // The root is the average of all the points
+  double root[3];
+  output->GetPoint(0, root);
+  if (levelOffsets->GetValue(1) != 1 || std::abs(root[0] - centroid[0]) > 1e-6 ||
+    std::abs(root[1] - centroid[1]) > 1e-6 || std::abs(root[2] - centroid[2]) > 1e-6 ||
+    std::abs(outScalars->GetComponent(0, 0) - centroid[0]) > 1e-5)
+  {
+    vtkLog(ERROR, "Wrong root point (" << root[0] << "," << root[1] << "," << root[2] << ")");
+    return EXIT_FAILURE;
+  }
+
+  double bounds[6];
+  cloud->GetBounds(bounds);
+  for (int level = 0; level < numLevels; ++level)
+  {
+    // Each level has one point per non-empty bin of a 2^level grid
+    const int dim = 1 << level;
+    std::set<int> bins;
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      double x[3];
+      cloud->GetPoint(ptId, x);
+      int ijk[3];
+      for (int i = 0; i < 3; ++i)
+      {
+        const double length = bounds[2 * i + 1] - bounds[2 * i];
+        ijk[i] = static_cast<int>((x[i] - bounds[2 * i]) * dim / length);
+        ijk[i] = ijk[i] < dim ? ijk[i] : dim - 1;
+      }
+      bins.insert(ijk[0] + dim * (ijk[1] + dim * ijk[2]));
+    }
+    const vtkIdType begin = levelOffsets->GetValue(level);
+    const vtkIdType end = levelOffsets->GetValue(level + 1);
+    if (end - begin != static_cast<vtkIdType>(bins.size()))
+    {
+      vtkLog(ERROR, "Level " << level << " has " << end - begin << " points instead of "
+                             << bins.size());
+      return EXIT_FAILURE;
+    }
+
+    // The children of the nodes of a level cover the next level
+    const vtkIdType childBegin = level + 1 < numLevels ? end : numOutPts;
+    const vtkIdType childEnd =
+      level + 1 < numLevels ? levelOffsets->GetValue(level + 2) : numOutPts;
+    if (childOffsets->GetValue(begin) != childBegin || childOffsets->GetValue(end) != childEnd)
+    {
+      vtkLog(ERROR, "Children of level " << level << " do not cover the next level.");
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType nodeId = begin; nodeId < end; ++nodeId)
+    {
+      const vtkIdType numChildren =
+        childOffsets->GetValue(nodeId + 1) - childOffsets->GetValue(nodeId);
+      if (numChildren > 8 || (level + 1 < numLevels && numChildren < 1))
+      {
+        vtkLog(ERROR, "Node " << nodeId << " has " << numChildren << " children.");
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
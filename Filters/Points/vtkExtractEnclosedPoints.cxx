@@ -19,6 +19,7 @@
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
+#include "vtkFastWindingNumber.h"
 #include "vtkFeatureEdges.h"
 #include "vtkGarbageCollector.h"
 #include "vtkGenericCell.h"
@@ -28,6 +29,7 @@
 #include "vtkInformationVector.h"
 #include "vtkIntersectionCounter.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
@@ -153,6 +155,7 @@ vtkExtractEnclosedPoints::vtkExtractEnclosedPoints()
 
   this->CheckSurface = false;
   this->Tolerance = 0.001;
+  this->InsideTestMethod = RAY_CASTING;
 }
 
 //------------------------------------------------------------------------------
@@ -193,6 +196,28 @@ int vtkExtractEnclosedPoints::RequestData(
 // the enclosing surface.
 int vtkExtractEnclosedPoints::FilterPoints(vtkPointSet* input)
 {
+  if (this->InsideTestMethod == WINDING_NUMBER)
+  {
+    vtkNew<vtkFastWindingNumber> windingNumber;
+    windingNumber->SetSurface(this->Surface);
+    windingNumber->BuildTree();
+
+    double bds[6];
+    this->Surface->GetBounds(bds);
+    vtkIdType* map = this->PointMap;
+    vtkSMPTools::For(0, input->GetNumberOfPoints(), [&](vtkIdType ptId, vtkIdType endPtId) {
+      double x[3];
+      for (; ptId < endPtId; ++ptId)
+      {
+        input->GetPoint(ptId, x);
+        const bool inside = x[0] >= bds[0] && x[0] <= bds[1] && x[1] >= bds[2] &&
+          x[1] <= bds[3] && x[2] >= bds[4] && x[2] <= bds[5] && windingNumber->IsInside(x);
+        map[ptId] = (inside ? 1 : -1);
+      }
+    });
+    return 1;
+  }
+
   // Initialize search structures
   vtkStaticCellLocator* locator = vtkStaticCellLocator::New();
 
@@ -277,5 +302,8 @@ void vtkExtractEnclosedPoints::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Check Surface: " << (this->CheckSurface ? "On\n" : "Off\n");
 
   os << indent << "Tolerance: " << this->Tolerance << "\n";
+
+  os << indent << "Inside Test Method: "
+     << (this->InsideTestMethod == WINDING_NUMBER ? "Winding Number\n" : "Ray Casting\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -31,6 +31,10 @@
  * all points will be marked outside. Note that if this check is not performed
  * and the surface is not closed, the results are undefined.
  *
+ * By default, each point is classified by casting random rays, but the
+ * winding number of the surface can be used instead (see
+ * InsideTestMethod).
+ *
  * @warning
  * This class has been threaded with vtkSMPTools. Using TBB or other
  * non-sequential type (set in the CMake variable
@@ -47,7 +51,7 @@
  * its methods to vtkSelectEnclosedPoints.
  *
  * @sa
- * vtkSelectEnclosedPoints vtkExtractPoints
+ * vtkSelectEnclosedPoints vtkExtractPoints vtkFastWindingNumber
  */
 
 #ifndef vtkExtractEnclosedPoints_h
@@ -106,12 +110,37 @@ public:
   vtkGetMacro(Tolerance, double);
   ///@}
 
+  /**
+   * The methods used to decide whether a point is inside the surface.
+   */
+  enum InsideTestMethods
+  {
+    RAY_CASTING = 0,
+    WINDING_NUMBER = 1
+  };
+
+  ///@{
+  /**
+   * Specify how the points are classified. With RAY_CASTING (the default),
+   * random rays are cast from the point and their intersections with the
+   * surface are counted. With WINDING_NUMBER, a point is inside when the
+   * winding number of the surface at the point is at least 0.5 (see
+   * vtkFastWindingNumber); the polygons of the surface must then be
+   * consistently oriented with outward normals.
+   */
+  vtkSetClampMacro(InsideTestMethod, int, RAY_CASTING, WINDING_NUMBER);
+  vtkGetMacro(InsideTestMethod, int);
+  void SetInsideTestMethodToRayCasting() { this->SetInsideTestMethod(RAY_CASTING); }
+  void SetInsideTestMethodToWindingNumber() { this->SetInsideTestMethod(WINDING_NUMBER); }
+  ///@}
+
 protected:
   vtkExtractEnclosedPoints();
   ~vtkExtractEnclosedPoints() override;
 
   vtkTypeBool CheckSurface;
   double Tolerance;
+  int InsideTestMethod;
 
   // Internal structures for managing the intersection testing
   vtkPolyData* Surface;
@@ -0,0 +1,444 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPointCloudPyramidFilter.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See LICENSE file for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPointCloudPyramidFilter.h"
+
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkFieldData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPointCloudPyramidFilter);
+
+//------------------------------------------------------------------------------
+// Helper classes to support efficient computing, and threaded execution.
+namespace
+{
+
+//------------------------------------------------------------------------------
+// Spread the lower 21 bits of i so that there are two zero bits between each
+// of them: interleaving three spread indices gives a Morton code.
+vtkTypeUInt64 SpreadBits(vtkTypeUInt64 i)
+{
+  i &= 0x1fffff;
+  i = (i | i << 32) & 0x1f00000000ffff;
+  i = (i | i << 16) & 0x1f0000ff0000ff;
+  i = (i | i << 8) & 0x100f00f00f00f00f;
+  i = (i | i << 4) & 0x10c30c30c30c30c3;
+  i = (i | i << 2) & 0x1249249249249249;
+  return i;
+}
+
+//------------------------------------------------------------------------------
+// The tuple sorted to order the points along the Morton curve of the finest
+// level. Ties are broken by point id so that the output does not depend on
+// the sort implementation.
+struct PointCode
+{
+  vtkTypeUInt64 Code;
+  vtkIdType PtId;
+
+  bool operator<(const PointCode& other) const
+  {
+    return this->Code < other.Code || (this->Code == other.Code && this->PtId < other.PtId);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Compute the Morton code of the finest level bin of each point.
+template <typename TPts>
+struct ComputeCodes
+{
+  const TPts* Points;
+  PointCode* Codes;
+  double Origin[3];
+  double Factor[3];
+  int MaxIndex;
+
+  ComputeCodes(const TPts* pts, PointCode* codes, const double bounds[6], int numLevels)
+    : Points(pts)
+    , Codes(codes)
+  {
+    const int dim = 1 << (numLevels - 1);
+    this->MaxIndex = dim - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      const double length = bounds[2 * i + 1] - bounds[2 * i];
+      this->Origin[i] = bounds[2 * i];
+      this->Factor[i] = (length > 0.0 ? dim / length : 0.0);
+    }
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    const TPts* x = this->Points + 3 * ptId;
+    PointCode* code = this->Codes + ptId;
+    vtkTypeUInt64 ijk[3];
+    for (; ptId < endPtId; ++ptId, x += 3, ++code)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        const double idx = (static_cast<double>(x[i]) - this->Origin[i]) * this->Factor[i];
+        ijk[i] = static_cast<vtkTypeUInt64>(
+          idx < 0.0 ? 0 : (idx >= this->MaxIndex ? this->MaxIndex : static_cast<int>(idx)));
+      }
+      code->Code = SpreadBits(ijk[0]) | (SpreadBits(ijk[1]) << 1) | (SpreadBits(ijk[2]) << 2);
+      code->PtId = ptId;
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Gather the sorted point ids, and for each sorted point find the coarsest
+// level at which it starts a new node. Consecutive points sharing a node at
+// level L share it at all coarser levels, so a point starts a node at all the
+// levels from the first one where its code differs from its predecessor's.
+struct ClassifyPoints
+{
+  const PointCode* Codes;
+  vtkIdType* PtIds;
+  unsigned char* StartLevels;
+  int NumLevels;
+
+  void operator()(vtkIdType idx, vtkIdType endIdx)
+  {
+    const int finest = this->NumLevels - 1;
+    for (; idx < endIdx; ++idx)
+    {
+      this->PtIds[idx] = this->Codes[idx].PtId;
+      if (idx == 0)
+      {
+        this->StartLevels[idx] = 0;
+        continue;
+      }
+      vtkTypeUInt64 diff = this->Codes[idx].Code ^ this->Codes[idx - 1].Code;
+      if (diff == 0)
+      {
+        this->StartLevels[idx] = static_cast<unsigned char>(this->NumLevels);
+        continue;
+      }
+      int highBit = 0;
+      while (diff >>= 1)
+      {
+        ++highBit;
+      }
+      this->StartLevels[idx] = static_cast<unsigned char>(finest - highBit / 3);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// The nodes of the pyramid, level by level. Within a level, the nodes are
+// identified by their first point in the sorted points.
+struct Pyramid
+{
+  vtkIdType NumPts;
+  std::vector<std::vector<vtkIdType>> Starts;
+  std::vector<vtkIdType> LevelOffsets;
+
+  // Range of sorted points in the j-th node of a level.
+  vtkIdType GetStart(int level, vtkIdType j) const { return this->Starts[level][j]; }
+  vtkIdType GetEnd(int level, vtkIdType j) const
+  {
+    const std::vector<vtkIdType>& starts = this->Starts[level];
+    return (j + 1 < static_cast<vtkIdType>(starts.size()) ? starts[j + 1] : this->NumPts);
+  }
+};
+
+//------------------------------------------------------------------------------
+// For each node of a level, find its first child in the next level.
+struct MapChildren
+{
+  const Pyramid* Nodes;
+  int Level;
+  vtkIdType* ChildOffsets;
+
+  void operator()(vtkIdType j, vtkIdType endJ)
+  {
+    const std::vector<vtkIdType>& children = this->Nodes->Starts[this->Level + 1];
+    const vtkIdType childOffset = this->Nodes->LevelOffsets[this->Level + 1];
+    vtkIdType* offset = this->ChildOffsets + this->Nodes->LevelOffsets[this->Level] + j;
+    for (; j < endJ; ++j, ++offset)
+    {
+      auto child =
+        std::lower_bound(children.begin(), children.end(), this->Nodes->GetStart(this->Level, j));
+      *offset = childOffset + static_cast<vtkIdType>(child - children.begin());
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Average the input points and attributes into the nodes of the finest level.
+template <typename TPts>
+struct AverageLeaves
+{
+  const Pyramid* Nodes;
+  const vtkIdType* PtIds;
+  const TPts* InPoints;
+  TPts* OutPoints;
+  vtkIdType* Counts;
+  ArrayList* Arrays;
+
+  void operator()(vtkIdType j, vtkIdType endJ)
+  {
+    const int level = static_cast<int>(this->Nodes->Starts.size()) - 1;
+    vtkIdType outId = this->Nodes->LevelOffsets[level] + j;
+    for (; j < endJ; ++j, ++outId)
+    {
+      const vtkIdType start = this->Nodes->GetStart(level, j);
+      const vtkIdType numIds = this->Nodes->GetEnd(level, j) - start;
+      const vtkIdType* ids = this->PtIds + start;
+      double y[3] = { 0.0, 0.0, 0.0 };
+      for (vtkIdType id = 0; id < numIds; ++id)
+      {
+        const TPts* px = this->InPoints + 3 * ids[id];
+        y[0] += px[0];
+        y[1] += px[1];
+        y[2] += px[2];
+      }
+      TPts* py = this->OutPoints + 3 * outId;
+      py[0] = static_cast<TPts>(y[0] / numIds);
+      py[1] = static_cast<TPts>(y[1] / numIds);
+      py[2] = static_cast<TPts>(y[2] / numIds);
+      this->Counts[outId] = numIds;
+      this->Arrays->Average(static_cast<int>(numIds), ids, outId);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Average the children of the nodes of a coarser level, weighted by the
+// number of points they contain. This gives the same result as averaging the
+// input points of the node, at a cost independent of the number of points.
+template <typename TPts>
+struct AverageChildren
+{
+  const Pyramid* Nodes;
+  int Level;
+  const vtkIdType* ChildOffsets;
+  TPts* OutPoints;
+  vtkIdType* Counts;
+  ArrayList* Arrays;
+
+  void operator()(vtkIdType j, vtkIdType endJ)
+  {
+    vtkIdType outId = this->Nodes->LevelOffsets[this->Level] + j;
+    vtkIdType childIds[8];
+    double weights[8];
+    for (; j < endJ; ++j, ++outId)
+    {
+      const vtkIdType firstChild = this->ChildOffsets[outId];
+      const int numChildren = static_cast<int>(this->ChildOffsets[outId + 1] - firstChild);
+      vtkIdType count = 0;
+      for (int c = 0; c < numChildren; ++c)
+      {
+        childIds[c] = firstChild + c;
+        count += this->Counts[childIds[c]];
+      }
+      double y[3] = { 0.0, 0.0, 0.0 };
+      for (int c = 0; c < numChildren; ++c)
+      {
+        weights[c] = static_cast<double>(this->Counts[childIds[c]]) / count;
+        const TPts* px = this->OutPoints + 3 * childIds[c];
+        y[0] += weights[c] * px[0];
+        y[1] += weights[c] * px[1];
+        y[2] += weights[c] * px[2];
+      }
+      TPts* py = this->OutPoints + 3 * outId;
+      py[0] = static_cast<TPts>(y[0]);
+      py[1] = static_cast<TPts>(y[1]);
+      py[2] = static_cast<TPts>(y[2]);
+      this->Counts[outId] = count;
+      this->Arrays->InterpolateOutput(numChildren, childIds, weights, outId);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Sort the points, build the nodes and compute their representative points
+// and attributes.
+template <typename TPts>
+void BuildPyramid(vtkPointSet* input, vtkPolyData* output, const double bounds[6], int numLevels,
+  vtkIdTypeArray* levelOffsetsArray, vtkIdTypeArray* childOffsetsArray)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const TPts* inPts = static_cast<const TPts*>(input->GetPoints()->GetVoidPointer(0));
+
+  // Sort the points once along the Morton curve of the finest level
+  std::vector<PointCode> codes(numPts);
+  ComputeCodes<TPts> computeCodes(inPts, codes.data(), bounds, numLevels);
+  vtkSMPTools::For(0, numPts, computeCodes);
+  vtkSMPTools::Sort(codes.begin(), codes.end());
+
+  std::vector<vtkIdType> ptIds(numPts);
+  std::vector<unsigned char> startLevels(numPts);
+  ClassifyPoints classify{ codes.data(), ptIds.data(), startLevels.data(), numLevels };
+  vtkSMPTools::For(0, numPts, classify);
+  codes.clear();
+  codes.shrink_to_fit();
+
+  // Gather the nodes of each level. This is a single pass over the sorted
+  // points, proportional to the number of points and nodes.
+  Pyramid nodes;
+  nodes.NumPts = numPts;
+  nodes.Starts.resize(numLevels);
+  for (vtkIdType idx = 0; idx < numPts; ++idx)
+  {
+    for (int level = startLevels[idx]; level < numLevels; ++level)
+    {
+      nodes.Starts[level].push_back(idx);
+    }
+  }
+  startLevels.clear();
+  startLevels.shrink_to_fit();
+
+  nodes.LevelOffsets.resize(numLevels + 1);
+  nodes.LevelOffsets[0] = 0;
+  for (int level = 0; level < numLevels; ++level)
+  {
+    nodes.LevelOffsets[level + 1] =
+      nodes.LevelOffsets[level] + static_cast<vtkIdType>(nodes.Starts[level].size());
+  }
+  const vtkIdType numOutPts = nodes.LevelOffsets[numLevels];
+
+  levelOffsetsArray->SetNumberOfTuples(numLevels + 1);
+  std::copy(nodes.LevelOffsets.begin(), nodes.LevelOffsets.end(), levelOffsetsArray->GetPointer(0));
+
+  // The children of a node are contiguous in the next level, the nodes of the
+  // finest level have no children.
+  childOffsetsArray->SetNumberOfTuples(numOutPts + 1);
+  vtkIdType* childOffsets = childOffsetsArray->GetPointer(0);
+  for (int level = 0; level < numLevels - 1; ++level)
+  {
+    MapChildren mapChildren{ &nodes, level, childOffsets };
+    vtkSMPTools::For(0, static_cast<vtkIdType>(nodes.Starts[level].size()), mapChildren);
+  }
+  std::fill(childOffsets + nodes.LevelOffsets[numLevels - 1], childOffsets + numOutPts + 1,
+    numOutPts);
+
+  // Allocate the output points and attributes
+  vtkPoints* points = input->GetPoints()->NewInstance();
+  points->SetDataType(input->GetPoints()->GetDataType());
+  points->SetNumberOfPoints(numOutPts);
+  output->SetPoints(points);
+  points->Delete();
+  TPts* outPts = static_cast<TPts*>(points->GetVoidPointer(0));
+
+  vtkPointData* inPD = input->GetPointData();
+  vtkPointData* outPD = output->GetPointData();
+  outPD->InterpolateAllocate(inPD, numOutPts);
+  ArrayList arrays;
+  arrays.AddArrays(numOutPts, inPD, outPD);
+
+  // Average the input into the finest level, then each level from the next
+  // one, finest to coarsest.
+  std::vector<vtkIdType> counts(numOutPts);
+  AverageLeaves<TPts> averageLeaves{ &nodes, ptIds.data(), inPts, outPts, counts.data(), &arrays };
+  vtkSMPTools::For(0, static_cast<vtkIdType>(nodes.Starts[numLevels - 1].size()), averageLeaves);
+  for (int level = numLevels - 2; level >= 0; --level)
+  {
+    AverageChildren<TPts> averageChildren{ &nodes, level, childOffsets, outPts, counts.data(),
+      &arrays };
+    vtkSMPTools::For(0, static_cast<vtkIdType>(nodes.Starts[level].size()), averageChildren);
+  }
+}
+
+} // anonymous namespace
+
+//================= Begin class proper =======================================
+//------------------------------------------------------------------------------
+vtkPointCloudPyramidFilter::vtkPointCloudPyramidFilter()
+{
+  this->NumberOfLevels = 8;
+  this->Automatic = true;
+  this->Bounds[0] = this->Bounds[2] = this->Bounds[4] = 0.0;
+  this->Bounds[1] = this->Bounds[3] = this->Bounds[5] = 1.0;
+}
+
+//------------------------------------------------------------------------------
+// Produce the output data
+int vtkPointCloudPyramidFilter::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // get the info objects
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  // get the input and output
+  vtkPointSet* input = vtkPointSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  // Check the input
+  if (!input || !output)
+  {
+    return 1;
+  }
+  vtkIdType numPts = input->GetNumberOfPoints();
+  if (numPts < 1)
+  {
+    return 1;
+  }
+
+  if (this->Automatic)
+  {
+    input->GetBounds(this->Bounds);
+  }
+
+  vtkNew<vtkIdTypeArray> levelOffsets;
+  levelOffsets->SetName("LevelOffsets");
+  vtkNew<vtkIdTypeArray> childOffsets;
+  childOffsets->SetName("ChildOffsets");
+
+  switch (input->GetPoints()->GetDataType())
+  {
+    vtkTemplateMacro(BuildPyramid<VTK_TT>(
+      input, output, this->Bounds, this->NumberOfLevels, levelOffsets, childOffsets));
+  }
+
+  output->GetFieldData()->AddArray(levelOffsets);
+  output->GetFieldData()->AddArray(childOffsets);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPointCloudPyramidFilter::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPointSet");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkPointCloudPyramidFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Number of Levels: " << this->NumberOfLevels << endl;
+  os << indent << "Automatic: " << (this->Automatic ? "On\n" : "Off\n");
+  os << indent << "Bounds: (" << this->Bounds[0] << "," << this->Bounds[1] << ","
+     << this->Bounds[2] << "," << this->Bounds[3] << "," << this->Bounds[4] << ","
+     << this->Bounds[5] << ")\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,129 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPointCloudPyramidFilter.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See LICENSE file for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPointCloudPyramidFilter
+ * @brief   generate a multiresolution pyramid of a point cloud
+ *
+ *
+ * vtkPointCloudPyramidFilter builds, in a single execution, all the levels of
+ * detail of a point cloud. Space is recursively subdivided by an octree over
+ * the bounding box of the points: level 0 is a single node covering the
+ * whole bounding box, and each node of level L is split into up to 8 children
+ * at level L+1. Each non-empty node produces one representative point, placed
+ * at the average position of the input points it contains, with point
+ * attributes averaged the same way. This is equivalent to running vtkVoxelGrid
+ * once per level with 2^L divisions in each direction, except that the points
+ * are sorted only once (by Morton code) and the coarser levels are computed
+ * from their children rather than from the input points.
+ *
+ * The output is a vtkPolyData containing the representative points of all the
+ * levels, coarsest first. Within a level, the points are ordered along the
+ * Morton (Z-order) curve, so that the children of a node are contiguous in
+ * the next level. Two vtkIdTypeArrays in the field data of the output
+ * describe the pyramid:
+ * - "LevelOffsets" (NumberOfLevels + 1 values): the points of level L are the
+ *   point ids in [LevelOffsets[L], LevelOffsets[L+1]).
+ * - "ChildOffsets" (number of output points + 1 values): the children of point
+ *   n are the point ids in [ChildOffsets[n], ChildOffsets[n+1]). The points of
+ *   the finest level have no children.
+ * Rendering the points of the levels up to L (i.e., the point ids in
+ * [0, LevelOffsets[L+1])) or a selection of nodes and their descendants gives
+ * a level of detail suitable, for instance, for vtkPointGaussianMapper or for
+ * writing point cloud tiles.
+ *
+ * While any vtkPointSet type can be provided as input, the output is
+ * represented by an explicit representation of points via a
+ * vtkPolyData. This output polydata will populate its instance of vtkPoints,
+ * but no cells will be defined (i.e., no vtkVertex or vtkPolyVertex are
+ * contained in the output).
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkVoxelGrid vtkHierarchicalBinningFilter vtkPointGaussianMapper
+ */
+
+#ifndef vtkPointCloudPyramidFilter_h
+#define vtkPointCloudPyramidFilter_h
+
+#include "vtkFiltersPointsModule.h" // For export macro
+#include "vtkPolyDataAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSPOINTS_EXPORT vtkPointCloudPyramidFilter : public vtkPolyDataAlgorithm
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiating, obtaining type information, and
+   * printing information.
+   */
+  static vtkPointCloudPyramidFilter* New();
+  vtkTypeMacro(vtkPointCloudPyramidFilter, vtkPolyDataAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Specify the number of levels of the pyramid, including the root level.
+   * The finest level divides the bounding box into 2^(NumberOfLevels-1) bins
+   * in each direction. By default, the number of levels is 8; it is at most 21.
+   */
+  vtkSetClampMacro(NumberOfLevels, int, 1, 21);
+  vtkGetMacro(NumberOfLevels, int);
+  ///@}
+
+  ///@{
+  /**
+   * Specify whether to compute the bounding box of the pyramid from the
+   * input points (by default this is on). If off, the Bounds are used, which
+   * allows several point clouds to share the same pyramid nodes.
+   */
+  vtkSetMacro(Automatic, bool);
+  vtkGetMacro(Automatic, bool);
+  vtkBooleanMacro(Automatic, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set the bounding box of the pyramid, as (xmin,xmax, ymin,ymax, zmin,zmax).
+   * If Automatic is enabled, then this is computed during filter execution.
+   * Points outside of the bounding box are clamped to it.
+   */
+  vtkSetVector6Macro(Bounds, double);
+  vtkGetVectorMacro(Bounds, double, 6);
+  ///@}
+
+protected:
+  vtkPointCloudPyramidFilter();
+  ~vtkPointCloudPyramidFilter() override = default;
+
+  int NumberOfLevels;
+  bool Automatic;
+  double Bounds[6];
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+private:
+  vtkPointCloudPyramidFilter(const vtkPointCloudPyramidFilter&) = delete;
+  void operator=(const vtkPointCloudPyramidFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -121,5 +121,46 @@ class TestPythonAlgorithm(Testing.vtkTest):
         self.assertEqual(ncells, sphere.GetOutput().GetNumberOfCells())
         self.assertEqual(output.GetBounds(), sphere.GetOutput().GetBounds())
 
+    def testThreads(self):
+        """Update independent pipelines in concurrent threads. The GIL is
+        released during Update() and taken back by the python algorithms
+        and observers called from C++."""
+        import threading
+
+        class MyAlgorithm(vta.VTKPythonAlgorithmBase):
+            def __init__(self):
+                vta.VTKPythonAlgorithmBase.__init__(self)
+            def RequestData(self, request, inInfo, outInfo):
+                inp = self.GetInputData(inInfo, 0, 0)
+                out = self.GetOutputData(outInfo, 0)
+                out.ShallowCopy(inp)
+                return 1
+
+        numberOfCells = [0] * 4
+        endEvents = []
+        def update(i):
+            sphere = vtkSphereSource()
+            sphere.SetThetaResolution(8 + i)
+            ex = MyAlgorithm()
+            ex.SetInputConnection(sphere.GetOutputPort())
+            ex.AddObserver('EndEvent', lambda o, e: endEvents.append(i))
+            for _ in range(10):
+                ex.Modified()
+                ex.Update()
+            numberOfCells[i] = ex.GetOutputDataObject(0).GetNumberOfCells()
+
+        threads = [threading.Thread(target=update, args=(i,)) for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        self.assertEqual(len(endEvents), 40)
+        for i in range(4):
+            sphere = vtkSphereSource()
+            sphere.SetThetaResolution(8 + i)
+            sphere.Update()
+            self.assertEqual(numberOfCells[i], sphere.GetOutput().GetNumberOfCells())
+
 if __name__ == "__main__":
     Testing.main([(TestPythonAlgorithm, 'test')])
@@ -27,7 +27,7 @@ void vtkPythonAlgorithm::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject str;
   if (this->Object)
   {
@@ -59,7 +59,7 @@ vtkPythonAlgorithm::~vtkPythonAlgorithm()
   // have been finalized before the VTK object is released.
   if (Py_IsInitialized())
   {
-    vtkPythonScopeGilEnsurer gilEnsurer;
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
     Py_XDECREF(this->Object);
   }
 }
@@ -103,7 +103,7 @@ static PyObject* VTKToPython(vtkObjectBase* obj)
 
 int vtkPythonAlgorithm::CheckResult(const char* method, const vtkSmartPyObject& res)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   if (!res)
   {
     vtkErrorMacro("Failure when calling method: \"" << method << "\":");
@@ -126,7 +126,7 @@ int vtkPythonAlgorithm::CheckResult(const char* method, const vtkSmartPyObject&
 
 void vtkPythonAlgorithm::SetPythonObject(PyObject* obj)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
 
   if (!obj)
   {
@@ -163,7 +163,7 @@ void vtkPythonAlgorithm::SetNumberOfOutputPorts(int n)
 vtkTypeBool vtkPythonAlgorithm::ProcessRequest(
   vtkInformation* request, vtkInformationVector** inInfo, vtkInformationVector* outInfo)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   char mname[] = "ProcessRequest";
   VTK_GET_METHOD(method, this->Object, mname, 0)
 
@@ -190,7 +190,7 @@ vtkTypeBool vtkPythonAlgorithm::ProcessRequest(
 
 int vtkPythonAlgorithm::FillInputPortInformation(int port, vtkInformation* info)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   char mname[] = "FillInputPortInformation";
   VTK_GET_METHOD(method, this->Object, mname, 0)
 
@@ -209,7 +209,7 @@ int vtkPythonAlgorithm::FillInputPortInformation(int port, vtkInformation* info)
 
 int vtkPythonAlgorithm::FillOutputPortInformation(int port, vtkInformation* info)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   char mname[] = "FillOutputPortInformation";
   VTK_GET_METHOD(method, this->Object, mname, 0)
 
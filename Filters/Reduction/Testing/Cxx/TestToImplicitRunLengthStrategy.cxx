@@ -0,0 +1,91 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestToImplicitRunLengthStrategy.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkToImplicitRunLengthStrategy.h"
+
+#include "vtkDataArrayRange.h"
+#include "vtkIntArray.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+
+int TestToImplicitRunLengthStrategy(int, char*[])
+{
+  vtkNew<vtkIntArray> base;
+  base->SetNumberOfComponents(2);
+  base->SetNumberOfTuples(100);
+  base->SetName("Base");
+  auto range = vtk::DataArrayValueRange<2>(base);
+  std::size_t quarterSize = base->GetNumberOfValues() / 4;
+  std::fill(range.begin(), range.begin() + quarterSize, 7);
+  std::fill(range.begin() + quarterSize, range.begin() + 2 * quarterSize, -3);
+  std::fill(range.begin() + 2 * quarterSize, range.begin() + 3 * quarterSize, 42);
+  std::fill(range.begin() + 3 * quarterSize, range.end(), 7);
+
+  vtkNew<vtkToImplicitRunLengthStrategy> strat;
+  auto opt = strat->EstimateReduction(base);
+  if (!opt.IsSome)
+  {
+    std::cout << "Could not identify run-length compressible array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  double expected = 4.0 * (sizeof(int) + sizeof(vtkIdType)) / (200.0 * sizeof(int));
+  if (opt.Value != expected)
+  {
+    std::cout << "Did not identify correct reduction factor: " << expected << " != " << opt.Value
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkSmartPointer<vtkDataArray> result = strat->Reduce(base);
+
+  if (!result)
+  {
+    std::cout << "Generated a nullptr result" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (result->GetNumberOfComponents() != base->GetNumberOfComponents())
+  {
+    std::cout << "Result does not have same number of components as base" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (result->GetNumberOfTuples() != base->GetNumberOfTuples())
+  {
+    std::cout << "Result does not have same number of tuples as base" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto compressedRange = vtk::DataArrayValueRange<2>(result);
+  if (!std::equal(range.begin(), range.end(), compressedRange.begin()))
+  {
+    std::cout << "Values in compressed array don't line up with base" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::shuffle(range.begin(), range.end(), std::default_random_engine());
+  opt = strat->EstimateReduction(base);
+
+  if (opt.IsSome)
+  {
+    std::cout << "Should not be able to compress shuffled array using run-length encoding"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestToIndexedArrayStrategy.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkToIndexedArrayStrategy.h"
+
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkIndexedArray.h"
+#include "vtkMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+int TestToIndexedArrayStrategy(int, char*[])
+{
+  vtkNew<vtkDoubleArray> base;
+  base->SetNumberOfComponents(3);
+  base->SetNumberOfTuples(100);
+  base->SetName("Base");
+  auto range = vtk::DataArrayValueRange<3>(base);
+  std::default_random_engine engine;
+  std::uniform_int_distribution<int> distribution(0, 9);
+  std::generate(range.begin(), range.end(), [&]() { return 0.1 * distribution(engine) - 0.3; });
+  // make sure that all the 10 values are present
+  for (int iV = 0; iV < 10; ++iV)
+  {
+    range[iV] = 0.1 * iV - 0.3;
+  }
+
+  vtkNew<vtkToIndexedArrayStrategy> strat;
+  auto opt = strat->EstimateReduction(base);
+  if (!opt.IsSome)
+  {
+    std::cout << "Could not identify indexed compressible array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  double expected = (10.0 * sizeof(double) + 300.0) / (300.0 * sizeof(double));
+  if (std::abs(opt.Value - expected) > 1e-12)
+  {
+    std::cout << "Did not identify correct reduction factor: " << expected << " != " << opt.Value
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkSmartPointer<vtkDataArray> result = strat->Reduce(base);
+
+  if (!vtkArrayDownCast<vtkIndexedArray<double>>(result))
+  {
+    std::cout << "Did not generate an indexed array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (result->GetNumberOfComponents() != base->GetNumberOfComponents())
+  {
+    std::cout << "Result does not have same number of components as base" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (result->GetNumberOfTuples() != base->GetNumberOfTuples())
+  {
+    std::cout << "Result does not have same number of tuples as base" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto compressedRange = vtk::DataArrayValueRange<3>(result);
+  if (!std::equal(range.begin(), range.end(), compressedRange.begin()))
+  {
+    std::cout << "Values in compressed array don't line up with base" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  range[42] = vtkMath::Nan();
+  opt = strat->EstimateReduction(base);
+
+  if (opt.IsSome)
+  {
+    std::cout << "Should not be able to compress array holding NaN values" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,165 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkToImplicitRunLengthStrategy.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkToImplicitRunLengthStrategy.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkArrayDispatchImplicitArrayList.h"
+#include "vtkDataArrayRange.h"
+#include "vtkImplicitArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using Dispatch = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::AllArrays>;
+
+template <typename ValueType>
+struct RunLengthBackend
+{
+public:
+  RunLengthBackend(std::vector<ValueType>&& values, std::vector<vtkIdType>&& ends)
+    : Values(std::move(values))
+    , RunEnds(std::move(ends))
+  {
+  }
+
+  ValueType operator()(vtkIdType idx) const
+  {
+    auto it = std::upper_bound(this->RunEnds.begin(), this->RunEnds.end(), idx);
+    return this->Values[it - this->RunEnds.begin()];
+  }
+
+private:
+  // value of each run and index one past its last value
+  std::vector<ValueType> Values;
+  std::vector<vtkIdType> RunEnds;
+};
+
+struct CountRunsWorklet
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* arr, vtkIdType& nRuns, std::size_t& valueSize) const
+  {
+    using VType = vtk::GetAPIType<ArrayT>;
+    auto range = vtk::DataArrayValueRange(arr);
+    nRuns = 1;
+    for (vtkIdType iV = 1; iV < range.size(); ++iV)
+    {
+      if (range[iV] != range[iV - 1])
+      {
+        ++nRuns;
+      }
+    }
+    valueSize = sizeof(VType);
+  }
+};
+
+struct GenerateRunLengthWorklet
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* arr, vtkSmartPointer<vtkDataArray>& result) const
+  {
+    using VType = vtk::GetAPIType<ArrayT>;
+    auto range = vtk::DataArrayValueRange(arr);
+    std::vector<VType> values;
+    std::vector<vtkIdType> ends;
+    values.push_back(range[0]);
+    for (vtkIdType iV = 1; iV < range.size(); ++iV)
+    {
+      if (range[iV] != values.back())
+      {
+        ends.push_back(iV);
+        values.push_back(range[iV]);
+      }
+    }
+    ends.push_back(range.size());
+    values.shrink_to_fit();
+    ends.shrink_to_fit();
+
+    vtkNew<vtkImplicitArray<RunLengthBackend<VType>>> runLength;
+    runLength->SetBackend(
+      std::make_shared<RunLengthBackend<VType>>(std::move(values), std::move(ends)));
+    runLength->SetNumberOfComponents(arr->GetNumberOfComponents());
+    runLength->SetNumberOfTuples(arr->GetNumberOfTuples());
+    runLength->SetName(arr->GetName());
+    result = runLength;
+  }
+};
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//-------------------------------------------------------------------------
+vtkObjectFactoryNewMacro(vtkToImplicitRunLengthStrategy);
+
+//-------------------------------------------------------------------------
+void vtkToImplicitRunLengthStrategy::PrintSelf(std::ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << std::flush;
+}
+
+//-------------------------------------------------------------------------
+vtkToImplicitStrategy::Optional vtkToImplicitRunLengthStrategy::EstimateReduction(
+  vtkDataArray* arr)
+{
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to run-length encoded array.");
+    return vtkToImplicitStrategy::Optional();
+  }
+  vtkIdType nVals = arr->GetNumberOfValues();
+  if (!nVals)
+  {
+    return vtkToImplicitStrategy::Optional();
+  }
+  vtkIdType nRuns = 0;
+  std::size_t valueSize = 0;
+  ::CountRunsWorklet worker;
+  if (!::Dispatch::Execute(arr, worker, nRuns, valueSize))
+  {
+    worker(arr, nRuns, valueSize);
+  }
+  // each run stores its value and its end index
+  double reduction = static_cast<double>(nRuns * (valueSize + sizeof(vtkIdType))) /
+    static_cast<double>(nVals * valueSize);
+  return reduction < 1.0 ? vtkToImplicitStrategy::Optional(reduction)
+                         : vtkToImplicitStrategy::Optional();
+}
+
+//-------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkToImplicitRunLengthStrategy::Reduce(vtkDataArray* arr)
+{
+  vtkSmartPointer<vtkDataArray> res = nullptr;
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to run-length encoded array.");
+    return res;
+  }
+  vtkIdType nVals = arr->GetNumberOfValues();
+  if (!nVals)
+  {
+    return res;
+  }
+  ::GenerateRunLengthWorklet worker;
+  if (!::Dispatch::Execute(arr, worker, res))
+  {
+    worker(arr, res);
+  }
+  return res;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,64 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkToImplicitRunLengthStrategy.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkToImplicitRunLengthStrategy_h
+#define vtkToImplicitRunLengthStrategy_h
+
+#include "vtkFiltersReductionModule.h" // for export
+#include "vtkToImplicitStrategy.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+/**
+ * @class vtkToImplicitRunLengthStrategy
+ *
+ * A strategy for compressing arrays made of long runs of repeated values, such as material ids or
+ * boundary flags, with a run-length encoding wrapped behind a `vtkImplicitArray`.
+ *
+ * The runs are found on the flat list of values of the array, so that consecutive tuples with the
+ * same components also form a run. The compressed array stores the value and the end index of each
+ * run, and finds the run holding a given value index with a binary search.
+ *
+ * The compression is lossless: only exactly equal values form a run and the `Tolerance` is not
+ * used.
+ *
+ * @sa
+ * vtkImplicitArray vtkToImplicitArrayFilter vtkToImplicitStrategy
+ */
+class VTKFILTERSREDUCTION_EXPORT vtkToImplicitRunLengthStrategy final
+  : public vtkToImplicitStrategy
+{
+public:
+  static vtkToImplicitRunLengthStrategy* New();
+  vtkTypeMacro(vtkToImplicitRunLengthStrategy, vtkToImplicitStrategy);
+  void PrintSelf(std::ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Parent API implementing the strategy
+   */
+  vtkToImplicitStrategy::Optional EstimateReduction(vtkDataArray*) override;
+  vtkSmartPointer<vtkDataArray> Reduce(vtkDataArray*) override;
+  ///@}
+
+protected:
+  vtkToImplicitRunLengthStrategy() = default;
+  ~vtkToImplicitRunLengthStrategy() override = default;
+
+private:
+  vtkToImplicitRunLengthStrategy(const vtkToImplicitRunLengthStrategy&) = delete;
+  void operator=(const vtkToImplicitRunLengthStrategy&) = delete;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkToImplicitRunLengthStrategy_h
@@ -0,0 +1,204 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkToIndexedArrayStrategy.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkToIndexedArrayStrategy.h"
+
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkArrayDispatch.h"
+#include "vtkArrayDispatchImplicitArrayList.h"
+#include "vtkDataArrayRange.h"
+#include "vtkIndexedArray.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnsignedIntArray.h"
+#include "vtkUnsignedShortArray.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace
+{
+using Dispatch = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::AllArrays>;
+
+// Size in bytes of the indexes into a dictionary of nDistinct values, 0 if too large.
+std::size_t GetIndexSize(std::size_t nDistinct)
+{
+  if (nDistinct <= std::numeric_limits<unsigned char>::max() + std::size_t(1))
+  {
+    return sizeof(unsigned char);
+  }
+  if (nDistinct <= std::numeric_limits<unsigned short>::max() + std::size_t(1))
+  {
+    return sizeof(unsigned short);
+  }
+  if (nDistinct <= std::numeric_limits<unsigned int>::max() + std::size_t(1))
+  {
+    return sizeof(unsigned int);
+  }
+  return 0;
+}
+
+// Sorted distinct values of the array, empty if they cannot be ordered because of NaN values.
+template <typename ArrayT>
+std::vector<vtk::GetAPIType<ArrayT>> GetDistinctValues(ArrayT* arr)
+{
+  using VType = vtk::GetAPIType<ArrayT>;
+  auto range = vtk::DataArrayValueRange(arr);
+  if (std::any_of(range.begin(), range.end(), [](VType val) { return vtkMath::IsNan(val); }))
+  {
+    return {};
+  }
+  std::vector<VType> values(range.begin(), range.end());
+  vtkSMPTools::Sort(values.begin(), values.end());
+  values.erase(std::unique(values.begin(), values.end()), values.end());
+  return values;
+}
+
+struct ReductionChecker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* arr, vtkToImplicitStrategy::Optional& reduction) const
+  {
+    using VType = vtk::GetAPIType<ArrayT>;
+    const std::size_t nDistinct = ::GetDistinctValues(arr).size();
+    const std::size_t indexSize = ::GetIndexSize(nDistinct);
+    if (!nDistinct || !indexSize || indexSize >= sizeof(VType))
+    {
+      reduction = vtkToImplicitStrategy::Optional();
+      return;
+    }
+    const double nVals = static_cast<double>(arr->GetNumberOfValues());
+    const double ratio =
+      (nDistinct * sizeof(VType) + nVals * indexSize) / (nVals * sizeof(VType));
+    reduction = ratio < 1.0 ? vtkToImplicitStrategy::Optional(ratio)
+                            : vtkToImplicitStrategy::Optional();
+  }
+};
+
+struct IndexedReductor
+{
+  template <typename ArrayT, typename IndexArrayT>
+  vtkSmartPointer<vtkDataArray> ConstructIndexedArray(
+    ArrayT* arr, std::vector<vtk::GetAPIType<ArrayT>>& distinct)
+  {
+    using VType = vtk::GetAPIType<ArrayT>;
+    using IndexType = vtk::GetAPIType<IndexArrayT>;
+    vtkNew<vtkAOSDataArrayTemplate<VType>> dictionary;
+    dictionary->SetNumberOfComponents(1);
+    dictionary->SetNumberOfTuples(static_cast<vtkIdType>(distinct.size()));
+    std::copy(distinct.begin(), distinct.end(), dictionary->GetPointer(0));
+
+    auto range = vtk::DataArrayValueRange(arr);
+    vtkNew<IndexArrayT> indexes;
+    indexes->SetNumberOfComponents(1);
+    indexes->SetNumberOfTuples(arr->GetNumberOfValues());
+    IndexType* indexPtr = indexes->GetPointer(0);
+    vtkSMPTools::For(0, range.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType iV = begin; iV < end; ++iV)
+      {
+        auto it = std::lower_bound(distinct.begin(), distinct.end(), range[iV]);
+        indexPtr[iV] = static_cast<IndexType>(it - distinct.begin());
+      }
+    });
+
+    vtkNew<vtkIndexedArray<VType>> res;
+    res->SetBackend(std::make_shared<vtkIndexedImplicitBackend<VType>>(indexes, dictionary));
+    res->SetNumberOfComponents(arr->GetNumberOfComponents());
+    res->SetNumberOfTuples(arr->GetNumberOfTuples());
+    res->SetName(arr->GetName());
+    return res;
+  }
+
+  template <typename ArrayT>
+  void operator()(ArrayT* arr, vtkSmartPointer<vtkDataArray>& result)
+  {
+    auto distinct = ::GetDistinctValues(arr);
+    switch (::GetIndexSize(distinct.size()))
+    {
+      case sizeof(unsigned char):
+        result = this->ConstructIndexedArray<ArrayT, vtkUnsignedCharArray>(arr, distinct);
+        return;
+      case sizeof(unsigned short):
+        result = this->ConstructIndexedArray<ArrayT, vtkUnsignedShortArray>(arr, distinct);
+        return;
+      case sizeof(unsigned int):
+        result = this->ConstructIndexedArray<ArrayT, vtkUnsignedIntArray>(arr, distinct);
+        return;
+      default:
+        result = nullptr;
+        return;
+    }
+  }
+};
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//-------------------------------------------------------------------------
+vtkObjectFactoryNewMacro(vtkToIndexedArrayStrategy);
+
+//-------------------------------------------------------------------------
+void vtkToIndexedArrayStrategy::PrintSelf(std::ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << std::flush;
+}
+
+//-------------------------------------------------------------------------
+vtkToImplicitStrategy::Optional vtkToIndexedArrayStrategy::EstimateReduction(vtkDataArray* arr)
+{
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to indexed array.");
+    return vtkToImplicitStrategy::Optional();
+  }
+  vtkIdType nVals = arr->GetNumberOfValues();
+  if (!nVals)
+  {
+    return vtkToImplicitStrategy::Optional();
+  }
+  vtkToImplicitStrategy::Optional reduction;
+  ::ReductionChecker checker;
+  if (!::Dispatch::Execute(arr, checker, reduction))
+  {
+    checker(arr, reduction);
+  }
+  return reduction;
+}
+
+//-------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkToIndexedArrayStrategy::Reduce(vtkDataArray* arr)
+{
+  vtkSmartPointer<vtkDataArray> res = nullptr;
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to indexed array.");
+    return res;
+  }
+  vtkIdType nVals = arr->GetNumberOfValues();
+  if (!nVals)
+  {
+    return res;
+  }
+  ::IndexedReductor generator;
+  if (!::Dispatch::Execute(arr, generator, res))
+  {
+    generator(arr, res);
+  }
+  return res;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,64 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkToIndexedArrayStrategy.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkToIndexedArrayStrategy_h
+#define vtkToIndexedArrayStrategy_h
+
+#include "vtkFiltersReductionModule.h" // for export
+#include "vtkToImplicitStrategy.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+/**
+ * @class vtkToIndexedArrayStrategy
+ *
+ * Strategy to be used in conjunction with `vtkToImplicitArrayFilter` to compress arrays holding
+ * few distinct values into a `vtkIndexedArray`.
+ *
+ * The distinct values of the array form a dictionary and each value of the array is replaced by
+ * its index in the dictionary, stored in the smallest unsigned integral type able to hold it. The
+ * array can be compressed when the dictionary and the indexes take less memory than the original
+ * values, for example a `vtkDoubleArray` taking less than 256 distinct values.
+ *
+ * The compression is lossless: the `Tolerance` is not used. Floating point arrays holding NaN
+ * values are not compressed.
+ *
+ * @sa
+ * vtkIndexedArray vtkToImplicitArrayFilter vtkToImplicitStrategy
+ */
+class VTKFILTERSREDUCTION_EXPORT vtkToIndexedArrayStrategy final : public vtkToImplicitStrategy
+{
+public:
+  static vtkToIndexedArrayStrategy* New();
+  vtkTypeMacro(vtkToIndexedArrayStrategy, vtkToImplicitStrategy);
+  void PrintSelf(std::ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Parent API implementing the strategy
+   */
+  vtkToImplicitStrategy::Optional EstimateReduction(vtkDataArray*) override;
+  vtkSmartPointer<vtkDataArray> Reduce(vtkDataArray*) override;
+  ///@}
+
+protected:
+  vtkToIndexedArrayStrategy() = default;
+  ~vtkToIndexedArrayStrategy() override = default;
+
+private:
+  vtkToIndexedArrayStrategy(const vtkToIndexedArrayStrategy&) = delete;
+  void operator=(const vtkToIndexedArrayStrategy&) = delete;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkToIndexedArrayStrategy_h
@@ -22,6 +22,8 @@
 
 #include <vtksys/SystemTools.hxx>
 
+#include <cmath>
+
 //------------------------------------------------------------------------------
 // randomly sampled data
 const int N_random_list = 100;
@@ -36,10 +38,12 @@ const double quartile_solution[] = { 1, 24.5, 44, 70, 98 };
 const double decile_solution[] = { 1, 10, 20, 28, 36.5, 44, 55, 67.5, 75, 85, 98 };
 //------------------------------------------------------------------------------
 
-bool ComputeQuantiles(vtkTable* table, int N_intervals, const double* solution)
+bool ComputeQuantiles(
+  vtkTable* table, int N_intervals, const double* solution, bool approximate = false)
 {
   vtkNew<vtkComputeQuantiles> computeQuantiles;
   computeQuantiles->SetNumberOfIntervals(N_intervals);
+  computeQuantiles->SetApproximateQuantiles(approximate);
   computeQuantiles->SetInputData(table);
   computeQuantiles->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_ROWS, table->GetColumn(0)->GetName());
@@ -88,5 +92,41 @@ int TestComputeQuantiles(int, char*[])
     return EXIT_FAILURE;
   }
 
+  // The sketch keeps all the values of small arrays, so quantiles are exact
+  if (!ComputeQuantiles(table, 4, quartile_solution, true))
+  {
+    cout << "## Failure: Approximation of quartiles does not match solution data!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Approximate the quartiles of a large shuffled ramp
+  const int N_ramp = 1000000;
+  vtkNew<vtkIntArray> ramp_array;
+  ramp_array->SetName("ramp");
+  ramp_array->SetNumberOfTuples(N_ramp);
+  for (int i = 0; i < N_ramp; i++)
+  {
+    ramp_array->SetValue(i, static_cast<int>((i * 7919LL) % N_ramp));
+  }
+  vtkNew<vtkTable> ramp_table;
+  ramp_table->AddColumn(ramp_array);
+
+  vtkNew<vtkComputeQuantiles> computeQuantiles;
+  computeQuantiles->SetNumberOfIntervals(4);
+  computeQuantiles->ApproximateQuantilesOn();
+  computeQuantiles->SetInputData(ramp_table);
+  computeQuantiles->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_ROWS, "ramp");
+  computeQuantiles->Update();
+  vtkDataArray* quartiles = vtkDataArray::SafeDownCast(computeQuantiles->GetOutput()->GetColumn(0));
+  for (int i = 0; i <= 4; i++)
+  {
+    const double expected = i * (N_ramp - 1) / 4.;
+    if (!quartiles || std::abs(quartiles->GetTuple1(i) - expected) > 0.01 * N_ramp)
+    {
+      cout << "## Failure: Approximate quartile " << i << " is too far from " << expected << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,206 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestStatisticsMomentsSMP.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the learn phase of vtkDescriptiveStatistics and
+// vtkCorrelativeStatistics, which accumulates ranges of rows concurrently and
+// merges the partial moments, gives the same model as the sequential backend
+// and as a two-pass computation. All the values are negative, so that the
+// maximum cannot be confused with its initial value.
+
+#include "vtkCorrelativeStatistics.h"
+#include "vtkDescriptiveStatistics.h"
+#include "vtkDoubleArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStatisticsAlgorithm.h"
+#include "vtkTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+struct Model
+{
+  // Descriptive statistics of X
+  double Minimum;
+  double Maximum;
+  double Mean;
+  double M2;
+  double M3;
+  double M4;
+  // Correlative statistics of (X, Y)
+  double MeanX;
+  double MeanY;
+  double M2X;
+  double M2Y;
+  double MXY;
+  double PearsonR;
+};
+
+bool Close(const char* name, double value, double expected)
+{
+  if (std::abs(value - expected) > 1e-10 * std::max(1.0, std::abs(expected)))
+  {
+    std::cerr << name << " is " << value << " instead of " << expected << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool SameModels(const Model& model, const Model& expected)
+{
+  // The extrema are exact
+  if (model.Minimum != expected.Minimum || model.Maximum != expected.Maximum)
+  {
+    std::cerr << "The range is [" << model.Minimum << ", " << model.Maximum << "] instead of ["
+              << expected.Minimum << ", " << expected.Maximum << "]" << std::endl;
+    return false;
+  }
+  return Close("Mean", model.Mean, expected.Mean) && Close("M2", model.M2, expected.M2) &&
+    Close("M3", model.M3, expected.M3) && Close("M4", model.M4, expected.M4) &&
+    Close("Mean X", model.MeanX, expected.MeanX) && Close("Mean Y", model.MeanY, expected.MeanY) &&
+    Close("M2 X", model.M2X, expected.M2X) && Close("M2 Y", model.M2Y, expected.M2Y) &&
+    Close("M XY", model.MXY, expected.MXY) && Close("Pearson r", model.PearsonR, expected.PearsonR);
+}
+
+Model Learn(vtkTable* table)
+{
+  Model model;
+
+  vtkNew<vtkDescriptiveStatistics> descriptive;
+  descriptive->SetInputData(vtkStatisticsAlgorithm::INPUT_DATA, table);
+  descriptive->AddColumn("X");
+  descriptive->SetLearnOption(true);
+  descriptive->SetDeriveOption(false);
+  descriptive->SetAssessOption(false);
+  descriptive->SetTestOption(false);
+  descriptive->Update();
+  vtkTable* primary = vtkTable::SafeDownCast(
+    vtkMultiBlockDataSet::SafeDownCast(
+      descriptive->GetOutputDataObject(vtkStatisticsAlgorithm::OUTPUT_MODEL))
+      ->GetBlock(0));
+  model.Minimum = primary->GetValueByName(0, "Minimum").ToDouble();
+  model.Maximum = primary->GetValueByName(0, "Maximum").ToDouble();
+  model.Mean = primary->GetValueByName(0, "Mean").ToDouble();
+  model.M2 = primary->GetValueByName(0, "M2").ToDouble();
+  model.M3 = primary->GetValueByName(0, "M3").ToDouble();
+  model.M4 = primary->GetValueByName(0, "M4").ToDouble();
+
+  vtkNew<vtkCorrelativeStatistics> correlative;
+  correlative->SetInputData(vtkStatisticsAlgorithm::INPUT_DATA, table);
+  correlative->AddColumnPair("X", "Y");
+  correlative->SetLearnOption(true);
+  correlative->SetDeriveOption(true);
+  correlative->SetAssessOption(false);
+  correlative->SetTestOption(false);
+  correlative->Update();
+  vtkMultiBlockDataSet* correlativeModel = vtkMultiBlockDataSet::SafeDownCast(
+    correlative->GetOutputDataObject(vtkStatisticsAlgorithm::OUTPUT_MODEL));
+  primary = vtkTable::SafeDownCast(correlativeModel->GetBlock(0));
+  vtkTable* derived = vtkTable::SafeDownCast(correlativeModel->GetBlock(1));
+  model.MeanX = primary->GetValueByName(0, "Mean X").ToDouble();
+  model.MeanY = primary->GetValueByName(0, "Mean Y").ToDouble();
+  model.M2X = primary->GetValueByName(0, "M2 X").ToDouble();
+  model.M2Y = primary->GetValueByName(0, "M2 Y").ToDouble();
+  model.MXY = primary->GetValueByName(0, "M XY").ToDouble();
+  model.PearsonR = derived->GetValueByName(0, "Pearson r").ToDouble();
+  return model;
+}
+
+// Two-pass computation of the expected model
+Model Reference(const std::vector<double>& x, const std::vector<double>& y)
+{
+  Model model;
+  const double n = static_cast<double>(x.size());
+  model.Minimum = *std::min_element(x.begin(), x.end());
+  model.Maximum = *std::max_element(x.begin(), x.end());
+  double sumX = 0.;
+  double sumY = 0.;
+  for (size_t i = 0; i < x.size(); ++i)
+  {
+    sumX += x[i];
+    sumY += y[i];
+  }
+  model.Mean = model.MeanX = sumX / n;
+  model.MeanY = sumY / n;
+  model.M2 = model.M3 = model.M4 = model.M2Y = model.MXY = 0.;
+  for (size_t i = 0; i < x.size(); ++i)
+  {
+    const double dx = x[i] - model.MeanX;
+    const double dy = y[i] - model.MeanY;
+    model.M2 += dx * dx;
+    model.M3 += dx * dx * dx;
+    model.M4 += dx * dx * dx * dx;
+    model.M2Y += dy * dy;
+    model.MXY += dx * dy;
+  }
+  model.M2X = model.M2;
+  model.PearsonR = model.MXY / std::sqrt(model.M2X * model.M2Y);
+  return model;
+}
+}
+
+int TestStatisticsMomentsSMP(int, char*[])
+{
+  const vtkIdType numberOfRows = 100003;
+  std::vector<double> x(numberOfRows);
+  std::vector<double> y(numberOfRows);
+  vtkNew<vtkDoubleArray> xColumn;
+  xColumn->SetName("X");
+  xColumn->SetNumberOfTuples(numberOfRows);
+  vtkNew<vtkDoubleArray> yColumn;
+  yColumn->SetName("Y");
+  yColumn->SetNumberOfTuples(numberOfRows);
+  for (vtkIdType i = 0; i < numberOfRows; ++i)
+  {
+    // skewed negative values between -1000.5 and -1
+    const double u = static_cast<double>((i * 7919) % 1000) / 1000.;
+    x[i] = -1. - 999.5 * u * u;
+    y[i] = 0.5 * x[i] + static_cast<double>((i * 104729) % 97) - 300.;
+    xColumn->SetValue(i, x[i]);
+    yColumn->SetValue(i, y[i]);
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(xColumn);
+  table->AddColumn(yColumn);
+
+  Model sequential;
+  vtkSMPTools::LocalScope(
+    vtkSMPTools::Config{ "Sequential" }, [&]() { sequential = Learn(table); });
+  const Model threaded = Learn(table);
+  const Model expected = Reference(x, y);
+
+  if (expected.Maximum >= 0.)
+  {
+    std::cerr << "The test data must be negative" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameModels(sequential, expected))
+  {
+    std::cerr << "The sequential model differs from the two-pass one" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameModels(threaded, sequential))
+  {
+    std::cerr << "The threaded model differs from the sequential one" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
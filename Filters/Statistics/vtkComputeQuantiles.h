@@ -61,6 +61,20 @@ public:
   vtkSetMacro(NumberOfIntervals, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/get whether the quantiles are approximated with a quantile sketch
+   * of the given size, which is much cheaper for large arrays.
+   * Default is false, with a sketch size of 200.
+   * @sa vtkOrderStatistics::SetApproximateQuantiles
+   */
+  vtkGetMacro(ApproximateQuantiles, bool);
+  vtkSetMacro(ApproximateQuantiles, bool);
+  vtkBooleanMacro(ApproximateQuantiles, bool);
+  vtkGetMacro(SketchSize, vtkIdType);
+  vtkSetClampMacro(SketchSize, vtkIdType, 8, VTK_ID_MAX);
+  ///@}
+
 protected:
   vtkComputeQuantiles();
   ~vtkComputeQuantiles() override = default;
@@ -76,6 +90,8 @@ protected:
 
   int FieldAssociation = -1;
   int NumberOfIntervals = 4;
+  bool ApproximateQuantiles = false;
+  vtkIdType SketchSize = 200;
 
 private:
   void operator=(const vtkComputeQuantiles&) = delete;
@@ -20,6 +20,7 @@
 
 #include "vtkCorrelativeStatistics.h"
 #include "vtkStatisticsAlgorithmPrivate.h"
+#include "vtkStatisticsMomentsInternal.h"
 
 #include "vtkDataObjectCollection.h"
 #include "vtkDoubleArray.h"
@@ -266,7 +267,8 @@ void vtkCorrelativeStatistics::Learn(
     // ignored)
     std::set<vtkStdString>::const_iterator it = rit->begin();
     vtkStdString colX = *it;
-    if (!inData->GetColumnByName(colX.c_str()))
+    vtkAbstractArray* columnX = inData->GetColumnByName(colX.c_str());
+    if (!columnX)
     {
       vtkWarningMacro("InData table does not have a column " << colX << ". Ignoring this pair.");
       continue;
@@ -274,36 +276,36 @@ void vtkCorrelativeStatistics::Learn(
 
     ++it;
     vtkStdString colY = *it;
-    if (!inData->GetColumnByName(colY.c_str()))
+    vtkAbstractArray* columnY = inData->GetColumnByName(colY.c_str());
+    if (!columnY)
     {
       vtkWarningMacro("InData table does not have a column " << colY << ". Ignoring this pair.");
       continue;
     }
 
-    double meanX = 0.;
-    double meanY = 0.;
-    double mom2X = 0.;
-    double mom2Y = 0.;
-    double momXY = 0.;
-
-    double inv_n, x, y, delta, deltaXn;
-    for (vtkIdType r = 0; r < nRow; ++r)
-    {
-      inv_n = 1. / (r + 1.);
-
-      x = inData->GetValueByName(r, colX.c_str()).ToDouble();
-      delta = x - meanX;
-      meanX += delta * inv_n;
-      deltaXn = x - meanX;
-      mom2X += delta * deltaXn;
-
-      y = inData->GetValueByName(r, colY.c_str()).ToDouble();
-      delta = y - meanY;
-      meanY += delta * inv_n;
-      mom2Y += delta * (y - meanY);
-
-      momXY += delta * deltaXn;
-    }
+    // Single component data arrays are read directly, by ranges of rows
+    // accumulated concurrently, other columns through the variant API.
+    vtkDataArray* dataX = vtkArrayDownCast<vtkDataArray>(columnX);
+    vtkDataArray* dataY = vtkArrayDownCast<vtkDataArray>(columnY);
+    const bool direct = dataX && dataX->GetNumberOfComponents() == 1 && dataY &&
+      dataY->GetNumberOfComponents() == 1;
+    vtkBivariateMoments moments = vtkStatisticsAccumulateRows<vtkBivariateMoments>(nRow, nullptr,
+      0, direct, [&](vtkBivariateMoments& accumulator, vtkIdType r) {
+        if (direct)
+        {
+          accumulator.Add(dataX->GetComponent(r, 0), dataY->GetComponent(r, 0));
+        }
+        else
+        {
+          accumulator.Add(inData->GetValueByName(r, colX.c_str()).ToDouble(),
+            inData->GetValueByName(r, colY.c_str()).ToDouble());
+        }
+      });
+    const double meanX = moments.MeanX;
+    const double meanY = moments.MeanY;
+    const double mom2X = moments.M2X;
+    const double mom2Y = moments.M2Y;
+    const double momXY = moments.MXY;
 
     vtkVariantArray* row = vtkVariantArray::New();
 
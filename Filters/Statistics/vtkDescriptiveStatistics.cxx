@@ -23,6 +23,7 @@
 
 #include "vtkDescriptiveStatistics.h"
 #include "vtkStatisticsAlgorithmPrivate.h"
+#include "vtkStatisticsMomentsInternal.h"
 
 #include "vtkDataObjectCollection.h"
 #include "vtkDataSetAttributes.h"
@@ -394,33 +395,30 @@ void vtkDescriptiveStatistics::Learn(
 
   // Loop over requests
   vtkIdType nRow = inData->GetNumberOfRows();
-  vtkIdType numberOfGhostlessRow = 0;
-  if (ghosts)
-  {
-    for (vtkIdType id = 0; id < ghosts->GetNumberOfValues(); ++id)
-    {
-      if (!(ghosts->GetValue(id) & this->GhostsToSkip))
-      {
-        ++numberOfGhostlessRow;
-      }
-    }
-  }
-  else
-  {
-    numberOfGhostlessRow = nRow;
-  }
   for (std::set<std::set<vtkStdString>>::const_iterator rit = this->Internals->Requests.begin();
        rit != this->Internals->Requests.end(); ++rit)
   {
     // Each request contains only one column of interest (if there are others, they are ignored)
     std::set<vtkStdString>::const_iterator it = rit->begin();
     vtkStdString varName = *it;
-    if (!inData->GetColumnByName(varName.c_str()))
+    vtkAbstractArray* column = inData->GetColumnByName(varName.c_str());
+    if (!column)
     {
       vtkWarningMacro("InData table does not have a column " << varName << ". Ignoring it.");
       continue;
     }
 
+    // Single component data arrays are read directly, by ranges of rows
+    // accumulated concurrently, other columns through the variant API.
+    vtkDataArray* dataColumn = vtkArrayDownCast<vtkDataArray>(column);
+    const bool direct = dataColumn && dataColumn->GetNumberOfComponents() == 1;
+    vtkUnivariateMoments moments = vtkStatisticsAccumulateRows<vtkUnivariateMoments>(nRow, ghosts,
+      this->GhostsToSkip, direct, [&](vtkUnivariateMoments& accumulator, vtkIdType r) {
+        accumulator.Add(direct ? dataColumn->GetComponent(r, 0)
+                               : inData->GetValueByName(r, varName.c_str()).ToDouble());
+      });
+
+    const vtkIdType numberOfGhostlessRow = static_cast<vtkIdType>(moments.Cardinality);
     double minVal, maxVal, mean, mom2, mom3, mom4;
     if (numberOfGhostlessRow == 0)
     {
@@ -433,44 +431,12 @@ void vtkDescriptiveStatistics::Learn(
     }
     else
     {
-      minVal = std::numeric_limits<double>::max();
-      maxVal = std::numeric_limits<double>::min();
-      mean = 0.;
-      mom2 = 0.;
-      mom3 = 0.;
-      mom4 = 0.;
-    }
-
-    if (numberOfGhostlessRow)
-    {
-      double n, inv_n, val, delta, A, B;
-      vtkIdType numberOfSkippedElements = 0;
-      for (vtkIdType r = 0; r < nRow; ++r)
-      {
-        if (ghosts && (ghosts->GetValue(r) & this->GhostsToSkip))
-        {
-          ++numberOfSkippedElements;
-          continue;
-        }
-        n = r + 1. - numberOfSkippedElements;
-        inv_n = 1. / n;
-
-        val = inData->GetValueByName(r, varName.c_str()).ToDouble();
-        delta = val - mean;
-
-        A = delta * inv_n;
-        mean += A;
-        mom4 += A *
-          (A * A * delta * (r - numberOfSkippedElements) * (n * (n - 3.) + 3.) + 6. * A * mom2 -
-            4. * mom3);
-
-        B = val - mean;
-        mom3 += A * (B * delta * (n - 2.) - 3. * mom2);
-        mom2 += delta * B;
-
-        minVal = std::min(minVal, val);
-        maxVal = std::max(maxVal, val);
-      }
+      minVal = moments.Minimum;
+      maxVal = moments.Maximum;
+      mean = moments.Mean;
+      mom2 = moments.M2;
+      mom3 = moments.M3;
+      mom4 = moments.M4;
     }
 
     vtkVariantArray* row = vtkVariantArray::New();
@@ -7,6 +7,8 @@
 #include "vtkTable.h"
 #include "vtkVariantArray.h"
 
+#include <cstring>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkKMeansDistanceFunctor);
 
@@ -61,6 +63,12 @@ void vtkKMeansDistanceFunctor::operator()(
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkKMeansDistanceFunctor::IsThreadSafe()
+{
+  return strcmp(this->GetClassName(), "vtkKMeansDistanceFunctor") == 0;
+}
+
 //------------------------------------------------------------------------------
 void vtkKMeansDistanceFunctor::PairwiseUpdate(vtkTable* clusterCoords, vtkIdType rowIndex,
   vtkVariantArray* dataCoord, vtkIdType dataCoordCardinality, vtkIdType totalCardinality)
@@ -40,6 +40,15 @@ public:
    */
   virtual void operator()(double&, vtkVariantArray*, vtkVariantArray*);
 
+  /**
+   * Return whether operator() may be called concurrently, from different
+   * threads, with different arguments. vtkKMeansStatistics then searches the
+   * nearest cluster centers of the observations concurrently.
+   * This is true for the Euclidean distance of this class. Subclasses, which
+   * may keep state in operator(), have to override this method to opt in.
+   */
+  virtual bool IsThreadSafe();
+
   /**
    * This is called once per observation per run per iteration in order to assign the
    * observation to its nearest cluster center after the distance functor has been
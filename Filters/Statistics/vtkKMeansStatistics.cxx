@@ -10,8 +10,10 @@
 #include "vtkInformation.h"
 #include "vtkIntArray.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStatisticsAlgorithmPrivate.h"
 #include "vtkTable.h"
 #include "vtkUnsignedCharArray.h"
@@ -460,63 +462,95 @@ void vtkKMeansStatistics::Learn(
       }
     }
 
-    // Find minimum distance between each observation and each cluster center,
-    // then assign the observation to the nearest cluster.
-    vtkIdType localMemberID, offsetLocalMemberID;
-    double minDistance, curDistance;
-    vtkIdType numberOfSkipedObservations = 0;
-    for (vtkIdType observation = 0; observation < dataElements->GetNumberOfRows(); observation++)
+    // Find minimum distance between each observation and each cluster center.
+    // The cluster centers do not change during this search, which is done
+    // concurrently when the distance functor supports it.
+    const vtkIdType numberOfRows = dataElements->GetNumberOfRows();
+    std::vector<vtkSmartPointer<vtkVariantArray>> centers(curClusterElements->GetNumberOfRows());
+    for (vtkIdType j = 0; j < curClusterElements->GetNumberOfRows(); ++j)
     {
-      if (ghosts && (ghosts->GetValue(observation) & this->GhostsToSkip))
-      {
-        ++numberOfSkipedObservations;
-        continue;
-      }
-      for (int runID = 0; runID < numRuns; runID++)
+      centers[j] = vtkSmartPointer<vtkVariantArray>::New();
+      curClusterElements->GetRow(j, centers[j]);
+    }
+    std::vector<vtkIdType> nearestCenter(numberOfRows * numRuns, -1);
+    std::vector<double> nearestDistance(numberOfRows * numRuns);
+    auto findNearestCenters = [&](vtkIdType begin, vtkIdType end) {
+      vtkNew<vtkVariantArray> observationRow;
+      double minDistance, curDistance;
+      for (vtkIdType observation = begin; observation < end; ++observation)
       {
-        if (computeRun->GetValue(runID))
+        if (ghosts && (ghosts->GetValue(observation) & this->GhostsToSkip))
+        {
+          continue;
+        }
+        dataElements->GetRow(observation, observationRow);
+        for (int runID = 0; runID < numRuns; runID++)
         {
           vtkIdType runStartIdx = startRunID->GetValue(runID);
           vtkIdType runEndIdx = endRunID->GetValue(runID);
-          if (runStartIdx >= runEndIdx)
+          if (!computeRun->GetValue(runID) || runStartIdx >= runEndIdx)
           {
             continue;
           }
-          vtkIdType j = runStartIdx;
-          localMemberID = 0;
-          offsetLocalMemberID = runStartIdx;
-          (*this->DistanceFunctor)(
-            minDistance, curClusterElements->GetRow(j), dataElements->GetRow(observation));
-          curDistance = minDistance;
-          ++j;
-          for (/* no init */; j < runEndIdx; j++)
+          vtkIdType nearest = runStartIdx;
+          (*this->DistanceFunctor)(minDistance, centers[runStartIdx], observationRow);
+          for (vtkIdType j = runStartIdx + 1; j < runEndIdx; j++)
           {
-            (*this->DistanceFunctor)(
-              curDistance, curClusterElements->GetRow(j), dataElements->GetRow(observation));
+            (*this->DistanceFunctor)(curDistance, centers[j], observationRow);
             if (curDistance < minDistance)
             {
               minDistance = curDistance;
-              localMemberID = j - runStartIdx;
-              offsetLocalMemberID = j;
+              nearest = j;
             }
           }
-          vtkIdType id = (observation - numberOfSkipedObservations) * numRuns + runID;
-          // We've located the nearest cluster center. Has it changed since the last iteration?
-          if (clusterMemberID->GetValue(id) != localMemberID)
-          {
-            numMembershipChanges->SetValue(runID, numMembershipChanges->GetValue(runID) + 1);
-            clusterMemberID->SetValue(id, localMemberID);
-          }
-          // Give the distance functor a chance to modify any derived quantities used to
-          // change the cluster centers between iterations, now that we know which cluster
-          // center the observation is assigned to.
-          vtkIdType newCardinality = numDataElementsInCluster->GetValue(offsetLocalMemberID) + 1;
-          numDataElementsInCluster->SetValue(offsetLocalMemberID, newCardinality);
-          this->DistanceFunctor->PairwiseUpdate(newClusterElements, offsetLocalMemberID,
-            dataElements->GetRow(observation), 1, newCardinality);
-          // Update the error for this cluster center to account for this observation.
-          error->SetValue(offsetLocalMemberID, error->GetValue(offsetLocalMemberID) + minDistance);
+          nearestCenter[observation * numRuns + runID] = nearest;
+          nearestDistance[observation * numRuns + runID] = minDistance;
+        }
+      }
+    };
+    if (this->DistanceFunctor->IsThreadSafe())
+    {
+      vtkSMPTools::For(0, numberOfRows, findNearestCenters);
+    }
+    else
+    {
+      findNearestCenters(0, numberOfRows);
+    }
+
+    // Then assign the observations to their nearest cluster, in order.
+    vtkIdType numberOfSkipedObservations = 0;
+    for (vtkIdType observation = 0; observation < numberOfRows; observation++)
+    {
+      if (ghosts && (ghosts->GetValue(observation) & this->GhostsToSkip))
+      {
+        ++numberOfSkipedObservations;
+        continue;
+      }
+      for (int runID = 0; runID < numRuns; runID++)
+      {
+        const vtkIdType offsetLocalMemberID = nearestCenter[observation * numRuns + runID];
+        if (offsetLocalMemberID < 0)
+        {
+          continue;
+        }
+        const vtkIdType localMemberID = offsetLocalMemberID - startRunID->GetValue(runID);
+        const double minDistance = nearestDistance[observation * numRuns + runID];
+        vtkIdType id = (observation - numberOfSkipedObservations) * numRuns + runID;
+        // We've located the nearest cluster center. Has it changed since the last iteration?
+        if (clusterMemberID->GetValue(id) != localMemberID)
+        {
+          numMembershipChanges->SetValue(runID, numMembershipChanges->GetValue(runID) + 1);
+          clusterMemberID->SetValue(id, localMemberID);
         }
+        // Give the distance functor a chance to modify any derived quantities used to
+        // change the cluster centers between iterations, now that we know which cluster
+        // center the observation is assigned to.
+        vtkIdType newCardinality = numDataElementsInCluster->GetValue(offsetLocalMemberID) + 1;
+        numDataElementsInCluster->SetValue(offsetLocalMemberID, newCardinality);
+        this->DistanceFunctor->PairwiseUpdate(newClusterElements, offsetLocalMemberID,
+          dataElements->GetRow(observation), 1, newCardinality);
+        // Update the error for this cluster center to account for this observation.
+        error->SetValue(offsetLocalMemberID, error->GetValue(offsetLocalMemberID) + minDistance);
       }
     }
     // update cluster centers
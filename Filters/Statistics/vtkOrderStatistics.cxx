@@ -29,12 +29,14 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkMath.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkVariantArray.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <map>
@@ -77,6 +79,119 @@ struct GhostsCounter
   vtkIdType GlobalNumberOfGhosts;
   vtkSMPThreadLocal<vtkIdType> NumberOfGhosts;
 };
+
+//==============================================================================
+// A KLL quantile sketch (Karnin, Lang and Liberty, 2016). Values are added to
+// level 0; when a level is full, it is sorted and every other value is promoted
+// to the next level, where values weigh twice as much. The total weight is
+// preserved exactly. Sketches of disjoint sets of values can be merged. The
+// value promoted out of each pair alternates instead of being random, so that
+// the sketch of a given sequence of values is reproducible.
+class QuantileSketch
+{
+public:
+  explicit QuantileSketch(vtkIdType k = 200)
+    : K(k)
+  {
+  }
+
+  void Add(double value)
+  {
+    if (this->Levels.empty())
+    {
+      this->Levels.resize(1);
+    }
+    this->Levels[0].push_back(value);
+    if (++this->Size >= this->GetCapacity())
+    {
+      this->Compress();
+    }
+  }
+
+  void Merge(const QuantileSketch& other)
+  {
+    if (this->Levels.size() < other.Levels.size())
+    {
+      this->Levels.resize(other.Levels.size());
+    }
+    for (std::size_t level = 0; level < other.Levels.size(); ++level)
+    {
+      this->Levels[level].insert(
+        this->Levels[level].end(), other.Levels[level].begin(), other.Levels[level].end());
+    }
+    this->Size += other.Size;
+    while (this->Size >= this->GetCapacity())
+    {
+      this->Compress();
+    }
+  }
+
+  // Accumulate the weighted values of the sketch in a histogram
+  void FillHistogram(std::map<double, vtkIdType>& histogram) const
+  {
+    for (std::size_t level = 0; level < this->Levels.size(); ++level)
+    {
+      const vtkIdType weight = static_cast<vtkIdType>(1) << level;
+      for (double value : this->Levels[level])
+      {
+        histogram[value] += weight;
+      }
+    }
+  }
+
+private:
+  // Lower levels get geometrically smaller capacities
+  vtkIdType GetLevelCapacity(std::size_t level) const
+  {
+    const double depth = static_cast<double>(this->Levels.size() - 1 - level);
+    return std::max(static_cast<vtkIdType>(2),
+      static_cast<vtkIdType>(std::ceil(this->K * std::pow(2. / 3., depth))));
+  }
+
+  vtkIdType GetCapacity() const
+  {
+    vtkIdType capacity = 0;
+    for (std::size_t level = 0; level < this->Levels.size(); ++level)
+    {
+      capacity += this->GetLevelCapacity(level);
+    }
+    return capacity;
+  }
+
+  // Compact the lowest full level. There is one when the sketch is full.
+  void Compress()
+  {
+    for (std::size_t level = 0; level < this->Levels.size(); ++level)
+    {
+      if (static_cast<vtkIdType>(this->Levels[level].size()) < this->GetLevelCapacity(level))
+      {
+        continue;
+      }
+      if (level + 1 == this->Levels.size())
+      {
+        this->Levels.emplace_back();
+      }
+      std::vector<double>& values = this->Levels[level];
+      std::vector<double>& promoted = this->Levels[level + 1];
+      std::sort(values.begin(), values.end());
+      // An odd value out stays at this level
+      const std::size_t first = values.size() % 2;
+      this->Offset ^= 1;
+      for (std::size_t i = first + this->Offset; i < values.size(); i += 2)
+      {
+        promoted.push_back(values[i]);
+      }
+      this->Size -= static_cast<vtkIdType>((values.size() - first) / 2);
+      values.resize(first);
+      return;
+    }
+  }
+
+  vtkIdType K;
+  vtkIdType Size = 0;
+  std::size_t Offset = 0;
+  std::vector<std::vector<double>> Levels;
+};
 } // anonymous namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -89,6 +204,8 @@ vtkOrderStatistics::vtkOrderStatistics()
   this->NumberOfIntervals = 4;       // By default, calculate 5-points statistics
   this->Quantize = false;            // By default, do not force quantization
   this->MaximumHistogramSize = 1000; // A large value by default
+  this->ApproximateQuantiles = false;
+  this->SketchSize = 200;
   // Number of primary tables is variable
   this->NumberOfPrimaryTables = -1;
 
@@ -110,6 +227,8 @@ void vtkOrderStatistics::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "QuantileDefinition: " << this->QuantileDefinition << endl;
   os << indent << "Quantize: " << this->Quantize << endl;
   os << indent << "MaximumHistogramSize: " << this->MaximumHistogramSize << endl;
+  os << indent << "ApproximateQuantiles: " << this->ApproximateQuantiles << endl;
+  os << indent << "SketchSize: " << this->SketchSize << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -256,16 +375,44 @@ void vtkOrderStatistics::Learn(
 
       // Calculate histogram
       std::map<double, vtkIdType> histogram;
-      for (vtkIdType r = 0; r < nRow; ++r)
+      if (this->ApproximateQuantiles)
       {
-        if (!ghosts || !(ghosts->GetValue(r) & this->GhostsToSkip))
+        // Sketch ranges of rows concurrently, then merge the sketches
+        vtkSMPThreadLocal<::QuantileSketch> localSketches(::QuantileSketch(this->SketchSize));
+        vtkSMPTools::For(0, nRow, [&](vtkIdType begin, vtkIdType end) {
+          ::QuantileSketch& sketch = localSketches.Local();
+          for (vtkIdType r = begin; r < end; ++r)
+          {
+            if (!ghosts || !(ghosts->GetValue(r) & this->GhostsToSkip))
+            {
+              const double value = dvals->GetComponent(r, 0);
+              if (!std::isnan(value))
+              {
+                sketch.Add(value);
+              }
+            }
+          }
+        });
+        ::QuantileSketch sketch(this->SketchSize);
+        for (const ::QuantileSketch& localSketch : localSketches)
+        {
+          sketch.Merge(localSketch);
+        }
+        sketch.FillHistogram(histogram);
+      }
+      else
+      {
+        for (vtkIdType r = 0; r < nRow; ++r)
         {
-          ++histogram[dvals->GetTuple1(r)];
+          if (!ghosts || !(ghosts->GetValue(r) & this->GhostsToSkip))
+          {
+            ++histogram[dvals->GetTuple1(r)];
+          }
         }
       }
 
       // If maximum size was requested, make sure it is satisfied
-      if (this->Quantize)
+      if (this->Quantize && !this->ApproximateQuantiles)
       {
         // Retrieve achieved histogram size
         vtkIdType Nq = static_cast<vtkIdType>(histogram.size());
@@ -25,7 +25,7 @@ PURPOSE.  See the above copyright notice for more information.
  * Given a selection of columns of interest in an input data table, this
  * class provides the following functionalities, depending on the
  * execution mode it is executed in:
- * * Learn: calculate histogram.
+ * * Learn: calculate histogram, or a quantile sketch when ApproximateQuantiles is on.
  * * Derive: calculate PDFs and arbitrary quantiles. Provide specific names when 5-point
  *   statistics (minimum, 1st quartile, median, third quartile, maximum) requested.
  * * Assess: given an input data set and a set of q-quantiles, label each datum
@@ -102,6 +102,32 @@ public:
   vtkGetMacro(MaximumHistogramSize, vtkIdType);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether the quantiles of numeric columns are approximated with a
+   * mergeable quantile sketch (KLL) instead of the full histogram of the column.
+   * The sketch is built concurrently, needs memory proportional to SketchSize
+   * only, and its weighted samples are stored in place of the histogram, so
+   * that the model stays small and can be gathered across ranks. The rank error
+   * of the quantiles is about 1.7 / SketchSize of the number of values, and the
+   * quantiles may change with the number of threads. NaN values are ignored.
+   * Quantize is ignored in this mode. The default is false.
+   */
+  vtkSetMacro(ApproximateQuantiles, bool);
+  vtkGetMacro(ApproximateQuantiles, bool);
+  vtkBooleanMacro(ApproximateQuantiles, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the size parameter of the quantile sketch, used when
+   * ApproximateQuantiles is true. Larger sketches give more accurate quantiles.
+   * The default is 200.
+   */
+  vtkSetClampMacro(SketchSize, vtkIdType, 8, VTK_ID_MAX);
+  vtkGetMacro(SketchSize, vtkIdType);
+  ///@}
+
   /**
    * Get the quantile definition.
    */
@@ -174,6 +200,8 @@ protected:
   QuantileDefinitionType QuantileDefinition;
   bool Quantize;
   vtkIdType MaximumHistogramSize;
+  bool ApproximateQuantiles;
+  vtkIdType SketchSize;
   vtkIdType NumberOfGhosts;
   unsigned char GhostsToSkip;
 
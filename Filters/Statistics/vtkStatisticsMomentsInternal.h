@@ -0,0 +1,202 @@
+/*=========================================================================
+
+Program:   Visualization Toolkit
+Module:    vtkStatisticsMomentsInternal.h
+
+Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+All rights reserved.
+See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+This software is distributed WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkStatisticsMomentsInternal
+ * @brief   single pass, mergeable accumulators of centered moments
+ *
+ * vtkUnivariateMoments and vtkBivariateMoments accumulate the cardinality,
+ * the means and the centered moments of one or two variables in a single
+ * pass over the data, with the update formulas of Welford and Pebay. Two
+ * accumulators of disjoint sets of observations can be merged with the
+ * pairwise formulas of Pebay (SAND2008-6212), which are also used to
+ * aggregate models. This lets the learn phase of the statistics algorithms
+ * process the rows of their input concurrently: each thread accumulates a
+ * range of rows, then the partial moments are merged.
+ *
+ * vtkStatisticsAccumulateRows() accumulates the rows of a table, skipping
+ * ghost rows, concurrently when the columns can be read concurrently.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkDescriptiveStatistics vtkCorrelativeStatistics
+ */
+
+#ifndef vtkStatisticsMomentsInternal_h
+#define vtkStatisticsMomentsInternal_h
+
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <limits>
+
+VTK_ABI_NAMESPACE_BEGIN
+struct vtkUnivariateMoments
+{
+  double Cardinality = 0.;
+  double Minimum = std::numeric_limits<double>::infinity();
+  double Maximum = -std::numeric_limits<double>::infinity();
+  double Mean = 0.;
+  double M2 = 0.;
+  double M3 = 0.;
+  double M4 = 0.;
+
+  void Add(double x)
+  {
+    const double n = ++this->Cardinality;
+    const double delta = x - this->Mean;
+    const double A = delta / n;
+    this->Mean += A;
+    this->M4 +=
+      A * (A * A * delta * (n - 1.) * (n * (n - 3.) + 3.) + 6. * A * this->M2 - 4. * this->M3);
+    const double B = x - this->Mean;
+    this->M3 += A * (B * delta * (n - 2.) - 3. * this->M2);
+    this->M2 += delta * B;
+    this->Minimum = std::min(this->Minimum, x);
+    this->Maximum = std::max(this->Maximum, x);
+  }
+
+  void Merge(const vtkUnivariateMoments& other)
+  {
+    if (other.Cardinality == 0.)
+    {
+      return;
+    }
+    if (this->Cardinality == 0.)
+    {
+      *this = other;
+      return;
+    }
+    const double n = this->Cardinality;
+    const double n_c = other.Cardinality;
+    const double N = n + n_c;
+    const double delta = other.Mean - this->Mean;
+    const double delta_sur_N = delta / N;
+    const double delta2_sur_N2 = delta_sur_N * delta_sur_N;
+    const double n2 = n * n;
+    const double n_c2 = n_c * n_c;
+    const double prod_n = n * n_c;
+
+    this->M4 += other.M4 + delta2_sur_N2 * delta2_sur_N2 * prod_n * (n * n2 + n_c * n_c2) +
+      6. * (n2 * other.M2 + n_c2 * this->M2) * delta2_sur_N2 +
+      4. * (n * other.M3 - n_c * this->M3) * delta_sur_N;
+    this->M3 += other.M3 + prod_n * (n - n_c) * delta * delta2_sur_N2 +
+      3. * (n * other.M2 - n_c * this->M2) * delta_sur_N;
+    this->M2 += other.M2 + prod_n * delta * delta_sur_N;
+    this->Mean += n_c * delta_sur_N;
+    this->Cardinality = N;
+    this->Minimum = std::min(this->Minimum, other.Minimum);
+    this->Maximum = std::max(this->Maximum, other.Maximum);
+  }
+};
+
+struct vtkBivariateMoments
+{
+  double Cardinality = 0.;
+  double MeanX = 0.;
+  double MeanY = 0.;
+  double M2X = 0.;
+  double M2Y = 0.;
+  double MXY = 0.;
+
+  void Add(double x, double y)
+  {
+    const double n = ++this->Cardinality;
+    const double deltaX = x - this->MeanX;
+    this->MeanX += deltaX / n;
+    const double deltaXn = x - this->MeanX;
+    this->M2X += deltaX * deltaXn;
+    const double deltaY = y - this->MeanY;
+    this->MeanY += deltaY / n;
+    this->M2Y += deltaY * (y - this->MeanY);
+    this->MXY += deltaY * deltaXn;
+  }
+
+  void Merge(const vtkBivariateMoments& other)
+  {
+    if (other.Cardinality == 0.)
+    {
+      return;
+    }
+    if (this->Cardinality == 0.)
+    {
+      *this = other;
+      return;
+    }
+    const double n = this->Cardinality;
+    const double n_c = other.Cardinality;
+    const double N = n + n_c;
+    const double deltaX = other.MeanX - this->MeanX;
+    const double deltaX_sur_N = deltaX / N;
+    const double deltaY = other.MeanY - this->MeanY;
+    const double deltaY_sur_N = deltaY / N;
+    const double prod_n = n * n_c;
+
+    this->M2X += other.M2X + prod_n * deltaX * deltaX_sur_N;
+    this->M2Y += other.M2Y + prod_n * deltaY * deltaY_sur_N;
+    this->MXY += other.MXY + prod_n * deltaX * deltaY_sur_N;
+    this->MeanX += n_c * deltaX_sur_N;
+    this->MeanY += n_c * deltaY_sur_N;
+    this->Cardinality = N;
+  }
+};
+
+/**
+ * Accumulate the rows [0, numberOfRows) that are not flagged in the ghost
+ * array with ghostsToSkip, calling addRow(moments, row) for each of them.
+ * When concurrent is true, ranges of rows are accumulated by different
+ * threads, so addRow must be thread safe, then the partial moments are merged.
+ */
+template <typename Moments, typename AddRow>
+Moments vtkStatisticsAccumulateRows(vtkIdType numberOfRows, vtkUnsignedCharArray* ghosts,
+  unsigned char ghostsToSkip, bool concurrent, AddRow&& addRow)
+{
+  auto accumulate = [&](Moments& moments, vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; ++row)
+    {
+      if (!ghosts || !(ghosts->GetValue(row) & ghostsToSkip))
+      {
+        addRow(moments, row);
+      }
+    }
+  };
+
+  Moments moments;
+  if (!concurrent)
+  {
+    accumulate(moments, 0, numberOfRows);
+    return moments;
+  }
+
+  vtkSMPThreadLocal<Moments> localMoments;
+  vtkSMPTools::For(0, numberOfRows, [&](vtkIdType begin, vtkIdType end) {
+    accumulate(localMoments.Local(), begin, end);
+  });
+  for (const Moments& partial : localMoments)
+  {
+    moments.Merge(partial);
+  }
+  return moments;
+}
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkStatisticsMomentsInternal_h
+// VTK-HeaderTest-Exclude: vtkStatisticsMomentsInternal.h
@@ -70,7 +70,16 @@ void vtkGeoTransform::TransformPoints(vtkPoints* srcPts, vtkPoints* dstPts)
   vtkDoubleArray* dstCoords = vtkArrayDownCast<vtkDoubleArray>(dstPts->GetData());
   if (!srcCoords || !dstCoords)
   { // data not in a form we can use directly anyway...
-    this->Superclass::TransformPoints(srcPts, dstPts);
+    // Transform the points one by one: unlike the superclass, do not use the
+    // projections concurrently, as they are not thread safe.
+    this->Update();
+    double point[3];
+    for (vtkIdType i = 0; i < srcPts->GetNumberOfPoints(); ++i)
+    {
+      srcPts->GetPoint(i, point);
+      this->InternalTransformPoint(point, point);
+      dstPts->InsertNextPoint(point);
+    }
     return;
   }
   dstCoords->DeepCopy(srcCoords);
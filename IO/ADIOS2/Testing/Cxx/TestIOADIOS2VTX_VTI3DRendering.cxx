@@ -28,11 +28,13 @@
 
 #include "vtkADIOS2VTXReader.h"
 
+#include <iostream>
 #include <numeric>
 
 #include "vtkCamera.h"
 #include "vtkCellData.h"
 #include "vtkDataArray.h"
+#include "vtkDataArraySelection.h"
 #include "vtkDataObject.h"
 #include "vtkDataSetMapper.h"
 #include "vtkImageData.h"
@@ -158,6 +160,27 @@ int TestIOADIOS2VTX_VTI3DRendering(int argc, char* argv[])
   vtkMultiPieceDataSet* mp = vtkMultiPieceDataSet::SafeDownCast(multiBlock->GetBlock(0));
   vtkImageData* imageData = vtkImageData::SafeDownCast(mp->GetPiece(rank));
 
+  // a disabled array is not read
+  vtkDataArraySelection* cellSelection = adios2Reader->GetCellDataArraySelection();
+  if (!cellSelection->ArrayExists("T") || !imageData->GetCellData()->GetArray("T"))
+  {
+    std::cerr << "ERROR: cell data array T not found\n";
+    return EXIT_FAILURE;
+  }
+  cellSelection->DisableArray("T");
+  adios2Reader->Update();
+  vtkImageData* withoutT = vtkImageData::SafeDownCast(
+    vtkMultiPieceDataSet::SafeDownCast(adios2Reader->GetOutput()->GetBlock(0))->GetPiece(rank));
+  if (withoutT->GetCellData()->GetArray("T"))
+  {
+    std::cerr << "ERROR: disabled cell data array T was read\n";
+    return EXIT_FAILURE;
+  }
+  cellSelection->EnableArray("T");
+  adios2Reader->Update();
+  mp = vtkMultiPieceDataSet::SafeDownCast(adios2Reader->GetOutput()->GetBlock(0));
+  imageData = vtkImageData::SafeDownCast(mp->GetPiece(rank));
+
   // set color table
   vtkSmartPointer<vtkLookupTable> lookupTable = vtkSmartPointer<vtkLookupTable>::New();
   lookupTable->SetNumberOfTableValues(10);
@@ -30,11 +30,25 @@
 
 #include "common/VTXHelper.h"
 
+#include "vtkNew.h"
+
+#include <stdexcept>
+
 namespace vtx
 {
 VTK_ABI_NAMESPACE_BEGIN
 
 // PUBLIC
+VTXSchemaManager::~VTXSchemaManager()
+{
+  if (this->Prefetcher.joinable())
+  {
+    this->StopPrefetch = true;
+    this->Prefetcher.join();
+    this->Engine.Close();
+  }
+}
+
 void VTXSchemaManager::Update(
   const std::string& streamName, size_t /*step*/, const std::string& schemaName)
 {
@@ -50,10 +64,30 @@ void VTXSchemaManager::Update(
     this->SchemaName = schemaName;
 
     const std::string fileName = helper::GetFileName(this->StreamName);
+    this->Streaming = helper::EndsWith(this->StreamName, ".sst");
     this->IO = this->ADIOS->DeclareIO(fileName);
-    this->IO.SetEngine(helper::GetEngineType(fileName));
+    this->IO.SetEngine(this->Streaming ? "SST" : helper::GetEngineType(fileName));
     this->Engine = this->IO.Open(fileName, adios2::Mode::Read);
+
+    // the schema of a stream is only available within a step: wait for the first one
+    if (this->Streaming && this->Engine.BeginStep() != adios2::StepStatus::OK)
+    {
+      throw std::runtime_error("ERROR: no step available in stream " + fileName + "\n");
+    }
     InitReader();
+
+    for (const auto type : { types::DataSetType::PointData, types::DataSetType::CellData })
+    {
+      this->ArrayNames[type] = this->Reader->GetArrayNames(type);
+    }
+
+    if (this->Streaming)
+    {
+      this->Current = ReadStep();
+      this->Time = this->Current.Time;
+      this->Step = this->Current.Step;
+      this->Prefetcher = std::thread(&VTXSchemaManager::Prefetch, this);
+    }
   }
   else
   {
@@ -63,10 +97,120 @@ void VTXSchemaManager::Update(
 
 void VTXSchemaManager::Fill(vtkMultiBlockDataSet* multiBlock, size_t step)
 {
+  if (this->Streaming)
+  {
+    // the schema belongs to the prefetch thread, deliver the current step
+    if (this->Current.Data)
+    {
+      multiBlock->ShallowCopy(this->Current.Data);
+    }
+    return;
+  }
+
+  this->Reader->DisabledArrays = this->DisabledArrays;
   this->Reader->Fill(multiBlock, step);
 }
 
+void VTXSchemaManager::SetDisabledArrays(
+  const std::map<types::DataSetType, std::set<std::string>>& disabled)
+{
+  std::lock_guard<std::mutex> lock(this->StepsMutex);
+  this->DisabledArrays = disabled;
+}
+
+bool VTXSchemaManager::NextStep()
+{
+  std::lock_guard<std::mutex> lock(this->StepsMutex);
+  if (!this->PrefetchError.empty())
+  {
+    const std::string error = this->PrefetchError;
+    this->PrefetchError.clear();
+    throw std::runtime_error(error);
+  }
+  if (!this->HasNext)
+  {
+    return false;
+  }
+
+  this->Current = this->Next;
+  this->Next = StagedStep();
+  this->HasNext = false;
+  this->Time = this->Current.Time;
+  this->Step = this->Current.Step;
+  return true;
+}
+
+bool VTXSchemaManager::IsEndOfStream()
+{
+  std::lock_guard<std::mutex> lock(this->StepsMutex);
+  return this->EndOfStream && !this->HasNext;
+}
+
+std::vector<std::string> VTXSchemaManager::GetArrayNames(const types::DataSetType type) const
+{
+  auto itNames = this->ArrayNames.find(type);
+  return itNames != this->ArrayNames.end() ? itNames->second : std::vector<std::string>();
+}
+
 // PRIVATE
+VTXSchemaManager::StagedStep VTXSchemaManager::ReadStep()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->StepsMutex);
+    this->Reader->DisabledArrays = this->DisabledArrays;
+  }
+
+  StagedStep staged;
+  staged.Step = this->Engine.CurrentStep();
+  staged.Time = this->Reader->GetCurrentTime();
+  vtkNew<vtkMultiBlockDataSet> multiBlock;
+  this->Reader->Fill(multiBlock, staged.Step);
+  // release the step as soon as it is read, so that writers can go on
+  this->Engine.EndStep();
+
+  // the schema reuses its data sets from step to step, keep copies of them
+  staged.Data = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  staged.Data->ShallowCopy(multiBlock);
+  return staged;
+}
+
+void VTXSchemaManager::Prefetch()
+{
+  // BeginStep does not block longer than this, to notice StopPrefetch
+  constexpr float timeoutSeconds = 0.1f;
+
+  try
+  {
+    while (!this->StopPrefetch)
+    {
+      const adios2::StepStatus status =
+        this->Engine.BeginStep(adios2::StepMode::Read, timeoutSeconds);
+      if (status == adios2::StepStatus::NotReady)
+      {
+        continue;
+      }
+      if (status != adios2::StepStatus::OK)
+      {
+        break;
+      }
+
+      StagedStep staged = ReadStep();
+      std::lock_guard<std::mutex> lock(this->StepsMutex);
+      // an older step not consumed yet is dropped
+      this->Next = staged;
+      this->HasNext = true;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::lock_guard<std::mutex> lock(this->StepsMutex);
+    this->PrefetchError = e.what();
+  }
+
+  std::lock_guard<std::mutex> lock(this->StepsMutex);
+  this->EndOfStream = true;
+}
+
 const std::set<std::string> VTXSchemaManager::SupportedTypes = { "ImageData", "UnstructuredGrid" };
 // TODO: , "StructuredGrid", "PolyData" };
 
@@ -24,11 +24,17 @@
 #ifndef VTK_IO_ADIOS2_VTX_VTXSchemaManager_H_
 #define VTK_IO_ADIOS2_VTX_VTXSchemaManager_H_
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "vtkMultiBlockDataSet.h"
+#include "vtkSmartPointer.h"
 
 #include "schema/VTXSchema.h"
 #include <adios2.h>
@@ -49,7 +55,7 @@ public:
   std::unique_ptr<VTXSchema> Reader;
 
   VTXSchemaManager() = default;
-  ~VTXSchemaManager() = default;
+  ~VTXSchemaManager();
 
   /**
    * Updates metadata if stream is changed
@@ -68,6 +74,32 @@ public:
    */
   void Fill(vtkMultiBlockDataSet* multiblock, size_t step = 0);
 
+  /**
+   * Set the names of the arrays not to read, per data set type. With a
+   * staging engine, they apply to the steps prefetched afterwards.
+   */
+  void SetDisabledArrays(const std::map<types::DataSetType, std::set<std::string>>& disabled);
+
+  /**
+   * True when reading from a staging engine (SST): steps are then prefetched
+   * in a worker thread, and Fill delivers the most recent one without waiting
+   * for the writers.
+   */
+  bool IsStreaming() const noexcept { return this->Streaming; }
+
+  /**
+   * With a staging engine, makes the most recent prefetched step, if any, the
+   * current one, its time in Time. Never blocks.
+   * @return true if a new step was made current
+   */
+  bool NextStep();
+
+  /** With a staging engine, true once the writers closed the stream */
+  bool IsEndOfStream();
+
+  /** Names of the arrays of a data set type (PointData, CellData) */
+  std::vector<std::string> GetArrayNames(types::DataSetType type) const;
+
 private:
   /** Current stream name */
   std::string StreamName;
@@ -86,6 +118,43 @@ private:
 
   static const std::set<std::string> SupportedTypes;
 
+  /** a step read from a staging engine */
+  struct StagedStep
+  {
+    double Time = 0.;
+    size_t Step = 0;
+    vtkSmartPointer<vtkMultiBlockDataSet> Data;
+  };
+
+  /** true if Engine is a staging engine */
+  bool Streaming = false;
+
+  /** array names, computed once as the schema is not thread safe */
+  std::map<types::DataSetType, std::vector<std::string>> ArrayNames;
+
+  /**
+   * Double buffer of staging engine steps: Current is delivered by Fill, Next
+   * is the most recent step read by the prefetch thread, replaced by newer
+   * steps until consumed so that writers never wait for the visualization.
+   */
+  StagedStep Current;
+  StagedStep Next;
+  bool HasNext = false;
+  bool EndOfStream = false;
+  std::string PrefetchError;
+  std::map<types::DataSetType, std::set<std::string>> DisabledArrays;
+  /** guards Next, HasNext, EndOfStream, PrefetchError and DisabledArrays */
+  std::mutex StepsMutex;
+
+  std::thread Prefetcher;
+  std::atomic<bool> StopPrefetch{ false };
+
+  /** Reads the current step of the staging engine, between BeginStep and EndStep */
+  StagedStep ReadStep();
+
+  /** Prefetch thread loop, reading steps until the end of the stream */
+  void Prefetch();
+
   /** we can extend this to add more schemas */
   void InitReader();
 
@@ -344,8 +344,10 @@ vtkSmartPointer<vtkIdTypeArray> NewDataArrayIdType()
 
 std::string GetFileName(const std::string& fileName) noexcept
 {
-  std::string output =
-    EndsWith(fileName, ".bp.dir") ? fileName.substr(0, fileName.size() - 4) : fileName;
+  // foo.sst is the contact file written by SST writers of the foo stream
+  std::string output = EndsWith(fileName, ".bp.dir") || EndsWith(fileName, ".sst")
+    ? fileName.substr(0, fileName.size() - 4)
+    : fileName;
   return output;
 }
 
@@ -355,6 +357,11 @@ std::string GetEngineType(const std::string& fileName) noexcept
   return engineType;
 }
 
+bool IsStagingEngine(const std::string& engineType) noexcept
+{
+  return vtksys::SystemTools::LowerCase(engineType) == "sst";
+}
+
 bool EndsWith(const std::string& input, const std::string& ends) noexcept
 {
   if (input.length() >= ends.length())
@@ -209,6 +209,14 @@ std::string GetFileName(const std::string& fileName) noexcept;
  */
 std::string GetEngineType(const std::string& fileName) noexcept;
 
+/**
+ * Check if the engine type streams the steps of a staging engine, e.g. SST,
+ * in which case steps are only available between BeginStep and EndStep
+ * @param engineType adios2 engine type
+ * @return true: staging engine, false: file engine
+ */
+bool IsStagingEngine(const std::string& engineType) noexcept;
+
 /**
  * Check if input ends with a certain (ends) string
  * @param input string input
@@ -35,6 +35,7 @@ VTXSchema::VTXSchema(
   , Schema(schema)
   , IO(io)
   , Engine(engine)
+  , Streaming(helper::IsStagingEngine(io.EngineType()))
 {
 }
 
@@ -45,9 +46,32 @@ void VTXSchema::Fill(vtkMultiBlockDataSet* multiBlock, size_t step)
   DoFill(multiBlock, step);
 }
 
+double VTXSchema::GetCurrentTime()
+{
+  const std::string type =
+    this->TimeVariable.empty() ? std::string() : this->IO.VariableType(this->TimeVariable);
+
+  if (type.empty())
+  {
+  }
+#define declare_type(T)                                                                            \
+  else if (type == adios2::GetType<T>()) { return GetCurrentTimeCommon<T>(); }
+  VTK_IO_ADIOS2_VTX_ARRAY_TYPE(declare_type)
+#undef declare_type
+
+  return static_cast<double>(this->Engine.CurrentStep());
+}
+
 // PROTECTED
 void VTXSchema::GetTimes(const std::string& variableName)
 {
+  if (this->Streaming)
+  {
+    // only the current step is known, its time is read at each step
+    this->TimeVariable = variableName;
+    return;
+  }
+
   if (variableName.empty())
   {
     // set default steps as "timesteps"
@@ -25,7 +25,9 @@
 #define VTK_IO_ADIOS2_VTX_SCHEMA_VTXSchema_h
 
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "vtkMultiBlockDataSet.h"
 
@@ -58,6 +60,11 @@ public:
    */
   std::map<double, size_t> Times;
 
+  /**
+   * Names of the arrays not to read, per data set type (PointData, CellData)
+   */
+  std::map<types::DataSetType, std::set<std::string>> DisabledArrays;
+
   /**
    * Generic base constructor
    * @param type from derived class
@@ -78,10 +85,29 @@ public:
    */
   void Fill(vtkMultiBlockDataSet* multiBlock, size_t step = 0);
 
+  /**
+   * Names of the arrays of a data set type, e.g. PointData, that can be read
+   * @param type input data set type
+   */
+  virtual std::vector<std::string> GetArrayNames(types::DataSetType type) const = 0;
+
+  /**
+   * Physical time of the current step of a staging engine, read from the time
+   * variable if any, the step otherwise. Must be called between BeginStep and
+   * EndStep.
+   */
+  double GetCurrentTime();
+
 protected:
   adios2::IO& IO;
   adios2::Engine& Engine;
 
+  /** true for staging engines, which only expose the current step */
+  const bool Streaming;
+
+  /** time variable of staging engines, read at each step */
+  std::string TimeVariable;
+
   virtual void Init() = 0;
   virtual void InitTimes() = 0;
 
@@ -116,6 +142,9 @@ private:
   template <class T>
   void GetTimesCommon(const std::string& variableName);
 
+  template <class T>
+  double GetCurrentTimeCommon();
+
   template <class T>
   void InitDataArray(
     const std::string& name, size_t elements, size_t components, types::DataArray& dataArray);
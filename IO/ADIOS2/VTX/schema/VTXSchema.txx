@@ -48,7 +48,7 @@ void VTXSchema::GetDataArrayCommon(
       return;
     }
   }
-  else
+  else if (!this->Streaming)
   {
     variable.SetStepSelection({ step, 1 });
   }
@@ -168,6 +168,15 @@ void VTXSchema::GetTimesCommon(const std::string& variableName)
   }
 }
 
+template <class T>
+double VTXSchema::GetCurrentTimeCommon()
+{
+  adios2::Variable<T> varTime = this->IO.InquireVariable<T>(this->TimeVariable);
+  T timeValue = T();
+  this->Engine.Get(varTime, timeValue, adios2::Mode::Sync);
+  return static_cast<double>(timeValue);
+}
+
 VTK_ABI_NAMESPACE_END
 } // end namespace vtx
 
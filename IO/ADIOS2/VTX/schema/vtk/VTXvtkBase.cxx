@@ -24,6 +24,8 @@
 
 #include <adios2.h>
 
+#include <algorithm>
+
 namespace vtx
 {
 namespace schema
@@ -49,11 +51,35 @@ VTXvtkBase::VTXvtkBase(
 
 VTXvtkBase::~VTXvtkBase() = default;
 
+std::vector<std::string> VTXvtkBase::GetArrayNames(const types::DataSetType type) const
+{
+  std::vector<std::string> names;
+  for (const types::Piece& piece : this->Pieces)
+  {
+    auto itDataSet = piece.find(type);
+    if (itDataSet == piece.end())
+    {
+      continue;
+    }
+    for (const auto& dataArrayPair : itDataSet->second)
+    {
+      const std::string& variableName = dataArrayPair.first;
+      if (VTXvtkBase::TIMENames.count(variableName) == 0 &&
+        std::find(names.begin(), names.end(), variableName) == names.end())
+      {
+        names.push_back(variableName);
+      }
+    }
+  }
+  return names;
+}
+
 bool VTXvtkBase::ReadDataSets(const types::DataSetType type, size_t step, size_t pieceID)
 {
   types::Piece& piece = this->Pieces.at(pieceID);
   types::DataSet& dataSet = piece.at(type);
 
+  auto itDisabled = this->DisabledArrays.find(type);
   for (auto& dataArrayPair : dataSet)
   {
     const std::string& variableName = dataArrayPair.first;
@@ -62,6 +88,13 @@ bool VTXvtkBase::ReadDataSets(const types::DataSetType type, size_t step, size_t
     {
       continue;
     }
+    if (itDisabled != this->DisabledArrays.end() && itDisabled->second.count(variableName) == 1)
+    {
+      // not read, and removed from the output
+      dataArray.IsUpdated = false;
+      dataArray.Data = nullptr;
+      continue;
+    }
     GetDataArray(variableName, dataArray, step);
   }
   return true;
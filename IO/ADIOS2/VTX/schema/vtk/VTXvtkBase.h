@@ -49,6 +49,8 @@ public:
   // can't use = default, due to forward class not defined
   ~VTXvtkBase() override;
 
+  std::vector<std::string> GetArrayNames(types::DataSetType type) const override;
+
 protected:
   std::vector<types::Piece> Pieces;
 
@@ -84,6 +84,12 @@ void VTXvtkVTI::ReadPiece(size_t step, size_t pieceID)
       }
 
       types::DataArray& dataArray = dataArrayPair.second;
+      if (!dataArray.Data)
+      {
+        // disabled
+        this->ImageData->GetCellData()->RemoveArray(variableName.c_str());
+        continue;
+      }
       this->ImageData->GetCellData()->AddArray(dataArray.Data.GetPointer());
     }
   }
@@ -100,6 +106,12 @@ void VTXvtkVTI::ReadPiece(size_t step, size_t pieceID)
         continue;
       }
       types::DataArray& dataArray = dataArrayPair.second;
+      if (!dataArray.Data)
+      {
+        // disabled
+        this->ImageData->GetPointData()->RemoveArray(variableName.c_str());
+        continue;
+      }
       this->ImageData->GetPointData()->AddArray(dataArray.Data.GetPointer());
     }
   }
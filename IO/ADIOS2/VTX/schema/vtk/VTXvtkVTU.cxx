@@ -103,6 +103,11 @@ void VTXvtkVTU::ReadPiece(size_t step, size_t pieceID)
         {
           this->UnstructuredGrid->GetCellData()->AddArray(dataArray.Data.GetPointer());
         }
+        else if (!dataArray.Data)
+        {
+          // disabled
+          this->UnstructuredGrid->GetCellData()->RemoveArray(dataArrayPair.first.c_str());
+        }
       }
     }
   }
@@ -122,6 +127,11 @@ void VTXvtkVTU::ReadPiece(size_t step, size_t pieceID)
       {
         this->UnstructuredGrid->GetPointData()->AddArray(dataArray.Data.GetPointer());
       }
+      else if (!dataArray.Data)
+      {
+        // disabled
+        this->UnstructuredGrid->GetPointData()->RemoveArray(variableName.c_str());
+      }
     }
   }
 
@@ -25,6 +25,7 @@
 #include "VTX/VTXSchemaManager.h"
 #include "VTX/common/VTXHelper.h"
 
+#include "vtkDataArraySelection.h"
 #include "vtkIndent.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -32,6 +33,28 @@
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
+#include <set>
+#include <string>
+
+namespace
+{
+VTK_ABI_NAMESPACE_BEGIN
+std::set<std::string> GetDisabledArrays(vtkDataArraySelection* selection)
+{
+  std::set<std::string> disabled;
+  for (int i = 0; i < selection->GetNumberOfArrays(); ++i)
+  {
+    if (!selection->GetArraySetting(i))
+    {
+      disabled.insert(selection->GetArrayName(i));
+    }
+  }
+  return disabled;
+}
+VTK_ABI_NAMESPACE_END
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkADIOS2VTXReader);
 
@@ -53,11 +76,30 @@ int vtkADIOS2VTXReader::RequestInformation(vtkInformation* vtkNotUsed(inputVecto
 {
   this->SchemaManager->Update(FileName); // check if FileName changed
 
+  for (const std::string& name :
+    this->SchemaManager->GetArrayNames(vtx::types::DataSetType::PointData))
+  {
+    this->PointDataArraySelection->AddArray(name.c_str());
+  }
+  for (const std::string& name :
+    this->SchemaManager->GetArrayNames(vtx::types::DataSetType::CellData))
+  {
+    this->CellDataArraySelection->AddArray(name.c_str());
+  }
+
+  vtkInformation* info = outputVector->GetInformationObject(0);
+  if (this->SchemaManager->IsStreaming())
+  {
+    // only the current step of a stream is known
+    info->Remove(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    info->Remove(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+    return 1;
+  }
+
   // set time info
   const std::vector<double> vTimes =
     vtx::helper::MapKeysToVector(this->SchemaManager->Reader->Times);
 
-  vtkInformation* info = outputVector->GetInformationObject(0);
   info->Set(
     vtkStreamingDemandDrivenPipeline::TIME_STEPS(), vTimes.data(), static_cast<int>(vTimes.size()));
 
@@ -71,6 +113,12 @@ int vtkADIOS2VTXReader::RequestInformation(vtkInformation* vtkNotUsed(inputVecto
 int vtkADIOS2VTXReader::RequestUpdateExtent(
   vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
 {
+  if (this->SchemaManager->IsStreaming())
+  {
+    // the current step is changed by AdvanceStep
+    return 1;
+  }
+
   vtkInformation* info = outputVector->GetInformationObject(0);
   const double newTime = info->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
   this->SchemaManager->Step = this->SchemaManager->Reader->Times[newTime];
@@ -85,14 +133,53 @@ int vtkADIOS2VTXReader::RequestData(vtkInformation* vtkNotUsed(inputVector),
   vtkDataObject* output = info->Get(vtkDataObject::DATA_OBJECT());
   vtkMultiBlockDataSet* multiBlock = vtkMultiBlockDataSet::SafeDownCast(output);
 
+  this->SchemaManager->SetDisabledArrays(
+    { { vtx::types::DataSetType::PointData, ::GetDisabledArrays(this->PointDataArraySelection) },
+      { vtx::types::DataSetType::CellData, ::GetDisabledArrays(this->CellDataArraySelection) } });
+
   output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), this->SchemaManager->Time);
   this->SchemaManager->Fill(multiBlock, this->SchemaManager->Step);
   return 1;
 }
 
+vtkDataArraySelection* vtkADIOS2VTXReader::GetPointDataArraySelection()
+{
+  return this->PointDataArraySelection;
+}
+
+vtkDataArraySelection* vtkADIOS2VTXReader::GetCellDataArraySelection()
+{
+  return this->CellDataArraySelection;
+}
+
+bool vtkADIOS2VTXReader::AdvanceStep()
+{
+  if (!this->SchemaManager->IsStreaming() || !this->SchemaManager->NextStep())
+  {
+    return false;
+  }
+  this->Modified();
+  return true;
+}
+
+bool vtkADIOS2VTXReader::IsEndOfStream()
+{
+  return this->SchemaManager->IsStreaming() && this->SchemaManager->IsEndOfStream();
+}
+
+vtkMTimeType vtkADIOS2VTXReader::GetMTime()
+{
+  return std::max({ this->Superclass::GetMTime(), this->PointDataArraySelection->GetMTime(),
+    this->CellDataArraySelection->GetMTime() });
+}
+
 void vtkADIOS2VTXReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "File Name: " << (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "PointDataArraySelection:\n";
+  this->PointDataArraySelection->PrintSelf(os, indent.GetNextIndent());
+  os << indent << "CellDataArraySelection:\n";
+  this->CellDataArraySelection->PrintSelf(os, indent.GetNextIndent());
 }
 VTK_ABI_NAMESPACE_END
@@ -19,6 +19,16 @@
  *                     VTK ADIOS2 Readers (VTX) developed
  *                     at Oak Ridge National Laboratory
  *
+ *  A FileName ending with .sst, the contact file written by SST writers,
+ *  reads the stream of the SST staging engine instead. Its steps are
+ *  prefetched in a worker thread as soon as the writers publish them, and
+ *  released right away, so that the writers never wait for the
+ *  visualization. The first step is waited for while updating the
+ *  information. Then the output is the current step, the most recent
+ *  prefetched one becoming current with AdvanceStep(). Its time is set as
+ *  DATA_TIME_STEP, no TIME_STEPS are reported. With MPI, the prefetch thread
+ *  communicates, which requires MPI_THREAD_MULTIPLE.
+ *
  *  Created on: May 1, 2019
  *      Author: William F Godoy godoywf@ornl.gov
  */
@@ -30,6 +40,7 @@
 
 #include "vtkIOADIOS2Module.h" // For export macro
 #include "vtkMultiBlockDataSetAlgorithm.h"
+#include "vtkNew.h" // For vtkNew
 
 // forward declaring to keep it private
 namespace vtx
@@ -41,6 +52,7 @@ VTK_ABI_NAMESPACE_END
 
 VTK_ABI_NAMESPACE_BEGIN
 
+class vtkDataArraySelection;
 class vtkIndent;
 class vtkInformation;
 class vtkInformationvector;
@@ -55,6 +67,31 @@ public:
   vtkSetFilePathMacro(FileName);
   vtkGetFilePathMacro(FileName);
 
+  ///@{
+  /**
+   * Selections of the point and cell data arrays to read, filled when
+   * updating the information. All arrays are enabled by default. With a
+   * staging engine, they apply to the steps prefetched afterwards.
+   */
+  vtkDataArraySelection* GetPointDataArraySelection();
+  vtkDataArraySelection* GetCellDataArraySelection();
+  ///@}
+
+  /**
+   * With a staging engine, makes the most recent prefetched step the output
+   * of the next update, and marks the reader modified. Never blocks.
+   * Returns false when no new step was prefetched since the last call.
+   */
+  bool AdvanceStep();
+
+  /**
+   * With a staging engine, returns true once the writers closed the stream
+   * and its last step was advanced to.
+   */
+  bool IsEndOfStream();
+
+  vtkMTimeType GetMTime() override;
+
 protected:
   vtkADIOS2VTXReader();
   ~vtkADIOS2VTXReader() override;
@@ -72,6 +109,8 @@ protected:
 private:
   char* FileName;
   std::unique_ptr<vtx::VTXSchemaManager> SchemaManager;
+  vtkNew<vtkDataArraySelection> PointDataArraySelection;
+  vtkNew<vtkDataArraySelection> CellDataArraySelection;
 };
 
 VTK_ABI_NAMESPACE_END
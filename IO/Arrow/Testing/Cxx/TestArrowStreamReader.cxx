@@ -0,0 +1,361 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestArrowStreamReader.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkArrowStreamReader reads the batches of a stream exported
+// through the Arrow C stream interface, sharing the numeric buffers.
+
+#include "vtkArrowCDataInterface.h"
+#include "vtkArrowStreamReader.h"
+#include "vtkArrowTableImporter.h"
+#include "vtkBitArray.h"
+#include "vtkDataArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationStringVectorKey.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+const int NumberOfBatches = 3;
+const int NumberOfRows = 10;
+int BatchesReleased = 0;
+
+// value of a row of a batch
+double GetValue(int batch, int row)
+{
+  return batch * 100 + row + 0.5;
+}
+
+// A batch holding its buffers, exported as the private data of its array.
+struct Batch
+{
+  std::vector<double> X;
+  std::vector<int32_t> Ids;
+  std::vector<uint8_t> IdsValidity;
+  std::vector<float> Points;
+  std::vector<int32_t> NameOffsets;
+  std::string Names;
+  std::vector<int8_t> Kinds;
+  std::vector<int32_t> KindOffsets;
+  std::string KindChars;
+  std::vector<uint8_t> Flags;
+
+  std::vector<ArrowArray> Columns;
+  ArrowArray PointValues;
+  ArrowArray Dictionary;
+  std::vector<ArrowArray*> Children;
+  ArrowArray* PointChildren[1];
+  std::vector<std::vector<const void*>> Buffers;
+};
+
+void ReleaseChild(ArrowArray* array)
+{
+  array->release = nullptr;
+}
+
+void ReleaseBatch(ArrowArray* array)
+{
+  delete static_cast<Batch*>(array->private_data);
+  array->release = nullptr;
+  ++BatchesReleased;
+}
+
+ArrowArray MakeArray(int64_t length, int64_t nullCount, int64_t offset,
+  std::vector<const void*>& buffers, int64_t numChildren = 0, ArrowArray** children = nullptr)
+{
+  ArrowArray array;
+  array.length = length;
+  array.null_count = nullCount;
+  array.offset = offset;
+  array.n_buffers = static_cast<int64_t>(buffers.size());
+  array.buffers = buffers.data();
+  array.n_children = numChildren;
+  array.children = children;
+  array.dictionary = nullptr;
+  array.release = ReleaseChild;
+  array.private_data = nullptr;
+  return array;
+}
+
+void MakeBatch(int b, ArrowArray* out)
+{
+  Batch* batch = new Batch;
+  const int n = NumberOfRows;
+  // x has an offset of 1 into its buffer
+  batch->X.push_back(-1);
+  batch->IdsValidity.resize(2, 0);
+  batch->Flags.resize(2, 0);
+  batch->NameOffsets.push_back(0);
+  for (int i = 0; i < n; ++i)
+  {
+    batch->X.push_back(GetValue(b, i));
+    batch->Ids.push_back(b * 1000 + i);
+    if (i % 3 != 0)
+    {
+      batch->IdsValidity[i / 8] |= 1 << (i % 8);
+    }
+    for (int c = 0; c < 3; ++c)
+    {
+      batch->Points.push_back(static_cast<float>(GetValue(b, i) + c));
+    }
+    batch->Names += "row" + std::to_string(i);
+    batch->NameOffsets.push_back(static_cast<int32_t>(batch->Names.size()));
+    batch->Kinds.push_back(static_cast<int8_t>((i + b) % 3));
+    if (i % 2)
+    {
+      batch->Flags[i / 8] |= 1 << (i % 8);
+    }
+  }
+  batch->KindChars = "redgreenblue";
+  batch->KindOffsets = { 0, 3, 8, 12 };
+
+  batch->Buffers = { { nullptr, batch->X.data() }, { batch->IdsValidity.data(), batch->Ids.data() },
+    { nullptr }, { nullptr, batch->Points.data() },
+    { nullptr, batch->NameOffsets.data(), batch->Names.data() }, { nullptr, batch->Kinds.data() },
+    { nullptr, batch->KindOffsets.data(), batch->KindChars.data() },
+    { nullptr, batch->Flags.data() }, { nullptr } };
+  auto& buffers = batch->Buffers;
+
+  batch->PointValues = MakeArray(3 * n, 0, 0, buffers[3]);
+  batch->PointChildren[0] = &batch->PointValues;
+  batch->Dictionary = MakeArray(3, 0, 0, buffers[6]);
+  batch->Columns.push_back(MakeArray(n, 0, 1, buffers[0]));
+  batch->Columns.push_back(MakeArray(n, (n + 2) / 3, 0, buffers[1]));
+  batch->Columns.push_back(MakeArray(n, 0, 0, buffers[2], 1, batch->PointChildren));
+  batch->Columns.push_back(MakeArray(n, 0, 0, buffers[4]));
+  batch->Columns.push_back(MakeArray(n, 0, 0, buffers[5]));
+  batch->Columns.back().dictionary = &batch->Dictionary;
+  batch->Columns.push_back(MakeArray(n, 0, 0, buffers[7]));
+  for (auto& column : batch->Columns)
+  {
+    batch->Children.push_back(&column);
+  }
+
+  *out = MakeArray(
+    n, 0, 0, buffers[8], static_cast<int64_t>(batch->Children.size()), batch->Children.data());
+  out->release = ReleaseBatch;
+  out->private_data = batch;
+}
+
+// The schema of the batches, with its storage.
+struct Schema
+{
+  std::vector<ArrowSchema> Fields;
+  std::vector<ArrowSchema*> Children;
+  ArrowSchema PointValues;
+  ArrowSchema* PointChildren[1];
+  ArrowSchema Dictionary;
+};
+
+ArrowSchema MakeSchema(const char* format, const char* name)
+{
+  ArrowSchema schema;
+  schema.format = format;
+  schema.name = name;
+  schema.metadata = nullptr;
+  schema.flags = ARROW_FLAG_NULLABLE;
+  schema.n_children = 0;
+  schema.children = nullptr;
+  schema.dictionary = nullptr;
+  schema.release = [](ArrowSchema* s) {
+    delete static_cast<Schema*>(s->private_data);
+    s->release = nullptr;
+  };
+  schema.private_data = nullptr;
+  return schema;
+}
+
+void MakeSchema(ArrowSchema* out)
+{
+  Schema* schema = new Schema;
+  schema->PointValues = MakeSchema("f", "item");
+  schema->PointChildren[0] = &schema->PointValues;
+  schema->Dictionary = MakeSchema("u", nullptr);
+  schema->Fields = { MakeSchema("g", "x"), MakeSchema("i", "id"), MakeSchema("+w:3", "point"),
+    MakeSchema("u", "name"), MakeSchema("c", "kind"), MakeSchema("b", "flag") };
+  schema->Fields[2].n_children = 1;
+  schema->Fields[2].children = schema->PointChildren;
+  schema->Fields[4].dictionary = &schema->Dictionary;
+  for (auto& field : schema->Fields)
+  {
+    schema->Children.push_back(&field);
+  }
+  *out = MakeSchema("+s", "");
+  out->n_children = static_cast<int64_t>(schema->Children.size());
+  out->children = schema->Children.data();
+  out->private_data = schema;
+}
+
+int StreamReleased = 0;
+struct Stream
+{
+  int NextBatch = 0;
+};
+
+ArrowArrayStream MakeStream()
+{
+  ArrowArrayStream stream;
+  stream.get_schema = [](ArrowArrayStream*, ArrowSchema* out) {
+    MakeSchema(out);
+    return 0;
+  };
+  stream.get_next = [](ArrowArrayStream* s, ArrowArray* out) {
+    Stream* state = static_cast<Stream*>(s->private_data);
+    if (state->NextBatch == NumberOfBatches)
+    {
+      out->release = nullptr;
+    }
+    else
+    {
+      MakeBatch(state->NextBatch++, out);
+    }
+    return 0;
+  };
+  stream.get_last_error = [](ArrowArrayStream*) -> const char* { return nullptr; };
+  stream.release = [](ArrowArrayStream* s) {
+    delete static_cast<Stream*>(s->private_data);
+    s->release = nullptr;
+    ++StreamReleased;
+  };
+  stream.private_data = new Stream;
+  return stream;
+}
+
+bool CheckTable(vtkTable* table, int b, bool decoded)
+{
+  if (table->GetNumberOfRows() != NumberOfRows || table->GetNumberOfColumns() != 6)
+  {
+    std::cerr << "Wrong table size for batch " << b << std::endl;
+    return false;
+  }
+  vtkDataArray* x = vtkDataArray::SafeDownCast(table->GetColumnByName("x"));
+  vtkDataArray* ids = vtkDataArray::SafeDownCast(table->GetColumnByName("id"));
+  vtkDataArray* points = vtkDataArray::SafeDownCast(table->GetColumnByName("point"));
+  vtkStringArray* names = vtkStringArray::SafeDownCast(table->GetColumnByName("name"));
+  vtkAbstractArray* kinds = table->GetColumnByName("kind");
+  vtkBitArray* flags = vtkBitArray::SafeDownCast(table->GetColumnByName("flag"));
+  if (!x || x->GetDataType() != VTK_DOUBLE || !ids || ids->GetDataType() != VTK_INT || !points ||
+    points->GetNumberOfComponents() != 3 || !names || !kinds || !flags)
+  {
+    std::cerr << "Wrong columns for batch " << b << std::endl;
+    return false;
+  }
+  const char* kindNames[] = { "red", "green", "blue" };
+  vtkStringArray* kindStrings = vtkStringArray::SafeDownCast(kinds);
+  vtkDataArray* kindIndices = vtkDataArray::SafeDownCast(kinds);
+  if (decoded ? !kindStrings
+              : !kindIndices ||
+        vtkArrowTableImporter::CATEGORIES()->Length(kinds->GetInformation()) != 3 ||
+        vtkArrowTableImporter::CATEGORIES()->Get(kinds->GetInformation(), 1) !=
+          std::string("green"))
+  {
+    std::cerr << "Wrong categorical column for batch " << b << std::endl;
+    return false;
+  }
+  for (int i = 0; i < NumberOfRows; ++i)
+  {
+    const int kind = (i + b) % 3;
+    if (x->GetComponent(i, 0) != GetValue(b, i) ||
+      ids->GetComponent(i, 0) != (i % 3 ? b * 1000 + i : 0) ||
+      points->GetComponent(i, 2) != static_cast<float>(GetValue(b, i) + 2) ||
+      names->GetValue(i) != "row" + std::to_string(i) || flags->GetValue(i) != i % 2 ||
+      (decoded ? kindStrings->GetValue(i) != kindNames[kind]
+               : kindIndices->GetComponent(i, 0) != kind))
+    {
+      std::cerr << "Wrong values at row " << i << " of batch " << b << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestArrowStreamReader(int, char*[])
+{
+  // the numeric columns share the buffers of the batch, which is released
+  // with the last of them
+  vtkSmartPointer<vtkDataArray> x;
+  {
+    ArrowSchema schema;
+    MakeSchema(&schema);
+    ArrowArray batch;
+    MakeBatch(0, &batch);
+    const double* values = static_cast<const double*>(batch.children[0]->buffers[1]) + 1;
+    vtkNew<vtkTable> table;
+    vtkNew<vtkArrowTableImporter> importer;
+    if (!importer->Import(&schema, &batch, table) || batch.release || !CheckTable(table, 0, false))
+    {
+      std::cerr << "Cannot import a batch" << std::endl;
+      return EXIT_FAILURE;
+    }
+    schema.release(&schema);
+    x = vtkDataArray::SafeDownCast(table->GetColumnByName("x"));
+    if (x->GetVoidPointer(0) != values)
+    {
+      std::cerr << "The numeric column was copied" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (BatchesReleased != 0)
+  {
+    std::cerr << "The batch was released with a column in use" << std::endl;
+    return EXIT_FAILURE;
+  }
+  x = nullptr;
+  if (BatchesReleased != 1)
+  {
+    std::cerr << "The batch was not released with its columns" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // a batch per execution, until the end of the stream
+  for (bool decoded : { false, true })
+  {
+    BatchesReleased = 0;
+    vtkNew<vtkArrowStreamReader> reader;
+    reader->SetDecodeDictionaries(decoded);
+    ArrowArrayStream stream = MakeStream();
+    reader->SetStream(&stream);
+    int b = 0;
+    while (reader->ReadNextBatch())
+    {
+      if (!CheckTable(reader->GetOutput(), b++, decoded))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+    if (b != NumberOfBatches || reader->GetNumberOfBatchesRead() != NumberOfBatches ||
+      !reader->GetEndOfStream() || reader->GetOutput()->GetNumberOfColumns() != 0 ||
+      BatchesReleased != NumberOfBatches)
+    {
+      std::cerr << "Wrong number of batches read: " << b << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (StreamReleased != 2)
+  {
+    std::cerr << "The streams were not released" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
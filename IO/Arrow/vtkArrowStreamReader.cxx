@@ -0,0 +1,168 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkArrowStreamReader.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkArrowStreamReader.h"
+
+#include "vtkArrowCDataInterface.h"
+#include "vtkArrowTableImporter.h"
+#include "vtkExecutive.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkTable.h"
+
+#include <cstdint>
+
+VTK_ABI_NAMESPACE_BEGIN
+struct vtkArrowStreamReader::vtkInternals
+{
+  ArrowArrayStream Stream;
+  ArrowSchema Schema;
+
+  vtkInternals()
+  {
+    this->Stream.release = nullptr;
+    this->Schema.release = nullptr;
+  }
+};
+
+vtkStandardNewMacro(vtkArrowStreamReader);
+
+//------------------------------------------------------------------------------
+vtkArrowStreamReader::vtkArrowStreamReader()
+  : EndOfStream(false)
+  , NumberOfBatchesRead(0)
+  , Importer(vtkArrowTableImporter::New())
+  , Internals(new vtkInternals)
+{
+  this->SetNumberOfInputPorts(0);
+}
+
+//------------------------------------------------------------------------------
+vtkArrowStreamReader::~vtkArrowStreamReader()
+{
+  this->ReleaseStream();
+  this->Importer->Delete();
+}
+
+//------------------------------------------------------------------------------
+void vtkArrowStreamReader::ReleaseStream()
+{
+  if (this->Internals->Schema.release)
+  {
+    this->Internals->Schema.release(&this->Internals->Schema);
+    this->Internals->Schema.release = nullptr;
+  }
+  if (this->Internals->Stream.release)
+  {
+    this->Internals->Stream.release(&this->Internals->Stream);
+    this->Internals->Stream.release = nullptr;
+  }
+  this->EndOfStream = false;
+  this->NumberOfBatchesRead = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkArrowStreamReader::SetStream(ArrowArrayStream* stream)
+{
+  this->ReleaseStream();
+  if (stream)
+  {
+    this->Internals->Stream = *stream;
+    stream->release = nullptr;
+  }
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt64 vtkArrowStreamReader::InitializeStream()
+{
+  this->ReleaseStream();
+  this->Modified();
+  return static_cast<vtkTypeUInt64>(reinterpret_cast<uintptr_t>(&this->Internals->Stream));
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowStreamReader::ReadNextBatch()
+{
+  this->Modified();
+  const bool status = this->GetExecutive()->Update() != 0;
+  return status && !this->EndOfStream;
+}
+
+//------------------------------------------------------------------------------
+void vtkArrowStreamReader::SetDecodeDictionaries(bool decode)
+{
+  if (this->Importer->GetDecodeDictionaries() != decode)
+  {
+    this->Importer->SetDecodeDictionaries(decode);
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowStreamReader::GetDecodeDictionaries()
+{
+  return this->Importer->GetDecodeDictionaries();
+}
+
+//------------------------------------------------------------------------------
+int vtkArrowStreamReader::RequestData(
+  vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
+{
+  vtkTable* output = vtkTable::GetData(outputVector);
+  output->Initialize();
+
+  ArrowArrayStream* stream = &this->Internals->Stream;
+  if (!stream->release)
+  {
+    vtkErrorMacro("No stream to read.");
+    return 0;
+  }
+  if (this->EndOfStream)
+  {
+    return 1;
+  }
+  if (!this->Internals->Schema.release && stream->get_schema(stream, &this->Internals->Schema))
+  {
+    vtkErrorMacro("Cannot get the schema of the stream: " << stream->get_last_error(stream));
+    this->Internals->Schema.release = nullptr;
+    return 0;
+  }
+
+  ArrowArray batch;
+  if (stream->get_next(stream, &batch))
+  {
+    vtkErrorMacro("Cannot read the next batch: " << stream->get_last_error(stream));
+    return 0;
+  }
+  if (!batch.release)
+  {
+    this->EndOfStream = true;
+    return 1;
+  }
+  ++this->NumberOfBatchesRead;
+  return this->Importer->Import(&this->Internals->Schema, &batch, output) ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkArrowStreamReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Stream: " << (this->Internals->Stream.release ? "set" : "none") << endl;
+  os << indent << "EndOfStream: " << this->EndOfStream << endl;
+  os << indent << "NumberOfBatchesRead: " << this->NumberOfBatchesRead << endl;
+  os << indent << "DecodeDictionaries: " << this->GetDecodeDictionaries() << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,124 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkArrowStreamReader.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkArrowStreamReader
+ * @brief   reads the record batches of an Arrow stream as tables
+ *
+ * vtkArrowStreamReader reads a stream of record batches exported through the
+ * Arrow C stream interface (see vtkArrowCDataInterface.h), one batch per
+ * execution: the output is the table of the next batch of the stream, made
+ * by vtkArrowTableImporter without copying the numeric columns, or an empty
+ * table at the end of the stream. ReadNextBatch() executes the reader again,
+ * so that large Parquet files, Arrow IPC streams or query results are
+ * processed a batch at a time.
+ *
+ * The stream comes from any Arrow implementation, the reader depending on
+ * none. From Python, with pyarrow:
+ *
+ * @code{.py}
+ * reader = vtkArrowStreamReader()
+ * batches = pyarrow.parquet.ParquetFile("data.parquet").iter_batches()
+ * pyarrow.RecordBatchReader.from_batches(schema, batches)._export_to_c(
+ *     reader.InitializeStream())
+ * while reader.ReadNextBatch():
+ *     process(reader.GetOutput())
+ * @endcode
+ *
+ * @sa
+ * vtkArrowTableImporter vtkTable
+ */
+
+#ifndef vtkArrowStreamReader_h
+#define vtkArrowStreamReader_h
+
+#include "vtkIOArrowModule.h" // For export macro
+#include "vtkTableAlgorithm.h"
+
+#include <memory> // For std::unique_ptr
+
+struct ArrowArrayStream;
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkArrowTableImporter;
+
+class VTKIOARROW_EXPORT vtkArrowStreamReader : public vtkTableAlgorithm
+{
+public:
+  static vtkArrowStreamReader* New();
+  vtkTypeMacro(vtkArrowStreamReader, vtkTableAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Read the batches of @a stream, which is moved into the reader and marked
+   * released when this returns. The current stream is released.
+   */
+  VTK_WRAPEXCLUDE void SetStream(ArrowArrayStream* stream);
+
+  /**
+   * Release the current stream and return the address of an empty
+   * ArrowArrayStream, for a producer to export the stream to read into, as
+   * with _export_to_c() in pyarrow.
+   */
+  vtkTypeUInt64 InitializeStream();
+
+  /**
+   * Read the next batch of the stream, same as Modified() then Update().
+   * Returns false at the end of the stream, or on error.
+   */
+  bool ReadNextBatch();
+
+  ///@{
+  /**
+   * Whether the last execution reached the end of the stream, and the number
+   * of batches read from the stream.
+   */
+  vtkGetMacro(EndOfStream, bool);
+  vtkGetMacro(NumberOfBatchesRead, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Whether the dictionary encoded strings are decoded into vtkStringArray
+   * instead of categorical arrays, see vtkArrowTableImporter. Default is
+   * false.
+   */
+  void SetDecodeDictionaries(bool decode);
+  bool GetDecodeDictionaries();
+  vtkBooleanMacro(DecodeDictionaries, bool);
+  ///@}
+
+protected:
+  vtkArrowStreamReader();
+  ~vtkArrowStreamReader() override;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  // Release the stream and its schema.
+  void ReleaseStream();
+
+  bool EndOfStream;
+  vtkIdType NumberOfBatchesRead;
+  vtkArrowTableImporter* Importer;
+
+private:
+  vtkArrowStreamReader(const vtkArrowStreamReader&) = delete;
+  void operator=(const vtkArrowStreamReader&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,365 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkArrowTableImporter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkArrowTableImporter.h"
+
+#include "vtkArrowCDataInterface.h"
+#include "vtkBitArray.h"
+#include "vtkDataArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationStringVectorKey.h"
+#include "vtkMemoryResource.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkTypeFloat32Array.h"
+#include "vtkTypeFloat64Array.h"
+#include "vtkTypeInt16Array.h"
+#include "vtkTypeInt32Array.h"
+#include "vtkTypeInt64Array.h"
+#include "vtkTypeInt8Array.h"
+#include "vtkTypeUInt16Array.h"
+#include "vtkTypeUInt32Array.h"
+#include "vtkTypeUInt64Array.h"
+#include "vtkTypeUInt8Array.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Owns a record batch for the arrays that use its buffers: they release
+// their memory with it, and the batch is released with the last of them.
+class vtkArrowBatchResource : public vtkMemoryResource
+{
+public:
+  static vtkArrowBatchResource* New();
+  vtkTypeMacro(vtkArrowBatchResource, vtkMemoryResource);
+
+  ArrowArray Batch;
+
+protected:
+  vtkArrowBatchResource() { this->Batch.release = nullptr; }
+  ~vtkArrowBatchResource() override
+  {
+    if (this->Batch.release)
+    {
+      this->Batch.release(&this->Batch);
+    }
+  }
+
+  // the memory belongs to the batch
+  void DeallocateMemory(void*, size_t) override {}
+
+private:
+  vtkArrowBatchResource(const vtkArrowBatchResource&) = delete;
+  void operator=(const vtkArrowBatchResource&) = delete;
+};
+vtkStandardNewMacro(vtkArrowBatchResource);
+
+bool HasNulls(const ArrowArray* array)
+{
+  // a null count of -1 is unknown
+  return array->null_count != 0 && array->n_buffers > 0 && array->buffers[0];
+}
+
+// whether the value at index, not counting the offset of array, is not null
+bool IsValid(const ArrowArray* array, int64_t index)
+{
+  if (array->n_buffers == 0 || !array->buffers[0])
+  {
+    return true;
+  }
+  const uint8_t* bitmap = static_cast<const uint8_t*>(array->buffers[0]);
+  const int64_t bit = array->offset + index;
+  return ((bitmap[bit >> 3] >> (bit & 7)) & 1) != 0;
+}
+
+// The values of tuples, held in the data buffer of values: tuples itself, or
+// the child of a fixed size list of numComps values.
+template <typename ArrayT>
+vtkSmartPointer<vtkAbstractArray> ImportValues(const ArrowArray* tuples,
+  const ArrowArray* values, int numComps, double nullValue, vtkMemoryResource* owner)
+{
+  using ValueType = typename ArrayT::ValueType;
+  auto result = vtkSmartPointer<ArrayT>::New();
+  result->SetNumberOfComponents(numComps);
+  if (values->n_buffers < 2 || (!values->buffers[1] && tuples->length > 0))
+  {
+    return nullptr;
+  }
+  // the first value of tuples, not counting the offset of values
+  const int64_t first = tuples != values ? tuples->offset * numComps : 0;
+  ValueType* data = static_cast<ValueType*>(const_cast<void*>(values->buffers[1]));
+  data += values->offset + first;
+  const vtkIdType numValues = tuples->length * numComps;
+  if (!HasNulls(values) && (tuples == values || !HasNulls(tuples)))
+  {
+    result->SetArrayFromResource(data, numValues, owner);
+    return result;
+  }
+
+  result->SetNumberOfTuples(tuples->length);
+  const ValueType null = std::numeric_limits<ValueType>::has_quiet_NaN
+    ? std::numeric_limits<ValueType>::quiet_NaN()
+    : static_cast<ValueType>(nullValue);
+  ValueType* out = result->GetPointer(0);
+  for (vtkIdType i = 0; i < numValues; ++i)
+  {
+    const bool valid =
+      IsValid(values, first + i) && (tuples == values || IsValid(tuples, i / numComps));
+    out[i] = valid ? data[i] : null;
+  }
+  return result;
+}
+
+vtkSmartPointer<vtkAbstractArray> ImportNumbers(const char* format, const ArrowArray* tuples,
+  const ArrowArray* values, int numComps, double nullValue, vtkMemoryResource* owner)
+{
+  // the formats of the Arrow C data interface stored as a single buffer of
+  // numbers: primitive types, dates, times, timestamps and durations
+  char type = format[0];
+  if (format[0] == 't' && format[1] != '\0')
+  {
+    switch (format[1])
+    {
+      case 'd': // date32 in days or date64 in milliseconds
+        type = format[2] == 'D' ? 'i' : 'l';
+        break;
+      case 't': // time32 in seconds or milliseconds, time64 otherwise
+        type = format[2] == 's' || format[2] == 'm' ? 'i' : 'l';
+        break;
+      case 's': // timestamp, with its time zone after the unit
+      case 'D': // duration
+        type = 'l';
+        break;
+      default:
+        return nullptr;
+    }
+  }
+  else if (format[0] == '\0' || format[1] != '\0')
+  {
+    return nullptr;
+  }
+
+  switch (type)
+  {
+    case 'c':
+      return ImportValues<vtkTypeInt8Array>(tuples, values, numComps, nullValue, owner);
+    case 'C':
+      return ImportValues<vtkTypeUInt8Array>(tuples, values, numComps, nullValue, owner);
+    case 's':
+      return ImportValues<vtkTypeInt16Array>(tuples, values, numComps, nullValue, owner);
+    case 'S':
+      return ImportValues<vtkTypeUInt16Array>(tuples, values, numComps, nullValue, owner);
+    case 'i':
+      return ImportValues<vtkTypeInt32Array>(tuples, values, numComps, nullValue, owner);
+    case 'I':
+      return ImportValues<vtkTypeUInt32Array>(tuples, values, numComps, nullValue, owner);
+    case 'l':
+      return ImportValues<vtkTypeInt64Array>(tuples, values, numComps, nullValue, owner);
+    case 'L':
+      return ImportValues<vtkTypeUInt64Array>(tuples, values, numComps, nullValue, owner);
+    case 'f':
+      return ImportValues<vtkTypeFloat32Array>(tuples, values, numComps, nullValue, owner);
+    case 'g':
+      return ImportValues<vtkTypeFloat64Array>(tuples, values, numComps, nullValue, owner);
+    default:
+      return nullptr;
+  }
+}
+
+// the string at index of a utf8 (int32 offsets) or large utf8 array
+template <typename OffsetType>
+std::string GetString(const ArrowArray* array, int64_t index)
+{
+  const OffsetType* offsets = static_cast<const OffsetType*>(array->buffers[1]) + array->offset;
+  const char* chars = static_cast<const char*>(array->buffers[2]);
+  return std::string(chars + offsets[index], chars + offsets[index + 1]);
+}
+
+bool IsString(const char* format)
+{
+  return (format[0] == 'u' || format[0] == 'U') && format[1] == '\0';
+}
+
+std::string GetString(const char* format, const ArrowArray* array, int64_t index)
+{
+  return format[0] == 'u' ? GetString<int32_t>(array, index) : GetString<int64_t>(array, index);
+}
+
+vtkSmartPointer<vtkAbstractArray> ImportStrings(const char* format, const ArrowArray* array)
+{
+  if (array->n_buffers < 3)
+  {
+    return nullptr;
+  }
+  vtkNew<vtkStringArray> result;
+  result->SetNumberOfValues(array->length);
+  for (int64_t i = 0; i < array->length; ++i)
+  {
+    if (IsValid(array, i))
+    {
+      result->SetValue(i, GetString(format, array, i));
+    }
+  }
+  return result;
+}
+
+vtkSmartPointer<vtkAbstractArray> ImportBooleans(const ArrowArray* array)
+{
+  if (array->n_buffers < 2 || (!array->buffers[1] && array->length > 0))
+  {
+    return nullptr;
+  }
+  // Arrow packs the bits from the least significant one, vtkBitArray from the
+  // most significant one
+  const uint8_t* bits = static_cast<const uint8_t*>(array->buffers[1]);
+  vtkNew<vtkBitArray> result;
+  result->SetNumberOfValues(array->length);
+  for (int64_t i = 0; i < array->length; ++i)
+  {
+    const int64_t bit = array->offset + i;
+    result->SetValue(i, IsValid(array, i) && ((bits[bit >> 3] >> (bit & 7)) & 1));
+  }
+  return result;
+}
+}
+
+vtkStandardNewMacro(vtkArrowTableImporter);
+vtkInformationKeyMacro(vtkArrowTableImporter, CATEGORIES, StringVector);
+
+//------------------------------------------------------------------------------
+vtkArrowTableImporter::vtkArrowTableImporter()
+  : DecodeDictionaries(false)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkArrowTableImporter::~vtkArrowTableImporter() = default;
+
+//------------------------------------------------------------------------------
+bool vtkArrowTableImporter::Import(const ArrowSchema* schema, ArrowArray* batch, vtkTable* table)
+{
+  if (!batch || !batch->release)
+  {
+    vtkErrorMacro("No record batch to import.");
+    return false;
+  }
+  // take the batch, as the consumer of the C data interface does
+  vtkNew<vtkArrowBatchResource> owner;
+  owner->Batch = *batch;
+  batch->release = nullptr;
+  const ArrowArray* records = &owner->Batch;
+
+  if (!schema || !table || std::strcmp(schema->format, "+s") != 0 ||
+    schema->n_children != records->n_children)
+  {
+    vtkErrorMacro("The record batch is not a struct array of the given schema.");
+    return false;
+  }
+  if (HasNulls(records))
+  {
+    vtkWarningMacro("The null records of the batch are imported as records of null values.");
+  }
+
+  table->Initialize();
+  for (int64_t col = 0; col < records->n_children; ++col)
+  {
+    const ArrowSchema* field = schema->children[col];
+    const ArrowArray* array = records->children[col];
+    const std::string name =
+      field->name && field->name[0] ? field->name : "Column " + std::to_string(col);
+    const char* format = field->format;
+
+    vtkSmartPointer<vtkAbstractArray> column;
+    if (field->dictionary && array->dictionary)
+    {
+      const char* dictionaryFormat = field->dictionary->format;
+      const ArrowArray* dictionary = array->dictionary;
+      if (IsString(dictionaryFormat) && dictionary->n_buffers >= 3)
+      {
+        column = ImportNumbers(format, array, array, 1, -1, owner);
+      }
+      if (column && this->DecodeDictionaries)
+      {
+        vtkDataArray* indices = vtkDataArray::SafeDownCast(column);
+        vtkNew<vtkStringArray> strings;
+        strings->SetNumberOfValues(array->length);
+        for (int64_t i = 0; i < array->length; ++i)
+        {
+          const double index = indices->GetComponent(i, 0);
+          if (index >= 0 && index < dictionary->length)
+          {
+            strings->SetValue(i, GetString(dictionaryFormat, dictionary, index));
+          }
+        }
+        column = strings;
+      }
+      else if (column)
+      {
+        vtkInformation* info = column->GetInformation();
+        for (int64_t i = 0; i < dictionary->length; ++i)
+        {
+          vtkArrowTableImporter::CATEGORIES()->Append(
+            info, GetString(dictionaryFormat, dictionary, i));
+        }
+      }
+    }
+    else if (IsString(format))
+    {
+      column = ImportStrings(format, array);
+    }
+    else if (std::strcmp(format, "b") == 0)
+    {
+      column = ImportBooleans(array);
+    }
+    else if (std::strncmp(format, "+w:", 3) == 0 && field->n_children == 1 &&
+      array->n_children == 1)
+    {
+      const int numComps = std::atoi(format + 3);
+      if (numComps > 0)
+      {
+        column = ImportNumbers(
+          field->children[0]->format, array, array->children[0], numComps, 0, owner);
+      }
+    }
+    else
+    {
+      column = ImportNumbers(format, array, array, 1, 0, owner);
+    }
+
+    if (!column)
+    {
+      vtkWarningMacro("Skipping column " << name << " of unsupported format " << format << ".");
+      continue;
+    }
+    column->SetName(name.c_str());
+    table->AddColumn(column);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkArrowTableImporter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "DecodeDictionaries: " << this->DecodeDictionaries << endl;
+}
+VTK_ABI_NAMESPACE_END
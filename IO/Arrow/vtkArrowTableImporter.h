@@ -0,0 +1,100 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkArrowTableImporter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkArrowTableImporter
+ * @brief   makes the columns of a table from an Arrow record batch
+ *
+ * vtkArrowTableImporter turns a record batch exported through the Arrow C
+ * data interface (see vtkArrowCDataInterface.h) into the columns of a
+ * vtkTable, one column per field of the batch:
+ *
+ * - the numeric, date, time and timestamp fields become AOS data arrays of
+ *   the same type that use the Arrow buffers without copy, and so do the
+ *   fixed size lists of numbers, as arrays of several components,
+ * - the dictionary encoded strings become categorical arrays: integer arrays
+ *   of the indices, without copy, whose information holds the dictionary
+ *   under the CATEGORIES() key, or vtkStringArray when DecodeDictionaries is
+ *   set,
+ * - the strings become vtkStringArray and the booleans vtkBitArray, copied.
+ *
+ * The columns with null values are copied, the null values being NaN for
+ * floating point values, -1 for the dictionary indices and 0 otherwise. The
+ * other field types are skipped with a warning.
+ *
+ * The record batch is moved into the columns, and released once the last
+ * column that uses its buffers is released. As Arrow buffers are immutable,
+ * the columns that share them must not be modified in place.
+ *
+ * @sa
+ * vtkArrowStreamReader vtkTable
+ */
+
+#ifndef vtkArrowTableImporter_h
+#define vtkArrowTableImporter_h
+
+#include "vtkIOArrowModule.h" // For export macro
+#include "vtkObject.h"
+
+struct ArrowArray;
+struct ArrowSchema;
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformationStringVectorKey;
+class vtkTable;
+
+class VTKIOARROW_EXPORT vtkArrowTableImporter : public vtkObject
+{
+public:
+  static vtkArrowTableImporter* New();
+  vtkTypeMacro(vtkArrowTableImporter, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Replace the columns of @a table by the fields of @a batch, a struct
+   * array described by @a schema. The batch is moved, and marked released
+   * when this returns, while the schema is left to the caller. Returns false,
+   * after releasing the batch, if it is not a struct array matching schema.
+   */
+  VTK_WRAPEXCLUDE bool Import(const ArrowSchema* schema, ArrowArray* batch, vtkTable* table);
+
+  ///@{
+  /**
+   * Whether the dictionary encoded strings are decoded into vtkStringArray
+   * instead of categorical arrays. Default is false.
+   */
+  vtkSetMacro(DecodeDictionaries, bool);
+  vtkGetMacro(DecodeDictionaries, bool);
+  vtkBooleanMacro(DecodeDictionaries, bool);
+  ///@}
+
+  /**
+   * The dictionary of a categorical column, in the information of the
+   * column: the category of index i is the i-th string.
+   */
+  static vtkInformationStringVectorKey* CATEGORIES();
+
+protected:
+  vtkArrowTableImporter();
+  ~vtkArrowTableImporter() override;
+
+  bool DecodeDictionaries;
+
+private:
+  vtkArrowTableImporter(const vtkArrowTableImporter&) = delete;
+  void operator=(const vtkArrowTableImporter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,163 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestThreadedDataObjectWriterCopyOnWrite.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the data object can be modified in place right after Write()
+// returns, while the snapshot is written: the file holds the values at the
+// time of the call.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTestUtilities.h"
+#include "vtkThreadedDataObjectWriter.h"
+#include "vtkXMLPolyDataReader.h"
+#include "vtkXMLPolyDataWriter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 100;
+
+// Do not write until released, so that the caller modifies the data object
+// before the snapshot is written.
+class BlockingWriter : public vtkXMLPolyDataWriter
+{
+public:
+  static BlockingWriter* New();
+  vtkTypeMacro(BlockingWriter, vtkXMLPolyDataWriter);
+
+  std::atomic<bool>* Released = nullptr;
+
+  vtkTypeBool ProcessRequest(vtkInformation* request, vtkInformationVector** inInfo,
+    vtkInformationVector* outInfo) override
+  {
+    while (!*this->Released)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return this->Superclass::ProcessRequest(request, inInfo, outInfo);
+  }
+};
+vtkStandardNewMacro(BlockingWriter);
+
+bool CheckArray(vtkDataArray* array, const char* name, double offset)
+{
+  if (!array || array->GetNumberOfTuples() != NumberOfPoints)
+  {
+    std::cerr << "Missing array " << name << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    if (array->GetComponent(i, 0) != i + offset)
+    {
+      std::cerr << "Wrong value " << array->GetComponent(i, 0) << " in " << name << " at " << i
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestThreadedDataObjectWriterCopyOnWrite(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    std::cerr << "Could not determine temporary directory." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string fileName =
+    std::string(tempDir) + "/TestThreadedDataObjectWriterCopyOnWrite.vtp";
+  delete[] tempDir;
+
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkFloatArray> values;
+  values->SetName("Values");
+  vtkNew<vtkDoubleArray> cellValues;
+  cellValues->SetName("CellValues");
+  vtkNew<vtkIntArray> fieldValues;
+  fieldValues->SetName("FieldValues");
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    points->InsertNextPoint(i, 0.0, 0.0);
+    verts->InsertNextCell(1, &i);
+    values->InsertNextValue(i + 1.0f);
+    cellValues->InsertNextValue(i + 2.0);
+    fieldValues->InsertNextValue(i + 3);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetVerts(verts);
+  polyData->GetPointData()->SetScalars(values);
+  polyData->GetCellData()->AddArray(cellValues);
+  polyData->GetFieldData()->AddArray(fieldValues);
+
+  std::atomic<bool> released(false);
+  vtkNew<BlockingWriter> xmlWriter;
+  xmlWriter->Released = &released;
+  xmlWriter->SetFileName(fileName.c_str());
+  vtkNew<vtkThreadedDataObjectWriter> writer;
+  writer->SetMaxThreads(1);
+  writer->Initialize();
+  writer->Write(polyData, xmlWriter);
+
+  // modify the data object in place, as a simulation updating its fields would
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    points->SetPoint(i, -1.0, -1.0, -1.0);
+    values->SetValue(i, -1.0f);
+    cellValues->SetTuple1(i, -1.0);
+    fieldValues->SetTypedComponent(i, 0, -1);
+  }
+  polyData->GetPointData()->SetActiveScalars(nullptr);
+  released = true;
+  writer->Finalize();
+
+  vtkNew<vtkXMLPolyDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  vtkPolyData* output = reader->GetOutput();
+  if (!output->GetPoints() || !CheckArray(output->GetPoints()->GetData(), "Points", 0.0) ||
+    !CheckArray(output->GetPointData()->GetScalars(), "Values", 1.0) ||
+    !CheckArray(output->GetCellData()->GetArray("CellValues"), "CellValues", 2.0) ||
+    !CheckArray(output->GetFieldData()->GetArray("FieldValues"), "FieldValues", 3.0))
+  {
+    std::cerr << "The file does not hold the values at the time of Write()" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (values->GetValue(0) != -1.0f || points->GetPoint(0)[1] != -1.0)
+  {
+    std::cerr << "The data object lost its modifications" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
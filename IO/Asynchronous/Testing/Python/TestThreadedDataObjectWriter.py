@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+import sys
+
+from vtkmodules.vtkCommonCore import vtkPoints
+from vtkmodules.vtkCommonDataModel import vtkPolyData
+from vtkmodules.vtkIOAsynchronous import vtkThreadedDataObjectWriter
+from vtkmodules.vtkIOXML import vtkXMLPolyDataReader, vtkXMLPolyDataWriter
+from vtkmodules.util.misc import vtkGetTempDir
+
+VTK_TEMP_DIR = vtkGetTempDir()
+
+# Generate Data
+points = vtkPoints()
+for i in range(1000):
+    points.InsertNextPoint(i, 2 * i, 3 * i)
+polyData = vtkPolyData()
+polyData.SetPoints(points)
+
+# Initialize writer, with a small queue to exercise the backpressure
+writer = vtkThreadedDataObjectWriter()
+writer.SetMaxThreads(2)
+writer.SetMaxQueueSize(2)
+writer.DeepCopyOn()
+writer.Initialize()
+
+fileNames = []
+for i in range(10):
+    # the snapshot is a deep copy: the points can be modified right away
+    points.SetPoint(0, i, i, i)
+    points.Modified()
+    fileName = '%s/threaded-data-writer-%d.vtp' % (VTK_TEMP_DIR, i)
+    if i % 2:
+        writer.EncodeAndWrite(polyData, fileName)
+    else:
+        xmlWriter = vtkXMLPolyDataWriter()
+        xmlWriter.SetFileName(fileName)
+        writer.Write(polyData, xmlWriter)
+    fileNames.append(fileName)
+    if writer.GetNumberOfPendingWrites() > 2:
+        print('Too many pending writes')
+        sys.exit(1)
+
+# Wait for the work to be done
+writer.Finalize()
+
+for i, fileName in enumerate(fileNames):
+    reader = vtkXMLPolyDataReader()
+    reader.SetFileName(fileName)
+    reader.Update()
+    output = reader.GetOutput()
+    if output.GetNumberOfPoints() != 1000 or output.GetPoint(0) != (i, i, i):
+        print('Wrong data in %s' % fileName)
+        sys.exit(1)
+
+print("All good...")
@@ -0,0 +1,304 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkThreadedDataObjectWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkThreadedDataObjectWriter.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataObject.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkErrorCode.h"
+#include "vtkFieldData.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkSmartPointer.h"
+#include "vtkThreadedTaskQueue.h"
+#include "vtkXMLDataObjectWriter.h"
+#include "vtkXMLMultiBlockDataWriter.h"
+#include "vtkXMLWriter.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Return a copy of the array sharing its values until either is modified.
+// Arrays that do not support it, such as string arrays, are deep copied.
+vtkSmartPointer<vtkAbstractArray> CopyOnWrite(vtkAbstractArray* array)
+{
+  vtkSmartPointer<vtkAbstractArray> copy;
+  copy.TakeReference(array->NewInstance());
+  vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array);
+  if (dataArray)
+  {
+    vtkDataArray::SafeDownCast(copy)->ShallowCopyOnWrite(dataArray);
+  }
+  else
+  {
+    copy->DeepCopy(array);
+  }
+  return copy;
+}
+
+// Replace the arrays of the field data, shared with the caller after a
+// shallow copy, by copy-on-write copies, keeping the active attributes.
+void CopyArraysOnWrite(vtkFieldData* fieldData)
+{
+  vtkDataSetAttributes* attributes = vtkDataSetAttributes::SafeDownCast(fieldData);
+  const int numberOfArrays = fieldData->GetNumberOfArrays();
+  std::vector<vtkSmartPointer<vtkAbstractArray>> copies(numberOfArrays);
+  std::vector<int> attributeTypes(numberOfArrays, -1);
+  for (int i = 0; i < numberOfArrays; ++i)
+  {
+    copies[i] = CopyOnWrite(fieldData->GetAbstractArray(i));
+    if (attributes)
+    {
+      attributeTypes[i] = attributes->IsArrayAnAttribute(i);
+    }
+  }
+  for (int i = numberOfArrays - 1; i >= 0; --i)
+  {
+    fieldData->RemoveArray(i);
+  }
+  for (int i = 0; i < numberOfArrays; ++i)
+  {
+    const int index = fieldData->AddArray(copies[i]);
+    if (attributeTypes[i] >= 0)
+    {
+      attributes->SetActiveAttribute(index, attributeTypes[i]);
+    }
+  }
+}
+
+void CopyArraysOnWrite(vtkDataObject* dataObject)
+{
+  for (int type = 0; type < vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES; ++type)
+  {
+    vtkFieldData* fieldData = dataObject->GetAttributesAsFieldData(type);
+    if (fieldData)
+    {
+      CopyArraysOnWrite(fieldData);
+    }
+  }
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataObject);
+  if (pointSet && pointSet->GetPoints())
+  {
+    vtkNew<vtkPoints> points;
+    points->SetData(vtkDataArray::SafeDownCast(CopyOnWrite(pointSet->GetPoints()->GetData())));
+    pointSet->SetPoints(points);
+  }
+}
+}
+
+//****************************************************************************
+class vtkThreadedDataObjectWriter::vtkInternals
+{
+private:
+  using TaskQueueType =
+    vtkThreadedTaskQueue<void, vtkSmartPointer<vtkDataObject>, vtkSmartPointer<vtkAlgorithm>>;
+  std::unique_ptr<TaskQueueType> Queue;
+
+  std::mutex PendingMutex;
+  std::condition_variable PendingCV;
+  int Pending = 0;
+
+  void Write(
+    const vtkSmartPointer<vtkDataObject>& data, const vtkSmartPointer<vtkAlgorithm>& writer)
+  {
+    vtkLogF(TRACE, "writing: %s", data->GetClassName());
+    writer->SetInputDataObject(0, data);
+    // always write even if the writer has been used before
+    writer->Modified();
+    writer->UpdateWholeExtent();
+    if (writer->GetErrorCode() != vtkErrorCode::NoError)
+    {
+      vtkLog(ERROR,
+        "Failed to write " << data->GetClassName() << " with " << writer->GetClassName() << ": "
+                           << vtkErrorCode::GetStringFromErrorCode(writer->GetErrorCode()));
+    }
+    // release the snapshot before another write is allowed
+    writer->RemoveAllInputConnections(0);
+
+    std::lock_guard<std::mutex> lock(this->PendingMutex);
+    --this->Pending;
+    this->PendingCV.notify_all();
+  }
+
+public:
+  ~vtkInternals() { this->TerminateAllWorkers(); }
+
+  bool IsInitialized() const { return this->Queue != nullptr; }
+
+  void TerminateAllWorkers()
+  {
+    if (this->Queue)
+    {
+      this->Queue->Flush();
+    }
+    this->Queue.reset(nullptr);
+  }
+
+  void SpawnWorkers(int numberOfThreads)
+  {
+    this->Queue.reset(new TaskQueueType(
+      [this](vtkSmartPointer<vtkDataObject> data, vtkSmartPointer<vtkAlgorithm> writer) {
+        this->Write(data, writer);
+      },
+      /*strict_ordering=*/true,
+      /*buffer_size=*/-1,
+      /*max_concurrent_tasks=*/numberOfThreads));
+  }
+
+  // Wait for room in the queue, so that the snapshots held by the queue stay
+  // bounded, then push the write.
+  void Push(vtkSmartPointer<vtkDataObject>&& data, vtkSmartPointer<vtkAlgorithm>&& writer,
+    int maxQueueSize)
+  {
+    {
+      std::unique_lock<std::mutex> lock(this->PendingMutex);
+      this->PendingCV.wait(
+        lock, [&]() { return maxQueueSize <= 0 || this->Pending < maxQueueSize; });
+      ++this->Pending;
+    }
+    this->Queue->Push(std::move(data), std::move(writer));
+  }
+
+  int GetNumberOfPending()
+  {
+    std::lock_guard<std::mutex> lock(this->PendingMutex);
+    return this->Pending;
+  }
+};
+
+vtkStandardNewMacro(vtkThreadedDataObjectWriter);
+//------------------------------------------------------------------------------
+vtkThreadedDataObjectWriter::vtkThreadedDataObjectWriter()
+  : MaxThreads(4)
+  , MaxQueueSize(8)
+  , DeepCopy(false)
+  , Internals(new vtkInternals())
+{
+}
+
+//------------------------------------------------------------------------------
+vtkThreadedDataObjectWriter::~vtkThreadedDataObjectWriter() = default;
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::Initialize()
+{
+  // Stop any started thread first
+  this->Internals->TerminateAllWorkers();
+  this->Internals->SpawnWorkers(this->MaxThreads);
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::Write(vtkDataObject* data, vtkAlgorithm* writer)
+{
+  if (data == nullptr || writer == nullptr)
+  {
+    vtkErrorMacro(<< "Write: Please specify a data object and a writer!");
+    return;
+  }
+  if (!this->Internals->IsInitialized())
+  {
+    vtkErrorMacro(<< "Write: Initialize() must be called first.");
+    return;
+  }
+
+  vtkSmartPointer<vtkDataObject> snapshot;
+  snapshot.TakeReference(data->NewInstance());
+  // The shallow copy of the other composite datasets, such as AMR ones,
+  // shares the blocks themselves.
+  if (this->DeepCopy ||
+    (vtkCompositeDataSet::SafeDownCast(data) && !vtkDataObjectTree::SafeDownCast(data)))
+  {
+    snapshot->DeepCopy(data);
+  }
+  else
+  {
+    // The snapshot shares the values of the arrays with the data object until
+    // either of them modifies them.
+    snapshot->ShallowCopy(data);
+    vtkDataObjectTree* tree = vtkDataObjectTree::SafeDownCast(snapshot);
+    if (tree)
+    {
+      vtkSmartPointer<vtkCompositeDataIterator> iter;
+      iter.TakeReference(tree->NewIterator());
+      for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+      {
+        CopyArraysOnWrite(iter->GetCurrentDataObject());
+      }
+    }
+    CopyArraysOnWrite(snapshot);
+  }
+  this->Internals->Push(std::move(snapshot), writer, this->MaxQueueSize);
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::EncodeAndWrite(vtkDataObject* data, const char* fileName)
+{
+  if (data == nullptr || fileName == nullptr)
+  {
+    vtkErrorMacro(<< "EncodeAndWrite: Please specify a data object and a file name!");
+    return;
+  }
+
+  vtkSmartPointer<vtkXMLWriter> writer;
+  if (vtkMultiBlockDataSet::SafeDownCast(data))
+  {
+    writer = vtkSmartPointer<vtkXMLMultiBlockDataWriter>::New();
+  }
+  else
+  {
+    writer.TakeReference(vtkXMLDataObjectWriter::NewWriter(data->GetDataObjectType()));
+  }
+  if (!writer)
+  {
+    vtkErrorMacro(<< "EncodeAndWrite: Cannot write " << data->GetClassName() << " in XML.");
+    return;
+  }
+  writer->SetFileName(fileName);
+  this->Write(data, writer);
+}
+
+//------------------------------------------------------------------------------
+int vtkThreadedDataObjectWriter::GetNumberOfPendingWrites()
+{
+  return this->Internals->GetNumberOfPending();
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::Finalize()
+{
+  this->Internals->TerminateAllWorkers();
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaxThreads: " << this->MaxThreads << endl;
+  os << indent << "MaxQueueSize: " << this->MaxQueueSize << endl;
+  os << indent << "DeepCopy: " << (this->DeepCopy ? "On" : "Off") << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,150 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkThreadedDataObjectWriter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class    vtkThreadedDataObjectWriter
+ * @brief    write any data object using threads, without blocking the caller
+ *
+ * vtkThreadedDataObjectWriter is the counterpart of vtkThreadedImageWriter for
+ * any kind of data object. A snapshot of the data object is taken when it is
+ * pushed, and it is written in the background by a pool of worker threads.
+ * This lets in situ codes output their data without waiting for the file
+ * system.
+ *
+ * By default, the snapshot shares the memory of the arrays of the data object
+ * copy-on-write (see vtkDataArray::ShallowCopyOnWrite()): the caller may
+ * modify the data object and its arrays right after the call, and the first
+ * modification of a shared array through its setters copies its values;
+ * writes through GetPointer() are not detected. This covers the point
+ * and cell data, the field data and the points; the cells are still shared
+ * and may not be modified in place until the data is written. Arrays that do
+ * not support copy-on-write, such as string arrays or SOA arrays, are deep
+ * copied, as are the composite datasets that are not trees, such as AMR ones.
+ * Turn DeepCopy on to copy everything up front.
+ *
+ * Either pass a writer, configured with its file name and options, to
+ * Write(), or let EncodeAndWrite() create a XML writer suited to the data
+ * object. A writer is used by a single task: give a new writer to each call.
+ *
+ * The number of pending writes is bounded by MaxQueueSize: when the queue is
+ * full, pushing a data object blocks until a write completes. This bounds the
+ * memory held by the snapshots, which matters with DeepCopy on.
+ *
+ * @sa vtkThreadedImageWriter
+ */
+
+#ifndef vtkThreadedDataObjectWriter_h
+#define vtkThreadedDataObjectWriter_h
+
+#include "vtkIOAsynchronousModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <memory> // For unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkDataObject;
+
+class VTKIOASYNCHRONOUS_EXPORT vtkThreadedDataObjectWriter : public vtkObject
+{
+public:
+  static vtkThreadedDataObjectWriter* New();
+  vtkTypeMacro(vtkThreadedDataObjectWriter, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Need to be called at least once before using the class.
+   * Then it should be called again after any change on the
+   * thread count or if Finalize() was called.
+   *
+   * This method will wait for any pending write to complete and start
+   * a new pool with the given number of threads.
+   */
+  void Initialize();
+
+  /**
+   * Push a snapshot of the data object, to be written with the given writer.
+   * The writer must have its file name set, and must not be used by the
+   * caller anymore. Blocks while MaxQueueSize writes are pending.
+   */
+  void Write(vtkDataObject* data, vtkAlgorithm* writer);
+
+  /**
+   * Push a snapshot of the data object, to be written in the XML format
+   * suited to its type (vti, vtp, vtu, vtm...) to the given file.
+   * Blocks while MaxQueueSize writes are pending.
+   */
+  void EncodeAndWrite(vtkDataObject* data, VTK_FILEPATH const char* fileName);
+
+  ///@{
+  /**
+   * Define the number of worker thread to use.
+   * Initialize() need to be called after any thread count change.
+   * The number of threads is limited by
+   * vtkMultiThreader::GetGlobalMaximumNumberOfThreads(). The default is 4.
+   */
+  vtkSetClampMacro(MaxThreads, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaxThreads, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of writes that may be pending, queued or in
+   * progress. Pushing more data objects blocks until a write completes.
+   * Zero means unlimited. The default is 8.
+   */
+  vtkSetClampMacro(MaxQueueSize, int, 0, VTK_INT_MAX);
+  vtkGetMacro(MaxQueueSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get whether the snapshots are deep copies of the data objects
+   * instead of copy-on-write ones. Deep copies also allow the caller to
+   * modify the cells in place, at the price of copying all the data up
+   * front. The default is off.
+   */
+  vtkSetMacro(DeepCopy, bool);
+  vtkGetMacro(DeepCopy, bool);
+  vtkBooleanMacro(DeepCopy, bool);
+  ///@}
+
+  /**
+   * Return the number of writes queued or in progress.
+   */
+  int GetNumberOfPendingWrites();
+
+  /**
+   * This method will wait for any pending write to complete.
+   */
+  void Finalize();
+
+protected:
+  vtkThreadedDataObjectWriter();
+  ~vtkThreadedDataObjectWriter() override;
+
+  int MaxThreads;
+  int MaxQueueSize;
+  bool DeepCopy;
+
+private:
+  vtkThreadedDataObjectWriter(const vtkThreadedDataObjectWriter&) = delete;
+  void operator=(const vtkThreadedDataObjectWriter&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -60,6 +60,8 @@ public:
   /**
    * Define the number of worker thread to use.
    * Initialize() need to be called after any thread count change.
+   * The number of threads is limited by
+   * vtkMultiThreader::GetGlobalMaximumNumberOfThreads().
    */
   void SetMaxThreads(vtkTypeUInt32);
   vtkGetMacro(MaxThreads, vtkTypeUInt32);
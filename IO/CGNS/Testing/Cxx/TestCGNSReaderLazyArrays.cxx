@@ -0,0 +1,108 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCGNSReaderLazyArrays.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the arrays loaded lazily by vtkCGNSReader are implicit arrays
+// with the same values as the arrays read at once.
+
+#include "vtkCGNSReader.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkDataSet* GetFirstZone(vtkCGNSReader* reader)
+{
+  vtkMultiBlockDataSet* base = vtkMultiBlockDataSet::SafeDownCast(reader->GetOutput()->GetBlock(0));
+  return base ? vtkDataSet::SafeDownCast(base->GetBlock(0)) : nullptr;
+}
+
+bool CompareArrays(vtkDataSetAttributes* expected, vtkDataSetAttributes* lazy)
+{
+  if (expected->GetNumberOfArrays() == 0 ||
+    expected->GetNumberOfArrays() != lazy->GetNumberOfArrays())
+  {
+    std::cerr << lazy->GetNumberOfArrays() << " lazy arrays instead of "
+              << expected->GetNumberOfArrays() << std::endl;
+    return false;
+  }
+  for (int i = 0; i < expected->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* array = expected->GetArray(i);
+    vtkDataArray* lazyArray = lazy->GetArray(array->GetName());
+    if (!lazyArray || lazyArray->HasStandardMemoryLayout() ||
+      lazyArray->GetDataType() != array->GetDataType() ||
+      lazyArray->GetNumberOfComponents() != array->GetNumberOfComponents() ||
+      lazyArray->GetNumberOfTuples() != array->GetNumberOfTuples())
+    {
+      std::cerr << "Wrong lazy array " << array->GetName() << std::endl;
+      return false;
+    }
+    for (vtkIdType t = 0; t < array->GetNumberOfTuples(); t++)
+    {
+      for (int c = 0; c < array->GetNumberOfComponents(); c++)
+      {
+        if (lazyArray->GetComponent(t, c) != array->GetComponent(t, c))
+        {
+          std::cerr << "Wrong value in lazy array " << array->GetName() << " at tuple " << t
+                    << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestCGNSReaderLazyArrays(int argc, char* argv[])
+{
+  char* fname = vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/test_node_and_cell.cgns");
+  vtkNew<vtkCGNSReader> reader;
+  reader->SetFileName(fname);
+  vtkNew<vtkCGNSReader> lazyReader;
+  lazyReader->SetFileName(fname);
+  delete[] fname;
+
+  reader->UpdateInformation();
+  reader->EnableAllCellArrays();
+  reader->EnableAllPointArrays();
+  reader->Update();
+
+  lazyReader->UpdateInformation();
+  lazyReader->EnableAllCellArrays();
+  lazyReader->EnableAllPointArrays();
+  lazyReader->LoadArraysLazilyOn();
+  lazyReader->Update();
+
+  vtkDataSet* expected = GetFirstZone(reader);
+  vtkDataSet* lazy = GetFirstZone(lazyReader);
+  if (!expected || !lazy)
+  {
+    std::cerr << "Missing zone" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!CompareArrays(expected->GetCellData(), lazy->GetCellData()))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
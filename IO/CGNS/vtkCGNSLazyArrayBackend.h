@@ -0,0 +1,98 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCGNSLazyArrayBackend.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+/**
+ * @struct   vtkCGNSLazyArrayBackend
+ *
+ *     implicit array backend loading the values of a CGNS array on first access
+ *
+ * The backend is constructed with a loader, which fills a buffer of the given
+ * number of values from the file, and a number of values. The loader is only
+ * called the first time a value is accessed, so that arrays nobody looks at
+ * are never read. Loading happens once, even when the first accesses are
+ * concurrent, and the copies of a backend share the loaded values.
+ *
+ * An example of usage in a vtkImplicitArray
+ * ```
+ * vtkNew<vtkImplicitArray<vtkCGNSLazyArrayBackend<double>>> array;
+ * array->ConstructBackend([](double* values) { ... }, nTuples * nComponents);
+ * array->SetNumberOfComponents(nComponents);
+ * array->SetNumberOfTuples(nTuples);
+ * ```
+ */
+
+#ifndef vtkCGNSLazyArrayBackend_h
+#define vtkCGNSLazyArrayBackend_h
+
+#include "vtkType.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CGNSRead
+{
+VTK_ABI_NAMESPACE_BEGIN
+template <typename ValueType>
+struct vtkCGNSLazyArrayBackend
+{
+  using LoaderType = std::function<void(ValueType*)>;
+
+  vtkCGNSLazyArrayBackend(LoaderType loader, vtkIdType numberOfValues)
+    : State(std::make_shared<LazyState>())
+  {
+    this->State->Loader = std::move(loader);
+    this->State->NumberOfValues = numberOfValues;
+  }
+
+  ValueType operator()(vtkIdType index) const { return this->GetValues()[index]; }
+
+  /**
+   * Return whether the values have been read from the file.
+   */
+  bool IsLoaded() const { return this->State->Loaded; }
+
+private:
+  struct LazyState
+  {
+    std::once_flag Once;
+    LoaderType Loader;
+    vtkIdType NumberOfValues = 0;
+    std::vector<ValueType> Values;
+    std::atomic<bool> Loaded{ false };
+  };
+
+  const ValueType* GetValues() const
+  {
+    LazyState* state = this->State.get();
+    std::call_once(state->Once, [state]() {
+      // zero-initialized, for the components the loader does not fill
+      state->Values.resize(static_cast<std::size_t>(state->NumberOfValues), ValueType());
+      state->Loader(state->Values.data());
+      state->Loader = nullptr;
+      state->Loaded = true;
+    });
+    return state->Values.data();
+  }
+
+  std::shared_ptr<LazyState> State;
+};
+VTK_ABI_NAMESPACE_END
+}
+
+#endif // vtkCGNSLazyArrayBackend_h
+// VTK-HeaderTest-Exclude: vtkCGNSLazyArrayBackend.h
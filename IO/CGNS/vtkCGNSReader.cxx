@@ -27,6 +27,7 @@
 #include "vtkArrayDispatch.h"
 #include "vtkAssume.h"
 #include "vtkCGNSCache.h"
+#include "vtkCGNSLazyArrayBackend.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
@@ -38,6 +39,7 @@
 #include "vtkFieldData.h"
 #include "vtkFloatArray.h"
 #include "vtkIdTypeArray.h"
+#include "vtkImplicitArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationVector.h"
@@ -63,6 +65,8 @@
 #include <cstdlib>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <sstream>
@@ -432,6 +436,122 @@ private:
   BCInformationUns(const BCInformationUns&) = delete;
   BCInformationUns& operator=(const BCInformationUns&) = delete;
 };
+
+//------------------------------------------------------------------------------
+/**
+ * Description of the reads filling a lazily loaded array: the range of the
+ * solution read from the file, where it goes in memory, and the variables
+ * (one per component for vectors) with the offset of their first value.
+ */
+struct LazyArrayReads
+{
+  struct Variable
+  {
+    std::string NodePath;
+    std::string DataType;
+    vtkIdType Offset;
+  };
+
+  std::string FileName;
+  int CellDim;
+  cgsize_t SrcStart[3];
+  cgsize_t SrcEnd[3];
+  cgsize_t SrcStride[3];
+  cgsize_t MemDims[3];
+  cgsize_t MemStart[3];
+  cgsize_t MemEnd[3];
+  cgsize_t MemStride[3];
+  std::vector<Variable> Variables;
+};
+
+// The cgio layer is not thread safe: lazy arrays load one at a time
+std::mutex LazyArrayMutex;
+
+template <typename ValueType>
+void LoadLazyArray(const LazyArrayReads& reads, ValueType* values)
+{
+  std::lock_guard<std::mutex> lock(LazyArrayMutex);
+  int cgioNum;
+  if (cgio_open_file(reads.FileName.c_str(), CGIO_MODE_READ, 0, &cgioNum) != CG_OK)
+  {
+    char message[81];
+    cgio_error_message(message);
+    vtkGenericWarningMacro(<< "Error opening " << reads.FileName << " to load an array: "
+                           << message);
+    return;
+  }
+  double rootId;
+  cgio_get_root_id(cgioNum, &rootId);
+
+  for (const auto& variable : reads.Variables)
+  {
+    double varId;
+    if (cgio_get_node_id(cgioNum, rootId, variable.NodePath.c_str(), &varId) != CG_OK)
+    {
+      char message[81];
+      cgio_error_message(message);
+      vtkGenericWarningMacro(<< "cgio_get_node_id " << variable.NodePath << " :" << message);
+      continue;
+    }
+    if (cgio_read_data_type(cgioNum, varId, reads.SrcStart, reads.SrcEnd, reads.SrcStride,
+          variable.DataType.c_str(), reads.CellDim, reads.MemDims, reads.MemStart, reads.MemEnd,
+          reads.MemStride, values + variable.Offset) != CG_OK)
+    {
+      char message[81];
+      cgio_error_message(message);
+      vtkGenericWarningMacro(<< "cgio_read_data_type :" << message);
+    }
+    cgio_release_id(cgioNum, varId);
+  }
+  cgio_close_file(cgioNum);
+}
+
+template <typename ValueType>
+vtkDataArray* NewLazyArray(const std::shared_ptr<const LazyArrayReads>& reads, vtkIdType nVals,
+  int nComponents)
+{
+  using ArrayType = vtkImplicitArray<CGNSRead::vtkCGNSLazyArrayBackend<ValueType>>;
+  ArrayType* array = ArrayType::New();
+  array->ConstructBackend(
+    [reads](ValueType* values) { LoadLazyArray(*reads, values); }, nVals * nComponents);
+  array->SetNumberOfComponents(nComponents);
+  array->SetNumberOfTuples(nVals);
+  return array;
+}
+
+/**
+ * Create an implicit array loading its values on first access, with the type,
+ * name and components of the given unallocated array.
+ */
+vtkDataArray* NewLazyArray(
+  vtkDataArray* layout, const std::shared_ptr<const LazyArrayReads>& reads, vtkIdType nVals)
+{
+  const int nComponents = layout->GetNumberOfComponents();
+  vtkDataArray* array = nullptr;
+  switch (layout->GetDataType())
+  {
+    case VTK_INT:
+      array = NewLazyArray<int>(reads, nVals, nComponents);
+      break;
+    case VTK_LONG:
+      array = NewLazyArray<long>(reads, nVals, nComponents);
+      break;
+    case VTK_FLOAT:
+      array = NewLazyArray<float>(reads, nVals, nComponents);
+      break;
+    case VTK_DOUBLE:
+      array = NewLazyArray<double>(reads, nVals, nComponents);
+      break;
+    case VTK_CHAR:
+      array = NewLazyArray<char>(reads, nVals, nComponents);
+      break;
+    default:
+      return nullptr;
+  }
+  array->SetName(layout->GetName());
+  array->CopyComponentNames(layout);
+  return array;
+}
 }
 
 // vtkCGNSReader has several method that used types from CGNS
@@ -530,6 +650,8 @@ public:
   ~vtkPrivate();
 
   CGNSRead::vtkCGNSMetaData* Internal;               // Metadata
+  // Path (/baseName/zoneName) of the zone being read, for the arrays loaded lazily
+  std::string CurrentZonePath;
   CGNSRead::vtkCGNSCache<vtkPoints> MeshPointsCache; // Cache for the mesh points
   CGNSRead::vtkCGNSCache<vtkUnstructuredGrid>
     ConnectivitiesCache; // Cache for the mesh connectivities
@@ -1255,10 +1377,12 @@ int vtkCGNSReader::vtkPrivate::readSolution(const std::string& solutionNameStr,
   std::vector<vtkDataArray*> vtkVars(nVarArray);
   // Count number of vars and vectors
   // Assign vars and vectors to a vtkvars array
-  vtkPrivate::AllocateVtkArray(
-    physicalDim, requestedVectorDim, nVals, varCentering, cgnsVars, cgnsVectors, vtkVars, self);
+  // Arrays loaded lazily are not allocated: they only describe the output arrays
+  vtkPrivate::AllocateVtkArray(physicalDim, requestedVectorDim, self->LoadArraysLazily ? 0 : nVals,
+    varCentering, cgnsVars, cgnsVectors, vtkVars, self);
 
-  // Load Data
+  // Load Data, or record how to load it for the arrays loaded lazily
+  std::map<vtkDataArray*, std::shared_ptr<LazyArrayReads>> lazyReads;
   for (std::size_t ff = 0; ff < nVarArray; ++ff)
   {
     // only read allocated fields
@@ -1269,8 +1393,32 @@ int vtkCGNSReader::vtkPrivate::readSolution(const std::string& solutionNameStr,
     double cgioVarId = solChildId[ff];
     const char* fieldDataType = get_data_type(cgnsVars[ff].dt);
 
+    if (self->LoadArraysLazily)
+    {
+      std::shared_ptr<LazyArrayReads>& reads = lazyReads[vtkVars[ff]];
+      if (!reads)
+      {
+        const bool isVector = cgnsVars[ff].isComponent;
+        reads = std::make_shared<LazyArrayReads>();
+        reads->FileName = self->FileName;
+        reads->CellDim = cellDim;
+        std::copy_n(fieldSrcStart, 3, reads->SrcStart);
+        std::copy_n(fieldSrcEnd, 3, reads->SrcEnd);
+        std::copy_n(fieldSrcStride, 3, reads->SrcStride);
+        std::copy_n(isVector ? fieldVectMemDims : fieldMemDims, 3, reads->MemDims);
+        std::copy_n(isVector ? fieldVectMemStart : fieldMemStart, 3, reads->MemStart);
+        std::copy_n(isVector ? fieldVectMemEnd : fieldMemEnd, 3, reads->MemEnd);
+        std::copy_n(isVector ? fieldVectMemStride : fieldMemStride, 3, reads->MemStride);
+      }
+      LazyArrayReads::Variable variable;
+      variable.NodePath =
+        self->Internals->CurrentZonePath + "/" + solutionNameStr + "/" + cgnsVars[ff].name;
+      variable.DataType = fieldDataType;
+      variable.Offset = cgnsVars[ff].isComponent ? cgnsVars[ff].xyzIndex - 1 : 0;
+      reads->Variables.push_back(variable);
+    }
     // quick transfer of data because data types is given by cgns database
-    if (!cgnsVars[ff].isComponent)
+    else if (!cgnsVars[ff].isComponent)
     {
       if (cgio_read_data_type(self->cgioNum, cgioVarId, fieldSrcStart, fieldSrcEnd, fieldSrcStride,
             fieldDataType, cellDim, fieldMemDims, fieldMemStart, fieldMemEnd, fieldMemStride,
@@ -1320,26 +1468,39 @@ int vtkCGNSReader::vtkPrivate::readSolution(const std::string& solutionNameStr,
       continue;
     }
 
-    if (!cgnsVars[nv].isComponent)
+    vtkDataArray* array = vtkVars[nv];
+    if (self->LoadArraysLazily && (!cgnsVars[nv].isComponent || cgnsVars[nv].xyzIndex == 1))
     {
-      dsa->AddArray(vtkVars[nv]);
+      // the lazy array is zero-filled beyond the physical dimension
+      array = NewLazyArray(vtkVars[nv], lazyReads[vtkVars[nv]], nVals);
       vtkVars[nv]->Delete();
+      if (array == nullptr)
+      {
+        vtkVars[nv] = nullptr;
+        continue;
+      }
+    }
+
+    if (!cgnsVars[nv].isComponent)
+    {
+      dsa->AddArray(array);
+      array->Delete();
     }
     else if (cgnsVars[nv].xyzIndex == 1)
     {
-      dsa->AddArray(vtkVars[nv]);
+      dsa->AddArray(array);
       if (!dsa->GetVectors() && requestedVectorDim == 3)
       {
-        dsa->SetVectors(vtkVars[nv]);
+        dsa->SetVectors(array);
       }
-      if (requestedVectorDim != physicalDim)
+      if (requestedVectorDim != physicalDim && !self->LoadArraysLazily)
       {
         for (int dim = physicalDim; dim < requestedVectorDim; dim++)
         {
-          vtkVars[nv]->FillComponent(dim, 0.0);
+          array->FillComponent(dim, 0.0);
         }
       }
-      vtkVars[nv]->Delete();
+      array->Delete();
     }
     vtkVars[nv] = nullptr;
   }
@@ -4776,6 +4937,7 @@ int vtkCGNSReader::RequestData(vtkInformation* vtkNotUsed(request),
       }
 
       this->currentZoneId = baseChildId[zone];
+      this->Internals->CurrentZonePath = vtkPrivate::GenerateMeshKey(curBaseInfo.name, zoneName);
 
       double zoneTypeId;
       zt = CGNS_ENUMV(Structured);
@@ -4957,6 +5119,7 @@ void vtkCGNSReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "CreateEachSolutionAsBlock: " << this->CreateEachSolutionAsBlock << endl;
   os << indent << "IgnoreFlowSolutionPointers: " << this->IgnoreFlowSolutionPointers << endl;
   os << indent << "DistributeBlocks: " << this->DistributeBlocks << endl;
+  os << indent << "LoadArraysLazily: " << this->LoadArraysLazily << endl;
   os << indent << "Controller: " << this->Controller << endl;
 }
 
@@ -271,6 +271,20 @@ public:
   vtkBooleanMacro(DistributeBlocks, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true (default is false), the arrays of the flow solutions are
+   * not read by RequestData. They are implicit arrays instead, which read
+   * their values from the file the first time one of them is accessed, so
+   * that enabling many arrays only costs the reading of those actually used.
+   * The file must thus remain available as long as such arrays are alive.
+   * Boundary condition and user defined data are always read at once.
+   */
+  vtkSetMacro(LoadArraysLazily, bool);
+  vtkGetMacro(LoadArraysLazily, bool);
+  vtkBooleanMacro(LoadArraysLazily, bool);
+  ///@}
+
   ///@{
   /**
    * This reader can cache the mesh points if they are time invariant.
@@ -363,6 +377,7 @@ private:
   bool CacheMesh = false;
   bool CacheConnectivity = false;
   bool Use3DVector = true;
+  bool LoadArraysLazily = false;
   int UnsteadySolutionStartTimestep = 0;
 
   // For internal cgio calls (low level IO)
@@ -13,9 +13,11 @@
 
 =========================================================================*/
 
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkConduitSource.h"
+#include "vtkDataArray.h"
 #include "vtkImageData.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
@@ -28,6 +30,8 @@
 
 #include <catalyst_conduit_blueprint.hpp>
 
+#include <vector>
+
 #define VERIFY(x, ...)                                                                             \
   if ((x) == false)                                                                                \
   {                                                                                                \
@@ -618,6 +622,36 @@ bool ValidateMeshTypeMixed2D()
   VERIFY(ug->GetNumberOfCells() == 24, "expected 24 cells, got %lld", ug->GetNumberOfCells());
   VERIFY(ug->GetNumberOfPoints() == 25, "Expected 25 points, got %lld", ug->GetNumberOfPoints());
 
+  // the cells are stored back to back: the connectivity must not be copied
+  VERIFY(ug->GetCells()->GetConnectivityArray()->GetVoidPointer(0) ==
+      mesh["topologies/mesh/elements/connectivity"].element_ptr(0),
+    "expected the connectivity to be shared with the conduit node");
+
+  // a field with strided components, as the members of an array of structures
+  std::vector<double> values(3 * 24);
+  for (size_t cc = 0; cc < values.size(); ++cc)
+  {
+    values[cc] = static_cast<double>(cc);
+  }
+  mesh["fields/strided/association"] = "element";
+  mesh["fields/strided/topology"] = "mesh";
+  mesh["fields/strided/values/x"].set_external_float64_ptr(
+    values.data(), 24, 0, 3 * sizeof(double));
+  mesh["fields/strided/values/y"].set_external_float64_ptr(
+    values.data(), 24, 2 * sizeof(double), 3 * sizeof(double));
+  const auto stridedData = Convert(mesh);
+  auto stridedUg = vtkUnstructuredGrid::SafeDownCast(
+    vtkPartitionedDataSet::SafeDownCast(stridedData)->GetPartition(0));
+  vtkDataArray* strided = stridedUg->GetCellData()->GetArray("strided");
+  VERIFY(strided != nullptr && strided->GetNumberOfComponents() == 2 &&
+      strided->GetNumberOfTuples() == 24,
+    "expected a strided array of 24 tuples with 2 components");
+  for (vtkIdType cc = 0; cc < 24; ++cc)
+  {
+    VERIFY(strided->GetComponent(cc, 0) == 3 * cc && strided->GetComponent(cc, 1) == 3 * cc + 2,
+      "wrong value in the strided array at tuple %lld", cc);
+  }
+
   // check cell types
   const auto it = vtkSmartPointer<vtkCellIterator>::Take(ug->NewCellIterator());
   int nTris(0), nQuads(0);
@@ -16,6 +16,9 @@
 
 #include "vtkArrayDispatch.h"
 #include "vtkCellArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImplicitArray.h"
 #include "vtkLogger.h"
 #include "vtkObjectFactory.h"
 #include "vtkSOADataArrayTemplate.h"
@@ -33,6 +36,7 @@
 #include <catalyst_conduit.hpp>
 #include <catalyst_conduit_blueprint.hpp>
 
+#include <cstring>
 #include <vector>
 
 namespace internals
@@ -96,6 +100,67 @@ vtkSmartPointer<vtkSOADataArrayTemplate<ValueT>> CreateSOArray(
   return array;
 }
 
+//----------------------------------------------------------------------------
+// internal: implicit array backend reading components stored with arbitrary
+// strides (in bytes) in the conduit buffers, e.g. the members of an array of
+// structures.
+template <typename ValueT>
+struct StridedBackend
+{
+  StridedBackend(
+    const std::vector<const char*>& pointers, const std::vector<conduit_index_t>& strides)
+    : Pointers(pointers)
+    , Strides(strides)
+  {
+  }
+
+  std::vector<const char*> Pointers;
+  std::vector<conduit_index_t> Strides;
+
+  ValueT operator()(vtkIdType index) const
+  {
+    const vtkIdType numComps = static_cast<vtkIdType>(this->Pointers.size());
+    const vtkIdType tuple = index / numComps;
+    const std::size_t comp = static_cast<std::size_t>(index % numComps);
+    ValueT value;
+    // the strides do not guarantee the alignment of the values
+    std::memcpy(&value, this->Pointers[comp] + tuple * this->Strides[comp], sizeof(ValueT));
+    return value;
+  }
+};
+
+template <typename ValueT>
+vtkSmartPointer<vtkDataArray> CreateStridedArray(vtkIdType number_of_tuples,
+  const std::vector<const char*>& raw_ptrs, const std::vector<conduit_index_t>& strides)
+{
+  auto array = vtkSmartPointer<vtkImplicitArray<StridedBackend<ValueT>>>::New();
+  array->ConstructBackend(raw_ptrs, strides);
+  array->SetNumberOfComponents(static_cast<int>(raw_ptrs.size()));
+  array->SetNumberOfTuples(number_of_tuples);
+  return array;
+}
+
+//----------------------------------------------------------------------------
+// internal: change components of arrays that are neither AOS nor SOA, by
+// copying them to an AOS array.
+static vtkSmartPointer<vtkDataArray> ChangeComponentsGeneric(
+  vtkDataArray* array, int num_components)
+{
+  vtkLogF(TRACE, "copying array '%s' to change its number of components",
+    array->GetName() ? array->GetName() : "");
+  vtkSmartPointer<vtkDataArray> result;
+  result.TakeReference(vtkDataArray::CreateDataArray(array->GetDataType()));
+  result->SetName(array->GetName());
+  result->SetNumberOfComponents(num_components);
+  result->SetNumberOfTuples(array->GetNumberOfTuples());
+  result->Fill(0.0);
+  for (int cc = 0, max = std::min(num_components, array->GetNumberOfComponents()); cc < max; ++cc)
+  {
+    result->CopyComponent(cc, array, cc);
+  }
+  return result;
+}
+
 //----------------------------------------------------------------------------
 // internal: change components helper.
 struct ChangeComponentsAOSImpl
@@ -299,12 +364,9 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
   }
   else
   {
-    // TODO: we can do a deep-copy in this case, so we can still handle it quite easily when needed.
-    vtkLogF(ERROR, "unsupported array layout.");
-    return nullptr;
+    return vtkConduitArrayUtilities::MCArrayToVTKStridedArray(
+      conduit_cpp::c_node(&mcarray), force_signed);
   }
-
-  return nullptr;
 }
 
 //----------------------------------------------------------------------------
@@ -420,6 +482,64 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKSOAArray(
   }
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKStridedArray(
+  const conduit_node* c_mcarray, bool force_signed)
+{
+  const conduit_cpp::Node mcarray = conduit_cpp::cpp_node(const_cast<conduit_node*>(c_mcarray));
+  const conduit_cpp::DataType dtype0 = mcarray.child(0).dtype();
+  const int num_components = static_cast<int>(mcarray.number_of_children());
+  const vtkIdType num_tuples = static_cast<vtkIdType>(dtype0.number_of_elements());
+
+  std::vector<const char*> ptrs;
+  std::vector<conduit_index_t> strides;
+  ptrs.reserve(num_components);
+  strides.reserve(num_components);
+  for (int cc = 0; cc < num_components; ++cc)
+  {
+    const auto child = mcarray.child(cc);
+    ptrs.push_back(reinterpret_cast<const char*>(child.element_ptr(0)));
+    strides.push_back(child.dtype().stride());
+  }
+
+  switch (internals::GetTypeId(dtype0.id(), force_signed))
+  {
+    case conduit_cpp::DataType::Id::int8:
+      return internals::CreateStridedArray<vtkTypeInt8>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::int16:
+      return internals::CreateStridedArray<vtkTypeInt16>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::int32:
+      return internals::CreateStridedArray<vtkTypeInt32>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::int64:
+      return internals::CreateStridedArray<vtkTypeInt64>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint8:
+      return internals::CreateStridedArray<vtkTypeUInt8>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint16:
+      return internals::CreateStridedArray<vtkTypeUInt16>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint32:
+      return internals::CreateStridedArray<vtkTypeUInt32>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint64:
+      return internals::CreateStridedArray<vtkTypeUInt64>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::float32:
+      return internals::CreateStridedArray<vtkTypeFloat32>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::float64:
+      return internals::CreateStridedArray<vtkTypeFloat64>(num_tuples, ptrs, strides);
+
+    default:
+      vtkLogF(ERROR, "unsupported data type '%s' ", dtype0.name().c_str());
+      return nullptr;
+  }
+}
+
 //----------------------------------------------------------------------------
 vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::SetNumberOfComponents(
   vtkDataArray* array, int num_components)
@@ -433,10 +553,14 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::SetNumberOfComponents(
   {
     return internals::ChangeComponentsAOS(array, num_components);
   }
-  else
+  else if (array->GetArrayType() == vtkAbstractArray::SoADataArrayTemplate)
   {
     return internals::ChangeComponentsSOA(array, num_components);
   }
+  else
+  {
+    return internals::ChangeComponentsGeneric(array, num_components);
+  }
 }
 
 struct NoOp
@@ -457,6 +581,15 @@ vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::MCArrayToVTKCellArray(
     return nullptr;
   }
 
+  if (!array->HasStandardMemoryLayout())
+  {
+    // vtkCellArray only accepts AOS arrays as connectivity.
+    vtkLogF(TRACE, "copying a connectivity array with strided or non-interleaved layout");
+    auto copy = vtkSmartPointer<vtkIdTypeArray>::New();
+    copy->DeepCopy(array);
+    array = copy;
+  }
+
   // now the array matches the type accepted by vtkCellArray (in most cases).
   vtkNew<vtkCellArray> cellArray;
   cellArray->SetData(cellSize, array);
@@ -469,6 +602,48 @@ namespace
 {
 VTK_ABI_NAMESPACE_BEGIN
 
+// Use `elements` as connectivity of the returned vtkCellArray when the cells
+// are stored back to back, in order, which is the layout of vtkCellArray: then
+// only the offsets, with one more value in VTK, are created. Otherwise returns
+// nullptr.
+template <typename ArrayT>
+vtkSmartPointer<vtkCellArray> ShareO2MConnectivity(
+  ArrayT* elements, vtkDataArray* sizes, vtkDataArray* offsets)
+{
+  using ValueType = typename ArrayT::ValueType;
+  if (elements->GetNumberOfComponents() != 1 || sizes->GetNumberOfComponents() != 1 ||
+    offsets->GetNumberOfComponents() != 1 ||
+    offsets->GetNumberOfTuples() != sizes->GetNumberOfTuples())
+  {
+    return nullptr;
+  }
+
+  const vtkIdType numCells = sizes->GetNumberOfTuples();
+  const auto sizesRange = vtk::DataArrayValueRange<1>(sizes);
+  const auto offsetsRange = vtk::DataArrayValueRange<1>(offsets);
+  vtkNew<ArrayT> cellOffsets;
+  cellOffsets->SetNumberOfValues(numCells + 1);
+  vtkIdType next = 0;
+  for (vtkIdType cc = 0; cc < numCells; ++cc)
+  {
+    if (static_cast<vtkIdType>(offsetsRange[cc]) != next)
+    {
+      return nullptr;
+    }
+    cellOffsets->SetValue(cc, static_cast<ValueType>(next));
+    next += static_cast<vtkIdType>(sizesRange[cc]);
+  }
+  if (next != elements->GetNumberOfValues())
+  {
+    return nullptr;
+  }
+  cellOffsets->SetValue(numCells, static_cast<ValueType>(next));
+
+  auto cells = vtkSmartPointer<vtkCellArray>::New();
+  cells->SetData(cellOffsets, elements);
+  return cells;
+}
+
 struct O2MRelationToVTKCellArrayWorker
 {
   vtkNew<vtkCellArray> Cells;
@@ -532,6 +707,25 @@ vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::O2MRelationToVTKCellArra
   const auto node_offsets = o2mrelation["offsets"];
   auto offsets = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
     conduit_cpp::c_node(&node_offsets), /*force_signed*/ true);
+  if (!sizes || !offsets)
+  {
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkCellArray> shared;
+  if (auto elements32 = vtkTypeInt32Array::SafeDownCast(elements))
+  {
+    shared = ::ShareO2MConnectivity(elements32, sizes, offsets);
+  }
+  else if (auto elements64 = vtkTypeInt64Array::SafeDownCast(elements))
+  {
+    shared = ::ShareO2MConnectivity(elements64, sizes, offsets);
+  }
+  if (shared)
+  {
+    return shared;
+  }
+  vtkLogF(TRACE, "copying the '%s' of a O2MRelation", leafname.c_str());
 
   O2MRelationToVTKCellArrayWorker worker;
 
@@ -18,9 +18,11 @@
  * @ingroup Insitu
  *
  * vtkConduitArrayUtilities is intended to convert Conduit nodes satisfying the
- * `mcarray` protocol to VTK arrays. It uses zero-copy, as much as possible.
- * Currently implementation fails if zero-copy is not possible. In future, that
- * may be changed to do a deep-copy (with appropriate warnings) if necessary.
+ * `mcarray` protocol to VTK arrays. It uses zero-copy, as much as possible:
+ * interleaved and contiguous components are wrapped in AOS and SOA arrays, and
+ * strided components in implicit arrays reading the conduit buffers. The few
+ * conversions that must copy the data (e.g. cells that are not stored back to
+ * back) report it at the TRACE verbosity of vtkLogger.
  *
  * This is primarily designed for use by vtkConduitSource.
  */
@@ -73,7 +75,11 @@ public:
     vtkDataArray* array, int num_components);
 
   /**
-   * Read a O2MRelation element
+   * Read a O2MRelation element.
+   *
+   * When the elements are 32 or 64 bit integers and the cells are stored back
+   * to back, in order, the elements are used as connectivity of the
+   * vtkCellArray without copy. Otherwise the cells are copied.
    */
   static vtkSmartPointer<vtkCellArray> O2MRelationToVTKCellArray(
     const conduit_node* o2mrelation, const std::string& leafname);
@@ -88,6 +94,8 @@ protected:
     const conduit_node* mcarray, bool force_signed);
   static vtkSmartPointer<vtkDataArray> MCArrayToVTKSOAArray(
     const conduit_node* mcarray, bool force_signed);
+  static vtkSmartPointer<vtkDataArray> MCArrayToVTKStridedArray(
+    const conduit_node* mcarray, bool force_signed);
 
 private:
   vtkConduitArrayUtilities(const vtkConduitArrayUtilities&) = delete;
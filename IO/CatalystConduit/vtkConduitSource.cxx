@@ -544,6 +544,32 @@ vtkSmartPointer<vtkDataSet> GetMesh(
         conduit_cpp::Node t_elementOffsets = topologyNode["elements/offsets"];
         conduit_cpp::Node t_elementConnectivity = topologyNode["elements/connectivity"];
 
+        if (!hasPolyhedra)
+        {
+          // the connectivity is used without copy when the cells are stored back to back, only
+          // the cell types are converted.
+          conduit_cpp::Node t_elements = topologyNode["elements"];
+          auto cellArray = vtkConduitArrayUtilities::O2MRelationToVTKCellArray(
+            conduit_cpp::c_node(&t_elements), "connectivity");
+          const auto elementShapesArray =
+            vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(&t_elementShapes));
+          if (cellArray == nullptr || elementShapesArray == nullptr)
+          {
+            throw std::runtime_error("elements/connectivity or shapes not available (nullptr)");
+          }
+
+          const auto elementShapesRange = vtk::DataArrayValueRange<1>(elementShapesArray);
+          vtkNew<vtkUnsignedCharArray> cellTypes;
+          cellTypes->SetNumberOfValues(elementShapesRange.size());
+          vtkIdType cellId = 0;
+          for (const auto cellType : elementShapesRange)
+          {
+            cellTypes->SetValue(cellId++, static_cast<unsigned char>(cellType));
+          }
+          ug->SetCells(cellTypes, cellArray);
+          return ug;
+        }
+
         auto elementConnectivity =
           vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(&t_elementConnectivity));
 
@@ -45,6 +45,7 @@
 #include "vtkPNGWriter.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
@@ -547,7 +548,7 @@ void TreeInformation::Compute()
 void TreeInformation::SaveTilesBuildings(bool mergeTilePolyData, size_t mergedTextureWidth)
 {
   MergePolyDataInfo info{ mergeTilePolyData, mergedTextureWidth };
-  this->PostOrderTraversal(&TreeInformation::SaveTileBuildings, this->Root, &info);
+  this->SaveTiles(&TreeInformation::SaveTileBuildings, &info);
 }
 
 void TreeInformation::WriteTileTexture(
@@ -576,14 +577,43 @@ void TreeInformation::SaveTilesMesh()
     textureImages[i] = GetTexture(this->TextureBaseDirectory, textureFileName);
   }
   SaveTileMeshData aux(vtkSelectionNode::CELL, textureImages);
-  this->PostOrderTraversal(&TreeInformation::SaveTileMesh, this->Root, &aux);
+  // cache the bounds, shared by the tiles saved concurrently
+  this->Mesh->GetBounds();
+  this->SaveTiles(&TreeInformation::SaveTileMesh, &aux);
 }
 
 //------------------------------------------------------------------------------
 void TreeInformation::SaveTilesPoints()
 {
   int selectionField = vtkSelectionNode::POINT;
-  this->PostOrderTraversal(&TreeInformation::SaveTilePoints, this->Root, &selectionField);
+  // cache the bounds, shared by the tiles saved concurrently
+  this->Points->GetBounds();
+  this->SaveTiles(&TreeInformation::SaveTilePoints, &selectionField);
+}
+
+//------------------------------------------------------------------------------
+void TreeInformation::SaveTiles(
+  void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux), void* aux)
+{
+  std::vector<vtkIncrementalOctreeNode*> tiles;
+  this->PostOrderTraversal(&TreeInformation::VisitCollectTile, this->Root, &tiles);
+  vtkLog(INFO, "Saving " << tiles.size() << " tiles...");
+  // a tile is expensive to save, one at a time is a good grain
+  vtkSMPTools::For(0, static_cast<vtkIdType>(tiles.size()), 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      (this->*Visit)(tiles[i], aux);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+void TreeInformation::VisitCollectTile(vtkIncrementalOctreeNode* node, void* aux)
+{
+  if (node->IsLeaf() && !this->EmptyNode[node->GetID()])
+  {
+    static_cast<std::vector<vtkIncrementalOctreeNode*>*>(aux)->push_back(node);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -1049,8 +1079,12 @@ void TreeInformation::SaveTileMesh(vtkIncrementalOctreeNode* node, void* voidAux
     selectionNode->SetContentType(vtkSelectionNode::INDICES);
     vtkNew<vtkSelection> selection;
     selection->AddNode(selectionNode);
+    // tiles are saved concurrently: use a copy of the mesh, as setting it as
+    // the input of a filter modifies its pipeline information
+    auto mesh = vtk::TakeSmartPointer(this->Mesh->NewInstance());
+    mesh->ShallowCopy(this->Mesh);
     vtkNew<vtkExtractSelection> extractSelection;
-    extractSelection->SetInputData(0, this->Mesh);
+    extractSelection->SetInputData(0, mesh);
     extractSelection->SetInputData(1, selection);
     vtkNew<vtkGeometryFilter> geometryFilter;
     geometryFilter->SetInputConnection(extractSelection->GetOutputPort());
@@ -1149,8 +1183,11 @@ void TreeInformation::SaveTilePoints(vtkIncrementalOctreeNode* node, void* voidA
   else if (node->IsLeaf() && !this->EmptyNode[node->GetID()])
   {
     vtkSmartPointer<vtkIdList> pointIds = node->GetPointIds();
+    // tiles are saved concurrently, see SaveTileMesh
+    auto points = vtk::TakeSmartPointer(this->Points->NewInstance());
+    points->ShallowCopy(this->Points);
     vtkNew<vtkCesiumPointCloudWriter> writer;
-    writer->SetInputDataObject(this->Points);
+    writer->SetInputDataObject(points);
     writer->SetPointIds(pointIds);
     std::ostringstream ostr;
     ostr << this->OutputDir << "/" << node->GetID();
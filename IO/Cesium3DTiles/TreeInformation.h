@@ -124,6 +124,14 @@ protected:
   void VisitCompute(vtkIncrementalOctreeNode* node, void* aux);
   void VisitComputeGeometricError(vtkIncrementalOctreeNode* node, void* aux);
   ///@}
+  /**
+   * Call 'Visit' for each non-empty leaf. These are the nodes that store a tile,
+   * and as tiles are independent from each other, they are saved concurrently
+   * using vtkSMPTools.
+   */
+  void SaveTiles(void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux),
+    void* aux);
+  void VisitCollectTile(vtkIncrementalOctreeNode* node, void* aux);
   void SaveTileBuildings(vtkIncrementalOctreeNode* node, void* auxData);
   void SaveTileMesh(vtkIncrementalOctreeNode* node, void* auxData);
   void WriteTileTexture(
@@ -28,6 +28,11 @@
  * should be implemented with this in mind to provide a predictable
  * compressor interface for vtkDataCompressor users.
  *
+ * @par Note:
+ * The XML writers and readers call the buffer Compress and Uncompress
+ * methods concurrently on independent blocks. Subclasses must not modify
+ * their state in CompressBuffer and UncompressBuffer.
+ *
  * @par Thanks:
  * Homogeneous CompressionLevel behavior contributed by Quincy Wofford
  * (qwofford@lanl.gov) and John Patchett (patchett@lanl.gov)
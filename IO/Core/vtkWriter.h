@@ -51,6 +51,7 @@ public:
    * well as StartMethod() and EndMethod() methods.
    * Returns 1 on success and 0 on failure.
    */
+  VTK_UNBLOCKTHREADS
   virtual int Write();
 
   /**
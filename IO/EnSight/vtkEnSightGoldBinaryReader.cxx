@@ -39,6 +39,7 @@
 #include <numeric>
 #include <string>
 #include <sys/stat.h>
+#include <utility>
 #include <vector>
 
 #if defined(_WIN32)
@@ -204,6 +205,9 @@ public:
   typedef std::map<MapKey, MapValue>::value_type value_type;
 
   std::map<MapKey, MapValue> Map;
+
+  // Number of time steps of the indexed files, with the file size at indexing
+  std::map<MapKey, std::pair<int, vtkTypeUInt64>> NumberOfTimeSteps;
 };
 
 // This is half the precision of an int.
@@ -412,8 +416,8 @@ int vtkEnSightGoldBinaryReader::ReadGeometryFile(
     return 0;
   }
 
-  // this will close the file, so we need to reinitialize it
-  int numberOfTimeStepsInFile = this->CountTimeSteps();
+  // this may close the file, so we need to reinitialize it
+  int numberOfTimeStepsInFile = this->IndexTimeSteps(fileName);
 
   if (!this->InitializeFile(fileName))
   {
@@ -589,6 +593,40 @@ int vtkEnSightGoldBinaryReader::CountTimeSteps()
   return count;
 }
 
+//------------------------------------------------------------------------------
+int vtkEnSightGoldBinaryReader::IndexTimeSteps(const char* fileName)
+{
+  auto indexed = this->FileOffsets->NumberOfTimeSteps.find(fileName);
+  if (indexed != this->FileOffsets->NumberOfTimeSteps.end() &&
+    indexed->second.second == this->FileSize)
+  {
+    return indexed->second.first;
+  }
+
+  // the file is new or has changed: forget its offsets and scan it
+  this->FileOffsets->Map.erase(fileName);
+  char line[80];
+  int count = 0;
+  while (this->ReadLine(line))
+  {
+    if (strncmp(line, "BEGIN TIME STEP", 15) != 0)
+    {
+      continue;
+    }
+    this->AddTimeStepToCache(fileName, count, this->GoldIFile->tellg());
+
+    // let SkipTimeStep read the "BEGIN TIME STEP" line again
+    this->GoldIFile->seekg(-80l, ios::cur);
+    if (!this->SkipTimeStep())
+    {
+      break;
+    }
+    count++;
+  }
+  this->FileOffsets->NumberOfTimeSteps[fileName] = std::make_pair(count, this->FileSize);
+  return count;
+}
+
 //------------------------------------------------------------------------------
 int vtkEnSightGoldBinaryReader::SkipTimeStep()
 {
@@ -1553,6 +1591,11 @@ bool vtkEnSightGoldBinaryReader::SkipToTimeStep(const char* fileName, int timeSt
   {
     // keep on advancing;
   }
+  if (this->GoldIFile->good() && strncmp(line, "BEGIN TIME STEP", 15) == 0)
+  {
+    // found the time step -> cache it
+    this->AddTimeStepToCache(fileName, timeStep - 1, this->GoldIFile->tellg());
+  }
 
   return true;
 }
@@ -211,6 +211,14 @@ protected:
    */
   int CountTimeSteps();
 
+  /**
+   * Like CountTimeSteps, but also adds the offset of every time step of the
+   * geometry file to the time step cache, so that any time step can then be
+   * reached with a single seek. The count is cached as well, and the file
+   * only scanned again when its size changes.
+   */
+  int IndexTimeSteps(const char* fileName);
+
   ///@{
   /**
    * Read to the next time step in the geometry file.
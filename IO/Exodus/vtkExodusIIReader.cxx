@@ -19,10 +19,12 @@
 #include "vtkExodusIIReader.h"
 #include "vtkExodusIICache.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellType.h"
 #include "vtkCharArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDoubleArray.h"
 #include "vtkExodusIIReaderParser.h"
 #include "vtkFloatArray.h"
@@ -40,6 +42,7 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkStdString.h"
@@ -216,6 +219,61 @@ static void extractTruthForVar(
   }
 }
 
+// Exodus doesn't support reading with a stride, so the components of an array
+// are read one at a time and interleaved here, in parallel. The components of
+// arr past the ones read are zeroed (2-D vectors are embedded in 3-D).
+struct vtkExodusIIInterleaveWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* arr, const std::vector<std::vector<double>>& components)
+  {
+    using ValueType = vtk::GetAPIType<ArrayT>;
+    const int numComps = arr->GetNumberOfComponents();
+    const int numRead = std::min(numComps, static_cast<int>(components.size()));
+    vtkSMPTools::For(0, arr->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      auto tuples = vtk::DataArrayTupleRange(arr, begin, end);
+      for (vtkIdType t = begin; t < end; ++t)
+      {
+        auto tuple = tuples[t - begin];
+        int c;
+        for (c = 0; c < numRead; ++c)
+        {
+          tuple[c] = static_cast<ValueType>(components[c][t]);
+        }
+        for (; c < numComps; ++c)
+        {
+          tuple[c] = static_cast<ValueType>(0);
+        }
+      }
+    });
+  }
+};
+
+static void vtkExodusIIInterleaveComponents(
+  const std::vector<std::vector<double>>& components, vtkDataArray* arr)
+{
+  vtkExodusIIInterleaveWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(arr, worker, components))
+  {
+    worker(arr, components);
+  }
+}
+
+// Copy the tuples of src at the points kept for a block into dest, in
+// parallel. dest must have one tuple per point kept.
+static void vtkExodusIISqueezeTuples(
+  vtkDataArray* src, vtkDataArray* dest, const std::map<vtkIdType, vtkIdType>& pointMap)
+{
+  std::vector<std::pair<vtkIdType, vtkIdType>> pointPairs(pointMap.begin(), pointMap.end());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(pointPairs.size()),
+    [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        dest->SetTuple(pointPairs[i].second, pointPairs[i].first, src);
+      }
+    });
+}
+
 static void printBlock(
   ostream& os, vtkIndent indent, int btyp, vtkExodusIIReaderPrivate::BlockInfoType& binfo)
 {
@@ -554,11 +612,7 @@ int vtkExodusIIReaderPrivate::AssembleOutputPoints(
   if (this->SqueezePoints)
   {
     pts->SetNumberOfPoints(bsinfop->NextSqueezePoint);
-    std::map<vtkIdType, vtkIdType>::iterator it;
-    for (it = bsinfop->PointMap.begin(); it != bsinfop->PointMap.end(); ++it)
-    {
-      pts->SetPoint(it->second, arr->GetTuple(it->first));
-    }
+    vtkExodusIISqueezeTuples(arr, pts->GetData(), bsinfop->PointMap);
   }
   else
   {
@@ -1384,17 +1438,7 @@ void vtkExodusIIReaderPrivate::AddPointArray(
     dest->SetName(src->GetName());
     dest->SetNumberOfComponents(src->GetNumberOfComponents());
     dest->SetNumberOfTuples(bsinfop->NextSqueezePoint);
-    std::map<vtkIdType, vtkIdType>::iterator it, itEnd;
-    //
-    // I moved the end condition of the loop out of the for(;;) loop.
-    //   Assuming it doesn't change within the loop itself!
-    //   The reason is that the code was making the call every loop.
-    //
-    itEnd = bsinfop->PointMap.end();
-    for (it = bsinfop->PointMap.begin(); it != itEnd; ++it)
-    {
-      pd->CopyTuple(src, dest, it->first, it->second);
-    }
+    vtkExodusIISqueezeTuples(src, dest, bsinfop->PointMap);
     pd->AddArray(dest);
     dest->FastDelete();
   }
@@ -1672,36 +1716,7 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
           return nullptr;
         }
       }
-      int t;
-      std::vector<double> tmpTuple;
-      tmpTuple.resize(ncomps);
-      tmpTuple[ncomps - 1] = 0.; // In case we're embedding a 2-D vector in 3-D
-
-      //
-      // Lets unroll the most common case - components == 3.
-      //
-      if (ainfop->Components == 3)
-      {
-        int maxTuples = arr->GetNumberOfTuples();
-        for (t = 0; t < maxTuples; ++t)
-        {
-          tmpTuple[0] = tmpVal[0][t];
-          tmpTuple[1] = tmpVal[1][t];
-          tmpTuple[2] = tmpVal[2][t];
-          arr->SetTuple(t, tmpTuple.data());
-        }
-      }
-      else
-      {
-        for (t = 0; t < arr->GetNumberOfTuples(); ++t)
-        {
-          for (c = 0; c < ainfop->Components; ++c)
-          {
-            tmpTuple[c] = tmpVal[c][t];
-          }
-          arr->SetTuple(t, tmpTuple.data());
-        }
-      }
+      vtkExodusIIInterleaveComponents(tmpVal, arr);
     }
   }
   else if (key.ObjectType == vtkExodusIIReader::GLOBAL_TEMPORAL)
@@ -1734,17 +1749,7 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
           return nullptr;
         }
       }
-      int t;
-      std::vector<double> tmpTuple;
-      tmpTuple.resize(ainfop->Components);
-      for (t = 0; t < arr->GetNumberOfTuples(); ++t)
-      {
-        for (c = 0; c < ainfop->Components; ++c)
-        {
-          tmpTuple[c] = tmpVal[c][t];
-        }
-        arr->SetTuple(t, tmpTuple.data());
-      }
+      vtkExodusIIInterleaveComponents(tmpVal, arr);
     }
     else if (ex_get_var_time(exoid, EX_GLOBAL, ainfop->OriginalIndices[0], key.ObjectId, 1,
                this->GetNumberOfTimeSteps(), arr->GetVoidPointer(0)) < 0)
@@ -1797,17 +1802,7 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
           return nullptr;
         }
       }
-      int t;
-      std::vector<double> tmpTuple;
-      tmpTuple.resize(ainfop->Components);
-      for (t = 0; t < arr->GetNumberOfTuples(); ++t)
-      {
-        for (c = 0; c < ainfop->Components; ++c)
-        {
-          tmpTuple[c] = tmpVal[c][t];
-        }
-        arr->SetTuple(t, tmpTuple.data());
-      }
+      vtkExodusIIInterleaveComponents(tmpVal, arr);
     }
   }
   else if (key.ObjectType == vtkExodusIIReader::ELEM_BLOCK_TEMPORAL)
@@ -1850,17 +1845,7 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
           return nullptr;
         }
       }
-      int t;
-      std::vector<double> tmpTuple;
-      tmpTuple.resize(ainfop->Components);
-      for (t = 0; t < arr->GetNumberOfTuples(); ++t)
-      {
-        for (c = 0; c < ainfop->Components; ++c)
-        {
-          tmpTuple[c] = tmpVal[c][t];
-        }
-        arr->SetTuple(t, tmpTuple.data());
-      }
+      vtkExodusIIInterleaveComponents(tmpVal, arr);
     }
   }
   else if (key.ObjectType == vtkExodusIIReader::EDGE_BLOCK ||
@@ -1919,23 +1904,10 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
             << ainfop->OriginalNames[c] << " for " << objtype_names[otypidx] << " " << oinfop->Id
             << ".");
           arr->Delete();
-          arr = nullptr;
-        }
-      }
-      // Carefully use arr->GetNumberOfComponents() when sizing
-      // output as we may have promoted 2-D arrays to 3-D.
-      int t = arr->GetNumberOfComponents();
-      std::vector<double> tmpTuple;
-      tmpTuple.resize(t);
-      tmpTuple[t - 1] = 0.;
-      for (t = 0; t < arr->GetNumberOfTuples(); ++t)
-      {
-        for (c = 0; c < ainfop->Components; ++c)
-        {
-          tmpTuple[c] = tmpVal[c][t];
+          return nullptr;
         }
-        arr->SetTuple(t, tmpTuple.data());
       }
+      vtkExodusIIInterleaveComponents(tmpVal, arr);
     }
   }
   else if (key.ObjectType == vtkExodusIIReader::NODE_MAP ||
@@ -2588,76 +2560,33 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
       displ = this->FindDisplacementVectors(key.Time);
     }
 
-    std::vector<double> coordTmp;
     vtkDoubleArray* darr = vtkDoubleArray::New();
     arr = darr;
     arr->SetNumberOfComponents(3);
     arr->SetNumberOfTuples(this->ModelParameters.num_nodes);
     int dim = this->ModelParameters.num_dim;
     int c;
-    vtkIdType t;
-    double* xc = nullptr;
-    double* yc = nullptr;
-    double* zc = nullptr;
-    coordTmp.resize(this->ModelParameters.num_nodes);
+    if (dim < 1 || dim > 3)
+    {
+      vtkErrorMacro("Bad dimension " << dim << " when reading point coordinates.");
+      arr->Delete();
+      return nullptr;
+    }
+    // Read all the coordinates at once, and interleave them in parallel
+    std::vector<std::vector<double>> coordTmp(dim);
+    double* coordPtrs[3] = { nullptr, nullptr, nullptr };
     for (c = 0; c < dim; ++c)
     {
-      switch (c)
-      {
-        case 0:
-          xc = coordTmp.data();
-          break;
-        case 1:
-          yc = xc;
-          xc = nullptr;
-          break;
-        case 2:
-          zc = yc;
-          yc = nullptr;
-          break;
-        default:
-          vtkErrorMacro("Bad coordinate index " << c << " when reading point coordinates.");
-          xc = yc = zc = nullptr;
-      }
-      if (ex_get_coord(exoid, xc, yc, zc) < 0)
-      {
-        vtkErrorMacro("Unable to read node coordinates for index " << c << ".");
-        arr->Delete();
-        arr = nullptr;
-        break;
-      }
-      double* cptr = darr->GetPointer(c);
-
-      //
-      // num_nodes can get big.  Lets unroll the loop
-      //
-      for (t = 0; t + 8 < this->ModelParameters.num_nodes; t += 8)
-      {
-        *(cptr + 3 * 0) = coordTmp[t + 0];
-        *(cptr + 3 * 1) = coordTmp[t + 1];
-        *(cptr + 3 * 2) = coordTmp[t + 2];
-        *(cptr + 3 * 3) = coordTmp[t + 3];
-        *(cptr + 3 * 4) = coordTmp[t + 4];
-        *(cptr + 3 * 5) = coordTmp[t + 5];
-        *(cptr + 3 * 6) = coordTmp[t + 6];
-        *(cptr + 3 * 7) = coordTmp[t + 7];
-        cptr += 3 * 8;
-      }
-
-      for (; t < this->ModelParameters.num_nodes; ++t)
-      {
-        *cptr = coordTmp[t];
-        cptr += 3;
-      }
+      coordTmp[c].resize(this->ModelParameters.num_nodes + 1); // + 1 to avoid errors when N == 0.
+      coordPtrs[c] = coordTmp[c].data();
     }
-    if (dim < 3)
+    if (ex_get_coord(exoid, coordPtrs[0], coordPtrs[1], coordPtrs[2]) < 0)
     {
-      double* cptr = darr->GetPointer(2);
-      for (t = 0; t < this->ModelParameters.num_nodes; ++t, cptr += 3)
-      {
-        *cptr = 0.;
-      }
+      vtkErrorMacro("Unable to read node coordinates.");
+      arr->Delete();
+      return nullptr;
     }
+    vtkExodusIIInterleaveComponents(coordTmp, arr);
     //
     // Unrolling some of the inner loops for the most common case - dim 3.
     // Also moving the maxTuples from inside of the for(;;) loops
@@ -94,6 +94,32 @@ int TestFFMPEGWriter(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     cerr << "ERROR: 2 - Test failing because TestFFMPEGWriter.avi file has zero length..." << endl;
   }
 
+  // same, encoding the frames in a background thread
+  w = vtkFFMPEGWriter::New();
+  w->SetInputConnection(colorize->GetOutputPort());
+  w->SetFileName("TestFFMPEGWriterAsync.avi");
+  cout << "Writing file TestFFMPEGWriterAsync.avi..." << endl;
+  w->AsynchronousEncodingOn();
+  w->SetMaximumNumberOfQueuedFrames(4);
+  w->Start();
+  for (cc = 2; cc < 99; cc++)
+  {
+    Fractal0->SetMaximumNumberOfIterations(cc);
+    w->Write();
+  }
+  w->End();
+  int writeError = w->GetError();
+  w->Delete();
+
+  length = vtksys::SystemTools::FileLength("TestFFMPEGWriterAsync.avi");
+  cout << "TestFFMPEGWriterAsync.avi file length: " << length << endl;
+  if (writeError || 0 == length)
+  {
+    err = 3;
+    cerr << "ERROR: 3 - Test failing because TestFFMPEGWriterAsync.avi was not written..." << endl;
+  }
+  vtksys::SystemTools::RemoveFile("TestFFMPEGWriterAsync.avi");
+
   colorize->Delete();
   table->Delete();
   cast->Delete();
@@ -19,6 +19,13 @@
 #include "vtkImageData.h"
 #include "vtkObjectFactory.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 extern "C"
 {
 #include <libavcodec/avcodec.h>
@@ -35,7 +42,9 @@ extern "C"
 #if defined(LIBAVFORMAT_VERSION_MAJOR) && LIBAVFORMAT_VERSION_MAJOR >= 57
 extern "C"
 {
+#include <libavutil/dict.h>
 #include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
 }
 #endif
 
@@ -50,7 +59,7 @@ public:
 
   int Start();
   int Write(vtkImageData* id);
-  void End();
+  int End();
 
   int Dim[2];
   int FrameRate;
@@ -71,6 +80,24 @@ private:
 
   int openedFile;
   int closedFile;
+
+#if defined(LIBAVFORMAT_VERSION_MAJOR) && LIBAVFORMAT_VERSION_MAJOR >= 57
+  int EncodeFrame(const unsigned char* rgb);
+  void EncodeQueuedFrames();
+
+  SwsContext* swsContext;
+
+  // Flipped RGB frames waiting for the encoding thread, and the buffers of
+  // the frames already encoded, reused for the next ones.
+  std::thread EncodingThread;
+  std::mutex QueueMutex;
+  std::condition_variable QueueCondition;
+  std::deque<std::vector<unsigned char>> PendingFrames;
+  std::vector<std::vector<unsigned char>> FreeFrames;
+  size_t MaximumNumberOfQueuedFrames;
+  bool StopEncoding;
+  std::atomic<bool> EncodingFailed;
+#endif
 };
 
 //------------------------------------------------------------------------------
@@ -89,10 +116,19 @@ vtkFFMPEGWriterInternal::vtkFFMPEGWriterInternal(vtkFFMPEGWriter* creator)
   this->rgbInput = nullptr;
   this->yuvOutput = nullptr;
 
+  this->avCodecContext = nullptr;
+
   this->openedFile = 0;
   this->closedFile = 1;
 
   this->FrameRate = 25;
+
+#if defined(LIBAVFORMAT_VERSION_MAJOR) && LIBAVFORMAT_VERSION_MAJOR >= 57
+  this->swsContext = nullptr;
+  this->MaximumNumberOfQueuedFrames = 8;
+  this->StopEncoding = false;
+  this->EncodingFailed = false;
+#endif
 }
 
 //------------------------------------------------------------------------------
@@ -107,27 +143,65 @@ vtkFFMPEGWriterInternal::~vtkFFMPEGWriterInternal()
 // for newer versions of ffmpeg use the new API as the old has been deprecated
 #if defined(LIBAVFORMAT_VERSION_MAJOR) && LIBAVFORMAT_VERSION_MAJOR >= 57
 
+namespace
+{
+// First pixel format supported by the encoder that lives in system memory.
+// Hardware encoders also list their own surface formats, to which they upload
+// the frames given in the software ones.
+AVPixelFormat vtkFFMPEGSoftwarePixelFormat(const AVCodec* codec)
+{
+  for (const AVPixelFormat* fmt = codec->pix_fmts; fmt && *fmt != AV_PIX_FMT_NONE; ++fmt)
+  {
+    const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(*fmt);
+    if (desc && !(desc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+    {
+      return *fmt;
+    }
+  }
+  return AV_PIX_FMT_YUV420P;
+}
+}
+
 //------------------------------------------------------------------------------
 int vtkFFMPEGWriterInternal::Start()
 {
   this->closedFile = 0;
+  // nothing is to be flushed until the header is written
+  this->EncodingFailed = true;
 
 #ifdef NDEBUG
   av_log_set_level(AV_LOG_ERROR);
 #endif
 
-  // choose avi media file format
-  this->avOutputFormat = av_guess_format("avi", nullptr, nullptr);
+  // look for the encoder asked for by name, if any
+  const char* encoderName = this->Writer->GetEncoderName();
+  vtk_ff_const59 AVCodec* codec = nullptr;
+  if (encoderName && *encoderName)
+  {
+    codec = avcodec_find_encoder_by_name(encoderName);
+    if (!codec)
+    {
+      vtkGenericWarningMacro(<< "Encoder " << encoderName
+                             << " is not available, using the default encoder.");
+    }
+  }
+
+  // choose avi media file format, unless the file name tells otherwise for
+  // the encoder asked for
+  if (codec)
+  {
+    this->avOutputFormat = av_guess_format(nullptr, this->Writer->GetFileName(), nullptr);
+  }
+  if (!this->avOutputFormat)
+  {
+    this->avOutputFormat = av_guess_format("avi", nullptr, nullptr);
+  }
   if (!this->avOutputFormat)
   {
     vtkGenericWarningMacro(<< "Could not open the avi media file format.");
     return 0;
   }
 
-  enum AVCodecID video_codec = this->Writer->GetCompression()
-    ? AV_CODEC_ID_MJPEG // choose a codec that is easily playable on windows
-    : AV_CODEC_ID_RAWVIDEO;
-
   // create the format context that wraps all of the media output structures
   if (avformat_alloc_output_context2(
         &this->avFormatContext, this->avOutputFormat, nullptr, this->Writer->GetFileName()) < 0)
@@ -136,8 +210,14 @@ int vtkFFMPEGWriterInternal::Start()
     return 0;
   }
 
-  vtk_ff_const59 AVCodec* codec;
-  if (!(codec = avcodec_find_encoder(video_codec)))
+  if (!codec)
+  {
+    enum AVCodecID video_codec = this->Writer->GetCompression()
+      ? AV_CODEC_ID_MJPEG // choose a codec that is easily playable on windows
+      : AV_CODEC_ID_RAWVIDEO;
+    codec = avcodec_find_encoder(video_codec);
+  }
+  if (!codec)
   {
     vtkGenericWarningMacro(<< "Failed to get video codec.");
     return 0;
@@ -158,11 +238,15 @@ int vtkFFMPEGWriterInternal::Start()
     return 0;
   }
 
-  this->avStream->codecpar->codec_id = video_codec;
+  this->avStream->codecpar->codec_id = codec->id;
   this->avStream->codecpar->codec_type = AVMEDIA_TYPE_VIDEO;
   this->avStream->codecpar->width = this->Dim[0];
   this->avStream->codecpar->height = this->Dim[1];
-  if (this->Writer->GetCompression())
+  if (codec->id != AV_CODEC_ID_MJPEG && codec->id != AV_CODEC_ID_RAWVIDEO)
+  {
+    this->avStream->codecpar->format = vtkFFMPEGSoftwarePixelFormat(codec);
+  }
+  else if (codec->id == AV_CODEC_ID_MJPEG)
   {
     this->avStream->codecpar->format = AV_PIX_FMT_YUVJ420P;
   }
@@ -216,23 +300,40 @@ int vtkFFMPEGWriterInternal::Start()
   }
   avcodec_parameters_from_context(this->avStream->codecpar, this->avCodecContext);
 
-  if (avcodec_open2(this->avCodecContext, codec, nullptr) < 0)
+  AVDictionary* options = nullptr;
+  const char* encoderOptions = this->Writer->GetEncoderOptions();
+  if (encoderOptions && av_dict_parse_string(&options, encoderOptions, "=", ":", 0) < 0)
+  {
+    vtkGenericWarningMacro(<< "Could not parse the encoder options " << encoderOptions << ".");
+    av_dict_free(&options);
+    return 0;
+  }
+  int openResult = avcodec_open2(this->avCodecContext, codec, &options);
+  // the options left are the ones the encoder did not know about
+  for (AVDictionaryEntry* entry = av_dict_get(options, "", nullptr, AV_DICT_IGNORE_SUFFIX); entry;
+       entry = av_dict_get(options, "", entry, AV_DICT_IGNORE_SUFFIX))
+  {
+    vtkGenericWarningMacro(<< "Unknown encoder option " << entry->key << ".");
+  }
+  av_dict_free(&options);
+  if (openResult < 0)
   {
     vtkGenericWarningMacro(<< "Could not open codec.");
     return 0;
   }
+  // the stream parameters may have been completed by the encoder
+  avcodec_parameters_from_context(this->avStream->codecpar, this->avCodecContext);
 
-  // for the output of the writer's input...
-  this->rgbInput = av_frame_alloc();
-  if (!this->rgbInput)
+  // converts the writer's input to the codec's input...
+  this->swsContext =
+    sws_getContext(this->avCodecContext->width, this->avCodecContext->height, AV_PIX_FMT_RGB24,
+      this->avCodecContext->width, this->avCodecContext->height, this->avCodecContext->pix_fmt,
+      SWS_BICUBIC, nullptr, nullptr, nullptr);
+  if (!this->swsContext)
   {
-    vtkGenericWarningMacro(<< "Could not make rgbInput avframe.");
+    vtkGenericWarningMacro(<< "swscale context initialization failed");
     return 0;
   }
-  this->rgbInput->format = AV_PIX_FMT_RGB24;
-  this->rgbInput->width = this->avCodecContext->width;
-  this->rgbInput->height = this->avCodecContext->height;
-  av_frame_get_buffer(this->rgbInput, 1);
 
   // and for the output to the codec's input.
   this->yuvOutput = av_frame_alloc();
@@ -263,49 +364,137 @@ int vtkFFMPEGWriterInternal::Start()
     vtkGenericWarningMacro(<< "Could not allocate avcodec private data.");
     return 0;
   }
+
+  // from now on, the encoding thread owns the codec and the format contexts
+  this->EncodingFailed = false;
+  if (this->Writer->GetAsynchronousEncoding())
+  {
+    this->MaximumNumberOfQueuedFrames =
+      static_cast<size_t>(this->Writer->GetMaximumNumberOfQueuedFrames());
+    this->StopEncoding = false;
+    this->EncodingThread = std::thread(&vtkFFMPEGWriterInternal::EncodeQueuedFrames, this);
+  }
   return 1;
 }
 
 //------------------------------------------------------------------------------
 int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
 {
-  this->Writer->GetInputAlgorithm(0, 0)->UpdateWholeExtent();
+  if (this->EncodingFailed)
+  {
+    return 0;
+  }
+
+  const int width = this->avCodecContext->width;
+  const int height = this->avCodecContext->height;
+  const size_t rowSize = static_cast<size_t>(width) * 3;
+
+  // reuse the buffer of a frame already encoded if any
+  std::vector<unsigned char> frame;
+  {
+    std::lock_guard<std::mutex> lock(this->QueueMutex);
+    if (!this->FreeFrames.empty())
+    {
+      frame = std::move(this->FreeFrames.back());
+      this->FreeFrames.pop_back();
+    }
+  }
+  frame.resize(rowSize * height);
 
   // copy the image from the input to the RGB buffer while flipping Y
-  unsigned char* rgb = (unsigned char*)id->GetScalarPointer();
-  unsigned char* src;
-  for (int y = 0; y < this->avCodecContext->height; y++)
+  const unsigned char* rgb = static_cast<const unsigned char*>(id->GetScalarPointer());
+  for (int y = 0; y < height; y++)
   {
-    src = rgb + (this->avCodecContext->height - y - 1) * this->avCodecContext->width * 3; // flip Y
-    unsigned char* dest = &this->rgbInput->data[0][y * this->rgbInput->linesize[0]];
-    memcpy((void*)dest, (void*)src, this->avCodecContext->width * 3);
+    memcpy(&frame[y * rowSize], rgb + (height - y - 1) * rowSize, rowSize);
   }
 
-  // convert that to YUV for input to the codec
-  SwsContext* convert_ctx =
-    sws_getContext(this->avCodecContext->width, this->avCodecContext->height, AV_PIX_FMT_RGB24,
-      this->avCodecContext->width, this->avCodecContext->height, this->avCodecContext->pix_fmt,
-      SWS_BICUBIC, nullptr, nullptr, nullptr);
+  if (!this->EncodingThread.joinable())
+  {
+    int result = this->EncodeFrame(frame.data());
+    this->FreeFrames.push_back(std::move(frame));
+    return result;
+  }
 
-  if (convert_ctx == nullptr)
+  // queue the frame for the encoding thread, waiting for room if needed
+  std::unique_lock<std::mutex> lock(this->QueueMutex);
+  this->QueueCondition.wait(lock, [this] {
+    return this->PendingFrames.size() < this->MaximumNumberOfQueuedFrames || this->EncodingFailed;
+  });
+  if (this->EncodingFailed)
   {
-    vtkGenericWarningMacro(<< "swscale context initialization failed");
     return 0;
   }
+  this->PendingFrames.push_back(std::move(frame));
+  this->QueueCondition.notify_all();
+  return 1;
+}
 
-  int result = sws_scale(convert_ctx, this->rgbInput->data, this->rgbInput->linesize, 0,
-    this->avCodecContext->height, this->yuvOutput->data, this->yuvOutput->linesize);
+//------------------------------------------------------------------------------
+void vtkFFMPEGWriterInternal::EncodeQueuedFrames()
+{
+  std::unique_lock<std::mutex> lock(this->QueueMutex);
+  for (;;)
+  {
+    this->QueueCondition.wait(
+      lock, [this] { return !this->PendingFrames.empty() || this->StopEncoding; });
+    if (this->PendingFrames.empty())
+    {
+      // stopped, and all the frames have been encoded
+      return;
+    }
+    std::vector<unsigned char> frame = std::move(this->PendingFrames.front());
+    this->PendingFrames.pop_front();
 
-  sws_freeContext(convert_ctx);
+    lock.unlock();
+    bool encoded = this->EncodeFrame(frame.data()) != 0;
+    lock.lock();
 
-  if (!result)
-  {
-    vtkGenericWarningMacro(<< "sws_scale() failed");
-    return 0;
+    this->FreeFrames.push_back(std::move(frame));
+    if (!encoded)
+    {
+      this->EncodingFailed = true;
+      this->PendingFrames.clear();
+    }
+    this->QueueCondition.notify_all();
+    if (!encoded)
+    {
+      return;
+    }
   }
+}
 
-  int ret = avcodec_send_frame(this->avCodecContext, this->yuvOutput);
-  this->yuvOutput->pts++;
+//------------------------------------------------------------------------------
+int vtkFFMPEGWriterInternal::EncodeFrame(const unsigned char* rgb)
+{
+  int ret;
+  if (rgb)
+  {
+    // the encoder may still reference the previous frame
+    if (av_frame_make_writable(this->yuvOutput) < 0)
+    {
+      vtkGenericWarningMacro(<< "Could not make yuvOutput avframe writable.");
+      return 0;
+    }
+
+    // convert that to YUV for input to the codec
+    const uint8_t* srcData[1] = { rgb };
+    const int srcStride[1] = { this->avCodecContext->width * 3 };
+    int result = sws_scale(this->swsContext, srcData, srcStride, 0, this->avCodecContext->height,
+      this->yuvOutput->data, this->yuvOutput->linesize);
+    if (!result)
+    {
+      vtkGenericWarningMacro(<< "sws_scale() failed");
+      return 0;
+    }
+
+    ret = avcodec_send_frame(this->avCodecContext, this->yuvOutput);
+    this->yuvOutput->pts++;
+  }
+  else
+  {
+    // flush the frames delayed by the encoder
+    ret = avcodec_send_frame(this->avCodecContext, nullptr);
+  }
 
   if (ret < 0)
   {
@@ -323,11 +512,14 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
     ret = avcodec_receive_packet(this->avCodecContext, pkt);
     if (!ret)
     {
+      av_packet_rescale_ts(pkt, this->avCodecContext->time_base, this->avStream->time_base);
       pkt->stream_index = this->avStream->index;
       int wret = av_write_frame(this->avFormatContext, pkt);
+      av_packet_unref(pkt);
       if (wret < 0)
       {
         vtkGenericWarningMacro(<< "Problem encoding frame.");
+        av_packet_free(&pkt);
         return 0;
       }
     }
@@ -338,8 +530,35 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
 }
 
 //------------------------------------------------------------------------------
-void vtkFFMPEGWriterInternal::End()
+int vtkFFMPEGWriterInternal::End()
 {
+  // let the encoding thread encode the frames left
+  if (this->EncodingThread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->QueueMutex);
+      this->StopEncoding = true;
+    }
+    this->QueueCondition.notify_all();
+    this->EncodingThread.join();
+  }
+  this->PendingFrames.clear();
+  this->FreeFrames.clear();
+
+  if (this->openedFile && this->avCodecContext && this->yuvOutput && !this->EncodingFailed)
+  {
+    if (!this->EncodeFrame(nullptr))
+    {
+      this->EncodingFailed = true;
+    }
+  }
+
+  if (this->swsContext)
+  {
+    sws_freeContext(this->swsContext);
+    this->swsContext = nullptr;
+  }
+
   if (this->yuvOutput)
   {
     av_frame_free(&this->yuvOutput);
@@ -381,6 +600,8 @@ void vtkFFMPEGWriterInternal::End()
   }
 
   this->closedFile = 1;
+
+  return this->EncodingFailed ? 0 : 1;
 }
 
 // for old versions of ffmpeg use the old API, eventually remove this code
@@ -613,7 +834,7 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
 }
 
 //------------------------------------------------------------------------------
-void vtkFFMPEGWriterInternal::End()
+int vtkFFMPEGWriterInternal::End()
 {
   if (this->yuvOutput)
   {
@@ -657,6 +878,8 @@ void vtkFFMPEGWriterInternal::End()
   }
 
   this->closedFile = 1;
+
+  return 1;
 }
 
 #endif
@@ -673,12 +896,18 @@ vtkFFMPEGWriter::vtkFFMPEGWriter()
   this->Rate = 25;
   this->BitRate = 0;
   this->BitRateTolerance = 0;
+  this->EncoderName = nullptr;
+  this->EncoderOptions = nullptr;
+  this->AsynchronousEncoding = false;
+  this->MaximumNumberOfQueuedFrames = 8;
 }
 
 //------------------------------------------------------------------------------
 vtkFFMPEGWriter::~vtkFFMPEGWriter()
 {
   delete this->Internals;
+  this->SetEncoderName(nullptr);
+  this->SetEncoderOptions(nullptr);
 }
 
 //------------------------------------------------------------------------------
@@ -772,7 +1001,13 @@ void vtkFFMPEGWriter::Write()
 //------------------------------------------------------------------------------
 void vtkFFMPEGWriter::End()
 {
-  this->Internals->End();
+  // with asynchronous encoding, the last frames are only written now
+  if (!this->Internals->End() && !this->Error)
+  {
+    vtkErrorMacro("Error storing image.");
+    this->Error = 1;
+    this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+  }
 
   delete this->Internals;
   this->Internals = nullptr;
@@ -787,5 +1022,11 @@ void vtkFFMPEGWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Rate: " << this->Rate << endl;
   os << indent << "BitRate: " << this->BitRate << endl;
   os << indent << "BitRateTolerance: " << this->BitRateTolerance << endl;
+  os << indent << "EncoderName: " << (this->EncoderName ? this->EncoderName : "(none)") << endl;
+  os << indent << "EncoderOptions: " << (this->EncoderOptions ? this->EncoderOptions : "(none)")
+     << endl;
+  os << indent << "AsynchronousEncoding: " << (this->AsynchronousEncoding ? "true" : "false")
+     << endl;
+  os << indent << "MaximumNumberOfQueuedFrames: " << this->MaximumNumberOfQueuedFrames << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -22,6 +22,14 @@
  * This class creates .avi files containing MP43 encoded video without
  * audio.
  *
+ * An encoder can also be chosen by name with EncoderName, for instance one
+ * of the hardware encoders h264_nvenc, hevc_qsv or h264_videotoolbox, and
+ * configured with EncoderOptions. When AsynchronousEncoding is on, Write()
+ * only copies the frame into a bounded queue, and the frames are encoded and
+ * written by a background thread, so that rendering the next frame overlaps
+ * with encoding the previous ones. These features require the libavformat 57
+ * API (FFMPEG 3.1) or newer.
+ *
  * The FFMPEG multimedia library source code can be obtained from
  * the sourceforge web site at http://ffmpeg.sourceforge.net/download.php
  * or is a tarball along with installation instructions at
@@ -99,6 +107,47 @@ public:
   vtkGetMacro(BitRateTolerance, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the name of the FFMPEG encoder to use, for instance h264_nvenc,
+   * hevc_qsv or h264_videotoolbox to encode with the GPU. When set, it
+   * overrides Compression, and the container format is guessed from the file
+   * name, falling back to avi. If the encoder is not available, the default
+   * encoder is used instead. Default is nullptr.
+   */
+  vtkSetStringMacro(EncoderName);
+  vtkGetStringMacro(EncoderName);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get options passed to the encoder, as key=value pairs separated by
+   * ':', for instance "preset=p4:rc=vbr". Default is nullptr.
+   */
+  vtkSetStringMacro(EncoderOptions);
+  vtkGetStringMacro(EncoderOptions);
+  ///@}
+
+  ///@{
+  /**
+   * Turns on or off (the default) encoding the frames in a background
+   * thread. Write() then returns as soon as the frame is queued, and only
+   * blocks when MaximumNumberOfQueuedFrames frames are waiting.
+   */
+  vtkSetMacro(AsynchronousEncoding, bool);
+  vtkGetMacro(AsynchronousEncoding, bool);
+  vtkBooleanMacro(AsynchronousEncoding, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of frames waiting to be encoded when
+   * AsynchronousEncoding is on. Default is 8.
+   */
+  vtkSetClampMacro(MaximumNumberOfQueuedFrames, int, 1, 1024);
+  vtkGetMacro(MaximumNumberOfQueuedFrames, int);
+  ///@}
+
 protected:
   vtkFFMPEGWriter();
   ~vtkFFMPEGWriter() override;
@@ -111,6 +160,10 @@ protected:
   int BitRate;
   int BitRateTolerance;
   bool Compression;
+  char* EncoderName;
+  char* EncoderOptions;
+  bool AsynchronousEncoding;
+  int MaximumNumberOfQueuedFrames;
 
 private:
   vtkFFMPEGWriter(const vtkFFMPEGWriter&) = delete;
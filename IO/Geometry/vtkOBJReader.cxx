@@ -28,6 +28,9 @@
 
 #include "vtkCellData.h"
 #include "vtkStringArray.h"
+#include "vtkValueFromString.h"
+
+#include <cstring>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkOBJReader);
@@ -108,6 +111,37 @@ p <v_a> <v_b> ...
 
 \*---------------------------------------------------------------------------*/
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Parse count numbers separated by whitespace from line, without the cost of
+// building a stream for every line. As with operator>>, the numbers that are
+// missing or cannot be parsed are set to 0.
+void ReadValues(const char* line, double* values, int count)
+{
+  const char* ptr = line;
+  const char* const end = line + strlen(line);
+  int i = 0;
+  for (; i < count; ++i)
+  {
+    while (ptr != end && isspace(static_cast<unsigned char>(*ptr)))
+    {
+      ++ptr;
+    }
+    const std::size_t length = vtkValueFromString(ptr, end, values[i]);
+    if (length == 0)
+    {
+      break;
+    }
+    ptr += length;
+  }
+  for (; i < count; ++i)
+  {
+    values[i] = 0.0;
+  }
+}
+}
+
 int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
 {
@@ -270,19 +304,8 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
       else if (strcmp(cmd, "vt") == 0)
       {
         // this is a tcoord, expect two floats, separated by whitespace:
-        std::stringstream dataStream;
-        dataStream.imbue(std::locale::classic());
-        dataStream << pLine;
-
-        try
-        {
-          dataStream >> xyz[0] >> xyz[1];
-          verticesTextureList.emplace_back(xyz[0], xyz[1]);
-        }
-        catch (const std::exception&)
-        {
-          vtkErrorMacro(<< "Error reading 'vt' at line " << lineNr);
-        }
+        ReadValues(pLine, xyz, 2);
+        verticesTextureList.emplace_back(xyz[0], xyz[1]);
       }
     } // (end of first while loop)
 
@@ -361,21 +384,9 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
       else if (strcmp(cmd, "v") == 0)
       {
         // vertex definition, expect three floats, separated by whitespace:
-        std::stringstream dataStream;
-        dataStream.imbue(std::locale::classic());
-        dataStream << pLine;
-
-        try
-        {
-          dataStream >> xyz[0] >> xyz[1] >> xyz[2];
-          points->InsertNextPoint(xyz);
-          numPoints++;
-        }
-        catch (const std::exception&)
-        {
-          vtkErrorMacro(<< "Error reading 'v' at line " << lineNr);
-          everything_ok = false;
-        }
+        ReadValues(pLine, xyz, 3);
+        points->InsertNextPoint(xyz);
+        numPoints++;
       }
       else if (strcmp(cmd, "usemtl") == 0)
       {
@@ -415,22 +426,10 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
       else if (strcmp(cmd, "vn") == 0)
       {
         // vertex normal, expect three floats, separated by whitespace:
-        std::stringstream dataStream;
-        dataStream.imbue(std::locale::classic());
-        dataStream << pLine;
-
-        try
-        {
-          dataStream >> xyz[0] >> xyz[1] >> xyz[2];
-          normals->InsertNextTuple(xyz);
-          hasNormals = true;
-          numNormals++;
-        }
-        catch (const std::exception&)
-        {
-          vtkErrorMacro(<< "Error reading 'vn' at line " << lineNr);
-          everything_ok = false;
-        }
+        ReadValues(pLine, xyz, 3);
+        normals->InsertNextTuple(xyz);
+        hasNormals = true;
+        numNormals++;
       }
       else if (strcmp(cmd, "p") == 0)
       {
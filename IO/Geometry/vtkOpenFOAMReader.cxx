@@ -1130,6 +1130,16 @@ private:
   vtkPolyData* AreaMesh;
 #endif
 
+  // Field files read ahead in parallel (by path), until consumed by ReadFieldFile
+  struct vtkFoamFieldFile
+  {
+    std::unique_ptr<vtkFoamIOobject> IO;
+    std::unique_ptr<vtkFoamDict> Dict;
+    bool Valid = false;
+    std::string Error;
+  };
+  std::map<std::string, vtkFoamFieldFile> PrefetchedFieldFiles;
+
   // Constructor and destructor are kept private
   vtkOpenFOAMReaderPrivate();
   ~vtkOpenFOAMReaderPrivate() override;
@@ -1273,8 +1283,12 @@ private:
   std::string ConstructDimensions(const vtkFoamDict& dict) const;
 
   // read and create cell/point fields
-  bool ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& dict, const std::string& varName,
-    const vtkDataArraySelection* selection);
+  static bool ParseFieldFile(vtkFoamIOobject& io, vtkFoamDict& dict, const std::string& varPath,
+    const vtkDataArraySelection* selection, std::string& error);
+  void PrefetchFieldFiles(
+    const std::vector<std::pair<std::string, const vtkDataArraySelection*>>& fields);
+  bool ReadFieldFile(std::unique_ptr<vtkFoamIOobject>& io, std::unique_ptr<vtkFoamDict>& dict,
+    const std::string& varName, const vtkDataArraySelection* selection);
   vtkSmartPointer<vtkFloatArray> FillField(vtkFoamEntry& entry, vtkIdType nElements,
     const vtkFoamIOobject& io, vtkFoamTypes::dataType fieldDataType);
   void GetVolFieldAtTimeStep(const std::string& varName, bool isInternalField = false);
@@ -8405,6 +8419,7 @@ vtkMultiBlockDataSet* vtkOpenFOAMReaderPrivate::MakeBoundaryMesh(
       // links of physical-processor shared points to avoid cracky seams
       // on fixedValue-type boundaries which are noticeable when all the
       // decomposed meshes are appended
+      this->AllBoundaries->EditableOn();
       this->AllBoundaries->BuildLinks();
       for (int pointI = 0; pointI < nAllBoundaryPoints; pointI++)
       {
@@ -8724,15 +8739,19 @@ void vtkOpenFOAMReaderPrivate::InterpolateCellToPoint(vtkFloatArray* pData, vtkF
 }
 
 //------------------------------------------------------------------------------
-bool vtkOpenFOAMReaderPrivate::ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& dict,
-  const std::string& varName, const vtkDataArraySelection* selection)
+// Open a field file and read it into a dictionary. Errors are returned in the
+// error string rather than reported, so that this may be called from several
+// threads: a deselected field returns false with an empty error.
+bool vtkOpenFOAMReaderPrivate::ParseFieldFile(vtkFoamIOobject& io, vtkFoamDict& dict,
+  const std::string& varPath, const vtkDataArraySelection* selection, std::string& error)
 {
-  const std::string varPath(this->CurrentTimeRegionPath() + "/" + varName);
+  std::ostringstream os;
 
   // Open the file
   if (!io.Open(varPath))
   {
-    vtkErrorMacro(<< "Error opening " << io.GetFileName() << ": " << io.GetError());
+    os << "Error opening " << io.GetFileName() << ": " << io.GetError();
+    error = os.str();
     return false;
   }
 
@@ -8746,19 +8765,85 @@ bool vtkOpenFOAMReaderPrivate::ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& d
   // Read the field file into dictionary
   if (!dict.Read(io))
   {
-    vtkErrorMacro(<< "Error reading line " << io.GetLineNumber() << " of " << io.GetFileName()
-                  << ": " << io.GetError());
+    os << "Error reading line " << io.GetLineNumber() << " of " << io.GetFileName() << ": "
+       << io.GetError();
+    error = os.str();
     return false;
   }
 
   if (dict.GetType() != vtkFoamToken::DICTIONARY)
   {
-    vtkErrorMacro(<< "File " << io.GetFileName() << "is not valid as a field file");
+    os << "File " << io.GetFileName() << "is not valid as a field file";
+    error = os.str();
     return false;
   }
   return true;
 }
 
+//------------------------------------------------------------------------------
+// Read the given field files of the current time step in parallel. They are
+// kept until ReadFieldFile consumes them, so the conversion to VTK arrays,
+// the error reporting and the progress events remain serial and in order.
+void vtkOpenFOAMReaderPrivate::PrefetchFieldFiles(
+  const std::vector<std::pair<std::string, const vtkDataArraySelection*>>& fields)
+{
+  const std::string timeRegionPath(this->CurrentTimeRegionPath() + "/");
+  const vtkIdType nFields = static_cast<vtkIdType>(fields.size());
+  std::vector<vtkFoamFieldFile> files(fields.size());
+  for (vtkIdType i = 0; i < nFields; ++i)
+  {
+    files[i].IO.reset(new vtkFoamIOobject(this->CasePath, this->Parent));
+    files[i].Dict.reset(new vtkFoamDict);
+  }
+
+  // One field file per task: the files are few and each is costly to parse
+  vtkSMPTools::For(0, nFields, 1, [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType i = first; i < last; ++i)
+    {
+      vtkFoamFieldFile& file = files[i];
+      file.Valid = vtkOpenFOAMReaderPrivate::ParseFieldFile(*file.IO, *file.Dict,
+        timeRegionPath + fields[i].first, fields[i].second, file.Error);
+    }
+  });
+
+  for (vtkIdType i = 0; i < nFields; ++i)
+  {
+    this->PrefetchedFieldFiles[timeRegionPath + fields[i].first] = std::move(files[i]);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenFOAMReaderPrivate::ReadFieldFile(std::unique_ptr<vtkFoamIOobject>& io,
+  std::unique_ptr<vtkFoamDict>& dict, const std::string& varName,
+  const vtkDataArraySelection* selection)
+{
+  const std::string varPath(this->CurrentTimeRegionPath() + "/" + varName);
+
+  bool valid;
+  std::string error;
+  auto prefetched = this->PrefetchedFieldFiles.find(varPath);
+  if (prefetched != this->PrefetchedFieldFiles.end())
+  {
+    io = std::move(prefetched->second.IO);
+    dict = std::move(prefetched->second.Dict);
+    valid = prefetched->second.Valid;
+    error = prefetched->second.Error;
+    this->PrefetchedFieldFiles.erase(prefetched);
+  }
+  else
+  {
+    io.reset(new vtkFoamIOobject(this->CasePath, this->Parent));
+    dict.reset(new vtkFoamDict);
+    valid = vtkOpenFOAMReaderPrivate::ParseFieldFile(*io, *dict, varPath, selection, error);
+  }
+
+  if (!error.empty())
+  {
+    vtkErrorMacro(<< error);
+  }
+  return valid;
+}
+
 //------------------------------------------------------------------------------
 vtkSmartPointer<vtkFloatArray> vtkOpenFOAMReaderPrivate::FillField(vtkFoamEntry& entry,
   vtkIdType nElements, const vtkFoamIOobject& io, vtkFoamTypes::dataType fieldDataType)
@@ -9013,12 +9098,14 @@ void vtkOpenFOAMReaderPrivate::GetVolFieldAtTimeStep(
   const auto& patches = this->BoundaryDict;
   const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->CellDataArraySelection))
+  std::unique_ptr<vtkFoamIOobject> ioPtr;
+  std::unique_ptr<vtkFoamDict> dictPtr;
+  if (!this->ReadFieldFile(ioPtr, dictPtr, varName, this->Parent->CellDataArraySelection))
   {
     return;
   }
+  vtkFoamIOobject& io = *ioPtr;
+  vtkFoamDict& dict = *dictPtr;
 
   // For internal field (eg, volScalarField::Internal)
   const bool hasColons = (io.GetClassName().find("::Internal") != std::string::npos);
@@ -9517,12 +9604,14 @@ void vtkOpenFOAMReaderPrivate::GetPointFieldAtTimeStep(const std::string& varNam
   // Boundary information
   const auto& patches = this->BoundaryDict;
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->PointDataArraySelection))
+  std::unique_ptr<vtkFoamIOobject> ioPtr;
+  std::unique_ptr<vtkFoamDict> dictPtr;
+  if (!this->ReadFieldFile(ioPtr, dictPtr, varName, this->Parent->PointDataArraySelection))
   {
     return;
   }
+  vtkFoamIOobject& io = *ioPtr;
+  vtkFoamDict& dict = *dictPtr;
 
   if (io.GetClassName().compare(0, 5, "point") != 0)
   {
@@ -9741,12 +9830,14 @@ void vtkOpenFOAMReaderPrivate::GetAreaFieldAtTimeStep(const std::string& varName
     return;
   }
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->CellDataArraySelection))
+  std::unique_ptr<vtkFoamIOobject> ioPtr;
+  std::unique_ptr<vtkFoamDict> dictPtr;
+  if (!this->ReadFieldFile(ioPtr, dictPtr, varName, this->Parent->CellDataArraySelection))
   {
     return;
   }
+  vtkFoamIOobject& io = *ioPtr;
+  vtkFoamDict& dict = *dictPtr;
 
   if (io.GetClassName().compare(0, 4, "area") != 0)
   {
@@ -10883,28 +10974,74 @@ int vtkOpenFOAMReaderPrivate::RequestData(vtkMultiBlockDataSet* output)
     nFieldsToRead += this->AreaFieldFiles->GetNumberOfValues();
 #endif
 
-    for (vtkIdType i = 0; i < this->VolFieldFiles->GetNumberOfValues(); ++i)
-    {
-      this->GetVolFieldAtTimeStep(this->VolFieldFiles->GetValue(i));
-      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
-    }
-    for (vtkIdType i = 0; i < this->DimFieldFiles->GetNumberOfValues(); ++i)
+    // The field files are read ahead in parallel, a batch per thread at a time
+    // to bound the memory held by the dictionaries, and converted serially
+    enum fieldType
+    {
+      VOL_FIELD,
+      DIM_FIELD,
+      POINT_FIELD,
+      AREA_FIELD
+    };
+    std::vector<std::pair<vtkStringArray*, fieldType>> fieldLists;
+    fieldLists.emplace_back(this->VolFieldFiles, VOL_FIELD);
+    fieldLists.emplace_back(this->DimFieldFiles, DIM_FIELD);
+    fieldLists.emplace_back(this->PointFieldFiles, POINT_FIELD);
+    bool prefetchAreaFields = false;
+#if VTK_FOAMFILE_FINITE_AREA
+    fieldLists.emplace_back(this->AreaFieldFiles, AREA_FIELD);
+    prefetchAreaFields = (this->AreaMesh && this->AreaMesh->GetNumberOfCells());
+#endif
+    std::vector<std::pair<std::string, fieldType>> fields;
+    for (const auto& fieldList : fieldLists)
     {
-      this->GetVolFieldAtTimeStep(this->DimFieldFiles->GetValue(i), true); // Internal field
-      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
+      for (vtkIdType i = 0; i < fieldList.first->GetNumberOfValues(); ++i)
+      {
+        fields.emplace_back(fieldList.first->GetValue(i), fieldList.second);
+      }
     }
-    for (vtkIdType i = 0; i < this->PointFieldFiles->GetNumberOfValues(); ++i)
+
+    const std::size_t batchSize =
+      static_cast<std::size_t>(std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads()));
+    for (std::size_t start = 0; start < fields.size(); start += batchSize)
     {
-      this->GetPointFieldAtTimeStep(this->PointFieldFiles->GetValue(i));
-      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
-    }
+      const std::size_t end = std::min(start + batchSize, fields.size());
+      std::vector<std::pair<std::string, const vtkDataArraySelection*>> batch;
+      for (std::size_t i = start; i < end; ++i)
+      {
+        if (fields[i].second == AREA_FIELD && !prefetchAreaFields)
+        {
+          continue;
+        }
+        batch.emplace_back(fields[i].first,
+          fields[i].second == POINT_FIELD ? this->Parent->PointDataArraySelection
+                                          : this->Parent->CellDataArraySelection);
+      }
+      this->PrefetchFieldFiles(batch);
+
+      for (std::size_t i = start; i < end; ++i)
+      {
+        switch (fields[i].second)
+        {
+          case VOL_FIELD:
+            this->GetVolFieldAtTimeStep(fields[i].first);
+            break;
+          case DIM_FIELD:
+            this->GetVolFieldAtTimeStep(fields[i].first, true); // Internal field
+            break;
+          case POINT_FIELD:
+            this->GetPointFieldAtTimeStep(fields[i].first);
+            break;
+          case AREA_FIELD:
 #if VTK_FOAMFILE_FINITE_AREA
-    for (vtkIdType i = 0; i < this->AreaFieldFiles->GetNumberOfValues(); ++i)
-    {
-      this->GetAreaFieldAtTimeStep(this->AreaFieldFiles->GetValue(i));
-      this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
-    }
+            this->GetAreaFieldAtTimeStep(fields[i].first);
 #endif
+            break;
+        }
+        this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
+      }
+      this->PrefetchedFieldFiles.clear();
+    }
   }
 
   // Read lagrangian mesh and fields
@@ -19,6 +19,7 @@
 #include "vtkCellData.h"
 #include "vtkErrorCode.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -26,14 +27,18 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkValueFromString.h"
 
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -226,12 +231,10 @@ int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
 //------------------------------------------------------------------------------
 bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newPolys)
 {
-  struct facet_t_t
-  {
-    float n[3], v1[3], v2[3], v3[3];
-    unsigned short junk;
-  };
-  using facet_t = struct facet_t_t;
+  // A facet is a normal and three vertices stored as little endian floats,
+  // followed by a two bytes attribute count.
+  const int facetSize = 50;
+  const int verticesOffset = 12;
 
   vtkDebugMacro(<< "Reading BINARY STL file");
 
@@ -285,41 +288,52 @@ bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newP
   }
 
   // now we can allocate the memory we need for this STL file
+  newPts->SetDataTypeToFloat();
   newPts->Allocate(numTris * 3);
-  newPolys->AllocateEstimate(numTris, 3);
-
-  facet_t facet;
-  for (int i = 0; fread(&facet, 50, 1, fp) > 0; i++)
+  vtkFloatArray* coords = vtkFloatArray::FastDownCast(newPts->GetData());
+
+  // Facets are read by blocks and their vertices are decoded in parallel
+  // straight into the points.
+  const int blockSize = 65536;
+  std::vector<char> facets(static_cast<std::size_t>(facetSize) * blockSize);
+  vtkIdType numFacets = 0;
+  std::size_t count;
+  while ((count = fread(facets.data(), facetSize, blockSize, fp)) > 0)
   {
-    vtkByteSwap::Swap4LE(facet.n);
-    vtkByteSwap::Swap4LE(facet.n + 1);
-    vtkByteSwap::Swap4LE(facet.n + 2);
-
-    vtkByteSwap::Swap4LE(facet.v1);
-    vtkByteSwap::Swap4LE(facet.v1 + 1);
-    vtkByteSwap::Swap4LE(facet.v1 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v2);
-    vtkByteSwap::Swap4LE(facet.v2 + 1);
-    vtkByteSwap::Swap4LE(facet.v2 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v3);
-    vtkByteSwap::Swap4LE(facet.v3 + 1);
-    vtkByteSwap::Swap4LE(facet.v3 + 2);
-
-    vtkIdType pts[3];
-    pts[0] = newPts->InsertNextPoint(facet.v1);
-    pts[1] = newPts->InsertNextPoint(facet.v2);
-    pts[2] = newPts->InsertNextPoint(facet.v3);
-
-    newPolys->InsertNextCell(3, pts);
+    coords->SetNumberOfTuples(3 * (numFacets + static_cast<vtkIdType>(count)));
+    float* vertices = coords->GetPointer(9 * numFacets);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(count), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        memcpy(vertices + 9 * i, facets.data() + facetSize * i + verticesOffset, 9 * sizeof(float));
+      }
+      vtkByteSwap::Swap4LERange(vertices + 9 * begin, 9 * (end - begin));
+    });
+    numFacets += static_cast<vtkIdType>(count);
 
-    if ((i % 100000) == 0 && i != 0)
+    vtkDebugMacro(<< "triangle# " << numFacets);
+    this->UpdateProgress(std::min(1.0, static_cast<double>(numFacets) / std::max(numTris, 1)));
+  }
+  newPts->Modified();
+
+  // every facet uses its own three points
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numFacets + 1);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(3 * numFacets);
+  vtkSMPTools::For(0, numFacets + 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
     {
-      vtkDebugMacro(<< "triangle# " << i);
-      this->UpdateProgress(static_cast<double>(i) / numTris);
+      offsets->SetValue(i, 3 * i);
     }
-  }
+  });
+  vtkSMPTools::For(0, 3 * numFacets, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      connectivity->SetValue(i, i);
+    }
+  });
+  newPolys->SetData(offsets, connectivity);
 
   return true;
 }
@@ -342,21 +356,24 @@ inline std::string stlParseExpected(const std::string& expected, const std::stri
 // Get three space-delimited floats from string.
 bool stlReadVertex(char* buf, float vertCoord[3])
 {
-  char* begptr = buf;
-  char* endptr = nullptr;
+  char* ptr = buf;
+  char* const end = buf + strlen(buf);
 
   for (int i = 0; i < 3; ++i)
   {
-    // We really should use: vertCoord[i] = std::strtof(begptr, &endptr);
-    // instead of strtod below but Apple Clang 9.0.0.9000039 doesn't
-    // recognize strtof as part of the C++11 standard
-    vertCoord[i] = static_cast<float>(std::strtod(begptr, &endptr));
-    if (begptr == endptr)
+    while (ptr != end && isspace(static_cast<unsigned char>(*ptr)))
+    {
+      ++ptr;
+    }
+    // parse as double and round to float, as the file was parsed with strtod
+    double value;
+    const std::size_t length = vtkValueFromString(ptr, end, value);
+    if (length == 0)
     {
       return false;
     }
-
-    begptr = endptr;
+    vertCoord[i] = static_cast<float>(value);
+    ptr += length;
   }
 
   return true;
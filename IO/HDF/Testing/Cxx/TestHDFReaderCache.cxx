@@ -0,0 +1,135 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHDFReaderCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkHDFReader gives the same unstructured grid with and without
+// its geometry cache, across executions that change the array selection.
+
+#include "vtkCellArray.h"
+#include "vtkDataArraySelection.h"
+#include "vtkDoubleArray.h"
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkTesting.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkNew<vtkUnstructuredGrid> MakeGrid(int numberOfTriangles, double offset)
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> first;
+  first->SetName("First");
+  vtkNew<vtkDoubleArray> second;
+  second->SetName("Second");
+  for (int i = 0; i < numberOfTriangles + 2; ++i)
+  {
+    points->InsertNextPoint(offset + i, i % 2, 0.0);
+    first->InsertNextValue(offset + i);
+    second->InsertNextValue(-offset - i);
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(first);
+  grid->GetPointData()->AddArray(second);
+  for (vtkIdType i = 0; i < numberOfTriangles; ++i)
+  {
+    const vtkIdType triangle[3] = { i, i + 1, i + 2 };
+    grid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  }
+  return grid;
+}
+
+bool SameGrids(vtkUnstructuredGrid* a, vtkUnstructuredGrid* b, const char* arrayName)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+    a->GetNumberOfCells() != b->GetNumberOfCells() ||
+    a->GetCells()->GetNumberOfConnectivityIds() != b->GetCells()->GetNumberOfConnectivityIds())
+  {
+    return false;
+  }
+  vtkDataArray* arrayA = a->GetPointData()->GetArray(arrayName);
+  vtkDataArray* arrayB = b->GetPointData()->GetArray(arrayName);
+  if (!arrayA || !arrayB)
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3], y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2] ||
+      arrayA->GetComponent(i, 0) != arrayB->GetComponent(i, 0))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestHDFReaderCache(int argc, char* argv[])
+{
+  vtkNew<vtkTesting> testHelper;
+  testHelper->AddArguments(argc, argv);
+  const std::string fileName =
+    std::string(testHelper->GetTempDirectory()) + "/TestHDFReaderCache.hdf";
+
+  vtkNew<vtkPartitionedDataSet> partitioned;
+  partitioned->SetPartition(0, MakeGrid(10, 0.0));
+  partitioned->SetPartition(1, MakeGrid(20, 100.0));
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(partitioned);
+  writer->SetFileName(fileName.c_str());
+  writer->Write();
+
+  vtkNew<vtkHDFReader> reference;
+  reference->SetFileName(fileName.c_str());
+
+  // a cache large enough for all the arrays, and one that can only keep
+  // the last array read
+  for (unsigned long maximumCacheSize : { 1048576ul, 0ul })
+  {
+    vtkNew<vtkHDFReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->UseCacheOn();
+    reader->SetMaximumCacheSize(maximumCacheSize);
+    for (const char* arrayName : { "First", "Second", "First" })
+    {
+      for (vtkHDFReader* r : { reader.Get(), reference.Get() })
+      {
+        r->UpdateInformation();
+        r->GetPointDataArraySelection()->DisableAllArrays();
+        r->GetPointDataArraySelection()->EnableArray(arrayName);
+        r->Update();
+      }
+      if (!SameGrids(vtkUnstructuredGrid::SafeDownCast(reader->GetOutput()),
+            vtkUnstructuredGrid::SafeDownCast(reference->GetOutput()), arrayName))
+      {
+        std::cerr << "Cached read differs for array " << arrayName << " and cache size "
+                  << maximumCacheSize << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHDFReaderMemoryMapping.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that memory mapped arrays read by vtkHDFReader have the same values
+// as the arrays it reads, and that modifying them leaves the file unchanged.
+
+#include "vtkDoubleArray.h"
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTesting.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkSmartPointer<vtkDataArray> ReadArray(const std::string& fileName, bool useMemoryMapping)
+{
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->SetUseMemoryMapping(useMemoryMapping);
+  reader->Update();
+  vtkImageData* data = vtkImageData::SafeDownCast(reader->GetOutput());
+  return data ? data->GetPointData()->GetArray("Values") : nullptr;
+}
+
+bool SameValues(vtkDataArray* array, vtkDataArray* expectedArray)
+{
+  if (!array || array->GetNumberOfValues() != expectedArray->GetNumberOfValues())
+  {
+    std::cerr << "Array missing or of a different size" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < expectedArray->GetNumberOfValues(); ++i)
+  {
+    if (array->GetComponent(i, 0) != expectedArray->GetComponent(i, 0))
+    {
+      std::cerr << "Value " << i << " differs" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestHDFReaderMemoryMapping(int argc, char* argv[])
+{
+  vtkNew<vtkTesting> testHelper;
+  testHelper->AddArguments(argc, argv);
+  const std::string tempDir = testHelper->GetTempDirectory();
+
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(17, 9, 5);
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  values->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < values->GetNumberOfValues(); ++i)
+  {
+    values->SetValue(i, 0.25 * i);
+  }
+  image->GetPointData()->AddArray(values);
+
+  // a contiguous dataset, which is mapped, and a chunked one, which is read
+  for (vtkIdType chunkSize : { 0, 100 })
+  {
+    const std::string fileName =
+      tempDir + "/TestHDFReaderMemoryMapping" + std::to_string(chunkSize) + ".hdf";
+    vtkNew<vtkHDFWriter> writer;
+    writer->SetInputData(image);
+    writer->SetFileName(fileName.c_str());
+    writer->SetChunkSize(chunkSize);
+    writer->Write();
+
+    vtkSmartPointer<vtkDataArray> mapped = ReadArray(fileName, true);
+    if (!SameValues(mapped, values))
+    {
+      std::cerr << "Mapped array differs for chunk size " << chunkSize << std::endl;
+      return EXIT_FAILURE;
+    }
+    // mapped arrays are copy-on-write
+    mapped->SetComponent(0, 0, -1.0);
+    if (!SameValues(ReadArray(fileName, true), values) ||
+      !SameValues(ReadArray(fileName, false), values))
+    {
+      std::cerr << "Modifying a mapped array changed the file" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
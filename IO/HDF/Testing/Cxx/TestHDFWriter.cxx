@@ -0,0 +1,255 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHDFWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Write data with vtkHDFWriter and check that vtkHDFReader reads it back.
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkStringArray.h"
+#include "vtkTesting.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+bool SameArrays(vtkDataArray* array, vtkDataArray* expectedArray)
+{
+  if (!array || array->GetNumberOfTuples() != expectedArray->GetNumberOfTuples() ||
+    array->GetNumberOfComponents() != expectedArray->GetNumberOfComponents())
+  {
+    std::cerr << "Array " << expectedArray->GetName() << " is missing or has a different size"
+              << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < expectedArray->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < expectedArray->GetNumberOfComponents(); ++c)
+    {
+      if (array->GetComponent(i, c) != expectedArray->GetComponent(i, c))
+      {
+        std::cerr << "Array " << expectedArray->GetName() << " differs at tuple/component " << i
+                  << "/" << c << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// a row of hexahedra along x, with point and cell arrays
+vtkNew<vtkUnstructuredGrid> MakeGrid(int numberOfHexes, double xOffset)
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("PointScalars");
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  for (int i = 0; i <= numberOfHexes; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      const double x[3] = { xOffset + i, static_cast<double>(j & 1), static_cast<double>(j >> 1) };
+      points->InsertNextPoint(x);
+      pointScalars->InsertNextValue(x[0] + 10 * x[1] + 100 * x[2]);
+    }
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(pointScalars);
+  for (int i = 0; i < numberOfHexes; ++i)
+  {
+    const vtkIdType p = 4 * i;
+    const vtkIdType hex[8] = { p, p + 4, p + 5, p + 1, p + 2, p + 6, p + 7, p + 3 };
+    grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+    cellIds->InsertNextValue(i);
+  }
+  grid->GetCellData()->AddArray(cellIds);
+  return grid;
+}
+
+int TestImageData(const std::string& fileName, int chunkSize, int compressionLevel)
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 6, 0, 4, 0, 3);
+  image->SetOrigin(1, 2, 3);
+  image->SetSpacing(0.5, 0.25, 2);
+  vtkNew<vtkFloatArray> pointVectors;
+  pointVectors->SetName("PointVectors");
+  pointVectors->SetNumberOfComponents(3);
+  pointVectors->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < pointVectors->GetNumberOfValues(); ++i)
+  {
+    pointVectors->SetValue(i, static_cast<float>(i) * 0.5f);
+  }
+  image->GetPointData()->AddArray(pointVectors);
+  vtkNew<vtkStringArray> names;
+  names->SetName("Names");
+  names->InsertNextValue("first");
+  names->InsertNextValue("second");
+  image->GetFieldData()->AddArray(names);
+
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(image);
+  writer->SetFileName(fileName.c_str());
+  writer->SetChunkSize(chunkSize);
+  writer->SetCompressionLevel(compressionLevel);
+  writer->Write();
+
+  vtkNew<vtkHDFReader> reader;
+  if (!reader->CanReadFile(fileName.c_str()))
+  {
+    std::cerr << "Cannot read " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  vtkImageData* data = vtkImageData::SafeDownCast(reader->GetOutput());
+  if (!data || data->GetNumberOfPoints() != image->GetNumberOfPoints())
+  {
+    std::cerr << "Image data read back with a different size" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    if (data->GetOrigin()[i] != image->GetOrigin()[i] ||
+      data->GetSpacing()[i] != image->GetSpacing()[i])
+    {
+      std::cerr << "Origin or spacing differs" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (!SameArrays(data->GetPointData()->GetArray("PointVectors"), pointVectors))
+  {
+    return EXIT_FAILURE;
+  }
+  vtkStringArray* readNames =
+    vtkStringArray::SafeDownCast(data->GetFieldData()->GetAbstractArray("Names"));
+  if (!readNames || readNames->GetNumberOfValues() != 2 || readNames->GetValue(1) != "second")
+  {
+    std::cerr << "Field data string array differs" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+int TestPartitionedUnstructuredGrid(
+  const std::string& fileName, int chunkSize, int compressionLevel)
+{
+  vtkNew<vtkPartitionedDataSet> partitioned;
+  partitioned->SetPartition(0, MakeGrid(3, 0.0));
+  partitioned->SetPartition(1, MakeGrid(5, 3.0));
+
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(partitioned);
+  writer->SetFileName(fileName.c_str());
+  writer->SetChunkSize(chunkSize);
+  writer->SetCompressionLevel(compressionLevel);
+  writer->Write();
+
+  // a single reader piece appends all the file pieces in order
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  vtkUnstructuredGrid* data = vtkUnstructuredGrid::SafeDownCast(reader->GetOutput());
+  if (!data || data->GetNumberOfPoints() != 40 || data->GetNumberOfCells() != 8)
+  {
+    std::cerr << "Unstructured grid read back with a different size" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkIdType pointOffset = 0;
+  vtkIdType cellOffset = 0;
+  vtkNew<vtkIdList> cellPoints;
+  vtkNew<vtkIdList> expectedCellPoints;
+  for (unsigned int partition = 0; partition < 2; ++partition)
+  {
+    vtkUnstructuredGrid* grid =
+      vtkUnstructuredGrid::SafeDownCast(partitioned->GetPartition(partition));
+    for (vtkIdType i = 0; i < grid->GetNumberOfPoints(); ++i)
+    {
+      double x[3], expectedX[3];
+      data->GetPoint(pointOffset + i, x);
+      grid->GetPoint(i, expectedX);
+      vtkDataArray* scalars = data->GetPointData()->GetArray("PointScalars");
+      if (x[0] != expectedX[0] || x[1] != expectedX[1] || x[2] != expectedX[2] || !scalars ||
+        scalars->GetComponent(pointOffset + i, 0) !=
+          grid->GetPointData()->GetArray("PointScalars")->GetComponent(i, 0))
+      {
+        std::cerr << "Point " << pointOffset + i << " differs" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+    {
+      data->GetCellPoints(cellOffset + i, cellPoints);
+      grid->GetCellPoints(i, expectedCellPoints);
+      vtkDataArray* cellIds = data->GetCellData()->GetArray("CellIds");
+      bool same = data->GetCellType(cellOffset + i) == VTK_HEXAHEDRON &&
+        cellPoints->GetNumberOfIds() == expectedCellPoints->GetNumberOfIds() && cellIds &&
+        cellIds->GetComponent(cellOffset + i, 0) == i;
+      for (vtkIdType j = 0; same && j < cellPoints->GetNumberOfIds(); ++j)
+      {
+        same = cellPoints->GetId(j) == pointOffset + expectedCellPoints->GetId(j);
+      }
+      if (!same)
+      {
+        std::cerr << "Cell " << cellOffset + i << " differs" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    pointOffset += grid->GetNumberOfPoints();
+    cellOffset += grid->GetNumberOfCells();
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+int TestHDFWriter(int argc, char* argv[])
+{
+  vtkNew<vtkTesting> testHelper;
+  testHelper->AddArguments(argc, argv);
+  const std::string tempDir = testHelper->GetTempDirectory();
+
+  // contiguous, chunked, and chunked and compressed datasets
+  const int chunkSizes[3] = { 0, 10, 0 };
+  const int compressionLevels[3] = { 0, 0, 4 };
+  for (int i = 0; i < 3; ++i)
+  {
+    const std::string suffix = std::to_string(i) + ".hdf";
+    if (TestImageData(tempDir + "/TestHDFWriter_image" + suffix, chunkSizes[i],
+          compressionLevels[i]) != EXIT_SUCCESS ||
+      TestPartitionedUnstructuredGrid(tempDir + "/TestHDFWriter_grid" + suffix, chunkSizes[i],
+        compressionLevels[i]) != EXIT_SUCCESS)
+    {
+      std::cerr << "Failure for chunk size " << chunkSizes[i] << " and compression level "
+                << compressionLevels[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -126,6 +126,9 @@ void vtkHDFReader::PrintSelf(ostream& os, vtkIndent indent)
      << "\n";
   os << indent << "PointDataArraySelection: " << this->DataArraySelection[vtkDataObject::POINT]
      << "\n";
+  os << indent << "UseMemoryMapping: " << (this->UseMemoryMapping ? "on" : "off") << "\n";
+  os << indent << "UseCache: " << (this->UseCache ? "on" : "off") << "\n";
+  os << indent << "MaximumCacheSize: " << this->MaximumCacheSize << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -109,6 +109,43 @@ public:
   vtkSetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
   vtkGetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
 
+  ///@{
+  /**
+   * When on, arrays stored in contiguous, uncompressed HDF5 datasets with
+   * the native representation are memory mapped instead of being read, so
+   * only the pages that are actually accessed are loaded from disk. Mapped
+   * arrays are copy-on-write: modifying them does not change the file, but
+   * the file must not be modified or truncated while they are in use. Other
+   * datasets are read as usual. Not available on Windows. Default is off.
+   */
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  ///@}
+
+  ///@{
+  /**
+   * When on, the points and cell arrays of unstructured grids are kept in a
+   * cache after they are read, so that executing the reader again, for
+   * instance after changing the array selection, only reads the point and
+   * cell data arrays from the file. Cached arrays may be shared with the
+   * output, so they should not be modified in place. The cache is cleared
+   * when a different file is opened. Default is off.
+   */
+  vtkSetMacro(UseCache, bool);
+  vtkGetMacro(UseCache, bool);
+  vtkBooleanMacro(UseCache, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the maximum size of the cache in kibibytes. The least recently
+   * used arrays are evicted first. Default is 1048576 (1 GiB).
+   */
+  vtkSetMacro(MaximumCacheSize, unsigned long);
+  vtkGetMacro(MaximumCacheSize, unsigned long);
+  ///@}
+
 protected:
   vtkHDFReader();
   ~vtkHDFReader() override;
@@ -202,6 +239,9 @@ protected:
   ///@}
 
   unsigned int MaximumLevelsToReadByDefaultForAMR = 0;
+  bool UseMemoryMapping = false;
+  bool UseCache = false;
+  unsigned long MaximumCacheSize = 1048576;
 
   class Implementation;
   Implementation* Impl;
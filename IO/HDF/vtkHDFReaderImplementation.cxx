@@ -14,6 +14,7 @@
 =========================================================================*/
 
 #include "vtkHDFReaderImplementation.h"
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <sstream>
@@ -46,11 +47,82 @@
 #include "vtkUnsignedShortArray.h"
 
 #include <array>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
+#if !defined(_WIN32)
+//------------------------------------------------------------------------------
+// Memory mappings backing the mapped arrays, indexed by the pointer given to
+// the arrays. Each one stores the start and length of the mapping.
+std::map<void*, std::pair<void*, size_t>>& GetMappings(std::mutex*& mutex)
+{
+  static std::mutex mappingsMutex;
+  static std::map<void*, std::pair<void*, size_t>> mappings;
+  mutex = &mappingsMutex;
+  return mappings;
+}
+
+//------------------------------------------------------------------------------
+// Maps 'size' bytes at 'offset' in 'fileName' copy-on-write.
+void* MapFileRegion(const std::string& fileName, off_t offset, size_t size)
+{
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return nullptr;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) < 0 || fileStat.st_size < static_cast<off_t>(offset + size))
+  {
+    close(fd);
+    return nullptr;
+  }
+  const off_t pageSize = sysconf(_SC_PAGESIZE);
+  const off_t start = offset - offset % pageSize;
+  const size_t length = size + static_cast<size_t>(offset - start);
+  void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, start);
+  // the mapping stays valid after the file is closed
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    return nullptr;
+  }
+  void* data = static_cast<char*>(base) + (offset - start);
+  std::mutex* mutex;
+  auto& mappings = ::GetMappings(mutex);
+  std::lock_guard<std::mutex> lock(*mutex);
+  mappings[data] = std::make_pair(base, length);
+  return data;
+}
+
+//------------------------------------------------------------------------------
+// Free function of the mapped arrays.
+void UnmapFileRegion(void* data)
+{
+  std::mutex* mutex;
+  auto& mappings = ::GetMappings(mutex);
+  std::lock_guard<std::mutex> lock(*mutex);
+  auto it = mappings.find(data);
+  if (it != mappings.end())
+  {
+    munmap(it->second.first, it->second.second);
+    mappings.erase(it);
+  }
+}
+#endif
+
 herr_t AddName(hid_t group, const char* name, const H5L_info_t*, void* op_data)
 {
   auto array = static_cast<std::vector<std::string>*>(op_data);
@@ -305,6 +377,7 @@ bool vtkHDFReader::Implementation::ReadDataSetType()
 //------------------------------------------------------------------------------
 void vtkHDFReader::Implementation::Close()
 {
+  this->Cache.clear();
   this->DataSetType = -1;
   this->NumberOfPieces = 0;
   std::fill(this->Version.begin(), this->Version.end(), 0);
@@ -765,8 +838,47 @@ vtkAbstractArray* vtkHDFReader::Implementation::NewFieldArray(const char* name)
 vtkDataArray* vtkHDFReader::Implementation::NewMetadataArray(
   const char* name, hsize_t offset, hsize_t size)
 {
-  std::vector<hsize_t> fileExtent = { offset, offset + size - 1 };
-  return NewArrayForGroup(this->VTKGroup, name, fileExtent);
+  if (!this->Reader->GetUseCache())
+  {
+    this->Cache.clear();
+    std::vector<hsize_t> fileExtent = { offset, offset + size - 1 };
+    return NewArrayForGroup(this->VTKGroup, name, fileExtent);
+  }
+
+  auto it = std::find_if(this->Cache.begin(), this->Cache.end(),
+    [&](const CachedArray& cached)
+    { return cached.Offset == offset && cached.Size == size && cached.Name == name; });
+  if (it != this->Cache.end())
+  {
+    this->Cache.splice(this->Cache.begin(), this->Cache, it);
+  }
+  else
+  {
+    std::vector<hsize_t> fileExtent = { offset, offset + size - 1 };
+    vtkSmartPointer<vtkDataArray> array =
+      vtk::TakeSmartPointer(NewArrayForGroup(this->VTKGroup, name, fileExtent));
+    if (!array)
+    {
+      return nullptr;
+    }
+    this->Cache.push_front(CachedArray{ name, offset, size, array });
+
+    // evict the least recently used arrays, but always keep the new one
+    unsigned long cacheSize = 0;
+    for (const CachedArray& cached : this->Cache)
+    {
+      cacheSize += cached.Array->GetActualMemorySize();
+    }
+    while (this->Cache.size() > 1 && cacheSize > this->Reader->GetMaximumCacheSize())
+    {
+      cacheSize -= this->Cache.back().Array->GetActualMemorySize();
+      this->Cache.pop_back();
+    }
+  }
+  // the caller owns a reference, as for arrays read from the file
+  vtkDataArray* array = this->Cache.front().Array;
+  array->Register(nullptr);
+  return array;
 }
 
 //------------------------------------------------------------------------------
@@ -874,6 +986,15 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
     size_t j = i << 1;
     numberOfTuples *= (fileExtent[j + 1] - fileExtent[j] + 1);
   }
+  if (this->Reader->GetUseMemoryMapping())
+  {
+    vtkDataArray* mappedArray =
+      this->NewMappedArray<T>(dataset, fileExtent, numberOfComponents, numberOfTuples);
+    if (mappedArray)
+    {
+      return mappedArray;
+    }
+  }
   auto array = vtkAOSDataArrayTemplate<T>::SafeDownCast(NewVtkDataArray<T>());
   array->SetNumberOfComponents(numberOfComponents);
   array->SetNumberOfTuples(numberOfTuples);
@@ -886,6 +1007,91 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
   return array;
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+vtkDataArray* vtkHDFReader::Implementation::NewMappedArray(hid_t dataset,
+  const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents, hsize_t numberOfTuples)
+{
+#if defined(_WIN32)
+  (void)dataset;
+  (void)fileExtent;
+  (void)numberOfComponents;
+  (void)numberOfTuples;
+  return nullptr;
+#else
+  // the dataset has to be stored in the file itself as one block of
+  // uncompressed native values, which excludes chunked datasets.
+  vtkHDF::ScopedH5PHandle fileProperties = H5Fget_create_plist(this->File);
+  hsize_t userBlockSize = 0;
+  if (fileProperties < 0 || H5Pget_userblock(fileProperties, &userBlockSize) < 0 ||
+    userBlockSize != 0)
+  {
+    return nullptr;
+  }
+  vtkHDF::ScopedH5PHandle properties = H5Dget_create_plist(dataset);
+  if (properties < 0 || H5Pget_layout(properties) != H5D_CONTIGUOUS ||
+    H5Pget_external_count(properties) != 0)
+  {
+    return nullptr;
+  }
+  vtkHDF::ScopedH5THandle fileType = H5Dget_type(dataset);
+  if (fileType < 0 || H5Tequal(fileType, TemplateTypeToHdfNativeType<T>()) <= 0)
+  {
+    return nullptr;
+  }
+  const haddr_t address = H5Dget_offset(dataset);
+  vtkHDF::ScopedH5SHandle dataspace = H5Dget_space(dataset);
+  const int rank = dataspace < 0 ? -1 : H5Sget_simple_extent_ndims(dataspace);
+  if (address == HADDR_UNDEF || rank < 1)
+  {
+    return nullptr;
+  }
+  std::vector<hsize_t> dims(rank);
+  if (H5Sget_simple_extent_dims(dataspace, dims.data(), nullptr) < 0)
+  {
+    return nullptr;
+  }
+
+  // the selected values are contiguous when the selection covers whole
+  // slices along the slowest varying dimension. fileExtent is in VTK order,
+  // the reverse of the dataset dimensions.
+  const size_t ndims = fileExtent.size() >> 1;
+  hsize_t valuesPerSlice = 1;
+  for (int i = 1; i < rank; ++i)
+  {
+    if (static_cast<size_t>(i) < ndims)
+    {
+      const size_t j = (ndims - 1 - i) << 1;
+      if (fileExtent[j] != 0 || fileExtent[j + 1] + 1 != dims[i])
+      {
+        return nullptr;
+      }
+    }
+    valuesPerSlice *= dims[i];
+  }
+  const hsize_t firstSlice = fileExtent[(ndims - 1) << 1];
+  const hsize_t offset = address + firstSlice * valuesPerSlice * sizeof(T);
+  const hsize_t size = numberOfTuples * numberOfComponents * sizeof(T);
+  if (size == 0 || offset % sizeof(T) != 0)
+  {
+    return nullptr;
+  }
+
+  void* data = ::MapFileRegion(this->FileName, static_cast<off_t>(offset), size);
+  if (!data)
+  {
+    return nullptr;
+  }
+  auto array = vtkAOSDataArrayTemplate<T>::SafeDownCast(NewVtkDataArray<T>());
+  array->SetNumberOfComponents(numberOfComponents);
+  array->SetArray(static_cast<T*>(data),
+    static_cast<vtkIdType>(numberOfTuples * numberOfComponents), 0,
+    vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+  array->SetArrayFreeFunction(::UnmapFileRegion);
+  return array;
+#endif
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 bool vtkHDFReader::Implementation::NewArray(
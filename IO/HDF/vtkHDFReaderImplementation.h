@@ -21,9 +21,12 @@
 #ifndef vtkHDFReaderImplementation_h
 #define vtkHDFReaderImplementation_h
 
+#include "vtkDataArray.h"
 #include "vtkHDFReader.h"
+#include "vtkSmartPointer.h"
 #include "vtk_hdf5.h"
 #include <array>
+#include <list>
 #include <map>
 #include <string>
 #include <vector>
@@ -97,7 +100,8 @@ public:
    * Reads a 1D metadata array in a DataArray or a vector of vtkIdType.
    * We read either the whole array for the vector version or a slice
    * specified with (offset, size). For an error we return nullptr or an
-   * empty vector.
+   * empty vector. When the reader cache is on, metadata arrays are
+   * looked up in and added to the cache.
    */
   vtkDataArray* NewMetadataArray(const char* name, hsize_t offset, hsize_t size);
   std::vector<vtkIdType> GetMetadata(const char* name, hsize_t size);
@@ -184,6 +188,15 @@ protected:
     hid_t dataset, const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents, T* data);
   vtkStringArray* NewStringArray(hid_t dataset, hsize_t size);
   ///@}
+  /**
+   * Memory maps the values of 'fileExtent' in 'dataset' into a new array
+   * of type 'T'. Returns nullptr when the dataset is not stored as a
+   * contiguous block of native 'T' values, in which case the array has to
+   * be read.
+   */
+  template <typename T>
+  vtkDataArray* NewMappedArray(hid_t dataset, const std::vector<hsize_t>& fileExtent,
+    hsize_t numberOfComponents, hsize_t numberOfTuples);
   /**
    * Builds a map between native types and GetArray routines for that type.
    */
@@ -207,6 +220,18 @@ private:
   using ArrayReader = vtkDataArray* (vtkHDFReader::Implementation::*)(hid_t dataset,
     const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents);
   std::map<TypeDescription, ArrayReader> TypeReaderMap;
+  /**
+   * Metadata arrays already read from the file, most recently used first.
+   * The cache is cleared when the file is closed.
+   */
+  struct CachedArray
+  {
+    std::string Name;
+    hsize_t Offset;
+    hsize_t Size;
+    vtkSmartPointer<vtkDataArray> Array;
+  };
+  std::list<CachedArray> Cache;
 
   bool ReadDataSetType();
 
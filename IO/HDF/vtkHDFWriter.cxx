@@ -0,0 +1,706 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkHDFWriter.h"
+
+#include "vtk_hdf5.h"
+
+#include "vtkAbstractArray.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkErrorCode.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkHDF5ScopedHandle.h"
+#include "vtkHDFReaderVersion.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMatrix3x3.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkHDFWriter);
+
+namespace
+{
+// HDF5 can only compress chunked datasets, so this chunk size is used
+// when compression is requested without a chunk size.
+const hsize_t DefaultCompressedChunkSize = 65536;
+
+//------------------------------------------------------------------------------
+hid_t GetNativeType(int dataType)
+{
+  switch (dataType)
+  {
+    case VTK_CHAR:
+      return H5T_NATIVE_CHAR;
+    case VTK_SIGNED_CHAR:
+      return H5T_NATIVE_SCHAR;
+    case VTK_UNSIGNED_CHAR:
+      return H5T_NATIVE_UCHAR;
+    case VTK_SHORT:
+      return H5T_NATIVE_SHORT;
+    case VTK_UNSIGNED_SHORT:
+      return H5T_NATIVE_USHORT;
+    case VTK_INT:
+      return H5T_NATIVE_INT;
+    case VTK_UNSIGNED_INT:
+      return H5T_NATIVE_UINT;
+    case VTK_LONG:
+      return H5T_NATIVE_LONG;
+    case VTK_UNSIGNED_LONG:
+      return H5T_NATIVE_ULONG;
+    case VTK_LONG_LONG:
+      return H5T_NATIVE_LLONG;
+    case VTK_UNSIGNED_LONG_LONG:
+      return H5T_NATIVE_ULLONG;
+    case VTK_ID_TYPE:
+      return sizeof(vtkIdType) == sizeof(long long) ? H5T_NATIVE_LLONG : H5T_NATIVE_INT;
+    case VTK_FLOAT:
+      return H5T_NATIVE_FLOAT;
+    case VTK_DOUBLE:
+      return H5T_NATIVE_DOUBLE;
+    default:
+      return H5I_INVALID_HID;
+  }
+}
+
+//------------------------------------------------------------------------------
+// HDF5 writes from a single buffer, so arrays that do not store their
+// values as one contiguous block are copied into one that does.
+vtkSmartPointer<vtkDataArray> GetContiguousArray(vtkDataArray* array)
+{
+  if (array->HasStandardMemoryLayout())
+  {
+    return array;
+  }
+  auto copy = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(array->GetDataType()));
+  copy->DeepCopy(array);
+  return copy;
+}
+
+//------------------------------------------------------------------------------
+hsize_t GetNumberOfValues(const std::vector<hsize_t>& dims)
+{
+  hsize_t numberOfValues = 1;
+  for (hsize_t dim : dims)
+  {
+    numberOfValues *= dim;
+  }
+  return numberOfValues;
+}
+}
+
+//------------------------------------------------------------------------------
+class vtkHDFWriter::Implementation
+{
+public:
+  Implementation(vtkHDFWriter* writer)
+    : File(-1)
+    , VTKGroup(-1)
+    , Writer(writer)
+  {
+    std::fill(this->AttributeDataGroup.begin(), this->AttributeDataGroup.end(), -1);
+  }
+  ~Implementation() { this->Close(); }
+
+  /**
+   * Creates the file, the /VTKHDF group with its Version attribute and
+   * the groups for point, cell and field data.
+   */
+  bool Open(const char* fileName);
+  void Close();
+
+  bool WriteImageData(vtkImageData* data);
+  bool WriteUnstructuredGrid(const std::vector<vtkUnstructuredGrid*>& pieces);
+  bool WriteFieldData(vtkFieldData* fieldData);
+
+private:
+  bool WriteAttribute(const char* name, hid_t type, hsize_t size, const void* values);
+  bool WriteStringAttribute(const char* name, const std::string& value);
+  /**
+   * Creates a dataset, chunked and compressed as requested by the writer.
+   */
+  hid_t CreateDataSet(hid_t group, const char* name, hid_t type, const std::vector<hsize_t>& dims);
+  /**
+   * Writes 'values' in the slab of 'dataset' starting at 'offset' along
+   * the first dimension and of size 'count'.
+   */
+  bool WriteSlab(hid_t dataset, hid_t memoryType, hsize_t offset,
+    const std::vector<hsize_t>& count, const void* values);
+  /**
+   * Writes one dataset holding the arrays of all pieces one after the other.
+   * 'pieceDims' are the tuple dimensions of each piece. The type of the
+   * dataset is 'type', or the type of the first array if 'type' is invalid.
+   */
+  bool WritePieces(hid_t group, const char* name, const std::vector<vtkDataArray*>& arrays,
+    const std::vector<std::vector<hsize_t>>& pieceDims, hid_t type = H5I_INVALID_HID);
+  /**
+   * Writes the arrays of the first piece found in all pieces.
+   */
+  bool WriteArrays(hid_t group, const std::vector<vtkFieldData*>& fields,
+    const std::vector<std::vector<hsize_t>>& pieceDims);
+  bool WriteMetadata(const char* name, const std::vector<long long>& values);
+
+  hid_t File;
+  hid_t VTKGroup;
+  // in the same order as vtkDataObject::AttributeTypes: POINT, CELL, FIELD
+  std::array<hid_t, 3> AttributeDataGroup;
+  vtkHDFWriter* Writer;
+};
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::Open(const char* fileName)
+{
+  if ((this->File = H5Fcreate(fileName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create file: " << fileName);
+    return false;
+  }
+  if ((this->VTKGroup = H5Gcreate(this->File, "/VTKHDF", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+    0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create the /VTKHDF group");
+    return false;
+  }
+  const int version[2] = { vtkHDFReaderMajorVersion, vtkHDFReaderMinorVersion };
+  if (!this->WriteAttribute("Version", H5T_NATIVE_INT, 2, version))
+  {
+    return false;
+  }
+  std::array<const char*, 3> groupNames = { "PointData", "CellData", "FieldData" };
+  for (size_t i = 0; i < this->AttributeDataGroup.size(); ++i)
+  {
+    if ((this->AttributeDataGroup[i] =
+            H5Gcreate(this->VTKGroup, groupNames[i], H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+    {
+      vtkErrorWithObjectMacro(this->Writer, "Cannot create the " << groupNames[i] << " group");
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkHDFWriter::Implementation::Close()
+{
+  for (size_t i = 0; i < this->AttributeDataGroup.size(); ++i)
+  {
+    if (this->AttributeDataGroup[i] >= 0)
+    {
+      H5Gclose(this->AttributeDataGroup[i]);
+      this->AttributeDataGroup[i] = -1;
+    }
+  }
+  if (this->VTKGroup >= 0)
+  {
+    H5Gclose(this->VTKGroup);
+    this->VTKGroup = -1;
+  }
+  if (this->File >= 0)
+  {
+    H5Fclose(this->File);
+    this->File = -1;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteAttribute(
+  const char* name, hid_t type, hsize_t size, const void* values)
+{
+  vtkHDF::ScopedH5SHandle space = H5Screate_simple(1, &size, nullptr);
+  if (space < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create space for attribute " << name);
+    return false;
+  }
+  vtkHDF::ScopedH5AHandle attribute =
+    H5Acreate(this->VTKGroup, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+  if (attribute < 0 || H5Awrite(attribute, type, values) < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot write attribute " << name);
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteStringAttribute(const char* name, const std::string& value)
+{
+  // vtkHDFReader expects a fixed length ASCII string without the
+  // terminating null character.
+  vtkHDF::ScopedH5THandle type = H5Tcopy(H5T_C_S1);
+  if (type < 0 || H5Tset_size(type, value.size()) < 0 ||
+    H5Tset_strpad(type, H5T_STR_NULLPAD) < 0 || H5Tset_cset(type, H5T_CSET_ASCII) < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create the type of attribute " << name);
+    return false;
+  }
+  vtkHDF::ScopedH5SHandle space = H5Screate(H5S_SCALAR);
+  if (space < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create space for attribute " << name);
+    return false;
+  }
+  vtkHDF::ScopedH5AHandle attribute =
+    H5Acreate(this->VTKGroup, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+  if (attribute < 0 || H5Awrite(attribute, type, value.c_str()) < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot write attribute " << name);
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+hid_t vtkHDFWriter::Implementation::CreateDataSet(
+  hid_t group, const char* name, hid_t type, const std::vector<hsize_t>& dims)
+{
+  const int rank = static_cast<int>(dims.size());
+  vtkHDF::ScopedH5SHandle space = H5Screate_simple(rank, dims.data(), nullptr);
+  if (space < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create space for dataset " << name);
+    return H5I_INVALID_HID;
+  }
+  vtkHDF::ScopedH5PHandle properties = H5Pcreate(H5P_DATASET_CREATE);
+  if (properties < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create properties for dataset " << name);
+    return H5I_INVALID_HID;
+  }
+
+  const int compressionLevel = this->Writer->CompressionLevel;
+  hsize_t chunkSize = static_cast<hsize_t>(this->Writer->ChunkSize);
+  if (chunkSize == 0 && compressionLevel > 0)
+  {
+    chunkSize = DefaultCompressedChunkSize;
+  }
+  // empty datasets cannot be chunked
+  if (chunkSize > 0 && ::GetNumberOfValues(dims) > 0)
+  {
+    // keep the fastest varying dimensions whole as long as they fit in a
+    // chunk, and split the first one that does not.
+    std::vector<hsize_t> chunk(dims.size(), 1);
+    hsize_t chunkValues = 1;
+    for (int i = rank - 1; i >= 0; --i)
+    {
+      chunk[i] = std::min(dims[i], std::max<hsize_t>(1, chunkSize / chunkValues));
+      chunkValues *= chunk[i];
+      if (chunk[i] < dims[i])
+      {
+        break;
+      }
+    }
+    if (H5Pset_chunk(properties, rank, chunk.data()) < 0 ||
+      (compressionLevel > 0 && H5Pset_deflate(properties, compressionLevel) < 0))
+    {
+      vtkErrorWithObjectMacro(this->Writer, "Cannot set chunking for dataset " << name);
+      return H5I_INVALID_HID;
+    }
+  }
+
+  hid_t dataset = H5Dcreate(group, name, type, space, H5P_DEFAULT, properties, H5P_DEFAULT);
+  if (dataset < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Cannot create dataset " << name);
+  }
+  return dataset;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteSlab(hid_t dataset, hid_t memoryType, hsize_t offset,
+  const std::vector<hsize_t>& count, const void* values)
+{
+  if (::GetNumberOfValues(count) == 0)
+  {
+    return true;
+  }
+  vtkHDF::ScopedH5SHandle memorySpace =
+    H5Screate_simple(static_cast<int>(count.size()), count.data(), nullptr);
+  if (memorySpace < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Error H5Screate_simple for memory space");
+    return false;
+  }
+  vtkHDF::ScopedH5SHandle fileSpace = H5Dget_space(dataset);
+  std::vector<hsize_t> start(count.size(), 0);
+  start[0] = offset;
+  if (fileSpace < 0 ||
+    H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr) <
+      0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Error selecting hyperslab at offset " << offset);
+    return false;
+  }
+  if (H5Dwrite(dataset, memoryType, memorySpace, fileSpace, H5P_DEFAULT, values) < 0)
+  {
+    vtkErrorWithObjectMacro(this->Writer, "Error H5Dwrite at offset " << offset);
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WritePieces(hid_t group, const char* name,
+  const std::vector<vtkDataArray*>& arrays, const std::vector<std::vector<hsize_t>>& pieceDims,
+  hid_t type)
+{
+  const int numberOfComponents = arrays[0]->GetNumberOfComponents();
+  std::vector<hsize_t> dims = pieceDims[0];
+  dims[0] = 0;
+  for (size_t piece = 0; piece < arrays.size(); ++piece)
+  {
+    dims[0] += pieceDims[piece][0];
+  }
+  if (numberOfComponents > 1)
+  {
+    dims.push_back(numberOfComponents);
+  }
+  if (type < 0)
+  {
+    type = ::GetNativeType(arrays[0]->GetDataType());
+  }
+  vtkHDF::ScopedH5DHandle dataset = this->CreateDataSet(group, name, type, dims);
+  if (dataset < 0)
+  {
+    return false;
+  }
+
+  hsize_t offset = 0;
+  for (size_t piece = 0; piece < arrays.size(); ++piece)
+  {
+    std::vector<hsize_t> count = pieceDims[piece];
+    if (numberOfComponents > 1)
+    {
+      count.push_back(numberOfComponents);
+    }
+    // HDF5 converts the values when the piece type differs from the
+    // dataset type.
+    vtkSmartPointer<vtkDataArray> array = ::GetContiguousArray(arrays[piece]);
+    if (!this->WriteSlab(dataset, ::GetNativeType(array->GetDataType()), offset, count,
+          array->GetVoidPointer(0)))
+    {
+      vtkErrorWithObjectMacro(this->Writer, "Cannot write dataset " << name);
+      return false;
+    }
+    offset += count[0];
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteArrays(hid_t group,
+  const std::vector<vtkFieldData*>& fields, const std::vector<std::vector<hsize_t>>& pieceDims)
+{
+  vtkFieldData* firstFields = fields[0];
+  for (int i = 0; i < firstFields->GetNumberOfArrays(); ++i)
+  {
+    vtkAbstractArray* firstArray = firstFields->GetAbstractArray(i);
+    const char* name = firstArray->GetName();
+    if (!name || !*name || std::string(name).find('/') != std::string::npos)
+    {
+      vtkWarningWithObjectMacro(this->Writer,
+        "Skipping array " << i << " which has no name or a name with a '/': "
+                          << (name ? name : "(null)"));
+      continue;
+    }
+
+    std::vector<vtkDataArray*> arrays;
+    for (size_t piece = 0; piece < fields.size(); ++piece)
+    {
+      vtkDataArray* array = fields[piece]->GetArray(name);
+      if (!array || ::GetNativeType(array->GetDataType()) < 0 ||
+        array->GetNumberOfComponents() != firstArray->GetNumberOfComponents() ||
+        static_cast<hsize_t>(array->GetNumberOfTuples()) != ::GetNumberOfValues(pieceDims[piece]))
+      {
+        break;
+      }
+      arrays.push_back(array);
+    }
+    if (arrays.size() != fields.size())
+    {
+      vtkWarningWithObjectMacro(this->Writer,
+        "Skipping array " << name
+                          << " which is not a numeric array of the same size and number of "
+                             "components in all pieces");
+      continue;
+    }
+    if (!this->WritePieces(group, name, arrays, pieceDims))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteMetadata(
+  const char* name, const std::vector<long long>& values)
+{
+  std::vector<hsize_t> dims = { values.size() };
+  vtkHDF::ScopedH5DHandle dataset = this->CreateDataSet(this->VTKGroup, name, H5T_STD_I64LE, dims);
+  return dataset >= 0 && this->WriteSlab(dataset, H5T_NATIVE_LLONG, 0, dims, values.data());
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteImageData(vtkImageData* data)
+{
+  int extent[6];
+  data->GetExtent(extent);
+  if (!this->WriteStringAttribute("Type", "ImageData") ||
+    !this->WriteAttribute("WholeExtent", H5T_NATIVE_INT, 6, extent) ||
+    !this->WriteAttribute("Origin", H5T_NATIVE_DOUBLE, 3, data->GetOrigin()) ||
+    !this->WriteAttribute("Spacing", H5T_NATIVE_DOUBLE, 3, data->GetSpacing()) ||
+    !this->WriteAttribute("Direction", H5T_NATIVE_DOUBLE, 9, data->GetDirectionMatrix()->GetData()))
+  {
+    return false;
+  }
+
+  // arrays are stored in C order, with the fastest varying dimension last.
+  std::vector<hsize_t> pointDims(3), cellDims(3);
+  for (int i = 0; i < 3; ++i)
+  {
+    const hsize_t numberOfPoints = extent[2 * i + 1] - extent[2 * i] + 1;
+    pointDims[2 - i] = numberOfPoints;
+    cellDims[2 - i] = std::max<hsize_t>(numberOfPoints - 1, 1);
+  }
+  return this->WriteArrays(this->AttributeDataGroup[vtkDataObject::POINT],
+           { data->GetPointData() }, { pointDims }) &&
+    this->WriteArrays(
+      this->AttributeDataGroup[vtkDataObject::CELL], { data->GetCellData() }, { cellDims });
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteUnstructuredGrid(
+  const std::vector<vtkUnstructuredGrid*>& pieces)
+{
+  if (!this->WriteStringAttribute("Type", "UnstructuredGrid"))
+  {
+    return false;
+  }
+
+  // empty grids may have no points or cells at all
+  vtkNew<vtkFloatArray> emptyPoints;
+  emptyPoints->SetNumberOfComponents(3);
+  vtkNew<vtkCellArray> emptyCells;
+  vtkNew<vtkUnsignedCharArray> emptyTypes;
+
+  std::vector<long long> numberOfPoints, numberOfCells, numberOfConnectivityIds;
+  std::vector<vtkDataArray*> points, types, connectivity, offsets;
+  std::vector<vtkFieldData*> pointData, cellData;
+  std::vector<std::vector<hsize_t>> pointDims, cellDims, connectivityDims, offsetsDims;
+  for (vtkUnstructuredGrid* piece : pieces)
+  {
+    vtkCellArray* cells = piece->GetCells() ? piece->GetCells() : emptyCells.Get();
+    vtkDataArray* pieceTypes = piece->GetCellTypesArray();
+    points.push_back(piece->GetPoints() ? piece->GetPoints()->GetData() : emptyPoints.Get());
+    types.push_back(pieceTypes ? pieceTypes : emptyTypes.Get());
+    connectivity.push_back(cells->GetConnectivityArray());
+    offsets.push_back(cells->GetOffsetsArray());
+    pointData.push_back(piece->GetPointData());
+    cellData.push_back(piece->GetCellData());
+
+    numberOfPoints.push_back(piece->GetNumberOfPoints());
+    numberOfCells.push_back(cells->GetNumberOfCells());
+    numberOfConnectivityIds.push_back(cells->GetNumberOfConnectivityIds());
+    pointDims.push_back({ static_cast<hsize_t>(numberOfPoints.back()) });
+    cellDims.push_back({ static_cast<hsize_t>(numberOfCells.back()) });
+    connectivityDims.push_back({ static_cast<hsize_t>(numberOfConnectivityIds.back()) });
+    offsetsDims.push_back({ static_cast<hsize_t>(numberOfCells.back() + 1) });
+  }
+  if (!this->WriteMetadata("NumberOfPoints", numberOfPoints) ||
+    !this->WriteMetadata("NumberOfCells", numberOfCells) ||
+    !this->WriteMetadata("NumberOfConnectivityIds", numberOfConnectivityIds))
+  {
+    return false;
+  }
+  if (pieces.empty())
+  {
+    return true;
+  }
+  // connectivity and offsets are always stored as 64 bit integers so that
+  // vtkHDFReader can build cell arrays from them.
+  return this->WritePieces(this->VTKGroup, "Points", points, pointDims) &&
+    this->WritePieces(this->VTKGroup, "Types", types, cellDims) &&
+    this->WritePieces(
+      this->VTKGroup, "Connectivity", connectivity, connectivityDims, H5T_STD_I64LE) &&
+    this->WritePieces(this->VTKGroup, "Offsets", offsets, offsetsDims, H5T_STD_I64LE) &&
+    this->WriteArrays(this->AttributeDataGroup[vtkDataObject::POINT], pointData, pointDims) &&
+    this->WriteArrays(this->AttributeDataGroup[vtkDataObject::CELL], cellData, cellDims);
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteFieldData(vtkFieldData* fieldData)
+{
+  hid_t group = this->AttributeDataGroup[vtkDataObject::FIELD];
+  for (int i = 0; fieldData && i < fieldData->GetNumberOfArrays(); ++i)
+  {
+    vtkAbstractArray* array = fieldData->GetAbstractArray(i);
+    const char* name = array->GetName();
+    // vtkHDFReader cannot read empty field arrays
+    if (!name || !*name || std::string(name).find('/') != std::string::npos ||
+      array->GetNumberOfTuples() == 0)
+    {
+      vtkWarningWithObjectMacro(
+        this->Writer, "Skipping empty or unnamed field array: " << (name ? name : "(null)"));
+      continue;
+    }
+
+    if (vtkStringArray* stringArray = vtkStringArray::SafeDownCast(array))
+    {
+      std::vector<const char*> values(stringArray->GetNumberOfValues());
+      for (vtkIdType j = 0; j < stringArray->GetNumberOfValues(); ++j)
+      {
+        values[j] = stringArray->GetValue(j).c_str();
+      }
+      vtkHDF::ScopedH5THandle type = H5Tcopy(H5T_C_S1);
+      if (type < 0 || H5Tset_size(type, H5T_VARIABLE) < 0)
+      {
+        vtkErrorWithObjectMacro(this->Writer, "Error H5Tset_size");
+        return false;
+      }
+      std::vector<hsize_t> dims = { values.size() };
+      vtkHDF::ScopedH5DHandle dataset = this->CreateDataSet(group, name, type, dims);
+      if (dataset < 0 || !this->WriteSlab(dataset, type, 0, dims, values.data()))
+      {
+        vtkErrorWithObjectMacro(this->Writer, "Cannot write field array " << name);
+        return false;
+      }
+    }
+    else if (vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array))
+    {
+      if (::GetNativeType(dataArray->GetDataType()) < 0)
+      {
+        vtkWarningWithObjectMacro(
+          this->Writer, "Skipping field array " << name << " of unsupported type");
+        continue;
+      }
+      std::vector<hsize_t> dims = { static_cast<hsize_t>(dataArray->GetNumberOfTuples()) };
+      if (!this->WritePieces(group, name, { dataArray }, { dims }))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      vtkWarningWithObjectMacro(
+        this->Writer, "Skipping field array " << name << " of unsupported type");
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkHDFWriter::vtkHDFWriter()
+  : FileName(nullptr)
+  , ChunkSize(0)
+  , CompressionLevel(0)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkHDFWriter::~vtkHDFWriter()
+{
+  this->SetFileName(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkHDFWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "ChunkSize: " << this->ChunkSize << "\n";
+  os << indent << "CompressionLevel: " << this->CompressionLevel << "\n";
+}
+
+//------------------------------------------------------------------------------
+int vtkHDFWriter::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkUnstructuredGrid");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPartitionedDataSet");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkHDFWriter::WriteData()
+{
+  if (!this->FileName)
+  {
+    vtkErrorMacro("Requires valid output file name");
+    this->SetErrorCode(vtkErrorCode::NoFileNameError);
+    return;
+  }
+
+  vtkDataObject* input = this->GetInput();
+  std::vector<vtkUnstructuredGrid*> pieces;
+  if (vtkPartitionedDataSet* partitioned = vtkPartitionedDataSet::SafeDownCast(input))
+  {
+    for (unsigned int i = 0; i < partitioned->GetNumberOfPartitions(); ++i)
+    {
+      vtkDataSet* partition = partitioned->GetPartition(i);
+      if (!partition)
+      {
+        continue;
+      }
+      vtkUnstructuredGrid* piece = vtkUnstructuredGrid::SafeDownCast(partition);
+      if (!piece)
+      {
+        vtkErrorMacro("Partitions must be vtkUnstructuredGrid, got: " << partition->GetClassName());
+        return;
+      }
+      pieces.push_back(piece);
+    }
+  }
+
+  Implementation impl(this);
+  if (!impl.Open(this->FileName))
+  {
+    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+    return;
+  }
+  bool success = false;
+  if (vtkImageData* image = vtkImageData::SafeDownCast(input))
+  {
+    success = impl.WriteImageData(image);
+  }
+  else if (vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input))
+  {
+    success = impl.WriteUnstructuredGrid({ grid });
+  }
+  else
+  {
+    success = impl.WriteUnstructuredGrid(pieces);
+  }
+  if (!success || !impl.WriteFieldData(input->GetFieldData()))
+  {
+    this->SetErrorCode(vtkErrorCode::UnknownError);
+  }
+}
+VTK_ABI_NAMESPACE_END
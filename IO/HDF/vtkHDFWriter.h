@@ -0,0 +1,92 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHDFWriter
+ * @brief   Write VTK HDF files.
+ *
+ * Writes data using the VTK HDF format read by vtkHDFReader. Image data and
+ * unstructured grids are supported. A vtkPartitionedDataSet made of
+ * unstructured grids is written as one unstructured grid with a file piece
+ * per partition, which vtkHDFReader can then distribute among processes.
+ *
+ * By default datasets are stored contiguously. Setting ChunkSize stores
+ * them in chunks of about that many values, and setting CompressionLevel
+ * compresses the chunks with the deflate filter.
+ *
+ * @sa vtkHDFReader
+ */
+
+#ifndef vtkHDFWriter_h
+#define vtkHDFWriter_h
+
+#include "vtkIOHDFModule.h" // For export macro
+#include "vtkWriter.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIOHDF_EXPORT vtkHDFWriter : public vtkWriter
+{
+public:
+  static vtkHDFWriter* New();
+  vtkTypeMacro(vtkHDFWriter, vtkWriter);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Get/Set the name of the output file.
+   */
+  vtkSetFilePathMacro(FileName);
+  vtkGetFilePathMacro(FileName);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the approximate number of values stored in each HDF5 chunk.
+   * Chunks always span whole tuples and, for image data, whole rows.
+   * 0 stores datasets contiguously unless compression is enabled, in which
+   * case chunks of 65536 values are used. Default is 0.
+   */
+  vtkSetClampMacro(ChunkSize, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(ChunkSize, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the deflate compression level, between 0 (no compression) and 9.
+   * Compressed datasets are always chunked. Default is 0.
+   */
+  vtkSetClampMacro(CompressionLevel, int, 0, 9);
+  vtkGetMacro(CompressionLevel, int);
+  ///@}
+
+protected:
+  vtkHDFWriter();
+  ~vtkHDFWriter() override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  void WriteData() override;
+
+  char* FileName;
+  vtkIdType ChunkSize;
+  int CompressionLevel;
+
+private:
+  vtkHDFWriter(const vtkHDFWriter&) = delete;
+  void operator=(const vtkHDFWriter&) = delete;
+
+  class Implementation;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -23,7 +23,6 @@
 #include "vtkDataSet.h"
 #include "vtkExtractGrid.h"
 #include "vtkHexahedron.h"
-#include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationVector.h"
@@ -41,6 +40,7 @@
 #include "vtkPointData.h"
 #include "vtkQuad.h"
 #include "vtkRemoveUnusedPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -620,7 +620,8 @@ private:
 
   /**
    * Fields like "ids" have to be vtkIdTypeArray in VTK. This method does the
-   * conversion if needed.
+   * conversion if needed. When the field already has the layout of a
+   * vtkIdTypeArray (64-bit ids), its buffer is shared instead of copied.
    */
   vtkSmartPointer<vtkAbstractArray> ConvertFieldForVTK(vtkAbstractArray* array)
   {
@@ -635,7 +636,14 @@ private:
     }
 
     vtkNew<vtkIdTypeArray> ids;
-    ids->DeepCopy(array);
+    if (auto dataArray = vtkDataArray::SafeDownCast(array))
+    {
+      ids->ShallowCopy(dataArray);
+    }
+    else
+    {
+      ids->DeepCopy(array);
+    }
     return ids;
   }
 
@@ -2320,20 +2328,21 @@ vtkSmartPointer<vtkAbstractArray> vtkIOSSReader::vtkInternals::GetField(
   auto full_field = get_field_for_entity();
   if (full_field != nullptr && ids_to_extract != nullptr)
   {
-    // subset the field.
-    vtkNew<vtkIdList> list;
-    // this is a shallow copy.
-    list->SetArray(ids_to_extract->GetPointer(0), ids_to_extract->GetNumberOfTuples());
+    // subset the field, in parallel.
+    const vtkIdType numIds = ids_to_extract->GetNumberOfTuples();
+    const vtkIdType* ids = ids_to_extract->GetPointer(0);
 
     vtkSmartPointer<vtkAbstractArray> clone;
     clone.TakeReference(full_field->NewInstance());
     clone->SetName(full_field->GetName());
     clone->SetNumberOfComponents(full_field->GetNumberOfComponents());
-    clone->SetNumberOfTuples(list->GetNumberOfIds());
-    full_field->GetTuples(list, clone);
-
-    // get back the data pointer from the idlist
-    list->Release();
+    clone->SetNumberOfTuples(numIds);
+    vtkSMPTools::For(0, numIds, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        clone->SetTuple(cc, ids[cc], full_field);
+      }
+    });
 
     // convert field if needed for VTK e.g. ids have to be `vtkIdTypeArray`.
     clone = this->ConvertFieldForVTK(clone);
@@ -2590,17 +2599,20 @@ bool vtkIOSSReader::vtkInternals::ApplyDisplacements(vtkPointSet* grid, Ioss::Re
     vtkNew<vtkPoints> xformedPts;
     xformedPts->SetDataType(pts->GetDataType());
     xformedPts->SetNumberOfPoints(pts->GetNumberOfPoints());
-    vtkVector3d coords{ 0.0 }, displ{ 0.0 };
-    for (vtkIdType cc = 0; cc < numPts; ++cc)
-    {
-      pts->GetPoint(cc, coords.GetData());
-      array->GetTuple(cc, displ.GetData());
-      for (int i = 0; i < 3; ++i)
+    const int numComps = array->GetNumberOfComponents();
+    const double magnitude = this->DisplacementMagnitude;
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      vtkVector3d coords{ 0.0 };
+      for (vtkIdType cc = begin; cc < end; ++cc)
       {
-        displ[i] *= this->DisplacementMagnitude;
+        pts->GetPoint(cc, coords.GetData());
+        for (int i = 0; i < numComps; ++i)
+        {
+          coords[i] += array->GetComponent(cc, i) * magnitude;
+        }
+        xformedPts->SetPoint(cc, coords.GetData());
       }
-      xformedPts->SetPoint(cc, (coords + displ).GetData());
-    }
+    });
 
     grid->SetPoints(xformedPts);
     cache.Insert(group_entity, xformPtsCacheKey, xformedPts);
@@ -0,0 +1,124 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestImageReader2Slices.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkImageReader2 reads the same raw volume from one file per
+// slice, read concurrently, and from a single file, read or memory mapped.
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkImageReader2.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTestUtilities.h"
+
+#include "vtksys/FStream.hxx"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+const int Dimensions[3] = { 17, 11, 9 };
+
+bool CheckOutput(vtkImageReader2* reader, const std::vector<short>& values, const char* mode)
+{
+  reader->Update();
+  vtkDataArray* scalars = reader->GetOutput()->GetPointData()->GetScalars();
+  if (!scalars || scalars->GetNumberOfTuples() != static_cast<vtkIdType>(values.size()))
+  {
+    std::cerr << "Wrong number of values read " << mode << std::endl;
+    return false;
+  }
+  const int rowsPerSlice = Dimensions[1];
+  for (vtkIdType id = 0; id < scalars->GetNumberOfTuples(); ++id)
+  {
+    // the rows are stored from the upper left corner unless FileLowerLeft is on
+    vtkIdType row = id / Dimensions[0];
+    vtkIdType fileRow = reader->GetFileLowerLeft()
+      ? row
+      : (row / rowsPerSlice) * rowsPerSlice + rowsPerSlice - 1 - row % rowsPerSlice;
+    vtkIdType fileId = fileRow * Dimensions[0] + id % Dimensions[0];
+    if (scalars->GetTuple1(id) != values[fileId])
+    {
+      std::cerr << "Wrong value " << scalars->GetTuple1(id) << " at " << id << " instead of "
+                << values[fileId] << " " << mode << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestImageReader2Slices(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string prefix = std::string(tempDir) + "/TestImageReader2Slices";
+  delete[] tempDir;
+
+  const size_t sliceSize = static_cast<size_t>(Dimensions[0]) * Dimensions[1];
+  std::vector<short> values(sliceSize * Dimensions[2]);
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    values[i] = static_cast<short>(7 * i - 300);
+  }
+
+  // a volume file with a header, and a file per slice
+  const char header[8] = { 0 };
+  const std::string volumeName = prefix + ".raw";
+  vtksys::ofstream volume(volumeName.c_str(), std::ios::out | std::ios::binary);
+  volume.write(header, sizeof(header));
+  volume.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(short));
+  volume.close();
+  for (int k = 0; k < Dimensions[2]; ++k)
+  {
+    const std::string sliceName = prefix + "." + std::to_string(k);
+    vtksys::ofstream slice(sliceName.c_str(), std::ios::out | std::ios::binary);
+    slice.write(reinterpret_cast<const char*>(values.data() + k * sliceSize),
+      sliceSize * sizeof(short));
+  }
+
+  for (int lowerLeft = 0; lowerLeft < 2; ++lowerLeft)
+  {
+    vtkNew<vtkImageReader2> sliceReader;
+    sliceReader->SetFilePrefix(prefix.c_str());
+    sliceReader->SetFileDimensionality(2);
+    sliceReader->SetDataExtent(0, Dimensions[0] - 1, 0, Dimensions[1] - 1, 0, Dimensions[2] - 1);
+    sliceReader->SetDataScalarTypeToShort();
+    sliceReader->SetFileLowerLeft(lowerLeft);
+    if (!CheckOutput(sliceReader, values, "from the slice files"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    for (int mapped = 0; mapped < 2; ++mapped)
+    {
+      vtkNew<vtkImageReader2> volumeReader;
+      volumeReader->SetFileName(volumeName.c_str());
+      volumeReader->SetFileDimensionality(3);
+      volumeReader->SetHeaderSize(sizeof(header));
+      volumeReader->SetDataExtent(
+        0, Dimensions[0] - 1, 0, Dimensions[1] - 1, 0, Dimensions[2] - 1);
+      volumeReader->SetDataScalarTypeToShort();
+      volumeReader->SetFileLowerLeft(lowerLeft);
+      volumeReader->SetUseMemoryMapping(mapped != 0);
+      if (!CheckOutput(volumeReader, values, mapped ? "mapping the volume" : "from the volume"))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,243 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestOMETIFFReaderTiles.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkOMETIFFReader reads sub-extents and pyramid levels of a tiled
+// OME-TIFF file, with and without its tile cache.
+
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkOMETIFFReader.h"
+#include "vtkPointData.h"
+#include "vtkTestUtilities.h"
+
+#include "vtk_tiff.h"
+
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+const int SizeX = 300;
+const int SizeY = 200;
+const int SizeZ = 2;
+const int SizeC = 2;
+const int SizeT = 2;
+const int NumberOfLevels = 3;
+
+// value of pixel (x, y) of the IFD holding plane (c, t, z), at the given level
+int GetValue(int x, int y, int c, int t, int z, int level)
+{
+  const int ifd = z + SizeZ * (c + SizeC * t);
+  return (ifd * 4096 + level * 1024 + 3 * x + 7 * y) % 65536;
+}
+
+bool WritePlane(TIFF* tif, int c, int t, int z, int level, const std::string& description)
+{
+  const int width = SizeX >> level;
+  const int height = SizeY >> level;
+  const int tileSize = level == 0 ? 64 : 32;
+  TIFFSetField(tif, TIFFTAG_SUBFILETYPE, level == 0 ? 0 : FILETYPE_REDUCEDIMAGE);
+  TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, width);
+  TIFFSetField(tif, TIFFTAG_IMAGELENGTH, height);
+  TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, 16);
+  TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, 1);
+  TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_MINISBLACK);
+  TIFFSetField(tif, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+  TIFFSetField(tif, TIFFTAG_COMPRESSION, COMPRESSION_ADOBE_DEFLATE);
+  TIFFSetField(tif, TIFFTAG_TILEWIDTH, tileSize);
+  TIFFSetField(tif, TIFFTAG_TILELENGTH, tileSize);
+  if (!description.empty())
+  {
+    TIFFSetField(tif, TIFFTAG_IMAGEDESCRIPTION, description.c_str());
+  }
+  if (level == 0)
+  {
+    // the reduced resolutions are written in the next directories, as SubIFDs
+    uint64_t subIFDs[NumberOfLevels - 1] = { 0 };
+    TIFFSetField(tif, TIFFTAG_SUBIFD, NumberOfLevels - 1, subIFDs);
+  }
+
+  std::vector<uint16_t> tile(tileSize * tileSize);
+  for (int ty = 0; ty < height; ty += tileSize)
+  {
+    for (int tx = 0; tx < width; tx += tileSize)
+    {
+      for (int y = 0; y < tileSize; ++y)
+      {
+        for (int x = 0; x < tileSize; ++x)
+        {
+          tile[y * tileSize + x] = static_cast<uint16_t>(GetValue(tx + x, ty + y, c, t, z, level));
+        }
+      }
+      if (TIFFWriteTile(tif, tile.data(), tx, ty, 0, 0) < 0)
+      {
+        return false;
+      }
+    }
+  }
+  return TIFFWriteDirectory(tif) != 0;
+}
+
+bool WriteFile(const std::string& fname)
+{
+  std::ostringstream description;
+  description << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+              << "<OME xmlns=\"http://www.openmicroscopy.org/Schemas/OME/2016-06\">"
+              << "<Image ID=\"Image:0\"><Pixels ID=\"Pixels:0\" DimensionOrder=\"XYZCT\" "
+              << "Type=\"uint16\" SizeX=\"" << SizeX << "\" SizeY=\"" << SizeY << "\" SizeZ=\""
+              << SizeZ << "\" SizeC=\"" << SizeC << "\" SizeT=\"" << SizeT << "\" "
+              << "PhysicalSizeX=\"0.5\" PhysicalSizeY=\"0.5\" PhysicalSizeZ=\"2\">"
+              << "<TiffData IFD=\"0\" PlaneCount=\"" << SizeZ * SizeC * SizeT << "\"/>"
+              << "</Pixels></Image></OME>";
+
+  TIFF* tif = TIFFOpen(fname.c_str(), "w");
+  if (!tif)
+  {
+    return false;
+  }
+  bool status = true;
+  for (int t = 0; t < SizeT && status; ++t)
+  {
+    for (int c = 0; c < SizeC && status; ++c)
+    {
+      for (int z = 0; z < SizeZ && status; ++z)
+      {
+        const bool first = t == 0 && c == 0 && z == 0;
+        for (int level = 0; level < NumberOfLevels && status; ++level)
+        {
+          status = WritePlane(tif, c, t, z, level, first && level == 0 ? description.str() : "");
+        }
+      }
+    }
+  }
+  TIFFClose(tif);
+  return status;
+}
+
+bool CheckOutput(vtkOMETIFFReader* reader, int t, const int extent[6], int level, double spacing)
+{
+  reader->UpdateTimeStep(t, -1, 1, 0, extent);
+  vtkImageData* output = reader->GetOutput();
+
+  int outExtent[6];
+  output->GetExtent(outExtent);
+  for (int i = 0; i < 6; ++i)
+  {
+    if (outExtent[i] != extent[i])
+    {
+      std::cerr << "Wrong extent read at level " << level << std::endl;
+      return false;
+    }
+  }
+  if (reader->GetLevel() != level || std::abs(output->GetSpacing()[0] - spacing) > 1e-9)
+  {
+    std::cerr << "Wrong level " << reader->GetLevel() << " or spacing "
+              << output->GetSpacing()[0] << " instead of " << level << ", " << spacing
+              << std::endl;
+    return false;
+  }
+  if (!output->GetFieldData()->GetArray("Channel_1_Range"))
+  {
+    std::cerr << "Missing channel range" << std::endl;
+    return false;
+  }
+
+  for (int c = 0; c < SizeC; ++c)
+  {
+    const std::string name = "Channel_" + std::to_string(c + 1);
+    vtkDataArray* array = output->GetPointData()->GetArray(name.c_str());
+    if (!array)
+    {
+      std::cerr << "Missing array " << name << std::endl;
+      return false;
+    }
+    for (int z = extent[4]; z <= extent[5]; ++z)
+    {
+      for (int y = extent[2]; y <= extent[3]; ++y)
+      {
+        for (int x = extent[0]; x <= extent[1]; ++x)
+        {
+          int ijk[3] = { x, y, z };
+          const double value = array->GetTuple1(output->ComputePointId(ijk));
+          if (value != GetValue(x, y, c, t, z, level))
+          {
+            std::cerr << "Wrong value " << value << " at (" << x << ", " << y << ", " << z
+                      << ") of " << name << " at level " << level << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestOMETIFFReaderTiles(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fname = std::string(tempDir) + "/TestOMETIFFReaderTiles.ome.tif";
+  delete[] tempDir;
+
+  if (!WriteFile(fname))
+  {
+    std::cerr << "Cannot write " << fname << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkOMETIFFReader> reader;
+  reader->SetFileName(fname.c_str());
+  reader->UpdateInformation();
+  if (reader->GetNumberOfLevels() != NumberOfLevels)
+  {
+    std::cerr << "Wrong number of levels " << reader->GetNumberOfLevels() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the whole image, then windows crossing tiles, as when panning
+  const int whole[6] = { 0, SizeX - 1, 0, SizeY - 1, 0, SizeZ - 1 };
+  const int window[6] = { 100, 180, 50, 120, 1, 1 };
+  const int panned[6] = { 130, 299, 60, 199, 0, 1 };
+  for (int cacheSize : { 256, 0 })
+  {
+    reader->SetTileCacheSize(cacheSize);
+    reader->SetResolution(1.0);
+    if (!CheckOutput(reader, 0, whole, 0, 0.5) || !CheckOutput(reader, 1, window, 0, 0.5) ||
+      !CheckOutput(reader, 1, panned, 0, 0.5))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // the coarsest level wide enough for the requested resolution
+    const int level1[6] = { 10, 140, 0, 99, 0, 1 };
+    reader->SetResolution(0.3);
+    if (!CheckOutput(reader, 1, level1, 1, 1.0))
+    {
+      return EXIT_FAILURE;
+    }
+    const int level2[6] = { 0, 74, 20, 49, 1, 1 };
+    reader->SetResolution(0.25);
+    if (!CheckOutput(reader, 0, level2, 2, 2.0))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
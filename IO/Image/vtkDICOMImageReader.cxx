@@ -20,10 +20,14 @@
 #include "vtkImageData.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include <vtksys/SystemTools.hxx>
 
+#include <atomic>
 #include <cmath>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -37,6 +41,22 @@ class vtkDICOMImageReaderVector : public std::vector<std::string>
 {
 };
 
+namespace
+{
+// Parser of the files read by a thread.
+struct SliceParser
+{
+  DICOMParser Parser;
+  DICOMAppHelper AppHelper;
+
+  SliceParser()
+  {
+    this->AppHelper.RegisterCallbacks(&this->Parser);
+    this->AppHelper.RegisterPixelDataCallback(&this->Parser);
+  }
+};
+}
+
 //------------------------------------------------------------------------------
 vtkDICOMImageReader::vtkDICOMImageReader()
 {
@@ -291,62 +311,94 @@ void vtkDICOMImageReader::ExecuteDataWithInformation(vtkDataObject* output, vtkI
   else if (!this->DICOMFileNames->empty())
   {
     vtkDebugMacro(<< "Multiple files (" << static_cast<int>(this->DICOMFileNames->size()) << ")");
-    this->Parser->ClearAllDICOMTagCallbacks();
-    this->AppHelper->Clear();
-    this->AppHelper->RegisterCallbacks(this->Parser);
-    this->AppHelper->RegisterPixelDataCallback(this->Parser);
 
-    void* buffer = data->GetScalarPointer();
+    unsigned char* buffer = static_cast<unsigned char*>(data->GetScalarPointer());
     if (buffer == nullptr)
     {
       vtkErrorMacro(<< "No memory allocated for image data!");
       return;
     }
 
-    std::vector<std::string>::iterator fiter;
-
-    int count = 0;
-    vtkIdType numFiles = static_cast<int>(this->DICOMFileNames->size());
-
-    for (fiter = this->DICOMFileNames->begin(); fiter != this->DICOMFileNames->end(); ++fiter)
-    {
-      count++;
-      const char* file = fiter->c_str();
-      vtkDebugMacro(<< "File : " << file);
-      this->Parser->OpenFile(file);
-      this->Parser->ReadHeader();
-
-      void* imgData = nullptr;
-      DICOMParser::VRTypes dataType;
-      unsigned long imageDataLengthInBytes;
-
-      this->AppHelper->GetImageData(imgData, dataType, imageDataLengthInBytes);
-      if (!imageDataLengthInBytes)
+    // The files are parsed concurrently, each thread with its own parser,
+    // and each image is copied in its slice of the output.
+    const vtkIdType numFiles = static_cast<vtkIdType>(this->DICOMFileNames->size());
+    const vtkIdType rowLength = this->DataIncrements[1];
+    const vtkIdType sliceLength = this->DataIncrements[2];
+    vtkSMPThreadLocal<std::shared_ptr<SliceParser>> parsers;
+    std::atomic<vtkIdType> filesRead(0);
+    std::atomic<vtkIdType> failedFile(numFiles);
+    vtkSMPTools::For(0, numFiles, 1, [&](vtkIdType begin, vtkIdType end) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      std::shared_ptr<SliceParser>& parser = parsers.Local();
+      if (!parser)
       {
-        vtkErrorMacro(<< "There was a problem retrieving data from: " << file);
-        this->SetErrorCode(vtkErrorCode::FileFormatError);
-        return;
+        parser = std::make_shared<SliceParser>();
       }
-
-      // DICOM stores the upper left pixel as the first pixel in an
-      // image. VTK stores the lower left pixel as the first pixel in
-      // an image.  Need to flip the data.
-      vtkIdType rowLength;
-      rowLength = this->DataIncrements[1];
-      unsigned char* b = (unsigned char*)buffer;
-      unsigned char* iData = (unsigned char*)imgData;
-      iData += (imageDataLengthInBytes - rowLength); // beginning of last row
-      for (int i = 0; i < this->AppHelper->GetHeight(); ++i)
+      for (vtkIdType fileId = begin; fileId < end && failedFile == numFiles; ++fileId)
       {
-        memcpy(b, iData, rowLength);
-        b += rowLength;
-        iData -= rowLength;
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+
+        const std::string& file = (*this->DICOMFileNames)[fileId];
+        parser->Parser.OpenFile(file);
+        parser->Parser.ReadHeader();
+
+        void* imgData = nullptr;
+        DICOMParser::VRTypes dataType;
+        unsigned long imageDataLengthInBytes;
+
+        parser->AppHelper.GetImageData(imgData, dataType, imageDataLengthInBytes);
+        if (!imageDataLengthInBytes ||
+          static_cast<vtkIdType>(imageDataLengthInBytes) > sliceLength)
+        {
+          vtkIdType expected = numFiles;
+          failedFile.compare_exchange_strong(expected, fileId);
+          break;
+        }
+
+        // DICOM stores the upper left pixel as the first pixel in an
+        // image. VTK stores the lower left pixel as the first pixel in
+        // an image.  Need to flip the data.
+        unsigned char* b = buffer + fileId * sliceLength;
+        unsigned char* iData = static_cast<unsigned char*>(imgData);
+        iData += (imageDataLengthInBytes - rowLength); // beginning of last row
+        for (int i = 0; i < parser->AppHelper.GetHeight(); ++i)
+        {
+          memcpy(b, iData, rowLength);
+          b += rowLength;
+          iData -= rowLength;
+        }
+
+        vtkIdType count = ++filesRead;
+        if (isFirst)
+        {
+          this->UpdateProgress(float(count) / float(numFiles));
+          this->SetProgressText(file.c_str());
+        }
       }
-      buffer = ((char*)buffer) + imageDataLengthInBytes;
+    });
 
-      this->UpdateProgress(float(count) / float(numFiles));
-      this->SetProgressText(fiter->c_str());
+    if (failedFile != numFiles)
+    {
+      vtkErrorMacro(<< "There was a problem retrieving data from: "
+                    << (*this->DICOMFileNames)[failedFile]);
+      this->SetErrorCode(vtkErrorCode::FileFormatError);
+      return;
     }
+
+    // The information getters report the header of the last file, as when
+    // the files were read one after another.
+    this->Parser->ClearAllDICOMTagCallbacks();
+    this->AppHelper->Clear();
+    this->AppHelper->RegisterCallbacks(this->Parser);
+    this->Parser->OpenFile(this->DICOMFileNames->back());
+    this->Parser->ReadHeader();
   }
 }
 
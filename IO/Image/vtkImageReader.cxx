@@ -367,6 +367,15 @@ void vtkImageReaderUpdate1(vtkImageReader* self, vtkImageData* data, T* inPtr)
 // are assumed to be the same as the file extent/order.
 void vtkImageReader::ExecuteDataWithInformation(vtkDataObject* output, vtkInformation* outInfo)
 {
+  // the file can only be mapped when its values are used as they are
+  if (!this->Transform && this->DataMask == static_cast<vtkTypeUInt64>(~0UL) &&
+    (this->FileName || this->FilePattern) && this->MapOutputScalars(output, outInfo))
+  {
+    vtkImageData::SafeDownCast(output)->GetPointData()->GetScalars()->SetName(
+      this->ScalarArrayName);
+    return;
+  }
+
   vtkImageData* data = this->AllocateOutputData(output, outInfo);
 
   void* ptr = nullptr;
@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkImageReader2.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkByteSwap.h"
 #include "vtkDataArray.h"
 #include "vtkEndian.h"
@@ -23,6 +24,7 @@
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 
@@ -30,9 +32,114 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
+#include <atomic>
 #include <ios>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+#if !defined(_WIN32)
+//------------------------------------------------------------------------------
+// Memory mappings backing the mapped scalars, indexed by the pointer given to
+// the arrays. Each one stores the start and length of the mapping.
+std::map<void*, std::pair<void*, size_t>>& GetMappings(std::mutex*& mutex)
+{
+  static std::mutex mappingsMutex;
+  static std::map<void*, std::pair<void*, size_t>> mappings;
+  mutex = &mappingsMutex;
+  return mappings;
+}
+
+//------------------------------------------------------------------------------
+// Maps 'size' bytes at 'offset' in 'fileName' copy-on-write.
+void* MapFileRegion(const char* fileName, off_t offset, size_t size)
+{
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0)
+  {
+    return nullptr;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) < 0 || fileStat.st_size < static_cast<off_t>(offset + size))
+  {
+    close(fd);
+    return nullptr;
+  }
+  const off_t pageSize = sysconf(_SC_PAGESIZE);
+  const off_t start = offset - offset % pageSize;
+  const size_t length = size + static_cast<size_t>(offset - start);
+  void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, start);
+  // the mapping stays valid after the file is closed
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    return nullptr;
+  }
+  void* data = static_cast<char*>(base) + (offset - start);
+  std::mutex* mutex;
+  auto& mappings = ::GetMappings(mutex);
+  std::lock_guard<std::mutex> lock(*mutex);
+  mappings[data] = std::make_pair(base, length);
+  return data;
+}
+
+//------------------------------------------------------------------------------
+// Free function of the mapped scalars.
+void UnmapFileRegion(void* data)
+{
+  std::mutex* mutex;
+  auto& mappings = ::GetMappings(mutex);
+  std::lock_guard<std::mutex> lock(*mutex);
+  auto it = mappings.find(data);
+  if (it != mappings.end())
+  {
+    munmap(it->second.first, it->second.second);
+    mappings.erase(it);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class T>
+vtkDataArray* MapScalars(
+  const char* fileName, off_t offset, size_t size, int dataType, int numberOfComponents, T*)
+{
+  if (size == 0 || offset % sizeof(T) != 0)
+  {
+    return nullptr;
+  }
+  auto array = vtkAOSDataArrayTemplate<T>::SafeDownCast(vtkDataArray::CreateDataArray(dataType));
+  if (!array)
+  {
+    return nullptr;
+  }
+  void* data = ::MapFileRegion(fileName, offset, size);
+  if (!data)
+  {
+    array->Delete();
+    return nullptr;
+  }
+  array->SetNumberOfComponents(numberOfComponents);
+  array->SetArray(static_cast<T*>(data), static_cast<vtkIdType>(size / sizeof(T)), 0,
+    vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+  array->SetArrayFreeFunction(::UnmapFileRegion);
+  return array;
+}
+#endif
+}
+
 vtkStandardNewMacro(vtkImageReader2);
 
 //------------------------------------------------------------------------------
@@ -74,6 +181,8 @@ vtkImageReader2::vtkImageReader2()
   this->FileNameSliceOffset = 0;
   this->FileNameSliceSpacing = 1;
 
+  this->UseMemoryMapping = false;
+
   // Left over from short reader
   this->SwapBytes = 0;
   this->FileLowerLeft = 0;
@@ -400,6 +509,7 @@ void vtkImageReader2::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "File Dimensionality: " << this->FileDimensionality << "\n";
 
   os << indent << "File Lower Left: " << (this->FileLowerLeft ? "On\n" : "Off\n");
+  os << indent << "UseMemoryMapping: " << (this->UseMemoryMapping ? "on" : "off") << "\n";
 
   os << indent << "Swap Bytes: " << (this->SwapBytes ? "On\n" : "Off\n");
 
@@ -669,6 +779,103 @@ void vtkImageReader2::SeekFile(int i, int j, int k)
   }
 }
 
+//------------------------------------------------------------------------------
+// This function reads the slices stored in their own files concurrently,
+// each one with its own stream, directly in its part of the output.
+template <class OT>
+void vtkImageReader2UpdateSlices(vtkImageReader2* self, vtkImageData* data, OT* outPtr)
+{
+  vtkIdType outIncr[3];
+  int outExtent[6];
+  data->GetExtent(outExtent);
+  data->GetIncrements(outIncr);
+  const int nComponents = data->GetNumberOfScalarComponents();
+  const int numSlices = outExtent[5] - outExtent[4] + 1;
+
+  // length of a row, num pixels read at a time
+  const int pixelRead = outExtent[1] - outExtent[0] + 1;
+  const std::streamsize streamRead =
+    static_cast<std::streamsize>(pixelRead) * nComponents * sizeof(OT);
+
+  // the file names and header sizes are computed by the reader, one after
+  // another, as it stores them
+  std::vector<std::string> fileNames(numSlices);
+  std::vector<std::streamoff> headerSizes(numSlices);
+  for (int k = 0; k < numSlices; ++k)
+  {
+    headerSizes[k] = static_cast<std::streamoff>(self->GetHeaderSize(outExtent[4] + k));
+    self->ComputeInternalFileName(outExtent[4] + k);
+    fileNames[k] = self->GetInternalFileName();
+  }
+
+  // offsets of the rows in the files, as in SeekFile()
+  const unsigned long* increments = self->GetDataIncrements();
+  const int* dataExtent = self->GetDataExtent();
+  const std::streamoff rowStart =
+    static_cast<std::streamoff>(outExtent[0] - dataExtent[0]) * increments[0];
+  auto rowOffset = [&](int j) {
+    return self->GetFileLowerLeft()
+      ? static_cast<std::streamoff>(j - dataExtent[2]) * increments[1]
+      : static_cast<std::streamoff>(dataExtent[3] - dataExtent[2] - j) * increments[1];
+  };
+
+  const bool swapBytes = self->GetSwapBytes() && sizeof(OT) > 1;
+  std::atomic<int> slicesRead(0);
+  std::atomic<bool> failed(false);
+  vtkSMPTools::For(0, numSlices, 1, [&](vtkIdType begin, vtkIdType end) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType k = begin; k < end && !failed; ++k)
+    {
+      if (isFirst)
+      {
+        self->CheckAbort();
+      }
+      if (self->GetAbortOutput())
+      {
+        break;
+      }
+
+      std::ios_base::openmode mode = ios::in;
+#ifdef _WIN32
+      mode |= ios::binary;
+#endif
+      vtksys::ifstream file(fileNames[k].c_str(), mode);
+      if (file.fail())
+      {
+        vtkErrorWithObjectMacro(self, << "Initialize: Could not open file " << fileNames[k]);
+        failed = true;
+        break;
+      }
+
+      OT* outPtr1 = outPtr + k * outIncr[2];
+      for (int idx1 = outExtent[2]; idx1 <= outExtent[3]; ++idx1)
+      {
+        // seek to the correct row, and read it
+        file.seekg(headerSizes[k] + rowStart + rowOffset(idx1), ios::beg);
+        if (file.fail() || !file.read(reinterpret_cast<char*>(outPtr1), streamRead))
+        {
+          vtkGenericWarningMacro("File operation failed. row = "
+            << idx1 << ", Read = " << streamRead << ", File = " << fileNames[k]);
+          failed = true;
+          break;
+        }
+        // handle swapping
+        if (swapBytes)
+        {
+          vtkByteSwap::SwapVoidRange(outPtr1, pixelRead * nComponents, sizeof(OT));
+        }
+        outPtr1 += outIncr[1];
+      }
+
+      int count = ++slicesRead;
+      if (isFirst)
+      {
+        self->UpdateProgress(static_cast<double>(count) / numSlices);
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 // This function reads in one data of data.
 // templated to handle different data types.
@@ -697,6 +904,13 @@ void vtkImageReader2Update(vtkImageReader2* self, vtkImageData* data, OT* outPtr
     (unsigned long)((outExtent[5] - outExtent[4] + 1) * (outExtent[3] - outExtent[2] + 1) / 50.0);
   target++;
 
+  // read the slices stored in their own files concurrently
+  if (self->GetFileDimensionality() == 2 && outExtent[5] > outExtent[4])
+  {
+    vtkImageReader2UpdateSlices(self, data, outPtr);
+    return;
+  }
+
   // read the data row by row
   if (self->GetFileDimensionality() == 3)
   {
@@ -753,16 +967,23 @@ void vtkImageReader2Update(vtkImageReader2* self, vtkImageData* data, OT* outPtr
 // are assumed to be the same as the file extent/order.
 void vtkImageReader2::ExecuteDataWithInformation(vtkDataObject* output, vtkInformation* outInfo)
 {
-  vtkImageData* data = this->AllocateOutputData(output, outInfo);
-
-  void* ptr;
-
   if (!this->FileName && !this->FilePattern)
   {
     vtkErrorMacro("Either a valid FileName or FilePattern must be specified.");
+    this->AllocateOutputData(output, outInfo);
     return;
   }
 
+  if (this->MapOutputScalars(output, outInfo))
+  {
+    vtkImageData::SafeDownCast(output)->GetPointData()->GetScalars()->SetName("ImageFile");
+    return;
+  }
+
+  vtkImageData* data = this->AllocateOutputData(output, outInfo);
+
+  void* ptr;
+
   data->GetPointData()->GetScalars()->SetName("ImageFile");
 
 #ifndef NDEBUG
@@ -784,6 +1005,64 @@ void vtkImageReader2::ExecuteDataWithInformation(vtkDataObject* output, vtkInfor
   }
 }
 
+//------------------------------------------------------------------------------
+int vtkImageReader2::MapOutputScalars(vtkDataObject* output, vtkInformation* outInfo)
+{
+#if defined(_WIN32)
+  (void)output;
+  (void)outInfo;
+  return 0;
+#else
+  vtkImageData* data = vtkImageData::SafeDownCast(output);
+  int* updateExtent = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT());
+  if (!this->UseMemoryMapping || !data || !updateExtent || this->MemoryBuffer ||
+    this->GetSwapBytes() || !this->FileLowerLeft ||
+    (this->GetFileDimensionality() != 3 && this->DataExtent[4] != this->DataExtent[5]) ||
+    !std::equal(this->DataExtent, this->DataExtent + 6, updateExtent))
+  {
+    return 0;
+  }
+
+  // the output scalars must be the ones stored in the file
+  vtkInformation* scalarInfo = vtkDataObject::GetActiveFieldInformation(
+    outInfo, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+  if (!scalarInfo || scalarInfo->Get(vtkDataObject::FIELD_ARRAY_TYPE()) != this->DataScalarType ||
+    (scalarInfo->Has(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS()) &&
+      scalarInfo->Get(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS()) !=
+        this->NumberOfScalarComponents))
+  {
+    return 0;
+  }
+
+  // the data start after the header, as in SeekFile()
+  this->ComputeDataIncrements();
+  const off_t offset = static_cast<off_t>(this->GetHeaderSize(this->DataExtent[4]));
+  this->ComputeInternalFileName(this->GetFileDimensionality() == 3 ? 0 : this->DataExtent[4]);
+  if (!this->InternalFileName)
+  {
+    return 0;
+  }
+
+  vtkDataArray* scalars = nullptr;
+  switch (this->DataScalarType)
+  {
+    vtkTemplateMacro(scalars = ::MapScalars(this->InternalFileName, offset,
+                       static_cast<size_t>(this->DataIncrements[3]), this->DataScalarType,
+                       this->NumberOfScalarComponents, static_cast<VTK_TT*>(nullptr)));
+  }
+  if (!scalars)
+  {
+    return 0;
+  }
+
+  vtkDebugMacro("Mapping " << this->InternalFileName);
+  data->SetExtent(updateExtent);
+  data->GetPointData()->SetScalars(scalars);
+  scalars->Delete();
+  return 1;
+#endif
+}
+
 //------------------------------------------------------------------------------
 void vtkImageReader2::SetMemoryBuffer(const void* membuf)
 {
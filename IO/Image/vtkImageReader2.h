@@ -34,6 +34,11 @@
  * reader->UpdateWholeExtent();
  * \endcode
  *
+ * When each slice is stored in its own file, the slices are read
+ * concurrently with vtkSMPTools, each one directly in its part of the output
+ * scalars. With UseMemoryMapping, a volume stored in a single file can also
+ * be memory mapped instead of being read.
+ *
  * @sa
  * vtkJPEGReader vtkPNGReader vtkImageReader vtkGESignaReader
  */
@@ -254,6 +259,22 @@ public:
   void CloseFile();
   virtual void SeekFile(int i, int j, int k);
 
+  ///@{
+  /**
+   * When on, and the whole extent is requested, an uncompressed volume
+   * stored in a single file, in the native byte order and starting in the
+   * lower left corner, is memory mapped as the output scalars instead of
+   * being read, so only the pages that are actually accessed are loaded from
+   * disk. The mapped scalars are copy-on-write: modifying them does not change
+   * the file, but the file must not be modified or truncated while they are
+   * in use. Other data are read as usual. Not available on Windows. Default
+   * is off.
+   */
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  ///@}
+
   ///@{
   /**
    * Set/Get whether the data comes from the file starting in the lower left
@@ -330,6 +351,15 @@ protected:
   int FileNameSliceOffset;
   int FileNameSliceSpacing;
 
+  bool UseMemoryMapping;
+
+  /**
+   * Set the whole output scalars as a memory mapping of the file when
+   * UseMemoryMapping is on and the data allows it. Return 1 if the scalars
+   * are mapped, 0 if they must be read.
+   */
+  int MapOutputScalars(vtkDataObject* output, vtkInformation* outInfo);
+
   int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector) override;
   virtual void ExecuteInformation();
@@ -31,13 +31,18 @@
 #include "vtkVector.h"
 #include "vtkVectorOperators.h"
 #include "vtk_pugixml.h"
+#include "vtksys/SystemTools.hxx"
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <list>
 #include <map>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -62,6 +67,58 @@ public:
   std::vector<vtkSmartPointer<vtkDoubleArray>> RangeArrays;
   vtkTimeStamp CacheMTime;
 
+  // Direct reading of the planes, tile by tile, used when their format allows
+  // to copy the decoded tiles as is. Strips are handled as tiles spanning the
+  // width of the image.
+  struct vtkLevel
+  {
+    int Width = 0;
+    int Height = 0;
+    int TileWidth = 0;
+    int TileHeight = 0;
+    bool Tiled = false;
+  };
+  bool CanReadTiles = false;
+  TIFF* Image = nullptr;
+  std::string ImageFileName;
+  long ImageFileMTime = 0;
+  int CurrentIFD = -1;
+  int CurrentLevel = -1;
+  int PixelSize = 0;
+  unsigned short Orientation = ORIENTATION_TOPLEFT;
+  // Levels[0] is the full resolution, the others are read from the SubIFDs.
+  std::vector<vtkLevel> Levels;
+  bool HasRanges = false;
+
+  // key = (IFD, level, tile), most recently used first in TileOrder.
+  using TileKey = std::tuple<int, int, uint32_t>;
+  std::list<TileKey> TileOrder;
+  std::map<TileKey, std::pair<std::vector<unsigned char>, std::list<TileKey>::iterator>> Tiles;
+  size_t TileCacheBytes = 0;
+
+  ~vtkOMEInternals() { this->CloseImage(); }
+
+  bool OpenImage(const char* fname);
+  void CloseImage();
+  bool ReadLevel(vtkLevel& level);
+  bool InspectLevels();
+  bool SetDirectory(int ifd, int level);
+  const unsigned char* ReadTile(int ifd, int level, uint32_t tile);
+  void PruneTiles(size_t maxBytes);
+  bool ReadPlane(int ifd, int level, const int ext[6], unsigned char* out,
+    vtkIdType rowIncrement, size_t maxBytes);
+  bool UpdateRanges(int scalarType, int numComps, size_t maxBytes);
+
+  void UpdateFieldArrays(const std::vector<vtkVector2d>& channel_ranges);
+  void AddFieldArrays(vtkImageData* output)
+  {
+    output->GetFieldData()->AddArray(this->PhysicalSizeUnitArray);
+    for (auto& array : this->RangeArrays)
+    {
+      output->GetFieldData()->AddArray(array);
+    }
+  }
+
   void UpdateCache(vtkImageData* output);
   void ExtractFromCache(vtkImageData* output, int t)
   {
@@ -75,12 +132,7 @@ public:
     {
       output->ShallowCopy(this->Cache[t]);
     }
-    output->GetFieldData()->AddArray(this->PhysicalSizeUnitArray);
-
-    for (auto& array : this->RangeArrays)
-    {
-      output->GetFieldData()->AddArray(array);
-    }
+    this->AddFieldArrays(output);
   }
 };
 
@@ -164,6 +216,14 @@ void vtkOMETIFFReader::vtkOMEInternals::UpdateCache(vtkImageData* source)
     }
   }
 
+  this->UpdateFieldArrays(channel_ranges);
+  this->CacheMTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkOMETIFFReader::vtkOMEInternals::UpdateFieldArrays(
+  const std::vector<vtkVector2d>& channel_ranges)
+{
   this->PhysicalSizeUnitArray = vtkSmartPointer<vtkStringArray>::New();
   this->PhysicalSizeUnitArray->SetName("PhysicalSizeUnit");
   this->PhysicalSizeUnitArray->SetNumberOfTuples(3);
@@ -184,15 +244,302 @@ void vtkOMETIFFReader::vtkOMEInternals::UpdateCache(vtkImageData* source)
     this->RangeArrays[c]->SetNumberOfTuples(1);
     this->RangeArrays[c]->SetTypedTuple(0, channel_ranges[c].GetData());
   }
+}
 
-  this->CacheMTime.Modified();
+//------------------------------------------------------------------------------
+bool vtkOMETIFFReader::vtkOMEInternals::OpenImage(const char* fname)
+{
+  const long mtime = vtksys::SystemTools::ModifiedTime(fname);
+  if (this->Image && this->ImageFileName == fname && this->ImageFileMTime == mtime)
+  {
+    return true;
+  }
+
+  this->CloseImage();
+  this->Image = TIFFOpen(fname, "r");
+  if (!this->Image)
+  {
+    return false;
+  }
+  this->ImageFileName = fname;
+  this->ImageFileMTime = mtime;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkOMETIFFReader::vtkOMEInternals::CloseImage()
+{
+  if (this->Image)
+  {
+    TIFFClose(this->Image);
+    this->Image = nullptr;
+  }
+  this->ImageFileName.clear();
+  this->CurrentIFD = this->CurrentLevel = -1;
+  this->Levels.clear();
+  this->HasRanges = false;
+  this->TileOrder.clear();
+  this->Tiles.clear();
+  this->TileCacheBytes = 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOMETIFFReader::vtkOMEInternals::ReadLevel(vtkLevel& level)
+{
+  uint32_t width = 0, height = 0;
+  uint16_t samples = 1, bits = 1, planar = PLANARCONFIG_CONTIG, compression = COMPRESSION_NONE;
+  if (!TIFFGetField(this->Image, TIFFTAG_IMAGEWIDTH, &width) ||
+    !TIFFGetField(this->Image, TIFFTAG_IMAGELENGTH, &height) || width == 0 || height == 0)
+  {
+    return false;
+  }
+  TIFFGetFieldDefaulted(this->Image, TIFFTAG_SAMPLESPERPIXEL, &samples);
+  TIFFGetFieldDefaulted(this->Image, TIFFTAG_BITSPERSAMPLE, &bits);
+  TIFFGetFieldDefaulted(this->Image, TIFFTAG_PLANARCONFIG, &planar);
+  TIFFGetFieldDefaulted(this->Image, TIFFTAG_COMPRESSION, &compression);
+  if ((samples > 1 && planar != PLANARCONFIG_CONTIG) || samples * bits / 8 != this->PixelSize ||
+    !TIFFIsCODECConfigured(compression))
+  {
+    return false;
+  }
+
+  level.Width = static_cast<int>(width);
+  level.Height = static_cast<int>(height);
+  level.Tiled = TIFFIsTiled(this->Image) != 0;
+  if (level.Tiled)
+  {
+    uint32_t tileWidth = 0, tileHeight = 0;
+    if (!TIFFGetField(this->Image, TIFFTAG_TILEWIDTH, &tileWidth) ||
+      !TIFFGetField(this->Image, TIFFTAG_TILELENGTH, &tileHeight) || tileWidth == 0 ||
+      tileHeight == 0)
+    {
+      return false;
+    }
+    level.TileWidth = static_cast<int>(tileWidth);
+    level.TileHeight = static_cast<int>(tileHeight);
+  }
+  else
+  {
+    uint32_t rowsPerStrip = height;
+    TIFFGetFieldDefaulted(this->Image, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip);
+    level.TileWidth = level.Width;
+    level.TileHeight = static_cast<int>(std::min(std::max(rowsPerStrip, 1u), height));
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOMETIFFReader::vtkOMEInternals::InspectLevels()
+{
+  this->Levels.clear();
+  this->CurrentIFD = this->CurrentLevel = -1;
+
+  vtkLevel level;
+  if (!this->SetDirectory(0, 0) || !this->ReadLevel(level))
+  {
+    return false;
+  }
+  this->Levels.push_back(level);
+
+  // The reduced resolutions, if any, are in the SubIFDs of each plane. The
+  // offsets are copied since libtiff releases them when changing directory.
+  uint16_t count = 0;
+  uint64_t* offsets = nullptr;
+  std::vector<uint64_t> subIFDs;
+  if (TIFFGetField(this->Image, TIFFTAG_SUBIFD, &count, &offsets) && offsets)
+  {
+    subIFDs.assign(offsets, offsets + count);
+  }
+  for (uint64_t offset : subIFDs)
+  {
+    this->CurrentIFD = this->CurrentLevel = -1;
+    if (!TIFFSetSubDirectory(this->Image, offset) || !this->ReadLevel(level) ||
+      level.Width >= this->Levels.back().Width)
+    {
+      break;
+    }
+    this->Levels.push_back(level);
+  }
+  this->CurrentIFD = this->CurrentLevel = -1;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOMETIFFReader::vtkOMEInternals::SetDirectory(int ifd, int level)
+{
+  if (ifd == this->CurrentIFD && level == this->CurrentLevel)
+  {
+    return true;
+  }
+  this->CurrentIFD = this->CurrentLevel = -1;
+  if (!TIFFSetDirectory(this->Image, static_cast<uint16_t>(ifd)))
+  {
+    return false;
+  }
+  if (level > 0)
+  {
+    uint16_t count = 0;
+    uint64_t* offsets = nullptr;
+    if (!TIFFGetField(this->Image, TIFFTAG_SUBIFD, &count, &offsets) || count < level)
+    {
+      return false;
+    }
+    const uint64_t offset = offsets[level - 1];
+    if (!TIFFSetSubDirectory(this->Image, offset))
+    {
+      return false;
+    }
+  }
+  this->CurrentIFD = ifd;
+  this->CurrentLevel = level;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+const unsigned char* vtkOMETIFFReader::vtkOMEInternals::ReadTile(
+  int ifd, int level, uint32_t tile)
+{
+  const TileKey key(ifd, level, tile);
+  auto iter = this->Tiles.find(key);
+  if (iter != this->Tiles.end())
+  {
+    this->TileOrder.splice(this->TileOrder.begin(), this->TileOrder, iter->second.second);
+    return iter->second.first.data();
+  }
+
+  if (!this->SetDirectory(ifd, level))
+  {
+    return nullptr;
+  }
+  const vtkLevel& info = this->Levels[level];
+  std::vector<unsigned char> buffer(
+    static_cast<size_t>(info.TileWidth) * info.TileHeight * this->PixelSize);
+  const tmsize_t size = static_cast<tmsize_t>(buffer.size());
+  const tmsize_t read = info.Tiled ? TIFFReadEncodedTile(this->Image, tile, buffer.data(), size)
+                                   : TIFFReadEncodedStrip(this->Image, tile, buffer.data(), size);
+  if (read < 0)
+  {
+    return nullptr;
+  }
+
+  this->TileOrder.push_front(key);
+  auto& entry = this->Tiles[key];
+  entry.first = std::move(buffer);
+  entry.second = this->TileOrder.begin();
+  this->TileCacheBytes += entry.first.size();
+  return entry.first.data();
+}
+
+//------------------------------------------------------------------------------
+void vtkOMETIFFReader::vtkOMEInternals::PruneTiles(size_t maxBytes)
+{
+  while (this->TileCacheBytes > maxBytes && !this->TileOrder.empty())
+  {
+    auto iter = this->Tiles.find(this->TileOrder.back());
+    this->TileCacheBytes -= iter->second.first.size();
+    this->Tiles.erase(iter);
+    this->TileOrder.pop_back();
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkOMETIFFReader::vtkOMEInternals::ReadPlane(int ifd, int level, const int ext[6],
+  unsigned char* out, vtkIdType rowIncrement, size_t maxBytes)
+{
+  const vtkLevel& info = this->Levels[level];
+  const bool flip = this->Orientation != ORIENTATION_TOPLEFT;
+  const int tilesAcross = (info.Width + info.TileWidth - 1) / info.TileWidth;
+
+  // Read the rows of the extent from the tiles (or strips) containing them.
+  const int firstRow = flip ? info.Height - 1 - ext[3] : ext[2];
+  const int lastRow = flip ? info.Height - 1 - ext[2] : ext[3];
+  for (int tileRow = firstRow / info.TileHeight; tileRow <= lastRow / info.TileHeight; ++tileRow)
+  {
+    const int rowStart = std::max(firstRow, tileRow * info.TileHeight);
+    const int rowEnd = std::min(lastRow, (tileRow + 1) * info.TileHeight - 1);
+    for (int tileCol = ext[0] / info.TileWidth; tileCol <= ext[1] / info.TileWidth; ++tileCol)
+    {
+      const int colStart = std::max(ext[0], tileCol * info.TileWidth);
+      const int colEnd = std::min(ext[1], (tileCol + 1) * info.TileWidth - 1);
+      const unsigned char* tile =
+        this->ReadTile(ifd, level, static_cast<uint32_t>(tileRow * tilesAcross + tileCol));
+      if (!tile)
+      {
+        return false;
+      }
+
+      const size_t rowSize = static_cast<size_t>(colEnd - colStart + 1) * this->PixelSize;
+      for (int fileRow = rowStart; fileRow <= rowEnd; ++fileRow)
+      {
+        const int row = flip ? info.Height - 1 - fileRow : fileRow;
+        const unsigned char* src = tile +
+          (static_cast<size_t>(fileRow - tileRow * info.TileHeight) * info.TileWidth + colStart -
+            tileCol * info.TileWidth) *
+            this->PixelSize;
+        unsigned char* dst = out + (row - ext[2]) * rowIncrement +
+          static_cast<vtkIdType>(colStart - ext[0]) * this->PixelSize;
+        std::memcpy(dst, src, rowSize);
+      }
+      this->PruneTiles(maxBytes);
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOMETIFFReader::vtkOMEInternals::UpdateRanges(
+  int scalarType, int numComps, size_t maxBytes)
+{
+  // The ranges are computed on the coarsest level, which is much faster to
+  // read than the full resolution for pyramidal files.
+  const int level = static_cast<int>(this->Levels.size()) - 1;
+  const vtkLevel& info = this->Levels[level];
+  const int ext[6] = { 0, info.Width - 1, 0, info.Height - 1, 0, 0 };
+
+  vtkSmartPointer<vtkDataArray> plane;
+  plane.TakeReference(vtkDataArray::CreateDataArray(scalarType));
+  plane->SetNumberOfComponents(numComps);
+  plane->SetNumberOfTuples(static_cast<vtkIdType>(info.Width) * info.Height);
+  auto planePtr = static_cast<unsigned char*>(plane->GetVoidPointer(0));
+
+  std::vector<vtkVector2d> channel_ranges;
+  channel_ranges.resize(this->SizeC, vtkVector2d(VTK_DOUBLE_MAX, VTK_DOUBLE_MIN));
+  for (int c = 0; c < this->SizeC; ++c)
+  {
+    for (int t = 0; t < this->SizeT; ++t)
+    {
+      for (int z = 0; z < this->SizeZ; ++z)
+      {
+        auto iter = this->IFDMap.find(vtkVector3i(c, t, z));
+        if (iter == this->IFDMap.end() ||
+          !this->ReadPlane(iter->second, level, ext, planePtr,
+            static_cast<vtkIdType>(info.Width) * this->PixelSize, maxBytes))
+        {
+          return false;
+        }
+        plane->Modified();
+
+        vtkVector2d range;
+        plane->GetRange(range.GetData(), -1);
+        channel_ranges[c][0] = std::min(channel_ranges[c][0], range[0]);
+        channel_ranges[c][1] = std::max(channel_ranges[c][1], range[1]);
+      }
+    }
+  }
+
+  this->UpdateFieldArrays(channel_ranges);
+  this->HasRanges = true;
+  return true;
 }
 
 //============================================================================
 vtkStandardNewMacro(vtkOMETIFFReader);
 //------------------------------------------------------------------------------
 vtkOMETIFFReader::vtkOMETIFFReader()
-  : OMEInternals(new vtkOMETIFFReader::vtkOMEInternals())
+  : Resolution(1.0)
+  , Level(0)
+  , TileCacheSize(256)
+  , OMEInternals(new vtkOMETIFFReader::vtkOMEInternals())
 {
 }
 
@@ -207,6 +554,16 @@ vtkOMETIFFReader::~vtkOMETIFFReader()
 void vtkOMETIFFReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "Resolution: " << this->Resolution << endl;
+  os << indent << "Level: " << this->Level << endl;
+  os << indent << "TileCacheSize: " << this->TileCacheSize << endl;
+}
+
+//------------------------------------------------------------------------------
+int vtkOMETIFFReader::GetNumberOfLevels()
+{
+  const auto& omeinternals = (*this->OMEInternals);
+  return omeinternals.CanReadTiles ? static_cast<int>(omeinternals.Levels.size()) : 1;
 }
 
 //------------------------------------------------------------------------------
@@ -242,6 +599,7 @@ void vtkOMETIFFReader::ExecuteInformation()
 
   auto& omeinternals = (*this->OMEInternals);
   omeinternals.IsValid = false;
+  omeinternals.CanReadTiles = false;
 
   auto& doc = omeinternals.XMLDocument;
 
@@ -303,9 +661,16 @@ void vtkOMETIFFReader::ExecuteInformation()
   // with TiffData.
   // ref:
   // https://docs.openmicroscopy.org/ome-model/5.6.3/ome-tiff/specification.html#the-tiffdata-element
+  // Without any TiffData element, the planes are stored in order in all the IFDs.
+  std::vector<pugi::xml_node> tiffdatas(
+    pixelsXML.children("TiffData").begin(), pixelsXML.children("TiffData").end());
+  if (tiffdatas.empty())
+  {
+    tiffdatas.emplace_back();
+  }
   int nextIFD = 0;
   int next[3] = { 0, 0, 0 };
-  for (auto tiffdataXML : pixelsXML.child("TiffData"))
+  for (const auto& tiffdataXML : tiffdatas)
   {
     next[z_idx] = tiffdataXML.attribute("FirstZ").as_int(next[z_idx]);
     next[c_idx] = tiffdataXML.attribute("FirstC").as_int(next[c_idx]);
@@ -332,6 +697,21 @@ void vtkOMETIFFReader::ExecuteInformation()
       }
     }
   }
+
+  // Grayscale and RGB planes can be copied from the decoded tiles as is, so
+  // they are read directly, only where requested.
+  const bool isGray =
+    interals.Photometrics == PHOTOMETRIC_MINISBLACK && interals.SamplesPerPixel == 1;
+  const bool isRGB = interals.Photometrics == PHOTOMETRIC_RGB && interals.SamplesPerPixel == 3;
+  if (interals.CanRead() && (isGray || isRGB) &&
+    static_cast<int>(omeinternals.IFDMap.size()) >=
+      omeinternals.SizeZ * omeinternals.SizeC * omeinternals.SizeT &&
+    omeinternals.OpenImage(this->InternalFileName))
+  {
+    omeinternals.PixelSize = interals.SamplesPerPixel * interals.BitsPerSample / 8;
+    omeinternals.Orientation = interals.Orientation;
+    omeinternals.CanReadTiles = omeinternals.InspectLevels();
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -363,8 +743,25 @@ int vtkOMETIFFReader::RequestInformation(
   whole_extent[1] = omeinternals.SizeX - 1;
   whole_extent[3] = omeinternals.SizeY - 1;
   whole_extent[5] = omeinternals.SizeZ - 1;
+  double spacing[3] = { this->DataSpacing[0], this->DataSpacing[1], this->DataSpacing[2] };
+
+  // pick the coarsest level providing the requested resolution.
+  this->Level = 0;
+  if (omeinternals.CanReadTiles)
+  {
+    const auto& levels = omeinternals.Levels;
+    while (this->Level + 1 < static_cast<int>(levels.size()) &&
+      levels[this->Level + 1].Width >= this->Resolution * levels[0].Width)
+    {
+      ++this->Level;
+    }
+    whole_extent[1] = levels[this->Level].Width - 1;
+    whole_extent[3] = levels[this->Level].Height - 1;
+    spacing[0] *= static_cast<double>(levels[0].Width) / levels[this->Level].Width;
+    spacing[1] *= static_cast<double>(levels[0].Height) / levels[this->Level].Height;
+  }
   outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), whole_extent, 6);
-  outInfo->Set(vtkDataObject::SPACING(), this->DataSpacing, 3);
+  outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
 
   // add timesteps information.
   if (omeinternals.SizeT >= 1)
@@ -389,17 +786,100 @@ int vtkOMETIFFReader::RequestInformation(
     outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
     outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
   }
-  outInfo->Remove(CAN_PRODUCE_SUB_EXTENT());
-  outInfo->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
+  if (omeinternals.CanReadTiles)
+  {
+    outInfo->Set(CAN_PRODUCE_SUB_EXTENT(), 1);
+    outInfo->Remove(CAN_HANDLE_PIECE_REQUEST());
+  }
+  else
+  {
+    outInfo->Remove(CAN_PRODUCE_SUB_EXTENT());
+    outInfo->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
+  }
   return 1;
 }
 
+//------------------------------------------------------------------------------
+void vtkOMETIFFReader::ReadPlanes(vtkImageData* output, vtkInformation* outInfo, int t)
+{
+  auto& omeinternals = (*this->OMEInternals);
+  const size_t maxBytes = static_cast<size_t>(this->TileCacheSize) << 20;
+
+  // the superclass keeps the file open after reading the information.
+  this->InternalImage->Clean();
+
+  if (!omeinternals.HasRanges &&
+    !omeinternals.UpdateRanges(
+      this->GetDataScalarType(), this->GetNumberOfScalarComponents(), maxBytes))
+  {
+    vtkErrorMacro("Cannot read the planes of " << this->InternalFileName);
+    return;
+  }
+
+  this->AllocateOutputData(output, outInfo);
+  int ext[6];
+  output->GetExtent(ext);
+  vtkIdType increments[3];
+  output->GetIncrements(increments);
+  const vtkIdType rowIncrement = increments[1] * output->GetScalarSize();
+
+  t = std::max(0, std::min(t, omeinternals.SizeT - 1));
+  auto pd = output->GetPointData();
+  const int numPlanes = omeinternals.SizeC * (ext[5] - ext[4] + 1);
+  int plane = 0;
+  for (int c = 0; c < omeinternals.SizeC; ++c)
+  {
+    vtkDataArray* array = pd->GetScalars();
+    if (c > 0)
+    {
+      array = vtkDataArray::CreateDataArray(this->GetDataScalarType());
+      array->SetNumberOfComponents(this->GetNumberOfScalarComponents());
+      array->SetNumberOfTuples(output->GetNumberOfPoints());
+      pd->AddArray(array);
+      array->Delete();
+    }
+    std::ostringstream str;
+    str << "Channel_" << (c + 1); // channel names start with 1.
+    array->SetName(str.str().c_str());
+
+    for (int z = ext[4]; z <= ext[5]; ++z)
+    {
+      auto iter = omeinternals.IFDMap.find(vtkVector3i(c, t, z));
+      int coordinate[] = { ext[0], ext[2], z };
+      if (iter == omeinternals.IFDMap.end() ||
+        !omeinternals.ReadPlane(iter->second, this->Level, ext,
+          reinterpret_cast<unsigned char*>(output->GetArrayPointer(array, coordinate)),
+          rowIncrement, maxBytes))
+      {
+        vtkErrorMacro("Cannot read plane (c=" << c << ", t=" << t << ", z=" << z << ") of "
+                                              << this->InternalFileName);
+        return;
+      }
+      this->UpdateProgress(static_cast<double>(++plane) / numPlanes);
+    }
+  }
+  omeinternals.AddFieldArrays(output);
+}
+
 //------------------------------------------------------------------------------
 void vtkOMETIFFReader::ExecuteDataWithInformation(vtkDataObject* dobj, vtkInformation* outInfo)
 {
   // we want to make superclass read all channels for all timesteps at the same
   // time.
   auto& omeinternals = (*this->OMEInternals);
+  double time = outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+    ? outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+    : 0.0;
+  int time_step = static_cast<int>(std::floor(time / omeinternals.TimeIncrement));
+
+  auto output = vtkImageData::SafeDownCast(dobj);
+  assert(output != nullptr);
+  if (omeinternals.CanReadTiles)
+  {
+    this->ReadPlanes(output, outInfo, time_step);
+    return;
+  }
+
   if (omeinternals.CacheMTime < this->GetMTime())
   {
     vtkNew<vtkExtentTranslator> extTranslator;
@@ -439,13 +919,6 @@ void vtkOMETIFFReader::ExecuteDataWithInformation(vtkDataObject* dobj, vtkInform
   }
 
   // copy appropriate timestep from cache to the output.
-  auto output = vtkImageData::SafeDownCast(dobj);
-  assert(output != nullptr);
-
-  double time = outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
-    ? outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
-    : 0.0;
-  int time_step = static_cast<int>(std::floor(time / omeinternals.TimeIncrement));
   omeinternals.ExtractFromCache(output, time_step);
   output->SetSpacing(this->DataSpacing);
 }
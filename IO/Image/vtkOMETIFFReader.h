@@ -25,16 +25,25 @@
  * The current implementation only supports single-file, multi-page TIFF. It
  * will not read multi-file OME-TIFF files correctly.
  *
- * Unlike most image readers, this reader does not support arbitrary sub-extent
- * requests. This is because the splicing of the `z`, `t`, and `c` planes can make it
+ * When the planes are grayscale or RGB images stored contiguously with 8, 16
+ * or 32 bits per sample, the reader reads them directly, tile by tile (or
+ * strip by strip), and supports arbitrary sub-extent requests: only the tiles
+ * intersecting the requested extent of the requested timestep are decoded.
+ * Decoded tiles are kept in a cache of at most TileCacheSize MiB, shared by
+ * successive requests, so that panning over a large image only decodes the
+ * tiles that were not already visible. If the planes store reduced resolution
+ * images in their SubIFDs, as pyramidal OME-TIFF files do, the level read is
+ * the coarsest one providing at least the requested Resolution. The ranges of
+ * the channels are then computed from the coarsest level.
+ *
+ * For other files, the reader does not support arbitrary sub-extent requests.
+ * This is because the splicing of the `z`, `t`, and `c` planes can make it
  * tricky to read sub-extents in `z` for certain dimension orders. This reader
  * supports piece-request instead and satisfies such request by splitting the
- * `XY` plane into requested number of pieces.
- *
- * The reader lets the superclass read the whole TIFF volume and then splice it
- * up into channels, timesteps, and z-planes. The parts are then cached
- * internally so that subsequent timestep requests can be served without
- * re-reading the file.
+ * `XY` plane into requested number of pieces. It lets the superclass read the
+ * whole TIFF volume and then splice it up into channels, timesteps, and
+ * z-planes. The parts are then cached internally so that subsequent timestep
+ * requests can be served without re-reading the file.
  */
 
 #ifndef vtkOMETIFFReader_h
@@ -56,6 +65,34 @@ public:
   const char* GetDescriptiveName() override { return "OME TIFF"; }
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the requested resolution, as a fraction of the full resolution of
+   * the image. The reader reads the coarsest level of the image pyramid whose
+   * width is at least this fraction of the full width, and scales the spacing
+   * accordingly. The default of 1 reads the full resolution.
+   */
+  vtkSetClampMacro(Resolution, double, 0.0, 1.0);
+  vtkGetMacro(Resolution, double);
+  ///@}
+
+  /**
+   * Get the number of levels of the image pyramid, including the full
+   * resolution, and the level read for the current Resolution. Valid after
+   * UpdateInformation().
+   */
+  int GetNumberOfLevels();
+  vtkGetMacro(Level, int);
+
+  ///@{
+  /**
+   * Set/Get the maximum size, in MiB, of the decoded tiles kept between
+   * requests. The default is 256.
+   */
+  vtkSetClampMacro(TileCacheSize, int, 0, VTK_INT_MAX);
+  vtkGetMacro(TileCacheSize, int);
+  ///@}
+
 protected:
   vtkOMETIFFReader();
   ~vtkOMETIFFReader() override;
@@ -65,6 +102,16 @@ protected:
   void ExecuteInformation() override;
   void ExecuteDataWithInformation(vtkDataObject* out, vtkInformation* outInfo) override;
 
+  /**
+   * Read the requested extent of the planes of timestep t directly from their
+   * tiles.
+   */
+  void ReadPlanes(vtkImageData* output, vtkInformation* outInfo, int t);
+
+  double Resolution;
+  int Level;
+  int TileCacheSize;
+
 private:
   vtkOMETIFFReader(const vtkOMETIFFReader&) = delete;
   void operator=(const vtkOMETIFFReader&) = delete;
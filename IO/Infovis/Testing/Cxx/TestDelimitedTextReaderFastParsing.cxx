@@ -0,0 +1,161 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDelimitedTextReaderFastParsing.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkDelimitedTextReader reads the same tables with and without
+// FastParsing, for inputs large enough to be parsed by several chunks.
+
+#include "vtkDataArray.h"
+#include "vtkDelimitedTextReader.h"
+#include "vtkNew.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkVariant.h"
+
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+bool CompareTables(vtkTable* fast, vtkTable* legacy, const std::string& test)
+{
+  if (fast->GetNumberOfColumns() != legacy->GetNumberOfColumns() ||
+    fast->GetNumberOfRows() != legacy->GetNumberOfRows())
+  {
+    std::cerr << test << ": " << fast->GetNumberOfColumns() << "x" << fast->GetNumberOfRows()
+              << " table instead of " << legacy->GetNumberOfColumns() << "x"
+              << legacy->GetNumberOfRows() << std::endl;
+    return false;
+  }
+  for (vtkIdType col = 0; col < fast->GetNumberOfColumns(); ++col)
+  {
+    vtkAbstractArray* a = fast->GetColumn(col);
+    vtkAbstractArray* b = legacy->GetColumn(col);
+    if (std::string(a->GetName()) != b->GetName() ||
+      std::string(a->GetClassName()) != b->GetClassName() ||
+      a->GetNumberOfTuples() != b->GetNumberOfTuples())
+    {
+      std::cerr << test << ": column " << a->GetName() << " is a " << a->GetClassName()
+                << " instead of a " << b->GetClassName() << " named " << b->GetName()
+                << std::endl;
+      return false;
+    }
+    vtkDataArray* da = vtkDataArray::SafeDownCast(a);
+    vtkDataArray* db = vtkDataArray::SafeDownCast(b);
+    for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+    {
+      const bool same = da ? da->GetTuple1(i) == db->GetTuple1(i) ||
+          (da->GetTuple1(i) != da->GetTuple1(i) && db->GetTuple1(i) != db->GetTuple1(i))
+                           : a->GetVariantValue(i).ToString() == b->GetVariantValue(i).ToString();
+      if (!same)
+      {
+        std::cerr << test << ": value " << i << " of column " << a->GetName() << " is "
+                  << a->GetVariantValue(i).ToString() << " instead of "
+                  << b->GetVariantValue(i).ToString() << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool Compare(const std::string& input, const std::string& test,
+  const std::function<void(vtkDelimitedTextReader*)>& configure = nullptr)
+{
+  vtkNew<vtkDelimitedTextReader> fast;
+  vtkNew<vtkDelimitedTextReader> legacy;
+  for (vtkDelimitedTextReader* reader : { fast.Get(), legacy.Get() })
+  {
+    reader->SetReadFromInputString(true);
+    reader->SetInputString(input);
+    reader->SetHaveHeaders(true);
+    reader->SetDetectNumericColumns(true);
+    if (configure)
+    {
+      configure(reader);
+    }
+  }
+  legacy->FastParsingOff();
+  fast->Update();
+  legacy->Update();
+  return CompareTables(fast->GetOutput(), legacy->GetOutput(), test);
+}
+}
+
+int TestDelimitedTextReaderFastParsing(int, char*[])
+{
+  // integers, doubles, empty values, strings with delimiters and escape
+  // sequences, numbers that only vtkVariant parses and non-ASCII characters
+  std::ostringstream csv;
+  csv << "id,x,label,mixed,sparse,name \xc3\xa9\r\n";
+  const int numRecords = 40000;
+  for (int i = 0; i < numRecords; ++i)
+  {
+    csv << i << "," << i * 0.25 - 7 << "e-3," << (i % 7 ? "\"a, b\"" : "c\\td") << ","
+        << (i == numRecords / 2 ? "nan" : std::to_string(i % 13)) << ","
+        << (i % 5 ? "" : " 3 ") << ",\xe2\x82\xac" << i % 100 << "\r\n";
+  }
+  csv << "1,2,3,4,5,6";
+  const std::string input = csv.str();
+
+  bool status = Compare(input, "defaults");
+  status &=
+    Compare(input, "strings", [](vtkDelimitedTextReader* r) { r->DetectNumericColumnsOff(); });
+  status &= Compare(input, "no headers", [](vtkDelimitedTextReader* r) { r->SetHaveHeaders(false); });
+  status &= Compare(input, "doubles", [](vtkDelimitedTextReader* r) { r->ForceDoubleOn(); });
+  status &= Compare(input, "trimmed", [](vtkDelimitedTextReader* r) {
+    r->TrimWhitespacePriorToNumericConversionOn();
+    r->SetDefaultIntegerValue(-1);
+    r->SetDefaultDoubleValue(0.5);
+  });
+  status &= Compare(input, "merged", [](vtkDelimitedTextReader* r) {
+    r->MergeConsecutiveDelimitersOn();
+    r->UseStringDelimiterOff();
+  });
+  status &= Compare(input, "max records", [](vtkDelimitedTextReader* r) { r->SetMaxRecords(777); });
+
+  // escape sequences pending at the end of every record
+  std::ostringstream escaped;
+  for (int i = 0; i < numRecords; ++i)
+  {
+    escaped << i << ";v" << i << "\\\n";
+  }
+  status &= Compare(escaped.str(), "escaped", [](vtkDelimitedTextReader* r) {
+    r->SetFieldDelimiterCharacters(";");
+    r->SetHaveHeaders(false);
+  });
+
+  // invalid UTF-8 is left to the text codecs
+  status &= Compare("a,b\n1,\xff\n", "invalid");
+
+  vtkNew<vtkDelimitedTextReader> reader;
+  reader->SetReadFromInputString(true);
+  reader->SetInputString(input);
+  reader->SetHaveHeaders(true);
+  reader->SetDetectNumericColumns(true);
+  reader->Update();
+  vtkTable* table = reader->GetOutput();
+  if (table->GetNumberOfRows() != numRecords + 1 ||
+    !table->GetColumnByName("id")->IsA("vtkIntArray") ||
+    !table->GetColumnByName("x")->IsA("vtkDoubleArray") ||
+    !table->GetColumnByName("mixed")->IsA("vtkDoubleArray") ||
+    !table->GetColumnByName("label")->IsA("vtkStringArray") ||
+    vtkStringArray::SafeDownCast(table->GetColumnByName("label"))->GetValue(7) != "c\td")
+  {
+    std::cerr << "Wrong table read" << std::endl;
+    status = false;
+  }
+  return status ? EXIT_SUCCESS : EXIT_FAILURE;
+}
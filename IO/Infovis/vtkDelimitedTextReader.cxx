@@ -21,15 +21,21 @@
 #include "vtkDelimitedTextReader.h"
 #include "vtkCommand.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkStringToNumeric.h"
 #include "vtkTable.h"
+#include "vtkValueFromString.h"
+#include "vtkVariant.h"
 
 #include "vtkTextCodec.h"
 #include "vtkTextCodecFactory.h"
@@ -38,8 +44,10 @@
 #include <vtk_utf8.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -305,6 +313,592 @@ private:
   vtkTypeUInt32 WithinString;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// FastDelimitedTextParser
+
+// The whitespace trimmed by vtkStringToNumeric.
+void TrimValue(const char*& begin, const char*& end)
+{
+  auto isTrimmed = [](char c) { return c == ' ' || c == '\n' || c == '\t' || c == '\r'; };
+  while (begin != end && isTrimmed(*begin))
+  {
+    ++begin;
+  }
+  while (end != begin && isTrimmed(end[-1]))
+  {
+    --end;
+  }
+}
+
+// The numbers are parsed as vtkVariant parses strings, with a stream
+// skipping the whitespace around them, but much faster.
+void TrimSpace(const char*& begin, const char*& end)
+{
+  auto isSpace = [](char c) { return c == ' ' || (c >= '\t' && c <= '\r'); };
+  while (begin != end && isSpace(*begin))
+  {
+    ++begin;
+  }
+  while (end != begin && isSpace(end[-1]))
+  {
+    --end;
+  }
+}
+
+bool IntegerFromString(const char* begin, const char* end, int& value)
+{
+  TrimSpace(begin, end);
+  return begin != end &&
+    vtkValueFromString(begin, end, value) == static_cast<std::size_t>(end - begin);
+}
+
+bool DoubleFromString(const char* begin, const char* end, double& value)
+{
+  const char* first = begin;
+  const char* last = end;
+  TrimSpace(first, last);
+  // the names of the non-finite numbers, the values out of range and other
+  // notations are left to vtkVariant
+  bool common = first != last;
+  bool zero = true;
+  bool exponent = false;
+  for (const char* c = first; c != last && common; ++c)
+  {
+    exponent = exponent || *c == 'e' || *c == 'E';
+    zero = zero && (exponent || *c < '1' || *c > '9');
+    common = (*c >= '0' && *c <= '9') || *c == '.' || *c == '+' || *c == '-' || *c == 'e' ||
+      *c == 'E';
+  }
+  if (common &&
+    vtkValueFromString(first, last, value) == static_cast<std::size_t>(last - first) &&
+    (value == 0 ? zero : std::abs(value) >= std::numeric_limits<double>::min()) &&
+    std::abs(value) <= std::numeric_limits<double>::max())
+  {
+    return true;
+  }
+  bool valid;
+  value = vtkVariant(vtkStdString(begin, static_cast<std::size_t>(end - begin))).ToDouble(&valid);
+  return valid;
+}
+
+// A field of a chunk: a range of the input or, when escape sequences or
+// strings changed it, of the text of the chunk.
+struct ParsedField
+{
+  size_t Offset;
+  size_t Size;
+  bool InText;
+};
+
+struct ParsedChunk
+{
+  const char* Begin;
+  const char* End;
+  // whether an escape sequence is pending at the beginning and at the end
+  bool StartEscaped = false;
+  bool EndEscaped = false;
+  bool Valid = true;
+  std::string Text;
+  std::vector<ParsedField> Fields;
+  // one past the last field of each record
+  std::vector<size_t> RecordEnds;
+  vtkIdType FirstRecord = 0;
+};
+
+/// Parses the ASCII and UTF-8 inputs whose delimiters are ASCII characters
+/// as DelimitedTextIterator does, a byte at a time, the bytes of the other
+/// characters never being delimiters. The input is split in chunks after
+/// record delimiters, which end the records even within strings, and the
+/// chunks are parsed concurrently.
+
+class FastDelimitedTextParser
+{
+public:
+  FastDelimitedTextParser(const vtkIdType max_records, const std::string& record_delimiters,
+    const std::string& field_delimiters, const std::string& string_delimiters,
+    const std::string& whitespace, const std::string& escape, bool have_headers,
+    bool merge_cons_delimiters, bool use_string_delimiter)
+    : MaxRecords(max_records)
+    , MaxRecordIndex(have_headers ? max_records + 1 : max_records)
+    , HaveHeaders(have_headers)
+    , MergeConsDelims(merge_cons_delimiters)
+    , UseStringDelimiter(use_string_delimiter)
+    , CanParse(true)
+  {
+    this->SetClass(record_delimiters, RecordDelimiter);
+    this->SetClass(field_delimiters, FieldDelimiter);
+    this->SetClass(string_delimiters, StringDelimiter);
+    this->SetClass(whitespace, Whitespace);
+    this->SetClass(escape, EscapeDelimiter);
+  }
+
+  // Whether the delimiters are ASCII characters.
+  bool GetCanParse() const { return this->CanParse; }
+
+  // Parse [begin, end) into output, returning false if the input is not
+  // valid US-ASCII, when ascii is true, or UTF-8.
+  bool Parse(const char* begin, const char* end, bool ascii, vtkTable* output);
+
+  ///@{
+  // The conversion of the numeric columns, as vtkStringToNumeric does.
+  bool DetectNumericColumns = false;
+  bool ForceDouble = false;
+  bool TrimWhitespace = false;
+  int DefaultIntegerValue = 0;
+  double DefaultDoubleValue = 0.0;
+  ///@}
+
+private:
+  enum
+  {
+    RecordDelimiter = 1,
+    FieldDelimiter = 2,
+    StringDelimiter = 4,
+    Whitespace = 8,
+    EscapeDelimiter = 16
+  };
+
+  void SetClass(const std::string& characters, unsigned char byteClass)
+  {
+    for (char c : characters)
+    {
+      if (static_cast<unsigned char>(c) >= 0x80)
+      {
+        this->CanParse = false;
+      }
+      this->Classes[static_cast<unsigned char>(c)] |= byteClass;
+    }
+  }
+
+  bool Is(char c, unsigned char byteClass) const
+  {
+    return (this->Classes[static_cast<unsigned char>(c)] & byteClass) != 0;
+  }
+
+  void ParseChunk(ParsedChunk& chunk, bool ascii, bool last) const;
+
+  const char* GetField(const ParsedChunk& chunk, const ParsedField& field) const
+  {
+    return field.InText ? chunk.Text.data() + field.Offset : this->Input + field.Offset;
+  }
+
+  // The fields of a record of a chunk.
+  const ParsedField* GetRecord(const ParsedChunk& chunk, size_t record, size_t& numFields) const
+  {
+    const size_t first = record ? chunk.RecordEnds[record - 1] : 0;
+    numFields = chunk.RecordEnds[record] - first;
+    return chunk.Fields.data() + first;
+  }
+
+  // Call functor(row, begin, end) for the value of column col in the rows of
+  // chunk, until it returns false. The missing values are empty.
+  template <typename Functor>
+  void ForEachValue(
+    const ParsedChunk& chunk, size_t col, vtkIdType numRecords, Functor&& functor) const
+  {
+    const vtkIdType firstRecord = this->HaveHeaders ? 1 : 0;
+    for (size_t r = 0; r < chunk.RecordEnds.size(); ++r)
+    {
+      const vtkIdType record = chunk.FirstRecord + static_cast<vtkIdType>(r);
+      if (record >= numRecords)
+      {
+        return;
+      }
+      if (record < firstRecord)
+      {
+        continue;
+      }
+      size_t numFields;
+      const ParsedField* fields = this->GetRecord(chunk, r, numFields);
+      const char* value = col < numFields ? this->GetField(chunk, fields[col]) : "";
+      const size_t size = col < numFields ? fields[col].Size : 0;
+      if (!functor(record - firstRecord, value, value + size))
+      {
+        return;
+      }
+    }
+  }
+
+  void MakeColumns(const std::vector<ParsedChunk>& chunks, const std::vector<std::string>& names,
+    vtkIdType numRecords, vtkTable* output) const;
+
+  vtkIdType MaxRecords;
+  vtkIdType MaxRecordIndex;
+  unsigned char Classes[256] = {};
+  bool HaveHeaders;
+  bool MergeConsDelims;
+  bool UseStringDelimiter;
+  bool CanParse;
+  const char* Input = nullptr;
+};
+
+void FastDelimitedTextParser::ParseChunk(ParsedChunk& chunk, bool ascii, bool last) const
+{
+  chunk.Valid = ascii
+    ? std::find_if(chunk.Begin, chunk.End, [](char c) { return (c & 0x80) != 0; }) == chunk.End
+    : utf8::is_valid(chunk.Begin, chunk.End);
+  chunk.Text.clear();
+  chunk.Fields.clear();
+  chunk.RecordEnds.clear();
+  if (!chunk.Valid)
+  {
+    return;
+  }
+
+  // the current field is a range of the input until it is changed
+  const char* fieldBegin = chunk.Begin;
+  size_t fieldSize = 0;
+  bool fieldInText = false;
+  std::string field;
+  auto append = [&](const char* c) {
+    if (!fieldInText)
+    {
+      if (fieldSize == 0 || fieldBegin + fieldSize == c)
+      {
+        fieldBegin = fieldSize ? fieldBegin : c;
+        ++fieldSize;
+        return;
+      }
+      field.assign(fieldBegin, fieldSize);
+      fieldInText = true;
+    }
+    field.push_back(*c);
+  };
+  auto appendChar = [&](char c) {
+    if (!fieldInText)
+    {
+      field.assign(fieldBegin, fieldSize);
+      fieldInText = true;
+    }
+    field.push_back(c);
+  };
+  auto clear = [&]() {
+    fieldSize = 0;
+    fieldInText = false;
+    field.clear();
+  };
+  auto empty = [&]() { return fieldInText ? field.empty() : fieldSize == 0; };
+  auto insert = [&]() {
+    if (fieldInText)
+    {
+      chunk.Fields.push_back(ParsedField{ chunk.Text.size(), field.size(), true });
+      chunk.Text += field;
+    }
+    else
+    {
+      const size_t offset = fieldSize ? static_cast<size_t>(fieldBegin - this->Input) : 0;
+      chunk.Fields.push_back(ParsedField{ offset, fieldSize, false });
+    }
+  };
+
+  bool recordAdjacent = true;
+  bool processEscapeSequence = chunk.StartEscaped;
+  char withinString = 0;
+  for (const char* c = chunk.Begin; c != chunk.End; ++c)
+  {
+    // Strip adjacent record delimiters and whitespace...
+    if (recordAdjacent && this->Is(*c, RecordDelimiter | Whitespace))
+    {
+      continue;
+    }
+    recordAdjacent = false;
+
+    // Look for record delimiters ...
+    if (this->Is(*c, RecordDelimiter))
+    {
+      insert();
+      chunk.RecordEnds.push_back(chunk.Fields.size());
+      clear();
+      recordAdjacent = true;
+      withinString = 0;
+      continue;
+    }
+
+    // Look for field delimiters unless we're in a string ...
+    if (!withinString && this->Is(*c, FieldDelimiter))
+    {
+      if (!(empty() && this->MergeConsDelims))
+      {
+        insert();
+        clear();
+      }
+      continue;
+    }
+
+    // Check for start of escape sequence ...
+    if (!processEscapeSequence && this->Is(*c, EscapeDelimiter))
+    {
+      processEscapeSequence = true;
+      continue;
+    }
+
+    // Process escape sequence ...
+    if (processEscapeSequence)
+    {
+      static const std::string escaped = "abtnvfr\\";
+      static const std::string replaced = "\a\b\t\n\v\f\r\\";
+      const size_t pos = escaped.find(*c);
+      if (pos != std::string::npos)
+      {
+        appendChar(replaced[pos]);
+      }
+      else if (*c != '0')
+      {
+        appendChar(*c);
+      }
+      processEscapeSequence = false;
+      continue;
+    }
+
+    // Start a string ...
+    if (!withinString && this->Is(*c, StringDelimiter) && this->UseStringDelimiter)
+    {
+      withinString = *c;
+      clear();
+      continue;
+    }
+
+    // End a string ...
+    if (withinString && withinString == *c && this->UseStringDelimiter)
+    {
+      withinString = 0;
+      continue;
+    }
+
+    // Keep growing the current field ...
+    append(c);
+  }
+  chunk.EndEscaped = processEscapeSequence;
+
+  // the last record of the input may have no record delimiter, see
+  // DelimitedTextIterator::ReachedEndOfInput()
+  if (last && !recordAdjacent)
+  {
+    if (!empty())
+    {
+      const char lastChar = fieldInText ? field.back() : fieldBegin[fieldSize - 1];
+      if (!this->Is(lastChar, RecordDelimiter | Whitespace))
+      {
+        insert();
+      }
+    }
+    if (chunk.Fields.size() > (chunk.RecordEnds.empty() ? 0 : chunk.RecordEnds.back()))
+    {
+      chunk.RecordEnds.push_back(chunk.Fields.size());
+    }
+  }
+}
+
+bool FastDelimitedTextParser::Parse(
+  const char* begin, const char* end, bool ascii, vtkTable* output)
+{
+  // chunks of at least 64 KiB, a few per thread to balance the work
+  const size_t minChunkSize = 1 << 16;
+  const size_t size = static_cast<size_t>(end - begin);
+  const size_t maxChunks = 8 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  const size_t numChunks = std::max<size_t>(1, std::min(size / minChunkSize, maxChunks));
+  std::vector<ParsedChunk> chunks;
+  const char* chunkBegin = begin;
+  for (size_t i = 1; i <= numChunks && chunkBegin != end; ++i)
+  {
+    const char* chunkEnd = i == numChunks ? end : begin + i * (size / numChunks);
+    if (chunkEnd < chunkBegin)
+    {
+      chunkEnd = chunkBegin;
+    }
+    chunkEnd = std::find_if(
+      chunkEnd, end, [this](char c) { return this->Is(c, RecordDelimiter); });
+    chunkEnd = chunkEnd == end ? end : chunkEnd + 1;
+    chunks.emplace_back();
+    chunks.back().Begin = chunkBegin;
+    chunks.back().End = chunkEnd;
+    chunkBegin = chunkEnd;
+  }
+  this->Input = begin;
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(chunks.size()), [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType i = first; i < last; ++i)
+    {
+      this->ParseChunk(chunks[i], ascii, static_cast<size_t>(i) + 1 == chunks.size());
+    }
+  });
+
+  // a chunk is parsed again in the rare case an escape sequence was pending at
+  // the end of the previous one, then the records are numbered
+  vtkIdType numRecords = 0;
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    if (i > 0 && chunks[i].StartEscaped != chunks[i - 1].EndEscaped)
+    {
+      chunks[i].StartEscaped = chunks[i - 1].EndEscaped;
+      this->ParseChunk(chunks[i], ascii, i + 1 == chunks.size());
+    }
+    if (!chunks[i].Valid)
+    {
+      return false;
+    }
+    chunks[i].FirstRecord = numRecords;
+    numRecords += static_cast<vtkIdType>(chunks[i].RecordEnds.size());
+  }
+  if (this->MaxRecords && numRecords > this->MaxRecordIndex)
+  {
+    numRecords = this->MaxRecordIndex;
+  }
+  if (numRecords == 0)
+  {
+    return true;
+  }
+
+  // the first record makes the columns
+  auto firstChunk = std::find_if(chunks.begin(), chunks.end(),
+    [](const ParsedChunk& chunk) { return !chunk.RecordEnds.empty(); });
+  size_t numColumns;
+  const ParsedField* header = this->GetRecord(*firstChunk, 0, numColumns);
+  std::vector<std::string> names;
+  for (size_t col = 0; col < numColumns; ++col)
+  {
+    if (this->HaveHeaders)
+    {
+      names.emplace_back(this->GetField(*firstChunk, header[col]), header[col].Size);
+    }
+    else
+    {
+      std::stringstream buffer;
+      buffer << "Field " << col;
+      names.push_back(buffer.str());
+    }
+  }
+  this->MakeColumns(chunks, names, numRecords, output);
+  return true;
+}
+
+void FastDelimitedTextParser::MakeColumns(const std::vector<ParsedChunk>& chunks,
+  const std::vector<std::string>& names, vtkIdType numRecords, vtkTable* output) const
+{
+  const size_t numColumns = names.size();
+  const vtkIdType numChunks = static_cast<vtkIdType>(chunks.size());
+  const vtkIdType numRows = this->HaveHeaders ? numRecords - 1 : numRecords;
+  std::vector<vtkSmartPointer<vtkAbstractArray>> columns(numColumns);
+
+  // the numeric columns are converted directly, as vtkStringToNumeric does
+  if (this->DetectNumericColumns)
+  {
+    std::vector<vtkSmartPointer<vtkIntArray>> integers(numColumns);
+    std::vector<vtkSmartPointer<vtkDoubleArray>> doubles(numColumns);
+    for (size_t col = 0; col < numColumns; ++col)
+    {
+      if (!this->ForceDouble)
+      {
+        integers[col] = vtkSmartPointer<vtkIntArray>::New();
+        integers[col]->SetNumberOfValues(numRows);
+      }
+      doubles[col] = vtkSmartPointer<vtkDoubleArray>::New();
+      doubles[col]->SetNumberOfValues(numRows);
+    }
+    // whether the values of a column in a chunk are integers, or numbers
+    std::vector<char> areIntegers(numChunks * numColumns);
+    std::vector<char> areNumbers(numChunks * numColumns);
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType first, vtkIdType last) {
+      for (vtkIdType i = first; i < last; ++i)
+      {
+        for (size_t col = 0; col < numColumns; ++col)
+        {
+          int* integerValues = integers[col] ? integers[col]->GetPointer(0) : nullptr;
+          double* doubleValues = doubles[col]->GetPointer(0);
+          bool areInteger = integerValues != nullptr;
+          bool areNumber = true;
+          this->ForEachValue(chunks[i], col, numRecords,
+            [&](vtkIdType row, const char* begin, const char* end) {
+              if (this->TrimWhitespace)
+              {
+                TrimValue(begin, end);
+              }
+              if (begin == end)
+              {
+                if (integerValues)
+                {
+                  integerValues[row] = this->DefaultIntegerValue;
+                }
+                doubleValues[row] = this->DefaultDoubleValue;
+                return true;
+              }
+              if (areInteger)
+              {
+                int value;
+                if (IntegerFromString(begin, end, value))
+                {
+                  integerValues[row] = value;
+                  doubleValues[row] = value;
+                  return true;
+                }
+                areInteger = false;
+              }
+              areNumber = DoubleFromString(begin, end, doubleValues[row]);
+              return areNumber;
+            });
+          areIntegers[i * numColumns + col] = areInteger && areNumber;
+          areNumbers[i * numColumns + col] = areNumber;
+        }
+      }
+    });
+
+    for (size_t col = 0; col < numColumns; ++col)
+    {
+      bool areInteger = integers[col] != nullptr && numRows > 0;
+      bool areNumber = true;
+      for (vtkIdType i = 0; i < numChunks; ++i)
+      {
+        areInteger = areInteger && areIntegers[i * numColumns + col];
+        areNumber = areNumber && areNumbers[i * numColumns + col];
+      }
+      if (areInteger)
+      {
+        columns[col] = integers[col];
+      }
+      else if (areNumber)
+      {
+        columns[col] = doubles[col];
+      }
+    }
+  }
+
+  // the other columns are strings
+  std::vector<vtkStdString*> strings(numColumns, nullptr);
+  for (size_t col = 0; col < numColumns; ++col)
+  {
+    if (!columns[col])
+    {
+      vtkNew<vtkStringArray> array;
+      array->SetNumberOfValues(numRows);
+      strings[col] = array->GetPointer(0);
+      columns[col] = array;
+    }
+  }
+  vtkSMPTools::For(0, numChunks, [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType i = first; i < last; ++i)
+    {
+      for (size_t col = 0; col < numColumns; ++col)
+      {
+        vtkStdString* values = strings[col];
+        if (values)
+        {
+          this->ForEachValue(chunks[i], col, numRecords,
+            [values](vtkIdType row, const char* begin, const char* end) {
+              values[row].assign(begin, end);
+              return true;
+            });
+        }
+      }
+    }
+  });
+
+  for (size_t col = 0; col < numColumns; ++col)
+  {
+    columns[col]->SetName(names[col].c_str());
+    output->AddColumn(columns[col]);
+  }
+}
+
 } // End anonymous namespace
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -342,6 +936,7 @@ vtkDelimitedTextReader::vtkDelimitedTextReader()
   this->UseStringDelimiter = true;
   this->DetectNumericColumns = false;
   this->ForceDouble = false;
+  this->FastParsing = true;
   this->DefaultIntegerValue = 0;
   this->DefaultDoubleValue = 0.0;
   this->TrimWhitespacePriorToNumericConversion = false;
@@ -387,6 +982,7 @@ void vtkDelimitedTextReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DetectNumericColumns: " << (this->DetectNumericColumns ? "true" : "false")
      << endl;
   os << indent << "ForceDouble: " << (this->ForceDouble ? "true" : "false") << endl;
+  os << indent << "FastParsing: " << (this->FastParsing ? "true" : "false") << endl;
   os << indent << "DefaultIntegerValue: " << this->DefaultIntegerValue << endl;
   os << indent << "DefaultDoubleValue: " << this->DefaultDoubleValue << endl;
   os << indent << "TrimWhitespacePriorToNumericConversion: "
@@ -559,17 +1155,6 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
       }
     }
 
-    vtkTextCodec* transCodec = nullptr;
-
-    if (this->UnicodeCharacterSet)
-    {
-      transCodec = vtkTextCodecFactory::CodecForName(this->UnicodeCharacterSet);
-    }
-    else
-    {
-      transCodec = vtkTextCodecFactory::CodecToHandle(*input_stream_pt);
-    }
-
     char tstring[2];
     tstring[1] = '\0';
     tstring[0] = this->StringDelimiter;
@@ -583,20 +1168,73 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
     this->UnicodeFieldDelimiters = fieldDelimiterCharacters;
     this->UnicodeStringDelimiters = tstring;
 
-    if (nullptr == transCodec)
+    vtkTextCodec* transCodec = nullptr;
+
+    if (this->UnicodeCharacterSet)
     {
-      // should this use the locale instead??
-      return 1;
+      transCodec = vtkTextCodecFactory::CodecForName(this->UnicodeCharacterSet);
     }
 
-    DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
-      this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
-      this->UnicodeEscapeCharacter, this->HaveHeaders, this->MergeConsecutiveDelimiters,
-      this->UseStringDelimiter, output_table);
+    // The fast parser handles the inputs that the ASCII or UTF-8 codecs would,
+    // which are the first ones tried when the character set is not given.
+    // It converts the numeric columns too.
+    const char* codecName = transCodec ? transCodec->Name() : nullptr;
+    const bool ascii = codecName && strcmp(codecName, "US-ASCII") == 0;
+    bool parsed = false;
+    if (this->FastParsing &&
+      (!this->UnicodeCharacterSet || ascii || (codecName && strcmp(codecName, "UTF-8") == 0)))
+    {
+      FastDelimitedTextParser parser(this->MaxRecords, this->UnicodeRecordDelimiters,
+        this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
+        this->UnicodeEscapeCharacter, this->HaveHeaders, this->MergeConsecutiveDelimiters,
+        this->UseStringDelimiter);
+      parser.DetectNumericColumns = this->DetectNumericColumns;
+      parser.ForceDouble = this->ForceDouble;
+      parser.TrimWhitespace = this->TrimWhitespacePriorToNumericConversion;
+      parser.DefaultIntegerValue = this->DefaultIntegerValue;
+      parser.DefaultDoubleValue = this->DefaultDoubleValue;
+      if (parser.GetCanParse())
+      {
+        const std::streampos start = input_stream_pt->tellg();
+        input_stream_pt->seekg(0, ios::end);
+        std::vector<char> buffer(static_cast<size_t>(input_stream_pt->tellg() - start));
+        input_stream_pt->seekg(start);
+        input_stream_pt->read(buffer.data(), buffer.size());
+        parsed = parser.Parse(buffer.data(), buffer.data() + buffer.size(), ascii, output_table);
+        if (!parsed)
+        {
+          // left to the codecs, which will report the invalid characters
+          input_stream_pt->clear();
+          input_stream_pt->seekg(start);
+        }
+      }
+    }
+
+    if (!parsed)
+    {
+      if (!this->UnicodeCharacterSet)
+      {
+        transCodec = vtkTextCodecFactory::CodecToHandle(*input_stream_pt);
+      }
 
-    transCodec->ToUnicode(*input_stream_pt, iterator);
-    iterator.ReachedEndOfInput();
-    transCodec->Delete();
+      if (nullptr == transCodec)
+      {
+        // should this use the locale instead??
+        return 1;
+      }
+
+      DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
+        this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
+        this->UnicodeEscapeCharacter, this->HaveHeaders, this->MergeConsecutiveDelimiters,
+        this->UseStringDelimiter, output_table);
+
+      transCodec->ToUnicode(*input_stream_pt, iterator);
+      iterator.ReachedEndOfInput();
+    }
+    if (transCodec)
+    {
+      transCodec->Delete();
+    }
 
     if (this->OutputPedigreeIds)
     {
@@ -627,7 +1265,7 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
       }
     }
 
-    if (this->DetectNumericColumns)
+    if (this->DetectNumericColumns && !parsed)
     {
       vtkStringToNumeric* converter = vtkStringToNumeric::New();
       converter->SetForceDouble(this->ForceDouble);
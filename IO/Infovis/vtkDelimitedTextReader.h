@@ -47,6 +47,12 @@
  * this class will acquire the ability to read gracefully text from
  * any code page, making this option obsolete.
  *
+ * The ASCII and UTF-8 inputs whose delimiters are ASCII characters are read
+ * by a faster parser when FastParsing is set: the input is split in chunks
+ * at record delimiters, which are parsed concurrently with vtkSMPTools, and
+ * the numeric columns are detected and converted while parsing, without
+ * making vtkStringArray columns first. The output is the same.
+ *
  * This class emits ProgressEvent for every 100 lines it reads.
  *
  * @par Thanks:
@@ -228,6 +234,17 @@ public:
   vtkBooleanMacro(ForceDouble, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true, the ASCII and UTF-8 inputs whose delimiters are ASCII
+   * characters are parsed by chunks in parallel, see the class description.
+   * Default is on.
+   */
+  vtkSetMacro(FastParsing, bool);
+  vtkGetMacro(FastParsing, bool);
+  vtkBooleanMacro(FastParsing, bool);
+  ///@}
+
   ///@{
   /**
    * When DetectNumericColumns is set to true, whether to trim whitespace from
@@ -345,6 +362,7 @@ protected:
   std::string UnicodeEscapeCharacter;
   bool DetectNumericColumns;
   bool ForceDouble;
+  bool FastParsing;
   bool TrimWhitespacePriorToNumericConversion;
   int DefaultIntegerValue;
   double DefaultDoubleValue;
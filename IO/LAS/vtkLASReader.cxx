@@ -23,12 +23,14 @@
 #include <vtkPointData.h>
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkUnsignedShortArray.h>
 #include <vtkVertexGlyphFilter.h>
 #include <vtksys/FStream.hxx>
 
 #include <liblas/liblas.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <valarray>
@@ -40,6 +42,7 @@ vtkStandardNewMacro(vtkLASReader);
 vtkLASReader::vtkLASReader()
 {
   this->FileName = nullptr;
+  this->MaximumNumberOfPoints = 0;
 
   this->SetNumberOfInputPorts(0);
   this->SetNumberOfOutputPorts(1);
@@ -51,12 +54,24 @@ vtkLASReader::~vtkLASReader()
   delete[] this->FileName;
 }
 
+//------------------------------------------------------------------------------
+int vtkLASReader::RequestInformation(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  outInfo->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 int vtkLASReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(request), vtkInformationVector* outputVector)
 {
   // Get the info object
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  const int piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  const int numPieces =
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
 
   // Get the output
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
@@ -75,8 +90,18 @@ int vtkLASReader::RequestData(vtkInformation* vtkNotUsed(request),
   liblas::ReaderFactory readerFactory;
   liblas::Reader reader = readerFactory.CreateWithStream(ifs);
 
+  // records of the piece, decimated to the maximum number of points
+  const vtkIdType count = static_cast<vtkIdType>(reader.GetHeader().GetPointRecordsCount());
+  const vtkIdType first = count * piece / std::max(numPieces, 1);
+  const vtkIdType last = count * (piece + 1) / std::max(numPieces, 1);
+  vtkIdType stride = 1;
+  if (this->MaximumNumberOfPoints > 0 && last - first > this->MaximumNumberOfPoints)
+  {
+    stride = (last - first + this->MaximumNumberOfPoints - 1) / this->MaximumNumberOfPoints;
+  }
+
   vtkNew<vtkPolyData> pointsPolyData;
-  this->ReadPointRecordData(reader, pointsPolyData);
+  this->ReadPointRecordData(reader, pointsPolyData, first, last, stride);
   ifs.close();
 
   // Convert points to verts in output polydata
@@ -90,6 +115,14 @@ int vtkLASReader::RequestData(vtkInformation* vtkNotUsed(request),
 
 //------------------------------------------------------------------------------
 void vtkLASReader::ReadPointRecordData(liblas::Reader& reader, vtkPolyData* pointsPolyData)
+{
+  this->ReadPointRecordData(reader, pointsPolyData, 0,
+    static_cast<vtkIdType>(reader.GetHeader().GetPointRecordsCount()), 1);
+}
+
+//------------------------------------------------------------------------------
+void vtkLASReader::ReadPointRecordData(liblas::Reader& reader, vtkPolyData* pointsPolyData,
+  vtkIdType first, vtkIdType last, vtkIdType stride)
 {
   vtkNew<vtkPoints> points;
   // scalars associated with points
@@ -107,10 +140,24 @@ void vtkLASReader::ReadPointRecordData(liblas::Reader& reader, vtkPolyData* poin
   std::valarray<double> scale = { header.GetScaleX(), header.GetScaleY(), header.GetScaleZ() };
   std::valarray<double> offset = { header.GetOffsetX(), header.GetOffsetY(), header.GetOffsetZ() };
   liblas::PointFormatName pointFormat = header.GetDataFormatId();
-  int pointRecordsCount = header.GetPointRecordsCount();
 
-  for (int i = 0; i < pointRecordsCount && reader.ReadNextPoint(); i++)
+  const vtkIdType numberOfPoints = first < last ? (last - first + stride - 1) / stride : 0;
+  points->Allocate(numberOfPoints);
+  intensity->Allocate(numberOfPoints);
+
+  if (first > 0 && !reader.Seek(static_cast<std::size_t>(first)))
   {
+    vtkErrorMacro(<< "Unable to seek to point record " << first << " in " << this->FileName);
+    return;
+  }
+  for (vtkIdType i = first; i < last; i += stride)
+  {
+    // decimated records are skipped without being read
+    if ((i != first && stride > 1 && !reader.Seek(static_cast<std::size_t>(i))) ||
+      !reader.ReadNextPoint())
+    {
+      break;
+    }
     liblas::Point const& p = reader.GetPoint();
     std::valarray<double> lasPoint = { p.GetX(), p.GetY(), p.GetZ() };
     points->InsertNextPoint(&lasPoint[0]);
@@ -173,5 +220,6 @@ void vtkLASReader::PrintSelf(ostream& os, vtkIndent indent)
   Superclass::PrintSelf(os, indent);
   os << "vtkLASReader" << std::endl;
   os << "Filename: " << this->FileName << std::endl;
+  os << indent << "MaximumNumberOfPoints: " << this->MaximumNumberOfPoints << std::endl;
 }
 VTK_ABI_NAMESPACE_END
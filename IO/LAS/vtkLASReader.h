@@ -23,6 +23,10 @@
  * "classification": vtkUnsignedCharArray (optional)
  * "color": vtkUnsignedShortArray (optional)
  *
+ * The reader handles piece requests: a piece is a contiguous range of the
+ * point records, so that a streaming pipeline never loads the whole file.
+ * MaximumNumberOfPoints bounds the memory of a piece: larger pieces are
+ * decimated, reading every n-th point record only.
  *
  * @sa
  * vtkPolyData
@@ -58,10 +62,24 @@ public:
   vtkSetFilePathMacro(FileName);
   vtkGetFilePathMacro(FileName);
 
+  ///@{
+  /**
+   * Set/Get the maximum number of points read for a piece, 0 for no limit.
+   * When a piece has more point records, every n-th record is read instead,
+   * which gives a uniformly decimated, coarser level of detail, cloud. The
+   * default is 0.
+   */
+  vtkSetClampMacro(MaximumNumberOfPoints, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(MaximumNumberOfPoints, vtkIdType);
+  ///@}
+
 protected:
   vtkLASReader();
   ~vtkLASReader() override;
 
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
   /**
    * Core implementation of the data set reader
    */
@@ -73,7 +91,14 @@ protected:
    */
   void ReadPointRecordData(liblas::Reader& reader, vtkPolyData* pointsPolyData);
 
+  /**
+   * Read every stride-th point record of the range [first, last)
+   */
+  void ReadPointRecordData(liblas::Reader& reader, vtkPolyData* pointsPolyData, vtkIdType first,
+    vtkIdType last, vtkIdType stride);
+
   char* FileName;
+  vtkIdType MaximumNumberOfPoints;
 };
 
 VTK_ABI_NAMESPACE_END
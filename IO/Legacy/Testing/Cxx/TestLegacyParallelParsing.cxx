@@ -0,0 +1,177 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestLegacyParallelParsing.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that large ascii and binary sections of legacy files, which are
+// parsed by blocks in parallel, are read back with their values for both the
+// current and the 4.2 file versions.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCharArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkUnstructuredGridReader.h"
+#include "vtkUnstructuredGridWriter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    std::cerr << "Different array sizes" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        std::cerr << "Tuple " << i << " of " << (a->GetName() ? a->GetName() : "points")
+                  << " differs" << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameGrids(vtkUnstructuredGrid* a, vtkUnstructuredGrid* b)
+{
+  if (!SameArrays(a->GetPoints()->GetData(), b->GetPoints()->GetData()) ||
+    a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  vtkNew<vtkIdList> cellA;
+  vtkNew<vtkIdList> cellB;
+  for (vtkIdType cellId = 0; cellId < a->GetNumberOfCells(); ++cellId)
+  {
+    a->GetCellPoints(cellId, cellA);
+    b->GetCellPoints(cellId, cellB);
+    bool same = a->GetCellType(cellId) == b->GetCellType(cellId) &&
+      cellA->GetNumberOfIds() == cellB->GetNumberOfIds();
+    for (vtkIdType i = 0; same && i < cellA->GetNumberOfIds(); ++i)
+    {
+      same = cellA->GetId(i) == cellB->GetId(i);
+    }
+    if (!same)
+    {
+      std::cerr << "Cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+  }
+  const char* pointArrays[] = { "Floats", "Doubles", "Ints", "UChars", "Chars" };
+  for (const char* name : pointArrays)
+  {
+    if (!SameArrays(a->GetPointData()->GetArray(name), b->GetPointData()->GetArray(name)))
+    {
+      return false;
+    }
+  }
+  return SameArrays(a->GetCellData()->GetArray("Ids"), b->GetCellData()->GetArray("Ids"));
+}
+}
+
+int TestLegacyParallelParsing(int, char*[])
+{
+  // large enough for the ascii points to span several blocks; values are
+  // chosen to be written exactly in ascii files
+  const vtkIdType numPts = 300000;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkFloatArray> floats;
+  floats->SetName("Floats");
+  floats->SetNumberOfTuples(numPts);
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetName("Doubles");
+  doubles->SetNumberOfComponents(3);
+  doubles->SetNumberOfTuples(numPts);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  ints->SetNumberOfTuples(numPts);
+  vtkNew<vtkUnsignedCharArray> uchars;
+  uchars->SetName("UChars");
+  uchars->SetNumberOfTuples(numPts);
+  vtkNew<vtkCharArray> chars;
+  chars->SetName("Chars");
+  chars->SetNumberOfTuples(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    points->SetPoint(i, (i % 4000) * 0.25, -(i % 999) * 0.5, i % 7);
+    floats->SetValue(i, (i % 4096) * 0.5f);
+    doubles->SetTuple3(i, i * 0.125, -1.0 / (1 << (i % 16)), (i % 100) * 1e9);
+    ints->SetValue(i, static_cast<int>(i * 7919 % 200003) - 100000);
+    uchars->SetValue(i, static_cast<unsigned char>(i % 256));
+    chars->SetValue(i, static_cast<char>(i % 128 - 64));
+  }
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(floats);
+  grid->GetPointData()->AddArray(doubles);
+  grid->GetPointData()->AddArray(ints);
+  grid->GetPointData()->AddArray(uchars);
+  grid->GetPointData()->AddArray(chars);
+
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("Ids");
+  grid->Allocate();
+  for (vtkIdType i = 0; i + 3 < numPts; i += 2)
+  {
+    const vtkIdType tetra[4] = { i, i + 1, i + 2, i + 3 };
+    grid->InsertNextCell(VTK_TETRA, 4, tetra);
+    ids->InsertNextValue(i / 2);
+  }
+  grid->GetCellData()->AddArray(ids);
+
+  const int fileTypes[2] = { VTK_ASCII, VTK_BINARY };
+  const int fileVersions[2] = { 42, 51 };
+  for (int fileType : fileTypes)
+  {
+    for (int fileVersion : fileVersions)
+    {
+      vtkNew<vtkUnstructuredGridWriter> writer;
+      writer->SetInputData(grid);
+      writer->SetFileType(fileType);
+      writer->SetFileVersion(fileVersion);
+      writer->WriteToOutputStringOn();
+      writer->Write();
+
+      vtkNew<vtkUnstructuredGridReader> reader;
+      reader->ReadFromInputStringOn();
+      reader->SetInputString(writer->GetOutputStdString());
+      reader->Update();
+      if (!SameGrids(grid, reader->GetOutput()))
+      {
+        std::cerr << "Wrong output for " << (fileType == VTK_ASCII ? "ascii" : "binary")
+                  << " files of version " << fileVersion << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -46,6 +46,7 @@
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkShortArray.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -56,12 +57,14 @@
 #include "vtkUnsignedIntArray.h"
 #include "vtkUnsignedLongArray.h"
 #include "vtkUnsignedShortArray.h"
+#include "vtkValueFromString.h"
 #include "vtkVariantArray.h"
 
 #include "vtksys/FStream.hxx"
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <sstream>
 #include <vector>
@@ -1500,6 +1503,219 @@ int vtkDataReader::ReadRowData(vtkTable* t, vtkIdType numEdges)
   return 1;
 }
 
+namespace
+{
+// Sections with fewer values are parsed from the stream directly.
+const vtkIdType MinimumParallelValues = 4096;
+// Number of bytes parsed at once by ParseASCIIValues().
+const std::size_t ASCIIBlockSize = 1 << 22;
+// Approximate number of bytes scanned by a single task.
+const std::size_t ASCIIChunkSize = 1 << 16;
+
+bool IsSpace(char c)
+{
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// The legacy format stores chars as integers.
+template <class T>
+struct ASCIIValue
+{
+  using Type = T;
+};
+template <>
+struct ASCIIValue<char>
+{
+  using Type = int;
+};
+template <>
+struct ASCIIValue<signed char>
+{
+  using Type = int;
+};
+template <>
+struct ASCIIValue<unsigned char>
+{
+  using Type = int;
+};
+
+// Count the whitespace separated tokens of [begin, end).
+vtkIdType CountTokens(const char* begin, const char* end)
+{
+  vtkIdType count = 0;
+  bool inToken = false;
+  for (const char* ptr = begin; ptr != end; ++ptr)
+  {
+    const bool space = IsSpace(*ptr);
+    count += (inToken && space) ? 1 : 0;
+    inToken = !space;
+  }
+  return count + (inToken ? 1 : 0);
+}
+
+// Parse at most maxValues whitespace separated tokens of [begin, end) into
+// data, and set last right after the last one. Returns false if a token is not
+// a valid number of type T.
+template <class T>
+bool ParseTokens(
+  const char* begin, const char* end, T* data, vtkIdType maxValues, const char*& last)
+{
+  using ValueType = typename ASCIIValue<T>::Type;
+  const char* ptr = begin;
+  for (vtkIdType i = 0; i < maxValues; ++i)
+  {
+    while (ptr != end && IsSpace(*ptr))
+    {
+      ++ptr;
+    }
+    if (ptr == end)
+    {
+      break;
+    }
+    const char* tokenEnd = ptr;
+    while (tokenEnd != end && !IsSpace(*tokenEnd))
+    {
+      ++tokenEnd;
+    }
+    ValueType value;
+    if (vtkValueFromString(ptr, tokenEnd, value) != static_cast<std::size_t>(tokenEnd - ptr))
+    {
+      return false;
+    }
+    data[i] = static_cast<T>(value);
+    ptr = tokenEnd;
+  }
+  last = ptr;
+  return true;
+}
+
+// Read numValues whitespace separated numbers from the stream by large blocks
+// that are parsed in parallel, leaving the stream right after the last
+// number. Returns false, with the stream at its initial position, if the
+// stream cannot be repositioned or if the values cannot be parsed this way, in
+// which case they have to be read with the stream operators.
+template <class T>
+bool ParseASCIIValues(istream* is, T* data, vtkIdType numValues)
+{
+  const std::streampos start = is->tellg();
+  if (start == std::streampos(-1))
+  {
+    return false;
+  }
+
+  std::vector<char> buffer;
+  std::vector<const char*> chunks;
+  std::vector<vtkIdType> counts;
+  std::size_t carry = 0; // bytes of a token cut by the previous block
+  vtkIdType done = 0;
+  while (done < numValues)
+  {
+    buffer.resize(carry + ASCIIBlockSize);
+    is->read(buffer.data() + carry, ASCIIBlockSize);
+    const std::size_t size = carry + static_cast<std::size_t>(is->gcount());
+    const bool atEnd = !is->good();
+    const char* const bufferEnd = buffer.data() + size;
+
+    // do not parse a token that may continue in the next block
+    const char* end = bufferEnd;
+    if (!atEnd)
+    {
+      while (end != buffer.data() && !IsSpace(end[-1]))
+      {
+        --end;
+      }
+      if (end == buffer.data())
+      {
+        break;
+      }
+    }
+
+    // split the block at whitespace into chunks scanned by separate tasks
+    chunks.assign(1, buffer.data());
+    while (static_cast<std::size_t>(end - chunks.back()) > ASCIIChunkSize)
+    {
+      const char* split = chunks.back() + ASCIIChunkSize;
+      while (split != end && !IsSpace(*split))
+      {
+        ++split;
+      }
+      chunks.push_back(split);
+    }
+    chunks.push_back(end);
+    const vtkIdType numChunks = static_cast<vtkIdType>(chunks.size()) - 1;
+
+    // count the tokens of each chunk to know where their values go
+    counts.assign(numChunks + 1, 0);
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType begin, vtkIdType endChunk) {
+      for (vtkIdType chunk = begin; chunk < endChunk; ++chunk)
+      {
+        counts[chunk + 1] = CountTokens(chunks[chunk], chunks[chunk + 1]);
+      }
+    });
+    for (vtkIdType chunk = 0; chunk < numChunks; ++chunk)
+    {
+      counts[chunk + 1] += counts[chunk];
+    }
+
+    // parse the chunks, the one holding the last value tells where it ends
+    std::atomic<bool> valid(true);
+    const char* last = end;
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType begin, vtkIdType endChunk) {
+      for (vtkIdType chunk = begin; chunk < endChunk; ++chunk)
+      {
+        const vtkIdType first = done + counts[chunk];
+        if (first >= numValues)
+        {
+          break;
+        }
+        const vtkIdType count = std::min(counts[chunk + 1] - counts[chunk], numValues - first);
+        const char* chunkLast;
+        if (!ParseTokens(chunks[chunk], chunks[chunk + 1], data + first, count, chunkLast))
+        {
+          valid = false;
+        }
+        else if (first + count == numValues)
+        {
+          last = chunkLast;
+        }
+      }
+    });
+    if (!valid)
+    {
+      break;
+    }
+    done = std::min(numValues, done + counts[numChunks]);
+
+    if (done == numValues)
+    {
+      // give back what follows the last value
+      is->clear();
+      is->seekg(-static_cast<std::streamoff>(bufferEnd - last), std::ios_base::cur);
+      return true;
+    }
+    if (atEnd)
+    {
+      break;
+    }
+    carry = static_cast<std::size_t>(bufferEnd - end);
+    std::copy(end, bufferEnd, buffer.data());
+  }
+
+  is->clear();
+  is->seekg(start);
+  return false;
+}
+
+// Swap big endian values to the native byte order in parallel.
+template <class T>
+void SwapBigEndianValues(T* data, vtkIdType numValues)
+{
+  vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
+    vtkByteSwap::SwapBERange(data + begin, static_cast<size_t>(end - begin));
+  });
+}
+}
+
 // General templated function to read data of various types.
 template <class T>
 int vtkReadBinaryData(istream* IS, T* data, vtkIdType numTuples, vtkIdType numComp)
@@ -1528,6 +1744,12 @@ int vtkReadASCIIData(vtkDataReader* self, T* data, vtkIdType numTuples, vtkIdTyp
 {
   vtkIdType i, j;
 
+  if (numTuples * numComp >= MinimumParallelValues &&
+    ParseASCIIValues(self->GetIStream(), data, numTuples * numComp))
+  {
+    return 1;
+  }
+
   for (i = 0; i < numTuples; i++)
   {
     for (j = 0; j < numComp; j++)
@@ -1639,7 +1861,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap2BERange(ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
     else
     {
@@ -1655,7 +1877,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap2BERange((short*)ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
     else
     {
@@ -1672,7 +1894,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, buffer.data(), numTuples, numComp);
-      vtkByteSwap::Swap4BERange(buffer.data(), numTuples * numComp);
+      SwapBigEndianValues(buffer.data(), numTuples * numComp);
     }
     else
     {
@@ -1693,7 +1915,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
     else
     {
@@ -1709,7 +1931,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap4BERange((int*)ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
     else
     {
@@ -1728,11 +1950,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-#if VTK_SIZEOF_LONG == 4
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
-#else // VTK_SIZEOF_LONG == 8
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
-#endif
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
 
     else
@@ -1749,11 +1967,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-#if VTK_SIZEOF_LONG == 4
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
-#else // VTK_SIZEOF_LONG == 8
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
-#endif
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
     else
     {
@@ -1769,7 +1983,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
 
     else
@@ -1786,7 +2000,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
 
     else
@@ -1803,7 +2017,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
     else
     {
@@ -1819,7 +2033,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
+      SwapBigEndianValues(ptr, numTuples * numComp);
     }
     else
     {
@@ -3188,9 +3402,9 @@ int vtkDataReader::ReadCellsLegacy(vtkIdType size, int* data)
                     << " for file: " << (fname ? fname : "(Null FileName)"));
       return 0;
     }
-    vtkByteSwap::Swap4BERange(data, size);
+    SwapBigEndianValues(data, size);
   }
-  else // ascii
+  else if (size < MinimumParallelValues || !ParseASCIIValues(this->IS, data, size)) // ascii
   {
     for (i = 0; i < size; i++)
     {
@@ -3240,7 +3454,7 @@ int vtkDataReader::ReadCellsLegacy(vtkIdType size, int* data, int skip1, int rea
                     << " for file: " << (fname ? fname : "(Null FileName)"));
       return 0;
     }
-    vtkByteSwap::Swap4BERange(tmp, size);
+    SwapBigEndianValues(tmp, size);
     if (tmp == data)
     {
       return 1;
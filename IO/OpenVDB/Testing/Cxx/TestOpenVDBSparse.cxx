@@ -0,0 +1,101 @@
+#include "vtkOpenVDBReader.h"
+#include "vtkOpenVDBWriter.h"
+
+#include "vtkDataArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkTestUtilities.h"
+
+#include <string>
+
+namespace
+{
+vtkDataArray* ReadDensity(vtkOpenVDBReader* reader, const std::string& fileName, bool sparse)
+{
+  reader->SetFileName(fileName.c_str());
+  reader->SetSparseImageVolumes(sparse);
+  reader->Update();
+  vtkPartitionedDataSetCollection* output =
+    vtkPartitionedDataSetCollection::SafeDownCast(reader->GetOutputDataObject(0));
+  vtkImageData* image =
+    output ? vtkImageData::SafeDownCast(output->GetPartitionAsDataObject(0, 0)) : nullptr;
+  return image ? image->GetPointData()->GetArray("density") : nullptr;
+}
+}
+
+int TestOpenVDBSparse(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory." << endl;
+    return EXIT_FAILURE;
+  }
+  const std::string fileName = std::string(tempDir) + "/TestOpenVDBSparse.vdb";
+  delete[] tempDir;
+
+  // a mostly empty volume: a ball of density in a 64^3 image
+  const int dim = 64;
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(dim, dim, dim);
+  vtkNew<vtkFloatArray> density;
+  density->SetName("density");
+  density->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (int k = 0, id = 0; k < dim; k++)
+  {
+    for (int j = 0; j < dim; j++)
+    {
+      for (int i = 0; i < dim; i++, id++)
+      {
+        const int r2 = (i - 20) * (i - 20) + (j - 24) * (j - 24) + (k - 28) * (k - 28);
+        density->SetValue(id, r2 < 100 ? 100.f - r2 : 0.f);
+      }
+    }
+  }
+  image->GetPointData()->AddArray(density);
+
+  vtkNew<vtkOpenVDBWriter> writer;
+  writer->SetInputData(image);
+  writer->SetFileName(fileName.c_str());
+  writer->SkipBackgroundVoxelsOn();
+  writer->Write();
+
+  vtkNew<vtkOpenVDBReader> denseReader;
+  vtkDataArray* dense = ::ReadDensity(denseReader, fileName, false);
+  vtkNew<vtkOpenVDBReader> sparseReader;
+  vtkDataArray* sparse = ::ReadDensity(sparseReader, fileName, true);
+  if (!dense || !sparse)
+  {
+    cerr << "Could not read the density back." << endl;
+    return EXIT_FAILURE;
+  }
+  if (sparse->GetNumberOfTuples() != dense->GetNumberOfTuples() ||
+    sparse->GetNumberOfComponents() != dense->GetNumberOfComponents())
+  {
+    cerr << "The sparse array has " << sparse->GetNumberOfTuples() << " tuples instead of "
+         << dense->GetNumberOfTuples() << endl;
+    return EXIT_FAILURE;
+  }
+  // only the ball is written, its bounding box is read back
+  if (dense->GetNumberOfTuples() >= image->GetNumberOfPoints() || dense->GetRange()[1] != 100.)
+  {
+    cerr << "Unexpected density of " << dense->GetNumberOfTuples() << " tuples with maximum "
+         << dense->GetRange()[1] << endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType id = 0; id < dense->GetNumberOfTuples(); id++)
+  {
+    if (sparse->GetComponent(id, 0) != dense->GetComponent(id, 0))
+    {
+      cerr << "Sparse value " << sparse->GetComponent(id, 0) << " differs from dense value "
+           << dense->GetComponent(id, 0) << " at " << id << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
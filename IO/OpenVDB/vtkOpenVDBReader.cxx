@@ -6,10 +6,12 @@
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkImageData.h"
+#include "vtkImplicitArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkIntArray.h"
 #include "vtkLongArray.h"
+#include "vtkOpenVDBSparseArrayBackend.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPointData.h"
@@ -341,6 +343,35 @@ struct PopulateImageDataArray
   }
 };
 
+//------------------------------------------------------------------------
+// Creates an implicit array sampling one OpenVDB grid on access, with the value type
+// of the given array, for an image of the given dimensions.
+struct NewSparseImageDataArray
+{
+  // dimensions of the image
+  const int* dimensions = nullptr;
+  // dataset information of the image
+  const vtkResDataLeafInformation* dataInfo = nullptr;
+  // the created array
+  vtkSmartPointer<vtkDataArray> sparseArray;
+
+  template <vtkIdType NComps, typename GridType, typename ArrayType>
+  void operator()(typename GridType::Ptr grid, ArrayType* dataArray)
+  {
+    if (grid == nullptr || dataArray == nullptr || dimensions == nullptr || dataInfo == nullptr)
+    {
+      return;
+    }
+
+    using BackendType =
+      vtkOpenVDBSparseArrayBackend<GridType, typename ArrayType::ValueType, NComps>;
+    vtkNew<vtkImplicitArray<BackendType>> array;
+    array->ConstructBackend(
+      grid, this->dataInfo->BBoxMin, this->dimensions, this->dataInfo->DownsamplingFactor);
+    this->sparseArray = array;
+  }
+};
+
 //------------------------------------------------------------------------
 vtkSmartPointer<vtkDataArray> InstanciateVtkArrayType(openvdb::GridBase::Ptr grid)
 {
@@ -1076,6 +1107,20 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
         vtkErrorMacro(<< "Couldn't instantiate vtDataArray, unknown array type");
         return 0;
       }
+      if (this->SparseImageVolumes)
+      {
+        // sample the grid on access rather than copying it
+        NewSparseImageDataArray newSparseArray;
+        newSparseArray.dimensions = imgDataInfo.Dimensions;
+        newSparseArray.dataInfo = &imgDataInfo;
+        ::processTypedGridArray(gridInfo->Grid, dataArray, newSparseArray);
+        if (!newSparseArray.sparseArray)
+        {
+          vtkErrorMacro(<< "Couldn't instantiate a sparse array for grid " << gridInfo->Name);
+          return 0;
+        }
+        dataArray = newSparseArray.sparseArray;
+      }
       dataArray->SetName(gridInfo->Name.c_str());
       dataArray->SetNumberOfComponents(gridInfo->NumComps);
       dataArray->SetNumberOfTuples(imgData->GetNumberOfPoints());
@@ -1125,7 +1170,7 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
   for (const auto& imgDataInfo : imgDatasetsInfo)
   {
     vtkImageData* imagedata = vtkImageData::SafeDownCast(output->GetPartition(imgdataIdx, 0));
-    if (!imagedata)
+    if (!imagedata || this->SparseImageVolumes)
     {
       imgdataIdx++;
       continue;
@@ -1245,6 +1290,7 @@ void vtkOpenVDBReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DownsamplingFactor: " << this->DownsamplingFactor << endl;
   os << indent << "MergeImageVolumes: " << this->MergeImageVolumes << endl;
   os << indent << "MergePointSets: " << this->MergePointSets << endl;
+  os << indent << "SparseImageVolumes: " << this->SparseImageVolumes << endl;
   this->GridSelection->PrintSelf(os, indent.GetNextIndent());
 }
 VTK_ABI_NAMESPACE_END
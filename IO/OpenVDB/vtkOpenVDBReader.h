@@ -22,6 +22,8 @@
  * It is also possible to merge all image volumes into a single vtkImageData, and independently
  * merge all point clouds into a single vtkPolyData (cf vtkOpenVDBReader::SetMergeImageVolumes
  * and vtkOpenVDBReader::SetMergePointSets).
+ * The image volumes can also be kept sparse, their arrays sampling the OpenVDB
+ * grids on access (cf vtkOpenVDBReader::SetSparseImageVolumes).
  */
 
 #ifndef vtkOpenVDBReader_h
@@ -107,6 +109,20 @@ public:
   vtkBooleanMacro(MergePointSets, bool);
   ///@}
 
+  ///@{
+  /**
+   * When enabled, the arrays of the image volumes are implicit arrays sampling
+   * the OpenVDB grids on access, instead of dense copies of the grids. The memory
+   * used is then proportional to the number of occupied voxels of the grids,
+   * which is much smaller for mostly empty volumes, at the cost of a slower
+   * access to the values.
+   * It is disabled by default.
+   */
+  vtkSetMacro(SparseImageVolumes, bool);
+  vtkGetMacro(SparseImageVolumes, bool);
+  vtkBooleanMacro(SparseImageVolumes, bool);
+  ///@}
+
   ///@{
   /**
    * Standard interface to a vtkDataArraySelection object,
@@ -153,6 +169,7 @@ protected:
 
   bool MergeImageVolumes = false;
   bool MergePointSets = false;
+  bool SparseImageVolumes = false;
 
   bool DataCorrect = true;
 
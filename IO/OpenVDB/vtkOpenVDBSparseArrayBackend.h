@@ -0,0 +1,119 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenVDBSparseArrayBackend.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+/**
+ * @struct   vtkOpenVDBSparseArrayBackend
+ *
+ *     implicit array backend sampling an OpenVDB grid on access
+ *
+ * The backend shares the ownership of a grid and maps the point ids of an image
+ * of the given dimensions to the voxels of the grid, the same way the reader
+ * samples the grids into dense arrays: point (i, j, k) is the voxel
+ * (i, j, k) / downsamplingFactor + bboxMin. The memory used is the one of the
+ * VDB tree, i.e. proportional to the number of occupied voxels.
+ *
+ * The values are read from the tree without cached accessors, so that the
+ * array can be accessed concurrently.
+ *
+ * An example of usage in a vtkImplicitArray
+ * ```
+ * using BackendType = vtkOpenVDBSparseArrayBackend<openvdb::FloatGrid, float, 1>;
+ * vtkNew<vtkImplicitArray<BackendType>> array;
+ * array->ConstructBackend(grid, bboxMin, dimensions, downsamplingFactor);
+ * array->SetNumberOfComponents(1);
+ * array->SetNumberOfTuples(dimensions[0] * dimensions[1] * dimensions[2]);
+ * ```
+ */
+
+#ifndef vtkOpenVDBSparseArrayBackend_h
+#define vtkOpenVDBSparseArrayBackend_h
+
+#include "vtkSetGet.h" // for vtkNotUsed
+#include "vtkType.h"
+
+#include <openvdb/openvdb.h>
+
+#include <utility>
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename GridType, typename ValueType, int NComps>
+struct vtkOpenVDBSparseArrayBackend
+{
+  vtkOpenVDBSparseArrayBackend(typename GridType::ConstPtr grid, const int bboxMin[3],
+    const int dimensions[3], float downsamplingFactor)
+    : Grid(std::move(grid))
+    , DownsamplingFactor(downsamplingFactor)
+  {
+    for (int s = 0; s < 3; s++)
+    {
+      this->BBoxMin[s] = bboxMin[s];
+      this->Dimensions[s] = dimensions[s];
+    }
+  }
+
+  ValueType operator()(vtkIdType index) const
+  {
+    return this->mapComponent(index / NComps, static_cast<int>(index % NComps));
+  }
+
+  ValueType mapComponent(vtkIdType tupleIdx, int comp) const
+  {
+    return Component(this->Sample(tupleIdx), comp);
+  }
+
+  void mapTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    const typename GridType::ValueType value = this->Sample(tupleIdx);
+    for (int comp = 0; comp < NComps; comp++)
+    {
+      tuple[comp] = Component(value, comp);
+    }
+  }
+
+private:
+  typename GridType::ValueType Sample(vtkIdType tupleIdx) const
+  {
+    const vtkIdType sliceSize = static_cast<vtkIdType>(this->Dimensions[0]) * this->Dimensions[1];
+    const int k = static_cast<int>(tupleIdx / sliceSize);
+    const vtkIdType t = tupleIdx % sliceSize;
+    const int j = static_cast<int>(t / this->Dimensions[0]);
+    const int i = static_cast<int>(t % this->Dimensions[0]);
+    const openvdb::Coord ijk(static_cast<int>(i / this->DownsamplingFactor + this->BBoxMin[0]),
+      static_cast<int>(j / this->DownsamplingFactor + this->BBoxMin[1]),
+      static_cast<int>(k / this->DownsamplingFactor + this->BBoxMin[2]));
+    return this->Grid->tree().getValue(ijk);
+  }
+
+  template <typename T>
+  static ValueType Component(const T& value, int vtkNotUsed(comp))
+  {
+    return static_cast<ValueType>(value);
+  }
+
+  template <typename T>
+  static ValueType Component(const openvdb::math::Vec3<T>& value, int comp)
+  {
+    return static_cast<ValueType>(value[comp]);
+  }
+
+  typename GridType::ConstPtr Grid;
+  int BBoxMin[3];
+  int Dimensions[3];
+  float DownsamplingFactor;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkOpenVDBSparseArrayBackend_h
+// VTK-HeaderTest-Exclude: vtkOpenVDBSparseArrayBackend.h
@@ -26,6 +26,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkScalarsToColors.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -34,6 +36,7 @@
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <set>
 #include <sstream>
@@ -79,6 +82,132 @@ std::string MakeValidAttributeName(std::string& name)
   return output;
 }
 
+// Reads the values of a VTK array at the voxels of an image, as points or as cells.
+// Ghost voxels are reported as missing.
+struct VoxelReader
+{
+  vtkImageData* Image;
+  vtkDataArray* Data;
+  vtkUnsignedCharArray* Ghosts;
+  int Component;
+  bool Cells;
+
+  vtkIdType GetId(const openvdb::Coord& ijk) const
+  {
+    int vtkijk[3] = { ijk[0], ijk[1], ijk[2] };
+    return this->Cells ? this->Image->ComputeCellId(vtkijk) : this->Image->ComputePointId(vtkijk);
+  }
+
+  bool operator()(const openvdb::Coord& ijk, float& value) const
+  {
+    vtkIdType id = this->GetId(ijk);
+    if (this->Ghosts && this->Ghosts->GetValue(id) != 0)
+    {
+      return false;
+    }
+    value = this->Data->GetComponent(id, this->Component);
+    return true;
+  }
+
+  bool operator()(const openvdb::Coord& ijk, openvdb::Vec3f& value) const
+  {
+    vtkIdType id = this->GetId(ijk);
+    if (this->Ghosts && this->Ghosts->GetValue(id) != 0)
+    {
+      return false;
+    }
+    double tuple[3];
+    this->Data->GetTuple(id, tuple);
+    value = openvdb::Vec3f(tuple[0], tuple[1], tuple[2]);
+    return true;
+  }
+};
+
+bool IsBackground(float value, float background, double tolerance)
+{
+  return std::abs(value - background) <= tolerance;
+}
+
+bool IsBackground(const openvdb::Vec3f& value, const openvdb::Vec3f& background, double tolerance)
+{
+  return IsBackground(value[0], background[0], tolerance) &&
+    IsBackground(value[1], background[1], tolerance) &&
+    IsBackground(value[2], background[2], tolerance);
+}
+
+// Fills the voxels of the half-open range [xmin, xmax, ymin, ymax, zmin, zmax) of a grid
+// with the values given by a reader. Each thread fills its k slabs in its own tree, and
+// the trees are merged into the grid at the end.
+template <typename GridT, typename ReaderT>
+struct FillVDBGridFunctor
+{
+  using TreeT = typename GridT::TreeType;
+  using ValueT = typename GridT::ValueType;
+
+  GridT& Grid;
+  const int* Range;
+  const ReaderT& Reader;
+  bool SkipBackground;
+  double Tolerance;
+  vtkSMPThreadLocal<typename TreeT::Ptr> LocalTrees;
+
+  FillVDBGridFunctor(
+    GridT& grid, const int range[6], const ReaderT& reader, bool skipBackground, double tolerance)
+    : Grid(grid)
+    , Range(range)
+    , Reader(reader)
+    , SkipBackground(skipBackground)
+    , Tolerance(tolerance)
+  {
+  }
+
+  void Initialize() { this->LocalTrees.Local().reset(new TreeT(this->Grid.background())); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    typename GridT::Accessor accessor(*this->LocalTrees.Local());
+    const ValueT background = this->Grid.background();
+    ValueT value;
+    openvdb::Coord ijk;
+    for (vtkIdType k = begin; k < end; ++k)
+    {
+      for (int j = this->Range[2]; j < this->Range[3]; ++j)
+      {
+        for (int i = this->Range[0]; i < this->Range[1]; ++i)
+        {
+          ijk.reset(i, j, static_cast<int>(k));
+          if (this->Reader(ijk, value) &&
+            !(this->SkipBackground && ::IsBackground(value, background, this->Tolerance)))
+          {
+            accessor.setValue(ijk, value);
+          }
+        }
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for (auto& tree : this->LocalTrees)
+    {
+      this->Grid.tree().merge(*tree);
+    }
+  }
+};
+
+template <typename GridT, typename ReaderT>
+void FillVDBGrid(
+  GridT& grid, const int range[6], const ReaderT& reader, bool skipBackground, double tolerance)
+{
+  FillVDBGridFunctor<GridT, ReaderT> functor(grid, range, reader, skipBackground, tolerance);
+  vtkSMPTools::For(range[4], range[5], functor);
+  if (skipBackground)
+  {
+    // collapse the uniform regions into tiles
+    grid.pruneGrid();
+  }
+}
+
 void WriteVDBGrids(std::vector<openvdb::GridBase::Ptr>& grids,
   vtkMultiProcessController* controller, const char* fileName, bool writeAllTimeSteps,
   vtkIdType numberOfTimeSteps, vtkIdType currentTimeIndex)
@@ -372,6 +501,9 @@ vtkOpenVDBWriter::vtkOpenVDBWriter()
   this->LookupTable = nullptr;
   this->EnableColoring = false;
   this->EnableAlpha = false;
+  this->BackgroundValue = 0.;
+  this->SkipBackgroundVoxels = false;
+  this->BackgroundTolerance = 0.;
   this->Internals = new vtkOpenVDBWriterInternals(this);
 }
 
@@ -601,7 +733,12 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
     -wholeExtent[4] * dz + globalBounds.GetBound(4));
   pointsTransform->postTranslate(offsetPoints);
 
-  vtkBoundingBox boundingBox;
+  const float background = static_cast<float>(this->BackgroundValue);
+  // half-open voxel ranges of the points and of the cells
+  const int pointRange[6] = { pointExtent[0], pointExtent[1] + 1, pointExtent[2],
+    pointExtent[3] + 1, pointExtent[4], pointExtent[5] + 1 };
+  const int cellRange[6] = { extent[0], extent[1], extent[2], extent[3], extent[4], extent[5] };
+
   for (int array = 0; array < pointData->GetNumberOfArrays(); array++)
   {
     vtkDataArray* data = pointData->GetArray(array);
@@ -614,7 +751,8 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
         continue;
       }
       // Vec3SGrid is single precision and Vec3DGrid is for double precision
-      openvdb::Vec3SGrid::Ptr vecGrid = openvdb::Vec3SGrid::create();
+      openvdb::Vec3SGrid::Ptr vecGrid =
+        openvdb::Vec3SGrid::create(openvdb::Vec3f(background));
       // see
       // https://www.openvdb.org/documentation/doxygen/namespaceopenvdb_1_1v8__0.html#ae93f92d10730a52ed3b207d5811f6a6e
       if (strcmp(arrayName, "color"))
@@ -627,7 +765,7 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
       }
       vecGrid->setGridClass(openvdb::GRID_FOG_VOLUME);
 
-      openvdb::FloatGrid::Ptr grid = openvdb::FloatGrid::create();
+      openvdb::FloatGrid::Ptr grid = openvdb::FloatGrid::create(background);
       // enum GridClass {
       //     GRID_UNKNOWN = 0,
       //     GRID_LEVEL_SET,
@@ -638,45 +776,16 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
       std::string vdbName = GetVDBGridName(arrayName, component, numberOfComponents);
       grid->setName(vdbName);
       vecGrid->setName(vdbName);
-      openvdb::FloatGrid::Accessor accessor = grid->getAccessor();
-      openvdb::Vec3SGrid::Accessor vecAccessor = vecGrid->getAccessor();
-      openvdb::Coord ijk;
-
-      int &i = ijk[0], &j = ijk[1], &k = ijk[2];
-      int vtkijk[3];
-      for (k = pointExtent[4]; k <= pointExtent[5]; ++k)
+      const ::VoxelReader reader{ imageData, data, pointGhostType, component, false };
+      if (numberOfComponents == 3)
       {
-        vtkijk[2] = k;
-        for (j = pointExtent[2]; j <= pointExtent[3]; ++j)
-        {
-          vtkijk[1] = j;
-          for (i = pointExtent[0]; i <= pointExtent[1]; ++i)
-          {
-            vtkijk[0] = i;
-            vtkIdType pointId = imageData->ComputePointId(vtkijk);
-            if (needToUpdateBounds && pointGhostType && pointGhostType->GetTuple1(pointId) == 0)
-            {
-              double coords[3];
-              imageData->GetPoint(pointId, coords);
-              boundingBox.AddPoint(coords);
-            }
-
-            if (!pointGhostType || pointGhostType->GetTuple1(pointId) == 0)
-            {
-              if (numberOfComponents == 3)
-              {
-                double tuple[3];
-                data->GetTuple(pointId, tuple);
-                openvdb::Vec3f ftuple(tuple[0], tuple[1], tuple[2]);
-                vecAccessor.setValue(ijk, ftuple);
-              }
-              else
-              {
-                accessor.setValue(ijk, data->GetComponent(pointId, component));
-              }
-            }
-          }
-        }
+        ::FillVDBGrid(*vecGrid, pointRange, reader, this->SkipBackgroundVoxels,
+          this->BackgroundTolerance);
+      }
+      else
+      {
+        ::FillVDBGrid(
+          *grid, pointRange, reader, this->SkipBackgroundVoxels, this->BackgroundTolerance);
       }
 
       grid->setTransform(pointsTransform);
@@ -702,6 +811,30 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
     -wholeExtent[4] * dz + dz / 2 + globalBounds.GetBound(4));
   cellsTransform->postTranslate(offsetCells);
 
+  if (needToUpdateBounds && cellGhostType && cellData->GetNumberOfArrays() > 0)
+  {
+    for (int k = extent[4]; k < extent[5]; ++k)
+    {
+      for (int j = extent[2]; j < extent[3]; ++j)
+      {
+        for (int i = extent[0]; i < extent[1]; ++i)
+        {
+          int vtkijk[3] = { i, j, k };
+          if (cellGhostType->GetValue(imageData->ComputeCellId(vtkijk)) == 0)
+          {
+            double coords[3];
+            imageData->GetPoint(imageData->ComputePointId(vtkijk), coords);
+            for (int c = 0; c < 3; c++)
+            {
+              coords[c] += halfCellSize[c];
+            }
+            bounds.AddPoint(coords);
+          }
+        }
+      }
+    }
+  }
+
   for (int array = 0; array < cellData->GetNumberOfArrays(); array++)
   {
     vtkDataArray* data = cellData->GetArray(array);
@@ -714,7 +847,8 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
         continue;
       }
       // Vec3SGrid is single precision and Vec3DGrid is for double precision
-      openvdb::Vec3SGrid::Ptr vecGrid = openvdb::Vec3SGrid::create();
+      openvdb::Vec3SGrid::Ptr vecGrid =
+        openvdb::Vec3SGrid::create(openvdb::Vec3f(background));
       // see
       // https://www.openvdb.org/documentation/doxygen/namespaceopenvdb_1_1v8__0.html#ae93f92d10730a52ed3b207d5811f6a6e
       if (strcmp(arrayName, "color"))
@@ -727,7 +861,7 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
       }
       vecGrid->setGridClass(openvdb::GRID_FOG_VOLUME);
 
-      openvdb::FloatGrid::Ptr grid = openvdb::FloatGrid::create();
+      openvdb::FloatGrid::Ptr grid = openvdb::FloatGrid::create(background);
       // enum GridClass {
       //     GRID_UNKNOWN = 0,
       //     GRID_LEVEL_SET,
@@ -738,46 +872,16 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
       std::string vdbName = GetVDBGridName(arrayName, component, numberOfComponents);
       grid->setName(vdbName);
       vecGrid->setName(vdbName);
-      openvdb::FloatGrid::Accessor accessor = grid->getAccessor();
-      openvdb::Vec3SGrid::Accessor vecAccessor = vecGrid->getAccessor();
-      openvdb::Coord ijk;
-
-      int &i = ijk[0], &j = ijk[1], &k = ijk[2];
-      for (k = extent[4]; k < extent[5]; ++k)
+      const ::VoxelReader reader{ imageData, data, cellGhostType, component, true };
+      if (numberOfComponents == 3)
       {
-        for (j = extent[2]; j < extent[3]; ++j)
-        {
-          for (i = extent[0]; i < extent[1]; ++i)
-          {
-            int vtkijk[3] = { i, j, k };
-            vtkIdType cellId = imageData->ComputeCellId(vtkijk);
-            if (needToUpdateBounds && cellGhostType && cellGhostType->GetTuple1(cellId) == 0)
-            {
-              double coords[3];
-              vtkIdType pointId = imageData->ComputePointId(vtkijk);
-              imageData->GetPoint(pointId, coords);
-              for (int c = 0; c < 3; c++)
-              {
-                coords[c] += halfCellSize[c];
-              }
-              bounds.AddPoint(coords);
-            }
-            if (!cellGhostType || cellGhostType->GetTuple1(cellId) == 0)
-            {
-              if (numberOfComponents == 3)
-              {
-                double tuple[3];
-                data->GetTuple(cellId, tuple);
-                openvdb::Vec3f ftuple(tuple[0], tuple[1], tuple[2]);
-                vecAccessor.setValue(ijk, ftuple);
-              }
-              else
-              {
-                accessor.setValue(ijk, data->GetComponent(cellId, component));
-              }
-            }
-          }
-        }
+        ::FillVDBGrid(
+          *vecGrid, cellRange, reader, this->SkipBackgroundVoxels, this->BackgroundTolerance);
+      }
+      else
+      {
+        ::FillVDBGrid(
+          *grid, cellRange, reader, this->SkipBackgroundVoxels, this->BackgroundTolerance);
       }
 
       grid->setTransform(cellsTransform);
@@ -797,7 +901,7 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
   // if no point data or no cell data then we just add in a value of 1 for the voxels for the cells
   if (grids.empty())
   {
-    openvdb::FloatGrid::Ptr grid = openvdb::FloatGrid::create();
+    openvdb::FloatGrid::Ptr grid = openvdb::FloatGrid::create(background);
     // enum GridClass {
     //     GRID_UNKNOWN = 0,
     //     GRID_LEVEL_SET,
@@ -806,22 +910,14 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
     // };
     grid->setGridClass(openvdb::GRID_FOG_VOLUME);
     grid->setName("empty");
-    openvdb::FloatGrid::Accessor accessor = grid->getAccessor();
-    openvdb::Coord ijk;
-
-    int &i = ijk[0], &j = ijk[1], &k = ijk[2];
     // if we're here we don't have any ghost info since it would be stored in point or cell data
-    for (k = extent[4]; k < extent[5]; ++k)
-    {
-      for (j = extent[2]; j < extent[3]; ++j)
-      {
-        for (i = extent[0]; i < extent[1]; ++i)
-        {
-          accessor.setValue(ijk, 1.);
-        }
-      }
-      grid->setTransform(cellsTransform);
-    }
+    auto reader = [](const openvdb::Coord&, float& value) {
+      value = 1.f;
+      return true;
+    };
+    ::FillVDBGrid(
+      *grid, cellRange, reader, this->SkipBackgroundVoxels, this->BackgroundTolerance);
+    grid->setTransform(cellsTransform);
     grids.push_back(grid);
   }
 
@@ -958,5 +1054,8 @@ void vtkOpenVDBWriter::PrintSelf(ostream& os, vtkIndent indent)
   }
   os << indent << "EnableColoring: " << this->EnableColoring << endl;
   os << indent << "EnableAlpha: " << this->EnableAlpha << endl;
+  os << indent << "BackgroundValue: " << this->BackgroundValue << endl;
+  os << indent << "SkipBackgroundVoxels: " << this->SkipBackgroundVoxels << endl;
+  os << indent << "BackgroundTolerance: " << this->BackgroundTolerance << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -16,6 +16,11 @@
  * @class   vtkOpenVDBWriter
  * @brief   OpenVDB writer for vtkImageData or vtkPointSet
  * Writes a vtkImageData or vtkPointSet as a VDB file.
+ *
+ * The voxels of an image are converted concurrently, by slabs of k. When
+ * SkipBackgroundVoxels is enabled, the voxels whose values are within
+ * BackgroundTolerance of BackgroundValue are left inactive, so that the VDB
+ * grids only store the occupied part of mostly empty volumes.
  */
 
 #ifndef vtkOpenVDBWriter_h
@@ -95,6 +100,36 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the background value of the image grids, i.e. the value of their
+   * inactive voxels. Default is 0.
+   */
+  vtkSetMacro(BackgroundValue, double);
+  vtkGetMacro(BackgroundValue, double);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set whether the image voxels whose values are within BackgroundTolerance
+   * of BackgroundValue are left out of the grids. For vectors, every component
+   * must be within the tolerance. The constant regions of the resulting grids
+   * are also collapsed into tiles. Default is false: every voxel is written.
+   */
+  vtkSetMacro(SkipBackgroundVoxels, bool);
+  vtkGetMacro(SkipBackgroundVoxels, bool);
+  vtkBooleanMacro(SkipBackgroundVoxels, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the tolerance used to compare the voxel values with BackgroundValue
+   * when SkipBackgroundVoxels is enabled. Default is 0.
+   */
+  vtkSetClampMacro(BackgroundTolerance, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(BackgroundTolerance, double);
+  ///@}
+
 protected:
   vtkOpenVDBWriter();
   ~vtkOpenVDBWriter() override;
@@ -134,6 +169,10 @@ protected:
   bool EnableAlpha;
   ///@}
 
+  double BackgroundValue;
+  bool SkipBackgroundVoxels;
+  double BackgroundTolerance;
+
 private:
   vtkOpenVDBWriter(const vtkOpenVDBWriter&) = delete;
   void operator=(const vtkOpenVDBWriter&) = delete;
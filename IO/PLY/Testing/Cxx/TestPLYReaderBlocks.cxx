@@ -0,0 +1,144 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPLYReaderBlocks.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// .NAME Test of vtkPLYReader on large files
+// .SECTION Description
+// Tests that vertices read by blocks from ascii and binary files of both byte
+// orders keep their values, including across the block boundaries.
+
+#include "vtkCellArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPLYReader.h"
+#include "vtkPLYWriter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        std::cerr << "Tuple " << i << " differs" << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestPLYReaderBlocks(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    std::cerr << "Could not determine temporary directory." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string filename = std::string(tempDir) + "/TestPLYReaderBlocks.ply";
+  delete[] tempDir;
+
+  // enough vertices to need several blocks
+  const vtkIdType numPts = 150000;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkFloatArray> normals;
+  normals->SetNumberOfComponents(3);
+  normals->SetNumberOfTuples(numPts);
+  vtkNew<vtkUnsignedCharArray> colors;
+  colors->SetName("Colors");
+  colors->SetNumberOfComponents(3);
+  colors->SetNumberOfTuples(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    points->SetPoint(i, std::sin(0.001 * i) * 1e5, -1.0 / (i + 1), i * 0.125);
+    normals->SetTuple3(i, std::cos(0.01 * i), std::sin(0.01 * i), 0.0);
+    colors->SetTuple3(i, i % 256, (i / 256) % 256, 255 - i % 256);
+  }
+  vtkNew<vtkCellArray> polys;
+  for (vtkIdType i = 0; i + 2 < numPts; i += 3)
+  {
+    const vtkIdType triangle[3] = { i, i + 1, i + 2 };
+    polys->InsertNextCell(3, triangle);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->SetPolys(polys);
+  input->GetPointData()->SetNormals(normals);
+  input->GetPointData()->SetScalars(colors);
+
+  int options[3][2] = { { VTK_ASCII, 0 }, { VTK_BINARY, VTK_BIG_ENDIAN },
+    { VTK_BINARY, VTK_LITTLE_ENDIAN } };
+  for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); ++i)
+  {
+    vtkNew<vtkPLYWriter> writer;
+    writer->SetFileName(filename.c_str());
+    writer->SetFileType(options[i][0]);
+    writer->SetDataByteOrder(options[i][1]);
+    writer->SetArrayName("Colors");
+    writer->SetInputData(input);
+    writer->Write();
+
+    vtkNew<vtkPLYReader> reader;
+    reader->SetFileName(filename.c_str());
+    reader->Update();
+    vtkPolyData* output = reader->GetOutput();
+
+    if (!SameArrays(input->GetPoints()->GetData(), output->GetPoints()->GetData()) ||
+      !SameArrays(normals, output->GetPointData()->GetNormals()) ||
+      !SameArrays(colors, output->GetPointData()->GetScalars()))
+    {
+      std::cerr << "Different vertices for option " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // the faces follow the vertices and must be read from the right place
+    if (output->GetNumberOfPolys() != polys->GetNumberOfCells())
+    {
+      std::cerr << "Different number of faces for option " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+    vtkNew<vtkIdList> cell;
+    const vtkIdType lastCell = polys->GetNumberOfCells() - 1;
+    output->GetCellPoints(lastCell, cell);
+    if (cell->GetNumberOfIds() != 3 || cell->GetId(0) != 3 * lastCell)
+    {
+      std::cerr << "Wrong last face for option " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
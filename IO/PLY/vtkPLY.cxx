@@ -48,11 +48,16 @@ WARRANTY OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE.
 
 #include "vtkPLY.h"
 #include "vtkByteSwap.h"
+#include "vtkEndian.h"
 #include "vtkHeap.h"
 #include "vtkMath.h"
+#include "vtkSMPTools.h"
+#include "vtkValueFromString.h"
 #include <vtksys/FStream.hxx>
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -93,7 +98,7 @@ void* plyAllocateMemory(size_t n)
 const char* type_names[] = { "invalid", "char", "short", "int", "int8", "int16", "int32", "uchar",
   "ushort", "uint", "uint8", "uint16", "uint32", "float", "float32", "double", "float64" };
 
-const int ply_type_size[] = { 0, 1, 2, 4, 1, 2, 4, 1, 2, 4, 1, 2, 4, 4, 4, 8 };
+const int ply_type_size[] = { 0, 1, 2, 4, 1, 2, 4, 1, 2, 4, 1, 2, 4, 4, 4, 8, 8 };
 }
 
 #define NO_OTHER_PROPS (-1)
@@ -1023,6 +1028,348 @@ void vtkPLY::ply_get_element(PlyFile* plyfile, void* elem_ptr)
     binary_get_element(plyfile, (char*)elem_ptr);
 }
 
+namespace
+{
+/* number of elements decoded at once by ply_get_elements() */
+const int ELEMENT_BLOCK_SIZE = 65536;
+/* number of bytes read at once from an ascii file by ply_get_elements() */
+const std::size_t ASCII_BLOCK_SIZE = 1 << 22;
+
+/* can the elements be decoded independently from each other? */
+bool has_fixed_size(const PlyElement* elem)
+{
+  if (elem->other_offset != NO_OTHER_PROPS)
+    return false;
+  for (int j = 0; j < elem->nprops; j++)
+    if (elem->props[j]->is_list)
+      return false;
+  return true;
+}
+
+/* the name of a type that has several ones */
+int canonical_type(int type)
+{
+  switch (type)
+  {
+    case PLY_CHAR:
+      return PLY_INT8;
+    case PLY_UCHAR:
+      return PLY_UINT8;
+    case PLY_SHORT:
+      return PLY_INT16;
+    case PLY_USHORT:
+      return PLY_UINT16;
+    case PLY_INT:
+      return PLY_INT32;
+    case PLY_UINT:
+      return PLY_UINT32;
+    case PLY_FLOAT:
+      return PLY_FLOAT32;
+    case PLY_DOUBLE:
+      return PLY_FLOAT64;
+    default:
+      return type;
+  }
+}
+
+/* do the binary items of the file have to be byte swapped? */
+bool swap_bytes(const PlyFile* plyfile)
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  return plyfile->file_type == PLY_BINARY_LE;
+#else
+  return plyfile->file_type == PLY_BINARY_BE;
+#endif
+}
+
+template <typename T>
+T read_binary_value(const char* data, bool swap)
+{
+  T value;
+  char* bytes = reinterpret_cast<char*>(&value);
+  memcpy(bytes, data, sizeof(T));
+  if (swap)
+    std::reverse(bytes, bytes + sizeof(T));
+  return value;
+}
+
+template <typename T>
+void set_integer_item(T value, int* int_val, unsigned int* uint_val, double* double_val)
+{
+  *int_val = static_cast<int>(value);
+  *uint_val = static_cast<unsigned int>(value);
+  *double_val = static_cast<double>(value);
+}
+
+/* extract the value of a binary item of the given type stored at data */
+void decode_binary_item(
+  const char* data, int type, bool swap, int* int_val, unsigned int* uint_val, double* double_val)
+{
+  switch (type)
+  {
+    // Here values can always fit in int, unsigned int, and double.
+    case PLY_CHAR:
+    case PLY_INT8:
+      set_integer_item(read_binary_value<vtkTypeInt8>(data, swap), int_val, uint_val, double_val);
+      break;
+    case PLY_UCHAR:
+    case PLY_UINT8:
+      set_integer_item(read_binary_value<vtkTypeUInt8>(data, swap), int_val, uint_val, double_val);
+      break;
+    case PLY_SHORT:
+    case PLY_INT16:
+      set_integer_item(read_binary_value<vtkTypeInt16>(data, swap), int_val, uint_val, double_val);
+      break;
+    case PLY_USHORT:
+    case PLY_UINT16:
+      set_integer_item(read_binary_value<vtkTypeUInt16>(data, swap), int_val, uint_val, double_val);
+      break;
+    case PLY_INT:
+    case PLY_INT32:
+      set_integer_item(read_binary_value<vtkTypeInt32>(data, swap), int_val, uint_val, double_val);
+      break;
+    case PLY_UINT:
+    case PLY_UINT32:
+      set_integer_item(read_binary_value<vtkTypeUInt32>(data, swap), int_val, uint_val, double_val);
+      break;
+    case PLY_FLOAT:
+    case PLY_FLOAT32:
+    {
+      vtkTypeFloat32 value = read_binary_value<vtkTypeFloat32>(data, swap);
+      // INT32_MIN (-2^31) is a power of 2 and thus exactly representable as float.
+      // INT32_MAX (2^31 - 1) is not exactly representable as float; closest smaller integer is 2^31
+      // - 128. UINT32_MAX (2^32 - 1) is not exactly representable as float; closest smaller integer
+      // is 2^32 - 256.
+      *int_val = static_cast<int>(vtkMath::ClampValue(value, (float)VTK_INT_MIN, 2147483520.0f));
+      *uint_val = static_cast<unsigned int>(vtkMath::ClampValue(value, 0.0f, 4294967040.0f));
+      *double_val = static_cast<double>(value);
+    }
+    break;
+    case PLY_DOUBLE:
+    case PLY_FLOAT64:
+    {
+      vtkTypeFloat64 value = read_binary_value<vtkTypeFloat64>(data, swap);
+      // Here we can just clamp and cast, all int32s can be exactly represented as doubles.
+      *int_val =
+        static_cast<int>(vtkMath::ClampValue(value, (double)VTK_INT_MIN, (double)VTK_INT_MAX));
+      *uint_val =
+        static_cast<unsigned int>(vtkMath::ClampValue(value, 0.0, (double)VTK_UNSIGNED_INT_MAX));
+      *double_val = value;
+    }
+    break;
+    default:
+      fprintf(stderr, "decode_binary_item: bad type = %d\n", type);
+      assert(0);
+  }
+}
+
+/* is c a separator between the words of an ascii line? */
+bool is_blank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/* split a null terminated line into words and store its properties */
+bool ascii_decode_element(const PlyElement* elem, char* line, char* elem_data)
+{
+  char* ptr = line;
+  for (int j = 0; j < elem->nprops; j++)
+  {
+    while (is_blank(*ptr))
+      ptr++;
+    if (*ptr == '\0')
+      return false;
+    char* word = ptr;
+    while (*ptr != '\0' && !is_blank(*ptr))
+      ptr++;
+    if (*ptr != '\0')
+      *ptr++ = '\0';
+
+    const PlyProperty* prop = elem->props[j];
+    int int_val;
+    unsigned int uint_val;
+    double double_val;
+    vtkPLY::get_ascii_item(word, prop->external_type, &int_val, &uint_val, &double_val);
+    if (elem->store_prop[j])
+      vtkPLY::store_item(
+        elem_data + prop->offset, prop->internal_type, int_val, uint_val, double_val);
+  }
+  return true;
+}
+
+/* read fixed size elements from a binary file by blocks */
+bool binary_get_elements(PlyFile* plyfile, char* elem_ptr, int elem_size, int num_elems)
+{
+  const PlyElement* elem = plyfile->which_elem;
+  const bool swap = swap_bytes(plyfile);
+
+  /* location of the properties in an element of the file */
+  std::vector<int> offsets(elem->nprops);
+  int record_size = 0;
+  for (int j = 0; j < elem->nprops; j++)
+  {
+    offsets[j] = record_size;
+    record_size += ply_type_size[elem->props[j]->external_type];
+  }
+
+  std::vector<char> buffer(
+    static_cast<std::size_t>(record_size) * std::min(num_elems, ELEMENT_BLOCK_SIZE));
+  for (int first = 0; first < num_elems; first += ELEMENT_BLOCK_SIZE)
+  {
+    const int count = std::min(ELEMENT_BLOCK_SIZE, num_elems - first);
+    plyfile->is->read(buffer.data(), static_cast<std::streamsize>(record_size) * count);
+    if (!plyfile->is->good())
+    {
+      vtkGenericWarningMacro("PLY error reading file."
+        << " Premature EOF while reading element " << elem->name << ".");
+      return false;
+    }
+
+    char* block_ptr = elem_ptr + static_cast<std::size_t>(first) * elem_size;
+    vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        const char* record = buffer.data() + i * record_size;
+        char* elem_data = block_ptr + i * elem_size;
+        for (int j = 0; j < elem->nprops; j++)
+        {
+          if (!elem->store_prop[j])
+            continue;
+          const PlyProperty* prop = elem->props[j];
+          if (!swap && canonical_type(prop->external_type) == canonical_type(prop->internal_type))
+          {
+            /* the file already holds the value the user wants */
+            memcpy(
+              elem_data + prop->offset, record + offsets[j], ply_type_size[prop->internal_type]);
+          }
+          else
+          {
+            int int_val;
+            unsigned int uint_val;
+            double double_val;
+            decode_binary_item(
+              record + offsets[j], prop->external_type, swap, &int_val, &uint_val, &double_val);
+            vtkPLY::store_item(
+              elem_data + prop->offset, prop->internal_type, int_val, uint_val, double_val);
+          }
+        }
+      }
+    });
+  }
+  return true;
+}
+
+/* read fixed size elements from an ascii file by blocks of lines */
+bool ascii_get_elements(PlyFile* plyfile, char* elem_ptr, int elem_size, int num_elems)
+{
+  const PlyElement* elem = plyfile->which_elem;
+  std::istream* is = plyfile->is;
+  std::vector<char> buffer;
+  std::vector<char*> lines;
+  std::size_t used = 0; /* bytes of the buffer holding data */
+  int first = 0;
+
+  while (first < num_elems)
+  {
+    /* read the next block after the partial line left by the previous one */
+    buffer.resize(used + ASCII_BLOCK_SIZE + 1);
+    is->read(buffer.data() + used, ASCII_BLOCK_SIZE);
+    used += static_cast<std::size_t>(is->gcount());
+    const bool at_end = !is->good();
+
+    /* split the block at the line feeds */
+    lines.clear();
+    char* start = buffer.data();
+    char* const data_end = buffer.data() + used;
+    while (first + static_cast<int>(lines.size()) < num_elems && start < data_end)
+    {
+      char* line_end = static_cast<char*>(memchr(start, '\n', data_end - start));
+      if (line_end == nullptr)
+      {
+        if (!at_end)
+          break;
+        /* the last line of the file has no line feed */
+        line_end = data_end;
+      }
+      *line_end = '\0';
+      lines.push_back(start);
+      start = line_end + 1;
+    }
+    if (lines.empty() && at_end)
+    {
+      vtkGenericWarningMacro("PLY error reading file."
+        << " Premature EOF while reading element " << elem->name << ".");
+      return false;
+    }
+
+    std::atomic<bool> complete(true);
+    char* block_ptr = elem_ptr + static_cast<std::size_t>(first) * elem_size;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(lines.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        if (!ascii_decode_element(elem, lines[i], block_ptr + i * elem_size))
+          complete = false;
+      }
+    });
+    if (!complete)
+    {
+      vtkGenericWarningMacro("PLY error reading file."
+        << " Missing properties in element " << elem->name << ".");
+      return false;
+    }
+    first += static_cast<int>(lines.size());
+
+    /* keep the rest of the block for the next one */
+    used = start < data_end ? static_cast<std::size_t>(data_end - start) : 0;
+    memmove(buffer.data(), start, used);
+  }
+
+  /* give back what was read past the last element */
+  is->clear();
+  if (used > 0)
+    is->seekg(-static_cast<std::streamoff>(used), std::ios::cur);
+  return true;
+}
+}
+
+/******************************************************************************
+Read several elements of the type specified in the last call to the routine
+ply_get_element_setup() or ply_get_property(). Elements without list or other
+properties are read by large blocks that are decoded in parallel, the others
+are read one at a time as ply_get_element() does.
+
+Entry:
+  plyfile   - file identifier
+  elem_ptr  - pointer to the location of the first element
+  elem_size - distance in bytes between two elements in elem_ptr
+  num_elems - number of elements to read
+
+Exit:
+  returns false if the elements could not be read
+******************************************************************************/
+
+bool vtkPLY::ply_get_elements(PlyFile* plyfile, void* elem_ptr, int elem_size, int num_elems)
+{
+  char* elem_data = static_cast<char*>(elem_ptr);
+  if (num_elems <= 0)
+    return true;
+  if (has_fixed_size(plyfile->which_elem))
+  {
+    return plyfile->file_type == PLY_ASCII
+      ? ascii_get_elements(plyfile, elem_data, elem_size, num_elems)
+      : binary_get_elements(plyfile, elem_data, elem_size, num_elems);
+  }
+
+  for (int i = 0; i < num_elems; i++, elem_data += elem_size)
+  {
+    bool read = plyfile->file_type == PLY_ASCII ? ascii_get_element(plyfile, elem_data)
+                                                : binary_get_element(plyfile, elem_data);
+    if (!read)
+      return false;
+  }
+  return true;
+}
+
 /******************************************************************************
 Extract the comments from the header information of a PLY file.
 
@@ -2290,174 +2637,22 @@ Exit:
 bool vtkPLY::get_binary_item(
   PlyFile* plyfile, int type, int* int_val, unsigned int* uint_val, double* double_val)
 {
-  switch (type)
+  if (type <= PLY_START_TYPE || type >= PLY_END_TYPE)
   {
-    case PLY_CHAR:
-    case PLY_INT8:
-    {
-      vtkTypeInt8 value = 0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading char.");
-        return false;
-      }
-
-      // Here value can always fit in int, unsigned int, and double.
-      *int_val = static_cast<int>(value);
-      *uint_val = static_cast<unsigned int>(value);
-      *double_val = static_cast<double>(value);
-    }
-    break;
-    case PLY_UCHAR:
-    case PLY_UINT8:
-    {
-      vtkTypeUInt8 value = 0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading uchar or uint8.");
-        return false;
-      }
-
-      // Here value can always fit in int, unsigned int, and double.
-      *int_val = static_cast<int>(value);
-      *uint_val = static_cast<unsigned int>(value);
-      *double_val = static_cast<double>(value);
-    }
-    break;
-    case PLY_SHORT:
-    case PLY_INT16:
-    {
-      vtkTypeInt16 value = 0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading short.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap2BE(&value)
-                                          : vtkByteSwap::Swap2LE(&value);
-
-      // Here value can always fit in int, unsigned int, and double.
-      *int_val = static_cast<int>(value);
-      *uint_val = static_cast<unsigned int>(value);
-      *double_val = static_cast<double>(value);
-    }
-    break;
-    case PLY_USHORT:
-    case PLY_UINT16:
-    {
-      vtkTypeUInt16 value = 0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading ushort.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap2BE(&value)
-                                          : vtkByteSwap::Swap2LE(&value);
-
-      // Here value can always fit in int, unsigned int, and double.
-      *int_val = static_cast<int>(value);
-      *uint_val = static_cast<unsigned int>(value);
-      *double_val = static_cast<double>(value);
-    }
-    break;
-    case PLY_INT:
-    case PLY_INT32:
-    {
-      vtkTypeInt32 value = 0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading int or int32.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value)
-                                          : vtkByteSwap::Swap4LE(&value);
-
-      // Here value can always fit in int, unsigned int, and double.
-      *int_val = static_cast<int>(value);
-      *uint_val = static_cast<unsigned int>(value);
-      *double_val = static_cast<double>(value);
-    }
-    break;
-    case PLY_UINT:
-    case PLY_UINT32:
-    {
-      vtkTypeUInt32 value = 0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading uint");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value)
-                                          : vtkByteSwap::Swap4LE(&value);
-
-      // Here value can always fit in int, unsigned int, and double.
-      *int_val = static_cast<int>(value);
-      *uint_val = static_cast<unsigned int>(value);
-      *double_val = static_cast<double>(value);
-    }
-    break;
-    case PLY_FLOAT:
-    case PLY_FLOAT32:
-    {
-      vtkTypeFloat32 value = 0.0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading float of float32.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value)
-                                          : vtkByteSwap::Swap4LE(&value);
-
-      // INT32_MIN (-2^31) is a power of 2 and thus exactly representable as float.
-      // INT32_MAX (2^31 - 1) is not exactly representable as float; closest smaller integer is 2^31
-      // - 128. UINT32_MAX (2^32 - 1) is not exactly representable as float; closest smaller integer
-      // is 2^32 - 256.
-      *int_val = static_cast<int>(vtkMath::ClampValue(value, (float)VTK_INT_MIN, 2147483520.0f));
-      *uint_val = static_cast<unsigned int>(vtkMath::ClampValue(value, 0.0f, 4294967040.0f));
-      *double_val = static_cast<double>(value);
-    }
-    break;
-    case PLY_DOUBLE:
-    case PLY_FLOAT64:
-    {
-      vtkTypeFloat64 value = 0.0;
-      plyfile->is->read(reinterpret_cast<char*>(&value), sizeof(value));
-      if (!plyfile->is->good())
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading double.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap8BE(&value)
-                                          : vtkByteSwap::Swap8LE(&value);
+    fprintf(stderr, "get_binary_item: bad type = %d\n", type);
+    assert(0);
+    return false;
+  }
 
-      // Here we can just clamp and cast, all int32s can be exactly represented as doubles.
-      *int_val =
-        static_cast<int>(vtkMath::ClampValue(value, (double)VTK_INT_MIN, (double)VTK_INT_MAX));
-      *uint_val =
-        static_cast<unsigned int>(vtkMath::ClampValue(value, 0.0, (double)VTK_UNSIGNED_INT_MAX));
-      *double_val = value;
-    }
-    break;
-    default:
-      fprintf(stderr, "get_binary_item: bad type = %d\n", type);
-      assert(0);
-      return false;
+  char data[8];
+  plyfile->is->read(data, ply_type_size[type]);
+  if (!plyfile->is->good())
+  {
+    vtkGenericWarningMacro("PLY error reading file."
+      << " Premature EOF while reading " << type_names[type] << ".");
+    return false;
   }
+  decode_binary_item(data, type, swap_bytes(plyfile), int_val, uint_val, double_val);
   return true;
 }
 
@@ -2479,6 +2674,7 @@ VTK_NO_UBSAN
 void vtkPLY::get_ascii_item(
   const char* word, int type, int* int_val, unsigned int* uint_val, double* double_val)
 {
+  const char* word_end = word + strlen(word);
   switch (type)
   {
     case PLY_CHAR:
@@ -2491,26 +2687,39 @@ void vtkPLY::get_ascii_item(
     case PLY_UINT16:
     case PLY_INT:
     case PLY_INT32:
-      *int_val = atoi(word);
+    {
+      int value = 0;
+      vtkValueFromString(word, word_end, value);
+      *int_val = value;
       *uint_val = *int_val;
       *double_val = *int_val;
       break;
+    }
 
     case PLY_UINT:
     case PLY_UINT32:
-      *uint_val = strtoul(word, nullptr, 10);
+    {
+      // negative values wrap around as they do with strtoul
+      long long value = 0;
+      vtkValueFromString(word, word_end, value);
+      *uint_val = static_cast<unsigned int>(value);
       *int_val = *uint_val;
       *double_val = *uint_val;
       break;
+    }
 
     case PLY_FLOAT:
     case PLY_FLOAT32:
     case PLY_DOUBLE:
     case PLY_FLOAT64:
-      *double_val = atof(word);
+    {
+      double value = 0.0;
+      vtkValueFromString(word, word_end, value);
+      *double_val = value;
       *int_val = (int)*double_val;
       *uint_val = (unsigned int)*double_val;
       break;
+    }
 
     default:
       fprintf(stderr, "get_ascii_item: bad type = %d\n", type);
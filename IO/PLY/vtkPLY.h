@@ -195,6 +195,7 @@ public:
   static void ply_get_property(PlyFile*, const char*, PlyProperty*);
   static PlyOtherProp* ply_get_other_properties(PlyFile*, const char*, int);
   static void ply_get_element(PlyFile*, void*);
+  static bool ply_get_elements(PlyFile*, void*, int, int);
   static char** ply_get_comments(PlyFile*, int*);
   static char** ply_get_obj_info(PlyFile*, int*);
   static void ply_close(PlyFile*);
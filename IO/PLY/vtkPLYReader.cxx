@@ -29,6 +29,7 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkUnsignedCharArray.h"
@@ -396,30 +397,47 @@ int vtkPLYReader::RequestData(vtkInformation* vtkNotUsed(request),
         rgbPoints->SetNumberOfTuples(numPts);
       }
 
-      plyVertex vertex;
-      for (int j = 0; j < numPts; j++)
+      // Read the vertices by blocks, which are decoded in parallel, then
+      // scatter them into the output arrays.
+      const int blockSize = 65536;
+      std::vector<plyVertex> vertices(std::min(numPts, blockSize));
+      float* ptsData = vtkFloatArray::FastDownCast(pts->GetData())->GetPointer(0);
+      float* tcoordsData = texCoordsPointsAvailable ? texCoordsPoints->GetPointer(0) : nullptr;
+      float* normalsData = normalPointsAvailable ? normals->GetPointer(0) : nullptr;
+      unsigned char* rgbData = rgbPointsAvailable ? rgbPoints->GetPointer(0) : nullptr;
+      const int numColorComps = rgbPointsHaveAlpha ? 4 : 3;
+      for (int first = 0; first < numPts; first += blockSize)
       {
-        vtkPLY::ply_get_element(ply, (void*)&vertex);
-        pts->SetPoint(j, vertex.x);
-        if (texCoordsPointsAvailable)
+        const int count = std::min(blockSize, numPts - first);
+        if (!vtkPLY::ply_get_elements(ply, vertices.data(), sizeof(plyVertex), count))
         {
-          texCoordsPoints->SetTuple2(j, vertex.tex[0], vertex.tex[1]);
+          vtkErrorMacro(<< "Cannot read the vertices");
+          pts->Delete();
+          vtkPLY::ply_close(ply);
+          return 0;
         }
-        if (normalPointsAvailable)
-        {
-          normals->SetTuple3(j, vertex.normal[0], vertex.normal[1], vertex.normal[2]);
-        }
-        if (rgbPointsAvailable)
-        {
-          if (rgbPointsHaveAlpha)
+        vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType j = begin; j < end; j++)
           {
-            rgbPoints->SetTuple4(j, vertex.red, vertex.green, vertex.blue, vertex.alpha);
-          }
-          else
-          {
-            rgbPoints->SetTuple3(j, vertex.red, vertex.green, vertex.blue);
+            const plyVertex& vertex = vertices[j];
+            const vtkIdType ptId = first + j;
+            std::copy(vertex.x, vertex.x + 3, ptsData + 3 * ptId);
+            if (tcoordsData)
+            {
+              std::copy(vertex.tex, vertex.tex + 2, tcoordsData + 2 * ptId);
+            }
+            if (normalsData)
+            {
+              std::copy(vertex.normal, vertex.normal + 3, normalsData + 3 * ptId);
+            }
+            if (rgbData)
+            {
+              const unsigned char color[4] = { vertex.red, vertex.green, vertex.blue,
+                vertex.alpha };
+              std::copy(color, color + numColorComps, rgbData + numColorComps * ptId);
+            }
           }
-        }
+        });
       }
       output->SetPoints(pts);
       pts->Delete();
@@ -0,0 +1,106 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLArrayRangeCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the XML readers fill the range cache of the arrays from the
+// ranges stored in the file, when these ranges are exact.
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkXMLImageDataReader.h"
+#include "vtkXMLImageDataWriter.h"
+
+#include <cmath>
+
+namespace
+{
+bool CheckArray(vtkDataArray* read, vtkDataArray* written, bool cached)
+{
+  if (!read)
+  {
+    std::cerr << "Missing array " << written->GetName() << std::endl;
+    return false;
+  }
+  if (read->GetInformation()->Has(vtkAbstractArray::PER_COMPONENT()) != cached)
+  {
+    std::cerr << "The range of " << written->GetName() << " should " << (cached ? "" : "not ")
+              << "be cached after reading." << std::endl;
+    return false;
+  }
+  double readRange[2];
+  double writtenRange[2];
+  read->GetRange(readRange);
+  written->GetRange(writtenRange);
+  if (readRange[0] != writtenRange[0] || readRange[1] != writtenRange[1])
+  {
+    std::cerr << "Wrong range for " << written->GetName() << ": [" << readRange[0] << ", "
+              << readRange[1] << "] instead of [" << writtenRange[0] << ", " << writtenRange[1]
+              << "]" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestXMLArrayRangeCache(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(10, 10, 2);
+
+  vtkNew<vtkFloatArray> floats;
+  floats->SetName("floats");
+  floats->SetNumberOfTuples(image->GetNumberOfPoints());
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetName("doubles");
+  doubles->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    floats->SetValue(i, static_cast<float>(std::sin(0.1 * i) / 3.));
+    doubles->SetValue(i, std::sin(0.1 * i) / 3.);
+  }
+  image->GetPointData()->AddArray(floats);
+  image->GetPointData()->AddArray(doubles);
+
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("ints");
+  ints->SetNumberOfTuples(image->GetNumberOfCells());
+  for (vtkIdType i = 0; i < image->GetNumberOfCells(); ++i)
+  {
+    ints->SetValue(i, static_cast<int>(i * 104729 % 2147483) - 1000000);
+  }
+  image->GetCellData()->AddArray(ints);
+
+  vtkNew<vtkXMLImageDataWriter> writer;
+  writer->SetInputData(image);
+  writer->WriteToOutputStringOn();
+  writer->Write();
+
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->ReadFromInputStringOn();
+  reader->SetInputString(writer->GetOutputString());
+  reader->Update();
+  vtkImageData* output = reader->GetOutput();
+
+  // The range of doubles is written with a limited precision, so it is not
+  // cached, while the ranges of floats and integers are exact.
+  bool success = CheckArray(output->GetPointData()->GetArray("floats"), floats, true);
+  success &= CheckArray(output->GetPointData()->GetArray("doubles"), doubles, false);
+  success &= CheckArray(output->GetCellData()->GetArray("ints"), ints, true);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
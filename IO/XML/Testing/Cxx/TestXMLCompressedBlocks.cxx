@@ -0,0 +1,146 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLCompressedBlocks.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Write arrays spanning many compressed blocks with every compressor, byte
+// order and id type, and check that they are read back unchanged.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkXMLUnstructuredGridReader.h"
+#include "vtkXMLUnstructuredGridWriter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+void MakeGrid(vtkUnstructuredGrid* grid)
+{
+  const vtkIdType numPoints = 100003;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPoints);
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetName("Doubles");
+  doubles->SetNumberOfComponents(2);
+  doubles->SetNumberOfTuples(numPoints);
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    points->SetPoint(i, i % 1000, (i * 7) % 333, i % 17);
+    doubles->SetTypedComponent(i, 0, i * 0.5);
+    doubles->SetTypedComponent(i, 1, -1.0 / (i + 1));
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(doubles);
+
+  const vtkIdType numCells = numPoints - 3;
+  vtkNew<vtkCellArray> cells;
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfTuples(numCells);
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    const vtkIdType tetra[4] = { i, i + 1, i + 2, i + 3 };
+    cells->InsertNextCell(4, tetra);
+    ids->SetValue(i, numCells - i);
+  }
+  grid->SetCells(VTK_TETRA, cells);
+  grid->GetCellData()->AddArray(ids);
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameGrids(vtkUnstructuredGrid* a, vtkUnstructuredGrid* b)
+{
+  return a->GetNumberOfCells() == b->GetNumberOfCells() &&
+    SameArrays(a->GetPoints()->GetData(), b->GetPoints()->GetData()) &&
+    SameArrays(a->GetCells()->GetConnectivityArray(), b->GetCells()->GetConnectivityArray()) &&
+    SameArrays(a->GetCells()->GetOffsetsArray(), b->GetCells()->GetOffsetsArray()) &&
+    SameArrays(a->GetPointData()->GetArray("Doubles"), b->GetPointData()->GetArray("Doubles")) &&
+    SameArrays(a->GetCellData()->GetArray("Ids"), b->GetCellData()->GetArray("Ids"));
+}
+}
+
+int TestXMLCompressedBlocks(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  MakeGrid(grid);
+
+  const int compressors[3] = { vtkXMLWriter::ZLIB, vtkXMLWriter::LZ4, vtkXMLWriter::LZMA };
+  const int idTypes[2] = { vtkXMLWriter::Int32, vtkXMLWriter::Int64 };
+  for (int compressor : compressors)
+  {
+    for (int byteOrder = vtkXMLWriter::BigEndian; byteOrder <= vtkXMLWriter::LittleEndian;
+         ++byteOrder)
+    {
+      for (int idType : idTypes)
+      {
+        for (int encode = 0; encode < 2; ++encode)
+        {
+          vtkNew<vtkXMLUnstructuredGridWriter> writer;
+          writer->SetInputData(grid);
+          writer->WriteToOutputStringOn();
+          writer->SetCompressorType(compressor);
+          writer->SetCompressionLevel(1);
+          writer->SetByteOrder(byteOrder);
+          writer->SetIdType(idType);
+          writer->SetBlockSize(4096);
+          writer->SetDataModeToAppended();
+          writer->SetEncodeAppendedData(encode);
+          if (!writer->Write())
+          {
+            std::cerr << "Could not write the grid" << std::endl;
+            return EXIT_FAILURE;
+          }
+
+          vtkNew<vtkXMLUnstructuredGridReader> reader;
+          reader->ReadFromInputStringOn();
+          reader->SetInputString(writer->GetOutputString());
+          reader->Update();
+          if (!SameGrids(grid, reader->GetOutput()))
+          {
+            std::cerr << "The grid read with compressor " << compressor << ", byte order "
+                      << byteOrder << ", id type " << idType << " and encoding " << encode
+                      << " differs" << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
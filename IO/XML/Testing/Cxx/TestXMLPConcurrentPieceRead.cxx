@@ -0,0 +1,109 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLPConcurrentPieceRead.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that reading the pieces of a parallel unstructured file concurrently
+// gives the same output as reading them one after another.
+
+#include "vtkDataArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
+#include "vtkXMLPPolyDataReader.h"
+#include "vtkXMLPPolyDataWriter.h"
+
+#include <string>
+
+namespace
+{
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetComponent(i / a->GetNumberOfComponents(), i % a->GetNumberOfComponents()) !=
+      b->GetComponent(i / b->GetNumberOfComponents(), i % b->GetNumberOfComponents()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestXMLPConcurrentPieceRead(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string fileName = std::string(tempDir) + "/TestXMLPConcurrentPieceRead.pvtp";
+  delete[] tempDir;
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+
+  vtkNew<vtkXMLPPolyDataWriter> writer;
+  writer->SetInputConnection(sphere->GetOutputPort());
+  writer->SetFileName(fileName.c_str());
+  writer->SetNumberOfPieces(16);
+  writer->SetStartPiece(0);
+  writer->SetEndPiece(15);
+  writer->Write();
+
+  vtkNew<vtkXMLPPolyDataReader> serialReader;
+  serialReader->SetFileName(fileName.c_str());
+  serialReader->SetNumberOfReadThreads(1);
+  serialReader->Update();
+  vtkPolyData* expected = serialReader->GetOutput();
+  if (expected->GetNumberOfPoints() == 0)
+  {
+    std::cerr << "Nothing read from " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (int numberOfThreads : { 0, 4 })
+  {
+    vtkNew<vtkXMLPPolyDataReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->SetNumberOfReadThreads(numberOfThreads);
+    reader->Update();
+    vtkPolyData* output = reader->GetOutput();
+
+    if (output->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+      output->GetNumberOfPolys() != expected->GetNumberOfPolys())
+    {
+      std::cerr << "Read " << output->GetNumberOfPoints() << " points and "
+                << output->GetNumberOfPolys() << " polygons with " << numberOfThreads
+                << " threads instead of " << expected->GetNumberOfPoints() << " and "
+                << expected->GetNumberOfPolys() << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (!SameArrays(output->GetPoints()->GetData(), expected->GetPoints()->GetData()) ||
+      !SameArrays(output->GetPointData()->GetArray("Normals"),
+        expected->GetPointData()->GetArray("Normals")) ||
+      !SameArrays(output->GetPolys()->GetConnectivityArray(),
+        expected->GetPolys()->GetConnectivityArray()))
+    {
+      std::cerr << "Different data read with " << numberOfThreads << " threads" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -22,6 +22,7 @@
 #include "vtkDataSet.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkPointData.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -29,6 +30,7 @@
 #include "vtkXMLDataParser.h"
 
 #include <cassert>
+#include <cmath>
 #include <map> // needed for std::map
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -412,6 +414,7 @@ int vtkXMLDataReader::ReadPieceData()
             }
             return 0;
           }
+          this->SetArrayRangeFromElement(eNested, array);
         }
       }
     }
@@ -438,7 +441,8 @@ int vtkXMLDataReader::ReadPieceData()
           this->SetProgressRange(progressRange, currentArray++, numArrays);
 
           // Read the array.
-          if (!this->ReadArrayForCells(eNested, cellData->GetAbstractArray(a++)))
+          vtkAbstractArray* array = cellData->GetAbstractArray(a++);
+          if (!this->ReadArrayForCells(eNested, array))
           {
             if (!this->AbortExecute)
             {
@@ -449,6 +453,7 @@ int vtkXMLDataReader::ReadPieceData()
             }
             return 0;
           }
+          this->SetArrayRangeFromElement(eNested, array);
         }
       }
     }
@@ -471,6 +476,35 @@ void vtkXMLDataReader::ReadXMLData()
   this->ReadFieldData();
 }
 
+//------------------------------------------------------------------------------
+void vtkXMLDataReader::SetArrayRangeFromElement(vtkXMLDataElement* da, vtkAbstractArray* array)
+{
+  // The range is written with 11 significant digits: it is exact for floats
+  // and for integers of up to 32 bits, not for doubles. The range of arrays
+  // with several components is the range of their magnitude, computed in
+  // double, so it is not exact either.
+  vtkDataArray* dataArray = vtkArrayDownCast<vtkDataArray>(array);
+  double range[2];
+  if (!dataArray || !this->ReadsWholePiece() || dataArray->GetNumberOfComponents() != 1 ||
+    dataArray->GetNumberOfTuples() == 0 || dataArray->GetDataTypeSize() > 4 ||
+    !da->GetScalarAttribute("RangeMin", range[0]) ||
+    !da->GetScalarAttribute("RangeMax", range[1]) || !(range[0] <= range[1]))
+  {
+    return;
+  }
+  for (int i = 0; i < 2; ++i)
+  {
+    range[i] = dataArray->GetDataType() == VTK_FLOAT ? static_cast<float>(range[i])
+                                                     : std::round(range[i]);
+  }
+
+  // Fill the cache the way vtkDataArray::ComputeRange() does
+  vtkNew<vtkInformationVector> infoVec;
+  infoVec->SetNumberOfInformationObjects(1);
+  infoVec->GetInformationObject(0)->Set(vtkDataArray::COMPONENT_RANGE(), range, 2);
+  dataArray->GetInformation()->Set(vtkAbstractArray::PER_COMPONENT(), infoVec);
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLDataReader::ReadArrayForPoints(vtkXMLDataElement* da, vtkAbstractArray* outArray)
 {
@@ -83,6 +83,15 @@ protected:
   virtual int ReadArrayForPoints(vtkXMLDataElement* da, vtkAbstractArray* outArray);
   virtual int ReadArrayForCells(vtkXMLDataElement* da, vtkAbstractArray* outArray);
 
+  // Return whether the arrays of the current piece are read whole into the
+  // output, so that the ranges stored in the file are the ranges of the output
+  // arrays.
+  virtual bool ReadsWholePiece() { return false; }
+
+  // Seed the range cache of an array read whole with the range stored in its
+  // element, so that GetRange() does not scan the values again.
+  void SetArrayRangeFromElement(vtkXMLDataElement* da, vtkAbstractArray* array);
+
   // Callback registered with the DataProgressObserver.
   static void DataProgressCallbackFunction(vtkObject*, unsigned long, void*, void*);
   // Progress callback from XMLParser.
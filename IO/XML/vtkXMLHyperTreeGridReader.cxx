@@ -422,6 +422,8 @@ void vtkXMLHyperTreeGridReader::ReadXMLData()
       this->ReadTrees_2(ePrimary);
     }
   }
+  // The trees are complete: store them compactly
+  output->Squeeze();
   this->IdsSelected.clear();
   this->FixedHTs = false;
 }
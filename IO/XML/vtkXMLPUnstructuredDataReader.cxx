@@ -15,22 +15,29 @@
 #include "vtkXMLPUnstructuredDataReader.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkCallbackCommand.h"
 #include "vtkCellArray.h"
+#include "vtkDataArraySelection.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkXMLDataElement.h"
 #include "vtkXMLUnstructuredDataReader.h"
 
+#include <atomic>
+#include <vector>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkXMLPUnstructuredDataReader::vtkXMLPUnstructuredDataReader()
 {
   this->TotalNumberOfPoints = 0;
   this->TotalNumberOfCells = 0;
+  this->NumberOfReadThreads = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -40,6 +47,7 @@ vtkXMLPUnstructuredDataReader::~vtkXMLPUnstructuredDataReader() = default;
 void vtkXMLPUnstructuredDataReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfReadThreads: " << this->NumberOfReadThreads << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -304,6 +312,9 @@ void vtkXMLPUnstructuredDataReader::ReadXMLData()
     fractions[index + 1] = fractions[index + 1] / fractions[this->EndPiece - this->StartPiece];
   }
 
+  // Read the pieces concurrently, then copy them one after another.
+  this->ReadPiecesConcurrently();
+
   // Read the data needed from each piece.
   for (int i = this->StartPiece; (i < this->EndPiece && !this->AbortExecute && !this->DataError);
        ++i)
@@ -322,6 +333,65 @@ void vtkXMLPUnstructuredDataReader::ReadXMLData()
   delete[] fractions;
 }
 
+//------------------------------------------------------------------------------
+void vtkXMLPUnstructuredDataReader::ReadPiecesConcurrently()
+{
+  if (this->NumberOfReadThreads == 1 || this->EndPiece - this->StartPiece < 2)
+  {
+    return;
+  }
+
+  // Prepare the readers as ReadPieceData(int) does, so that updating them
+  // again when copying the pieces does nothing. The progress observer only
+  // follows the current piece, so it is detached meanwhile.
+  std::vector<vtkXMLDataReader*> readers;
+  for (int i = this->StartPiece; i < this->EndPiece; ++i)
+  {
+    if (this->CanReadPiece(i))
+    {
+      vtkXMLDataReader* reader = this->PieceReaders[i];
+      reader->SetAbortExecute(0);
+      reader->GetPointDataArraySelection()->CopySelections(this->PointDataArraySelection);
+      reader->GetCellDataArraySelection()->CopySelections(this->CellDataArraySelection);
+      reader->RemoveObserver(this->PieceProgressObserver);
+      readers.push_back(reader);
+    }
+  }
+
+  float progressRange[2] = { 0.f, 0.f };
+  this->GetProgressRange(progressRange);
+  const vtkIdType numberOfReaders = static_cast<vtkIdType>(readers.size());
+  std::atomic<vtkIdType> numberOfPiecesRead(0);
+  auto readPieces = [&]() {
+    vtkSMPTools::For(0, numberOfReaders, 1, [&](vtkIdType begin, vtkIdType end) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      for (vtkIdType i = begin; i < end && !this->AbortExecute; ++i)
+      {
+        readers[i]->UpdatePiece(0, 1, this->UpdateGhostLevel);
+        vtkIdType count = ++numberOfPiecesRead;
+        if (isFirst)
+        {
+          this->UpdateProgressDiscrete(progressRange[0] +
+            (progressRange[1] - progressRange[0]) * count / static_cast<float>(numberOfReaders));
+        }
+      }
+    });
+  };
+  if (this->NumberOfReadThreads > 1)
+  {
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ this->NumberOfReadThreads }, readPieces);
+  }
+  else
+  {
+    readPieces();
+  }
+
+  for (vtkXMLDataReader* reader : readers)
+  {
+    reader->AddObserver(vtkCommand::ProgressEvent, this->PieceProgressObserver);
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLPUnstructuredDataReader::ReadPieceData()
 {
@@ -19,6 +19,11 @@
  * vtkXMLPUnstructuredDataReader provides functionality common to all
  * parallel unstructured data format readers.
  *
+ * The pieces forming the requested piece are read concurrently by their own
+ * serial readers, with at most NumberOfReadThreads threads, then copied in
+ * order into the output arrays, which are allocated beforehand for all the
+ * pieces.
+ *
  * @sa
  * vtkXMLPPolyDataReader vtkXMLPUnstructuredGridReader
  */
@@ -45,6 +50,16 @@ public:
   // SetupOutputInformation to outInfo
   void CopyOutputInformation(vtkInformation* outInfo, int port) override;
 
+  ///@{
+  /**
+   * Set/Get the maximum number of threads reading pieces concurrently. 0, the
+   * default, uses the number of threads of vtkSMPTools, and 1 reads each
+   * piece just before copying it into the output.
+   */
+  vtkSetClampMacro(NumberOfReadThreads, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfReadThreads, int);
+  ///@}
+
 protected:
   vtkXMLPUnstructuredDataReader();
   ~vtkXMLPUnstructuredDataReader() override;
@@ -74,6 +89,11 @@ protected:
   void SetupUpdateExtent(int piece, int numberOfPieces, int ghostLevel);
 
   int ReadPieceData() override;
+
+  // Read the pieces of the range concurrently, so that ReadPieceData only
+  // has to copy them.
+  void ReadPiecesConcurrently();
+
   void CopyCellArray(vtkIdType totalNumberOfCells, vtkCellArray* inCells, vtkCellArray* outCells);
 
   // Get the number of points/cells in the given piece.  Valid after
@@ -96,6 +116,8 @@ protected:
   // The PPoints element with point information.
   vtkXMLDataElement* PPointsElement;
 
+  int NumberOfReadThreads;
+
 private:
   vtkXMLPUnstructuredDataReader(const vtkXMLPUnstructuredDataReader&) = delete;
   void operator=(const vtkXMLPUnstructuredDataReader&) = delete;
@@ -46,6 +46,10 @@
 #include "vtkXMLReaderVersion.h"
 #include "vtkZLibDataCompressor.h"
 
+#if VTK_MODULE_ENABLE_VTK_IOZstd
+#include "vtkZstdDataCompressor.h"
+#endif
+
 #include "vtksys/Encoding.hxx"
 #include "vtksys/FStream.hxx"
 #include <vtksys/SystemTools.hxx>
@@ -460,6 +464,12 @@ void vtkXMLReader::SetupCompressor(const char* type)
     {
       compressor = vtkLZMADataCompressor::New();
     }
+#if VTK_MODULE_ENABLE_VTK_IOZstd
+    else if (strcmp(type, "vtkZstdDataCompressor") == 0)
+    {
+      compressor = vtkZstdDataCompressor::New();
+    }
+#endif
   }
 
   if (!compressor)
@@ -22,6 +22,8 @@
 #include "vtkXMLDataElement.h"
 #include "vtkXMLDataParser.h"
 
+#include <algorithm>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkXMLStructuredDataReader::vtkXMLStructuredDataReader()
@@ -372,6 +374,14 @@ int vtkXMLStructuredDataReader::ReadArrayForCells(vtkXMLDataElement* da, vtkAbst
   return 1;
 }
 
+//------------------------------------------------------------------------------
+bool vtkXMLStructuredDataReader::ReadsWholePiece()
+{
+  // The piece may be larger than the update extent
+  const int* pieceExtent = this->PieceExtents + this->Piece * 6;
+  return std::equal(pieceExtent, pieceExtent + 6, this->UpdateExtent);
+}
+
 //------------------------------------------------------------------------------
 template <class iterT>
 void vtkXMLStructuredDataReaderSubExtentCopyValues(
@@ -108,6 +108,7 @@ protected:
   void DestroyPieces() override;
   int ReadArrayForPoints(vtkXMLDataElement* da, vtkAbstractArray* outArray) override;
   int ReadArrayForCells(vtkXMLDataElement* da, vtkAbstractArray* outArray) override;
+  bool ReadsWholePiece() override;
 
   // Internal utility methods.
   int ReadPiece(vtkXMLDataElement* ePiece) override;
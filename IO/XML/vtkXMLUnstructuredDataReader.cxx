@@ -1118,6 +1118,13 @@ int vtkXMLUnstructuredDataReader::ReadArrayForPoints(
     da, startPoint * components, outArray, 0, numPoints * components, POINT_DATA);
 }
 
+//------------------------------------------------------------------------------
+bool vtkXMLUnstructuredDataReader::ReadsWholePiece()
+{
+  // Several pieces are appended in the output arrays
+  return this->EndPiece - this->StartPiece == 1;
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLUnstructuredDataReader::PointsNeedToReadTimeStep(vtkXMLDataElement* eNested)
 {
@@ -105,6 +105,7 @@ protected:
 
   // Read a data array whose tuples coorrespond to points.
   int ReadArrayForPoints(vtkXMLDataElement* da, vtkAbstractArray* outArray) override;
+  bool ReadsWholePiece() override;
 
   // Get the number of points/cells in the given piece.  Valid after
   // UpdateInformation.
@@ -43,6 +43,7 @@
 #include "vtkOutputStream.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -63,9 +64,11 @@
 #include "vtksys/FStream.hxx"
 #include <memory>
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #if !defined(_WIN32) || defined(__CYGWIN__)
 #include <unistd.h> /* unlink */
@@ -93,6 +96,15 @@ public:
   {
     return writer->WriteBinaryDataBlock(in_data, numWords, wordType);
   }
+  static inline int WriteBinaryDataBlocks(vtkXMLWriter* writer, unsigned char* in_data,
+    size_t numBlocks, size_t blockWords, int wordType)
+  {
+    return writer->WriteBinaryDataBlocks(in_data, numBlocks, blockWords, wordType);
+  }
+  static inline size_t GetNumberOfBlocksInFlight(vtkXMLWriter* writer)
+  {
+    return writer->GetNumberOfBlocksInFlight();
+  }
   static inline void* GetInt32IdTypeBuffer(vtkXMLWriter* writer)
   {
     return static_cast<void*>(writer->Int32IdTypeBuffer);
@@ -142,17 +154,21 @@ struct WriteBinaryDataBlockWorker
     unsigned char* ptr = reinterpret_cast<unsigned char*>(iter);
     size_t wordsLeft = this->NumWords;
 
-    // Do the complete blocks.
+    // Do the complete blocks, several at a time so that they can be
+    // compressed concurrently.
+    size_t const blocksInFlight = vtkXMLWriterHelper::GetNumberOfBlocksInFlight(this->Writer);
     vtkXMLWriterHelper::SetProgressPartial(this->Writer, 0);
     this->Result = true;
     while (this->Result && (wordsLeft >= blockWords))
     {
-      if (!vtkXMLWriterHelper::WriteBinaryDataBlock(this->Writer, ptr, blockWords, this->WordType))
+      size_t const numBlocks = std::min(wordsLeft / blockWords, blocksInFlight);
+      if (!vtkXMLWriterHelper::WriteBinaryDataBlocks(
+            this->Writer, ptr, numBlocks, blockWords, this->WordType))
       {
         this->Result = false;
       }
-      ptr += memBlockSize;
-      wordsLeft -= blockWords;
+      ptr += numBlocks * memBlockSize;
+      wordsLeft -= numBlocks * blockWords;
       vtkXMLWriterHelper::SetProgressPartial(
         this->Writer, static_cast<float>(this->NumWords - wordsLeft) / this->NumWords);
     }
@@ -1275,6 +1291,109 @@ int vtkXMLWriter::WriteBinaryDataBlock(unsigned char* in_data, size_t numWords,
   }
 }
 
+//------------------------------------------------------------------------------
+size_t vtkXMLWriter::GetNumberOfBlocksInFlight()
+{
+  // Bound the uncompressed data handled at once when compressing blocks
+  // concurrently.  Uncompressed blocks are written one at a time.
+  size_t const maxBytesInFlight = 16777216;
+  if (!this->Compressor || this->BlockSize == 0)
+  {
+    return 1;
+  }
+  return std::max<size_t>(1, maxBytesInFlight / this->BlockSize);
+}
+
+//------------------------------------------------------------------------------
+int vtkXMLWriter::WriteBinaryDataBlocks(
+  unsigned char* in_data, size_t numBlocks, size_t blockWords, int wordType)
+{
+  size_t const memBlockSize = blockWords * this->GetWordTypeSize(wordType);
+  if (!this->Compressor || numBlocks < 2)
+  {
+    for (size_t block = 0; block < numBlocks; ++block)
+    {
+      if (!this->WriteBinaryDataBlock(in_data + block * memBlockSize, blockWords, wordType))
+      {
+        return 0;
+      }
+    }
+    return 1;
+  }
+
+  // Convert, byte swap and compress the blocks concurrently, each one in its
+  // own part of the buffers, then write them in order.
+  size_t const wordSize = this->GetOutputWordTypeSize(wordType);
+  size_t const blockSize = blockWords * wordSize;
+  size_t const compressionSpace = this->Compressor->GetMaximumCompressionSpace(blockSize);
+  bool convertIds = false;
+#ifdef VTK_USE_64BIT_IDS
+  convertIds = (wordType == VTK_ID_TYPE) && (this->IdType == vtkXMLWriter::Int32);
+#endif
+  bool const byteSwap = this->ByteSwapBuffer != nullptr;
+  std::vector<unsigned char> blocks((convertIds || byteSwap) ? numBlocks * blockSize : 0);
+  std::vector<unsigned char> compressed(numBlocks * compressionSpace);
+  std::vector<size_t> compressedSizes(numBlocks);
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numBlocks), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType block = begin; block < end; ++block)
+    {
+      unsigned char* data = in_data + block * memBlockSize;
+      if (!blocks.empty())
+      {
+        unsigned char* converted = blocks.data() + block * blockSize;
+#ifdef VTK_USE_64BIT_IDS
+        if (convertIds)
+        {
+          const vtkIdType* ids = reinterpret_cast<const vtkIdType*>(data);
+          Int32IdType* out = reinterpret_cast<Int32IdType*>(converted);
+          for (size_t i = 0; i < blockWords; ++i)
+          {
+            out[i] = static_cast<Int32IdType>(ids[i]);
+          }
+        }
+        else
+#endif
+        {
+          memcpy(converted, data, blockSize);
+        }
+        if (byteSwap)
+        {
+          this->PerformByteSwap(converted, blockWords, wordSize);
+        }
+        data = converted;
+      }
+      compressedSizes[block] = this->Compressor->Compress(
+        data, blockSize, compressed.data() + block * compressionSpace, compressionSpace);
+    }
+  });
+
+  for (size_t block = 0; block < numBlocks; ++block)
+  {
+    if (!compressedSizes[block])
+    {
+      vtkErrorMacro("Error compressing block " << this->CompressionBlockNumber << ".");
+      return 0;
+    }
+    int result =
+      this->DataStream->Write(compressed.data() + block * compressionSpace, compressedSizes[block]);
+    this->Stream->flush();
+    if (this->Stream->fail())
+    {
+      this->SetErrorCode(vtkErrorCode::GetLastSystemError());
+      return 0;
+    }
+    if (!result)
+    {
+      return 0;
+    }
+
+    // Store the resulting compressed size in the compression header.
+    this->CompressionHeader->Set(3 + this->CompressionBlockNumber++, compressedSizes[block]);
+  }
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 void vtkXMLWriter::PerformByteSwap(void* data, size_t numWords, size_t wordSize)
 {
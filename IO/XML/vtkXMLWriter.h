@@ -252,6 +252,9 @@ protected:
 
   // Internal utility methods.
   int WriteBinaryDataBlock(unsigned char* in_data, size_t numWords, int wordType);
+  int WriteBinaryDataBlocks(
+    unsigned char* in_data, size_t numBlocks, size_t blockWords, int wordType);
+  size_t GetNumberOfBlocksInFlight();
   void PerformByteSwap(void* data, size_t numWords, size_t wordSize);
   int CreateCompressionHeader(size_t size);
   int WriteCompressionBlock(unsigned char* data, size_t size);
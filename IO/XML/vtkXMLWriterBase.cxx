@@ -21,6 +21,10 @@
 #include "vtkXMLReaderVersion.h"
 #include "vtkZLibDataCompressor.h"
 
+#if VTK_MODULE_ENABLE_VTK_IOZstd
+#include "vtkZstdDataCompressor.h"
+#endif
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkCxxSetObjectMacro(vtkXMLWriterBase, Compressor, vtkDataCompressor);
 //----------------------------------------------------------------------------
@@ -132,6 +136,20 @@ void vtkXMLWriterBase::SetCompressorType(int compressorType)
     this->Compressor->SetCompressionLevel(this->CompressionLevel);
     this->Modified();
   }
+  else if (compressorType == ZSTD)
+  {
+#if VTK_MODULE_ENABLE_VTK_IOZstd
+    if (this->Compressor)
+    {
+      this->Compressor->Delete();
+    }
+    this->Compressor = vtkZstdDataCompressor::New();
+    this->Compressor->SetCompressionLevel(this->CompressionLevel);
+    this->Modified();
+#else
+    vtkWarningMacro("The Zstandard compressor requires the IOZstd module.");
+#endif
+  }
   else
   {
     vtkWarningMacro("Invalid compressorType:" << compressorType);
@@ -151,18 +151,21 @@ public:
     NONE,
     ZLIB,
     LZ4,
-    LZMA
+    LZMA,
+    ZSTD
   };
 
   ///@{
   /**
    * Convenience functions to set the compressor to certain known types.
+   * ZSTD is only available when VTK is built with the IOZstd module.
    */
   void SetCompressorType(int compressorType);
   void SetCompressorTypeToNone() { this->SetCompressorType(NONE); }
   void SetCompressorTypeToLZ4() { this->SetCompressorType(LZ4); }
   void SetCompressorTypeToZLib() { this->SetCompressorType(ZLIB); }
   void SetCompressorTypeToLZMA() { this->SetCompressorType(LZMA); }
+  void SetCompressorTypeToZstd() { this->SetCompressorType(ZSTD); }
   ///@}
 
   ///@{
@@ -219,6 +222,7 @@ public:
   /**
    * Invoke the writer.  Returns 1 for success, 0 for failure.
    */
+  VTK_UNBLOCKTHREADS
   int Write();
 
 protected:
@@ -21,6 +21,7 @@
 #include "vtkEndian.h"
 #include "vtkInputStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkXMLDataElement.h"
 #define vtkXMLDataHeaderPrivate_DoNotInclude
 #include "vtkXMLDataHeaderPrivate.h"
@@ -636,6 +637,58 @@ unsigned char* vtkXMLDataParser::ReadBlock(vtkTypeUInt64 block)
   return decompressBuffer;
 }
 
+//------------------------------------------------------------------------------
+size_t vtkXMLDataParser::GetNumberOfBlocksInFlight()
+{
+  // Bound the compressed data read at once.
+  size_t const maxBytesInFlight = 16777216;
+  if (this->BlockUncompressedSize == 0)
+  {
+    return 1;
+  }
+  return std::max<size_t>(1, maxBytesInFlight / this->BlockUncompressedSize);
+}
+
+//------------------------------------------------------------------------------
+int vtkXMLDataParser::ReadBlocks(
+  vtkTypeUInt64 firstBlock, vtkTypeUInt64 numBlocks, unsigned char* buffer, size_t wordSize)
+{
+  // The compressed blocks are stored one after the other.
+  std::vector<size_t> offsets(numBlocks + 1, 0);
+  for (vtkTypeUInt64 i = 0; i < numBlocks; ++i)
+  {
+    offsets[i + 1] = offsets[i] + this->BlockCompressedSizes[firstBlock + i];
+  }
+
+  if (!this->DataStream->Seek(this->BlockStartOffsets[firstBlock]))
+  {
+    return 0;
+  }
+  std::vector<unsigned char> readBuffer(offsets[numBlocks]);
+  if (this->DataStream->Read(readBuffer.data(), readBuffer.size()) < readBuffer.size())
+  {
+    return 0;
+  }
+
+  size_t const blockSize = this->BlockUncompressedSize;
+  std::vector<unsigned char> valid(numBlocks, 0);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numBlocks), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      unsigned char* output = buffer + i * blockSize;
+      if (this->Compressor->Uncompress(
+            readBuffer.data() + offsets[i], offsets[i + 1] - offsets[i], output, blockSize) > 0)
+      {
+        // Byte swap this block.  Note that blockSize will always be an
+        // integer multiple of the word size.
+        this->PerformByteSwap(output, blockSize / wordSize, wordSize);
+        valid[i] = 1;
+      }
+    }
+  });
+  return std::find(valid.begin(), valid.end(), 0) == valid.end();
+}
+
 //------------------------------------------------------------------------------
 size_t vtkXMLDataParser::ReadUncompressedData(
   unsigned char* data, vtkTypeUInt64 startWord, size_t numWords, size_t wordSize)
@@ -808,21 +861,21 @@ size_t vtkXMLDataParser::ReadCompressedData(
     // Report progress.
     this->UpdateProgress(float(outputPointer - data) / length);
 
-    unsigned int currentBlock = firstBlock + 1;
-    for (; currentBlock != lastBlock && !this->Abort; ++currentBlock)
+    // The blocks in between are complete.  Read them several at a time and
+    // uncompress them concurrently straight into the output.
+    vtkTypeUInt64 currentBlock = firstBlock + 1;
+    while (currentBlock < lastBlock && !this->Abort)
     {
-      // Read this block.
-      if (!this->ReadBlock(currentBlock, outputPointer))
+      vtkTypeUInt64 numBlocks =
+        std::min<vtkTypeUInt64>(lastBlock - currentBlock, this->GetNumberOfBlocksInFlight());
+      if (!this->ReadBlocks(currentBlock, numBlocks, outputPointer, wordSize))
       {
         return 0;
       }
 
-      // Byte swap this block.  Note that blockSize will always be an
-      // integer multiple of the word size.
-      this->PerformByteSwap(outputPointer, blockSize / wordSize, wordSize);
-
       // Advance the pointer to the beginning of the next block.
-      outputPointer += this->FindBlockSize(currentBlock);
+      currentBlock += numBlocks;
+      outputPointer += numBlocks * this->BlockUncompressedSize;
 
       // Report progress.
       this->UpdateProgress(float(outputPointer - data) / length);
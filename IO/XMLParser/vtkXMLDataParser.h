@@ -187,6 +187,9 @@ protected:
   size_t FindBlockSize(vtkTypeUInt64 block);
   int ReadBlock(vtkTypeUInt64 block, unsigned char* buffer);
   unsigned char* ReadBlock(vtkTypeUInt64 block);
+  int ReadBlocks(
+    vtkTypeUInt64 firstBlock, vtkTypeUInt64 numBlocks, unsigned char* buffer, size_t wordSize);
+  size_t GetNumberOfBlocksInFlight();
   size_t ReadUncompressedData(
     unsigned char* data, vtkTypeUInt64 startWord, size_t numWords, size_t wordSize);
   size_t ReadCompressedData(
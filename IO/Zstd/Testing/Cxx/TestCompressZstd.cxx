@@ -0,0 +1,152 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCompressZstd.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Test of vtkZstdDataCompressor, directly and through the XML writer and
+// reader.
+
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkXMLImageDataReader.h"
+#include "vtkXMLImageDataWriter.h"
+#include "vtkZstdDataCompressor.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+bool RoundTrip(vtkZstdDataCompressor* compressor, const std::vector<unsigned char>& data)
+{
+  std::vector<unsigned char> compressed(compressor->GetMaximumCompressionSpace(data.size()));
+  size_t size =
+    compressor->Compress(data.data(), data.size(), compressed.data(), compressed.size());
+  if (size == 0)
+  {
+    std::cerr << "Compression failed" << std::endl;
+    return false;
+  }
+  std::vector<unsigned char> uncompressed(data.size());
+  if (compressor->Uncompress(compressed.data(), size, uncompressed.data(), data.size()) !=
+      data.size() ||
+    uncompressed != data)
+  {
+    std::cerr << "Uncompression failed" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestCompressZstd(int, char*[])
+{
+  std::vector<unsigned char> data(100024);
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<unsigned char>((i * i) % 251);
+  }
+
+  vtkNew<vtkZstdDataCompressor> compressor;
+  for (int level = 1; level <= 9; ++level)
+  {
+    compressor->SetCompressionLevel(level);
+    if (compressor->GetCompressionLevel() != level || !RoundTrip(compressor, data))
+    {
+      std::cerr << "Failed with compression level " << level << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  compressor->SetZstdLevel(22);
+  compressor->SetNumberOfThreads(2);
+  if (!RoundTrip(compressor, data))
+  {
+    std::cerr << "Failed with Zstandard level 22 and 2 threads" << std::endl;
+    return EXIT_FAILURE;
+  }
+  compressor->SetZstdLevel(3);
+  compressor->SetNumberOfThreads(0);
+
+  // Many small similar buffers, which a dictionary compresses better.
+  const unsigned int numberOfSamples = 1000;
+  const size_t sampleSize = 64;
+  std::vector<unsigned char> samples(numberOfSamples * sampleSize);
+  std::vector<size_t> sampleSizes(numberOfSamples, sampleSize);
+  for (size_t i = 0; i < samples.size(); ++i)
+  {
+    const char* pattern = "<DataArray type=\"Float32\" Name=\"Normals\" format=\"appended\"/>";
+    samples[i] = static_cast<unsigned char>(pattern[i % std::strlen(pattern)] + (i / 997) % 3);
+  }
+  vtkNew<vtkUnsignedCharArray> dictionary;
+  if (!vtkZstdDataCompressor::TrainDictionary(
+        samples.data(), sampleSizes.data(), numberOfSamples, 4096, dictionary) ||
+    dictionary->GetNumberOfValues() == 0)
+  {
+    std::cerr << "Could not train a dictionary" << std::endl;
+    return EXIT_FAILURE;
+  }
+  compressor->SetDictionary(dictionary);
+  std::vector<unsigned char> sample(samples.begin(), samples.begin() + sampleSize);
+  if (!RoundTrip(compressor, sample) || !RoundTrip(compressor, data))
+  {
+    std::cerr << "Failed with a dictionary" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Through the XML writer and reader.
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(50, 40, 30);
+  vtkNew<vtkFloatArray> values;
+  values->SetName("Values");
+  values->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < values->GetNumberOfTuples(); ++i)
+  {
+    values->SetValue(i, static_cast<float>(i % 1000) * 0.5f);
+  }
+  image->GetPointData()->SetScalars(values);
+
+  vtkNew<vtkXMLImageDataWriter> writer;
+  writer->SetInputData(image);
+  writer->WriteToOutputStringOn();
+  writer->SetCompressorTypeToZstd();
+  writer->SetCompressionLevel(5);
+  if (!vtkZstdDataCompressor::SafeDownCast(writer->GetCompressor()) || !writer->Write())
+  {
+    std::cerr << "Could not write with the Zstandard compressor" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->ReadFromInputStringOn();
+  reader->SetInputString(writer->GetOutputString());
+  reader->Update();
+  vtkDataArray* read = reader->GetOutput()->GetPointData()->GetArray("Values");
+  if (!read || read->GetNumberOfTuples() != values->GetNumberOfTuples())
+  {
+    std::cerr << "Could not read the Zstandard compressed data" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < values->GetNumberOfTuples(); ++i)
+  {
+    if (read->GetComponent(i, 0) != values->GetValue(i))
+    {
+      std::cerr << "Value " << i << " differs" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,249 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkZstdDataCompressor.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkZstdDataCompressor.h"
+#include "vtkObjectFactory.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <zdict.h>
+#include <zstd.h>
+
+namespace
+{
+// Zstandard levels used for the CompressionLevel values 1 to 9.
+const int ZstdLevels[9] = { 1, 2, 3, 5, 8, 11, 14, 17, 19 };
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+// The digested dictionaries are only read while compressing and
+// uncompressing, so they may be shared by concurrent calls.
+class vtkZstdDataCompressor::vtkInternals
+{
+public:
+  ZSTD_CDict* CompressionDictionary = nullptr;
+  ZSTD_DDict* DecompressionDictionary = nullptr;
+
+  void Clear()
+  {
+    ZSTD_freeCDict(this->CompressionDictionary);
+    this->CompressionDictionary = nullptr;
+    ZSTD_freeDDict(this->DecompressionDictionary);
+    this->DecompressionDictionary = nullptr;
+  }
+};
+
+vtkStandardNewMacro(vtkZstdDataCompressor);
+
+//------------------------------------------------------------------------------
+vtkZstdDataCompressor::vtkZstdDataCompressor()
+{
+  this->ZstdLevel = ZSTD_CLEVEL_DEFAULT;
+  this->NumberOfThreads = 0;
+  this->Dictionary = nullptr;
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkZstdDataCompressor::~vtkZstdDataCompressor()
+{
+  this->Internals->Clear();
+  delete this->Internals;
+  if (this->Dictionary)
+  {
+    this->Dictionary->Delete();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkZstdDataCompressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "ZstdLevel: " << this->ZstdLevel << endl;
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << endl;
+  os << indent << "Dictionary: " << this->Dictionary << endl;
+}
+
+//------------------------------------------------------------------------------
+void vtkZstdDataCompressor::SetDictionary(vtkUnsignedCharArray* dictionary)
+{
+  if (this->Dictionary)
+  {
+    this->Dictionary->Delete();
+    this->Dictionary = nullptr;
+  }
+  if (dictionary && dictionary->GetNumberOfValues() > 0)
+  {
+    this->Dictionary = vtkUnsignedCharArray::New();
+    this->Dictionary->DeepCopy(dictionary);
+  }
+  this->UpdateDictionaries();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkZstdDataCompressor::UpdateDictionaries()
+{
+  this->Internals->Clear();
+  if (!this->Dictionary)
+  {
+    return;
+  }
+  const void* data = this->Dictionary->GetVoidPointer(0);
+  size_t size = static_cast<size_t>(this->Dictionary->GetNumberOfValues());
+  this->Internals->CompressionDictionary = ZSTD_createCDict(data, size, this->ZstdLevel);
+  this->Internals->DecompressionDictionary = ZSTD_createDDict(data, size);
+  if (!this->Internals->CompressionDictionary || !this->Internals->DecompressionDictionary)
+  {
+    vtkErrorMacro("Zstandard error while loading the dictionary.");
+    this->Internals->Clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+size_t vtkZstdDataCompressor::CompressBuffer(unsigned char const* uncompressedData,
+  size_t uncompressedSize, unsigned char* compressedData, size_t compressionSpace)
+{
+  ZSTD_CCtx* context = ZSTD_createCCtx();
+  if (!context)
+  {
+    vtkErrorMacro("Zstandard error while compressing data.");
+    return 0;
+  }
+  ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, this->ZstdLevel);
+  if (this->NumberOfThreads > 0)
+  {
+    // Fails without effect when the library has no thread support.
+    ZSTD_CCtx_setParameter(context, ZSTD_c_nbWorkers, this->NumberOfThreads);
+  }
+  if (this->Internals->CompressionDictionary)
+  {
+    ZSTD_CCtx_refCDict(context, this->Internals->CompressionDictionary);
+  }
+  size_t cs =
+    ZSTD_compress2(context, compressedData, compressionSpace, uncompressedData, uncompressedSize);
+  ZSTD_freeCCtx(context);
+  if (ZSTD_isError(cs))
+  {
+    vtkErrorMacro("Zstandard error while compressing data: " << ZSTD_getErrorName(cs));
+    return 0;
+  }
+  return cs;
+}
+
+//------------------------------------------------------------------------------
+size_t vtkZstdDataCompressor::UncompressBuffer(unsigned char const* compressedData,
+  size_t compressedSize, unsigned char* uncompressedData, size_t uncompressedSize)
+{
+  ZSTD_DCtx* context = ZSTD_createDCtx();
+  if (!context)
+  {
+    vtkErrorMacro("Zstandard error while uncompressing data.");
+    return 0;
+  }
+  size_t us = this->Internals->DecompressionDictionary
+    ? ZSTD_decompress_usingDDict(context, uncompressedData, uncompressedSize, compressedData,
+        compressedSize, this->Internals->DecompressionDictionary)
+    : ZSTD_decompressDCtx(
+        context, uncompressedData, uncompressedSize, compressedData, compressedSize);
+  ZSTD_freeDCtx(context);
+  if (ZSTD_isError(us))
+  {
+    vtkErrorMacro("Zstandard error while uncompressing data: " << ZSTD_getErrorName(us));
+    return 0;
+  }
+  // Make sure the output size matched that expected.
+  if (us != uncompressedSize)
+  {
+    vtkErrorMacro("Decompression produced incorrect size.\n"
+                  "Expected "
+      << uncompressedSize << " and got " << us);
+    return 0;
+  }
+  return us;
+}
+
+//------------------------------------------------------------------------------
+int vtkZstdDataCompressor::GetCompressionLevel()
+{
+  int compressionLevel = 1;
+  while (compressionLevel < 9 && ZstdLevels[compressionLevel - 1] < this->ZstdLevel)
+  {
+    ++compressionLevel;
+  }
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): returning CompressionLevel "
+                << compressionLevel);
+  return compressionLevel;
+}
+
+//------------------------------------------------------------------------------
+void vtkZstdDataCompressor::SetCompressionLevel(int compressionLevel)
+{
+  int min = 1;
+  int max = 9;
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): setting CompressionLevel to "
+                << compressionLevel);
+  // In order to make an intuitive interface for vtkDataCompressor objects
+  // we accept compressionLevel values 1..9. 1 is fastest, 9 is slowest
+  // 1 is worst compression, 9 is best compression. They are mapped onto the
+  // Zstandard levels, which go further; see SetZstdLevel.
+  compressionLevel =
+    compressionLevel < min ? min : (compressionLevel > max ? max : compressionLevel);
+  this->SetZstdLevel(ZstdLevels[compressionLevel - 1]);
+}
+
+//------------------------------------------------------------------------------
+void vtkZstdDataCompressor::SetZstdLevel(int level)
+{
+  int max = ZSTD_maxCLevel();
+  level = level < 1 ? 1 : (level > max ? max : level);
+  if (this->ZstdLevel != level)
+  {
+    this->ZstdLevel = level;
+    // The compression dictionary is digested for a given level.
+    this->UpdateDictionaries();
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+size_t vtkZstdDataCompressor::GetMaximumCompressionSpace(size_t size)
+{
+  return ZSTD_compressBound(size);
+}
+
+//------------------------------------------------------------------------------
+int vtkZstdDataCompressor::TrainDictionary(const unsigned char* samples, const size_t* sampleSizes,
+  unsigned int numberOfSamples, size_t dictionarySize, vtkUnsignedCharArray* dictionary)
+{
+  if (!samples || !sampleSizes || !dictionary || dictionarySize == 0)
+  {
+    return 0;
+  }
+  dictionary->SetNumberOfComponents(1);
+  dictionary->SetNumberOfValues(static_cast<vtkIdType>(dictionarySize));
+  size_t size = ZDICT_trainFromBuffer(
+    dictionary->GetPointer(0), dictionarySize, samples, sampleSizes, numberOfSamples);
+  if (ZDICT_isError(size))
+  {
+    vtkGenericWarningMacro("Zstandard error while training a dictionary: "
+      << ZDICT_getErrorName(size));
+    dictionary->SetNumberOfValues(0);
+    return 0;
+  }
+  dictionary->SetNumberOfValues(static_cast<vtkIdType>(size));
+  return 1;
+}
+VTK_ABI_NAMESPACE_END
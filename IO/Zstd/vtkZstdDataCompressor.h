@@ -0,0 +1,125 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkZstdDataCompressor.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkZstdDataCompressor
+ * @brief   Data compression using Zstandard.
+ *
+ * vtkZstdDataCompressor provides a concrete vtkDataCompressor class
+ * using Zstandard for compressing and uncompressing data.
+ *
+ * Besides the CompressionLevel values 1 to 9 shared by all compressors, the
+ * Zstandard level may be set directly. Each buffer may also be compressed by
+ * several threads, and a dictionary trained from typical small buffers may be
+ * used to improve their compression. The same dictionary must then be given
+ * to the compressor used to uncompress the data.
+ */
+
+#ifndef vtkZstdDataCompressor_h
+#define vtkZstdDataCompressor_h
+
+#include "vtkDataCompressor.h"
+#include "vtkIOZstdModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkUnsignedCharArray;
+
+class VTKIOZSTD_EXPORT vtkZstdDataCompressor : public vtkDataCompressor
+{
+public:
+  vtkTypeMacro(vtkZstdDataCompressor, vtkDataCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  static vtkZstdDataCompressor* New();
+
+  /**
+   *  Get the maximum space that may be needed to store data of the
+   *  given uncompressed size after compression.  This is the minimum
+   *  size of the output buffer that can be passed to the four-argument
+   *  Compress method.
+   */
+  size_t GetMaximumCompressionSpace(size_t size) override;
+
+  /**
+   *  Get/Set the compression level.
+   */
+  // Compression level getter required by vtkDataCompressor.
+  int GetCompressionLevel() override;
+
+  // Compression level setter required by vtkDataCompresor.
+  void SetCompressionLevel(int compressionLevel) override;
+
+  ///@{
+  /**
+   * Direct setting of the Zstandard level, from 1 to 22, allows more direct
+   * control over the compressor. The default is 3.
+   */
+  virtual void SetZstdLevel(int level);
+  vtkGetMacro(ZstdLevel, int);
+  ///@}
+
+  ///@{
+  /**
+   * Number of threads Zstandard uses to compress a single buffer. When 0, the
+   * default, each buffer is compressed by the calling thread. This is ignored
+   * when the Zstandard library is built without thread support.
+   */
+  vtkSetClampMacro(NumberOfThreads, int, 0, 200);
+  vtkGetMacro(NumberOfThreads, int);
+  ///@}
+
+  ///@{
+  /**
+   * Dictionary used to compress and uncompress the data, or nullptr, the
+   * default, to use none. The dictionary is copied when it is set, later
+   * changes to the array are ignored.
+   */
+  virtual void SetDictionary(vtkUnsignedCharArray* dictionary);
+  vtkGetObjectMacro(Dictionary, vtkUnsignedCharArray);
+  ///@}
+
+  /**
+   * Train a dictionary of at most dictionarySize bytes from numberOfSamples
+   * samples stored one after the other in samples, the size of each being
+   * given by sampleSizes. Return 1 on success, 0 otherwise.
+   */
+  static int TrainDictionary(const unsigned char* samples, const size_t* sampleSizes,
+    unsigned int numberOfSamples, size_t dictionarySize, vtkUnsignedCharArray* dictionary);
+
+protected:
+  vtkZstdDataCompressor();
+  ~vtkZstdDataCompressor() override;
+
+  int ZstdLevel;
+  int NumberOfThreads;
+  vtkUnsignedCharArray* Dictionary;
+
+  // Compression method required by vtkDataCompressor.
+  size_t CompressBuffer(unsigned char const* uncompressedData, size_t uncompressedSize,
+    unsigned char* compressedData, size_t compressionSpace) override;
+  // Decompression method required by vtkDataCompressor.
+  size_t UncompressBuffer(unsigned char const* compressedData, size_t compressedSize,
+    unsigned char* uncompressedData, size_t uncompressedSize) override;
+
+private:
+  vtkZstdDataCompressor(const vtkZstdDataCompressor&) = delete;
+  void operator=(const vtkZstdDataCompressor&) = delete;
+
+  void UpdateDictionaries();
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
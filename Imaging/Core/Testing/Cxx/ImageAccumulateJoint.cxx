@@ -0,0 +1,136 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    ImageAccumulateJoint.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare the 3D joint histogram computed by vtkImageAccumulate, with dense
+// and with sparse bins, with a direct count of the voxels in a stencil.
+
+#include "vtkImageAccumulate.h"
+#include "vtkImageData.h"
+#include "vtkImageStencilData.h"
+#include "vtkNew.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+int ImageAccumulateJoint(int, char*[])
+{
+  const int extent[6] = { -5, 34, 0, 29, 2, 21 };
+  vtkNew<vtkImageData> image;
+  image->SetExtent(const_cast<int*>(extent));
+  image->AllocateScalars(VTK_SHORT, 3);
+  short* scalars = static_cast<short*>(image->GetScalarPointer());
+  unsigned int state = 99;
+  for (vtkIdType i = 0; i < 3 * image->GetNumberOfPoints(); ++i)
+  {
+    state = state * 1103515245u + 12345u;
+    scalars[i] = static_cast<short>((state >> 8) % 40 - 10);
+  }
+
+  // a ball, in which the voxels are counted
+  vtkNew<vtkImageStencilData> stencil;
+  stencil->SetExtent(const_cast<int*>(extent));
+  stencil->AllocateExtents();
+  std::vector<bool> inside(image->GetNumberOfPoints(), false);
+  for (int k = extent[4]; k <= extent[5]; ++k)
+  {
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      const double r2 = 144.0 - (j - 15.0) * (j - 15.0) - (k - 12.0) * (k - 12.0);
+      if (r2 >= 0.0)
+      {
+        const int r1 = static_cast<int>(std::ceil(14.0 - std::sqrt(r2)));
+        const int r2i = static_cast<int>(std::floor(14.0 + std::sqrt(r2)));
+        stencil->InsertNextExtent(r1, r2i, j, k);
+        for (int i = r1; i <= r2i; ++i)
+        {
+          int ijk[3] = { i, j, k };
+          inside[image->ComputePointId(ijk)] = true;
+        }
+      }
+    }
+  }
+
+  // bins of size 2 from -6 to 23, so that some values are out of bounds
+  const int numBins = 15;
+  std::vector<vtkIdType> expected(numBins * numBins * numBins, 0);
+  double sum[3] = { 0.0, 0.0, 0.0 };
+  vtkIdType count = 0;
+  for (vtkIdType p = 0; p < image->GetNumberOfPoints(); ++p)
+  {
+    if (!inside[p])
+    {
+      continue;
+    }
+    vtkIdType bin = 0;
+    vtkIdType stride = 1;
+    bool inBounds = true;
+    for (int c = 0; c < 3; ++c)
+    {
+      const int b = static_cast<int>(std::floor((scalars[3 * p + c] + 6) / 2.0));
+      inBounds = inBounds && (b >= 0 && b < numBins);
+      bin += b * stride;
+      stride *= numBins;
+      sum[c] += scalars[3 * p + c];
+      count++;
+    }
+    if (inBounds)
+    {
+      expected[bin]++;
+    }
+  }
+
+  vtkNew<vtkImageAccumulate> accumulate;
+  accumulate->SetInputData(image);
+  accumulate->SetStencilData(stencil);
+  accumulate->SetComponentOrigin(-6.0, -6.0, -6.0);
+  accumulate->SetComponentSpacing(2.0, 2.0, 2.0);
+  accumulate->SetComponentExtent(0, numBins - 1, 0, numBins - 1, 0, numBins - 1);
+
+  int retVal = EXIT_SUCCESS;
+  for (int sparse = 0; sparse < 2; ++sparse)
+  {
+    accumulate->SetSparseBins(sparse);
+    accumulate->Update();
+    vtkIdType* bins = static_cast<vtkIdType*>(accumulate->GetOutput()->GetScalarPointer());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      if (bins[i] != expected[i])
+      {
+        std::cerr << "Wrong count " << bins[i] << " instead of " << expected[i] << " in bin " << i
+                  << (sparse ? " with sparse bins" : "") << std::endl;
+        retVal = EXIT_FAILURE;
+        break;
+      }
+    }
+    if (accumulate->GetVoxelCount() != count)
+    {
+      std::cerr << "Wrong voxel count " << accumulate->GetVoxelCount() << " instead of " << count
+                << std::endl;
+      retVal = EXIT_FAILURE;
+    }
+    for (int c = 0; c < 3; ++c)
+    {
+      if (std::abs(accumulate->GetMean()[c] - sum[c] / count) > 1e-9)
+      {
+        std::cerr << "Wrong mean " << accumulate->GetMean()[c] << " instead of " << sum[c] / count
+                  << std::endl;
+        retVal = EXIT_FAILURE;
+      }
+    }
+  }
+
+  return retVal;
+}
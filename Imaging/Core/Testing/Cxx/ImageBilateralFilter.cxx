@@ -0,0 +1,164 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    ImageBilateralFilter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare vtkImageBilateralFilter with a direct evaluation of the weighted
+// average at each voxel, on the whole image and on a piece, and check that
+// the iterations give the same result as a chain of filters.
+
+#include "vtkImageBilateralFilter.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const int Extent[6] = { -3, 26, 2, 21, 0, 11 };
+
+int CheckPiece(vtkImageData* image, const int piece[6])
+{
+  const double sigmas[3] = { 1.5, 1.0, 0.8 };
+  const double rangeSigma = 12.0;
+  vtkNew<vtkImageBilateralFilter> filter;
+  filter->SetInputData(image);
+  filter->SetStandardDeviations(sigmas[0], sigmas[1], sigmas[2]);
+  filter->SetRadiusFactor(2.0);
+  filter->SetRangeStandardDeviation(rangeSigma);
+  filter->UpdateExtent(piece);
+  vtkImageData* output = filter->GetOutput();
+
+  const int radius[3] = { 3, 2, 1 };
+  for (int k = piece[4]; k <= piece[5]; ++k)
+  {
+    for (int j = piece[2]; j <= piece[3]; ++j)
+    {
+      for (int i = piece[0]; i <= piece[1]; ++i)
+      {
+        for (int c = 0; c < 2; ++c)
+        {
+          const double center = static_cast<double*>(image->GetScalarPointer(i, j, k))[c];
+          double sum = 0.0;
+          double weights = 0.0;
+          for (int kk = std::max(k - radius[2], Extent[4]);
+               kk <= std::min(k + radius[2], Extent[5]); ++kk)
+          {
+            for (int jj = std::max(j - radius[1], Extent[2]);
+                 jj <= std::min(j + radius[1], Extent[3]); ++jj)
+            {
+              for (int ii = std::max(i - radius[0], Extent[0]);
+                   ii <= std::min(i + radius[0], Extent[1]); ++ii)
+              {
+                const double value =
+                  static_cast<double*>(image->GetScalarPointer(ii, jj, kk))[c];
+                const double d[4] = { (ii - i) / sigmas[0], (jj - j) / sigmas[1],
+                  (kk - k) / sigmas[2], (value - center) / rangeSigma };
+                const double w =
+                  std::exp(-0.5 * (d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + d[3] * d[3]));
+                sum += w * value;
+                weights += w;
+              }
+            }
+          }
+          const double expected = sum / weights;
+          const double result = static_cast<double*>(output->GetScalarPointer(i, j, k))[c];
+          if (std::abs(result - expected) > 1e-9 * (1.0 + std::abs(expected)))
+          {
+            std::cerr << "Wrong value at (" << i << ", " << j << ", " << k << "): " << result
+                      << " instead of " << expected << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+int ImageBilateralFilter(int, char*[])
+{
+  // noisy steps in the first component, a noisy ramp in the second
+  vtkNew<vtkImageData> image;
+  image->SetExtent(const_cast<int*>(Extent));
+  image->AllocateScalars(VTK_DOUBLE, 2);
+  unsigned int state = 4321;
+  for (int k = Extent[4]; k <= Extent[5]; ++k)
+  {
+    for (int j = Extent[2]; j <= Extent[3]; ++j)
+    {
+      double* row = static_cast<double*>(image->GetScalarPointer(Extent[0], j, k));
+      for (int i = Extent[0]; i <= Extent[1]; ++i)
+      {
+        state = state * 1103515245u + 12345u;
+        const double noise = ((state >> 8) % 1000) / 100.0 - 5.0;
+        *row++ = ((i > 10) != (j + k > 18) ? 100.0 : 0.0) + noise;
+        *row++ = 2.0 * i - 3.0 * j + k + noise;
+      }
+    }
+  }
+
+  const int piece[6] = { 0, 12, 5, 21, 4, 7 };
+  if (CheckPiece(image, Extent) != EXIT_SUCCESS || CheckPiece(image, piece) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // three iterations of a piece, and three filters in a chain
+  vtkNew<vtkImageBilateralFilter> iterated;
+  iterated->SetInputData(image);
+  iterated->SetNumberOfIterations(3);
+  iterated->UpdateExtent(piece);
+
+  vtkNew<vtkImageBilateralFilter> chain[3];
+  vtkImageData* chained = chain[2]->GetOutput();
+  for (int i = 0; i < 3; ++i)
+  {
+    if (i == 0)
+    {
+      chain[i]->SetInputData(image);
+    }
+    else
+    {
+      chain[i]->SetInputConnection(chain[i - 1]->GetOutputPort());
+    }
+  }
+  chain[2]->Update();
+
+  for (int k = piece[4]; k <= piece[5]; ++k)
+  {
+    for (int j = piece[2]; j <= piece[3]; ++j)
+    {
+      for (int i = piece[0]; i <= piece[1]; ++i)
+      {
+        for (int c = 0; c < 2; ++c)
+        {
+          const double a =
+            static_cast<double*>(iterated->GetOutput()->GetScalarPointer(i, j, k))[c];
+          const double b = static_cast<double*>(chained->GetScalarPointer(i, j, k))[c];
+          if (std::abs(a - b) > 1e-9 * (1.0 + std::abs(b)))
+          {
+            std::cerr << "Iterated value " << a << " instead of " << b << " at (" << i << ", "
+                      << j << ", " << k << ")" << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    ImageEuclideanDistance.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare the Felzenszwalb algorithm of vtkImageEuclideanDistance with a
+// brute force computation, for the distances, the signed distances and the
+// closest feature ids, on an anisotropic image.
+
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkImageEuclideanDistance.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+double SquaredDistance(vtkImageData* image, vtkIdType i, vtkIdType j)
+{
+  double x[3];
+  double y[3];
+  image->GetPoint(i, x);
+  image->GetPoint(j, y);
+  return (x[0] - y[0]) * (x[0] - y[0]) + (x[1] - y[1]) * (x[1] - y[1]) +
+    (x[2] - y[2]) * (x[2] - y[2]);
+}
+
+bool Near(double a, double b)
+{
+  return std::abs(a - b) <= 1e-9 * (1.0 + std::abs(b));
+}
+}
+
+int ImageEuclideanDistance(int, char*[])
+{
+  // A few zero voxels, the features, in an image of ones.
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 22, 0, 16, 0, 10);
+  image->SetSpacing(1.0, 1.5, 0.75);
+  image->AllocateScalars(VTK_SHORT, 1);
+  const vtkIdType numPts = image->GetNumberOfPoints();
+  short* scalars = static_cast<short*>(image->GetScalarPointer());
+  std::vector<vtkIdType> zeros;
+  std::vector<vtkIdType> ones;
+  unsigned int state = 4321;
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    state = state * 1103515245u + 12345u;
+    scalars[i] = ((state >> 16) % 200 == 0 ? 0 : 1);
+    (scalars[i] == 0 ? zeros : ones).push_back(i);
+  }
+  if (zeros.empty())
+  {
+    std::cerr << "The test image has no features" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkImageEuclideanDistance> saito;
+  saito->SetInputData(image);
+  saito->SetAlgorithmToSaito();
+  saito->Update();
+  double* saitoPtr = static_cast<double*>(saito->GetOutput()->GetScalarPointer());
+
+  vtkNew<vtkImageEuclideanDistance> distance;
+  distance->SetInputData(image);
+  distance->SetAlgorithmToFelzenszwalb();
+  distance->GenerateClosestFeatureIdsOn();
+  distance->Update();
+  vtkImageData* output = distance->GetOutput();
+  double* distPtr = static_cast<double*>(output->GetScalarPointer());
+  vtkIdTypeArray* featureIds =
+    vtkIdTypeArray::SafeDownCast(output->GetPointData()->GetArray("ClosestFeatureIds"));
+  if (!featureIds || featureIds->GetNumberOfValues() != numPts)
+  {
+    std::cerr << "Missing ClosestFeatureIds array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double expected = VTK_DOUBLE_MAX;
+    for (vtkIdType zero : zeros)
+    {
+      expected = std::min(expected, SquaredDistance(image, i, zero));
+    }
+    vtkIdType feature = featureIds->GetValue(i);
+    if (!Near(distPtr[i], expected) || !Near(saitoPtr[i], expected))
+    {
+      std::cerr << "Wrong distance at voxel " << i << ": " << distPtr[i] << " and " << saitoPtr[i]
+                << " instead of " << expected << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (feature < 0 || feature >= numPts || scalars[feature] != 0 ||
+      !Near(SquaredDistance(image, i, feature), expected))
+    {
+      std::cerr << "Wrong closest feature " << feature << " at voxel " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The features get the negative of their distance to the other voxels.
+  distance->SignedDistanceOn();
+  distance->GenerateClosestFeatureIdsOff();
+  distance->Update();
+  distPtr = static_cast<double*>(output->GetScalarPointer());
+  if (output->GetPointData()->GetNumberOfArrays() != 1)
+  {
+    std::cerr << "Unexpected arrays in the signed distance output" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType zero : zeros)
+  {
+    double expected = VTK_DOUBLE_MAX;
+    for (vtkIdType one : ones)
+    {
+      expected = std::min(expected, SquaredDistance(image, zero, one));
+    }
+    if (!Near(distPtr[zero], -expected))
+    {
+      std::cerr << "Wrong signed distance at voxel " << zero << ": " << distPtr[zero]
+                << " instead of " << -expected << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
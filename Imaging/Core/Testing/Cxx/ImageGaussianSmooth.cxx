@@ -0,0 +1,193 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    ImageGaussianSmooth.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare vtkImageGaussianSmooth with a direct convolution whose kernel is
+// clipped and renormalized at the boundaries, for the whole image and for a
+// piece of it, and compare the recursive gaussian with the convolution.
+
+#include "vtkImageData.h"
+#include "vtkImageGaussianSmooth.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+const int Extent[6] = { -3, 17, 0, 16, 2, 14 };
+const int NumberOfComponents = 2;
+
+// Convolve the values along one axis with a gaussian of the given standard
+// deviation and radius, clipped and renormalized at the boundaries.
+void Convolve(std::vector<double>& values, int axis, double sigma, int radius)
+{
+  int dims[3] = { Extent[1] - Extent[0] + 1, Extent[3] - Extent[2] + 1,
+    Extent[5] - Extent[4] + 1 };
+  vtkIdType steps[3] = { NumberOfComponents, NumberOfComponents * dims[0],
+    static_cast<vtkIdType>(NumberOfComponents) * dims[0] * dims[1] };
+  std::vector<double> result(values.size());
+  for (int k = 0; k < dims[2]; ++k)
+  {
+    for (int j = 0; j < dims[1]; ++j)
+    {
+      for (int i = 0; i < dims[0]; ++i)
+      {
+        int ijk[3] = { i, j, k };
+        for (int c = 0; c < NumberOfComponents; ++c)
+        {
+          vtkIdType id = i * steps[0] + j * steps[1] + k * steps[2] + c;
+          double sum = 0.0;
+          double weights = 0.0;
+          for (int r = -radius; r <= radius; ++r)
+          {
+            if (ijk[axis] + r >= 0 && ijk[axis] + r < dims[axis])
+            {
+              double w = std::exp(-r * r / (2.0 * sigma * sigma));
+              sum += w * values[id + r * steps[axis]];
+              weights += w;
+            }
+          }
+          result[id] = sum / weights;
+        }
+      }
+    }
+  }
+  values = result;
+}
+
+int CheckPiece(vtkImageGaussianSmooth* smooth, const std::vector<double>& expected,
+  const int piece[6])
+{
+  smooth->UpdateExtent(piece);
+  vtkImageData* output = smooth->GetOutput();
+  for (int k = piece[4]; k <= piece[5]; ++k)
+  {
+    for (int j = piece[2]; j <= piece[3]; ++j)
+    {
+      for (int i = piece[0]; i <= piece[1]; ++i)
+      {
+        vtkIdType id = NumberOfComponents *
+          ((i - Extent[0]) +
+            (Extent[1] - Extent[0] + 1) *
+              ((j - Extent[2]) + (Extent[3] - Extent[2] + 1) * (k - Extent[4])));
+        float* value = static_cast<float*>(output->GetScalarPointer(i, j, k));
+        for (int c = 0; c < NumberOfComponents; ++c)
+        {
+          if (std::abs(value[c] - expected[id + c]) > 1e-4 * (1.0 + std::abs(expected[id + c])))
+          {
+            std::cerr << "Wrong value at (" << i << ", " << j << ", " << k << "): " << value[c]
+                      << " instead of " << expected[id + c] << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+int ImageGaussianSmooth(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(const_cast<int*>(Extent));
+  image->AllocateScalars(VTK_FLOAT, NumberOfComponents);
+  float* scalars = static_cast<float*>(image->GetScalarPointer());
+  const vtkIdType numValues = image->GetNumberOfPoints() * NumberOfComponents;
+  std::vector<double> expected(numValues);
+  unsigned int state = 2024;
+  for (vtkIdType i = 0; i < numValues; ++i)
+  {
+    state = state * 1103515245u + 12345u;
+    scalars[i] = static_cast<float>((state >> 16) % 1000) / 10.0f;
+    expected[i] = scalars[i];
+  }
+
+  const double sigmas[3] = { 1.5, 2.0, 1.0 };
+  vtkNew<vtkImageGaussianSmooth> smooth;
+  smooth->SetInputData(image);
+  smooth->SetStandardDeviations(sigmas[0], sigmas[1], sigmas[2]);
+  smooth->SetRadiusFactors(2.0, 2.0, 2.0);
+  for (int axis = 2; axis >= 0; --axis)
+  {
+    Convolve(expected, axis, sigmas[axis], static_cast<int>(2.0 * sigmas[axis]));
+  }
+
+  // the whole image, then a piece away from the boundaries
+  const int piece[6] = { 2, 9, 5, 11, 6, 8 };
+  if (CheckPiece(smooth, expected, Extent) != EXIT_SUCCESS ||
+    CheckPiece(smooth, expected, piece) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // the recursive gaussian approximates the convolution away from the
+  // boundaries, and keeps a constant image constant
+  vtkNew<vtkImageData> plane;
+  plane->SetExtent(0, 99, 0, 99, 0, 0);
+  plane->AllocateScalars(VTK_DOUBLE, 1);
+  double* planeScalars = static_cast<double*>(plane->GetScalarPointer());
+  for (vtkIdType i = 0; i < plane->GetNumberOfPoints(); ++i)
+  {
+    state = state * 1103515245u + 12345u;
+    planeScalars[i] = static_cast<double>((state >> 16) % 1000) / 10.0;
+  }
+  vtkNew<vtkImageGaussianSmooth> convolution;
+  convolution->SetInputData(plane);
+  convolution->SetDimensionality(2);
+  convolution->SetStandardDeviations(6.0, 6.0);
+  convolution->SetRadiusFactors(4.0, 4.0);
+  convolution->Update();
+  vtkNew<vtkImageGaussianSmooth> recursive;
+  recursive->SetInputData(plane);
+  recursive->SetDimensionality(2);
+  recursive->SetStandardDeviations(6.0, 6.0);
+  recursive->SetRadiusFactors(4.0, 4.0);
+  recursive->SetRecursiveThreshold(3.0);
+  recursive->Update();
+  double maxError = 0.0;
+  for (int j = 24; j < 76; ++j)
+  {
+    for (int i = 24; i < 76; ++i)
+    {
+      double* a = static_cast<double*>(convolution->GetOutput()->GetScalarPointer(i, j, 0));
+      double* b = static_cast<double*>(recursive->GetOutput()->GetScalarPointer(i, j, 0));
+      maxError = std::max(maxError, std::abs(*a - *b));
+    }
+  }
+  if (maxError > 0.5)
+  {
+    std::cerr << "The recursive gaussian differs from the convolution by " << maxError
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::fill(planeScalars, planeScalars + plane->GetNumberOfPoints(), 7.0);
+  plane->Modified();
+  recursive->Update();
+  double* result = static_cast<double*>(recursive->GetOutput()->GetScalarPointer());
+  for (vtkIdType i = 0; i < plane->GetNumberOfPoints(); ++i)
+  {
+    if (std::abs(result[i] - 7.0) > 1e-9)
+    {
+      std::cerr << "The recursive gaussian changed a constant image: " << result[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
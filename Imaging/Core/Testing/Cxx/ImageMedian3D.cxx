@@ -0,0 +1,168 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    ImageMedian3D.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare vtkImageMedian3D with a sort of each neighborhood, for kernels
+// that use the sorting network, the sliding histogram, and the partial sort,
+// for the median and for other percentiles, on the whole image and a piece.
+
+#include "vtkImageData.h"
+#include "vtkImageMedian3D.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+const int Extent[6] = { -4, 21, 3, 20, 0, 9 };
+
+template <class T>
+void FillImage(vtkImageData* image, int scalarType, int numComp, int range)
+{
+  image->SetExtent(const_cast<int*>(Extent));
+  image->AllocateScalars(scalarType, numComp);
+  T* scalars = static_cast<T*>(image->GetScalarPointer());
+  unsigned int state = 1234;
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints() * numComp; ++i)
+  {
+    state = state * 1103515245u + 12345u;
+    scalars[i] = static_cast<T>((state >> 8) % range);
+  }
+}
+
+// The percentile of the sorted values, interpolated between two ranks.
+template <class T>
+double Percentile(std::vector<T>& values, double percentile)
+{
+  std::sort(values.begin(), values.end());
+  const double position = percentile * (values.size() - 1) / 100.0;
+  const size_t rank = static_cast<size_t>(position);
+  const double fraction = position - rank;
+  if (fraction == 0.0)
+  {
+    return values[rank];
+  }
+  const double step = (static_cast<double>(values[rank + 1]) - values[rank]) * fraction;
+  return values[rank] + (std::is_integral<T>::value ? std::floor(step) : step);
+}
+
+template <class T>
+int CheckPiece(vtkImageData* image, const int kernel[3], double percentile, const int piece[6])
+{
+  vtkNew<vtkImageMedian3D> median;
+  median->SetInputData(image);
+  median->SetKernelSize(kernel[0], kernel[1], kernel[2]);
+  median->SetPercentile(percentile);
+  median->UpdateExtent(piece);
+  vtkImageData* output = median->GetOutput();
+  const int numComp = image->GetNumberOfScalarComponents();
+
+  std::vector<T> values;
+  for (int k = piece[4]; k <= piece[5]; ++k)
+  {
+    for (int j = piece[2]; j <= piece[3]; ++j)
+    {
+      for (int i = piece[0]; i <= piece[1]; ++i)
+      {
+        const int ijk[3] = { i, j, k };
+        int hood[6];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          hood[2 * axis] = std::max(ijk[axis] - kernel[axis] / 2, Extent[2 * axis]);
+          hood[2 * axis + 1] =
+            std::min(ijk[axis] - kernel[axis] / 2 + kernel[axis] - 1, Extent[2 * axis + 1]);
+        }
+        T* value = static_cast<T*>(output->GetScalarPointer(i, j, k));
+        for (int c = 0; c < numComp; ++c)
+        {
+          values.clear();
+          for (int kk = hood[4]; kk <= hood[5]; ++kk)
+          {
+            for (int jj = hood[2]; jj <= hood[3]; ++jj)
+            {
+              for (int ii = hood[0]; ii <= hood[1]; ++ii)
+              {
+                values.push_back(static_cast<T*>(image->GetScalarPointer(ii, jj, kk))[c]);
+              }
+            }
+          }
+          const double expected = Percentile(values, percentile);
+          if (std::abs(value[c] - expected) > 1e-5 * (1.0 + std::abs(expected)))
+          {
+            std::cerr << "Kernel " << kernel[0] << "x" << kernel[1] << "x" << kernel[2]
+                      << ", percentile " << percentile << ": wrong value at (" << i << ", " << j
+                      << ", " << k << "): " << static_cast<double>(value[c]) << " instead of "
+                      << expected << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+template <class T>
+int Check(vtkImageData* image, const int kernel[3], double percentile)
+{
+  const int piece[6] = { 3, 12, 8, 15, 2, 6 };
+  if (CheckPiece<T>(image, kernel, percentile, Extent) != EXIT_SUCCESS ||
+    CheckPiece<T>(image, kernel, percentile, piece) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+int ImageMedian3D(int, char*[])
+{
+  int retVal = EXIT_SUCCESS;
+
+  // small kernels use a sorting network, except at the boundaries
+  vtkNew<vtkImageData> floatImage;
+  FillImage<float>(floatImage, VTK_FLOAT, 2, 1000);
+  const int cube[3] = { 3, 3, 3 };
+  const int even[3] = { 4, 2, 1 };
+  retVal |= Check<float>(floatImage, cube, 50.0);
+  retVal |= Check<float>(floatImage, cube, 80.0);
+  retVal |= Check<float>(floatImage, even, 50.0);
+
+  // large kernels of 8 and 16 bit integers use a sliding histogram
+  vtkNew<vtkImageData> shortImage;
+  FillImage<unsigned short>(shortImage, VTK_UNSIGNED_SHORT, 1, 60000);
+  const int large[3] = { 7, 6, 5 };
+  retVal |= Check<unsigned short>(shortImage, large, 50.0);
+  retVal |= Check<unsigned short>(shortImage, large, 10.0);
+  retVal |= Check<unsigned short>(shortImage, large, 100.0);
+
+  vtkNew<vtkImageData> charImage;
+  FillImage<unsigned char>(charImage, VTK_UNSIGNED_CHAR, 1, 256);
+  const int plane[3] = { 9, 9, 1 };
+  retVal |= Check<unsigned char>(charImage, plane, 50.0);
+  retVal |= Check<unsigned char>(charImage, plane, 0.0);
+
+  // other large kernels sort each neighborhood
+  vtkNew<vtkImageData> doubleImage;
+  FillImage<double>(doubleImage, VTK_DOUBLE, 1, 100);
+  const int box[3] = { 5, 5, 3 };
+  retVal |= Check<double>(doubleImage, box, 50.0);
+  retVal |= Check<double>(doubleImage, box, 30.0);
+
+  return retVal;
+}
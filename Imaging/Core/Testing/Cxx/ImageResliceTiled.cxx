@@ -0,0 +1,129 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    ImageResliceTiled.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkImageReslice with an InputMemoryLimit requests the input
+// in pieces that fit within the limit, and that the tiled output and its
+// stencil are identical to those computed from the whole input.
+
+#include "vtkCallbackCommand.h"
+#include "vtkCommand.h"
+#include "vtkImageData.h"
+#include "vtkImageReslice.h"
+#include "vtkImageSinusoidSource.h"
+#include "vtkImageStencilData.h"
+#include "vtkNew.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// Record the size of the largest extent that the source produced.
+void RecordExtent(vtkObject* caller, unsigned long, void* clientData, void*)
+{
+  vtkImageSinusoidSource* source = static_cast<vtkImageSinusoidSource*>(caller);
+  vtkIdType* largest = static_cast<vtkIdType*>(clientData);
+  vtkIdType size = source->GetOutput()->GetNumberOfPoints();
+  *largest = (size > *largest ? size : *largest);
+}
+}
+
+int ImageResliceTiled(int, char*[])
+{
+  // a 64x64x64 image of doubles, which is two mebibytes
+  vtkNew<vtkImageSinusoidSource> source;
+  source->SetWholeExtent(0, 63, 0, 63, 0, 63);
+  source->SetDirection(1.0, 2.0, 3.0);
+  source->SetPeriod(20.0);
+  source->SetAmplitude(100.0);
+
+  vtkIdType largest = 0;
+  vtkNew<vtkCallbackCommand> callback;
+  callback->SetCallback(RecordExtent);
+  callback->SetClientData(&largest);
+  source->AddObserver(vtkCommand::EndEvent, callback);
+
+  // an oblique rotation, so that the input extent of each tile is larger
+  // than the tile itself
+  const double c = std::cos(0.5);
+  const double s = std::sin(0.5);
+  const double cosines[9] = { c, s, 0.0, -s * c, c * c, s, s * s, -s * c, c };
+
+  vtkNew<vtkImageData> expected;
+  vtkNew<vtkImageStencilData> expectedStencil;
+  vtkNew<vtkImageReslice> reslice;
+  reslice->SetInputConnection(source->GetOutputPort());
+  reslice->SetResliceAxesDirectionCosines(cosines);
+  reslice->SetResliceAxesOrigin(32.0, 32.0, 32.0);
+  reslice->SetOutputOrigin(-40.0, -40.0, -20.0);
+  reslice->SetOutputSpacing(1.0, 1.0, 1.0);
+  reslice->SetOutputExtent(0, 79, 0, 79, 0, 39);
+  reslice->SetInterpolationModeToCubic();
+  reslice->GenerateStencilOutputOn();
+  reslice->Update();
+  expected->DeepCopy(reslice->GetOutput());
+  expectedStencil->DeepCopy(reslice->GetStencilOutput());
+
+  if (reslice->GetNumberOfTiles() != 1 || largest * 8 <= 512 * 1024)
+  {
+    std::cerr << "The output was tiled without an InputMemoryLimit" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // limit the input to a quarter of the whole image
+  largest = 0;
+  reslice->SetInputMemoryLimit(512);
+  reslice->Update();
+  vtkImageData* output = reslice->GetOutput();
+  vtkImageStencilData* stencil = reslice->GetStencilOutput();
+
+  if (reslice->GetNumberOfTiles() < 4)
+  {
+    std::cerr << "Only " << reslice->GetNumberOfTiles() << " tiles were used" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (largest * 8 > 512 * 1024)
+  {
+    std::cerr << "An input of " << largest << " voxels exceeds the limit" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  int extent[6];
+  output->GetExtent(extent);
+  for (int k = extent[4]; k <= extent[5]; k++)
+  {
+    for (int j = extent[2]; j <= extent[3]; j++)
+    {
+      for (int i = extent[0]; i <= extent[1]; i++)
+      {
+        double a = *static_cast<double*>(output->GetScalarPointer(i, j, k));
+        double b = *static_cast<double*>(expected->GetScalarPointer(i, j, k));
+        if (a != b)
+        {
+          std::cerr << "Wrong value at (" << i << ", " << j << ", " << k << "): " << a
+                    << " instead of " << b << std::endl;
+          return EXIT_FAILURE;
+        }
+        if (stencil->IsInside(i, j, k) != expectedStencil->IsInside(i, j, k))
+        {
+          std::cerr << "Wrong stencil at (" << i << ", " << j << ", " << k << ")" << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,170 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    ImageStencilToLabelMap.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the row-parallel boolean operations of vtkImageStencilData and the
+// label map made by vtkImageStencilToLabelMap against voxel-by-voxel tests.
+
+#include "vtkImageData.h"
+#include "vtkImageStencilData.h"
+#include "vtkImageStencilToLabelMap.h"
+#include "vtkNew.h"
+#include "vtkROIStencilSource.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+
+namespace
+{
+const int Extent[6] = { 0, 39, 0, 29, 0, 19 };
+
+vtkSmartPointer<vtkImageStencilData> MakeROI(int shape, const double bounds[6])
+{
+  vtkNew<vtkROIStencilSource> source;
+  source->SetOutputWholeExtent(const_cast<int*>(Extent));
+  source->SetShape(shape);
+  source->SetBounds(const_cast<double*>(bounds));
+  source->Update();
+  vtkSmartPointer<vtkImageStencilData> stencil = vtkSmartPointer<vtkImageStencilData>::New();
+  stencil->DeepCopy(source->GetOutput());
+  return stencil;
+}
+
+bool Compare(
+  const char* name, vtkImageStencilData* stencil, const std::function<bool(int, int, int)>& inside)
+{
+  for (int k = Extent[4]; k <= Extent[5]; ++k)
+  {
+    for (int j = Extent[2]; j <= Extent[3]; ++j)
+    {
+      for (int i = Extent[0]; i <= Extent[1]; ++i)
+      {
+        if ((stencil->IsInside(i, j, k) != 0) != inside(i, j, k))
+        {
+          std::cerr << name << ": wrong result at (" << i << ", " << j << ", " << k << ")"
+                    << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int ImageStencilToLabelMap(int, char*[])
+{
+  const double bounds0[6] = { 3, 30, 2, 25, 1, 15 };
+  const double bounds1[6] = { 15, 38, 8, 29, 4, 19 };
+  const double bounds2[6] = { 10, 20, 5, 15, 0, 10 };
+  vtkSmartPointer<vtkImageStencilData> a = MakeROI(vtkROIStencilSource::ELLIPSOID, bounds0);
+  vtkSmartPointer<vtkImageStencilData> b = MakeROI(vtkROIStencilSource::CYLINDERZ, bounds1);
+  vtkSmartPointer<vtkImageStencilData> c = MakeROI(vtkROIStencilSource::BOX, bounds2);
+
+  // a stencil with a smaller extent, with several runs per row
+  vtkNew<vtkImageStencilData> d;
+  d->SetExtent(5, 34, 4, 24, 3, 16);
+  d->AllocateExtents();
+  for (int k = 3; k <= 16; ++k)
+  {
+    for (int j = 4; j <= 24; ++j)
+    {
+      for (int i = 5 + (j + k) % 4; i <= 34; i += 7)
+      {
+        d->InsertNextExtent(i, std::min(i + (j % 3), 34), j, k);
+      }
+    }
+  }
+
+  auto in = [](vtkImageStencilData* s, int i, int j, int k) { return s->IsInside(i, j, k) != 0; };
+  bool success = true;
+
+  vtkNew<vtkImageStencilData> added;
+  added->DeepCopy(a);
+  added->Add(b);
+  success &= Compare("Add", added,
+    [&](int i, int j, int k) { return in(a, i, j, k) || in(b, i, j, k); });
+
+  vtkNew<vtkImageStencilData> subtracted;
+  subtracted->DeepCopy(a);
+  subtracted->Subtract(d);
+  success &= Compare("Subtract", subtracted,
+    [&](int i, int j, int k) { return in(a, i, j, k) && !in(d, i, j, k); });
+
+  vtkNew<vtkImageStencilData> replaced;
+  replaced->DeepCopy(b);
+  replaced->Replace(d);
+  success &= Compare("Replace", replaced, [&](int i, int j, int k) {
+    bool inD = (i >= 5 && i <= 34 && j >= 4 && j <= 24 && k >= 3 && k <= 16);
+    return (inD ? in(d, i, j, k) : in(b, i, j, k));
+  });
+
+  vtkNew<vtkImageStencilData> clipped;
+  clipped->DeepCopy(a);
+  int clipExtent[6] = { 8, 25, 0, 29, 5, 12 };
+  clipped->Clip(clipExtent);
+  success &= Compare("Clip", clipped, [&](int i, int j, int k) {
+    return in(a, i, j, k) && i >= 8 && i <= 25 && k >= 5 && k <= 12;
+  });
+
+  // all the stencils painted in one label map, the last one wins
+  vtkImageStencilData* stencils[4] = { a, b, c, d };
+  vtkNew<vtkImageStencilToLabelMap> labelMap;
+  for (vtkImageStencilData* stencil : stencils)
+  {
+    labelMap->AddStencilData(stencil);
+  }
+  labelMap->SetBackgroundValue(100);
+  labelMap->Update();
+  vtkImageData* output = labelMap->GetOutput();
+  int outExt[6];
+  output->GetExtent(outExt);
+  for (int i = 0; i < 6; ++i)
+  {
+    if (outExt[i] != Extent[i])
+    {
+      std::cerr << "Wrong label map extent" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  for (int k = Extent[4]; k <= Extent[5] && success; ++k)
+  {
+    for (int j = Extent[2]; j <= Extent[3] && success; ++j)
+    {
+      unsigned short* row = static_cast<unsigned short*>(output->GetScalarPointer(0, j, k));
+      for (int i = Extent[0]; i <= Extent[1]; ++i)
+      {
+        unsigned short expected = 100;
+        for (int s = 0; s < 4; ++s)
+        {
+          if (in(stencils[s], i, j, k))
+          {
+            expected = static_cast<unsigned short>(s + 1);
+          }
+        }
+        if (row[i] != expected)
+        {
+          std::cerr << "Label " << row[i] << " instead of " << expected << " at (" << i << ", "
+                    << j << ", " << k << ")" << std::endl;
+          success = false;
+          break;
+        }
+      }
+    }
+  }
+
+  return (success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,171 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkImageConvolutionInternals.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkImageConvolutionInternals.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// Convolve the output sample at input position p with the kernel weights
+// from jMin to jMax, where the kernel is indexed from its center.
+void vtkImageConvolutionSample(const double* input, vtkIdType count, double* output,
+  vtkIdType p, const double* kernel, int jMin, int jMax)
+{
+  if (count == 1)
+  {
+    const double* in = input + p;
+    double sum = 0.0;
+    for (int j = jMin; j <= jMax; ++j)
+    {
+      sum += kernel[j] * in[j];
+    }
+    *output = sum;
+  }
+  else
+  {
+    std::fill(output, output + count, 0.0);
+    for (int j = jMin; j <= jMax; ++j)
+    {
+      const double w = kernel[j];
+      const double* in = input + (p + j) * count;
+      for (vtkIdType k = 0; k < count; ++k)
+      {
+        output[k] += w * in[k];
+      }
+    }
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkImageConvolutionInternals::Convolve(const double* input, vtkIdType inputSize,
+  vtkIdType count, double* output, vtkIdType outputStart, vtkIdType outputSize,
+  const double* kernel, int radius, bool renormalize)
+{
+  // index the kernel from -radius to radius
+  const double* center = kernel + radius;
+  double kernelSum = 0.0;
+  for (int j = -radius; j <= radius; ++j)
+  {
+    kernelSum += center[j];
+  }
+
+  // the output samples whose kernel fits in the input
+  const vtkIdType interiorBegin =
+    std::min(std::max(radius - outputStart, vtkIdType(0)), outputSize);
+  const vtkIdType interiorEnd =
+    std::max(std::min(inputSize - radius - outputStart, outputSize), interiorBegin);
+
+  // the boundaries, with a clipped kernel
+  auto clipped = [&](vtkIdType i) {
+    const vtkIdType p = outputStart + i;
+    const int jMin = static_cast<int>(std::max(-static_cast<vtkIdType>(radius), -p));
+    const int jMax = static_cast<int>(std::min(static_cast<vtkIdType>(radius), inputSize - 1 - p));
+    double* out = output + i * count;
+    vtkImageConvolutionSample(input, count, out, p, center, jMin, jMax);
+    if (renormalize)
+    {
+      double used = 0.0;
+      for (int j = jMin; j <= jMax; ++j)
+      {
+        used += center[j];
+      }
+      if (used != 0.0)
+      {
+        const double scale = kernelSum / used;
+        for (vtkIdType k = 0; k < count; ++k)
+        {
+          out[k] *= scale;
+        }
+      }
+    }
+  };
+
+  for (vtkIdType i = 0; i < interiorBegin; ++i)
+  {
+    clipped(i);
+  }
+  for (vtkIdType i = interiorBegin; i < interiorEnd; ++i)
+  {
+    vtkImageConvolutionSample(
+      input, count, output + i * count, outputStart + i, center, -radius, radius);
+  }
+  for (vtkIdType i = interiorEnd; i < outputSize; ++i)
+  {
+    clipped(i);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkImageConvolutionInternals::RecursiveGaussian(
+  double* data, vtkIdType size, vtkIdType count, double sigma)
+{
+  if (sigma < 0.5 || size < 1)
+  {
+    return;
+  }
+
+  // the coefficients of Young and van Vliet
+  double q;
+  if (sigma >= 2.5)
+  {
+    q = 0.98711 * sigma - 0.96330;
+  }
+  else
+  {
+    q = 3.97156 - 4.14554 * std::sqrt(1.0 - 0.26891 * sigma);
+  }
+  const double q2 = q * q;
+  const double q3 = q2 * q;
+  const double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+  const double a1 = (2.44413 * q + 2.85619 * q2 + 1.26661 * q3) / b0;
+  const double a2 = -(1.4281 * q2 + 1.26661 * q3) / b0;
+  const double a3 = 0.422205 * q3 / b0;
+  const double b = 1.0 - (a1 + a2 + a3);
+
+  // a constant line is its own steady state, so the samples before the
+  // line are initialized with the first one, and those after the line
+  // with the last result of the causal pass
+  std::vector<double> edge(data, data + count);
+  for (vtkIdType n = 0; n < size; ++n)
+  {
+    double* x = data + n * count;
+    const double* w1 = (n >= 1 ? x - count : edge.data());
+    const double* w2 = (n >= 2 ? x - 2 * count : edge.data());
+    const double* w3 = (n >= 3 ? x - 3 * count : edge.data());
+    for (vtkIdType k = 0; k < count; ++k)
+    {
+      x[k] = b * x[k] + a1 * w1[k] + a2 * w2[k] + a3 * w3[k];
+    }
+  }
+
+  std::copy(data + (size - 1) * count, data + size * count, edge.begin());
+  for (vtkIdType n = size - 1; n >= 0; --n)
+  {
+    double* x = data + n * count;
+    const double* y1 = (n + 1 < size ? x + count : edge.data());
+    const double* y2 = (n + 2 < size ? x + 2 * count : edge.data());
+    const double* y3 = (n + 3 < size ? x + 3 * count : edge.data());
+    for (vtkIdType k = 0; k < count; ++k)
+    {
+      x[k] = b * x[k] + a1 * y1[k] + a2 * y2[k] + a3 * y3[k];
+    }
+  }
+}
+VTK_ABI_NAMESPACE_END
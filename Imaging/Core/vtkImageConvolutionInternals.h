@@ -0,0 +1,76 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkImageConvolutionInternals.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkImageConvolutionInternals
+ * @brief   Separable convolution code shared by the imaging filters
+ *
+ * vtkImageConvolutionInternals provides the one dimensional passes of
+ * separable image filters. Each pass works on a line of samples, where
+ * each sample is a group of "count" contiguous values that are filtered
+ * together. A line along the x axis is filtered one component at a time
+ * with a count of one. A line along the y or z axis is filtered as a
+ * line of whole x rows, with a count of the row length times the number
+ * of components: the inner loops then run over contiguous memory, which
+ * the compiler vectorizes, instead of striding through the image.
+ *
+ * The recursive gaussian is described in the following paper:
+ * [1] I.T. Young, L.J. van Vliet, "Recursive implementation of the
+ *     Gaussian filter," Signal Processing 44(2):139-151, 1995.
+ */
+
+#ifndef vtkImageConvolutionInternals_h
+#define vtkImageConvolutionInternals_h
+
+#include "vtkImagingCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIMAGINGCORE_EXPORT vtkImageConvolutionInternals
+{
+public:
+  /**
+   * Internal method.  Convolve a line of "inputSize" samples with a kernel
+   * of 2*radius+1 weights, whose center is kernel[radius].  Output sample i
+   * is computed at the position of input sample outputStart+i.  Near the
+   * ends of the line the kernel is clipped, and if renormalize is set, the
+   * result is scaled by the sum of the kernel over the sum of the weights
+   * that were used.  Samples whose kernel is not clipped are computed by a
+   * separate loop without any boundary checks.
+   */
+  static void Convolve(const double* input, vtkIdType inputSize, vtkIdType count, double* output,
+    vtkIdType outputStart, vtkIdType outputSize, const double* kernel, int radius,
+    bool renormalize);
+
+  /**
+   * Internal method.  Smooth a line of "size" samples in place with the
+   * recursive approximation of a gaussian of the given standard deviation,
+   * whose cost does not depend on the standard deviation.  The line is
+   * extended by repeating its end samples.  The approximation requires a
+   * standard deviation of at least 0.5, the line is left unchanged otherwise.
+   */
+  static void RecursiveGaussian(double* data, vtkIdType size, vtkIdType count, double sigma);
+
+protected:
+  vtkImageConvolutionInternals() = default;
+  ~vtkImageConvolutionInternals() = default;
+
+private:
+  vtkImageConvolutionInternals(const vtkImageConvolutionInternals&) = delete;
+  void operator=(const vtkImageConvolutionInternals&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkImageConvolutionInternals.h
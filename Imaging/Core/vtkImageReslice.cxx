@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkImageReslice.h"
 
+#include "vtkDataArray.h"
 #include "vtkGarbageCollector.h"
 #include "vtkImageData.h"
 #include "vtkImageInterpolator.h"
@@ -25,6 +26,7 @@
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 
@@ -37,6 +39,7 @@
 #undef VTK_USE_UINT64
 #define VTK_USE_UINT64 0
 
+#include <algorithm>
 #include <cfloat>
 #include <climits>
 #include <cmath>
@@ -150,6 +153,14 @@ vtkImageReslice::vtkImageReslice()
   // the output stencil
   this->GenerateStencilOutput = 0;
 
+  // no limit on the input size, so the output is not tiled
+  this->InputMemoryLimit = 0;
+  this->NumberOfTiles = 1;
+  this->TileDivisions[0] = 1;
+  this->TileDivisions[1] = 1;
+  this->TileDivisions[2] = 1;
+  this->CurrentTile = 0;
+
   // There is an optional second input (the stencil input)
   this->SetNumberOfInputPorts(2);
   // There is an optional second output (the stencil output)
@@ -236,6 +247,8 @@ void vtkImageReslice::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Stencil: " << this->GetStencil() << "\n";
   os << indent << "GenerateStencilOutput: " << (this->GenerateStencilOutput ? "On\n" : "Off\n");
   os << indent << "StencilOutput: " << this->GetStencilOutput() << "\n";
+  os << indent << "InputMemoryLimit: " << this->InputMemoryLimit << "\n";
+  os << indent << "NumberOfTiles: " << this->NumberOfTiles << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -547,33 +560,18 @@ void vtkImageReslice::ConvertScalars(void* vtkNotUsed(inPtr), void* vtkNotUsed(o
 }
 
 //------------------------------------------------------------------------------
-int vtkImageReslice::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
-  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+namespace
 {
-  int inExt[6], outExt[6];
-  vtkInformation* outInfo = outputVector->GetInformationObject(0);
-  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
-
-  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
-  this->HitInputExtent = 1;
-
-  if (this->ResliceTransform)
-  {
-    this->ResliceTransform->Update();
-    if (!this->ResliceTransform->IsA("vtkHomogeneousTransform"))
-    { // update the whole input extent if the transform is nonlinear
-      inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), inExt);
-      inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
-      return 1;
-    }
-  }
-
-  bool wrap = (this->Wrap || this->Mirror);
-
+//------------------------------------------------------------------------------
+// Compute the input extent that is needed to compute the given output
+// extent with the matrix that converts output indices to input indices,
+// and return false if the output extent does not hit the input at all.
+bool vtkImageResliceInputExtent(vtkMatrix4x4* matrix, const int supportSize[3], int slabSlices,
+  bool wrap, const int wholeExtent[6], const int outputExtent[6], int inExt[6])
+{
+  bool hit = true;
   double xAxis[4], yAxis[4], zAxis[4], origin[4];
 
-  vtkMatrix4x4* matrix = this->GetIndexMatrix(inInfo, outInfo);
-
   // convert matrix from world coordinates to pixel indices
   for (int i = 0; i < 4; i++)
   {
@@ -589,18 +587,17 @@ int vtkImageReslice::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
     inExt[2 * i + 1] = VTK_INT_MIN;
   }
 
-  if (this->SlabNumberOfSlices > 1)
+  int outExt[6];
+  for (int i = 0; i < 6; i++)
   {
-    outExt[4] -= (this->SlabNumberOfSlices + 1) / 2;
-    outExt[5] += (this->SlabNumberOfSlices + 1) / 2;
+    outExt[i] = outputExtent[i];
   }
 
-  // set the extent according to the interpolation kernel size
-  vtkAbstractImageInterpolator* interpolator = this->GetInterpolator();
-  double* elements = *matrix->Element;
-  elements = ((this->OptimizedTransform == nullptr) ? elements : nullptr);
-  int supportSize[3];
-  interpolator->ComputeSupportSize(elements, supportSize);
+  if (slabSlices > 1)
+  {
+    outExt[4] -= (slabSlices + 1) / 2;
+    outExt[5] += (slabSlices + 1) / 2;
+  }
 
   // check the coordinates of the 8 corners of the output extent
   // (this must be done exactly the same as the calculation in
@@ -675,9 +672,6 @@ int vtkImageReslice::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
   }
 
   // Clip to whole extent, make sure we hit the extent
-  int wholeExtent[6];
-  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
-
   for (int k = 0; k < 3; k++)
   {
     if (inExt[2 * k] < wholeExtent[2 * k])
@@ -691,7 +685,7 @@ int vtkImageReslice::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
       {
         // didn't hit any of the input extent
         inExt[2 * k + 1] = wholeExtent[2 * k];
-        this->HitInputExtent = 0;
+        hit = false;
       }
     }
     if (inExt[2 * k + 1] > wholeExtent[2 * k + 1])
@@ -710,23 +704,163 @@ int vtkImageReslice::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
         {
           inExt[2 * k] = wholeExtent[2 * k];
         }
-        this->HitInputExtent = 0;
+        hit = false;
       }
     }
   }
 
+  return hit;
+}
+}
+
+//------------------------------------------------------------------------------
+int vtkImageReslice::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  int inExt[6], outExt[6];
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+  this->HitInputExtent = 1;
+
+  if (this->ResliceTransform)
+  {
+    this->ResliceTransform->Update();
+    if (!this->ResliceTransform->IsA("vtkHomogeneousTransform"))
+    { // update the whole input extent if the transform is nonlinear
+      inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), inExt);
+      inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
+      this->NumberOfTiles = 1;
+      return 1;
+    }
+  }
+
+  bool wrap = (this->Wrap || this->Mirror);
+
+  vtkMatrix4x4* matrix = this->GetIndexMatrix(inInfo, outInfo);
+
+  // set the extent according to the interpolation kernel size
+  vtkAbstractImageInterpolator* interpolator = this->GetInterpolator();
+  double* elements = *matrix->Element;
+  elements = ((this->OptimizedTransform == nullptr) ? elements : nullptr);
+  int supportSize[3];
+  interpolator->ComputeSupportSize(elements, supportSize);
+
+  // divide the output into tiles when the update starts, and then request
+  // only the input that is needed for the tile that will be executed next
+  if (this->CurrentTile == 0)
+  {
+    this->ComputeTileDivisions(inInfo, matrix, supportSize, outExt);
+  }
+  int tileExt[6];
+  this->GetTileExtent(outExt, this->CurrentTile, tileExt);
+
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  this->HitInputExtent = vtkImageResliceInputExtent(
+    matrix, supportSize, this->SlabNumberOfSlices, wrap, wholeExtent, tileExt, inExt);
+
   inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
 
   // need to set the stencil update extent to the output extent
   if (this->GetNumberOfInputConnections(1) > 0)
   {
     vtkInformation* stencilInfo = inputVector[1]->GetInformationObject(0);
-    stencilInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt, 6);
+    stencilInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), tileExt, 6);
   }
 
   return 1;
 }
 
+//------------------------------------------------------------------------------
+void vtkImageReslice::ComputeTileDivisions(
+  vtkInformation* inInfo, vtkMatrix4x4* matrix, const int supportSize[3], const int outExt[6])
+{
+  this->TileDivisions[0] = 1;
+  this->TileDivisions[1] = 1;
+  this->TileDivisions[2] = 1;
+  this->NumberOfTiles = 1;
+
+  if (this->InputMemoryLimit == 0 || outExt[0] > outExt[1] || outExt[2] > outExt[3] ||
+    outExt[4] > outExt[5])
+  {
+    return;
+  }
+
+  bool wrap = (this->Wrap || this->Mirror);
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  double voxelSize = vtkDataArray::GetDataTypeSize(vtkImageData::GetScalarType(inInfo)) *
+    vtkImageData::GetNumberOfScalarComponents(inInfo);
+  double limit = 1024.0 * this->InputMemoryLimit;
+
+  for (;;)
+  {
+    // find the largest input that is needed by any of the tiles, since
+    // the tiles need inputs of different sizes for perspective transforms
+    int numberOfTiles = this->TileDivisions[0] * this->TileDivisions[1] * this->TileDivisions[2];
+    double largest = 0.0;
+    for (int tile = 0; tile < numberOfTiles; tile++)
+    {
+      int tileExt[6], inExt[6];
+      this->GetTileExtent(outExt, tile, tileExt);
+      vtkImageResliceInputExtent(
+        matrix, supportSize, this->SlabNumberOfSlices, wrap, wholeExtent, tileExt, inExt);
+      double size = voxelSize * (inExt[1] - inExt[0] + 1.0) * (inExt[3] - inExt[2] + 1.0) *
+        (inExt[5] - inExt[4] + 1.0);
+      largest = (size > largest ? size : largest);
+    }
+
+    this->NumberOfTiles = numberOfTiles;
+    if (largest <= limit)
+    {
+      break;
+    }
+
+    // halve the tiles along the axis where they are longest
+    int axis = -1;
+    int longest = 1;
+    for (int i = 0; i < 3; i++)
+    {
+      int n = this->TileDivisions[i];
+      int length = (outExt[2 * i + 1] - outExt[2 * i] + n) / n;
+      if (length > longest)
+      {
+        longest = length;
+        axis = i;
+      }
+    }
+    if (axis < 0)
+    {
+      vtkWarningMacro("ComputeTileDivisions: the input that is needed for a single output voxel "
+                      "is larger than the InputMemoryLimit");
+      break;
+    }
+    int size = outExt[2 * axis + 1] - outExt[2 * axis] + 1;
+    this->TileDivisions[axis] = std::min(2 * this->TileDivisions[axis], size);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkImageReslice::GetTileExtent(const int outExt[6], int tile, int tileExt[6])
+{
+  // the tiles are numbered with x increasing fastest, so that the tiles
+  // along each output row are executed in order
+  int index[3];
+  index[0] = tile % this->TileDivisions[0];
+  index[1] = (tile / this->TileDivisions[0]) % this->TileDivisions[1];
+  index[2] = tile / (this->TileDivisions[0] * this->TileDivisions[1]);
+
+  for (int i = 0; i < 3; i++)
+  {
+    vtkIdType size = outExt[2 * i + 1] - outExt[2 * i] + 1;
+    vtkIdType n = this->TileDivisions[i];
+    tileExt[2 * i] = outExt[2 * i] + static_cast<int>(size * index[i] / n);
+    tileExt[2 * i + 1] = outExt[2 * i] + static_cast<int>(size * (index[i] + 1) / n) - 1;
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkImageReslice::FillInputPortInformation(int port, vtkInformation* info)
 {
@@ -3016,13 +3150,84 @@ int vtkImageReslice::RequestData(
   vtkInformation* info = inputVector[0]->GetInformationObject(0);
   interpolator->Initialize(info->Get(vtkDataObject::DATA_OBJECT()));
 
-  int rval = this->Superclass::RequestData(request, inputVector, outputVector);
+  int rval;
+  if (this->NumberOfTiles > 1)
+  {
+    rval = this->RequestTileData(request, inputVector, outputVector);
+  }
+  else
+  {
+    rval = this->Superclass::RequestData(request, inputVector, outputVector);
+  }
 
   interpolator->ReleaseData();
 
   return rval;
 }
 
+//------------------------------------------------------------------------------
+// Execute the current tile, the pipeline calls RequestData() once per tile
+// and the input holds only the part that is needed for this tile
+int vtkImageReslice::RequestTileData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkImageData* output = vtkImageData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+
+  int outExt[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+
+  // allocate the whole output for the first tile, and tell the pipeline
+  // to keep executing until all of the tiles are done
+  if (this->CurrentTile == 0)
+  {
+    this->AllocateOutputData(output, outInfo, outExt);
+    request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+  }
+
+  int tileExt[6];
+  this->GetTileExtent(outExt, this->CurrentTile, tileExt);
+
+  // the data objects, in the form expected by ThreadedRequestData()
+  vtkImageData* inputs[1] = { input };
+  vtkImageData** inData[2] = { inputs, nullptr };
+  vtkImageData* outData[2] = { output, nullptr };
+
+  // split the tile into pieces for the threads
+  int pieces = this->NumberOfThreads;
+  if (this->EnableSMP)
+  {
+    pieces = vtkSMPTools::GetEstimatedNumberOfThreads();
+  }
+  int splitExt[6];
+  pieces = this->SplitExtent(splitExt, tileExt, 0, pieces);
+
+  // always shut off debugging to avoid threading problems with GetMacros
+  bool debug = this->Debug;
+  this->Debug = false;
+  vtkSMPTools::For(0, pieces, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType piece = begin; piece < end; piece++)
+    {
+      int pieceExt[6];
+      this->SplitExtent(pieceExt, tileExt, static_cast<int>(piece), pieces);
+      this->ThreadedRequestData(request, inputVector, outputVector, inData, outData, pieceExt,
+        static_cast<int>(piece));
+    }
+  });
+  this->Debug = debug;
+
+  this->CurrentTile++;
+  if (this->CurrentTile == this->NumberOfTiles)
+  {
+    // tell the pipeline to stop looping
+    request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+    this->CurrentTile = 0;
+  }
+
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 // This method is passed a input and output region, and executes the filter
 // algorithm to fill the output from the input.
@@ -43,6 +43,11 @@
  * You can use both the ResliceAxes and the ResliceTransform at the
  * same time, in order to extract slices from a volume that you have
  * applied a transformation to.
+ * <p>4) Resampling of volumes that are too large to fit in memory.  If
+ * an InputMemoryLimit is set, the output is computed in tiles, and only
+ * the part of the input that is needed for each tile is requested from
+ * the pipeline.  A reader that supports streaming, combined with a writer
+ * that streams the output, can then reslice a volume of any size.
  * @warning
  * This filter is very inefficient if the output X dimension is 1.
  * @sa
@@ -493,6 +498,28 @@ public:
   void SetStencilOutput(vtkImageStencilData* stencil);
   ///@}
 
+  ///@{
+  /**
+   * Limit the size, in kibibytes, of the input that is requested for each
+   * execution.  When the input extent that is needed for the requested
+   * output is larger than this limit, the output is divided into tiles
+   * that are computed one after another, each from its own piece of the
+   * input, through the pipeline's streaming loop.  The default value of
+   * zero means no limit.  Tiling is only possible for linear transforms,
+   * since nonlinear transforms always need the whole input.  Only the
+   * scalars are produced when the output is tiled, the other point data
+   * arrays of the input are not passed to the output.
+   */
+  vtkSetMacro(InputMemoryLimit, unsigned long);
+  vtkGetMacro(InputMemoryLimit, unsigned long);
+  ///@}
+
+  /**
+   * Get the number of tiles that were used to compute the output at the
+   * last update.  This is one unless an InputMemoryLimit is set.
+   */
+  vtkGetMacro(NumberOfTiles, int);
+
 protected:
   vtkImageReslice();
   ~vtkImageReslice() override;
@@ -529,6 +556,10 @@ protected:
   int ComputeOutputOrigin;
   int ComputeOutputExtent;
   vtkTypeBool GenerateStencilOutput;
+  unsigned long InputMemoryLimit;
+  int NumberOfTiles;
+  int TileDivisions[3];
+  int CurrentTile;
 
   vtkMatrix4x4* IndexMatrix;
   vtkAbstractTransform* OptimizedTransform;
@@ -585,6 +616,23 @@ protected:
   vtkMatrix4x4* GetIndexMatrix(vtkInformation* inInfo, vtkInformation* outInfo);
   vtkAbstractTransform* GetOptimizedTransform() { return this->OptimizedTransform; }
 
+  /**
+   * Divide the output extent into the smallest number of tiles for which
+   * the needed input fits within the InputMemoryLimit.
+   */
+  void ComputeTileDivisions(vtkInformation* inInfo, vtkMatrix4x4* matrix,
+    const int supportSize[3], const int outExt[6]);
+
+  /**
+   * Compute the output tile that is executed by the current iteration.
+   */
+  void GetTileExtent(const int outExt[6], int tile, int tileExt[6]);
+
+  /**
+   * Execute one tile, after allocating the whole output for the first.
+   */
+  int RequestTileData(vtkInformation*, vtkInformationVector**, vtkInformationVector*);
+
 private:
   vtkImageReslice(const vtkImageReslice&) = delete;
   void operator=(const vtkImageReslice&) = delete;
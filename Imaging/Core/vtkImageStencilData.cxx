@@ -22,8 +22,10 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -867,11 +869,17 @@ void vtkImageStencilData::LogicalOperationInPlace(vtkImageStencilData* stencil,
     }
   }
 
-  // Iterate over the intersected extent
-  for (int idz = extent[4]; idz <= extent[5]; idz++)
-  {
-    for (int idy = extent[2]; idy <= extent[3]; idy++)
+  // Iterate over the rows of the intersected extent, which are independent
+  const int numRowsY = extent[3] - extent[2] + 1;
+  const vtkIdType numRows = (extent[2] <= extent[3] && extent[4] <= extent[5])
+    ? static_cast<vtkIdType>(numRowsY) * (extent[5] - extent[4] + 1)
+    : 0;
+  vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; ++row)
     {
+      int idy = extent[2] + static_cast<int>(row % numRowsY);
+      int idz = extent[4] + static_cast<int>(row / numRowsY);
+
       int incr = vtkImageStencilDataIndex(stencil->Extent, idy, idz);
       int clistlen2 = stencil->ExtentListLengths[incr];
       int* clist2 = stencil->ExtentLists[incr];
@@ -910,7 +918,7 @@ void vtkImageStencilData::LogicalOperationInPlace(vtkImageStencilData* stencil,
         delete[] clist1;
       }
     }
-  }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -962,7 +970,7 @@ void vtkImageStencilData::Subtract(vtkImageStencilData* stencil1)
 //------------------------------------------------------------------------------
 void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
 {
-  int extent[6], extent1[6], extent2[6], r1, r2, idy, idz, iter = 0;
+  int extent[6], extent1[6], extent2[6];
   stencil1->GetExtent(extent1);
   this->GetExtent(extent2);
 
@@ -981,10 +989,16 @@ void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
   extent[4] = (extent1[4] < extent2[4]) ? extent2[4] : extent1[4];
   extent[5] = (extent1[5] > extent2[5]) ? extent2[5] : extent1[5];
 
-  for (idz = extent[4]; idz <= extent[5]; idz++, iter = 0)
-  {
-    for (idy = extent[2]; idy <= extent[3]; idy++, iter = 0)
+  // Replace each row of the intersected extent, the rows are independent
+  const int numRowsY = extent[3] - extent[2] + 1;
+  const vtkIdType numRows = static_cast<vtkIdType>(numRowsY) * (extent[5] - extent[4] + 1);
+  vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; ++row)
     {
+      int idy = extent[2] + static_cast<int>(row % numRowsY);
+      int idz = extent[4] + static_cast<int>(row / numRowsY);
+      int r1, r2, iter = 0;
+
       this->RemoveExtent(extent[0], extent[1], idy, idz);
 
       int moreSubExtents = 1;
@@ -998,7 +1012,7 @@ void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
         }
       }
     }
-  }
+  });
 
   this->Modified();
 }
@@ -1021,13 +1035,14 @@ int vtkImageStencilData::Clip(int extent[6])
   int** lists = this->ExtentLists;
   int* smallstore = &listLengths[numberOfEntries];
 
-  // Perform the clip
-  bool modified = false;
-  int k = 0;
-  for (int idz = currentExtent[4]; idz <= currentExtent[5]; idz++)
-  {
-    for (int idy = currentExtent[2]; idy <= currentExtent[3]; idy++)
+  // Perform the clip, row by row
+  std::atomic<bool> modified(false);
+  const int numRowsY = currentExtent[3] - currentExtent[2] + 1;
+  vtkSMPTools::For(0, numberOfEntries, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType k = begin; k < end; ++k)
     {
+      int idy = currentExtent[2] + static_cast<int>(k % numRowsY);
+      int idz = currentExtent[4] + static_cast<int>(k / numRowsY);
       if (idy >= extent[2] && idy <= extent[3] && idz >= extent[4] && idz <= extent[5])
       {
         if (extent[0] > currentExtent[0] || extent[1] < currentExtent[1])
@@ -1051,11 +1066,10 @@ int vtkImageStencilData::Clip(int extent[6])
         }
         modified = true;
       }
-      k++;
     }
-  }
+  });
 
-  return modified;
+  return modified.load();
 }
 
 //------------------------------------------------------------------------------
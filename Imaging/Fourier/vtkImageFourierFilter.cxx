@@ -14,8 +14,11 @@
 =========================================================================*/
 #include "vtkImageFourierFilter.h"
 
+#include "vtkFFT.h"
 #include "vtkMath.h"
+
 #include <cmath>
+#include <vector>
 
 /*=========================================================================
         Vectors of complex numbers.
@@ -208,22 +211,54 @@ void vtkImageFourierFilter::ExecuteFftForwardBackward(
   }
 }
 
+//------------------------------------------------------------------------------
+// Compute the transform of an array with the plans of vtkFFT, which are
+// cached by size and handle any size efficiently.
+static void vtkImageFourierFilterExecute(
+  vtkImageComplex* in, vtkImageComplex* out, int N, bool inverse)
+{
+  if (N <= 1)
+  {
+    if (N == 1)
+    {
+      *out = *in;
+    }
+    return;
+  }
+  std::vector<vtkFFT::ComplexNumber> input(N);
+  std::vector<vtkFFT::ComplexNumber> output(N);
+  for (int idx = 0; idx < N; ++idx)
+  {
+    input[idx].r = static_cast<vtkFFT::ScalarNumber>(in[idx].Real);
+    input[idx].i = static_cast<vtkFFT::ScalarNumber>(in[idx].Imag);
+  }
+  if (inverse)
+  {
+    vtkFFT::IFft(input.data(), N, output.data());
+  }
+  else
+  {
+    vtkFFT::Fft(input.data(), N, output.data());
+  }
+  for (int idx = 0; idx < N; ++idx)
+  {
+    out[idx].Real = static_cast<double>(output[idx].r);
+    out[idx].Imag = static_cast<double>(output[idx].i);
+  }
+}
+
 //------------------------------------------------------------------------------
 // This function calculates the whole fft of an array.
-// The contents of the input array are changed.
-// (It is engineered for no decimation)
 void vtkImageFourierFilter::ExecuteFft(vtkImageComplex* in, vtkImageComplex* out, int N)
 {
-  this->ExecuteFftForwardBackward(in, out, N, 1);
+  vtkImageFourierFilterExecute(in, out, N, false);
 }
 
 //------------------------------------------------------------------------------
-// This function calculates the whole fft of an array.
-// The contents of the input array are changed.
-// (It is engineered for no decimation)
+// This function calculates the whole inverse fft of an array.
 void vtkImageFourierFilter::ExecuteRfft(vtkImageComplex* in, vtkImageComplex* out, int N)
 {
-  this->ExecuteFftForwardBackward(in, out, N, -1);
+  vtkImageFourierFilterExecute(in, out, N, true);
 }
 
 //------------------------------------------------------------------------------
@@ -116,15 +116,13 @@ public:
 
   /**
    * This function calculates the whole fft of an array.
-   * The contents of the input array are changed.
-   * (It is engineered for no decimation)
+   * It uses the cached plans of vtkFFT, which are fast for any size.
    */
   void ExecuteFft(vtkImageComplex* in, vtkImageComplex* out, int N);
 
   /**
-   * This function calculates the whole fft of an array.
-   * The contents of the input array are changed.
-   * (It is engineered for no decimation)
+   * This function calculates the whole inverse fft of an array,
+   * scaled by 1/N. It uses the cached plans of vtkFFT.
    */
   void ExecuteRfft(vtkImageComplex* in, vtkImageComplex* out, int N);
 
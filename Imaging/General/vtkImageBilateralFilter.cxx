@@ -0,0 +1,250 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkImageBilateralFilter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkImageBilateralFilter.h"
+
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkImageBilateralFilter);
+
+namespace
+{
+// Filter the voxels of the region, with the neighbors that are within the
+// extent of the input. Both images are double and have the same extent.
+void vtkImageBilateralFilterIterate(vtkImageData* inData, vtkImageData* outData,
+  const int region[6], const int radius[3], const double* kernel, double rangeFactor)
+{
+  int inExt[6];
+  vtkIdType inc[3];
+  inData->GetExtent(inExt);
+  inData->GetIncrements(inc);
+  const int numComps = inData->GetNumberOfScalarComponents();
+  const double* inPtr = static_cast<double*>(inData->GetScalarPointer());
+  double* outPtr = static_cast<double*>(outData->GetScalarPointer());
+  const int kernelDims[2] = { 2 * radius[0] + 1, 2 * radius[1] + 1 };
+
+  for (int k = region[4]; k <= region[5]; ++k)
+  {
+    const int kMin = std::max(k - radius[2], inExt[4]);
+    const int kMax = std::min(k + radius[2], inExt[5]);
+    for (int j = region[2]; j <= region[3]; ++j)
+    {
+      const int jMin = std::max(j - radius[1], inExt[2]);
+      const int jMax = std::min(j + radius[1], inExt[3]);
+      for (int i = region[0]; i <= region[1]; ++i)
+      {
+        const int iMin = std::max(i - radius[0], inExt[0]);
+        const int iMax = std::min(i + radius[0], inExt[1]);
+        const vtkIdType offset =
+          (i - inExt[0]) * inc[0] + (j - inExt[2]) * inc[1] + (k - inExt[4]) * inc[2];
+        for (int c = 0; c < numComps; ++c)
+        {
+          const double center = inPtr[offset + c];
+          double sum = 0.0;
+          double weights = 0.0;
+          for (int kk = kMin; kk <= kMax; ++kk)
+          {
+            for (int jj = jMin; jj <= jMax; ++jj)
+            {
+              const double* kernelRow = kernel +
+                ((kk - k + radius[2]) * kernelDims[1] + (jj - j + radius[1])) * kernelDims[0] +
+                radius[0];
+              const double* inRow =
+                inPtr + (jj - inExt[2]) * inc[1] + (kk - inExt[4]) * inc[2] + c;
+              for (int ii = iMin; ii <= iMax; ++ii)
+              {
+                const double value = inRow[(ii - inExt[0]) * inc[0]];
+                const double diff = value - center;
+                const double w = kernelRow[ii - i] * std::exp(rangeFactor * diff * diff);
+                sum += w * value;
+                weights += w;
+              }
+            }
+          }
+          outPtr[offset + c] = sum / weights;
+        }
+      }
+    }
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+vtkImageBilateralFilter::vtkImageBilateralFilter()
+{
+  this->StandardDeviations[0] = 1.5;
+  this->StandardDeviations[1] = 1.5;
+  this->StandardDeviations[2] = 1.5;
+  this->RadiusFactor = 2.0;
+  this->RangeStandardDeviation = 10.0;
+  this->NumberOfIterations = 1;
+}
+
+//------------------------------------------------------------------------------
+vtkImageBilateralFilter::~vtkImageBilateralFilter() = default;
+
+//------------------------------------------------------------------------------
+void vtkImageBilateralFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "StandardDeviations: ( " << this->StandardDeviations[0] << ", "
+     << this->StandardDeviations[1] << ", " << this->StandardDeviations[2] << " )\n";
+  os << indent << "RadiusFactor: " << this->RadiusFactor << "\n";
+  os << indent << "RangeStandardDeviation: " << this->RangeStandardDeviation << "\n";
+  os << indent << "NumberOfIterations: " << this->NumberOfIterations << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkImageBilateralFilter::ComputeRadius(int radius[3])
+{
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    radius[axis] =
+      static_cast<int>(std::max(this->StandardDeviations[axis], 0.0) * this->RadiusFactor);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkImageBilateralFilter::ComputeSpatialKernel(const int radius[3], double* kernel)
+{
+  // the factors of the squared distances along each axis
+  double factors[3];
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double sigma = this->StandardDeviations[axis];
+    factors[axis] = (radius[axis] > 0 ? -0.5 / (sigma * sigma) : 0.0);
+  }
+
+  for (int k = -radius[2]; k <= radius[2]; ++k)
+  {
+    for (int j = -radius[1]; j <= radius[1]; ++j)
+    {
+      for (int i = -radius[0]; i <= radius[0]; ++i)
+      {
+        *kernel++ = std::exp(factors[0] * i * i + factors[1] * j * j + factors[2] * k * k);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+double vtkImageBilateralFilter::ComputeRangeFactor()
+{
+  const double sigma = this->RangeStandardDeviation;
+  return (sigma > 0.0 ? -0.5 / (sigma * sigma) : -VTK_DOUBLE_MAX);
+}
+
+//------------------------------------------------------------------------------
+void vtkImageBilateralFilter::InternalRequestUpdateExtent(
+  int* inExt, const int* outExt, const int* wholeExt)
+{
+  int radius[3];
+  this->ComputeRadius(radius);
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const int border = radius[axis] * this->NumberOfIterations;
+    inExt[2 * axis] = std::max(outExt[2 * axis] - border, wholeExt[2 * axis]);
+    inExt[2 * axis + 1] = std::min(outExt[2 * axis + 1] + border, wholeExt[2 * axis + 1]);
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkImageBilateralFilter::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+
+  int outExt[6], wholeExt[6], inExt[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExt);
+  this->InternalRequestUpdateExtent(inExt, outExt, wholeExt);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+// Each iteration filters a region that shrinks towards the output extent,
+// since the voxels beyond it are not needed by the following iterations.
+void vtkImageBilateralFilter::ThreadedRequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector),
+  vtkImageData*** inData, vtkImageData** outData, int outExt[6], int id)
+{
+  // this filter expects that input is the same type as output.
+  if (inData[0][0]->GetScalarType() != outData[0]->GetScalarType())
+  {
+    vtkErrorMacro("Execute: input ScalarType, " << inData[0][0]->GetScalarType()
+                                                << ", must match out ScalarType "
+                                                << outData[0]->GetScalarType());
+    return;
+  }
+
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  int wholeExt[6], inExt[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExt);
+  this->InternalRequestUpdateExtent(inExt, outExt, wholeExt);
+
+  int radius[3];
+  this->ComputeRadius(radius);
+  std::vector<double> kernel(
+    static_cast<size_t>(2 * radius[0] + 1) * (2 * radius[1] + 1) * (2 * radius[2] + 1));
+  this->ComputeSpatialKernel(radius, kernel.data());
+  const double rangeFactor = this->ComputeRangeFactor();
+
+  // the iterations go back and forth between two double images
+  const int numComps = inData[0][0]->GetNumberOfScalarComponents();
+  vtkSmartPointer<vtkImageData> in = vtkSmartPointer<vtkImageData>::New();
+  in->SetExtent(inExt);
+  in->AllocateScalars(VTK_DOUBLE, numComps);
+  in->CopyAndCastFrom(inData[0][0], inExt);
+  vtkSmartPointer<vtkImageData> out = vtkSmartPointer<vtkImageData>::New();
+  out->SetExtent(inExt);
+  out->AllocateScalars(VTK_DOUBLE, numComps);
+
+  for (int iter = 0; !this->AbortExecute && iter < this->NumberOfIterations; ++iter)
+  {
+    if (!id)
+    {
+      this->UpdateProgress(static_cast<double>(iter) / this->NumberOfIterations);
+    }
+
+    int region[6];
+    const int remaining = this->NumberOfIterations - 1 - iter;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      region[2 * axis] = std::max(outExt[2 * axis] - radius[axis] * remaining, inExt[2 * axis]);
+      region[2 * axis + 1] =
+        std::min(outExt[2 * axis + 1] + radius[axis] * remaining, inExt[2 * axis + 1]);
+    }
+
+    vtkImageBilateralFilterIterate(in, out, region, radius, kernel.data(), rangeFactor);
+    std::swap(in, out);
+  }
+
+  outData[0]->CopyAndCastFrom(in, outExt);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,126 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkImageBilateralFilter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkImageBilateralFilter
+ * @brief   Edge preserving smoothing with a bilateral filter.
+ *
+ * vtkImageBilateralFilter replaces each voxel by an average of its
+ * neighbors, weighted by a gaussian of their distance to the voxel (in
+ * pixel units) and by a gaussian of the difference between their values
+ * and the value of the voxel. Neighbors across an edge have very different
+ * values and contribute little, so that the noise is smoothed while the
+ * edges are kept. Each component is filtered on its own. The kernel is
+ * clipped at the boundaries of the whole extent, and the weights are
+ * normalized over the remaining neighbors. The filter can be iterated,
+ * each iteration filtering the result of the previous one.
+ * @sa
+ * vtkImageGaussianSmooth vtkImageAnisotropicDiffusion3D
+ */
+
+#ifndef vtkImageBilateralFilter_h
+#define vtkImageBilateralFilter_h
+
+#include "vtkImagingGeneralModule.h" // For export macro
+#include "vtkThreadedImageAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIMAGINGGENERAL_EXPORT vtkImageBilateralFilter : public vtkThreadedImageAlgorithm
+{
+public:
+  static vtkImageBilateralFilter* New();
+  vtkTypeMacro(vtkImageBilateralFilter, vtkThreadedImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the standard deviations of the spatial gaussian in pixel units.
+   * A standard deviation of zero does not filter along that axis. The
+   * default is 1.5 along each axis.
+   */
+  vtkSetVector3Macro(StandardDeviations, double);
+  void SetStandardDeviation(double std) { this->SetStandardDeviations(std, std, std); }
+  vtkGetVector3Macro(StandardDeviations, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the radius of the kernel as a multiple of the standard
+   * deviations. The default is 2.
+   */
+  vtkSetClampMacro(RadiusFactor, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(RadiusFactor, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the standard deviation of the gaussian of the differences of
+   * values, in the units of the scalars. Differences that are larger than
+   * a few times this value are considered to be edges. If zero, only the
+   * neighbors with the same value as the voxel are averaged. The default
+   * is 10.
+   */
+  vtkSetClampMacro(RangeStandardDeviation, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(RangeStandardDeviation, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of times that the filter is applied. The input
+   * extent that is needed for an output extent grows with the number of
+   * iterations. The default is 1.
+   */
+  vtkSetClampMacro(NumberOfIterations, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfIterations, int);
+  ///@}
+
+protected:
+  vtkImageBilateralFilter();
+  ~vtkImageBilateralFilter() override;
+
+  /**
+   * Compute the radius of the kernel along each axis.
+   */
+  void ComputeRadius(int radius[3]);
+
+  /**
+   * Compute the weights of the spatial gaussian for a kernel of the given
+   * radius, with x increasing fastest.
+   */
+  void ComputeSpatialKernel(const int radius[3], double* kernel);
+
+  /**
+   * Compute the factor of the squared difference of values in the exponent
+   * of the range gaussian.
+   */
+  double ComputeRangeFactor();
+
+  void InternalRequestUpdateExtent(int* inExt, const int* outExt, const int* wholeExt);
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  void ThreadedRequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector, vtkImageData*** inData, vtkImageData** outData,
+    int outExt[6], int id) override;
+
+  double StandardDeviations[3];
+  double RadiusFactor;
+  double RangeStandardDeviation;
+  int NumberOfIterations;
+
+private:
+  vtkImageBilateralFilter(const vtkImageBilateralFilter&) = delete;
+  void operator=(const vtkImageBilateralFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
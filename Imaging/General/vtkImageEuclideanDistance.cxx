@@ -14,13 +14,27 @@
 =========================================================================*/
 #include "vtkImageEuclideanDistance.h"
 
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
+#include <vector>
+
+namespace
+{
+// Squared distances of the voxels that are zero to the non-zero voxels,
+// carried between the iterations for SignedDistance.
+const char* ComplementArrayName = "vtkImageEuclideanDistanceComplement";
+const char* FeatureArrayName = "ClosestFeatureIds";
+}
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageEuclideanDistance);
@@ -33,6 +47,8 @@ vtkImageEuclideanDistance::vtkImageEuclideanDistance()
   this->Initialize = 1;
   this->ConsiderAnisotropy = 1;
   this->Algorithm = VTK_EDT_SAITO;
+  this->SignedDistance = 0;
+  this->GenerateClosestFeatureIds = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -612,6 +628,118 @@ static void vtkImageEuclideanDistanceExecuteSaitoCached(
   free(temp);
   free(sq);
 }
+//------------------------------------------------------------------------------
+// Transform the squared distances of one row with the lower envelope of the
+// parabolas rooted at each voxel, and propagate the closest features if
+// "featurePtr" is not null. The buffers hold at least n values, n + 1 for z.
+static void vtkImageEuclideanDistanceTransformRow(double* ptr, vtkIdType inc, int n, double w,
+  double maxDist, double* f, double* z, int* v, vtkIdType* featurePtr, vtkIdType* features)
+{
+  for (int q = 0; q < n; ++q)
+  {
+    f[q] = ptr[q * inc];
+    if (featurePtr)
+    {
+      features[q] = featurePtr[q * inc];
+    }
+  }
+
+  // compute the lower envelope, v holds the roots of its parabolas and z
+  // the boundaries between them
+  int k = 0;
+  v[0] = 0;
+  z[0] = -VTK_DOUBLE_MAX;
+  z[1] = VTK_DOUBLE_MAX;
+  for (int q = 1; q < n; ++q)
+  {
+    double s;
+    while (true)
+    {
+      const int p = v[k];
+      s = ((f[q] + w * q * q) - (f[p] + w * p * p)) / (2.0 * w * (q - p));
+      if (s > z[k])
+      {
+        break;
+      }
+      --k;
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = VTK_DOUBLE_MAX;
+  }
+
+  // sample the lower envelope
+  k = 0;
+  for (int q = 0; q < n; ++q)
+  {
+    while (z[k + 1] < q)
+    {
+      ++k;
+    }
+    const int p = v[k];
+    const double dist = w * (q - p) * (q - p) + f[p];
+    ptr[q * inc] = (dist < maxDist ? dist : maxDist);
+    if (featurePtr)
+    {
+      featurePtr[q * inc] = features[p];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Execute the algorithm of Felzenszwalb and Huttenlocher along the axis of
+// the current iteration, with several threads over the rows.
+//
+// P. F. Felzenszwalb and D. P. Huttenlocher. Distance Transforms of Sampled
+// Functions. Theory of Computing, 8(19). pp. 415--428, 2012.
+//
+// The squared distances of the complement are transformed too if
+// "complementPtr" is not null, and the closest features are propagated if
+// "featurePtr" is not null.
+static void vtkImageEuclideanDistanceExecuteFelzenszwalb(vtkImageEuclideanDistance* self,
+  vtkImageData* outData, int outExt[6], double* outPtr, double* complementPtr,
+  vtkIdType* featurePtr)
+{
+  int outMin0, outMax0, outMin1, outMax1, outMin2, outMax2;
+  vtkIdType outInc0, outInc1, outInc2;
+
+  // Reorder axes
+  self->PermuteExtent(outExt, outMin0, outMax0, outMin1, outMax1, outMin2, outMax2);
+  self->PermuteIncrements(outData->GetIncrements(), outInc0, outInc1, outInc2);
+
+  const int inSize0 = outMax0 - outMin0 + 1;
+  const vtkIdType inSize1 = outMax1 - outMin1 + 1;
+  const vtkIdType numRows = inSize1 * (outMax2 - outMin2 + 1);
+  const double maxDist = self->GetMaximumDistance();
+
+  double spacing = 1.0;
+  if (self->GetConsiderAnisotropy())
+  {
+    spacing = outData->GetSpacing()[self->GetIteration()];
+  }
+  const double w = spacing * spacing;
+
+  vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<double> f(inSize0);
+    std::vector<double> z(inSize0 + 1);
+    std::vector<int> v(inSize0);
+    std::vector<vtkIdType> features(featurePtr ? inSize0 : 0);
+    for (vtkIdType row = begin; row < end; ++row)
+    {
+      const vtkIdType offset = (row % inSize1) * outInc1 + (row / inSize1) * outInc2;
+      vtkImageEuclideanDistanceTransformRow(outPtr + offset, outInc0, inSize0, w, maxDist,
+        f.data(), z.data(), v.data(), (featurePtr ? featurePtr + offset : nullptr),
+        features.data());
+      if (complementPtr)
+      {
+        vtkImageEuclideanDistanceTransformRow(complementPtr + offset, outInc0, inSize0, w,
+          maxDist, f.data(), z.data(), v.data(), nullptr, nullptr);
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 void vtkImageEuclideanDistance::AllocateOutputScalars(
   vtkImageData* outData, int outExt[6], vtkInformation* outInfo)
@@ -696,6 +824,71 @@ int vtkImageEuclideanDistance::IterativeRequestData(vtkInformation* vtkNotUsed(r
       }
   }
 
+  // The Felzenszwalb algorithm also transforms the complement for signed
+  // distances and propagates the closest features, in arrays that are
+  // passed from one iteration to the next.
+  bool felzenszwalb = (this->Algorithm == VTK_EDT_FELZENSZWALB);
+  bool signedDistance = (felzenszwalb && this->SignedDistance && this->Initialize);
+  bool featureIds = (felzenszwalb && this->GenerateClosestFeatureIds);
+  vtkPointData* outPD = outData->GetPointData();
+  outPD->RemoveArray(ComplementArrayName);
+  outPD->RemoveArray(FeatureArrayName);
+  vtkDoubleArray* complement = nullptr;
+  vtkIdTypeArray* features = nullptr;
+  if (this->GetIteration() == 0)
+  {
+    vtkIdType numPts = outData->GetNumberOfPoints();
+    double* distPtr = static_cast<double*>(outPtr);
+    double maxDist = this->MaximumDistance;
+    if (signedDistance)
+    {
+      vtkNew<vtkDoubleArray> array;
+      array->SetName(ComplementArrayName);
+      array->SetNumberOfValues(numPts);
+      double* complementPtr = array->GetPointer(0);
+      vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          complementPtr[i] = (distPtr[i] == 0 ? maxDist : 0.0);
+        }
+      });
+      outPD->AddArray(array);
+      complement = array;
+    }
+    if (featureIds)
+    {
+      vtkNew<vtkIdTypeArray> array;
+      array->SetName(FeatureArrayName);
+      array->SetNumberOfValues(numPts);
+      vtkIdType* featurePtr = array->GetPointer(0);
+      vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          featurePtr[i] = (distPtr[i] == 0 ? i : -1);
+        }
+      });
+      outPD->AddArray(array);
+      features = array;
+    }
+  }
+  else
+  {
+    // the arrays of the previous iteration are transformed in place
+    vtkPointData* inPD = inData->GetPointData();
+    complement = (signedDistance ? vtkDoubleArray::SafeDownCast(inPD->GetArray(ComplementArrayName))
+                                 : nullptr);
+    features =
+      (featureIds ? vtkIdTypeArray::SafeDownCast(inPD->GetArray(FeatureArrayName)) : nullptr);
+    if (complement)
+    {
+      outPD->AddArray(complement);
+    }
+    if (features)
+    {
+      outPD->AddArray(features);
+    }
+  }
+
   // Call the specific algorithms.
   switch (this->GetAlgorithm())
   {
@@ -706,10 +899,33 @@ int vtkImageEuclideanDistance::IterativeRequestData(vtkInformation* vtkNotUsed(r
       vtkImageEuclideanDistanceExecuteSaitoCached(
         this, outData, outExt, static_cast<double*>(outPtr));
       break;
+    case VTK_EDT_FELZENSZWALB:
+      vtkImageEuclideanDistanceExecuteFelzenszwalb(this, outData, outExt,
+        static_cast<double*>(outPtr), (complement ? complement->GetPointer(0) : nullptr),
+        (features ? features->GetPointer(0) : nullptr));
+      break;
     default:
       vtkErrorMacro(<< "Execute: Unknown Algorithm");
   }
 
+  // After the last axis, the zero voxels get the negative of their distance
+  // to the non-zero voxels.
+  if (complement && this->GetIteration() == this->GetNumberOfIterations() - 1)
+  {
+    double* distPtr = static_cast<double*>(outPtr);
+    const double* complementPtr = complement->GetPointer(0);
+    vtkSMPTools::For(0, outData->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        if (distPtr[i] == 0)
+        {
+          distPtr[i] = -complementPtr[i];
+        }
+      }
+    });
+    outPD->RemoveArray(ComplementArrayName);
+  }
+
   this->UpdateProgress((this->GetIteration() + 1.0) / 3.0);
 
   return 1;
@@ -732,9 +948,16 @@ void vtkImageEuclideanDistance::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << "Saito\n";
   }
+  else if (this->Algorithm == VTK_EDT_FELZENSZWALB)
+  {
+    os << "Felzenszwalb\n";
+  }
   else
   {
     os << "Saito Cached\n";
   }
+  os << indent << "SignedDistance: " << (this->SignedDistance ? "On\n" : "Off\n");
+  os << indent << "GenerateClosestFeatureIds: "
+     << (this->GenerateClosestFeatureIds ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -31,6 +31,12 @@
  * slow it very significantly. In that case, one should use
  * vtkImageEuclideanDistance::SetAlgorithmToSaitoCached() instead for better performance.
  *
+ * SetAlgorithmToFelzenszwalb() selects the lower envelope algorithm of
+ * Felzenszwalb and Huttenlocher, which is linear in the number of voxels and
+ * processes the rows of each axis with several threads through vtkSMPTools.
+ * Only this algorithm can also generate signed distances and the ids of the
+ * closest features, see SetSignedDistance() and SetGenerateClosestFeatureIds().
+ *
  * References:
  *
  * T. Saito and J.I. Toriwaki. New algorithms for Euclidean distance
@@ -40,6 +46,9 @@
  * O. Cuisenaire. Distance Transformation: fast algorithms and applications
  * to medical image processing. PhD Thesis, Universite catholique de Louvain,
  * October 1999. http://ltswww.epfl.ch/~cuisenai/papers/oc_thesis.pdf
+ *
+ * P. F. Felzenszwalb and D. P. Huttenlocher. Distance Transforms of Sampled
+ * Functions. Theory of Computing, 8(19). pp. 415--428, 2012.
  */
 
 #ifndef vtkImageEuclideanDistance_h
@@ -50,6 +59,7 @@
 
 #define VTK_EDT_SAITO_CACHED 0
 #define VTK_EDT_SAITO 1
+#define VTK_EDT_FELZENSZWALB 2
 
 VTK_ABI_NAMESPACE_BEGIN
 class VTKIMAGINGGENERAL_EXPORT vtkImageEuclideanDistance : public vtkImageDecomposeFilter
@@ -95,12 +105,38 @@ public:
    * Selects a Euclidean DT algorithm.
    * 1. Saito
    * 2. Saito-cached
+   * 3. Felzenszwalb
    * More algorithms will be added later on.
    */
   vtkSetMacro(Algorithm, int);
   vtkGetMacro(Algorithm, int);
   void SetAlgorithmToSaito() { this->SetAlgorithm(VTK_EDT_SAITO); }
   void SetAlgorithmToSaitoCached() { this->SetAlgorithm(VTK_EDT_SAITO_CACHED); }
+  void SetAlgorithmToFelzenszwalb() { this->SetAlgorithm(VTK_EDT_FELZENSZWALB); }
+  ///@}
+
+  ///@{
+  /**
+   * When on, the voxels that are zero in the input get the negative of
+   * their squared distance to the closest non-zero voxel, instead of zero.
+   * This requires the Felzenszwalb algorithm and Initialize on.
+   * Off by default.
+   */
+  vtkSetMacro(SignedDistance, vtkTypeBool);
+  vtkGetMacro(SignedDistance, vtkTypeBool);
+  vtkBooleanMacro(SignedDistance, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * When on, the output gets a "ClosestFeatureIds" point data array that
+   * holds, for each voxel, the point id of the closest voxel that is zero
+   * in the input, or -1 if there is none within MaximumDistance.
+   * This requires the Felzenszwalb algorithm. Off by default.
+   */
+  vtkSetMacro(GenerateClosestFeatureIds, vtkTypeBool);
+  vtkGetMacro(GenerateClosestFeatureIds, vtkTypeBool);
+  vtkBooleanMacro(GenerateClosestFeatureIds, vtkTypeBool);
   ///@}
 
   int IterativeRequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
@@ -113,6 +149,8 @@ protected:
   vtkTypeBool Initialize;
   vtkTypeBool ConsiderAnisotropy;
   int Algorithm;
+  vtkTypeBool SignedDistance;
+  vtkTypeBool GenerateClosestFeatureIds;
 
   // Replaces "EnlargeOutputUpdateExtent"
   virtual void AllocateOutputScalars(vtkImageData* outData, int outExt[6], vtkInformation* outInfo);
@@ -14,13 +14,16 @@
 =========================================================================*/
 #include "vtkImageGaussianSmooth.h"
 
+#include "vtkImageConvolutionInternals.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageGaussianSmooth);
@@ -35,6 +38,7 @@ vtkImageGaussianSmooth::vtkImageGaussianSmooth()
   this->RadiusFactors[0] = 1.5;
   this->RadiusFactors[1] = 1.5;
   this->RadiusFactors[2] = 1.5;
+  this->RecursiveThreshold = 0.0;
 }
 
 //------------------------------------------------------------------------------
@@ -56,6 +60,8 @@ void vtkImageGaussianSmooth::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "StandardDeviations: ( " << this->StandardDeviations[0] << ", "
      << this->StandardDeviations[1] << ", " << this->StandardDeviations[2] << " )\n";
+
+  os << indent << "RecursiveThreshold: " << this->RecursiveThreshold << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -131,212 +137,147 @@ void vtkImageGaussianSmooth::InternalRequestUpdateExtent(int* inExt, int* wholeE
 }
 
 //------------------------------------------------------------------------------
-// For a given position along the convolution axis, this method loops over
-// all other axes, and performs the convolution. Boundary conditions handled
-// previously.
+// This templated function convolves the output extent along one axis. The
+// input samples along the axis go from inMin to inMax, which includes the
+// whole kernel of each output sample except where it is clipped by the
+// whole extent. If sigma is not zero, the recursive gaussian is used
+// instead of the kernel.
 template <class T>
-void vtkImageGaussianSmoothExecute(vtkImageGaussianSmooth* self, int axis, double* kernel,
-  int kernelSize, vtkImageData* inData, T* inPtrC, vtkImageData* outData, int outExt[6], T* outPtrC,
-  int* pcycle, int target, int* pcount, int total)
+void vtkImageGaussianSmoothExecute(vtkImageGaussianSmooth* self, int axis, const double* kernel,
+  int radius, double sigma, vtkImageData* inData, vtkImageData* outData, int outExt[6], int inMin,
+  int inMax, T*, int* pcycle, int target, int* pcount, int total)
 {
-  int maxC, max0 = 0, max1 = 0;
-  int idxC, idx0, idx1, idxK;
-  vtkIdType inIncs[3], outIncs[3];
-  vtkIdType inInc0 = 0, inInc1 = 0, inIncK, outInc0 = 0, outInc1 = 0;
-  T *outPtr1, *outPtr0;
-  T *inPtr1, *inPtr0, *inPtrK;
-  double *ptrK, sum;
-
-  // I am counting on the fact that tight loops (component on outside)
-  // is more important than cache misses from shuffled access.
-
-  // Do the correct shuffling of the axes (increments, extents)
-  inData->GetIncrements(inIncs);
-  outData->GetIncrements(outIncs);
-  inIncK = inIncs[axis];
-  maxC = outData->GetNumberOfScalarComponents();
-  switch (axis)
-  {
-    case 0:
-      inInc0 = inIncs[1];
-      inInc1 = inIncs[2];
-      outInc0 = outIncs[1];
-      outInc1 = outIncs[2];
-      max0 = outExt[3] - outExt[2] + 1;
-      max1 = outExt[5] - outExt[4] + 1;
-      break;
-    case 1:
-      inInc0 = inIncs[0];
-      inInc1 = inIncs[2];
-      outInc0 = outIncs[0];
-      outInc1 = outIncs[2];
-      max0 = outExt[1] - outExt[0] + 1;
-      max1 = outExt[5] - outExt[4] + 1;
-      break;
-    case 2:
-      inInc0 = inIncs[0];
-      inInc1 = inIncs[1];
-      outInc0 = outIncs[0];
-      outInc1 = outIncs[1];
-      max0 = outExt[1] - outExt[0] + 1;
-      max1 = outExt[3] - outExt[2] + 1;
-      break;
-  }
+  const int numComps = outData->GetNumberOfScalarComponents();
+  const vtkIdType inSize = inMax - inMin + 1;
+  const vtkIdType outStart = outExt[2 * axis] - inMin;
+  const vtkIdType outSize = outExt[2 * axis + 1] - outExt[2 * axis] + 1;
+  int coords[3] = { outExt[0], outExt[2], outExt[4] };
+
+  // Convolve a line of samples held in buf, with count values per sample,
+  // and return a pointer to the outSize output samples.
+  std::vector<double> outBuf;
+  auto convolve = [&](std::vector<double>& buf, vtkIdType count) -> const double* {
+    if (sigma != 0.0)
+    {
+      vtkImageConvolutionInternals::RecursiveGaussian(buf.data(), inSize, count, sigma);
+      return buf.data() + outStart * count;
+    }
+    outBuf.resize(outSize * count);
+    vtkImageConvolutionInternals::Convolve(
+      buf.data(), inSize, count, outBuf.data(), outStart, outSize, kernel, radius, true);
+    return outBuf.data();
+  };
+
+  // Update the progress after each row of count values.
+  auto progress = [&](vtkIdType count) {
+    if (total)
+    { // yes this is the main thread
+      *pcycle += static_cast<int>(count);
+      if (*pcycle > target)
+      {
+        *pcycle -= target;
+        *pcount += target;
+        self->UpdateProgress(static_cast<double>(*pcount) / static_cast<double>(total));
+      }
+    }
+  };
 
-  for (idxC = 0; idxC < maxC; ++idxC)
+  std::vector<double> buf;
+  if (axis == 0)
   {
-    inPtr1 = inPtrC;
-    outPtr1 = outPtrC;
-    for (idx1 = 0; !self->AbortExecute && idx1 < max1; ++idx1)
+    // the x rows are convolved one component at a time
+    buf.resize(inSize);
+    for (int idxZ = outExt[4]; idxZ <= outExt[5]; ++idxZ)
     {
-      inPtr0 = inPtr1;
-      outPtr0 = outPtr1;
-      for (idx0 = 0; idx0 < max0; ++idx0)
+      for (int idxY = outExt[2]; !self->AbortExecute && idxY <= outExt[3]; ++idxY)
       {
-        inPtrK = inPtr0;
-        ptrK = kernel;
-        sum = 0.0;
-        // too bad this short loop has to be the inner most loop
-        for (idxK = 0; idxK < kernelSize; ++idxK)
+        coords[0] = inMin;
+        coords[1] = idxY;
+        coords[2] = idxZ;
+        const T* inPtr = static_cast<T*>(inData->GetScalarPointer(coords));
+        T* outPtr = static_cast<T*>(outData->GetScalarPointer(outExt[0], idxY, idxZ));
+        for (int idxC = 0; idxC < numComps; ++idxC)
         {
-          sum += *ptrK * static_cast<double>(*inPtrK);
-          ++ptrK;
-          inPtrK += inIncK;
-        }
-        *outPtr0 = static_cast<T>(sum);
-        inPtr0 += inInc0;
-        outPtr0 += outInc0;
-      }
-      inPtr1 += inInc1;
-      outPtr1 += outInc1;
-      // we finished a row ... do we update ???
-      if (total)
-      { // yes this is the main thread
-        *pcycle += max0;
-        if (*pcycle > target)
-        { // yes
-          *pcycle -= target;
-          *pcount += target;
-          self->UpdateProgress(static_cast<double>(*pcount) / static_cast<double>(total));
-          // fprintf(stderr, "count: %d, total: %d, progress: %f\n",
-          //*pcount, total, (double)(*pcount) / (double)total);
+          for (vtkIdType i = 0; i < inSize; ++i)
+          {
+            buf[i] = static_cast<double>(inPtr[i * numComps + idxC]);
+          }
+          const double* result = convolve(buf, 1);
+          for (vtkIdType i = 0; i < outSize; ++i)
+          {
+            outPtr[i * numComps + idxC] = static_cast<T>(result[i]);
+          }
+          progress(outSize);
         }
       }
     }
-
-    ++inPtrC;
-    ++outPtrC;
+    return;
   }
-}
 
-//------------------------------------------------------------------------------
-template <class T>
-size_t vtkImageGaussianSmoothGetTypeSize(T*)
-{
-  return sizeof(T);
+  // the y or z axis is convolved as a line of whole x rows, for each
+  // position along the remaining axis
+  const int other = 3 - axis;
+  const vtkIdType rowSize = static_cast<vtkIdType>(outExt[1] - outExt[0] + 1) * numComps;
+  buf.resize(inSize * rowSize);
+  for (int idxO = outExt[2 * other]; !self->AbortExecute && idxO <= outExt[2 * other + 1]; ++idxO)
+  {
+    coords[other] = idxO;
+    for (vtkIdType n = 0; n < inSize; ++n)
+    {
+      coords[axis] = inMin + static_cast<int>(n);
+      const T* inPtr = static_cast<T*>(inData->GetScalarPointer(coords));
+      std::copy(inPtr, inPtr + rowSize, buf.begin() + n * rowSize);
+    }
+    const double* result = convolve(buf, rowSize);
+    for (vtkIdType i = 0; i < outSize; ++i)
+    {
+      coords[axis] = outExt[2 * axis] + static_cast<int>(i);
+      T* outPtr = static_cast<T*>(outData->GetScalarPointer(coords));
+      const double* row = result + i * rowSize;
+      for (vtkIdType k = 0; k < rowSize; ++k)
+      {
+        outPtr[k] = static_cast<T>(row[k]);
+      }
+      progress(rowSize);
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
-// This method convolves over one axis. It loops over the convolved axis,
-// and handles boundary conditions.
-void vtkImageGaussianSmooth::ExecuteAxis(int axis, vtkImageData* inData, int inExt[6],
+// This method convolves over one axis. The kernel is clipped at the
+// boundaries of the whole extent.
+void vtkImageGaussianSmooth::ExecuteAxis(int axis, vtkImageData* inData, int vtkNotUsed(inExt)[6],
   vtkImageData* outData, int outExt[6], int* pcycle, int target, int* pcount, int total,
   vtkInformation* inInfo)
 {
-  int idxA, max;
-  int wholeExtent[6], wholeMax, wholeMin;
-  double* kernel;
-  // previousClip and currentClip rembers that the previous was not clipped
-  // keeps from recomputing kernels for center pixels.
-  int kernelSize = 0;
-  int kernelLeftClip, kernelRightClip;
-  int previousClipped, currentClipped;
-  int radius, size;
-  void* inPtr;
-  void* outPtr;
-  int coords[3];
-  vtkIdType outIncs[3], outIncA;
-
-  // Get the correct starting pointer of the output
-  outPtr = outData->GetScalarPointerForExtent(outExt);
-  outData->GetIncrements(outIncs);
-  outIncA = outIncs[axis];
-
-  // trick to account for the scalar type of the output(used to be only float)
-  switch (outData->GetScalarType())
-  {
-    vtkTemplateMacro(outIncA *=
-      static_cast<vtkIdType>(vtkImageGaussianSmoothGetTypeSize(static_cast<VTK_TT*>(nullptr))));
-    default:
-      vtkErrorMacro("Unknown scalar type");
-      return;
-  }
-
-  // Determine default starting position of input
-  coords[0] = inExt[0];
-  coords[1] = inExt[2];
-  coords[2] = inExt[4];
-
   // get whole extent for boundary checking ...
+  int wholeExtent[6];
   inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
-  wholeMin = wholeExtent[axis * 2];
-  wholeMax = wholeExtent[axis * 2 + 1];
-
-  // allocate memory for the kernel
-  radius = static_cast<int>(this->StandardDeviations[axis] * this->RadiusFactors[axis]);
-  size = 2 * radius + 1;
-  kernel = new double[size];
-
-  // loop over the convolution axis
-  previousClipped = currentClipped = 1;
-  max = outExt[axis * 2 + 1];
-  for (idxA = outExt[axis * 2]; idxA <= max; ++idxA)
-  {
-    // left boundary condition
-    coords[axis] = idxA - radius;
-    kernelLeftClip = wholeMin - coords[axis];
-    if (kernelLeftClip > 0)
-    { // front of kernel is cut off ("kernelStart" samples)
-      coords[axis] += kernelLeftClip;
-    }
-    else
-    {
-      kernelLeftClip = 0;
-    }
-    // Right boundary condition
-    kernelRightClip = (idxA + radius) - wholeMax;
-    if (kernelRightClip < 0)
-    {
-      kernelRightClip = 0;
-    }
 
-    // We can only use previous kernel if it is not clipped and new
-    // kernel is also not clipped.
-    currentClipped = kernelLeftClip + kernelRightClip;
-    if (currentClipped || previousClipped)
-    {
-      this->ComputeKernel(kernel, -radius + kernelLeftClip, radius - kernelRightClip,
-        static_cast<double>(this->StandardDeviations[axis]));
-      kernelSize = size - kernelLeftClip - kernelRightClip;
-    }
-    previousClipped = currentClipped;
+  const double stdDev = this->StandardDeviations[axis];
+  const int radius = static_cast<int>(stdDev * this->RadiusFactors[axis]);
+  const int inMin = std::max(outExt[2 * axis] - radius, wholeExtent[2 * axis]);
+  const int inMax = std::min(outExt[2 * axis + 1] + radius, wholeExtent[2 * axis + 1]);
 
-    /* now do the convolution on the rest of the axes */
-    inPtr = inData->GetScalarPointer(coords);
-    switch (inData->GetScalarType())
-    {
-      vtkTemplateMacro(vtkImageGaussianSmoothExecute(this, axis, kernel, kernelSize, inData,
-        static_cast<VTK_TT*>(inPtr), outData, outExt, static_cast<VTK_TT*>(outPtr), pcycle, target,
-        pcount, total));
-      default:
-        vtkErrorMacro("Unknown scalar type");
-        return;
-    }
-    outPtr = static_cast<void*>(static_cast<unsigned char*>(outPtr) + outIncA);
+  // the full kernel, it is renormalized where it is clipped
+  std::vector<double> kernel(2 * radius + 1);
+  this->ComputeKernel(kernel.data(), -radius, radius, stdDev);
+
+  double sigma = 0.0;
+  if (this->RecursiveThreshold > 0.0 && stdDev >= std::max(this->RecursiveThreshold, 0.5))
+  {
+    sigma = stdDev;
   }
 
-  // get rid of temporary kernel
-  delete[] kernel;
+  switch (inData->GetScalarType())
+  {
+    vtkTemplateMacro(vtkImageGaussianSmoothExecute(this, axis, kernel.data(), radius, sigma,
+      inData, outData, outExt, inMin, inMax, static_cast<VTK_TT*>(nullptr), pcycle, target, pcount,
+      total));
+    default:
+      vtkErrorMacro("Unknown scalar type");
+      return;
+  }
 }
 
 //------------------------------------------------------------------------------
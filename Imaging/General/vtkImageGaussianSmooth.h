@@ -18,6 +18,10 @@
  *
  * vtkImageGaussianSmooth implements a convolution of the input image
  * with a gaussian. Supports from one to three dimensional convolutions.
+ * The y and z axes are convolved a whole x row at a time, so that the
+ * inner loops run over contiguous memory. For large standard deviations,
+ * a recursive filter whose cost does not depend on the radius of the
+ * kernel can be used instead of the convolution, see RecursiveThreshold.
  */
 
 #ifndef vtkImageGaussianSmooth_h
@@ -78,6 +82,20 @@ public:
   vtkGetMacro(Dimensionality, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the standard deviation from which an axis is smoothed with the
+   * recursive approximation of the gaussian of Young and van Vliet instead
+   * of a convolution. The cost of the recursive filter does not depend on
+   * the standard deviation, but it repeats the edge values of the image
+   * instead of clipping the kernel, and it is less accurate for small
+   * standard deviations: it is never used below 0.5. The default is zero,
+   * which never uses the recursive filter.
+   */
+  vtkSetClampMacro(RecursiveThreshold, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(RecursiveThreshold, double);
+  ///@}
+
 protected:
   vtkImageGaussianSmooth();
   ~vtkImageGaussianSmooth() override;
@@ -85,6 +103,7 @@ protected:
   int Dimensionality;
   double StandardDeviations[3];
   double RadiusFactors[3];
+  double RecursiveThreshold;
 
   void ComputeKernel(double* kernel, int min, int max, double std);
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
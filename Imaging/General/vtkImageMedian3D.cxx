@@ -24,6 +24,10 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm> // for std::nth_element
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageMedian3D);
@@ -33,6 +37,7 @@ vtkStandardNewMacro(vtkImageMedian3D);
 vtkImageMedian3D::vtkImageMedian3D()
 {
   this->NumberOfElements = 0;
+  this->Percentile = 50.0;
   this->SetKernelSize(1, 1, 1);
   this->HandleBoundaries = 1;
 }
@@ -46,6 +51,7 @@ void vtkImageMedian3D::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "NumberOfElements: " << this->NumberOfElements << endl;
+  os << indent << "Percentile: " << this->Percentile << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -83,25 +89,298 @@ void vtkImageMedian3D::SetKernelSize(int size0, int size1, int size2)
 namespace
 {
 
+// Kernels with up to this many elements are sorted with a sorting network
+// that is applied to a whole row of pixels at once.
+const int vtkImageMedian3DMaxNetworkSize = 32;
+
+//------------------------------------------------------------------------------
+// Get the rank (from zero) of the value at the given percentile of n sorted
+// values, and the fraction of the way from this value to the next one.
+void vtkImageMedian3DRank(vtkIdType n, double percentile, vtkIdType& rank, double& fraction)
+{
+  const double position = percentile * (n - 1) / 100.0;
+  rank = std::min(static_cast<vtkIdType>(position), n - 1);
+  fraction = (rank < n - 1 ? position - rank : 0.0);
+}
+
 //------------------------------------------------------------------------------
-// Compute the median with std::nth_element
+// Interpolate between the values of two consecutive ranks.  Halfway is
+// computed like the median of an even number of values always was.
 template <class T>
-T vtkComputeMedianOfArray(T* aBegin, T* aEnd)
+T vtkImageMedian3DInterpolate(T low, T high, double fraction)
 {
-  T* aMid = aBegin + (aEnd - aBegin) / 2;
-  std::nth_element(aBegin, aMid, aEnd);
-  T m = *aMid;
+  using Difference = decltype(high - low);
+  if (fraction == 0.5)
+  {
+    return static_cast<T>(low + (high - low) / 2);
+  }
+  else if (fraction > 0.0)
+  {
+    return static_cast<T>(low + static_cast<Difference>((high - low) * fraction));
+  }
+  return low;
+}
+
+//------------------------------------------------------------------------------
+// Compute the percentile of an array with std::nth_element
+template <class T>
+T vtkImageMedian3DSelect(T* aBegin, T* aEnd, double percentile)
+{
+  vtkIdType rank;
+  double fraction;
+  vtkImageMedian3DRank(aEnd - aBegin, percentile, rank, fraction);
+  T* aRank = aBegin + rank;
+  std::nth_element(aBegin, aRank, aEnd);
+  if (fraction > 0.0)
+  {
+    // the next rank is the min of the upper part of the array
+    return vtkImageMedian3DInterpolate(*aRank, *std::min_element(aRank + 1, aEnd), fraction);
+  }
+  return *aRank;
+}
+
+//------------------------------------------------------------------------------
+// Generate the comparators of the odd-even merge sort of Batcher for n
+// values.  The comparators that involve positions beyond n in the network
+// for the next power of two are dropped, as if the values were padded with
+// an infinite value that never moves.
+std::vector<std::pair<int, int>> vtkImageMedian3DSortingNetwork(int n)
+{
+  std::vector<std::pair<int, int>> network;
+  for (int p = 1; p < n; p *= 2)
+  {
+    for (int k = p; k >= 1; k /= 2)
+    {
+      for (int j = k % p; j + k < n; j += 2 * k)
+      {
+        for (int i = 0; i < k && i + j + k < n; ++i)
+        {
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+          {
+            network.emplace_back(i + j, i + j + k);
+          }
+        }
+      }
+    }
+  }
+  return network;
+}
 
-  // if even size, get max of lower part of array and compute the average
-  if (aMid - aBegin == aEnd - aMid)
+//------------------------------------------------------------------------------
+// Sort the columns of an array of n rows of "count" values with a sorting
+// network.  Each comparator is a min and a max over two whole rows, which
+// the compiler vectorizes, and which does not branch on the data.
+template <class T>
+void vtkImageMedian3DSortColumns(
+  T* values, vtkIdType count, const std::vector<std::pair<int, int>>& network)
+{
+  for (const auto& comparator : network)
   {
-    T* lowMid = std::max_element(aBegin, aMid);
-    m = *lowMid + (m - *lowMid) / 2;
+    T* a = values + comparator.first * count;
+    T* b = values + comparator.second * count;
+    for (vtkIdType i = 0; i < count; ++i)
+    {
+      const T x = a[i];
+      const T y = b[i];
+      a[i] = std::min(x, y);
+      b[i] = std::max(x, y);
+    }
   }
+}
+
+//------------------------------------------------------------------------------
+// Clip the neighborhood of an output index along an axis by the input extent.
+void vtkImageMedian3DClipHood(const int kernelSize[3], const int kernelMiddle[3],
+  const int inExt[6], int axis, int idx, int& hoodMin, int& hoodMax)
+{
+  hoodMin = std::max(idx - kernelMiddle[axis], inExt[2 * axis]);
+  hoodMax = std::min(idx - kernelMiddle[axis] + kernelSize[axis] - 1, inExt[2 * axis + 1]);
+}
+
+//------------------------------------------------------------------------------
+// A histogram of 8-bit or 16-bit integers, where the value of a given rank
+// is found by scanning coarse bins and then the fine bins within one coarse
+// bin, as in the constant time median filter of Perreault and Hebert.
+template <class T>
+class vtkImageMedian3DHistogram
+{
+public:
+  vtkImageMedian3DHistogram()
+    : Fine(std::size_t(1) << Bits, 0)
+    , Coarse(std::size_t(1) << (Bits - Shift), 0)
+  {
+  }
+
+  // Add a value with a weight of 1, or remove it with a weight of -1.
+  void Add(T value, int weight)
+  {
+    const int bin = static_cast<int>(value) - Minimum;
+    this->Fine[bin] += weight;
+    this->Coarse[bin >> Shift] += weight;
+  }
+
+  // Get the value of the given rank, which must be less than the number of
+  // values in the histogram.
+  T Select(vtkIdType rank) const
+  {
+    int bin = 0;
+    vtkIdType below = 0;
+    while (below + this->Coarse[bin] <= rank)
+    {
+      below += this->Coarse[bin++];
+    }
+    bin <<= Shift;
+    while (below + this->Fine[bin] <= rank)
+    {
+      below += this->Fine[bin++];
+    }
+    return static_cast<T>(bin + Minimum);
+  }
+
+private:
+  static constexpr int Bits = 8 * sizeof(T);
+  static constexpr int Shift = Bits / 2;
+  static constexpr int Minimum = std::numeric_limits<T>::min();
+
+  std::vector<int> Fine;
+  std::vector<int> Coarse;
+};
+
+//------------------------------------------------------------------------------
+// Compute the output with a histogram of the neighborhood that slides along
+// the rows, as in the median filter of Huang.  Moving to the next pixel only
+// adds and removes one column of the neighborhood, so the cost per pixel
+// grows with the kernel size along y and z but not along x, and it does not
+// depend on the kernel size at all for a 1D kernel along x.
+template <class T>
+void vtkImageMedian3DHistogramExecute(vtkImageMedian3D* self, vtkImageData* inData, T* inPtr,
+  vtkImageData* outData, T* outPtr, int outExt[6], int id, vtkDataArray* inArray)
+{
+  int* kernelMiddle = self->GetKernelMiddle();
+  int* kernelSize = self->GetKernelSize();
+  int* inExt = inData->GetExtent();
+  const double percentile = self->GetPercentile();
+  const int numComp = inArray->GetNumberOfComponents();
+  const int rowLength = outExt[1] - outExt[0] + 1;
+  vtkIdType inInc[3];
+  vtkIdType outIncX, outIncY, outIncZ;
+  inData->GetIncrements(inArray, inInc);
+  outData->GetContinuousIncrements(outExt, outIncX, outIncY, outIncZ);
+
+  unsigned long count = 0;
+  unsigned long target =
+    static_cast<unsigned long>((outExt[5] - outExt[4] + 1) * (outExt[3] - outExt[2] + 1) / 50.0);
+  target++;
+
+  vtkImageMedian3DHistogram<T> histogram;
+  int hoodMin0, hoodMax0, hoodMin1, hoodMax1, hoodMin2, hoodMax2;
+  for (int outIdx2 = outExt[4]; outIdx2 <= outExt[5]; ++outIdx2)
+  {
+    vtkImageMedian3DClipHood(kernelSize, kernelMiddle, inExt, 2, outIdx2, hoodMin2, hoodMax2);
+    for (int outIdx1 = outExt[2]; !self->AbortExecute && outIdx1 <= outExt[3]; ++outIdx1)
+    {
+      if (!id)
+      {
+        if (!(count % target))
+        {
+          self->UpdateProgress(count / (50.0 * target));
+        }
+        count++;
+      }
+      vtkImageMedian3DClipHood(kernelSize, kernelMiddle, inExt, 1, outIdx1, hoodMin1, hoodMax1);
+      const vtkIdType hoodCount1 = hoodMax1 - hoodMin1 + 1;
+      const vtkIdType hoodCount2 = hoodMax2 - hoodMin2 + 1;
+
+      for (int outIdxC = 0; outIdxC < numComp; outIdxC++)
+      {
+        // add or remove one column of the neighborhood
+        T* inRow =
+          inPtr + (hoodMin1 - inExt[2]) * inInc[1] + (hoodMin2 - inExt[4]) * inInc[2] + outIdxC;
+        auto updateColumn = [&](int hoodIdx0, int weight) {
+          T* tmpPtr2 = inRow + (hoodIdx0 - inExt[0]) * inInc[0];
+          for (vtkIdType hoodIdx2 = 0; hoodIdx2 < hoodCount2; ++hoodIdx2)
+          {
+            T* tmpPtr1 = tmpPtr2;
+            for (vtkIdType hoodIdx1 = 0; hoodIdx1 < hoodCount1; ++hoodIdx1)
+            {
+              histogram.Add(*tmpPtr1, weight);
+              tmpPtr1 += inInc[1];
+            }
+            tmpPtr2 += inInc[2];
+          }
+        };
+
+        // the columns from first to last are in the histogram
+        int first = std::max(outExt[0] - kernelMiddle[0], inExt[0]);
+        int last = first - 1;
+        T* outValue = outPtr + outIdxC;
+        for (int outIdx0 = outExt[0]; outIdx0 <= outExt[1]; ++outIdx0)
+        {
+          vtkImageMedian3DClipHood(kernelSize, kernelMiddle, inExt, 0, outIdx0, hoodMin0, hoodMax0);
+          while (last < hoodMax0)
+          {
+            updateColumn(++last, 1);
+          }
+          while (first < hoodMin0)
+          {
+            updateColumn(first++, -1);
+          }
 
-  return m;
+          vtkIdType rank;
+          double fraction;
+          vtkImageMedian3DRank((last - first + 1) * hoodCount1 * hoodCount2, percentile, rank,
+            fraction);
+          T value = histogram.Select(rank);
+          if (fraction > 0.0)
+          {
+            value = vtkImageMedian3DInterpolate(value, histogram.Select(rank + 1), fraction);
+          }
+          *outValue = value;
+          outValue += numComp;
+        }
+
+        // empty the histogram for the next row
+        while (first <= last)
+        {
+          updateColumn(first++, -1);
+        }
+      }
+      outPtr += static_cast<vtkIdType>(rowLength) * numComp + outIncY;
+    }
+    outPtr += outIncZ;
+  }
 }
 
+//------------------------------------------------------------------------------
+// The sliding histogram is used for integers of at most 16 bits, when the
+// kernel is large enough for the histogram scans to cost less than the
+// selection of the value among the neighborhood.
+template <class T, bool = (std::is_integral<T>::value && sizeof(T) <= 2)>
+struct vtkImageMedian3DHistogramDispatch
+{
+  static bool Execute(vtkImageMedian3D*, vtkImageData*, T*, vtkImageData*, T*, int[6], int,
+    vtkDataArray*)
+  {
+    return false;
+  }
+};
+
+template <class T>
+struct vtkImageMedian3DHistogramDispatch<T, true>
+{
+  static bool Execute(vtkImageMedian3D* self, vtkImageData* inData, T* inPtr,
+    vtkImageData* outData, T* outPtr, int outExt[6], int id, vtkDataArray* inArray)
+  {
+    const int minimumSize = (sizeof(T) == 1 ? vtkImageMedian3DMaxNetworkSize : 100);
+    if (self->GetNumberOfElements() <= minimumSize)
+    {
+      return false;
+    }
+    vtkImageMedian3DHistogramExecute(self, inData, inPtr, outData, outPtr, outExt, id, inArray);
+    return true;
+  }
+};
+
 } // end anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -111,85 +390,56 @@ template <class T>
 void vtkImageMedian3DExecute(vtkImageMedian3D* self, vtkImageData* inData, T* inPtr,
   vtkImageData* outData, T* outPtr, int outExt[6], int id, vtkDataArray* inArray)
 {
-  int *kernelMiddle, *kernelSize;
-  // For looping though output (and input) pixels.
-  int outIdx0, outIdx1, outIdx2;
-  vtkIdType inInc0, inInc1, inInc2;
-  int outIdxC;
-  vtkIdType outIncX, outIncY, outIncZ;
-  T *inPtr0, *inPtr1, *inPtr2;
-  // For looping through hood pixels
-  int hoodMin0, hoodMax0, hoodMin1, hoodMax1, hoodMin2, hoodMax2;
-  int hoodStartMin0, hoodStartMax0, hoodStartMin1, hoodStartMax1;
-  int hoodIdx0, hoodIdx1, hoodIdx2;
-  T *tmpPtr0, *tmpPtr1, *tmpPtr2;
-  // The portion of the out image that needs no boundary processing.
-  int middleMin0, middleMax0, middleMin1, middleMax1, middleMin2, middleMax2;
-  int numComp;
-  int* inExt;
-  unsigned long count = 0;
-  unsigned long target;
-
   if (!inArray)
   {
     return;
   }
 
-  // Array used to compute the median
-  T* workArray = new T[self->GetNumberOfElements()];
+  // integers with a large kernel use a sliding histogram
+  if (vtkImageMedian3DHistogramDispatch<T>::Execute(
+        self, inData, inPtr, outData, outPtr, outExt, id, inArray))
+  {
+    return;
+  }
 
   // Get information to march through data
-  inData->GetIncrements(inInc0, inInc1, inInc2);
+  int* kernelMiddle = self->GetKernelMiddle();
+  int* kernelSize = self->GetKernelSize();
+  int* inExt = inData->GetExtent();
+  const double percentile = self->GetPercentile();
+  const int numComp = inArray->GetNumberOfComponents();
+  const int numElements = self->GetNumberOfElements();
+  const int rowLength = outExt[1] - outExt[0] + 1;
+  vtkIdType inInc[3];
+  vtkIdType outIncX, outIncY, outIncZ;
+  inData->GetIncrements(inArray, inInc);
   outData->GetContinuousIncrements(outExt, outIncX, outIncY, outIncZ);
-  kernelMiddle = self->GetKernelMiddle();
-  kernelSize = self->GetKernelSize();
-
-  numComp = inArray->GetNumberOfComponents();
-
-  hoodMin0 = outExt[0] - kernelMiddle[0];
-  hoodMin1 = outExt[2] - kernelMiddle[1];
-  hoodMin2 = outExt[4] - kernelMiddle[2];
-  hoodMax0 = kernelSize[0] + hoodMin0 - 1;
-  hoodMax1 = kernelSize[1] + hoodMin1 - 1;
-  hoodMax2 = kernelSize[2] + hoodMin2 - 1;
-
-  // Clip by the input image extent
-  inExt = inData->GetExtent();
-  hoodMin0 = (hoodMin0 > inExt[0]) ? hoodMin0 : inExt[0];
-  hoodMin1 = (hoodMin1 > inExt[2]) ? hoodMin1 : inExt[2];
-  hoodMin2 = (hoodMin2 > inExt[4]) ? hoodMin2 : inExt[4];
-  hoodMax0 = (hoodMax0 < inExt[1]) ? hoodMax0 : inExt[1];
-  hoodMax1 = (hoodMax1 < inExt[3]) ? hoodMax1 : inExt[3];
-  hoodMax2 = (hoodMax2 < inExt[5]) ? hoodMax2 : inExt[5];
-
-  // Save the starting neighborhood dimensions (2 loops only once)
-  hoodStartMin0 = hoodMin0;
-  hoodStartMax0 = hoodMax0;
-  hoodStartMin1 = hoodMin1;
-  hoodStartMax1 = hoodMax1;
-
-  // The portion of the output that needs no boundary computation.
-  middleMin0 = inExt[0] + kernelMiddle[0];
-  middleMax0 = inExt[1] - (kernelSize[0] - 1) + kernelMiddle[0];
-  middleMin1 = inExt[2] + kernelMiddle[1];
-  middleMax1 = inExt[3] - (kernelSize[1] - 1) + kernelMiddle[1];
-  middleMin2 = inExt[4] + kernelMiddle[2];
-  middleMax2 = inExt[5] - (kernelSize[2] - 1) + kernelMiddle[2];
-
-  target =
+
+  unsigned long count = 0;
+  unsigned long target =
     static_cast<unsigned long>((outExt[5] - outExt[4] + 1) * (outExt[3] - outExt[2] + 1) / 50.0);
   target++;
 
-  // loop through pixel of output
-  inPtr = static_cast<T*>(inArray->GetVoidPointer((hoodMin0 - inExt[0]) * inInc0 +
-    (hoodMin1 - inExt[2]) * inInc1 + (hoodMin2 - inExt[4]) * inInc2));
-  inPtr2 = inPtr;
-  for (outIdx2 = outExt[4]; outIdx2 <= outExt[5]; ++outIdx2)
+  // Array used to compute the percentile of clipped neighborhoods
+  std::vector<T> workArray(numElements);
+
+  // The sorting network for the pixels whose neighborhood is not clipped,
+  // and the rows of values that it sorts for each of these pixels
+  std::vector<std::pair<int, int>> network;
+  vtkIdType networkRank = 0;
+  double networkFraction = 0.0;
+  if (numElements > 1 && numElements <= vtkImageMedian3DMaxNetworkSize)
+  {
+    network = vtkImageMedian3DSortingNetwork(numElements);
+    vtkImageMedian3DRank(numElements, percentile, networkRank, networkFraction);
+  }
+  std::vector<T> columns;
+
+  int hoodMin0, hoodMax0, hoodMin1, hoodMax1, hoodMin2, hoodMax2;
+  for (int outIdx2 = outExt[4]; outIdx2 <= outExt[5]; ++outIdx2)
   {
-    inPtr1 = inPtr2;
-    hoodMin1 = hoodStartMin1;
-    hoodMax1 = hoodStartMax1;
-    for (outIdx1 = outExt[2]; !self->AbortExecute && outIdx1 <= outExt[3]; ++outIdx1)
+    vtkImageMedian3DClipHood(kernelSize, kernelMiddle, inExt, 2, outIdx2, hoodMin2, hoodMax2);
+    for (int outIdx1 = outExt[2]; !self->AbortExecute && outIdx1 <= outExt[3]; ++outIdx1)
     {
       if (!id)
       {
@@ -199,76 +449,108 @@ void vtkImageMedian3DExecute(vtkImageMedian3D* self, vtkImageData* inData, T* in
         }
         count++;
       }
-      inPtr0 = inPtr1;
-      hoodMin0 = hoodStartMin0;
-      hoodMax0 = hoodStartMax0;
-      for (outIdx0 = outExt[0]; outIdx0 <= outExt[1]; ++outIdx0)
+      vtkImageMedian3DClipHood(kernelSize, kernelMiddle, inExt, 1, outIdx1, hoodMin1, hoodMax1);
+      T* inRow = inPtr + (hoodMin1 - inExt[2]) * inInc[1] + (hoodMin2 - inExt[4]) * inInc[2];
+
+      // The portion of the row that needs no boundary processing
+      int middleMin0 = outExt[1] + 1;
+      int middleMax0 = outExt[1];
+      if (!network.empty() && hoodMax1 - hoodMin1 + 1 == kernelSize[1] &&
+        hoodMax2 - hoodMin2 + 1 == kernelSize[2])
       {
-        for (outIdxC = 0; outIdxC < numComp; outIdxC++)
-        {
-          // Compute median of neighborhood
-          T* workEnd = workArray;
+        middleMin0 = std::max(outExt[0], inExt[0] + kernelMiddle[0]);
+        middleMax0 = std::min(outExt[1], inExt[1] - (kernelSize[0] - 1) + kernelMiddle[0]);
+      }
 
+      for (int outIdx0 = outExt[0]; outIdx0 <= outExt[1]; ++outIdx0)
+      {
+        if (outIdx0 >= middleMin0 && outIdx0 <= middleMax0)
+        {
+          continue;
+        }
+        vtkImageMedian3DClipHood(kernelSize, kernelMiddle, inExt, 0, outIdx0, hoodMin0, hoodMax0);
+        for (int outIdxC = 0; outIdxC < numComp; outIdxC++)
+        {
           // loop through neighborhood pixels
-          tmpPtr2 = inPtr0 + outIdxC;
-          for (hoodIdx2 = hoodMin2; hoodIdx2 <= hoodMax2; ++hoodIdx2)
+          T* workEnd = workArray.data();
+          T* tmpPtr2 = inRow + (hoodMin0 - inExt[0]) * inInc[0] + outIdxC;
+          for (int hoodIdx2 = hoodMin2; hoodIdx2 <= hoodMax2; ++hoodIdx2)
           {
-            tmpPtr1 = tmpPtr2;
-            for (hoodIdx1 = hoodMin1; hoodIdx1 <= hoodMax1; ++hoodIdx1)
+            T* tmpPtr1 = tmpPtr2;
+            for (int hoodIdx1 = hoodMin1; hoodIdx1 <= hoodMax1; ++hoodIdx1)
             {
-              tmpPtr0 = tmpPtr1;
-              for (hoodIdx0 = hoodMin0; hoodIdx0 <= hoodMax0; ++hoodIdx0)
+              T* tmpPtr0 = tmpPtr1;
+              for (int hoodIdx0 = hoodMin0; hoodIdx0 <= hoodMax0; ++hoodIdx0)
               {
-                // Add this pixel to the median
                 *workEnd++ = *tmpPtr0;
-                tmpPtr0 += inInc0;
+                tmpPtr0 += inInc[0];
               }
-              tmpPtr1 += inInc1;
+              tmpPtr1 += inInc[1];
             }
-            tmpPtr2 += inInc2;
+            tmpPtr2 += inInc[2];
           }
 
-          // Replace this pixel with the hood median
-          *outPtr++ = vtkComputeMedianOfArray(workArray, workEnd);
+          // Replace this pixel with the hood percentile
+          outPtr[(outIdx0 - outExt[0]) * numComp + outIdxC] =
+            vtkImageMedian3DSelect(workArray.data(), workEnd, percentile);
         }
+      }
 
-        // shift neighborhood considering boundaries
-        if (outIdx0 >= middleMin0)
-        {
-          inPtr0 += inInc0;
-          ++hoodMin0;
-        }
-        if (outIdx0 < middleMax0)
+      // Sort the neighborhoods of all the middle pixels together: row e of
+      // the columns array holds element e of the neighborhood of each pixel
+      if (middleMin0 <= middleMax0)
+      {
+        const vtkIdType middleCount = middleMax0 - middleMin0 + 1;
+        columns.resize(middleCount * numElements);
+        for (int outIdxC = 0; outIdxC < numComp; outIdxC++)
         {
-          ++hoodMax0;
+          T* column = columns.data();
+          T* tmpPtr2 = inRow + (middleMin0 - kernelMiddle[0] - inExt[0]) * inInc[0] + outIdxC;
+          for (int hoodIdx2 = 0; hoodIdx2 < kernelSize[2]; ++hoodIdx2)
+          {
+            T* tmpPtr1 = tmpPtr2;
+            for (int hoodIdx1 = 0; hoodIdx1 < kernelSize[1]; ++hoodIdx1)
+            {
+              T* tmpPtr0 = tmpPtr1;
+              for (int hoodIdx0 = 0; hoodIdx0 < kernelSize[0]; ++hoodIdx0)
+              {
+                for (vtkIdType i = 0; i < middleCount; ++i)
+                {
+                  column[i] = tmpPtr0[i * inInc[0]];
+                }
+                column += middleCount;
+                tmpPtr0 += inInc[0];
+              }
+              tmpPtr1 += inInc[1];
+            }
+            tmpPtr2 += inInc[2];
+          }
+
+          vtkImageMedian3DSortColumns(columns.data(), middleCount, network);
+
+          const T* low = columns.data() + networkRank * middleCount;
+          T* outValue = outPtr + (middleMin0 - outExt[0]) * numComp + outIdxC;
+          if (networkFraction > 0.0)
+          {
+            const T* high = low + middleCount;
+            for (vtkIdType i = 0; i < middleCount; ++i)
+            {
+              outValue[i * numComp] = vtkImageMedian3DInterpolate(low[i], high[i], networkFraction);
+            }
+          }
+          else
+          {
+            for (vtkIdType i = 0; i < middleCount; ++i)
+            {
+              outValue[i * numComp] = low[i];
+            }
+          }
         }
       }
-      // shift neighborhood considering boundaries
-      if (outIdx1 >= middleMin1)
-      {
-        inPtr1 += inInc1;
-        ++hoodMin1;
-      }
-      if (outIdx1 < middleMax1)
-      {
-        ++hoodMax1;
-      }
-      outPtr += outIncY;
-    }
-    // shift neighborhood considering boundaries
-    if (outIdx2 >= middleMin2)
-    {
-      inPtr2 += inInc2;
-      ++hoodMin2;
-    }
-    if (outIdx2 < middleMax2)
-    {
-      ++hoodMax2;
+      outPtr += static_cast<vtkIdType>(rowLength) * numComp + outIncY;
     }
     outPtr += outIncZ;
   }
-
-  delete[] workArray;
 }
 
 //------------------------------------------------------------------------------
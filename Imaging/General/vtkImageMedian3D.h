@@ -20,7 +20,14 @@
  * median value from a rectangular neighborhood around that pixel.
  * Neighborhoods can be no more than 3 dimensional.  Setting one
  * axis of the neighborhood kernelSize to 1 changes the filter
- * into a 2D median.
+ * into a 2D median.  Other percentiles of the neighborhood, such as
+ * the minimum or the maximum, can be computed instead of the median.
+ *
+ * Small neighborhoods, of up to 32 pixels, are sorted with a sorting
+ * network that processes a whole row of pixels at once.  For 8-bit and
+ * 16-bit integer scalars, large neighborhoods use a histogram that slides
+ * along the rows, so that the cost per pixel does not grow with the kernel
+ * size along x.  Other neighborhoods are partially sorted for each pixel.
  */
 
 #ifndef vtkImageMedian3D_h
@@ -50,11 +57,23 @@ public:
   vtkGetMacro(NumberOfElements, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the percentile of the neighborhood that replaces each pixel,
+   * from 0 for the minimum to 100 for the maximum.  A percentile that falls
+   * between two values of the sorted neighborhood is linearly interpolated.
+   * The default is 50, the median.
+   */
+  vtkSetClampMacro(Percentile, double, 0.0, 100.0);
+  vtkGetMacro(Percentile, double);
+  ///@}
+
 protected:
   vtkImageMedian3D();
   ~vtkImageMedian3D() override;
 
   int NumberOfElements;
+  double Percentile;
 
   void ThreadedRequestData(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector, vtkImageData*** inData, vtkImageData** outData,
@@ -0,0 +1,182 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGaussianSplatter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare the tile-binned vtkGaussianSplatter with a direct evaluation of
+// every splat, for spherical and elliptical splats and all accumulation
+// modes, with a cluster of points that all fall into the same tile.
+
+#include "vtkDoubleArray.h"
+#include "vtkGaussianSplatter.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// Check whether a voxel is within the box that bounds the splat, since the
+// elliptical splats are clipped to this box.
+bool InFootprint(const double p[3], const double origin[3], const double spacing[3],
+  double radius, int i, int j, int k)
+{
+  const int ijk[3] = { i, j, k };
+  for (int axis = 0; axis < 3; axis++)
+  {
+    double loc = (p[axis] - origin[axis]) / spacing[axis];
+    double distance = radius / spacing[axis];
+    if (ijk[axis] < std::floor(loc - distance) || ijk[axis] > std::ceil(loc + distance))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int CheckSplatter(vtkPolyData* input, int mode, bool normalWarping, bool scalarWarping)
+{
+  vtkNew<vtkGaussianSplatter> splatter;
+  splatter->SetInputData(input);
+  splatter->SetSampleDimensions(40, 30, 20);
+  splatter->SetModelBounds(-1.0, 1.0, -1.0, 1.0, -0.5, 0.5);
+  splatter->SetRadius(0.08);
+  splatter->SetExponentFactor(-4.0);
+  splatter->SetScaleFactor(2.0);
+  splatter->SetNormalWarping(normalWarping);
+  splatter->SetScalarWarping(scalarWarping);
+  splatter->SetEccentricity(3.0);
+  splatter->SetAccumulationMode(mode);
+  splatter->SetNullValue(-1.0);
+  splatter->CappingOff();
+  splatter->Update();
+
+  vtkImageData* output = splatter->GetOutput();
+  const double* origin = output->GetOrigin();
+  const double* spacing = output->GetSpacing();
+  const int* dims = output->GetDimensions();
+  const double radius = 0.08 * 2.0;
+  const double radius2 = radius * radius;
+  const double e2 = 9.0;
+
+  std::vector<double> expected(output->GetNumberOfPoints(), -1.0);
+  std::vector<bool> visited(expected.size(), false);
+  vtkDataArray* scalars = input->GetPointData()->GetScalars();
+  vtkDataArray* normals = input->GetPointData()->GetNormals();
+  for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ptId++)
+  {
+    double p[3], n[3];
+    input->GetPoint(ptId, p);
+    normals->GetTuple(ptId, n);
+    double nn = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    double factor = 2.0 * (scalarWarping ? scalars->GetComponent(ptId, 0) : 1.0);
+    for (int k = 0; k < dims[2]; k++)
+    {
+      for (int j = 0; j < dims[1]; j++)
+      {
+        for (int i = 0; i < dims[0]; i++)
+        {
+          double v[3] = { origin[0] + spacing[0] * i - p[0], origin[1] + spacing[1] * j - p[1],
+            origin[2] + spacing[2] * k - p[2] };
+          double dist2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+          if (normalWarping)
+          {
+            double z = (v[0] * n[0] + v[1] * n[1] + v[2] * n[2]) / nn;
+            dist2 = (dist2 - z * z) / e2 + z * z;
+          }
+          if (dist2 <= radius2 && InFootprint(p, origin, spacing, radius, i, j, k))
+          {
+            double s = factor * std::exp(-4.0 * dist2 / radius2);
+            vtkIdType idx = i + dims[0] * (j + static_cast<vtkIdType>(dims[1]) * k);
+            if (!visited[idx])
+            {
+              expected[idx] = s;
+              visited[idx] = true;
+            }
+            else if (mode == VTK_ACCUMULATION_MODE_MIN)
+            {
+              expected[idx] = std::min(expected[idx], s);
+            }
+            else if (mode == VTK_ACCUMULATION_MODE_MAX)
+            {
+              expected[idx] = std::max(expected[idx], s);
+            }
+            else
+            {
+              expected[idx] += s;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  const double* values = static_cast<double*>(output->GetScalarPointer());
+  for (size_t idx = 0; idx < expected.size(); idx++)
+  {
+    if (std::abs(values[idx] - expected[idx]) > 1e-9 * (1.0 + std::abs(expected[idx])))
+    {
+      std::cerr << "Mode " << splatter->GetAccumulationModeAsString() << ", normal warping "
+                << normalWarping << ", scalar warping " << scalarWarping << ": value "
+                << values[idx] << " instead of " << expected[idx] << " at " << idx << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+int TestGaussianSplatter(int, char*[])
+{
+  // random points, a third of them in a small cluster
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> scalars;
+  vtkNew<vtkDoubleArray> normals;
+  normals->SetNumberOfComponents(3);
+  unsigned int state = 4321;
+  auto random = [&state]() {
+    state = state * 1103515245u + 12345u;
+    return ((state >> 8) & 0xffff) / 65535.0;
+  };
+  for (int i = 0; i < 3000; i++)
+  {
+    double p[3] = { 2.2 * random() - 1.1, 2.2 * random() - 1.1, 1.2 * random() - 0.6 };
+    if (i % 3 == 0)
+    {
+      p[0] = 0.3 + 0.05 * p[0];
+      p[1] = -0.2 + 0.05 * p[1];
+      p[2] = 0.1 + 0.05 * p[2];
+    }
+    points->InsertNextPoint(p);
+    scalars->InsertNextValue(4.0 * random() - 1.0);
+    normals->InsertNextTuple3(random() - 0.5, random() - 0.5, random() - 0.5);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->GetPointData()->SetScalars(scalars);
+  input->GetPointData()->SetNormals(normals);
+
+  int retVal = EXIT_SUCCESS;
+  for (int mode = VTK_ACCUMULATION_MODE_MIN; mode <= VTK_ACCUMULATION_MODE_SUM; mode++)
+  {
+    retVal |= CheckSplatter(input, mode, false, true);
+    retVal |= CheckSplatter(input, mode, true, mode == VTK_ACCUMULATION_MODE_SUM);
+  }
+  return retVal;
+}
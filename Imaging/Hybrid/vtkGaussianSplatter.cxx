@@ -30,63 +30,361 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkGaussianSplatter);
 
 //------------------------------------------------------------------------------
-// Algorithm and integration into vtkSMPTools
+// Algorithm and integration into vtkSMPTools. The points are first sorted
+// into bins, one bin for each tile of the volume that the footprint of the
+// point overlaps, and then the tiles are splatted in parallel. Since each
+// tile is written by a single thread, no write conflicts can occur no matter
+// how densely the points are clustered.
 class vtkGaussianSplatterAlgorithm
 {
 public:
   vtkGaussianSplatter* Splatter;
   double* Scalars;
+  char* Visited;
   vtkIdType Dims[3], SliceSize;
-  double Origin[3], Spacing[3], Radius2;
+  double Origin[3], Spacing[3], SplatDistance[3], Radius2;
+  double ExponentFactor, ScaleFactor, Eccentricity2;
+  int AccumulationMode;
+
+  // the dataset that is being splatted, and its scalars and normals if
+  // they are used to warp the splats
+  vtkDataSet* Input;
+  vtkDataArray* InScalars;
+  vtkDataArray* InNormals;
+
+  // the tiles, and the ids of the points binned into each tile
+  int TileSize[3];
+  int TileDims[3];
+  vtkIdType NumberOfTiles;
+  std::vector<vtkIdType> BinOffsets;
+  std::vector<vtkIdType> BinPoints;
+
+  // Choose tiles that are larger than the footprint of a splat, so that
+  // most points fall into one to eight bins, but not so many tiles that
+  // the bin counts use too much memory.
+  void ComputeTiles()
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      this->TileSize[i] = std::max(8, 2 * static_cast<int>(std::ceil(this->SplatDistance[i])) + 1);
+      this->TileSize[i] = std::min(this->TileSize[i], static_cast<int>(this->Dims[i]));
+      this->TileDims[i] = static_cast<int>((this->Dims[i] - 1) / this->TileSize[i] + 1);
+    }
+    while (static_cast<vtkIdType>(this->TileDims[0]) * this->TileDims[1] * this->TileDims[2] >
+      vtkGaussianSplatterAlgorithm::MaximumNumberOfTiles)
+    {
+      int axis = 0;
+      for (int i = 1; i < 3; i++)
+      {
+        axis = (this->TileDims[i] > this->TileDims[axis] ? i : axis);
+      }
+      this->TileSize[axis] *= 2;
+      this->TileDims[axis] = static_cast<int>((this->Dims[axis] - 1) / this->TileSize[axis] + 1);
+    }
+    this->NumberOfTiles =
+      static_cast<vtkIdType>(this->TileDims[0]) * this->TileDims[1] * this->TileDims[2];
+  }
 
-  class Splat
+  // Compute the footprint of a splat within the volume, which is empty if
+  // min > max along any axis.
+  void GetFootprint(const double x[3], int min[3], int max[3]) const
   {
-  public:
-    vtkGaussianSplatterAlgorithm* Algo;
-    vtkIdType XMin, XMax, YMin, YMax, ZMin, ZMax;
-    Splat(vtkGaussianSplatterAlgorithm* algo) { this->Algo = algo; }
-    void SetBounds(int min[3], int max[3])
+    for (int i = 0; i < 3; i++)
     {
-      this->XMin = min[0];
-      this->XMax = max[0];
-      this->YMin = min[1];
-      this->YMax = max[1];
-      this->ZMin = min[2];
-      this->ZMax = max[2];
+      double loc = (x[i] - this->Origin[i]) / this->Spacing[i];
+      double lo = std::floor(loc - this->SplatDistance[i]);
+      double hi = std::ceil(loc + this->SplatDistance[i]);
+      // clamp before the conversion, for points far outside the volume
+      lo = std::min(std::max(lo, 0.0), static_cast<double>(this->Dims[i]));
+      hi = std::min(std::max(hi, -1.0), static_cast<double>(this->Dims[i] - 1));
+      min[i] = static_cast<int>(lo);
+      max[i] = static_cast<int>(hi);
     }
-    void operator()(vtkIdType slice, vtkIdType end)
+  }
+
+  // Call a function for every tile that the footprint of a point overlaps.
+  template <class F>
+  bool ForEachTile(vtkIdType ptId, F&& func) const
+  {
+    double x[3];
+    int min[3], max[3];
+    this->Input->GetPoint(ptId, x);
+    this->GetFootprint(x, min, max);
+    if (min[0] > max[0] || min[1] > max[1] || min[2] > max[2])
+    {
+      return false;
+    }
+    for (int k = min[2] / this->TileSize[2]; k <= max[2] / this->TileSize[2]; k++)
     {
-      vtkIdType i, j, jOffset, kOffset, idx;
-      double cx[3], dist2;
-      for (; slice < end; ++slice)
+      for (int j = min[1] / this->TileSize[1]; j <= max[1] / this->TileSize[1]; j++)
+      {
+        vtkIdType tile = (static_cast<vtkIdType>(k) * this->TileDims[1] + j) * this->TileDims[0];
+        for (int i = min[0] / this->TileSize[0]; i <= max[0] / this->TileSize[0]; i++)
+        {
+          func(tile + i);
+        }
+      }
+    }
+    return true;
+  }
+
+  // Sort the points of the input into the bins of the tiles. The points are
+  // counted and then inserted in chunks of consecutive ids, so that each bin
+  // lists its points in order and the result does not depend on threading.
+  void BinInputPoints()
+  {
+    vtkIdType numPts = this->Input->GetNumberOfPoints();
+    vtkIdType numTiles = this->NumberOfTiles;
+    vtkIdType numChunks = std::min((numPts + vtkGaussianSplatterAlgorithm::ChunkSize - 1) /
+        vtkGaussianSplatterAlgorithm::ChunkSize,
+      static_cast<vtkIdType>(vtkGaussianSplatterAlgorithm::MaximumNumberOfChunks));
+    vtkIdType chunkSize = (numChunks > 0 ? (numPts + numChunks - 1) / numChunks : 0);
+
+    // count the points of each chunk in each bin
+    std::vector<vtkIdType> counts(numChunks * numTiles, 0);
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+      for (; chunk < endChunk; ++chunk)
+      {
+        vtkIdType* chunkCounts = counts.data() + chunk * numTiles;
+        vtkIdType endId = std::min((chunk + 1) * chunkSize, numPts);
+        for (vtkIdType ptId = chunk * chunkSize; ptId < endId; ++ptId)
+        {
+          this->ForEachTile(ptId, [chunkCounts](vtkIdType tile) { chunkCounts[tile]++; });
+        }
+      }
+    });
+
+    // convert the counts into the position of each chunk within each bin
+    this->BinOffsets.resize(numTiles + 1);
+    vtkIdType total = 0;
+    for (vtkIdType tile = 0; tile < numTiles; ++tile)
+    {
+      this->BinOffsets[tile] = total;
+      for (vtkIdType chunk = 0; chunk < numChunks; ++chunk)
+      {
+        vtkIdType count = counts[chunk * numTiles + tile];
+        counts[chunk * numTiles + tile] = total;
+        total += count;
+      }
+    }
+    this->BinOffsets[numTiles] = total;
+
+    // insert the point ids into the bins
+    this->BinPoints.resize(total);
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+      for (; chunk < endChunk; ++chunk)
+      {
+        vtkIdType* chunkOffsets = counts.data() + chunk * numTiles;
+        vtkIdType* binPoints = this->BinPoints.data();
+        vtkIdType endId = std::min((chunk + 1) * chunkSize, numPts);
+        for (vtkIdType ptId = chunk * chunkSize; ptId < endId; ++ptId)
+        {
+          this->ForEachTile(
+            ptId, [=](vtkIdType tile) { binPoints[chunkOffsets[tile]++] = ptId; });
+        }
+      }
+    });
+  }
+
+  // Combine a splat value with the value of a voxel.
+  void Accumulate(vtkIdType idx, double v)
+  {
+    double* sPtr = this->Scalars + idx;
+    if (!this->Visited[idx])
+    {
+      this->Visited[idx] = 1;
+      *sPtr = v;
+    }
+    else if (this->AccumulationMode == VTK_ACCUMULATION_MODE_MIN)
+    {
+      *sPtr = (v < *sPtr ? v : *sPtr);
+    }
+    else if (this->AccumulationMode == VTK_ACCUMULATION_MODE_MAX)
+    {
+      *sPtr = (v > *sPtr ? v : *sPtr);
+    }
+    else
+    {
+      *sPtr += v;
+    }
+  }
+
+  // Splat all the points of a bin into the part of a tile between the
+  // given slices. The distances and the Gaussian along each axis are
+  // tabulated for each point, since the Gaussian of a spherical splat is
+  // the product of the Gaussians along the three axes.
+  void SplatTile(vtkIdType tile, int zMin, int zMax)
+  {
+    int tileMin[3], tileMax[3];
+    vtkIdType t[3] = { tile % this->TileDims[0], (tile / this->TileDims[0]) % this->TileDims[1],
+      tile / (static_cast<vtkIdType>(this->TileDims[0]) * this->TileDims[1]) };
+    for (int i = 0; i < 3; i++)
+    {
+      tileMin[i] = static_cast<int>(t[i] * this->TileSize[i]);
+      tileMax[i] = std::min(tileMin[i] + this->TileSize[i], static_cast<int>(this->Dims[i])) - 1;
+    }
+    tileMin[2] = std::max(tileMin[2], zMin);
+    tileMax[2] = std::min(tileMax[2], zMax);
+
+    std::vector<double> delta[3], delta2[3], gauss[3];
+    for (int i = 0; i < 3; i++)
+    {
+      delta[i].resize(this->TileSize[i]);
+      delta2[i].resize(this->TileSize[i]);
+      gauss[i].resize(this->TileSize[i]);
+    }
+
+    const double e = this->ExponentFactor / this->Radius2;
+    for (vtkIdType b = this->BinOffsets[tile]; b < this->BinOffsets[tile + 1]; ++b)
+    {
+      vtkIdType ptId = this->BinPoints[b];
+      double x[3];
+      int min[3], max[3];
+      this->Input->GetPoint(ptId, x);
+      this->GetFootprint(x, min, max);
+      for (int i = 0; i < 3; i++)
+      {
+        min[i] = std::max(min[i], tileMin[i]);
+        max[i] = std::min(max[i], tileMax[i]);
+      }
+      if (min[0] > max[0] || min[1] > max[1] || min[2] > max[2])
+      {
+        continue;
+      }
+
+      double factor = this->ScaleFactor;
+      if (this->InScalars)
+      {
+        factor *= this->InScalars->GetComponent(ptId, 0);
+      }
+
+      // tabulate the distances, and the Gaussian if the splat is spherical
+      for (int i = 0; i < 3; i++)
       {
-        // Loop over all sample points in volume within footprint and
-        // evaluate the splat
-        cx[2] = this->Algo->Origin[2] + this->Algo->Spacing[2] * slice;
-        kOffset = slice * this->Algo->SliceSize;
-        for (j = this->YMin; j <= this->YMax; j++)
+        for (int idx = min[i]; idx <= max[i]; idx++)
         {
-          cx[1] = this->Algo->Origin[1] + this->Algo->Spacing[1] * j;
-          jOffset = j * this->Algo->Dims[0];
-          for (i = this->XMin; i <= this->XMax; i++)
+          double d = this->Origin[i] + this->Spacing[i] * idx - x[i];
+          delta[i][idx - min[i]] = d;
+          delta2[i][idx - min[i]] = d * d;
+          if (!this->InNormals)
           {
-            cx[0] = this->Algo->Origin[0] + this->Algo->Spacing[0] * i;
-            dist2 = this->Algo->Splatter->SamplePoint(cx);
-            if (dist2 <= this->Algo->Radius2)
+            gauss[i][idx - min[i]] = std::exp(e * (d * d));
+          }
+        }
+      }
+
+      if (this->InNormals)
+      {
+        this->SplatEccentric(ptId, factor, min, max, delta, delta2);
+        continue;
+      }
+
+      for (int k = min[2]; k <= max[2]; k++)
+      {
+        double dz2 = delta2[2][k - min[2]];
+        double gz = factor * gauss[2][k - min[2]];
+        for (int j = min[1]; j <= max[1]; j++)
+        {
+          double dy2 = delta2[1][j - min[1]];
+          if (dy2 + dz2 > this->Radius2)
+          {
+            continue;
+          }
+          double gyz = gz * gauss[1][j - min[1]];
+          vtkIdType offset = k * this->SliceSize + j * this->Dims[0];
+          for (int i = min[0]; i <= max[0]; i++)
+          {
+            if (delta2[0][i - min[0]] + dy2 + dz2 <= this->Radius2)
             {
-              idx = i + jOffset + kOffset;
-              this->Algo->Splatter->SetScalar(idx, dist2, this->Algo->Scalars + idx);
-            } // if within splat radius
-          }   // i
-        }     // j
-      }       // k within splat footprint
-    }
-  };
+              this->Accumulate(offset + i, gyz * gauss[0][i - min[0]]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Splat an elliptical splat, whose Gaussian is not separable.
+  void SplatEccentric(vtkIdType ptId, double factor, const int min[3], const int max[3],
+    const std::vector<double> delta[3], const std::vector<double> delta2[3])
+  {
+    double n[3];
+    this->InNormals->GetTuple(ptId, n);
+    double mag = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+    mag = (mag == 0.0 ? 1.0 : std::sqrt(mag));
+
+    const double e = this->ExponentFactor / this->Radius2;
+    for (int k = min[2]; k <= max[2]; k++)
+    {
+      double dz = delta[2][k - min[2]];
+      double dz2 = delta2[2][k - min[2]];
+      for (int j = min[1]; j <= max[1]; j++)
+      {
+        double dy = delta[1][j - min[1]];
+        double dy2 = delta2[1][j - min[1]];
+        vtkIdType offset = k * this->SliceSize + j * this->Dims[0];
+        for (int i = min[0]; i <= max[0]; i++)
+        {
+          double dx = delta[0][i - min[0]];
+          double r2 = delta2[0][i - min[0]] + dy2 + dz2;
+          double z = (dx * n[0] + dy * n[1] + dz * n[2]) / mag;
+          double z2 = z * z;
+          double dist2 = (r2 - z2) / this->Eccentricity2 + z2;
+          if (dist2 <= this->Radius2)
+          {
+            this->Accumulate(offset + i, factor * std::exp(e * dist2));
+          }
+        }
+      }
+    }
+  }
+
+  // Splat the tiles in parallel. The slices of the tiles that have many
+  // more points than average are splatted in parallel too, in case the
+  // nested parallelism of vtkSMPTools is enabled.
+  void SplatTiles()
+  {
+    vtkIdType hotCount = 8 * (this->BinOffsets[this->NumberOfTiles] / this->NumberOfTiles + 1);
+    hotCount = std::max(hotCount, static_cast<vtkIdType>(vtkGaussianSplatterAlgorithm::ChunkSize));
+    vtkGaussianSplatter* self = this->Splatter;
+    vtkSMPTools::For(0, this->NumberOfTiles, [&](vtkIdType tile, vtkIdType endTile) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      for (; tile < endTile; ++tile)
+      {
+        if (isFirst)
+        {
+          self->CheckAbort();
+        }
+        if (self->GetAbortOutput())
+        {
+          break;
+        }
+        if (this->BinOffsets[tile + 1] - this->BinOffsets[tile] > hotCount)
+        {
+          int z0 = static_cast<int>(tile / (static_cast<vtkIdType>(this->TileDims[0]) *
+                                       this->TileDims[1])) *
+            this->TileSize[2];
+          vtkSMPTools::For(z0, z0 + this->TileSize[2], [&](vtkIdType z, vtkIdType endZ) {
+            this->SplatTile(tile, static_cast<int>(z), static_cast<int>(endZ) - 1);
+          });
+        }
+        else
+        {
+          this->SplatTile(tile, 0, static_cast<int>(this->Dims[2]) - 1);
+        }
+      }
+    });
+  }
+
+  static constexpr vtkIdType ChunkSize = 4096;
+  static constexpr int MaximumNumberOfChunks = 256;
+  static constexpr vtkIdType MaximumNumberOfTiles = 16384;
 };
 
 //------------------------------------------------------------------------------
@@ -172,11 +470,9 @@ int vtkGaussianSplatter::RequestData(vtkInformation* vtkNotUsed(request),
   output->SetExtent(outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()));
   output->AllocateScalars(outInfo);
 
-  vtkIdType totalNumPts, numNewPts, ptId, i;
-  int min[3], max[3];
+  vtkIdType totalNumPts, numNewPts, i;
   vtkPointData* pd;
   vtkDataArray* inNormals = nullptr;
-  double loc[3];
   vtkDoubleArray* newScalars =
     vtkArrayDownCast<vtkDoubleArray>(output->GetPointData()->GetScalars());
   newScalars->SetName("SplatterValues");
@@ -271,18 +567,26 @@ int vtkGaussianSplatter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkGaussianSplatterAlgorithm algo;
   algo.Splatter = this;
   algo.Scalars = scalars;
+  algo.Visited = this->Visited;
   algo.Radius2 = this->Radius2;
+  algo.ExponentFactor = this->ExponentFactor;
+  algo.ScaleFactor = this->ScaleFactor;
+  algo.Eccentricity2 = this->Eccentricity2;
+  algo.AccumulationMode = this->AccumulationMode;
   algo.SliceSize = this->SampleDimensions[0] * this->SampleDimensions[1];
   for (i = 0; i < 3; ++i)
   {
     algo.Dims[i] = this->SampleDimensions[i];
     algo.Origin[i] = this->Origin[i];
     algo.Spacing[i] = this->Spacing[i];
+    algo.SplatDistance[i] = this->SplatDistance[i];
   }
-  vtkGaussianSplatterAlgorithm::Splat splat(&algo);
+  algo.ComputeTiles();
 
   // Process all input datasets
-  for (dataItr->InitTraversal(); !dataItr->IsDoneWithTraversal(); dataItr->GoToNextItem())
+  vtkIdType numSplatted = 0;
+  for (dataItr->InitTraversal(); !dataItr->IsDoneWithTraversal() && !this->GetAbortOutput();
+       dataItr->GoToNextItem())
   {
     vtkDataSet* input = vtkDataSet::SafeDownCast(dataItr->GetCurrentDataObject());
     if (!input)
@@ -317,59 +621,23 @@ int vtkGaussianSplatter::RequestData(vtkInformation* vtkNotUsed(request),
       continue;
     }
     vtkIdType numPts = input->GetNumberOfPoints();
-
-    // Traverse all points - splatting each into the volume.
-    // For each point, determine which voxel it is in.  Then determine
-    // the subvolume that the splat is contained in, and process that.
-    //
-    int abortExecute = 0;
-    vtkIdType progressInterval = numPts / 20 + 1;
-    for (ptId = 0; ptId < numPts && !abortExecute; ptId++)
+    if (numPts == 0)
     {
-      if (!(ptId % progressInterval))
-      {
-        vtkDebugMacro(<< "Inserting point #" << ptId);
-        this->UpdateProgress(static_cast<double>(ptId) / numPts);
-        abortExecute = this->GetAbortExecute();
-      }
-
-      this->P = input->GetPoint(ptId);
-      if (myNormals != nullptr)
-      {
-        this->N = myNormals->GetTuple(ptId);
-      }
-      if (myScalars != nullptr)
-      {
-        this->S = myScalars->GetComponent(ptId, 0);
-      }
-
-      // Determine the voxel that the point is in
-      for (i = 0; i < 3; i++)
-      {
-        loc[i] = (this->P[i] - this->Origin[i]) / this->Spacing[i];
-      }
-
-      // Determine splat footprint
-      for (i = 0; i < 3; i++)
-      {
-        min[i] = static_cast<int>(floor(static_cast<double>(loc[i]) - this->SplatDistance[i]));
-        max[i] = static_cast<int>(ceil(static_cast<double>(loc[i]) + this->SplatDistance[i]));
-        if (min[i] < 0)
-        {
-          min[i] = 0;
-        }
-        if (max[i] >= this->SampleDimensions[i])
-        {
-          max[i] = this->SampleDimensions[i] - 1;
-        }
-      }
-
-      // Parallel splat the point
-      splat.SetBounds(min, max);
-      vtkSMPTools::For(min[2], max[2] + 1, splat);
+      continue;
+    }
 
-    } // for all input points
-  }   // for all datasets
+    // Sort the points into the tiles that their footprints overlap, and
+    // then splat the tiles in parallel.
+    vtkDebugMacro(<< "Splatting " << numPts << " points");
+    algo.Input = input;
+    algo.InScalars = (this->ScalarWarping ? myScalars : nullptr);
+    algo.InNormals = myNormals;
+    algo.BinInputPoints();
+    algo.SplatTiles();
+
+    numSplatted += numPts;
+    this->UpdateProgress(static_cast<double>(numSplatted) / totalNumPts);
+  } // for all datasets
 
   // If capping is turned on, set the distances of the outside of the volume
   // to the CapValue.
@@ -65,6 +65,11 @@
  * This class has been threaded with vtkSMPTools. Using TBB or other
  * non-sequential type (set in the CMake variable
  * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ * The points are first sorted into bins according to the tiles of the
+ * volume that their splats overlap, and then the tiles are splatted in
+ * parallel, each by a single thread, so that densely clustered points do
+ * not cause write conflicts. Spherical splats are computed as the product
+ * of Gaussians tabulated along each axis.
  *
  * @sa
  * vtkShepardMethod vtkCheckerboardSplatter
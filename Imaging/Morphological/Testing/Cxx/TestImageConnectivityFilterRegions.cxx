@@ -0,0 +1,212 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestImageConnectivityFilterRegions.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare the regions found by vtkImageConnectivityFilter in a random mask
+// with those of a simple flood fill, so that regions crossing the slabs that
+// are labeled by different threads are checked.
+
+#include "vtkIdTypeArray.h"
+#include "vtkImageConnectivityFilter.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+const int Extent[6] = { 2, 41, -3, 26, 0, 19 };
+const int Dims[3] = { 40, 30, 20 };
+
+// Label the mask in raster order with a 6-connected flood fill, and compute
+// the size and extent of each region.
+int ReferenceLabels(const std::vector<unsigned char>& mask, std::vector<int>& labels,
+  std::vector<vtkIdType>& sizes, std::vector<int>& extents)
+{
+  labels.assign(mask.size(), 0);
+  int numRegions = 0;
+  std::vector<vtkIdType> stack;
+  for (vtkIdType seed = 0; seed < static_cast<vtkIdType>(mask.size()); ++seed)
+  {
+    if (!mask[seed] || labels[seed])
+    {
+      continue;
+    }
+    ++numRegions;
+    labels[seed] = numRegions;
+    sizes.push_back(0);
+    int ext[6] = { VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN };
+    stack.push_back(seed);
+    while (!stack.empty())
+    {
+      vtkIdType id = stack.back();
+      stack.pop_back();
+      ++sizes.back();
+      int ijk[3] = { static_cast<int>(id % Dims[0]), static_cast<int>((id / Dims[0]) % Dims[1]),
+        static_cast<int>(id / (Dims[0] * Dims[1])) };
+      const vtkIdType steps[3] = { 1, Dims[0], Dims[0] * Dims[1] };
+      for (int k = 0; k < 3; ++k)
+      {
+        ext[2 * k] = std::min(ext[2 * k], ijk[k] + Extent[2 * k]);
+        ext[2 * k + 1] = std::max(ext[2 * k + 1], ijk[k] + Extent[2 * k]);
+        if (ijk[k] > 0 && mask[id - steps[k]] && !labels[id - steps[k]])
+        {
+          labels[id - steps[k]] = numRegions;
+          stack.push_back(id - steps[k]);
+        }
+        if (ijk[k] < Dims[k] - 1 && mask[id + steps[k]] && !labels[id + steps[k]])
+        {
+          labels[id + steps[k]] = numRegions;
+          stack.push_back(id + steps[k]);
+        }
+      }
+    }
+    extents.insert(extents.end(), ext, ext + 6);
+  }
+  return numRegions;
+}
+}
+
+int TestImageConnectivityFilterRegions(int, char*[])
+{
+  // A random mask that is dense enough for regions to span many rows.
+  vtkNew<vtkImageData> image;
+  image->SetExtent(const_cast<int*>(Extent));
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+  unsigned char* maskPtr = static_cast<unsigned char*>(image->GetScalarPointer());
+  const vtkIdType numVoxels = image->GetNumberOfPoints();
+  std::vector<unsigned char> mask(numVoxels);
+  unsigned int state = 12345;
+  for (vtkIdType i = 0; i < numVoxels; ++i)
+  {
+    state = state * 1103515245u + 12345u;
+    mask[i] = ((state >> 16) % 100 < 45 ? 1 : 0);
+    maskPtr[i] = mask[i];
+  }
+
+  std::vector<int> labels;
+  std::vector<vtkIdType> sizes;
+  std::vector<int> extents;
+  const int numRegions = ReferenceLabels(mask, labels, sizes, extents);
+
+  int retVal = EXIT_SUCCESS;
+
+  // All regions, labeled in the order in which they are found.
+  vtkNew<vtkImageConnectivityFilter> filter;
+  filter->SetInputData(image);
+  filter->SetLabelScalarTypeToInt();
+  filter->GenerateRegionExtentsOn();
+  filter->Update();
+  int* outPtr = static_cast<int*>(filter->GetOutput()->GetScalarPointer());
+  if (filter->GetNumberOfExtractedRegions() != numRegions ||
+    !std::equal(labels.begin(), labels.end(), outPtr))
+  {
+    std::cerr << "Found " << filter->GetNumberOfExtractedRegions() << " regions instead of "
+              << numRegions << " or wrong labels" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < numRegions; ++i)
+  {
+    if (filter->GetExtractedRegionSizes()->GetValue(i) != sizes[i] ||
+      !std::equal(extents.begin() + 6 * i, extents.begin() + 6 * i + 6,
+        filter->GetExtractedRegionExtents()->GetPointer(6 * i)))
+    {
+      std::cerr << "Wrong size or extent for region " << (i + 1) << std::endl;
+      retVal = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  // The largest region only.
+  const vtkIdType largest =
+    std::distance(sizes.begin(), std::max_element(sizes.begin(), sizes.end())) + 1;
+  filter->SetExtractionModeToLargestRegion();
+  filter->Update();
+  outPtr = static_cast<int*>(filter->GetOutput()->GetScalarPointer());
+  for (vtkIdType i = 0; i < numVoxels; ++i)
+  {
+    if (outPtr[i] != (labels[i] == largest ? 1 : 0))
+    {
+      std::cerr << "Wrong output for the largest region at voxel " << i << std::endl;
+      retVal = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  // Seeded regions labeled by the seed scalars, where the second seed is in
+  // the region of the first one and the third one is outside of the mask.
+  vtkIdType seedVoxels[3] = { -1, -1, -1 };
+  for (vtkIdType i = 0; i < numVoxels && seedVoxels[1] < 0; ++i)
+  {
+    if (labels[i] == largest)
+    {
+      seedVoxels[seedVoxels[0] < 0 ? 0 : 1] = i;
+    }
+  }
+  seedVoxels[2] = std::distance(mask.begin(), std::find(mask.begin(), mask.end(), 0));
+  vtkNew<vtkPoints> seedPoints;
+  vtkNew<vtkUnsignedCharArray> seedScalars;
+  for (int i = 0; i < 3; ++i)
+  {
+    double point[3];
+    image->GetPoint(seedVoxels[i], point);
+    seedPoints->InsertNextPoint(point);
+    seedScalars->InsertNextValue(static_cast<unsigned char>(10 * (i + 1)));
+  }
+  vtkNew<vtkPolyData> seedData;
+  seedData->SetPoints(seedPoints);
+  seedData->GetPointData()->SetScalars(seedScalars);
+  filter->SetSeedData(seedData);
+  filter->SetExtractionModeToSeededRegions();
+  filter->Update();
+  outPtr = static_cast<int*>(filter->GetOutput()->GetScalarPointer());
+  if (filter->GetNumberOfExtractedRegions() != 1 ||
+    filter->GetExtractedRegionSeedIds()->GetValue(0) != 0)
+  {
+    std::cerr << "Found " << filter->GetNumberOfExtractedRegions()
+              << " seeded regions instead of 1" << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < numVoxels; ++i)
+  {
+    if (outPtr[i] != (labels[i] == largest ? 10 : 0))
+    {
+      std::cerr << "Wrong output for the seeded region at voxel " << i << std::endl;
+      retVal = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  // More regions than unsigned char labels: some regions are discarded.
+  filter->SetSeedData(nullptr);
+  filter->SetExtractionModeToAllRegions();
+  filter->SetLabelScalarTypeToUnsignedChar();
+  filter->Update();
+  if (numRegions <= 255 || filter->GetNumberOfExtractedRegions() == 0 ||
+    filter->GetNumberOfExtractedRegions() > 255)
+  {
+    std::cerr << "Wrong number of regions with unsigned char labels: "
+              << filter->GetNumberOfExtractedRegions() << std::endl;
+    retVal = EXIT_FAILURE;
+  }
+
+  return retVal;
+}
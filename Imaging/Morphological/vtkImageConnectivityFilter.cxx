@@ -59,6 +59,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTemplateAliasMacro.h"
@@ -278,6 +279,12 @@ protected:
   static void PruneSmallestRegion(vtkImageData* outData, OT* outPtr, vtkImageStencilData* stencil,
     int extent[6], vtkICF::RegionVector& regionInfo);
 
+  // Remove the regions that aren't in the given range of sizes from the
+  // list, and give the new label of each region. Returns false if all the
+  // regions are in the range.
+  static bool PruneRegionsBySize(
+    vtkIdType sizeRange[2], vtkICF::RegionVector& regionInfo, std::vector<vtkIdType>& newlabels);
+
   // Remove all islands that aren't in the given range of sizes
   template <class OT>
   static void PruneBySize(vtkImageData* outData, OT* outPtr, vtkImageStencilData* stencil,
@@ -329,6 +336,14 @@ protected:
     vtkImageStencilData* stencil, OT* outPtr, unsigned char* maskPtr, int extent[6],
     vtkICF::RegionVector& regionInfo);
 
+  // Execute method that labels the image with several threads, for seeds
+  // or no seeds.  Returns false without touching the output or the mask if
+  // there are more regions than labels, since the regions that are removed
+  // then depend on the order in which the serial methods find them.
+  template <class OT>
+  static bool ParallelExecute(vtkImageConnectivityFilter* self, vtkImageData* outData,
+    vtkDataSet* seedData, OT* outPtr, unsigned char* maskPtr, int extent[6]);
+
 public:
   // Create a bit mask from the input
   template <class IT>
@@ -664,13 +679,12 @@ void vtkICF::PruneSmallestRegion(vtkImageData* outData, OT* outPtr, vtkImageSten
 }
 
 //------------------------------------------------------------------------------
-template <class OT>
-void vtkICF::PruneBySize(vtkImageData* outData, OT* outPtr, vtkImageStencilData* stencil,
-  int extent[6], vtkIdType sizeRange[2], vtkICF::RegionVector& regionInfo)
+bool vtkICF::PruneRegionsBySize(
+  vtkIdType sizeRange[2], vtkICF::RegionVector& regionInfo, std::vector<vtkIdType>& newlabels)
 {
   // find all the regions in the allowed size range
   size_t n = regionInfo.size();
-  std::vector<OT> newlabels(n);
+  newlabels.resize(n);
   newlabels[0] = 0;
   size_t m = 1;
   for (size_t i = 1; i < n; i++)
@@ -685,15 +699,23 @@ void vtkICF::PruneBySize(vtkImageData* outData, OT* outPtr, vtkImageStencilData*
         regionInfo[l] = regionInfo[i];
       }
     }
-    newlabels[i] = static_cast<OT>(l);
+    newlabels[i] = static_cast<vtkIdType>(l);
   }
 
+  // resize regionInfo if any regions were outside of the range
+  regionInfo.resize(m);
+  return (m < n);
+}
+
+//------------------------------------------------------------------------------
+template <class OT>
+void vtkICF::PruneBySize(vtkImageData* outData, OT* outPtr, vtkImageStencilData* stencil,
+  int extent[6], vtkIdType sizeRange[2], vtkICF::RegionVector& regionInfo)
+{
   // were any regions outside of the range?
-  if (m < n)
+  std::vector<vtkIdType> newlabels;
+  if (vtkICF::PruneRegionsBySize(sizeRange, regionInfo, newlabels))
   {
-    // resize regionInfo
-    regionInfo.resize(m);
-
     // clip the extent with the output extent
     int outExt[6];
     outData->GetExtent(outExt);
@@ -715,7 +737,7 @@ void vtkICF::PruneBySize(vtkImageData* outData, OT* outPtr, vtkImageStencilData*
           OT v = *outPtr;
           if (v != 0)
           {
-            *outPtr = newlabels[v];
+            *outPtr = static_cast<OT>(newlabels[v]);
           }
         }
       }
@@ -1324,6 +1346,358 @@ void vtkICF::SeedlessExecute(vtkImageConnectivityFilter* self, vtkImageData* out
   }
 }
 
+//------------------------------------------------------------------------------
+// Label the connected components with runs of voxels: each row of the mask
+// is split into runs, the rows are split into slabs that are labeled by
+// different threads with a union-find forest, and the equivalences across
+// the slab boundaries are merged afterwards.
+template <class OT>
+bool vtkICF::ParallelExecute(vtkImageConnectivityFilter* self, vtkImageData* outData,
+  vtkDataSet* seedData, OT* outPtr, unsigned char* maskPtr, int extent[6])
+{
+  // Get execution parameters
+  int labelMode = self->GetLabelMode();
+  int extractionMode = self->GetExtractionMode();
+  vtkIdType sizeRange[2];
+  self->GetSizeRange(sizeRange);
+  bool growExtent = (self->GetGenerateRegionExtents() != 0);
+
+  vtkIdType outInc[3];
+  outData->GetIncrements(outInc);
+
+  int outExt[6];
+  outData->GetExtent(outExt);
+
+  int maxIdx[3];
+  int* outLimits = vtkICF::ZeroBaseExtent(extent, outExt, maxIdx);
+  int limits[6] = { 0, maxIdx[0], 0, maxIdx[1], 0, maxIdx[2] };
+  if (outLimits)
+  {
+    std::copy(outLimits, outLimits + 6, limits);
+  }
+
+  // a run of voxels within a row, the row of index "r" is at (r % ny, r / ny)
+  struct Run
+  {
+    int x0;
+    int x1;
+  };
+
+  const vtkIdType nx = maxIdx[0] + 1;
+  const vtkIdType ny = maxIdx[1] + 1;
+  const vtkIdType nRows = ny * (maxIdx[2] + 1);
+
+  // find the runs of voxels that are not set in the mask, store them in
+  // "run" unless it is null, and return how many there are
+  auto findRuns = [maskPtr, nx](vtkIdType row, Run* run) {
+    vtkIdType count = 0;
+    vtkIdType offset = row * nx;
+    int x0 = -1;
+    for (int x = 0; x <= nx; ++x, ++offset)
+    {
+      bool isSet = (x == nx || ((maskPtr[offset >> 3] >> (offset & 0x7)) & 1) != 0);
+      if (!isSet && x0 < 0)
+      {
+        x0 = x;
+      }
+      else if (isSet && x0 >= 0)
+      {
+        if (run)
+        {
+          run[count].x0 = x0;
+          run[count].x1 = x - 1;
+        }
+        ++count;
+        x0 = -1;
+      }
+    }
+    return count;
+  };
+
+  // find the runs of each row
+  std::vector<vtkIdType> rowStart(nRows + 1, 0);
+  vtkSMPTools::For(0, nRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType r = begin; r < end; ++r)
+    {
+      rowStart[r + 1] = findRuns(r, nullptr);
+    }
+  });
+  for (vtkIdType r = 0; r < nRows; ++r)
+  {
+    rowStart[r + 1] += rowStart[r];
+  }
+  std::vector<Run> runs(rowStart[nRows]);
+  vtkSMPTools::For(0, nRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType r = begin; r < end; ++r)
+    {
+      findRuns(r, runs.data() + rowStart[r]);
+    }
+  });
+
+  // the root of each tree is its run of smallest index, i.e. the first run
+  // of the region in raster order
+  std::vector<vtkIdType> parent(runs.size());
+  for (size_t i = 0; i < parent.size(); ++i)
+  {
+    parent[i] = static_cast<vtkIdType>(i);
+  }
+  auto find = [&parent](vtkIdType i) {
+    while (parent[i] != i)
+    {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  // join the regions of the overlapping runs of two rows
+  auto mergeRows = [&](vtkIdType row1, vtkIdType row2) {
+    vtkIdType i = rowStart[row1];
+    vtkIdType j = rowStart[row2];
+    while (i < rowStart[row1 + 1] && j < rowStart[row2 + 1])
+    {
+      if (runs[i].x0 <= runs[j].x1 && runs[j].x0 <= runs[i].x1)
+      {
+        vtkIdType root1 = find(i);
+        vtkIdType root2 = find(j);
+        if (root1 < root2)
+        {
+          parent[root2] = root1;
+        }
+        else if (root2 < root1)
+        {
+          parent[root1] = root2;
+        }
+      }
+      if (runs[i].x1 < runs[j].x1)
+      {
+        ++i;
+      }
+      else
+      {
+        ++j;
+      }
+    }
+  };
+
+  // label the slabs, a slab only touches the trees of its own runs
+  vtkIdType nSlabs = 4 * vtkSMPTools::GetEstimatedNumberOfThreads();
+  nSlabs = std::max<vtkIdType>(1, std::min(nSlabs, nRows));
+  auto slabStart = [nRows, nSlabs](vtkIdType slab) { return slab * nRows / nSlabs; };
+  vtkSMPTools::For(0, nSlabs, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType slab = begin; slab < end; ++slab)
+    {
+      const vtkIdType r0 = slabStart(slab);
+      for (vtkIdType r = r0; r < slabStart(slab + 1); ++r)
+      {
+        if (r % ny != 0 && r - 1 >= r0)
+        {
+          mergeRows(r, r - 1);
+        }
+        if (r - ny >= r0)
+        {
+          mergeRows(r, r - ny);
+        }
+      }
+    }
+  });
+
+  // merge the equivalences across the slab boundaries
+  for (vtkIdType slab = 1; slab < nSlabs; ++slab)
+  {
+    const vtkIdType r0 = slabStart(slab);
+    for (vtkIdType r = r0; r < std::min(r0 + ny, slabStart(slab + 1)); ++r)
+    {
+      if (r % ny != 0 && r - 1 < r0)
+      {
+        mergeRows(r, r - 1);
+      }
+      if (r - ny >= 0 && r - ny < r0)
+      {
+        mergeRows(r, r - ny);
+      }
+    }
+  }
+
+  // number the regions in raster order, replacing the parent of each run
+  // with its region, and measure the regions
+  vtkICF::RegionVector components;
+  for (vtkIdType r = 0; r < nRows; ++r)
+  {
+    const int y = static_cast<int>(r % ny);
+    const int z = static_cast<int>(r / ny);
+    for (vtkIdType i = rowStart[r]; i < rowStart[r + 1]; ++i)
+    {
+      const Run& run = runs[i];
+      if (parent[i] == i)
+      {
+        int regionExtent[6] = { run.x0, (growExtent ? run.x1 : run.x0), y, y, z, z };
+        parent[i] = static_cast<vtkIdType>(components.size());
+        components.push_back(vtkICF::Region(run.x1 - run.x0 + 1, -1, regionExtent));
+        continue;
+      }
+      parent[i] = parent[parent[i]];
+      vtkICF::Region& component = components[parent[i]];
+      component.size += run.x1 - run.x0 + 1;
+      if (growExtent)
+      {
+        component.extent[0] = std::min(component.extent[0], run.x0);
+        component.extent[1] = std::max(component.extent[1], run.x1);
+        component.extent[2] = std::min(component.extent[2], y);
+        component.extent[3] = std::max(component.extent[3], y);
+        component.extent[5] = z;
+      }
+    }
+  }
+
+  // build the regions like the serial methods: first the regions of the
+  // seeds, in the order of the seeds, then all others in raster order
+  vtkICF::RegionVector regionInfo;
+  regionInfo.push_back(vtkICF::Region(0, 0, extent));
+  std::vector<vtkIdType> componentRegion(components.size(), 0);
+  const size_t maxRegions = static_cast<size_t>(vtkTypeTraits<OT>::Max());
+
+  vtkDataArray* seedScalars = nullptr;
+  if (seedData)
+  {
+    seedScalars = seedData->GetPointData()->GetScalars();
+
+    double spacing[3];
+    double origin[3];
+    outData->GetOrigin(origin);
+    outData->GetSpacing(spacing);
+
+    vtkIdType nPoints = seedData->GetNumberOfPoints();
+    for (vtkIdType i = 0; i < nPoints; i++)
+    {
+      if (seedScalars && seedScalars->GetComponent(i, 0) == 0)
+      {
+        continue;
+      }
+
+      double point[3];
+      seedData->GetPoint(i, point);
+      int idx[3];
+      bool outOfBounds = false;
+
+      // convert point from data coords to image index
+      for (int j = 0; j < 3; j++)
+      {
+        idx[j] = vtkMath::Floor((point[j] - origin[j]) / spacing[j] + 0.5);
+        idx[j] -= extent[2 * j];
+        outOfBounds |= (idx[j] < 0 || idx[j] > maxIdx[j]);
+      }
+
+      if (outOfBounds)
+      {
+        continue;
+      }
+
+      // find the run that holds the seed, if any
+      vtkIdType r = idx[2] * ny + idx[1];
+      auto runEnd = runs.begin() + rowStart[r + 1];
+      auto run = std::upper_bound(runs.begin() + rowStart[r], runEnd, idx[0],
+        [](int x, const Run& a) { return x < a.x0; });
+      if (run == runs.begin() + rowStart[r] || (run - 1)->x1 < idx[0])
+      {
+        continue;
+      }
+
+      vtkIdType component = parent[std::distance(runs.begin(), run - 1)];
+      if (componentRegion[component] != 0)
+      {
+        continue;
+      }
+
+      componentRegion[component] = static_cast<vtkIdType>(regionInfo.size());
+      regionInfo.push_back(components[component]);
+      regionInfo.back().id = i;
+      if (!growExtent)
+      {
+        int* regionExtent = regionInfo.back().extent;
+        regionExtent[0] = regionExtent[1] = idx[0];
+        regionExtent[2] = regionExtent[3] = idx[1];
+        regionExtent[4] = regionExtent[5] = idx[2];
+      }
+      if (regionInfo.size() > maxRegions)
+      {
+        return false;
+      }
+    }
+  }
+
+  if (!seedData || extractionMode == vtkImageConnectivityFilter::AllRegions)
+  {
+    for (size_t component = 0; component < components.size(); ++component)
+    {
+      if (componentRegion[component] == 0)
+      {
+        componentRegion[component] = static_cast<vtkIdType>(regionInfo.size());
+        regionInfo.push_back(components[component]);
+        if (regionInfo.size() > maxRegions)
+        {
+          return false;
+        }
+      }
+    }
+  }
+
+  // do the bookkeeping of Finish(), but on the regions instead of the voxels
+  std::vector<vtkIdType> newlabels;
+  vtkICF::PruneRegionsBySize(sizeRange, regionInfo, newlabels);
+
+  vtkICF::GenerateRegionArrays(
+    self, regionInfo, seedScalars, extent, vtkTypeTraits<OT>::Min(), vtkTypeTraits<OT>::Max());
+
+  std::vector<OT> regionLabels(regionInfo.size(), 0);
+  vtkIdTypeArray* labelArray = self->GetExtractedRegionLabels();
+  if (labelArray->GetNumberOfTuples() > 0)
+  {
+    if (extractionMode == vtkImageConnectivityFilter::LargestRegion)
+    {
+      regionLabels[std::distance(regionInfo.begin(), regionInfo.largest())] =
+        static_cast<OT>(labelArray->GetValue(0));
+    }
+    else
+    {
+      bool relabel = (labelMode != vtkImageConnectivityFilter::SeedScalar || seedScalars != nullptr);
+      for (size_t i = 1; i < regionLabels.size(); ++i)
+      {
+        vtkIdType label = static_cast<vtkIdType>(i);
+        regionLabels[i] = static_cast<OT>(relabel ? labelArray->GetValue(label - 1) : label);
+      }
+    }
+
+    // sort the three region info arrays
+    vtkICF::SortRegionArrays(self);
+  }
+
+  // write the labels of the runs that are within the output
+  vtkSMPTools::For(0, nRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType r = begin; r < end; ++r)
+    {
+      const int y = static_cast<int>(r % ny);
+      const int z = static_cast<int>(r / ny);
+      if (y < limits[2] || y > limits[3] || z < limits[4] || z > limits[5])
+      {
+        continue;
+      }
+      OT* outRow = outPtr + (y - limits[2]) * outInc[1] + (z - limits[4]) * outInc[2];
+      for (vtkIdType i = rowStart[r]; i < rowStart[r + 1]; ++i)
+      {
+        OT label = regionLabels[newlabels[componentRegion[parent[i]]]];
+        int x0 = std::max(runs[i].x0, limits[0]);
+        int x1 = std::min(runs[i].x1, limits[1]);
+        for (int x = x0; label != 0 && x <= x1; ++x)
+        {
+          outRow[(x - limits[0]) * outInc[0]] = label;
+        }
+      }
+    }
+  });
+
+  return true;
+}
+
 //------------------------------------------------------------------------------
 // This templated function executes the filter for any type of data.
 template <class OT>
@@ -1331,6 +1705,12 @@ void vtkICF::ExecuteOutput(vtkImageConnectivityFilter* self, vtkImageData* outDa
   vtkDataSet* seedData, vtkImageStencilData* stencil, OT* outPtr, unsigned char* maskPtr,
   int extent[6])
 {
+  // label with several threads, unless the labels would overflow
+  if (vtkICF::ParallelExecute(self, outData, seedData, outPtr, maskPtr, extent))
+  {
+    return;
+  }
+
   // push the "background" onto the region vector
   vtkICF::RegionVector regionInfo;
   regionInfo.push_back(vtkICF::Region(0, 0, extent));
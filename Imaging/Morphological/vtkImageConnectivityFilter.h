@@ -86,6 +86,11 @@
  * is called.  These extents can be useful for cropping the output
  * of the filter.
  *
+ * The regions are found with several threads through vtkSMPTools.  If
+ * there are more regions than the output scalar type can label, the
+ * filter falls back to a single thread, since it must then discard
+ * regions in the order in which it finds them.
+ *
  * @sa
  * vtkConnectivityFilter, vtkPolyDataConnectivityFilter, vtkmImageConnectivity
  */
@@ -0,0 +1,141 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestOpenGLImageDenoising.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compare the multi-pass GPU versions of the gaussian smoothing, the
+// anisotropic diffusion and the bilateral filter with the CPU versions,
+// on the whole image and on a piece of it.
+
+#include "vtkImageAnisotropicDiffusion3D.h"
+#include "vtkImageBilateralFilter.h"
+#include "vtkImageData.h"
+#include "vtkImageGaussianSmooth.h"
+#include "vtkNew.h"
+#include "vtkOpenGLImageAnisotropicDiffusion3D.h"
+#include "vtkOpenGLImageBilateralFilter.h"
+#include "vtkOpenGLImageGaussianSmooth.h"
+#include "vtkRenderWindow.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+int Compare(const char* name, vtkImageAlgorithm* cpu, vtkImageAlgorithm* gpu, const int piece[6])
+{
+  cpu->UpdateExtent(piece);
+  gpu->UpdateExtent(piece);
+  vtkImageData* expected = cpu->GetOutput();
+  vtkImageData* output = gpu->GetOutput();
+  for (int k = piece[4]; k <= piece[5]; k++)
+  {
+    for (int j = piece[2]; j <= piece[3]; j++)
+    {
+      for (int i = piece[0]; i <= piece[1]; i++)
+      {
+        for (int c = 0; c < 2; c++)
+        {
+          float a = static_cast<float*>(output->GetScalarPointer(i, j, k))[c];
+          float b = static_cast<float*>(expected->GetScalarPointer(i, j, k))[c];
+          if (std::abs(a - b) > 1e-3 * (1.0 + std::abs(b)))
+          {
+            std::cerr << name << ": value " << a << " instead of " << b << " at (" << i << ", "
+                      << j << ", " << k << ")" << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+int TestOpenGLImageDenoising(int, char*[])
+{
+  // two components: noisy steps, and a noisy ramp
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 39, 0, 29, 0, 19);
+  image->SetSpacing(1.0, 1.0, 1.5);
+  image->AllocateScalars(VTK_FLOAT, 2);
+  float* scalars = static_cast<float*>(image->GetScalarPointer());
+  unsigned int state = 1234;
+  for (int k = 0; k < 20; k++)
+  {
+    for (int j = 0; j < 30; j++)
+    {
+      for (int i = 0; i < 40; i++)
+      {
+        state = state * 1103515245u + 12345u;
+        float noise = ((state >> 8) % 1000) / 100.0f - 5.0f;
+        *scalars++ = ((i > 20) != (j + k > 25) ? 100.0f : 0.0f) + noise;
+        *scalars++ = 2.0f * i + 3.0f * j - k + noise;
+      }
+    }
+  }
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetShowWindow(false);
+
+  const int whole[6] = { 0, 39, 0, 29, 0, 19 };
+  const int piece[6] = { 5, 24, 12, 29, 3, 11 };
+  int retVal = EXIT_SUCCESS;
+
+  vtkNew<vtkImageGaussianSmooth> smooth;
+  vtkNew<vtkOpenGLImageGaussianSmooth> gpuSmooth;
+  gpuSmooth->SetRenderWindow(renWin);
+  vtkImageGaussianSmooth* smoothers[2] = { smooth, gpuSmooth };
+  for (vtkImageGaussianSmooth* filter : smoothers)
+  {
+    filter->SetInputData(image);
+    filter->SetStandardDeviations(1.5, 2.0, 1.0);
+  }
+  retVal |= Compare("GaussianSmooth", smooth, gpuSmooth, whole);
+  retVal |= Compare("GaussianSmooth piece", smooth, gpuSmooth, piece);
+
+  vtkNew<vtkImageAnisotropicDiffusion3D> diffusion;
+  vtkNew<vtkOpenGLImageAnisotropicDiffusion3D> gpuDiffusion;
+  gpuDiffusion->SetRenderWindow(renWin);
+  vtkImageAnisotropicDiffusion3D* diffusers[2] = { diffusion, gpuDiffusion };
+  for (vtkImageAnisotropicDiffusion3D* filter : diffusers)
+  {
+    filter->SetInputData(image);
+    filter->SetNumberOfIterations(6);
+    filter->SetDiffusionThreshold(20.0);
+  }
+  retVal |= Compare("AnisotropicDiffusion3D", diffusion, gpuDiffusion, whole);
+  retVal |= Compare("AnisotropicDiffusion3D piece", diffusion, gpuDiffusion, piece);
+  for (vtkImageAnisotropicDiffusion3D* filter : diffusers)
+  {
+    filter->GradientMagnitudeThresholdOn();
+    filter->EdgesOff();
+  }
+  retVal |= Compare("AnisotropicDiffusion3D gradient", diffusion, gpuDiffusion, whole);
+
+  vtkNew<vtkImageBilateralFilter> bilateral;
+  vtkNew<vtkOpenGLImageBilateralFilter> gpuBilateral;
+  gpuBilateral->SetRenderWindow(renWin);
+  vtkImageBilateralFilter* bilaterals[2] = { bilateral, gpuBilateral };
+  for (vtkImageBilateralFilter* filter : bilaterals)
+  {
+    filter->SetInputData(image);
+    filter->SetStandardDeviations(1.5, 1.5, 1.0);
+    filter->SetRangeStandardDeviation(15.0);
+    filter->SetNumberOfIterations(3);
+  }
+  retVal |= Compare("BilateralFilter", bilateral, gpuBilateral, whole);
+  retVal |= Compare("BilateralFilter piece", bilateral, gpuBilateral, piece);
+
+  return retVal;
+}
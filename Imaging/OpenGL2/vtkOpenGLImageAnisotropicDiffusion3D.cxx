@@ -0,0 +1,225 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLImageAnisotropicDiffusion3D.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkOpenGLImageAnisotropicDiffusion3D.h"
+
+#include "vtkOpenGLImageAlgorithmHelper.h"
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkShaderProgram.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkOpenGLImageAnisotropicDiffusion3D);
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageAnisotropicDiffusion3D::vtkOpenGLImageAnisotropicDiffusion3D()
+{
+  // for GPU we do not want threading
+  this->NumberOfThreads = 1;
+  this->EnableSMP = false;
+  this->Helper = vtkOpenGLImageAlgorithmHelper::New();
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageAnisotropicDiffusion3D::~vtkOpenGLImageAnisotropicDiffusion3D()
+{
+  if (this->Helper)
+  {
+    this->Helper->Delete();
+    this->Helper = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageAnisotropicDiffusion3D::SetRenderWindow(vtkRenderWindow* renWin)
+{
+  this->Helper->SetRenderWindow(renWin);
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageAnisotropicDiffusion3D::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Helper: ";
+  this->Helper->PrintSelf(os, indent);
+}
+
+// this is used as a callback by the helper to set the diffusion parameters
+class vtkOpenGLAnisotropicDiffusionCB : public vtkOpenGLImageAlgorithmCallback
+{
+public:
+  void InitializeShaderUniforms(vtkShaderProgram* program) override
+  {
+    program->SetUniform3f("spacing", this->Spacing);
+    program->SetUniformf("threshold", this->Threshold);
+    program->SetUniformf("factor", this->Factor);
+  }
+
+  double* Spacing;
+  float Threshold;
+  float Factor;
+  vtkOpenGLAnisotropicDiffusionCB() = default;
+  ~vtkOpenGLAnisotropicDiffusionCB() override = default;
+
+private:
+  vtkOpenGLAnisotropicDiffusionCB(const vtkOpenGLAnisotropicDiffusionCB&) = delete;
+  void operator=(const vtkOpenGLAnisotropicDiffusionCB&) = delete;
+};
+
+//------------------------------------------------------------------------------
+// Each iteration is a pass over the whole texture. The neighbors outside of
+// the texture are not diffused, and the texture covers the input extent,
+// so the voxels that are needed for the output are the same as on the CPU.
+void vtkOpenGLImageAnisotropicDiffusion3D::ThreadedRequestData(vtkInformation* request,
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector, vtkImageData*** inData,
+  vtkImageData** outData, int outExt[6], int id)
+{
+  if (inData[0][0]->GetScalarType() != outData[0]->GetScalarType())
+  {
+    vtkErrorMacro("Execute: input ScalarType, " << inData[0][0]->GetScalarType()
+                                                << ", must match out ScalarType "
+                                                << outData[0]->GetScalarType());
+    return;
+  }
+
+  // the CPU handles the cases that do not diffuse
+  if (this->NumberOfIterations <= 0 || !(this->Faces || this->Edges || this->Corners))
+  {
+    this->Superclass::ThreadedRequestData(
+      request, inputVector, outputVector, inData, outData, outExt, id);
+    return;
+  }
+
+  // the diffusion factor of a neighbor is inversely proportional to its
+  // distance, and the factors are normalized like in Iterate()
+  double* ar = inData[0][0]->GetSpacing();
+  double sum = 0.0;
+  if (this->Faces)
+  {
+    sum += 2.0 * (1.0 / ar[0] + 1.0 / ar[1] + 1.0 / ar[2]);
+  }
+  if (this->Edges)
+  {
+    sum += 4.0 / std::sqrt(ar[0] * ar[0] + ar[1] * ar[1]);
+    sum += 4.0 / std::sqrt(ar[0] * ar[0] + ar[2] * ar[2]);
+    sum += 4.0 / std::sqrt(ar[1] * ar[1] + ar[2] * ar[2]);
+  }
+  if (this->Corners)
+  {
+    sum += 8.0 / std::sqrt(ar[0] * ar[0] + ar[1] * ar[1] + ar[2] * ar[2]);
+  }
+
+  vtkOpenGLAnisotropicDiffusionCB cb;
+  cb.Spacing = ar;
+  cb.Threshold = static_cast<float>(this->DiffusionThreshold);
+  cb.Factor = static_cast<float>(this->DiffusionFactor / sum);
+
+  // the kinds of neighbors and the threshold are compiled into the shader
+  std::string fragShader = "//VTK::System::Dec\n"
+                           "uniform sampler3D inputTex1;\n"
+                           "uniform int zSlice;\n"
+                           "uniform vec3 spacing;\n"
+                           "uniform float threshold;\n"
+                           "uniform float factor;\n"
+                           "//VTK::Output::Dec\n"
+                           "void main(void) {\n"
+                           "  ivec3 size = textureSize(inputTex1, 0);\n"
+                           "  ivec3 pos = ivec3(gl_FragCoord.xy, zSlice);\n"
+                           "  vec4 center = texelFetch(inputTex1, pos, 0);\n"
+                           "  vec4 result = center;\n";
+  if (this->GradientMagnitudeThreshold)
+  {
+    // the central differences repeat the center at the boundaries
+    fragShader +=
+      "  ivec3 lo = max(pos - ivec3(1), ivec3(0));\n"
+      "  ivec3 hi = min(pos + ivec3(1), size - ivec3(1));\n"
+      "  vec4 dx = (texelFetch(inputTex1, ivec3(hi.x, pos.yz), 0)\n"
+      "    - texelFetch(inputTex1, ivec3(lo.x, pos.yz), 0))/spacing.x;\n"
+      "  vec4 dy = (texelFetch(inputTex1, ivec3(pos.x, hi.y, pos.z), 0)\n"
+      "    - texelFetch(inputTex1, ivec3(pos.x, lo.y, pos.z), 0))/spacing.y;\n"
+      "  vec4 dz = (texelFetch(inputTex1, ivec3(pos.xy, hi.z), 0)\n"
+      "    - texelFetch(inputTex1, ivec3(pos.xy, lo.z), 0))/spacing.z;\n"
+      "  vec4 diffuse = vec4(lessThanEqual(sqrt(dx*dx + dy*dy + dz*dz), vec4(threshold)));\n";
+  }
+  fragShader += "  for (int k = -1; k <= 1; k++) {\n"
+                "    for (int j = -1; j <= 1; j++) {\n"
+                "      for (int i = -1; i <= 1; i++) {\n"
+                "        int n = abs(i) + abs(j) + abs(k);\n"
+                "        ivec3 p = pos + ivec3(i, j, k);\n"
+                "        if (n == 0 || any(lessThan(p, ivec3(0))) ||\n"
+                "          any(greaterThanEqual(p, size))) continue;\n";
+  if (!this->Faces)
+  {
+    fragShader += "        if (n == 1) continue;\n";
+  }
+  if (!this->Edges)
+  {
+    fragShader += "        if (n == 2) continue;\n";
+  }
+  if (!this->Corners)
+  {
+    fragShader += "        if (n == 3) continue;\n";
+  }
+  fragShader += "        float dist = length(vec3(i, j, k)*spacing);\n"
+                "        vec4 diff = texelFetch(inputTex1, p, 0) - center;\n";
+  if (this->GradientMagnitudeThreshold)
+  {
+    fragShader += "        result += diffuse*diff*(factor/dist);\n";
+  }
+  else
+  {
+    fragShader +=
+      "        result += vec4(lessThan(abs(diff), vec4(dist*threshold)))*diff*(factor/dist);\n";
+  }
+  fragShader += "      }\n"
+                "    }\n"
+                "  }\n"
+                "  gl_FragData[0] = result;\n"
+                "}\n";
+
+  // every iteration runs the same shader
+  std::vector<const char*> fragCodes(this->NumberOfIterations, fragShader.c_str());
+
+  vtkDataArray* inArray = inData[0][0]->GetPointData()->GetScalars();
+
+  // call the helper to execute the passes, or use the CPU if it cannot
+  if (!this->Helper->ExecutePasses(&cb, inData[0][0], inArray, outData[0], outExt,
+        this->NumberOfIterations,
+
+        "//VTK::System::Dec\n"
+        "attribute vec4 vertexMC;\n"
+        "attribute vec2 tcoordMC;\n"
+        "varying vec2 tcoordVSOutput;\n"
+        "void main() {\n"
+        "  tcoordVSOutput = tcoordMC;\n"
+        "  gl_Position = vertexMC;\n"
+        "}\n",
+
+        fragCodes.data(),
+
+        ""))
+  {
+    this->Superclass::ThreadedRequestData(
+      request, inputVector, outputVector, inData, outData, outExt, id);
+  }
+}
+VTK_ABI_NAMESPACE_END
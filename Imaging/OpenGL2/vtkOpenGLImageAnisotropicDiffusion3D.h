@@ -0,0 +1,64 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLImageAnisotropicDiffusion3D.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkOpenGLImageAnisotropicDiffusion3D
+ * @brief   Anisotropic diffusion using the GPU
+ *
+ * Each iteration is a pass that diffuses the result of the previous one,
+ * and the intermediate results stay on the GPU. The computation is done in
+ * single precision, so the result differs slightly from the CPU version,
+ * which iterates in double precision.
+ */
+
+#ifndef vtkOpenGLImageAnisotropicDiffusion3D_h
+#define vtkOpenGLImageAnisotropicDiffusion3D_h
+
+#include "vtkImageAnisotropicDiffusion3D.h"
+#include "vtkImagingOpenGL2Module.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkOpenGLImageAlgorithmHelper;
+class vtkRenderWindow;
+
+class VTKIMAGINGOPENGL2_EXPORT vtkOpenGLImageAnisotropicDiffusion3D
+  : public vtkImageAnisotropicDiffusion3D
+{
+public:
+  static vtkOpenGLImageAnisotropicDiffusion3D* New();
+  vtkTypeMacro(vtkOpenGLImageAnisotropicDiffusion3D, vtkImageAnisotropicDiffusion3D);
+
+  /**
+   * Set the render window to get the OpenGL resources from
+   */
+  void SetRenderWindow(vtkRenderWindow*);
+
+protected:
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  vtkOpenGLImageAnisotropicDiffusion3D();
+  ~vtkOpenGLImageAnisotropicDiffusion3D() override;
+
+  vtkOpenGLImageAlgorithmHelper* Helper;
+
+  void ThreadedRequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector, vtkImageData*** inData, vtkImageData** outData,
+    int extent[6], int id) override;
+
+private:
+  vtkOpenGLImageAnisotropicDiffusion3D(const vtkOpenGLImageAnisotropicDiffusion3D&) = delete;
+  void operator=(const vtkOpenGLImageAnisotropicDiffusion3D&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,172 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLImageBilateralFilter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkOpenGLImageBilateralFilter.h"
+
+#include "vtkOpenGLImageAlgorithmHelper.h"
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkShaderProgram.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkOpenGLImageBilateralFilter);
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageBilateralFilter::vtkOpenGLImageBilateralFilter()
+{
+  // for GPU we do not want threading
+  this->NumberOfThreads = 1;
+  this->EnableSMP = false;
+  this->Helper = vtkOpenGLImageAlgorithmHelper::New();
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageBilateralFilter::~vtkOpenGLImageBilateralFilter()
+{
+  if (this->Helper)
+  {
+    this->Helper->Delete();
+    this->Helper = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageBilateralFilter::SetRenderWindow(vtkRenderWindow* renWin)
+{
+  this->Helper->SetRenderWindow(renWin);
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageBilateralFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Helper: ";
+  this->Helper->PrintSelf(os, indent);
+}
+
+// this is used as a callback by the helper to set the gaussian factors
+class vtkOpenGLBilateralFilterCB : public vtkOpenGLImageAlgorithmCallback
+{
+public:
+  void InitializeShaderUniforms(vtkShaderProgram* program) override
+  {
+    program->SetUniform3f("spatialFactors", this->SpatialFactors);
+    program->SetUniformf("rangeFactor", this->RangeFactor);
+  }
+
+  float SpatialFactors[3];
+  float RangeFactor;
+  vtkOpenGLBilateralFilterCB() = default;
+  ~vtkOpenGLBilateralFilterCB() override = default;
+
+private:
+  vtkOpenGLBilateralFilterCB(const vtkOpenGLBilateralFilterCB&) = delete;
+  void operator=(const vtkOpenGLBilateralFilterCB&) = delete;
+};
+
+//------------------------------------------------------------------------------
+// Each iteration is a pass over the whole texture, with the kernel clipped
+// at the boundaries of the texture, which covers the input extent.
+void vtkOpenGLImageBilateralFilter::ThreadedRequestData(vtkInformation* request,
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector, vtkImageData*** inData,
+  vtkImageData** outData, int outExt[6], int id)
+{
+  if (inData[0][0]->GetScalarType() != outData[0]->GetScalarType())
+  {
+    vtkErrorMacro("Execute: input ScalarType, " << inData[0][0]->GetScalarType()
+                                                << ", must match out ScalarType "
+                                                << outData[0]->GetScalarType());
+    return;
+  }
+
+  int radius[3];
+  this->ComputeRadius(radius);
+
+  vtkOpenGLBilateralFilterCB cb;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double sigma = this->StandardDeviations[axis];
+    cb.SpatialFactors[axis] = static_cast<float>(radius[axis] > 0 ? -0.5 / (sigma * sigma) : 0.0);
+  }
+  // a factor of -VTK_FLOAT_MAX keeps the neighbors with the same value
+  cb.RangeFactor = static_cast<float>(std::max(this->ComputeRangeFactor(), -1.0 * VTK_FLOAT_MAX));
+
+  // the radius is compiled into the shader
+  std::string fragShader = "//VTK::System::Dec\n"
+                           "uniform sampler3D inputTex1;\n"
+                           "uniform int zSlice;\n"
+                           "uniform vec3 spatialFactors;\n"
+                           "uniform float rangeFactor;\n"
+                           "//VTK::Output::Dec\n"
+                           "void main(void) {\n"
+                           "  ivec3 radius = ivec3(" +
+    std::to_string(radius[0]) + ", " + std::to_string(radius[1]) + ", " +
+    std::to_string(radius[2]) +
+    ");\n"
+    "  ivec3 pos = ivec3(gl_FragCoord.xy, zSlice);\n"
+    "  ivec3 lo = max(pos - radius, ivec3(0));\n"
+    "  ivec3 hi = min(pos + radius, textureSize(inputTex1, 0) - ivec3(1));\n"
+    "  vec4 center = texelFetch(inputTex1, pos, 0);\n"
+    "  vec4 sum = vec4(0.0);\n"
+    "  vec4 weights = vec4(0.0);\n"
+    "  for (int k = lo.z; k <= hi.z; k++) {\n"
+    "    for (int j = lo.y; j <= hi.y; j++) {\n"
+    "      for (int i = lo.x; i <= hi.x; i++) {\n"
+    "        vec3 d = vec3(ivec3(i, j, k) - pos);\n"
+    "        vec4 value = texelFetch(inputTex1, ivec3(i, j, k), 0);\n"
+    "        vec4 diff = value - center;\n"
+    "        vec4 w = exp(dot(d*d, spatialFactors) + rangeFactor*diff*diff);\n"
+    "        sum += w*value;\n"
+    "        weights += w;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "  gl_FragData[0] = sum/weights;\n"
+    "}\n";
+
+  // every iteration runs the same shader
+  std::vector<const char*> fragCodes(this->NumberOfIterations, fragShader.c_str());
+
+  vtkDataArray* inArray = inData[0][0]->GetPointData()->GetScalars();
+
+  // call the helper to execute the passes, or use the CPU if it cannot
+  if (!this->Helper->ExecutePasses(&cb, inData[0][0], inArray, outData[0], outExt,
+        this->NumberOfIterations,
+
+        "//VTK::System::Dec\n"
+        "attribute vec4 vertexMC;\n"
+        "attribute vec2 tcoordMC;\n"
+        "varying vec2 tcoordVSOutput;\n"
+        "void main() {\n"
+        "  tcoordVSOutput = tcoordMC;\n"
+        "  gl_Position = vertexMC;\n"
+        "}\n",
+
+        fragCodes.data(),
+
+        ""))
+  {
+    this->Superclass::ThreadedRequestData(
+      request, inputVector, outputVector, inData, outData, outExt, id);
+  }
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,62 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLImageBilateralFilter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkOpenGLImageBilateralFilter
+ * @brief   Bilateral filter using the GPU
+ *
+ * Each iteration is a pass that filters the result of the previous one,
+ * and the intermediate results stay on the GPU. The computation is done in
+ * single precision.
+ */
+
+#ifndef vtkOpenGLImageBilateralFilter_h
+#define vtkOpenGLImageBilateralFilter_h
+
+#include "vtkImageBilateralFilter.h"
+#include "vtkImagingOpenGL2Module.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkOpenGLImageAlgorithmHelper;
+class vtkRenderWindow;
+
+class VTKIMAGINGOPENGL2_EXPORT vtkOpenGLImageBilateralFilter : public vtkImageBilateralFilter
+{
+public:
+  static vtkOpenGLImageBilateralFilter* New();
+  vtkTypeMacro(vtkOpenGLImageBilateralFilter, vtkImageBilateralFilter);
+
+  /**
+   * Set the render window to get the OpenGL resources from
+   */
+  void SetRenderWindow(vtkRenderWindow*);
+
+protected:
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  vtkOpenGLImageBilateralFilter();
+  ~vtkOpenGLImageBilateralFilter() override;
+
+  vtkOpenGLImageAlgorithmHelper* Helper;
+
+  void ThreadedRequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector, vtkImageData*** inData, vtkImageData** outData,
+    int extent[6], int id) override;
+
+private:
+  vtkOpenGLImageBilateralFilter(const vtkOpenGLImageBilateralFilter&) = delete;
+  void operator=(const vtkOpenGLImageBilateralFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,185 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLImageGaussianSmooth.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkOpenGLImageGaussianSmooth.h"
+
+#include "vtkOpenGLImageAlgorithmHelper.h"
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkShaderProgram.h"
+
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkOpenGLImageGaussianSmooth);
+
+namespace
+{
+// the largest radius of the kernels that are passed to the shaders
+const int vtkOpenGLGaussianMaxRadius = 64;
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageGaussianSmooth::vtkOpenGLImageGaussianSmooth()
+{
+  // for GPU we do not want threading
+  this->NumberOfThreads = 1;
+  this->EnableSMP = false;
+  this->Helper = vtkOpenGLImageAlgorithmHelper::New();
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageGaussianSmooth::~vtkOpenGLImageGaussianSmooth()
+{
+  if (this->Helper)
+  {
+    this->Helper->Delete();
+    this->Helper = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageGaussianSmooth::SetRenderWindow(vtkRenderWindow* renWin)
+{
+  this->Helper->SetRenderWindow(renWin);
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageGaussianSmooth::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Helper: ";
+  this->Helper->PrintSelf(os, indent);
+}
+
+// this is used as a callback by the helper to set the kernel of each pass
+class vtkOpenGLGaussianSmoothCB : public vtkOpenGLImageAlgorithmCallback
+{
+public:
+  void UpdatePassUniforms(vtkShaderProgram* program, int pass) override
+  {
+    program->SetUniform1fv("kernel", static_cast<int>(this->Kernels[pass].size()),
+      this->Kernels[pass].data());
+  }
+
+  std::vector<std::vector<float>> Kernels;
+  vtkOpenGLGaussianSmoothCB() = default;
+  ~vtkOpenGLGaussianSmoothCB() override = default;
+
+private:
+  vtkOpenGLGaussianSmoothCB(const vtkOpenGLGaussianSmoothCB&) = delete;
+  void operator=(const vtkOpenGLGaussianSmoothCB&) = delete;
+};
+
+//------------------------------------------------------------------------------
+// Each axis is a pass, z first like the CPU version. The texture covers the
+// input extent, which is clipped to the whole extent, so the kernel is
+// clipped and renormalized at the boundaries of the texture.
+void vtkOpenGLImageGaussianSmooth::ThreadedRequestData(vtkInformation* request,
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector, vtkImageData*** inData,
+  vtkImageData** outData, int outExt[6], int id)
+{
+  if (inData[0][0]->GetScalarType() != outData[0]->GetScalarType())
+  {
+    vtkErrorMacro("Execute: input ScalarType, " << inData[0][0]->GetScalarType()
+                                                << ", must match out ScalarType "
+                                                << outData[0]->GetScalarType());
+    return;
+  }
+
+  vtkOpenGLGaussianSmoothCB cb;
+  std::vector<std::string> fragShaders;
+  for (int axis = this->Dimensionality - 1; axis >= 0; --axis)
+  {
+    const double stdDev = this->StandardDeviations[axis];
+    const int radius = static_cast<int>(stdDev * this->RadiusFactors[axis]);
+    if (radius > vtkOpenGLGaussianMaxRadius)
+    {
+      this->Superclass::ThreadedRequestData(
+        request, inputVector, outputVector, inData, outData, outExt, id);
+      return;
+    }
+
+    std::vector<double> kernel(2 * radius + 1);
+    this->ComputeKernel(kernel.data(), -radius, radius, stdDev);
+    cb.Kernels.emplace_back(kernel.begin(), kernel.end());
+
+    // the kernel is clipped where the neighbors are outside the texture
+    const std::string size = std::to_string(2 * radius + 1);
+    std::string fragShader = "//VTK::System::Dec\n"
+                             "uniform sampler3D inputTex1;\n"
+                             "uniform int zSlice;\n"
+                             "uniform float kernel[" +
+      size +
+      "];\n"
+      "//VTK::Output::Dec\n"
+      "void main(void) {\n"
+      "  ivec3 size = textureSize(inputTex1, 0);\n"
+      "  ivec3 pos = ivec3(gl_FragCoord.xy, zSlice);\n"
+      "  ivec3 step = ivec3(" +
+      (axis == 0 ? "1,0,0" : (axis == 1 ? "0,1,0" : "0,0,1")) +
+      ");\n"
+      "  vec4 sum = vec4(0.0);\n"
+      "  float weights = 0.0;\n"
+      "  for (int i = 0; i < " +
+      size +
+      "; i++) {\n"
+      "    ivec3 p = pos + (i - " +
+      std::to_string(radius) +
+      ")*step;\n"
+      "    if (all(greaterThanEqual(p, ivec3(0))) && all(lessThan(p, size))) {\n"
+      "      sum += kernel[i]*texelFetch(inputTex1, p, 0);\n"
+      "      weights += kernel[i];\n"
+      "    }\n"
+      "  }\n"
+      "  gl_FragData[0] = sum/weights;\n"
+      "}\n";
+    fragShaders.push_back(fragShader);
+  }
+
+  std::vector<const char*> fragCodes;
+  for (const std::string& code : fragShaders)
+  {
+    fragCodes.push_back(code.c_str());
+  }
+
+  vtkDataArray* inArray = inData[0][0]->GetPointData()->GetScalars();
+
+  // call the helper to execute the passes, or use the CPU if it cannot
+  if (!this->Helper->ExecutePasses(&cb, inData[0][0], inArray, outData[0], outExt,
+        static_cast<int>(fragCodes.size()),
+
+        "//VTK::System::Dec\n"
+        "attribute vec4 vertexMC;\n"
+        "attribute vec2 tcoordMC;\n"
+        "varying vec2 tcoordVSOutput;\n"
+        "void main() {\n"
+        "  tcoordVSOutput = tcoordMC;\n"
+        "  gl_Position = vertexMC;\n"
+        "}\n",
+
+        fragCodes.data(),
+
+        ""))
+  {
+    this->Superclass::ThreadedRequestData(
+      request, inputVector, outputVector, inData, outData, outExt, id);
+  }
+}
+VTK_ABI_NAMESPACE_END
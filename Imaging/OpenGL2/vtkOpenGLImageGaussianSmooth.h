@@ -0,0 +1,64 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLImageGaussianSmooth.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkOpenGLImageGaussianSmooth
+ * @brief   Gaussian smoothing using the GPU
+ *
+ * The axes are convolved one after another in passes that keep the
+ * intermediate results on the GPU. The kernel is always used, even when
+ * RecursiveThreshold asks for the recursive gaussian, and kernels with a
+ * radius larger than 64 are computed on the CPU. The computation is done
+ * in single precision.
+ */
+
+#ifndef vtkOpenGLImageGaussianSmooth_h
+#define vtkOpenGLImageGaussianSmooth_h
+
+#include "vtkImageGaussianSmooth.h"
+#include "vtkImagingOpenGL2Module.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkOpenGLImageAlgorithmHelper;
+class vtkRenderWindow;
+
+class VTKIMAGINGOPENGL2_EXPORT vtkOpenGLImageGaussianSmooth : public vtkImageGaussianSmooth
+{
+public:
+  static vtkOpenGLImageGaussianSmooth* New();
+  vtkTypeMacro(vtkOpenGLImageGaussianSmooth, vtkImageGaussianSmooth);
+
+  /**
+   * Set the render window to get the OpenGL resources from
+   */
+  void SetRenderWindow(vtkRenderWindow*);
+
+protected:
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  vtkOpenGLImageGaussianSmooth();
+  ~vtkOpenGLImageGaussianSmooth() override;
+
+  vtkOpenGLImageAlgorithmHelper* Helper;
+
+  void ThreadedRequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector, vtkImageData*** inData, vtkImageData** outData,
+    int extent[6], int id) override;
+
+private:
+  vtkOpenGLImageGaussianSmooth(const vtkOpenGLImageGaussianSmooth&) = delete;
+  void operator=(const vtkOpenGLImageGaussianSmooth&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
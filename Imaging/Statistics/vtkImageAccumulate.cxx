@@ -21,9 +21,14 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cmath>
+#include <unordered_map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageAccumulate);
@@ -49,6 +54,7 @@ vtkImageAccumulate::vtkImageAccumulate()
   this->StandardDeviation[0] = this->StandardDeviation[1] = this->StandardDeviation[2] = 0.0;
   this->VoxelCount = 0;
   this->IgnoreZero = 0;
+  this->SparseBins = 0;
 
   // we have the image input and the optional stencil input
   this->SetNumberOfInputPorts(2);
@@ -116,59 +122,109 @@ vtkImageStencilData* vtkImageAccumulate::GetStencil()
   return vtkImageStencilData::SafeDownCast(this->GetExecutive()->GetInputData(1, 0));
 }
 
+namespace
+{
 //------------------------------------------------------------------------------
-// This templated function executes the filter for any type of data.
+// The bins and the statistics accumulated by one thread.
+struct vtkImageAccumulateThreadData
+{
+  std::vector<vtkIdType> Bins;
+  std::unordered_map<vtkIdType, vtkIdType> SparseBins;
+  double Sum[3] = { 0.0, 0.0, 0.0 };
+  double SumSqr[3] = { 0.0, 0.0, 0.0 };
+  double Min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+  double Max[3] = { VTK_DOUBLE_MIN, VTK_DOUBLE_MIN, VTK_DOUBLE_MIN };
+  vtkIdType VoxelCount = 0;
+};
+
+//------------------------------------------------------------------------------
+// Functor for vtkSMPTools execution, over the rows of the update extent.
+// Each thread fills its own bins, which are summed once all rows are done.
 template <class T>
-int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*,
-  vtkImageData* outData, vtkIdType* outPtr, double min[3], double max[3], double mean[3],
-  double standardDeviation[3], vtkIdType* voxelCount, int* updateExtent)
+class vtkImageAccumulateFunctor
 {
-  // variables used to compute statistics (filter handles max 3 components)
-  double sum[3];
-  sum[0] = sum[1] = sum[2] = 0.0;
-  double sumSqr[3];
-  sumSqr[0] = sumSqr[1] = sumSqr[2] = 0.0;
-  min[0] = min[1] = min[2] = VTK_DOUBLE_MAX;
-  max[0] = max[1] = max[2] = VTK_DOUBLE_MIN;
-  standardDeviation[0] = standardDeviation[1] = standardDeviation[2] = 0.0;
-  *voxelCount = 0;
+public:
+  vtkImageAccumulateFunctor(vtkImageAccumulate* self, vtkImageData* inData,
+    vtkImageData* outData, vtkIdType* outPtr, const int extent[6])
+    : InData(inData)
+    , Stencil(self->GetStencil())
+    , ReverseStencil(self->GetReverseStencil() != 0)
+    , IgnoreZero(self->GetIgnoreZero() != 0)
+    , Sparse(self->GetSparseBins() != 0)
+    , NumberOfComponents(inData->GetNumberOfScalarComponents())
+    , OutPtr(outPtr)
+  {
+    std::copy(extent, extent + 6, this->Extent);
+    outData->GetExtent(this->OutExtent);
+    outData->GetIncrements(this->OutIncs);
+    outData->GetOrigin(this->Origin);
+    outData->GetSpacing(this->Spacing);
+    this->NumberOfBins = outData->GetNumberOfPoints();
+  }
 
-  // input's number of components is used as output dimensionality
-  int numC = inData->GetNumberOfScalarComponents();
-  if (numC > 3)
+  void Initialize()
   {
-    return 0;
+    if (!this->Sparse)
+    {
+      this->ThreadLocal.Local().Bins.assign(this->NumberOfBins, 0);
+    }
   }
 
-  // get information for output data
-  int outExtent[6];
-  outData->GetExtent(outExtent);
-  vtkIdType outIncs[3];
-  outData->GetIncrements(outIncs);
-  double origin[3];
-  outData->GetOrigin(origin);
-  double spacing[3];
-  outData->GetSpacing(spacing);
-
-  // zero count in every bin
-  vtkIdType size = 1;
-  size *= (outExtent[1] - outExtent[0] + 1);
-  size *= (outExtent[3] - outExtent[2] + 1);
-  size *= (outExtent[5] - outExtent[4] + 1);
-  for (vtkIdType j = 0; j < size; j++)
+  void operator()(vtkIdType begin, vtkIdType end)
   {
-    outPtr[j] = 0;
+    // the rows from begin to end, split at the slice boundaries
+    vtkImageAccumulateThreadData& data = this->ThreadLocal.Local();
+    const vtkIdType numRows = this->Extent[3] - this->Extent[2] + 1;
+    while (begin < end)
+    {
+      const vtkIdType row = begin % numRows;
+      const vtkIdType count = std::min(end - begin, numRows - row);
+      int piece[6] = { this->Extent[0], this->Extent[1], 0, 0, 0, 0 };
+      piece[2] = this->Extent[2] + static_cast<int>(row);
+      piece[3] = piece[2] + static_cast<int>(count) - 1;
+      piece[4] = piece[5] = this->Extent[4] + static_cast<int>(begin / numRows);
+      this->Accumulate(data, piece);
+      begin += count;
+    }
   }
 
-  vtkImageStencilData* stencil = self->GetStencil();
-  bool reverseStencil = (self->GetReverseStencil() != 0);
-  bool ignoreZero = (self->GetIgnoreZero() != 0);
+  void Reduce();
+
+  // Store the statistics of all threads in the filter.
+  void GetStatistics(double min[3], double max[3], double mean[3], double standardDeviation[3],
+    vtkIdType* voxelCount);
+
+private:
+  void Accumulate(vtkImageAccumulateThreadData& data, const int extent[6]);
+
+  vtkImageData* InData;
+  vtkImageStencilData* Stencil;
+  bool ReverseStencil;
+  bool IgnoreZero;
+  bool Sparse;
+  int NumberOfComponents;
+  vtkIdType* OutPtr;
+  int Extent[6];
+  int OutExtent[6];
+  vtkIdType OutIncs[3];
+  double Origin[3];
+  double Spacing[3];
+  vtkIdType NumberOfBins;
+  vtkSMPThreadLocal<vtkImageAccumulateThreadData> ThreadLocal;
+  vtkImageAccumulateThreadData Total;
+};
 
-  vtkImageStencilIterator<T> inIter(inData, stencil, updateExtent, self);
+//------------------------------------------------------------------------------
+template <class T>
+void vtkImageAccumulateFunctor<T>::Accumulate(
+  vtkImageAccumulateThreadData& data, const int extent[6])
+{
+  const int numC = this->NumberOfComponents;
+  vtkImageStencilIterator<T> inIter(this->InData, this->Stencil, extent);
 
   while (!inIter.IsAtEnd())
   {
-    if (inIter.IsInStencil() ^ reverseStencil)
+    if (inIter.IsInStencil() ^ this->ReverseStencil)
     {
       T* inPtr = inIter.BeginSpan();
       T* spanEndPtr = inIter.EndSpan();
@@ -177,33 +233,33 @@ int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*
       {
         // find the bin for this pixel.
         bool outOfBounds = false;
-        vtkIdType* outPtrC = outPtr;
+        vtkIdType bin = 0;
         for (int idxC = 0; idxC < numC; ++idxC)
         {
           double v = static_cast<double>(*inPtr++);
-          if (!ignoreZero || v != 0)
+          if (!this->IgnoreZero || v != 0)
           {
             // gather statistics
-            sum[idxC] += v;
-            sumSqr[idxC] += v * v;
-            if (v > max[idxC])
+            data.Sum[idxC] += v;
+            data.SumSqr[idxC] += v * v;
+            if (v > data.Max[idxC])
             {
-              max[idxC] = v;
+              data.Max[idxC] = v;
             }
-            if (v < min[idxC])
+            if (v < data.Min[idxC])
             {
-              min[idxC] = v;
+              data.Min[idxC] = v;
             }
-            (*voxelCount)++;
+            data.VoxelCount++;
           }
 
           // compute the index
-          int outIdx = vtkMath::Floor((v - origin[idxC]) / spacing[idxC]);
+          int outIdx = vtkMath::Floor((v - this->Origin[idxC]) / this->Spacing[idxC]);
 
           // verify that it is in range
-          if (outIdx >= outExtent[idxC * 2] && outIdx <= outExtent[idxC * 2 + 1])
+          if (outIdx >= this->OutExtent[idxC * 2] && outIdx <= this->OutExtent[idxC * 2 + 1])
           {
-            outPtrC += (outIdx - outExtent[idxC * 2]) * outIncs[idxC];
+            bin += (outIdx - this->OutExtent[idxC * 2]) * this->OutIncs[idxC];
           }
           else
           {
@@ -214,38 +270,126 @@ int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*
         // increment the bin
         if (!outOfBounds)
         {
-          ++(*outPtrC);
+          if (this->Sparse)
+          {
+            ++data.SparseBins[bin];
+          }
+          else
+          {
+            ++data.Bins[bin];
+          }
         }
       }
     }
 
     inIter.NextSpan();
   }
+}
+
+//------------------------------------------------------------------------------
+// Called by vtkSMPTools once the multi-threading has finished.
+template <class T>
+void vtkImageAccumulateFunctor<T>::Reduce()
+{
+  vtkIdType* outPtr = this->OutPtr;
+  std::fill(outPtr, outPtr + this->NumberOfBins, 0);
+
+  // sum the statistics, and the sparse bins, of each thread
+  std::vector<vtkIdType*> denseBins;
+  vtkImageAccumulateThreadData& total = this->Total;
+  for (auto& data : this->ThreadLocal)
+  {
+    for (int idxC = 0; idxC < 3; ++idxC)
+    {
+      total.Sum[idxC] += data.Sum[idxC];
+      total.SumSqr[idxC] += data.SumSqr[idxC];
+      total.Min[idxC] = std::min(total.Min[idxC], data.Min[idxC]);
+      total.Max[idxC] = std::max(total.Max[idxC], data.Max[idxC]);
+    }
+    total.VoxelCount += data.VoxelCount;
+    for (const auto& bin : data.SparseBins)
+    {
+      outPtr[bin.first] += bin.second;
+    }
+    if (!data.Bins.empty())
+    {
+      denseBins.push_back(data.Bins.data());
+    }
+  }
 
-  // initialize the statistics
-  mean[0] = 0;
-  mean[1] = 0;
-  mean[2] = 0;
+  // sum the dense bins of each thread, split among the threads
+  vtkSMPTools::For(0, this->NumberOfBins, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType* bins : denseBins)
+    {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        outPtr[i] += bins[i];
+      }
+    }
+  });
+}
 
-  standardDeviation[0] = 0;
-  standardDeviation[1] = 0;
-  standardDeviation[2] = 0;
+//------------------------------------------------------------------------------
+template <class T>
+void vtkImageAccumulateFunctor<T>::GetStatistics(double min[3], double max[3], double mean[3],
+  double standardDeviation[3], vtkIdType* voxelCount)
+{
+  const vtkImageAccumulateThreadData& total = this->Total;
+  *voxelCount = total.VoxelCount;
+  for (int idxC = 0; idxC < 3; ++idxC)
+  {
+    min[idxC] = total.Min[idxC];
+    max[idxC] = total.Max[idxC];
+    mean[idxC] = 0.0;
+    standardDeviation[idxC] = 0.0;
+  }
 
   if (*voxelCount != 0) // avoid the div0
   {
     double n = static_cast<double>(*voxelCount);
-    mean[0] = sum[0] / n;
-    mean[1] = sum[1] / n;
-    mean[2] = sum[2] / n;
+    for (int idxC = 0; idxC < 3; ++idxC)
+    {
+      mean[idxC] = total.Sum[idxC] / n;
+    }
 
     if (*voxelCount - 1 != 0) // avoid the div0
     {
       double m = static_cast<double>(*voxelCount - 1);
-      standardDeviation[0] = sqrt((sumSqr[0] - mean[0] * mean[0] * n) / m);
-      standardDeviation[1] = sqrt((sumSqr[1] - mean[1] * mean[1] * n) / m);
-      standardDeviation[2] = sqrt((sumSqr[2] - mean[2] * mean[2] * n) / m);
+      for (int idxC = 0; idxC < 3; ++idxC)
+      {
+        standardDeviation[idxC] =
+          sqrt((total.SumSqr[idxC] - mean[idxC] * mean[idxC] * n) / m);
+      }
     }
   }
+}
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// This templated function executes the filter for any type of data.
+template <class T>
+int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*,
+  vtkImageData* outData, vtkIdType* outPtr, double min[3], double max[3], double mean[3],
+  double standardDeviation[3], vtkIdType* voxelCount, int* updateExtent)
+{
+  // input's number of components is used as output dimensionality
+  if (inData->GetNumberOfScalarComponents() > 3)
+  {
+    return 0;
+  }
+
+  // the rows of the update extent are split among the threads
+  vtkIdType numRows = 0;
+  if (updateExtent[0] <= updateExtent[1] && updateExtent[2] <= updateExtent[3] &&
+    updateExtent[4] <= updateExtent[5])
+  {
+    numRows = static_cast<vtkIdType>(updateExtent[3] - updateExtent[2] + 1) *
+      (updateExtent[5] - updateExtent[4] + 1);
+  }
+
+  vtkImageAccumulateFunctor<T> functor(self, inData, outData, outPtr, updateExtent);
+  vtkSMPTools::For(0, numRows, functor);
+  functor.GetStatistics(min, max, mean, standardDeviation, voxelCount);
 
   return 1;
 }
@@ -382,6 +526,7 @@ void vtkImageAccumulate::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Stencil: " << this->GetStencil() << "\n";
   os << indent << "ReverseStencil: " << (this->ReverseStencil ? "On\n" : "Off\n");
   os << indent << "IgnoreZero: " << (this->IgnoreZero ? "On" : "Off") << "\n";
+  os << indent << "SparseBins: " << (this->SparseBins ? "On" : "Off") << "\n";
 
   os << indent << "ComponentOrigin: ( " << this->ComponentOrigin[0] << ", "
      << this->ComponentOrigin[1] << ", " << this->ComponentOrigin[2] << " )\n";
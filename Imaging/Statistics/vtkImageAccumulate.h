@@ -32,6 +32,9 @@
  * option with vtkImageMask may result in results being slightly off since 0
  * could be a valid value from your input.
  *
+ * The rows of the input are split among threads with vtkSMPTools.  Each
+ * thread counts into its own bins, which are summed at the end, so that
+ * the threads never write to shared bins.
  */
 
 #ifndef vtkImageAccumulate_h
@@ -135,6 +138,20 @@ public:
   vtkBooleanMacro(IgnoreZero, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Use sparse bins for the counts of each thread.  Each thread normally
+   * counts into a full copy of the output histogram, which needs a lot of
+   * memory if the number of bins is huge, as with 3D joint histograms.
+   * With sparse bins, each thread only stores the bins that it has counted
+   * something into.  This is slower when most of the bins are used.
+   * Initial value is false.
+   */
+  vtkSetMacro(SparseBins, vtkTypeBool);
+  vtkGetMacro(SparseBins, vtkTypeBool);
+  vtkBooleanMacro(SparseBins, vtkTypeBool);
+  ///@}
+
 protected:
   vtkImageAccumulate();
   ~vtkImageAccumulate() override;
@@ -149,6 +166,7 @@ protected:
     vtkInformationVector* outputVector) override;
 
   vtkTypeBool IgnoreZero;
+  vtkTypeBool SparseBins;
   double Min[3];
   double Max[3];
   double Mean[3];
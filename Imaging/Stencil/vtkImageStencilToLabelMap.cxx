@@ -0,0 +1,209 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkImageStencilToLabelMap.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkImageStencilToLabelMap.h"
+
+#include "vtkImageData.h"
+#include "vtkImageStencilData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkImageStencilToLabelMap);
+
+//------------------------------------------------------------------------------
+vtkImageStencilToLabelMap::vtkImageStencilToLabelMap()
+{
+  this->BackgroundValue = 0;
+  this->OutputScalarType = VTK_UNSIGNED_SHORT;
+
+  this->SetNumberOfInputPorts(1);
+}
+
+//------------------------------------------------------------------------------
+vtkImageStencilToLabelMap::~vtkImageStencilToLabelMap() = default;
+
+//------------------------------------------------------------------------------
+void vtkImageStencilToLabelMap::AddStencilData(vtkImageStencilData* stencil)
+{
+  this->AddInputData(0, stencil);
+}
+
+//------------------------------------------------------------------------------
+int vtkImageStencilToLabelMap::RequestInformation(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  int numInputs = inputVector[0]->GetNumberOfInformationObjects();
+
+  // the output extent holds the extents of all the stencils
+  int extent[6] = { VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN };
+  for (int i = 0; i < numInputs; i++)
+  {
+    int inExt[6];
+    inputVector[0]->GetInformationObject(i)->Get(
+      vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), inExt);
+    for (int j = 0; j < 3; j++)
+    {
+      extent[2 * j] = std::min(extent[2 * j], inExt[2 * j]);
+      extent[2 * j + 1] = std::max(extent[2 * j + 1], inExt[2 * j + 1]);
+    }
+  }
+
+  double spacing[3] = { 1.0, 1.0, 1.0 };
+  double origin[3] = { 0.0, 0.0, 0.0 };
+  if (numInputs > 0)
+  {
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+    inInfo->Get(vtkDataObject::SPACING(), spacing);
+    inInfo->Get(vtkDataObject::ORIGIN(), origin);
+  }
+
+  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent, 6);
+  outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
+  outInfo->Set(vtkDataObject::ORIGIN(), origin, 3);
+
+  vtkDataObject::SetPointDataActiveScalarInfo(outInfo, this->OutputScalarType, 1);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+// Request the whole extent of each stencil, since the run-length stencils
+// are small compared to the output and their extents can differ.
+int vtkImageStencilToLabelMap::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector))
+{
+  int numInputs = inputVector[0]->GetNumberOfInformationObjects();
+  for (int i = 0; i < numInputs; i++)
+  {
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(i);
+    int extent[6];
+    inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent, 6);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+template <class T>
+void vtkImageStencilToLabelMapExecute(vtkImageStencilToLabelMap* self,
+  const std::vector<vtkImageStencilData*>& stencils, vtkImageData* outData, T* outPtr,
+  int outExt[6])
+{
+  double tmin = outData->GetScalarTypeMin();
+  double tmax = outData->GetScalarTypeMax();
+
+  T background = static_cast<T>(std::min(std::max(self->GetBackgroundValue(), tmin), tmax));
+  std::vector<T> labels(stencils.size());
+  for (size_t i = 0; i < stencils.size(); i++)
+  {
+    labels[i] = static_cast<T>(std::min(std::max(i + 1.0, tmin), tmax));
+  }
+
+  vtkIdType outIncX, outIncY, outIncZ;
+  outData->GetIncrements(outIncX, outIncY, outIncZ);
+
+  // each row is filled with the background, then painted with the
+  // sub-extents of all the stencils in order
+  const int rowLength = outExt[1] - outExt[0] + 1;
+  const int numRowsY = outExt[3] - outExt[2] + 1;
+  const vtkIdType numRows = static_cast<vtkIdType>(numRowsY) * (outExt[5] - outExt[4] + 1);
+  vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; ++row)
+    {
+      int idy = static_cast<int>(row % numRowsY);
+      int idz = static_cast<int>(row / numRowsY);
+      T* rowPtr = outPtr + idy * outIncY + idz * outIncZ;
+      std::fill(rowPtr, rowPtr + rowLength, background);
+
+      for (size_t i = 0; i < stencils.size(); i++)
+      {
+        int r1, r2;
+        int iter = 0;
+        while (stencils[i]->GetNextExtent(
+          r1, r2, outExt[0], outExt[1], idy + outExt[2], idz + outExt[4], iter))
+        {
+          if (r1 <= r2)
+          {
+            std::fill(rowPtr + (r1 - outExt[0]), rowPtr + (r2 - outExt[0] + 1), labels[i]);
+          }
+        }
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+int vtkImageStencilToLabelMap::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  int updateExtent[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent);
+  vtkImageData* outData = static_cast<vtkImageData*>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+  this->AllocateOutputData(outData, outInfo, updateExtent);
+  if (updateExtent[0] > updateExtent[1] || updateExtent[2] > updateExtent[3] ||
+    updateExtent[4] > updateExtent[5])
+  {
+    return 1;
+  }
+  void* outPtr = outData->GetScalarPointerForExtent(updateExtent);
+
+  std::vector<vtkImageStencilData*> stencils;
+  int numInputs = inputVector[0]->GetNumberOfInformationObjects();
+  for (int i = 0; i < numInputs; i++)
+  {
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(i);
+    stencils.push_back(
+      static_cast<vtkImageStencilData*>(inInfo->Get(vtkDataObject::DATA_OBJECT())));
+  }
+
+  switch (outData->GetScalarType())
+  {
+    vtkTemplateMacro(vtkImageStencilToLabelMapExecute(
+      this, stencils, outData, static_cast<VTK_TT*>(outPtr), updateExtent));
+    default:
+      vtkErrorMacro("Execute: Unknown ScalarType");
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkImageStencilToLabelMap::FillInputPortInformation(int port, vtkInformation* info)
+{
+  if (port == 0)
+  {
+    info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageStencilData");
+    info->Set(vtkAlgorithm::INPUT_IS_REPEATABLE(), 1);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkImageStencilToLabelMap::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "BackgroundValue: " << this->BackgroundValue << "\n";
+  os << indent << "OutputScalarType: " << this->OutputScalarType << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,97 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkImageStencilToLabelMap.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkImageStencilToLabelMap
+ * @brief   Convert a set of image stencils into a label map
+ *
+ * vtkImageStencilToLabelMap paints all of its input stencils into a single
+ * label image, in one pass over the output.  The stencil on input
+ * connection i gets the label i + 1, and where stencils overlap, the one
+ * with the highest connection index wins.  The voxels that are outside of
+ * all the stencils get the BackgroundValue.  The stencils must be on the
+ * same grid: the output has the spacing and origin of the first stencil,
+ * and its extent holds the extents of all the stencils.  The rows of the
+ * output are split among threads with vtkSMPTools.  When used with
+ * vtkPolyDataToImageStencil, this converts a set of structures into a
+ * label map without creating one binary image per structure.
+ * @sa
+ * vtkImageStencilToImage vtkPolyDataToImageStencil
+ */
+
+#ifndef vtkImageStencilToLabelMap_h
+#define vtkImageStencilToLabelMap_h
+
+#include "vtkImageAlgorithm.h"
+#include "vtkImagingStencilModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkImageStencilData;
+
+class VTKIMAGINGSTENCIL_EXPORT vtkImageStencilToLabelMap : public vtkImageAlgorithm
+{
+public:
+  static vtkImageStencilToLabelMap* New();
+  vtkTypeMacro(vtkImageStencilToLabelMap, vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Add a stencil, which gets the label of its position in the inputs.
+   * Stencils can also be added with AddInputConnection().
+   */
+  void AddStencilData(vtkImageStencilData* stencil);
+
+  ///@{
+  /**
+   * The value to use outside of all the stencils.  The default is 0.
+   */
+  vtkSetMacro(BackgroundValue, double);
+  vtkGetMacro(BackgroundValue, double);
+  ///@}
+
+  ///@{
+  /**
+   * The desired output scalar type.  The default is unsigned short, which
+   * allows for 65535 stencils.  Labels that do not fit in the output type
+   * are clamped to its range.
+   */
+  vtkSetMacro(OutputScalarType, int);
+  vtkGetMacro(OutputScalarType, int);
+  void SetOutputScalarTypeToInt() { this->SetOutputScalarType(VTK_INT); }
+  void SetOutputScalarTypeToUnsignedInt() { this->SetOutputScalarType(VTK_UNSIGNED_INT); }
+  void SetOutputScalarTypeToShort() { this->SetOutputScalarType(VTK_SHORT); }
+  void SetOutputScalarTypeToUnsignedShort() { this->SetOutputScalarType(VTK_UNSIGNED_SHORT); }
+  void SetOutputScalarTypeToUnsignedChar() { this->SetOutputScalarType(VTK_UNSIGNED_CHAR); }
+  ///@}
+
+protected:
+  vtkImageStencilToLabelMap();
+  ~vtkImageStencilToLabelMap() override;
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  double BackgroundValue;
+  int OutputScalarType;
+
+  int FillInputPortInformation(int, vtkInformation*) override;
+
+private:
+  vtkImageStencilToLabelMap(const vtkImageStencilToLabelMap&) = delete;
+  void operator=(const vtkImageStencilToLabelMap&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
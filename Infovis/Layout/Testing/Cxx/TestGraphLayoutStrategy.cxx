@@ -23,6 +23,7 @@
 #include "vtkForceDirectedLayoutStrategy.h"
 #include "vtkGraphLayout.h"
 #include "vtkMath.h"
+#include "vtkMultilevelForceLayoutStrategy.h"
 #include "vtkPassThroughLayoutStrategy.h"
 #include "vtkRandomGraphSource.h"
 #include "vtkRandomLayoutStrategy.h"
@@ -201,5 +202,47 @@ int TestGraphLayoutStrategy(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
   }
   cerr << "...done." << endl;
 
+  cerr << "Testing vtkMultilevelForceLayoutStrategy..." << endl;
+  VTK_CREATE(vtkMultilevelForceLayoutStrategy, multilevel);
+  multilevel->SetRestDistance(1.0);
+  multilevel->SetCoarsestGraphSize(10);
+  length = multilevel->GetRestDistance();
+  layout->SetLayoutStrategy(multilevel);
+  for (int threeD = 0; threeD < 2; ++threeD)
+  {
+    multilevel->SetThreeDimensionalLayout(threeD);
+    multilevel->Modified();
+    layout->Modified();
+    layout->Update();
+    output = layout->GetOutput();
+    if (multilevel->GetNumberOfLevels() < 2)
+    {
+      cerr << "ERROR: The graph was not coarsened." << endl;
+      errors++;
+    }
+    output->GetEdges(edges);
+    while (edges->HasNext())
+    {
+      vtkEdgeType e = edges->Next();
+      vtkIdType u = e.Source;
+      vtkIdType v = e.Target;
+      output->GetPoint(u, pt);
+      output->GetPoint(v, pt2);
+      double dist = sqrt(vtkMath::Distance2BetweenPoints(pt, pt2));
+      if (u != v && (dist < length / tol || dist > length * tol))
+      {
+        cerr << "ERROR: Edge " << u << "," << v << " distance is " << dist
+             << " but resting distance is " << length << endl;
+        errors++;
+      }
+      if (!threeD && (pt[2] != 0.0 || pt2[2] != 0.0))
+      {
+        cerr << "ERROR: Edge " << u << "," << v << " not on the xy plane" << endl;
+        errors++;
+      }
+    }
+  }
+  cerr << "...done." << endl;
+
   return errors;
 }
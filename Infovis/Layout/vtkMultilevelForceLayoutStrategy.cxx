@@ -0,0 +1,787 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkMultilevelForceLayoutStrategy.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkMultilevelForceLayoutStrategy.h"
+
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkEdgeListIterator.h"
+#include "vtkGraph.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Strength of the repulsion relative to the attraction, as suggested by Hu.
+constexpr double RepulsionStrength = 0.2;
+// Factor applied to the step length when the energy does not decrease.
+constexpr double StepCooling = 0.9;
+// A level has converged when the step falls below this fraction of the rest distance.
+constexpr double Tolerance = 0.01;
+// Coarsening stops when it does not remove at least a tenth of the vertices.
+constexpr double MaximumCoarseningRatio = 0.9;
+// Amplitude of the jitter of the interpolated positions, relative to the rest distance.
+constexpr double InterpolationJitter = 0.1;
+// Limits of the Barnes-Hut tree.
+constexpr vtkIdType LeafSize = 8;
+constexpr int MaxTreeDepth = 32;
+
+//------------------------------------------------------------------------------
+// A graph of the hierarchy, its symmetric adjacency stored in compressed rows.
+struct Level
+{
+  vtkIdType NumberOfVertices = 0;
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> Neighbors;
+  std::vector<double> Weights;
+  std::vector<double> Masses;
+  // The vertex of the next coarser level each vertex was collapsed into.
+  std::vector<vtkIdType> Parents;
+};
+
+//------------------------------------------------------------------------------
+void BuildInputLevel(vtkGraph* graph, vtkDataArray* weights, Level& level)
+{
+  const vtkIdType numVertices = graph->GetNumberOfVertices();
+  level.NumberOfVertices = numVertices;
+  level.Masses.assign(numVertices, 1.0);
+  level.Offsets.assign(numVertices + 1, 0);
+
+  double maxWeight = 0.0;
+  if (weights)
+  {
+    for (vtkIdType i = 0; i < weights->GetNumberOfTuples(); ++i)
+    {
+      maxWeight = std::max(maxWeight, weights->GetTuple1(i));
+    }
+    if (maxWeight <= 0.0)
+    {
+      weights = nullptr;
+    }
+  }
+
+  // Self loops do not take part in the layout.
+  vtkNew<vtkEdgeListIterator> edges;
+  graph->GetEdges(edges);
+  while (edges->HasNext())
+  {
+    vtkEdgeType e = edges->Next();
+    if (e.Source != e.Target)
+    {
+      ++level.Offsets[e.Source + 1];
+      ++level.Offsets[e.Target + 1];
+    }
+  }
+  std::partial_sum(level.Offsets.begin(), level.Offsets.end(), level.Offsets.begin());
+  level.Neighbors.resize(level.Offsets[numVertices]);
+  level.Weights.resize(level.Offsets[numVertices]);
+
+  std::vector<vtkIdType> next(level.Offsets.begin(), level.Offsets.end() - 1);
+  graph->GetEdges(edges);
+  while (edges->HasNext())
+  {
+    vtkEdgeType e = edges->Next();
+    if (e.Source != e.Target)
+    {
+      const double weight = weights ? std::max(weights->GetTuple1(e.Id), 0.0) / maxWeight : 1.0;
+      level.Neighbors[next[e.Source]] = e.Target;
+      level.Weights[next[e.Source]++] = weight;
+      level.Neighbors[next[e.Target]] = e.Source;
+      level.Weights[next[e.Target]++] = weight;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Collapses a heavy edge matching of the fine graph into the coarse graph.
+// The vertices left unmatched, whose neighbors are all matched, join the
+// coarse vertex of their heaviest neighbor so that hubs collapse quickly.
+// Returns false when the graph does not shrink enough to be worth it.
+bool Coarsen(Level& fine, Level& coarse, vtkMinimalStandardRandomSequence* random)
+{
+  const vtkIdType numVertices = fine.NumberOfVertices;
+  std::vector<vtkIdType> order(numVertices);
+  std::iota(order.begin(), order.end(), 0);
+  for (vtkIdType i = numVertices - 1; i > 0; --i)
+  {
+    const vtkIdType j = std::min(
+      static_cast<vtkIdType>(random->GetNextRangeValue(0.0, static_cast<double>(i + 1))), i);
+    std::swap(order[i], order[j]);
+  }
+
+  // Match each vertex with the unmatched neighbor of heaviest edge, relative
+  // to its mass to keep the coarse vertices balanced.
+  std::vector<vtkIdType>& parents = fine.Parents;
+  parents.assign(numVertices, -1);
+  vtkIdType numCoarse = 0;
+  for (vtkIdType v : order)
+  {
+    if (parents[v] >= 0)
+    {
+      continue;
+    }
+    vtkIdType match = -1;
+    double best = -1.0;
+    for (vtkIdType k = fine.Offsets[v]; k < fine.Offsets[v + 1]; ++k)
+    {
+      const vtkIdType u = fine.Neighbors[k];
+      const double score = fine.Weights[k] / fine.Masses[u];
+      if (parents[u] < 0 && u != v && score > best)
+      {
+        match = u;
+        best = score;
+      }
+    }
+    if (match >= 0)
+    {
+      parents[v] = parents[match] = numCoarse++;
+    }
+  }
+  for (vtkIdType v : order)
+  {
+    if (parents[v] >= 0)
+    {
+      continue;
+    }
+    vtkIdType heaviest = -1;
+    double best = -1.0;
+    for (vtkIdType k = fine.Offsets[v]; k < fine.Offsets[v + 1]; ++k)
+    {
+      if (fine.Weights[k] > best && parents[fine.Neighbors[k]] >= 0)
+      {
+        heaviest = fine.Neighbors[k];
+        best = fine.Weights[k];
+      }
+    }
+    parents[v] = heaviest >= 0 ? parents[heaviest] : numCoarse++;
+  }
+  if (numCoarse > MaximumCoarseningRatio * numVertices)
+  {
+    return false;
+  }
+
+  // Group the fine vertices by coarse vertex.
+  std::vector<vtkIdType> memberOffsets(numCoarse + 1, 0);
+  for (vtkIdType v = 0; v < numVertices; ++v)
+  {
+    ++memberOffsets[parents[v] + 1];
+  }
+  std::partial_sum(memberOffsets.begin(), memberOffsets.end(), memberOffsets.begin());
+  std::vector<vtkIdType> members(numVertices);
+  std::vector<vtkIdType> next(memberOffsets.begin(), memberOffsets.end() - 1);
+  for (vtkIdType v = 0; v < numVertices; ++v)
+  {
+    members[next[parents[v]]++] = v;
+  }
+
+  // Merge the edges between the same coarse vertices, adding their weights.
+  coarse.NumberOfVertices = numCoarse;
+  coarse.Masses.assign(numCoarse, 0.0);
+  coarse.Offsets.assign(numCoarse + 1, 0);
+  coarse.Neighbors.clear();
+  coarse.Weights.clear();
+  std::vector<vtkIdType> slots(numCoarse, -1);
+  for (vtkIdType c = 0; c < numCoarse; ++c)
+  {
+    const vtkIdType rowStart = static_cast<vtkIdType>(coarse.Neighbors.size());
+    for (vtkIdType m = memberOffsets[c]; m < memberOffsets[c + 1]; ++m)
+    {
+      const vtkIdType v = members[m];
+      coarse.Masses[c] += fine.Masses[v];
+      for (vtkIdType k = fine.Offsets[v]; k < fine.Offsets[v + 1]; ++k)
+      {
+        const vtkIdType p = parents[fine.Neighbors[k]];
+        if (p == c)
+        {
+          continue;
+        }
+        if (slots[p] < rowStart)
+        {
+          slots[p] = static_cast<vtkIdType>(coarse.Neighbors.size());
+          coarse.Neighbors.push_back(p);
+          coarse.Weights.push_back(fine.Weights[k]);
+        }
+        else
+        {
+          coarse.Weights[slots[p]] += fine.Weights[k];
+        }
+      }
+    }
+    coarse.Offsets[c + 1] = static_cast<vtkIdType>(coarse.Neighbors.size());
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// A quadtree or an octree of the vertices, each cell knowing the total mass
+// and the center of mass of the vertices it holds.
+class BarnesHutTree
+{
+public:
+  struct Node
+  {
+    double Center[3];
+    double Mass;
+    double Size;
+    vtkIdType Begin;
+    vtkIdType End;
+    vtkIdType FirstChild;
+    int NumberOfChildren;
+  };
+
+  std::vector<Node> Nodes;
+  // The vertices, ordered so that each cell holds a contiguous range.
+  std::vector<vtkIdType> Indices;
+
+  void Build(const double* positions, const double* masses, vtkIdType numVertices, int dimension)
+  {
+    this->Positions = positions;
+    this->Masses = masses;
+    this->Dimension = dimension;
+    this->Indices.resize(numVertices);
+    std::iota(this->Indices.begin(), this->Indices.end(), 0);
+    this->Scratch.resize(numVertices);
+    this->Octants.resize(numVertices);
+    this->Nodes.clear();
+
+    double origin[3] = { 0.0, 0.0, 0.0 };
+    double size = 0.0;
+    for (int d = 0; d < dimension; ++d)
+    {
+      double lower = VTK_DOUBLE_MAX;
+      double upper = -VTK_DOUBLE_MAX;
+      for (vtkIdType i = 0; i < numVertices; ++i)
+      {
+        lower = std::min(lower, positions[3 * i + d]);
+        upper = std::max(upper, positions[3 * i + d]);
+      }
+      origin[d] = lower;
+      size = std::max(size, upper - lower);
+    }
+    this->Nodes.emplace_back();
+    this->BuildNode(0, 0, numVertices, origin, size > 0.0 ? size : 1.0, 0);
+  }
+
+private:
+  void BuildNode(vtkIdType node, vtkIdType begin, vtkIdType end, const double origin[3],
+    double size, int depth)
+  {
+    double center[3] = { 0.0, 0.0, 0.0 };
+    double mass = 0.0;
+    for (vtkIdType k = begin; k < end; ++k)
+    {
+      const vtkIdType i = this->Indices[k];
+      const double m = this->Masses[i];
+      mass += m;
+      for (int d = 0; d < 3; ++d)
+      {
+        center[d] += m * this->Positions[3 * i + d];
+      }
+    }
+    Node& current = this->Nodes[node];
+    for (int d = 0; d < 3; ++d)
+    {
+      current.Center[d] = center[d] / mass;
+    }
+    current.Mass = mass;
+    current.Size = size;
+    current.Begin = begin;
+    current.End = end;
+    current.FirstChild = -1;
+    current.NumberOfChildren = 0;
+    if (end - begin <= LeafSize || depth >= MaxTreeDepth)
+    {
+      return;
+    }
+
+    // Sort the vertices of the cell by sub-cell.
+    const double half = 0.5 * size;
+    vtkIdType counts[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    for (vtkIdType k = begin; k < end; ++k)
+    {
+      const double* x = this->Positions + 3 * this->Indices[k];
+      unsigned char octant = 0;
+      for (int d = 0; d < this->Dimension; ++d)
+      {
+        octant |= (x[d] >= origin[d] + half ? 1 : 0) << d;
+      }
+      this->Octants[k] = octant;
+      ++counts[octant];
+    }
+    vtkIdType starts[9] = { begin };
+    for (int o = 0; o < 8; ++o)
+    {
+      starts[o + 1] = starts[o] + counts[o];
+    }
+    vtkIdType next[8];
+    std::copy(starts, starts + 8, next);
+    for (vtkIdType k = begin; k < end; ++k)
+    {
+      this->Scratch[next[this->Octants[k]]++] = this->Indices[k];
+    }
+    std::copy(this->Scratch.begin() + begin, this->Scratch.begin() + end,
+      this->Indices.begin() + begin);
+
+    // The children are stored contiguously, before building them recursively.
+    const vtkIdType firstChild = static_cast<vtkIdType>(this->Nodes.size());
+    int numChildren = 0;
+    for (int o = 0; o < 8; ++o)
+    {
+      numChildren += counts[o] > 0 ? 1 : 0;
+    }
+    this->Nodes[node].FirstChild = firstChild;
+    this->Nodes[node].NumberOfChildren = numChildren;
+    this->Nodes.resize(this->Nodes.size() + numChildren);
+    vtkIdType child = firstChild;
+    for (int o = 0; o < 8; ++o)
+    {
+      if (counts[o] > 0)
+      {
+        double childOrigin[3];
+        for (int d = 0; d < 3; ++d)
+        {
+          childOrigin[d] = origin[d] + ((o >> d) & 1 ? half : 0.0);
+        }
+        this->BuildNode(child++, starts[o], starts[o + 1], childOrigin, half, depth + 1);
+      }
+    }
+  }
+
+  const double* Positions = nullptr;
+  const double* Masses = nullptr;
+  int Dimension = 2;
+  std::vector<vtkIdType> Scratch;
+  std::vector<unsigned char> Octants;
+};
+
+//------------------------------------------------------------------------------
+// Computes the force applied on each vertex: the repulsion of all the other
+// vertices, approximated with the tree, and the attraction of its neighbors.
+struct ComputeForces
+{
+  const Level& Graph;
+  const BarnesHutTree& Tree;
+  const double* Positions;
+  double* Forces;
+  double* Norms;
+  int Dimension;
+  double RestDistance;
+  double Theta2;
+
+  ComputeForces(const Level& graph, const BarnesHutTree& tree, const double* positions,
+    double* forces, double* norms, int dimension, double restDistance, double theta)
+    : Graph(graph)
+    , Tree(tree)
+    , Positions(positions)
+    , Forces(forces)
+    , Norms(norms)
+    , Dimension(dimension)
+    , RestDistance(restDistance)
+    , Theta2(theta * theta)
+  {
+  }
+
+  // Adds the repulsion of a body at y on the vertex i at x.
+  void Repulse(const double* x, const double* y, double strength, vtkIdType i, vtkIdType j,
+    double force[3]) const
+  {
+    double diff[3] = { 0.0, 0.0, 0.0 };
+    double dist2 = 0.0;
+    for (int d = 0; d < this->Dimension; ++d)
+    {
+      diff[d] = x[d] - y[d];
+      dist2 += diff[d] * diff[d];
+    }
+    const double minDist2 = 1e-12 * this->RestDistance * this->RestDistance;
+    if (dist2 < minDist2)
+    {
+      // Separate coincident vertices along a direction depending on the pair.
+      const double angle = static_cast<double>((std::min(i, j) * 7919 + std::max(i, j)) % 3600);
+      const double sign = i < j ? 1.0 : -1.0;
+      diff[0] = sign * std::cos(angle);
+      diff[1] = sign * std::sin(angle);
+      diff[2] = this->Dimension == 3 ? sign * std::cos(0.5 * angle) : 0.0;
+      dist2 = diff[0] * diff[0] + diff[1] * diff[1] + diff[2] * diff[2];
+    }
+    for (int d = 0; d < this->Dimension; ++d)
+    {
+      force[d] += diff[d] * strength / dist2;
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    const std::vector<BarnesHutTree::Node>& nodes = this->Tree.Nodes;
+    const double k2 = RepulsionStrength * this->RestDistance * this->RestDistance;
+    vtkIdType stack[8 * MaxTreeDepth + 8];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const double* x = this->Positions + 3 * i;
+      const double strength = k2 * this->Graph.Masses[i];
+      double force[3] = { 0.0, 0.0, 0.0 };
+
+      int top = 0;
+      stack[top++] = 0;
+      while (top > 0)
+      {
+        const BarnesHutTree::Node& node = nodes[stack[--top]];
+        if (node.FirstChild < 0)
+        {
+          for (vtkIdType k = node.Begin; k < node.End; ++k)
+          {
+            const vtkIdType j = this->Tree.Indices[k];
+            if (j != i)
+            {
+              this->Repulse(
+                x, this->Positions + 3 * j, strength * this->Graph.Masses[j], i, j, force);
+            }
+          }
+          continue;
+        }
+        double dist2 = 0.0;
+        for (int d = 0; d < this->Dimension; ++d)
+        {
+          dist2 += (x[d] - node.Center[d]) * (x[d] - node.Center[d]);
+        }
+        if (node.Size * node.Size < this->Theta2 * dist2)
+        {
+          this->Repulse(x, node.Center, strength * node.Mass, i, -1, force);
+        }
+        else
+        {
+          for (int c = 0; c < node.NumberOfChildren; ++c)
+          {
+            stack[top++] = node.FirstChild + c;
+          }
+        }
+      }
+
+      for (vtkIdType k = this->Graph.Offsets[i]; k < this->Graph.Offsets[i + 1]; ++k)
+      {
+        const double* y = this->Positions + 3 * this->Graph.Neighbors[k];
+        double diff[3] = { 0.0, 0.0, 0.0 };
+        double dist2 = 0.0;
+        for (int d = 0; d < this->Dimension; ++d)
+        {
+          diff[d] = y[d] - x[d];
+          dist2 += diff[d] * diff[d];
+        }
+        const double scale = this->Graph.Weights[k] * std::sqrt(dist2) / this->RestDistance;
+        for (int d = 0; d < this->Dimension; ++d)
+        {
+          force[d] += diff[d] * scale;
+        }
+      }
+
+      double* f = this->Forces + 3 * i;
+      f[0] = force[0];
+      f[1] = force[1];
+      f[2] = force[2];
+      this->Norms[i] = std::sqrt(force[0] * force[0] + force[1] * force[1] + force[2] * force[2]);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+double MeanEdgeLength(const Level& level, const std::vector<double>& positions)
+{
+  double sum = 0.0;
+  for (vtkIdType i = 0; i < level.NumberOfVertices; ++i)
+  {
+    for (vtkIdType k = level.Offsets[i]; k < level.Offsets[i + 1]; ++k)
+    {
+      const double* x = positions.data() + 3 * i;
+      const double* y = positions.data() + 3 * level.Neighbors[k];
+      sum += std::sqrt((x[0] - y[0]) * (x[0] - y[0]) + (x[1] - y[1]) * (x[1] - y[1]) +
+        (x[2] - y[2]) * (x[2] - y[2]));
+    }
+  }
+  return level.Neighbors.empty() ? 0.0 : sum / level.Neighbors.size();
+}
+
+//------------------------------------------------------------------------------
+// Scales the layout about its centroid by the factor minimizing its energy.
+// The attraction energy of an edge is w d^3 / 3K and the repulsion energy of
+// a pair is -C K^2 m m' ln(d), so that the energy of the layout scaled by s
+// is minimal when s^3 = C K^2 sum(m m') / sum(w d^3 / K).
+void ScaleToEquilibrium(const Level& level, std::vector<double>& positions, double restDistance)
+{
+  double attraction = 0.0;
+  for (vtkIdType i = 0; i < level.NumberOfVertices; ++i)
+  {
+    for (vtkIdType k = level.Offsets[i]; k < level.Offsets[i + 1]; ++k)
+    {
+      const double* x = positions.data() + 3 * i;
+      const double* y = positions.data() + 3 * level.Neighbors[k];
+      const double dist2 = (x[0] - y[0]) * (x[0] - y[0]) + (x[1] - y[1]) * (x[1] - y[1]) +
+        (x[2] - y[2]) * (x[2] - y[2]);
+      // each edge is seen from both ends
+      attraction += 0.5 * level.Weights[k] * dist2 * std::sqrt(dist2) / restDistance;
+    }
+  }
+  double mass = 0.0;
+  double mass2 = 0.0;
+  for (double m : level.Masses)
+  {
+    mass += m;
+    mass2 += m * m;
+  }
+  const double repulsion =
+    RepulsionStrength * restDistance * restDistance * 0.5 * (mass * mass - mass2);
+  if (attraction <= 0.0 || repulsion <= 0.0)
+  {
+    return;
+  }
+
+  const double scale = std::cbrt(repulsion / attraction);
+  const vtkIdType numVertices = level.NumberOfVertices;
+  double center[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType i = 0; i < numVertices; ++i)
+  {
+    for (int d = 0; d < 3; ++d)
+    {
+      center[d] += positions[3 * i + d] / numVertices;
+    }
+  }
+  for (vtkIdType i = 0; i < numVertices; ++i)
+  {
+    for (int d = 0; d < 3; ++d)
+    {
+      positions[3 * i + d] = center[d] + scale * (positions[3 * i + d] - center[d]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Lays out a level from the given positions. The vertices move by a step
+// starting at the mean edge length, which is cooled down at each iteration.
+// For the coarsest level, whose initial layout is random, the step follows
+// Hu's adaptive scheme and grows back while the energy keeps decreasing.
+void LayoutLevel(const Level& level, std::vector<double>& positions, int dimension,
+  double restDistance, double theta, int maxIterations, bool adaptive)
+{
+  const vtkIdType numVertices = level.NumberOfVertices;
+  if (numVertices == 0)
+  {
+    return;
+  }
+  std::vector<double> forces(3 * numVertices);
+  std::vector<double> norms(numVertices);
+  BarnesHutTree tree;
+
+  ScaleToEquilibrium(level, positions, restDistance);
+  double step = MeanEdgeLength(level, positions);
+  if (step <= 0.0)
+  {
+    step = restDistance;
+  }
+  const double minStep = Tolerance * step;
+  double energy = VTK_DOUBLE_MAX;
+  int progress = 0;
+  for (int iteration = 0; iteration < maxIterations && step >= minStep; ++iteration)
+  {
+    tree.Build(positions.data(), level.Masses.data(), numVertices, dimension);
+    ComputeForces computeForces(level, tree, positions.data(), forces.data(), norms.data(),
+      dimension, restDistance, theta);
+    vtkSMPTools::For(0, numVertices, computeForces);
+
+    // Move each vertex by the step length along its force.
+    double* x = positions.data();
+    const double* f = forces.data();
+    const double* n = norms.data();
+    vtkSMPTools::For(0, numVertices, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        if (n[i] > 0.0)
+        {
+          for (int d = 0; d < 3; ++d)
+          {
+            x[3 * i + d] += step * f[3 * i + d] / n[i];
+          }
+        }
+      }
+    });
+
+    // The energy is summed serially so that the layout does not depend on
+    // the number of threads.
+    const double previousEnergy = energy;
+    energy = 0.0;
+    for (vtkIdType i = 0; i < numVertices; ++i)
+    {
+      energy += n[i] * n[i];
+    }
+    if (adaptive && energy < previousEnergy)
+    {
+      if (++progress >= 5)
+      {
+        progress = 0;
+        step /= StepCooling;
+      }
+    }
+    else
+    {
+      progress = 0;
+      step *= StepCooling;
+    }
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkMultilevelForceLayoutStrategy);
+
+//------------------------------------------------------------------------------
+vtkMultilevelForceLayoutStrategy::vtkMultilevelForceLayoutStrategy()
+{
+  this->RandomSeed = 123;
+  this->MaxNumberOfIterations = 100;
+  this->RestDistance = 1.0;
+  this->Theta = 0.9;
+  this->CoarsestGraphSize = 50;
+  this->MaxNumberOfLevels = 30;
+  this->ThreeDimensionalLayout = false;
+  this->NumberOfLevels = 0;
+  this->SetEdgeWeightField("weight");
+}
+
+//------------------------------------------------------------------------------
+vtkMultilevelForceLayoutStrategy::~vtkMultilevelForceLayoutStrategy() = default;
+
+//------------------------------------------------------------------------------
+void vtkMultilevelForceLayoutStrategy::Layout()
+{
+  if (!this->Graph)
+  {
+    vtkErrorMacro("No graph to lay out.");
+    return;
+  }
+  if (this->RestDistance <= 0.0)
+  {
+    vtkErrorMacro("RestDistance must be positive, not " << this->RestDistance << ".");
+    return;
+  }
+
+  vtkDataArray* weights = nullptr;
+  if (this->WeightEdges && this->EdgeWeightField)
+  {
+    weights = vtkArrayDownCast<vtkDataArray>(
+      this->Graph->GetEdgeData()->GetAbstractArray(this->EdgeWeightField));
+  }
+
+  // Build the hierarchy of coarser graphs.
+  std::vector<Level> levels(1);
+  BuildInputLevel(this->Graph, weights, levels[0]);
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(this->RandomSeed);
+  while (static_cast<int>(levels.size()) < this->MaxNumberOfLevels &&
+    levels.back().NumberOfVertices > this->CoarsestGraphSize)
+  {
+    Level coarse;
+    if (!Coarsen(levels.back(), coarse, random))
+    {
+      break;
+    }
+    levels.push_back(std::move(coarse));
+  }
+  this->NumberOfLevels = static_cast<int>(levels.size());
+
+  // Place the vertices of the coarsest graph randomly in a region whose size
+  // depends on the number of vertices of the input graph.
+  const int dimension = this->ThreeDimensionalLayout ? 3 : 2;
+  const double side = this->RestDistance *
+    std::pow(static_cast<double>(this->Graph->GetNumberOfVertices()), 1.0 / dimension);
+  std::vector<double> positions(3 * levels.back().NumberOfVertices, 0.0);
+  for (vtkIdType i = 0; i < levels.back().NumberOfVertices; ++i)
+  {
+    for (int d = 0; d < dimension; ++d)
+    {
+      positions[3 * i + d] = random->GetNextRangeValue(-0.5 * side, 0.5 * side);
+    }
+  }
+
+  // Refine the layout from the coarsest level to the input graph, each fine
+  // vertex starting next to the coarse vertex it was collapsed into.
+  bool coarsest = true;
+  double meanLength = 0.0;
+  while (true)
+  {
+    LayoutLevel(levels.back(), positions, dimension, this->RestDistance, this->Theta,
+      this->MaxNumberOfIterations, coarsest);
+    coarsest = false;
+    meanLength = MeanEdgeLength(levels.back(), positions);
+    levels.pop_back();
+    if (levels.empty())
+    {
+      break;
+    }
+    const Level& fine = levels.back();
+    std::vector<double> finePositions(3 * fine.NumberOfVertices, 0.0);
+    const double jitter =
+      InterpolationJitter * (meanLength > 0.0 ? meanLength : this->RestDistance);
+    for (vtkIdType i = 0; i < fine.NumberOfVertices; ++i)
+    {
+      for (int d = 0; d < dimension; ++d)
+      {
+        finePositions[3 * i + d] =
+          positions[3 * fine.Parents[i] + d] + random->GetNextRangeValue(-jitter, jitter);
+      }
+    }
+    positions = std::move(finePositions);
+  }
+
+  // The shape of the layout does not depend on the rest distance, scale it so
+  // that the edges are RestDistance long on average.
+  if (meanLength > 0.0)
+  {
+    const double scale = this->RestDistance / meanLength;
+    for (double& x : positions)
+    {
+      x *= scale;
+    }
+  }
+
+  vtkNew<vtkDoubleArray> coordinates;
+  coordinates->SetNumberOfComponents(3);
+  coordinates->SetNumberOfTuples(this->Graph->GetNumberOfVertices());
+  std::copy(positions.begin(), positions.end(), coordinates->GetPointer(0));
+  vtkNew<vtkPoints> points;
+  points->SetData(coordinates);
+  this->Graph->SetPoints(points);
+}
+
+//------------------------------------------------------------------------------
+void vtkMultilevelForceLayoutStrategy::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "RandomSeed: " << this->RandomSeed << endl;
+  os << indent << "MaxNumberOfIterations: " << this->MaxNumberOfIterations << endl;
+  os << indent << "RestDistance: " << this->RestDistance << endl;
+  os << indent << "Theta: " << this->Theta << endl;
+  os << indent << "CoarsestGraphSize: " << this->CoarsestGraphSize << endl;
+  os << indent << "MaxNumberOfLevels: " << this->MaxNumberOfLevels << endl;
+  os << indent << "ThreeDimensionalLayout: " << (this->ThreeDimensionalLayout ? "On\n" : "Off\n");
+  os << indent << "NumberOfLevels: " << this->NumberOfLevels << endl;
+}
+VTK_ABI_NAMESPACE_END
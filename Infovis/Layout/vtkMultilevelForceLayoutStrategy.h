@@ -0,0 +1,156 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkMultilevelForceLayoutStrategy.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkMultilevelForceLayoutStrategy
+ * @brief   a multilevel force directed layout for large graphs
+ *
+ *
+ * Lays out a graph in 2D or 3D with a spring-electrical model, as described
+ * by Yifan Hu in "Efficient and high quality force-directed graph drawing"
+ * (The Mathematica Journal, 2005).
+ *
+ * The graph is first coarsened into a hierarchy of smaller graphs by
+ * collapsing matched edges, each coarse vertex standing for the vertices it
+ * was built from. The coarsest graph is laid out from random positions, then
+ * each layout is interpolated to the finer graph below it and refined, until
+ * the input graph is reached.
+ *
+ * At each level, the repulsive forces between all the vertices are
+ * approximated with a Barnes-Hut quadtree (2D) or octree (3D), so that an
+ * iteration costs O(V log V + E) instead of O(V^2). The forces and the
+ * displacements of the vertices are computed in parallel with vtkSMPTools,
+ * the result not depending on the number of threads.
+ *
+ * Unlike vtkForceDirectedLayoutStrategy, the whole layout is computed by a
+ * single call to Layout(), and the points are not scaled to fit in given
+ * bounds but so that the mean length of the edges is RestDistance.
+ *
+ * @sa
+ * vtkForceDirectedLayoutStrategy vtkFast2DLayoutStrategy vtkIncrementalForceLayout
+ */
+
+#ifndef vtkMultilevelForceLayoutStrategy_h
+#define vtkMultilevelForceLayoutStrategy_h
+
+#include "vtkGraphLayoutStrategy.h"
+#include "vtkInfovisLayoutModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKINFOVISLAYOUT_EXPORT vtkMultilevelForceLayoutStrategy : public vtkGraphLayoutStrategy
+{
+public:
+  static vtkMultilevelForceLayoutStrategy* New();
+
+  vtkTypeMacro(vtkMultilevelForceLayoutStrategy, vtkGraphLayoutStrategy);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Seed the random number generator used for the coarsening and the initial
+   * positions of the coarsest graph. The default is 123.
+   */
+  vtkSetClampMacro(RandomSeed, int, 0, VTK_INT_MAX);
+  vtkGetMacro(RandomSeed, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of iterations at each level of the hierarchy.
+   * A level stops earlier when its layout has converged. The default is 100.
+   */
+  vtkSetClampMacro(MaxNumberOfIterations, int, 0, VTK_INT_MAX);
+  vtkGetMacro(MaxNumberOfIterations, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the mean length of the edges in the final layout, which must be
+   * positive. The default is 1.
+   */
+  vtkSetMacro(RestDistance, double);
+  vtkGetMacro(RestDistance, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the Barnes-Hut opening criterion: a cell of the tree whose size
+   * is less than Theta times its distance to a vertex acts on that vertex as
+   * a single body. Lower values are more accurate and slower, 0 computing all
+   * the pairwise repulsions. The default is 0.9.
+   */
+  vtkSetClampMacro(Theta, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(Theta, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of vertices below which the graph is not coarsened
+   * anymore. The default is 50.
+   */
+  vtkSetClampMacro(CoarsestGraphSize, vtkIdType, 2, VTK_ID_MAX);
+  vtkGetMacro(CoarsestGraphSize, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of levels of the hierarchy, including the
+   * input graph. Setting it to 1 disables the coarsening. The default is 30.
+   */
+  vtkSetClampMacro(MaxNumberOfLevels, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaxNumberOfLevels, int);
+  ///@}
+
+  ///@{
+  /**
+   * Turn on/off layout of graph in three dimensions. If off, graph
+   * layout occurs in two dimensions. By default, three dimensional
+   * layout is off.
+   */
+  vtkSetMacro(ThreeDimensionalLayout, vtkTypeBool);
+  vtkGetMacro(ThreeDimensionalLayout, vtkTypeBool);
+  vtkBooleanMacro(ThreeDimensionalLayout, vtkTypeBool);
+  ///@}
+
+  /**
+   * Get the number of levels of the hierarchy built by the last call to
+   * Layout(), including the input graph.
+   */
+  vtkGetMacro(NumberOfLevels, int);
+
+  /**
+   * Lay out the graph set in SetGraph(), replacing its points.
+   */
+  void Layout() override;
+
+protected:
+  vtkMultilevelForceLayoutStrategy();
+  ~vtkMultilevelForceLayoutStrategy() override;
+
+  int RandomSeed;
+  int MaxNumberOfIterations;
+  double RestDistance;
+  double Theta;
+  vtkIdType CoarsestGraphSize;
+  int MaxNumberOfLevels;
+  vtkTypeBool ThreeDimensionalLayout;
+  int NumberOfLevels;
+
+private:
+  vtkMultilevelForceLayoutStrategy(const vtkMultilevelForceLayoutStrategy&) = delete;
+  void operator=(const vtkMultilevelForceLayoutStrategy&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
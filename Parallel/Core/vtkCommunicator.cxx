@@ -15,6 +15,8 @@
 #include "vtkCommunicator.h"
 
 #include "vtkBoundingBox.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
 #include "vtkCharArray.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataObjectTypes.h"
@@ -28,9 +30,13 @@
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkIntArray.h"
+#include "vtkMatrix3x3.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
@@ -39,10 +45,13 @@
 #include "vtkTypeTraits.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedLongArray.h"
+#include "vtkUnstructuredGrid.h"
 
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <string>
+#include <utility>
 #include <vector>
 
 #define EXTENT_HEADER_SIZE 128
@@ -98,6 +107,394 @@ STANDARD_OPERATION_DEFINITION(LogicalXor, (!A[i] && B[i]) || (A[i] && !B[i]));
 STANDARD_OPERATION_FLOAT_OVERRIDE(BitwiseXor);
 STANDARD_OPERATION_DEFINITION(BitwiseXor, A[i] ^ B[i]);
 
+namespace
+{
+// Formats of the elemental data objects: the legacy format sends a string
+// written by vtkGenericDataObjectWriter, the arrays format sends the buffers
+// of the arrays of a dataset as they are, behind a description of the
+// dataset.
+enum DataObjectFormats
+{
+  LEGACY_FORMAT = 0,
+  ARRAYS_FORMAT = 1
+};
+
+// What each array sent in the arrays format is to the dataset.
+enum ArrayRoles
+{
+  FIELD_DATA_ROLE = 0,
+  POINT_DATA_ROLE,
+  CELL_DATA_ROLE,
+  POINTS_ROLE,
+  X_COORDINATES_ROLE,
+  Y_COORDINATES_ROLE,
+  Z_COORDINATES_ROLE,
+  CELL_TYPES_ROLE,
+  FACES_ROLE,
+  FACE_LOCATIONS_ROLE,
+  // offsets then connectivity of the verts, lines, polys, strips and cells
+  CELL_ARRAYS_ROLE
+};
+
+using RoleAndArray = std::pair<int, vtkDataArray*>;
+
+//------------------------------------------------------------------------------
+bool AddAttributeArrays(vtkFieldData* fd, int role, std::vector<RoleAndArray>& arrays)
+{
+  for (int i = 0; i < fd->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* array = vtkArrayDownCast<vtkDataArray>(fd->GetAbstractArray(i));
+    if (!array || array->GetDataType() == VTK_BIT)
+    {
+      return false;
+    }
+    arrays.emplace_back(role, array);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void AddCellArray(vtkCellArray* cells, int index, std::vector<RoleAndArray>& arrays)
+{
+  if (cells && cells->GetNumberOfCells() > 0)
+  {
+    arrays.emplace_back(CELL_ARRAYS_ROLE + 2 * index, cells->GetOffsetsArray());
+    arrays.emplace_back(CELL_ARRAYS_ROLE + 2 * index + 1, cells->GetConnectivityArray());
+  }
+}
+
+//------------------------------------------------------------------------------
+// Lists the arrays of a dataset that the arrays format can send, returns false
+// if the dataset must be sent in the legacy format.
+bool CollectArrays(vtkDataObject* data, std::vector<RoleAndArray>& arrays)
+{
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(data);
+  const int type = data ? data->GetDataObjectType() : -1;
+  if (!ds ||
+    (type != VTK_IMAGE_DATA && type != VTK_STRUCTURED_POINTS && type != VTK_RECTILINEAR_GRID &&
+      type != VTK_STRUCTURED_GRID && type != VTK_POLY_DATA && type != VTK_UNSTRUCTURED_GRID))
+  {
+    return false;
+  }
+  if (!AddAttributeArrays(ds->GetFieldData(), FIELD_DATA_ROLE, arrays) ||
+    !AddAttributeArrays(ds->GetPointData(), POINT_DATA_ROLE, arrays) ||
+    !AddAttributeArrays(ds->GetCellData(), CELL_DATA_ROLE, arrays))
+  {
+    return false;
+  }
+  if (auto ps = vtkPointSet::SafeDownCast(ds))
+  {
+    if (ps->GetPoints())
+    {
+      arrays.emplace_back(POINTS_ROLE, ps->GetPoints()->GetData());
+    }
+  }
+  if (auto rg = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    vtkDataArray* coordinates[3] = { rg->GetXCoordinates(), rg->GetYCoordinates(),
+      rg->GetZCoordinates() };
+    for (int i = 0; i < 3; i++)
+    {
+      if (coordinates[i])
+      {
+        arrays.emplace_back(X_COORDINATES_ROLE + i, coordinates[i]);
+      }
+    }
+  }
+  else if (auto pd = vtkPolyData::SafeDownCast(ds))
+  {
+    AddCellArray(pd->GetVerts(), 0, arrays);
+    AddCellArray(pd->GetLines(), 1, arrays);
+    AddCellArray(pd->GetPolys(), 2, arrays);
+    AddCellArray(pd->GetStrips(), 3, arrays);
+  }
+  else if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    if (ug->GetCellTypesArray())
+    {
+      arrays.emplace_back(CELL_TYPES_ROLE, ug->GetCellTypesArray());
+    }
+    if (ug->GetFaces() && ug->GetFaceLocations())
+    {
+      arrays.emplace_back(FACES_ROLE, ug->GetFaces());
+      arrays.emplace_back(FACE_LOCATIONS_ROLE, ug->GetFaceLocations());
+    }
+    AddCellArray(ug->GetCells(), 4, arrays);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int SendArrays(vtkCommunicator* comm, vtkDataObject* data,
+  const std::vector<RoleAndArray>& arrays, int remoteHandle, int tag)
+{
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(data);
+  vtkMultiProcessStream description;
+  description << static_cast<int>(ARRAYS_FORMAT) << static_cast<int>(arrays.size());
+  for (const RoleAndArray& item : arrays)
+  {
+    vtkDataArray* array = item.second;
+    int attributes = 0;
+    vtkDataSetAttributes* dsa = item.first == POINT_DATA_ROLE
+      ? static_cast<vtkDataSetAttributes*>(ds->GetPointData())
+      : (item.first == CELL_DATA_ROLE ? ds->GetCellData() : nullptr);
+    for (int i = 0; dsa && i < vtkDataSetAttributes::NUM_ATTRIBUTES; i++)
+    {
+      attributes |= dsa->GetAbstractAttribute(i) == array ? (1 << i) : 0;
+    }
+    const char* name = array->GetName();
+    description << item.first << attributes << array->GetDataType()
+                << array->GetNumberOfComponents()
+                << static_cast<vtkTypeInt64>(array->GetNumberOfTuples()) << (name != nullptr)
+                << std::string(name ? name : "") << array->HasAComponentName();
+    for (int i = 0; array->HasAComponentName() && i < array->GetNumberOfComponents(); i++)
+    {
+      const char* componentName = array->GetComponentName(i);
+      description << std::string(componentName ? componentName : "");
+    }
+  }
+
+  int extent[6] = { 0, -1, 0, -1, 0, -1 };
+  if (auto id = vtkImageData::SafeDownCast(ds))
+  {
+    id->GetExtent(extent);
+    const double* origin = id->GetOrigin();
+    const double* spacing = id->GetSpacing();
+    const double* direction = id->GetDirectionMatrix()->GetData();
+    for (int i = 0; i < 3; i++)
+    {
+      description << origin[i] << spacing[i];
+    }
+    for (int i = 0; i < 9; i++)
+    {
+      description << direction[i];
+    }
+  }
+  else if (auto rg = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    rg->GetExtent(extent);
+  }
+  else if (auto sg = vtkStructuredGrid::SafeDownCast(ds))
+  {
+    sg->GetExtent(extent);
+  }
+  for (int i = 0; i < 6; i++)
+  {
+    description << extent[i];
+  }
+
+  if (!comm->Send(description, remoteHandle, tag))
+  {
+    return 0;
+  }
+
+  // the buffers of arrays without the standard memory layout are copied,
+  // the others are sent from where they are
+  for (const RoleAndArray& item : arrays)
+  {
+    vtkDataArray* array = item.second;
+    vtkSmartPointer<vtkDataArray> copy;
+    if (!array->HasStandardMemoryLayout())
+    {
+      copy.TakeReference(vtkDataArray::CreateDataArray(array->GetDataType()));
+      copy->DeepCopy(array);
+      array = copy;
+    }
+    const vtkIdType size = array->GetNumberOfValues();
+    if (size > 0 &&
+      !comm->SendVoidArray(
+        array->GetVoidPointer(0), size, array->GetDataType(), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int ReceiveArrays(vtkCommunicator* comm, vtkDataObject* data, vtkMultiProcessStream& description,
+  int remoteHandle, int tag)
+{
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(data);
+  int numberOfArrays;
+  description >> numberOfArrays;
+  std::vector<std::pair<int, vtkSmartPointer<vtkDataArray>>> arrays;
+  std::vector<int> attributes;
+  for (int cc = 0; cc < numberOfArrays; cc++)
+  {
+    int role, attributeFlags, type, numComponents;
+    vtkTypeInt64 numTuples;
+    bool hasName, hasComponentNames;
+    std::string name;
+    description >> role >> attributeFlags >> type >> numComponents >> numTuples >> hasName >>
+      name >> hasComponentNames;
+    vtkSmartPointer<vtkDataArray> array;
+    array.TakeReference(vtkDataArray::CreateDataArray(type));
+    if (!array)
+    {
+      return 0;
+    }
+    array->SetNumberOfComponents(numComponents);
+    array->SetNumberOfTuples(numTuples);
+    if (hasName)
+    {
+      array->SetName(name.c_str());
+    }
+    for (int i = 0; hasComponentNames && i < numComponents; i++)
+    {
+      std::string componentName;
+      description >> componentName;
+      array->SetComponentName(i, componentName.c_str());
+    }
+    arrays.emplace_back(role, array);
+    attributes.push_back(attributeFlags);
+  }
+
+  double values[15] = { 0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
+  if (vtkImageData::SafeDownCast(ds))
+  {
+    for (int i = 0; i < 15; i++)
+    {
+      description >> values[i];
+    }
+  }
+  int extent[6];
+  for (int i = 0; i < 6; i++)
+  {
+    description >> extent[i];
+  }
+
+  for (const auto& item : arrays)
+  {
+    vtkDataArray* array = item.second;
+    const vtkIdType size = array->GetNumberOfValues();
+    if (size > 0 &&
+      !comm->ReceiveVoidArray(
+        array->GetVoidPointer(0), size, array->GetDataType(), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+
+  ds->Initialize();
+  if (auto id = vtkImageData::SafeDownCast(ds))
+  {
+    id->SetExtent(extent);
+    id->SetOrigin(values[0], values[2], values[4]);
+    id->SetSpacing(values[1], values[3], values[5]);
+    id->SetDirectionMatrix(values + 6);
+  }
+  else if (auto rg = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    rg->SetExtent(extent);
+  }
+  else if (auto sg = vtkStructuredGrid::SafeDownCast(ds))
+  {
+    sg->SetExtent(extent);
+  }
+
+  vtkSmartPointer<vtkDataArray> cellArrays[10];
+  vtkUnsignedCharArray* cellTypes = nullptr;
+  vtkIdTypeArray* faces = nullptr;
+  vtkIdTypeArray* faceLocations = nullptr;
+  for (std::size_t cc = 0; cc < arrays.size(); cc++)
+  {
+    const int role = arrays[cc].first;
+    vtkDataArray* array = arrays[cc].second;
+    switch (role)
+    {
+      case FIELD_DATA_ROLE:
+        ds->GetFieldData()->AddArray(array);
+        break;
+      case POINT_DATA_ROLE:
+      case CELL_DATA_ROLE:
+      {
+        vtkDataSetAttributes* dsa = role == POINT_DATA_ROLE
+          ? static_cast<vtkDataSetAttributes*>(ds->GetPointData())
+          : ds->GetCellData();
+        const int index = dsa->AddArray(array);
+        for (int i = 0; i < vtkDataSetAttributes::NUM_ATTRIBUTES; i++)
+        {
+          if (attributes[cc] & (1 << i))
+          {
+            dsa->SetActiveAttribute(index, i);
+          }
+        }
+        break;
+      }
+      case POINTS_ROLE:
+        if (auto ps = vtkPointSet::SafeDownCast(ds))
+        {
+          vtkNew<vtkPoints> points;
+          points->SetData(array);
+          ps->SetPoints(points);
+        }
+        break;
+      case X_COORDINATES_ROLE:
+      case Y_COORDINATES_ROLE:
+      case Z_COORDINATES_ROLE:
+        if (auto rg = vtkRectilinearGrid::SafeDownCast(ds))
+        {
+          if (role == X_COORDINATES_ROLE)
+          {
+            rg->SetXCoordinates(array);
+          }
+          else if (role == Y_COORDINATES_ROLE)
+          {
+            rg->SetYCoordinates(array);
+          }
+          else
+          {
+            rg->SetZCoordinates(array);
+          }
+        }
+        break;
+      case CELL_TYPES_ROLE:
+        cellTypes = vtkUnsignedCharArray::SafeDownCast(array);
+        break;
+      case FACES_ROLE:
+        faces = vtkIdTypeArray::SafeDownCast(array);
+        break;
+      case FACE_LOCATIONS_ROLE:
+        faceLocations = vtkIdTypeArray::SafeDownCast(array);
+        break;
+      default:
+        if (role >= CELL_ARRAYS_ROLE && role < CELL_ARRAYS_ROLE + 10)
+        {
+          cellArrays[role - CELL_ARRAYS_ROLE] = array;
+        }
+        break;
+    }
+  }
+
+  vtkSmartPointer<vtkCellArray> cells[5];
+  for (int i = 0; i < 5; i++)
+  {
+    cells[i] = vtkSmartPointer<vtkCellArray>::New();
+    if (cellArrays[2 * i] && cellArrays[2 * i + 1] &&
+      !cells[i]->SetData(cellArrays[2 * i], cellArrays[2 * i + 1]))
+    {
+      return 0;
+    }
+  }
+  if (auto pd = vtkPolyData::SafeDownCast(ds))
+  {
+    pd->SetVerts(cells[0]);
+    pd->SetLines(cells[1]);
+    pd->SetPolys(cells[2]);
+    pd->SetStrips(cells[3]);
+  }
+  else if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    if (cellTypes)
+    {
+      ug->SetCells(cellTypes, cells[4], faceLocations, faces);
+    }
+  }
+  return 1;
+}
+}
+
 //=============================================================================
 vtkCommunicator::vtkCommunicator()
 {
@@ -213,10 +610,18 @@ int vtkCommunicator::Send(vtkDataObject* data, int remoteHandle, int tag)
 //------------------------------------------------------------------------------
 int vtkCommunicator::SendElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  std::vector<RoleAndArray> arrays;
+  if (::CollectArrays(data, arrays))
+  {
+    return ::SendArrays(this, data, arrays, remoteHandle, tag);
+  }
+
+  vtkMultiProcessStream description;
+  description << static_cast<int>(LEGACY_FORMAT);
   VTK_CREATE(vtkCharArray, buffer);
   if (vtkCommunicator::MarshalDataObject(data, buffer))
   {
-    return this->Send(buffer, remoteHandle, tag);
+    return this->Send(description, remoteHandle, tag) && this->Send(buffer, remoteHandle, tag);
   }
 
   // could not marshal data
@@ -408,6 +813,18 @@ int vtkCommunicator::ReceiveDataObject(vtkDataObject* data, int remoteHandle, in
 //------------------------------------------------------------------------------
 int vtkCommunicator::ReceiveElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  vtkMultiProcessStream description;
+  int format = -1;
+  if (!this->Receive(description, remoteHandle, tag))
+  {
+    return 0;
+  }
+  description >> format;
+  if (format == ARRAYS_FORMAT)
+  {
+    return ::ReceiveArrays(this, data, description, remoteHandle, tag);
+  }
+
   VTK_CREATE(vtkCharArray, buffer);
   if (!this->Receive(buffer, remoteHandle, tag))
   {
@@ -1660,6 +2077,101 @@ int vtkCommunicator::AllReduceVoidArray(
   return 0;
 }
 
+//------------------------------------------------------------------------------
+bool vtkCommunicator::CollectiveRequest::Test()
+{
+  if (this->Impl && this->Impl->Test())
+  {
+    this->Impl.reset();
+  }
+  return !this->Impl;
+}
+
+//------------------------------------------------------------------------------
+void vtkCommunicator::CollectiveRequest::Wait()
+{
+  if (this->Impl)
+  {
+    this->Impl->Wait();
+    this->Impl.reset();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCommunicator::WaitAll(std::vector<CollectiveRequest>& requests)
+{
+  for (CollectiveRequest& request : requests)
+  {
+    request.Wait();
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::NoBlockAllReduceVoidArray(const void* sendBuffer, void* recvBuffer,
+  vtkIdType length, int type, int operation, CollectiveRequest& request)
+{
+  request.Impl.reset();
+  return this->AllReduceVoidArray(sendBuffer, recvBuffer, length, type, operation);
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::NoBlockBroadcastVoidArray(
+  void* data, vtkIdType length, int type, int srcProcessId, CollectiveRequest& request)
+{
+  request.Impl.reset();
+  return this->BroadcastVoidArray(data, length, type, srcProcessId);
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::NoBlockGatherVVoidArray(const void* sendBuffer, void* recvBuffer,
+  vtkIdType sendLength, vtkIdType* recvLengths, vtkIdType* offsets, int type, int destProcessId,
+  CollectiveRequest& request)
+{
+  request.Impl.reset();
+  return this->GatherVVoidArray(
+    sendBuffer, recvBuffer, sendLength, recvLengths, offsets, type, destProcessId);
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::NoBlockAllToAllVVoidArray(const void* sendBuffer, vtkIdType* sendLengths,
+  vtkIdType* sendOffsets, void* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+  int type, CollectiveRequest& request)
+{
+  request.Impl.reset();
+  int typeSize = 1;
+  switch (type)
+  {
+    vtkTemplateMacro(typeSize = sizeof(VTK_TT));
+  }
+  const char* src = reinterpret_cast<const char*>(sendBuffer);
+  char* dest = reinterpret_cast<char*>(recvBuffer);
+  const int rank = this->LocalProcessId;
+  memmove(dest + recvOffsets[rank] * typeSize, src + sendOffsets[rank] * typeSize,
+    recvLengths[rank] * typeSize);
+
+  // Every pair of processes exchanges in the order of the processes, the
+  // lower one sending first, so that blocking sends cannot deadlock.
+  int result = 1;
+  for (int i = 0; i < this->NumberOfProcesses; i++)
+  {
+    if (i < rank)
+    {
+      result &= this->ReceiveVoidArray(
+        dest + recvOffsets[i] * typeSize, recvLengths[i], type, i, ALLTOALLV_TAG);
+      result &= this->SendVoidArray(
+        src + sendOffsets[i] * typeSize, sendLengths[i], type, i, ALLTOALLV_TAG);
+    }
+    else if (i > rank)
+    {
+      result &= this->SendVoidArray(
+        src + sendOffsets[i] * typeSize, sendLengths[i], type, i, ALLTOALLV_TAG);
+      result &= this->ReceiveVoidArray(
+        dest + recvOffsets[i] * typeSize, recvLengths[i], type, i, ALLTOALLV_TAG);
+    }
+  }
+  return result;
+}
+
 //------------------------------------------------------------------------------
 int vtkCommunicator::AllReduce(vtkDataArray* sendBuffer, vtkDataArray* recvBuffer, int operation)
 {
@@ -35,6 +35,7 @@
 #include "vtkObject.h"
 #include "vtkParallelCoreModule.h" // For export macro
 #include "vtkSmartPointer.h"       // needed for vtkSmartPointer.
+#include <memory>                  // needed for std::shared_ptr
 #include <vector>                  // needed for std::vector
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -80,7 +81,8 @@ public:
     SCATTER_TAG = 13,
     SCATTERV_TAG = 14,
     REDUCE_TAG = 15,
-    BARRIER_TAG = 16
+    BARRIER_TAG = 16,
+    ALLTOALLV_TAG = 17
   };
 
   enum StandardOperations
@@ -1221,6 +1223,245 @@ public:
   int AllReduce(vtkDataArray* sendBuffer, vtkDataArray* recvBuffer, Operation* operation);
   ///@}
 
+  /**
+   * A handle on a nonblocking collective operation started by one of the
+   * NoBlock collectives below. The buffers given to the operation must not be
+   * used until Wait() returns or Test() returns true. A default constructed
+   * request is complete, and so are the requests of communicators without
+   * nonblocking collectives, which perform the blocking operation instead.
+   */
+  class VTKPARALLELCORE_EXPORT CollectiveRequest
+  {
+  public:
+    /**
+     * State of an operation in progress, implemented by the communicators
+     * with nonblocking collectives.
+     */
+    class Implementation
+    {
+    public:
+      virtual ~Implementation() = default;
+      virtual bool Test() = 0;
+      virtual void Wait() = 0;
+    };
+
+    /**
+     * Returns true if the operation completed, without blocking.
+     */
+    bool Test();
+
+    /**
+     * Blocks until the operation completes.
+     */
+    void Wait();
+
+    std::shared_ptr<Implementation> Impl;
+  };
+
+  /**
+   * Blocks until all the requests complete.
+   */
+  static void WaitAll(std::vector<CollectiveRequest>& requests);
+
+  ///@{
+  /**
+   * Nonblocking versions of AllReduce, Broadcast and GatherV. They return as
+   * soon as the operation is started and request completes when it is done,
+   * so that several reductions can be batched or overlap local work. Every
+   * process must start the same collectives in the same order.
+   */
+  int NoBlockAllReduce(const int* sendBuffer, int* recvBuffer, vtkIdType length, int operation,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_INT, operation,
+      request);
+  }
+  int NoBlockAllReduce(const long* sendBuffer, long* recvBuffer, vtkIdType length, int operation,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_LONG, operation,
+      request);
+  }
+  int NoBlockAllReduce(const unsigned long* sendBuffer, unsigned long* recvBuffer, vtkIdType length,
+    int operation, CollectiveRequest& request)
+  {
+    return this->NoBlockAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_UNSIGNED_LONG,
+      operation, request);
+  }
+  int NoBlockAllReduce(const float* sendBuffer, float* recvBuffer, vtkIdType length, int operation,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_FLOAT, operation,
+      request);
+  }
+  int NoBlockAllReduce(const double* sendBuffer, double* recvBuffer, vtkIdType length,
+    int operation, CollectiveRequest& request)
+  {
+    return this->NoBlockAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_DOUBLE, operation,
+      request);
+  }
+  int NoBlockAllReduce(const long long* sendBuffer, long long* recvBuffer, vtkIdType length,
+    int operation, CollectiveRequest& request)
+  {
+    return this->NoBlockAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_LONG_LONG, operation,
+      request);
+  }
+  int NoBlockAllReduce(const unsigned long long* sendBuffer, unsigned long long* recvBuffer,
+    vtkIdType length, int operation, CollectiveRequest& request)
+  {
+    return this->NoBlockAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_UNSIGNED_LONG_LONG,
+      operation, request);
+  }
+  int NoBlockBroadcast(int* data, vtkIdType length, int srcProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockBroadcastVoidArray(data, length, VTK_INT, srcProcessId, request);
+  }
+  int NoBlockBroadcast(long* data, vtkIdType length, int srcProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockBroadcastVoidArray(data, length, VTK_LONG, srcProcessId, request);
+  }
+  int NoBlockBroadcast(unsigned long* data, vtkIdType length, int srcProcessId,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockBroadcastVoidArray(data, length, VTK_UNSIGNED_LONG, srcProcessId, request);
+  }
+  int NoBlockBroadcast(float* data, vtkIdType length, int srcProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockBroadcastVoidArray(data, length, VTK_FLOAT, srcProcessId, request);
+  }
+  int NoBlockBroadcast(double* data, vtkIdType length, int srcProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockBroadcastVoidArray(data, length, VTK_DOUBLE, srcProcessId, request);
+  }
+  int NoBlockBroadcast(long long* data, vtkIdType length, int srcProcessId,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockBroadcastVoidArray(data, length, VTK_LONG_LONG, srcProcessId, request);
+  }
+  int NoBlockBroadcast(unsigned long long* data, vtkIdType length, int srcProcessId,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockBroadcastVoidArray(data, length, VTK_UNSIGNED_LONG_LONG, srcProcessId,
+      request);
+  }
+  int NoBlockGatherV(const int* sendBuffer, int* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockGatherVVoidArray(sendBuffer, recvBuffer, sendLength, recvLengths, offsets,
+      VTK_INT, destProcessId, request);
+  }
+  int NoBlockGatherV(const long* sendBuffer, long* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockGatherVVoidArray(sendBuffer, recvBuffer, sendLength, recvLengths, offsets,
+      VTK_LONG, destProcessId, request);
+  }
+  int NoBlockGatherV(const unsigned long* sendBuffer, unsigned long* recvBuffer,
+    vtkIdType sendLength, vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockGatherVVoidArray(sendBuffer, recvBuffer, sendLength, recvLengths, offsets,
+      VTK_UNSIGNED_LONG, destProcessId, request);
+  }
+  int NoBlockGatherV(const float* sendBuffer, float* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockGatherVVoidArray(sendBuffer, recvBuffer, sendLength, recvLengths, offsets,
+      VTK_FLOAT, destProcessId, request);
+  }
+  int NoBlockGatherV(const double* sendBuffer, double* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockGatherVVoidArray(sendBuffer, recvBuffer, sendLength, recvLengths, offsets,
+      VTK_DOUBLE, destProcessId, request);
+  }
+  int NoBlockGatherV(const long long* sendBuffer, long long* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId, CollectiveRequest& request)
+  {
+    return this->NoBlockGatherVVoidArray(sendBuffer, recvBuffer, sendLength, recvLengths, offsets,
+      VTK_LONG_LONG, destProcessId, request);
+  }
+  int NoBlockGatherV(const unsigned long long* sendBuffer, unsigned long long* recvBuffer,
+    vtkIdType sendLength, vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockGatherVVoidArray(sendBuffer, recvBuffer, sendLength, recvLengths, offsets,
+      VTK_UNSIGNED_LONG_LONG, destProcessId, request);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * Nonblocking personalized exchange: each process sends sendLengths[i]
+   * values from sendBuffer + sendOffsets[i] to process i, and receives
+   * recvLengths[i] values from process i in recvBuffer + recvOffsets[i].
+   */
+  int NoBlockAllToAllV(const int* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    int* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets, CollectiveRequest& request)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, VTK_INT, request);
+  }
+  int NoBlockAllToAllV(const long* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    long* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets, CollectiveRequest& request)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, VTK_LONG, request);
+  }
+  int NoBlockAllToAllV(const unsigned long* sendBuffer, vtkIdType* sendLengths,
+    vtkIdType* sendOffsets, unsigned long* recvBuffer, vtkIdType* recvLengths,
+    vtkIdType* recvOffsets, CollectiveRequest& request)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, VTK_UNSIGNED_LONG, request);
+  }
+  int NoBlockAllToAllV(const float* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    float* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets, CollectiveRequest& request)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, VTK_FLOAT, request);
+  }
+  int NoBlockAllToAllV(const double* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    double* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets, CollectiveRequest& request)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, VTK_DOUBLE, request);
+  }
+  int NoBlockAllToAllV(const long long* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    long long* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    CollectiveRequest& request)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, VTK_LONG_LONG, request);
+  }
+  int NoBlockAllToAllV(const unsigned long long* sendBuffer, vtkIdType* sendLengths,
+    vtkIdType* sendOffsets, unsigned long long* recvBuffer, vtkIdType* recvLengths,
+    vtkIdType* recvOffsets, CollectiveRequest& request)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, VTK_UNSIGNED_LONG_LONG, request);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * Subclasses with nonblocking collectives should reimplement these. The
+   * default implementations perform the blocking operations, or pairwise
+   * sends and receives for NoBlockAllToAllVVoidArray, and leave the request
+   * complete.
+   */
+  virtual int NoBlockAllReduceVoidArray(const void* sendBuffer, void* recvBuffer, vtkIdType length,
+    int type, int operation, CollectiveRequest& request);
+  virtual int NoBlockBroadcastVoidArray(
+    void* data, vtkIdType length, int type, int srcProcessId, CollectiveRequest& request);
+  virtual int NoBlockGatherVVoidArray(const void* sendBuffer, void* recvBuffer,
+    vtkIdType sendLength, vtkIdType* recvLengths, vtkIdType* offsets, int type, int destProcessId,
+    CollectiveRequest& request);
+  virtual int NoBlockAllToAllVVoidArray(const void* sendBuffer, vtkIdType* sendLengths,
+    vtkIdType* sendOffsets, void* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    int type, CollectiveRequest& request);
+  ///@}
+
   ///@{
   /**
    * Subclasses should reimplement these if they have a more efficient
@@ -1393,6 +1393,191 @@ public:
     return this->Communicator->AllReduce(sendBuffer, recvBuffer, operation);
   }
 
+  ///@{
+  /**
+   * Nonblocking versions of AllReduce, Broadcast and GatherV. They return as
+   * soon as the operation is started and request completes when it is done,
+   * so that several reductions can be batched or overlap local work. Every
+   * process must start the same collectives in the same order.
+   */
+  int NoBlockAllReduce(const int* sendBuffer, int* recvBuffer, vtkIdType length, int operation,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation, request);
+  }
+  int NoBlockAllReduce(const long* sendBuffer, long* recvBuffer, vtkIdType length, int operation,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation, request);
+  }
+  int NoBlockAllReduce(const unsigned long* sendBuffer, unsigned long* recvBuffer, vtkIdType length,
+    int operation, vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation, request);
+  }
+  int NoBlockAllReduce(const float* sendBuffer, float* recvBuffer, vtkIdType length, int operation,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation, request);
+  }
+  int NoBlockAllReduce(const double* sendBuffer, double* recvBuffer, vtkIdType length,
+    int operation, vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation, request);
+  }
+  int NoBlockAllReduce(const long long* sendBuffer, long long* recvBuffer, vtkIdType length,
+    int operation, vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation, request);
+  }
+  int NoBlockAllReduce(const unsigned long long* sendBuffer, unsigned long long* recvBuffer,
+    vtkIdType length, int operation, vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation, request);
+  }
+  int NoBlockBroadcast(int* data, vtkIdType length, int srcProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockBroadcast(data, length, srcProcessId, request);
+  }
+  int NoBlockBroadcast(long* data, vtkIdType length, int srcProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockBroadcast(data, length, srcProcessId, request);
+  }
+  int NoBlockBroadcast(unsigned long* data, vtkIdType length, int srcProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockBroadcast(data, length, srcProcessId, request);
+  }
+  int NoBlockBroadcast(float* data, vtkIdType length, int srcProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockBroadcast(data, length, srcProcessId, request);
+  }
+  int NoBlockBroadcast(double* data, vtkIdType length, int srcProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockBroadcast(data, length, srcProcessId, request);
+  }
+  int NoBlockBroadcast(long long* data, vtkIdType length, int srcProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockBroadcast(data, length, srcProcessId, request);
+  }
+  int NoBlockBroadcast(unsigned long long* data, vtkIdType length, int srcProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockBroadcast(data, length, srcProcessId, request);
+  }
+  int NoBlockGatherV(const int* sendBuffer, int* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockGatherV(sendBuffer, recvBuffer, sendLength, recvLengths,
+      offsets, destProcessId, request);
+  }
+  int NoBlockGatherV(const long* sendBuffer, long* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockGatherV(sendBuffer, recvBuffer, sendLength, recvLengths,
+      offsets, destProcessId, request);
+  }
+  int NoBlockGatherV(const unsigned long* sendBuffer, unsigned long* recvBuffer,
+    vtkIdType sendLength, vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockGatherV(sendBuffer, recvBuffer, sendLength, recvLengths,
+      offsets, destProcessId, request);
+  }
+  int NoBlockGatherV(const float* sendBuffer, float* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockGatherV(sendBuffer, recvBuffer, sendLength, recvLengths,
+      offsets, destProcessId, request);
+  }
+  int NoBlockGatherV(const double* sendBuffer, double* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockGatherV(sendBuffer, recvBuffer, sendLength, recvLengths,
+      offsets, destProcessId, request);
+  }
+  int NoBlockGatherV(const long long* sendBuffer, long long* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockGatherV(sendBuffer, recvBuffer, sendLength, recvLengths,
+      offsets, destProcessId, request);
+  }
+  int NoBlockGatherV(const unsigned long long* sendBuffer, unsigned long long* recvBuffer,
+    vtkIdType sendLength, vtkIdType* recvLengths, vtkIdType* offsets, int destProcessId,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockGatherV(sendBuffer, recvBuffer, sendLength, recvLengths,
+      offsets, destProcessId, request);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * Nonblocking personalized exchange: each process sends sendLengths[i]
+   * values from sendBuffer + sendOffsets[i] to process i, and receives
+   * recvLengths[i] values from process i in recvBuffer + recvOffsets[i].
+   */
+  int NoBlockAllToAllV(const int* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    int* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllToAllV(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, request);
+  }
+  int NoBlockAllToAllV(const long* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    long* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllToAllV(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, request);
+  }
+  int NoBlockAllToAllV(const unsigned long* sendBuffer, vtkIdType* sendLengths,
+    vtkIdType* sendOffsets, unsigned long* recvBuffer, vtkIdType* recvLengths,
+    vtkIdType* recvOffsets, vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllToAllV(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, request);
+  }
+  int NoBlockAllToAllV(const float* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    float* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllToAllV(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, request);
+  }
+  int NoBlockAllToAllV(const double* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    double* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllToAllV(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, request);
+  }
+  int NoBlockAllToAllV(const long long* sendBuffer, vtkIdType* sendLengths, vtkIdType* sendOffsets,
+    long long* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllToAllV(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, request);
+  }
+  int NoBlockAllToAllV(const unsigned long long* sendBuffer, vtkIdType* sendLengths,
+    vtkIdType* sendOffsets, unsigned long long* recvBuffer, vtkIdType* recvLengths,
+    vtkIdType* recvOffsets, vtkCommunicator::CollectiveRequest& request)
+  {
+    return this->Communicator->NoBlockAllToAllV(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, request);
+  }
+  ///@}
+
   ///@{
   /**
    * Convenience methods to reduce bounds.
@@ -14,6 +14,7 @@
 =========================================================================*/
 
 #include "vtkThreadedCallbackQueue.h"
+#include "vtkMultiThreader.h"
 #include "vtkObjectFactory.h"
 
 #include <algorithm>
@@ -129,6 +130,7 @@ vtkThreadedCallbackQueue::~vtkThreadedCallbackQueue()
 //-----------------------------------------------------------------------------
 void vtkThreadedCallbackQueue::SetNumberOfThreads(int numberOfThreads)
 {
+  numberOfThreads = vtkMultiThreader::LimitToGlobalMaximumNumberOfThreads(numberOfThreads);
   this->PushControl([this, numberOfThreads]() {
     int size = static_cast<int>(this->Threads.size());
 
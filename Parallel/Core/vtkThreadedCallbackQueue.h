@@ -316,6 +316,7 @@ public:
 
   /**
    * Sets the number of threads. The running state of the queue is not impacted by this method.
+   * The number of threads is limited by `vtkMultiThreader::GetGlobalMaximumNumberOfThreads()`.
    *
    * This method is executed by the `Controller` on a different thread, so this method may terminate
    * before the threads were allocated. Nevertheless, this method is thread-safe. Other calls to
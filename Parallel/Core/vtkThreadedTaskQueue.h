@@ -37,7 +37,9 @@
  *
  * `max_concurrent_tasks` controls how many threads are used to process tasks in
  * the queue. Default is same as
- * `vtkMultiThreader::GetGlobalDefaultNumberOfThreads()`.
+ * `vtkMultiThreader::GetGlobalDefaultNumberOfThreads()`. In both cases, the
+ * number of threads is limited by
+ * `vtkMultiThreader::GetGlobalMaximumNumberOfThreads()`.
  *
  * `buffer_size` indicates how many tasks may be queued for processing. Default
  * is infinite size. If a positive number is provided, then pushing additional
@@ -182,8 +182,9 @@ vtkThreadedTaskQueue<R, Args...>::vtkThreadedTaskQueue(
   , Tasks(new vtkThreadedTaskQueueInternals::TaskQueue<R>(
       std::max(0, strict_ordering ? 0 : buffer_size)))
   , Results(new vtkThreadedTaskQueueInternals::ResultQueue<R>(strict_ordering))
-  , NumberOfThreads(max_concurrent_tasks <= 0 ? vtkMultiThreader::GetGlobalDefaultNumberOfThreads()
-                                              : max_concurrent_tasks)
+  , NumberOfThreads(vtkMultiThreader::LimitToGlobalMaximumNumberOfThreads(max_concurrent_tasks <= 0
+        ? vtkMultiThreader::GetGlobalDefaultNumberOfThreads()
+        : max_concurrent_tasks))
   , Threads{ new std::thread[this->NumberOfThreads] }
 {
   auto f = [this](int thread_id) {
@@ -278,8 +279,9 @@ vtkThreadedTaskQueue<void, Args...>::vtkThreadedTaskQueue(std::function<void(Arg
   , Tasks(new vtkThreadedTaskQueueInternals::TaskQueue<void>(
       std::max(0, strict_ordering ? 0 : buffer_size)))
   , NextResultId(0)
-  , NumberOfThreads(max_concurrent_tasks <= 0 ? vtkMultiThreader::GetGlobalDefaultNumberOfThreads()
-                                              : max_concurrent_tasks)
+  , NumberOfThreads(vtkMultiThreader::LimitToGlobalMaximumNumberOfThreads(max_concurrent_tasks <= 0
+        ? vtkMultiThreader::GetGlobalDefaultNumberOfThreads()
+        : max_concurrent_tasks))
   , Threads{ new std::thread[this->NumberOfThreads] }
 {
   auto f = [this](int thread_id) {
@@ -41,6 +41,7 @@
 #include "vtkTypeTraits.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedLongArray.h"
+#include "vtkUnstructuredGrid.h"
 
 #include <string.h>
 #include <time.h>
@@ -361,6 +362,17 @@ static int CompareDataObjects(vtkDataObject* obj1, vtkDataObject* obj2)
         return 0;
       }
     }
+
+    vtkUnstructuredGrid* ug1 = vtkUnstructuredGrid::SafeDownCast(ps1);
+    vtkUnstructuredGrid* ug2 = vtkUnstructuredGrid::SafeDownCast(ps2);
+    if (ug1 && ug2)
+    {
+      if (!CompareDataArrays(ug1->GetCellTypesArray(), ug2->GetCellTypesArray()) ||
+        !compareCellArrays(ug1->GetCells(), ug2->GetCells()))
+      {
+        return 0;
+      }
+    }
   }
 
   return 1;
@@ -1174,6 +1186,12 @@ static void Run(vtkMultiProcessController* controller, void* _args)
     polySource->Update();
     ExerciseDataObject(controller, polySource->GetOutput(), vtkSmartPointer<vtkPolyData>::New());
 
+    vtkNew<vtkUnstructuredGrid> ugrid;
+    ugrid->SetPoints(polySource->GetOutput()->GetPoints());
+    ugrid->SetCells(VTK_TRIANGLE, polySource->GetOutput()->GetPolys());
+    ugrid->GetPointData()->ShallowCopy(polySource->GetOutput()->GetPointData());
+    ExerciseDataObject(controller, ugrid, vtkSmartPointer<vtkUnstructuredGrid>::New());
+
     vtkNew<vtkPartitionedDataSetCollectionSource> pdcSource;
     pdcSource->SetNumberOfShapes(12);
     pdcSource->Update();
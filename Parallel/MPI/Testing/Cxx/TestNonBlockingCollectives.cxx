@@ -0,0 +1,110 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestNonBlockingCollectives.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Starts a nonblocking all-reduce, broadcast, gather and all-to-all at once,
+// waits for all of them and checks their results.
+
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+int TestNonBlockingCollectives(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv, 0);
+  const int rank = controller->GetLocalProcessId();
+  const int size = controller->GetNumberOfProcesses();
+
+  std::vector<vtkCommunicator::CollectiveRequest> requests(4);
+
+  const double local[2] = { rank + 1.0, 1.0 };
+  double sum[2] = { 0.0, 0.0 };
+  controller->NoBlockAllReduce(local, sum, 2, vtkCommunicator::SUM_OP, requests[0]);
+
+  int value = rank == 0 ? 42 : 0;
+  controller->NoBlockBroadcast(&value, 1, 0, requests[1]);
+
+  // rank r sends r + 1 copies of r to the root
+  std::vector<long long> gatherSend(rank + 1, rank);
+  std::vector<vtkIdType> gatherLengths(size), gatherOffsets(size);
+  for (int i = 0; i < size; ++i)
+  {
+    gatherLengths[i] = i + 1;
+    gatherOffsets[i] = i * (i + 1) / 2;
+  }
+  std::vector<long long> gathered(size * (size + 1) / 2, -1);
+  controller->NoBlockGatherV(gatherSend.data(), gathered.data(), rank + 1, gatherLengths.data(),
+    gatherOffsets.data(), 0, requests[2]);
+
+  // rank r sends i + 1 values 100 * r + i to rank i
+  std::vector<vtkIdType> sendLengths(size), sendOffsets(size), recvLengths(size),
+    recvOffsets(size);
+  std::vector<int> sendValues;
+  for (int i = 0; i < size; ++i)
+  {
+    sendLengths[i] = i + 1;
+    sendOffsets[i] = static_cast<vtkIdType>(sendValues.size());
+    sendValues.insert(sendValues.end(), i + 1, 100 * rank + i);
+    recvLengths[i] = rank + 1;
+    recvOffsets[i] = i * (rank + 1);
+  }
+  std::vector<int> recvValues(size * (rank + 1), -1);
+  controller->NoBlockAllToAllV(sendValues.data(), sendLengths.data(), sendOffsets.data(),
+    recvValues.data(), recvLengths.data(), recvOffsets.data(), requests[3]);
+
+  vtkCommunicator::WaitAll(requests);
+
+  bool success = true;
+  if (sum[0] != size * (size + 1) / 2.0 || sum[1] != size)
+  {
+    std::cerr << "Wrong all-reduce on rank " << rank << std::endl;
+    success = false;
+  }
+  if (value != 42)
+  {
+    std::cerr << "Wrong broadcast on rank " << rank << std::endl;
+    success = false;
+  }
+  for (int i = 0; rank == 0 && i < size; ++i)
+  {
+    for (vtkIdType j = 0; j < gatherLengths[i]; ++j)
+    {
+      if (gathered[gatherOffsets[i] + j] != i)
+      {
+        std::cerr << "Wrong gather from rank " << i << std::endl;
+        success = false;
+      }
+    }
+  }
+  for (int i = 0; i < size; ++i)
+  {
+    for (int j = 0; j <= rank; ++j)
+    {
+      if (recvValues[recvOffsets[i] + j] != 100 * i + rank)
+      {
+        std::cerr << "Wrong all-to-all from rank " << i << " on rank " << rank << std::endl;
+        success = false;
+      }
+    }
+  }
+
+  int localSuccess = success ? 1 : 0;
+  int globalSuccess = 0;
+  controller->AllReduce(&localSuccess, &globalSuccess, 1, vtkCommunicator::MIN_OP);
+  controller->Finalize();
+  return globalSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
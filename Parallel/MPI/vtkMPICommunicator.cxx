@@ -26,6 +26,7 @@
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <cassert>
+#include <memory>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -1413,6 +1414,207 @@ int vtkMPICommunicator::AllReduceVoidArray(
   return res;
 }
 
+#if MPI_VERSION >= 3
+//------------------------------------------------------------------------------
+// State of a nonblocking collective, with the counts and displacements MPI
+// reads until the operation completes.
+class vtkMPICommunicatorCollectiveRequest
+  : public vtkCommunicator::CollectiveRequest::Implementation
+{
+public:
+  ~vtkMPICommunicatorCollectiveRequest() override { this->Wait(); }
+
+  bool Test() override
+  {
+    int flag = 0;
+    MPI_Test(&this->Handle, &flag, MPI_STATUS_IGNORE);
+    return flag != 0;
+  }
+
+  void Wait() override { MPI_Wait(&this->Handle, MPI_STATUS_IGNORE); }
+
+  MPI_Request Handle = MPI_REQUEST_NULL;
+  std::vector<int> Counts[4];
+};
+
+//------------------------------------------------------------------------------
+inline bool vtkMPICommunicatorToMPICounts(
+  const vtkIdType* lengths, const vtkIdType* offsets, int numProc, std::vector<int>& mpiLengths,
+  std::vector<int>& mpiOffsets)
+{
+  mpiLengths.resize(numProc);
+  mpiOffsets.resize(numProc);
+  for (int i = 0; i < numProc; i++)
+  {
+    if (!vtkMPICommunicatorCheckSize(lengths[i] + offsets[i]))
+    {
+      return false;
+    }
+    mpiLengths[i] = static_cast<int>(lengths[i]);
+    mpiOffsets[i] = static_cast<int>(offsets[i]);
+  }
+  return true;
+}
+#endif
+
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::NoBlockAllReduceVoidArray(const void* sendBuffer, void* recvBuffer,
+  vtkIdType length, int type, int operation, CollectiveRequest& request)
+{
+#if MPI_VERSION >= 3
+  vtkMPICommunicatorDebugBarrier(this->MPIComm->Handle);
+  request.Impl.reset();
+  if (!vtkMPICommunicatorCheckSize(length))
+  {
+    return 0;
+  }
+  MPI_Op mpiOp;
+  switch (operation)
+  {
+    case MAX_OP:
+      mpiOp = MPI_MAX;
+      break;
+    case MIN_OP:
+      mpiOp = MPI_MIN;
+      break;
+    case SUM_OP:
+      mpiOp = MPI_SUM;
+      break;
+    case PRODUCT_OP:
+      mpiOp = MPI_PROD;
+      break;
+    case LOGICAL_AND_OP:
+      mpiOp = MPI_LAND;
+      break;
+    case BITWISE_AND_OP:
+      mpiOp = MPI_BAND;
+      break;
+    case LOGICAL_OR_OP:
+      mpiOp = MPI_LOR;
+      break;
+    case BITWISE_OR_OP:
+      mpiOp = MPI_BOR;
+      break;
+    case LOGICAL_XOR_OP:
+      mpiOp = MPI_LXOR;
+      break;
+    case BITWISE_XOR_OP:
+      mpiOp = MPI_BXOR;
+      break;
+    default:
+      vtkWarningMacro(<< "Operation number " << operation << " not supported.");
+      return 0;
+  }
+  auto impl = std::make_shared<vtkMPICommunicatorCollectiveRequest>();
+  int res = CheckForMPIError(MPI_Iallreduce(const_cast<void*>(sendBuffer), recvBuffer,
+    static_cast<int>(length), vtkMPICommunicatorGetMPIType(type), mpiOp, *this->MPIComm->Handle,
+    &impl->Handle));
+  if (res)
+  {
+    request.Impl = impl;
+  }
+  return res;
+#else
+  return this->Superclass::NoBlockAllReduceVoidArray(
+    sendBuffer, recvBuffer, length, type, operation, request);
+#endif
+}
+
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::NoBlockBroadcastVoidArray(
+  void* data, vtkIdType length, int type, int srcProcessId, CollectiveRequest& request)
+{
+#if MPI_VERSION >= 3
+  vtkMPICommunicatorDebugBarrier(this->MPIComm->Handle);
+  request.Impl.reset();
+  if (!vtkMPICommunicatorCheckSize(length))
+  {
+    return 0;
+  }
+  auto impl = std::make_shared<vtkMPICommunicatorCollectiveRequest>();
+  int res = CheckForMPIError(MPI_Ibcast(data, static_cast<int>(length),
+    vtkMPICommunicatorGetMPIType(type), srcProcessId, *this->MPIComm->Handle, &impl->Handle));
+  if (res)
+  {
+    request.Impl = impl;
+  }
+  return res;
+#else
+  return this->Superclass::NoBlockBroadcastVoidArray(data, length, type, srcProcessId, request);
+#endif
+}
+
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::NoBlockGatherVVoidArray(const void* sendBuffer, void* recvBuffer,
+  vtkIdType sendLength, vtkIdType* recvLengths, vtkIdType* offsets, int type, int destProcessId,
+  CollectiveRequest& request)
+{
+#if MPI_VERSION >= 3
+  vtkMPICommunicatorDebugBarrier(this->MPIComm->Handle);
+  request.Impl.reset();
+  if (!vtkMPICommunicatorCheckSize(sendLength))
+  {
+    return 0;
+  }
+  auto impl = std::make_shared<vtkMPICommunicatorCollectiveRequest>();
+  int rank, numProc;
+  MPI_Comm_rank(*this->MPIComm->Handle, &rank);
+  MPI_Comm_size(*this->MPIComm->Handle, &numProc);
+  if (rank == destProcessId &&
+    !vtkMPICommunicatorToMPICounts(recvLengths, offsets, numProc, impl->Counts[0], impl->Counts[1]))
+  {
+    return 0;
+  }
+  MPI_Datatype mpiType = vtkMPICommunicatorGetMPIType(type);
+  int res = CheckForMPIError(MPI_Igatherv(const_cast<void*>(sendBuffer),
+    static_cast<int>(sendLength), mpiType, rank == destProcessId ? recvBuffer : nullptr,
+    rank == destProcessId ? impl->Counts[0].data() : nullptr,
+    rank == destProcessId ? impl->Counts[1].data() : nullptr, mpiType, destProcessId,
+    *this->MPIComm->Handle, &impl->Handle));
+  if (res)
+  {
+    request.Impl = impl;
+  }
+  return res;
+#else
+  return this->Superclass::NoBlockGatherVVoidArray(
+    sendBuffer, recvBuffer, sendLength, recvLengths, offsets, type, destProcessId, request);
+#endif
+}
+
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::NoBlockAllToAllVVoidArray(const void* sendBuffer, vtkIdType* sendLengths,
+  vtkIdType* sendOffsets, void* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+  int type, CollectiveRequest& request)
+{
+#if MPI_VERSION >= 3
+  vtkMPICommunicatorDebugBarrier(this->MPIComm->Handle);
+  request.Impl.reset();
+  auto impl = std::make_shared<vtkMPICommunicatorCollectiveRequest>();
+  int numProc;
+  MPI_Comm_size(*this->MPIComm->Handle, &numProc);
+  if (!vtkMPICommunicatorToMPICounts(
+        sendLengths, sendOffsets, numProc, impl->Counts[0], impl->Counts[1]) ||
+    !vtkMPICommunicatorToMPICounts(
+      recvLengths, recvOffsets, numProc, impl->Counts[2], impl->Counts[3]))
+  {
+    return 0;
+  }
+  MPI_Datatype mpiType = vtkMPICommunicatorGetMPIType(type);
+  int res = CheckForMPIError(MPI_Ialltoallv(const_cast<void*>(sendBuffer),
+    impl->Counts[0].data(), impl->Counts[1].data(), mpiType, recvBuffer, impl->Counts[2].data(),
+    impl->Counts[3].data(), mpiType, *this->MPIComm->Handle, &impl->Handle));
+  if (res)
+  {
+    request.Impl = impl;
+  }
+  return res;
+#else
+  return this->Superclass::NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets,
+    recvBuffer, recvLengths, recvOffsets, type, request);
+#endif
+}
+
 //------------------------------------------------------------------------------
 int vtkMPICommunicator::WaitAll(int count, Request requests[])
 {
@@ -173,6 +173,25 @@ public:
     Operation* operation) override;
   ///@}
 
+  ///@{
+  /**
+   * Nonblocking collectives using MPI_Iallreduce, MPI_Ibcast, MPI_Igatherv
+   * and MPI_Ialltoallv. With an MPI older than 3.0, these perform the blocking
+   * operations like the superclass. Return values are 1 for success and 0
+   * otherwise.
+   */
+  int NoBlockAllReduceVoidArray(const void* sendBuffer, void* recvBuffer, vtkIdType length,
+    int type, int operation, CollectiveRequest& request) override;
+  int NoBlockBroadcastVoidArray(
+    void* data, vtkIdType length, int type, int srcProcessId, CollectiveRequest& request) override;
+  int NoBlockGatherVVoidArray(const void* sendBuffer, void* recvBuffer, vtkIdType sendLength,
+    vtkIdType* recvLengths, vtkIdType* offsets, int type, int destProcessId,
+    CollectiveRequest& request) override;
+  int NoBlockAllToAllVVoidArray(const void* sendBuffer, vtkIdType* sendLengths,
+    vtkIdType* sendOffsets, void* recvBuffer, vtkIdType* recvLengths, vtkIdType* recvOffsets,
+    int type, CollectiveRequest& request) override;
+  ///@}
+
   ///@{
   /**
    * Nonblocking test for a message.  Inputs are: source -- the source rank
@@ -38,8 +38,17 @@ uniform samplerBuffer vertexPositions;
 // The normal of the output primitive in view coordinates.
 //VTK::Normal::Dec
 
+// Faces are subdivided in at most MaxSubdivisions x MaxSubdivisions quadrilaterals,
+// emitted as one triangle strip per row.
+#define MaxSubdivisions 4
+
 layout(points) in;
-layout(triangle_strip, max_vertices = 6) out; // TODO: use string substitution for this
+layout(triangle_strip, max_vertices = 40) out; // MaxSubdivisions * (2 * MaxSubdivisions + 2)
+
+// Largest distance in pixels between the faces and their triangles, no subdivision when <= 0.
+uniform float maxScreenSpaceError;
+// Size of the viewport in pixels.
+uniform vec2 viewportSize;
 
 // Input from vertex shader
 in int vtkCellSideId[]; // size 1
@@ -58,61 +67,109 @@ vec3 ComputeNormal(in vec3 p1, in vec3 p2, in vec3 p3)
   return cross(delta32, delta12);
 }
 
+//----------------------------------------------------------------
+/**
+ * Returns the number of subdivisions along each direction of a bilinear face
+ * so that its triangles stay within maxScreenSpaceError pixels of the face.
+ * A quadrilateral departs from its two triangles by at most a quarter of its
+ * twist p0 - p1 + p2 - p3, which subdividing n times divides by n * n.
+ */
+int ComputeNumberOfSubdivisions(in vec3 coords[4])
+{
+  if (maxScreenSpaceError <= 0.0)
+  {
+    return 1;
+  }
+  vec2 screen[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    vec4 posDC = MCDCMatrix * vec4(coords[i], 1.0);
+    if (posDC.w <= 0.0)
+    {
+      // the face crosses the plane of the eye, its projection is unbounded.
+      return MaxSubdivisions;
+    }
+    screen[i] = 0.5 * viewportSize * posDC.xy / posDC.w;
+  }
+  float error = 0.25 * length(screen[0] - screen[1] + screen[2] - screen[3]);
+  int n = int(ceil(sqrt(error / maxScreenSpaceError)));
+  return clamp(n, 1, MaxSubdivisions);
+}
+
+//----------------------------------------------------------------
+vec3 EvaluateBilinear(in vec3 values[4], in vec2 uv)
+{
+  return mix(mix(values[0], values[1], uv.x), mix(values[3], values[2], uv.x), uv.y);
+}
+
 //----------------------------------------------------------------
 /**
  * Draws triangle strips for the sideId'th face of a linear hexahedron.
- * sideId - index of the face which will be rendered as two triangles - [0, 5]
+ * sideId - index of the face which will be rendered as triangles - [0, 5]
  * cellId - index of the vtk cell whose faces we shall render - [0, numCells]
+ *
+ * The face is the bilinear patch of its 4 corners, it is not planar when the
+ * cell is twisted. It is split into a grid of quadrilaterals, each drawn as two
+ * triangles, fine enough for the triangles to be within maxScreenSpaceError
+ * pixels of the patch. The normals are those of the patch at each vertex.
+ *   0----3      u from 0 to 1, v from 0 to 3
+ *   |    |
+ *   1----2
  */
 void DrawHexFace(in int sideId, in int cellId)
 {
-  // split each face into two triangles.
-  // 0----3   0          0---3
-  // |    |   | \         \  |
-  // |    | ->|  \    +    \ |
-  // |    |   |   \         \|
-  // 1----2   1----2         2
-  ivec3 triPtIds[2];
-  triPtIds[0] = ivec3(0, 1, 2);
-  triPtIds[1] = ivec3(0, 2, 3);
-
   int cellLocalPtIds[4], cellGlobalPtIds[4];
   vec3 coords[4];
+  vec3 pCoords[4];
   for (int i = 0; i < 4; ++i)
   {
     cellLocalPtIds[i] = texelFetch(faceConnectivity, sideId * 4 + i).r;
     cellGlobalPtIds[i] = texelFetch(cellConnectivity, cellId * 8 + cellLocalPtIds[i]).r;
     coords[i] = texelFetch(vertexPositions, cellGlobalPtIds[i]).xyz;
+    pCoords[i] = texelFetch(cellParametrics, cellLocalPtIds[i]).xyz;
   }
 
-  vec3 n = ComputeNormal(coords[0], coords[1], coords[2]);
-  if (length(n) == 0.0)
+  // normal of the face, used where the patch is degenerate.
+  vec3 faceNormal = ComputeNormal(coords[0], coords[1], coords[2]);
+  if (length(faceNormal) == 0.0)
   {
-    n = ComputeNormal(coords[1], coords[2], coords[3]);
+    faceNormal = ComputeNormal(coords[1], coords[2], coords[3]);
   }
-  if (length(n) == 0.0)
+  if (length(faceNormal) == 0.0)
   {
-    n.z = 1.0f;
+    faceNormal.z = 1.0f;
   }
 
-  //VTK::Normal::Impl
-
-  for (int triId = 0; triId < 2; ++triId)
+  int numberOfSubdivisions = ComputeNumberOfSubdivisions(coords);
+  float delta = 1.0 / float(numberOfSubdivisions);
+  for (int row = 0; row < numberOfSubdivisions; ++row)
   {
-    for (int i = 0; i < 3; ++i)
+    for (int col = 0; col <= numberOfSubdivisions; ++col)
     {
-      int triPtId = triPtIds[triId][i];
-      int localPtId = cellLocalPtIds[triPtId];
-      int globalPtId = cellGlobalPtIds[triPtId];
-
-      vec4 vertexMC = vec4(texelFetch(vertexPositions, globalPtId).xyz, 1.0f);
-
-      //VTK::PositionVC::Impl
-
-      //VTK::Color::Impl
-
-      pCoordGSOutput = texelFetch(cellParametrics, localPtId).xyz;
-      EmitVertex();
+      // the vertex of the next row comes first to keep the winding of the face.
+      for (int next = 1; next >= 0; --next)
+      {
+        vec2 uv = vec2(float(col), float(row + next)) * delta;
+        vec3 dPdu = mix(coords[1] - coords[0], coords[2] - coords[3], uv.y);
+        vec3 dPdv = mix(coords[3] - coords[0], coords[2] - coords[1], uv.x);
+        vec3 n = cross(dPdu, dPdv);
+        if (length(n) == 0.0)
+        {
+          n = faceNormal;
+        }
+
+        //VTK::Normal::Impl
+
+        vec4 vertexMC = vec4(EvaluateBilinear(coords, uv), 1.0f);
+
+        //VTK::PositionVC::Impl
+
+        //VTK::Color::Impl
+
+        vtkCellIdGSOutput = cellId;
+        pCoordGSOutput = EvaluateBilinear(pCoords, uv);
+        EmitVertex();
+      }
     }
     EndPrimitive();
   }
@@ -123,6 +180,5 @@ void main()
 {
   int cellId = texelFetch(sideConnectivity, 2 * vtkCellSideId[0]).r;
   int sideId = texelFetch(sideConnectivity, 2 * vtkCellSideId[0] + 1).r;
-  vtkCellIdGSOutput = cellId;
   DrawHexFace(sideId, cellId);
 }
@@ -573,6 +573,15 @@ void DGState::SetMapperShaderParameters(vtkOpenGLCellGridRenderRequest* request)
     vtkWarningWithObjectMacro(mapper, << this->CellBO.Program->GetError());
   }
 
+  // Only the faces of hexahedra are subdivided, those of tetrahedra are planar.
+  if (this->CellBO.Program->IsUniformUsed("maxScreenSpaceError"))
+  {
+    int* size = request->GetRenderer()->GetSize();
+    float viewportSize[2] = { static_cast<float>(size[0]), static_cast<float>(size[1]) };
+    this->CellBO.Program->SetUniformf("maxScreenSpaceError", mapper->GetMaximumScreenSpaceError());
+    this->CellBO.Program->SetUniform2f("viewportSize", viewportSize);
+  }
+
   if (!this->CellBO.Program->SetUniformi("mapScalars", mapper->GetScalarVisibility() ? 1 : 0))
   {
     vtkWarningWithObjectMacro(mapper, << this->CellBO.Program->GetError());
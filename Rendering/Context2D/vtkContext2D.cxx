@@ -361,6 +361,63 @@ void vtkContext2D::DrawMarkers(
   this->DrawMarkers(shape, highlight, f, n, c, nc_comps);
 }
 
+//------------------------------------------------------------------------------
+void vtkContext2D::DrawCachedPoly(vtkPoints2D* points, vtkUnsignedCharArray* colors)
+{
+  if (!this->Device)
+  {
+    vtkErrorMacro(<< "Attempted to paint with no active vtkContextDevice2D.");
+    return;
+  }
+  if (colors && colors->GetNumberOfTuples() != points->GetNumberOfPoints())
+  {
+    vtkErrorMacro(<< "Attempted to color points with array of wrong length");
+    return;
+  }
+  vtkFloatArray* f = vtkArrayDownCast<vtkFloatArray>(points->GetData());
+  if (!f)
+  {
+    vtkErrorMacro(<< "Only points stored as floats can be cached.");
+    return;
+  }
+  // The device tracks the modifications of the data array, which
+  // vtkPoints2D::Modified() leaves unchanged.
+  if (points->GetMTime() > f->GetMTime())
+  {
+    f->Modified();
+  }
+  this->Device->DrawCachedPoly(f, colors);
+}
+
+//------------------------------------------------------------------------------
+void vtkContext2D::DrawCachedMarkers(
+  int shape, bool highlight, vtkPoints2D* points, vtkUnsignedCharArray* colors)
+{
+  if (!this->Device)
+  {
+    vtkErrorMacro(<< "Attempted to paint with no active vtkContextDevice2D.");
+    return;
+  }
+  if (colors && colors->GetNumberOfTuples() != points->GetNumberOfPoints())
+  {
+    vtkErrorMacro(<< "Attempted to color points with array of wrong length");
+    return;
+  }
+  vtkFloatArray* f = vtkArrayDownCast<vtkFloatArray>(points->GetData());
+  if (!f)
+  {
+    vtkErrorMacro(<< "Only points stored as floats can be cached.");
+    return;
+  }
+  // The device tracks the modifications of the data array, which
+  // vtkPoints2D::Modified() leaves unchanged.
+  if (points->GetMTime() > f->GetMTime())
+  {
+    f->Modified();
+  }
+  this->Device->DrawCachedMarkers(shape, highlight, f, colors);
+}
+
 //------------------------------------------------------------------------------
 void vtkContext2D::DrawRect(float x, float y, float width, float height)
 {
@@ -225,6 +225,19 @@ public:
     int shape, bool highlight, vtkPoints2D* points, vtkUnsignedCharArray* colors);
   ///@}
 
+  ///@{
+  /**
+   * Draw a poly line or a series of markers like DrawPoly() and DrawMarkers(),
+   * letting the device keep the points and their optional colors, one per
+   * point, in the graphics memory between renders. The points and the colors
+   * must be marked as modified whenever their values change.
+   * \sa vtkContextDevice2D::DrawCachedPoly()
+   */
+  void DrawCachedPoly(vtkPoints2D* points, vtkUnsignedCharArray* colors = nullptr);
+  void DrawCachedMarkers(
+    int shape, bool highlight, vtkPoints2D* points, vtkUnsignedCharArray* colors = nullptr);
+  ///@}
+
   /**
    * Draw a rectangle with origin at x, y and width w, height h
    */
@@ -17,6 +17,7 @@
 #include "vtkAbstractMapper.h" // for VTK_SCALAR_MODE defines
 #include "vtkBrush.h"
 #include "vtkCellIterator.h"
+#include "vtkFloatArray.h"
 #include "vtkMathTextUtilities.h"
 #include "vtkPen.h"
 #include "vtkPolyData.h"
@@ -187,6 +188,29 @@ void vtkContextDevice2D::PrintSelf(ostream& os, vtkIndent indent)
 //------------------------------------------------------------------------------
 void vtkContextDevice2D::DrawMarkers(int, bool, float*, int, unsigned char*, int) {}
 
+//------------------------------------------------------------------------------
+void vtkContextDevice2D::DrawCachedPoly(vtkFloatArray* points, vtkUnsignedCharArray* colors)
+{
+  const int n = static_cast<int>(points->GetNumberOfTuples());
+  if (n > 0)
+  {
+    this->DrawPoly(points->GetPointer(0), n, colors ? colors->GetPointer(0) : nullptr,
+      colors ? colors->GetNumberOfComponents() : 0);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContextDevice2D::DrawCachedMarkers(
+  int shape, bool highlight, vtkFloatArray* points, vtkUnsignedCharArray* colors)
+{
+  const int n = static_cast<int>(points->GetNumberOfTuples());
+  if (n > 0)
+  {
+    this->DrawMarkers(shape, highlight, points->GetPointer(0), n,
+      colors ? colors->GetPointer(0) : nullptr, colors ? colors->GetNumberOfComponents() : 0);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkContextDevice2D::DrawColoredPolygon(float*, int, unsigned char*, int)
 {
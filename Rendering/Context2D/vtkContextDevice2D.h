@@ -43,6 +43,7 @@ class vtkMatrix3x3;
 class vtkAbstractContextBufferId;
 class vtkPen;
 class vtkBrush;
+class vtkFloatArray;
 class vtkRectf;
 class vtkPolyData;
 class vtkUnsignedCharArray;
@@ -111,6 +112,21 @@ public:
   virtual void DrawMarkers(int shape, bool highlight, float* points, int n,
     unsigned char* colors = nullptr, int nc_comps = 0);
 
+  ///@{
+  /**
+   * Draw a poly line or a series of markers like DrawPoly() and DrawMarkers(),
+   * from the 2-components \a points array and the optional \a colors array,
+   * which has a color for each point. Devices may keep these arrays in the
+   * graphics memory between renders and only transfer them again when they
+   * are modified, so the arrays must be marked as modified whenever their
+   * values change. The default implementation draws them as DrawPoly() and
+   * DrawMarkers().
+   */
+  virtual void DrawCachedPoly(vtkFloatArray* points, vtkUnsignedCharArray* colors);
+  virtual void DrawCachedMarkers(
+    int shape, bool highlight, vtkFloatArray* points, vtkUnsignedCharArray* colors);
+  ///@}
+
   /**
    * Draw a quad using the specified number of points.
    */
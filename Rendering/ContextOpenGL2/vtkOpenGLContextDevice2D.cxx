@@ -209,6 +209,55 @@ inline bool IsFullCircle(float startAngle, float stopAngle)
   return std::fabs(stopAngle - startAngle) + TOL >= 360.f;
 }
 
+//------------------------------------------------------------------------------
+// Interleaves the positions, colors and texture coordinates of the vertices,
+// the colors being packed in a single float.
+void PackVertices(std::vector<float>& va, const float* f, int nv, const unsigned char* colors,
+  int nc, const float* tcoords)
+{
+  int stride = 2;
+  int cOffset = 0;
+  int tOffset = 0;
+  if (colors)
+  {
+    cOffset = stride;
+    stride++;
+  }
+  if (tcoords)
+  {
+    tOffset = stride;
+    stride += 2;
+  }
+
+  va.resize(nv * stride);
+  vtkFourByteUnion c;
+  for (int i = 0; i < nv; i++)
+  {
+    va[i * stride] = f[i * 2];
+    va[i * stride + 1] = f[i * 2 + 1];
+    if (colors)
+    {
+      c.c[0] = colors[nc * i];
+      c.c[1] = colors[nc * i + 1];
+      c.c[2] = colors[nc * i + 2];
+      if (nc == 4)
+      {
+        c.c[3] = colors[nc * i + 3];
+      }
+      else
+      {
+        c.c[3] = 255;
+      }
+      va[i * stride + cOffset] = c.f;
+    }
+    if (tcoords)
+    {
+      va[i * stride + tOffset] = tcoords[i * 2];
+      va[i * stride + tOffset + 1] = tcoords[i * 2 + 1];
+    }
+  }
+}
+
 } // end anon namespace
 
 //------------------------------------------------------------------------------
@@ -363,6 +412,20 @@ void vtkOpenGLContextDevice2D::End()
 
   this->PolyDataImpl->HandleEndFrame();
 
+  // Release the buffers of the cached arrays that were deleted
+  for (auto it = this->Storage->ArrayBuffers.begin(); it != this->Storage->ArrayBuffers.end();)
+  {
+    if (!it->second.Points)
+    {
+      it->second.Buffer->ReleaseGraphicsResources();
+      it = this->Storage->ArrayBuffers.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
   this->RenderWindow = nullptr;
   this->InRender = false;
 
@@ -459,61 +522,31 @@ void vtkOpenGLContextDevice2D::SetMatrices(vtkShaderProgram* prog)
 void vtkOpenGLContextDevice2D::BuildVBO(
   vtkOpenGLHelper* cellBO, float* f, int nv, unsigned char* colors, int nc, float* tcoords)
 {
-  int stride = 2;
-  int cOffset = 0;
-  int tOffset = 0;
-  if (colors)
-  {
-    cOffset = stride;
-    stride++;
-  }
-  if (tcoords)
-  {
-    tOffset = stride;
-    stride += 2;
-  }
-
   std::vector<float> va;
-  va.resize(nv * stride);
-  vtkFourByteUnion c;
-  for (int i = 0; i < nv; i++)
-  {
-    va[i * stride] = f[i * 2];
-    va[i * stride + 1] = f[i * 2 + 1];
-    if (colors)
-    {
-      c.c[0] = colors[nc * i];
-      c.c[1] = colors[nc * i + 1];
-      c.c[2] = colors[nc * i + 2];
-      if (nc == 4)
-      {
-        c.c[3] = colors[nc * i + 3];
-      }
-      else
-      {
-        c.c[3] = 255;
-      }
-      va[i * stride + cOffset] = c.f;
-    }
-    if (tcoords)
-    {
-      va[i * stride + tOffset] = tcoords[i * 2];
-      va[i * stride + tOffset + 1] = tcoords[i * 2 + 1];
-    }
-  }
+  PackVertices(va, f, nv, colors, nc, tcoords);
 
   // upload the data
   cellBO->IBO->Upload(va, vtkOpenGLBufferObject::ArrayBuffer);
+  this->BindVBO(cellBO, cellBO->IBO, colors != nullptr, tcoords != nullptr);
+}
+
+void vtkOpenGLContextDevice2D::BindVBO(
+  vtkOpenGLHelper* cellBO, vtkOpenGLBufferObject* buffer, bool colors, bool tcoords)
+{
+  const int cOffset = 2;
+  const int tOffset = colors ? 3 : 2;
+  const int stride = tOffset + (tcoords ? 2 : 0);
+
   cellBO->VAO->ShaderProgramChanged();
   cellBO->VAO->Bind();
   if (!cellBO->VAO->AddAttributeArray(
-        cellBO->Program, cellBO->IBO, "vertexMC", 0, sizeof(float) * stride, VTK_FLOAT, 2, false))
+        cellBO->Program, buffer, "vertexMC", 0, sizeof(float) * stride, VTK_FLOAT, 2, false))
   {
     vtkErrorMacro(<< "Error setting vertexMC in shader VAO.");
   }
   if (colors)
   {
-    if (!cellBO->VAO->AddAttributeArray(cellBO->Program, cellBO->IBO, "vertexScalar",
+    if (!cellBO->VAO->AddAttributeArray(cellBO->Program, buffer, "vertexScalar",
           sizeof(float) * cOffset, sizeof(float) * stride, VTK_UNSIGNED_CHAR, 4, true))
     {
       vtkErrorMacro(<< "Error setting vertexScalar in shader VAO.");
@@ -521,7 +554,7 @@ void vtkOpenGLContextDevice2D::BuildVBO(
   }
   if (tcoords)
   {
-    if (!cellBO->VAO->AddAttributeArray(cellBO->Program, cellBO->IBO, "tcoordMC",
+    if (!cellBO->VAO->AddAttributeArray(cellBO->Program, buffer, "tcoordMC",
           sizeof(float) * tOffset, sizeof(float) * stride, VTK_FLOAT, 2, false))
     {
       vtkErrorMacro(<< "Error setting tcoordMC in shader VAO.");
@@ -531,6 +564,40 @@ void vtkOpenGLContextDevice2D::BuildVBO(
   cellBO->VAO->Bind();
 }
 
+vtkOpenGLBufferObject* vtkOpenGLContextDevice2D::GetCachedBuffer(
+  vtkFloatArray* points, vtkUnsignedCharArray* colors, bool tcoords)
+{
+  vtkCachedArrayBuffer& entry = this->Storage->ArrayBuffers[std::make_pair(points, tcoords)];
+  if (!entry.Buffer)
+  {
+    entry.Buffer = vtkSmartPointer<vtkOpenGLBufferObject>::New();
+  }
+  // the weak pointer is reset if the array at this address was deleted and
+  // another one allocated in its place
+  if (entry.Points != points || entry.PointsTime != points->GetMTime() ||
+    entry.Colors != colors || (colors && entry.ColorsTime != colors->GetMTime()))
+  {
+    const int n = static_cast<int>(points->GetNumberOfTuples());
+    std::vector<float> va;
+    std::vector<float> distances;
+    if (tcoords)
+    {
+      // only solid lines are cached, so the stipple distances can be zero
+      distances.resize(2 * n, 0.f);
+    }
+    PackVertices(va, points->GetPointer(0), n, colors ? colors->GetPointer(0) : nullptr,
+      colors ? colors->GetNumberOfComponents() : 0, tcoords ? distances.data() : nullptr);
+    entry.Buffer->Upload(va, vtkOpenGLBufferObject::ArrayBuffer);
+
+    entry.Points = points;
+    entry.PointsTime = points->GetMTime();
+    entry.Colors = colors;
+    entry.ColorsTime = colors ? colors->GetMTime() : 0;
+    entry.NumberOfPoints = n;
+  }
+  return entry.Buffer;
+}
+
 void vtkOpenGLContextDevice2D::ReadyVBOProgram()
 {
   vtkOpenGLGL2PSHelper* gl2ps = PrepProgramForGL2PS(*this->VBO);
@@ -874,6 +941,59 @@ void vtkOpenGLContextDevice2D::DrawPoly(float* f, int n, unsigned char* colors,
   vtkOpenGLCheckErrorMacro("failed after DrawPoly");
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLContextDevice2D::DrawCachedPoly(vtkFloatArray* points, vtkUnsignedCharArray* colors)
+{
+  // Wide lines are converted to triangles and stipples need the distances
+  // along the line in pixels, both depending on the current transform.
+  vtkOpenGLGL2PSHelper* gl2ps = vtkOpenGLGL2PSHelper::GetInstance();
+  if ((gl2ps && gl2ps->GetActiveState() != vtkOpenGLGL2PSHelper::Inactive) ||
+    this->Pen->GetWidth() > 1.0 || this->Pen->GetLineType() != vtkPen::SOLID_LINE)
+  {
+    this->Superclass::DrawCachedPoly(points, colors);
+    return;
+  }
+
+  const int n = static_cast<int>(points->GetNumberOfTuples());
+  // Skip transparent elements.
+  if (n == 0 || (!colors && this->Pen->GetColorObject().GetAlpha() == 0))
+  {
+    return;
+  }
+
+  vtkOpenGLClearErrorMacro();
+  this->SetLineType(vtkPen::SOLID_LINE);
+
+  vtkOpenGLHelper* cbo = nullptr;
+  if (colors)
+  {
+    this->ReadyLinesCBOProgram();
+    cbo = this->LinesCBO;
+  }
+  else
+  {
+    this->ReadyLinesBOProgram();
+    cbo = this->LinesBO;
+    if (cbo->Program)
+    {
+      cbo->Program->SetUniform4uc("vertexColor", this->Pen->GetColor());
+    }
+  }
+  if (!cbo->Program)
+  {
+    return;
+  }
+
+  cbo->Program->SetUniformi("stipple", this->LinePattern);
+  this->SetMatrices(cbo->Program);
+  this->SetLineWidth(this->Pen->GetWidth());
+  this->BindVBO(cbo, this->GetCachedBuffer(points, colors, true), colors != nullptr, true);
+  glDrawArrays(GL_LINE_STRIP, 0, n);
+  this->SetLineWidth(1.0);
+
+  vtkOpenGLCheckErrorMacro("failed after DrawCachedPoly");
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLContextDevice2D::DrawLines(float* f, int n, unsigned char* colors, int nc)
 {
@@ -1097,53 +1217,60 @@ void vtkOpenGLContextDevice2D::DrawPointSprites(
     }
 
     this->BuildVBO(cbo, points, n, colors, nc_comps, nullptr);
-    this->SetMatrices(cbo->Program);
+    this->DrawBoundPointSprites(cbo, sprite, n);
+  }
+  else
+  {
+    vtkWarningMacro(<< "Points supplied without a valid image or pointer.");
+  }
+  vtkOpenGLCheckErrorMacro("failed after DrawPointSprites");
+}
 
-    if (sprite)
+//------------------------------------------------------------------------------
+void vtkOpenGLContextDevice2D::DrawBoundPointSprites(
+  vtkOpenGLHelper* cbo, vtkImageData* sprite, int n)
+{
+  this->SetMatrices(cbo->Program);
+
+  if (sprite)
+  {
+    if (!this->Storage->SpriteTexture)
     {
-      if (!this->Storage->SpriteTexture)
-      {
-        this->Storage->SpriteTexture = vtkTexture::New();
-      }
-      int properties = this->Brush->GetTextureProperties();
-      this->Storage->SpriteTexture->SetInputData(sprite);
-      this->Storage->SpriteTexture->SetRepeat(properties & vtkContextDevice2D::Repeat);
-      this->Storage->SpriteTexture->SetInterpolate(properties & vtkContextDevice2D::Linear);
-      this->Storage->SpriteTexture->Render(this->Renderer);
-      int tunit = vtkOpenGLTexture::SafeDownCast(this->Storage->SpriteTexture)->GetTextureUnit();
-      cbo->Program->SetUniformi("texture1", tunit);
+      this->Storage->SpriteTexture = vtkTexture::New();
     }
+    int properties = this->Brush->GetTextureProperties();
+    this->Storage->SpriteTexture->SetInputData(sprite);
+    this->Storage->SpriteTexture->SetRepeat(properties & vtkContextDevice2D::Repeat);
+    this->Storage->SpriteTexture->SetInterpolate(properties & vtkContextDevice2D::Linear);
+    this->Storage->SpriteTexture->Render(this->Renderer);
+    int tunit = vtkOpenGLTexture::SafeDownCast(this->Storage->SpriteTexture)->GetTextureUnit();
+    cbo->Program->SetUniformi("texture1", tunit);
+  }
 
 #ifdef GL_POINT_SPRITE
-    // We can actually use point sprites here
-    if (this->RenderWindow->IsPointSpriteBugPresent())
-    {
-      glEnable(GL_POINT_SPRITE);
-      glTexEnvi(GL_POINT_SPRITE, GL_COORD_REPLACE, GL_TRUE);
-    }
-    glPointParameteri(GL_POINT_SPRITE_COORD_ORIGIN, GL_LOWER_LEFT);
+  // We can actually use point sprites here
+  if (this->RenderWindow->IsPointSpriteBugPresent())
+  {
+    glEnable(GL_POINT_SPRITE);
+    glTexEnvi(GL_POINT_SPRITE, GL_COORD_REPLACE, GL_TRUE);
+  }
+  glPointParameteri(GL_POINT_SPRITE_COORD_ORIGIN, GL_LOWER_LEFT);
 #endif
 
-    glDrawArrays(GL_POINTS, 0, n);
+  glDrawArrays(GL_POINTS, 0, n);
 
 #ifdef GL_POINT_SPRITE
-    if (this->RenderWindow->IsPointSpriteBugPresent())
-    {
-      glTexEnvi(GL_POINT_SPRITE, GL_COORD_REPLACE, GL_FALSE);
-      glDisable(GL_POINT_SPRITE);
-    }
+  if (this->RenderWindow->IsPointSpriteBugPresent())
+  {
+    glTexEnvi(GL_POINT_SPRITE, GL_COORD_REPLACE, GL_FALSE);
+    glDisable(GL_POINT_SPRITE);
+  }
 #endif
 
-    if (sprite)
-    {
-      this->Storage->SpriteTexture->PostRender(this->Renderer);
-    }
-  }
-  else
+  if (sprite)
   {
-    vtkWarningMacro(<< "Points supplied without a valid image or pointer.");
+    this->Storage->SpriteTexture->PostRender(this->Renderer);
   }
-  vtkOpenGLCheckErrorMacro("failed after DrawPointSprites");
 }
 
 //------------------------------------------------------------------------------
@@ -1170,6 +1297,52 @@ void vtkOpenGLContextDevice2D::DrawMarkers(
   this->DrawPointSprites(sprite, points, n, colors, nc_comps);
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLContextDevice2D::DrawCachedMarkers(
+  int shape, bool highlight, vtkFloatArray* points, vtkUnsignedCharArray* colors)
+{
+  vtkOpenGLGL2PSHelper* gl2ps = vtkOpenGLGL2PSHelper::GetInstance();
+  if (gl2ps && gl2ps->GetActiveState() != vtkOpenGLGL2PSHelper::Inactive)
+  {
+    this->Superclass::DrawCachedMarkers(shape, highlight, points, colors);
+    return;
+  }
+
+  const int n = static_cast<int>(points->GetNumberOfTuples());
+  if (n == 0)
+  {
+    return;
+  }
+
+  vtkOpenGLClearErrorMacro();
+  this->SetPointSize(this->Pen->GetWidth());
+
+  vtkOpenGLHelper* cbo = nullptr;
+  if (colors)
+  {
+    this->ReadySCBOProgram();
+    cbo = this->SCBO;
+  }
+  else
+  {
+    this->ReadySBOProgram();
+    cbo = this->SBO;
+    if (cbo->Program)
+    {
+      cbo->Program->SetUniform4uc("vertexColor", this->Pen->GetColor());
+    }
+  }
+  if (!cbo->Program)
+  {
+    return;
+  }
+
+  this->BindVBO(cbo, this->GetCachedBuffer(points, colors, false), colors != nullptr, false);
+  vtkImageData* sprite = this->GetMarker(shape, this->Pen->GetWidth(), highlight);
+  this->DrawBoundPointSprites(cbo, sprite, n);
+  vtkOpenGLCheckErrorMacro("failed after DrawCachedMarkers");
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLContextDevice2D::DrawQuad(float* f, int n)
 {
@@ -2098,6 +2271,11 @@ void vtkOpenGLContextDevice2D::ReleaseGraphicsResources(vtkWindow* window)
     this->Storage->SpriteTexture->ReleaseGraphicsResources(window);
   }
   this->Storage->TextTextureCache.ReleaseGraphicsResources(window);
+  for (auto& item : this->Storage->ArrayBuffers)
+  {
+    item.second.Buffer->ReleaseGraphicsResources();
+  }
+  this->Storage->ArrayBuffers.clear();
 }
 
 //------------------------------------------------------------------------------
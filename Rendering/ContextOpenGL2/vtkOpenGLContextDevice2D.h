@@ -38,6 +38,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkMatrix4x4;
+class vtkOpenGLBufferObject;
 class vtkOpenGLExtensionManager;
 class vtkOpenGLHelper;
 class vtkOpenGLRenderWindow;
@@ -109,6 +110,17 @@ public:
   void DrawMarkers(int shape, bool highlight, float* points, int n, unsigned char* colors = nullptr,
     int nc_comps = 0) override;
 
+  ///@{
+  /**
+   * Draw a poly line or markers from arrays whose vertex buffer is kept on the
+   * GPU between renders, and only uploaded again when the arrays are modified.
+   * Wide or stippled lines, and GL2PS captures, use the uncached path.
+   */
+  void DrawCachedPoly(vtkFloatArray* points, vtkUnsignedCharArray* colors) override;
+  void DrawCachedMarkers(
+    int shape, bool highlight, vtkFloatArray* points, vtkUnsignedCharArray* colors) override;
+  ///@}
+
   ///@{
   /**
    * Adjust the size of the MarkerCache. This implementation generates point
@@ -398,6 +410,19 @@ protected:
   void SetMatrices(vtkShaderProgram* prog);
   void BuildVBO(
     vtkOpenGLHelper* cbo, float* v, int nv, unsigned char* coolors, int nc, float* tcoords);
+  void BindVBO(vtkOpenGLHelper* cbo, vtkOpenGLBufferObject* buffer, bool colors, bool tcoords);
+
+  /**
+   * Return the buffer holding the vertices of the cached arrays, uploading
+   * them if they were modified since the last call.
+   */
+  vtkOpenGLBufferObject* GetCachedBuffer(
+    vtkFloatArray* points, vtkUnsignedCharArray* colors, bool tcoords);
+
+  /**
+   * Draw the point sprites of the vertices bound to \a cbo.
+   */
+  void DrawBoundPointSprites(vtkOpenGLHelper* cbo, vtkImageData* sprite, int n);
   void CoreDrawTriangles(
     std::vector<float>& tverts, unsigned char* colors = nullptr, int numComp = 0);
   // used for stipples
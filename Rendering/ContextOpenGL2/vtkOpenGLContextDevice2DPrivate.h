@@ -38,15 +38,20 @@
 #include "vtkAbstractMapper.h"
 #include "vtkCellIterator.h"
 #include "vtkColor.h"
+#include "vtkFloatArray.h"
 #include "vtkFreeTypeTools.h"
 #include "vtkGenericCell.h"
+#include "vtkOpenGLBufferObject.h"
+#include "vtkSmartPointer.h"
 #include "vtkTextProperty.h"
 #include "vtkTextRenderer.h"
 #include "vtkTexture.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkWeakPointer.h"
 
 #include <algorithm>
 #include <list>
+#include <map>
 #include <utility>
 
 // .NAME vtkTextureImageCache - store vtkTexture and vtkImageData identified by
@@ -273,6 +278,21 @@ struct TextPropertyKey
 
 typedef TextPropertyKey<std::string> UTF8TextPropertyKey;
 
+/**
+ * Vertex buffer holding the points and colors of arrays drawn with
+ * DrawCachedPoly() or DrawCachedMarkers(). The buffer is only uploaded again
+ * when one of the arrays is modified, and released once the points are deleted.
+ */
+struct vtkCachedArrayBuffer
+{
+  vtkWeakPointer<vtkFloatArray> Points;
+  vtkWeakPointer<vtkUnsignedCharArray> Colors;
+  vtkMTimeType PointsTime = 0;
+  vtkMTimeType ColorsTime = 0;
+  int NumberOfPoints = 0;
+  vtkSmartPointer<vtkOpenGLBufferObject> Buffer;
+};
+
 class vtkOpenGLContextDevice2D::Private
 {
 public:
@@ -513,6 +533,12 @@ public:
    */
   mutable vtkTextureImageCache<UTF8TextPropertyKey> TextTextureCache;
   ///@}
+
+  /**
+   * Buffers of the cached arrays, keyed by the points and by whether the
+   * vertices hold line distances (polylines) or not (markers).
+   */
+  std::map<std::pair<vtkFloatArray*, bool>, vtkCachedArrayBuffer> ArrayBuffers;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////
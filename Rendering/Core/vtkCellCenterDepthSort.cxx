@@ -27,25 +27,33 @@
 #include "vtkCell.h"
 #include "vtkDataSet.h"
 #include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
 #include "vtkIdTypeArray.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
-#include "vtkSortDataArray.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
-#include <stack>
 #include <utility>
+#include <vector>
 
 //------------------------------------------------------------------------------
 
-typedef std::pair<vtkIdType, vtkIdType> vtkIdPair;
+typedef std::pair<float, vtkIdType> vtkDepthIdPair;
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellCenterDepthSortStack
 {
 public:
-  std::stack<vtkIdPair> Stack;
+  // Range of SortedCells still to be returned by GetNextCells.
+  vtkIdType NextCell = 0;
+  vtkIdType EndCell = 0;
+  // Scratch buffer to sort the depths along with the cell ids.
+  std::vector<vtkDepthIdPair> Keys;
 };
 
 //------------------------------------------------------------------------------
@@ -133,38 +141,55 @@ void vtkCellCenterDepthSort::ComputeCellCenters()
   vtkIdType numcells = this->Input->GetNumberOfCells();
   this->CellCenters->SetNumberOfTuples(numcells);
 
-  float* center = this->CellCenters->GetPointer(0);
-  double dcenter[3];
-  double* weights = new double[this->Input->GetMaxCellSize()]; // Dummy array.
-
-  for (vtkIdType i = 0; i < numcells; i++)
+  if (numcells == 0)
   {
-    vtkCell* cell = this->Input->GetCell(i);
-    double pcenter[3];
-    int subId;
-    subId = cell->GetParametricCenter(pcenter);
-    cell->EvaluateLocation(subId, pcenter, dcenter, weights);
-    center[0] = dcenter[0];
-    center[1] = dcenter[1];
-    center[2] = dcenter[2];
-    center += 3;
+    return;
   }
 
-  delete[] weights;
+  // Build the cell links and the like up front, so that GetCell may then be
+  // called concurrently.
+  vtkNew<vtkGenericCell> firstCell;
+  this->Input->GetCell(0, firstCell);
+  const int maxCellSize = this->Input->GetMaxCellSize();
+
+  float* centers = this->CellCenters->GetPointer(0);
+  vtkSMPThreadLocalObject<vtkGenericCell> localCell;
+  vtkSMPThreadLocal<std::vector<double>> localWeights;
+  vtkSMPTools::For(0, numcells, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = localCell.Local();
+    std::vector<double>& weights = localWeights.Local(); // Dummy array.
+    weights.resize(maxCellSize);
+    double pcenter[3];
+    double dcenter[3];
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      this->Input->GetCell(i, cell);
+      int subId = cell->GetParametricCenter(pcenter);
+      cell->EvaluateLocation(subId, pcenter, dcenter, weights.data());
+      float* center = centers + 3 * i;
+      center[0] = dcenter[0];
+      center[1] = dcenter[1];
+      center[2] = dcenter[2];
+    }
+  });
 }
 
 void vtkCellCenterDepthSort::ComputeDepths()
 {
-  float* vector = this->ComputeProjectionVector();
+  const float* vector = this->ComputeProjectionVector();
+  const float v[3] = { vector[0], vector[1], vector[2] };
   vtkIdType numcells = this->Input->GetNumberOfCells();
 
-  float* center = this->CellCenters->GetPointer(0);
-  float* depth = this->CellDepths->GetPointer(0);
-  for (vtkIdType i = 0; i < numcells; i++)
-  {
-    *(depth++) = vtkMath::Dot(center, vector);
-    center += 3;
-  }
+  // The depths follow the order of SortedCells.
+  const float* centers = this->CellCenters->GetPointer(0);
+  const vtkIdType* ids = this->SortedCells->GetPointer(0);
+  float* depths = this->CellDepths->GetPointer(0);
+  vtkSMPTools::For(0, numcells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      depths[i] = vtkMath::Dot(centers + 3 * ids[i], v);
+    }
+  });
 }
 
 void vtkCellCenterDepthSort::InitTraversal()
@@ -181,80 +206,70 @@ void vtkCellCenterDepthSort::InitTraversal()
     this->ComputeCellCenters();
     this->CellDepths->SetNumberOfTuples(numcells);
     this->SortedCells->SetNumberOfTuples(numcells);
-  }
 
-  vtkDebugMacro("Filling SortedCells to initial values.");
-  vtkIdType* id = this->SortedCells->GetPointer(0);
-  for (vtkIdType i = 0; i < numcells; i++)
-  {
-    *(id++) = i;
+    vtkDebugMacro("Filling SortedCells to initial values.");
+    vtkIdType* ids = this->SortedCells->GetPointer(0);
+    vtkSMPTools::For(0, numcells, [ids](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        ids[i] = i;
+      }
+    });
   }
+  // Otherwise start from the order of the previous traversal: when the view
+  // direction did not change (pan, dolly, zoom) it is still sorted.
 
   vtkDebugMacro("Calculating depths.");
   this->ComputeDepths();
 
-  while (!this->ToSort->Stack.empty())
-    this->ToSort->Stack.pop();
-  this->ToSort->Stack.push(vtkIdPair(0, numcells));
+  float* depths = this->CellDepths->GetPointer(0);
+  if (!std::is_sorted(depths, depths + numcells))
+  {
+    vtkDebugMacro("Sorting depths.");
+    vtkIdType* ids = this->SortedCells->GetPointer(0);
+    std::vector<vtkDepthIdPair>& keys = this->ToSort->Keys;
+    keys.resize(numcells);
+    vtkSMPTools::For(0, numcells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        keys[i] = vtkDepthIdPair(depths[i], ids[i]);
+      }
+    });
+    vtkSMPTools::Sort(keys.begin(), keys.end());
+    vtkSMPTools::For(0, numcells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        depths[i] = keys[i].first;
+        ids[i] = keys[i].second;
+      }
+    });
+  }
+
+  this->ToSort->NextCell = 0;
+  this->ToSort->EndCell = numcells;
 
   this->LastSortTime.Modified();
 }
 
 vtkIdTypeArray* vtkCellCenterDepthSort::GetNextCells()
 {
-  if (this->ToSort->Stack.empty())
+  if (this->ToSort->NextCell >= this->ToSort->EndCell)
   {
-    // Already sorted and returned everything.
+    // Already returned everything.
     return nullptr;
   }
 
-  vtkIdType* cellIds = this->SortedCells->GetPointer(0);
-  float* cellDepths = this->CellDepths->GetPointer(0);
-  vtkIdPair partition;
-
-  partition = this->ToSort->Stack.top();
-  this->ToSort->Stack.pop();
-  while (partition.second - partition.first > this->MaxCellsReturned)
-  {
-    vtkIdType left = partition.first;
-    vtkIdType right = partition.second - 1;
-    float pivot = cellDepths[static_cast<vtkIdType>(vtkMath::Random(left, right))];
-    while (left <= right)
-    {
-      while ((left <= right) && (cellDepths[left] < pivot))
-        left++;
-      while ((left <= right) && (cellDepths[right] > pivot))
-        right--;
-
-      if (left > right)
-        break;
-
-      std::swap(cellIds[left], cellIds[right]);
-      std::swap(cellDepths[left], cellDepths[right]);
-
-      left++;
-      right--;
-    }
-
-    this->ToSort->Stack.push(vtkIdPair(left, partition.second));
-    partition.second = left;
-  }
-
-  if (partition.second <= partition.first)
-  {
-    // Got a partition of zero size.  Just recurse to get the next one.
-    return this->GetNextCells();
-  }
-
-  vtkIdType firstcell = partition.first;
-  vtkIdType numcells = partition.second - partition.first;
+  // The cells are fully sorted by InitTraversal, return the next batch.
+  vtkIdType firstcell = this->ToSort->NextCell;
+  vtkIdType numcells =
+    std::min(this->ToSort->EndCell - firstcell, static_cast<vtkIdType>(this->MaxCellsReturned));
+  this->ToSort->NextCell += numcells;
 
-  this->SortedCellPartition->SetArray(cellIds + firstcell, numcells, 1);
+  this->SortedCellPartition->SetArray(this->SortedCells->GetPointer(firstcell), numcells, 1);
   this->SortedCellPartition->SetNumberOfTuples(numcells);
-  this->CellPartitionDepths->SetArray(cellDepths + firstcell, numcells, 1);
+  this->CellPartitionDepths->SetArray(this->CellDepths->GetPointer(firstcell), numcells, 1);
   this->CellPartitionDepths->SetNumberOfTuples(numcells);
 
-  vtkSortDataArray::Sort(this->CellPartitionDepths, this->SortedCellPartition);
   return this->SortedCellPartition;
 }
 VTK_ABI_NAMESPACE_END
@@ -34,6 +34,11 @@
  * camera transformed into object space.  It then performs an ordinary sort
  * on the result.
  *
+ * The centroids are only recomputed when the input changes. Centroids, depths
+ * and the sort are computed with vtkSMPTools. Each traversal starts from the
+ * order of the previous one, so that the sort is skipped altogether when the
+ * view direction did not change.
+ *
  */
 
 #ifndef vtkCellCenterDepthSort_h
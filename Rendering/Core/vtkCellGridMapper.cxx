@@ -41,6 +41,7 @@ void vtkCellGridMapper::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "VisualizePCoords: " << this->VisualizePCoords << "\n";
   os << indent << "VisualizeBasisFunction: " << this->VisualizeBasisFunction << "\n";
+  os << indent << "MaximumScreenSpaceError: " << this->MaximumScreenSpaceError << "\n";
 }
 
 void vtkCellGridMapper::SetInputData(vtkCellGrid* in)
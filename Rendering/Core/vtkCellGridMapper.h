@@ -51,6 +51,18 @@ public:
   vtkSetMacro(VisualizeBasisFunction, int);
   vtkGetMacro(VisualizeBasisFunction, int);
 
+  ///@{
+  /**
+   * Set/Get the largest distance, in pixels, between the rendered triangles
+   * and the curved faces of the cells. Faces are subdivided on the GPU, with
+   * the projection of the current view, until their triangles are within this
+   * distance, up to 4 times along each direction. Zero or less renders each
+   * face unsubdivided. The default is 0.5.
+   */
+  vtkSetMacro(MaximumScreenSpaceError, double);
+  vtkGetMacro(MaximumScreenSpaceError, double);
+  ///@}
+
   /**
    * Implemented by sub classes. Actual rendering is done here.
    */
@@ -95,6 +107,7 @@ protected:
 
   int VisualizePCoords = -1;
   int VisualizeBasisFunction = -1;
+  double MaximumScreenSpaceError = 0.5;
 
 private:
   vtkCellGridMapper(const vtkCellGridMapper&) = delete;
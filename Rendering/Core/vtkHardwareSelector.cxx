@@ -23,13 +23,17 @@
 #include "vtkProp.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <set>
+#include <vector>
 
 #define ID_OFFSET 1
 
@@ -79,22 +83,93 @@ public:
   double OriginalBackground[3];
   bool OriginalGradient;
 
-  typedef std::map<PixelInformation, std::set<vtkIdType>, PixelInformationComparator>
-    MapOfAttributeIds;
+  struct AttributeHits
+  {
+    // ids of the attributes hit, sorted and unique once all pixels are merged
+    std::vector<vtkIdType> Ids;
+    vtkIdType PixelCount = 0;
+  };
 
-  typedef std::map<PixelInformation, vtkIdType, PixelInformationComparator> PixelCountType;
+  typedef std::map<PixelInformation, AttributeHits, PixelInformationComparator>
+    MapOfAttributeHits;
 
   //-----------------------------------------------------------------------------
-  vtkSelection* ConvertSelection(
-    int fieldassociation, const MapOfAttributeIds& dataMap, const PixelCountType& pixelCounts)
+  // Gather the hits of the pixels of [x1, x2] x [y1, y2] accepted by the
+  // predicate. Bands of rows are decoded concurrently, in maps local to each
+  // thread, merged at the end.
+  template <typename PixelPredicate>
+  MapOfAttributeHits CollectHits(
+    vtkHardwareSelector* self, int x1, int y1, int x2, int y2, PixelPredicate&& accept)
+  {
+    MapOfAttributeHits dataMap;
+    if (x2 < x1 || y2 < y1)
+    {
+      return dataMap;
+    }
+
+    vtkSMPThreadLocal<MapOfAttributeHits> localDataMaps;
+    vtkSMPTools::For(y1, y2 + 1, [&](vtkIdType beginY, vtkIdType endY) {
+      MapOfAttributeHits& localDataMap = localDataMaps.Local();
+      PixelInformationComparator less;
+      PixelInformation lastKey;
+      AttributeHits* lastHits = nullptr;
+      for (int yy = static_cast<int>(beginY); yy < static_cast<int>(endY); ++yy)
+      {
+        for (int xx = x1; xx <= x2; ++xx)
+        {
+          if (!accept(xx, yy))
+          {
+            continue;
+          }
+          unsigned int pos[2] = { static_cast<unsigned int>(xx), static_cast<unsigned int>(yy) };
+          PixelInformation info = self->GetPixelInformation(pos, 0);
+          if (!info.Valid)
+          {
+            continue;
+          }
+          // neighbor pixels mostly hit the same block, often the same cell
+          if (!lastHits || less(info, lastKey) || less(lastKey, info))
+          {
+            lastHits = &localDataMap[info];
+            lastKey = info;
+          }
+          if (lastHits->Ids.empty() || lastHits->Ids.back() != info.AttributeID)
+          {
+            lastHits->Ids.push_back(info.AttributeID);
+          }
+          lastHits->PixelCount++;
+        }
+      }
+    });
+
+    for (MapOfAttributeHits& localDataMap : localDataMaps)
+    {
+      for (auto& localHits : localDataMap)
+      {
+        AttributeHits& hits = dataMap[localHits.first];
+        hits.Ids.insert(hits.Ids.end(), localHits.second.Ids.begin(), localHits.second.Ids.end());
+        hits.PixelCount += localHits.second.PixelCount;
+      }
+    }
+    for (auto& hits : dataMap)
+    {
+      std::vector<vtkIdType>& ids = hits.second.Ids;
+      std::sort(ids.begin(), ids.end());
+      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    }
+    return dataMap;
+  }
+
+  //-----------------------------------------------------------------------------
+  vtkSelection* ConvertSelection(int fieldassociation, const MapOfAttributeHits& dataMap)
   {
     vtkSelection* sel = vtkSelection::New();
 
-    MapOfAttributeIds::const_iterator iter;
+    MapOfAttributeHits::const_iterator iter;
     for (iter = dataMap.begin(); iter != dataMap.end(); ++iter)
     {
       const PixelInformation& key = iter->first;
-      const std::set<vtkIdType>& id_values = iter->second;
+      const std::vector<vtkIdType>& id_values = iter->second.Ids;
       vtkSelectionNode* child = vtkSelectionNode::New();
       child->SetContentType(vtkSelectionNode::INDICES);
       switch (fieldassociation)
@@ -115,8 +190,7 @@ public:
         child->GetProperties()->Set(vtkSelectionNode::ZBUFFER_VALUE(), this->ZValues[key.PropID]);
       }
 
-      PixelCountType::const_iterator pit = pixelCounts.find(key);
-      child->GetProperties()->Set(vtkSelectionNode::PIXEL_COUNT(), pit->second);
+      child->GetProperties()->Set(vtkSelectionNode::PIXEL_COUNT(), iter->second.PixelCount);
       if (key.ProcessID >= 0)
       {
         child->GetProperties()->Set(vtkSelectionNode::PROCESS_ID(), key.ProcessID);
@@ -127,14 +201,8 @@ public:
       vtkIdTypeArray* ids = vtkIdTypeArray::New();
       ids->SetName("SelectedIds");
       ids->SetNumberOfComponents(1);
-      ids->SetNumberOfTuples(static_cast<vtkIdType>(iter->second.size()));
-      vtkIdType* ptr = ids->GetPointer(0);
-      std::set<vtkIdType>::const_iterator idIter;
-      vtkIdType cc = 0;
-      for (idIter = id_values.begin(); idIter != id_values.end(); ++idIter, ++cc)
-      {
-        ptr[cc] = *idIter;
-      }
+      ids->SetNumberOfTuples(static_cast<vtkIdType>(id_values.size()));
+      std::copy(id_values.begin(), id_values.end(), ids->GetPointer(0));
       child->SetSelectionList(ids);
       ids->FastDelete();
       sel->AddNode(child);
@@ -145,7 +213,7 @@ public:
   }
 
   //-----------------------------------------------------------------------------
-  bool PixelInsidePolygon(float x, float y, int* polygonPoints, vtkIdType count)
+  static bool PixelInsidePolygon(float x, float y, int* polygonPoints, vtkIdType count)
   {
     // http://en.wikipedia.org/wiki/Point_in_polygon
     // RayCasting method shooting the ray along the x axis, using float
@@ -791,23 +859,10 @@ vtkHardwareSelector::PixelInformation vtkHardwareSelector::GetPixelInformation(
 vtkSelection* vtkHardwareSelector::GenerateSelection(
   unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
 {
-  vtkInternals::MapOfAttributeIds dataMap;
-  vtkInternals::PixelCountType pixelCounts;
-
-  for (unsigned int yy = y1; yy <= y2; yy++)
-  {
-    for (unsigned int xx = x1; xx <= x2; xx++)
-    {
-      unsigned int pos[2] = { xx, yy };
-      PixelInformation info = this->GetPixelInformation(pos, 0);
-      if (info.Valid)
-      {
-        dataMap[info].insert(info.AttributeID);
-        pixelCounts[info]++;
-      }
-    }
-  }
-  return this->Internals->ConvertSelection(this->FieldAssociation, dataMap, pixelCounts);
+  vtkInternals::MapOfAttributeHits dataMap = this->Internals->CollectHits(this,
+    static_cast<int>(x1), static_cast<int>(y1), static_cast<int>(x2), static_cast<int>(y2),
+    [](int, int) { return true; });
+  return this->Internals->ConvertSelection(this->FieldAssociation, dataMap);
 }
 
 //------------------------------------------------------------------------------
@@ -829,25 +884,11 @@ vtkSelection* vtkHardwareSelector::GeneratePolygonSelection(int* polygonPoints,
     y2 = std::max(polygonPoints[i + 1], y2);
   }
 
-  vtkInternals::MapOfAttributeIds dataMap;
-  vtkInternals::PixelCountType pixelCounts;
-  for (int yy = y1; yy <= y2; yy++)
-  {
-    for (int xx = x1; xx <= x2; xx++)
-    {
-      if (this->Internals->PixelInsidePolygon(xx, yy, polygonPoints, count))
-      {
-        unsigned int pos[2] = { static_cast<unsigned int>(xx), static_cast<unsigned int>(yy) };
-        PixelInformation info = this->GetPixelInformation(pos, 0);
-        if (info.Valid)
-        {
-          dataMap[info].insert(info.AttributeID);
-          pixelCounts[info]++;
-        }
-      }
-    }
-  }
-  return this->Internals->ConvertSelection(this->FieldAssociation, dataMap, pixelCounts);
+  vtkInternals::MapOfAttributeHits dataMap =
+    this->Internals->CollectHits(this, x1, y1, x2, y2, [&](int xx, int yy) {
+      return vtkInternals::PixelInsidePolygon(xx, yy, polygonPoints, count);
+    });
+  return this->Internals->ConvertSelection(this->FieldAssociation, dataMap);
 }
 
 //------------------------------------------------------------------------------
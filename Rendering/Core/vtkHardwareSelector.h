@@ -320,6 +320,8 @@ public:
    * to generate a selection from. The region must be a subregion
    * of the region specified by SetArea(), otherwise it will be
    * clipped to that region.
+   * The pixels are decoded concurrently with vtkSMPTools, so subclasses
+   * overriding GetPixelInformation() must support concurrent calls.
    */
   virtual vtkSelection* GenerateSelection() { return GenerateSelection(this->Area); }
   virtual vtkSelection* GenerateSelection(unsigned int r[4])
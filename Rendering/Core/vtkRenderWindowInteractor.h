@@ -110,6 +110,7 @@ public:
    * implement your own event loop. You still can use your own
    * event loop if you want.
    */
+  VTK_UNBLOCKTHREADS
   virtual void Start();
 
   /**
@@ -402,6 +403,7 @@ public:
    * Render the scene. Just pass the render call on to the
    * associated vtkRenderWindow.
    */
+  VTK_UNBLOCKTHREADS
   virtual void Render();
 
   ///@{
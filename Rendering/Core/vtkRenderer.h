@@ -653,7 +653,12 @@ public:
    * SetMultiSamples(0) ) to support depth peeling.
    * If UseDepthPeeling is on and the GPU supports it, depth peeling is used
    * for rendering translucent materials.
-   * If UseDepthPeeling is off, alpha blending is used.
+   * If UseDepthPeeling is off, the OpenGL renderer uses weighted blended order
+   * independent translucency, which renders translucent geometry in a single
+   * pass at the price of approximate blending where layers overlap.
+   * The time spent by each technique is reported by the render timer log of
+   * the render window, under "Dual Depth Peeling", "Depth Peeling" or
+   * "Weighted Blended OIT".
    * Initial value is off.
    */
   vtkSetMacro(UseDepthPeeling, vtkTypeBool);
@@ -30,6 +30,9 @@
 #include "vtkRange.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
+#include "vtkTimeStamp.h"
+
+#include <map>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -72,10 +75,37 @@ void GetBoundsComposite(vtkCompositeDataSet* cd, double bounds[6])
 }
 }
 
+//------------------------------------------------------------------------------
+struct vtkHyperTreeGridMapper::vtkInternals
+{
+  enum FilterType
+  {
+    ADAPTIVE_GEOMETRY,
+    HTG_GEOMETRY,
+    SURFACE
+  };
+
+  struct BlockFilter
+  {
+    FilterType Type = SURFACE;
+    vtkSmartPointer<vtkAlgorithm> Filter;
+  };
+
+  // Surface filters of the blocks, by flat index, kept between renders
+  std::map<unsigned int, BlockFilter> Filters;
+
+  // Surface of the last render and the time it was built
+  vtkSmartPointer<vtkCompositeDataSet> Output;
+  vtkTimeStamp OutputTime;
+};
+
 vtkObjectFactoryNewMacro(vtkHyperTreeGridMapper);
 
 //------------------------------------------------------------------------------
-vtkHyperTreeGridMapper::vtkHyperTreeGridMapper() = default;
+vtkHyperTreeGridMapper::vtkHyperTreeGridMapper()
+  : Internals(new vtkInternals())
+{
+}
 
 //------------------------------------------------------------------------------
 vtkHyperTreeGridMapper::~vtkHyperTreeGridMapper() = default;
@@ -151,55 +181,92 @@ vtkSmartPointer<vtkCompositeDataSet> vtkHyperTreeGridMapper::UpdateWithDecimatio
     useAdapt = false;
   }
 
-  vtkNew<vtkAdaptiveDataSetSurfaceFilter> adaptiveGeometryFilter;
-  vtkNew<vtkHyperTreeGridGeometry> geometryFilter;
-  vtkNew<vtkDataSetSurfaceFilter> surfaceFilter;
-
-  adaptiveGeometryFilter->SetRenderer(ren);
-
-  auto outputComposite = vtkSmartPointer<vtkCompositeDataSet>::Take(cds->NewInstance());
-  outputComposite->CopyStructure(cds);
-
+  // Update the surface filter of each block. A filter only executes when its
+  // block, or the view for the adaptive decimation, changed since last render.
+  std::map<unsigned int, vtkInternals::BlockFilter> filters;
+  bool changed = !this->Internals->Output;
   auto iter = vtkSmartPointer<vtkCompositeDataIterator>::Take(cds->NewIterator());
   iter->SkipEmptyNodesOn();
   for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
   {
     vtkDataObject* leaf = iter->GetCurrentDataObject();
+    vtkInternals::FilterType type;
     if (auto* htg = vtkHyperTreeGrid::SafeDownCast(leaf))
     {
-      if (useAdapt && htg->GetDimension() == 2)
-      {
-        // use adaptive decimation
-        adaptiveGeometryFilter->SetInputDataObject(htg);
-        adaptiveGeometryFilter->Update();
-        vtkDataObject* outputDS = adaptiveGeometryFilter->GetOutputDataObject(0);
-        auto newBlock = vtkSmartPointer<vtkDataObject>::Take(outputDS->NewInstance());
-        newBlock->ShallowCopy(outputDS);
-        outputComposite->SetDataSet(iter.Get(), newBlock);
-      }
-      else
+      // use adaptive decimation, or simply transform to polydata
+      type = useAdapt && htg->GetDimension() == 2 ? vtkInternals::ADAPTIVE_GEOMETRY
+                                                  : vtkInternals::HTG_GEOMETRY;
+    }
+    else if (vtkDataSet::SafeDownCast(leaf))
+    {
+      // other cases
+      type = vtkInternals::SURFACE;
+    }
+    else
+    {
+      continue;
+    }
+
+    const unsigned int index = iter->GetCurrentFlatIndex();
+    auto previous = this->Internals->Filters.find(index);
+    vtkInternals::BlockFilter block;
+    if (previous != this->Internals->Filters.end() && previous->second.Type == type)
+    {
+      block = previous->second;
+    }
+    else
+    {
+      changed = true;
+      block.Type = type;
+      switch (type)
       {
-        // simply transform to polydata
-        geometryFilter->SetInputDataObject(htg);
-        geometryFilter->Update();
-        vtkDataObject* outputDS = geometryFilter->GetOutputDataObject(0);
-        auto newBlock = vtkSmartPointer<vtkDataObject>::Take(outputDS->NewInstance());
-        newBlock->ShallowCopy(outputDS);
-        outputComposite->SetDataSet(iter.Get(), newBlock);
+        case vtkInternals::ADAPTIVE_GEOMETRY:
+          block.Filter = vtkSmartPointer<vtkAdaptiveDataSetSurfaceFilter>::New();
+          break;
+        case vtkInternals::HTG_GEOMETRY:
+          block.Filter = vtkSmartPointer<vtkHyperTreeGridGeometry>::New();
+          break;
+        default:
+          block.Filter = vtkSmartPointer<vtkDataSetSurfaceFilter>::New();
+          break;
       }
     }
-    else if (auto* ds = vtkDataSet::SafeDownCast(leaf))
+    if (type == vtkInternals::ADAPTIVE_GEOMETRY)
     {
-      // other cases
-      surfaceFilter->SetInputDataObject(ds);
-      surfaceFilter->Update();
-      vtkDataObject* outputDS = surfaceFilter->GetOutputDataObject(0);
+      vtkAdaptiveDataSetSurfaceFilter::SafeDownCast(block.Filter)->SetRenderer(ren);
+    }
+    block.Filter->SetInputDataObject(leaf);
+    block.Filter->Update();
+    changed =
+      changed || block.Filter->GetOutputDataObject(0)->GetMTime() > this->Internals->OutputTime;
+    filters[index] = block;
+  }
+  changed = changed || filters.size() != this->Internals->Filters.size();
+  this->Internals->Filters.swap(filters);
+
+  // Reuse the previous surface when no block changed, so that the internal
+  // mapper does not upload it again
+  if (!changed)
+  {
+    return this->Internals->Output;
+  }
+
+  auto outputComposite = vtkSmartPointer<vtkCompositeDataSet>::Take(cds->NewInstance());
+  outputComposite->CopyStructure(cds);
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    auto filter = this->Internals->Filters.find(iter->GetCurrentFlatIndex());
+    if (filter != this->Internals->Filters.end())
+    {
+      vtkDataObject* outputDS = filter->second.Filter->GetOutputDataObject(0);
       auto newBlock = vtkSmartPointer<vtkDataObject>::Take(outputDS->NewInstance());
       newBlock->ShallowCopy(outputDS);
       outputComposite->SetDataSet(iter.Get(), newBlock);
     }
   }
 
+  this->Internals->Output = outputComposite;
+  this->Internals->OutputTime.Modified();
   return outputComposite;
 }
 
@@ -39,6 +39,8 @@
 #include "vtkSetGet.h"       // Get macro
 #include "vtkSmartPointer.h" // For vtkSmartPointer
 
+#include <memory> // For std::unique_ptr
+
 #include "vtkRenderingHyperTreeGridModule.h" // For export macro
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -114,7 +116,10 @@ protected:
   ~vtkHyperTreeGridMapper() override;
 
   /**
-   * Generate a new composite were each leave is decimated if required
+   * Generate a new composite were each leave is decimated if required.
+   * The surface filters of the blocks are kept between calls, and the
+   * previous composite is returned when no block, nor the view for the
+   * adaptive decimation, changed.
    */
   vtkSmartPointer<vtkCompositeDataSet> UpdateWithDecimation(
     vtkCompositeDataSet* htg, vtkRenderer* ren);
@@ -132,6 +137,9 @@ protected:
 private:
   vtkHyperTreeGridMapper(const vtkHyperTreeGridMapper&) = delete;
   void operator=(const vtkHyperTreeGridMapper&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -25,7 +25,35 @@
 #include "vtkTimerLog.h"
 #include "vtkWindow.h"
 
+#include <map>
+#include <string>
+#include <utility>
+
 VTK_ABI_NAMESPACE_BEGIN
+class vtkFreeTypeLabelRenderStrategy::vtkInternals
+{
+public:
+  struct CachedLabel
+  {
+    vtkSmartPointer<vtkTextMapper> Mapper;
+    vtkIdType LastFrame;
+  };
+
+  // The cached mappers hold a reference to their text property, so a text
+  // property address cannot be reused by another one while it is a key.
+  std::map<std::pair<vtkTextProperty*, std::string>, CachedLabel> Labels;
+  vtkIdType Frame = 0;
+
+  void ReleaseGraphicsResources(vtkWindow* window)
+  {
+    for (auto& label : this->Labels)
+    {
+      label.second.Mapper->ReleaseGraphicsResources(window);
+    }
+    this->Labels.clear();
+  }
+};
+
 vtkStandardNewMacro(vtkFreeTypeLabelRenderStrategy);
 
 //------------------------------------------------------------------------------
@@ -35,11 +63,14 @@ vtkFreeTypeLabelRenderStrategy::vtkFreeTypeLabelRenderStrategy()
   this->Mapper = vtkTextMapper::New();
   this->Actor = vtkActor2D::New();
   this->Actor->SetMapper(this->Mapper);
+  this->MaximumNumberOfCachedLabels = 10000;
+  this->Internals = new vtkInternals;
 }
 
 //------------------------------------------------------------------------------
 vtkFreeTypeLabelRenderStrategy::~vtkFreeTypeLabelRenderStrategy()
 {
+  delete this->Internals;
   this->Mapper->Delete();
   this->Actor->Delete();
 }
@@ -47,6 +78,35 @@ vtkFreeTypeLabelRenderStrategy::~vtkFreeTypeLabelRenderStrategy()
 void vtkFreeTypeLabelRenderStrategy::ReleaseGraphicsResources(vtkWindow* window)
 {
   this->Actor->ReleaseGraphicsResources(window);
+  this->Internals->ReleaseGraphicsResources(window);
+}
+
+//------------------------------------------------------------------------------
+void vtkFreeTypeLabelRenderStrategy::StartFrame()
+{
+  ++this->Internals->Frame;
+}
+
+//------------------------------------------------------------------------------
+void vtkFreeTypeLabelRenderStrategy::EndFrame()
+{
+  vtkWindow* window = this->Renderer ? this->Renderer->GetVTKWindow() : nullptr;
+  auto& labels = this->Internals->Labels;
+  for (auto it = labels.begin(); it != labels.end();)
+  {
+    if (it->second.LastFrame != this->Internals->Frame)
+    {
+      if (window)
+      {
+        it->second.Mapper->ReleaseGraphicsResources(window);
+      }
+      it = labels.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
 }
 
 // double compute_bounds_time1 = 0;
@@ -154,11 +214,37 @@ void vtkFreeTypeLabelRenderStrategy::RenderLabel(
   {
     tprop = this->DefaultTextProperty;
   }
-  this->Mapper->SetTextProperty(tprop);
-  this->Mapper->SetInput(label.c_str());
+
+  // Reuse the mapper, and thus the texture, that rendered this label before.
+  vtkTextMapper* mapper = this->Mapper;
+  if (this->MaximumNumberOfCachedLabels > 0)
+  {
+    auto& labels = this->Internals->Labels;
+    auto key = std::make_pair(tprop, std::string(label));
+    auto it = labels.find(key);
+    if (it == labels.end() &&
+      static_cast<int>(labels.size()) < this->MaximumNumberOfCachedLabels)
+    {
+      vtkInternals::CachedLabel cached;
+      cached.Mapper = vtkSmartPointer<vtkTextMapper>::New();
+      cached.Mapper->SetTextProperty(tprop);
+      cached.Mapper->SetInput(label.c_str());
+      it = labels.emplace(std::move(key), cached).first;
+    }
+    if (it != labels.end())
+    {
+      it->second.LastFrame = this->Internals->Frame;
+      mapper = it->second.Mapper;
+    }
+  }
+  if (mapper == this->Mapper)
+  {
+    this->Mapper->SetTextProperty(tprop);
+    this->Mapper->SetInput(label.c_str());
+  }
   this->Actor->GetPositionCoordinate()->SetCoordinateSystemToDisplay();
   this->Actor->GetPositionCoordinate()->SetValue(x[0], x[1], 0.0);
-  this->Mapper->RenderOverlay(this->Renderer, this->Actor);
+  mapper->RenderOverlay(this->Renderer, this->Actor);
   // timer->StopTimer();
   // render_label_time1 += timer->GetElapsedTime();
   // render_label_iter1++;
@@ -172,5 +258,6 @@ void vtkFreeTypeLabelRenderStrategy::RenderLabel(
 void vtkFreeTypeLabelRenderStrategy::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaximumNumberOfCachedLabels: " << this->MaximumNumberOfCachedLabels << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -19,6 +19,10 @@
  *
  * Uses the FreeType to render labels and compute label sizes.
  * This strategy may be used with vtkLabelPlacementMapper.
+ *
+ * The texture of each label is kept from one frame to the next, as long as
+ * the label is rendered in each frame, so that labels are only rasterized and
+ * uploaded when they appear or when their text property changes.
  */
 
 #ifndef vtkFreeTypeLabelRenderStrategy_h
@@ -67,6 +71,25 @@ public:
    */
   void ReleaseGraphicsResources(vtkWindow* window) override;
 
+  ///@{
+  /**
+   * Start and end a rendering pass. The textures of the labels that were
+   * not rendered during the pass are released when it ends.
+   */
+  void StartFrame() override;
+  void EndFrame() override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of labels whose texture is kept between
+   * frames. Labels beyond this number are rasterized each time they are
+   * rendered. 0 disables the cache. Default is 10000.
+   */
+  vtkSetClampMacro(MaximumNumberOfCachedLabels, int, 0, VTK_INT_MAX);
+  vtkGetMacro(MaximumNumberOfCachedLabels, int);
+  ///@}
+
 protected:
   vtkFreeTypeLabelRenderStrategy();
   ~vtkFreeTypeLabelRenderStrategy() override;
@@ -74,10 +97,14 @@ protected:
   vtkTextRenderer* TextRenderer;
   vtkTextMapper* Mapper;
   vtkActor2D* Actor;
+  int MaximumNumberOfCachedLabels;
 
 private:
   vtkFreeTypeLabelRenderStrategy(const vtkFreeTypeLabelRenderStrategy&) = delete;
   void operator=(const vtkFreeTypeLabelRenderStrategy&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -95,7 +95,7 @@ vtkMatplotlibMathTextUtilities::Availability vtkMatplotlibMathTextUtilities::Che
     return UNAVAILABLE;
   }
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   if (PyErr_Occurred() || !PyImport_ImportModule("matplotlib") || PyErr_Occurred())
   {
     // FIXME: Check if we need this. Wouldn't pipe-ing the stdout/stderr make
@@ -167,7 +167,7 @@ void vtkMatplotlibMathTextUtilities::CleanupPythonObjects()
 {
   if (Py_IsInitialized())
   {
-    vtkPythonScopeGilEnsurer gilEnsurer;
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
     Py_XDECREF(this->MaskParser);
     Py_XDECREF(this->PathParser);
     Py_XDECREF(this->FontPropertiesClass);
@@ -190,7 +190,7 @@ bool vtkMatplotlibMathTextUtilities::InitializeMaskParser()
     return false;
   }
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject mplMathTextLib(PyImport_ImportModule("matplotlib.mathtext"));
   if (this->CheckForError(mplMathTextLib))
   {
@@ -225,7 +225,7 @@ bool vtkMatplotlibMathTextUtilities::InitializePathParser()
     return false;
   }
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject mplTextPathLib(PyImport_ImportModule("matplotlib.textpath"));
   if (this->CheckForError(mplTextPathLib))
   {
@@ -260,7 +260,7 @@ bool vtkMatplotlibMathTextUtilities::InitializeFontPropertiesClass()
     return false;
   }
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject mplFontManagerLib(PyImport_ImportModule("matplotlib.font_manager"));
   if (this->CheckForError(mplFontManagerLib))
   {
@@ -280,7 +280,7 @@ bool vtkMatplotlibMathTextUtilities::InitializeFontPropertiesClass()
 //------------------------------------------------------------------------------
 bool vtkMatplotlibMathTextUtilities::CheckForError()
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   PyObject* exception = PyErr_Occurred();
   if (exception)
   {
@@ -383,7 +383,7 @@ PyObject* vtkMatplotlibMathTextUtilities::GetFontProperties(vtkTextProperty* tpr
 
   tpropFontSize = tprop->GetFontSize();
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   return PyObject_CallFunction(this->FontPropertiesClass, const_cast<char*>("sssssi"), tpropFamily,
     tpropStyle, tpropVariant, tpropWeight, tpropStretch, tpropFontSize);
 }
@@ -711,7 +711,7 @@ bool vtkMatplotlibMathTextUtilities::ComputeRowsAndCols(const GridOfStrings& str
 bool vtkMatplotlibMathTextUtilities::ComputeCellRowsAndCols(const char* str, PyObject* pyFontProp,
   int dpi, std::uint64_t& rows, std::uint64_t& cols, vtkSmartPyObject* list)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
 
   // Call the parse method
   // ftimage, depth = parse(str, dpi, fontProp)
@@ -832,7 +832,7 @@ void vtkMatplotlibMathTextUtilities::ComputeTextColors(vtkTextProperty* tprop, T
 //------------------------------------------------------------------------------
 bool vtkMatplotlibMathTextUtilities::SetMathTextFont(vtkTextProperty* tprop)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject mplBase(PyImport_ImportModule("matplotlib"));
   if (this->CheckForError(mplBase))
   {
@@ -1427,7 +1427,7 @@ bool vtkMatplotlibMathTextUtilities::StringToPath(
     return false;
   }
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject pyResultTuple(PyObject_CallMethod(this->PathParser,
     const_cast<char*>("get_text_path"), const_cast<char*>("Osi"),
     pyFontProp.GetPointer(), // prop
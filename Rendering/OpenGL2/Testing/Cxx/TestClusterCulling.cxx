@@ -0,0 +1,161 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestClusterCulling.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that culling the clusters of triangles of a zoomed in surface outside
+// of the frustum or facing away from the camera renders the same images as
+// drawing all the triangles, with cell scalars that depend on the primitive
+// ids of the triangles drawn.
+
+#include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkCellData.h"
+#include "vtkFloatArray.h"
+#include "vtkNew.h"
+#include "vtkOpenGLPolyDataMapper.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkProperty.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->ShouldRerenderOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+bool SameImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Render with and without the culling of the clusters, return false if the
+// images differ or less than minimumCulled clusters are culled.
+bool CheckCulling(vtkRenderWindow* renWin, vtkOpenGLPolyDataMapper* mapper,
+  vtkIdType minimumCulled, vtkIdType& culled, const char* name)
+{
+  mapper->UseClusterCullingOff();
+  renWin->Render();
+  vtkSmartPointer<vtkUnsignedCharArray> reference = Capture(renWin);
+  mapper->UseClusterCullingOn();
+  renWin->Render();
+  culled = mapper->GetNumberOfCulledClusters();
+  std::cout << name << ": " << culled << " of " << mapper->GetNumberOfClusters()
+            << " clusters culled" << std::endl;
+  if (culled < minimumCulled || culled == mapper->GetNumberOfClusters())
+  {
+    std::cerr << "Unexpected number of culled clusters with " << name << std::endl;
+    return false;
+  }
+  if (!SameImages(reference, Capture(renWin)))
+  {
+    std::cerr << "Images differ with " << name << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestClusterCulling(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(200);
+  sphere->SetPhiResolution(200);
+  sphere->Update();
+  vtkNew<vtkPolyData> polyData;
+  polyData->ShallowCopy(sphere->GetOutput());
+  vtkNew<vtkFloatArray> cellScalars;
+  cellScalars->SetNumberOfTuples(polyData->GetNumberOfCells());
+  for (vtkIdType i = 0; i < polyData->GetNumberOfCells(); ++i)
+  {
+    cellScalars->SetValue(i, static_cast<float>(i % 7));
+  }
+  polyData->GetCellData()->SetScalars(cellScalars);
+
+  vtkNew<vtkOpenGLPolyDataMapper> mapper;
+  mapper->SetInputData(polyData);
+  mapper->SetScalarModeToUseCellData();
+  mapper->SetScalarRange(0.0, 6.0);
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+  renderer->ResetCamera();
+  renderer->GetActiveCamera()->Azimuth(30.0);
+  renderer->GetActiveCamera()->Zoom(4.0);
+  renderer->ResetCameraClippingRange();
+
+  vtkIdType frustumCulled;
+  if (!CheckCulling(renWin, mapper, 1, frustumCulled, "the frustum"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // the back of the sphere is culled too
+  vtkIdType culled;
+  actor->GetProperty()->BackfaceCullingOn();
+  if (!CheckCulling(renWin, mapper, frustumCulled + 1, culled, "backface culling"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // the front is culled instead, with a mirroring matrix
+  actor->GetProperty()->BackfaceCullingOff();
+  actor->GetProperty()->FrontfaceCullingOn();
+  actor->SetScale(-1.0, 1.0, 1.0);
+  if (!CheckCulling(renWin, mapper, frustumCulled + 1, culled, "mirrored frontface culling"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  actor->SetScale(1.0, 1.0, 1.0);
+  actor->GetProperty()->FrontfaceCullingOff();
+  actor->GetProperty()->BackfaceCullingOn();
+  renderer->GetActiveCamera()->ParallelProjectionOn();
+  renderer->GetActiveCamera()->Zoom(4.0);
+  renderer->ResetCameraClippingRange();
+  if (!CheckCulling(renWin, mapper, frustumCulled + 1, culled, "a parallel projection"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCompositePolyDataMapper2Batching.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that batching the draws of the blocks of vtkCompositePolyDataMapper2
+// renders the same images as drawing the blocks one by one, with block
+// colors, opacities and visibilities, edges, and point or cell scalars.
+
+#include "vtkActor.h"
+#include "vtkCompositeDataDisplayAttributes.h"
+#include "vtkCompositePolyDataMapper2.h"
+#include "vtkElevationFilter.h"
+#include "vtkIdFilter.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkProperty.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+bool SameImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool RenderSameBatched(vtkRenderWindow* renWin, vtkCompositePolyDataMapper2* mapper)
+{
+  mapper->BatchBlockDrawsOff();
+  renWin->Render();
+  vtkSmartPointer<vtkUnsignedCharArray> reference = Capture(renWin);
+  mapper->BatchBlockDrawsOn();
+  renWin->Render();
+  return SameImages(reference, Capture(renWin));
+}
+}
+
+int TestCompositePolyDataMapper2Batching(int, char*[])
+{
+  const int numberOfBlocks = 20;
+  vtkNew<vtkMultiBlockDataSet> data;
+  data->SetNumberOfBlocks(numberOfBlocks * numberOfBlocks);
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetRadius(0.4);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->SetLowPoint(0.0, 0.0, 0.0);
+  elevation->SetHighPoint(numberOfBlocks, numberOfBlocks, 0.0);
+  vtkNew<vtkIdFilter> ids;
+  ids->SetInputConnection(elevation->GetOutputPort());
+  ids->SetCellIdsArrayName("CellIds");
+  ids->PointIdsOff();
+  for (int i = 0; i < numberOfBlocks * numberOfBlocks; ++i)
+  {
+    sphere->SetCenter(i % numberOfBlocks, i / numberOfBlocks, 0.0);
+    ids->Update();
+    vtkNew<vtkPolyData> block;
+    block->DeepCopy(ids->GetOutput());
+    data->SetBlock(i, block);
+  }
+
+  vtkNew<vtkCompositePolyDataMapper2> mapper;
+  vtkNew<vtkCompositeDataDisplayAttributes> attributes;
+  mapper->SetCompositeDataDisplayAttributes(attributes);
+  mapper->SetInputDataObject(data);
+  // Flat indices start at 1 for the children of the root.
+  for (unsigned int i = 1; i <= numberOfBlocks * numberOfBlocks; ++i)
+  {
+    if (i % 7 == 0)
+    {
+      mapper->SetBlockColor(i, 1.0, 0.5, 0.0);
+    }
+    if (i % 13 == 0)
+    {
+      mapper->SetBlockOpacity(i, 0.5);
+    }
+    if (i % 5 == 0)
+    {
+      mapper->SetBlockVisibility(i, false);
+    }
+  }
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(400, 400);
+  renWin->AddRenderer(renderer);
+  renderer->ResetCamera();
+
+  mapper->ScalarVisibilityOff();
+  if (!RenderSameBatched(renWin, mapper))
+  {
+    std::cerr << "Images differ without scalars" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  actor->GetProperty()->EdgeVisibilityOn();
+  actor->GetProperty()->SetEdgeColor(0.0, 0.0, 1.0);
+  if (!RenderSameBatched(renWin, mapper))
+  {
+    std::cerr << "Images differ with edges" << std::endl;
+    return EXIT_FAILURE;
+  }
+  actor->GetProperty()->EdgeVisibilityOff();
+
+  mapper->ScalarVisibilityOn();
+  mapper->SetScalarModeToUsePointData();
+  if (!RenderSameBatched(renWin, mapper))
+  {
+    std::cerr << "Images differ with point scalars" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  mapper->SetScalarModeToUseCellFieldData();
+  mapper->SelectColorArray("CellIds");
+  mapper->SetScalarRange(0.0, 100.0);
+  if (!RenderSameBatched(renWin, mapper))
+  {
+    std::cerr << "Images differ with cell scalars" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/*=========================================================================
+
+ Program:   Visualization Toolkit
+
+ Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+ All rights reserved.
+ See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+ This software is distributed WITHOUT ANY WARRANTY; without even
+ the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ PURPOSE.  See the above copyright notice for more information.
+
+ =========================================================================*/
+// Render the normals of the surface of rows of particles smoothed by the
+// narrow range filter of vtkOpenGLFluidMapper, applied in 2D and separably.
+// The rows make ridges that a filter along a single direction of the screen
+// cannot smooth. The separable filter smooths slightly less isotropically than
+// the 2D one, so the images are not compared to a baseline but to each other:
+// with the ridges along either direction of the screen, the separable filter
+// must give an image much closer to the 2D filter than the unfiltered surface.
+
+#include "vtkCamera.h"
+#include "vtkImageData.h"
+#include "vtkImageDifference.h"
+#include "vtkNew.h"
+#include "vtkOpenGLFluidMapper.h"
+#include "vtkOpenGLRenderer.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRenderWindow.h"
+#include "vtkSmartPointer.h"
+#include "vtkVolume.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> Capture(vtkRenderWindow* renderWindow)
+{
+  renderWindow->Render();
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renderWindow);
+  capture->Update();
+  auto image = vtkSmartPointer<vtkImageData>::New();
+  image->DeepCopy(capture->GetOutput());
+  return image;
+}
+
+double Difference(vtkImageData* image, vtkImageData* reference)
+{
+  vtkNew<vtkImageDifference> difference;
+  difference->SetInputData(image);
+  difference->SetImageData(reference);
+  difference->Update();
+  return difference->GetError();
+}
+}
+
+//------------------------------------------------------------------------------
+int TestFluidMapperSeparable(int, char*[])
+{
+  // Rows of particles along x, dense enough to make ridges
+  vtkNew<vtkPoints> points;
+  for (int z = 0; z < 3; ++z)
+  {
+    for (int y = 0; y < 20; ++y)
+    {
+      for (int x = 0; x < 100; ++x)
+      {
+        points->InsertNextPoint(x * 0.03, y * 0.15, z * 0.1);
+      }
+    }
+  }
+  vtkNew<vtkPolyData> particles;
+  particles->SetPoints(points);
+
+  vtkNew<vtkOpenGLFluidMapper> fluidMapper;
+  fluidMapper->SetInputData(particles);
+  fluidMapper->SetParticleRadius(0.1f);
+  fluidMapper->SetSurfaceFilterIterations(3);
+  fluidMapper->SetSurfaceFilterRadius(5);
+  fluidMapper->SetSurfaceFilterMethod(vtkOpenGLFluidMapper::FluidSurfaceFilterMethod::NarrowRange);
+  if (fluidMapper->GetSeparableSurfaceFilter())
+  {
+    std::cerr << "SeparableSurfaceFilter is not off by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkVolume> volume;
+  volume->SetMapper(fluidMapper);
+  vtkNew<vtkOpenGLRenderer> renderer;
+  renderer->SetBackground(0.0, 0.0, 0.0);
+  renderer->AddVolume(volume);
+  vtkNew<vtkRenderWindow> renderWindow;
+  renderWindow->SetSize(300, 300);
+  renderWindow->SetMultiSamples(0);
+  renderWindow->AddRenderer(renderer);
+
+  // Horizontal, then vertical ridges
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->SetPosition(1.5, 1.5, 8.0);
+  camera->SetFocalPoint(1.5, 1.5, 0.1);
+  const double viewUps[2][3] = { { 0.0, 1.0, 0.0 }, { 1.0, 0.0, 0.0 } };
+  for (const auto& viewUp : viewUps)
+  {
+    camera->SetViewUp(viewUp);
+    renderer->ResetCameraClippingRange();
+
+    fluidMapper->SetDisplayMode(vtkOpenGLFluidMapper::FluidDisplayMode::FilteredSurfaceNormal);
+    fluidMapper->SeparableSurfaceFilterOff();
+    vtkSmartPointer<vtkImageData> filtered2D = Capture(renderWindow);
+    fluidMapper->SeparableSurfaceFilterOn();
+    vtkSmartPointer<vtkImageData> separable = Capture(renderWindow);
+    fluidMapper->SetDisplayMode(vtkOpenGLFluidMapper::FluidDisplayMode::UnfilteredSurfaceNormal);
+    vtkSmartPointer<vtkImageData> unfiltered = Capture(renderWindow);
+
+    const double separableError = Difference(separable, filtered2D);
+    const double unfilteredError = Difference(unfiltered, filtered2D);
+    std::cout << "Difference with the 2D filter of the separable filter: " << separableError
+              << ", of the unfiltered surface: " << unfilteredError << std::endl;
+    if (separableError >= 0.25 * unfilteredError)
+    {
+      std::cerr << "The separable filter does not match the 2D filter with the view up ("
+                << viewUp[0] << ", " << viewUp[1] << ", " << viewUp[2] << ")" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
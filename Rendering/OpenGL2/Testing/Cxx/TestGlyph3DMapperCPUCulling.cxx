@@ -0,0 +1,161 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGlyph3DMapperCPUCulling.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the glyph instances culled and sorted by LOD on the CPU are the
+// ones culled and sorted on the GPU, when the GPU supports it, and that the
+// instances outside of the view are culled.
+
+#include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkOpenGLGlyph3DMapper.h"
+#include "vtkPlaneSource.h"
+#include "vtkPointData.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+bool SameImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<vtkIdType> GetStatistics(vtkOpenGLGlyph3DMapper* glypher)
+{
+  std::vector<vtkIdType> stats(1, glypher->GetNumberOfCulledInstances());
+  for (vtkIdType i = 0; i < 2; ++i)
+  {
+    stats.push_back(glypher->GetNumberOfInstancesInLOD(i));
+  }
+  return stats;
+}
+}
+
+int TestGlyph3DMapperCPUCulling(int, char*[])
+{
+  const int res = 20;
+  vtkNew<vtkPlaneSource> plane;
+  plane->SetResolution(res, res);
+
+  vtkNew<vtkSphereSource> squad;
+  squad->SetPhiResolution(10);
+  squad->SetThetaResolution(10);
+  squad->SetRadius(0.02);
+
+  vtkNew<vtkOpenGLGlyph3DMapper> glypher;
+  glypher->SetInputConnection(plane->GetOutputPort());
+  glypher->SetSourceConnection(squad->GetOutputPort());
+  glypher->SetCullingAndLOD(true);
+  glypher->SetNumberOfLOD(1);
+  glypher->SetLODDistanceAndTargetReduction(0, 15.0, 0.5);
+  glypher->SetLODColoring(true);
+
+  vtkNew<vtkActor> glyphActor;
+  glyphActor->SetMapper(glypher);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->SetBackground(0.5, 0.5, 0.5);
+  renderer->AddActor(glyphActor);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+
+  // look along the plane so that the glyphs are at various distances, and
+  // zoom so that some glyphs are outside of the view
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->SetPosition(0.1, -1.0, 0.3);
+  camera->SetFocalPoint(0.0, 0.0, 0.0);
+  camera->SetViewUp(0.0, 0.0, 1.0);
+  camera->SetViewAngle(40.0);
+  renderer->ResetCameraClippingRange();
+
+  glypher->ForceCPUCullingOn();
+  renWin->Render();
+  std::vector<vtkIdType> cpuStats = GetStatistics(glypher);
+  vtkSmartPointer<vtkUnsignedCharArray> cpuImage = Capture(renWin);
+
+  const vtkIdType numberOfGlyphs = (res + 1) * (res + 1);
+  if (cpuStats[0] + cpuStats[1] + cpuStats[2] != numberOfGlyphs)
+  {
+    std::cerr << "Expected " << numberOfGlyphs << " glyphs drawn or culled" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (cpuStats[0] == 0 || cpuStats[1] == 0 || cpuStats[2] == 0)
+  {
+    std::cerr << "Expected culled glyphs and glyphs drawn with every LOD, got " << cpuStats[0]
+              << " culled and " << cpuStats[1] << ", " << cpuStats[2] << " drawn" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the instances are all drawn with the glyph at full resolution without culling
+  glypher->SetCullingAndLOD(false);
+  renWin->Render();
+  if (glypher->GetNumberOfCulledInstances() != 0 ||
+    glypher->GetNumberOfInstancesInLOD(0) != numberOfGlyphs)
+  {
+    std::cerr << "Expected all the glyphs drawn without culling" << std::endl;
+    return EXIT_FAILURE;
+  }
+  glypher->SetCullingAndLOD(true);
+
+  glypher->ForceCPUCullingOff();
+  if (glypher->GetMaxNumberOfLOD() < 1)
+  {
+    std::cout << "The GPU path cannot be compared, this GPU does not support LODs." << std::endl;
+    return EXIT_SUCCESS;
+  }
+  renWin->Render();
+  if (GetStatistics(glypher) != cpuStats)
+  {
+    std::cerr << "The glyphs culled or drawn with each LOD differ on the GPU" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameImages(cpuImage, Capture(renWin)))
+  {
+    std::cerr << "Images differ between the CPU and the GPU" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestOcclusionCuller.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkOpenGLOcclusionCuller culls the actors and the blocks hidden
+// behind a wall, and that the images rendered with and without the culler
+// are the same once the culler caught up with the view.
+
+#include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkCompositePolyDataMapper2.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkOpenGLOcclusionCuller.h"
+#include "vtkPlaneSource.h"
+#include "vtkPointData.h"
+#include "vtkPolyDataMapper.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> MakeSphere(double x, double y, double z)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(x, y, z);
+  sphere->SetRadius(0.3);
+  sphere->Update();
+  return sphere->GetOutput();
+}
+
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+bool SameImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestOcclusionCuller(int, char*[])
+{
+  vtkNew<vtkRenderer> renderer;
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+
+  // A wall hides the actors and blocks centered on x = 0.
+  vtkNew<vtkPlaneSource> wall;
+  wall->SetOrigin(-2.0, -2.0, 0.0);
+  wall->SetPoint1(2.0, -2.0, 0.0);
+  wall->SetPoint2(-2.0, 2.0, 0.0);
+  vtkNew<vtkPolyDataMapper> wallMapper;
+  wallMapper->SetInputConnection(wall->GetOutputPort());
+  vtkNew<vtkActor> wallActor;
+  wallActor->SetMapper(wallMapper);
+  renderer->AddActor(wallActor);
+
+  const int numberOfHiddenActors = 9;
+  for (int i = 0; i < numberOfHiddenActors; ++i)
+  {
+    vtkNew<vtkPolyDataMapper> mapper;
+    mapper->SetInputData(MakeSphere(i % 3 - 1.0, i / 3 - 1.0, -2.0));
+    vtkNew<vtkActor> actor;
+    actor->SetMapper(mapper);
+    renderer->AddActor(actor);
+  }
+  vtkNew<vtkPolyDataMapper> visibleMapper;
+  visibleMapper->SetInputData(MakeSphere(-3.0, 0.0, -2.0));
+  vtkNew<vtkActor> visibleActor;
+  visibleActor->SetMapper(visibleMapper);
+  renderer->AddActor(visibleActor);
+
+  const int numberOfHiddenBlocks = 3;
+  vtkNew<vtkMultiBlockDataSet> blocks;
+  for (int i = 0; i < numberOfHiddenBlocks; ++i)
+  {
+    blocks->SetBlock(i, MakeSphere(0.5 * i - 0.5, 1.5, -3.0));
+  }
+  blocks->SetBlock(numberOfHiddenBlocks, MakeSphere(3.0, 0.0, -2.0));
+  vtkNew<vtkCompositePolyDataMapper2> compositeMapper;
+  compositeMapper->SetInputDataObject(blocks);
+  vtkNew<vtkActor> compositeActor;
+  compositeActor->SetMapper(compositeMapper);
+  renderer->AddActor(compositeActor);
+
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->SetPosition(0.0, 0.0, 10.0);
+  camera->SetFocalPoint(0.0, 0.0, -1.0);
+  camera->SetViewAngle(40.0);
+  renderer->ResetCameraClippingRange();
+  renWin->Render();
+  vtkSmartPointer<vtkUnsignedCharArray> reference = Capture(renWin);
+
+  vtkNew<vtkOpenGLOcclusionCuller> culler;
+  renderer->AddCuller(culler);
+
+  // All the props are rendered and tested at the first frame, the occluded
+  // ones are culled from the second one.
+  renWin->Render();
+  if (culler->GetNumberOfOccludedProps() != 0 || culler->GetNumberOfQueries() == 0)
+  {
+    std::cerr << "Expected queries and no culling at the first frame" << std::endl;
+    return EXIT_FAILURE;
+  }
+  renWin->Render();
+  if (culler->GetNumberOfOccludedProps() != numberOfHiddenActors ||
+    culler->GetNumberOfOccludedBlocks() != numberOfHiddenBlocks)
+  {
+    std::cerr << "Expected " << numberOfHiddenActors << " occluded props and "
+              << numberOfHiddenBlocks << " occluded blocks, got "
+              << culler->GetNumberOfOccludedProps() << " and "
+              << culler->GetNumberOfOccludedBlocks() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameImages(Capture(renWin), reference))
+  {
+    std::cerr << "Images differ with the props occluded" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Look from behind the wall: the props reappear one frame later.
+  camera->Azimuth(180.0);
+  renderer->ResetCameraClippingRange();
+  renWin->Render();
+  if (culler->GetNumberOfOccludedProps() != numberOfHiddenActors)
+  {
+    std::cerr << "Expected the occluded props to be culled until tested again" << std::endl;
+    return EXIT_FAILURE;
+  }
+  renWin->Render();
+  if (culler->GetNumberOfOccludedProps() != 0 || culler->GetNumberOfOccludedBlocks() != 0)
+  {
+    std::cerr << "Expected no occluded props from behind the wall, got "
+              << culler->GetNumberOfOccludedProps() << " and "
+              << culler->GetNumberOfOccludedBlocks() << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkSmartPointer<vtkUnsignedCharArray> uncovered = Capture(renWin);
+
+  // The culler stops hiding anything once removed.
+  renderer->RemoveCuller(culler);
+  renWin->Render();
+  if (!SameImages(uncovered, Capture(renWin)))
+  {
+    std::cerr << "Images differ with the props uncovered" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestProgressiveRefinementPass.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkProgressiveRefinementPass accumulates samples until
+// converged, restarts when the camera moves, and that its first sample is the
+// image rendered without it.
+
+#include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkOpenGLRenderer.h"
+#include "vtkPointData.h"
+#include "vtkPolyDataMapper.h"
+#include "vtkProgressiveRefinementPass.h"
+#include "vtkRenderStepsPass.h"
+#include "vtkRenderWindow.h"
+#include "vtkSSAOPass.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->ShouldRerenderOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+bool SameImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestProgressiveRefinementPass(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(32);
+  sphere->SetPhiResolution(32);
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+
+  vtkNew<vtkOpenGLRenderer> renderer;
+  renderer->SetBackground(0.2, 0.3, 0.4);
+  renderer->AddActor(actor);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(200, 200);
+  renWin->AddRenderer(renderer);
+  renderer->ResetCamera();
+
+  renWin->Render();
+  vtkSmartPointer<vtkUnsignedCharArray> reference = Capture(renWin);
+
+  vtkNew<vtkRenderStepsPass> steps;
+  vtkNew<vtkProgressiveRefinementPass> progressive;
+  progressive->SetDelegatePass(steps);
+  progressive->SetTimeBudget(0.0);
+  progressive->SetMaximumNumberOfSamples(4);
+  renderer->SetPass(progressive);
+
+  // one sample for each render without time budget
+  for (int i = 1; i <= 4; ++i)
+  {
+    renWin->Render();
+    if (progressive->GetNumberOfSamples() != i || progressive->GetConverged() != (i == 4))
+    {
+      std::cerr << "Expected " << i << " samples, got " << progressive->GetNumberOfSamples()
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (i == 1 && !SameImages(reference, Capture(renWin)))
+    {
+      std::cerr << "The first sample differs from the image rendered without the pass"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  vtkSmartPointer<vtkUnsignedCharArray> converged = Capture(renWin);
+  if (SameImages(reference, converged))
+  {
+    std::cerr << "Expected the jittered samples to antialias the image" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the converged image is displayed again without rendering
+  renWin->Render();
+  if (progressive->GetNumberOfSamples() != 4 || progressive->GetNumberOfRenderedProps() != 0 ||
+    !SameImages(converged, Capture(renWin)))
+  {
+    std::cerr << "Expected the converged image to be displayed again" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // moving the camera restarts the accumulation
+  renderer->GetActiveCamera()->Azimuth(10.0);
+  renWin->Render();
+  if (progressive->GetNumberOfSamples() != 1)
+  {
+    std::cerr << "Expected the accumulation to restart when the camera moves" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // a large budget converges in a single render
+  progressive->SetTimeBudget(1000.0);
+  progressive->SetMaximumNumberOfSamples(8);
+  renWin->Render();
+  if (!progressive->GetConverged() || progressive->GetNumberOfSamples() != 8)
+  {
+    std::cerr << "Expected the image to converge within the time budget" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the kernel of the ambient occlusion is rotated between the samples
+  vtkNew<vtkSSAOPass> ssao;
+  ssao->SetDelegatePass(steps);
+  ssao->SetRadius(0.2);
+  progressive->SetDelegatePass(ssao);
+  progressive->Reset();
+  renWin->Render();
+  if (!progressive->GetConverged())
+  {
+    std::cerr << "Expected the ambient occlusion to converge" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
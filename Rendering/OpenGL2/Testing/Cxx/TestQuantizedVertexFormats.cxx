@@ -0,0 +1,160 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestQuantizedVertexFormats.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that quantizing the positions and encoding the normals of the VBOs
+// shrink them and render images close to the ones of the float VBOs, with
+// vtkOpenGLPolyDataMapper and vtkOpenGLPointGaussianMapper.
+
+#include "vtkActor.h"
+#include "vtkElevationFilter.h"
+#include "vtkNew.h"
+#include "vtkOpenGLPointGaussianMapper.h"
+#include "vtkOpenGLPolyDataMapper.h"
+#include "vtkOpenGLVertexBufferObject.h"
+#include "vtkOpenGLVertexBufferObjectGroup.h"
+#include "vtkPointData.h"
+#include "vtkPointSource.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->ShouldRerenderOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+// Return true if less than 1% of the pixels differ noticeably.
+bool CloseImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  vtkIdType different = 0;
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (std::abs(a->GetTypedComponent(i, c) - b->GetTypedComponent(i, c)) > 8)
+      {
+        ++different;
+        break;
+      }
+    }
+  }
+  std::cout << different << " pixels differ" << std::endl;
+  return different < a->GetNumberOfTuples() / 100;
+}
+}
+
+int TestQuantizedVertexFormats(int, char*[])
+{
+  // away from the origin, where float coordinates are not exact either
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(1000.0, 2000.0, 3000.0);
+  sphere->SetRadius(10.0);
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->SetLowPoint(1000.0, 1990.0, 3000.0);
+  elevation->SetHighPoint(1000.0, 2010.0, 3000.0);
+
+  vtkNew<vtkOpenGLPolyDataMapper> mapper;
+  mapper->SetInputConnection(elevation->GetOutputPort());
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+  renderer->ResetCamera();
+
+  renWin->Render();
+  vtkSmartPointer<vtkUnsignedCharArray> reference = Capture(renWin);
+  vtkOpenGLVertexBufferObjectGroup* vbos = mapper->GetVBOs();
+  const unsigned int floatStrides[2] = { vbos->GetVBO("vertexMC")->GetStride(),
+    vbos->GetVBO("normalMC")->GetStride() };
+
+  mapper->UseQuantizedPositionsOn();
+  mapper->UseOctahedralNormalsOn();
+  renWin->Render();
+  vtkOpenGLVertexBufferObject* positions = vbos->GetVBO("vertexMC");
+  vtkOpenGLVertexBufferObject* normals = vbos->GetVBO("normalMC");
+  if (positions->GetDataType() != VTK_UNSIGNED_SHORT ||
+    positions->GetStride() >= floatStrides[0] || normals->GetNumberOfComponents() != 2 ||
+    normals->GetStride() >= floatStrides[1])
+  {
+    std::cerr << "Expected smaller VBOs, got strides of " << positions->GetStride() << " and "
+              << normals->GetStride() << " bytes" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!CloseImages(reference, Capture(renWin)))
+  {
+    std::cerr << "Images differ with quantized positions and normals" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the float VBOs are back when turned off
+  mapper->UseQuantizedPositionsOff();
+  mapper->UseOctahedralNormalsOff();
+  renWin->Render();
+  if (vbos->GetVBO("vertexMC")->GetDataType() != VTK_FLOAT ||
+    vbos->GetVBO("normalMC")->GetNumberOfComponents() != 3)
+  {
+    std::cerr << "Expected float VBOs" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // splats of a point cloud
+  renderer->RemoveActor(actor);
+  vtkNew<vtkPointSource> cloud;
+  cloud->SetCenter(1000.0, 2000.0, 3000.0);
+  cloud->SetRadius(10.0);
+  cloud->SetNumberOfPoints(2000);
+  vtkNew<vtkOpenGLPointGaussianMapper> splatMapper;
+  splatMapper->SetInputConnection(cloud->GetOutputPort());
+  splatMapper->EmissiveOff();
+  splatMapper->SetScaleFactor(0.4);
+  vtkNew<vtkActor> splats;
+  splats->SetMapper(splatMapper);
+  renderer->AddActor(splats);
+  renderer->ResetCamera();
+  renWin->Render();
+  reference = Capture(renWin);
+
+  splatMapper->UseQuantizedPositionsOn();
+  renWin->Render();
+  if (!CloseImages(reference, Capture(renWin)))
+  {
+    std::cerr << "Images differ with quantized splat positions" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
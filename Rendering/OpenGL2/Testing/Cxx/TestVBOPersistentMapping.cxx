@@ -0,0 +1,170 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestVBOPersistentMapping.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that streaming time varying points through persistently mapped
+// buffers renders the same images as uploading them with glBufferData, while
+// the uploads go round the ring of the buffer and the points grow.
+
+#include "vtkActor.h"
+#include "vtkElevationFilter.h"
+#include "vtkNew.h"
+#include "vtkOpenGLPolyDataMapper.h"
+#include "vtkOpenGLVertexBufferObject.h"
+#include "vtkOpenGLVertexBufferObjectGroup.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include "vtk_glew.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->ShouldRerenderOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+bool SameImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Render a sphere whose points move at every frame, with more points from
+// the middle frame on, and return the images of the frames.
+std::vector<vtkSmartPointer<vtkUnsignedCharArray>> RenderFrames(bool persistent, bool& streamed)
+{
+  vtkOpenGLVertexBufferObject::SetGlobalPersistentMappingEnabled(persistent);
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->SetLowPoint(0.0, -0.5, 0.0);
+  elevation->SetHighPoint(0.0, 0.5, 0.0);
+  vtkNew<vtkPolyData> polyData;
+
+  vtkNew<vtkOpenGLPolyDataMapper> mapper;
+  mapper->SetInputData(polyData);
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+
+  std::vector<vtkSmartPointer<vtkUnsignedCharArray>> images;
+  streamed = false;
+  const int numberOfFrames = 10;
+  for (int frame = 0; frame < numberOfFrames; ++frame)
+  {
+    if (frame == 0)
+    {
+      elevation->Update();
+      polyData->DeepCopy(elevation->GetOutput());
+      renderer->ResetCamera();
+    }
+    else if (frame == numberOfFrames / 2)
+    {
+      // more points in the same array, that outgrow the regions of the ring
+      sphere->SetThetaResolution(128);
+      elevation->Update();
+      vtkPolyData* output = vtkPolyData::SafeDownCast(elevation->GetOutput());
+      polyData->GetPoints()->DeepCopy(output->GetPoints());
+      polyData->SetPolys(output->GetPolys());
+      polyData->GetPointData()->DeepCopy(output->GetPointData());
+    }
+    vtkPoints* points = polyData->GetPoints();
+    for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+    {
+      double p[3];
+      points->GetPoint(i, p);
+      p[0] += 0.01 * (i % 3);
+      points->SetPoint(i, p);
+    }
+    points->Modified();
+    renWin->Render();
+    images.push_back(Capture(renWin));
+
+    vtkOpenGLVertexBufferObject* vbo = mapper->GetVBOs()->GetVBO("vertexMC");
+    streamed = streamed || (vbo && vbo->GetDataOffset() != 0);
+  }
+#ifndef GL_ES_VERSION_3_0
+  if (persistent && !GLEW_ARB_buffer_storage)
+#else
+  if (persistent)
+#endif
+  {
+    // glBufferData is used instead
+    streamed = true;
+  }
+  return images;
+}
+}
+
+int TestVBOPersistentMapping(int, char*[])
+{
+  bool streamed;
+  auto references = RenderFrames(false, streamed);
+  if (streamed)
+  {
+    std::cerr << "The points are streamed without persistent mapping" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto images = RenderFrames(true, streamed);
+  vtkOpenGLVertexBufferObject::SetGlobalPersistentMappingEnabled(false);
+  if (!streamed)
+  {
+    std::cerr << "The points are not streamed with persistent mapping" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (size_t i = 0; i < references.size(); ++i)
+  {
+    if (!SameImages(references[i], images[i]))
+    {
+      std::cerr << "Images differ at frame " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
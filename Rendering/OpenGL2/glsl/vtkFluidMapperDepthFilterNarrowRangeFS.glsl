@@ -22,6 +22,8 @@ uniform int       filterRadius = 5;
 uniform float     lambda       = 10.0f;
 uniform float     mu           = 1.0f;
 uniform float     farZValue;
+// (1, 0) or (0, 1) for a pass of a separable filter, (0, 0) for a 2D filter
+uniform vec2      filterDirection = vec2(0.0f, 0.0f);
 
 in vec2 texCoord;
 
@@ -131,6 +133,57 @@ float filter2D(float pixelDepth)
   return filterVal.x / filterVal.y;
 }
 
+// One-dimensional version of filter2D along filterDirection, for separable filtering
+float filter1D(float pixelDepth)
+{
+  if(filterRadius == 0) {
+      return pixelDepth;
+  }
+
+  vec2  blurRadius = vec2(1.0 / viewportWidth, 1.0 / viewportHeight);
+  float threshold  = particleRadius * lambda;
+  float ratio      = viewportHeight / 2.0 / tan(PI_OVER_8);
+  float K          = -filterRadius * ratio * particleRadius * 0.1f;
+  int   filterSize = min(MAX_ADAPTIVE_RADIUS, int(ceil(K / pixelDepth)));
+
+  float upper       = pixelDepth + threshold;
+  float lower       = pixelDepth - threshold;
+  float lower_clamp = pixelDepth - particleRadius * mu;
+
+  float sigma      = filterSize / 3.0f;
+  float two_sigma2 = 2.0f * sigma * sigma;
+
+  vec2 delta = blurRadius * filterDirection;
+  vec2 f_tex1 = texCoord;
+  vec2 f_tex2 = texCoord;
+
+  vec2 r     = vec2(0, 0);
+  float sum  = pixelDepth;
+  float wsum = 1;
+  vec2 sampleDepth;
+  vec2 w2;
+
+  for(int i = 1; i <= filterSize; ++i)
+  {
+    r      += delta;
+    f_tex1 += delta;
+    f_tex2 -= delta;
+
+    sampleDepth.x = texture(fluidZTexture, f_tex1).r;
+    sampleDepth.y = texture(fluidZTexture, f_tex2).r;
+
+    w2 = vec2(compute_weight2D(blurRadius * r, two_sigma2));
+
+    modifiedGaussianFilter2D(sampleDepth.x, w2.x, w2.y, upper, lower, lower_clamp, threshold);
+    modifiedGaussianFilter2D(sampleDepth.y, w2.y, w2.x, upper, lower, lower_clamp, threshold);
+
+    sum  += dot(sampleDepth, w2);
+    wsum += w2.x + w2.y;
+  }
+
+  return sum / wsum;
+}
+
 //-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 void main()
 {
@@ -140,6 +193,10 @@ void main()
   {
     finalDepth = pixelDepth;
   }
+  else if (filterDirection != vec2(0.0f, 0.0f))
+  {
+    finalDepth = filter1D(pixelDepth);
+  }
   else
   {
     finalDepth = filter2D(pixelDepth);
@@ -43,6 +43,7 @@ public:
   double Opacity;
   bool IsOpaque;
   bool Visibility;
+  bool Occluded;
   bool Pickability;
   bool OverridesColor;
   vtkColor3d AmbientColor;
@@ -124,6 +125,19 @@ protected:
   virtual void SetShaderValues(
     vtkShaderProgram* prog, vtkCompositeMapperHelperData* hdata, size_t primOffset);
 
+  /**
+   * Get the NaN color used for a block missing the scalars colored by, if
+   * requested by the parent. Returns false when the block is colored as usual.
+   */
+  bool GetNanColor(vtkCompositeMapperHelperData* hdata, double nanColor[4]);
+
+  /**
+   * Whether SetShaderValues() sets the same values for both blocks, so that
+   * they may be drawn by a single call.
+   */
+  virtual bool HaveSameShaderValues(
+    vtkCompositeMapperHelperData* hdata1, vtkCompositeMapperHelperData* hdata2);
+
   /**
    * Make sure appropriate shaders are defined, compiled and bound.  This method
    * orchistrates the process, much of the work is done in other methods
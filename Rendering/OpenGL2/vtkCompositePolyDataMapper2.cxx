@@ -123,30 +123,8 @@ void vtkCompositeMapperHelper2::SetShaderValues(
   }
 
   // If requested, color partial / missing arrays with NaN color.
-  bool useNanColor = false;
   double nanColor[4] = { -1., -1., -1., -1 };
-  if (this->Parent->GetColorMissingArraysWithNanColor() && this->GetScalarVisibility())
-  {
-    int cellFlag = 0;
-    vtkAbstractArray* scalars = vtkAbstractMapper::GetAbstractScalars(hdata->Data, this->ScalarMode,
-      this->ArrayAccessMode, this->ArrayId, this->ArrayName, cellFlag);
-    if (scalars == nullptr)
-    {
-      vtkLookupTable* lut = vtkLookupTable::SafeDownCast(this->GetLookupTable());
-      vtkColorTransferFunction* ctf =
-        lut ? nullptr : vtkColorTransferFunction::SafeDownCast(this->GetLookupTable());
-      if (lut)
-      {
-        lut->GetNanColor(nanColor);
-        useNanColor = true;
-      }
-      else if (ctf)
-      {
-        ctf->GetNanColor(nanColor);
-        useNanColor = true;
-      }
-    }
-  }
+  bool useNanColor = this->GetNanColor(hdata, nanColor);
 
   // override the opacity and color
   prog->SetUniformf("opacityUniform", hdata->Opacity);
@@ -187,6 +165,45 @@ void vtkCompositeMapperHelper2::SetShaderValues(
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkCompositeMapperHelper2::GetNanColor(vtkCompositeMapperHelperData* hdata, double nanColor[4])
+{
+  if (this->Parent->GetColorMissingArraysWithNanColor() && this->GetScalarVisibility())
+  {
+    int cellFlag = 0;
+    vtkAbstractArray* scalars = vtkAbstractMapper::GetAbstractScalars(hdata->Data, this->ScalarMode,
+      this->ArrayAccessMode, this->ArrayId, this->ArrayName, cellFlag);
+    if (scalars == nullptr)
+    {
+      vtkLookupTable* lut = vtkLookupTable::SafeDownCast(this->GetLookupTable());
+      vtkColorTransferFunction* ctf =
+        lut ? nullptr : vtkColorTransferFunction::SafeDownCast(this->GetLookupTable());
+      if (lut)
+      {
+        lut->GetNanColor(nanColor);
+        return true;
+      }
+      else if (ctf)
+      {
+        ctf->GetNanColor(nanColor);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+bool vtkCompositeMapperHelper2::HaveSameShaderValues(
+  vtkCompositeMapperHelperData* hdata1, vtkCompositeMapperHelperData* hdata2)
+{
+  double nanColor[4];
+  return hdata1->Opacity == hdata2->Opacity && hdata1->AmbientColor == hdata2->AmbientColor &&
+    hdata1->DiffuseColor == hdata2->DiffuseColor &&
+    hdata1->OverridesColor == hdata2->OverridesColor &&
+    this->GetNanColor(hdata1, nanColor) == this->GetNanColor(hdata2, nanColor);
+}
+
 //------------------------------------------------------------------------------
 void vtkCompositeMapperHelper2::UpdateShaders(
   vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* act)
@@ -420,10 +437,33 @@ void vtkCompositeMapperHelper2::DrawIBO(vtkRenderer* ren, vtkActor* actor, int p
     bool selecting = this->CurrentSelector != nullptr;
     bool tpass = actor->IsRenderingTranslucentPolygonalGeometry();
 
+    // When batching, consecutive blocks with the same shader values are drawn
+    // by a single call, as their indices follow each other in the IBO.
+    bool batching = this->Parent->GetBatchBlockDraws() && !selecting &&
+      !this->DrawingSelection && !this->PrimIDUsed;
+    vtkCompositeMapperHelperData* batchhdata = nullptr;
+    unsigned int batchStartIndex = 0;
+    unsigned int batchNextIndex = 0;
+    unsigned int batchStartVertex = 0;
+    unsigned int batchNextVertex = 0;
+    auto drawBatch = [&]() {
+      if (!batchhdata)
+      {
+        return;
+      }
+      unsigned int count = this->DrawingSelection
+        ? static_cast<unsigned int>(CellBO.IBO->IndexCount)
+        : batchNextIndex - batchStartIndex;
+      glDrawRangeElements(mode, static_cast<GLuint>(batchStartVertex),
+        static_cast<GLuint>(batchNextVertex > 0 ? batchNextVertex - 1 : 0), count, GL_UNSIGNED_INT,
+        reinterpret_cast<const GLvoid*>(batchStartIndex * sizeof(GLuint)));
+    };
+
     for (auto& data : this->Data)
     {
       vtkCompositeMapperHelperData* starthdata = data.second;
       bool shouldDraw = starthdata->Visibility     // must be visible
+        && (selecting || !starthdata->Occluded)    // and not occluded unless selecting
         && (!selecting || starthdata->Pickability) // and pickable when selecting
         && (((selecting || starthdata->IsOpaque || actor->GetForceOpaque()) &&
               !tpass) // opaque during opaque or when selecting
@@ -431,6 +471,17 @@ void vtkCompositeMapperHelper2::DrawIBO(vtkRenderer* ren, vtkActor* actor, int p
                   !selecting)); // translucent during translucent and never selecting
       if (shouldDraw && starthdata->NextIndex[primType] > starthdata->StartIndex[primType])
       {
+        if (batching && batchhdata && starthdata->StartIndex[primType] == batchNextIndex &&
+          (primType > vtkOpenGLPolyDataMapper::PrimitiveTriStrips ||
+            this->HaveSameShaderValues(batchhdata, starthdata)))
+        {
+          batchNextIndex = starthdata->NextIndex[primType];
+          batchStartVertex = std::min(batchStartVertex, starthdata->StartVertex);
+          batchNextVertex = std::max(batchNextVertex, starthdata->NextVertex);
+          continue;
+        }
+        drawBatch();
+
         // compilers think this can exceed the bounds so we also
         // test against primType even though we should not need to
         if (primType <= vtkOpenGLPolyDataMapper::PrimitiveTriStrips)
@@ -439,16 +490,14 @@ void vtkCompositeMapperHelper2::DrawIBO(vtkRenderer* ren, vtkActor* actor, int p
             prog, starthdata, starthdata->CellCellMap->GetPrimitiveOffsets()[primType]);
         }
 
-        unsigned int count = this->DrawingSelection
-          ? static_cast<unsigned int>(CellBO.IBO->IndexCount)
-          : starthdata->NextIndex[primType] - starthdata->StartIndex[primType];
-
-        glDrawRangeElements(mode, static_cast<GLuint>(starthdata->StartVertex),
-          static_cast<GLuint>(starthdata->NextVertex > 0 ? starthdata->NextVertex - 1 : 0), count,
-          GL_UNSIGNED_INT,
-          reinterpret_cast<const GLvoid*>(starthdata->StartIndex[primType] * sizeof(GLuint)));
+        batchhdata = starthdata;
+        batchStartIndex = starthdata->StartIndex[primType];
+        batchNextIndex = starthdata->NextIndex[primType];
+        batchStartVertex = starthdata->StartVertex;
+        batchNextVertex = starthdata->NextVertex;
       }
     }
+    drawBatch();
     CellBO.IBO->Release();
   }
 }
@@ -549,38 +598,62 @@ void vtkCompositeMapperHelper2::RenderPieceDraw(vtkRenderer* ren, vtkActor* acto
     this->PrimIDUsed = prog->IsUniformUsed("PrimitiveIDOffset");
     this->OverideColorUsed = prog->IsUniformUsed("OverridesColor");
 
+    // When batching, consecutive blocks with the same shader values are drawn
+    // by a single call, as their vertices follow each other.
+    bool batching = this->Parent->GetBatchBlockDraws() && !selecting && !this->PrimIDUsed;
+    vtkCompositeMapperHelperData* batchhdata = nullptr;
+    unsigned int batchFirst = 0;
+    unsigned int batchNext = 0;
+    GLenum mode = this->GetOpenGLMode(representation, primType);
+    auto drawBatch = [&]() {
+      if (!batchhdata)
+      {
+        return;
+      }
+      const GLsizei count = batchNext - batchFirst;
+      if (mode == GL_LINES && this->HaveWideLines(ren, actor))
+      {
+        glDrawArraysInstanced(
+          mode, batchFirst, count, 2 * vtkMath::Ceil(actor->GetProperty()->GetLineWidth()));
+      }
+      else
+      {
+        glDrawArrays(mode, batchFirst, count);
+      }
+    };
+
     for (auto& data : this->Data)
     {
       vtkCompositeMapperHelperData* starthdata = data.second;
       bool shouldDraw = starthdata->Visibility     // must be visible
+        && (selecting || !starthdata->Occluded)    // and not occluded unless selecting
         && (!selecting || starthdata->Pickability) // and pickable when selecting
         && (((selecting || starthdata->IsOpaque || actor->GetForceOpaque()) &&
               !tpass) // opaque during opaque or when selecting
              || ((!starthdata->IsOpaque || actor->GetForceTranslucent()) && tpass &&
                   !selecting)); // translucent during translucent and never selecting
 
-      const unsigned int first = starthdata->StartIndex[primType];
-      const GLsizei count = starthdata->NextIndex[primType] - first;
-
       if (shouldDraw && starthdata->NextIndex[primType] > starthdata->StartIndex[primType])
       {
+        if (batching && batchhdata && starthdata->StartIndex[primType] == batchNext &&
+          (primType > vtkOpenGLPolyDataMapper::PrimitiveTriStrips ||
+            this->HaveSameShaderValues(batchhdata, starthdata)))
+        {
+          batchNext = starthdata->NextIndex[primType];
+          continue;
+        }
+        drawBatch();
         if (primType <= vtkOpenGLPolyDataMapper::PrimitiveTriStrips)
         {
           this->SetShaderValues(
             prog, starthdata, starthdata->CellCellMap->GetPrimitiveOffsets()[primType]);
         }
-        GLenum mode = this->GetOpenGLMode(representation, primType);
-        if (mode == GL_LINES && this->HaveWideLines(ren, actor))
-        {
-          glDrawArraysInstanced(
-            mode, first, count, 2 * vtkMath::Ceil(actor->GetProperty()->GetLineWidth()));
-        }
-        else
-        {
-          glDrawArrays(mode, first, count);
-        }
+        batchhdata = starthdata;
+        batchFirst = starthdata->StartIndex[primType];
+        batchNext = starthdata->NextIndex[primType];
       }
     }
+    drawBatch();
   }
 
   if (this->CurrentSelector &&
@@ -602,6 +675,7 @@ vtkCompositeMapperHelperData* vtkCompositeMapperHelper2::AddData(
     vtkCompositeMapperHelperData* hdata = new vtkCompositeMapperHelperData();
     hdata->FlatIndex = flatIndex;
     hdata->Data = pd;
+    hdata->Occluded = false;
     hdata->Marked = true;
     this->Data.insert(std::make_pair(pd, hdata));
     this->Modified();
@@ -1553,6 +1627,7 @@ vtkCompositePolyDataMapper2::vtkCompositePolyDataMapper2()
 {
   this->CurrentFlatIndex = 0;
   this->ColorMissingArraysWithNanColor = false;
+  this->BatchBlockDraws = false;
 }
 
 //------------------------------------------------------------------------------
@@ -1791,6 +1866,36 @@ void vtkCompositePolyDataMapper2::RemoveBlockVisibilities()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkCompositePolyDataMapper2::SetOccludedBlocks(const std::vector<unsigned int>& flatIndices)
+{
+  std::vector<unsigned int> sorted(flatIndices);
+  std::sort(sorted.begin(), sorted.end());
+  for (auto& data : this->HelperDataMap)
+  {
+    data.second->Occluded =
+      std::binary_search(sorted.begin(), sorted.end(), data.second->FlatIndex);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCompositePolyDataMapper2::GetVisibleBlocks(
+  std::vector<unsigned int>& flatIndices, std::vector<double>& bounds)
+{
+  flatIndices.clear();
+  bounds.clear();
+  for (auto& data : this->HelperDataMap)
+  {
+    vtkCompositeMapperHelperData* hdata = data.second;
+    if (hdata->Visibility && hdata->Data && hdata->Data->GetNumberOfPoints() > 0)
+    {
+      const double* blockBounds = hdata->Data->GetBounds();
+      flatIndices.push_back(hdata->FlatIndex);
+      bounds.insert(bounds.end(), blockBounds, blockBounds + 6);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkCompositePolyDataMapper2::SetBlockColor(unsigned int index, const double color[3])
 {
@@ -1935,6 +2040,7 @@ vtkCompositeDataDisplayAttributes* vtkCompositePolyDataMapper2::GetCompositeData
 void vtkCompositePolyDataMapper2::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "BatchBlockDraws: " << (this->BatchBlockDraws ? "On" : "Off") << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -85,6 +85,21 @@ public:
   void RemoveBlockVisibilities();
   ///@}
 
+  /**
+   * Set the flat indices of the blocks hidden behind other geometry, which
+   * need not be rendered, as found by vtkOpenGLOcclusionCuller. Unlike the
+   * block visibility, this is a rendering hint that does not modify the
+   * mapper, and occluded blocks are still rendered when selecting.
+   */
+  void SetOccludedBlocks(const std::vector<unsigned int>& flatIndices);
+
+  /**
+   * Get the flat indices and the bounds, in data coordinates, of the visible
+   * and non-empty blocks of the last render, occluded or not. The bounds are
+   * stored 6 values per block.
+   */
+  void GetVisibleBlocks(std::vector<unsigned int>& flatIndices, std::vector<double>& bounds);
+
   ///@{
   /**
    * Set/get the color for a block given its flat index.
@@ -121,6 +136,19 @@ public:
   vtkBooleanMacro(ColorMissingArraysWithNanColor, bool);
   /**@}*/
 
+  /**
+   * If on, the consecutive blocks drawn with the same color, opacity and
+   * color overriding are drawn by a single draw call, so that the number of
+   * calls does not grow with the number of blocks sharing their look. Blocks
+   * are still drawn one by one while selecting, and when colored by cell
+   * scalars. Default is false.
+   * @{
+   */
+  vtkSetMacro(BatchBlockDraws, bool);
+  vtkGetMacro(BatchBlockDraws, bool);
+  vtkBooleanMacro(BatchBlockDraws, bool);
+  /**@}*/
+
   /**
    * Release any graphics resources that are being consumed by this mapper.
    * The parameter window could be used to determine which graphic
@@ -257,6 +285,11 @@ protected:
    */
   bool ColorMissingArraysWithNanColor;
 
+  /**
+   * Draw the consecutive blocks sharing their shader values together.
+   */
+  bool BatchBlockDraws;
+
   std::vector<vtkPolyData*> RenderedList;
 
 private:
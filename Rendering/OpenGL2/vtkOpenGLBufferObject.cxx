@@ -16,6 +16,9 @@
 
 #include "vtk_glew.h"
 
+#include <cstring>
+#include <limits>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkOpenGLBufferObject);
 
@@ -41,24 +44,147 @@ inline GLenum convertType(vtkOpenGLBufferObject::ObjectType type)
 
 struct vtkOpenGLBufferObject::Private
 {
+  // number of regions of the ring of a persistently mapped buffer, one being
+  // written while the GPU may still read the previous ones
+  static const int NumberOfRegions = 3;
+
   Private()
   {
     this->Handle = 0;
     this->Type = GL_ARRAY_BUFFER;
+    this->Mapped = nullptr;
+    this->RegionSize = 0;
+    this->Region = 0;
+    this->DataOffset = 0;
+#ifndef GL_ES_VERSION_3_0
+    for (int i = 0; i < NumberOfRegions; ++i)
+    {
+      this->Fences[i] = nullptr;
+    }
+#endif
   }
+
+  // Delete the persistently mapped buffer, if any, the buffer being
+  // implicitly unmapped.
+  void ReleasePersistentBuffer()
+  {
+    if (!this->Mapped)
+    {
+      return;
+    }
+#ifndef GL_ES_VERSION_3_0
+    for (int i = 0; i < NumberOfRegions; ++i)
+    {
+      if (this->Fences[i])
+      {
+        glDeleteSync(this->Fences[i]);
+        this->Fences[i] = nullptr;
+      }
+    }
+#endif
+    glDeleteBuffers(1, &this->Handle);
+    this->Handle = 0;
+    this->Mapped = nullptr;
+    this->RegionSize = 0;
+    this->DataOffset = 0;
+  }
+
+  bool UploadPersistent(const void* buffer, size_t size);
+
   GLenum Type;
   GLuint Handle;
+  char* Mapped;
+  size_t RegionSize;
+  int Region;
+  size_t DataOffset;
+#ifndef GL_ES_VERSION_3_0
+  GLsync Fences[NumberOfRegions];
+#endif
 };
 
+//------------------------------------------------------------------------------
+bool vtkOpenGLBufferObject::Private::UploadPersistent(const void* buffer, size_t size)
+{
+#ifndef GL_ES_VERSION_3_0
+  if (!GLEW_ARB_buffer_storage || this->Type != GL_ARRAY_BUFFER)
+  {
+    return false;
+  }
+
+  if (this->Mapped && size <= this->RegionSize)
+  {
+    // the draws reading the current region are issued, fence them and move
+    // to the next region once the GPU is done with it
+    this->Fences[this->Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    this->Region = (this->Region + 1) % NumberOfRegions;
+    GLsync& fence = this->Fences[this->Region];
+    if (fence)
+    {
+      GLenum status;
+      do
+      {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+      } while (status == GL_TIMEOUT_EXPIRED);
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+    glBindBuffer(this->Type, this->Handle);
+  }
+  else
+  {
+    // immutable storage cannot be resized, allocate a new buffer with some
+    // room for the data to grow
+    this->ReleasePersistentBuffer();
+    if (this->Handle != 0)
+    {
+      glDeleteBuffers(1, &this->Handle);
+      this->Handle = 0;
+    }
+    size_t regionSize = size + size / 8;
+    regionSize = (regionSize + 255) & ~static_cast<size_t>(255);
+    // attribute offsets are ints
+    if (regionSize > static_cast<size_t>(std::numeric_limits<int>::max()) / NumberOfRegions)
+    {
+      return false;
+    }
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glGenBuffers(1, &this->Handle);
+    glBindBuffer(this->Type, this->Handle);
+    glBufferStorage(this->Type, regionSize * NumberOfRegions, nullptr, flags);
+    this->Mapped =
+      static_cast<char*>(glMapBufferRange(this->Type, 0, regionSize * NumberOfRegions, flags));
+    if (!this->Mapped)
+    {
+      glBindBuffer(this->Type, 0);
+      glDeleteBuffers(1, &this->Handle);
+      this->Handle = 0;
+      return false;
+    }
+    this->RegionSize = regionSize;
+    this->Region = 0;
+  }
+
+  this->DataOffset = this->Region * this->RegionSize;
+  memcpy(this->Mapped + this->DataOffset, buffer, size);
+  return true;
+#else
+  (void)buffer;
+  (void)size;
+  return false;
+#endif
+}
+
 vtkOpenGLBufferObject::vtkOpenGLBufferObject()
 {
   this->Dirty = true;
+  this->UsePersistentMapping = false;
   this->Internal = new Private;
   this->Internal->Type = convertType(vtkOpenGLBufferObject::ArrayBuffer);
 }
 
 vtkOpenGLBufferObject::~vtkOpenGLBufferObject()
 {
+  this->Internal->ReleasePersistentBuffer();
   if (this->Internal->Handle != 0)
   {
     glDeleteBuffers(1, &this->Internal->Handle);
@@ -71,6 +197,7 @@ void vtkOpenGLBufferObject::ReleaseGraphicsResources()
   if (this->Internal->Handle != 0)
   {
     glBindBuffer(this->Internal->Type, 0);
+    this->Internal->ReleasePersistentBuffer();
     glDeleteBuffers(1, &this->Internal->Handle);
     this->Internal->Handle = 0;
   }
@@ -102,6 +229,11 @@ int vtkOpenGLBufferObject::GetHandle() const
   return static_cast<int>(this->Internal->Handle);
 }
 
+size_t vtkOpenGLBufferObject::GetDataOffset() const
+{
+  return this->Internal->DataOffset;
+}
+
 bool vtkOpenGLBufferObject::Bind()
 {
   if (!this->Internal->Handle)
@@ -145,6 +277,22 @@ bool vtkOpenGLBufferObject::UploadInternal(
     return false;
   }
 
+  if (this->UsePersistentMapping && this->Internal->UploadPersistent(buffer, size))
+  {
+    // the buffer or the offset of the data changed, users must update their
+    // attributes
+    this->Modified();
+    this->Dirty = false;
+    return true;
+  }
+  // back to a mutable buffer, a failed persistent upload may have deleted it
+  this->Internal->ReleasePersistentBuffer();
+  if (this->Internal->Handle == 0)
+  {
+    this->GenerateBuffer(objectType);
+    this->Modified();
+  }
+
   glBindBuffer(this->Internal->Type, this->Internal->Handle);
   glBufferData(this->Internal->Type, size, static_cast<const GLvoid*>(buffer), GL_STATIC_DRAW);
   this->Dirty = false;
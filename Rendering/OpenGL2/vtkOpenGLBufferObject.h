@@ -97,12 +97,26 @@ public:
    */
   std::string GetError() const { return Error; }
 
+  /**
+   * Offset in bytes of the data of the last upload in the buffer. It is 0
+   * unless the data are streamed through a persistently mapped buffer, see
+   * UsePersistentMapping.
+   */
+  size_t GetDataOffset() const;
+
 protected:
   vtkOpenGLBufferObject();
   ~vtkOpenGLBufferObject() override;
   bool Dirty;
   std::string Error;
 
+  // When true, and ARB_buffer_storage is supported, the uploads of an array
+  // buffer write in the next region of a ring of regions persistently mapped,
+  // waiting on a fence only if the GPU may still read that region, instead of
+  // respecifying the buffer with glBufferData. The data are then at
+  // GetDataOffset() in the buffer.
+  bool UsePersistentMapping;
+
   bool UploadInternal(const void* buffer, size_t size, ObjectType objectType);
 
 private:
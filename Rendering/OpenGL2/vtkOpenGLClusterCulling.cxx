@@ -0,0 +1,262 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLClusterCulling.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkOpenGLClusterCulling.h"
+
+#include "vtkMath.h"
+#include "vtkMatrix4x4.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cmath>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkOpenGLClusterCulling);
+
+constexpr int vtkOpenGLClusterCulling::MaximumNumberOfVertices;
+constexpr int vtkOpenGLClusterCulling::MaximumNumberOfTriangles;
+
+//------------------------------------------------------------------------------
+vtkOpenGLClusterCulling::vtkOpenGLClusterCulling()
+{
+  this->NumberOfCulledClusters = 0;
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLClusterCulling::~vtkOpenGLClusterCulling() = default;
+
+//------------------------------------------------------------------------------
+void vtkOpenGLClusterCulling::Clear()
+{
+  this->Clusters.clear();
+  this->Ranges.clear();
+  this->NumberOfCulledClusters = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLClusterCulling::BuildClusters(
+  const std::vector<unsigned int>& indices, vtkPoints* points)
+{
+  this->Clear();
+  const unsigned int numTris = static_cast<unsigned int>(indices.size() / 3);
+  if (numTris == 0 || !points)
+  {
+    return;
+  }
+
+  // split the consecutive triangles, the distinct vertices of a cluster are
+  // few enough for a linear search
+  std::vector<unsigned int> vertices;
+  vertices.reserve(MaximumNumberOfVertices);
+  unsigned int first = 0;
+  for (unsigned int t = 0; t < numTris; ++t)
+  {
+    int newVertices = 0;
+    for (int v = 0; v < 3; ++v)
+    {
+      const unsigned int id = indices[3 * t + v];
+      if (std::find(vertices.begin(), vertices.end(), id) == vertices.end() &&
+        std::find(&indices[3 * t], &indices[3 * t + v], id) == &indices[3 * t + v])
+      {
+        ++newVertices;
+      }
+    }
+    if (t > first &&
+      (vertices.size() + newVertices > MaximumNumberOfVertices ||
+        t - first == MaximumNumberOfTriangles))
+    {
+      this->Clusters.push_back(Cluster{ first, t - first, {}, 0.0, {}, 0.0 });
+      first = t;
+      vertices.clear();
+    }
+    for (int v = 0; v < 3; ++v)
+    {
+      const unsigned int id = indices[3 * t + v];
+      if (std::find(vertices.begin(), vertices.end(), id) == vertices.end())
+      {
+        vertices.push_back(id);
+      }
+    }
+  }
+  this->Clusters.push_back(Cluster{ first, numTris - first, {}, 0.0, {}, 0.0 });
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(this->Clusters.size()),
+    [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType c = begin; c < end; ++c)
+      {
+        Cluster& cluster = this->Clusters[c];
+        const unsigned int* tris = &indices[3 * cluster.FirstTriangle];
+        const unsigned int numIds = 3 * cluster.NumberOfTriangles;
+
+        double bounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+          VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+        for (unsigned int i = 0; i < numIds; ++i)
+        {
+          double p[3];
+          points->GetPoint(tris[i], p);
+          for (int j = 0; j < 3; ++j)
+          {
+            bounds[2 * j] = std::min(bounds[2 * j], p[j]);
+            bounds[2 * j + 1] = std::max(bounds[2 * j + 1], p[j]);
+          }
+        }
+        double radius2 = 0.0;
+        for (int j = 0; j < 3; ++j)
+        {
+          cluster.Center[j] = 0.5 * (bounds[2 * j] + bounds[2 * j + 1]);
+        }
+        for (unsigned int i = 0; i < numIds; ++i)
+        {
+          double p[3];
+          points->GetPoint(tris[i], p);
+          radius2 = std::max(radius2, vtkMath::Distance2BetweenPoints(p, cluster.Center));
+        }
+        cluster.Radius = std::sqrt(radius2);
+
+        // the normals follow the counterclockwise front faces of OpenGL
+        std::vector<double> normals(cluster.NumberOfTriangles * 3, 0.0);
+        double axis[3] = { 0.0, 0.0, 0.0 };
+        for (unsigned int t = 0; t < cluster.NumberOfTriangles; ++t)
+        {
+          double p0[3], p1[3], p2[3], e1[3], e2[3];
+          points->GetPoint(tris[3 * t], p0);
+          points->GetPoint(tris[3 * t + 1], p1);
+          points->GetPoint(tris[3 * t + 2], p2);
+          vtkMath::Subtract(p1, p0, e1);
+          vtkMath::Subtract(p2, p0, e2);
+          double* n = &normals[3 * t];
+          vtkMath::Cross(e1, e2, n);
+          if (vtkMath::Normalize(n) > 0.0)
+          {
+            vtkMath::Add(axis, n, axis);
+          }
+        }
+        cluster.ConeSine = 2.0;
+        if (vtkMath::Normalize(axis) == 0.0)
+        {
+          continue;
+        }
+        double minDot = 1.0;
+        for (unsigned int t = 0; t < cluster.NumberOfTriangles; ++t)
+        {
+          const double* n = &normals[3 * t];
+          if (n[0] != 0.0 || n[1] != 0.0 || n[2] != 0.0)
+          {
+            minDot = std::min(minDot, vtkMath::Dot(axis, n));
+          }
+        }
+        std::copy(axis, axis + 3, cluster.ConeAxis);
+        if (minDot > 0.0)
+        {
+          cluster.ConeSine = std::sqrt(1.0 - minDot * minDot);
+        }
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLClusterCulling::Cull(
+  vtkMatrix4x4* mcdc, const double camera[4], bool cullFaces, bool cullFront)
+{
+  // the planes of the frustum in model coordinates, pointing inside
+  const double* m = mcdc->GetData();
+  double planes[6][4];
+  for (int p = 0; p < 6; ++p)
+  {
+    const double sign = (p % 2) ? -1.0 : 1.0;
+    double length = 0.0;
+    for (int c = 0; c < 4; ++c)
+    {
+      planes[p][c] = m[12 + c] + sign * m[4 * (p / 2) + c];
+      length += c < 3 ? planes[p][c] * planes[p][c] : 0.0;
+    }
+    length = std::sqrt(length);
+    for (int c = 0; length > 0.0 && c < 4; ++c)
+    {
+      planes[p][c] /= length;
+    }
+  }
+
+  double direction[3] = { camera[0], camera[1], camera[2] };
+  const bool parallel = camera[3] == 0.0;
+  if (parallel)
+  {
+    vtkMath::Normalize(direction);
+  }
+  const double faceSign = cullFront ? -1.0 : 1.0;
+
+  std::vector<unsigned char> visible(this->Clusters.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(this->Clusters.size()),
+    [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType c = begin; c < end; ++c)
+      {
+        const Cluster& cluster = this->Clusters[c];
+        bool inside = true;
+        for (int p = 0; p < 6 && inside; ++p)
+        {
+          inside = vtkMath::Dot(planes[p], cluster.Center) + planes[p][3] >= -cluster.Radius;
+        }
+        if (inside && cullFaces && cluster.ConeSine < 1.0)
+        {
+          // all the triangles face away from the camera when it looks at
+          // every point of the bounding sphere at less than 90 degrees minus
+          // the angle of the cone from the axis
+          const double* a = cluster.ConeAxis;
+          if (parallel)
+          {
+            inside = faceSign * vtkMath::Dot(a, direction) <= cluster.ConeSine;
+          }
+          else
+          {
+            double v[3];
+            vtkMath::Subtract(cluster.Center, camera, v);
+            inside = faceSign * vtkMath::Dot(a, v) <=
+              vtkMath::Norm(v) * cluster.ConeSine + cluster.Radius * (1.0 + cluster.ConeSine);
+          }
+        }
+        visible[c] = inside ? 1 : 0;
+      }
+    });
+
+  // merge the consecutive visible clusters
+  this->Ranges.clear();
+  this->NumberOfCulledClusters = 0;
+  for (size_t c = 0; c < this->Clusters.size(); ++c)
+  {
+    const Cluster& cluster = this->Clusters[c];
+    if (!visible[c])
+    {
+      ++this->NumberOfCulledClusters;
+    }
+    else if (c > 0 && visible[c - 1])
+    {
+      this->Ranges.back().second += cluster.NumberOfTriangles;
+    }
+    else
+    {
+      this->Ranges.emplace_back(cluster.FirstTriangle, cluster.NumberOfTriangles);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLClusterCulling::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfClusters: " << this->Clusters.size() << endl;
+  os << indent << "NumberOfCulledClusters: " << this->NumberOfCulledClusters << endl;
+}
+VTK_ABI_NAMESPACE_END
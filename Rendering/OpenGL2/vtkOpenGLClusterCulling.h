@@ -0,0 +1,137 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLClusterCulling.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+/**
+ * @class   vtkOpenGLClusterCulling
+ * @brief   Frustum and backface culling of clusters of triangles.
+ *
+ * This class splits the triangles of an index buffer into clusters of
+ * consecutive triangles, of at most MaximumNumberOfVertices distinct vertices
+ * and MaximumNumberOfTriangles triangles, and computes the bounding sphere and
+ * the cone of the normals of each cluster. It was designed to let
+ * vtkOpenGLPolyDataMapper draw only the visible parts of large surfaces.
+ *
+ * Cull() tests the clusters against the frustum and, when asked to, against
+ * the direction of the camera with vtkSMPTools, and returns the ranges of
+ * consecutive triangles left to draw. The clusters follow the order of the
+ * triangles in the index buffer, so that the primitive ids of the triangles
+ * drawn are the first triangle of their range plus gl_PrimitiveID.
+ *
+ * @code{.cpp}
+ *
+ * vtkNew<vtkOpenGLClusterCulling> culling;
+ * culling->BuildClusters(indices, polydata->GetPoints());
+ *
+ * // planes and camera in model coordinates
+ * culling->Cull(mcdc, cameraPosition, false, true);
+ * for (const auto& range : culling->GetRanges())
+ * {
+ *   // draw 3 * range.second indices from the index 3 * range.first
+ * }
+ *
+ * @endcode
+ */
+
+#ifndef vtkOpenGLClusterCulling_h
+#define vtkOpenGLClusterCulling_h
+
+#include "vtkObject.h"
+#include "vtkRenderingOpenGL2Module.h" // For export macro
+
+#include <utility> // for std::pair
+#include <vector>  // for std::vector
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkMatrix4x4;
+class vtkPoints;
+
+class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLClusterCulling : public vtkObject
+{
+public:
+  static vtkOpenGLClusterCulling* New();
+  vtkTypeMacro(vtkOpenGLClusterCulling, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Limits of the size of the clusters.
+   */
+  static constexpr int MaximumNumberOfVertices = 64;
+  static constexpr int MaximumNumberOfTriangles = 124;
+
+  /**
+   * Split the triangles of indices, three indices per triangle, into clusters
+   * and compute their bounds from the points.
+   */
+  void BuildClusters(const std::vector<unsigned int>& indices, vtkPoints* points);
+
+  /**
+   * Remove the clusters.
+   */
+  void Clear();
+
+  /**
+   * Cull the clusters outside of the frustum of the mcdc matrix, the model
+   * coordinates to display coordinates matrix. When cullFaces is true, the
+   * clusters whose triangles all face away from the camera are culled too, or
+   * the ones whose triangles all face it when cullFront is true. The camera
+   * is a position in model coordinates when camera[3] is 1, and the
+   * direction of projection of a parallel projection when it is 0.
+   */
+  void Cull(vtkMatrix4x4* mcdc, const double camera[4], bool cullFaces, bool cullFront);
+
+  /**
+   * Ranges of the triangles left by the last Cull(), as the first triangle and
+   * the number of triangles of each range.
+   */
+  const std::vector<std::pair<unsigned int, unsigned int>>& GetRanges() { return this->Ranges; }
+
+  /**
+   * Number of clusters.
+   */
+  vtkIdType GetNumberOfClusters() { return static_cast<vtkIdType>(this->Clusters.size()); }
+
+  /**
+   * Number of clusters culled by the last Cull().
+   */
+  vtkGetMacro(NumberOfCulledClusters, vtkIdType);
+
+protected:
+  vtkOpenGLClusterCulling();
+  ~vtkOpenGLClusterCulling() override;
+
+  struct Cluster
+  {
+    unsigned int FirstTriangle;
+    unsigned int NumberOfTriangles;
+    double Center[3];
+    double Radius;
+    // unit axis of the normals of the triangles and the sine of the
+    // largest angle between them and the axis, more than 1 when they span
+    // more than an hemisphere
+    double ConeAxis[3];
+    double ConeSine;
+  };
+
+  std::vector<Cluster> Clusters;
+  std::vector<std::pair<unsigned int, unsigned int>> Ranges;
+  vtkIdType NumberOfCulledClusters;
+
+private:
+  vtkOpenGLClusterCulling(const vtkOpenGLClusterCulling&) = delete;
+  void operator=(const vtkOpenGLClusterCulling&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -567,7 +567,10 @@ void vtkOpenGLFluidMapper::Render(vtkRenderer* renderer, vtkVolume* vol)
       program->SetUniformf("particleRadius", this->ParticleRadius);
       program->SetUniformf("farZValue", -crange[1]);
 
-      for (uint32_t iter = 0; iter < this->SurfaceFilterIterations; ++iter)
+      // a separable filter runs a horizontal then a vertical pass per iteration
+      const bool separable = this->SeparableSurfaceFilter && SurfaceFilterMethod == NarrowRange;
+      const uint32_t numberOfPasses = separable ? 2u : 1u;
+      for (uint32_t pass = 0; pass < this->SurfaceFilterIterations * numberOfPasses; ++pass)
       {
         this->FBFilterDepth->Bind();
         this->FBFilterDepth->AddColorAttachment(
@@ -585,9 +588,14 @@ void vtkOpenGLFluidMapper::Render(vtkRenderer* renderer, vtkVolume* vol)
             program->SetUniformf("sigmaDepth", this->BiGaussFilterSigmaDepth);
             break;
           case NarrowRange:
+          {
             program->SetUniformf("lambda", this->NRFilterLambda);
             program->SetUniformf("mu", this->NRFilterMu);
+            const float direction[2] = { separable && pass % 2 == 0 ? 1.0f : 0.0f,
+              separable && pass % 2 == 1 ? 1.0f : 0.0f };
+            program->SetUniform2f("filterDirection", direction);
             break;
+          }
           // New filter method is added here
           default:
             vtkErrorMacro("Invalid filter method");
@@ -150,6 +150,20 @@ public:
     this->NRFilterMu = mu;
   }
 
+  ///@{
+  /**
+   * Get/Set whether the narrow range filter is applied separably, as a
+   * horizontal then a vertical one-dimensional pass in each iteration. The
+   * cost of a pixel is then linear in the filter size instead of quadratic,
+   * which makes large filter radii usable interactively, at the price of
+   * slightly less isotropic smoothing. Ignored by the bilateral gaussian
+   * filter. Default is false.
+   */
+  vtkSetMacro(SeparableSurfaceFilter, bool);
+  vtkGetMacro(SeparableSurfaceFilter, bool);
+  vtkBooleanMacro(SeparableSurfaceFilter, bool);
+  ///@}
+
   /**
    * Optional parameters, exclusively for bilateral gaussian filter
    * The parameter is for controlling smoothing between surface depth values
@@ -309,6 +323,7 @@ protected:
   uint32_t SurfaceFilterRadius = 5u;
   float NRFilterLambda = 10.0f;
   float NRFilterMu = 1.0f;
+  bool SeparableSurfaceFilter = false;
   float BiGaussFilterSigmaDepth = 10.0f;
 
   uint32_t ThicknessAndVolumeColorFilterIterations = 3u;
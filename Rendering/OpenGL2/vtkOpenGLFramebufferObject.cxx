@@ -905,7 +905,12 @@ void vtkOpenGLFramebufferObject::AddColorAttachment(unsigned int index, vtkTextu
     i = this->ColorBuffers.insert(std::make_pair(index, foinfo)).first;
   }
   i->second->SetTexture(tex, GL_COLOR_ATTACHMENT0 + index, format, mipmapLevel);
-  i->second->ZSlice = zslice;
+  // attaching another slice of the same 3D texture needs a new attachment
+  if (i->second->ZSlice != zslice)
+  {
+    i->second->ZSlice = zslice;
+    i->second->Attached = false;
+  }
   this->AttachColorBuffer(index);
 }
 
@@ -58,6 +58,8 @@ vtkStandardNewMacro(vtkOpenGLGlyph3DHelper);
 vtkOpenGLGlyph3DHelper::vtkOpenGLGlyph3DHelper()
 {
   this->UsingInstancing = false;
+  this->UsingCPUCulling = false;
+  this->ForceCPUCulling = false;
   this->PopulateSelectionSettings = 0;
 
   // Shift and Scale are not used in this mapper producing errors when the Shift Scale
@@ -263,22 +265,24 @@ void vtkOpenGLGlyph3DHelper::GlyphRender(vtkRenderer* ren, vtkActor* actor, vtkI
     static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow()));
 
   this->UsingInstancing = false;
+  this->NumberOfInstancesPerLOD.assign(1, numPts);
 
   vtkHardwareSelector* selector = ren->GetSelector();
 
   if (!selector && GLEW_ARB_instanced_arrays)
   {
     // if there is no triangle, culling is useless.
-    // GLEW_ARB_gpu_shader5 is needed by the culling shader.
-#ifndef GL_ES_VERSION_3_0
-    if (this->CurrentInput->GetNumberOfPolys() <= 0 || !GLEW_ARB_gpu_shader5 ||
-      !GLEW_ARB_transform_feedback3)
+    if (this->CurrentInput->GetNumberOfPolys() <= 0)
     {
       culling = false;
     }
+    // GLEW_ARB_gpu_shader5 is needed by the culling shader, without it the
+    // instances are culled on the CPU.
+#ifndef GL_ES_VERSION_3_0
+    this->UsingCPUCulling =
+      this->ForceCPUCulling || !GLEW_ARB_gpu_shader5 || !GLEW_ARB_transform_feedback3;
 #else
-    // disable culling on OpenGL ES
-    culling = false;
+    this->UsingCPUCulling = true;
 #endif
 
     this->GlyphRenderInstances(
@@ -394,6 +398,11 @@ void vtkOpenGLGlyph3DHelper::GlyphRenderInstances(vtkRenderer* ren, vtkActor* ac
     this->InstanceBuffersBuildTime.Modified();
   }
 
+  if (culling && this->UsingCPUCulling)
+  {
+    this->RunCPUCulling(ren, actor, numPts, colors, matrices, normalMatrices, withNormals);
+  }
+
   bool draw_surface_with_edges =
     (actor->GetProperty()->GetEdgeVisibility() && representation == VTK_SURFACE);
   for (int i = PrimitiveStart;
@@ -407,14 +416,17 @@ void vtkOpenGLGlyph3DHelper::GlyphRenderInstances(vtkRenderer* ren, vtkActor* ac
       // culling
       if (culling)
       {
-        this->BuildCullingShaders(ren, actor, numPts, withNormals);
-        if (!this->InstanceCulling->GetHelper().Program)
+        if (!this->UsingCPUCulling)
         {
-          return;
-        }
+          this->BuildCullingShaders(ren, actor, numPts, withNormals);
+          if (!this->InstanceCulling->GetHelper().Program)
+          {
+            return;
+          }
 
-        this->InstanceCulling->RunCullingShaders(
-          numPts, this->MatrixBuffer, this->ColorBuffer, this->NormalMatrixBuffer);
+          this->InstanceCulling->RunCullingShaders(
+            numPts, this->MatrixBuffer, this->ColorBuffer, this->NormalMatrixBuffer);
+        }
 
         // draw each LOD
 
@@ -567,10 +579,54 @@ void vtkOpenGLGlyph3DHelper::GlyphRenderInstances(vtkRenderer* ren, vtkActor* ac
     }
   }
 
+  if (culling)
+  {
+    this->NumberOfInstancesPerLOD.resize(this->InstanceCulling->GetNumberOfLOD());
+    for (vtkIdType j = 0; j < this->InstanceCulling->GetNumberOfLOD(); j++)
+    {
+      this->NumberOfInstancesPerLOD[j] = this->InstanceCulling->GetLOD(j).NumberOfInstances;
+    }
+  }
+
   vtkOpenGLCheckErrorMacro("failed after Render");
   this->RenderPieceFinish(ren, actor);
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLGlyph3DHelper::RunCPUCulling(vtkRenderer* ren, vtkActor* actor, vtkIdType numPts,
+  std::vector<unsigned char>& colors, std::vector<float>& matrices,
+  std::vector<float>& normalMatrices, bool withNormals)
+{
+  if (this->InstanceCulling->GetNumberOfLOD() == 0)
+  {
+    this->InstanceCulling->InitLOD(this->CurrentInput);
+
+    for (auto& lod : this->LODs)
+    {
+      this->InstanceCulling->AddLOD(lod.first, lod.second);
+    }
+  }
+
+  // same matrices as the MCDCMatrix and MCVCMatrix of the culling shaders,
+  // shift and scale being disabled
+  vtkCamera* cam = ren->GetActiveCamera();
+  vtkNew<vtkMatrix4x4> mcvc;
+  vtkNew<vtkMatrix4x4> mcdc;
+  mcvc->DeepCopy(cam->GetModelViewTransformMatrix());
+  mcdc->DeepCopy(cam->GetCompositeProjectionTransformMatrix(ren->GetTiledAspectRatio(), -1, 1));
+  if (!actor->GetIsIdentity())
+  {
+    vtkMatrix4x4::Multiply4x4(mcvc, actor->GetMatrix(), mcvc);
+    vtkMatrix4x4::Multiply4x4(mcdc, actor->GetMatrix(), mcdc);
+  }
+
+  double* bounds = this->CurrentInput->GetBounds();
+  double bboxSize[3] = { bounds[1] - bounds[0], bounds[3] - bounds[2], bounds[5] - bounds[4] };
+
+  this->InstanceCulling->RunCullingOnCPU(
+    numPts, matrices, colors, normalMatrices, withNormals, mcdc, mcvc, bboxSize);
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLGlyph3DHelper::BuildCullingShaders(
   vtkRenderer* ren, vtkActor* actor, vtkIdType numPts, bool withNormals)
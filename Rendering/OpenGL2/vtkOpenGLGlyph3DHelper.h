@@ -51,6 +51,21 @@ public:
 
   void SetLODColoring(bool val);
 
+  /**
+   * Cull the instances and select their LOD on the CPU even when the culling
+   * shaders are supported.
+   */
+  void SetForceCPUCulling(bool val) { this->ForceCPUCulling = val; }
+
+  /**
+   * Number of instances drawn with each LOD by the last GlyphRender, the
+   * first one being the glyph at full resolution.
+   */
+  const std::vector<vtkIdType>& GetNumberOfInstancesPerLOD() const
+  {
+    return this->NumberOfInstancesPerLOD;
+  }
+
   /**
    * Release any graphics resources that are being consumed by this mapper.
    * The parameter window could be used to determine which graphic
@@ -96,7 +111,18 @@ protected:
 
   void BuildCullingShaders(vtkRenderer* ren, vtkActor* actor, vtkIdType numPts, bool withNormals);
 
+  /**
+   * Cull the instances on the CPU, for the contexts without the geometry
+   * shader streams needed by the culling shaders.
+   */
+  void RunCPUCulling(vtkRenderer* ren, vtkActor* actor, vtkIdType numPts,
+    std::vector<unsigned char>& colors, std::vector<float>& matrices,
+    std::vector<float>& normalMatrices, bool withNormals);
+
   bool UsingInstancing;
+  bool UsingCPUCulling;
+  bool ForceCPUCulling;
+  std::vector<vtkIdType> NumberOfInstancesPerLOD;
 
   vtkNew<vtkOpenGLBufferObject> NormalMatrixBuffer;
   vtkNew<vtkOpenGLBufferObject> MatrixBuffer;
@@ -174,6 +174,8 @@ vtkOpenGLGlyph3DMapper::vtkOpenGLGlyph3DMapper()
 {
   this->GlyphValues = new vtkOpenGLGlyph3DMapper::vtkOpenGLGlyph3DMapperArray();
   this->ColorMapper = vtkOpenGLGlyph3DMappervtkColorMapper::New();
+  this->ForceCPUCulling = false;
+  this->NumberOfCulledInstances = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -224,6 +226,7 @@ void vtkOpenGLGlyph3DMapper::CopyInformationToSubMapper(vtkOpenGLGlyph3DHelper*
 
   mapper->SetLODs(this->LODs);
   mapper->SetLODColoring(this->LODColoring);
+  mapper->SetForceCPUCulling(this->ForceCPUCulling);
 }
 
 void vtkOpenGLGlyph3DMapper::SetupColorMapper()
@@ -321,6 +324,9 @@ void vtkOpenGLGlyph3DMapper::Render(vtkRenderer* ren, vtkActor* actor)
     }
   }
 
+  this->NumberOfInstancesPerLOD.clear();
+  this->NumberOfCulledInstances = 0;
+
   // Render the input dataset or every dataset in the input composite dataset.
   this->BlockMTime = this->BlockAttributes ? this->BlockAttributes->GetMTime() : 0;
   vtkDataSet* ds = vtkDataSet::SafeDownCast(inputDO);
@@ -591,6 +597,19 @@ void vtkOpenGLGlyph3DMapper::Render(vtkRenderer* ren, vtkActor* actor, vtkDataSe
         gh->CurrentInput = pd;
         gh->GlyphRender(ren, actor, entry->NumberOfPoints, entry->Colors, entry->Matrices,
           entry->NormalMatrices, entry->PickIds, subarray->BuildTime, this->CullingAndLOD);
+
+        const std::vector<vtkIdType>& drawn = gh->GetNumberOfInstancesPerLOD();
+        if (this->NumberOfInstancesPerLOD.size() < drawn.size())
+        {
+          this->NumberOfInstancesPerLOD.resize(drawn.size(), 0);
+        }
+        vtkIdType culled = entry->NumberOfPoints;
+        for (size_t j = 0; j < drawn.size(); ++j)
+        {
+          this->NumberOfInstancesPerLOD[j] += drawn[j];
+          culled -= drawn[j];
+        }
+        this->NumberOfCulledInstances += culled;
       }
 
       if (!cdsIter || cdsIter->IsDoneWithTraversal())
@@ -984,9 +1003,10 @@ void vtkOpenGLGlyph3DMapper::ReleaseGraphicsResources(vtkWindow* window)
 vtkIdType vtkOpenGLGlyph3DMapper::GetMaxNumberOfLOD()
 {
 #ifndef GL_ES_VERSION_3_0
-  if (!GLEW_ARB_gpu_shader5 || !GLEW_ARB_transform_feedback3)
+  // the LODs selected on the CPU are only limited by the memory
+  if (this->ForceCPUCulling || !GLEW_ARB_gpu_shader5 || !GLEW_ARB_transform_feedback3)
   {
-    return 0;
+    return VTK_ID_MAX;
   }
 
   GLint streams, maxsize;
@@ -998,10 +1018,20 @@ vtkIdType vtkOpenGLGlyph3DMapper::GetMaxNumberOfLOD()
   vtkIdType maxstreams = static_cast<vtkIdType>(std::min(streams, maxsize));
   return maxstreams - 1;
 #else
-  return 0;
+  return VTK_ID_MAX;
 #endif
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkOpenGLGlyph3DMapper::GetNumberOfInstancesInLOD(vtkIdType index)
+{
+  if (index < 0 || index >= static_cast<vtkIdType>(this->NumberOfInstancesPerLOD.size()))
+  {
+    return 0;
+  }
+  return this->NumberOfInstancesPerLOD[index];
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLGlyph3DMapper::SetNumberOfLOD(vtkIdType nb)
 {
@@ -1023,5 +1053,7 @@ void vtkOpenGLGlyph3DMapper::SetLODDistanceAndTargetReduction(
 void vtkOpenGLGlyph3DMapper::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ForceCPUCulling: " << (this->ForceCPUCulling ? "On" : "Off") << "\n";
+  os << indent << "NumberOfCulledInstances: " << this->NumberOfCulledInstances << "\n";
 }
 VTK_ABI_NAMESPACE_END
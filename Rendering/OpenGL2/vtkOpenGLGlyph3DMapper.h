@@ -32,6 +32,8 @@
 #include "vtkNew.h"                    // For vtkNew
 #include "vtkRenderingOpenGL2Module.h" // For export macro
 
+#include <vector> // For std::vector
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkOpenGLGlyph3DHelper;
 class vtkBitArray;
@@ -59,7 +61,8 @@ public:
   ///@{
   /**
    * Get the maximum number of LOD. OpenGL context must be bound.
-   * The maximum number of LOD depends on GPU capabilities.
+   * The maximum number of LOD depends on GPU capabilities, there is no limit
+   * when the instances are culled on the CPU.
    */
   vtkIdType GetMaxNumberOfLOD() override;
 
@@ -80,6 +83,29 @@ public:
     vtkIdType index, float distance, float targetReduction) override;
   ///@}
 
+  ///@{
+  /**
+   * Cull the instances and select their LOD on the CPU, using vtkSMPTools,
+   * even when the GPU supports the geometry shader streams used to do it on
+   * the GPU. The CPU is always used when they are not supported, as with
+   * OpenGL ES and on macOS. Default is off.
+   */
+  vtkSetMacro(ForceCPUCulling, bool);
+  vtkGetMacro(ForceCPUCulling, bool);
+  vtkBooleanMacro(ForceCPUCulling, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Statistics of the last render: the number of instances drawn with each
+   * LOD, the LOD 0 being the glyph at full resolution, and the number of
+   * instances culled. Without culling, all the instances are drawn with the
+   * LOD 0.
+   */
+  vtkIdType GetNumberOfInstancesInLOD(vtkIdType index);
+  vtkGetMacro(NumberOfCulledInstances, vtkIdType);
+  ///@}
+
 protected:
   vtkOpenGLGlyph3DMapper();
   ~vtkOpenGLGlyph3DMapper() override;
@@ -112,6 +138,10 @@ protected:
 
   vtkMTimeType BlockMTime; // Last time BlockAttributes was modified.
 
+  bool ForceCPUCulling;
+  std::vector<vtkIdType> NumberOfInstancesPerLOD;
+  vtkIdType NumberOfCulledInstances;
+
 private:
   vtkOpenGLGlyph3DMapper(const vtkOpenGLGlyph3DMapper&) = delete;
   void operator=(const vtkOpenGLGlyph3DMapper&) = delete;
@@ -15,6 +15,7 @@
 
 #include "vtkOpenGLImageAlgorithmHelper.h"
 #include "vtkDataArray.h"
+#include "vtkFloatArray.h"
 #include "vtkImageData.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
@@ -28,9 +29,36 @@
 #include "vtkTextureObject.h"
 #include "vtk_glew.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkOpenGLImageAlgorithmHelper);
 
+namespace
+{
+// Copy the rows of a slice that was read back as RGBA floats into the
+// output, with a cast to the output scalar type.
+template <class T>
+void vtkOpenGLImageAlgorithmHelperCopy(
+  const float* rgba, vtkImageData* outImage, const int outExt[6], int z, T*)
+{
+  const int numComps = outImage->GetNumberOfScalarComponents();
+  for (int j = outExt[2]; j <= outExt[3]; j++)
+  {
+    T* outP = static_cast<T*>(outImage->GetScalarPointer(outExt[0], j, z));
+    for (int i = outExt[0]; i <= outExt[1]; i++)
+    {
+      for (int c = 0; c < numComps; ++c)
+      {
+        outP[c] = static_cast<T>(rgba[c]);
+      }
+      rgba += 4;
+      outP += numComps;
+    }
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 vtkOpenGLImageAlgorithmHelper::vtkOpenGLImageAlgorithmHelper()
 {
@@ -60,9 +88,8 @@ void vtkOpenGLImageAlgorithmHelper::SetRenderWindow(vtkRenderWindow* renWin)
   this->Modified();
 }
 
-void vtkOpenGLImageAlgorithmHelper::Execute(vtkOpenGLImageAlgorithmCallback* cb,
-  vtkImageData* inImage, vtkDataArray* inArray, vtkImageData* outImage, int outExt[6],
-  const char* vertexCode, const char* fragmentCode, const char* geometryCode)
+//------------------------------------------------------------------------------
+void vtkOpenGLImageAlgorithmHelper::InitializeRenderWindow()
 {
   // make sure it is initialized
   if (!this->RenderWindow)
@@ -72,6 +99,28 @@ void vtkOpenGLImageAlgorithmHelper::Execute(vtkOpenGLImageAlgorithmCallback* cb,
     this->RenderWindow->UnRegister(this);
   }
   this->RenderWindow->Initialize();
+}
+
+//------------------------------------------------------------------------------
+vtkShaderProgram* vtkOpenGLImageAlgorithmHelper::ReadyProgram(
+  const char* vertexCode, const char* fragmentCode, const char* geometryCode)
+{
+  vtkShaderProgram* prog = this->RenderWindow->GetShaderCache()->ReadyShaderProgram(
+    vertexCode, fragmentCode, geometryCode);
+  if (prog != this->Quad.Program)
+  {
+    this->Quad.Program = prog;
+    this->Quad.VAO->ShaderProgramChanged();
+  }
+  return prog;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageAlgorithmHelper::Execute(vtkOpenGLImageAlgorithmCallback* cb,
+  vtkImageData* inImage, vtkDataArray* inArray, vtkImageData* outImage, int outExt[6],
+  const char* vertexCode, const char* fragmentCode, const char* geometryCode)
+{
+  this->InitializeRenderWindow();
 
   // Is it a 2D or 3D image
   int dims[3];
@@ -142,13 +191,7 @@ void vtkOpenGLImageAlgorithmHelper::Execute(vtkOpenGLImageAlgorithmCallback* cb,
   ostate->vtkglDepthMask(false);
   ostate->vtkglClearColor(0.0, 0.0, 0.0, 1.0);
 
-  vtkShaderProgram* prog = this->RenderWindow->GetShaderCache()->ReadyShaderProgram(
-    vertexCode, fragmentCode, geometryCode);
-  if (prog != this->Quad.Program)
-  {
-    this->Quad.Program = prog;
-    this->Quad.VAO->ShaderProgramChanged();
-  }
+  vtkShaderProgram* prog = this->ReadyProgram(vertexCode, fragmentCode, geometryCode);
   cb->InitializeShaderUniforms(prog);
 
   inputTex->Activate();
@@ -190,6 +233,131 @@ void vtkOpenGLImageAlgorithmHelper::Execute(vtkOpenGLImageAlgorithmCallback* cb,
   delete[] ftmp;
 }
 
+//------------------------------------------------------------------------------
+bool vtkOpenGLImageAlgorithmHelper::ExecutePasses(vtkOpenGLImageAlgorithmCallback* cb,
+  vtkImageData* inImage, vtkDataArray* inArray, vtkImageData* outImage, int outExt[6],
+  int numberOfPasses, const char* vertexCode, const char* const* fragmentCodes,
+  const char* geometryCode)
+{
+  int numComps = inArray->GetNumberOfComponents();
+  if (numComps > 4 || numberOfPasses < 1)
+  {
+    vtkErrorMacro("ExecutePasses needs one to four components and at least one pass");
+    return false;
+  }
+
+  this->InitializeRenderWindow();
+
+  int dims[3];
+  int inExt[6];
+  inImage->GetDimensions(dims);
+  inImage->GetExtent(inExt);
+
+  // the input is converted to float, so that every pass reads the values
+  // in their original units and can write them to a texture of the same kind
+  vtkSmartPointer<vtkDataArray> floatArray = inArray;
+  if (inArray->GetDataType() != VTK_FLOAT)
+  {
+    floatArray = vtkSmartPointer<vtkFloatArray>::New();
+    floatArray->DeepCopy(inArray);
+  }
+
+  // the input texture and the intermediate texture are used in turn as the
+  // source and the target of the passes
+  vtkNew<vtkTextureObject> textures[2];
+  textures[0]->SetContext(this->RenderWindow);
+  textures[1]->SetContext(this->RenderWindow);
+  if (!textures[0]->Create3DFromRaw(
+        dims[0], dims[1], dims[2], numComps, VTK_FLOAT, floatArray->GetVoidPointer(0)) ||
+    (numberOfPasses > 1 &&
+      !textures[1]->Create3D(dims[0], dims[1], dims[2], numComps, VTK_FLOAT, false)))
+  {
+    vtkErrorMacro("Could not create the textures for a " << dims[0] << "x" << dims[1] << "x"
+                                                         << dims[2] << " image");
+    return false;
+  }
+
+  // the last pass renders one slice at a time into a 2D texture
+  vtkNew<vtkTextureObject> outputTex;
+  outputTex->SetContext(this->RenderWindow);
+  outputTex->Create2D(dims[0], dims[1], 4, VTK_FLOAT, false);
+
+  vtkNew<vtkOpenGLFramebufferObject> fbo;
+  fbo->SetContext(this->RenderWindow);
+  vtkOpenGLState* ostate = this->RenderWindow->GetState();
+  ostate->PushFramebufferBindings();
+  fbo->Bind();
+  fbo->AddColorAttachment(0, outputTex);
+  fbo->ActivateDrawBuffer(0);
+
+  fbo->StartNonOrtho(dims[0], dims[1]);
+  ostate->vtkglViewport(0, 0, dims[0], dims[1]);
+  ostate->vtkglScissor(0, 0, dims[0], dims[1]);
+  ostate->vtkglDisable(GL_DEPTH_TEST);
+  ostate->vtkglDepthMask(false);
+
+  const int outDims[2] = { outExt[1] - outExt[0] + 1, outExt[3] - outExt[2] + 1 };
+  std::vector<float> ftmp(static_cast<size_t>(outDims[0]) * outDims[1] * 4);
+
+  for (int pass = 0; pass < numberOfPasses; pass++)
+  {
+    const bool lastPass = (pass == numberOfPasses - 1);
+    vtkTextureObject* source = textures[pass % 2];
+    vtkTextureObject* target = textures[(pass + 1) % 2];
+
+    vtkShaderProgram* prog = this->ReadyProgram(vertexCode, fragmentCodes[pass], geometryCode);
+    if (!prog)
+    {
+      vtkErrorMacro("Could not build the shader program of pass " << pass);
+      ostate->PopFramebufferBindings();
+      return false;
+    }
+    cb->InitializeShaderUniforms(prog);
+    cb->UpdatePassUniforms(prog, pass);
+
+    source->Activate();
+    prog->SetUniformi("inputTex1", source->GetTextureUnit());
+    prog->SetUniformf("inputShift", 0.0);
+    prog->SetUniformf("inputScale", 1.0);
+
+    if (lastPass)
+    {
+      fbo->AddColorAttachment(0, outputTex);
+    }
+
+    const int zMin = (lastPass ? outExt[4] : inExt[4]);
+    const int zMax = (lastPass ? outExt[5] : inExt[5]);
+    for (int z = zMin; z <= zMax; z++)
+    {
+      const int slice = z - inExt[4];
+      if (!lastPass)
+      {
+        fbo->AddColorAttachment(0, target, slice);
+      }
+      cb->UpdateShaderUniforms(prog, z);
+      prog->SetUniformi("zSlice", slice);
+      prog->SetUniformf("zPos", (slice + 0.5) / dims[2]);
+      fbo->RenderQuad(0, dims[0] - 1, 0, dims[1] - 1, prog, this->Quad.VAO);
+
+      if (lastPass)
+      {
+        glReadPixels(outExt[0] - inExt[0], outExt[2] - inExt[2], outDims[0], outDims[1], GL_RGBA,
+          GL_FLOAT, ftmp.data());
+        switch (outImage->GetScalarType())
+        {
+          vtkTemplateMacro(vtkOpenGLImageAlgorithmHelperCopy(
+            ftmp.data(), outImage, outExt, z, static_cast<VTK_TT*>(nullptr)));
+        }
+      }
+    }
+
+    source->Deactivate();
+  }
+
+  ostate->PopFramebufferBindings();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLImageAlgorithmHelper::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -16,7 +16,10 @@
  * @class   vtkOpenGLImageAlgorithmHelper
  * @brief   Help image algorithms use the GPU
  *
- * Designed to make it easier to accelerate an image algorithm on the GPU
+ * Designed to make it easier to accelerate an image algorithm on the GPU.
+ * Execute() runs a single fragment shader over each slice of the output,
+ * while ExecutePasses() runs a sequence of fragment shaders whose
+ * intermediate results stay on the GPU, for iterative or separable filters.
  */
 
 #ifndef vtkOpenGLImageAlgorithmHelper_h
@@ -39,6 +42,7 @@ class vtkOpenGLImageAlgorithmCallback
 public:
   virtual void InitializeShaderUniforms(vtkShaderProgram* /* program */) {}
   virtual void UpdateShaderUniforms(vtkShaderProgram* /* program */, int /* zExtent */) {}
+  virtual void UpdatePassUniforms(vtkShaderProgram* /* program */, int /* pass */) {}
   virtual ~vtkOpenGLImageAlgorithmCallback() = default;
   vtkOpenGLImageAlgorithmCallback() = default;
 
@@ -58,6 +62,25 @@ public:
     vtkImageData* outData, int outExt[6], const char* vertexCode, const char* fragmentCode,
     const char* geometryCode);
 
+  /**
+   * Run several passes of fragment shaders over the input, e.g. for the
+   * iterations of an iterative filter or for the axes of a separable one.
+   * The input array is uploaded once as a float texture, and every pass but
+   * the last renders all the slices of the input extent into a float 3D
+   * texture that the next pass samples as inputTex1, so that intermediate
+   * results never leave the GPU. The last pass renders only the slices of
+   * outExt, which are read back into outImage with a cast to its scalar
+   * type. Pass i uses fragmentCodes[i], and the callback's
+   * UpdatePassUniforms() is called at the start of each pass. Besides the
+   * uniforms set by Execute(), the shaders get the index of the slice
+   * within the input texture as zSlice, so that they can texelFetch() the
+   * neighbors of gl_FragCoord. Returns false if the textures could not be
+   * created, e.g. if the input has more than four components.
+   */
+  bool ExecutePasses(vtkOpenGLImageAlgorithmCallback* cb, vtkImageData* inImage,
+    vtkDataArray* inData, vtkImageData* outData, int outExt[6], int numberOfPasses,
+    const char* vertexCode, const char* const* fragmentCodes, const char* geometryCode);
+
   /**
    * Set the render window to get the OpenGL resources from
    */
@@ -67,6 +90,17 @@ protected:
   vtkOpenGLImageAlgorithmHelper();
   ~vtkOpenGLImageAlgorithmHelper() override;
 
+  /**
+   * Create a hidden render window if none was set, and initialize it.
+   */
+  void InitializeRenderWindow();
+
+  /**
+   * Make the program current for the quad and return it.
+   */
+  vtkShaderProgram* ReadyProgram(
+    const char* vertexCode, const char* fragmentCode, const char* geometryCode);
+
   vtkSmartPointer<vtkOpenGLRenderWindow> RenderWindow;
   vtkOpenGLHelper Quad;
 
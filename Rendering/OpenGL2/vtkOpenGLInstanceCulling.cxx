@@ -16,6 +16,7 @@
 #include "vtkOpenGLInstanceCulling.h"
 
 #include "vtkDecimatePro.h"
+#include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLBufferObject.h"
 #include "vtkOpenGLError.h"
@@ -25,12 +26,14 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolyDataNormals.h"
+#include "vtkSMPTools.h"
 #include "vtkShaderProgram.h"
 #include "vtkTransformFeedback.h"
 #include "vtkTriangleFilter.h"
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <sstream>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -392,6 +395,8 @@ void vtkOpenGLInstanceCulling::RunCullingShaders(vtkIdType numInstances,
   vtkOpenGLBufferObject* matrixBuffer, vtkOpenGLBufferObject* colorBuffer,
   vtkOpenGLBufferObject* normalBuffer)
 {
+  this->CulledOnCPU = false;
+
   // update VAO with buffers
   this->CullingHelper.VAO->Bind();
 
@@ -443,6 +448,132 @@ void vtkOpenGLInstanceCulling::RunCullingShaders(vtkIdType numInstances,
 #endif
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLInstanceCulling::RunCullingOnCPU(vtkIdType numInstances,
+  const std::vector<float>& matrices, const std::vector<unsigned char>& colors,
+  const std::vector<float>& normalMatrices, bool withNormals, vtkMatrix4x4* mcdc,
+  vtkMatrix4x4* mcvc, const double bboxSize[3])
+{
+  this->CulledOnCPU = true;
+  std::sort(this->LODList.begin(), this->LODList.end());
+  const int numLODs = static_cast<int>(this->LODList.size());
+  const double* dc = mcdc->GetData();
+  const double* vc = mcvc->GetData();
+
+  // LOD of each instance, -1 when outside of the frustum, as selected by the
+  // vertex shader of the culling program.
+  std::vector<int> levels(numInstances);
+  vtkSMPTools::For(0, numInstances, [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType i = first; i < last; ++i)
+    {
+      // instance matrices are column major, the position is the last column
+      const float* m = &matrices[16 * i];
+      double p[4];
+      for (int r = 0; r < 4; ++r)
+      {
+        p[r] = dc[4 * r] * m[12] + dc[4 * r + 1] * m[13] + dc[4 * r + 2] * m[14] +
+          dc[4 * r + 3] * m[15];
+      }
+      if (!(p[0] < p[3] && p[0] > -p[3] && p[1] < p[3] && p[1] > -p[3]))
+      {
+        levels[i] = -1;
+        continue;
+      }
+
+      double lenPosVC = 0.0;
+      double lenBBoxVC = 0.0;
+      for (int r = 0; r < 3; ++r)
+      {
+        double pc = vc[4 * r] * m[12] + vc[4 * r + 1] * m[13] + vc[4 * r + 2] * m[14] +
+          vc[4 * r + 3] * m[15];
+        double bc = 0.0;
+        for (int c = 0; c < 3; ++c)
+        {
+          bc += vc[4 * r + c] *
+            (m[c] * bboxSize[0] + m[4 + c] * bboxSize[1] + m[8 + c] * bboxSize[2]);
+        }
+        lenPosVC += pc * pc;
+        lenBBoxVC += bc * bc;
+      }
+      const double distance = std::sqrt(lenPosVC) / std::sqrt(lenBBoxVC);
+
+      int level = numLODs - 1;
+      for (int j = 1; j < numLODs; ++j)
+      {
+        if (distance < this->LODList[j].Distance)
+        {
+          level = j - 1;
+          break;
+        }
+      }
+      levels[i] = level;
+    }
+  });
+
+  // rank of each instance among the instances of its LOD
+  std::vector<vtkIdType> ranks(numInstances);
+  std::vector<vtkIdType> counts(numLODs, 0);
+  for (vtkIdType i = 0; i < numInstances; ++i)
+  {
+    if (levels[i] >= 0)
+    {
+      ranks[i] = counts[levels[i]]++;
+    }
+  }
+
+  // interleave the instances as the transform feedback of the culling program
+  const size_t instanceSize = withNormals ? 29 : 20;
+  std::vector<std::vector<float>> buffers(numLODs);
+  for (int j = 0; j < numLODs; ++j)
+  {
+    buffers[j].resize(counts[j] * instanceSize);
+  }
+  vtkSMPTools::For(0, numInstances, [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType i = first; i < last; ++i)
+    {
+      const int level = levels[i];
+      if (level < 0)
+      {
+        continue;
+      }
+      float* instance = &buffers[level][ranks[i] * instanceSize];
+      std::copy(&matrices[16 * i], &matrices[16 * i] + 16, instance);
+      if (this->ColorLOD)
+      {
+        instance[16] = static_cast<float>((level + 1) & 1);
+        instance[17] = static_cast<float>(((level + 1) & 2) >> 1);
+        instance[18] = static_cast<float>(((level + 1) & 4) >> 2);
+      }
+      else
+      {
+        for (int c = 0; c < 3; ++c)
+        {
+          instance[16 + c] = colors[4 * i + c] / 255.f;
+        }
+      }
+      instance[19] = colors[4 * i + 3] / 255.f;
+      if (withNormals)
+      {
+        std::copy(&normalMatrices[9 * i], &normalMatrices[9 * i] + 9, instance + 20);
+      }
+    }
+  });
+
+  this->CPUBuffers.resize(numLODs);
+  for (int j = 0; j < numLODs; ++j)
+  {
+    if (!this->CPUBuffers[j])
+    {
+      this->CPUBuffers[j] = vtkSmartPointer<vtkOpenGLBufferObject>::New();
+    }
+    this->LODList[j].NumberOfInstances = static_cast<int>(counts[j]);
+    if (counts[j] > 0)
+    {
+      this->CPUBuffers[j]->Upload(buffers[j], vtkOpenGLBufferObject::ArrayBuffer);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 vtkOpenGLHelper& vtkOpenGLInstanceCulling::GetHelper()
 {
@@ -458,6 +589,10 @@ vtkOpenGLInstanceCulling::InstanceLOD& vtkOpenGLInstanceCulling::GetLOD(vtkIdTyp
 //------------------------------------------------------------------------------
 vtkOpenGLBufferObject* vtkOpenGLInstanceCulling::GetLODBuffer(vtkIdType index)
 {
+  if (this->CulledOnCPU)
+  {
+    return this->CPUBuffers[index];
+  }
   return this->CullingHelper.Program->GetTransformFeedback()->GetBuffer(index);
 }
 
@@ -27,7 +27,9 @@
  * The geometry shader register the instance to the corresponding vertex stream and
  * therefore the corresponding transform feedback buffer in video memory.
  *
- * @warning   GL_ARB_gpu_shader5 extension is required.
+ * @warning   GL_ARB_gpu_shader5 extension is required by the culling shaders.
+ * Without it, RunCullingOnCPU() culls the instances and selects their LOD on
+ * the CPU with vtkSMPTools, and fills the same LOD buffers.
  *
  * @code{.cpp}
  *
@@ -78,6 +80,7 @@ class vtkOpenGLIndexBufferObject;
 class vtkOpenGLBufferObject;
 class vtkPolyData;
 class vtkOpenGLShaderCache;
+class vtkMatrix4x4;
 
 class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLInstanceCulling : public vtkObject
 {
@@ -144,6 +147,18 @@ public:
   void RunCullingShaders(vtkIdType numInstances, vtkOpenGLBufferObject* matrixBuffer,
     vtkOpenGLBufferObject* colorBuffer, vtkOpenGLBufferObject* normalBuffer);
 
+  /**
+   * Cull the instances and select their LOD on the CPU, with the same rules as
+   * the culling program, then upload the instances of each LOD to the buffers
+   * returned by GetLODBuffer(). matrices, colors and normalMatrices are the
+   * per instance values uploaded by vtkOpenGLGlyph3DHelper, mcdc and mcvc the
+   * model to device and model to view matrices, and bboxSize the size of the
+   * bounding box of the instanced geometry.
+   */
+  void RunCullingOnCPU(vtkIdType numInstances, const std::vector<float>& matrices,
+    const std::vector<unsigned char>& colors, const std::vector<float>& normalMatrices,
+    bool withNormals, vtkMatrix4x4* mcdc, vtkMatrix4x4* mcvc, const double bboxSize[3]);
+
   ///@{
   /**
    * Overload color with unique color per LOD.
@@ -167,6 +182,10 @@ private:
   std::vector<InstanceLOD> LODList;
   vtkSmartPointer<vtkPolyData> PolyData;
   bool ColorLOD = false;
+
+  // LOD buffers filled by RunCullingOnCPU()
+  std::vector<vtkSmartPointer<vtkOpenGLBufferObject>> CPUBuffers;
+  bool CulledOnCPU = false;
 };
 
 VTK_ABI_NAMESPACE_END
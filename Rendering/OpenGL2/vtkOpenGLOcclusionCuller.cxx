@@ -0,0 +1,573 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLOcclusionCuller.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkOpenGLOcclusionCuller.h"
+
+#include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkCommand.h"
+#include "vtkCompositePolyDataMapper2.h"
+#include "vtkCullerCollection.h"
+#include "vtkMath.h"
+#include "vtkMatrix4x4.h"
+#include "vtkObjectFactory.h"
+#include "vtkOpenGLBufferObject.h"
+#include "vtkOpenGLCamera.h"
+#include "vtkOpenGLError.h"
+#include "vtkOpenGLRenderWindow.h"
+#include "vtkOpenGLResourceFreeCallback.h"
+#include "vtkOpenGLShaderCache.h"
+#include "vtkOpenGLState.h"
+#include "vtkOpenGLVertexArrayObject.h"
+#include "vtkProp.h"
+#include "vtkRenderer.h"
+#include "vtkShaderProgram.h"
+#include "vtk_glew.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+// Only whether any sample passed can be queried with OpenGL ES.
+#ifdef GL_ES_VERSION_3_0
+const GLenum OcclusionQueryTarget = GL_ANY_SAMPLES_PASSED_CONSERVATIVE;
+#else
+const GLenum OcclusionQueryTarget = GL_SAMPLES_PASSED;
+#endif
+
+// Bounding boxes are enlarged by this fraction of their diagonal, so that
+// their faces are not hidden by the geometry they bound.
+const double BoxPadding = 1e-3;
+
+// Triangles of a box whose corner i + 2 j + 4 k is at the bounds i, j, k.
+const unsigned int BoxTriangles[36] = { 0, 2, 6, 0, 6, 4, 1, 5, 7, 1, 7, 3, 0, 4, 5, 0, 5, 1, 2,
+  3, 7, 2, 7, 6, 0, 1, 3, 0, 3, 2, 4, 6, 7, 4, 7, 5 };
+
+const char* BoxVertexShader = "//VTK::System::Dec\n"
+                              "in vec4 vertexWC;\n"
+                              "uniform mat4 WCDCMatrix;\n"
+                              "void main() { gl_Position = WCDCMatrix * vertexWC; }\n";
+
+const char* BoxFragmentShader = "//VTK::System::Dec\n"
+                                "//VTK::Output::Dec\n"
+                                "void main() { gl_FragData[0] = vec4(1.0); }\n";
+
+// Occlusion query of the bounding box of a prop or of a block.
+struct BoxQuery
+{
+  GLuint Id = 0;
+  bool Pending = false;
+  bool Visible = true;
+};
+
+struct PropRecord
+{
+  vtkWeakPointer<vtkProp> Prop;
+  BoxQuery Box;
+  int LastSeenFrame = -1;
+  int Stagger = 0;
+  vtkWeakPointer<vtkCompositePolyDataMapper2> Mapper;
+  std::map<unsigned int, BoxQuery> Blocks;
+  std::vector<unsigned int> OccludedBlocks;
+};
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+class vtkOpenGLOcclusionCuller::vtkInternals
+{
+public:
+  std::unordered_map<vtkProp*, PropRecord> Props;
+  // Query objects no longer used, kept for later queries.
+  std::vector<GLuint> FreeQueries;
+  int NextStagger = 0;
+  bool ResetRequested = false;
+
+  void Recycle(BoxQuery& query)
+  {
+    if (query.Id)
+    {
+      this->FreeQueries.push_back(query.Id);
+    }
+    query = BoxQuery();
+  }
+
+  void ClearBlocks(PropRecord& record)
+  {
+    for (auto& block : record.Blocks)
+    {
+      this->Recycle(block.second);
+    }
+    record.Blocks.clear();
+    if (!record.OccludedBlocks.empty())
+    {
+      record.OccludedBlocks.clear();
+      if (record.Mapper)
+      {
+        record.Mapper->SetOccludedBlocks(record.OccludedBlocks);
+      }
+    }
+  }
+
+  void Clear()
+  {
+    for (auto& prop : this->Props)
+    {
+      this->ClearBlocks(prop.second);
+      this->Recycle(prop.second.Box);
+    }
+    this->Props.clear();
+  }
+};
+
+vtkStandardNewMacro(vtkOpenGLOcclusionCuller);
+
+//------------------------------------------------------------------------------
+vtkOpenGLOcclusionCuller::vtkOpenGLOcclusionCuller()
+{
+  this->VisibilityThreshold = 1;
+  this->VisibleQueryInterval = 4;
+  this->CullBlocks = true;
+  this->NumberOfOccludedProps = 0;
+  this->NumberOfOccludedBlocks = 0;
+  this->NumberOfQueries = 0;
+  this->ObserverId = 0;
+  this->Culled = false;
+  this->Frame = 0;
+  this->Program = nullptr;
+  this->ResourceCallback = new vtkOpenGLResourceFreeCallback<vtkOpenGLOcclusionCuller>(
+    this, &vtkOpenGLOcclusionCuller::ReleaseGraphicsResources);
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLOcclusionCuller::~vtkOpenGLOcclusionCuller()
+{
+  if (this->Renderer)
+  {
+    this->Renderer->RemoveObserver(this->ObserverId);
+  }
+  this->ResourceCallback->Release();
+  delete this->ResourceCallback;
+  this->Internals->Clear();
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLOcclusionCuller::Reset()
+{
+  this->Internals->ResetRequested = true;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLOcclusionCuller::ReleaseGraphicsResources(vtkWindow* win)
+{
+  if (!this->ResourceCallback->IsReleasing())
+  {
+    this->ResourceCallback->Release();
+    return;
+  }
+
+  this->Internals->Clear();
+  if (!this->Internals->FreeQueries.empty())
+  {
+    glDeleteQueries(static_cast<GLsizei>(this->Internals->FreeQueries.size()),
+      this->Internals->FreeQueries.data());
+    this->Internals->FreeQueries.clear();
+  }
+  this->VAO->ReleaseGraphicsResources();
+  this->VBO->ReleaseGraphicsResources();
+  this->IBO->ReleaseGraphicsResources();
+  this->Program = nullptr;
+  (void)win;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLOcclusionCuller::Observe(vtkRenderer* ren)
+{
+  if (this->Renderer == ren)
+  {
+    return;
+  }
+  if (this->Renderer)
+  {
+    this->Renderer->RemoveObserver(this->ObserverId);
+    this->Internals->Clear();
+  }
+  this->Renderer = ren;
+  this->ObserverId =
+    ren->AddObserver(vtkCommand::EndEvent, this, &vtkOpenGLOcclusionCuller::IssueQueries);
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLOcclusionCuller::ReadQueryResults()
+{
+  GLuint minimumSamples = static_cast<GLuint>(this->VisibilityThreshold);
+  auto read = [minimumSamples](BoxQuery& query) {
+    if (query.Pending)
+    {
+      GLuint samples = 0;
+      glGetQueryObjectuiv(query.Id, GL_QUERY_RESULT, &samples);
+      query.Visible = samples >= minimumSamples;
+      query.Pending = false;
+    }
+  };
+
+  vtkInternals* internals = this->Internals;
+  for (auto it = internals->Props.begin(); it != internals->Props.end();)
+  {
+    PropRecord& record = it->second;
+    // Forget the props deleted, and those not rendered at the last frame,
+    // which are visible when they come back.
+    if (!record.Prop || record.LastSeenFrame != this->Frame)
+    {
+      internals->ClearBlocks(record);
+      internals->Recycle(record.Box);
+      it = internals->Props.erase(it);
+      continue;
+    }
+    read(record.Box);
+    for (auto& block : record.Blocks)
+    {
+      read(block.second);
+    }
+    if (internals->ResetRequested)
+    {
+      internals->ClearBlocks(record);
+      record.Box.Visible = true;
+    }
+    ++it;
+  }
+  internals->ResetRequested = false;
+}
+
+//------------------------------------------------------------------------------
+double vtkOpenGLOcclusionCuller::Cull(
+  vtkRenderer* ren, vtkProp** propList, int& listLength, int& initialized)
+{
+  vtkInternals* internals = this->Internals;
+  this->Culled = false;
+  this->NumberOfOccludedProps = 0;
+  this->NumberOfOccludedBlocks = 0;
+
+  // Leave the props alone while selecting, the queries are meant for the
+  // depth buffer of the regular renders.
+  bool culling = ren->GetSelector() == nullptr;
+  if (culling)
+  {
+    this->Observe(ren);
+    this->ReadQueryResults();
+    ++this->Frame;
+  }
+
+  double totalTime = 0.0;
+  int kept = 0;
+  for (int i = 0; i < listLength; ++i)
+  {
+    vtkProp* prop = propList[i];
+    if (culling)
+    {
+      PropRecord& record = internals->Props[prop];
+      if (record.Prop != prop)
+      {
+        record.Prop = prop;
+        record.Stagger = internals->NextStagger++;
+      }
+      record.LastSeenFrame = this->Frame;
+
+      vtkActor* actor = vtkActor::SafeDownCast(prop);
+      vtkCompositePolyDataMapper2* mapper =
+        actor ? vtkCompositePolyDataMapper2::SafeDownCast(actor->GetMapper()) : nullptr;
+      if (record.Mapper != mapper || !this->CullBlocks)
+      {
+        internals->ClearBlocks(record);
+        record.Mapper = mapper;
+      }
+
+      if (!record.Box.Visible)
+      {
+        // The blocks are all tested again once the prop is uncovered.
+        internals->ClearBlocks(record);
+        ++this->NumberOfOccludedProps;
+        continue;
+      }
+
+      if (mapper && this->CullBlocks)
+      {
+        std::vector<unsigned int> occludedBlocks;
+        for (const auto& block : record.Blocks)
+        {
+          if (!block.second.Visible)
+          {
+            occludedBlocks.push_back(block.first);
+          }
+        }
+        if (occludedBlocks != record.OccludedBlocks)
+        {
+          record.OccludedBlocks = occludedBlocks;
+          mapper->SetOccludedBlocks(occludedBlocks);
+        }
+        this->NumberOfOccludedBlocks += static_cast<int>(occludedBlocks.size());
+      }
+    }
+
+    double time = initialized ? prop->GetRenderTimeMultiplier() : 1.0;
+    prop->SetRenderTimeMultiplier(time);
+    totalTime += time;
+    propList[kept++] = prop;
+  }
+  for (int i = kept; i < listLength; ++i)
+  {
+    propList[i] = nullptr;
+  }
+  listLength = kept;
+  initialized = 1;
+  this->Culled = culling;
+  return totalTime;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLOcclusionCuller::IssueQueries(vtkObject* caller, unsigned long, void*)
+{
+  vtkRenderer* ren = vtkRenderer::SafeDownCast(caller);
+  if (!this->Culled)
+  {
+    // Stop observing the renderer once removed from its cullers, showing
+    // again the blocks hidden by this culler.
+    if (ren && !ren->GetCullers()->IsItemPresent(this))
+    {
+      ren->RemoveObserver(this->ObserverId);
+      this->Renderer = nullptr;
+      this->Internals->Clear();
+    }
+    return;
+  }
+  this->Culled = false;
+  this->NumberOfQueries = 0;
+
+  vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow());
+  if (!renWin)
+  {
+    return;
+  }
+
+  // Collect the boxes to test, in world coordinates. Boxes crossing the near
+  // plane are considered visible, as they would be clipped.
+  double planes[24];
+  ren->GetActiveCamera()->GetFrustumPlanes(ren->GetTiledAspectRatio(), planes);
+  const double* nearPlane = planes + 16;
+  std::vector<float> corners;
+  std::vector<BoxQuery*> queries;
+  auto addBox = [&](const double bounds[6], vtkMatrix4x4* matrix, BoxQuery& query) {
+    int flatAxes = 0;
+    double diagonal = 0.0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      double length = bounds[2 * axis + 1] - bounds[2 * axis];
+      flatAxes += length <= 0.0 ? 1 : 0;
+      diagonal += length * length;
+    }
+    // Lines and points may be rendered where their box covers no sample.
+    if (!vtkMath::AreBoundsInitialized(bounds) || flatAxes > 1)
+    {
+      query.Visible = true;
+      return;
+    }
+    double padding = BoxPadding * std::sqrt(diagonal);
+    double boxCorners[8][3];
+    for (int c = 0; c < 8; ++c)
+    {
+      double x[4];
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        x[axis] = (c >> axis) & 1 ? bounds[2 * axis + 1] + padding : bounds[2 * axis] - padding;
+      }
+      x[3] = 1.0;
+      if (matrix)
+      {
+        matrix->MultiplyPoint(x, x);
+      }
+      if (nearPlane[0] * x[0] + nearPlane[1] * x[1] + nearPlane[2] * x[2] + nearPlane[3] < 0.0)
+      {
+        query.Visible = true;
+        return;
+      }
+      std::copy(x, x + 3, boxCorners[c]);
+    }
+    for (int c = 0; c < 8; ++c)
+    {
+      corners.insert(corners.end(), boxCorners[c], boxCorners[c] + 3);
+    }
+    queries.push_back(&query);
+  };
+
+  std::vector<unsigned int> flatIndices;
+  std::vector<double> blockBounds;
+  for (auto& prop : this->Internals->Props)
+  {
+    PropRecord& record = prop.second;
+    if (record.LastSeenFrame != this->Frame || !record.Prop)
+    {
+      continue;
+    }
+    // Occluded boxes are tested at every frame, visible ones at intervals
+    // once tested a first time.
+    bool rendered = record.Box.Visible;
+    if (!rendered || !record.Box.Id ||
+      (this->Frame + record.Stagger) % this->VisibleQueryInterval == 0)
+    {
+      const double* bounds = record.Prop->GetBounds();
+      if (bounds)
+      {
+        addBox(bounds, nullptr, record.Box);
+      }
+    }
+
+    vtkActor* actor = vtkActor::SafeDownCast(record.Prop);
+    if (!rendered || !actor || !record.Mapper || !this->CullBlocks)
+    {
+      continue;
+    }
+    record.Mapper->GetVisibleBlocks(flatIndices, blockBounds);
+    std::map<unsigned int, BoxQuery> blocks;
+    for (size_t b = 0; b < flatIndices.size(); ++b)
+    {
+      BoxQuery& query = blocks[flatIndices[b]];
+      auto found = record.Blocks.find(flatIndices[b]);
+      if (found != record.Blocks.end())
+      {
+        query = found->second;
+        record.Blocks.erase(found);
+      }
+    }
+    // Recycle the queries of the blocks no longer rendered.
+    for (auto& block : record.Blocks)
+    {
+      this->Internals->Recycle(block.second);
+    }
+    record.Blocks.swap(blocks);
+    vtkMatrix4x4* matrix = actor->GetIsIdentity() ? nullptr : actor->GetMatrix();
+    for (size_t b = 0; b < flatIndices.size(); ++b)
+    {
+      BoxQuery& query = record.Blocks[flatIndices[b]];
+      if (!query.Visible || !query.Id ||
+        (this->Frame + record.Stagger + flatIndices[b]) % this->VisibleQueryInterval == 0)
+      {
+        addBox(blockBounds.data() + 6 * b, matrix, query);
+      }
+    }
+  }
+  if (queries.empty())
+  {
+    return;
+  }
+
+  this->ResourceCallback->RegisterGraphicsResources(renWin);
+  if (!this->Program)
+  {
+    this->Program =
+      renWin->GetShaderCache()->ReadyShaderProgram(BoxVertexShader, BoxFragmentShader, "");
+  }
+  else
+  {
+    renWin->GetShaderCache()->ReadyShaderProgram(this->Program);
+  }
+  if (!this->Program)
+  {
+    return;
+  }
+
+  std::vector<unsigned int> indices(36 * queries.size());
+  for (size_t q = 0; q < queries.size(); ++q)
+  {
+    for (int i = 0; i < 36; ++i)
+    {
+      indices[36 * q + i] = static_cast<unsigned int>(8 * q) + BoxTriangles[i];
+    }
+  }
+  this->VBO->Upload(corners, vtkOpenGLBufferObject::ArrayBuffer);
+  this->VAO->Bind();
+  this->VAO->AddAttributeArray(
+    this->Program, this->VBO, "vertexWC", 0, sizeof(float) * 3, VTK_FLOAT, 3, false);
+  this->IBO->Upload(indices, vtkOpenGLBufferObject::ElementArrayBuffer);
+
+  vtkOpenGLCamera* cam = static_cast<vtkOpenGLCamera*>(ren->GetActiveCamera());
+  vtkMatrix4x4* wcdc;
+  vtkMatrix4x4* wcvc;
+  vtkMatrix3x3* norms;
+  vtkMatrix4x4* vcdc;
+  cam->GetKeyMatrices(ren, wcvc, norms, vcdc, wcdc);
+  this->Program->SetUniformMatrix("WCDCMatrix", wcdc);
+
+  vtkOpenGLState* ostate = renWin->GetState();
+  {
+    // Test the boxes against the depth buffer without changing any buffer.
+    vtkOpenGLState::ScopedglColorMask colorMaskSaver(ostate);
+    vtkOpenGLState::ScopedglDepthMask depthMaskSaver(ostate);
+    vtkOpenGLState::ScopedglDepthFunc depthFuncSaver(ostate);
+    vtkOpenGLState::ScopedglEnableDisable depthTestSaver(ostate, GL_DEPTH_TEST);
+    vtkOpenGLState::ScopedglEnableDisable cullFaceSaver(ostate, GL_CULL_FACE);
+    ostate->vtkglColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    ostate->vtkglDepthMask(GL_FALSE);
+    ostate->vtkglDepthFunc(GL_LEQUAL);
+    ostate->vtkglEnable(GL_DEPTH_TEST);
+    ostate->vtkglDisable(GL_CULL_FACE);
+
+    for (size_t q = 0; q < queries.size(); ++q)
+    {
+      BoxQuery* query = queries[q];
+      if (!query->Id)
+      {
+        if (this->Internals->FreeQueries.empty())
+        {
+          glGenQueries(1, &query->Id);
+        }
+        else
+        {
+          query->Id = this->Internals->FreeQueries.back();
+          this->Internals->FreeQueries.pop_back();
+        }
+      }
+      glBeginQuery(OcclusionQueryTarget, query->Id);
+      glDrawRangeElements(GL_TRIANGLES, static_cast<GLuint>(8 * q),
+        static_cast<GLuint>(8 * q + 7), 36, GL_UNSIGNED_INT,
+        reinterpret_cast<const GLvoid*>(36 * q * sizeof(unsigned int)));
+      glEndQuery(OcclusionQueryTarget);
+      query->Pending = true;
+    }
+  }
+
+  this->IBO->Release();
+  this->VAO->Release();
+  this->NumberOfQueries = static_cast<int>(queries.size());
+  vtkOpenGLCheckErrorMacro("failed after issuing occlusion queries");
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLOcclusionCuller::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "VisibilityThreshold: " << this->VisibilityThreshold << "\n";
+  os << indent << "VisibleQueryInterval: " << this->VisibleQueryInterval << "\n";
+  os << indent << "CullBlocks: " << (this->CullBlocks ? "On" : "Off") << "\n";
+  os << indent << "NumberOfOccludedProps: " << this->NumberOfOccludedProps << "\n";
+  os << indent << "NumberOfOccludedBlocks: " << this->NumberOfOccludedBlocks << "\n";
+  os << indent << "NumberOfQueries: " << this->NumberOfQueries << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,168 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLOcclusionCuller.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkOpenGLOcclusionCuller
+ * @brief   cull props hidden behind other props with occlusion queries
+ *
+ * vtkOpenGLOcclusionCuller culls the props whose bounding box is hidden
+ * behind the geometry rendered by the renderer. Once a frame is rendered,
+ * the bounding boxes of the props are drawn, without changing the color and
+ * depth buffers, within OpenGL occlusion queries. The results are read back
+ * when the next frame is culled: the props of which too few samples passed
+ * the depth test are not rendered, while their bounding box is tested again
+ * at the end of each frame so that they reappear as soon as they are
+ * uncovered, with a delay of one frame. Props found visible are tested again
+ * only every few frames, which keeps the number of queries low when the view
+ * changes little from one frame to the next.
+ *
+ * The blocks of vtkCompositePolyDataMapper2 are culled the same way when the
+ * actor rendering them is visible.
+ *
+ * Props crossing the near plane of the camera, props without bounds such as
+ * 2D props, and all props while selecting are never culled. The culler is
+ * meant to be used by a single renderer, which it observes to issue the
+ * queries, after frustum culling:
+ *
+ * @code
+ * vtkNew<vtkOpenGLOcclusionCuller> culler;
+ * renderer->AddCuller(culler);
+ * @endcode
+ *
+ * @sa
+ * vtkCuller vtkFrustumCoverageCuller vtkCompositePolyDataMapper2
+ */
+
+#ifndef vtkOpenGLOcclusionCuller_h
+#define vtkOpenGLOcclusionCuller_h
+
+#include "vtkCuller.h"
+#include "vtkNew.h"                    // for ivars
+#include "vtkRenderingOpenGL2Module.h" // For export macro
+#include "vtkWeakPointer.h"            // for ivars
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkGenericOpenGLResourceFreeCallback;
+class vtkOpenGLBufferObject;
+class vtkOpenGLVertexArrayObject;
+class vtkShaderProgram;
+class vtkWindow;
+
+class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLOcclusionCuller : public vtkCuller
+{
+public:
+  static vtkOpenGLOcclusionCuller* New();
+  vtkTypeMacro(vtkOpenGLOcclusionCuller, vtkCuller);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Minimum number of samples of the bounding box of a prop, or of a block,
+   * that must pass the depth test for it to be rendered. Larger values also
+   * cull the props that would cover only a few pixels. With OpenGL ES, only
+   * whether any sample passes is known, and 0 or 1 are the useful values.
+   * Default is 1.
+   */
+  vtkSetClampMacro(VisibilityThreshold, int, 0, VTK_INT_MAX);
+  vtkGetMacro(VisibilityThreshold, int);
+  ///@}
+
+  ///@{
+  /**
+   * Number of frames after which the bounding box of a visible prop, or
+   * block, is tested again. Occluded props are tested at every frame.
+   * Default is 4.
+   */
+  vtkSetClampMacro(VisibleQueryInterval, int, 1, VTK_INT_MAX);
+  vtkGetMacro(VisibleQueryInterval, int);
+  ///@}
+
+  ///@{
+  /**
+   * Turn on/off culling the occluded blocks of the visible actors rendered
+   * by a vtkCompositePolyDataMapper2. Default is on.
+   */
+  vtkSetMacro(CullBlocks, bool);
+  vtkGetMacro(CullBlocks, bool);
+  vtkBooleanMacro(CullBlocks, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Statistics of the last frame: the number of props occluded and not
+   * rendered, the number of occluded blocks among the rendered props, and
+   * the number of occlusion queries issued.
+   */
+  vtkGetMacro(NumberOfOccludedProps, int);
+  vtkGetMacro(NumberOfOccludedBlocks, int);
+  vtkGetMacro(NumberOfQueries, int);
+  ///@}
+
+  /**
+   * Forget the visibility of all the props, for instance when the scene
+   * changes completely. All the props are then rendered at the next frame.
+   */
+  void Reset();
+
+  /**
+   * Release the occlusion queries and buffers.
+   */
+  void ReleaseGraphicsResources(vtkWindow* win);
+
+  /**
+   * Remove the props found occluded by the previous frame from the list.
+   */
+  double Cull(vtkRenderer* ren, vtkProp** propList, int& listLength, int& initialized) override;
+
+protected:
+  vtkOpenGLOcclusionCuller();
+  ~vtkOpenGLOcclusionCuller() override;
+
+  /**
+   * Issue the queries once the renderer has rendered the frame.
+   */
+  void IssueQueries(vtkObject* caller, unsigned long event, void* callData);
+
+  void ReadQueryResults();
+  void Observe(vtkRenderer* ren);
+
+  int VisibilityThreshold;
+  int VisibleQueryInterval;
+  bool CullBlocks;
+
+  int NumberOfOccludedProps;
+  int NumberOfOccludedBlocks;
+  int NumberOfQueries;
+
+  vtkWeakPointer<vtkRenderer> Renderer;
+  unsigned long ObserverId;
+  bool Culled;
+  int Frame;
+
+  vtkShaderProgram* Program;
+  vtkNew<vtkOpenGLVertexArrayObject> VAO;
+  vtkNew<vtkOpenGLBufferObject> VBO;
+  vtkNew<vtkOpenGLBufferObject> IBO;
+  vtkGenericOpenGLResourceFreeCallback* ResourceCallback;
+
+private:
+  vtkOpenGLOcclusionCuller(const vtkOpenGLOcclusionCuller&) = delete;
+  void operator=(const vtkOpenGLOcclusionCuller&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -43,7 +43,9 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkProperty.h"
+#include "vtkSMPTools.h"
 #include "vtkShaderProgram.h"
+#include "vtkTransform.h"
 #include "vtkUnsignedCharArray.h"
 
 #include "vtkPointGaussianGS.h"
@@ -272,12 +274,18 @@ void vtkOpenGLPointGaussianMapperHelper::SetCameraShaderParameters(
       vtkMatrix3x3* anorms;
       ((vtkOpenGLActor*)actor)->GetKeyMatrices(mcwc, anorms);
       vtkMatrix4x4::Multiply4x4(mcwc, wcvc, this->TempMatrix4);
-      program->SetUniformMatrix("MCVCMatrix", this->TempMatrix4);
     }
     else
     {
-      program->SetUniformMatrix("MCVCMatrix", wcvc);
+      this->TempMatrix4->DeepCopy(wcvc);
     }
+    // undo the shift and scale of the VBO coordinates
+    vtkOpenGLVertexBufferObject* vvbo = this->VBOs->GetVBO("vertexMC");
+    if (vvbo && vvbo->GetCoordShiftAndScaleEnabled())
+    {
+      vtkMatrix4x4::Multiply4x4(this->VBOShiftScale, this->TempMatrix4, this->TempMatrix4);
+    }
+    program->SetUniformMatrix("MCVCMatrix", this->TempMatrix4);
 
     // add in uniforms for parallel and distance
     cellBO.Program->SetUniformi("cameraParallel", cam->GetParallelProjection());
@@ -298,6 +306,44 @@ void vtkOpenGLPointGaussianMapperHelper::SetMapperShaderParameters(
 namespace
 {
 
+// Call functor(splat, pointId) for each splat, concurrently. The splats are
+// the points of the vertex cells, in order, or all the points when there is
+// no vertex cell. The functor must be thread safe.
+template <typename Functor>
+void vtkOpenGLPointGaussianMapperHelperForSplats(
+  vtkCellArray* verts, vtkIdType numPts, Functor&& functor)
+{
+  if (!verts->GetNumberOfCells())
+  {
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        functor(i, i);
+      }
+    });
+  }
+  else if (verts->IsStorage64Bit())
+  {
+    const vtkTypeInt64* ids = verts->GetConnectivityArray64()->GetPointer(0);
+    vtkSMPTools::For(0, verts->GetNumberOfConnectivityIds(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        functor(i, static_cast<vtkIdType>(ids[i]));
+      }
+    });
+  }
+  else
+  {
+    const vtkTypeInt32* ids = verts->GetConnectivityArray32()->GetPointer(0);
+    vtkSMPTools::For(0, verts->GetNumberOfConnectivityIds(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        functor(i, static_cast<vtkIdType>(ids[i]));
+      }
+    });
+  }
+}
+
 template <typename PointDataType>
 PointDataType vtkOpenGLPointGaussianMapperHelperGetComponent(
   PointDataType* tuple, int nComponent, int component)
@@ -342,8 +388,28 @@ void vtkOpenGLPointGaussianMapperHelperComputeColor(unsigned char* rcolor, unsig
 
   if (opacities)
   {
-    double opacity = vtkOpenGLPointGaussianMapperHelperGetComponent<double>(
-      opacities->GetTuple(index), opacities->GetNumberOfComponents(), opacitiesComponent);
+    // GetComponent, unlike GetTuple, may be called concurrently. Same
+    // semantic as vtkOpenGLPointGaussianMapperHelperGetComponent: a
+    // non-existing component gives the magnitude of the tuple.
+    const int nComponents = opacities->GetNumberOfComponents();
+    double opacity = 0.0;
+    if (nComponents == 1)
+    {
+      opacity = opacities->GetComponent(index, 0);
+    }
+    else if (opacitiesComponent >= 0 && opacitiesComponent < nComponents)
+    {
+      opacity = opacities->GetComponent(index, opacitiesComponent);
+    }
+    else
+    {
+      for (int c = 0; c < nComponents; ++c)
+      {
+        const double value = opacities->GetComponent(index, c);
+        opacity += value * value;
+      }
+      opacity = sqrt(opacity);
+    }
     if (self->OpacityTable)
     {
       double tindex = (opacity - self->OpacityOffset) * self->OpacityScale;
@@ -375,31 +441,11 @@ void vtkOpenGLPointGaussianMapperHelperColors(vtkUnsignedCharArray* outColors, v
   vtkOpenGLPointGaussianMapperHelper* self, vtkCellArray* verts)
 {
   unsigned char* vPtr = static_cast<unsigned char*>(outColors->GetVoidPointer(0));
-
-  // iterate over cells or not
-  if (verts->GetNumberOfCells())
-  {
-    const vtkIdType* indices(nullptr);
-    vtkIdType npts(0);
-    for (verts->InitTraversal(); verts->GetNextCell(npts, indices);)
-    {
-      for (int i = 0; i < npts; ++i)
-      {
-        vtkOpenGLPointGaussianMapperHelperComputeColor(
-          vPtr, colors, colorComponents, indices[i], opacities, opacitiesComponent, self);
-        vPtr += 4;
-      }
-    }
-  }
-  else
-  {
-    for (vtkIdType i = 0; i < numPts; i++)
-    {
+  vtkOpenGLPointGaussianMapperHelperForSplats(
+    verts, numPts, [&](vtkIdType splat, vtkIdType pointId) {
       vtkOpenGLPointGaussianMapperHelperComputeColor(
-        vPtr, colors, colorComponents, i, opacities, opacitiesComponent, self);
-      vPtr += 4;
-    }
-  }
+        vPtr + 4 * splat, colors, colorComponents, pointId, opacities, opacitiesComponent, self);
+    });
 }
 
 float vtkOpenGLPointGaussianMapperHelperGetRadius(
@@ -435,41 +481,16 @@ void vtkOpenGLPointGaussianMapperHelperSizes(vtkFloatArray* scales, PointDataTyp
   vtkCellArray* verts)
 {
   float* it = static_cast<float*>(scales->GetVoidPointer(0));
-
-  // iterate over cells or not
-  if (verts->GetNumberOfCells())
-  {
-    const vtkIdType* indices(nullptr);
-    vtkIdType npts(0);
-    for (verts->InitTraversal(); verts->GetNextCell(npts, indices);)
-    {
-      for (vtkIdType i = 0; i < npts; ++i)
-      {
-        PointDataType size = 1.0;
-        if (sizes)
-        {
-          size = vtkOpenGLPointGaussianMapperHelperGetComponent<PointDataType>(
-            &sizes[indices[i] * nComponent], nComponent, component);
-        }
-        float radiusFloat = vtkOpenGLPointGaussianMapperHelperGetRadius(size, self);
-        *(it++) = radiusFloat;
-      }
-    }
-  }
-  else
-  {
-    for (vtkIdType i = 0; i < numPts; i++)
-    {
+  vtkOpenGLPointGaussianMapperHelperForSplats(
+    verts, numPts, [&](vtkIdType splat, vtkIdType pointId) {
       PointDataType size = 1.0;
       if (sizes)
       {
         size = vtkOpenGLPointGaussianMapperHelperGetComponent<PointDataType>(
-          &sizes[i * nComponent], nComponent, component);
+          &sizes[pointId * nComponent], nComponent, component);
       }
-      float radiusFloat = vtkOpenGLPointGaussianMapperHelperGetRadius(size, self);
-      *(it++) = radiusFloat;
-    }
-  }
+      it[splat] = vtkOpenGLPointGaussianMapperHelperGetRadius(size, self);
+    });
 }
 
 } // anonymous namespace
@@ -510,6 +531,8 @@ void vtkOpenGLPointGaussianMapperHelper::BuildBufferObjects(
 
   this->UsingPoints = this->Owner->GetScaleFactor() == 0.0;
 
+  const int positionType = this->UseQuantizedPositions ? VTK_UNSIGNED_SHORT : VTK_FLOAT;
+
   // if we have an opacity array then get it and if we have
   // a ScalarOpacityFunction map the array through it
   bool hasOpacityArray = this->Owner->GetOpacityArray() != nullptr &&
@@ -539,29 +562,21 @@ void vtkOpenGLPointGaussianMapperHelper::BuildBufferObjects(
     auto srcData = poly->GetPoints()->GetData();
     const auto srcTuples = vtk::DataArrayTupleRange<3>(srcData);
     auto dstTuples = vtk::DataArrayTupleRange<3>(pts);
-    auto dstIter = dstTuples.begin();
-    auto verts = poly->GetVerts();
-    const vtkIdType* indices(nullptr);
-    vtkIdType npts(0);
-    for (verts->InitTraversal(); verts->GetNextCell(npts, indices);)
-    {
-      for (vtkIdType i = 0; i < npts; ++i)
-      {
-        auto srcIter = srcTuples[indices[i]];
-        auto dst = *dstIter;
-        dst[0] = srcIter[0];
-        dst[1] = srcIter[1];
-        dst[2] = srcIter[2];
-        ++dstIter;
-      }
-    }
-
-    this->VBOs->CacheDataArray("vertexMC", pts, ren, VTK_FLOAT);
+    vtkOpenGLPointGaussianMapperHelperForSplats(poly->GetVerts(),
+      poly->GetPoints()->GetNumberOfPoints(), [&](vtkIdType splat, vtkIdType pointId) {
+        const auto src = srcTuples[pointId];
+        auto dst = dstTuples[splat];
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+      });
+
+    this->VBOs->CacheDataArray("vertexMC", pts, ren, positionType);
     pts->Delete();
   }
   else // just pass the points
   {
-    this->VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), ren, VTK_FLOAT);
+    this->VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), ren, positionType);
   }
 
   if (!this->UsingPoints)
@@ -611,6 +626,18 @@ void vtkOpenGLPointGaussianMapperHelper::BuildBufferObjects(
 
   this->VBOs->BuildAllVBOs(ren);
 
+  // quantized positions are shifted and scaled
+  vtkOpenGLVertexBufferObject* posVBO = this->VBOs->GetVBO("vertexMC");
+  if (posVBO && posVBO->GetCoordShiftAndScaleEnabled())
+  {
+    std::vector<double> const& shift = posVBO->GetShift();
+    std::vector<double> const& scale = posVBO->GetScale();
+    this->VBOInverseTransform->Identity();
+    this->VBOInverseTransform->Translate(shift[0], shift[1], shift[2]);
+    this->VBOInverseTransform->Scale(1.0 / scale[0], 1.0 / scale[1], 1.0 / scale[2]);
+    this->VBOInverseTransform->GetTranspose(this->VBOShiftScale);
+  }
+
   // we use no IBO
   for (int i = PrimitiveStart; i < PrimitiveEnd; i++)
   {
@@ -681,6 +708,7 @@ vtkOpenGLPointGaussianMapper::vtkOpenGLPointGaussianMapper()
   this->ScaleScale = 1.0;
   this->OpacityOffset = 0.0;
   this->ScaleOffset = 0.0;
+  this->UseQuantizedPositions = false;
 }
 
 vtkOpenGLPointGaussianMapper::~vtkOpenGLPointGaussianMapper()
@@ -910,6 +938,7 @@ void vtkOpenGLPointGaussianMapper::CopyMapperValuesToHelper(
   helper->ScaleTable = this->ScaleTable;
   helper->ScaleScale = this->ScaleScale;
   helper->ScaleOffset = this->ScaleOffset;
+  helper->SetUseQuantizedPositions(this->UseQuantizedPositions);
   helper->Modified();
 }
 
@@ -60,6 +60,19 @@ public:
   void ProcessSelectorPixelBuffers(
     vtkHardwareSelector* sel, std::vector<unsigned int>& pixeloffsets, vtkProp* prop) override;
 
+  ///@{
+  /**
+   * Turn on/off the quantization of the coordinates of the points to 16 bit
+   * integers in their VBO, over the range of each coordinate of each block,
+   * which divides the GPU memory they use by 1.5. The coordinates are then
+   * accurate to the size of the bounds of the block divided by 65535.
+   * Default is off.
+   */
+  vtkSetMacro(UseQuantizedPositions, bool);
+  vtkGetMacro(UseQuantizedPositions, bool);
+  vtkBooleanMacro(UseQuantizedPositions, bool);
+  ///@}
+
 protected:
   vtkOpenGLPointGaussianMapper();
   ~vtkOpenGLPointGaussianMapper() override;
@@ -92,6 +105,8 @@ protected:
   double ScaleScale;    // used for quick lookups
   double ScaleOffset;   // used for quick lookups
 
+  bool UseQuantizedPositions;
+
   /**
    * We need to override this method because the standard streaming
    * demand driven pipeline may not be what we need as we can handle
@@ -14,10 +14,12 @@
 
 #include "vtkOpenGLPolyDataMapper.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCamera.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCommand.h"
+#include "vtkDataArrayRange.h"
 #include "vtkFloatArray.h"
 #include "vtkHardwareSelector.h"
 #include "vtkIdTypeArray.h"
@@ -35,6 +37,7 @@
 #include "vtkOpenGLBufferObject.h"
 #include "vtkOpenGLCamera.h"
 #include "vtkOpenGLCellToVTKCellMap.h"
+#include "vtkOpenGLClusterCulling.h"
 #include "vtkOpenGLError.h"
 #include "vtkOpenGLHelper.h"
 #include "vtkOpenGLIndexBufferObject.h"
@@ -61,7 +64,9 @@
 #include "vtkScalarsToColors.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
+#include "vtkSMPTools.h"
 #include "vtkShaderProgram.h"
+#include "vtkShortArray.h"
 #include "vtkTextureObject.h"
 #include "vtkTransform.h"
 #include "vtkUnsignedCharArray.h"
@@ -75,7 +80,9 @@
 #include "vtkPolyDataWideLineGS.h"
 
 #include <algorithm>
+#include <cmath>
 #include <sstream>
+#include <type_traits>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -98,6 +105,10 @@ vtkOpenGLPolyDataMapper::vtkOpenGLPolyDataMapper()
   this->ForceTextureCoordinates = false;
   this->SelectionType = VTK_POINTS;
   this->UseProgramPointSize = false;
+  this->UseQuantizedPositions = false;
+  this->UseOctahedralNormals = false;
+  this->OctahedralNormalsSource = nullptr;
+  this->UseClusterCulling = false;
 
   this->PrimitiveIDOffset = 0;
   this->ShiftScaleMethod = vtkOpenGLVertexBufferObject::AUTO_SHIFT_SCALE;
@@ -2031,7 +2042,29 @@ void vtkOpenGLPolyDataMapper::ReplaceShaderNormal(
     bool hasClearCoat = actor->GetProperty()->GetInterpolation() == VTK_PBR &&
       actor->GetProperty()->GetCoatStrength() > 0.0;
 
-    if (this->VBOs->GetNumberOfComponents("normalMC") == 3)
+    const int normalComponents = this->VBOs->GetNumberOfComponents("normalMC");
+    if (normalComponents == 2)
+    {
+      // octahedral encoded normals
+      vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Dec",
+        "//VTK::Normal::Dec\n"
+        "in vec2 normalMC;\n"
+        "uniform mat3 normalMatrix;\n"
+        "out vec3 normalVCVSOutput;\n"
+        "vec3 octahedralDecode(vec2 e)\n"
+        "{\n"
+        "  vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+        "  if (n.z < 0.0)\n"
+        "  {\n"
+        "    n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);\n"
+        "  }\n"
+        "  return normalize(n);\n"
+        "}");
+      vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Impl",
+        "normalVCVSOutput = normalMatrix * octahedralDecode(normalMC);\n"
+        "//VTK::Normal::Impl");
+    }
+    else if (normalComponents == 3)
     {
       vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Dec",
         "//VTK::Normal::Dec\n"
@@ -2041,6 +2074,9 @@ void vtkOpenGLPolyDataMapper::ReplaceShaderNormal(
       vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Impl",
         "normalVCVSOutput = normalMatrix * normalMC;\n"
         "//VTK::Normal::Impl");
+    }
+    if (normalComponents == 2 || normalComponents == 3)
+    {
       vtkShaderProgram::Substitute(GSSource, "//VTK::Normal::Dec",
         "//VTK::Normal::Dec\n"
         "in vec3 normalVCVSOutput[];\n"
@@ -2507,7 +2543,8 @@ bool vtkOpenGLPolyDataMapper::GetNeedToRebuildShaders(
     (vtkOpenGLRenderer::SafeDownCast(ren)->GetUseSphericalHarmonics() ? 0x40 : 0) +
     (actor->GetProperty()->GetCoatStrength() > 0.0 ? 0x80 : 0) +
     (actor->GetProperty()->GetAnisotropy() > 0.0 ? 0x100 : 0) +
-    ((this->VBOs->GetNumberOfComponents("tcoord") % 4) << 9);
+    ((this->VBOs->GetNumberOfComponents("tcoord") % 4) << 9) +
+    (this->VBOs->GetNumberOfComponents("normalMC") == 2 ? 0x800 : 0);
 
   if (cellBO.Program == nullptr || cellBO.ShaderSourceTime < this->GetMTime() ||
     cellBO.ShaderSourceTime < actor->GetProperty()->GetMTime() ||
@@ -3441,8 +3478,27 @@ void vtkOpenGLPolyDataMapper::RenderPieceDraw(vtkRenderer* ren, vtkActor* actor)
       }
 
       this->Primitives[i].IBO->Bind();
-      glDrawRangeElements(mode, 0, static_cast<GLuint>(numVerts - 1),
-        static_cast<GLsizei>(this->Primitives[i].IBO->IndexCount), GL_UNSIGNED_INT, nullptr);
+      if (i == vtkOpenGLPolyDataMapper::PrimitiveTris && representation == VTK_SURFACE &&
+        this->UseClusterCulling && !this->PointPicking &&
+        this->ClusterCulling->GetNumberOfClusters() > 0)
+      {
+        // draw the ranges of triangles left, their primitive ids start at the
+        // first triangle of the range
+        this->CullClusters(ren, actor);
+        for (const auto& range : this->ClusterCulling->GetRanges())
+        {
+          this->Primitives[i].Program->SetUniformi(
+            "PrimitiveIDOffset", this->PrimitiveIDOffset + static_cast<int>(range.first));
+          glDrawRangeElements(mode, 0, static_cast<GLuint>(numVerts - 1),
+            static_cast<GLsizei>(3 * range.second), GL_UNSIGNED_INT,
+            reinterpret_cast<const GLvoid*>(3 * range.first * sizeof(GLuint)));
+        }
+      }
+      else
+      {
+        glDrawRangeElements(mode, 0, static_cast<GLuint>(numVerts - 1),
+          static_cast<GLsizei>(this->Primitives[i].IBO->IndexCount), GL_UNSIGNED_INT, nullptr);
+      }
       this->Primitives[i].IBO->Release();
       if (i < 3)
       {
@@ -3473,6 +3529,59 @@ void vtkOpenGLPolyDataMapper::RenderPieceDraw(vtkRenderer* ren, vtkActor* actor)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLPolyDataMapper::CullClusters(vtkRenderer* ren, vtkActor* actor)
+{
+  vtkCamera* cam = ren->GetActiveCamera();
+  vtkNew<vtkMatrix4x4> mcdc;
+  mcdc->DeepCopy(cam->GetCompositeProjectionTransformMatrix(ren->GetTiledAspectRatio(), -1, 1));
+
+  // the camera position, or the direction of projection, in model coordinates
+  double camera[4];
+  if (cam->GetParallelProjection())
+  {
+    cam->GetDirectionOfProjection(camera);
+    camera[3] = 0.0;
+  }
+  else
+  {
+    cam->GetPosition(camera);
+    camera[3] = 1.0;
+  }
+
+  // the faces culled by OpenGL follow the winding on screen, which a
+  // mirroring actor matrix reverses
+  vtkProperty* prop = actor->GetProperty();
+  bool cullFront = !prop->GetBackfaceCulling() && prop->GetFrontfaceCulling();
+  if (!actor->GetIsIdentity())
+  {
+    vtkMatrix4x4* mcwc = actor->GetMatrix();
+    vtkMatrix4x4::Multiply4x4(mcdc, mcwc, mcdc);
+    vtkNew<vtkMatrix4x4> wcmc;
+    vtkMatrix4x4::Invert(mcwc, wcmc);
+    wcmc->MultiplyPoint(camera, camera);
+    if (mcwc->Determinant() < 0.0)
+    {
+      cullFront = !cullFront;
+    }
+  }
+
+  this->ClusterCulling->Cull(
+    mcdc, camera, prop->GetBackfaceCulling() || prop->GetFrontfaceCulling(), cullFront);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkOpenGLPolyDataMapper::GetNumberOfClusters()
+{
+  return this->ClusterCulling->GetNumberOfClusters();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkOpenGLPolyDataMapper::GetNumberOfCulledClusters()
+{
+  return this->ClusterCulling->GetNumberOfCulledClusters();
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLPolyDataMapper::RenderPieceFinish(vtkRenderer* ren, vtkActor*)
 {
@@ -3809,6 +3918,66 @@ void vtkOpenGLPolyDataMapper::BuildCellTextures(
   }
 }
 
+namespace
+{
+// Encode unit vectors on the octahedron unfolded on the unit square, in
+// signed normalized shorts.
+struct vtkOctahedralEncodeWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* normals, vtkShortArray* encoded)
+  {
+    const auto tuples = vtk::DataArrayTupleRange<3>(normals);
+    short* dst = encoded->GetPointer(0);
+    auto encode = [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const auto n = tuples[i];
+        double x = n[0];
+        double y = n[1];
+        const double z = n[2];
+        const double l1 = std::abs(x) + std::abs(y) + std::abs(z);
+        if (l1 > 0.0)
+        {
+          x /= l1;
+          y /= l1;
+        }
+        if (z < 0.0)
+        {
+          const double fx = (1.0 - std::abs(y)) * (x >= 0.0 ? 1.0 : -1.0);
+          y = (1.0 - std::abs(x)) * (y >= 0.0 ? 1.0 : -1.0);
+          x = fx;
+        }
+        dst[2 * i] = static_cast<short>(std::lround(x * VTK_SHORT_MAX));
+        dst[2 * i + 1] = static_cast<short>(std::lround(y * VTK_SHORT_MAX));
+      }
+    };
+    // arrays not handled by the dispatcher may not support concurrent reads
+    if (std::is_same<ArrayT, vtkDataArray>::value)
+    {
+      encode(0, tuples.size());
+    }
+    else
+    {
+      vtkSMPTools::For(0, tuples.size(), encode);
+    }
+  }
+};
+
+void vtkEncodeOctahedralNormals(vtkDataArray* normals, vtkShortArray* encoded)
+{
+  encoded->SetNumberOfComponents(2);
+  encoded->SetNumberOfTuples(normals->GetNumberOfTuples());
+  vtkOctahedralEncodeWorker worker;
+  if (!vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>::Execute(
+        normals, worker, encoded))
+  {
+    worker(normals, encoded);
+  }
+  encoded->Modified();
+}
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLPolyDataMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* act)
 {
@@ -3922,7 +4091,8 @@ void vtkOpenGLPolyDataMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* act
     this->VBOs->CacheDataArray(itr.first.c_str(), da, cache, VTK_FLOAT);
   }
 
-  this->VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), cache, VTK_FLOAT);
+  this->VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), cache,
+    this->UseQuantizedPositions ? VTK_UNSIGNED_SHORT : VTK_FLOAT);
   vtkOpenGLVertexBufferObject* posVBO = this->VBOs->GetVBO("vertexMC");
   if (posVBO)
   {
@@ -3932,12 +4102,26 @@ void vtkOpenGLPolyDataMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* act
     posVBO->SetCamera(ren->GetActiveCamera());
   }
 
-  this->VBOs->CacheDataArray("normalMC", n, cache, VTK_FLOAT);
+  // Look for tangents attribute
+  vtkFloatArray* tangents = vtkFloatArray::SafeDownCast(poly->GetPointData()->GetTangents());
+
+  if (n && this->UseOctahedralNormals && !tangents && n->GetNumberOfComponents() == 3)
+  {
+    if (this->OctahedralNormalsSource != n ||
+      n->GetMTime() > this->OctahedralNormals->GetMTime())
+    {
+      vtkEncodeOctahedralNormals(n, this->OctahedralNormals);
+      this->OctahedralNormalsSource = n;
+    }
+    this->VBOs->CacheDataArray("normalMC", this->OctahedralNormals, cache, VTK_SHORT);
+  }
+  else
+  {
+    this->VBOs->CacheDataArray("normalMC", n, cache, VTK_FLOAT);
+  }
   this->VBOs->CacheDataArray("scalarColor", c, cache, VTK_UNSIGNED_CHAR);
   this->VBOs->CacheDataArray("tcoord", tcoords, cache, VTK_FLOAT);
 
-  // Look for tangents attribute
-  vtkFloatArray* tangents = vtkFloatArray::SafeDownCast(poly->GetPointData()->GetTangents());
   if (tangents)
   {
     this->VBOs->CacheDataArray("tangentMC", tangents, cache, VTK_FLOAT);
@@ -4008,10 +4192,17 @@ void vtkOpenGLPolyDataMapper::BuildIBO(vtkRenderer* ren, vtkActor* act, vtkPolyD
   this->TempState.Append(representation, "representation");
   this->TempState.Append(ef ? ef->GetMTime() : 0, "edge flags mtime");
   this->TempState.Append(draw_surface_with_edges, "draw surface with edges");
+  // the clusters depend on the points too
+  this->TempState.Append(this->UseClusterCulling && poly->GetPoints() &&
+        representation == VTK_SURFACE
+      ? poly->GetPoints()->GetMTime()
+      : 0,
+    "cluster culling");
 
   if (this->IBOBuildState != this->TempState)
   {
     this->EdgeValues.clear();
+    this->ClusterCulling->Clear();
 
     this->IBOBuildState = this->TempState;
     this->Primitives[PrimitivePoints].IBO->CreatePointIndexBuffer(prims[0]);
@@ -4042,29 +4233,37 @@ void vtkOpenGLPolyDataMapper::BuildIBO(vtkRenderer* ren, vtkActor* act, vtkPolyD
       }
       else // SURFACE
       {
-        if (draw_surface_with_edges)
+        std::vector<unsigned char>* edgeValues =
+          draw_surface_with_edges ? &this->EdgeValues : nullptr;
+        if (this->UseClusterCulling && prims[2]->GetNumberOfCells())
         {
-          this->Primitives[PrimitiveTris].IBO->CreateTriangleIndexBuffer(
-            prims[2], poly->GetPoints(), &this->EdgeValues, ef);
-          if (!this->EdgeValues.empty())
-          {
-            if (!this->EdgeTexture)
-            {
-              this->EdgeTexture = vtkTextureObject::New();
-              this->EdgeBuffer = vtkOpenGLBufferObject::New();
-              this->EdgeBuffer->SetType(vtkOpenGLBufferObject::TextureBuffer);
-            }
-            this->EdgeTexture->SetContext(static_cast<vtkOpenGLRenderWindow*>(ren->GetVTKWindow()));
-            this->EdgeBuffer->Upload(this->EdgeValues, vtkOpenGLBufferObject::TextureBuffer);
-            this->EdgeTexture->CreateTextureBuffer(
-              static_cast<unsigned int>(this->EdgeValues.size()), 1, VTK_UNSIGNED_CHAR,
-              this->EdgeBuffer);
-          }
+          // keep the indices to split the triangles into clusters
+          std::vector<unsigned int> indexArray;
+          vtkOpenGLIndexBufferObject::AppendTriangleIndexBuffer(
+            indexArray, prims[2], poly->GetPoints(), 0, edgeValues, edgeValues ? ef : nullptr);
+          this->Primitives[PrimitiveTris].IBO->Upload(
+            indexArray, vtkOpenGLIndexBufferObject::ElementArrayBuffer);
+          this->Primitives[PrimitiveTris].IBO->IndexCount = indexArray.size();
+          this->ClusterCulling->BuildClusters(indexArray, poly->GetPoints());
         }
         else
         {
           this->Primitives[PrimitiveTris].IBO->CreateTriangleIndexBuffer(
-            prims[2], poly->GetPoints(), nullptr, nullptr);
+            prims[2], poly->GetPoints(), edgeValues, edgeValues ? ef : nullptr);
+        }
+        if (!this->EdgeValues.empty())
+        {
+          if (!this->EdgeTexture)
+          {
+            this->EdgeTexture = vtkTextureObject::New();
+            this->EdgeBuffer = vtkOpenGLBufferObject::New();
+            this->EdgeBuffer->SetType(vtkOpenGLBufferObject::TextureBuffer);
+          }
+          this->EdgeTexture->SetContext(static_cast<vtkOpenGLRenderWindow*>(ren->GetVTKWindow()));
+          this->EdgeBuffer->Upload(this->EdgeValues, vtkOpenGLBufferObject::TextureBuffer);
+          this->EdgeTexture->CreateTextureBuffer(
+            static_cast<unsigned int>(this->EdgeValues.size()), 1, VTK_UNSIGNED_CHAR,
+            this->EdgeBuffer);
         }
         this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips].IBO->CreateStripIndexBuffer(
           prims[3], false);
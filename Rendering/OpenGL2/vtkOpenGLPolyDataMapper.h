@@ -39,12 +39,14 @@ class vtkGenericOpenGLResourceFreeCallback;
 class vtkMatrix4x4;
 class vtkMatrix3x3;
 class vtkOpenGLCellToVTKCellMap;
+class vtkOpenGLClusterCulling;
 class vtkOpenGLRenderTimer;
 class vtkOpenGLTexture;
 class vtkOpenGLBufferObject;
 class vtkOpenGLVertexBufferObject;
 class vtkOpenGLVertexBufferObjectGroup;
 class vtkPoints;
+class vtkShortArray;
 class vtkTexture;
 class vtkTextureObject;
 class vtkTransform;
@@ -175,6 +177,56 @@ public:
   vtkSetMacro(UseProgramPointSize, bool);
   vtkBooleanMacro(UseProgramPointSize, bool);
 
+  ///@{
+  /**
+   * Turn on/off the quantization of the coordinates of the points to 16 bit
+   * integers in their VBO, over the range of each coordinate, which divides
+   * the GPU memory they use by 1.5. The coordinates are then accurate to
+   * the size of the bounds divided by 65535. Default is off.
+   */
+  vtkSetMacro(UseQuantizedPositions, bool);
+  vtkGetMacro(UseQuantizedPositions, bool);
+  vtkBooleanMacro(UseQuantizedPositions, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Turn on/off the octahedral encoding of the point normals on two 16 bit
+   * integers in their VBO, decoded by the vertex shader, which divides the
+   * GPU memory they use by 3. The normals of data with tangents are not
+   * encoded, as normal mapping needs both. Default is off.
+   *
+   * vtkCompositePolyDataMapper2 does not use these encodings.
+   */
+  vtkSetMacro(UseOctahedralNormals, bool);
+  vtkGetMacro(UseOctahedralNormals, bool);
+  vtkBooleanMacro(UseOctahedralNormals, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Turn on/off the culling of clusters of triangles. The triangles of the
+   * surface are split into clusters of up to 64 vertices and 124 triangles,
+   * and each render only draws the clusters that may be in the frustum, and
+   * that may face the camera when the property culls back or front faces.
+   * This helps large surfaces of which only a part is visible, at the cost
+   * of splitting the triangles when the points or the cells change. Only the
+   * polygons of the surface representation are culled. Default is off.
+   *
+   * vtkCompositePolyDataMapper2 does not cull clusters.
+   */
+  vtkSetMacro(UseClusterCulling, bool);
+  vtkGetMacro(UseClusterCulling, bool);
+  vtkBooleanMacro(UseClusterCulling, bool);
+  ///@}
+
+  /**
+   * Number of clusters of triangles, and number of them culled by the last
+   * render, when UseClusterCulling is on.
+   */
+  vtkIdType GetNumberOfClusters();
+  vtkIdType GetNumberOfCulledClusters();
+
   enum PrimitiveTypes
   {
     PrimitiveStart = 0,
@@ -454,6 +506,20 @@ protected:
   int ShiftScaleMethod; // for points
   bool PauseShiftScale;
   bool UseProgramPointSize;
+  bool UseQuantizedPositions;
+  bool UseOctahedralNormals;
+
+  // the point normals octahedral encoded, and the normals they encode
+  vtkNew<vtkShortArray> OctahedralNormals;
+  vtkDataArray* OctahedralNormalsSource;
+
+  bool UseClusterCulling;
+  vtkNew<vtkOpenGLClusterCulling> ClusterCulling;
+
+  /**
+   * Cull the clusters of triangles for the camera of the renderer.
+   */
+  void CullClusters(vtkRenderer* ren, vtkActor* actor);
 
   // if set to true, tcoords will be passed to the
   // VBO even if the mapper knows of no texture maps
@@ -532,7 +532,7 @@ void vtkOpenGLRenderer::DeviceRenderTranslucentPolygonalGeometry(vtkFrameBufferO
 
   vtkOpenGLRenderWindow* context = vtkOpenGLRenderWindow::SafeDownCast(this->RenderWindow);
 
-  if (this->UseDepthPeeling && !context)
+  if (!context)
   {
     vtkErrorMacro("OpenGL render window is required.");
     return;
@@ -548,11 +548,12 @@ void vtkOpenGLRenderer::DeviceRenderTranslucentPolygonalGeometry(vtkFrameBufferO
     {
       vtkOrderIndependentTranslucentPass* oit = vtkOrderIndependentTranslucentPass::New();
       this->TranslucentPass = oit;
+      vtkTranslucentPass* tp = vtkTranslucentPass::New();
+      this->TranslucentPass->SetTranslucentPass(tp);
+      tp->Delete();
     }
-    vtkTranslucentPass* tp = vtkTranslucentPass::New();
-    this->TranslucentPass->SetTranslucentPass(tp);
-    tp->Delete();
 
+    VTK_SCOPED_RENDER_EVENT("Weighted Blended OIT", context->GetRenderTimer());
     vtkRenderState s(this);
     s.SetPropArrayAndCount(this->PropArray, this->PropArrayCount);
     s.SetFrameBuffer(fbo);
@@ -614,6 +615,10 @@ void vtkOpenGLRenderer::DeviceRenderTranslucentPolygonalGeometry(vtkFrameBufferO
 
     this->DepthPeelingPass->SetMaximumNumberOfPeels(this->MaximumNumberOfPeels);
     this->DepthPeelingPass->SetOcclusionRatio(this->OcclusionRatio);
+    const char* peelingEventName = vtkDualDepthPeelingPass::SafeDownCast(this->DepthPeelingPass)
+      ? "Dual Depth Peeling"
+      : "Depth Peeling";
+    VTK_SCOPED_RENDER_EVENT(peelingEventName, context->GetRenderTimer());
     vtkRenderState s(this);
     s.SetPropArrayAndCount(this->PropArray, this->PropArrayCount);
     s.SetFrameBuffer(fbo);
@@ -23,9 +23,15 @@
 #include "vtkShaderProgram.h"
 
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
+#include <vector>
 
+#include "vtksys/FStream.hxx"
 #include "vtksys/MD5.h"
+#include "vtksys/SystemTools.hxx"
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkOpenGLShaderCache::Private
@@ -36,6 +42,9 @@ public:
   // map of hash to shader program structs
   std::map<std::string, vtkShaderProgram*> ShaderPrograms;
 
+  // identifies the driver the program binaries are produced by
+  std::string DriverKey;
+
   Private() { md5 = vtksysMD5_New(); }
 
   ~Private() { vtksysMD5_Delete(this->md5); }
@@ -81,6 +90,7 @@ vtkOpenGLShaderCache::vtkOpenGLShaderCache()
   this->LastShaderBound = nullptr;
   this->OpenGLMajorVersion = 0;
   this->OpenGLMinorVersion = 0;
+  this->ProgramBinaryDirectory = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -94,6 +104,7 @@ vtkOpenGLShaderCache::~vtkOpenGLShaderCache()
   }
 
   delete this->Internal;
+  this->SetProgramBinaryDirectory(nullptr);
 }
 
 // perform System and Output replacements
@@ -281,10 +292,23 @@ vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(
     shader->SetTransformFeedback(cap);
   }
 
-  // compile if needed
-  if (!shader->GetCompiled() && !shader->CompileShader())
+  // compile if needed, unless a binary of the program is cached
+  if (!shader->GetCompiled())
   {
-    return nullptr;
+    const bool useBinaries = !cap && this->ProgramBinaryDirectory &&
+      *this->ProgramBinaryDirectory && !shader->GetMD5Hash().empty();
+    if (!useBinaries || !this->LoadProgramBinary(shader))
+    {
+      shader->RetrievableBinary = useBinaries;
+      if (!shader->CompileShader())
+      {
+        return nullptr;
+      }
+      if (useBinaries)
+      {
+        this->SaveProgramBinary(shader);
+      }
+    }
   }
 
   // bind if needed
@@ -296,6 +320,99 @@ vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(
   return shader;
 }
 
+namespace
+{
+// header of the program binary files
+const char ProgramBinaryMagic[8] = { 'v', 't', 'k', 'P', 'r', 'g', 'B', '1' };
+}
+
+std::string vtkOpenGLShaderCache::GetProgramBinaryFileName(vtkShaderProgram* shader)
+{
+  if (this->Internal->DriverKey.empty())
+  {
+    const char* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+    const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    this->Internal->ComputeMD5(vendor, renderer, version, this->Internal->DriverKey);
+  }
+  std::string key;
+  this->Internal->ComputeMD5(
+    shader->GetMD5Hash().c_str(), this->Internal->DriverKey.c_str(), nullptr, key);
+  return std::string(this->ProgramBinaryDirectory) + "/" + key + ".bin";
+}
+
+bool vtkOpenGLShaderCache::LoadProgramBinary(vtkShaderProgram* shader)
+{
+  const std::string fileName = this->GetProgramBinaryFileName(shader);
+  vtksys::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+  if (!file)
+  {
+    return false;
+  }
+
+  char magic[sizeof(ProgramBinaryMagic)];
+  std::uint32_t format = 0;
+  std::uint32_t length = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&format), sizeof(format));
+  file.read(reinterpret_cast<char*>(&length), sizeof(length));
+  if (!file || memcmp(magic, ProgramBinaryMagic, sizeof(magic)) != 0 || length == 0)
+  {
+    return false;
+  }
+  std::vector<char> binary(length);
+  file.read(binary.data(), length);
+  if (!file)
+  {
+    return false;
+  }
+
+  if (!shader->LoadBinary(format, binary))
+  {
+    vtkDebugMacro("Discarding the program binary " << fileName << ": " << shader->GetError());
+    shader->ReleaseGraphicsResources(nullptr);
+    return false;
+  }
+  return true;
+}
+
+void vtkOpenGLShaderCache::SaveProgramBinary(vtkShaderProgram* shader)
+{
+  unsigned int format = 0;
+  std::vector<char> binary;
+  if (!shader->GetBinary(format, binary))
+  {
+    return;
+  }
+
+  // write to a temporary file then rename it, so that concurrent processes
+  // never read a partial binary
+  vtksys::SystemTools::MakeDirectory(this->ProgramBinaryDirectory);
+  const std::string fileName = this->GetProgramBinaryFileName(shader);
+  const std::string tmpFileName =
+    fileName + "." + std::to_string(vtksys::SystemTools::GetTime()) + ".tmp";
+  {
+    vtksys::ofstream file(tmpFileName.c_str(), std::ios::out | std::ios::binary);
+    const std::uint32_t format32 = format;
+    const std::uint32_t length = static_cast<std::uint32_t>(binary.size());
+    file.write(ProgramBinaryMagic, sizeof(ProgramBinaryMagic));
+    file.write(reinterpret_cast<const char*>(&format32), sizeof(format32));
+    file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    file.write(binary.data(), binary.size());
+    if (!file)
+    {
+      vtkWarningMacro("Could not write the program binary " << tmpFileName);
+      file.close();
+      vtksys::SystemTools::RemoveFile(tmpFileName);
+      return;
+    }
+  }
+  if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+  {
+    vtksys::SystemTools::RemoveFile(tmpFileName);
+  }
+}
+
 vtkShaderProgram* vtkOpenGLShaderCache::GetShaderProgram(
   std::map<vtkShader::Type, vtkShader*> shaders)
 {
@@ -374,6 +491,7 @@ void vtkOpenGLShaderCache::ReleaseGraphicsResources(vtkWindow* win)
     iter->second->ReleaseGraphicsResources(win);
   }
   this->OpenGLMajorVersion = 0;
+  this->Internal->DriverKey.clear();
 }
 
 void vtkOpenGLShaderCache::ReleaseCurrentShader()
@@ -411,5 +529,7 @@ int vtkOpenGLShaderCache::BindShader(vtkShaderProgram* shader)
 void vtkOpenGLShaderCache::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ProgramBinaryDirectory: "
+     << (this->ProgramBinaryDirectory ? this->ProgramBinaryDirectory : "(none)") << endl;
 }
 VTK_ABI_NAMESPACE_END
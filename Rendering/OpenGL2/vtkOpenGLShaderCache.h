@@ -26,6 +26,7 @@
 #include "vtkRenderingOpenGL2Module.h" // For export macro
 #include "vtkShader.h"                 // for vtkShader::Type
 #include <map>                         // for methods
+#include <string>                      // for methods
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkTransformFeedback;
@@ -76,6 +77,20 @@ public:
   // Set the time in seconds elapsed since the first render
   void SetElapsedTime(float val) { this->ElapsedTime = val; }
 
+  ///@{
+  /**
+   * Set/Get the directory where the binaries of the linked programs are
+   * cached, so that later sessions can skip compiling and linking them.
+   * A program binary is only valid for the driver that produced it: the
+   * files are keyed on the sources of the program and on the vendor, renderer
+   * and version strings of the driver, and a binary the driver rejects is
+   * compiled again. Programs using transform feedback are not cached.
+   * The default is nullptr, which disables the cache.
+   */
+  vtkSetFilePathMacro(ProgramBinaryDirectory);
+  vtkGetFilePathMacro(ProgramBinaryDirectory);
+  ///@}
+
 protected:
   vtkOpenGLShaderCache();
   ~vtkOpenGLShaderCache() override;
@@ -90,6 +105,11 @@ protected:
   virtual vtkShaderProgram* GetShaderProgram(std::map<vtkShader::Type, vtkShader*> shaders);
   virtual int BindShader(vtkShaderProgram* shader);
 
+  // load the program from, or save it to, the program binary directory
+  bool LoadProgramBinary(vtkShaderProgram* shader);
+  void SaveProgramBinary(vtkShaderProgram* shader);
+  std::string GetProgramBinaryFileName(vtkShaderProgram* shader);
+
   class Private;
   Private* Internal;
   vtkShaderProgram* LastShaderBound;
@@ -99,6 +119,8 @@ protected:
 
   float ElapsedTime;
 
+  char* ProgramBinaryDirectory;
+
 private:
   vtkOpenGLShaderCache(const vtkOpenGLShaderCache&) = delete;
   void operator=(const vtkOpenGLShaderCache&) = delete;
@@ -21,9 +21,15 @@
 #include "vtkOpenGLVertexBufferObjectCache.h"
 #include "vtkPoints.h"
 #include "vtkProp3D.h"
+#include "vtkSMPTools.h"
 
 #include "vtk_glew.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkOpenGLVertexBufferObject);
 
@@ -54,7 +60,10 @@ vtkCxxSetObjectMacro(vtkOpenGLVertexBufferObject, Cache, vtkOpenGLVertexBufferOb
 
 bool vtkOpenGLVertexBufferObject::GetCoordShiftAndScaleEnabled()
 {
-  auto value = GetGlobalCoordShiftAndScaleEnabled() ? this->CoordShiftAndScaleEnabled : false;
+  // quantized coordinates cannot do without their shift and scale
+  auto value = (GetGlobalCoordShiftAndScaleEnabled() || this->DataType == VTK_UNSIGNED_SHORT)
+    ? this->CoordShiftAndScaleEnabled
+    : false;
   vtkDebugMacro(<< this->GetClassName() << " (" << this
                 << "): returning CoordShiftAndScaleEnabled of " << value);
   return value;
@@ -253,9 +262,44 @@ vtkTypeBool vtkOpenGLVertexBufferObject::GetGlobalCoordShiftAndScaleEnabled()
   return vtkOpenGLVertexBufferObject::GlobalCoordShiftAndScaleEnabled;
 }
 
+//-----------------------------------------------------------------------------
+vtkTypeBool vtkOpenGLVertexBufferObject::GlobalPersistentMappingEnabled = 0;
+
+void vtkOpenGLVertexBufferObject::SetGlobalPersistentMappingEnabled(vtkTypeBool val)
+{
+  vtkOpenGLVertexBufferObject::GlobalPersistentMappingEnabled = val;
+}
+
+vtkTypeBool vtkOpenGLVertexBufferObject::GetGlobalPersistentMappingEnabled()
+{
+  return vtkOpenGLVertexBufferObject::GlobalPersistentMappingEnabled;
+}
+
 namespace
 {
 
+// Below this number of tuples the VBO is packed on the calling thread
+const vtkIdType VBOPackingGrain = 32768;
+
+// Convert a shifted and scaled value to the type of the VBO, integer types
+// hold quantized values that are rounded to the nearest.
+template <typename destType>
+typename std::enable_if<!std::is_integral<destType>::value, destType>::type vtkPackValue(
+  double value)
+{
+  return static_cast<destType>(value);
+}
+
+template <typename destType>
+typename std::enable_if<std::is_integral<destType>::value, destType>::type vtkPackValue(
+  double value)
+{
+  value = std::floor(value + 0.5);
+  value = std::max(value, static_cast<double>(std::numeric_limits<destType>::min()));
+  value = std::min(value, static_cast<double>(std::numeric_limits<destType>::max()));
+  return static_cast<destType>(value);
+}
+
 template <typename destType>
 class vtkAppendVBOWorker
 {
@@ -296,27 +340,34 @@ void vtkAppendVBOWorker<destType>::operator()(vtkAOSDataArrayTemplate<ValueType>
     return; // fixme: should handle error here?
   }
 
-  destType* VBOit = reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
+  destType* VBOstart = reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
 
-  ValueType* input = src->Begin();
-  unsigned int numComps = this->VBO->GetNumberOfComponents();
-  unsigned int numTuples = src->GetNumberOfTuples();
+  const ValueType* inputStart = src->Begin();
+  const unsigned int numComps = this->VBO->GetNumberOfComponents();
+  const vtkIdType numTuples = src->GetNumberOfTuples();
+  const bool shiftScale = this->VBO->GetCoordShiftAndScaleEnabled();
 
   // compute extra padding required
   int bytesNeeded = this->VBO->GetDataTypeSize() * this->VBO->GetNumberOfComponents();
   int extraComponents = ((4 - (bytesNeeded % 4)) % 4) / this->VBO->GetDataTypeSize();
-
-  // If not shift & scale
-  if (!this->VBO->GetCoordShiftAndScaleEnabled())
-  {
-    // if no padding and no type conversion then memcpy
-    if (extraComponents == 0 && src->GetDataType() == this->VBO->GetDataType())
+  const unsigned int vboComps = numComps + extraComponents;
+
+  // if no padding and no type conversion then memcpy
+  const bool copy = !shiftScale && extraComponents == 0 &&
+    src->GetDataType() == this->VBO->GetDataType();
+  const size_t tupleSize = this->VBO->GetDataTypeSize() * numComps;
+
+  // the tuples are packed independently, in parallel for large arrays
+  vtkSMPTools::For(0, numTuples, VBOPackingGrain, [&](vtkIdType begin, vtkIdType end) {
+    destType* VBOit = VBOstart + begin * vboComps;
+    const ValueType* input = inputStart + begin * numComps;
+    if (copy)
     {
-      memcpy(VBOit, input, this->VBO->GetDataTypeSize() * numComps * numTuples);
+      memcpy(VBOit, input, tupleSize * (end - begin));
     }
-    else
+    else if (!shiftScale)
     {
-      for (unsigned int i = 0; i < numTuples; ++i)
+      for (vtkIdType i = begin; i < end; ++i)
       {
         for (unsigned int j = 0; j < numComps; j++)
         {
@@ -325,18 +376,18 @@ void vtkAppendVBOWorker<destType>::operator()(vtkAOSDataArrayTemplate<ValueType>
         VBOit += extraComponents;
       }
     }
-  }
-  else
-  {
-    for (unsigned int i = 0; i < numTuples; ++i)
+    else
     {
-      for (unsigned int j = 0; j < numComps; j++)
+      for (vtkIdType i = begin; i < end; ++i)
       {
-        *(VBOit++) = (*(input++) - this->Shift.at(j)) * this->Scale.at(j);
+        for (unsigned int j = 0; j < numComps; j++)
+        {
+          *(VBOit++) = vtkPackValue<destType>((*(input++) - this->Shift[j]) * this->Scale[j]);
+        }
+        VBOit += extraComponents;
       }
-      VBOit += extraComponents;
-    }
-  } // end if shift*scale
+    } // end if shift*scale
+  });
 }
 
 template <typename destType>
@@ -350,34 +401,61 @@ void vtkAppendVBOWorker<destType>::operator()(DataArray* array)
     return; // fixme: should handle error here?
   }
 
-  destType* VBOit = reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
-
-  const auto dataRange = vtk::DataArrayTupleRange(array);
+  destType* VBOstart = reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
+  const bool shiftScale = this->VBO->GetCoordShiftAndScaleEnabled();
 
   // compute extra padding required
   int bytesNeeded = this->VBO->GetDataTypeSize() * this->VBO->GetNumberOfComponents();
   int extraComponents = ((4 - (bytesNeeded % 4)) % 4) / this->VBO->GetDataTypeSize();
+  const vtkIdType vboComps = this->VBO->GetNumberOfComponents() + extraComponents;
 
-  // If not shift & scale
-  if (!this->VBO->GetCoordShiftAndScaleEnabled())
-  {
-    for (const auto tuple : dataRange)
+  auto pack = [&](vtkIdType begin, vtkIdType end) {
+    destType* VBOit = VBOstart + begin * vboComps;
+    const auto dataRange = vtk::DataArrayTupleRange(array, begin, end);
+
+    // If not shift & scale
+    if (!shiftScale)
     {
-      VBOit = std::copy(tuple.cbegin(), tuple.cend(), VBOit);
-      VBOit += extraComponents;
+      for (const auto tuple : dataRange)
+      {
+        VBOit = std::copy(tuple.cbegin(), tuple.cend(), VBOit);
+        VBOit += extraComponents;
+      }
     }
-  }
-  else
-  {
-    for (const auto tuple : dataRange)
+    else
     {
-      for (int j = 0; j < tuple.size(); ++j)
+      for (const auto tuple : dataRange)
       {
-        *(VBOit++) = (tuple[j] - this->Shift[j]) * this->Scale[j];
+        for (int j = 0; j < tuple.size(); ++j)
+        {
+          *(VBOit++) = vtkPackValue<destType>((tuple[j] - this->Shift[j]) * this->Scale[j]);
+        }
+        VBOit += extraComponents;
       }
-      VBOit += extraComponents;
-    }
-  } // end if shift*scale
+    } // end if shift*scale
+  };
+
+  // arrays not handled by the dispatcher may not support concurrent reads
+  if (std::is_same<DataArray, vtkDataArray>::value)
+  {
+    pack(0, array->GetNumberOfTuples());
+  }
+  else
+  {
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), VBOPackingGrain, pack);
+  }
+}
+
+// Pack the tuples of an array at offset, in floats, in the VBO
+template <typename destType>
+void vtkAppendVBO(vtkOpenGLVertexBufferObject* vbo, vtkDataArray* array, unsigned int offset)
+{
+  typedef vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::AllTypes> Dispatcher;
+  vtkAppendVBOWorker<destType> worker(vbo, offset, vbo->GetShift(), vbo->GetScale());
+  if (!Dispatcher::Execute(array, worker))
+  {
+    worker(array);
+  }
 }
 
 } // end anon namespace
@@ -420,6 +498,26 @@ void vtkOpenGLVertexBufferObject::SetProp3D(vtkProp3D* prop)
 // update shift scale for methods that are computed such as auto or camera
 void vtkOpenGLVertexBufferObject::UpdateShiftScale(vtkDataArray* array)
 {
+  // quantized coordinates map the range of each component to the range of
+  // the unsigned shorts, whatever the method
+  if (this->DataType == VTK_UNSIGNED_SHORT)
+  {
+    std::vector<double> shift;
+    std::vector<double> scale;
+    for (int i = 0; i < array->GetNumberOfComponents(); ++i)
+    {
+      double range[2];
+      array->GetRange(range, i);
+      shift.push_back(range[0]);
+      double delta = range[1] - range[0];
+      scale.push_back(delta > 0 ? VTK_UNSIGNED_SHORT_MAX / delta : 1.0);
+    }
+    this->SetShift(shift);
+    this->SetScale(scale);
+    this->CoordShiftAndScaleEnabled = true;
+    return;
+  }
+
   // first consider auto
   bool useSS = false;
   if (this->GetCoordShiftAndScaleMethod() == vtkOpenGLVertexBufferObject::AUTO_SHIFT_SCALE)
@@ -557,6 +655,8 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
   {
     this->NumberOfTuples = array->GetNumberOfTuples();
     this->PackedVBO.resize(0);
+    this->UsePersistentMapping =
+      GlobalPersistentMappingEnabled && this->UploadTime.GetMTime() > 0;
     this->Upload(reinterpret_cast<float*>(array->GetVoidPointer(0)),
       this->NumberOfTuples * this->Stride / sizeof(float), vtkOpenGLBufferObject::ArrayBuffer);
     this->UploadTime.Modified();
@@ -570,35 +670,22 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
     this->PackedVBO.resize(this->NumberOfTuples * this->Stride / sizeof(float));
 
     // Dispatch based on the array data type
-    typedef vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::AllTypes> Dispatcher;
-    bool result = true;
     switch (this->DataType)
     {
       case VTK_FLOAT:
-      {
-        vtkAppendVBOWorker<float> worker(this, 0, this->GetShift(), this->GetScale());
-        // result = Dispatcher::Execute(array, worker);
-        if (!Dispatcher::Execute(array, worker))
-        {
-          worker(array);
-        }
+        vtkAppendVBO<float>(this, array, 0);
         break;
-      }
       case VTK_UNSIGNED_CHAR:
-      {
-        vtkAppendVBOWorker<unsigned char> worker(this, 0, this->GetShift(), this->GetScale());
-        // result = Dispatcher::Execute(array, worker);
-        if (!Dispatcher::Execute(array, worker))
-        {
-          worker(array);
-        }
+        vtkAppendVBO<unsigned char>(this, array, 0);
         break;
-      }
-    }
-
-    if (!result)
-    {
-      vtkErrorMacro(<< "Error filling VBO.");
+      case VTK_SHORT:
+        vtkAppendVBO<short>(this, array, 0);
+        break;
+      case VTK_UNSIGNED_SHORT:
+        vtkAppendVBO<unsigned short>(this, array, 0);
+        break;
+      default:
+        vtkErrorMacro(<< "Error filling VBO, unsupported data type " << this->DataType);
     }
 
     this->Modified();
@@ -641,33 +728,22 @@ void vtkOpenGLVertexBufferObject::AppendDataArray(vtkDataArray* array)
   this->PackedVBO.resize(this->NumberOfTuples * this->Stride / sizeof(float));
 
   // Dispatch based on the array data type
-  typedef vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::AllTypes> Dispatcher;
-  bool result = true;
   switch (this->DataType)
   {
     case VTK_FLOAT:
-    {
-      vtkAppendVBOWorker<float> worker(this, offset, this->GetShift(), this->GetScale());
-      if (!Dispatcher::Execute(array, worker))
-      {
-        worker(array);
-      }
+      vtkAppendVBO<float>(this, array, offset);
       break;
-    }
     case VTK_UNSIGNED_CHAR:
-    {
-      vtkAppendVBOWorker<unsigned char> worker(this, offset, this->GetShift(), this->GetScale());
-      if (!Dispatcher::Execute(array, worker))
-      {
-        worker(array);
-      }
+      vtkAppendVBO<unsigned char>(this, array, offset);
       break;
-    }
-  }
-
-  if (!result)
-  {
-    vtkErrorMacro(<< "Error filling VBO.");
+    case VTK_SHORT:
+      vtkAppendVBO<short>(this, array, offset);
+      break;
+    case VTK_UNSIGNED_SHORT:
+      vtkAppendVBO<unsigned short>(this, array, offset);
+      break;
+    default:
+      vtkErrorMacro(<< "Error filling VBO, unsupported data type " << this->DataType);
   }
 
   this->Modified();
@@ -676,6 +752,8 @@ void vtkOpenGLVertexBufferObject::AppendDataArray(vtkDataArray* array)
 //------------------------------------------------------------------------------
 void vtkOpenGLVertexBufferObject::UploadVBO()
 {
+  // data uploaded again are time varying, stream them if allowed to
+  this->UsePersistentMapping = GlobalPersistentMappingEnabled && this->UploadTime.GetMTime() > 0;
   this->Upload(this->PackedVBO, vtkOpenGLBufferObject::ArrayBuffer);
   this->PackedVBO.resize(0);
   this->UploadTime.Modified();
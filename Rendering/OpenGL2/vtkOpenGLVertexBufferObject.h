@@ -145,8 +145,25 @@ public:
   static void GlobalCoordShiftAndScaleEnabledOff() { SetGlobalCoordShiftAndScaleEnabled(0); };
   static vtkTypeBool GetGlobalCoordShiftAndScaleEnabled();
 
+  // Allow time varying data to be streamed through persistently mapped
+  // buffers
+  //
+  // When on, a VBO uploaded more than once writes its data in a ring of
+  // persistently mapped regions, see vtkOpenGLBufferObject, so that the
+  // upload does not wait for the GPU to be done with the previous data.
+  // The data are then at GetDataOffset() in the buffer, which
+  // vtkOpenGLVertexBufferObjectGroup adds to the offsets of the attributes,
+  // mappers skipping the VBOGroup support must do the same. Off by default.
+  static void SetGlobalPersistentMappingEnabled(vtkTypeBool val);
+  static void GlobalPersistentMappingEnabledOn() { SetGlobalPersistentMappingEnabled(1); };
+  static void GlobalPersistentMappingEnabledOff() { SetGlobalPersistentMappingEnabled(0); };
+  static vtkTypeBool GetGlobalPersistentMappingEnabled();
+
   // Set/Get the DataType to use for the VBO
   // As a side effect sets the DataTypeSize
+  // VTK_FLOAT, VTK_UNSIGNED_CHAR and VTK_SHORT store the values as they are,
+  // VTK_UNSIGNED_SHORT quantizes coordinates, always shifting and scaling
+  // the range of each component to the range of the unsigned shorts.
   void SetDataType(int v);
   vtkGetMacro(DataType, int);
 
@@ -207,6 +224,9 @@ private:
 
   // Initialize static member that controls shifts and scales
   static vtkTypeBool GlobalCoordShiftAndScaleEnabled;
+
+  // Initialize static member that controls persistent mapping
+  static vtkTypeBool GlobalPersistentMappingEnabled;
 };
 
 VTK_ABI_NAMESPACE_END
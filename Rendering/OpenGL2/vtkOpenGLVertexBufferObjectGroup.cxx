@@ -274,9 +274,12 @@ void vtkOpenGLVertexBufferObjectGroup::AddAllAttributesToVAO(
     if (program->IsAttributeUsed(dataShaderName.c_str()))
     {
       vtkOpenGLVertexBufferObject* vbo = i->second;
+      // the offset is not 0 when the data are streamed, see
+      // vtkOpenGLVertexBufferObject::SetGlobalPersistentMappingEnabled
       if (!vao->AddAttributeArray(program, vbo, dataShaderName,
-            0,                                          // offset see assert later in this file
-            (vbo->GetDataType() == VTK_UNSIGNED_CHAR))) // TODO: fix tweak. true for colors.
+            static_cast<int>(vbo->GetDataOffset()),
+            // TODO: fix tweak. true for colors and encoded normals.
+            (vbo->GetDataType() == VTK_UNSIGNED_CHAR || vbo->GetDataType() == VTK_SHORT)))
       {
         vtkErrorMacro(<< "Error setting '" << dataShaderName << "' in shader VAO.");
       }
@@ -363,7 +366,9 @@ void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkOpenGLVertexBufferObjectC
     std::vector<vtkDataArray*>& vec = i->second;
     vtkOpenGLVertexBufferObject* vbo = this->UsedVBOs[attribute];
 
-    if (vec.size() == 1 && vec[0]->GetMTime() > vbo->GetUploadTime())
+    // the VBO is modified when its data type changes
+    if (vec.size() == 1 &&
+      (vec[0]->GetMTime() > vbo->GetUploadTime() || vbo->GetMTime() > vbo->GetUploadTime()))
     {
       vbo->UploadDataArray(vec[0]);
     }
@@ -0,0 +1,412 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkProgressiveRefinementPass.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkProgressiveRefinementPass.h"
+#include "vtkObjectFactory.h"
+#include <cassert>
+
+#include "vtkCamera.h"
+#include "vtkInformation.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkLight.h"
+#include "vtkLightCollection.h"
+#include "vtkMatrix4x4.h"
+#include "vtkOpenGLError.h"
+#include "vtkOpenGLFramebufferObject.h"
+#include "vtkOpenGLQuadHelper.h"
+#include "vtkOpenGLRenderUtilities.h"
+#include "vtkOpenGLRenderWindow.h"
+#include "vtkOpenGLShaderCache.h"
+#include "vtkOpenGLState.h"
+#include "vtkProp.h"
+#include "vtkRenderState.h"
+#include "vtkRenderer.h"
+#include "vtkShaderProgram.h"
+#include "vtkTextureObject.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace
+{
+// radical inverse of the index in the given base, in [0, 1)
+double Halton(int index, int base)
+{
+  double result = 0.0;
+  double f = 1.0 / base;
+  for (int i = index; i > 0; i /= base)
+  {
+    result += f * (i % base);
+    f /= base;
+  }
+  return result;
+}
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkProgressiveRefinementPass);
+vtkInformationKeyMacro(vtkProgressiveRefinementPass, SAMPLE_INDEX, Integer);
+
+//------------------------------------------------------------------------------
+vtkProgressiveRefinementPass::vtkProgressiveRefinementPass()
+{
+  this->TimeBudget = 0.05;
+  this->MaximumNumberOfSamples = 16;
+  this->JitterCamera = true;
+  this->NumberOfSamples = 0;
+
+  this->FrameBufferObject = nullptr;
+  this->ColorTexture = vtkTextureObject::New();
+  this->AccumulationTexture[0] = vtkTextureObject::New();
+  this->AccumulationTexture[1] = vtkTextureObject::New();
+  this->DepthTexture = vtkTextureObject::New();
+  this->ActiveAccumulationTexture = 0;
+  this->AccumulationQuadHelper = nullptr;
+
+  this->ViewportX = 0;
+  this->ViewportY = 0;
+  this->ViewportWidth = 0;
+  this->ViewportHeight = 0;
+  this->SceneSize[0] = 0;
+  this->SceneSize[1] = 0;
+  this->SceneTime = 0;
+  this->SceneCamera.fill(0.0);
+}
+
+//------------------------------------------------------------------------------
+vtkProgressiveRefinementPass::~vtkProgressiveRefinementPass()
+{
+  if (this->FrameBufferObject != nullptr)
+  {
+    vtkErrorMacro(<< "FrameBufferObject should have been deleted in ReleaseGraphicsResources().");
+  }
+  this->ColorTexture->Delete();
+  this->AccumulationTexture[0]->Delete();
+  this->AccumulationTexture[1]->Delete();
+  this->DepthTexture->Delete();
+}
+
+//------------------------------------------------------------------------------
+void vtkProgressiveRefinementPass::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "TimeBudget: " << this->TimeBudget << "\n";
+  os << indent << "MaximumNumberOfSamples: " << this->MaximumNumberOfSamples << "\n";
+  os << indent << "JitterCamera: " << (this->JitterCamera ? "On" : "Off") << "\n";
+  os << indent << "NumberOfSamples: " << this->NumberOfSamples << "\n";
+}
+
+//------------------------------------------------------------------------------
+float vtkProgressiveRefinementPass::GetNoiseOffset(vtkRenderer* ren)
+{
+  vtkInformation* info = ren ? ren->GetInformation() : nullptr;
+  if (!info || !info->Has(vtkProgressiveRefinementPass::SAMPLE_INDEX()))
+  {
+    return 0.f;
+  }
+  // golden ratio sequence, which spreads the offsets of successive samples
+  double offset = 0.6180339887 * info->Get(vtkProgressiveRefinementPass::SAMPLE_INDEX());
+  return static_cast<float>(offset - std::floor(offset));
+}
+
+//------------------------------------------------------------------------------
+bool vtkProgressiveRefinementPass::SceneChanged(const vtkRenderState* s)
+{
+  // the renderer and its camera are modified by each render, so the matrices
+  // of the camera are compared instead
+  vtkRenderer* r = s->GetRenderer();
+  vtkCamera* cam = r->GetActiveCamera();
+  std::array<double, 33> camera;
+  std::copy_n(cam->GetViewTransformMatrix()->GetData(), 16, camera.begin());
+  std::copy_n(
+    cam->GetProjectionTransformMatrix(r->GetTiledAspectRatio(), -1, 1)->GetData(), 16,
+    camera.begin() + 16);
+  camera[32] = s->GetPropArrayCount();
+
+  vtkMTimeType time = 0;
+  vtkLightCollection* lights = r->GetLights();
+  vtkCollectionSimpleIterator lit;
+  lights->InitTraversal(lit);
+  while (vtkLight* light = lights->GetNextLight(lit))
+  {
+    time = std::max(time, light->GetMTime());
+  }
+  for (int i = 0; i < s->GetPropArrayCount(); ++i)
+  {
+    time = std::max(time, s->GetPropArray()[i]->GetRedrawMTime());
+  }
+
+  bool changed = time > this->SceneTime || camera != this->SceneCamera ||
+    this->SceneSize[0] != this->ViewportWidth || this->SceneSize[1] != this->ViewportHeight;
+  this->SceneTime = time;
+  this->SceneCamera = camera;
+  this->SceneSize[0] = this->ViewportWidth;
+  this->SceneSize[1] = this->ViewportHeight;
+  return changed;
+}
+
+//------------------------------------------------------------------------------
+void vtkProgressiveRefinementPass::RenderSample(const vtkRenderState* s)
+{
+  vtkRenderer* r = s->GetRenderer();
+  vtkOpenGLRenderWindow* renWin = static_cast<vtkOpenGLRenderWindow*>(r->GetRenderWindow());
+  vtkOpenGLState* ostate = renWin->GetState();
+
+  // the first sample is not jittered, the next ones are shifted by up to
+  // half a pixel
+  vtkCamera* cam = r->GetActiveCamera();
+  double center[2];
+  cam->GetWindowCenter(center);
+  if (this->JitterCamera && this->NumberOfSamples > 0)
+  {
+    cam->SetWindowCenter(
+      center[0] + (2.0 * Halton(this->NumberOfSamples, 2) - 1.0) / this->ViewportWidth,
+      center[1] + (2.0 * Halton(this->NumberOfSamples, 3) - 1.0) / this->ViewportHeight);
+  }
+  r->GetInformation()->Set(vtkProgressiveRefinementPass::SAMPLE_INDEX(), this->NumberOfSamples);
+
+  ostate->PushFramebufferBindings();
+  this->RenderDelegate(s, this->ViewportWidth, this->ViewportHeight, this->ViewportWidth,
+    this->ViewportHeight, this->FrameBufferObject, this->ColorTexture, this->DepthTexture);
+
+  r->GetInformation()->Remove(vtkProgressiveRefinementPass::SAMPLE_INDEX());
+  if (this->JitterCamera && this->NumberOfSamples > 0)
+  {
+    cam->SetWindowCenter(center[0], center[1]);
+  }
+
+  if (!this->AccumulationQuadHelper)
+  {
+    std::string FSSource = vtkOpenGLRenderUtilities::GetFullScreenQuadFragmentShaderTemplate();
+    vtkShaderProgram::Substitute(FSSource, "//VTK::FSQ::Decl",
+      "uniform sampler2D source;\n"
+      "uniform sampler2D accumulation;\n"
+      "uniform float weight;\n");
+    vtkShaderProgram::Substitute(FSSource, "//VTK::FSQ::Impl",
+      "  gl_FragData[0] = mix(texture(accumulation, texCoord), texture(source, texCoord), "
+      "weight);\n");
+    this->AccumulationQuadHelper = new vtkOpenGLQuadHelper(renWin,
+      vtkOpenGLRenderUtilities::GetFullScreenQuadVertexShader().c_str(), FSSource.c_str(), "");
+  }
+  else
+  {
+    renWin->GetShaderCache()->ReadyShaderProgram(this->AccumulationQuadHelper->Program);
+  }
+  if (!this->AccumulationQuadHelper->Program ||
+    !this->AccumulationQuadHelper->Program->GetCompiled())
+  {
+    vtkErrorMacro("Couldn't build the accumulation shader program.");
+    ostate->PopFramebufferBindings();
+    return;
+  }
+
+  // average the sample with the previous ones into the other accumulation texture
+  int target = 1 - this->ActiveAccumulationTexture;
+  this->FrameBufferObject->AddColorAttachment(0, this->AccumulationTexture[target]);
+  ostate->vtkglViewport(0, 0, this->ViewportWidth, this->ViewportHeight);
+  ostate->vtkglScissor(0, 0, this->ViewportWidth, this->ViewportHeight);
+  {
+    vtkOpenGLState::ScopedglEnableDisable bsaver(ostate, GL_BLEND);
+    vtkOpenGLState::ScopedglEnableDisable dsaver(ostate, GL_DEPTH_TEST);
+    ostate->vtkglDisable(GL_BLEND);
+    ostate->vtkglDisable(GL_DEPTH_TEST);
+
+    this->ColorTexture->Activate();
+    this->AccumulationTexture[this->ActiveAccumulationTexture]->Activate();
+    vtkShaderProgram* program = this->AccumulationQuadHelper->Program;
+    program->SetUniformi("source", this->ColorTexture->GetTextureUnit());
+    program->SetUniformi("accumulation",
+      this->AccumulationTexture[this->ActiveAccumulationTexture]->GetTextureUnit());
+    program->SetUniformf("weight", 1.f / (this->NumberOfSamples + 1));
+    this->AccumulationQuadHelper->Render();
+    this->AccumulationTexture[this->ActiveAccumulationTexture]->Deactivate();
+    this->ColorTexture->Deactivate();
+  }
+  ostate->PopFramebufferBindings();
+
+  this->ActiveAccumulationTexture = target;
+  this->NumberOfSamples++;
+}
+
+//------------------------------------------------------------------------------
+// Description:
+// Perform rendering according to a render state \p s.
+// \pre s_exists: s!=0
+void vtkProgressiveRefinementPass::Render(const vtkRenderState* s)
+{
+  assert("pre: s_exists" && s != nullptr);
+
+  vtkOpenGLClearErrorMacro();
+
+  this->NumberOfRenderedProps = 0;
+
+  vtkRenderer* r = s->GetRenderer();
+  vtkOpenGLRenderWindow* renWin = static_cast<vtkOpenGLRenderWindow*>(r->GetRenderWindow());
+  vtkOpenGLState* ostate = renWin->GetState();
+
+  if (this->DelegatePass == nullptr)
+  {
+    vtkWarningMacro(<< " no delegate.");
+    return;
+  }
+
+  // the samples must not be averaged while selecting
+  if (r->GetSelector())
+  {
+    this->DelegatePass->Render(s);
+    this->NumberOfRenderedProps = this->DelegatePass->GetNumberOfRenderedProps();
+    return;
+  }
+
+  if (s->GetFrameBuffer() == nullptr)
+  {
+    // get the viewport dimensions
+    r->GetTiledSizeAndOrigin(
+      &this->ViewportWidth, &this->ViewportHeight, &this->ViewportX, &this->ViewportY);
+  }
+  else
+  {
+    int size[2];
+    s->GetWindowSize(size);
+    this->ViewportWidth = size[0];
+    this->ViewportHeight = size[1];
+    this->ViewportX = 0;
+    this->ViewportY = 0;
+  }
+
+  this->ColorTexture->SetContext(renWin);
+  if (!this->ColorTexture->GetHandle())
+  {
+    this->ColorTexture->Allocate2D(this->ViewportWidth, this->ViewportHeight, 4, VTK_UNSIGNED_CHAR);
+  }
+  this->ColorTexture->Resize(this->ViewportWidth, this->ViewportHeight);
+
+  // the average is kept in floating point to not lose the sub-bit
+  // contributions of the later samples
+  for (int i = 0; i < 2; i++)
+  {
+    this->AccumulationTexture[i]->SetContext(renWin);
+    if (!this->AccumulationTexture[i]->GetHandle())
+    {
+      this->AccumulationTexture[i]->SetInternalFormat(GL_RGBA32F);
+      this->AccumulationTexture[i]->SetDataType(GL_FLOAT);
+      this->AccumulationTexture[i]->Allocate2D(
+        this->ViewportWidth, this->ViewportHeight, 4, VTK_FLOAT);
+    }
+    this->AccumulationTexture[i]->Resize(this->ViewportWidth, this->ViewportHeight);
+  }
+
+  // same depth format as the volume mappers, which copy the depth buffer
+  this->DepthTexture->SetContext(renWin);
+  if (!this->DepthTexture->GetHandle())
+  {
+    if (renWin->GetStencilCapable())
+    {
+      this->DepthTexture->AllocateDepthStencil(this->ViewportWidth, this->ViewportHeight);
+    }
+    else
+    {
+      this->DepthTexture->AllocateDepth(
+        this->ViewportWidth, this->ViewportHeight, vtkTextureObject::Fixed32);
+    }
+  }
+  this->DepthTexture->Resize(this->ViewportWidth, this->ViewportHeight);
+
+  if (this->FrameBufferObject == nullptr)
+  {
+    this->FrameBufferObject = vtkOpenGLFramebufferObject::New();
+    this->FrameBufferObject->SetContext(renWin);
+  }
+
+  if (this->SceneChanged(s))
+  {
+    this->NumberOfSamples = 0;
+  }
+
+  if (!this->GetConverged())
+  {
+    double start = vtkTimerLog::GetUniversalTime();
+    int numberOfSamples;
+    do
+    {
+      numberOfSamples = this->NumberOfSamples;
+      this->RenderSample(s);
+      this->NumberOfRenderedProps = this->DelegatePass->GetNumberOfRenderedProps();
+      if (this->TimeBudget > 0.0)
+      {
+        // wait for the sample to be rendered to know the time it took
+        glFinish();
+      }
+    } while (this->NumberOfSamples > numberOfSamples && !this->GetConverged() &&
+      vtkTimerLog::GetUniversalTime() - start < this->TimeBudget);
+
+    // the props updated their input when rendered, which the samples include
+    this->SceneChanged(s);
+  }
+
+  // copy the average to the outer FO
+  ostate->PushFramebufferBindings();
+  this->FrameBufferObject->Bind();
+  this->FrameBufferObject->AddColorAttachment(
+    0, this->AccumulationTexture[this->ActiveAccumulationTexture]);
+  ostate->PopFramebufferBindings();
+
+  ostate->PushReadFramebufferBinding();
+  this->FrameBufferObject->Bind(vtkOpenGLFramebufferObject::GetReadMode());
+
+  ostate->vtkglViewport(
+    this->ViewportX, this->ViewportY, this->ViewportWidth, this->ViewportHeight);
+  ostate->vtkglScissor(this->ViewportX, this->ViewportY, this->ViewportWidth, this->ViewportHeight);
+
+  ostate->vtkglBlitFramebuffer(0, 0, this->ViewportWidth, this->ViewportHeight, this->ViewportX,
+    this->ViewportY, this->ViewportX + this->ViewportWidth, this->ViewportY + this->ViewportHeight,
+    GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+  ostate->PopReadFramebufferBinding();
+
+  vtkOpenGLCheckErrorMacro("failed after Render");
+}
+
+//------------------------------------------------------------------------------
+// Description:
+// Release graphics resources and ask components to release their own
+// resources.
+// \pre w_exists: w!=0
+void vtkProgressiveRefinementPass::ReleaseGraphicsResources(vtkWindow* w)
+{
+  assert("pre: w_exists" && w != nullptr);
+
+  this->Superclass::ReleaseGraphicsResources(w);
+
+  if (this->FrameBufferObject != nullptr)
+  {
+    this->FrameBufferObject->Delete();
+    this->FrameBufferObject = nullptr;
+  }
+  this->ColorTexture->ReleaseGraphicsResources(w);
+  this->AccumulationTexture[0]->ReleaseGraphicsResources(w);
+  this->AccumulationTexture[1]->ReleaseGraphicsResources(w);
+  this->DepthTexture->ReleaseGraphicsResources(w);
+  if (this->AccumulationQuadHelper != nullptr)
+  {
+    delete this->AccumulationQuadHelper;
+    this->AccumulationQuadHelper = nullptr;
+  }
+  // the accumulated samples are lost with the textures
+  this->NumberOfSamples = 0;
+}
+VTK_ABI_NAMESPACE_END
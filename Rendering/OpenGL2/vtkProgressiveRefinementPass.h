@@ -0,0 +1,190 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkProgressiveRefinementPass.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkProgressiveRefinementPass
+ * @brief   Refine a still image over several renders within a time budget.
+ *
+ * vtkProgressiveRefinementPass averages the images rendered by its delegate
+ * pass while nothing changes in the scene. Each image is a sample of the
+ * scene: the camera is jittered by a fraction of a pixel, which antialiases
+ * the image, and the noise used by the jittering of
+ * vtkOpenGLGPUVolumeRayCastMapper and by the kernel of vtkSSAOPass is
+ * offset, so that their noise averages out over the samples.
+ *
+ * Every Render() renders samples until the TimeBudget is spent, at least one,
+ * and displays the average of the samples accumulated so far. Once
+ * MaximumNumberOfSamples are accumulated the image is converged, and Render()
+ * displays it again without rendering the delegate. Any change of the camera,
+ * the lights, the props or the size of the viewport restarts the
+ * accumulation, Reset() restarts it after other changes, such as the
+ * background of the renderer.
+ *
+ * The coarse first sample is thus displayed as soon as it is rendered, and
+ * the application refines it between the events of the interactor, for
+ * instance with a repeating timer:
+ *
+ * @code
+ * vtkNew<vtkCallbackCommand> refine;
+ * refine->SetClientData(pass);
+ * refine->SetCallback([](vtkObject* caller, unsigned long, void* clientData, void*) {
+ *   auto pass = static_cast<vtkProgressiveRefinementPass*>(clientData);
+ *   if (!pass->GetConverged())
+ *   {
+ *     static_cast<vtkRenderWindowInteractor*>(caller)->Render();
+ *   }
+ * });
+ * iren->AddObserver(vtkCommand::TimerEvent, refine);
+ * iren->CreateRepeatingTimer(10);
+ * @endcode
+ *
+ * The pass is bypassed while selecting.
+ *
+ * @sa
+ * vtkRenderPass vtkSimpleMotionBlurPass vtkSSAOPass
+ */
+
+#ifndef vtkProgressiveRefinementPass_h
+#define vtkProgressiveRefinementPass_h
+
+#include "vtkDepthImageProcessingPass.h"
+#include "vtkRenderingOpenGL2Module.h" // For export macro
+
+#include <array> // For std::array
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformationIntegerKey;
+class vtkOpenGLFramebufferObject;
+class vtkOpenGLQuadHelper;
+class vtkRenderer;
+class vtkTextureObject;
+
+class VTKRENDERINGOPENGL2_EXPORT vtkProgressiveRefinementPass : public vtkDepthImageProcessingPass
+{
+public:
+  static vtkProgressiveRefinementPass* New();
+  vtkTypeMacro(vtkProgressiveRefinementPass, vtkDepthImageProcessingPass);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Perform rendering according to a render state \p s.
+   * \pre s_exists: s!=0
+   */
+  void Render(const vtkRenderState* s) override;
+
+  /**
+   * Release graphics resources and ask components to release their own
+   * resources.
+   * \pre w_exists: w!=0
+   */
+  void ReleaseGraphicsResources(vtkWindow* w) override;
+
+  ///@{
+  /**
+   * Time in seconds spent rendering samples by each Render(). At least one
+   * sample is rendered, so that 0 renders a single sample per Render().
+   * Default is 0.05.
+   */
+  vtkSetClampMacro(TimeBudget, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(TimeBudget, double);
+  ///@}
+
+  ///@{
+  /**
+   * Number of samples after which the image is converged. Default is 16.
+   */
+  vtkSetClampMacro(MaximumNumberOfSamples, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumNumberOfSamples, int);
+  ///@}
+
+  ///@{
+  /**
+   * Turn on/off the jittering of the camera by a fraction of a pixel between
+   * the samples. Default is on.
+   */
+  vtkSetMacro(JitterCamera, bool);
+  vtkGetMacro(JitterCamera, bool);
+  vtkBooleanMacro(JitterCamera, bool);
+  ///@}
+
+  /**
+   * Number of samples averaged in the image displayed by the last Render().
+   */
+  vtkGetMacro(NumberOfSamples, int);
+
+  /**
+   * Return true when the image displayed by the last Render() is converged.
+   */
+  bool GetConverged() { return this->NumberOfSamples >= this->MaximumNumberOfSamples; }
+
+  /**
+   * Restart the accumulation at the next Render(), for instance when
+   * something the pass does not watch, such as a texture, changed.
+   */
+  void Reset() { this->NumberOfSamples = 0; }
+
+  /**
+   * Key set on the information of the renderer with the index of the sample
+   * being rendered, while the delegate pass renders it.
+   */
+  static vtkInformationIntegerKey* SAMPLE_INDEX();
+
+  /**
+   * Offset, in [0, 1), to add to the noise used by the sample the renderer is
+   * rendering so that the noise of successive samples differs. 0 when the
+   * renderer is not rendering a sample.
+   */
+  static float GetNoiseOffset(vtkRenderer* ren);
+
+protected:
+  vtkProgressiveRefinementPass();
+  ~vtkProgressiveRefinementPass() override;
+
+  /**
+   * Return true if something changed in the scene since the last Render().
+   */
+  bool SceneChanged(const vtkRenderState* s);
+
+  /**
+   * Render one more sample and average it with the previous ones.
+   */
+  void RenderSample(const vtkRenderState* s);
+
+  double TimeBudget;
+  int MaximumNumberOfSamples;
+  bool JitterCamera;
+  int NumberOfSamples;
+
+  vtkOpenGLFramebufferObject* FrameBufferObject;
+  vtkTextureObject* ColorTexture;           // render target for the samples
+  vtkTextureObject* AccumulationTexture[2]; // average of the samples
+  vtkTextureObject* DepthTexture;           // render target for the depth
+  int ActiveAccumulationTexture;
+  vtkOpenGLQuadHelper* AccumulationQuadHelper;
+
+  int ViewportX;
+  int ViewportY;
+  int ViewportWidth;
+  int ViewportHeight;
+  int SceneSize[2];
+  vtkMTimeType SceneTime;
+  std::array<double, 33> SceneCamera;
+
+private:
+  vtkProgressiveRefinementPass(const vtkProgressiveRefinementPass&) = delete;
+  void operator=(const vtkProgressiveRefinementPass&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
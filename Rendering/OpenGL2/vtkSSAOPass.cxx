@@ -28,6 +28,7 @@
 #include "vtkOpenGLShaderCache.h"
 #include "vtkOpenGLState.h"
 #include "vtkOpenGLVertexArrayObject.h"
+#include "vtkProgressiveRefinementPass.h"
 #include "vtkRenderState.h"
 #include "vtkRenderer.h"
 #include "vtkShaderProgram.h"
@@ -249,7 +250,8 @@ void vtkSSAOPass::RenderDelegate(const vtkRenderState* s, int w, int h)
 }
 
 //------------------------------------------------------------------------------
-void vtkSSAOPass::RenderSSAO(vtkOpenGLRenderWindow* renWin, vtkMatrix4x4* projection, int w, int h)
+void vtkSSAOPass::RenderSSAO(
+  vtkOpenGLRenderWindow* renWin, vtkRenderer* ren, vtkMatrix4x4* projection, int w, int h)
 {
   if (this->SSAOQuadHelper && this->SSAOQuadHelper->ShaderChangeValue < this->GetMTime())
   {
@@ -270,6 +272,7 @@ void vtkSSAOPass::RenderSSAO(vtkOpenGLRenderWindow* renWin, vtkMatrix4x4* projec
               "uniform sampler2D texDepth;\n"
               "uniform float kernelRadius;\n"
               "uniform float kernelBias;\n"
+              "uniform float noiseOffset;\n"
               "uniform vec3 samples["
            << this->KernelSize
            << "];\n"
@@ -293,7 +296,8 @@ void vtkSSAOPass::RenderSSAO(vtkOpenGLRenderWindow* renWin, vtkMatrix4x4* projec
          "    {\n"
          "      vec3 normal = texture(texNormal, texCoord).rgb;\n"
          "      vec2 tilingShift = vec2(size) / vec2(textureSize(texNoise, 0));\n"
-         "      float randomAngle = 6.283185 * texture(texNoise, texCoord * tilingShift).r;\n"
+         "      float randomAngle =\n"
+         "        6.283185 * (texture(texNoise, texCoord * tilingShift).r + noiseOffset);\n"
          "      vec3 randomVec = vec3(cos(randomAngle), sin(randomAngle), 0.0);\n"
          "      vec3 tangent = normalize(randomVec - normal * dot(randomVec, normal));\n"
          "      vec3 bitangent = cross(normal, tangent);\n"
@@ -348,6 +352,9 @@ void vtkSSAOPass::RenderSSAO(vtkOpenGLRenderWindow* renWin, vtkMatrix4x4* projec
   this->SSAOQuadHelper->Program->SetUniformi("texDepth", this->DepthTexture->GetTextureUnit());
   this->SSAOQuadHelper->Program->SetUniformf("kernelRadius", this->Radius);
   this->SSAOQuadHelper->Program->SetUniformf("kernelBias", this->Bias);
+  // rotate the kernel differently for each sample of a progressive refinement
+  this->SSAOQuadHelper->Program->SetUniformf(
+    "noiseOffset", vtkProgressiveRefinementPass::GetNoiseOffset(ren));
   this->SSAOQuadHelper->Program->SetUniformMatrix("matProjection", projection);
 
   int size[2] = { w, h };
@@ -509,7 +516,7 @@ void vtkSSAOPass::Render(const vtkRenderState* s)
   vtkMatrix4x4* projection = cam->GetProjectionTransformMatrix(r->GetTiledAspectRatio(), -1, 1);
   projection->Transpose();
 
-  this->RenderSSAO(renWin, projection, w, h);
+  this->RenderSSAO(renWin, r, projection, w, h);
   this->RenderCombine(renWin);
 
   vtkOpenGLCheckErrorMacro("failed after Render");
@@ -121,7 +121,8 @@ protected:
   void InitializeGraphicsResources(vtkOpenGLRenderWindow* renWin, int w, int h);
 
   void RenderDelegate(const vtkRenderState* s, int w, int h);
-  void RenderSSAO(vtkOpenGLRenderWindow* renWin, vtkMatrix4x4* projection, int w, int h);
+  void RenderSSAO(
+    vtkOpenGLRenderWindow* renWin, vtkRenderer* ren, vtkMatrix4x4* projection, int w, int h);
   void RenderCombine(vtkOpenGLRenderWindow* renWin);
 
   vtkTextureObject* ColorTexture = nullptr;
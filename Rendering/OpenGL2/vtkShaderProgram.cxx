@@ -93,6 +93,7 @@ vtkShaderProgram::vtkShaderProgram()
   this->GeometryShaderHandle = 0;
   this->Linked = false;
   this->Bound = false;
+  this->RetrievableBinary = false;
 
   this->FileNamePrefixForDebugging = nullptr;
 }
@@ -366,6 +367,14 @@ bool vtkShaderProgram::Link()
   }
 #endif
 
+#ifdef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+  if (this->RetrievableBinary && glProgramParameteri)
+  {
+    glProgramParameteri(
+      static_cast<GLuint>(this->Handle), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+#endif
+
   GLint isCompiled;
   glLinkProgram(static_cast<GLuint>(this->Handle));
   glGetProgramiv(static_cast<GLuint>(this->Handle), GL_LINK_STATUS, &isCompiled);
@@ -504,6 +513,74 @@ int vtkShaderProgram::CompileShader()
   return 1;
 }
 
+bool vtkShaderProgram::GetBinary(unsigned int& format, std::vector<char>& binary)
+{
+#ifdef GL_PROGRAM_BINARY_LENGTH
+  if (!this->Linked || !glGetProgramBinary)
+  {
+    return false;
+  }
+  GLint length = 0;
+  glGetProgramiv(static_cast<GLuint>(this->Handle), GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+  {
+    return false;
+  }
+  binary.resize(static_cast<size_t>(length));
+  GLenum binaryFormat = 0;
+  glGetProgramBinary(
+    static_cast<GLuint>(this->Handle), length, &length, &binaryFormat, binary.data());
+  binary.resize(static_cast<size_t>(length));
+  format = binaryFormat;
+  return length > 0;
+#else
+  (void)format;
+  (void)binary;
+  return false;
+#endif
+}
+
+bool vtkShaderProgram::LoadBinary(unsigned int format, const std::vector<char>& binary)
+{
+#ifdef GL_PROGRAM_BINARY_LENGTH
+  if (binary.empty() || !glProgramBinary)
+  {
+    return false;
+  }
+  if (this->Handle == 0)
+  {
+    GLuint handle_ = glCreateProgram();
+    if (handle_ == 0)
+    {
+      this->Error = "Could not create shader program.";
+      return false;
+    }
+    this->Handle = static_cast<int>(handle_);
+  }
+
+  // clear out the list of uniforms used
+  this->ClearMaps();
+
+  glProgramBinary(static_cast<GLuint>(this->Handle), static_cast<GLenum>(format), binary.data(),
+    static_cast<GLsizei>(binary.size()));
+  GLint isLinked = 0;
+  glGetProgramiv(static_cast<GLuint>(this->Handle), GL_LINK_STATUS, &isLinked);
+  if (isLinked == 0)
+  {
+    this->Error = "The program binary was rejected by the driver.";
+    this->Linked = false;
+    return false;
+  }
+  this->Linked = true;
+  this->Compiled = true;
+  return true;
+#else
+  (void)format;
+  (void)binary;
+  return false;
+#endif
+}
+
 void vtkShaderProgram::Release()
 {
   glUseProgram(0);
@@ -26,6 +26,7 @@
 
 #include <map>    // For member variables.
 #include <string> // For member variables.
+#include <vector> // For program binaries.
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkMatrix3x3;
@@ -353,6 +354,21 @@ protected:
   /** Releases the shader program from the current context. */
   void Release();
 
+  /**
+   * Get the binary of the linked program, in the driver specific format
+   * returned in format, so that it can be restored with LoadBinary().
+   * @return false if the driver does not provide program binaries.
+   */
+  bool GetBinary(unsigned int& format, std::vector<char>& binary);
+
+  /**
+   * Create the program from a binary returned by GetBinary() instead of
+   * compiling and linking its shaders.
+   * @return false if the driver rejects the binary, for instance after a
+   * driver update. The shaders must then be compiled.
+   */
+  bool LoadBinary(unsigned int format, const std::vector<char>& binary);
+
   /************* end **************************************/
 
   vtkShader* VertexShader;
@@ -374,6 +390,9 @@ protected:
   bool Bound;
   bool Compiled;
 
+  // whether the binary of the program is requested when it is linked
+  bool RetrievableBinary;
+
   // for glsl 1.5 or later, how many outputs
   // does this shader create
   // they will be bound in order to
@@ -19,6 +19,7 @@
 #include "vtkOpenGLRenderWindow.h"
 #include "vtkOpenXRManagerOpenGLGraphics.h"
 #include "vtkOpenXRUtilities.h"
+#include "vtkTimerLog.h"
 #include "vtkWindows.h" // Does nothing if we are not on windows
 
 #define VTK_CHECK_NULL_XRHANDLE(handle, msg)                                                       \
@@ -207,11 +208,32 @@ bool vtkOpenXRManager::WaitAndBeginFrame()
   XrFrameWaitInfo frameWaitInfo{ XR_TYPE_FRAME_WAIT_INFO };
   XrFrameState frameState{ XR_TYPE_FRAME_STATE };
 
+  const double waitStart = vtkTimerLog::GetUniversalTime();
   if (!this->XrCheckError(
         xrWaitFrame(this->Session, &frameWaitInfo, &frameState), "Failed to wait frame."))
   {
     return false;
   }
+  this->BeginFrameTime = vtkTimerLog::GetUniversalTime();
+  this->FrameTimings.WaitTime = this->BeginFrameTime - waitStart;
+
+  // XrTime and XrDuration are in nanoseconds. Each display period between the previous
+  // frame and this one is a frame the runtime had to display again.
+  if (frameState.predictedDisplayPeriod > 0)
+  {
+    this->FrameTimings.DisplayPeriod = frameState.predictedDisplayPeriod * 1e-9;
+    if (this->PreviousDisplayTime > 0)
+    {
+      const XrDuration elapsed = frameState.predictedDisplayTime - this->PreviousDisplayTime;
+      const XrDuration periods = (elapsed + frameState.predictedDisplayPeriod / 2) /
+        frameState.predictedDisplayPeriod;
+      if (periods > 1)
+      {
+        this->FrameTimings.MissedFrames += static_cast<unsigned long>(periods - 1);
+      }
+    }
+  }
+  this->PreviousDisplayTime = frameState.predictedDisplayTime;
 
   // Begin frame
   XrFrameBeginInfo frameBeginInfo{ XR_TYPE_FRAME_BEGIN_INFO };
@@ -228,27 +250,35 @@ bool vtkOpenXRManager::WaitAndBeginFrame()
 
   if (this->ShouldRenderCurrentFrame)
   {
-    // Locate the views : this will update view pose and projection fov for each view
-    XrViewLocateInfo viewLocateInfo{ XR_TYPE_VIEW_LOCATE_INFO };
-    viewLocateInfo.viewConfigurationType = this->ViewType;
-    viewLocateInfo.displayTime = frameState.predictedDisplayTime;
-    viewLocateInfo.space = this->ReferenceSpace;
-    const uint32_t viewCount = this->GetViewCount();
-    uint32_t viewCountOutput;
-    if (!this->XrCheckError(
-          xrLocateViews(this->Session, &viewLocateInfo, &this->RenderResources->ViewState,
-            viewCount, &viewCountOutput, this->RenderResources->Views.data()),
-          "Failed to locate views !"))
-    {
-      return false;
-    }
+    return this->LocateViews();
+  }
 
-    if (viewCountOutput != viewCount)
-    {
-      vtkWarningWithObjectMacro(nullptr, << "ViewCountOutput (" << viewCountOutput
-                                         << ") is different than ViewCount (" << viewCount
-                                         << ") !");
-    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenXRManager::LocateViews()
+{
+  // Locate the views : this will update view pose and projection fov for each view
+  XrViewLocateInfo viewLocateInfo{ XR_TYPE_VIEW_LOCATE_INFO };
+  viewLocateInfo.viewConfigurationType = this->ViewType;
+  viewLocateInfo.displayTime = this->PredictedDisplayTime;
+  viewLocateInfo.space = this->ReferenceSpace;
+  const uint32_t viewCount = this->GetViewCount();
+  uint32_t viewCountOutput;
+  if (!this->XrCheckError(
+        xrLocateViews(this->Session, &viewLocateInfo, &this->RenderResources->ViewState, viewCount,
+          &viewCountOutput, this->RenderResources->Views.data()),
+        "Failed to locate views !"))
+  {
+    return false;
+  }
+
+  if (viewCountOutput != viewCount)
+  {
+    vtkWarningWithObjectMacro(nullptr, << "ViewCountOutput (" << viewCountOutput
+                                       << ") is different than ViewCount (" << viewCount
+                                       << ") !");
   }
 
   return true;
@@ -417,7 +447,10 @@ bool vtkOpenXRManager::EndFrame()
   frameEndInfo.environmentBlendMode = this->EnvironmentBlendMode;
   frameEndInfo.layerCount = (uint32_t)layers.size();
   frameEndInfo.layers = layers.data();
+  const double submitStart = vtkTimerLog::GetUniversalTime();
   xrEndFrame(this->Session, &frameEndInfo);
+  this->FrameTimings.RenderTime = submitStart - this->BeginFrameTime;
+  this->FrameTimings.SubmitTime = vtkTimerLog::GetUniversalTime() - submitStart;
 
   return true;
 }
@@ -177,6 +177,32 @@ public:
   bool GetShouldRenderCurrentFrame() { return this->ShouldRenderCurrentFrame; }
   ///@}
 
+  /**
+   * CPU timings of the last frame, in seconds, and count of the display
+   * periods missed since the session began. The GPU timings of the eyes are
+   * reported through the vtkRenderTimerLog of the render window.
+   */
+  struct FrameTimings_t
+  {
+    // time blocked in xrWaitFrame, waiting for the runtime to start the frame
+    double WaitTime = 0.0;
+    // time between the beginning of the frame and its submission
+    double RenderTime = 0.0;
+    // time spent in xrEndFrame
+    double SubmitTime = 0.0;
+    // display period predicted by the runtime
+    double DisplayPeriod = 0.0;
+    // number of display periods for which no new frame was submitted
+    unsigned long MissedFrames = 0;
+  };
+
+  ///@{
+  /**
+   * Return the timings of the last frame.
+   */
+  const FrameTimings_t& GetFrameTimings() { return this->FrameTimings; }
+  ///@}
+
   ///@{
   /**
    * Start the OpenXR session.
@@ -216,6 +242,16 @@ public:
   bool WaitAndBeginFrame();
   ///@}
 
+  ///@{
+  /**
+   * Locate the views at the predicted display time of the current frame, to update
+   * the view pose and projection fov of each eye / display. It is called by
+   * WaitAndBeginFrame, and can be called again to latch more recent poses before
+   * rendering an eye.
+   */
+  bool LocateViews();
+  ///@}
+
   ///@{
   /**
    * Prepare the rendering resources for the specified eye and store in \p colorTextureId and
@@ -590,6 +626,11 @@ protected:
    */
   XrTime PredictedDisplayTime;
 
+  // Timings of the last frame, and the time stamps used to compute them
+  FrameTimings_t FrameTimings;
+  double BeginFrameTime = 0.0;
+  XrTime PreviousDisplayTime = 0;
+
   bool SessionRunning = false;
   // After each WaitAndBeginFrame, the OpenXR runtime may inform us that
   // the current frame should not be rendered. Store it to avoid a render
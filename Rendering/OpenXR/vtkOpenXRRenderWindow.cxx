@@ -26,6 +26,7 @@ https://github.com/ValveSoftware/openvr/blob/master/LICENSE
 #include "vtkOpenXRRenderWindowInteractor.h"
 #include "vtkOpenXRRenderer.h"
 #include "vtkOpenXRUtilities.h"
+#include "vtkRenderTimerLog.h"
 #include "vtkRendererCollection.h"
 #include "vtkVRCamera.h"
 
@@ -237,6 +238,7 @@ void vtkOpenXRRenderWindow::UpdateHMDMatrixPose()
 void vtkOpenXRRenderWindow::StereoUpdate()
 {
   this->Superclass::StereoUpdate();
+  this->LatchPoses();
 }
 
 //------------------------------------------------------------------------------
@@ -248,6 +250,9 @@ void vtkOpenXRRenderWindow::StereoMidpoint()
   {
     this->RenderOneEye(LEFT_EYE);
   }
+
+  // the left eye has been submitted with its pose, update the one of the right eye
+  this->LatchPoses();
 }
 
 //------------------------------------------------------------------------------
@@ -261,10 +266,35 @@ void vtkOpenXRRenderWindow::StereoRenderComplete()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenXRRenderWindow::LatchPoses()
+{
+  if (!this->LatePoseLatching || !vtkOpenXRManager::GetInstance().LocateViews())
+  {
+    return;
+  }
+
+  // the camera uses the view poses to compute its matrices
+  if (this->TrackHMD)
+  {
+    this->UpdateHMDMatrixPose();
+  }
+  vtkRenderer* ren;
+  vtkCollectionSimpleIterator rit;
+  this->Renderers->InitTraversal(rit);
+  while ((ren = this->Renderers->GetNextRenderer(rit)))
+  {
+    ren->GetActiveCamera()->Modified();
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenXRRenderWindow::RenderOneEye(uint32_t eye)
 {
   vtkOpenXRManager& xrManager = vtkOpenXRManager::GetInstance();
+  VTK_SCOPED_RENDER_EVENT(
+    "vtkOpenXRRenderWindow::RenderOneEye " << (eye == LEFT_EYE ? "Left" : "Right"),
+    this->GetRenderTimer());
 
   FramebufferDesc& eyeFramebufferDesc = this->FramebufferDescs[eye];
 
@@ -44,6 +44,9 @@ PURPOSE.  See the above copyright notice for more information.
  * This matrix determines the user's position and orientation in the rendered
  * scene and scaling (magnification) of rendered actors.
  *
+ * When the render timer log of the window is enabled (see GetRenderTimer), the
+ * GPU time spent on each eye is recorded in its frames. The CPU timings of the
+ * frames are available through vtkOpenXRManager::GetFrameTimings.
  */
 
 #ifndef vtkOpenXRRenderWindow_h
@@ -151,6 +154,20 @@ public:
    */
   void RenderModels() override;
 
+  ///@{
+  /**
+   * When enabled, the view poses are located again just before each eye is
+   * rendered, instead of once when the frame begins. The scene update and the
+   * rendering of the left eye then no longer delay the pose of the right eye,
+   * which reduces the latency perceived on large scenes. Each eye is submitted
+   * with the pose it was rendered with.
+   * Default is false.
+   */
+  vtkSetMacro(LatePoseLatching, bool);
+  vtkGetMacro(LatePoseLatching, bool);
+  vtkBooleanMacro(LatePoseLatching, bool);
+  ///@}
+
 protected:
   vtkOpenXRRenderWindow();
   ~vtkOpenXRRenderWindow() override;
@@ -163,12 +180,17 @@ protected:
 
   virtual void RenderOneEye(uint32_t eye);
 
+  // Locate the views again and update the HMD pose, when LatePoseLatching is enabled
+  void LatchPoses();
+
   vtkNew<vtkMatrix4x4> TempMatrix4x4;
 
   // Store if a model is active or not here as openxr do not have a concept
   // of active/inactive controller
   std::array<bool, 2> ModelsActiveState = { true, true };
 
+  bool LatePoseLatching = false;
+
 private:
   vtkOpenXRRenderWindow(const vtkOpenXRRenderWindow&) = delete;
   void operator=(const vtkOpenXRRenderWindow&) = delete;
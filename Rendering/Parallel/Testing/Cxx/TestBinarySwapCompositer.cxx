@@ -0,0 +1,199 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestBinarySwapCompositer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Composites synthetic images with vtkBinarySwapCompositer and compares the
+// results with the images composited on a single process.
+
+#include "vtkBinarySwapCompositer.h"
+#include "vtkFloatArray.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+const vtkIdType NumberOfPixels = 1001;
+
+bool IsActive(int rank, vtkIdType pixel)
+{
+  return (pixel + rank) % 3 != 0;
+}
+
+float Depth(int rank, vtkIdType pixel)
+{
+  return IsActive(rank, pixel) ? ((pixel * (rank + 3)) % 50) / 100.0f + rank * 0.001f : 1.0f;
+}
+
+unsigned char Color(int rank, vtkIdType pixel, int c)
+{
+  return static_cast<unsigned char>((rank * 31 + pixel * (c + 1)) % 256);
+}
+
+void RGBA(int rank, vtkIdType pixel, float rgba[4])
+{
+  const float alpha = IsActive(rank, pixel) ? 0.25f + 0.125f * ((pixel + rank) % 4) : 0.0f;
+  for (int c = 0; c < 3; ++c)
+  {
+    rgba[c] = alpha * Color(rank, pixel, c) / 255.0f;
+  }
+  rgba[3] = alpha;
+}
+
+bool TestNearest(vtkBinarySwapCompositer* compositer, int rank, int size)
+{
+  vtkNew<vtkUnsignedCharArray> colors;
+  colors->SetNumberOfComponents(4);
+  colors->SetNumberOfTuples(NumberOfPixels);
+  vtkNew<vtkFloatArray> depths;
+  depths->SetNumberOfTuples(NumberOfPixels);
+  for (vtkIdType i = 0; i < NumberOfPixels; ++i)
+  {
+    depths->SetValue(i, Depth(rank, i));
+    for (int c = 0; c < 4; ++c)
+    {
+      colors->SetTypedComponent(i, c, Color(rank, i, c));
+    }
+  }
+  compositer->CompositeBuffer(colors, depths, nullptr, nullptr);
+  if (rank != 0)
+  {
+    return true;
+  }
+
+  for (vtkIdType i = 0; i < NumberOfPixels; ++i)
+  {
+    // the empty pixels keep the color of the root
+    int nearest = 0;
+    for (int r = 1; r < size; ++r)
+    {
+      nearest = Depth(r, i) < Depth(nearest, i) ? r : nearest;
+    }
+    bool same = depths->GetValue(i) == Depth(nearest, i);
+    for (int c = 0; c < 4; ++c)
+    {
+      same &= colors->GetTypedComponent(i, c) == Color(nearest, i, c);
+    }
+    if (!same)
+    {
+      std::cerr << "Wrong nearest pixel " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestOver(vtkBinarySwapCompositer* compositer, int rank, int size)
+{
+  std::vector<int> frontToBack(size);
+  for (int i = 0; i < size; ++i)
+  {
+    frontToBack[i] = (i + 1) % size;
+  }
+  std::vector<float> image(4 * NumberOfPixels);
+  for (vtkIdType i = 0; i < NumberOfPixels; ++i)
+  {
+    RGBA(rank, i, &image[4 * i]);
+  }
+  compositer->CompositeRGBA(image.data(), NumberOfPixels, frontToBack.data(), 0);
+  if (rank != 0)
+  {
+    return true;
+  }
+
+  for (vtkIdType i = 0; i < NumberOfPixels; ++i)
+  {
+    float expected[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int r : frontToBack)
+    {
+      float rgba[4];
+      RGBA(r, i, rgba);
+      const float transparency = 1.0f - expected[3];
+      for (int c = 0; c < 4; ++c)
+      {
+        expected[c] += transparency * rgba[c];
+      }
+    }
+    for (int c = 0; c < 4; ++c)
+    {
+      if (std::abs(image[4 * i + c] - expected[c]) > 1e-5f)
+      {
+        std::cerr << "Wrong blended pixel " << i << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TestSparseDepth(vtkBinarySwapCompositer* compositer, int rank, int size)
+{
+  // only the first pixels are not empty
+  std::vector<float> depths(NumberOfPixels, 1.0f);
+  for (vtkIdType i = 0; i < 20 * (rank + 1); ++i)
+  {
+    depths[i] = Depth(rank, i) < 1.0f ? Depth(rank, i) : 0.5f;
+  }
+  compositer->CompositeDepth(depths.data(), NumberOfPixels, true, 0);
+
+  for (vtkIdType i = 0; i < NumberOfPixels; ++i)
+  {
+    float expected = 1.0f;
+    for (int r = 0; r < size; ++r)
+    {
+      if (i < 20 * (r + 1))
+      {
+        expected = std::min(expected, Depth(r, i) < 1.0f ? Depth(r, i) : 0.5f);
+      }
+    }
+    if (depths[i] != expected)
+    {
+      std::cerr << "Wrong depth " << i << " on rank " << rank << std::endl;
+      return false;
+    }
+  }
+  if (compositer->GetNumberOfBytesSent() >= static_cast<vtkIdType>(NumberOfPixels * sizeof(float)))
+  {
+    std::cerr << "Empty pixels were sent by rank " << rank << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestBinarySwapCompositer(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv, 0);
+  const int rank = controller->GetLocalProcessId();
+  const int size = controller->GetNumberOfProcesses();
+
+  vtkNew<vtkBinarySwapCompositer> compositer;
+  compositer->SetController(controller);
+
+  // every process takes part in every compositing
+  int success = TestNearest(compositer, rank, size);
+  success &= TestOver(compositer, rank, size);
+  success &= TestSparseDepth(compositer, rank, size);
+  int globalSuccess = 0;
+  controller->AllReduce(&success, &globalSuccess, 1, vtkCommunicator::MIN_OP);
+
+  controller->Finalize();
+  return globalSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
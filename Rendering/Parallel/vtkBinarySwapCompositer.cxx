@@ -0,0 +1,419 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBinarySwapCompositer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkBinarySwapCompositer.h"
+
+#include "vtkFloatArray.h"
+#include "vtkMultiProcessController.h"
+#include "vtkObjectFactory.h"
+#include "vtkRenderTimerLog.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBinarySwapCompositer);
+vtkCxxSetObjectMacro(vtkBinarySwapCompositer, RenderTimer, vtkRenderTimerLog);
+
+namespace
+{
+const int BINARY_SWAP_HEADER_TAG = 831;
+const int BINARY_SWAP_RUNS_TAG = 832;
+const int BINARY_SWAP_DEPTH_TAG = 833;
+const int BINARY_SWAP_COLOR_TAG = 834;
+
+enum class Merge
+{
+  Replace,
+  Nearest,
+  OverFront,
+  OverBack
+};
+
+// Composites an image of optional depth and color planes. The pixels are
+// active when their depth is less than 1, or their alpha is not zero when
+// there is no depth.
+template <typename T>
+class Compositing
+{
+public:
+  vtkMultiProcessController* Controller;
+  vtkRenderTimerLog* Timer;
+  float* Depth;
+  T* Color;
+  int NumberOfComponents;
+  vtkIdType NumberOfPixels;
+  bool Over;
+  vtkIdType BytesSent;
+
+  Compositing(vtkMultiProcessController* controller, vtkRenderTimerLog* timer, float* depth,
+    T* color, int numComp, vtkIdType numPixels, bool over)
+    : Controller(controller)
+    , Timer(timer)
+    , Depth(depth)
+    , Color(color)
+    , NumberOfComponents(numComp)
+    , NumberOfPixels(numPixels)
+    , Over(over)
+    , BytesSent(0)
+  {
+  }
+
+  // Composite the images of the processes of order, from the nearest to the
+  // farthest, and gather the result on root.
+  void Run(const std::vector<int>& order, int root)
+  {
+    const int numProcs = static_cast<int>(order.size());
+    const int me = this->Controller->GetLocalProcessId();
+    const int rank = static_cast<int>(std::find(order.begin(), order.end(), me) - order.begin());
+    if (rank == numProcs)
+    {
+      return;
+    }
+    int pow2 = 1;
+    while (2 * pow2 <= numProcs)
+    {
+      pow2 *= 2;
+    }
+    const int extra = numProcs - pow2;
+    auto survivor = [&](int i) { return i < extra ? order[2 * i] : order[i + extra]; };
+
+    // fold the neighbours, the odd ones are behind the even ones
+    int index = -1;
+    if (rank < 2 * extra)
+    {
+      auto event = this->StartEvent("Fold");
+      if (rank % 2)
+      {
+        this->Send(0, this->NumberOfPixels, order[rank - 1]);
+      }
+      else
+      {
+        this->Receive(0, this->NumberOfPixels, order[rank + 1],
+          this->Over ? Merge::OverBack : Merge::Nearest);
+        index = rank / 2;
+      }
+    }
+    else
+    {
+      index = rank - extra;
+    }
+
+    // swap the halves from the lowest bit so that the processes composited
+    // together stay consecutive in the visibility order
+    vtkIdType begin = 0;
+    vtkIdType end = this->NumberOfPixels;
+    for (int bit = 1; index >= 0 && bit < pow2; bit *= 2)
+    {
+      auto event = this->StartEvent("Swap " + std::to_string(bit));
+      const int partner = survivor(index ^ bit);
+      const vtkIdType middle = begin + (end - begin) / 2;
+      if (index & bit)
+      {
+        this->Receive(middle, end, partner, this->Over ? Merge::OverFront : Merge::Nearest);
+        this->Send(begin, middle, partner);
+        begin = middle;
+      }
+      else
+      {
+        this->Send(middle, end, partner);
+        this->Receive(begin, middle, partner, this->Over ? Merge::OverBack : Merge::Nearest);
+        end = middle;
+      }
+    }
+
+    auto event = this->StartEvent("Gather");
+    if (me != root)
+    {
+      if (index >= 0)
+      {
+        this->Send(begin, end, root);
+      }
+      return;
+    }
+    for (int other = 0; other < pow2; ++other)
+    {
+      if (other == index)
+      {
+        continue;
+      }
+      begin = 0;
+      end = this->NumberOfPixels;
+      for (int bit = 1; bit < pow2; bit *= 2)
+      {
+        const vtkIdType middle = begin + (end - begin) / 2;
+        if (other & bit)
+        {
+          begin = middle;
+        }
+        else
+        {
+          end = middle;
+        }
+      }
+      this->Receive(begin, end, survivor(other), Merge::Replace);
+    }
+  }
+
+private:
+  std::vector<int> Runs;
+  std::vector<float> Depths;
+  std::vector<T> Colors;
+
+  vtkRenderTimerLog::ScopedEventLogger StartEvent(const std::string& name)
+  {
+    return this->Timer ? this->Timer->StartScopedEvent("vtkBinarySwapCompositer::" + name)
+                       : vtkRenderTimerLog::ScopedEventLogger();
+  }
+
+  bool IsActive(vtkIdType i) const
+  {
+    return this->Depth ? this->Depth[i] < 1.0f
+                       : this->Color[i * this->NumberOfComponents + 3] != static_cast<T>(0);
+  }
+
+  // Send the pixels from begin to end as runs of inactive and active pixels.
+  void Send(vtkIdType begin, vtkIdType end, int destination)
+  {
+    const int numComp = this->NumberOfComponents;
+    this->Runs.clear();
+    this->Depths.clear();
+    this->Colors.clear();
+    int numActive = 0;
+    vtkIdType i = begin;
+    while (i < end)
+    {
+      vtkIdType first = i;
+      while (i < end && !this->IsActive(i))
+      {
+        ++i;
+      }
+      this->Runs.push_back(static_cast<int>(i - first));
+      first = i;
+      for (; i < end && this->IsActive(i); ++i)
+      {
+        if (this->Depth)
+        {
+          this->Depths.push_back(this->Depth[i]);
+        }
+        if (this->Color)
+        {
+          this->Colors.insert(
+            this->Colors.end(), this->Color + i * numComp, this->Color + (i + 1) * numComp);
+        }
+      }
+      this->Runs.push_back(static_cast<int>(i - first));
+      numActive += static_cast<int>(i - first);
+    }
+
+    int header[2] = { static_cast<int>(this->Runs.size()), numActive };
+    this->Controller->Send(header, 2, destination, BINARY_SWAP_HEADER_TAG);
+    this->BytesSent += sizeof(header);
+    if (!this->Runs.empty())
+    {
+      this->Controller->Send(this->Runs.data(), static_cast<vtkIdType>(this->Runs.size()),
+        destination, BINARY_SWAP_RUNS_TAG);
+      this->BytesSent += this->Runs.size() * sizeof(int);
+    }
+    if (numActive && this->Depth)
+    {
+      this->Controller->Send(this->Depths.data(), numActive, destination, BINARY_SWAP_DEPTH_TAG);
+      this->BytesSent += numActive * sizeof(float);
+    }
+    if (numActive && this->Color)
+    {
+      this->Controller->Send(this->Colors.data(), static_cast<vtkIdType>(this->Colors.size()),
+        destination, BINARY_SWAP_COLOR_TAG);
+      this->BytesSent += this->Colors.size() * sizeof(T);
+    }
+  }
+
+  // Receive the pixels from begin to end and merge them with the local ones.
+  void Receive(vtkIdType begin, vtkIdType end, int source, Merge merge)
+  {
+    const int numComp = this->NumberOfComponents;
+    int header[2];
+    this->Controller->Receive(header, 2, source, BINARY_SWAP_HEADER_TAG);
+    this->Runs.resize(header[0]);
+    if (header[0])
+    {
+      this->Controller->Receive(this->Runs.data(), header[0], source, BINARY_SWAP_RUNS_TAG);
+    }
+    const int numActive = header[1];
+    if (numActive && this->Depth)
+    {
+      this->Depths.resize(numActive);
+      this->Controller->Receive(this->Depths.data(), numActive, source, BINARY_SWAP_DEPTH_TAG);
+    }
+    if (numActive && this->Color)
+    {
+      this->Colors.resize(static_cast<size_t>(numActive) * numComp);
+      this->Controller->Receive(this->Colors.data(), static_cast<vtkIdType>(this->Colors.size()),
+        source, BINARY_SWAP_COLOR_TAG);
+    }
+
+    vtkIdType i = begin;
+    vtkIdType active = 0;
+    for (size_t r = 0; r + 1 < this->Runs.size() && i < end; r += 2)
+    {
+      const vtkIdType inactiveEnd = i + this->Runs[r];
+      for (; merge == Merge::Replace && i < inactiveEnd; ++i)
+      {
+        // the nearest color of an empty pixel stays the background of root
+        if (this->Depth)
+        {
+          this->Depth[i] = 1.0f;
+        }
+        if (this->Over)
+        {
+          std::fill_n(this->Color + i * numComp, numComp, static_cast<T>(0));
+        }
+      }
+      i = inactiveEnd;
+      for (int k = 0; k < this->Runs[r + 1]; ++k, ++i, ++active)
+      {
+        this->MergePixel(i, active, merge);
+      }
+    }
+  }
+
+  void MergePixel(vtkIdType i, vtkIdType active, Merge merge)
+  {
+    const int numComp = this->NumberOfComponents;
+    T* local = this->Color ? this->Color + i * numComp : nullptr;
+    const T* remote = this->Color ? this->Colors.data() + active * numComp : nullptr;
+    switch (merge)
+    {
+      case Merge::Nearest:
+        if (this->Depths[active] >= this->Depth[i])
+        {
+          break;
+        }
+        VTK_FALLTHROUGH;
+      case Merge::Replace:
+        if (this->Depth)
+        {
+          this->Depth[i] = this->Depths[active];
+        }
+        if (local)
+        {
+          std::copy(remote, remote + numComp, local);
+        }
+        break;
+      case Merge::OverFront:
+      {
+        const T transparency = static_cast<T>(1) - remote[3];
+        for (int c = 0; c < numComp; ++c)
+        {
+          local[c] = remote[c] + transparency * local[c];
+        }
+        break;
+      }
+      case Merge::OverBack:
+      {
+        const T transparency = static_cast<T>(1) - local[3];
+        for (int c = 0; c < numComp; ++c)
+        {
+          local[c] += transparency * remote[c];
+        }
+        break;
+      }
+    }
+  }
+};
+}
+
+//------------------------------------------------------------------------------
+vtkBinarySwapCompositer::vtkBinarySwapCompositer()
+{
+  this->RenderTimer = nullptr;
+  this->NumberOfBytesSent = 0;
+}
+
+//------------------------------------------------------------------------------
+vtkBinarySwapCompositer::~vtkBinarySwapCompositer()
+{
+  this->SetRenderTimer(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::CompositeBuffer(
+  vtkDataArray* pBuf, vtkFloatArray* zBuf, vtkDataArray* pTmp, vtkFloatArray* zTmp)
+{
+  (void)pTmp;
+  (void)zTmp;
+  std::vector<int> order(this->NumberOfProcesses);
+  std::iota(order.begin(), order.end(), 0);
+  const vtkIdType numPixels = zBuf->GetNumberOfTuples();
+  const int numComp = pBuf->GetNumberOfComponents();
+  if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+  {
+    Compositing<unsigned char> compositing(this->Controller, this->RenderTimer,
+      zBuf->GetPointer(0), static_cast<unsigned char*>(pBuf->GetVoidPointer(0)), numComp,
+      numPixels, false);
+    compositing.Run(order, 0);
+    this->NumberOfBytesSent = compositing.BytesSent;
+  }
+  else
+  {
+    Compositing<float> compositing(this->Controller, this->RenderTimer, zBuf->GetPointer(0),
+      static_cast<float*>(pBuf->GetVoidPointer(0)), numComp, numPixels, false);
+    compositing.Run(order, 0);
+    this->NumberOfBytesSent = compositing.BytesSent;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::CompositeRGBA(
+  float* rgba, vtkIdType numberOfPixels, const int* frontToBack, int root)
+{
+  std::vector<int> order(frontToBack, frontToBack + this->NumberOfProcesses);
+  Compositing<float> compositing(
+    this->Controller, this->RenderTimer, nullptr, rgba, 4, numberOfPixels, true);
+  compositing.Run(order, root);
+  this->NumberOfBytesSent = compositing.BytesSent;
+}
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::CompositeDepth(
+  float* depth, vtkIdType numberOfPixels, bool allProcesses, int root)
+{
+  std::vector<int> order(this->NumberOfProcesses);
+  std::iota(order.begin(), order.end(), 0);
+  Compositing<float> compositing(
+    this->Controller, this->RenderTimer, depth, nullptr, 0, numberOfPixels, false);
+  compositing.Run(order, root);
+  this->NumberOfBytesSent = compositing.BytesSent;
+  if (allProcesses)
+  {
+    vtkRenderTimerLog::ScopedEventLogger event;
+    if (this->RenderTimer)
+    {
+      event = this->RenderTimer->StartScopedEvent("vtkBinarySwapCompositer::Broadcast");
+    }
+    this->Controller->Broadcast(depth, numberOfPixels, root);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "RenderTimer: " << this->RenderTimer << endl;
+  os << indent << "NumberOfBytesSent: " << this->NumberOfBytesSent << endl;
+}
+VTK_ABI_NAMESPACE_END
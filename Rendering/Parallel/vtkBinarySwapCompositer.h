@@ -0,0 +1,108 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBinarySwapCompositer.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkBinarySwapCompositer
+ * @brief   Implements binary-swap compositing of compressed images.
+ *
+ * vtkBinarySwapCompositer composites the images of the processes in
+ * log2(N) stages. At each stage the processes are paired, each one keeps
+ * half of its current region of the image and exchanges the other half with
+ * its partner, so that each process composites 1/N of the image in the end.
+ * The regions are then gathered on the root process. When the number of
+ * processes is not a power of 2, the extra processes first send their whole
+ * image to a neighbour.
+ *
+ * Only the active pixels are sent, the ones with a depth less than 1, or a
+ * non-zero alpha when there is no depth, as runs of inactive and active
+ * pixels. The number of bytes a process sends is usually a fraction of the
+ * size of the image for sparse images.
+ *
+ * CompositeBuffer() keeps the nearest pixels of color and depth buffers,
+ * like vtkTreeCompositer. CompositeRGBA() blends premultiplied RGBA images
+ * in a visibility order, and CompositeDepth() keeps the nearest depths, for
+ * vtkCompositeRGBAPass and vtkCompositeZPass.
+ *
+ * @sa
+ * vtkTreeCompositer vtkCompressCompositer
+ */
+
+#ifndef vtkBinarySwapCompositer_h
+#define vtkBinarySwapCompositer_h
+
+#include "vtkCompositer.h"
+#include "vtkRenderingParallelModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkRenderTimerLog;
+
+class VTKRENDERINGPARALLEL_EXPORT vtkBinarySwapCompositer : public vtkCompositer
+{
+public:
+  static vtkBinarySwapCompositer* New();
+  vtkTypeMacro(vtkBinarySwapCompositer, vtkCompositer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Keep the nearest pixels of the unsigned char or float color buffers of
+   * all the processes. The result is put into pBuf and zBuf on process 0.
+   * The temporary buffers are not used.
+   */
+  void CompositeBuffer(
+    vtkDataArray* pBuf, vtkFloatArray* zBuf, vtkDataArray* pTmp, vtkFloatArray* zTmp) override;
+
+  /**
+   * Blend the premultiplied RGBA images of numberOfPixels pixels of the
+   * processes in the order of frontToBack, the ids of NumberOfProcesses
+   * processes from the nearest to the farthest. The result is put into rgba
+   * on the root process.
+   */
+  void CompositeRGBA(float* rgba, vtkIdType numberOfPixels, const int* frontToBack, int root = 0);
+
+  /**
+   * Keep the nearest depths of all the processes. The result is put into
+   * depth on the root process, or on all the processes when allProcesses is
+   * true.
+   */
+  void CompositeDepth(float* depth, vtkIdType numberOfPixels, bool allProcesses, int root = 0);
+
+  ///@{
+  /**
+   * When set, the stages of the compositing are logged as events of this
+   * timer. The OpenGL context of the timer must be current while
+   * compositing. Initial value is a NULL pointer.
+   */
+  virtual void SetRenderTimer(vtkRenderTimerLog*);
+  vtkGetObjectMacro(RenderTimer, vtkRenderTimerLog);
+  ///@}
+
+  /**
+   * Number of bytes sent by this process during the last compositing.
+   */
+  vtkGetMacro(NumberOfBytesSent, vtkIdType);
+
+protected:
+  vtkBinarySwapCompositer();
+  ~vtkBinarySwapCompositer() override;
+
+  vtkRenderTimerLog* RenderTimer;
+  vtkIdType NumberOfBytesSent;
+
+private:
+  vtkBinarySwapCompositer(const vtkBinarySwapCompositer&) = delete;
+  void operator=(const vtkBinarySwapCompositer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
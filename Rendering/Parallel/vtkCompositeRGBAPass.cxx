@@ -14,6 +14,7 @@
 =========================================================================*/
 
 #include "vtkCompositeRGBAPass.h"
+#include "vtkBinarySwapCompositer.h"
 #include "vtkFrameBufferObjectBase.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderWindow.h"
@@ -34,10 +35,12 @@
 #include "vtkImageShiftScale.h"
 #include "vtkIntArray.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkPKdTree.h"
 #include "vtkPNGWriter.h"
 #include "vtkPixelBufferObject.h"
 #include "vtkPointData.h"
+#include "vtkRenderTimerLog.h"
 #include "vtkTimerLog.h"
 #include <sstream>
 
@@ -59,6 +62,8 @@ vtkCompositeRGBAPass::vtkCompositeRGBAPass()
 {
   this->Controller = nullptr;
   this->Kdtree = nullptr;
+  this->UseBinarySwap = false;
+  this->Compositer = nullptr;
   this->PBO = nullptr;
   this->RGBATexture = nullptr;
   this->RootTexture = nullptr;
@@ -77,6 +82,10 @@ vtkCompositeRGBAPass::~vtkCompositeRGBAPass()
   {
     this->Kdtree->Delete();
   }
+  if (this->Compositer != nullptr)
+  {
+    this->Compositer->Delete();
+  }
   if (this->PBO != nullptr)
   {
     vtkErrorMacro(<< "PixelBufferObject should have been deleted in ReleaseGraphicsResources().");
@@ -115,6 +124,20 @@ void vtkCompositeRGBAPass::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << "(none)" << endl;
   }
+  os << indent << "UseBinarySwap: " << this->UseBinarySwap << endl;
+}
+
+//------------------------------------------------------------------------------
+void vtkCompositeRGBAPass::GetFrontToBackOrder(vtkCamera* c, vtkIntArray* frontToBackList)
+{
+  if (c->GetParallelProjection())
+  {
+    this->Kdtree->ViewOrderAllProcessesInDirection(c->GetDirectionOfProjection(), frontToBackList);
+  }
+  else
+  {
+    this->Kdtree->ViewOrderAllProcessesFromPosition(c->GetPosition(), frontToBackList);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -234,7 +257,7 @@ void vtkCompositeRGBAPass::Render(const vtkRenderState* s)
   timer->StartTimer();
 #endif
 
-  if (me == 0)
+  if (me == 0 && !this->UseBinarySwap)
   {
     // root
     // 1. figure out the back to front ordering
@@ -294,17 +317,8 @@ void vtkCompositeRGBAPass::Render(const vtkRenderState* s)
 #endif // #ifdef VTK_COMPOSITE_RGBAPASS_DEBUG
 
     // 1. figure out the back to front ordering
-    vtkCamera* c = r->GetActiveCamera();
     vtkIntArray* frontToBackList = vtkIntArray::New();
-    if (c->GetParallelProjection())
-    {
-      this->Kdtree->ViewOrderAllProcessesInDirection(
-        c->GetDirectionOfProjection(), frontToBackList);
-    }
-    else
-    {
-      this->Kdtree->ViewOrderAllProcessesFromPosition(c->GetPosition(), frontToBackList);
-    }
+    this->GetFrontToBackOrder(r->GetActiveCamera(), frontToBackList);
 
     assert("check same_size" && frontToBackList->GetNumberOfTuples() == numProcs);
 
@@ -447,10 +461,12 @@ void vtkCompositeRGBAPass::Render(const vtkRenderState* s)
   }
   else
   {
-    // satellite
+    // satellite, or any process with binary swap
     // send rgba-buffer
 
     // framebuffer to PBO.
+    VTK_SCOPED_RENDER_EVENT2(
+      "vtkCompositeRGBAPass::Readback", context->GetRenderTimer(), readbackEvent);
     this->PBO->Allocate(VTK_FLOAT, numTups, numComps, vtkPixelBufferObject::PACKED_BUFFER);
 
     this->PBO->Bind(vtkPixelBufferObject::PACKED_BUFFER);
@@ -460,6 +476,7 @@ void vtkCompositeRGBAPass::Render(const vtkRenderState* s)
     ostate->vtkglPixelStorei(GL_PACK_ALIGNMENT, 1); // server to client
     this->PBO->Download2D(VTK_FLOAT, this->RawRGBABuffer, dims, 4, continuousInc);
     this->PBO->UnBind();
+    readbackEvent.Stop();
 
 #ifdef VTK_COMPOSITE_RGBAPASS_DEBUG
     importer = vtkImageImport::New();
@@ -500,9 +517,43 @@ void vtkCompositeRGBAPass::Render(const vtkRenderState* s)
     writer->Delete();
 #endif
 
-    // client to root process
-    this->Controller->Send(this->RawRGBABuffer, static_cast<vtkIdType>(this->RawRGBABufferSize), 0,
-      VTK_COMPOSITE_RGBA_PASS_MESSAGE_GATHER);
+    if (!this->UseBinarySwap)
+    {
+      // client to root process
+      this->Controller->Send(this->RawRGBABuffer,
+        static_cast<vtkIdType>(this->RawRGBABufferSize), 0, VTK_COMPOSITE_RGBA_PASS_MESSAGE_GATHER);
+    }
+    else
+    {
+      // every process composites a part of the image in back to front order
+      vtkNew<vtkIntArray> frontToBackList;
+      this->GetFrontToBackOrder(r->GetActiveCamera(), frontToBackList);
+      assert("check same_size" && frontToBackList->GetNumberOfTuples() == numProcs);
+      if (this->Compositer == nullptr)
+      {
+        this->Compositer = vtkBinarySwapCompositer::New();
+      }
+      this->Compositer->SetController(this->Controller);
+      this->Compositer->SetRenderTimer(context->GetRenderTimer());
+      this->Compositer->CompositeRGBA(
+        this->RawRGBABuffer, numTups, frontToBackList->GetPointer(0), 0);
+
+      if (me == 0)
+      {
+        // the root process replaces its framebuffer by the final image
+        VTK_SCOPED_RENDER_EVENT("vtkCompositeRGBAPass::Upload", context->GetRenderTimer());
+        vtkOpenGLState::ScopedglBlendFuncSeparate bfsaver(ostate);
+        ostate->vtkglColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        ostate->vtkglDisable(GL_DEPTH_TEST);
+        ostate->vtkglDisable(GL_BLEND);
+        ostate->vtkglPixelStorei(GL_UNPACK_ALIGNMENT, 1); // client to server
+        this->PBO->Upload2D(VTK_FLOAT, this->RawRGBABuffer, dims, 4, continuousInc);
+        this->RGBATexture->Create2D(dims[0], dims[1], 4, this->PBO, false);
+        this->RGBATexture->Activate();
+        this->RGBATexture->CopyToFrameBuffer(0, 0, w - 1, h - 1, 0, 0, w, h, nullptr, nullptr);
+        this->RGBATexture->Deactivate();
+      }
+    }
   }
 #ifdef VTK_COMPOSITE_RGBAPASS_DEBUG
   delete state;
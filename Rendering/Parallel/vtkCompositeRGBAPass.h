@@ -35,6 +35,9 @@
 #include "vtkRenderingParallelModule.h" // For export macro
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkBinarySwapCompositer;
+class vtkCamera;
+class vtkIntArray;
 class vtkMultiProcessController;
 
 class vtkPixelBufferObject;
@@ -80,6 +83,19 @@ public:
   virtual void SetKdtree(vtkPKdTree* kdtree);
   ///@}
 
+  ///@{
+  /**
+   * Composite the RGBA buffers with a vtkBinarySwapCompositer, which splits
+   * the blending among all the processes and sends only the pixels that are
+   * not transparent, instead of blending all the buffers on the root process.
+   * The stages are logged in the vtkRenderTimerLog of the render window.
+   * Initial value is false.
+   */
+  vtkSetMacro(UseBinarySwap, bool);
+  vtkGetMacro(UseBinarySwap, bool);
+  vtkBooleanMacro(UseBinarySwap, bool);
+  ///@}
+
   /**
    * Is the pass supported by the OpenGL context?
    */
@@ -96,8 +112,16 @@ protected:
    */
   ~vtkCompositeRGBAPass() override;
 
+  /**
+   * Ids of the processes from the nearest to the farthest of the camera,
+   * given by the kd tree.
+   */
+  void GetFrontToBackOrder(vtkCamera* c, vtkIntArray* frontToBackList);
+
   vtkMultiProcessController* Controller;
   vtkPKdTree* Kdtree;
+  bool UseBinarySwap;
+  vtkBinarySwapCompositer* Compositer;
 
   vtkPixelBufferObject* PBO;
   vtkTextureObject* RGBATexture;
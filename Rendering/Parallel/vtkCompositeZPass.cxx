@@ -14,6 +14,7 @@
 =========================================================================*/
 
 #include "vtkCompositeZPass.h"
+#include "vtkBinarySwapCompositer.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderWindow.h"
 #include "vtkOpenGLRenderer.h"
@@ -35,6 +36,7 @@
 #include "vtkPNGWriter.h"
 #include "vtkPixelBufferObject.h"
 #include "vtkPointData.h"
+#include "vtkRenderTimerLog.h"
 #include "vtkTimerLog.h"
 #include <sstream>
 
@@ -59,6 +61,8 @@ vtkCxxSetObjectMacro(vtkCompositeZPass, Controller, vtkMultiProcessController);
 vtkCompositeZPass::vtkCompositeZPass()
 {
   this->Controller = nullptr;
+  this->UseBinarySwap = false;
+  this->Compositer = nullptr;
   this->PBO = nullptr;
   this->ZTexture = nullptr;
   this->Program = nullptr;
@@ -73,6 +77,10 @@ vtkCompositeZPass::~vtkCompositeZPass()
   {
     this->Controller->Delete();
   }
+  if (this->Compositer != nullptr)
+  {
+    this->Compositer->Delete();
+  }
   if (this->PBO != nullptr)
   {
     vtkErrorMacro(<< "PixelBufferObject should have been deleted in ReleaseGraphicsResources().");
@@ -103,6 +111,7 @@ void vtkCompositeZPass::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << "(none)" << endl;
   }
+  os << indent << "UseBinarySwap: " << this->UseBinarySwap << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -172,6 +181,7 @@ void vtkCompositeZPass::Render(const vtkRenderState* s)
   if (this->RawZBufferSize < static_cast<size_t>(w * h))
   {
     delete[] this->RawZBuffer;
+    this->RawZBuffer = nullptr;
   }
   if (this->RawZBuffer == nullptr)
   {
@@ -205,7 +215,7 @@ void vtkCompositeZPass::Render(const vtkRenderState* s)
   timer->StartTimer();
 #endif
 
-  if (me == 0)
+  if (me == 0 && !this->UseBinarySwap)
   {
     // root
     // 1. for each satellite
@@ -504,11 +514,13 @@ void vtkCompositeZPass::Render(const vtkRenderState* s)
   }
   else
   {
-    // satellite
+    // satellite, or any process with binary swap
     // 1. send z-buffer
     // 2. receive final z-buffer and copy it
 
     // framebuffer to PBO.
+    VTK_SCOPED_RENDER_EVENT2(
+      "vtkCompositeZPass::Readback", context->GetRenderTimer(), readbackEvent);
     this->PBO->Allocate(VTK_FLOAT, numTups, 1, vtkPixelBufferObject::PACKED_BUFFER);
 
     this->PBO->Bind(vtkPixelBufferObject::PACKED_BUFFER);
@@ -516,6 +528,7 @@ void vtkCompositeZPass::Render(const vtkRenderState* s)
 
     // PBO to client
     this->PBO->Download2D(VTK_FLOAT, this->RawZBuffer, dims, 1, continuousInc);
+    readbackEvent.Stop();
 
 #ifdef VTK_COMPOSITE_ZPASS_DEBUG
     importer = vtkImageImport::New();
@@ -559,13 +572,27 @@ void vtkCompositeZPass::Render(const vtkRenderState* s)
     writer->Delete();
 #endif
 
-    // client to root process
-    this->Controller->Send(this->RawZBuffer, static_cast<vtkIdType>(this->RawZBufferSize), 0,
-      VTK_COMPOSITE_Z_PASS_MESSAGE_GATHER);
+    if (!this->UseBinarySwap)
+    {
+      // client to root process
+      this->Controller->Send(this->RawZBuffer, static_cast<vtkIdType>(this->RawZBufferSize), 0,
+        VTK_COMPOSITE_Z_PASS_MESSAGE_GATHER);
 
-    // receiving final z-buffer.
-    this->Controller->Receive(this->RawZBuffer, static_cast<vtkIdType>(this->RawZBufferSize), 0,
-      VTK_COMPOSITE_Z_PASS_MESSAGE_SCATTER);
+      // receiving final z-buffer.
+      this->Controller->Receive(this->RawZBuffer, static_cast<vtkIdType>(this->RawZBufferSize),
+        0, VTK_COMPOSITE_Z_PASS_MESSAGE_SCATTER);
+    }
+    else
+    {
+      // every process merges a part of the z-buffer, then gets all of it
+      if (this->Compositer == nullptr)
+      {
+        this->Compositer = vtkBinarySwapCompositer::New();
+      }
+      this->Compositer->SetController(this->Controller);
+      this->Compositer->SetRenderTimer(context->GetRenderTimer());
+      this->Compositer->CompositeDepth(this->RawZBuffer, numTups, true, 0);
+    }
 
 #ifdef VTK_COMPOSITE_ZPASS_DEBUG
     importer = vtkImageImport::New();
@@ -603,6 +630,7 @@ void vtkCompositeZPass::Render(const vtkRenderState* s)
 #endif
 
     // client to PBO
+    VTK_SCOPED_RENDER_EVENT("vtkCompositeZPass::Upload", context->GetRenderTimer());
     this->PBO->Upload2D(VTK_FLOAT, this->RawZBuffer, dims, 1, continuousInc);
 
     // PBO to TO
@@ -35,6 +35,7 @@
 #include "vtkRenderingParallelModule.h" // For export macro
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkBinarySwapCompositer;
 class vtkMultiProcessController;
 
 class vtkPixelBufferObject;
@@ -72,6 +73,19 @@ public:
   virtual void SetController(vtkMultiProcessController* controller);
   ///@}
 
+  ///@{
+  /**
+   * Merge the depth buffers with a vtkBinarySwapCompositer, which splits the
+   * merge among all the processes and sends only the depths less than 1,
+   * instead of merging all the buffers on the root process. The stages are
+   * logged in the vtkRenderTimerLog of the render window. Initial value is
+   * false.
+   */
+  vtkSetMacro(UseBinarySwap, bool);
+  vtkGetMacro(UseBinarySwap, bool);
+  vtkBooleanMacro(UseBinarySwap, bool);
+  ///@}
+
   /**
    * Is the pass supported by the OpenGL context?
    */
@@ -97,6 +111,8 @@ protected:
   void CreateProgram(vtkOpenGLRenderWindow* context);
 
   vtkMultiProcessController* Controller;
+  bool UseBinarySwap;
+  vtkBinarySwapCompositer* Compositer;
 
   vtkPixelBufferObject* PBO;
   vtkTextureObject* ZTexture;
@@ -35,8 +35,11 @@
 #include "vtkPNGWriter.h"
 #include "vtkParallelRenderManager.h"
 #include "vtkRenderWindow.h"
+#include "vtkTimerLog.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -164,6 +167,7 @@ void vtkSynchronizedRenderers::HandleStartRender()
     return;
   }
 
+  this->RenderStartTime = vtkTimerLog::GetUniversalTime();
   this->Image.MarkInValid();
 
   // disable FXAA when parallel rendering. We'll do the FXAA pass after the
@@ -211,6 +215,11 @@ void vtkSynchronizedRenderers::HandleStartRender()
 //------------------------------------------------------------------------------
 void vtkSynchronizedRenderers::MasterStartRender()
 {
+  if (this->AutomaticImageReductionFactor)
+  {
+    this->UpdateImageReductionFactor();
+  }
+
   RendererInfo renInfo;
   renInfo.ImageReductionFactor = this->GetImageReductionFactor();
   renInfo.CopyFrom(this->Renderer);
@@ -283,6 +292,30 @@ void vtkSynchronizedRenderers::HandleEndRender()
   // restore FXAA state.
   this->Renderer->SetUseFXAA(this->UseFXAA);
   this->UseFXAA = false;
+
+  this->LastRenderTime = vtkTimerLog::GetUniversalTime() - this->RenderStartTime;
+}
+
+//------------------------------------------------------------------------------
+void vtkSynchronizedRenderers::UpdateImageReductionFactor()
+{
+  vtkRenderWindow* window = this->Renderer->GetRenderWindow();
+  const double desiredUpdateRate = window ? window->GetDesiredUpdateRate() : 0.0;
+  if (desiredUpdateRate <= 0.0 || this->LastRenderTime <= 0.0)
+  {
+    this->SetImageReductionFactor(1);
+    return;
+  }
+
+  // The time to render is assumed to scale with the number of pixels, that is
+  // with the inverse of the square of the reduction factor. For still
+  // renders, the allotted time is large enough for the factor to drop to 1.
+  const double factor =
+    this->ImageReductionFactor * std::sqrt(this->LastRenderTime * desiredUpdateRate);
+  this->SetImageReductionFactor(std::max(
+    1, std::min(this->MaxImageReductionFactor, static_cast<int>(std::ceil(factor - 0.25)))));
+  vtkDebugMacro("Last render time: " << this->LastRenderTime
+                                     << ", image reduction factor: " << this->ImageReductionFactor);
 }
 
 //------------------------------------------------------------------------------
@@ -414,6 +447,10 @@ void vtkSynchronizedRenderers::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "ImageReductionFactor: " << this->ImageReductionFactor << endl;
+  os << indent << "AutomaticImageReductionFactor: " << this->AutomaticImageReductionFactor
+     << endl;
+  os << indent << "MaxImageReductionFactor: " << this->MaxImageReductionFactor << endl;
+  os << indent << "LastRenderTime: " << this->LastRenderTime << endl;
   os << indent << "WriteBackImages: " << this->WriteBackImages << endl;
   os << indent << "FixBackground: " << this->FixBackground << endl;
   os << indent << "RootProcessId: " << this->RootProcessId << endl;
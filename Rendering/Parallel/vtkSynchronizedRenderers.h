@@ -88,6 +88,35 @@ public:
   vtkGetMacro(ImageReductionFactor, int);
   ///@}
 
+  ///@{
+  /**
+   * If on, the root process adjusts the image reduction factor before each
+   * render so that rendering, including compositing and image delivery,
+   * meets the desired update rate of the render window, based on the time
+   * the previous render took. Still renders, requested by interactors with a
+   * very low desired update rate when interaction stops, are done at full
+   * resolution. Default is off.
+   */
+  vtkSetMacro(AutomaticImageReductionFactor, bool);
+  vtkGetMacro(AutomaticImageReductionFactor, bool);
+  vtkBooleanMacro(AutomaticImageReductionFactor, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the largest image reduction factor used when
+   * AutomaticImageReductionFactor is on. Default is 8.
+   */
+  vtkSetClampMacro(MaxImageReductionFactor, int, 1, 50);
+  vtkGetMacro(MaxImageReductionFactor, int);
+  ///@}
+
+  /**
+   * Return the time in seconds the last render took on this process, from
+   * the start of the render to the image being pushed back to the screen.
+   */
+  vtkGetMacro(LastRenderTime, double);
+
   ///@{
   /**
    * If on (default), the rendered images are pasted back on to the screen. You
@@ -269,6 +298,13 @@ protected:
   virtual void MasterEndRender();
   virtual void SlaveEndRender();
 
+  /**
+   * Compute the image reduction factor meeting the desired update rate of the
+   * render window, when AutomaticImageReductionFactor is on. Called by
+   * MasterStartRender() before the factor is sent to the other processes.
+   */
+  virtual void UpdateImageReductionFactor();
+
   vtkMultiProcessController* ParallelController;
   vtkOpenGLRenderer* Renderer;
 
@@ -293,6 +329,9 @@ protected:
   bool WriteBackImages;
   int RootProcessId;
   bool AutomaticEventHandling;
+  bool AutomaticImageReductionFactor = false;
+  int MaxImageReductionFactor = 8;
+  double LastRenderTime = 0.0;
 
 private:
   vtkSynchronizedRenderers(const vtkSynchronizedRenderers&) = delete;
@@ -312,6 +351,8 @@ private:
   bool LastTexturedBackground;
   bool LastGradientBackground;
   bool FixBackground;
+
+  double RenderStartTime = 0.0;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -29,7 +29,7 @@ void vtkPythonItem::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   vtkSmartPyObject str;
   if (this->Object)
   {
@@ -63,7 +63,7 @@ vtkPythonItem::~vtkPythonItem()
   // have been finalized before the VTK object is released.
   if (Py_IsInitialized())
   {
-    vtkPythonScopeGilEnsurer gilEnsurer;
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
     Py_XDECREF(this->Object);
   }
 }
@@ -109,7 +109,7 @@ static PyObject* VTKToPython(vtkObjectBase* obj)
 //------------------------------------------------------------------------------
 bool vtkPythonItem::CheckResult(const char* method, const vtkSmartPyObject& res)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   if (!res)
   {
     vtkErrorMacro("Failure when calling method: \"" << method << "\":");
@@ -132,7 +132,7 @@ bool vtkPythonItem::CheckResult(const char* method, const vtkSmartPyObject& res)
 //------------------------------------------------------------------------------
 void vtkPythonItem::SetPythonObject(PyObject* obj)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
 
   if (!obj)
   {
@@ -159,7 +159,7 @@ void vtkPythonItem::SetPythonObject(PyObject* obj)
 //------------------------------------------------------------------------------
 bool vtkPythonItem::Paint(vtkContext2D* painter)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   const char* mname = "Paint";
   VTK_GET_METHOD(method, this->Object, mname, 0)
 
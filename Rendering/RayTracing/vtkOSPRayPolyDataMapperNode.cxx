@@ -23,6 +23,7 @@
 #include "vtkInformationDoubleKey.h"
 #include "vtkInformationObjectBaseKey.h"
 #include "vtkMapper.h"
+#include "vtkMath.h"
 #include "vtkMatrix3x3.h"
 #include "vtkMatrix4x4.h"
 #include "vtkOSPRayActorNode.h"
@@ -42,6 +43,7 @@
 
 #include "RTWrapper/RTWrapper.h"
 
+#include <algorithm>
 #include <map>
 
 //============================================================================
@@ -813,11 +815,165 @@ VTK_ABI_NAMESPACE_END
 }
 
 VTK_ABI_NAMESPACE_BEGIN
+//============================================================================
+//============================================================================
+class vtkOSPRayPolyDataMapperNode::vtkGeometryCache
+{
+public:
+  struct Entry
+  {
+    Entry() = default;
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+    ~Entry() { this->Release(); }
+
+    void Release()
+    {
+      if (this->Position)
+      {
+        RTW::Backend* backend = this->Backend;
+        ospRelease(this->Position);
+        this->Position = nullptr;
+      }
+      this->SharedPoints = nullptr;
+    }
+
+    // what the geometry was built from
+    RTW::Backend* Backend = nullptr;
+    vtkMTimeType PolyTime = 0;
+    int Representation = -1;
+    double Matrix[16];
+    // last render in which the entry was used
+    unsigned long Generation = 0;
+
+    // positions in OSPRay, shared with SharedPoints when it is set
+    OSPData Position = nullptr;
+    vtkSmartPointer<vtkFloatArray> SharedPoints;
+    // transformed positions, only computed when spheres or cylinders need them
+    std::vector<osp::vec3f> Vertices;
+    bool VerticesValid = false;
+    vtkPolyDataMapperNode::vtkPDConnectivity Connectivity;
+    vtkPolyDataMapperNode::vtkPDConnectivity EdgeConnectivity;
+    bool EdgeConnectivityValid = false;
+  };
+
+  /**
+   * Return the geometry of poly, rebuilt only if poly, the representation or the
+   * actor transform changed since it was last built. Its Position is nullptr when
+   * poly has no points.
+   */
+  Entry& Get(RTW::Backend* backend, vtkActor* act, vtkPolyData* poly, int representation)
+  {
+    Entry& entry = this->Entries[poly];
+    entry.Generation = this->Generation;
+    double matrix[16];
+    act->GetMatrix(matrix);
+    if (entry.Position && entry.Backend == backend && entry.PolyTime == poly->GetMTime() &&
+      entry.Representation == representation && std::equal(matrix, matrix + 16, entry.Matrix))
+    {
+      return entry;
+    }
+
+    entry.Release();
+    entry.Backend = backend;
+    entry.PolyTime = poly->GetMTime();
+    entry.Representation = representation;
+    std::copy(matrix, matrix + 16, entry.Matrix);
+    entry.Vertices.clear();
+    entry.VerticesValid = false;
+    entry.Connectivity = vtkPolyDataMapperNode::vtkPDConnectivity();
+    entry.EdgeConnectivity = vtkPolyDataMapperNode::vtkPDConnectivity();
+    entry.EdgeConnectivityValid = false;
+
+    const vtkIdType numPoints = poly->GetNumberOfPoints();
+    if (numPoints == 0)
+    {
+      return entry;
+    }
+
+    // TransformPoints replaces the NaN points, so only finite points can be shared
+    vtkFloatArray* points = vtkFloatArray::FastDownCast(poly->GetPoints()->GetData());
+    if (act->GetIsIdentity() && points && points->GetNumberOfComponents() == 3 &&
+      std::none_of(points->GetPointer(0), points->GetPointer(0) + 3 * numPoints,
+        [](float value) { return vtkMath::IsNan(value); }))
+    {
+      entry.SharedPoints = points;
+      entry.Position = ospNewSharedData1D(
+        points->GetPointer(0), OSP_VEC3F, static_cast<uint32_t>(numPoints));
+    }
+    else
+    {
+      vtkGeometryCache::GetVertices(entry, act, poly);
+      entry.Position =
+        ospNewCopyData1D(entry.Vertices.data(), OSP_VEC3F, entry.Vertices.size());
+    }
+    ospCommit(entry.Position);
+
+    vtkPolyDataMapperNode::MakeConnectivity(poly, representation, entry.Connectivity);
+    return entry;
+  }
+
+  /**
+   * Return the transformed positions of the points of poly.
+   */
+  static std::vector<osp::vec3f>& GetVertices(Entry& entry, vtkActor* act, vtkPolyData* poly)
+  {
+    if (!entry.VerticesValid)
+    {
+      std::vector<double> _vertices;
+      vtkPolyDataMapperNode::TransformPoints(act, poly, _vertices);
+      const size_t numPositions = _vertices.size() / 3;
+      entry.Vertices.resize(numPositions);
+      for (size_t i = 0; i < numPositions; i++)
+      {
+        entry.Vertices[i] = osp::vec3f{ static_cast<float>(_vertices[i * 3 + 0]),
+          static_cast<float>(_vertices[i * 3 + 1]), static_cast<float>(_vertices[i * 3 + 2]) };
+      }
+      entry.VerticesValid = true;
+    }
+    return entry.Vertices;
+  }
+
+  /**
+   * Return the connectivity of the edges of the surface of poly.
+   */
+  static vtkPolyDataMapperNode::vtkPDConnectivity& GetEdgeConnectivity(
+    Entry& entry, vtkPolyData* poly)
+  {
+    if (!entry.EdgeConnectivityValid)
+    {
+      vtkPolyDataMapperNode::MakeConnectivity(poly, VTK_WIREFRAME, entry.EdgeConnectivity);
+      entry.EdgeConnectivityValid = true;
+    }
+    return entry.EdgeConnectivity;
+  }
+
+  /**
+   * Start a new render of the geometric models: the entries not used by the
+   * end of it are released.
+   */
+  void BeginRender() { this->Generation++; }
+  void EndRender()
+  {
+    for (auto it = this->Entries.begin(); it != this->Entries.end();)
+    {
+      it = it->second.Generation != this->Generation ? this->Entries.erase(it) : std::next(it);
+    }
+  }
+
+private:
+  std::map<vtkPolyData*, Entry> Entries;
+  unsigned long Generation = 0;
+};
+
 //============================================================================
 vtkStandardNewMacro(vtkOSPRayPolyDataMapperNode);
 
 //------------------------------------------------------------------------------
-vtkOSPRayPolyDataMapperNode::vtkOSPRayPolyDataMapperNode() {}
+vtkOSPRayPolyDataMapperNode::vtkOSPRayPolyDataMapperNode()
+  : GeometryCache(new vtkGeometryCache)
+{
+}
 
 //------------------------------------------------------------------------------
 vtkOSPRayPolyDataMapperNode::~vtkOSPRayPolyDataMapperNode() {}
@@ -855,27 +1011,22 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
     texTransform.w = mat[5];
   }
 
-  // make geometry
-  std::vector<double> _vertices;
-  vtkPolyDataMapperNode::TransformPoints(act, poly, _vertices);
-  size_t numPositions = _vertices.size() / 3;
-  if (numPositions == 0)
+  // make geometry and connectivity, or reuse them if only the appearance changed
+  vtkGeometryCache::Entry& geometry =
+    this->GeometryCache->Get(backend, act, poly, property->GetRepresentation());
+  if (geometry.Position == nullptr)
   {
     return;
   }
-  std::vector<osp::vec3f> vertices(numPositions);
-  for (size_t i = 0; i < numPositions; i++)
-  {
-    vertices[i] = osp::vec3f{ static_cast<float>(_vertices[i * 3 + 0]),
-      static_cast<float>(_vertices[i * 3 + 1]), static_cast<float>(_vertices[i * 3 + 2]) };
-  }
-  OSPData position = ospNewCopyData1D(&vertices[0], OSP_VEC3F, numPositions);
-  ospCommit(position);
-  _vertices.clear();
-
-  // make connectivity
-  vtkPolyDataMapperNode::vtkPDConnectivity conn;
-  vtkPolyDataMapperNode::MakeConnectivity(poly, property->GetRepresentation(), conn);
+  OSPData position = geometry.Position;
+  vtkPolyDataMapperNode::vtkPDConnectivity& conn = geometry.Connectivity;
+  // spheres and cylinders are made from the positions on our side
+  std::vector<osp::vec3f> noVertices;
+  std::vector<osp::vec3f>& vertices =
+    (!conn.vertex_index.empty() || !conn.line_index.empty() ||
+      property->GetRepresentation() != VTK_SURFACE || property->GetEdgeVisibility())
+    ? vtkGeometryCache::GetVertices(geometry, act, poly)
+    : noVertices;
 
   // choosing sphere and cylinder radii (for points and lines) that
   // approximate pointsize and linewidth
@@ -1143,8 +1294,8 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
         if (property->GetEdgeVisibility())
         {
           // edge mesh
-          vtkPolyDataMapperNode::vtkPDConnectivity conn2;
-          vtkPolyDataMapperNode::MakeConnectivity(poly, VTK_WIREFRAME, conn2);
+          vtkPolyDataMapperNode::vtkPDConnectivity& conn2 =
+            vtkGeometryCache::GetEdgeConnectivity(geometry, poly);
 
           // edge material
           double* eColor = property->GetEdgeColor();
@@ -1249,8 +1400,8 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
         if (property->GetEdgeVisibility())
         {
           // edge mesh
-          vtkPolyDataMapperNode::vtkPDConnectivity conn2;
-          vtkPolyDataMapperNode::MakeConnectivity(poly, VTK_WIREFRAME, conn2);
+          vtkPolyDataMapperNode::vtkPDConnectivity& conn2 =
+            vtkGeometryCache::GetEdgeConnectivity(geometry, poly);
 
           // edge material
           double* eColor = property->GetEdgeColor();
@@ -1300,7 +1451,6 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
       }
     }
   }
-  ospRelease(position);
 
   for (auto it : mats)
   {
@@ -1396,6 +1546,9 @@ void vtkOSPRayPolyDataMapperNode::RenderGeometricModels()
   {
     orn->Instances.emplace_back(instance);
   }
+
+  // release the geometry of the poly data that are no longer rendered
+  this->GeometryCache->EndRender();
 }
 
 //----------------------------------------------------------------------------
@@ -1411,5 +1564,6 @@ void vtkOSPRayPolyDataMapperNode::ClearGeometricModels()
     ospRelease(instance);
   }
   this->Instances.clear();
+  this->GeometryCache->BeginRender();
 }
 VTK_ABI_NAMESPACE_END
@@ -17,6 +17,12 @@
  * @brief   links vtkActor and vtkMapper to OSPRay
  *
  * Translates vtkActor/Mapper state into OSPRay rendering calls
+ *
+ * The positions and the connectivity of the rendered poly data are kept
+ * across renders, so that changing the appearance of the actor (color,
+ * opacity, material...) only rebuilds the OSPRay materials and models. When
+ * the actor has no transform and its points are stored as floats, the
+ * positions are shared with OSPRay instead of copied.
  */
 
 #ifndef vtkOSPRayPolyDataMapperNode_h
@@ -63,6 +69,12 @@ protected:
    */
   void RenderGeometricModels();
 
+  /**
+   * Positions and connectivity of the rendered poly data, per poly data.
+   */
+  class vtkGeometryCache;
+  std::unique_ptr<vtkGeometryCache> GeometryCache;
+
 private:
   vtkOSPRayPolyDataMapperNode(const vtkOSPRayPolyDataMapperNode&) = delete;
   void operator=(const vtkOSPRayPolyDataMapperNode&) = delete;
@@ -0,0 +1,241 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestAMRVolumeMapperMultiResolution.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the blocks that vtkAMRVolumeMapper selects and the bricks it renders
+// when MultiResolution is on. The dataset has two root blocks side by side
+// along x, each with a refined child in its middle.
+
+#include "vtkAMRBox.h"
+#include "vtkAMRUtilities.h"
+#include "vtkAMRVolumeMapper.h"
+#include "vtkBoundingBox.h"
+#include "vtkCamera.h"
+#include "vtkCellData.h"
+#include "vtkColorTransferFunction.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkOverlappingAMR.h"
+#include "vtkPiecewiseFunction.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkUniformGrid.h"
+#include "vtkVolume.h"
+#include "vtkVolumeProperty.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using BlockList = std::vector<std::pair<unsigned int, unsigned int>>;
+
+// Gives access to the selection of the mapper
+class SelectionAMRVolumeMapper : public vtkAMRVolumeMapper
+{
+public:
+  static SelectionAMRVolumeMapper* New();
+  vtkTypeMacro(SelectionAMRVolumeMapper, vtkAMRVolumeMapper);
+
+  const BlockList& GetSelectedBlocks() const { return this->SelectedBlocks; }
+  vtkMultiBlockDataSet* GetBricks() const { return this->Bricks; }
+};
+vtkStandardNewMacro(SelectionAMRVolumeMapper);
+
+void AddBlock(vtkOverlappingAMR* amr, unsigned int level, unsigned int id, double x, double y,
+  double z, double spacing, double value)
+{
+  double origin[3] = { x, y, z };
+  double h[3] = { spacing, spacing, spacing };
+  int dims[3] = { 5, 5, 5 };
+  vtkNew<vtkUniformGrid> grid;
+  grid->SetOrigin(origin);
+  grid->SetSpacing(h);
+  grid->SetDimensions(dims);
+  vtkNew<vtkDoubleArray> density;
+  density->SetName("Density");
+  density->SetNumberOfTuples(grid->GetNumberOfCells());
+  density->FillValue(value);
+  grid->GetCellData()->AddArray(density);
+
+  amr->SetSpacing(level, h);
+  amr->SetAMRBox(level, id, vtkAMRBox(origin, dims, h, amr->GetOrigin(), VTK_XYZ_GRID));
+  amr->SetDataSet(level, id, grid);
+}
+
+// Root blocks [0, 4]^3 and [4, 8]x[0, 4]^2 with a cell size of 1, and their
+// children [1, 3]^3 and [5, 7]x[1, 3]^2 with a cell size of 0.5
+vtkSmartPointer<vtkOverlappingAMR> MakeAMR()
+{
+  auto amr = vtkSmartPointer<vtkOverlappingAMR>::New();
+  const int blocksPerLevel[2] = { 2, 2 };
+  amr->Initialize(2, blocksPerLevel);
+  const double origin[3] = { 0.0, 0.0, 0.0 };
+  amr->SetOrigin(origin);
+  amr->SetGridDescription(VTK_XYZ_GRID);
+  AddBlock(amr, 0, 0, 0.0, 0.0, 0.0, 1.0, 1.0);
+  AddBlock(amr, 0, 1, 4.0, 0.0, 0.0, 1.0, 1.0);
+  AddBlock(amr, 1, 0, 1.0, 1.0, 1.0, 0.5, 2.0);
+  AddBlock(amr, 1, 1, 5.0, 1.0, 1.0, 0.5, 2.0);
+  vtkAMRUtilities::BlankCells(amr);
+  return amr;
+}
+
+double Volume(const double bounds[6])
+{
+  return (bounds[1] - bounds[0]) * (bounds[3] - bounds[2]) * (bounds[5] - bounds[4]);
+}
+
+// Check the selected blocks, and that the bricks do not overlap and cover
+// the selected root blocks with the cells of the finest selected level.
+bool CheckSelection(const char* view, SelectionAMRVolumeMapper* mapper, vtkOverlappingAMR* amr,
+  const BlockList& expectedBlocks, unsigned int expectedBricks)
+{
+  if (mapper->GetSelectedBlocks() != expectedBlocks)
+  {
+    std::cerr << view << ": the selected blocks are";
+    for (const auto& block : mapper->GetSelectedBlocks())
+    {
+      std::cerr << " (" << block.first << ", " << block.second << ")";
+    }
+    std::cerr << std::endl;
+    return false;
+  }
+  vtkMultiBlockDataSet* bricks = mapper->GetBricks();
+  if (!bricks || bricks->GetNumberOfBlocks() != expectedBricks)
+  {
+    std::cerr << view << ": " << (bricks ? bricks->GetNumberOfBlocks() : 0)
+              << " bricks instead of " << expectedBricks << std::endl;
+    return false;
+  }
+
+  double expectedVolume = 0.0;
+  double expectedFineVolume = 0.0;
+  for (const auto& block : expectedBlocks)
+  {
+    double bounds[6];
+    amr->GetBounds(block.first, block.second, bounds);
+    (block.first == 0 ? expectedVolume : expectedFineVolume) += Volume(bounds);
+  }
+  double volume = 0.0;
+  double fineVolume = 0.0;
+  for (unsigned int i = 0; i < bricks->GetNumberOfBlocks(); ++i)
+  {
+    vtkImageData* brick = vtkImageData::SafeDownCast(bricks->GetBlock(i));
+    double bounds[6];
+    brick->GetBounds(bounds);
+    (brick->GetSpacing()[0] == 1.0 ? volume : fineVolume) += Volume(bounds);
+    vtkBoundingBox box(bounds);
+    for (unsigned int j = 0; j < i; ++j)
+    {
+      double otherBounds[6];
+      vtkImageData::SafeDownCast(bricks->GetBlock(j))->GetBounds(otherBounds);
+      vtkBoundingBox overlap(box);
+      if (overlap.IntersectBox(vtkBoundingBox(otherBounds)) && overlap.GetLength(0) > 0 &&
+        overlap.GetLength(1) > 0 && overlap.GetLength(2) > 0)
+      {
+        std::cerr << view << ": bricks " << j << " and " << i << " overlap" << std::endl;
+        return false;
+      }
+    }
+  }
+  if (volume + fineVolume != expectedVolume || fineVolume != expectedFineVolume)
+  {
+    std::cerr << view << ": the bricks cover " << volume + fineVolume << " with " << fineVolume
+              << " refined instead of " << expectedVolume << " with " << expectedFineVolume
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestAMRVolumeMapperMultiResolution(int, char*[])
+{
+  vtkSmartPointer<vtkOverlappingAMR> amr = MakeAMR();
+
+  vtkNew<SelectionAMRVolumeMapper> mapper;
+  mapper->SetInputData(amr);
+  mapper->SetScalarModeToUseCellFieldData();
+  mapper->SelectScalarArray("Density");
+  mapper->MultiResolutionOn();
+
+  vtkNew<vtkColorTransferFunction> color;
+  color->AddRGBPoint(1.0, 0.0, 0.0, 1.0);
+  color->AddRGBPoint(2.0, 1.0, 0.0, 0.0);
+  vtkNew<vtkPiecewiseFunction> opacity;
+  opacity->AddPoint(1.0, 0.05);
+  opacity->AddPoint(2.0, 0.2);
+  vtkNew<vtkVolume> volume;
+  volume->SetMapper(mapper);
+  volume->GetProperty()->SetColor(color);
+  volume->GetProperty()->SetScalarOpacity(opacity);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddVolume(volume);
+  vtkNew<vtkRenderWindow> renderWindow;
+  renderWindow->SetSize(300, 300);
+  renderWindow->AddRenderer(renderer);
+
+  // Looking along x at both root blocks, the cells of the children of the
+  // closest one cover 0.5 * 150 / tan(15) / 10 ~= 28 pixels, and those of
+  // the children of the other one 0.5 * 150 / tan(15) / 14 ~= 20 pixels.
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->SetPosition(-10.0, 2.0, 2.0);
+  camera->SetFocalPoint(4.0, 2.0, 2.0);
+  camera->SetViewUp(0.0, 0.0, 1.0);
+  camera->SetViewAngle(30.0);
+  renderer->ResetCameraClippingRange();
+
+  // The closest root block is split in 6 bricks around its child
+  mapper->SetMinimumPixelsPerCell(24.0);
+  renderWindow->Render();
+  if (!CheckSelection("Close block refined", mapper, amr, { { 0, 0 }, { 0, 1 }, { 1, 0 } }, 8))
+  {
+    return EXIT_FAILURE;
+  }
+
+  mapper->SetMinimumPixelsPerCell(1000.0);
+  renderWindow->Render();
+  if (!CheckSelection("Coarse", mapper, amr, { { 0, 0 }, { 0, 1 } }, 2))
+  {
+    return EXIT_FAILURE;
+  }
+
+  mapper->SetMinimumPixelsPerCell(0.0);
+  renderWindow->Render();
+  if (!CheckSelection("Fine", mapper, amr, { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 } }, 14))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Looking down at the first root block with a narrow view, the second one
+  // and its child are culled.
+  camera->SetPosition(2.0, 2.0, 20.0);
+  camera->SetFocalPoint(2.0, 2.0, 2.0);
+  camera->SetViewUp(0.0, 1.0, 0.0);
+  camera->SetViewAngle(10.0);
+  renderer->ResetCameraClippingRange();
+  renderWindow->Render();
+  if (!CheckSelection("Culled", mapper, amr, { { 0, 0 }, { 1, 0 } }, 7))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
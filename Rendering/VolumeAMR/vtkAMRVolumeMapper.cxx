@@ -17,25 +17,34 @@
 #include "vtkAMRResampleFilter.h"
 #include "vtkBoundingBox.h"
 #include "vtkCamera.h"
+#include "vtkCellData.h"
 #include "vtkCompositeDataPipeline.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
+#include "vtkExtractVOI.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkMultiBlockVolumeMapper.h"
 #include "vtkMultiThreader.h"
 #include "vtkObjectFactory.h"
 #include "vtkOverlappingAMR.h"
+#include "vtkPointData.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkSmartVolumeMapper.h"
 #include "vtkUniformGrid.h"
+#include "vtkVolume.h"
 
 #include "vtkNew.h"
 #include "vtkTimerLog.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkAMRVolumeMapper);
 
@@ -61,6 +70,11 @@ vtkAMRVolumeMapper::vtkAMRVolumeMapper()
   this->ResamplerUpdateTolerance = 10e-8;
   this->GridNeedsToBeUpdated = true;
   this->UseDefaultThreading = false;
+  this->MultiResolution = false;
+  this->MinimumPixelsPerCell = 1.0;
+  this->BlockMapper = vtkMultiBlockVolumeMapper::New();
+  this->Bricks = nullptr;
+  this->BricksInputTime = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -70,6 +84,13 @@ vtkAMRVolumeMapper::~vtkAMRVolumeMapper()
   this->InternalMapper = nullptr;
   this->Resampler->Delete();
   this->Resampler = nullptr;
+  this->BlockMapper->Delete();
+  this->BlockMapper = nullptr;
+  if (this->Bricks)
+  {
+    this->Bricks->Delete();
+    this->Bricks = nullptr;
+  }
   if (this->Grid)
   {
     this->Grid->Delete();
@@ -146,12 +167,14 @@ int vtkAMRVolumeMapper::FillInputPortInformation(int vtkNotUsed(port), vtkInform
 void vtkAMRVolumeMapper::SelectScalarArray(int arrayNum)
 {
   this->InternalMapper->SelectScalarArray(arrayNum);
+  this->BlockMapper->SelectScalarArray(arrayNum);
 }
 
 //------------------------------------------------------------------------------
 void vtkAMRVolumeMapper::SelectScalarArray(const char* arrayName)
 {
   this->InternalMapper->SelectScalarArray(arrayName);
+  this->BlockMapper->SelectScalarArray(arrayName);
 }
 
 //------------------------------------------------------------------------------
@@ -194,11 +217,14 @@ void vtkAMRVolumeMapper::SetScalarMode(int mode)
   }
 
   this->InternalMapper->SetScalarMode(newMode);
+  // the blocks keep their cell data
+  this->BlockMapper->SetScalarMode(mode);
 }
 //------------------------------------------------------------------------------
 void vtkAMRVolumeMapper::SetBlendMode(int mode)
 {
   this->InternalMapper->SetBlendMode(mode);
+  this->BlockMapper->SetBlendMode(mode);
 }
 //------------------------------------------------------------------------------
 int vtkAMRVolumeMapper::GetBlendMode()
@@ -209,6 +235,7 @@ int vtkAMRVolumeMapper::GetBlendMode()
 void vtkAMRVolumeMapper::SetCropping(vtkTypeBool mode)
 {
   this->InternalMapper->SetCropping(mode);
+  this->BlockMapper->SetCropping(mode);
 }
 //------------------------------------------------------------------------------
 vtkTypeBool vtkAMRVolumeMapper::GetCropping()
@@ -219,6 +246,7 @@ vtkTypeBool vtkAMRVolumeMapper::GetCropping()
 void vtkAMRVolumeMapper::SetCroppingRegionFlags(int mode)
 {
   this->InternalMapper->SetCroppingRegionFlags(mode);
+  this->BlockMapper->SetCroppingRegionFlags(mode);
 }
 //------------------------------------------------------------------------------
 int vtkAMRVolumeMapper::GetCroppingRegionFlags()
@@ -230,6 +258,7 @@ void vtkAMRVolumeMapper::SetCroppingRegionPlanes(
   double arg1, double arg2, double arg3, double arg4, double arg5, double arg6)
 {
   this->InternalMapper->SetCroppingRegionPlanes(arg1, arg2, arg3, arg4, arg5, arg6);
+  this->BlockMapper->SetCroppingRegionPlanes(arg1, arg2, arg3, arg4, arg5, arg6);
 }
 //------------------------------------------------------------------------------
 void vtkAMRVolumeMapper::GetCroppingRegionPlanes(double* planes)
@@ -245,6 +274,7 @@ double* vtkAMRVolumeMapper::GetCroppingRegionPlanes()
 void vtkAMRVolumeMapper::SetRequestedRenderMode(int mode)
 {
   this->InternalMapper->SetRequestedRenderMode(mode);
+  this->BlockMapper->SetRequestedRenderMode(mode);
 }
 //------------------------------------------------------------------------------
 int vtkAMRVolumeMapper::GetRequestedRenderMode()
@@ -265,10 +295,17 @@ int vtkAMRVolumeMapper::GetInterpolationMode()
 void vtkAMRVolumeMapper::ReleaseGraphicsResources(vtkWindow* window)
 {
   this->InternalMapper->ReleaseGraphicsResources(window);
+  this->BlockMapper->ReleaseGraphicsResources(window);
 }
 //------------------------------------------------------------------------------
 void vtkAMRVolumeMapper::Render(vtkRenderer* ren, vtkVolume* vol)
 {
+  if (this->MultiResolution)
+  {
+    this->RenderBlocks(ren, vol);
+    return;
+  }
+
   // Hack - Make sure the camera is in the right mode for moving the focal point
   ren->GetActiveCamera()->SetFreezeFocalPoint(this->FreezeFocalPoint);
   // If there is no grid initially we need to see if we can create one
@@ -570,6 +607,284 @@ void vtkAMRVolumeMapper::UpdateGrid()
             << ")\n";
 #endif
 }
+//------------------------------------------------------------------------------
+void vtkAMRVolumeMapper::RenderBlocks(vtkRenderer* ren, vtkVolume* vol)
+{
+  vtkAlgorithm* producer =
+    this->GetNumberOfInputConnections(0) > 0 ? this->GetInputAlgorithm() : nullptr;
+  if (producer == nullptr)
+  {
+    return;
+  }
+  producer->Update();
+  vtkOverlappingAMR* amr = vtkOverlappingAMR::SafeDownCast(this->GetInputDataObject(0, 0));
+  if (amr == nullptr || amr->GetNumberOfLevels() == 0)
+  {
+    return;
+  }
+  if (!amr->HasChildrenInformation())
+  {
+    amr->GenerateParentChildInformation();
+  }
+
+  // As for the resampled grid, the bricks are kept during interactive renders
+  // that the previous render was too slow for, unless the input has changed.
+  bool interactive = this->Bricks &&
+    (1.0 / ren->GetRenderWindow()->GetDesiredUpdateRate() < this->TimeToDraw);
+  if (!interactive || amr->GetMTime() != this->BricksInputTime)
+  {
+    std::vector<std::pair<unsigned int, unsigned int>> blocks = this->SelectBlocks(ren, vol, amr);
+    if (!this->Bricks || blocks != this->SelectedBlocks || amr->GetMTime() != this->BricksInputTime)
+    {
+      this->SelectedBlocks = std::move(blocks);
+      this->UpdateBricks(amr);
+      this->BricksInputTime = amr->GetMTime();
+    }
+  }
+  if (this->Bricks->GetNumberOfBlocks() == 0)
+  {
+    return;
+  }
+
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  if (this->UseDefaultThreading)
+  {
+    int maxNumThreads = vtkMultiThreader::GetGlobalMaximumNumberOfThreads();
+    vtkMultiThreader::SetGlobalMaximumNumberOfThreads(0);
+    this->BlockMapper->Render(ren, vol);
+    vtkMultiThreader::SetGlobalMaximumNumberOfThreads(maxNumThreads);
+  }
+  else
+  {
+    this->BlockMapper->Render(ren, vol);
+  }
+  timer->StopTimer();
+  this->TimeToDraw = timer->GetElapsedTime();
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::pair<unsigned int, unsigned int>> vtkAMRVolumeMapper::SelectBlocks(
+  vtkRenderer* ren, vtkVolume* vol, vtkOverlappingAMR* amr)
+{
+  // Blocks are culled with the part of the view frustum that the dataset
+  // covers, as for the resampled grid.
+  double bounds[6];
+  amr->GetBounds(bounds);
+  double visibleBounds[6];
+  vtkCamera* cam = ren->GetActiveCamera();
+  vtkBoundingBox visibleBox;
+  if (vtkAMRVolumeMapper::ComputeResamplerBoundsFrustumMethod(cam, ren, bounds, visibleBounds))
+  {
+    visibleBox.SetBounds(visibleBounds);
+  }
+  else
+  {
+    visibleBox.SetBounds(bounds);
+  }
+
+  // The size of a pixel at a given distance of the camera, in the
+  // coordinates of the dataset
+  double cameraPosition[4] = { 0.0, 0.0, 0.0, 1.0 };
+  cam->GetPosition(cameraPosition);
+  vtkNew<vtkMatrix4x4> worldToData;
+  vtkMatrix4x4::Invert(vol->GetMatrix(), worldToData);
+  worldToData->MultiplyPoint(cameraPosition, cameraPosition);
+  const int* size = ren->GetSize();
+  double pixelsPerUnit = std::max(size[1], 1) / 2.0;
+  if (cam->GetParallelProjection())
+  {
+    pixelsPerUnit /= cam->GetParallelScale();
+  }
+  else
+  {
+    pixelsPerUnit /= std::tan(vtkMath::RadiansFromDegrees(cam->GetViewAngle()) / 2.0);
+  }
+
+  const unsigned int numLevels = amr->GetNumberOfLevels();
+  std::vector<std::vector<bool>> selected(numLevels);
+  for (unsigned int level = 0; level < numLevels; ++level)
+  {
+    selected[level].resize(amr->GetNumberOfDataSets(level), level == 0);
+  }
+  std::vector<std::pair<unsigned int, unsigned int>> blocks;
+  for (unsigned int level = 0; level < numLevels; ++level)
+  {
+    double childSpacing[3] = { 0.0, 0.0, 0.0 };
+    if (level + 1 < numLevels)
+    {
+      amr->GetSpacing(level + 1, childSpacing);
+    }
+    double childCellSize = std::max({ childSpacing[0], childSpacing[1], childSpacing[2] });
+    for (unsigned int id = 0; id < amr->GetNumberOfDataSets(level); ++id)
+    {
+      double blockBounds[6];
+      amr->GetBounds(level, id, blockBounds);
+      if (!selected[level][id] || !visibleBox.Intersects(vtkBoundingBox(blockBounds)))
+      {
+        continue;
+      }
+      if (amr->GetDataSet(level, id))
+      {
+        blocks.emplace_back(level, id);
+      }
+
+      // Refine the block if the cells of its children cover enough pixels
+      // at the point of the block closest to the camera.
+      double distance2 = 0.0;
+      for (int i = 0; i < 3; ++i)
+      {
+        double d = std::max({ blockBounds[2 * i] - cameraPosition[i], 0.0,
+          cameraPosition[i] - blockBounds[2 * i + 1] });
+        distance2 += d * d;
+      }
+      double childPixels = cam->GetParallelProjection()
+        ? childCellSize * pixelsPerUnit
+        : childCellSize * pixelsPerUnit / std::sqrt(distance2);
+      if (level + 1 < numLevels && (distance2 == 0.0 || childPixels >= this->MinimumPixelsPerCell))
+      {
+        unsigned int numChildren;
+        unsigned int* children = amr->GetChildren(level, id, numChildren);
+        for (unsigned int i = 0; i < numChildren; ++i)
+        {
+          selected[level + 1][children[i]] = true;
+        }
+      }
+    }
+  }
+  return blocks;
+}
+
+//------------------------------------------------------------------------------
+void vtkAMRVolumeMapper::UpdateBricks(vtkOverlappingAMR* amr)
+{
+  if (this->Bricks)
+  {
+    this->Bricks->Delete();
+  }
+  this->Bricks = vtkMultiBlockDataSet::New();
+
+  // Selected blocks of each level, to subtract them from their parents
+  std::vector<std::vector<bool>> selected(amr->GetNumberOfLevels());
+  for (unsigned int level = 0; level < amr->GetNumberOfLevels(); ++level)
+  {
+    selected[level].resize(amr->GetNumberOfDataSets(level), false);
+  }
+  for (const auto& block : this->SelectedBlocks)
+  {
+    selected[block.first][block.second] = true;
+  }
+
+  using CellBox = std::array<int, 6>; // inclusive cell index ranges of a block
+  vtkNew<vtkExtractVOI> extractor;
+  unsigned int brickIdx = 0;
+  for (const auto& block : this->SelectedBlocks)
+  {
+    const unsigned int level = block.first;
+    vtkUniformGrid* grid = amr->GetDataSet(level, block.second);
+    int extent[6];
+    grid->GetExtent(extent);
+    double origin[3];
+    grid->GetOrigin(origin);
+    double spacing[3];
+    grid->GetSpacing(spacing);
+
+    // Remove the parts of the block covered by its selected children, by
+    // splitting the remaining bricks along the faces of each child.
+    std::vector<CellBox> bricks(1);
+    for (int i = 0; i < 3; ++i)
+    {
+      bricks[0][2 * i] = 0;
+      bricks[0][2 * i + 1] = std::max(extent[2 * i + 1] - extent[2 * i], 1) - 1;
+    }
+    bool split = false;
+    unsigned int numChildren = 0;
+    unsigned int* children = level + 1 < amr->GetNumberOfLevels()
+      ? amr->GetChildren(level, block.second, numChildren)
+      : nullptr;
+    for (unsigned int c = 0; c < numChildren; ++c)
+    {
+      if (!selected[level + 1][children[c]])
+      {
+        continue;
+      }
+      double childBounds[6];
+      amr->GetBounds(level + 1, children[c], childBounds);
+      CellBox cut;
+      for (int i = 0; i < 3; ++i)
+      {
+        cut[2 * i] =
+          static_cast<int>(std::floor((childBounds[2 * i] - origin[i]) / spacing[i] + 0.5));
+        cut[2 * i + 1] =
+          static_cast<int>(std::floor((childBounds[2 * i + 1] - origin[i]) / spacing[i] + 0.5)) - 1;
+      }
+      std::vector<CellBox> remaining;
+      for (CellBox brick : bricks)
+      {
+        bool intersects = true;
+        for (int i = 0; i < 3; ++i)
+        {
+          intersects &= cut[2 * i] <= brick[2 * i + 1] && brick[2 * i] <= cut[2 * i + 1];
+        }
+        if (!intersects)
+        {
+          remaining.push_back(brick);
+          continue;
+        }
+        split = true;
+        // Slabs on either side of the child along each axis, then shrink the
+        // brick to the child along that axis.
+        for (int i = 0; i < 3; ++i)
+        {
+          if (brick[2 * i] < cut[2 * i])
+          {
+            CellBox slab = brick;
+            slab[2 * i + 1] = cut[2 * i] - 1;
+            remaining.push_back(slab);
+            brick[2 * i] = cut[2 * i];
+          }
+          if (cut[2 * i + 1] < brick[2 * i + 1])
+          {
+            CellBox slab = brick;
+            slab[2 * i] = cut[2 * i + 1] + 1;
+            remaining.push_back(slab);
+            brick[2 * i + 1] = cut[2 * i + 1];
+          }
+        }
+      }
+      bricks = std::move(remaining);
+    }
+
+    for (const CellBox& brick : bricks)
+    {
+      vtkNew<vtkImageData> image;
+      if (!split)
+      {
+        image->ShallowCopy(grid);
+      }
+      else
+      {
+        int voi[6];
+        for (int i = 0; i < 3; ++i)
+        {
+          voi[2 * i] = extent[2 * i] + brick[2 * i];
+          voi[2 * i + 1] = std::min(extent[2 * i] + brick[2 * i + 1] + 1, extent[2 * i + 1]);
+        }
+        extractor->SetInputData(grid);
+        extractor->SetVOI(voi);
+        extractor->Update();
+        image->ShallowCopy(extractor->GetOutput());
+      }
+      // The blanking of the AMR hierarchy would hide the refined cells
+      image->GetCellData()->RemoveArray(vtkDataSetAttributes::GhostArrayName());
+      image->GetPointData()->RemoveArray(vtkDataSetAttributes::GhostArrayName());
+      this->Bricks->SetBlock(brickIdx++, image);
+    }
+  }
+  extractor->SetInputData(nullptr);
+  this->BlockMapper->SetInputDataObject(this->Bricks);
+}
+
 //------------------------------------------------------------------------------
 void vtkAMRVolumeMapper::ProcessUpdateExtentRequest(vtkRenderer* vtkNotUsed(ren),
   vtkInformation* info, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -629,6 +944,8 @@ void vtkAMRVolumeMapper::PrintSelf(ostream& os, vtkIndent indent)
   os << std::endl;
   os << indent << "RequestedResamplingMode: " << this->RequestedResamplingMode << "\n";
   os << indent << "FreezeFocalPoint: " << this->FreezeFocalPoint << "\n";
+  os << indent << "MultiResolution: " << this->MultiResolution << "\n";
+  os << indent << "MinimumPixelsPerCell: " << this->MinimumPixelsPerCell << "\n";
 }
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_END
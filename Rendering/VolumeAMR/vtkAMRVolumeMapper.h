@@ -20,7 +20,16 @@
  * vtkAMRVolumeMapper is the definition of a volume mapper.
  * for AMR Structured Data
  *
+ * By default, the AMR dataset is resampled to a single uniform grid covering
+ * the visible part of the dataset, which is rendered by a vtkSmartVolumeMapper.
  *
+ * When MultiResolution is on, the blocks of the AMR levels are rendered
+ * instead, without resampling. Each view selects the visible blocks, and
+ * refines a block with its children as long as the cells of the children
+ * project to at least MinimumPixelsPerCell pixels. The selected blocks are
+ * split into bricks that do not overlap the finer selected blocks, which are
+ * rendered by a vtkMultiBlockVolumeMapper. The blocks are expected not to
+ * have ghost layers, the blanking of the input is ignored.
  */
 
 #ifndef vtkAMRVolumeMapper_h
@@ -30,10 +39,15 @@
 #include "vtkRenderingVolumeAMRModule.h" // For export macro
 #include "vtkVolumeMapper.h"
 
+#include <utility> // For std::pair
+#include <vector>  // For SelectedBlocks
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkAMRResampleFilter;
 class vtkCamera;
 class vtkImageData;
+class vtkMultiBlockDataSet;
+class vtkMultiBlockVolumeMapper;
 class vtkOverlappingAMR;
 class vtkSmartVolumeMapper;
 class vtkUniformGrid;
@@ -305,6 +319,26 @@ public:
   vtkGetMacro(UseDefaultThreading, bool);
   ///@}
 
+  ///@{
+  /**
+   * Sets/Gets whether the blocks of the AMR levels are rendered, instead of
+   * a resampling of the dataset to a single grid. Default is false
+   */
+  vtkSetMacro(MultiResolution, bool);
+  vtkGetMacro(MultiResolution, bool);
+  vtkBooleanMacro(MultiResolution, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Sets/Gets the size, in pixels, that the cells of the children of a
+   * block must at least have on screen for the children to be rendered
+   * instead of the block. Only used when MultiResolution is on. Default is 1
+   */
+  vtkSetClampMacro(MinimumPixelsPerCell, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(MinimumPixelsPerCell, double);
+  ///@}
+
   /**
    * Utility method used by UpdateResamplerFrustrumMethod() to compute the
    * bounds.
@@ -320,6 +354,25 @@ protected:
   int FillInputPortInformation(int port, vtkInformation* info) override;
   void UpdateGrid();
 
+  /**
+   * Renders the blocks of the AMR levels selected for the view, when
+   * MultiResolution is on.
+   */
+  void RenderBlocks(vtkRenderer* ren, vtkVolume* vol);
+
+  /**
+   * Returns the (level, index) pairs of the loaded blocks that are visible
+   * and refined enough for the view, in composite order.
+   */
+  std::vector<std::pair<unsigned int, unsigned int>> SelectBlocks(
+    vtkRenderer* ren, vtkVolume* vol, vtkOverlappingAMR* amr);
+
+  /**
+   * Splits the selected blocks in bricks that do not overlap the finer
+   * selected blocks, and sets them as the input of the block mapper.
+   */
+  void UpdateBricks(vtkOverlappingAMR* amr);
+
   vtkSmartVolumeMapper* InternalMapper;
   vtkAMRResampleFilter* Resampler;
   vtkUniformGrid* Grid;
@@ -342,6 +395,14 @@ protected:
   bool GridNeedsToBeUpdated;
   bool UseDefaultThreading;
 
+  // Multi-resolution rendering of the AMR blocks
+  bool MultiResolution;
+  double MinimumPixelsPerCell;
+  vtkMultiBlockVolumeMapper* BlockMapper;
+  vtkMultiBlockDataSet* Bricks;
+  std::vector<std::pair<unsigned int, unsigned int>> SelectedBlocks;
+  vtkMTimeType BricksInputTime;
+
 private:
   vtkAMRVolumeMapper(const vtkAMRVolumeMapper&) = delete;
   void operator=(const vtkAMRVolumeMapper&) = delete;
@@ -0,0 +1,183 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGPURayCastEmptySpaceSkipping.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that leaping over the empty space of a sparse volume renders the
+// same images as sampling all of it, and that the empty macro-cells follow
+// the changes of the scalar opacity.
+
+#include "vtkCamera.h"
+#include "vtkColorTransferFunction.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkOpenGLGPUVolumeRayCastMapper.h"
+#include "vtkPiecewiseFunction.h"
+#include "vtkPointData.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkVolume.h"
+#include "vtkVolumeProperty.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->ShouldRerenderOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+// The samples after a leap are not exactly at the same positions, which can
+// change the images by a few units.
+bool SimilarImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (std::abs(a->GetValue(i) - b->GetValue(i)) > 2)
+    {
+      std::cerr << "Values " << int(a->GetValue(i)) << " and " << int(b->GetValue(i))
+                << " differ at " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool RenderSimilarSkipping(vtkRenderWindow* renWin, vtkOpenGLGPUVolumeRayCastMapper* mapper)
+{
+  mapper->UseEmptySpaceSkippingOff();
+  renWin->Render();
+  vtkSmartPointer<vtkUnsignedCharArray> reference = Capture(renWin);
+  mapper->UseEmptySpaceSkippingOn();
+  renWin->Render();
+  return SimilarImages(reference, Capture(renWin));
+}
+}
+
+int TestGPURayCastEmptySpaceSkipping(int, char*[])
+{
+  // A few balls, like the labels of a segmentation, in an empty volume.
+  const int size = 100;
+  const int centers[4][3] = { { 20, 20, 20 }, { 70, 30, 50 }, { 40, 75, 60 }, { 80, 80, 85 } };
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(size, size, size);
+  image->SetSpacing(1.0, 1.0, 1.2);
+  image->AllocateScalars(VTK_UNSIGNED_SHORT, 1);
+  auto scalars = static_cast<unsigned short*>(image->GetScalarPointer());
+  for (int k = 0; k < size; ++k)
+  {
+    for (int j = 0; j < size; ++j)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        unsigned short value = 0;
+        for (const auto& c : centers)
+        {
+          const int d2 = (i - c[0]) * (i - c[0]) + (j - c[1]) * (j - c[1]) + (k - c[2]) * (k - c[2]);
+          if (d2 < 100)
+          {
+            value = static_cast<unsigned short>(1000 - 5 * d2);
+          }
+        }
+        *scalars++ = value;
+      }
+    }
+  }
+
+  vtkNew<vtkColorTransferFunction> ctf;
+  ctf->AddRGBPoint(0, 0.0, 0.0, 0.0);
+  ctf->AddRGBPoint(500, 0.2, 0.4, 1.0);
+  ctf->AddRGBPoint(1000, 1.0, 0.9, 0.6);
+  vtkNew<vtkPiecewiseFunction> pf;
+  pf->AddPoint(0, 0.0);
+  pf->AddPoint(100, 0.0);
+  pf->AddPoint(1000, 0.6);
+  vtkNew<vtkVolumeProperty> volumeProperty;
+  volumeProperty->SetColor(ctf);
+  volumeProperty->SetScalarOpacity(pf);
+  volumeProperty->SetInterpolationTypeToLinear();
+  volumeProperty->ShadeOn();
+
+  vtkNew<vtkOpenGLGPUVolumeRayCastMapper> mapper;
+  mapper->SetInputData(image);
+  mapper->SetUseJittering(0);
+  mapper->SetSampleDistance(0.3);
+  mapper->AutoAdjustSampleDistancesOff();
+  vtkNew<vtkVolume> volume;
+  volume->SetMapper(mapper);
+  volume->SetProperty(volumeProperty);
+
+  vtkNew<vtkRenderer> ren;
+  ren->AddVolume(volume);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(ren);
+  ren->ResetCamera();
+  ren->GetActiveCamera()->Azimuth(30.0);
+  ren->GetActiveCamera()->Elevation(20.0);
+
+  if (!RenderSimilarSkipping(renWin, mapper))
+  {
+    std::cerr << "Images differ with the empty space skipped" << std::endl;
+    return EXIT_FAILURE;
+  }
+  // 13^3 macro-cells, most of them far from the balls.
+  const vtkIdType numberOfCells = 13 * 13 * 13;
+  if (mapper->GetNumberOfEmptyCells() < numberOfCells / 2 ||
+    mapper->GetNumberOfEmptyCells() >= numberOfCells)
+  {
+    std::cerr << "Unexpected number of empty cells " << mapper->GetNumberOfEmptyCells()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // From another point of view, with the rays entering the macro-cells
+  // through their other faces.
+  ren->GetActiveCamera()->Azimuth(150.0);
+  ren->GetActiveCamera()->Elevation(-60.0);
+  ren->GetActiveCamera()->OrthogonalizeViewUp();
+  ren->ResetCameraClippingRange();
+  if (!RenderSimilarSkipping(renWin, mapper))
+  {
+    std::cerr << "Images differ with the empty space skipped from behind" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The empty space becomes visible, no macro-cell is empty.
+  pf->AddPoint(0, 0.01);
+  if (!RenderSimilarSkipping(renWin, mapper))
+  {
+    std::cerr << "Images differ without empty space" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (mapper->GetNumberOfEmptyCells() != 0)
+  {
+    std::cerr << "Expected no empty cells, got " << mapper->GetNumberOfEmptyCells() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
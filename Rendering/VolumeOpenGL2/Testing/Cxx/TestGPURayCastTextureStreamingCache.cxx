@@ -0,0 +1,178 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGPURayCastTextureStreamingCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the partitions of a streamed volume stay resident in the
+// partition cache between renders, and that skipping the transparent
+// partitions renders the same images as rendering all of them.
+
+#include "vtkColorTransferFunction.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkOpenGLGPUVolumeRayCastMapper.h"
+#include "vtkPiecewiseFunction.h"
+#include "vtkPointData.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkVolume.h"
+#include "vtkVolumeProperty.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkUnsignedCharArray> Capture(vtkRenderWindow* renWin)
+{
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(renWin);
+  capture->ReadFrontBufferOff();
+  capture->ShouldRerenderOff();
+  capture->Update();
+  return vtkUnsignedCharArray::SafeDownCast(capture->GetOutput()->GetPointData()->GetScalars());
+}
+
+bool SameImages(vtkUnsignedCharArray* a, vtkUnsignedCharArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestGPURayCastTextureStreamingCache(int, char*[])
+{
+  // A ball in the first of the 2x2x2 partitions, the others are empty.
+  const int size = 64;
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(size, size, size);
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+  auto scalars = static_cast<unsigned char*>(image->GetScalarPointer());
+  for (int k = 0; k < size; ++k)
+  {
+    for (int j = 0; j < size; ++j)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        const int d2 = (i - 16) * (i - 16) + (j - 16) * (j - 16) + (k - 16) * (k - 16);
+        *scalars++ = d2 < 100 ? static_cast<unsigned char>(255 - 2 * d2) : 0;
+      }
+    }
+  }
+
+  vtkNew<vtkColorTransferFunction> ctf;
+  ctf->AddRGBPoint(0, 0.0, 0.0, 0.0);
+  ctf->AddRGBPoint(255, 1.0, 0.8, 0.5);
+  vtkNew<vtkPiecewiseFunction> pf;
+  pf->AddPoint(0, 0.0);
+  pf->AddPoint(40, 0.0);
+  pf->AddPoint(255, 0.8);
+  vtkNew<vtkVolumeProperty> volumeProperty;
+  volumeProperty->SetColor(ctf);
+  volumeProperty->SetScalarOpacity(pf);
+  volumeProperty->SetInterpolationTypeToLinear();
+
+  vtkNew<vtkOpenGLGPUVolumeRayCastMapper> mapper;
+  mapper->SetInputData(image);
+  mapper->SetUseJittering(0);
+  mapper->SetPartitions(2, 2, 2);
+  vtkNew<vtkVolume> volume;
+  volume->SetMapper(mapper);
+  volume->SetProperty(volumeProperty);
+
+  vtkNew<vtkRenderer> ren;
+  ren->AddVolume(volume);
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetMultiSamples(0);
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(ren);
+  ren->ResetCamera();
+
+  renWin->Render();
+  if (mapper->GetNumberOfUploadedPartitions() != 8 || mapper->GetNumberOfSkippedPartitions() != 0)
+  {
+    std::cerr << "Expected the 8 partitions to be uploaded, got "
+              << mapper->GetNumberOfUploadedPartitions() << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkSmartPointer<vtkUnsignedCharArray> reference = Capture(renWin);
+
+  // All the partitions fit in the cache and are uploaded once.
+  mapper->SetPartitionCacheSize(2 * size * size * size);
+  renWin->Render();
+  renWin->Render();
+  if (mapper->GetNumberOfUploadedPartitions() != 0)
+  {
+    std::cerr << "Expected the partitions to stay resident, got "
+              << mapper->GetNumberOfUploadedPartitions() << " uploads" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameImages(reference, Capture(renWin)))
+  {
+    std::cerr << "Images differ with the partitions resident" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A cache too small for all the partitions evicts some of them.
+  mapper->SetPartitionCacheSize(3 * 32 * 32 * 32);
+  renWin->Render();
+  renWin->Render();
+  if (mapper->GetNumberOfUploadedPartitions() == 0)
+  {
+    std::cerr << "Expected partitions to be evicted from a small cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameImages(reference, Capture(renWin)))
+  {
+    std::cerr << "Images differ with a small cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Only the partition of the ball is visible through the opacity.
+  mapper->SkipTransparentPartitionsOn();
+  renWin->Render();
+  if (mapper->GetNumberOfSkippedPartitions() != 7)
+  {
+    std::cerr << "Expected 7 transparent partitions, got "
+              << mapper->GetNumberOfSkippedPartitions() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameImages(reference, Capture(renWin)))
+  {
+    std::cerr << "Images differ with the transparent partitions skipped" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // No partition is transparent once the empty space is not.
+  pf->AddPoint(0, 0.05);
+  renWin->Render();
+  if (mapper->GetNumberOfSkippedPartitions() != 0)
+  {
+    std::cerr << "Expected no transparent partition, got "
+              << mapper->GetNumberOfSkippedPartitions() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
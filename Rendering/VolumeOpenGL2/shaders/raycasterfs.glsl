@@ -71,6 +71,8 @@ float g_jitterValue = 0.0;
 
 //VTK::Clipping::Dec
 
+//VTK::EmptySpaceSkipping::Dec
+
 #define EPSILON 0.001
 
 // Computes the intersection between a ray and a box
@@ -296,6 +298,8 @@ vec4 castRay(const float zStart, const float zEnd)
   {
     //VTK::Base::Impl
 
+    //VTK::EmptySpaceSkipping::Impl
+
     //VTK::Cropping::Impl
 
     //VTK::BinaryMask::Impl
@@ -67,6 +67,7 @@
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkPolyDataMapper.h>
+#include <vtkProgressiveRefinementPass.h>
 #include <vtkRectilinearGrid.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderer.h>
@@ -517,6 +518,7 @@ public:
 
   unsigned short Partitions[3];
   vtkMultiVolume* MultiVolume = nullptr;
+  bool EmptySpaceSkipping = false;
 
   std::vector<float> VolMatVec, InvMatVec, TexMatVec, InvTexMatVec, TexEyeMatVec, CellToPointVec,
     TexMinVec, TexMaxVec, ScaleVec, BiasVec, StepVec, SpacingVec, RangeVec;
@@ -2162,6 +2164,12 @@ vtkOpenGLGPUVolumeRayCastMapper::vtkOpenGLGPUVolumeRayCastMapper()
   this->Impl = new vtkInternal(this);
   this->ReductionFactor = 1.0;
   this->CurrentPass = RenderPass;
+  this->PartitionCacheSize = 0;
+  this->SkipTransparentPartitions = false;
+  this->NumberOfSkippedPartitions = 0;
+  this->NumberOfUploadedPartitions = 0;
+  this->UseEmptySpaceSkipping = false;
+  this->NumberOfEmptyCells = 0;
 
   this->ResourceCallback = new vtkOpenGLResourceFreeCallback<vtkOpenGLGPUVolumeRayCastMapper>(
     this, &vtkOpenGLGPUVolumeRayCastMapper::ReleaseGraphicsResources);
@@ -2190,6 +2198,9 @@ void vtkOpenGLGPUVolumeRayCastMapper::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "ReductionFactor: " << this->ReductionFactor << "\n";
   os << indent << "CurrentPass: " << this->CurrentPass << "\n";
+  os << indent << "PartitionCacheSize: " << this->PartitionCacheSize << "\n";
+  os << indent << "SkipTransparentPartitions: " << this->SkipTransparentPartitions << "\n";
+  os << indent << "UseEmptySpaceSkipping: " << this->UseEmptySpaceSkipping << "\n";
 }
 
 void vtkOpenGLGPUVolumeRayCastMapper::SetSharedDepthTexture(vtkTextureObject* nt)
@@ -2600,6 +2611,28 @@ void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderClipping(
     fragmentShader, "//VTK::Clipping::Exit", vtkvolume::ClippingExit(ren, this, vol));
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderEmptySpaceSkipping(
+  std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol,
+  int vtkNotUsed(numComps))
+{
+  vtkShader* fragmentShader = shaders[vtkShader::Fragment];
+
+  // The partitions and the mask are walked in step with the rays, and are
+  // left to their own code.
+  const auto part = this->Impl->Partitions;
+  this->Impl->EmptySpaceSkipping = this->UseEmptySpaceSkipping && !this->Impl->MultiVolume &&
+    this->AssembledInputs.size() == 1 && this->BlendMode == vtkVolumeMapper::COMPOSITE_BLEND &&
+    vol->GetProperty()->GetTransferFunctionMode() == vtkVolumeProperty::TF_1D &&
+    !this->Impl->CurrentMask && part[0] * part[1] * part[2] == 1;
+
+  vtkShaderProgram::Substitute(fragmentShader, "//VTK::EmptySpaceSkipping::Dec",
+    vtkvolume::EmptySpaceSkippingDeclaration(ren, this, vol, this->Impl->EmptySpaceSkipping));
+
+  vtkShaderProgram::Substitute(fragmentShader, "//VTK::EmptySpaceSkipping::Impl",
+    vtkvolume::EmptySpaceSkippingImplementation(ren, this, vol, this->Impl->EmptySpaceSkipping));
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderMasking(
   std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps)
@@ -2754,6 +2787,10 @@ void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderValues(
   //---------------------------------------------------------------------------
   this->ReplaceShaderClipping(shaders, ren, vol, noOfComponents);
 
+  // Empty space skipping replacements
+  //---------------------------------------------------------------------------
+  this->ReplaceShaderEmptySpaceSkipping(shaders, ren, vol, noOfComponents);
+
   // Masking methods replacements
   //---------------------------------------------------------------------------
   this->ReplaceShaderMasking(shaders, ren, vol, noOfComponents);
@@ -3604,6 +3641,8 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::SetMapperShaderParameters(
   {
     vtkOpenGLRenderWindow* win = static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow());
     prog->SetUniformi("in_noiseSampler", win->GetNoiseTextureUnit());
+    // differs for each sample of a progressive refinement
+    prog->SetUniformf("in_noiseOffset", vtkProgressiveRefinementPass::GetNoiseOffset(ren));
   }
 
   prog->SetUniformi("in_noOfComponents", numComp);
@@ -3750,6 +3789,18 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::SetAdvancedShaderParameters(v
     this->SetPickingId(ren);
   }
 
+  // Macro-cells for empty space skipping
+  if (this->EmptySpaceSkipping)
+  {
+    auto volTex = this->Parent->AssembledInputs[0].Texture.GetPointer();
+    volTex->EmptySpaceTex->Activate();
+    prog->SetUniformi("in_emptySpace", volTex->EmptySpaceTex->GetTextureUnit());
+    float gridSize[3];
+    vtkInternal::ToFloat(volTex->EmptySpaceGridSize, gridSize, 3);
+    prog->SetUniform3fv("in_emptySpaceGridSize", 1, &gridSize);
+    prog->SetUniform3fv("in_emptySpaceCellStep", 1, &volTex->EmptySpaceCellStep);
+  }
+
   auto blockExt = block->Extents;
   float fvalue3[3];
   vtkInternal::ToFloat(blockExt[0], blockExt[2], blockExt[4], fvalue3);
@@ -3840,6 +3891,11 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::FinishRendering(const int num
     this->CurrentMask->GetCurrentBlock()->TextureObject->Deactivate();
   }
 
+  if (this->EmptySpaceSkipping)
+  {
+    this->Parent->AssembledInputs[0].Texture->EmptySpaceTex->Deactivate();
+  }
+
   if (numComp == 1 && this->Parent->BlendMode != vtkGPUVolumeRayCastMapper::ADDITIVE_BLEND)
   {
     if (this->Parent->MaskInput != nullptr && this->Parent->MaskType == LabelMapMaskType)
@@ -3917,6 +3973,23 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::RenderSingleInput(
 
   // Sort blocks in case the viewpoint changed, it immediately returns if there
   // is a single block.
+  // Skipping the transparent blocks is only correct when compositing, and
+  // would get the blocks of the mask out of step.
+  vtkVolumeProperty* property = vol->GetProperty();
+  const bool skipTransparent = this->Parent->SkipTransparentPartitions && !this->CurrentMask &&
+    this->Parent->GetBlendMode() == vtkVolumeMapper::COMPOSITE_BLEND &&
+    property->GetTransferFunctionMode() == vtkVolumeProperty::TF_1D;
+  volumeTex->SetBlockCacheSize(this->Parent->PartitionCacheSize);
+  volumeTex->UpdateTransparentBlocks(skipTransparent ? property : nullptr);
+  this->Parent->NumberOfSkippedPartitions = volumeTex->GetNumberOfTransparentBlocks();
+  if (this->EmptySpaceSkipping)
+  {
+    volumeTex->UpdateEmptySpace(property);
+  }
+  this->Parent->NumberOfEmptyCells =
+    this->EmptySpaceSkipping ? volumeTex->GetNumberOfEmptyCells() : 0;
+  const vtkIdType uploads = volumeTex->GetNumberOfBlockUploads();
+
   vol->GetModelToWorldMatrix(this->TempMatrix4x4);
   volumeTex->SortBlocksBackToFront(ren, this->TempMatrix4x4);
   vtkVolumeTexture::VolumeBlock* block = volumeTex->GetCurrentBlock();
@@ -3952,6 +4025,8 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::RenderSingleInput(
       this->CurrentMask->GetNextBlock();
     }
   }
+  this->Parent->NumberOfUploadedPartitions =
+    static_cast<int>(volumeTex->GetNumberOfBlockUploads() - uploads);
 }
 
 //------------------------------------------------------------------------------
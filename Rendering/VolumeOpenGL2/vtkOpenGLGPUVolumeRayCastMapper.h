@@ -143,6 +143,61 @@ public:
    */
   void SetPartitions(unsigned short x, unsigned short y, unsigned short z);
 
+  ///@{
+  /**
+   * Size in bytes of the GPU memory in which the partitions stay resident
+   * between renders, the least recently used ones being evicted when it is
+   * full. This avoids uploading every partition again at every render when
+   * the volume is split to fit in the GPU memory but most of it does.
+   * Default is 0: the partitions are uploaded in turn to a single texture.
+   */
+  vtkSetClampMacro(PartitionCacheSize, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(PartitionCacheSize, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Skip the partitions through which the scalar opacity is null, from the
+   * range of the scalars of each partition computed once per loaded volume.
+   * Only used with the composite blend mode, 1D transfer functions and no
+   * mask. Default is off.
+   */
+  vtkSetMacro(SkipTransparentPartitions, bool);
+  vtkGetMacro(SkipTransparentPartitions, bool);
+  vtkBooleanMacro(SkipTransparentPartitions, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Leap over the regions of the volume through which the scalar opacity is
+   * null. The range of the scalars of each macro-cell of 8^3 voxels is
+   * computed once per loaded volume, and the macro-cells through which the
+   * scalar opacity is null are flagged in a texture updated when the volume
+   * property changes, that the rays consult to leap over them. This speeds
+   * up the rendering of sparse volumes, such as segmentations, but costs a
+   * texture lookup per sample for dense ones. Only used with the composite
+   * blend mode, 1D transfer functions, a single vtkImageData input that is
+   * not partitioned and no mask. Default is off.
+   */
+  vtkSetMacro(UseEmptySpaceSkipping, bool);
+  vtkGetMacro(UseEmptySpaceSkipping, bool);
+  vtkBooleanMacro(UseEmptySpaceSkipping, bool);
+  ///@}
+
+  /**
+   * Number of macro-cells of the volume leaped over by the last render.
+   */
+  vtkGetMacro(NumberOfEmptyCells, vtkIdType);
+
+  ///@{
+  /**
+   * Number of partitions skipped because transparent, and number of
+   * partitions uploaded to the GPU, by the last render.
+   */
+  vtkGetMacro(NumberOfSkippedPartitions, int);
+  vtkGetMacro(NumberOfUploadedPartitions, int);
+  ///@}
+
   /**
    *  Load the volume texture into GPU memory.  Actual loading occurs
    *  in vtkVolumeTexture::LoadVolume.  The mapper by default loads data
@@ -265,6 +320,8 @@ protected:
     std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps);
   void ReplaceShaderClipping(
     std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps);
+  void ReplaceShaderEmptySpaceSkipping(
+    std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps);
   void ReplaceShaderMasking(
     std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps);
   void ReplaceShaderPicking(
@@ -290,6 +347,13 @@ protected:
   double ReductionFactor;
   int CurrentPass;
 
+  vtkIdType PartitionCacheSize;
+  bool SkipTransparentPartitions;
+  int NumberOfSkippedPartitions;
+  int NumberOfUploadedPartitions;
+  bool UseEmptySpaceSkipping;
+  vtkIdType NumberOfEmptyCells;
+
 public:
   using VolumeInput = vtkVolumeInputHelper;
   using VolumeInputMap = std::map<int, vtkVolumeInputHelper>;
@@ -185,7 +185,8 @@ inline std::string BaseDeclarationFragment(vtkRenderer* vtkNotUsed(ren), vtkVolu
   vtkOpenGLGPUVolumeRayCastMapper* glMapper = vtkOpenGLGPUVolumeRayCastMapper::SafeDownCast(mapper);
   if (glMapper->GetUseJittering())
   {
-    toShaderStr << "uniform sampler2D in_noiseSampler;\n";
+    toShaderStr << "uniform sampler2D in_noiseSampler;\n"
+                   "uniform float in_noiseOffset;\n";
   }
 
   // For multiple inputs (numInputs > 1), an additional transformation is
@@ -474,6 +475,8 @@ inline std::string BaseInit(vtkRenderer* vtkNotUsed(ren), vtkVolumeMapper* mappe
       shaderStr << "\
           \n    jitterValue = texture2D(in_noiseSampler, gl_FragCoord.xy /\
                                               vec2(textureSize(in_noiseSampler, 0))).x;\
+          \n    jitterValue += in_noiseOffset;\
+          \n    jitterValue = jitterValue > 1.0 ? jitterValue - 1.0 : jitterValue;\
           \n    g_rayJitter = g_dirStep * jitterValue;\
           \n";
     }
@@ -3641,6 +3644,53 @@ inline std::string ClippingExit(
   return std::string();
 }
 
+//--------------------------------------------------------------------------
+inline std::string EmptySpaceSkippingDeclaration(vtkRenderer* vtkNotUsed(ren),
+  vtkVolumeMapper* vtkNotUsed(mapper), vtkVolume* vtkNotUsed(vol), bool emptySpaceSkipping)
+{
+  if (!emptySpaceSkipping)
+  {
+    return std::string();
+  }
+
+  return std::string("\
+      \nuniform sampler3D in_emptySpace;\
+      \nuniform vec3 in_emptySpaceGridSize;\
+      \nuniform vec3 in_emptySpaceCellStep;");
+}
+
+//--------------------------------------------------------------------------
+inline std::string EmptySpaceSkippingImplementation(vtkRenderer* vtkNotUsed(ren),
+  vtkVolumeMapper* vtkNotUsed(mapper), vtkVolume* vtkNotUsed(vol), bool emptySpaceSkipping)
+{
+  if (!emptySpaceSkipping)
+  {
+    return std::string();
+  }
+
+  return std::string("\
+      \n    // Leap over the samples of a transparent macro-cell: move to the\
+      \n    // last one, which is skipped, the loop then advances past the cell.\
+      \n    vec3 l_emptyCell = floor(g_dataPos / in_emptySpaceCellStep);\
+      \n    if (texture3D(in_emptySpace, (l_emptyCell + 0.5) / in_emptySpaceGridSize).r > 0.0)\
+      \n    {\
+      \n      vec3 l_cellExit = (l_emptyCell + step(0.0, g_dirStep)) * in_emptySpaceCellStep;\
+      \n      vec3 l_exitSteps = vec3(1.0e30);\
+      \n      for (int i = 0; i < 3; ++i)\
+      \n      {\
+      \n        if (g_dirStep[i] != 0.0)\
+      \n        {\
+      \n          l_exitSteps[i] = (l_cellExit[i] - g_dataPos[i]) / g_dirStep[i];\
+      \n        }\
+      \n      }\
+      \n      float l_exit = min(l_exitSteps.x, min(l_exitSteps.y, l_exitSteps.z));\
+      \n      float l_leap = max(ceil(l_exit) - 1.0, 0.0);\
+      \n      g_dataPos += l_leap * g_dirStep;\
+      \n      g_currentT += l_leap;\
+      \n      g_skip = true;\
+      \n    }");
+}
+
 //--------------------------------------------------------------------------
 inline std::string BinaryMaskDeclaration(vtkRenderer* vtkNotUsed(ren),
   vtkVolumeMapper* vtkNotUsed(mapper), vtkVolume* vtkNotUsed(vol), vtkImageData* maskInput,
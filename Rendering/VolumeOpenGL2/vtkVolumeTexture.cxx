@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <limits>
 
+#include "vtkArrayDispatch.h"
 #include "vtkBlockSortHelper.h"
 #include "vtkCamera.h"
 #include "vtkDataArray.h"
@@ -11,8 +13,10 @@
 #include "vtkNew.h"
 #include "vtkOpenGLRenderWindow.h"
 #include "vtkOpenGLState.h"
+#include "vtkPiecewiseFunction.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRenderer.h"
+#include "vtkSMPTools.h"
 #include "vtkTextureObject.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -20,6 +24,118 @@
 #include "vtkVolumeTexture.h"
 #include "vtk_glew.h"
 
+namespace
+{
+// Compute the range of each component of the scalars of the texels in ext of
+// a texture whose first texel is the tuple base.
+template <typename TupleRangeT, typename RangeT>
+void ComputeTexelRange(const TupleRangeT& tuples, vtkIdType base, vtkIdType sizeX,
+  vtkIdType sizeXY, const int ext[6], int numComps, RangeT (*range)[2])
+{
+  for (int c = 0; c < numComps; ++c)
+  {
+    range[c][0] = std::numeric_limits<RangeT>::max();
+    range[c][1] = std::numeric_limits<RangeT>::lowest();
+  }
+  for (int k = ext[4]; k <= ext[5]; ++k)
+  {
+    for (int j = ext[2]; j <= ext[3]; ++j)
+    {
+      vtkIdType tupleIdx = base + k * sizeXY + j * sizeX + ext[0];
+      for (int i = ext[0]; i <= ext[1]; ++i, ++tupleIdx)
+      {
+        const auto tuple = tuples[tupleIdx];
+        for (int c = 0; c < numComps; ++c)
+        {
+          const RangeT value = static_cast<RangeT>(tuple[c]);
+          range[c][0] = std::min(range[c][0], value);
+          range[c][1] = std::max(range[c][1], value);
+        }
+      }
+    }
+  }
+}
+
+// Compute the range of each component of the scalars of the blocks
+struct BlockScalarRangeWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const std::vector<vtkVolumeTexture::VolumeBlock*>& blocks,
+    vtkIdType sizeX, vtkIdType sizeXY)
+  {
+    const auto tuples = vtk::DataArrayTupleRange(array);
+    const int numComps = std::min(static_cast<int>(tuples.GetTupleSize()), 4);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(blocks.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType b = begin; b < end; ++b)
+      {
+        vtkVolumeTexture::VolumeBlock* block = blocks[b];
+        const int ext[6] = { 0, block->TextureSize[0] - 1, 0, block->TextureSize[1] - 1, 0,
+          block->TextureSize[2] - 1 };
+        ComputeTexelRange(
+          tuples, block->TupleIndex, sizeX, sizeXY, ext, numComps, block->ScalarRange);
+      }
+    });
+  }
+};
+
+// Compute the range of each component of the scalars of the macro-cells of
+// cellSize^3 texels of a texture, widened by a texel on each side since the
+// texels of the neighboring macro-cells are interpolated near the faces.
+struct EmptySpaceRangeWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const int texSize[3], int cellSize, const int grid[3],
+    vtkIdType sizeX, vtkIdType sizeXY, std::vector<float>& ranges)
+  {
+    const auto tuples = vtk::DataArrayTupleRange(array);
+    const int numComps = static_cast<int>(tuples.GetTupleSize());
+    ranges.resize(static_cast<size_t>(grid[0]) * grid[1] * grid[2] * numComps * 2);
+    vtkSMPTools::For(0, grid[2], [&](vtkIdType begin, vtkIdType end) {
+      for (int k = static_cast<int>(begin); k < end; ++k)
+      {
+        for (int j = 0; j < grid[1]; ++j)
+        {
+          for (int i = 0; i < grid[0]; ++i)
+          {
+            const int cell[3] = { i, j, k };
+            int ext[6];
+            for (int d = 0; d < 3; ++d)
+            {
+              ext[2 * d] = std::max(cell[d] * cellSize - 1, 0);
+              ext[2 * d + 1] = std::min((cell[d] + 1) * cellSize, texSize[d] - 1);
+            }
+            const size_t cellIdx = (static_cast<size_t>(k) * grid[1] + j) * grid[0] + i;
+            ComputeTexelRange(tuples, 0, sizeX, sizeXY, ext, numComps,
+              reinterpret_cast<float(*)[2]>(&ranges[cellIdx * numComps * 2]));
+          }
+        }
+      }
+    });
+  }
+};
+
+// Return true if the opacity is null over [low, high]. Between two nodes the
+// function is monotonic, whatever their midpoint and sharpness, so that it is
+// enough to check its values at the bounds and at the nodes in between.
+bool IsOpacityNull(vtkPiecewiseFunction* opacity, double low, double high)
+{
+  if (opacity->GetSize() == 0 || opacity->GetValue(low) > 0.0 || opacity->GetValue(high) > 0.0)
+  {
+    return false;
+  }
+  double node[4];
+  for (int i = 0; i < opacity->GetSize(); ++i)
+  {
+    opacity->GetNodeValue(i, node);
+    if (node[0] > low && node[0] < high && node[1] > 0.0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkVolumeTexture::vtkVolumeTexture()
   : HandleLargeDataTypes(false)
@@ -27,8 +143,18 @@ vtkVolumeTexture::vtkVolumeTexture()
   , Texture(nullptr)
   , CurrentBlockIdx(0)
   , StreamBlocks(false)
+  , BlockCacheSize(0)
+  , CachedBytes(0)
+  , NumberOfBlockUploads(0)
+  , BlockScalarRangesComputed(false)
+  , NumberOfTransparentBlocks(0)
+  , EmptySpaceRangesComputed(false)
+  , EmptySpaceProperty(nullptr)
+  , NumberOfEmptyCells(0)
   , Scalars(nullptr)
 {
+  this->EmptySpaceGridSize[0] = this->EmptySpaceGridSize[1] = this->EmptySpaceGridSize[2] = 1;
+  this->EmptySpaceCellStep[0] = this->EmptySpaceCellStep[1] = this->EmptySpaceCellStep[2] = 1.f;
   this->Partitions[0] = this->Partitions[1] = this->Partitions[2] = 1;
 
   this->ScalarRange[0][0] = this->ScalarRange[0][1] = 0.f;
@@ -177,12 +303,23 @@ void vtkVolumeTexture::SetInterpolation(int interpolation)
     this->Texture->SetMagnificationFilter(interpolation);
     this->Texture->SetMinificationFilter(interpolation);
   }
+
+  for (VolumeBlock* block : this->CachedBlocks)
+  {
+    block->CachedTexture->SetMagnificationFilter(interpolation);
+    block->CachedTexture->SetMinificationFilter(interpolation);
+  }
 }
 
 //------------------------------------------------------------------------------
 vtkVolumeTexture::VolumeBlock* vtkVolumeTexture::GetNextBlock()
 {
   this->CurrentBlockIdx++;
+  while (this->CurrentBlockIdx < this->SortedVolumeBlocks.size() &&
+    this->SortedVolumeBlocks[this->CurrentBlockIdx]->Transparent)
+  {
+    this->CurrentBlockIdx++;
+  }
   // All blocks were already rendered
   if (this->SortedVolumeBlocks.size() <= this->CurrentBlockIdx)
   {
@@ -194,7 +331,7 @@ vtkVolumeTexture::VolumeBlock* vtkVolumeTexture::GetNextBlock()
   // Load current block
   if (this->StreamBlocks)
   {
-    this->LoadTexture(this->InterpolationType, block);
+    this->LoadBlock(block);
   }
 
   return block;
@@ -564,13 +701,255 @@ bool vtkVolumeTexture::LoadTexture(int interpolation, VolumeBlock* volBlock)
 
   texture->Deactivate();
   this->UploadTime.Modified();
+  this->NumberOfBlockUploads++;
 
   return success;
 }
 
+//------------------------------------------------------------------------------
+bool vtkVolumeTexture::LoadBlock(VolumeBlock* volBlock)
+{
+  if (volBlock->CachedTexture)
+  {
+    // Resident block, only mark it as the most recently used. UploadTime is
+    // still modified, as it tells the mapper to update the geometry of the
+    // block to render.
+    this->CachedBlocks.remove(volBlock);
+    this->CachedBlocks.push_front(volBlock);
+    this->UploadTime.Modified();
+    return true;
+  }
+
+  // The blanking texture is shared by the blocks, which are then uploaded
+  // again with it at every render.
+  vtkIdType const blockBytes = this->GetBlockBytes(volBlock);
+  if (blockBytes > this->BlockCacheSize || this->BlankingTex)
+  {
+    volBlock->TextureObject = this->Texture;
+    return this->LoadTexture(this->InterpolationType, volBlock);
+  }
+
+  while (!this->CachedBlocks.empty() && this->CachedBytes + blockBytes > this->BlockCacheSize)
+  {
+    VolumeBlock* evicted = this->CachedBlocks.back();
+    this->CachedBlocks.pop_back();
+    this->CachedBytes -= this->GetBlockBytes(evicted);
+    evicted->CachedTexture = nullptr;
+    evicted->TextureObject = this->Texture;
+  }
+
+  int const noOfComponents = this->Scalars->GetNumberOfComponents();
+  int const scalarType = this->Scalars->GetDataType();
+  vtkNew<vtkTextureObject> texture;
+  texture->SetContext(this->Texture->GetContext());
+  texture->SetFormat(this->Texture->GetFormat(scalarType, noOfComponents, false));
+  texture->SetInternalFormat(this->Texture->GetInternalFormat(scalarType, noOfComponents, false));
+  texture->SetDataType(this->Texture->GetDataType(scalarType));
+  volBlock->TextureObject = texture;
+  if (!this->LoadTexture(this->InterpolationType, volBlock))
+  {
+    volBlock->TextureObject = this->Texture;
+    return false;
+  }
+
+  volBlock->CachedTexture = texture.GetPointer();
+  this->CachedBlocks.push_front(volBlock);
+  this->CachedBytes += blockBytes;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkVolumeTexture::GetBlockBytes(VolumeBlock* volBlock)
+{
+  vtkIdType const componentBytes =
+    this->HandleLargeDataTypes ? sizeof(float) : this->Scalars->GetDataTypeSize();
+  return static_cast<vtkIdType>(volBlock->TextureSize[0]) * volBlock->TextureSize[1] *
+    volBlock->TextureSize[2] * this->Scalars->GetNumberOfComponents() * componentBytes;
+}
+
+//------------------------------------------------------------------------------
+void vtkVolumeTexture::SetBlockCacheSize(vtkIdType size)
+{
+  if (this->BlockCacheSize == size)
+  {
+    return;
+  }
+  this->BlockCacheSize = size;
+  if (this->CachedBytes > size)
+  {
+    this->ClearBlockCache();
+  }
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkVolumeTexture::ClearBlockCache()
+{
+  for (VolumeBlock* block : this->CachedBlocks)
+  {
+    block->CachedTexture = nullptr;
+    block->TextureObject = this->Texture;
+  }
+  this->CachedBlocks.clear();
+  this->CachedBytes = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkVolumeTexture::ComputeBlockScalarRanges()
+{
+  std::vector<VolumeBlock*> blocks;
+  blocks.reserve(this->ImageDataBlockMap.size());
+  for (const auto& item : this->ImageDataBlockMap)
+  {
+    blocks.push_back(item.second);
+  }
+
+  // Same layout as the one used to upload the blocks in LoadTexture()
+  vtkIdType const sizeX = this->FullSize[0];
+  vtkIdType const sizeXY = sizeX * this->FullSize[1];
+  BlockScalarRangeWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(this->Scalars, worker, blocks, sizeX, sizeXY))
+  {
+    worker(this->Scalars, blocks, sizeX, sizeXY);
+  }
+  this->BlockScalarRangesComputed = true;
+}
+
+//------------------------------------------------------------------------------
+void vtkVolumeTexture::UpdateTransparentBlocks(vtkVolumeProperty* property)
+{
+  this->NumberOfTransparentBlocks = 0;
+
+  int const noOfComponents = this->Scalars ? this->Scalars->GetNumberOfComponents() : 0;
+  bool const skip = property && this->StreamBlocks && this->ImageDataBlockMap.size() > 1 &&
+    noOfComponents > 0 && noOfComponents <= 4 &&
+    (noOfComponents == 1 || property->GetIndependentComponents());
+  if (skip && !this->BlockScalarRangesComputed)
+  {
+    this->ComputeBlockScalarRanges();
+  }
+
+  for (const auto& item : this->ImageDataBlockMap)
+  {
+    VolumeBlock* block = item.second;
+    bool transparent = skip;
+    for (int c = 0; transparent && c < noOfComponents; ++c)
+    {
+      // Widen the range of the block by a texel of the lookup table of the
+      // opacity, which is interpolated on the GPU.
+      vtkPiecewiseFunction* opacity = property->GetScalarOpacity(c);
+      double const margin = (this->ScalarRange[c][1] - this->ScalarRange[c][0]) / 1024.0;
+      transparent = opacity->GetClamping() &&
+        IsOpacityNull(
+          opacity, block->ScalarRange[c][0] - margin, block->ScalarRange[c][1] + margin);
+    }
+    block->Transparent = transparent;
+    this->NumberOfTransparentBlocks += transparent ? 1 : 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkVolumeTexture::UpdateEmptySpace(vtkVolumeProperty* property)
+{
+  int const noOfComponents = this->Scalars ? this->Scalars->GetNumberOfComponents() : 0;
+  bool supported = property && !this->StreamBlocks && this->ImageDataBlocks.size() == 1 &&
+    vtkImageData::SafeDownCast(this->ImageDataBlocks[0]) && noOfComponents > 0 &&
+    noOfComponents <= 4 && (noOfComponents == 1 || property->GetIndependentComponents());
+  for (int c = 0; supported && c < noOfComponents; ++c)
+  {
+    supported = property->GetScalarOpacity(c)->GetClamping();
+  }
+  if (!supported)
+  {
+    property = nullptr;
+  }
+
+  if (this->EmptySpaceTex && this->EmptySpaceRangesComputed == supported &&
+    property == this->EmptySpaceProperty &&
+    (!property || property->GetMTime() <= this->EmptySpaceUploadTime.GetMTime()))
+  {
+    return;
+  }
+
+  if (!this->EmptySpaceTex)
+  {
+    this->EmptySpaceTex = vtkSmartPointer<vtkTextureObject>::New();
+    this->EmptySpaceTex->SetContext(this->Texture->GetContext());
+  }
+
+  VolumeBlock* block = supported ? this->SortedVolumeBlocks[0] : nullptr;
+  int const cellSize = vtkVolumeTexture::EmptySpaceCellSize;
+  for (int d = 0; d < 3; ++d)
+  {
+    int const texSize = block ? block->TextureSize[d] : 1;
+    this->EmptySpaceGridSize[d] = block ? (texSize + cellSize - 1) / cellSize : 1;
+    this->EmptySpaceCellStep[d] = block ? static_cast<float>(cellSize) / texSize : 1.f;
+  }
+  if (supported && !this->EmptySpaceRangesComputed)
+  {
+    // Same layout as the one used to upload the block in LoadTexture()
+    int const texSize[3] = { block->TextureSize[0], block->TextureSize[1],
+      block->TextureSize[2] };
+    vtkIdType const sizeX = this->FullSize[0];
+    vtkIdType const sizeXY = sizeX * this->FullSize[1];
+    EmptySpaceRangeWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(this->Scalars, worker, texSize, cellSize,
+          this->EmptySpaceGridSize, sizeX, sizeXY, this->EmptySpaceRanges))
+    {
+      worker(this->Scalars, texSize, cellSize, this->EmptySpaceGridSize, sizeX, sizeXY,
+        this->EmptySpaceRanges);
+    }
+  }
+  this->EmptySpaceRangesComputed = supported;
+
+  vtkIdType const numCells = static_cast<vtkIdType>(this->EmptySpaceGridSize[0]) *
+    this->EmptySpaceGridSize[1] * this->EmptySpaceGridSize[2];
+  std::vector<unsigned char> empty(numCells, 0);
+  this->NumberOfEmptyCells = 0;
+  if (supported)
+  {
+    for (vtkIdType cell = 0; cell < numCells; ++cell)
+    {
+      bool transparent = true;
+      for (int c = 0; transparent && c < noOfComponents; ++c)
+      {
+        // Widen the range by a texel of the lookup table of the opacity
+        float const* range = &this->EmptySpaceRanges[(cell * noOfComponents + c) * 2];
+        double const margin = (this->ScalarRange[c][1] - this->ScalarRange[c][0]) / 1024.0;
+        transparent =
+          IsOpacityNull(property->GetScalarOpacity(c), range[0] - margin, range[1] + margin);
+      }
+      empty[cell] = transparent ? 255 : 0;
+      this->NumberOfEmptyCells += transparent ? 1 : 0;
+    }
+  }
+
+  this->EmptySpaceTex->Create3DFromRaw(this->EmptySpaceGridSize[0], this->EmptySpaceGridSize[1],
+    this->EmptySpaceGridSize[2], 1, VTK_UNSIGNED_CHAR, empty.data());
+  this->EmptySpaceTex->SetWrapS(vtkTextureObject::ClampToEdge);
+  this->EmptySpaceTex->SetWrapT(vtkTextureObject::ClampToEdge);
+  this->EmptySpaceTex->SetWrapR(vtkTextureObject::ClampToEdge);
+  this->EmptySpaceTex->SetMagnificationFilter(vtkTextureObject::Nearest);
+  this->EmptySpaceTex->SetMinificationFilter(vtkTextureObject::Nearest);
+  this->EmptySpaceProperty = property;
+  this->EmptySpaceUploadTime.Modified();
+}
+
 //------------------------------------------------------------------------------
 void vtkVolumeTexture::ReleaseGraphicsResources(vtkWindow* win)
 {
+  for (VolumeBlock* block : this->CachedBlocks)
+  {
+    block->CachedTexture->ReleaseGraphicsResources(win);
+  }
+  this->ClearBlockCache();
+
+  if (this->EmptySpaceTex)
+  {
+    this->EmptySpaceTex->ReleaseGraphicsResources(win);
+    this->EmptySpaceTex = nullptr;
+  }
+
   if (this->Texture)
   {
     this->Texture->ReleaseGraphicsResources(win);
@@ -586,6 +965,15 @@ void vtkVolumeTexture::ClearBlocks()
     return;
   }
 
+  this->ClearBlockCache();
+  this->BlockScalarRangesComputed = false;
+  this->NumberOfTransparentBlocks = 0;
+  this->EmptySpaceTex = nullptr;
+  this->EmptySpaceRanges.clear();
+  this->EmptySpaceRangesComputed = false;
+  this->EmptySpaceProperty = nullptr;
+  this->NumberOfEmptyCells = 0;
+
   size_t const numBlocks = this->ImageDataBlocks.size();
   for (size_t i = 0; i < numBlocks; i++)
   {
@@ -870,9 +1258,14 @@ void vtkVolumeTexture::SortBlocksBackToFront(vtkRenderer* ren, vtkMatrix4x4* vol
       this->SortedVolumeBlocks.push_back(this->ImageDataBlockMap[this->ImageDataBlocks[i]]);
     }
 
-    // Load the first block
-    auto firstBlock = this->SortedVolumeBlocks.at(0);
-    this->LoadTexture(this->InterpolationType, firstBlock);
+    // Load the first block which is not transparent, or the last one
+    this->CurrentBlockIdx = 0;
+    while (this->CurrentBlockIdx + 1 < numBlocks &&
+      this->SortedVolumeBlocks[this->CurrentBlockIdx]->Transparent)
+    {
+      this->CurrentBlockIdx++;
+    }
+    this->LoadBlock(this->SortedVolumeBlocks[this->CurrentBlockIdx]);
   }
 }
 
@@ -917,6 +1310,8 @@ void vtkVolumeTexture::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "UploadTime: " << this->UploadTime << '\n';
   os << indent << "CurrentBlockIdx: " << this->CurrentBlockIdx << '\n';
   os << indent << "StreamBlocks: " << this->StreamBlocks << '\n';
+  os << indent << "BlockCacheSize: " << this->BlockCacheSize << '\n';
+  os << indent << "NumberOfBlockUploads: " << this->NumberOfBlockUploads << '\n';
 }
 
 //------------------------------------------------------------------------------
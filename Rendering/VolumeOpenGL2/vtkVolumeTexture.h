@@ -64,6 +64,7 @@
 
 #ifndef vtkVolumeTexture_h
 #define vtkVolumeTexture_h
+#include <list>   // For CachedBlocks
 #include <map>    // For ImageDataBlockMap
 #include <vector> // For ImageDataBlocks
 
@@ -101,6 +102,7 @@ public:
       TextureObject = tex;
       TextureSize = texSize;
       TupleIndex = 0;
+      Transparent = false;
 
       this->Extents[0] = VTK_INT_MAX;
       this->Extents[1] = VTK_INT_MIN;
@@ -128,6 +130,23 @@ public:
     double LoadedBoundsAA[6];
     double VolumeGeometry[24];
     int Extents[6];
+
+    /**
+     * Range of each component of the scalars of the block, computed when
+     * transparent blocks are first looked for.
+     */
+    double ScalarRange[4][2];
+
+    /**
+     * True when the scalar opacity is null over the range of the block, in
+     * which case GetNextBlock() skips it.
+     */
+    bool Transparent;
+
+    /**
+     * Texture of the block while it stays resident in the block cache.
+     */
+    vtkSmartPointer<vtkTextureObject> CachedTexture;
   };
 
   vtkTypeMacro(vtkVolumeTexture, vtkObject);
@@ -160,6 +179,56 @@ public:
    */
   void SortBlocksBackToFront(vtkRenderer* ren, vtkMatrix4x4* volumeMat);
 
+  ///@{
+  /**
+   * Size in bytes of the GPU memory used to keep streamed blocks resident
+   * between renders. Blocks are uploaded once and stay in their own texture
+   * until the least recently used ones are evicted to make room for others,
+   * instead of being uploaded again to a single texture at every render.
+   * Default is 0, which disables the cache. Only used when streaming blocks
+   * without blanking.
+   */
+  void SetBlockCacheSize(vtkIdType size);
+  vtkIdType GetBlockCacheSize() { return this->BlockCacheSize; }
+  ///@}
+
+  /**
+   * Number of block textures uploaded to the GPU so far.
+   */
+  vtkIdType GetNumberOfBlockUploads() { return this->NumberOfBlockUploads; }
+
+  /**
+   * Flag the streamed blocks through which the scalar opacity of \p property
+   * is null, so that GetNextBlock() and SortBlocksBackToFront() skip them,
+   * which is only correct when compositing. The range of the scalars of each
+   * block is computed at the first call after the volume is loaded. Passing
+   * nullptr, dependent components or a scalar opacity without clamping
+   * clears the flags.
+   */
+  void UpdateTransparentBlocks(vtkVolumeProperty* property);
+
+  /**
+   * Number of blocks flagged by the last UpdateTransparentBlocks().
+   */
+  int GetNumberOfTransparentBlocks() { return this->NumberOfTransparentBlocks; }
+
+  /**
+   * Update EmptySpaceTex, a grid of macro-cells of EmptySpaceCellSize^3 texels
+   * of the volume set to 1 where the scalar opacity of \p property is null
+   * over the range of the scalars of the macro-cell, so that the rays leap
+   * over it. The ranges are computed at the first call after the volume is
+   * loaded, and the grid is uploaded again when \p property changes. No
+   * macro-cell is set when \p property is nullptr, when the volume is split
+   * in blocks, is not a vtkImageData or has dependent components, or when the
+   * scalar opacity does not clamp. Requires an active OpenGL context.
+   */
+  void UpdateEmptySpace(vtkVolumeProperty* property);
+
+  /**
+   * Number of macro-cells set in EmptySpaceTex by the last upload.
+   */
+  vtkIdType GetNumberOfEmptyCells() { return this->NumberOfEmptyCells; }
+
   /**
    * Return the next volume block to be rendered and load its data.  If the
    * current block is the last one, it will return nullptr.
@@ -205,6 +274,11 @@ public:
 
   vtkSmartPointer<vtkTextureObject> BlankingTex;
 
+  vtkSmartPointer<vtkTextureObject> EmptySpaceTex;
+  static const int EmptySpaceCellSize = 8;
+  int EmptySpaceGridSize[3];
+  float EmptySpaceCellStep[3]; // size of a macro-cell in texture coordinates
+
 protected:
   vtkVolumeTexture();
   ~vtkVolumeTexture() override;
@@ -219,6 +293,28 @@ private:
    */
   bool LoadTexture(int interpolation, VolumeBlock* volBlock);
 
+  /**
+   * Make the texture of a streamed block current: reuse it if resident in the
+   * block cache, upload it otherwise, evicting the least recently used blocks
+   * beyond BlockCacheSize.
+   */
+  bool LoadBlock(VolumeBlock* volBlock);
+
+  /**
+   * Size in bytes of the texture of a block.
+   */
+  vtkIdType GetBlockBytes(VolumeBlock* volBlock);
+
+  /**
+   * Release the textures of the blocks resident in the block cache.
+   */
+  void ClearBlockCache();
+
+  /**
+   * Compute the range of the scalars of each block.
+   */
+  void ComputeBlockScalarRanges();
+
   /**
    * Divide the image data in NxMxO user-defined blocks.
    */
@@ -296,6 +392,19 @@ private:
   size_t CurrentBlockIdx;
   bool StreamBlocks;
 
+  vtkIdType BlockCacheSize;
+  vtkIdType CachedBytes;
+  std::list<VolumeBlock*> CachedBlocks; // most recently used first
+  vtkIdType NumberOfBlockUploads;
+  bool BlockScalarRangesComputed;
+  int NumberOfTransparentBlocks;
+
+  std::vector<float> EmptySpaceRanges; // [min, max] per component per macro-cell
+  bool EmptySpaceRangesComputed;
+  vtkVolumeProperty* EmptySpaceProperty;
+  vtkTimeStamp EmptySpaceUploadTime;
+  vtkIdType NumberOfEmptyCells;
+
   std::vector<Size3> TextureSizes;
   Size6 FullExtent;
   Size3 FullSize;
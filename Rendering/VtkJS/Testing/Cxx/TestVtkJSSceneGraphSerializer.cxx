@@ -0,0 +1,206 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestVtkJSSceneGraphSerializer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the data arrays listed by vtkVtkJSSceneGraphSerializer when a scene
+// is synchronized several times with IncrementalDataArrays on: a
+// synchronization only lists the arrays that were not listed before, while
+// the scene description still references all of them.
+
+#include "vtkActor.h"
+#include "vtkConeSource.h"
+#include "vtkNew.h"
+#include "vtkPolyDataMapper.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSphereSource.h"
+#include "vtkViewNode.h"
+#include "vtkVtkJSSceneGraphSerializer.h"
+#include "vtkVtkJSViewNodeFactory.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+
+namespace
+{
+// Traverse the scene graph of the window as vtkJSONRenderWindowExporter does
+void Synchronize(vtkVtkJSViewNodeFactory* factory, vtkRenderWindow* window)
+{
+  factory->GetSerializer()->Reset();
+  vtkViewNode* node = factory->CreateNode(window);
+  node->Traverse(vtkViewNode::build);
+  node->Traverse(vtkViewNode::synchronize);
+  node->Traverse(vtkViewNode::render);
+  node->Delete();
+}
+
+// Hashes of the non-null data arrays listed by the serializer
+std::set<std::string> ListedArrays(vtkVtkJSSceneGraphSerializer* serializer)
+{
+  std::set<std::string> hashes;
+  for (vtkIdType i = 0; i < serializer->GetNumberOfDataArrays(); ++i)
+  {
+    if (serializer->GetDataArray(i))
+    {
+      hashes.insert(serializer->GetDataArrayId(i));
+    }
+  }
+  return hashes;
+}
+
+// Hashes of the data arrays referenced by the scene description
+void ReferencedArrays(const Json::Value& value, std::set<std::string>& hashes)
+{
+  if (value.isObject())
+  {
+    if (value.isMember("hash") && value["vtkClass"].isString())
+    {
+      hashes.insert(value["hash"].asString());
+    }
+    for (const auto& name : value.getMemberNames())
+    {
+      ReferencedArrays(value[name], hashes);
+    }
+  }
+  else if (value.isArray())
+  {
+    for (const auto& item : value)
+    {
+      ReferencedArrays(item, hashes);
+    }
+  }
+}
+
+std::set<std::string> ReferencedArrays(vtkVtkJSSceneGraphSerializer* serializer)
+{
+  std::set<std::string> hashes;
+  ReferencedArrays(serializer->GetRoot(), hashes);
+  return hashes;
+}
+
+bool CheckArrays(const char* step, vtkVtkJSSceneGraphSerializer* serializer,
+  const std::set<std::string>& expected, std::size_t expectedReferences)
+{
+  const std::set<std::string> listed = ListedArrays(serializer);
+  const std::set<std::string> referenced = ReferencedArrays(serializer);
+  // An array is listed at most once when the listing is incremental
+  const bool duplicates = serializer->GetIncrementalDataArrays() &&
+    listed.size() != static_cast<std::size_t>(serializer->GetNumberOfDataArrays());
+  if (duplicates || listed != expected || referenced.size() != expectedReferences)
+  {
+    std::cerr << step << ": " << serializer->GetNumberOfDataArrays() << " arrays listed instead of "
+              << expected.size() << ", " << referenced.size() << " referenced instead of "
+              << expectedReferences << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestVtkJSSceneGraphSerializer(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkPolyDataMapper> sphereMapper;
+  sphereMapper->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkActor> sphereActor;
+  sphereActor->SetMapper(sphereMapper);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(sphereActor);
+  vtkNew<vtkRenderWindow> window;
+  window->AddRenderer(renderer);
+
+  vtkNew<vtkVtkJSViewNodeFactory> factory;
+  vtkVtkJSSceneGraphSerializer* serializer = factory->GetSerializer();
+  if (serializer->GetIncrementalDataArrays())
+  {
+    std::cerr << "IncrementalDataArrays is not off by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+  serializer->IncrementalDataArraysOn();
+
+  // The first synchronization lists all the arrays of the sphere
+  Synchronize(factory, window);
+  const std::set<std::string> sphereArrays = ReferencedArrays(serializer);
+  if (sphereArrays.empty() || !CheckArrays("First", serializer, sphereArrays, sphereArrays.size()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Nothing is new in the same scene, but it still references the sphere
+  Synchronize(factory, window);
+  if (!CheckArrays("Unchanged", serializer, {}, sphereArrays.size()) ||
+    ReferencedArrays(serializer) != sphereArrays)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Only the arrays of an added cone are listed
+  vtkNew<vtkConeSource> cone;
+  vtkNew<vtkPolyDataMapper> coneMapper;
+  coneMapper->SetInputConnection(cone->GetOutputPort());
+  vtkNew<vtkActor> coneActor;
+  coneActor->SetMapper(coneMapper);
+  renderer->AddActor(coneActor);
+  Synchronize(factory, window);
+  std::set<std::string> allArrays = ReferencedArrays(serializer);
+  std::set<std::string> coneArrays;
+  for (const std::string& hash : allArrays)
+  {
+    if (!sphereArrays.count(hash))
+    {
+      coneArrays.insert(hash);
+    }
+  }
+  if (coneArrays.empty() || !CheckArrays("Cone", serializer, coneArrays, allArrays.size()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Modified arrays are new arrays
+  sphere->SetThetaResolution(16);
+  Synchronize(factory, window);
+  std::set<std::string> modifiedArrays;
+  for (const std::string& hash : ReferencedArrays(serializer))
+  {
+    if (!allArrays.count(hash))
+    {
+      modifiedArrays.insert(hash);
+    }
+  }
+  allArrays = ReferencedArrays(serializer);
+  if (modifiedArrays.empty() ||
+    !CheckArrays("Modified", serializer, modifiedArrays, allArrays.size()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // All the arrays are listed again for a client that holds none
+  serializer->ClearSentDataArrays();
+  Synchronize(factory, window);
+  if (!CheckArrays("Cleared", serializer, allArrays, allArrays.size()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // and at each synchronization when the option is off
+  serializer->IncrementalDataArraysOff();
+  Synchronize(factory, window);
+  if (!CheckArrays("Not incremental", serializer, allArrays, allArrays.size()))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -50,6 +50,7 @@
 #include <ios>
 #include <sstream>
 #include <unordered_map>
+#include <unordered_set>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -131,6 +132,16 @@ struct vtkVtkJSSceneGraphSerializer::Internal
   std::vector<std::pair<Json::ArrayIndex, vtkDataObject*>> DataObjects;
   std::vector<std::pair<std::string, vtkDataArray*>> DataArrays;
 
+  // Hashes of the arrays of the current and of the previous synchronization,
+  // with the modification time they were computed at, so that unchanged
+  // arrays are not hashed again.
+  using HashCache = std::unordered_map<vtkDataArray*, std::pair<vtkMTimeType, std::string>>;
+  HashCache ArrayHashes;
+  HashCache PreviousArrayHashes;
+
+  // Hashes of the arrays listed in DataArrays since the last ClearSentDataArrays()
+  std::unordered_set<std::string> SentDataArrays;
+
   Json::Value* entry(const std::string& index, Json::Value* node);
   Json::Value* entry(const Json::ArrayIndex index) { return entry(std::to_string(index), &Root); }
   Json::Value* entry(void* address) { return entry(UniqueIds.at(address)); }
@@ -209,6 +220,14 @@ void vtkVtkJSSceneGraphSerializer::Reset()
   this->Internals->UniqueIdCount = 0;
   this->Internals->DataObjects.clear();
   this->Internals->DataArrays.clear();
+  std::swap(this->Internals->PreviousArrayHashes, this->Internals->ArrayHashes);
+  this->Internals->ArrayHashes.clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkVtkJSSceneGraphSerializer::ClearSentDataArrays()
+{
+  this->Internals->SentDataArrays.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -602,12 +621,34 @@ Json::Value vtkVtkJSSceneGraphSerializer::ToJson(vtkDataArray* array)
 {
   Json::Value val;
   std::string hash;
+  auto& hashes = this->Internals->ArrayHashes;
+  auto cached = hashes.find(array);
+  if (cached == hashes.end())
+  {
+    // An array deleted since its hash was computed cannot be mistaken for a
+    // new array at the same address, as their modification times differ.
+    auto previous = this->Internals->PreviousArrayHashes.find(array);
+    if (previous != this->Internals->PreviousArrayHashes.end() &&
+      previous->second.first == array->GetMTime())
+    {
+      cached = hashes.insert(*previous).first;
+    }
+  }
+  if (cached != hashes.end() && cached->second.first == array->GetMTime())
+  {
+    hash = cached->second.second;
+  }
+  else
   {
     const unsigned char* content = (const unsigned char*)array->GetVoidPointer(0);
     int size = array->GetNumberOfValues() * array->GetDataTypeSize();
     computeMD5(content, size, hash);
+    hashes[array] = std::make_pair(array->GetMTime(), hash);
+  }
+  if (!this->IncrementalDataArrays || this->Internals->SentDataArrays.insert(hash).second)
+  {
+    this->Internals->DataArrays.emplace_back(hash, array);
   }
-  this->Internals->DataArrays.emplace_back(hash, array);
   val["hash"] = hash;
   val["vtkClass"] = "vtkDataArray";
   val["name"] = array->GetName() ? array->GetName() : Json::Value();
@@ -1206,5 +1247,7 @@ void vtkVtkJSSceneGraphSerializer::extractRequiredFields(
 void vtkVtkJSSceneGraphSerializer::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "IncrementalDataArrays: " << (this->IncrementalDataArrays ? "On" : "Off")
+     << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -99,13 +99,36 @@ public:
 
   ///@{
   /**
-   * Access the data arrays referenced in the constructed scene.
+   * Access the data arrays referenced in the constructed scene. When
+   * IncrementalDataArrays is on, only the arrays that were not listed by a
+   * previous synchronization are accessible here.
    */
   vtkIdType GetNumberOfDataArrays() const;
   std::string GetDataArrayId(vtkIdType) const;
   vtkDataArray* GetDataArray(vtkIdType) const;
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether the data arrays listed by GetDataArray() are limited to
+   * the arrays whose hash was not listed since the last call to
+   * ClearSentDataArrays(). The scene description still references all the
+   * arrays by hash, so a client that keeps the arrays it received only needs
+   * to download the new ones when the scene is synchronized again, instead of
+   * the geometry of the whole scene. Reset() does not forget the arrays that
+   * were listed. Default is off.
+   */
+  vtkSetMacro(IncrementalDataArrays, bool);
+  vtkGetMacro(IncrementalDataArrays, bool);
+  vtkBooleanMacro(IncrementalDataArrays, bool);
+  ///@}
+
+  /**
+   * Forget the hashes of the data arrays listed so far, for instance when a
+   * client connects and holds no array yet.
+   */
+  void ClearSentDataArrays();
+
   ///@{
   /**
    * Add a scene graph node and its corresponding renderable to the scene.
@@ -155,6 +178,8 @@ protected:
   struct Internal;
   Internal* Internals;
 
+  bool IncrementalDataArrays = false;
+
 private:
   vtkVtkJSSceneGraphSerializer(const vtkVtkJSSceneGraphSerializer&) = delete;
   void operator=(const vtkVtkJSSceneGraphSerializer&) = delete;
@@ -0,0 +1,69 @@
+#include "vtkActor.h"
+#include "vtkConeSource.h"
+#include "vtkNew.h"
+#include "vtkPolyDataMapper.h"
+#include "vtkProperty.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
+#include "vtkWebGPURenderer.h"
+
+#include <iostream>
+#include <vector>
+
+// Check that the render bundles of unchanged props are reused, and that the
+// ones of modified mappers or properties are recorded again, in parallel.
+int TestRenderBundles(int, char*[])
+{
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetWindowName(__func__);
+  renWin->SetMultiSamples(0);
+
+  vtkNew<vtkRenderer> renderer;
+  renWin->AddRenderer(renderer);
+  auto wgpuRenderer = vtkWebGPURenderer::SafeDownCast(renderer);
+  if (!wgpuRenderer)
+  {
+    std::cerr << "Expected a vtkWebGPURenderer" << std::endl;
+    return 1;
+  }
+  wgpuRenderer->UseRenderBundlesOn();
+  wgpuRenderer->EncodeBundlesInParallelOn();
+
+  const int numberOfCones = 16;
+  std::vector<vtkSmartPointer<vtkActor>> actors;
+  for (int i = 0; i < numberOfCones; ++i)
+  {
+    vtkNew<vtkConeSource> coneSrc;
+    coneSrc->SetCenter(2.0 * i, 0.0, 0.0);
+    vtkNew<vtkPolyDataMapper> mapper;
+    mapper->SetInputConnection(coneSrc->GetOutputPort());
+    vtkNew<vtkActor> actor;
+    actor->SetMapper(mapper);
+    renderer->AddActor(actor);
+    actors.emplace_back(actor);
+  }
+  renderer->ResetCamera();
+  renderer->SetBackground(0.2, 0.3, 0.4);
+  renWin->Render();
+
+  renWin->Render();
+  if (wgpuRenderer->GetNumberOfRecordedBundles() != 0 ||
+    wgpuRenderer->GetNumberOfReusedBundles() != numberOfCones)
+  {
+    std::cerr << "Expected the bundles to be reused, " << wgpuRenderer->GetNumberOfRecordedBundles()
+              << " were recorded" << std::endl;
+    return 1;
+  }
+
+  actors[0]->GetMapper()->Modified();
+  actors[1]->GetProperty()->SetRepresentationToWireframe();
+  renWin->Render();
+  if (wgpuRenderer->GetNumberOfRecordedBundles() != 2)
+  {
+    std::cerr << "Expected 2 bundles to be recorded, got "
+              << wgpuRenderer->GetNumberOfRecordedBundles() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -21,6 +21,7 @@
 #include "vtkProperty.h"
 #include "vtkTexture.h"
 #include "vtkTransform.h"
+#include "vtkWebGPUPolyDataMapper.h"
 #include "vtkWebGPURenderWindow.h"
 #include "vtkWebGPURenderer.h"
 #include "vtkWindow.h"
@@ -80,6 +81,16 @@ void vtkWebGPUActor::Render(vtkRenderer* ren, vtkMapper* mapper)
 
 //------------------------------------------------------------------------------
 wgpu::RenderBundle vtkWebGPUActor::RenderToBundle(vtkRenderer* ren, vtkMapper* mapper)
+{
+  this->BeginRenderBundle(ren);
+  this->CurrentMapperRenderType = MapperRenderType::RenderBundleEncode;
+  mapper->Render(ren, this);
+  this->CurrentMapperRenderType = MapperRenderType::None;
+  return this->EndRenderBundle();
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUActor::BeginRenderBundle(vtkRenderer* ren)
 {
   auto wgpuRenderer = reinterpret_cast<vtkWebGPURenderer*>(ren);
   auto wgpuRenWin = reinterpret_cast<vtkWebGPURenderWindow*>(wgpuRenderer->GetRenderWindow());
@@ -109,13 +120,27 @@ wgpu::RenderBundle vtkWebGPUActor::RenderToBundle(vtkRenderer* ren, vtkMapper* m
 #ifndef NDEBUG
   this->CurrentBundler.PushDebugGroup("vtkWebGPUActor::Render");
 #endif
-  this->CurrentMapperRenderType = MapperRenderType::RenderBundleEncode;
-  mapper->Render(ren, this);
+}
+
+//------------------------------------------------------------------------------
+bool vtkWebGPUActor::EncodeRenderBundle(vtkRenderer* ren, vtkMapper* mapper)
+{
+  // the pipeline of the mapper is not updated, this was done by Update()
+  auto wgpuMapper = vtkWebGPUPolyDataMapper::SafeDownCast(mapper);
+  if (!wgpuMapper)
+  {
+    return false;
+  }
+  wgpuMapper->EncodeRenderCommands(ren, this, this->CurrentBundler);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+wgpu::RenderBundle vtkWebGPUActor::EndRenderBundle()
+{
 #ifndef NDEBUG
   this->CurrentBundler.PopDebugGroup();
 #endif
-  this->CurrentMapperRenderType = MapperRenderType::None;
-
   auto bundle = this->CurrentBundler.Finish();
   this->CurrentBundler = nullptr;
   return bundle;
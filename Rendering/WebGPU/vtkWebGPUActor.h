@@ -43,6 +43,20 @@ public:
   void Render(vtkRenderer* ren, vtkMapper* mapper) override;
   wgpu::RenderBundle RenderToBundle(vtkRenderer* ren, vtkMapper* mapper);
 
+  ///@{
+  /**
+   * The steps of RenderToBundle(). BeginRenderBundle() and EndRenderBundle()
+   * use the device and must be called from the rendering thread, whereas
+   * EncodeRenderBundle() only records the commands of a
+   * vtkWebGPUPolyDataMapper in the encoder of this actor, and may be called
+   * for several actors from several threads. EncodeRenderBundle() returns
+   * false if the mapper cannot encode its commands this way.
+   */
+  void BeginRenderBundle(vtkRenderer* ren);
+  bool EncodeRenderBundle(vtkRenderer* ren, vtkMapper* mapper);
+  wgpu::RenderBundle EndRenderBundle();
+  ///@}
+
   /**
    * Request mapper to run the vtkAlgorithm pipeline (if needed)
    * and consequently update device buffers corresponding to shader module bindings.
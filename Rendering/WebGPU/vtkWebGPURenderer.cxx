@@ -19,8 +19,10 @@
 #include "vtkLightCollection.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkProperty.h"
 #include "vtkRenderState.h"
 #include "vtkRenderer.h"
+#include "vtkSMPTools.h"
 #include "vtkTransform.h"
 #include "vtkType.h"
 #include "vtkTypeUInt32Array.h"
@@ -32,8 +34,10 @@
 #include "vtkWebGPUInternalsBindGroupLayout.h"
 #include "vtkWebGPUInternalsBuffer.h"
 #include "vtkWebGPULight.h"
+#include "vtkWebGPUPolyDataMapper.h"
 #include "vtkWebGPURenderWindow.h"
 
+#include <algorithm>
 #include <cstring>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -254,10 +258,11 @@ void vtkWebGPURenderer::DeviceRender()
       vtkDebugMacro(<< "Bundle cache summary:\n"
                     << "Total requests: " << this->BundleCacheStats.TotalRequests << "\n"
                     << "Hit ratio: "
-                    << (this->BundleCacheStats.Hits / this->BundleCacheStats.TotalRequests) * 100
+                    << (100.0 * this->BundleCacheStats.Hits) / this->BundleCacheStats.TotalRequests
                     << "%\n"
                     << "Miss ratio: "
-                    << (this->BundleCacheStats.Misses / this->BundleCacheStats.TotalRequests) * 100
+                    << (100.0 * this->BundleCacheStats.Misses) /
+                         this->BundleCacheStats.TotalRequests
                     << "%\n"
                     << "Hit: " << this->BundleCacheStats.Hits << "\n"
                     << "Miss: " << this->BundleCacheStats.Misses << "\n");
@@ -310,10 +315,19 @@ int vtkWebGPURenderer::UpdateOpaquePolygonalGeometry()
     wgpuActor->CacheActorRenderOptions();
     wgpuActor->CacheActorShadeOptions();
     wgpuActor->CacheActorTransforms();
-    if (wgpuActor->Update(this, wgpuActor->GetMapper()))
+    auto& wgpuPropItem = this->PropWGPUItems[this->PropArray[i]];
+    vtkMapper* mapper = wgpuActor->GetMapper();
+    vtkProperty* property = wgpuActor->GetProperty();
+    if (wgpuActor->Update(this, mapper))
     {
       // mapper's buffers and bind points have changed. bundle is outdated.
-      auto& wgpuPropItem = this->PropWGPUItems[this->PropArray[i]];
+      wgpuPropItem.Bundle = nullptr;
+    }
+    else if (mapper->GetMTime() > wgpuPropItem.BundleTimestamp ||
+      property->GetRepresentation() != wgpuPropItem.Representation ||
+      property->GetLineWidth() != wgpuPropItem.LineWidth)
+    {
+      // the draw calls recorded in the bundle depend on these.
       wgpuPropItem.Bundle = nullptr;
     }
   }
@@ -326,37 +340,94 @@ void vtkWebGPURenderer::DeviceRenderOpaqueGeometry(vtkFrameBufferObjectBase* vtk
 {
   int result = 0;
 
-  for (int i = 0; i < this->PropArrayCount; i++)
+  if (this->UseRenderBundles)
   {
-    auto& wgpuPropItem = this->PropWGPUItems[this->PropArray[i]];
-    auto wgpuActor = reinterpret_cast<vtkWebGPUActor*>(this->PropArray[i]);
-    if (this->UseRenderBundles)
+    // record the outdated bundles first, then execute all of them in order.
+    std::vector<int> outdated;
+    for (int i = 0; i < this->PropArrayCount; i++)
     {
       this->BundleCacheStats.TotalRequests++;
-      if (wgpuPropItem.Bundle == nullptr)
+      if (this->PropWGPUItems[this->PropArray[i]].Bundle == nullptr)
       {
-        wgpuActor->SetDynamicOffsets(wgpuPropItem.DynamicOffsets);
-        wgpuPropItem.Bundle = wgpuActor->RenderToBundle(this, wgpuActor->GetMapper());
-        this->Bundles.emplace_back(wgpuPropItem.Bundle);
+        outdated.emplace_back(i);
         this->BundleCacheStats.Misses++;
       }
       else
       {
         // bundle gets reused for this prop.
-        this->Bundles.emplace_back(wgpuPropItem.Bundle);
         this->BundleCacheStats.Hits++;
       }
     }
-    else
+    this->RecordBundles(outdated);
+    for (int i = 0; i < this->PropArrayCount; i++)
     {
-      wgpuActor->SetDynamicOffsets(wgpuPropItem.DynamicOffsets);
-      wgpuActor->Render(this, wgpuActor->GetMapper());
+      this->Bundles.emplace_back(this->PropWGPUItems[this->PropArray[i]].Bundle);
+      result += 1;
     }
+    this->NumberOfPropsRendered += result;
+    return;
+  }
+
+  for (int i = 0; i < this->PropArrayCount; i++)
+  {
+    auto& wgpuPropItem = this->PropWGPUItems[this->PropArray[i]];
+    auto wgpuActor = reinterpret_cast<vtkWebGPUActor*>(this->PropArray[i]);
+    wgpuActor->SetDynamicOffsets(wgpuPropItem.DynamicOffsets);
+    wgpuActor->Render(this, wgpuActor->GetMapper());
     result += 1;
   }
   this->NumberOfPropsRendered += result;
 }
 
+//------------------------------------------------------------------------------
+void vtkWebGPURenderer::RecordBundles(const std::vector<int>& propIndices)
+{
+  std::vector<vtkWebGPUActor*> actors;
+  for (const int i : propIndices)
+  {
+    auto& wgpuPropItem = this->PropWGPUItems[this->PropArray[i]];
+    auto wgpuActor = reinterpret_cast<vtkWebGPUActor*>(this->PropArray[i]);
+    wgpuActor->SetDynamicOffsets(wgpuPropItem.DynamicOffsets);
+    wgpuPropItem.BundleTimestamp.Modified();
+    wgpuPropItem.Representation = wgpuActor->GetProperty()->GetRepresentation();
+    wgpuPropItem.LineWidth = wgpuActor->GetProperty()->GetLineWidth();
+    actors.emplace_back(wgpuActor);
+  }
+
+  bool parallel = false;
+#ifndef __EMSCRIPTEN__
+  // the mappers encode their commands without running their vtkAlgorithm pipeline.
+  parallel = this->EncodeBundlesInParallel && actors.size() > 1 &&
+    std::all_of(actors.begin(), actors.end(), [](vtkWebGPUActor* actor) {
+      return vtkWebGPUPolyDataMapper::SafeDownCast(actor->GetMapper()) != nullptr;
+    });
+#endif
+  if (!parallel)
+  {
+    for (size_t i = 0; i < actors.size(); ++i)
+    {
+      this->PropWGPUItems[this->PropArray[propIndices[i]]].Bundle =
+        actors[i]->RenderToBundle(this, actors[i]->GetMapper());
+    }
+    return;
+  }
+
+  for (auto actor : actors)
+  {
+    actor->BeginRenderBundle(this);
+  }
+  vtkSMPTools::For(0, static_cast<vtkIdType>(actors.size()), [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType i = first; i < last; ++i)
+    {
+      actors[i]->EncodeRenderBundle(this, actors[i]->GetMapper());
+    }
+  });
+  for (size_t i = 0; i < actors.size(); ++i)
+  {
+    this->PropWGPUItems[this->PropArray[propIndices[i]]].Bundle = actors[i]->EndRenderBundle();
+  }
+}
+
 ///@{ TODO: Figure out translucent polygonal geometry. Better to do in a separate render pass?
 //------------------------------------------------------------------------------
 int vtkWebGPURenderer::UpdateTranslucentPolygonalGeometry()
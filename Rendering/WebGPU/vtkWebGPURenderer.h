@@ -24,6 +24,7 @@
 
 #include <string>        // for ivar
 #include <unordered_map> // for ivar
+#include <vector>        // for ivar
 
 class vtkAbstractMapper;
 class vtkRenderState;
@@ -112,6 +113,30 @@ public:
   vtkGetMacro(UseRenderBundles, bool);
   ///@}
 
+  ///@{
+  /**
+   * Set the recording of the outdated render bundles from several threads with
+   * vtkSMPTools. The bundle of a prop is outdated when the buffers or the
+   * MTime of its mapper, or the representation or the line width of its
+   * property, changed since it was recorded. Only the bundles of
+   * vtkWebGPUPolyDataMapper are recorded in parallel, the encoders are
+   * created and finished by the rendering thread. The device must allow the
+   * encoders to record from several threads, as Dawn does. Ignored with
+   * emscripten. Default is off.
+   */
+  vtkSetMacro(EncodeBundlesInParallel, bool);
+  vtkBooleanMacro(EncodeBundlesInParallel, bool);
+  vtkGetMacro(EncodeBundlesInParallel, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Number of render bundles reused and recorded by the last render.
+   */
+  int GetNumberOfReusedBundles() { return this->BundleCacheStats.Hits; }
+  int GetNumberOfRecordedBundles() { return this->BundleCacheStats.Misses; }
+  ///@}
+
 protected:
   vtkWebGPURenderer();
   ~vtkWebGPURenderer() override;
@@ -145,6 +170,9 @@ protected:
   void BeginEncoding();
   void EndEncoding();
 
+  // Record the bundles of the props of PropArray at these indices.
+  void RecordBundles(const std::vector<int>& propIndices);
+
   std::size_t WriteLightsBuffer(std::size_t offset = 0);
   std::size_t WriteSceneTransformsBuffer(std::size_t offset = 0);
   std::size_t WriteActorBlocksBuffer(std::size_t offset = 0);
@@ -164,14 +192,17 @@ protected:
 #else
   bool UseRenderBundles = false;
 #endif
-  // one bundle per actor. bundle gets reused every frame.
-  // these bundles can be built in parallel with vtkSMPTools. holding off because not
-  // sure how to get emscripten to thread.
+  bool EncodeBundlesInParallel = false;
+  // one bundle per actor. bundle gets reused every frame until outdated.
   std::vector<wgpu::RenderBundle> Bundles;
   struct vtkWGPUPropItem
   {
     wgpu::RenderBundle Bundle = nullptr;
     vtkSmartPointer<vtkTypeUInt32Array> DynamicOffsets;
+    // what the draw commands of the bundle depend on.
+    vtkTimeStamp BundleTimestamp;
+    int Representation = -1;
+    float LineWidth = 0;
   };
   std::unordered_map<vtkProp*, vtkWGPUPropItem> PropWGPUItems;
 
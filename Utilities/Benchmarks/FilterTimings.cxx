@@ -0,0 +1,62 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    FilterTimings.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+/*
+To add a test you must define a subclass of vtkFilterTimingTest and
+implement its pure virtual functions. Then in the main section at the
+bottom of this file add your test to the tests to be run and rebuild. See
+some of the existing tests to get an idea of what to do.
+
+Besides the options of the timing framework, -backends and -threads give
+comma separated lists of the SMP backends and numbers of threads to time
+each test with, for instance:
+
+  FilterTimings -nochart -backends STDThread,TBB -threads 1,2,4,8 -json results.json
+*/
+
+#include "vtkFilterTimingTests.h"
+
+/*=========================================================================
+The main entry point
+=========================================================================*/
+int main(int argc, char* argv[])
+{
+  // create the timing framework
+  vtkRenderTimings a;
+
+  // add the tests, for each layout of the input arrays
+  const char* layoutNames[] = { "AOS", "SOA", "Implicit" };
+  for (int layout = vtkFilterTimingTest::AOS; layout <= vtkFilterTimingTest::Implicit; ++layout)
+  {
+    const std::string suffix = layoutNames[layout];
+    a.TestsToRun.push_back(new contourFilterTest(("Contour" + suffix).c_str(), layout));
+    a.TestsToRun.push_back(new clipFilterTest(("Clip" + suffix).c_str(), layout));
+    a.TestsToRun.push_back(new thresholdFilterTest(("Threshold" + suffix).c_str(), layout));
+    a.TestsToRun.push_back(new cutFilterTest(("Cut" + suffix).c_str(), layout));
+    a.TestsToRun.push_back(new surfaceFilterTest(("Surface" + suffix).c_str(), layout));
+    a.TestsToRun.push_back(new probeFilterTest(("Probe" + suffix).c_str(), layout));
+    a.TestsToRun.push_back(new locatorTest(("Locator" + suffix).c_str(), layout));
+    a.TestsToRun.push_back(new ioTest(("XMLIO" + suffix).c_str(), layout, ioTest::XML));
+    a.TestsToRun.push_back(new ioTest(("HDFIO" + suffix).c_str(), layout, ioTest::HDF));
+  }
+
+  // process them
+  int result = a.ParseCommandLineArguments(argc, argv);
+  for (vtkRTTest* test : a.TestsToRun)
+  {
+    delete test;
+  }
+  return result;
+}
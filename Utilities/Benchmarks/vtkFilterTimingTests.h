@@ -0,0 +1,690 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkFilterTimingTests.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#ifndef vtkFilterTimingTests_h
+#define vtkFilterTimingTests_h
+
+/*
+To add a filter test you must define a subclass of vtkFilterTimingTest and
+implement Setup() and Execute(). Setup() gets the input grid and prepares
+what Execute() runs; Execute() is then timed for each SMP backend and
+number of threads. Then add your test to the tests to be run at the bottom
+of FilterTimings.cxx and rebuild.
+*/
+
+#include "vtkRenderTimings.h"
+
+#include "vtkCellArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkSmartPointer.h"
+#include "vtkStdFunctionArray.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vtksys/SystemInformation.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*=========================================================================
+Define the base class of the filter tests
+=========================================================================*/
+VTK_ABI_NAMESPACE_BEGIN
+class vtkFilterTimingTest : public vtkRTTest
+{
+public:
+  // how the points and the point scalars of the input are stored
+  enum ArrayLayout
+  {
+    AOS,
+    SOA,
+    Implicit
+  };
+
+  vtkFilterTimingTest(const char* name, int layout)
+    : vtkRTTest(name)
+  {
+    this->Layout = layout;
+  }
+
+  const char* GetSummaryResultName() override { return "Mcells/sec"; }
+
+  const char* GetSecondSummaryResultName() override { return "Mcells"; }
+
+  // Time Execute() on a grid of hexahedra for each backend and number of
+  // threads. The -backends and -threads arguments give comma separated
+  // lists of them, and default to the backend in use and to powers of two
+  // up to its number of threads.
+  vtkRTTestResult Run(vtkRTTestSequence* ats, int argc, char* argv[]) override
+  {
+    if (this->Backends.empty())
+    {
+      vtkFilterTimingTest::ParseArguments(argc, argv, this->Backends, this->Threads);
+    }
+    const std::vector<std::string>& backends = this->Backends;
+    const std::vector<int>& threads = this->Threads;
+
+    int xdim, ydim, zdim;
+    ats->GetSequenceNumbers(xdim, ydim, zdim);
+    vtkSmartPointer<vtkUnstructuredGrid> grid =
+      vtkFilterTimingTest::MakeGrid(20 * xdim, 20 * ydim, 20 * zdim, this->Layout);
+    this->Setup(grid);
+
+    const double numCells = static_cast<double>(grid->GetNumberOfCells());
+    const double configTime = this->TargetTime / (backends.size() * threads.size());
+    double bestTime = VTK_DOUBLE_MAX;
+    double memory = 0.0;
+
+    vtkRTTestResult result;
+    for (const std::string& backend : backends)
+    {
+      double baseTime = 0.0;
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        double seconds = 0.0;
+        double configMemory = 0.0;
+        vtkSMPTools::LocalScope(vtkSMPTools::Config(threads[i], backend, false),
+          [&]() { seconds = this->TimeExecute(configTime, configMemory); });
+        bestTime = std::min(bestTime, seconds);
+        memory = std::max(memory, configMemory);
+        if (i == 0)
+        {
+          baseTime = seconds * threads[0];
+        }
+
+        std::ostringstream prefix;
+        prefix << backend << " " << threads[i] << " threads ";
+        result.Results[prefix.str() + "seconds"] = seconds;
+        // the speedup over the first number of threads, per thread
+        result.Results[prefix.str() + "efficiency"] = baseTime / (seconds * threads[i]);
+      }
+    }
+    this->Cleanup();
+
+    result.Results["cells"] = numCells;
+    result.Results["Mcells"] = 1.0e-6 * numCells;
+    result.Results["Mcells/sec"] = 1.0e-6 * numCells / bestTime;
+    result.Results["memory MiB"] = memory;
+
+    return result;
+  }
+
+protected:
+  // prepare Execute() for the given input
+  virtual void Setup(vtkUnstructuredGrid* grid) = 0;
+
+  // run the timed operation
+  virtual void Execute() = 0;
+
+  // release what Execute() produced, so that its memory is measured again
+  virtual void ReleaseData() {}
+
+  // called once the timings of a sequence step are done
+  virtual void Cleanup() {}
+
+  // Return the fastest of a few executions, run within about maxTime. The
+  // memory is the increase in memory used by the process over the first
+  // execution, in MiB: it accounts for the output and for the temporary
+  // memory that was not released.
+  double TimeExecute(double maxTime, double& memory)
+  {
+    vtksys::SystemInformation si;
+    this->ReleaseData();
+    const long long before = si.GetProcMemoryUsed();
+    double startTime = vtkTimerLog::GetUniversalTime();
+    this->Execute();
+    double bestTime = vtkTimerLog::GetUniversalTime() - startTime;
+    const long long after = si.GetProcMemoryUsed();
+    memory = (before < 0 || after < before) ? 0.0 : (after - before) / 1024.0;
+
+    double totalTime = bestTime;
+    for (int run = 1; run < 5 && totalTime + bestTime < maxTime; ++run)
+    {
+      this->ReleaseData();
+      startTime = vtkTimerLog::GetUniversalTime();
+      this->Execute();
+      const double time = vtkTimerLog::GetUniversalTime() - startTime;
+      bestTime = std::min(bestTime, time);
+      totalTime += time;
+    }
+    return bestTime;
+  }
+
+  static void ParseArguments(
+    int argc, char* argv[], std::vector<std::string>& backends, std::vector<int>& threads)
+  {
+    std::string backendList;
+    std::string threadList;
+    vtksys::CommandLineArguments arguments;
+    arguments.Initialize(argc, argv);
+    arguments.StoreUnusedArguments(true);
+    typedef vtksys::CommandLineArguments argT;
+    arguments.AddArgument("-backends", argT::SPACE_ARGUMENT, &backendList,
+      "Comma separated list of the SMP backends to time the filters with.");
+    arguments.AddArgument("-threads", argT::SPACE_ARGUMENT, &threadList,
+      "Comma separated list of the numbers of threads to time the filters with.");
+    arguments.Parse();
+
+    backends.clear();
+    for (const std::string& backend : vtksys::SystemTools::SplitString(backendList, ','))
+    {
+      // skip the backends that are not built
+      const std::string current = vtkSMPTools::GetBackend();
+      if (!backend.empty() && vtkSMPTools::SetBackend(backend.c_str()))
+      {
+        backends.push_back(vtkSMPTools::GetBackend());
+        vtkSMPTools::SetBackend(current.c_str());
+      }
+    }
+    if (backends.empty())
+    {
+      backends.push_back(vtkSMPTools::GetBackend());
+    }
+
+    threads.clear();
+    for (const std::string& number : vtksys::SystemTools::SplitString(threadList, ','))
+    {
+      const int numThreads = atoi(number.c_str());
+      if (numThreads > 0)
+      {
+        threads.push_back(numThreads);
+      }
+    }
+    if (threads.empty())
+    {
+      const int maxThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+      for (int numThreads = 1; numThreads < maxThreads; numThreads *= 2)
+      {
+        threads.push_back(numThreads);
+      }
+      threads.push_back(maxThreads);
+    }
+  }
+
+  // Return an array of the given layout whose components are given by f
+  template <typename F>
+  static vtkSmartPointer<vtkDataArray> MakeArray(
+    int layout, int numComps, vtkIdType numTuples, F f)
+  {
+    if (layout == Implicit)
+    {
+      vtkNew<vtkStdFunctionArray<float>> array;
+      array->SetBackend(std::make_shared<std::function<float(int)>>(
+        [f, numComps](int idx) { return f(idx / numComps, idx % numComps); }));
+      array->SetNumberOfComponents(numComps);
+      array->SetNumberOfTuples(numTuples);
+      return array;
+    }
+
+    vtkSmartPointer<vtkDataArray> array;
+    if (layout == SOA)
+    {
+      array = vtkSmartPointer<vtkSOADataArrayTemplate<float>>::New();
+    }
+    else
+    {
+      array = vtkSmartPointer<vtkFloatArray>::New();
+    }
+    array->SetNumberOfComponents(numComps);
+    array->SetNumberOfTuples(numTuples);
+    vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType tupleIdx = begin; tupleIdx < end; ++tupleIdx)
+      {
+        for (int comp = 0; comp < numComps; ++comp)
+        {
+          array->SetComponent(tupleIdx, comp, f(tupleIdx, comp));
+        }
+      }
+    });
+    return array;
+  }
+
+  // Return a grid of nx*ny*nz hexahedra filling the unit cube, with a
+  // "Field" point scalar array that has many isosurfaces.
+  static vtkSmartPointer<vtkUnstructuredGrid> MakeGrid(int nx, int ny, int nz, int layout)
+  {
+    const vtkIdType px = nx + 1;
+    const vtkIdType pxy = px * (ny + 1);
+    const vtkIdType numPts = pxy * (nz + 1);
+    const vtkIdType numCells = static_cast<vtkIdType>(nx) * ny * nz;
+    const double spacing[3] = { 1.0 / nx, 1.0 / ny, 1.0 / nz };
+
+    auto coordinate = [px, pxy, spacing](vtkIdType ptId, int comp) {
+      const vtkIdType ijk[3] = { ptId % px, (ptId / px) % (pxy / px), ptId / pxy };
+      return static_cast<float>(ijk[comp] * spacing[comp]);
+    };
+    auto field = [coordinate](vtkIdType ptId, int) {
+      const double x = coordinate(ptId, 0);
+      const double y = coordinate(ptId, 1);
+      const double z = coordinate(ptId, 2);
+      return static_cast<float>(std::sin(12.0 * x) * std::cos(12.0 * y) + std::sin(12.0 * z));
+    };
+
+    vtkNew<vtkPoints> points;
+    points->SetData(MakeArray(layout, 3, numPts, coordinate));
+    vtkSmartPointer<vtkDataArray> scalars = MakeArray(layout, 1, numPts, field);
+    scalars->SetName("Field");
+
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(numCells + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(8 * numCells);
+    vtkNew<vtkUnsignedCharArray> types;
+    types->SetNumberOfValues(numCells);
+    vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        const vtkIdType i = cellId % nx;
+        const vtkIdType j = (cellId / nx) % ny;
+        const vtkIdType k = cellId / (static_cast<vtkIdType>(nx) * ny);
+        const vtkIdType p0 = i + j * px + k * pxy;
+        const vtkIdType hex[8] = { p0, p0 + 1, p0 + px + 1, p0 + px, p0 + pxy, p0 + pxy + 1,
+          p0 + pxy + px + 1, p0 + pxy + px };
+        std::copy(hex, hex + 8, connectivity->GetPointer(8 * cellId));
+        offsets->SetValue(cellId, 8 * cellId);
+        types->SetValue(cellId, VTK_HEXAHEDRON);
+      }
+    });
+    offsets->SetValue(numCells, 8 * numCells);
+    vtkNew<vtkCellArray> cells;
+    cells->SetData(offsets, connectivity);
+
+    vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    grid->SetPoints(points);
+    grid->SetCells(types, cells);
+    grid->GetPointData()->SetScalars(scalars);
+    return grid;
+  }
+
+  int Layout;
+  std::vector<std::string> Backends;
+  std::vector<int> Threads;
+};
+
+/*=========================================================================
+Define a base test for the filters with a vtkUnstructuredGrid input
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkFilterAlgorithmTest : public vtkFilterTimingTest
+{
+public:
+  vtkFilterAlgorithmTest(const char* name, int layout)
+    : vtkFilterTimingTest(name, layout)
+  {
+  }
+
+protected:
+  // return the filter to time, with its parameters set for the grid
+  virtual vtkSmartPointer<vtkAlgorithm> MakeFilter(vtkUnstructuredGrid* grid) = 0;
+
+  void Setup(vtkUnstructuredGrid* grid) override
+  {
+    this->Filter = this->MakeFilter(grid);
+    this->Filter->SetInputDataObject(0, grid);
+  }
+
+  void Execute() override
+  {
+    this->Filter->Modified();
+    this->Filter->Update();
+  }
+
+  void ReleaseData() override
+  {
+    if (vtkDataObject* output = this->Filter->GetOutputDataObject(0))
+    {
+      output->Initialize();
+    }
+  }
+
+  void Cleanup() override { this->Filter = nullptr; }
+
+  vtkSmartPointer<vtkAlgorithm> Filter;
+};
+
+/*=========================================================================
+Define a test for contouring
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkContourFilter.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class contourFilterTest : public vtkFilterAlgorithmTest
+{
+public:
+  contourFilterTest(const char* name, int layout)
+    : vtkFilterAlgorithmTest(name, layout)
+  {
+  }
+
+protected:
+  vtkSmartPointer<vtkAlgorithm> MakeFilter(vtkUnstructuredGrid*) override
+  {
+    vtkNew<vtkContourFilter> contour;
+    contour->SetValue(0, 0.5);
+    contour->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "Field");
+    return contour.Get();
+  }
+};
+
+/*=========================================================================
+Define a test for clipping
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkTableBasedClipDataSet.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class clipFilterTest : public vtkFilterAlgorithmTest
+{
+public:
+  clipFilterTest(const char* name, int layout)
+    : vtkFilterAlgorithmTest(name, layout)
+  {
+  }
+
+protected:
+  vtkSmartPointer<vtkAlgorithm> MakeFilter(vtkUnstructuredGrid*) override
+  {
+    vtkNew<vtkTableBasedClipDataSet> clip;
+    clip->SetValue(0.5);
+    clip->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "Field");
+    return clip.Get();
+  }
+};
+
+/*=========================================================================
+Define a test for thresholding
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkThreshold.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class thresholdFilterTest : public vtkFilterAlgorithmTest
+{
+public:
+  thresholdFilterTest(const char* name, int layout)
+    : vtkFilterAlgorithmTest(name, layout)
+  {
+  }
+
+protected:
+  vtkSmartPointer<vtkAlgorithm> MakeFilter(vtkUnstructuredGrid*) override
+  {
+    vtkNew<vtkThreshold> threshold;
+    threshold->SetThresholdFunction(vtkThreshold::THRESHOLD_BETWEEN);
+    threshold->SetLowerThreshold(-0.5);
+    threshold->SetUpperThreshold(0.5);
+    threshold->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "Field");
+    return threshold.Get();
+  }
+};
+
+/*=========================================================================
+Define a test for cutting with a plane
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkCutter.h"
+#include "vtkPlane.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class cutFilterTest : public vtkFilterAlgorithmTest
+{
+public:
+  cutFilterTest(const char* name, int layout)
+    : vtkFilterAlgorithmTest(name, layout)
+  {
+  }
+
+protected:
+  vtkSmartPointer<vtkAlgorithm> MakeFilter(vtkUnstructuredGrid*) override
+  {
+    vtkNew<vtkPlane> plane;
+    plane->SetOrigin(0.5, 0.5, 0.5);
+    plane->SetNormal(1.0, 2.0, 3.0);
+    vtkNew<vtkCutter> cutter;
+    cutter->SetCutFunction(plane);
+    return cutter.Get();
+  }
+};
+
+/*=========================================================================
+Define a test for surface extraction
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkDataSetSurfaceFilter.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class surfaceFilterTest : public vtkFilterAlgorithmTest
+{
+public:
+  surfaceFilterTest(const char* name, int layout)
+    : vtkFilterAlgorithmTest(name, layout)
+  {
+  }
+
+protected:
+  vtkSmartPointer<vtkAlgorithm> MakeFilter(vtkUnstructuredGrid*) override
+  {
+    return vtkSmartPointer<vtkDataSetSurfaceFilter>::New();
+  }
+};
+
+/*=========================================================================
+Define a test for probing with a plane of points
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkPlaneSource.h"
+#include "vtkPolyData.h"
+#include "vtkProbeFilter.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class probeFilterTest : public vtkFilterAlgorithmTest
+{
+public:
+  probeFilterTest(const char* name, int layout)
+    : vtkFilterAlgorithmTest(name, layout)
+  {
+  }
+
+protected:
+  vtkSmartPointer<vtkAlgorithm> MakeFilter(vtkUnstructuredGrid* grid) override
+  {
+    // a slanted plane with about as many points as the grid has cells on a face
+    const int resolution = static_cast<int>(std::cbrt(grid->GetNumberOfCells())) * 4;
+    vtkNew<vtkPlaneSource> plane;
+    plane->SetOrigin(0.05, 0.05, 0.1);
+    plane->SetPoint1(0.95, 0.05, 0.9);
+    plane->SetPoint2(0.05, 0.95, 0.5);
+    plane->SetResolution(resolution, resolution);
+    plane->Update();
+    this->Points = plane->GetOutput();
+    vtkNew<vtkProbeFilter> probe;
+    probe->SetSourceData(grid);
+    return probe.Get();
+  }
+
+  void Setup(vtkUnstructuredGrid* grid) override
+  {
+    this->Filter = this->MakeFilter(grid);
+    this->Filter->SetInputDataObject(0, this->Points);
+  }
+
+  void Cleanup() override
+  {
+    this->Points = nullptr;
+    this->vtkFilterAlgorithmTest::Cleanup();
+  }
+
+  vtkSmartPointer<vtkPolyData> Points;
+};
+
+/*=========================================================================
+Define a test for building a point locator and querying it concurrently
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkStaticPointLocator.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class locatorTest : public vtkFilterTimingTest
+{
+public:
+  locatorTest(const char* name, int layout)
+    : vtkFilterTimingTest(name, layout)
+  {
+  }
+
+protected:
+  void Setup(vtkUnstructuredGrid* grid) override
+  {
+    this->Locator = vtkSmartPointer<vtkStaticPointLocator>::New();
+    this->Locator->SetDataSet(grid);
+
+    // query as many random points as the grid has cells
+    std::mt19937 random(0);
+    std::uniform_real_distribution<double> coordinate(0.0, 1.0);
+    this->Queries.resize(3 * grid->GetNumberOfCells());
+    for (double& x : this->Queries)
+    {
+      x = coordinate(random);
+    }
+    this->Closest.resize(grid->GetNumberOfCells());
+  }
+
+  void Execute() override
+  {
+    this->Locator->ForceBuildLocator();
+    vtkSMPTools::For(
+      0, static_cast<vtkIdType>(this->Closest.size()), [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          this->Closest[i] = this->Locator->FindClosestPoint(&this->Queries[3 * i]);
+        }
+      });
+  }
+
+  void ReleaseData() override { this->Locator->FreeSearchStructure(); }
+
+  void Cleanup() override
+  {
+    this->Locator = nullptr;
+    this->Queries.clear();
+    this->Closest.clear();
+  }
+
+  vtkSmartPointer<vtkStaticPointLocator> Locator;
+  std::vector<double> Queries;
+  std::vector<vtkIdType> Closest;
+};
+
+/*=========================================================================
+Define a test for writing and reading back a file
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkXMLUnstructuredGridReader.h"
+#include "vtkXMLUnstructuredGridWriter.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class ioTest : public vtkFilterTimingTest
+{
+public:
+  enum FileFormat
+  {
+    XML,
+    HDF
+  };
+
+  ioTest(const char* name, int layout, int format)
+    : vtkFilterTimingTest(name, layout)
+  {
+    this->Format = format;
+  }
+
+protected:
+  void Setup(vtkUnstructuredGrid* grid) override
+  {
+    this->FileName = vtksys::SystemTools::GetCurrentWorkingDirectory() + "/FilterTimings" +
+      (this->Format == HDF ? ".vtkhdf" : ".vtu");
+    if (this->Format == HDF)
+    {
+      vtkNew<vtkHDFWriter> writer;
+      writer->SetFileName(this->FileName.c_str());
+      this->Writer = writer.Get();
+      vtkNew<vtkHDFReader> reader;
+      reader->SetFileName(this->FileName.c_str());
+      this->Reader = reader.Get();
+    }
+    else
+    {
+      vtkNew<vtkXMLUnstructuredGridWriter> writer;
+      writer->SetFileName(this->FileName.c_str());
+      this->Writer = writer.Get();
+      vtkNew<vtkXMLUnstructuredGridReader> reader;
+      reader->SetFileName(this->FileName.c_str());
+      this->Reader = reader.Get();
+    }
+    this->Writer->SetInputDataObject(0, grid);
+  }
+
+  void Execute() override
+  {
+    this->Writer->Modified();
+    this->Writer->Update();
+    this->Reader->Modified();
+    this->Reader->Update();
+  }
+
+  void ReleaseData() override
+  {
+    if (vtkDataObject* output = this->Reader->GetOutputDataObject(0))
+    {
+      output->Initialize();
+    }
+  }
+
+  void Cleanup() override
+  {
+    this->Writer = nullptr;
+    this->Reader = nullptr;
+    vtksys::SystemTools::RemoveFile(this->FileName);
+  }
+
+  int Format;
+  std::string FileName;
+  vtkSmartPointer<vtkAlgorithm> Writer;
+  vtkSmartPointer<vtkAlgorithm> Reader;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkFilterTimingTests.h
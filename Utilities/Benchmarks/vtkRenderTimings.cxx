@@ -31,7 +31,34 @@
 #include "vtkRenderWindow.h"
 #include "vtkTable.h"
 
+#include <cmath>
+
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// write a string as a JSON string literal
+void WriteJSONString(ostream& ost, const std::string& str)
+{
+  ost << '"';
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      ost << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      ost << ' ';
+    }
+    else
+    {
+      ost << c;
+    }
+  }
+  ost << '"';
+}
+}
+
 void vtkRTTestSequence::GetSequenceNumbers(int& xdim)
 {
   static int linearSequence[] = { 1, 2, 3, 5 };
@@ -234,6 +261,36 @@ void vtkRTTestSequence::ReportDetailedResults(ostream& ost)
   }
 }
 
+void vtkRTTestSequence::ReportJSONResults(ostream& ost)
+{
+  ost << "    {\n      \"name\": ";
+  WriteJSONString(ost, this->Test->GetName());
+  ost << ",\n      \"results\": [";
+  std::vector<vtkRTTestResult>::iterator trItr;
+  for (trItr = this->TestResults.begin(); trItr != this->TestResults.end(); ++trItr)
+  {
+    ost << (trItr == this->TestResults.begin() ? "\n" : ",\n");
+    ost << "        { \"sequence\": " << trItr->SequenceNumber;
+    std::map<std::string, double>::iterator rItr;
+    for (rItr = trItr->Results.begin(); rItr != trItr->Results.end(); ++rItr)
+    {
+      ost << ", ";
+      WriteJSONString(ost, rItr->first);
+      // JSON has no representation for infinities and NaNs
+      if (std::isfinite(rItr->second))
+      {
+        ost << ": " << rItr->second;
+      }
+      else
+      {
+        ost << ": null";
+      }
+    }
+    ost << " }";
+  }
+  ost << "\n      ]\n    }";
+}
+
 vtkRenderTimings::vtkRenderTimings()
 {
   this->TargetTime = 600.0; // 10 minutes
@@ -310,6 +367,25 @@ void vtkRenderTimings::ReportResults()
     (*tsItr)->ReportDetailedResults(rfile);
   }
   rfile.close();
+
+  // and to a json file if requested
+  if (!this->JSONResultsFileName.empty())
+  {
+    cout << "JSON results written to " << this->JSONResultsFileName << endl;
+    vtksys::ofstream jfile;
+    jfile.open(this->JSONResultsFileName.c_str());
+    jfile.precision(10);
+    jfile << "{\n  \"platform\": ";
+    WriteJSONString(jfile, this->SystemName);
+    jfile << ",\n  \"tests\": [";
+    for (tsItr = this->TestSequences.begin(); tsItr != this->TestSequences.end(); ++tsItr)
+    {
+      jfile << (tsItr == this->TestSequences.begin() ? "\n" : ",\n");
+      (*tsItr)->ReportJSONResults(jfile);
+    }
+    jfile << "\n  ]\n}\n";
+    jfile.close();
+  }
 }
 
 int vtkRenderTimings::ParseCommandLineArguments(int argc, char* argv[])
@@ -320,6 +396,8 @@ int vtkRenderTimings::ParseCommandLineArguments(int argc, char* argv[])
   typedef vtksys::CommandLineArguments argT;
   this->Arguments.AddArgument("-rn", argT::SPACE_ARGUMENT, &this->DetailedResultsFileName,
     "Specify where to write the detailed results to. Defaults to results.csv.");
+  this->Arguments.AddArgument("-json", argT::SPACE_ARGUMENT, &this->JSONResultsFileName,
+    "Specify a file to also write the detailed results to in JSON format.");
   this->Arguments.AddArgument("-regex", argT::SPACE_ARGUMENT, &this->Regex,
     "Specify a regular expression for what tests should be run.");
   this->Arguments.AddArgument("-tls", argT::SPACE_ARGUMENT, &this->SequenceStepTimeLimit,
@@ -105,6 +105,7 @@ public:
   virtual void Run();
   virtual void ReportSummaryResults(ostream& ost);
   virtual void ReportDetailedResults(ostream& ost);
+  virtual void ReportJSONResults(ostream& ost);
 
   // tests should use these functions to determine what resolution
   // to use in scaling their test. The functions will always return
@@ -186,6 +187,7 @@ private:
   int SequenceEnd;
   double SequenceStepTimeLimit;
   std::string DetailedResultsFileName;
+  std::string JSONResultsFileName;
   int RenderWidth;
   int RenderHeight;
 };
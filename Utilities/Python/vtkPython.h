@@ -123,6 +123,8 @@ public:
   // If force is TRUE, lock/unlock even if VTK_PYTHON_FULL_THREADSAFE is not defined.
   // If force is FALSE, lock/unlock is only performed if VTK_PYTHON_FULL_THREADSAFE is
   // defined.
+  // Code calling python from C++ must use force, since the wrappers release the GIL
+  // during the calls of the methods marked with VTK_UNBLOCKTHREADS, e.g. Update().
   // If noRelease is TRUE, unlock will not be called at object destruction. This is used
   // for specific python function calls like PyFinalize which already take
   // care of releasing the GIL.
@@ -48,7 +48,7 @@ public:
   {
     if (this->InteractiveConsole)
     {
-      vtkPythonScopeGilEnsurer gilEnsurer;
+      vtkPythonScopeGilEnsurer gilEnsurer(true);
       Py_XDECREF(this->InteractiveConsoleLocals);
       Py_XDECREF(this->InteractiveConsole);
       this->InteractiveConsole = nullptr;
@@ -70,7 +70,7 @@ public:
 
     vtkPythonInterpreter::Initialize();
 
-    vtkPythonScopeGilEnsurer gilEnsurer;
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
     // set up the code.InteractiveConsole instance that we'll use.
     const char* code = "import code\n"
                        "__vtkConsoleLocals={'__name__':'__vtkconsole__','__doc__':None}\n"
@@ -172,7 +172,7 @@ bool vtkPythonInteractiveInterpreter::Push(const char* code)
     i++;
   }
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   bool ret_value = false;
   PyObject* res = PyObject_CallMethod(console, "push", "z", buffer.c_str());
   if (res)
@@ -195,7 +195,7 @@ int vtkPythonInteractiveInterpreter::RunStringWithConsoleLocals(const char* scri
 
   this->Internals->GetInteractiveConsole(); // ensure the console is initialized
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   PyObject* context = this->Internals->GetInteractiveConsoleLocalsPyObject();
   PyObject* result = PyRun_String(script, Py_file_input, context, context);
 
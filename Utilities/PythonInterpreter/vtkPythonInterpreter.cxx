@@ -140,7 +140,7 @@ void NotifyInterpreters(unsigned long eventid, void* calldata = nullptr)
 inline void vtkPrependPythonPath(const char* pathtoadd)
 {
   VTKPY_DEBUG_MESSAGE("adding module search path " << pathtoadd);
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   PyObject* path = PySys_GetObject("path");
   PyObject* newpath = PyUnicode_FromString(pathtoadd);
 
@@ -369,7 +369,7 @@ bool vtkPythonInterpreter::InitializeWithArgs(int initsigs, int argc, char* argv
       // Setup handlers for stdout/stdin/stderr.
       vtkPythonStdStreamCaptureHelper* wrapperOut = NewPythonStdStreamCaptureHelper(false);
       vtkPythonStdStreamCaptureHelper* wrapperErr = NewPythonStdStreamCaptureHelper(true);
-      vtkPythonScopeGilEnsurer gilEnsurer;
+      vtkPythonScopeGilEnsurer gilEnsurer(true);
       PySys_SetObject("stdout", reinterpret_cast<PyObject*>(wrapperOut));
       PySys_SetObject("stderr", reinterpret_cast<PyObject*>(wrapperErr));
       PySys_SetObject("stdin", reinterpret_cast<PyObject*>(wrapperOut));
@@ -418,7 +418,7 @@ void vtkPythonInterpreter::Finalize()
   if (Py_IsInitialized() != 0)
   {
     NotifyInterpreters(vtkCommand::ExitEvent);
-    vtkPythonScopeGilEnsurer gilEnsurer(false, true);
+    vtkPythonScopeGilEnsurer gilEnsurer(true, true);
 #ifdef vtkPythonInterpreter_USE_DIRECTORY_COOKIE
     CloseDLLDirectoryCookie();
 #endif
@@ -689,7 +689,7 @@ int vtkPythonInterpreter::RunSimpleString(const char* script)
   // The cast is necessary because PyRun_SimpleString() hasn't always been const-correct
   int pyReturn;
   {
-    vtkPythonScopeGilEnsurer gilEnsurer;
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
     pyReturn = PyRun_SimpleString(buffer.c_str());
   }
 
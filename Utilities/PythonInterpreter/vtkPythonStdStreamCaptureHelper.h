@@ -252,7 +252,7 @@ static PyObject* vtkClose(PyObject* self, PyObject* args)
 
 static vtkPythonStdStreamCaptureHelper* NewPythonStdStreamCaptureHelper(bool for_stderr = false)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   if (PyType_Ready(&vtkPythonStdStreamCaptureHelperType) < 0)
   {
     return nullptr;
@@ -120,10 +120,47 @@ bool TestLatestOutput()
   return true;
 }
 
+bool TestSupersededImages()
+{
+  vtkLogScopeFunction(INFO);
+  constexpr int KEY1 = 1020;
+  constexpr int KEY2 = 1021;
+
+  vtkNew<vtkDataEncoder> encoder;
+  encoder->SetMaxThreads(1);
+  encoder->Initialize();
+
+  // pending images are dropped when a newer one is pushed on the same pipe,
+  // but not when it is pushed on another pipe.
+  auto image = GetData();
+  for (int cc = 0; cc < 50; cc++)
+  {
+    encoder->Push(KEY1, image, 50);
+    encoder->Push(KEY2, image, 50);
+  }
+
+  encoder->Flush(KEY1);
+  encoder->Flush(KEY2);
+  vtkSmartPointer<vtkUnsignedCharArray> result1;
+  vtkSmartPointer<vtkUnsignedCharArray> result2;
+  if (!encoder->GetLatestOutput(KEY1, result1) || !encoder->GetLatestOutput(KEY2, result2))
+  {
+    vtkLogF(ERROR, "latest outputs expected!");
+    return false;
+  }
+  if (result1->GetNumberOfValues() == 0 ||
+    result1->GetNumberOfValues() != result2->GetNumberOfValues())
+  {
+    vtkLogF(ERROR, "same outputs expected for the same images!");
+    return false;
+  }
+  return true;
+}
+
 int TestDataEncoder(int /*argc*/, char* /*argv*/[])
 {
   TestCreate();
   TestFlush();
   TestLatestOutput();
-  return EXIT_SUCCESS;
+  return TestSupersededImages() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -25,12 +25,13 @@
 #include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <condition_variable>
+#include <deque>
 #include <map>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -72,7 +73,7 @@ class vtkWorkQueue
   std::map<vtkTypeUInt32, std::atomic<vtkTypeUInt32>> LastTimeStamp;
 
   std::mutex QueueMutex;
-  std::queue<vtkWork> Queue;
+  std::deque<vtkWork> Queue;
   std::condition_variable QueueCondition;
 
   std::vector<std::thread> ThreadPool;
@@ -105,7 +106,7 @@ class vtkWorkQueue
           break;
         }
         work = self->Queue.front();
-        self->Queue.pop();
+        self->Queue.pop_front();
       }
 
       writer->SetInputData(work.Image);
@@ -179,8 +180,14 @@ public:
     auto key = work.Key;
     work.TimeStamp = ++this->LastTimeStamp[key];
     {
+      // Images of the same pipe that are still waiting for a thread are
+      // superseded: only the latest result can be obtained, so do not spend
+      // time encoding them, and let the threads catch up with the pushes.
       std::unique_lock<std::mutex> lock(this->QueueMutex);
-      this->Queue.emplace(std::move(work));
+      this->Queue.erase(std::remove_if(this->Queue.begin(), this->Queue.end(),
+                          [key](const vtkWork& pending) { return pending.Key == key; }),
+        this->Queue.end());
+      this->Queue.emplace_back(std::move(work));
     }
     this->QueueCondition.notify_one();
   }
@@ -28,6 +28,11 @@
  * takes longer to compress and encode than that pushed in at N+1-th location or
  * if it was pushed in before the N-th location was even taken up for encoding
  * by the a thread in the thread pool.
+ *
+ * As only the latest output of a pipe can be accessed, pushing an image drops
+ * the images of the same pipe that are not yet taken up by a thread. When
+ * images are pushed faster than they can be encoded, the encoder thus skips
+ * frames instead of lagging further and further behind.
  */
 
 #ifndef vtkDataEncoder_h
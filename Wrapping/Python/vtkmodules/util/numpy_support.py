@@ -9,6 +9,13 @@ The main functionality of this module is provided by the two functions:
     numpy_to_vtk,
     vtk_to_numpy.
 
+The arrays are shared without copies whenever their layout allows it.
+vtk_to_numpy_components and numpy_to_vtk_components share the components
+of struct-of-arrays (SOA) arrays, vtk_to_numpy_cell_array and
+numpy_to_vtk_cell_array the offsets and connectivity of cell arrays, and
+vtk_to_dlpack and dlpack_to_vtk exchange arrays with the frameworks
+supporting DLPack, such as PyTorch, through the DLPack support of numpy.
+
 
 Caveats:
 --------
@@ -20,14 +27,21 @@ Caveats:
  - You need to make sure you hold a reference to a Numpy array you want
    to import into VTK.  If not you'll get a segfault (in the best case).
    The same holds in reverse when you convert a VTK array to a numpy
-   array -- don't delete the VTK array.
+   array -- don't delete the VTK array.  The functions sharing SOA
+   components and cell arrays keep the arrays they share alive.
+
+ - VTK arrays live in host memory.  Arrays on a GPU, exposing
+   __cuda_array_interface__ or a DLPack device other than the CPU, are
+   rejected and must be copied to the host by their framework first.
+   Implicit arrays compute their values on the fly and are copied.
 
 
 Created by Prabhu Ramachandran in Feb. 2008.
 """
 
 from . import vtkConstants
-from vtkmodules.vtkCommonCore import vtkDataArray, vtkIdTypeArray, vtkLongArray
+from vtkmodules.vtkCommonCore import vtkDataArray, vtkIdTypeArray, vtkLongArray, \
+     vtkSOADataArrayTemplate
 import numpy
 
 # Useful constants for VTK arrays.
@@ -119,6 +133,9 @@ def numpy_to_vtk(num_array, deep=0, array_type=None):
     the numpy data is gc'd and VTK will point to garbage which will in
     the best case give you a segfault.
 
+    Any object numpy can view, including the objects supporting DLPack on
+    the CPU, is shared without copies too, see dlpack_to_vtk.
+
     Parameters:
 
     num_array
@@ -126,7 +143,7 @@ def numpy_to_vtk(num_array, deep=0, array_type=None):
 
     """
 
-    z = numpy.asarray(num_array)
+    z = _as_host_array(num_array)
     if not z.flags.contiguous:
         z = numpy.ascontiguousarray(z)
 
@@ -246,3 +263,178 @@ def vtk_to_numpy(vtk_array):
            result = numpy.empty(shape, dtype=dtype)
         else: raise
     return result
+
+
+# DLPack device types of the memory numpy, hence VTK, can address.
+_DLPACK_CPU = 1
+
+def _as_host_array(obj):
+    """Internal function returning a numpy array sharing the memory of obj,
+    which must be in host memory.
+    """
+    if isinstance(obj, numpy.ndarray):
+        return obj
+    if hasattr(obj, '__cuda_array_interface__'):
+        raise TypeError(
+            'VTK arrays live in host memory, copy the device array %s to the '
+            'host first.' % type(obj).__name__)
+    if hasattr(obj, '__dlpack__') and hasattr(numpy, 'from_dlpack'):
+        device = obj.__dlpack_device__()[0]
+        if device != _DLPACK_CPU:
+            raise TypeError(
+                'VTK arrays live in host memory, copy the array %s on the '
+                'DLPack device %d to the host first.'
+                % (type(obj).__name__, device))
+        # the capsule of the array returned keeps the producer alive.
+        return numpy.from_dlpack(obj)
+    return numpy.asarray(obj)
+
+def dlpack_to_vtk(obj, deep=0, array_type=None):
+    """Converts an array supporting DLPack on the CPU, such as a PyTorch
+    tensor, to a VTK array sharing its memory.
+
+    Unlike numpy_to_vtk, this keeps the producer of the array alive as long
+    as the VTK array uses its memory.  GPU arrays must be copied to the host
+    first, e.g. with the cpu() method of PyTorch tensors.
+
+    Parameters are the same as those of numpy_to_vtk.
+    """
+    return numpy_to_vtk(_as_host_array(obj), deep, array_type)
+
+def vtk_to_dlpack(vtk_array):
+    """Returns a DLPack capsule of the values of a VTK data array, without
+    copying them, for the consumers expecting capsules.
+
+    The numpy arrays returned by vtk_to_numpy and vtk_to_numpy_components
+    support the DLPack protocol, so most frameworks can import them
+    directly, e.g. with torch.from_dlpack(vtk_to_numpy(vtk_array)).  This
+    requires numpy 1.22 or newer.
+    """
+    return vtk_to_numpy(vtk_array).__dlpack__()
+
+def vtk_to_numpy_components(vtk_array):
+    """Returns the components of a VTK data array as a list of 1D numpy
+    arrays.
+
+    The components of arrays storing their values as an array of structs
+    are strided views of vtk_to_numpy.  Those of struct-of-arrays
+    (vtkSOADataArrayTemplate) arrays are views of their contiguous buffers,
+    whereas vtk_to_numpy would copy them.  The views keep the VTK array
+    alive.  The components of other arrays, such as implicit arrays, are
+    copies.
+
+    Parameters
+
+    vtk_array
+      The VTK data array to be converted.
+    """
+    typ = vtk_array.GetDataType()
+    assert typ in get_vtk_to_numpy_typemap().keys(), \
+           "Unsupported array type %s"%typ
+    assert typ != vtkConstants.VTK_BIT, 'Bit arrays are not supported.'
+    numTuples = vtk_array.GetNumberOfTuples()
+    numComps = vtk_array.GetNumberOfComponents()
+    dtype = get_numpy_array_type(typ)
+
+    if vtk_array.HasStandardMemoryLayout():
+        result = vtk_to_numpy(vtk_array)
+        if numComps == 1:
+            return [result]
+        return [result[:, c] for c in range(numComps)]
+
+    components = []
+    if hasattr(vtk_array, 'GetComponentArrayVoidPointer') and numTuples > 0:
+        for c in range(numComps):
+            ptr = vtk_array.GetComponentArrayVoidPointer(c)
+            if ptr is None:
+                components = []
+                break
+            # a 1 component array viewing the buffer of the component
+            view = create_vtk_array(typ)
+            view.SetVoidArray(ptr, numTuples, 1)
+            view._vtk_owner = vtk_array
+            components.append(numpy.frombuffer(view, dtype=dtype))
+        if components:
+            return components
+
+    # copy the values, without changing the storage of the array
+    copy = create_vtk_array(typ)
+    copy.DeepCopy(vtk_array)
+    return vtk_to_numpy_components(copy)
+
+def numpy_to_vtk_components(components, deep=0):
+    """Converts a sequence of 1D numpy arrays of the same length and type,
+    or a 2D numpy array whose columns are the components, to a
+    struct-of-arrays VTK array (vtkSOADataArrayTemplate).
+
+    The contiguous components are shared without copies, so that the
+    columns of Fortran ordered arrays, or of arrays exchanged with
+    frameworks storing their components separately, need not be
+    interleaved.  The VTK array keeps the components alive.  Objects
+    supporting DLPack on the CPU are accepted as components, see
+    dlpack_to_vtk.
+
+    Parameters
+
+    components
+      a sequence of 1D real arrays, or a 2D real array.
+    deep
+      if set, copy the components instead of sharing them.
+    """
+    if isinstance(components, (list, tuple)):
+        columns = [_as_host_array(c) for c in components]
+    else:
+        z = _as_host_array(components)
+        assert len(z.shape) == 2, 'Expecting a 2D array or a sequence of components.'
+        columns = [z[:, c] for c in range(z.shape[1])]
+    assert columns, 'Expecting at least one component.'
+    dtype = columns[0].dtype
+    length = len(columns[0])
+    for column in columns:
+        assert len(column.shape) == 1, 'Components must be 1D arrays.'
+        assert len(column) == length, 'Components must have the same length.'
+        assert column.dtype == dtype, 'Components must have the same type.'
+    dtype = get_numpy_array_type(get_vtk_array_type(dtype))
+    columns = [numpy.ascontiguousarray(c, dtype=dtype) for c in columns]
+    if deep:
+        columns = [c.copy() for c in columns]
+
+    result_array = vtkSOADataArrayTemplate[numpy.dtype(dtype).name]()
+    result_array.SetNumberOfComponents(len(columns))
+    for c, column in enumerate(columns):
+        # save the memory of the column, which the VTK array must not free.
+        result_array.SetArray(c, column, length, True, True)
+    result_array._numpy_reference = columns
+    return result_array
+
+def vtk_to_numpy_cell_array(cell_array):
+    """Returns the offsets and the connectivity of a vtkCellArray as two
+    numpy arrays sharing its memory.
+
+    The offsets have one more value than the number of cells, the last
+    being the size of the connectivity, whose values are the point ids of
+    the cells.
+    """
+    return vtk_to_numpy(cell_array.GetOffsetsArray()), \
+           vtk_to_numpy(cell_array.GetConnectivityArray())
+
+def numpy_to_vtk_cell_array(offsets, connectivity, deep=0):
+    """Converts offsets and connectivity arrays, laid out as returned by
+    vtk_to_numpy_cell_array, to a vtkCellArray sharing their memory.
+
+    The arrays are converted to the same 32 or 64 bit integer type, the one
+    of the connectivity, which copies the offsets if their type differs.
+    The cell array keeps the arrays alive.
+    """
+    from vtkmodules.vtkCommonDataModel import vtkCellArray
+    connectivity = _as_host_array(connectivity)
+    if connectivity.dtype == numpy.int32:
+        dtype = numpy.int32
+    else:
+        dtype = numpy.int64
+    vtk_connectivity = numpy_to_vtk(connectivity.astype(dtype, copy=False), deep)
+    vtk_offsets = numpy_to_vtk(_as_host_array(offsets).astype(dtype, copy=False), deep)
+    cell_array = vtkCellArray()
+    if not cell_array.SetData(vtk_offsets, vtk_connectivity):
+        raise ValueError('Invalid offsets or connectivity.')
+    return cell_array
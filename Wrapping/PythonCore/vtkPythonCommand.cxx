@@ -28,18 +28,23 @@ vtkPythonCommand::vtkPythonCommand()
 
 vtkPythonCommand::~vtkPythonCommand()
 {
-  vtkPythonUtil::UnRegisterPythonCommand(this);
-  if (this->obj && Py_IsInitialized())
+  // the command can be deleted during a call that released the GIL
+  if (Py_IsInitialized())
   {
-    vtkPythonScopeGilEnsurer gilEnsurer;
-    Py_DECREF(this->obj);
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
+    vtkPythonUtil::UnRegisterPythonCommand(this);
+    Py_XDECREF(this->obj);
+  }
+  else
+  {
+    vtkPythonUtil::UnRegisterPythonCommand(this);
   }
   this->obj = nullptr;
 }
 
 void vtkPythonCommand::SetObject(PyObject* o)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   Py_INCREF(o);
   this->obj = o;
 }
@@ -33,7 +33,7 @@ vtkSmartPyObject::vtkSmartPyObject(PyObject* obj)
 vtkSmartPyObject::vtkSmartPyObject(const vtkSmartPyObject& other)
   : Object(other.Object)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   Py_XINCREF(this->Object);
 }
 
@@ -42,7 +42,7 @@ vtkSmartPyObject::~vtkSmartPyObject()
 {
   if (Py_IsInitialized())
   {
-    vtkPythonScopeGilEnsurer gilEnsurer;
+    vtkPythonScopeGilEnsurer gilEnsurer(true);
     Py_XDECREF(this->Object);
   }
 }
@@ -55,7 +55,7 @@ vtkSmartPyObject& vtkSmartPyObject::operator=(const vtkSmartPyObject& other)
     return *this;
   }
 
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   Py_XDECREF(this->Object);
   this->Object = other.Object;
   Py_XINCREF(this->Object);
@@ -65,7 +65,7 @@ vtkSmartPyObject& vtkSmartPyObject::operator=(const vtkSmartPyObject& other)
 //------------------------------------------------------------------------------
 vtkSmartPyObject& vtkSmartPyObject::operator=(PyObject* obj)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   Py_XDECREF(this->Object);
   this->Object = obj;
   Py_XINCREF(this->Object);
@@ -75,7 +75,7 @@ vtkSmartPyObject& vtkSmartPyObject::operator=(PyObject* obj)
 //------------------------------------------------------------------------------
 void vtkSmartPyObject::TakeReference(PyObject* obj)
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   Py_XDECREF(this->Object);
   this->Object = obj;
 }
@@ -115,7 +115,7 @@ PyObject* vtkSmartPyObject::GetPointer() const
 //------------------------------------------------------------------------------
 PyObject* vtkSmartPyObject::GetAndIncreaseReferenceCount()
 {
-  vtkPythonScopeGilEnsurer gilEnsurer;
+  vtkPythonScopeGilEnsurer gilEnsurer(true);
   Py_XINCREF(this->Object);
   return this->Object;
 }
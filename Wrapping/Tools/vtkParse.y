@@ -4366,6 +4366,11 @@ static void handle_attribute(const char* att, int pack)
     {
       addAttribute(VTK_PARSE_NEWINSTANCE);
     }
+    else if (l == 19 && strncmp(att, "vtk::unblockthreads", l) == 0 && !args &&
+      role == VTK_PARSE_ATTRIB_DECL)
+    {
+      addAttribute(VTK_PARSE_UNBLOCKTHREADS);
+    }
     else if (l == 13 && strncmp(att, "vtk::zerocopy", l) == 0 && !args &&
       role == VTK_PARSE_ATTRIB_DECL)
     {
@@ -324,6 +324,12 @@ int vtkWrap_IsNewInstance(ValueInfo* val)
   return ((val->Attributes & VTK_PARSE_NEWINSTANCE) != 0);
 }
 
+int vtkWrap_IsUnblockThreads(FunctionInfo* func)
+{
+  /* the hint is kept with the return value, so that overrides inherit it */
+  return (func->ReturnValue && (func->ReturnValue->Attributes & VTK_PARSE_UNBLOCKTHREADS) != 0);
+}
+
 /* -------------------------------------------------------------------- */
 /* Constructor/Destructor checks */
 
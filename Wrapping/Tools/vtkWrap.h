@@ -109,9 +109,11 @@ extern "C"
   /**
    * Hints.
    * NewInstance objects must be freed by the caller.
+   * UnblockThreads methods let other threads run while they are called.
    */
   /*@{*/
   VTKWRAPPINGTOOLS_EXPORT int vtkWrap_IsNewInstance(ValueInfo* val);
+  VTKWRAPPINGTOOLS_EXPORT int vtkWrap_IsUnblockThreads(FunctionInfo* func);
   /*@}*/
 
   /**
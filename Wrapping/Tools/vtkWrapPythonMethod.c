@@ -816,12 +816,23 @@ static void vtkWrapPython_GenerateMethodCall(
   ValueInfo* arg;
   int totalArgs;
   int is_constructor;
+  int unblock_threads;
   int i, k, n;
 
   totalArgs = vtkWrap_CountWrappedParameters(currentFunction);
 
   is_constructor = vtkWrap_IsConstructor(data, currentFunction);
 
+  /* release the GIL during the call, callbacks into python take it back */
+  unblock_threads = (vtkWrap_IsUnblockThreads(currentFunction) && !is_constructor);
+  if (unblock_threads)
+  {
+    fprintf(fp,
+      "#ifndef VTK_NO_PYTHON_THREADS\n"
+      "    PyThreadState *threadState = PyEval_SaveThread();\n"
+      "#endif\n");
+  }
+
   /* for vtkobjects, do a bound call and an unbound call */
   n = 1;
   if (is_vtkobject && !currentFunction->IsStatic && !currentFunction->IsPureVirtual &&
@@ -972,6 +983,14 @@ static void vtkWrapPython_GenerateMethodCall(
     }
   }
 
+  if (unblock_threads)
+  {
+    fprintf(fp,
+      "#ifndef VTK_NO_PYTHON_THREADS\n"
+      "    PyEval_RestoreThread(threadState);\n"
+      "#endif\n");
+  }
+
   if (is_constructor)
   {
     /* initialize tuples created with default constructor */